@@ -1164,6 +1164,29 @@ if (BUILD_CUDA_MODULE)
     list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS ${CUDA_NPP_TARGET})
 endif ()
 
+# nvJPEG
+if (BUILD_CUDA_MODULE AND WITH_NVJPEG)
+    add_library(3rdparty_CUDA_NVJPEG INTERFACE)
+    target_link_libraries(3rdparty_CUDA_NVJPEG INTERFACE CUDA::nvjpeg)
+    if(NOT BUILD_SHARED_LIBS)
+        install(TARGETS 3rdparty_CUDA_NVJPEG EXPORT ${PROJECT_NAME}Targets)
+    endif()
+    set(CUDA_NVJPEG_TARGET 3rdparty_CUDA_NVJPEG)
+    list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS ${CUDA_NVJPEG_TARGET})
+endif ()
+
+# NVRTC
+if (BUILD_CUDA_MODULE AND WITH_NVRTC)
+    add_library(3rdparty_CUDA_NVRTC INTERFACE)
+    target_link_libraries(3rdparty_CUDA_NVRTC INTERFACE CUDA::nvrtc
+        CUDA::cuda_driver)
+    if(NOT BUILD_SHARED_LIBS)
+        install(TARGETS 3rdparty_CUDA_NVRTC EXPORT ${PROJECT_NAME}Targets)
+    endif()
+    set(CUDA_NVRTC_TARGET 3rdparty_CUDA_NVRTC)
+    list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS ${CUDA_NVRTC_TARGET})
+endif ()
+
 # IPP
 if (WITH_IPPICV)
     # Ref: https://stackoverflow.com/a/45125525
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FaissIndex.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+// Points uniformly distributed in the unit cube.
+static Tensor RandomPoints(int64_t num_points, const Device& device) {
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> points(num_points * 3);
+    for (float& p : points) {
+        p = dist(engine);
+    }
+    return Tensor(points, {num_points, 3}, Dtype::Float32, device);
+}
+
+// Radius with \p num_neighbors expected neighbors among \p num_points random
+// points, so that the output sizes stay comparable across point counts.
+static double RadiusForNeighbors(int64_t num_points, int64_t num_neighbors) {
+    return std::cbrt(num_neighbors / (4.0 / 3.0 * M_PI * num_points));
+}
+
+// Args: {num_points, knn}. Queries are the dataset points.
+template <class Index>
+static void SearchKnnBenchmark(benchmark::State& state, const Device& device) {
+    Tensor points = RandomPoints(state.range(0), device);
+    int knn = state.range(1);
+    Index index(points);
+    // Warm up.
+    index.SearchKnn(points, knn);
+    for (auto _ : state) {
+        index.SearchKnn(points, knn);
+    }
+}
+
+static void NanoFlannSearchKnn(benchmark::State& state, const Device& device) {
+    SearchKnnBenchmark<NanoFlannIndex>(state, device);
+}
+
+// Args: {num_points, expected_neighbors}.
+static void NanoFlannSearchRadius(benchmark::State& state,
+                                  const Device& device) {
+    Tensor points = RandomPoints(state.range(0), device);
+    double radius = RadiusForNeighbors(state.range(0), state.range(1));
+    NanoFlannIndex index(points);
+    index.SearchRadius(points, radius);
+    for (auto _ : state) {
+        index.SearchRadius(points, radius);
+    }
+}
+
+// Args: {num_points, expected_neighbors, max_knn}.
+static void NanoFlannSearchHybrid(benchmark::State& state,
+                                  const Device& device) {
+    Tensor points = RandomPoints(state.range(0), device);
+    double radius = RadiusForNeighbors(state.range(0), state.range(1));
+    int max_knn = state.range(2);
+    NanoFlannIndex index(points);
+    Tensor indices, distances;
+    index.SearchHybrid(points, radius, max_knn, indices, distances);
+    for (auto _ : state) {
+        index.SearchHybrid(points, radius, max_knn, indices, distances);
+    }
+}
+
+// Args: {num_points}. Measures index construction.
+static void NanoFlannBuild(benchmark::State& state, const Device& device) {
+    Tensor points = RandomPoints(state.range(0), device);
+    for (auto _ : state) {
+        NanoFlannIndex index(points);
+    }
+}
+
+BENCHMARK_CAPTURE(NanoFlannBuild, CPU, Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Range(10000, 1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NanoFlannSearchKnn, CPU, Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NanoFlannSearchRadius, CPU, Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NanoFlannSearchHybrid, CPU, Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}, {8, 32}})
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef WITH_FAISS
+static void FaissSearchKnn(benchmark::State& state, const Device& device) {
+    SearchKnnBenchmark<FaissIndex>(state, device);
+}
+
+BENCHMARK_CAPTURE(FaissSearchKnn, CPU, Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(FaissSearchKnn, CUDA, Device("CUDA:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+#endif
+
+#ifdef BUILD_CUDA_MODULE
+// Args: {num_points, expected_neighbors}.
+static void FixedRadiusSearchRadius(benchmark::State& state,
+                                    const Device& device) {
+    Tensor points = RandomPoints(state.range(0), device);
+    double radius = RadiusForNeighbors(state.range(0), state.range(1));
+    FixedRadiusIndex index(points, radius);
+    index.SearchRadius(points, radius);
+    for (auto _ : state) {
+        index.SearchRadius(points, radius);
+    }
+}
+
+// Args: {num_points, expected_neighbors, max_knn}.
+static void FixedRadiusSearchHybrid(benchmark::State& state,
+                                    const Device& device) {
+    Tensor points = RandomPoints(state.range(0), device);
+    double radius = RadiusForNeighbors(state.range(0), state.range(1));
+    int max_knn = state.range(2);
+    FixedRadiusIndex index(points, radius);
+    Tensor indices, distances;
+    index.SearchHybrid(points, radius, max_knn, indices, distances);
+    for (auto _ : state) {
+        index.SearchHybrid(points, radius, max_knn, indices, distances);
+    }
+}
+
+// Args: {num_points, expected_neighbors}. Measures index construction.
+static void FixedRadiusBuild(benchmark::State& state, const Device& device) {
+    Tensor points = RandomPoints(state.range(0), device);
+    double radius = RadiusForNeighbors(state.range(0), state.range(1));
+    for (auto _ : state) {
+        FixedRadiusIndex index(points, radius);
+    }
+}
+
+static void KnnSearchKnn(benchmark::State& state, const Device& device) {
+    SearchKnnBenchmark<KnnIndex>(state, device);
+}
+
+BENCHMARK_CAPTURE(FixedRadiusBuild, CUDA, Device("CUDA:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusSearchRadius, CUDA, Device("CUDA:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusSearchHybrid, CUDA, Device("CUDA:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}, {8, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(KnnSearchKnn, CUDA, Device("CUDA:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
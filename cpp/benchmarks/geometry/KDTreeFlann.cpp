@@ -28,6 +28,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cmath>
+#include <random>
+
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 
@@ -96,5 +99,111 @@ BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
 
+// Random points in the unit cube, queried at every dataset point. Args are
+// {num_points, knn} for knn searches and {num_points, expected_neighbors} for
+// radius searches.
+class TestKDTreeRandom {
+    geometry::PointCloud pc_;
+    geometry::KDTreeFlann kdtree_;
+    int size_ = 0;
+
+public:
+    void setup(int size) {
+        if (this->size_ == size) return;
+        utility::LogInfo("setup KDTree size={:d}", size);
+        this->size_ = size;
+        pc_.Clear();
+        std::mt19937 engine(0);
+        std::uniform_real_distribution<double> dist(0., 1.);
+        for (int i = 0; i < size; ++i) {
+            pc_.points_.push_back({dist(engine), dist(engine), dist(engine)});
+        }
+        kdtree_.SetGeometry(pc_);
+    }
+
+    double radius(int num_neighbors) const {
+        return std::cbrt(num_neighbors / (4.0 / 3.0 * M_PI * size_));
+    }
+
+    const geometry::PointCloud& cloud() const { return pc_; }
+    const geometry::KDTreeFlann& kdtree() const { return kdtree_; }
+};
+TestKDTreeRandom testKDTreeRandom;
+
+static void BM_TestKDTreeRandomKNN(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    int knn = state.range(1);
+    const auto& points = testKDTreeRandom.cloud().points_;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (const Eigen::Vector3d& query : points) {
+            testKDTreeRandom.kdtree().SearchKNN(query, knn, indices,
+                                                distance2);
+        }
+    }
+}
+
+static void BM_TestKDTreeRandomKNNBatch(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    int knn = state.range(1);
+    const auto& points = testKDTreeRandom.cloud().points_;
+    Eigen::MatrixXd queries(3, points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        queries.col(i) = points[i];
+    }
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        testKDTreeRandom.kdtree().SearchKNNBatch(queries, knn, indices,
+                                                 distance2);
+    }
+}
+
+static void BM_TestKDTreeRandomRadius(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    double radius = testKDTreeRandom.radius(state.range(1));
+    const auto& points = testKDTreeRandom.cloud().points_;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (const Eigen::Vector3d& query : points) {
+            testKDTreeRandom.kdtree().SearchRadius(query, radius, indices,
+                                                   distance2);
+        }
+    }
+}
+
+static void BM_TestKDTreeRandomHybrid(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    double radius = testKDTreeRandom.radius(state.range(1));
+    const auto& points = testKDTreeRandom.cloud().points_;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (const Eigen::Vector3d& query : points) {
+            testKDTreeRandom.kdtree().SearchHybrid(query, radius, 32, indices,
+                                                   distance2);
+        }
+    }
+}
+
+BENCHMARK(BM_TestKDTreeRandomKNN)
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomKNNBatch)
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomRadius)
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomHybrid)
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/PointCloud.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace geometry {
+
+// Reference point cloud shared by all legacy point cloud benchmarks, so that
+// timings are comparable across commits.
+static const std::string path = std::string(TEST_DATA_DIR) + "/fragment.ply";
+
+static std::shared_ptr<PointCloud> ReadDownSampled(double voxel_size) {
+    auto pcd = io::CreatePointCloudFromFile(path);
+    if (voxel_size > 0) {
+        pcd = pcd->VoxelDownSample(voxel_size);
+    }
+    return pcd;
+}
+
+static void EstimateNormals(benchmark::State& state,
+                            double voxel_size,
+                            const KDTreeSearchParam& search_param) {
+    auto pcd = ReadDownSampled(voxel_size);
+    for (auto _ : state) {
+        pcd->EstimateNormals(search_param);
+    }
+    state.counters["points"] = static_cast<double>(pcd->points_.size());
+}
+
+static void RemoveStatisticalOutliers(benchmark::State& state,
+                                      double voxel_size,
+                                      size_t nb_neighbors) {
+    auto pcd = ReadDownSampled(voxel_size);
+    for (auto _ : state) {
+        auto result = pcd->RemoveStatisticalOutliers(nb_neighbors, 2.0);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["points"] = static_cast<double>(pcd->points_.size());
+}
+
+static void ClusterDBSCAN(benchmark::State& state,
+                          double voxel_size,
+                          double eps) {
+    auto pcd = ReadDownSampled(voxel_size);
+    for (auto _ : state) {
+        auto labels = pcd->ClusterDBSCAN(eps, 10);
+        benchmark::DoNotOptimize(labels);
+    }
+    state.counters["points"] = static_cast<double>(pcd->points_.size());
+}
+
+BENCHMARK_CAPTURE(EstimateNormals, Full_KNN30, 0.0, KDTreeSearchParamKNN(30))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(EstimateNormals,
+                  Full_Hybrid,
+                  0.0,
+                  KDTreeSearchParamHybrid(0.02, 30))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(EstimateNormals, Down_0_01_KNN30, 0.01,
+                  KDTreeSearchParamKNN(30))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RemoveStatisticalOutliers, Full_20, 0.0, 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RemoveStatisticalOutliers, Down_0_01_20, 0.01, 20)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ClusterDBSCAN, Down_0_01, 0.01, 0.02)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN, Down_0_02, 0.02, 0.04)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace open3d
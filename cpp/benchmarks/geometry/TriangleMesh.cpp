@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMesh.h"
+
+#include <benchmark/benchmark.h>
+#include <limits>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace geometry {
+
+static void SimplifyQuadricDecimation(benchmark::State& state,
+                                      double target_ratio,
+                                      bool parallel) {
+    // The knot mesh subdivided twice has 46080 triangles.
+    auto mesh = io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply")
+                        ->SubdivideLoop(2);
+    int target = static_cast<int>(target_ratio * mesh->triangles_.size());
+    for (auto _ : state) {
+        auto simplified =
+                parallel ? mesh->SimplifyQuadricDecimationParallel(
+                                   target, std::numeric_limits<double>::max(),
+                                   1.0)
+                         : mesh->SimplifyQuadricDecimation(
+                                   target, std::numeric_limits<double>::max(),
+                                   1.0);
+        benchmark::DoNotOptimize(simplified);
+    }
+    state.counters["triangles"] = static_cast<double>(mesh->triangles_.size());
+}
+
+// Oriented reference point cloud used by the surface reconstruction
+// benchmarks.
+static std::shared_ptr<PointCloud> ReadOrientedPointCloud(double voxel_size) {
+    auto pcd = io::CreatePointCloudFromFile(TEST_DATA_DIR "/fragment.ply");
+    pcd = pcd->VoxelDownSample(voxel_size);
+    if (!pcd->HasNormals()) {
+        pcd->EstimateNormals();
+        pcd->OrientNormalsTowardsCameraLocation();
+    }
+    return pcd;
+}
+
+static void CreateFromPointCloudPoisson(benchmark::State& state,
+                                        double voxel_size,
+                                        size_t depth) {
+    auto pcd = ReadOrientedPointCloud(voxel_size);
+    for (auto _ : state) {
+        auto result = TriangleMesh::CreateFromPointCloudPoisson(*pcd, depth);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["points"] = static_cast<double>(pcd->points_.size());
+}
+
+static void CreateFromPointCloudBallPivoting(benchmark::State& state,
+                                             double voxel_size) {
+    auto pcd = ReadOrientedPointCloud(voxel_size);
+    std::vector<double> radii = {voxel_size * 2, voxel_size * 4};
+    for (auto _ : state) {
+        auto mesh = TriangleMesh::CreateFromPointCloudBallPivoting(*pcd, radii);
+        benchmark::DoNotOptimize(mesh);
+    }
+    state.counters["points"] = static_cast<double>(pcd->points_.size());
+}
+
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation, Ratio_0_5, 0.5, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation, Ratio_0_1, 0.1, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation, Parallel_Ratio_0_5, 0.5, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation, Parallel_Ratio_0_1, 0.1, true)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(CreateFromPointCloudPoisson, Depth_8, 0.01, 8)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CreateFromPointCloudPoisson, Depth_10, 0.01, 10)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(CreateFromPointCloudBallPivoting, Down_0_01, 0.01)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CreateFromPointCloudBallPivoting, Down_0_02, 0.02)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/contrib/contrib_nns.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+// Points uniformly distributed in the unit cube.
+static core::Tensor RandomPoints(int64_t num_points,
+                                 const core::Device& device) {
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> points(num_points * 3);
+    for (float& p : points) {
+        p = dist(engine);
+    }
+    return core::Tensor(points, {num_points, 3}, core::Dtype::Float32, device);
+}
+
+// Args: {num_points, knn}. Includes building the index, as the wrapper does
+// on every call.
+static void ContribKnnSearch(benchmark::State& state,
+                             const core::Device& device) {
+    core::Tensor points = RandomPoints(state.range(0), device);
+    int knn = state.range(1);
+    for (auto _ : state) {
+        KnnSearch(points, points, knn);
+    }
+}
+
+// Args: {num_points, expected_neighbors, num_batches}. Points are split into
+// equally sized batches, searched independently.
+static void ContribRadiusSearch(benchmark::State& state,
+                                const core::Device& device) {
+    int64_t num_points = state.range(0);
+    int64_t num_batches = state.range(2);
+    int64_t batch_size = num_points / num_batches;
+    num_points = batch_size * num_batches;
+    core::Tensor points = RandomPoints(num_points, device);
+    core::Tensor batches =
+            core::Tensor::Full({num_batches}, batch_size, core::Dtype::Int32);
+    double radius =
+            std::cbrt(state.range(1) / (4.0 / 3.0 * M_PI * batch_size));
+    for (auto _ : state) {
+        RadiusSearch(points, points, batches, batches, radius);
+    }
+}
+
+BENCHMARK_CAPTURE(ContribKnnSearch, CPU, core::Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ContribKnnSearch, CUDA, core::Device("CUDA:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(ContribRadiusSearch, CPU, core::Device("CPU:0"))
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 32}, {1, 10}})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
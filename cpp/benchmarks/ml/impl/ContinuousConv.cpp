@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/impl/continuous_conv/ContinuousConv.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+// Points uniformly distributed in the unit cube.
+static std::vector<float> RandomPoints(int64_t num_points) {
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> points(num_points * 3);
+    for (float& p : points) {
+        p = dist(engine);
+    }
+    return points;
+}
+
+// Args: {num_points, expected_neighbors, channels}. The neighbors of each
+// point are all points within the radius that contains expected_neighbors
+// points on average. Throughput is reported in points per second.
+static void CConvComputeFeatures(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const int64_t channels = state.range(2);
+    const std::vector<int> filter_dims = {4, 4, 4, int(channels),
+                                          int(channels)};
+    const float radius = std::cbrt(state.range(1) /
+                                   (4.0 / 3.0 * M_PI * num_points));
+
+    const std::vector<float> points = RandomPoints(num_points);
+    core::Tensor points_t(points, {num_points, 3}, core::Dtype::Float32);
+    core::nns::NearestNeighborSearch nns(points_t);
+    nns.FixedRadiusIndex(radius);
+    core::Tensor neighbors_index, distances, num_neighbors;
+    std::tie(neighbors_index, distances, num_neighbors) =
+            nns.FixedRadiusSearch(points_t, radius, false);
+    neighbors_index = neighbors_index.Contiguous();
+    std::vector<int64_t> row_splits(num_points + 1, 0);
+    const std::vector<int64_t> counts = num_neighbors.ToFlatVector<int64_t>();
+    for (int64_t i = 0; i < num_points; ++i) {
+        row_splits[i + 1] = row_splits[i] + counts[i];
+    }
+
+    std::mt19937 engine(1);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> filter(64 * channels * channels);
+    std::vector<float> features(num_points * channels);
+    for (float& v : filter) {
+        v = dist(engine);
+    }
+    for (float& v : features) {
+        v = dist(engine);
+    }
+    std::vector<float> out_features(num_points * channels);
+    const float extent = 2 * radius;
+    const float offset[3] = {0, 0, 0};
+
+    for (auto _ : state) {
+        CConvComputeFeaturesCPU<float, int64_t>(
+                out_features.data(), filter_dims, filter.data(), num_points,
+                points.data(), num_points, points.data(), features.data(),
+                nullptr, neighbors_index.GetLength(),
+                neighbors_index.GetDataPtr<int64_t>(), nullptr,
+                row_splits.data(), &extent, offset, InterpolationMode::LINEAR,
+                CoordinateMapping::BALL_TO_CUBE_RADIAL, true, false, true,
+                true);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+    state.counters["neighbors"] = double(row_splits.back()) / num_points;
+}
+
+BENCHMARK(CConvComputeFeatures)
+        ->RangeMultiplier(4)
+        ->Ranges({{10000, 100000}, {8, 128}, {8, 32}})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/impl/misc/Voxelize.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NeighborListOps.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+// Points uniformly distributed in the unit cube.
+static std::vector<float> RandomPoints(int64_t num_points) {
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> points(num_points * 3);
+    for (float& p : points) {
+        p = dist(engine);
+    }
+    return points;
+}
+
+// Row splits of num_rows rows with uniformly distributed lengths with mean
+// row_length.
+static core::Tensor RandomRowSplits(int64_t num_rows,
+                                    int64_t row_length,
+                                    const core::Device& device) {
+    std::mt19937 engine(0);
+    std::uniform_int_distribution<int64_t> dist(0, 2 * row_length);
+    std::vector<int64_t> row_splits(num_rows + 1, 0);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        row_splits[i + 1] = row_splits[i] + dist(engine);
+    }
+    return core::Tensor(row_splits, {num_rows + 1}, core::Dtype::Int64,
+                        device);
+}
+
+// Waits for queued CUDA kernels, such that the timing includes them.
+static void Synchronize(const core::Device& device) {
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        core::CUDAStream::GetCurrent().Synchronize();
+    }
+}
+
+struct VoxelizeOutputAllocator {
+    void AllocVoxelCoords(int32_t** ptr, int64_t rows, int64_t cols) {
+        voxel_coords.resize(rows * cols);
+        *ptr = voxel_coords.data();
+    }
+    void AllocVoxelPointIndices(int64_t** ptr, int64_t size) {
+        point_indices.resize(size);
+        *ptr = point_indices.data();
+    }
+    void AllocVoxelPointRowSplits(int64_t** ptr, int64_t size) {
+        row_splits.resize(size);
+        *ptr = row_splits.data();
+    }
+    std::vector<int32_t> voxel_coords;
+    std::vector<int64_t> point_indices;
+    std::vector<int64_t> row_splits;
+};
+
+// Args: {num_points, points_per_voxel}. The voxel size is chosen such that
+// each voxel contains points_per_voxel points on average.
+static void Voxelize(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const std::vector<float> points = RandomPoints(num_points);
+    const float voxel_size =
+            std::cbrt(float(state.range(1)) / float(num_points));
+    const float voxel_sizes[3] = {voxel_size, voxel_size, voxel_size};
+    const float range_min[3] = {0, 0, 0};
+    const float range_max[3] = {1, 1, 1};
+    for (auto _ : state) {
+        VoxelizeOutputAllocator allocator;
+        VoxelizeCPU<float, 3>(num_points, points.data(), voxel_sizes,
+                              range_min, range_max, 32, num_points, allocator);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
+// Args: {num_rows, row_length}.
+static void ReduceSubarraysSum(benchmark::State& state,
+                               const core::Device& device) {
+    core::Tensor row_splits =
+            RandomRowSplits(state.range(0), state.range(1), device);
+    const int64_t num_values = row_splits[-1].Item<int64_t>();
+    core::Tensor values =
+            core::Tensor::Ones({num_values}, core::Dtype::Float32, device);
+    for (auto _ : state) {
+        core::nns::ReduceSubarraysSum(values, row_splits);
+        Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+// Args: {num_rows, row_length}. The output has row_length columns.
+static void RaggedToDense(benchmark::State& state,
+                          const core::Device& device) {
+    core::Tensor row_splits =
+            RandomRowSplits(state.range(0), state.range(1), device);
+    const int64_t num_values = row_splits[-1].Item<int64_t>();
+    core::Tensor values =
+            core::Tensor::Ones({num_values}, core::Dtype::Int64, device);
+    core::Tensor default_value =
+            core::Tensor::Full({}, -1, core::Dtype::Int64, device);
+    for (auto _ : state) {
+        core::nns::RaggedToDense(values, row_splits, state.range(1),
+                                 default_value);
+        Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+// Args: {num_points, neighbors_per_point}. Inverts a neighbors list with
+// random indices and one attribute per neighbor.
+static void InvertNeighborsList(benchmark::State& state,
+                                const core::Device& device) {
+    const int64_t num_points = state.range(0);
+    core::Tensor row_splits =
+            RandomRowSplits(num_points, state.range(1), device);
+    const int64_t num_neighbors = row_splits[-1].Item<int64_t>();
+    std::mt19937 engine(1);
+    std::uniform_int_distribution<int32_t> dist(0, num_points - 1);
+    std::vector<int32_t> index(num_neighbors);
+    for (int32_t& i : index) {
+        i = dist(engine);
+    }
+    core::Tensor index_t(index, {num_neighbors}, core::Dtype::Int32, device);
+    core::Tensor attributes =
+            core::Tensor::Ones({num_neighbors}, core::Dtype::Float32, device);
+    core::Tensor out_index, out_row_splits, out_attributes;
+    for (auto _ : state) {
+        core::nns::InvertNeighborsList(num_points, index_t, row_splits,
+                                       attributes, out_index, out_row_splits,
+                                       out_attributes);
+        Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * num_neighbors);
+}
+
+// Args: {num_points, num_samples}.
+static void FarthestPointSample(benchmark::State& state,
+                                const core::Device& device) {
+    const int64_t num_points = state.range(0);
+    core::Tensor points(RandomPoints(num_points), {num_points, 3},
+                        core::Dtype::Float32, device);
+    core::Tensor indices;
+    for (auto _ : state) {
+        t::geometry::kernel::pointcloud::FarthestPointSample(
+                points, state.range(1), 0, indices);
+        Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points * state.range(1));
+}
+
+BENCHMARK(Voxelize)
+        ->RangeMultiplier(10)
+        ->Ranges({{10000, 1000000}, {1, 100}})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ReduceSubarraysSum, CPU, core::Device("CPU:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {8, 64}})
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ReduceSubarraysSum, CUDA, core::Device("CUDA:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {8, 64}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(RaggedToDense, CPU, core::Device("CPU:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {8, 64}})
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(RaggedToDense, CUDA, core::Device("CUDA:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {8, 64}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(InvertNeighborsList, CPU, core::Device("CPU:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {8, 64}})
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(InvertNeighborsList, CUDA, core::Device("CUDA:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {8, 64}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(FarthestPointSample, CPU, core::Device("CPU:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {512, 4096}})
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(FarthestPointSample, CUDA, core::Device("CUDA:0"))
+        ->RangeMultiplier(8)
+        ->Ranges({{8192, 524288}, {512, 4096}})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
@@ -100,6 +100,22 @@ void VoxelDownSample(benchmark::State& state,
     }
 }
 
+void VoxelDownSampleAndTrace(benchmark::State& state,
+                             const core::Device& device,
+                             float voxel_size) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+    core::Tensor trace;
+
+    // Warp up
+    pcd.VoxelDownSampleAndTrace(voxel_size, trace);
+
+    for (auto _ : state) {
+        pcd.VoxelDownSampleAndTrace(voxel_size, trace);
+    }
+}
+
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -129,13 +145,15 @@ BENCHMARK_CAPTURE(ToLegacyPointCloud, CUDA, core::Device("CUDA:0"))
             ->Unit(benchmark::kMillisecond);
 
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_VOXELDOWNSAMPLE_BACKEND()                                 \
-    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashmapBackend::TBB)   \
-    ENUM_VOXELSIZE(core::Device("CUDA:0"), core::HashmapBackend::Slab) \
+#define ENUM_VOXELDOWNSAMPLE_BACKEND()                                         \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashmapBackend::TBB)           \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashmapBackend::LinearProbing) \
+    ENUM_VOXELSIZE(core::Device("CUDA:0"), core::HashmapBackend::Slab)         \
     ENUM_VOXELSIZE(core::Device("CUDA:0"), core::HashmapBackend::StdGPU)
 #else
-#define ENUM_VOXELDOWNSAMPLE_BACKEND() \
-    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashmapBackend::TBB)
+#define ENUM_VOXELDOWNSAMPLE_BACKEND()                                 \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashmapBackend::TBB)   \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashmapBackend::LinearProbing)
 #endif
 
 BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_01, 0.01)
@@ -152,6 +170,19 @@ BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_32, 0.32)
         ->Unit(benchmark::kMillisecond);
 ENUM_VOXELDOWNSAMPLE_BACKEND()
 
+#define ENUM_VOXELSIZE_AND_TRACE(DEVICE, NAME)                               \
+    BENCHMARK_CAPTURE(VoxelDownSampleAndTrace, NAME##_0_01, DEVICE, 0.01)    \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(VoxelDownSampleAndTrace, NAME##_0_04, DEVICE, 0.04)    \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(VoxelDownSampleAndTrace, NAME##_0_16, DEVICE, 0.16)    \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_VOXELSIZE_AND_TRACE(core::Device("CPU:0"), CPU)
+#ifdef BUILD_CUDA_MODULE
+ENUM_VOXELSIZE_AND_TRACE(core::Device("CUDA:0"), CUDA)
+#endif
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
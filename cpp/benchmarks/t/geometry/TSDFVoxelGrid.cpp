@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// Reference RGB-D sequence shared by all TSDFVoxelGrid benchmarks.
+class TSDFSequence {
+public:
+    TSDFSequence(const core::Device& device) {
+        camera::PinholeCameraIntrinsic intrinsic =
+                camera::PinholeCameraIntrinsic(
+                        camera::PinholeCameraIntrinsicParameters::
+                                PrimeSenseDefault);
+        auto focal_length = intrinsic.GetFocalLength();
+        auto principal_point = intrinsic.GetPrincipalPoint();
+        intrinsic_ = core::Tensor::Init<double>(
+                {{focal_length.first, 0, principal_point.first},
+                 {0, focal_length.second, principal_point.second},
+                 {0, 0, 1}});
+        width_ = intrinsic.width_;
+        height_ = intrinsic.height_;
+
+        auto trajectory = open3d::io::CreatePinholeCameraTrajectoryFromFile(
+                std::string(TEST_DATA_DIR) + "/RGBD/odometry.log");
+        for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+            depths_.push_back(t::io::CreateImageFromFile(
+                                      fmt::format("{}/RGBD/depth/{:05d}.png",
+                                                  TEST_DATA_DIR, i))
+                                      ->To(device));
+            colors_.push_back(t::io::CreateImageFromFile(
+                                      fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                                  TEST_DATA_DIR, i))
+                                      ->To(device));
+            extrinsics_.push_back(core::eigen_converter::EigenMatrixToTensor(
+                    trajectory->parameters_[i].extrinsic_));
+        }
+    }
+
+    void Integrate(TSDFVoxelGrid& voxel_grid) const {
+        for (size_t i = 0; i < depths_.size(); ++i) {
+            voxel_grid.Integrate(depths_[i], colors_[i], intrinsic_,
+                                 extrinsics_[i]);
+        }
+    }
+
+    std::vector<Image> depths_;
+    std::vector<Image> colors_;
+    std::vector<core::Tensor> extrinsics_;
+    core::Tensor intrinsic_;
+    int width_;
+    int height_;
+};
+
+static TSDFVoxelGrid CreateVoxelGrid(const core::Device& device,
+                                     const core::HashmapBackend& backend) {
+    return TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                          {"weight", core::Dtype::UInt16},
+                          {"color", core::Dtype::UInt16}},
+                         0.008f, 0.04f, 16, 1000, device, backend);
+}
+
+void Integrate(benchmark::State& state,
+               const core::Device& device,
+               const core::HashmapBackend& backend) {
+    TSDFSequence sequence(device);
+
+    // Warm up.
+    TSDFVoxelGrid warm_up = CreateVoxelGrid(device, backend);
+    sequence.Integrate(warm_up);
+
+    for (auto _ : state) {
+        TSDFVoxelGrid voxel_grid = CreateVoxelGrid(device, backend);
+        sequence.Integrate(voxel_grid);
+    }
+    state.counters["frames"] = static_cast<double>(sequence.depths_.size());
+}
+
+void RayCast(benchmark::State& state,
+             const core::Device& device,
+             const core::HashmapBackend& backend) {
+    TSDFSequence sequence(device);
+    TSDFVoxelGrid voxel_grid = CreateVoxelGrid(device, backend);
+    sequence.Integrate(voxel_grid);
+
+    int mask = TSDFVoxelGrid::SurfaceMaskCode::VertexMap |
+               TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+               TSDFVoxelGrid::SurfaceMaskCode::ColorMap |
+               TSDFVoxelGrid::SurfaceMaskCode::NormalMap;
+    for (auto _ : state) {
+        auto result = voxel_grid.RayCast(
+                sequence.intrinsic_, sequence.extrinsics_.back(),
+                sequence.width_, sequence.height_, 1000.0f, 0.1f, 3.0f, 3.0f,
+                mask);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void ExtractSurfacePoints(benchmark::State& state,
+                          const core::Device& device,
+                          const core::HashmapBackend& backend) {
+    TSDFSequence sequence(device);
+    TSDFVoxelGrid voxel_grid = CreateVoxelGrid(device, backend);
+    sequence.Integrate(voxel_grid);
+
+    for (auto _ : state) {
+        PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+        benchmark::DoNotOptimize(pcd);
+    }
+}
+
+void ExtractSurfaceMesh(benchmark::State& state,
+                        const core::Device& device,
+                        const core::HashmapBackend& backend) {
+    TSDFSequence sequence(device);
+    TSDFVoxelGrid voxel_grid = CreateVoxelGrid(device, backend);
+    sequence.Integrate(voxel_grid);
+
+    for (auto _ : state) {
+        TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+        benchmark::DoNotOptimize(mesh);
+    }
+}
+
+#define ENUM_TSDF_BENCHMARK(DEVICE_NAME, DEVICE, BACKEND)                    \
+    BENCHMARK_CAPTURE(Integrate, DEVICE_NAME##_##BACKEND, DEVICE,            \
+                      core::HashmapBackend::BACKEND)                         \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(RayCast, DEVICE_NAME##_##BACKEND, DEVICE,              \
+                      core::HashmapBackend::BACKEND)                         \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(ExtractSurfacePoints, DEVICE_NAME##_##BACKEND, DEVICE, \
+                      core::HashmapBackend::BACKEND)                         \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(ExtractSurfaceMesh, DEVICE_NAME##_##BACKEND, DEVICE,   \
+                      core::HashmapBackend::BACKEND)                         \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_TSDF_BENCHMARK(CPU, core::Device("CPU:0"), TBB)
+ENUM_TSDF_BENCHMARK(CPU, core::Device("CPU:0"), LinearProbing)
+#ifdef BUILD_CUDA_MODULE
+ENUM_TSDF_BENCHMARK(CUDA, core::Device("CUDA:0"), Slab)
+ENUM_TSDF_BENCHMARK(CUDA, core::Device("CUDA:0"), StdGPU)
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,315 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <ctime>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/MemoryStatistics.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Metrics.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Profiler.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace reconstruction {
+
+// End-to-end RGB-D reconstruction on the RGBD test sequence, following the
+// stages of the reconstruction system in examples/python:
+// 1. fragments: frame-to-frame odometry and TSDF integration per fragment,
+// 2. registration: ICP between consecutive fragments, initialized with the
+//    odometry of their shared frame,
+// 3. refine: multi-scale point-to-plane ICP,
+// 4. integrate: integration of all frames into one scene volume with the
+//    refined poses, and mesh extraction.
+//
+// After the timed iterations, the pipeline is run once more with the
+// profiler and the memory tracker enabled, and the stage timings, the peak
+// memory and the utilization are reported as counters. Pass
+// --benchmark_out=<file> --benchmark_out_format=json for a machine-readable
+// report, and see util/compare_benchmarks.py to compare reports.
+
+static constexpr const char* kStages[] = {"fragments", "registration",
+                                          "refine", "integrate"};
+static constexpr int kFramesPerFragment = 3;
+static constexpr float kVoxelSize = 0.008f;
+static constexpr float kDepthScale = 1000.0f;
+static constexpr float kDepthMax = 3.0f;
+
+struct Sequence {
+    std::vector<geometry::RGBDImage> frames_;
+    core::Tensor intrinsics_;
+};
+
+static Sequence LoadSequence(const core::Device& device) {
+    Sequence sequence;
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    sequence.intrinsics_ = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    for (int i = 0; i < 5; ++i) {
+        geometry::Image depth = *t::io::CreateImageFromFile(
+                fmt::format("{}/RGBD/depth/{:05d}.png", TEST_DATA_DIR, i));
+        geometry::Image color = *t::io::CreateImageFromFile(
+                fmt::format("{}/RGBD/color/{:05d}.jpg", TEST_DATA_DIR, i));
+        sequence.frames_.emplace_back(color.To(device), depth.To(device));
+    }
+    return sequence;
+}
+
+static geometry::TSDFVoxelGrid CreateVoxelGrid(const core::Device& device) {
+    return geometry::TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                                    {"weight", core::Dtype::UInt16},
+                                    {"color", core::Dtype::UInt16}},
+                                   kVoxelSize, 0.04f, 16, 1000, device);
+}
+
+/// Runs the pipeline and returns the number of triangles of the scene mesh.
+static int64_t RunPipeline(const Sequence& sequence,
+                           const core::Device& device) {
+    const core::Device host("CPU:0");
+    const int64_t num_frames = static_cast<int64_t>(sequence.frames_.size());
+
+    // Frame ranges [begin, end) of the fragments. Consecutive fragments share
+    // one frame, whose pose in both fragments initializes the registration.
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    for (int64_t begin = 0; begin + 1 < num_frames;
+         begin += kFramesPerFragment - 1) {
+        ranges.emplace_back(begin,
+                            std::min(begin + kFramesPerFragment, num_frames));
+    }
+
+    // Camera to fragment poses of every frame, and fragment point clouds.
+    std::vector<std::vector<core::Tensor>> frame_poses(ranges.size());
+    std::vector<geometry::PointCloud> fragments;
+    {
+        OPEN3D_CUDA_PROFILE_SCOPE("fragments", device);
+        for (const auto& range : ranges) {
+            std::vector<core::Tensor>& poses = frame_poses[fragments.size()];
+            odometry::RGBDOdometryTracker tracker(sequence.intrinsics_,
+                                                  kDepthScale, kDepthMax);
+            geometry::TSDFVoxelGrid voxel_grid = CreateVoxelGrid(device);
+            core::Tensor pose =
+                    core::Tensor::Eye(4, core::Dtype::Float64, host);
+            for (int64_t i = range.first; i < range.second; ++i) {
+                const geometry::RGBDImage& frame = sequence.frames_[i];
+                pose = pose.Matmul(tracker.Track(frame));
+                poses.push_back(pose);
+                voxel_grid.Integrate(frame.depth_, frame.color_,
+                                     sequence.intrinsics_, pose.Inverse(),
+                                     kDepthScale, kDepthMax);
+            }
+            fragments.push_back(voxel_grid.ExtractSurfacePoints(-1, 1.0f));
+        }
+    }
+
+    // Fragment to scene poses.
+    std::vector<core::Tensor> fragment_poses = {
+            core::Tensor::Eye(4, core::Dtype::Float64, host)};
+    std::vector<core::Tensor> odometry_inits;
+    {
+        OPEN3D_CUDA_PROFILE_SCOPE("registration", device);
+        for (size_t f = 1; f < fragments.size(); ++f) {
+            // The first frame of fragment f is the last frame of fragment
+            // f - 1 and defines the origin of fragment f.
+            core::Tensor init = frame_poses[f - 1].back();
+            auto result = registration::RegistrationICP(
+                    fragments[f], fragments[f - 1], kVoxelSize * 5, init);
+            odometry_inits.push_back(result.transformation_);
+        }
+    }
+    {
+        OPEN3D_CUDA_PROFILE_SCOPE("refine", device);
+        for (size_t f = 0; f < fragments.size(); ++f) {
+            if (!fragments[f].HasPointNormals()) {
+                fragments[f].EstimateNormals();
+            }
+        }
+        std::vector<double> voxel_sizes = {kVoxelSize * 4, kVoxelSize * 2,
+                                           kVoxelSize};
+        std::vector<registration::ICPConvergenceCriteria> criterias = {
+                registration::ICPConvergenceCriteria(1e-6, 1e-6, 30),
+                registration::ICPConvergenceCriteria(1e-6, 1e-6, 20),
+                registration::ICPConvergenceCriteria(1e-6, 1e-6, 10)};
+        std::vector<double> max_correspondence_distances = {
+                kVoxelSize * 8, kVoxelSize * 4, kVoxelSize * 2};
+        for (size_t f = 1; f < fragments.size(); ++f) {
+            auto result = registration::RegistrationMultiScaleICP(
+                    fragments[f], fragments[f - 1], voxel_sizes, criterias,
+                    max_correspondence_distances, odometry_inits[f - 1],
+                    registration::TransformationEstimationPointToPlane());
+            fragment_poses.push_back(
+                    fragment_poses.back().Matmul(result.transformation_));
+        }
+    }
+
+    int64_t num_triangles = 0;
+    {
+        OPEN3D_CUDA_PROFILE_SCOPE("integrate", device);
+        geometry::TSDFVoxelGrid voxel_grid = CreateVoxelGrid(device);
+        for (size_t f = 0; f < ranges.size(); ++f) {
+            // Skip the frame shared with the previous fragment.
+            int64_t first = f == 0 ? 0 : 1;
+            for (int64_t i = first;
+                 i < static_cast<int64_t>(frame_poses[f].size()); ++i) {
+                const geometry::RGBDImage& frame =
+                        sequence.frames_[ranges[f].first + i];
+                core::Tensor pose = fragment_poses[f].Matmul(frame_poses[f][i]);
+                voxel_grid.Integrate(frame.depth_, frame.color_,
+                                     sequence.intrinsics_, pose.Inverse(),
+                                     kDepthScale, kDepthMax);
+            }
+        }
+        geometry::TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+        num_triangles = mesh.GetTriangles().GetLength();
+    }
+    return num_triangles;
+}
+
+/// Reruns the pipeline with the profiler and the memory tracker enabled, and
+/// reports its stage timings, peak memory and utilization as counters.
+static void ReportInstrumentedRun(benchmark::State& state,
+                                  const Sequence& sequence,
+                                  const core::Device& device) {
+    core::MemoryTracker& tracker = core::MemoryTracker::GetInstance();
+    const bool was_tracking = tracker.IsEnabled();
+    const bool was_profiling = utility::Profiler::IsEnabled();
+    const std::string launches_key = fmt::format(
+            "open3d_core_kernel_launches_total{{device=\"{}\"}}",
+            device.ToString());
+
+    tracker.SetEnabled(true);
+    tracker.ResetStatistics();
+    utility::Profiler::Clear();
+    utility::Profiler::Enable(true);
+    const int64_t launches_begin = utility::Metrics::GetValues()[launches_key];
+    const std::clock_t cpu_begin = std::clock();
+    const double wall_begin = utility::Timer::GetSystemTimeInMilliseconds();
+
+    RunPipeline(sequence, device);
+
+    const double wall_ms =
+            utility::Timer::GetSystemTimeInMilliseconds() - wall_begin;
+    const double cpu_ms =
+            1000.0 * static_cast<double>(std::clock() - cpu_begin) /
+            CLOCKS_PER_SEC;
+    const int64_t launches =
+            utility::Metrics::GetValues()[launches_key] - launches_begin;
+    utility::Profiler::Enable(was_profiling);
+    const std::vector<utility::Profiler::Zone> zones =
+            utility::Profiler::GetZones();
+
+    // Host zones are recorded on thread tracks, device zones on the track of
+    // the device.
+    double device_ms = 0;
+    for (const char* stage : kStages) {
+        double host_stage_ms = 0;
+        for (const utility::Profiler::Zone& zone : zones) {
+            if (zone.depth_ != 0 || std::string(zone.name_) != stage) {
+                continue;
+            }
+            if (zone.track_ == device.ToString()) {
+                device_ms += zone.duration_ms_;
+            } else {
+                host_stage_ms += zone.duration_ms_;
+            }
+        }
+        state.counters[std::string(stage) + "_ms"] = host_stage_ms;
+    }
+
+    // Process CPU time over the time all threads could have used.
+    state.counters["thread_utilization"] =
+            cpu_ms / (wall_ms * utility::GetMaxParallelism());
+    state.counters["kernel_launches"] = static_cast<double>(launches);
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        // Time spanned by the stages on the device stream over the wall
+        // time, an upper bound of the device utilization.
+        state.counters["gpu_utilization"] = device_ms / wall_ms;
+    }
+    state.counters["peak_bytes"] =
+            static_cast<double>(tracker.GetStatistics(device).peak_bytes_);
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        state.counters["peak_host_bytes"] = static_cast<double>(
+                tracker.GetStatistics(core::Device("CPU:0")).peak_bytes_);
+    }
+    tracker.SetEnabled(was_tracking);
+}
+
+static void Reconstruction(benchmark::State& state,
+                           const core::Device& device) {
+    if (!geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        state.SkipWithError("RGBD odometry on CPU requires IPP.");
+        return;
+    }
+    Sequence sequence = LoadSequence(device);
+
+    // Warm up.
+    int64_t num_triangles = RunPipeline(sequence, device);
+
+    for (auto _ : state) {
+        RunPipeline(sequence, device);
+    }
+
+    state.counters["frames_per_second"] = benchmark::Counter(
+            static_cast<double>(sequence.frames_.size()),
+            benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["triangles"] = static_cast<double>(num_triangles);
+    ReportInstrumentedRun(state, sequence, device);
+}
+
+BENCHMARK_CAPTURE(Reconstruction, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(Reconstruction, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
+
+}  // namespace reconstruction
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -27,11 +27,13 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <string>
 
 #include "open3d/core/Device.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/ScopedArena.h"
 
 namespace open3d {
 namespace core {
@@ -57,12 +59,20 @@ class Blob {
 public:
     /// Construct Blob on a specified device.
     ///
+    /// The memory is taken from the innermost ScopedArena of the device on
+    /// the calling thread if there is one with enough space left, and from the
+    /// MemoryManager otherwise.
+    ///
     /// \param byte_size Size of the blob in bytes.
     /// \param device Device where the blob resides.
     Blob(int64_t byte_size, const Device& device)
         : deleter_(nullptr),
-          data_ptr_(MemoryManager::Malloc(byte_size, device)),
-          device_(device) {}
+          data_ptr_(ScopedArena::Allocate(byte_size, device, deleter_)),
+          device_(device) {
+        if (data_ptr_ == nullptr) {
+            data_ptr_ = MemoryManager::Malloc(byte_size, device);
+        }
+    }
 
     /// Construct Blob with externally managed memory.
     ///
@@ -94,6 +104,10 @@ public:
 
     const void* GetDataPtr() const { return data_ptr_; }
 
+    /// Returns the deleter of externally managed or ScopedArena memory, or an
+    /// empty function if the memory is managed by the MemoryManager.
+    const std::function<void(void*)>& GetDeleter() const { return deleter_; }
+
 protected:
     /// For externally managed memory, deleter != nullptr.
     std::function<void(void*)> deleter_ = nullptr;
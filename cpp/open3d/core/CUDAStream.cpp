@@ -0,0 +1,384 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAStream.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
+
+#ifdef BUILD_CUDA_MODULE
+#include <nvtx3/nvToolsExt.h>
+#endif
+
+namespace open3d {
+namespace core {
+
+#ifdef BUILD_CUDA_MODULE
+
+/// Switches to a device in the current scope. Same as CUDADeviceSwitcher,
+/// which cannot be included here since CUDAState.cuh is nvcc-only.
+class StreamDeviceSwitcher {
+public:
+    StreamDeviceSwitcher(const Device& device) {
+        OPEN3D_CUDA_CHECK(cudaGetDevice(&prev_device_id_));
+        OPEN3D_CUDA_CHECK(cudaSetDevice(device.GetID()));
+    }
+    ~StreamDeviceSwitcher() {
+        OPEN3D_CUDA_CHECK(cudaSetDevice(prev_device_id_));
+    }
+
+private:
+    int prev_device_id_;
+};
+
+static Device GetCurrentCUDADevice() {
+    int device_id = 0;
+    OPEN3D_CUDA_CHECK(cudaGetDevice(&device_id));
+    return Device(Device::DeviceType::CUDA, device_id);
+}
+
+struct CUDAStream::Impl {
+    Impl(const Device& device) : device_(device), owned_(true) {
+        StreamDeviceSwitcher switcher(device_);
+        OPEN3D_CUDA_CHECK(cudaStreamCreate(&stream_));
+    }
+    Impl(cudaStream_t stream, const Device& device)
+        : device_(device), stream_(stream), owned_(false) {}
+    ~Impl() {
+        if (owned_) {
+            StreamDeviceSwitcher switcher(device_);
+            cudaStreamDestroy(stream_);
+        }
+    }
+    Device device_;
+    cudaStream_t stream_;
+    bool owned_;
+};
+
+struct CUDAEvent::Impl {
+    Impl(bool enable_timing) {
+        OPEN3D_CUDA_CHECK(cudaEventCreateWithFlags(
+                &event_, enable_timing ? cudaEventDefault
+                                       : cudaEventDisableTiming));
+    }
+    ~Impl() { cudaEventDestroy(event_); }
+    cudaEvent_t event_;
+};
+
+CUDAStream::CUDAStream() : impl_(nullptr), device_(GetCurrentCUDADevice()) {}
+
+CUDAStream::CUDAStream(const Device& device) : device_(device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("CUDAStream requires a CUDA device, but got {}.",
+                          device.ToString());
+    }
+    impl_ = std::make_shared<Impl>(device);
+}
+
+CUDAStream CUDAStream::Default(const Device& device) {
+    CUDAStream stream;
+    stream.device_ = device;
+    return stream;
+}
+
+CUDAStream CUDAStream::FromNative(cudaStream_t stream, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("CUDAStream requires a CUDA device, but got {}.",
+                          device.ToString());
+    }
+    if (stream == nullptr) {
+        return Default(device);
+    }
+    CUDAStream wrapped = Default(device);
+    wrapped.impl_ = std::make_shared<Impl>(stream, device);
+    return wrapped;
+}
+
+cudaStream_t CUDAStream::Get() const {
+    return impl_ == nullptr ? nullptr : impl_->stream_;
+}
+
+void CUDAStream::Synchronize() const {
+    StreamDeviceSwitcher switcher(device_);
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(Get()));
+}
+
+bool CUDAStream::Query() const {
+    StreamDeviceSwitcher switcher(device_);
+    cudaError_t err = cudaStreamQuery(Get());
+    if (err == cudaErrorNotReady) {
+        return false;
+    }
+    OPEN3D_CUDA_CHECK(err);
+    return true;
+}
+
+CUDAEvent::CUDAEvent(bool enable_timing)
+    : impl_(std::make_shared<Impl>(enable_timing)) {}
+
+void CUDAEvent::Record(const CUDAStream& stream) {
+    OPEN3D_CUDA_CHECK(cudaEventRecord(impl_->event_, stream.Get()));
+}
+
+void CUDAEvent::Wait(const CUDAStream& stream) const {
+    OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(stream.Get(), impl_->event_, 0));
+}
+
+void CUDAEvent::Synchronize() const {
+    OPEN3D_CUDA_CHECK(cudaEventSynchronize(impl_->event_));
+}
+
+bool CUDAEvent::Query() const {
+    cudaError_t err = cudaEventQuery(impl_->event_);
+    if (err == cudaErrorNotReady) {
+        return false;
+    }
+    OPEN3D_CUDA_CHECK(err);
+    return true;
+}
+
+float CUDAEvent::ElapsedMilliseconds(const CUDAEvent& start) const {
+    float ms = 0;
+    OPEN3D_CUDA_CHECK(
+            cudaEventElapsedTime(&ms, start.impl_->event_, impl_->event_));
+    return ms;
+}
+
+void CUDAMemcpyAsync(void* dst_ptr,
+                     const Device& dst_device,
+                     const void* src_ptr,
+                     const Device& src_device,
+                     size_t num_bytes,
+                     const CUDAStream& stream) {
+    if (dst_device.GetType() == Device::DeviceType::CUDA &&
+        src_device.GetType() == Device::DeviceType::CPU) {
+        StreamDeviceSwitcher switcher(dst_device);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyHostToDevice,
+                                          stream.Get()));
+    } else if (dst_device.GetType() == Device::DeviceType::CPU &&
+               src_device.GetType() == Device::DeviceType::CUDA) {
+        StreamDeviceSwitcher switcher(src_device);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyDeviceToHost,
+                                          stream.Get()));
+    } else if (dst_device.GetType() == Device::DeviceType::CUDA &&
+               src_device.GetType() == Device::DeviceType::CUDA) {
+        StreamDeviceSwitcher switcher(src_device);
+        if (dst_device == src_device) {
+            OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                              cudaMemcpyDeviceToDevice,
+                                              stream.Get()));
+        } else {
+            // Staged through the host by the driver if P2P is unavailable.
+            OPEN3D_CUDA_CHECK(cudaMemcpyPeerAsync(
+                    dst_ptr, dst_device.GetID(), src_ptr, src_device.GetID(),
+                    num_bytes, stream.Get()));
+        }
+    } else {
+        utility::LogError("Wrong cudaMemcpyKind.");
+    }
+}
+
+/// Device time of a CUDAProfileZone, resolved by ResolveDeviceRanges().
+struct DeviceRange {
+    const char* name_;
+    int depth_;
+    Device device_;
+    cudaEvent_t start_;
+    cudaEvent_t end_;
+};
+
+struct DeviceProfilerState {
+    std::mutex mutex_;
+    std::vector<DeviceRange> pending_;
+    /// Per device id, an event and the host time at which it completed. Device
+    /// times are measured relative to it.
+    std::unordered_map<int, std::pair<cudaEvent_t, double>> references_;
+};
+
+static DeviceProfilerState& GetDeviceProfilerState() {
+    static DeviceProfilerState* state = new DeviceProfilerState();
+    return *state;
+}
+
+/// Thread-local nesting depth of the device ranges.
+static int& DeviceRangeDepth() {
+    thread_local int depth = 0;
+    return depth;
+}
+
+static void ResolveDeviceRanges() {
+    DeviceProfilerState& state = GetDeviceProfilerState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    for (const DeviceRange& range : state.pending_) {
+        StreamDeviceSwitcher switcher(range.device_);
+        const auto& reference = state.references_.at(range.device_.GetID());
+        float start_ms = 0, duration_ms = 0;
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(range.end_));
+        OPEN3D_CUDA_CHECK(
+                cudaEventElapsedTime(&start_ms, reference.first, range.start_));
+        OPEN3D_CUDA_CHECK(
+                cudaEventElapsedTime(&duration_ms, range.start_, range.end_));
+        utility::Profiler::AddZone(range.name_, range.device_.ToString(),
+                                   range.depth_, reference.second + start_ms,
+                                   duration_ms);
+        cudaEventDestroy(range.start_);
+        cudaEventDestroy(range.end_);
+    }
+    state.pending_.clear();
+}
+
+/// Emits NVTX ranges for all profiler zones, and resolves device times when
+/// the zones are collected.
+static struct ProfilerCallbacksRegistrar {
+    ProfilerCallbacksRegistrar() {
+        utility::Profiler::SetRangeCallbacks(
+                [](const char* name) { nvtxRangePushA(name); },
+                []() { nvtxRangePop(); });
+        utility::Profiler::AddFlushCallback(ResolveDeviceRanges);
+    }
+} profiler_callbacks_registrar;
+
+struct CUDAProfileZone::Impl {
+    CUDAStream stream_;
+    DeviceRange range_;
+};
+
+CUDAProfileZone::CUDAProfileZone(const char* name, const Device& device)
+    : host_zone_(name) {
+    if (!utility::Profiler::IsEnabled() ||
+        device.GetType() != Device::DeviceType::CUDA) {
+        return;
+    }
+    CUDAStream stream = CUDAStream::GetCurrent();
+    if (stream.GetDevice() != device) {
+        stream = CUDAStream::Default(device);
+    }
+    StreamDeviceSwitcher switcher(device);
+    {
+        DeviceProfilerState& state = GetDeviceProfilerState();
+        std::lock_guard<std::mutex> lock(state.mutex_);
+        if (state.references_.count(device.GetID()) == 0) {
+            cudaEvent_t reference;
+            OPEN3D_CUDA_CHECK(cudaEventCreate(&reference));
+            OPEN3D_CUDA_CHECK(cudaEventRecord(reference, nullptr));
+            OPEN3D_CUDA_CHECK(cudaEventSynchronize(reference));
+            state.references_[device.GetID()] = {
+                    reference, utility::Timer::GetSystemTimeInMilliseconds()};
+        }
+    }
+    impl_ = std::unique_ptr<Impl>(
+            new Impl{stream, {name, DeviceRangeDepth()++, device}});
+    OPEN3D_CUDA_CHECK(cudaEventCreate(&impl_->range_.start_));
+    OPEN3D_CUDA_CHECK(cudaEventRecord(impl_->range_.start_, stream.Get()));
+}
+
+CUDAProfileZone::~CUDAProfileZone() {
+    if (!impl_) {
+        return;
+    }
+    DeviceRangeDepth()--;
+    StreamDeviceSwitcher switcher(impl_->range_.device_);
+    OPEN3D_CUDA_CHECK(cudaEventCreate(&impl_->range_.end_));
+    OPEN3D_CUDA_CHECK(
+            cudaEventRecord(impl_->range_.end_, impl_->stream_.Get()));
+    DeviceProfilerState& state = GetDeviceProfilerState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    state.pending_.push_back(impl_->range_);
+}
+
+#else  // #ifdef BUILD_CUDA_MODULE
+
+struct CUDAStream::Impl {};
+struct CUDAEvent::Impl {};
+
+CUDAStream::CUDAStream() : impl_(nullptr), device_("CUDA:0") {}
+
+CUDAStream::CUDAStream(const Device& device) {
+    utility::LogError("Not compiled with CUDA, cannot create CUDAStream.");
+}
+
+CUDAStream CUDAStream::Default(const Device& device) {
+    CUDAStream stream;
+    stream.device_ = device;
+    return stream;
+}
+
+void CUDAStream::Synchronize() const {}
+
+bool CUDAStream::Query() const { return true; }
+
+CUDAEvent::CUDAEvent(bool enable_timing) {
+    utility::LogError("Not compiled with CUDA, cannot create CUDAEvent.");
+}
+
+void CUDAEvent::Record(const CUDAStream& stream) {}
+
+void CUDAEvent::Wait(const CUDAStream& stream) const {}
+
+void CUDAEvent::Synchronize() const {}
+
+bool CUDAEvent::Query() const { return true; }
+
+float CUDAEvent::ElapsedMilliseconds(const CUDAEvent& start) const {
+    return 0;
+}
+
+struct CUDAProfileZone::Impl {};
+
+CUDAProfileZone::CUDAProfileZone(const char* name, const Device& device)
+    : host_zone_(name) {}
+
+CUDAProfileZone::~CUDAProfileZone() {}
+
+#endif  // #ifdef BUILD_CUDA_MODULE
+
+/// The stream set by the innermost CUDAScopedStream of the calling thread. No
+/// value means the default stream of the current device.
+static utility::optional<CUDAStream>& ScopedStream() {
+    thread_local utility::optional<CUDAStream> stream;
+    return stream;
+}
+
+CUDAStream CUDAStream::GetCurrent() {
+    const utility::optional<CUDAStream>& stream = ScopedStream();
+    return stream.has_value() ? stream.value() : CUDAStream();
+}
+
+CUDAScopedStream::CUDAScopedStream(const CUDAStream& stream)
+    : prev_stream_(ScopedStream()) {
+    ScopedStream() = stream;
+}
+
+CUDAScopedStream::~CUDAScopedStream() { ScopedStream() = prev_stream_; }
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file CUDAStream.h
+/// \brief CUDA streams, events and the stream-scoped context.
+///
+/// CUDAStream.h may be included from CPU-only code. Without the CUDA module,
+/// only the default stream can be constructed and all operations are no-ops
+/// or throw.
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Device.h"
+#include "open3d/utility/Optional.h"
+#include "open3d/utility/Profiler.h"
+
+namespace open3d {
+namespace core {
+
+/// \class CUDAStream
+///
+/// A ref-counted handle of a CUDA stream on a device. Copies of a CUDAStream
+/// refer to the same stream, which is destroyed with the last copy.
+///
+/// Streams are created as blocking streams, such that work on the legacy
+/// default stream still synchronizes with them. Two CUDAStreams do not
+/// synchronize with each other, which allows e.g. uploading the next frame
+/// on one stream while integrating the previous frame on another stream.
+class CUDAStream {
+public:
+    /// The default (legacy null) stream of the current device.
+    CUDAStream();
+
+    /// Creates a new stream on \p device, which must be a CUDA device.
+    explicit CUDAStream(const Device& device);
+
+    /// Returns the default stream of \p device.
+    static CUDAStream Default(const Device& device);
+
+    /// Returns the stream set by the innermost CUDAScopedStream of the calling
+    /// thread, or the default stream.
+    static CUDAStream GetCurrent();
+
+    /// Blocks until all work queued on the stream is done.
+    void Synchronize() const;
+
+    /// Returns true if all work queued on the stream is done.
+    bool Query() const;
+
+    /// Returns true if this is the default (null) stream.
+    bool IsDefault() const { return impl_ == nullptr; }
+
+    Device GetDevice() const { return device_; }
+
+    bool operator==(const CUDAStream& other) const {
+        return impl_ == other.impl_ && device_ == other.device_;
+    }
+    bool operator!=(const CUDAStream& other) const {
+        return !(*this == other);
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    /// Returns the native stream handle.
+    cudaStream_t Get() const;
+
+    /// Wraps a stream created elsewhere, e.g. the current stream of an ML
+    /// framework, such that core kernels can be queued on it with
+    /// CUDAScopedStream. The stream is not destroyed by the CUDAStream and
+    /// must outlive it. A null \p stream is the default stream of \p device.
+    static CUDAStream FromNative(cudaStream_t stream, const Device& device);
+#endif
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> impl_;
+    Device device_;
+};
+
+/// \class CUDAEvent
+///
+/// A CUDA event for synchronizing streams with each other or with the host.
+class CUDAEvent {
+public:
+    /// Creates an event on the current device. With \p enable_timing, the
+    /// event can be used with ElapsedMilliseconds.
+    explicit CUDAEvent(bool enable_timing = false);
+
+    /// Captures the work queued on \p stream so far.
+    void Record(const CUDAStream& stream = CUDAStream::GetCurrent());
+
+    /// Makes all future work on \p stream wait for the recorded work.
+    void Wait(const CUDAStream& stream = CUDAStream::GetCurrent()) const;
+
+    /// Blocks the host until the recorded work is done.
+    void Synchronize() const;
+
+    /// Returns true if the recorded work is done.
+    bool Query() const;
+
+    /// Returns the time in milliseconds between \p start and this event. Both
+    /// events must have been created with enable_timing and recorded.
+    float ElapsedMilliseconds(const CUDAEvent& start) const;
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> impl_;
+};
+
+/// \class CUDAScopedStream
+///
+/// Sets the current stream of the calling thread in the current scope. Core
+/// kernels and MemoryManager::MemcpyAsync use the current stream. The previous
+/// stream is restored when leaving the scope.
+///
+/// Example:
+/// ```cpp
+/// CUDAStream upload_stream(Device("CUDA:0"));
+/// {
+///     CUDAScopedStream scoped_stream(upload_stream);
+///     Tensor next_depth = depth.To(Device("CUDA:0"), upload_stream);
+/// }
+/// // ... integrate the previous frame on the default stream ...
+/// upload_stream.Synchronize();
+/// ```
+class CUDAScopedStream {
+public:
+    explicit CUDAScopedStream(const CUDAStream& stream);
+    ~CUDAScopedStream();
+
+    CUDAScopedStream(const CUDAScopedStream&) = delete;
+    CUDAScopedStream& operator=(const CUDAScopedStream&) = delete;
+
+private:
+    utility::optional<CUDAStream> prev_stream_;
+};
+
+/// \class CUDAProfileZone
+///
+/// Records a zone of utility::Profiler on the host, like OPEN3D_PROFILE_SCOPE.
+/// If \p device is a CUDA device, it also measures with CUDA events how long
+/// the work queued on the current stream in the scope takes on the device.
+/// Device times are resolved when the profiler's zones are collected and are
+/// shown on one track per device. Use OPEN3D_CUDA_PROFILE_SCOPE instead of
+/// constructing it directly.
+///
+/// With the CUDA module, all profiler zones are also emitted as NVTX ranges,
+/// which are shown by Nsight Systems.
+class CUDAProfileZone {
+public:
+    CUDAProfileZone(const char* name, const Device& device);
+    ~CUDAProfileZone();
+
+    CUDAProfileZone(const CUDAProfileZone&) = delete;
+    CUDAProfileZone& operator=(const CUDAProfileZone&) = delete;
+
+private:
+    utility::ProfileZone host_zone_;
+    struct Impl;
+    /// Null if no device time is measured.
+    std::unique_ptr<Impl> impl_;
+};
+
+#ifdef BUILD_CUDA_MODULE
+/// Queues a copy on \p stream, where at least one of the devices is a CUDA
+/// device. Used by MemoryManager::MemcpyAsync.
+void CUDAMemcpyAsync(void* dst_ptr,
+                     const Device& dst_device,
+                     const void* src_ptr,
+                     const Device& src_device,
+                     size_t num_bytes,
+                     const CUDAStream& stream);
+#endif
+
+}  // namespace core
+}  // namespace open3d
+
+/// Records the enclosing scope as a zone named \p name (a string literal) of
+/// utility::Profiler, including its device time if \p device is a CUDA device.
+#define OPEN3D_CUDA_PROFILE_SCOPE(name, device)         \
+    ::open3d::core::CUDAProfileZone OPEN3D_CONCATENATE( \
+            open3d_cuda_profile_zone_, __LINE__)(name, device)
@@ -39,12 +39,17 @@ namespace cuda {
 
 int DeviceCount() {
 #ifdef BUILD_CUDA_MODULE
-    try {
-        std::shared_ptr<CUDAState> cuda_state = CUDAState::GetInstance();
-        return cuda_state->GetNumDevices();
-    } catch (const std::runtime_error&) {  // GetInstance can throw
+    // Query the driver directly instead of going through CUDAState, whose
+    // constructor enables peer access and thus creates a context on every
+    // device. This keeps `import open3d` free of CUDA context creation.
+    int num_devices = 0;
+    if (cudaGetDeviceCount(&num_devices) != cudaSuccess) {
+        // No driver or no device. Clear the error so that it is not reported
+        // by a later CUDA call.
+        cudaGetLastError();
         return 0;
     }
+    return num_devices;
 #else
     return 0;
 #endif
@@ -67,6 +72,30 @@ void ReleaseCache() {
 #endif
 }
 
+int GetPointerDevice(const void* ptr) {
+#ifdef BUILD_CUDA_MODULE
+    cudaPointerAttributes attributes;
+    cudaError_t err = cudaPointerGetAttributes(&attributes, ptr);
+    if (err != cudaSuccess) {
+        // Older CUDA versions return an error for unregistered host memory.
+        // Clear it so that it is not reported by a later CUDA call.
+        cudaGetLastError();
+        utility::LogError("Cannot query the device of pointer {}: {}.", ptr,
+                          cudaGetErrorString(err));
+    }
+    if (attributes.type != cudaMemoryTypeDevice &&
+        attributes.type != cudaMemoryTypeManaged) {
+        utility::LogError("Pointer {} is not CUDA device memory.", ptr);
+    }
+    return attributes.device;
+#else
+    utility::LogError(
+            "Built without CUDA module, cannot query the device of pointer "
+            "{}.",
+            ptr);
+#endif
+}
+
 }  // namespace cuda
 }  // namespace core
 }  // namespace open3d
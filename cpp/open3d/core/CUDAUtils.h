@@ -115,6 +115,11 @@ int DeviceCount();
 bool IsAvailable();
 void ReleaseCache();
 
+/// Returns the id of the CUDA device on which \p ptr was allocated. Throws if
+/// \p ptr is not a CUDA device or managed memory pointer, e.g. for host
+/// memory, or if Open3D is built without CUDA.
+int GetPointerDevice(const void* ptr);
+
 }  // namespace cuda
 }  // namespace core
 }  // namespace open3d
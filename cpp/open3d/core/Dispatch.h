@@ -93,6 +93,32 @@
         }                                                   \
     }()
 
+/// Same as DISPATCH_DTYPE_TO_TEMPLATE, and also dispatches the 16-bit floating
+/// point dtypes. Only kernels whose element functions are valid for Half and
+/// BFloat16 (see Half.h) shall use it.
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, ...)     \
+    [&] {                                                    \
+        if (DTYPE == open3d::core::Dtype::Float16) {         \
+            using scalar_t = open3d::core::Half;             \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::BFloat16) { \
+            using scalar_t = open3d::core::BFloat16;         \
+            return __VA_ARGS__();                            \
+        } else {                                             \
+            DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__);  \
+        }                                                    \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(DTYPE, ...)     \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Dtype::Bool) {                     \
+            using scalar_t = bool;                                    \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, __VA_ARGS__); \
+        }                                                             \
+    }()
+
 #define DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(DTYPE, ...)        \
     [&] {                                                   \
         if (DTYPE == open3d::core::Dtype::Float32) {        \
@@ -31,6 +31,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Half.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -41,6 +42,8 @@ public:
     static const Dtype Undefined;
     static const Dtype Float32;
     static const Dtype Float64;
+    static const Dtype Float16;
+    static const Dtype BFloat16;
     static const Dtype Int8;
     static const Dtype Int16;
     static const Dtype Int32;
@@ -101,6 +104,17 @@ inline const Dtype Dtype::FromType<double>() {
     return Dtype::Float64;
 }
 
+// Qualified, since Dtype::BFloat16 hides core::BFloat16 in this scope.
+template <>
+inline const Dtype Dtype::FromType<core::Half>() {
+    return Dtype::Float16;
+}
+
+template <>
+inline const Dtype Dtype::FromType<core::BFloat16>() {
+    return Dtype::BFloat16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int8_t>() {
     return Dtype::Int8;
@@ -26,6 +26,7 @@
 
 #include "open3d/core/EigenConverter.h"
 
+#include <memory>
 #include <type_traits>
 
 #include "open3d/core/kernel/CPULauncher.h"
@@ -101,10 +102,24 @@ static std::vector<Eigen::Matrix<T, 3, 1>> TensorToEigenVector3xVector(
     // safe to write directly into std vector memory, see:
     // https://eigen.tuxfamily.org/dox/group__TopicStlContainers.html.
     std::vector<Eigen::Matrix<T, 3, 1>> eigen_vector(tensor.GetLength());
-    core::Tensor t = tensor.Contiguous().To(dtype);
-    MemoryManager::MemcpyToHost(eigen_vector.data(), t.GetDataPtr(),
-                                t.GetDevice(),
-                                t.GetDtype().ByteSize() * t.NumElements());
+    T *dst_ptr = eigen_vector.empty() ? nullptr : eigen_vector.data()->data();
+    if (tensor.GetDevice().GetType() == core::Device::DeviceType::CPU) {
+        // Cast straight into the vector, e.g. for Float32 point clouds, instead
+        // of staging a converted copy of the tensor.
+        core::Tensor t = tensor.Contiguous();
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(t.GetDtype(), [&]() {
+            const scalar_t *src_ptr = t.GetDataPtr<scalar_t>();
+            core::kernel::CPULauncher::LaunchGeneralKernel(
+                    t.NumElements(), [&](int64_t workload_idx) {
+                        dst_ptr[workload_idx] =
+                                static_cast<T>(src_ptr[workload_idx]);
+                    });
+        });
+    } else {
+        core::Tensor t = tensor.Contiguous().To(dtype);
+        MemoryManager::MemcpyToHost(dst_ptr, t.GetDataPtr(), t.GetDevice(),
+                                    t.GetDtype().ByteSize() * t.NumElements());
+    }
     return eigen_vector;
 }
 
@@ -122,17 +137,15 @@ static core::Tensor EigenVector3xVectorToTensor(
     core::Tensor tensor_cpu =
             core::Tensor::Empty({num_values, 3}, dtype, Device("CPU:0"));
 
-    // Fill Tensor. This takes care of dtype conversion at the same time.
-    core::Indexer indexer({tensor_cpu}, tensor_cpu,
-                          core::DtypePolicy::ALL_SAME);
+    // Fill Tensor. The vector is tightly packed, so element i of the flattened
+    // tensor is element i of the flattened vector, cast to dtype.
+    const T *src_ptr = values.empty() ? nullptr : values.data()->data();
     DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        core::kernel::CPULauncher::LaunchIndexFillKernel(
-                indexer, [&](void *ptr, int64_t workload_idx) {
-                    // Fills the flattened tensor tensor_cpu[:] with dtype
-                    // casting. tensor_cpu[:][i] corresponds to the (i/3)-th
-                    // element's (i%3)-th coordinate value.
-                    *static_cast<scalar_t *>(ptr) = static_cast<scalar_t>(
-                            values[workload_idx / 3](workload_idx % 3));
+        scalar_t *dst_ptr = tensor_cpu.GetDataPtr<scalar_t>();
+        core::kernel::CPULauncher::LaunchGeneralKernel(
+                tensor_cpu.NumElements(), [&](int64_t workload_idx) {
+                    dst_ptr[workload_idx] =
+                            static_cast<scalar_t>(src_ptr[workload_idx]);
                 });
     });
 
@@ -140,6 +153,61 @@ static core::Tensor EigenVector3xVectorToTensor(
     return tensor_cpu.To(device);
 }
 
+/// Blob deleter that keeps a moved-in std::vector alive for as long as a Blob
+/// refers to its storage. The vector is released with the last copy of the
+/// deleter, so the call operator has nothing to do.
+template <typename T>
+struct EigenVector3xVectorOwner {
+    std::shared_ptr<std::vector<Eigen::Matrix<T, 3, 1>>> values_;
+    void operator()(void *) const {}
+};
+
+template <typename T>
+static core::Tensor EigenVector3xVectorAsTensor(
+        std::vector<Eigen::Matrix<T, 3, 1>> &values,
+        const std::function<void(void *)> &deleter) {
+    static_assert(std::is_same<T, double>::value || std::is_same<T, int>::value,
+                  "Only supports double and int (Vector3d and Vector3i).");
+    static_assert(sizeof(Eigen::Matrix<T, 3, 1>) == 3 * sizeof(T),
+                  "Eigen::Matrix<T, 3, 1> must be tightly packed.");
+    core::Dtype dtype = core::Dtype::FromType<T>();
+    core::SizeVector shape{static_cast<int64_t>(values.size()), 3};
+    void *data_ptr = static_cast<void *>(values.data());
+    auto blob =
+            std::make_shared<core::Blob>(Device("CPU:0"), data_ptr, deleter);
+    return core::Tensor(shape, shape_util::DefaultStrides(shape), data_ptr,
+                        dtype, blob);
+}
+
+template <typename T>
+static std::vector<Eigen::Matrix<T, 3, 1>> TensorToEigenVector3xVector(
+        core::Tensor &&tensor) {
+    std::shared_ptr<core::Blob> blob = tensor.GetBlob();
+    // Steal the vector only if nothing but `tensor` refers to it, otherwise
+    // other tensors would be left aliasing the returned vector.
+    if (blob != nullptr && blob.use_count() == 2) {
+        const auto *owner = blob->GetDeleter()
+                                    .template target<
+                                            EigenVector3xVectorOwner<T>>();
+        if (owner != nullptr && owner->values_.use_count() == 1 &&
+            tensor.GetDtype() == core::Dtype::FromType<T>() &&
+            tensor.GetDataPtr() == owner->values_->data() &&
+            tensor.GetShape() ==
+                    core::SizeVector{static_cast<int64_t>(
+                                             owner->values_->size()),
+                                     3} &&
+            tensor.IsContiguous()) {
+            std::vector<Eigen::Matrix<T, 3, 1>> values =
+                    std::move(*owner->values_);
+            blob.reset();
+            tensor = core::Tensor();
+            return values;
+        }
+    }
+    return TensorToEigenVector3xVector<T>(
+            static_cast<const core::Tensor &>(tensor));
+}
+
 std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(
         const core::Tensor &tensor) {
     return TensorToEigenVector3xVector<double>(tensor);
@@ -164,6 +232,40 @@ core::Tensor EigenVector3iVectorToTensor(
     return EigenVector3xVectorToTensor(values, dtype, device);
 }
 
+core::Tensor EigenVector3dVectorAsTensor(std::vector<Eigen::Vector3d> &values) {
+    return EigenVector3xVectorAsTensor(values, [](void *) {});
+}
+
+core::Tensor EigenVector3iVectorAsTensor(std::vector<Eigen::Vector3i> &values) {
+    return EigenVector3xVectorAsTensor(values, [](void *) {});
+}
+
+core::Tensor EigenVector3dVectorToTensor(
+        std::vector<Eigen::Vector3d> &&values) {
+    auto owned = std::make_shared<std::vector<Eigen::Vector3d>>(
+            std::move(values));
+    return EigenVector3xVectorAsTensor(*owned,
+                                       EigenVector3xVectorOwner<double>{owned});
+}
+
+core::Tensor EigenVector3iVectorToTensor(
+        std::vector<Eigen::Vector3i> &&values) {
+    auto owned = std::make_shared<std::vector<Eigen::Vector3i>>(
+            std::move(values));
+    return EigenVector3xVectorAsTensor(*owned,
+                                       EigenVector3xVectorOwner<int>{owned});
+}
+
+std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(
+        core::Tensor &&tensor) {
+    return TensorToEigenVector3xVector<double>(std::move(tensor));
+}
+
+std::vector<Eigen::Vector3i> TensorToEigenVector3iVector(
+        core::Tensor &&tensor) {
+    return TensorToEigenVector3xVector<int>(std::move(tensor));
+}
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
@@ -119,6 +119,44 @@ core::Tensor EigenVector3iVectorToTensor(
         core::Dtype dtype,
         const core::Device &device);
 
+/// \brief Returns a Float64 CPU tensor of shape (N, 3) that shares memory with
+/// \p values without copying. The tensor does not own the memory: \p values
+/// must outlive the tensor and all tensors sharing its memory, and must not be
+/// resized meanwhile.
+///
+/// \param values A vector of Eigen::Vector3d values, e.g. a list of 3D points.
+/// \return A tensor of shape (N, 3) aliasing the storage of \p values.
+core::Tensor EigenVector3dVectorAsTensor(std::vector<Eigen::Vector3d> &values);
+
+/// \brief Same as EigenVector3dVectorAsTensor, for Eigen::Vector3i values and
+/// an Int32 tensor.
+core::Tensor EigenVector3iVectorAsTensor(std::vector<Eigen::Vector3i> &values);
+
+/// \brief Moves a vector of Eigen::Vector3d into a Float64 CPU tensor of shape
+/// (N, 3) without copying. The tensor owns the storage, which is released
+/// when the last tensor sharing it is destroyed.
+///
+/// \param values A vector of Eigen::Vector3d values, e.g. a list of 3D points.
+/// \return A tensor of shape (N, 3) owning the storage of \p values.
+core::Tensor EigenVector3dVectorToTensor(std::vector<Eigen::Vector3d> &&values);
+
+/// \brief Same as EigenVector3dVectorToTensor(std::vector<Eigen::Vector3d>
+/// &&), for Eigen::Vector3i values and an Int32 tensor.
+core::Tensor EigenVector3iVectorToTensor(std::vector<Eigen::Vector3i> &&values);
+
+/// \brief Converts a tensor of shape (N, 3) to std::vector<Eigen::Vector3d>.
+/// If \p tensor is the only reference to a vector moved in by
+/// EigenVector3dVectorToTensor, the vector is moved out without copying and
+/// \p tensor is reset. Otherwise the tensor is copied.
+///
+/// \param tensor A tensor of shape (N, 3).
+/// \return A vector of N Eigen::Vector3d values.
+std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(core::Tensor &&tensor);
+
+/// \brief Same as TensorToEigenVector3dVector(core::Tensor &&), for
+/// std::vector<Eigen::Vector3i>.
+std::vector<Eigen::Vector3i> TensorToEigenVector3iVector(core::Tensor &&tensor);
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,197 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/FusedExpr.h"
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+struct FusedExpr::Node {
+    kernel::FusedEWOpCode op_code_;
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+    Tensor tensor_;  // Only for LoadInput.
+    double value_;   // Only for LoadScalar.
+};
+
+using kernel::FusedEWOpCode;
+
+static std::shared_ptr<const FusedExpr::Node> MakeNode(
+        FusedEWOpCode op_code,
+        const std::shared_ptr<const FusedExpr::Node>& lhs,
+        const std::shared_ptr<const FusedExpr::Node>& rhs = nullptr) {
+    auto node = std::make_shared<FusedExpr::Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    node->value_ = 0;
+    return node;
+}
+
+namespace {
+
+/// Flattens the expression DAG into a postfix program. Leaf tensors are
+/// de-duplicated, such that a tensor referenced multiple times is loaded from
+/// the same input slot.
+class FusedExprCompiler {
+public:
+    void Compile(const FusedExpr::Node& node) {
+        switch (node.op_code_) {
+            case FusedEWOpCode::LoadInput:
+                program_.Push(FusedEWOpCode::LoadInput,
+                              InputIndex(node.tensor_));
+                break;
+            case FusedEWOpCode::LoadScalar:
+                program_.Push(FusedEWOpCode::LoadScalar, 0, node.value_);
+                break;
+            default:
+                Compile(*node.lhs_);
+                if (node.rhs_) {
+                    Compile(*node.rhs_);
+                }
+                program_.Push(node.op_code_);
+                break;
+        }
+    }
+
+    const kernel::FusedEWProgram& GetProgram() const { return program_; }
+    const std::vector<Tensor>& GetInputs() const { return inputs_; }
+
+private:
+    int64_t InputIndex(const Tensor& tensor) {
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            if (inputs_[i].IsSame(tensor)) {
+                return static_cast<int64_t>(i);
+            }
+        }
+        if (static_cast<int64_t>(inputs_.size()) >= MAX_INPUTS) {
+            utility::LogError(
+                    "FusedExpr references too many (>{}) distinct tensors.",
+                    MAX_INPUTS);
+        }
+        inputs_.push_back(tensor);
+        return static_cast<int64_t>(inputs_.size()) - 1;
+    }
+
+    kernel::FusedEWProgram program_;
+    std::vector<Tensor> inputs_;
+};
+
+}  // namespace
+
+FusedExpr::FusedExpr(const std::shared_ptr<const Node>& node) : node_(node) {}
+
+FusedExpr::FusedExpr(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = FusedEWOpCode::LoadInput;
+    node->tensor_ = tensor;
+    node->value_ = 0;
+    node_ = node;
+}
+
+FusedExpr::FusedExpr(Scalar value) {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = FusedEWOpCode::LoadScalar;
+    node->value_ = value.To<double>();
+    node_ = node;
+}
+
+FusedExpr FusedExpr::operator+(const FusedExpr& other) const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Add, node_, other.node_));
+}
+
+FusedExpr FusedExpr::operator-(const FusedExpr& other) const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Sub, node_, other.node_));
+}
+
+FusedExpr FusedExpr::operator*(const FusedExpr& other) const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Mul, node_, other.node_));
+}
+
+FusedExpr FusedExpr::operator/(const FusedExpr& other) const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Div, node_, other.node_));
+}
+
+FusedExpr FusedExpr::Neg() const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Neg, node_));
+}
+
+FusedExpr FusedExpr::Abs() const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Abs, node_));
+}
+
+FusedExpr FusedExpr::Sqrt() const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Sqrt, node_));
+}
+
+FusedExpr FusedExpr::Sin() const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Sin, node_));
+}
+
+FusedExpr FusedExpr::Cos() const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Cos, node_));
+}
+
+FusedExpr FusedExpr::Exp() const {
+    return FusedExpr(MakeNode(FusedEWOpCode::Exp, node_));
+}
+
+Tensor FusedExpr::Eval() const {
+    FusedExprCompiler compiler;
+    compiler.Compile(*node_);
+    const std::vector<Tensor>& inputs = compiler.GetInputs();
+    if (inputs.empty()) {
+        utility::LogError("FusedExpr must reference at least one tensor.");
+    }
+
+    SizeVector dst_shape({});
+    for (const Tensor& input : inputs) {
+        dst_shape = shape_util::BroadcastedShape(dst_shape, input.GetShape());
+    }
+    Tensor dst(dst_shape, inputs[0].GetDtype(), inputs[0].GetDevice());
+    kernel::FusedEW(inputs, dst, compiler.GetProgram());
+    return dst;
+}
+
+void FusedExpr::EvalInto(Tensor& dst) const {
+    FusedExprCompiler compiler;
+    compiler.Compile(*node_);
+    kernel::FusedEW(compiler.GetInputs(), dst, compiler.GetProgram());
+}
+
+int64_t FusedExpr::NumInputs() const {
+    FusedExprCompiler compiler;
+    compiler.Compile(*node_);
+    return static_cast<int64_t>(compiler.GetInputs().size());
+}
+
+}  // namespace core
+}  // namespace open3d
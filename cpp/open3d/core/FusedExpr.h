@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// \class FusedExpr
+///
+/// Lazy element-wise expression over Tensors. Operators on FusedExpr only
+/// record a DAG of element-wise ops; Eval() compiles the DAG into one fused
+/// kernel that is launched once on CPU or CUDA, without allocating any
+/// intermediate tensor.
+///
+/// Example usage:
+///
+/// ```cpp
+/// // Equivalent to (a - b).Mul(c).Add(d), with one kernel and no temporaries.
+/// Tensor dst = ((FusedExpr(a) - b) * c + d).Eval();
+/// ```
+///
+/// All tensors in one expression must have the same dtype and device, and
+/// their shapes must be broadcastable. At most MAX_INPUTS distinct tensors can
+/// be referenced; the same tensor referenced multiple times counts once.
+class FusedExpr {
+public:
+    /// Leaf expression that reads from \p tensor.
+    FusedExpr(const Tensor& tensor);
+
+    /// Leaf expression with a constant value, cast to the expression's dtype.
+    FusedExpr(Scalar value);
+
+    FusedExpr operator+(const FusedExpr& other) const;
+    FusedExpr operator-(const FusedExpr& other) const;
+    FusedExpr operator*(const FusedExpr& other) const;
+    FusedExpr operator/(const FusedExpr& other) const;
+    // Tensor overloads take precedence over the templated scalar operators
+    // of Tensor.
+    FusedExpr operator+(const Tensor& other) const {
+        return *this + FusedExpr(other);
+    }
+    FusedExpr operator-(const Tensor& other) const {
+        return *this - FusedExpr(other);
+    }
+    FusedExpr operator*(const Tensor& other) const {
+        return *this * FusedExpr(other);
+    }
+    FusedExpr operator/(const Tensor& other) const {
+        return *this / FusedExpr(other);
+    }
+    FusedExpr operator+(Scalar value) const { return *this + FusedExpr(value); }
+    FusedExpr operator-(Scalar value) const { return *this - FusedExpr(value); }
+    FusedExpr operator*(Scalar value) const { return *this * FusedExpr(value); }
+    FusedExpr operator/(Scalar value) const { return *this / FusedExpr(value); }
+    FusedExpr operator-() const { return Neg(); }
+
+    FusedExpr Add(const FusedExpr& other) const { return *this + other; }
+    FusedExpr Sub(const FusedExpr& other) const { return *this - other; }
+    FusedExpr Mul(const FusedExpr& other) const { return *this * other; }
+    FusedExpr Div(const FusedExpr& other) const { return *this / other; }
+    FusedExpr Neg() const;
+    FusedExpr Abs() const;
+
+    /// Float-only ops. Eval() throws if the expression's dtype is not float.
+    FusedExpr Sqrt() const;
+    FusedExpr Sin() const;
+    FusedExpr Cos() const;
+    FusedExpr Exp() const;
+
+    /// Evaluates the expression into a new contiguous tensor, whose shape is
+    /// the broadcasted shape of all referenced tensors.
+    Tensor Eval() const;
+
+    /// Evaluates the expression into \p dst. The broadcasted shape of the
+    /// referenced tensors must be broadcastable to \p dst's shape. \p dst may
+    /// alias any of the referenced tensors if the access is element-wise
+    /// identical, e.g. a = (FusedExpr(a) * b + c).
+    void EvalInto(Tensor& dst) const;
+
+    /// Returns the number of distinct tensors referenced by the expression.
+    int64_t NumInputs() const;
+
+public:
+    struct Node;
+
+protected:
+    explicit FusedExpr(const std::shared_ptr<const Node>& node);
+
+    std::shared_ptr<const Node> node_;
+};
+
+inline FusedExpr operator+(const Tensor& lhs, const FusedExpr& rhs) {
+    return FusedExpr(lhs) + rhs;
+}
+
+inline FusedExpr operator-(const Tensor& lhs, const FusedExpr& rhs) {
+    return FusedExpr(lhs) - rhs;
+}
+
+inline FusedExpr operator*(const Tensor& lhs, const FusedExpr& rhs) {
+    return FusedExpr(lhs) * rhs;
+}
+
+inline FusedExpr operator/(const Tensor& lhs, const FusedExpr& rhs) {
+    return FusedExpr(lhs) / rhs;
+}
+
+/// Evaluates a FusedExpr with a single kernel launch. Same as expr.Eval().
+inline Tensor Fuse(const FusedExpr& expr) { return expr.Eval(); }
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,258 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef __CUDACC__
+#include <cuda_fp16.h>
+#define OPEN3D_HALF_HOST_DEVICE __host__ __device__
+#else
+#define OPEN3D_HALF_HOST_DEVICE
+#endif
+
+namespace open3d {
+namespace core {
+
+namespace half_util {
+
+OPEN3D_HALF_HOST_DEVICE inline uint32_t FloatAsUInt32(float value) {
+#ifdef __CUDA_ARCH__
+    return __float_as_uint(value);
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+#endif
+}
+
+OPEN3D_HALF_HOST_DEVICE inline float UInt32AsFloat(uint32_t bits) {
+#ifdef __CUDA_ARCH__
+    return __uint_as_float(bits);
+#else
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+#endif
+}
+
+}  // namespace half_util
+
+/// IEEE 754 half-precision floating point number with 1 sign bit, 5 exponent
+/// bits and 10 mantissa bits, stored in 2 bytes.
+///
+/// Half converts implicitly to and from float. On the host, and on CUDA
+/// devices without native half arithmetic (< sm_53), arithmetic is computed in
+/// float and rounded back to Half; on newer devices, the +, -, * and /
+/// operators use the native half instructions.
+struct Half {
+    uint16_t bits;
+
+    Half() = default;
+
+    OPEN3D_HALF_HOST_DEVICE Half(float value) : bits(FloatToBits(value)) {}
+
+    OPEN3D_HALF_HOST_DEVICE operator float() const {
+        return BitsToFloat(bits);
+    }
+
+    OPEN3D_HALF_HOST_DEVICE static Half FromBits(uint16_t bits) {
+        Half h;
+        h.bits = bits;
+        return h;
+    }
+
+    /// Converts with round-to-nearest-even. Values larger than the largest
+    /// half (65504) overflow to infinity.
+    OPEN3D_HALF_HOST_DEVICE static uint16_t FloatToBits(float value) {
+#ifdef __CUDA_ARCH__
+        __half_raw raw = __float2half_rn(value);
+        return raw.x;
+#else
+        // Ref: https://gist.github.com/rygorous/2156668
+        const uint32_t kFloatInf = 255u << 23;
+        const uint32_t kHalfOverflow = (127u + 16u) << 23;
+        const uint32_t kSubnormalMagic = ((127u - 15u) + (23u - 10u) + 1u)
+                                         << 23;
+        uint32_t f = half_util::FloatAsUInt32(value);
+        uint32_t sign = f & 0x80000000u;
+        f ^= sign;
+        uint16_t h;
+        if (f >= kHalfOverflow) {
+            // Infinity, NaN (quiet) or overflow to infinity.
+            h = f > kFloatInf ? 0x7e00 : 0x7c00;
+        } else if (f < (113u << 23)) {
+            // Subnormal half or zero. The float addition does the rounding.
+            float shifted = half_util::UInt32AsFloat(f) +
+                            half_util::UInt32AsFloat(kSubnormalMagic);
+            h = static_cast<uint16_t>(half_util::FloatAsUInt32(shifted) -
+                                      kSubnormalMagic);
+        } else {
+            // Normal half: rebias the exponent and round the mantissa.
+            uint32_t mantissa_odd = (f >> 13) & 1;
+            f += ((15u - 127u) << 23) + 0xfff + mantissa_odd;
+            h = static_cast<uint16_t>(f >> 13);
+        }
+        return static_cast<uint16_t>(h | (sign >> 16));
+#endif
+    }
+
+    OPEN3D_HALF_HOST_DEVICE static float BitsToFloat(uint16_t bits) {
+#ifdef __CUDA_ARCH__
+        __half_raw raw;
+        raw.x = bits;
+        return __half2float(raw);
+#else
+        const uint32_t kShiftedExp = 0x7c00u << 13;
+        uint32_t f = (bits & 0x7fffu) << 13;
+        uint32_t exp = f & kShiftedExp;
+        f += (127u - 15u) << 23;
+        if (exp == kShiftedExp) {
+            // Infinity or NaN.
+            f += (128u - 16u) << 23;
+        } else if (exp == 0) {
+            // Zero or subnormal: renormalize.
+            f += 1u << 23;
+            f = half_util::FloatAsUInt32(half_util::UInt32AsFloat(f) -
+                                         half_util::UInt32AsFloat(113u << 23));
+        }
+        return half_util::UInt32AsFloat(f | ((bits & 0x8000u) << 16));
+#endif
+    }
+};
+
+/// Brain floating point number with 1 sign bit, 8 exponent bits and 7
+/// mantissa bits, stored in 2 bytes. BFloat16 has the range of float at a
+/// lower precision, and is the upper half of the corresponding float.
+///
+/// BFloat16 converts implicitly to and from float. Arithmetic is computed in
+/// float and rounded back to BFloat16.
+struct BFloat16 {
+    uint16_t bits;
+
+    BFloat16() = default;
+
+    OPEN3D_HALF_HOST_DEVICE BFloat16(float value) : bits(FloatToBits(value)) {}
+
+    OPEN3D_HALF_HOST_DEVICE operator float() const {
+        return BitsToFloat(bits);
+    }
+
+    OPEN3D_HALF_HOST_DEVICE static BFloat16 FromBits(uint16_t bits) {
+        BFloat16 b;
+        b.bits = bits;
+        return b;
+    }
+
+    /// Converts with round-to-nearest-even. NaNs stay (quiet) NaNs.
+    OPEN3D_HALF_HOST_DEVICE static uint16_t FloatToBits(float value) {
+        uint32_t f = half_util::FloatAsUInt32(value);
+        if ((f & 0x7fffffffu) > 0x7f800000u) {
+            return static_cast<uint16_t>((f >> 16) | 0x40);
+        }
+        f += 0x7fffu + ((f >> 16) & 1);
+        return static_cast<uint16_t>(f >> 16);
+    }
+
+    OPEN3D_HALF_HOST_DEVICE static float BitsToFloat(uint16_t bits) {
+        return half_util::UInt32AsFloat(static_cast<uint32_t>(bits) << 16);
+    }
+};
+
+static_assert(std::is_trivially_copyable<Half>::value,
+              "Half must be trivially copyable.");
+static_assert(std::is_trivially_copyable<BFloat16>::value,
+              "BFloat16 must be trivially copyable.");
+
+namespace half_util {
+
+#define OPEN3D_HALF_ARITHMETIC(NAME, OP, HALF_INTRINSIC)                  \
+    template <typename T>                                                 \
+    OPEN3D_HALF_HOST_DEVICE inline T NAME(T lhs, T rhs) {                 \
+        return T(static_cast<float>(lhs) OP static_cast<float>(rhs));     \
+    }                                                                     \
+    OPEN3D_HALF_HOST_DEVICE inline Half NAME(Half lhs, Half rhs) {        \
+        OPEN3D_HALF_NATIVE_OR_FLOAT(OP, HALF_INTRINSIC)                   \
+    }
+
+// Native half arithmetic requires sm_53. Elsewhere Half computes in float.
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 530
+#define OPEN3D_HALF_NATIVE_OR_FLOAT(OP, HALF_INTRINSIC)                   \
+    __half_raw a, b;                                                      \
+    a.x = lhs.bits;                                                       \
+    b.x = rhs.bits;                                                       \
+    __half_raw result = HALF_INTRINSIC(__half(a), __half(b));             \
+    return Half::FromBits(result.x);
+#else
+#define OPEN3D_HALF_NATIVE_OR_FLOAT(OP, HALF_INTRINSIC) \
+    return Half(static_cast<float>(lhs) OP static_cast<float>(rhs));
+#endif
+
+OPEN3D_HALF_ARITHMETIC(Add, +, __hadd)
+OPEN3D_HALF_ARITHMETIC(Sub, -, __hsub)
+OPEN3D_HALF_ARITHMETIC(Mul, *, __hmul)
+OPEN3D_HALF_ARITHMETIC(Div, /, __hdiv)
+
+#undef OPEN3D_HALF_NATIVE_OR_FLOAT
+#undef OPEN3D_HALF_ARITHMETIC
+
+template <typename T>
+using EnableIf16BitFloat =
+        typename std::enable_if<std::is_same<T, Half>::value ||
+                                        std::is_same<T, BFloat16>::value,
+                                int>::type;
+
+}  // namespace half_util
+
+// The arithmetic operators are templates so that they are only selected when
+// both operands have the same 16-bit type. Mixed expressions such as h * 2.0f
+// use the built-in float operators.
+template <typename T, half_util::EnableIf16BitFloat<T> = 0>
+OPEN3D_HALF_HOST_DEVICE inline T operator+(T lhs, T rhs) {
+    return half_util::Add(lhs, rhs);
+}
+
+template <typename T, half_util::EnableIf16BitFloat<T> = 0>
+OPEN3D_HALF_HOST_DEVICE inline T operator-(T lhs, T rhs) {
+    return half_util::Sub(lhs, rhs);
+}
+
+template <typename T, half_util::EnableIf16BitFloat<T> = 0>
+OPEN3D_HALF_HOST_DEVICE inline T operator*(T lhs, T rhs) {
+    return half_util::Mul(lhs, rhs);
+}
+
+template <typename T, half_util::EnableIf16BitFloat<T> = 0>
+OPEN3D_HALF_HOST_DEVICE inline T operator/(T lhs, T rhs) {
+    return half_util::Div(lhs, rhs);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -183,6 +183,10 @@ Indexer::Indexer(const std::vector<Tensor>& input_tensors,
         for (int64_t i = 0; i < ndims_; ++i) {
             master_shape_[i] = outputs_[0].shape_[i];
         }
+
+        // Combine dimensions to reduce index computation. Contiguous
+        // operands of the same shape end up with a single dimension.
+        CoalesceBroadcastDimensions();
     }
 
     // Fill global strides master_strides_.
@@ -451,6 +455,79 @@ void Indexer::CoalesceDimensions() {
     UpdateMasterStrides();
 }
 
+void Indexer::CoalesceBroadcastDimensions() {
+    if (ndims_ <= 1) {
+        return;
+    }
+
+    auto can_coalesce = [&](int64_t dim0, int64_t dim1) {
+        auto shape0 = master_shape_[dim0];
+        auto shape1 = master_shape_[dim1];
+        if (shape0 == 1 || shape1 == 1) {
+            return true;
+        }
+        for (int64_t i = 0; i < num_inputs_; i++) {
+            auto& stride = inputs_[i].byte_strides_;
+            if (stride[dim0] != shape1 * stride[dim1]) {
+                return false;
+            }
+        }
+        for (int64_t i = 0; i < num_outputs_; i++) {
+            auto& stride = outputs_[i].byte_strides_;
+            if (stride[dim0] != shape1 * stride[dim1]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Merge dim1 into dim0. The inner stride is kept unless dim1 has size 1.
+    auto merge = [&](TensorRef& tr, int64_t dim0, int64_t dim1) {
+        if (master_shape_[dim1] != 1) {
+            tr.byte_strides_[dim0] = tr.byte_strides_[dim1];
+        }
+        tr.shape_[dim0] *= tr.shape_[dim1];
+    };
+
+    // Move dim1 to dim0.
+    auto move = [&](TensorRef& tr, int64_t dim0, int64_t dim1) {
+        tr.byte_strides_[dim0] = tr.byte_strides_[dim1];
+        tr.shape_[dim0] = tr.shape_[dim1];
+    };
+
+    int64_t prev_dim = 0;
+    for (int64_t dim = 1; dim < ndims_; dim++) {
+        if (can_coalesce(prev_dim, dim)) {
+            for (int64_t i = 0; i < num_inputs_; i++) {
+                merge(inputs_[i], prev_dim, dim);
+            }
+            for (int64_t i = 0; i < num_outputs_; i++) {
+                merge(outputs_[i], prev_dim, dim);
+            }
+            master_shape_[prev_dim] *= master_shape_[dim];
+        } else {
+            prev_dim++;
+            if (prev_dim != dim) {
+                for (int64_t i = 0; i < num_inputs_; i++) {
+                    move(inputs_[i], prev_dim, dim);
+                }
+                for (int64_t i = 0; i < num_outputs_; i++) {
+                    move(outputs_[i], prev_dim, dim);
+                }
+                master_shape_[prev_dim] = master_shape_[dim];
+            }
+        }
+    }
+
+    ndims_ = prev_dim + 1;
+    for (int64_t i = 0; i < num_inputs_; i++) {
+        inputs_[i].ndims_ = ndims_;
+    }
+    for (int64_t i = 0; i < num_outputs_; i++) {
+        outputs_[i].ndims_ = ndims_;
+    }
+}
+
 void Indexer::ReorderDimensions(const SizeVector& reduction_dims) {
     if (ndims_ == 1) {
         return;
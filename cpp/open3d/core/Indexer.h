@@ -394,6 +394,28 @@ public:
         return outputs_[0].byte_strides_[dim] == 0 && master_shape_[dim] > 1;
     }
 
+    /// Returns true if the workloads span a single dimension after the
+    /// dimensions are coalesced, i.e. every operand advances by a constant
+    /// byte stride per workload. This is the case when all operands are
+    /// contiguous (or uniformly strided) with the same shape, or broadcasted
+    /// from a single element. Launchers can then step through the operands
+    /// with GetInputByteStride() and GetOutputByteStride() instead of computing
+    /// the offsets of every workload.
+    OPEN3D_HOST_DEVICE bool IsFlat() const { return ndims_ <= 1; }
+
+    /// Byte stride of input \p input_idx per workload, only valid if
+    /// IsFlat().
+    OPEN3D_HOST_DEVICE int64_t GetInputByteStride(int64_t input_idx) const {
+        return ndims_ == 0 ? 0 : inputs_[input_idx].byte_strides_[0];
+    }
+
+    /// Byte stride of output \p output_idx per workload, only valid if
+    /// IsFlat().
+    OPEN3D_HOST_DEVICE int64_t
+    GetOutputByteStride(int64_t output_idx = 0) const {
+        return ndims_ == 0 ? 0 : outputs_[output_idx].byte_strides_[0];
+    }
+
     /// Get input Tensor data pointer based on \p workload_idx.
     ///
     /// \param input_idx Input tensor index.
@@ -424,6 +446,13 @@ protected:
     /// shape[n] * stride[n] == shape[n + 1]
     void CoalesceDimensions();
 
+    /// Merge adjacent dimensions dim0 (outer) and dim1 (inner) if either dim
+    /// is 1 or if for all operands: stride[dim0] == shape[dim1] * stride[dim1].
+    /// Unlike CoalesceDimensions, which runs after the reduction dimensions are
+    /// reordered, this keeps the row-major order of the workloads, such that
+    /// workload_idx remains the linear index of the output element.
+    void CoalesceBroadcastDimensions();
+
     // Permute reduction dimensions to front.
     // TODO: Sort the dimensions based on strides in ascending orderto improve
     // thread coalescing.
@@ -479,11 +508,16 @@ protected:
         if (workload_idx < 0) {
             return nullptr;
         }
+        if (ndims_ == 0) {
+            return static_cast<char*>(tr.data_ptr_);
+        }
+        // The innermost master stride is always 1, which saves a division.
         int64_t offset = 0;
-        for (int64_t i = 0; i < ndims_; ++i) {
+        for (int64_t i = 0; i < ndims_ - 1; ++i) {
             offset += workload_idx / master_strides_[i] * tr.byte_strides_[i];
             workload_idx = workload_idx % master_strides_[i];
         }
+        offset += workload_idx * tr.byte_strides_[ndims_ - 1];
         return static_cast<char*>(tr.data_ptr_) + offset;
     }
 
@@ -527,6 +561,89 @@ protected:
     bool accumulate_ = false;
 };
 
+/// Compact copy of an Indexer with a compile-time number of dimensions and
+/// operands, for passing to device kernels by value. An Indexer holds
+/// MAX_DIMS shapes and strides for MAX_INPUTS + MAX_OUTPUTS operands
+/// regardless of the actual op, while StaticIndexer only holds what the
+/// offset computation needs, and the division loop is unrolled over NDIMS.
+///
+/// \tparam NDIMS Number of dimensions, must equal Indexer::NumDims().
+/// \tparam NINPUTS Number of inputs, must equal Indexer::NumInputs().
+/// \tparam NOUTPUTS Number of outputs.
+template <int NDIMS, int NINPUTS, int NOUTPUTS = 1>
+class StaticIndexer {
+    static_assert(NDIMS >= 1 && NDIMS <= MAX_DIMS, "Invalid NDIMS.");
+    static_assert(NINPUTS >= 1 && NINPUTS <= MAX_INPUTS, "Invalid NINPUTS.");
+    static_assert(NOUTPUTS >= 1 && NOUTPUTS <= MAX_OUTPUTS,
+                  "Invalid NOUTPUTS.");
+
+public:
+    StaticIndexer(const Indexer& indexer) {
+        if (indexer.NumDims() != NDIMS || indexer.NumInputs() != NINPUTS) {
+            utility::LogError(
+                    "StaticIndexer<{}, {}> cannot be created from an Indexer "
+                    "with {} dims and {} inputs.",
+                    NDIMS, NINPUTS, indexer.NumDims(), indexer.NumInputs());
+        }
+        for (int dim = 0; dim < NDIMS; ++dim) {
+            master_strides_[dim] = indexer.GetMasterStrides()[dim];
+        }
+        for (int i = 0; i < NINPUTS; ++i) {
+            const TensorRef& tr = indexer.GetInput(i);
+            input_ptrs_[i] = static_cast<char*>(tr.data_ptr_);
+            for (int dim = 0; dim < NDIMS; ++dim) {
+                input_byte_strides_[i][dim] = tr.byte_strides_[dim];
+            }
+        }
+        for (int i = 0; i < NOUTPUTS; ++i) {
+            const TensorRef& tr = indexer.GetOutput(i);
+            output_ptrs_[i] = static_cast<char*>(tr.data_ptr_);
+            for (int dim = 0; dim < NDIMS; ++dim) {
+                output_byte_strides_[i][dim] = tr.byte_strides_[dim];
+            }
+        }
+    }
+
+    /// Same as Indexer::GetInputPtr.
+    OPEN3D_HOST_DEVICE char* GetInputPtr(int input_idx,
+                                         int64_t workload_idx) const {
+        return input_ptrs_[input_idx] +
+               GetOffset(input_byte_strides_[input_idx], workload_idx);
+    }
+
+    /// Same as Indexer::GetOutputPtr.
+    OPEN3D_HOST_DEVICE char* GetOutputPtr(int64_t workload_idx) const {
+        return output_ptrs_[0] +
+               GetOffset(output_byte_strides_[0], workload_idx);
+    }
+    OPEN3D_HOST_DEVICE char* GetOutputPtr(int output_idx,
+                                          int64_t workload_idx) const {
+        return output_ptrs_[output_idx] +
+               GetOffset(output_byte_strides_[output_idx], workload_idx);
+    }
+
+private:
+    OPEN3D_HOST_DEVICE int64_t GetOffset(const int64_t* byte_strides,
+                                         int64_t workload_idx) const {
+        // The innermost master stride is always 1, which saves a division.
+        int64_t offset = 0;
+#if defined(__CUDA_ARCH__)
+#pragma unroll
+#endif
+        for (int dim = 0; dim < NDIMS - 1; ++dim) {
+            offset += workload_idx / master_strides_[dim] * byte_strides[dim];
+            workload_idx = workload_idx % master_strides_[dim];
+        }
+        return offset + workload_idx * byte_strides[NDIMS - 1];
+    }
+
+    char* input_ptrs_[NINPUTS];
+    char* output_ptrs_[NOUTPUTS];
+    int64_t master_strides_[NDIMS];
+    int64_t input_byte_strides_[NINPUTS][NDIMS];
+    int64_t output_byte_strides_[NOUTPUTS][NDIMS];
+};
+
 class IndexerIterator {
 public:
     struct Iterator {
@@ -31,6 +31,7 @@
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryStatistics.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
 
@@ -38,13 +39,29 @@ namespace open3d {
 namespace core {
 
 void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
-    return GetDeviceMemoryManager(device)->Malloc(byte_size, device);
+    void* ptr = GetDeviceMemoryManager(device)->Malloc(byte_size, device);
+    MemoryTracker::GetInstance().RecordMalloc(ptr, byte_size, device);
+    return ptr;
 }
 
 void MemoryManager::Free(void* ptr, const Device& device) {
+    MemoryTracker::GetInstance().RecordFree(ptr, device);
     return GetDeviceMemoryManager(device)->Free(ptr, device);
 }
 
+void* MemoryManager::MallocPinned(size_t byte_size) {
+    static const Device host("CPU:0");
+    void* ptr = GetPinnedMemoryManager()->Malloc(byte_size, host);
+    MemoryTracker::GetInstance().RecordMalloc(ptr, byte_size, host);
+    return ptr;
+}
+
+void MemoryManager::FreePinned(void* ptr) {
+    static const Device host("CPU:0");
+    MemoryTracker::GetInstance().RecordFree(ptr, host);
+    GetPinnedMemoryManager()->Free(ptr, host);
+}
+
 void MemoryManager::Memcpy(void* dst_ptr,
                            const Device& dst_device,
                            const void* src_ptr,
@@ -75,6 +92,34 @@ void MemoryManager::Memcpy(void* dst_ptr,
     }
 
     device_mm->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+    MemoryTracker::GetInstance().RecordMemcpy(dst_device, src_device,
+                                              num_bytes);
+}
+
+void MemoryManager::MemcpyAsync(void* dst_ptr,
+                                const Device& dst_device,
+                                const void* src_ptr,
+                                const Device& src_device,
+                                size_t num_bytes,
+                                const CUDAStream& stream) {
+    if (dst_device.GetType() == Device::DeviceType::CPU &&
+        src_device.GetType() == Device::DeviceType::CPU) {
+        Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+        return;
+    }
+    if (num_bytes == 0) {
+        return;
+    } else if (src_ptr == nullptr || dst_ptr == nullptr) {
+        utility::LogError("src_ptr and dst_ptr cannot be nullptr.");
+    }
+#ifdef BUILD_CUDA_MODULE
+    CUDAMemcpyAsync(dst_ptr, dst_device, src_ptr, src_device, num_bytes,
+                    stream);
+    MemoryTracker::GetInstance().RecordMemcpy(dst_device, src_device,
+                                              num_bytes);
+#else
+    utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
 }
 
 void MemoryManager::MemcpyFromHost(void* dst_ptr,
@@ -119,5 +164,11 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
     return map_device_type_to_memory_manager.at(device.GetType());
 }
 
+std::shared_ptr<DeviceMemoryManager> MemoryManager::GetPinnedMemoryManager() {
+    static std::shared_ptr<DeviceMemoryManager> pinned_mm =
+            std::make_shared<CPUPinnedMemoryManager>();
+    return pinned_mm;
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -26,12 +26,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 
+#include "open3d/core/CUDAStream.h"
 #include "open3d/core/Device.h"
 
 namespace open3d {
@@ -48,6 +50,24 @@ public:
                        const void* src_ptr,
                        const Device& src_device,
                        size_t num_bytes);
+    /// Asynchronous Memcpy on \p stream. For copies involving a CUDA device,
+    /// the call returns once the copy is queued. Host memory is only copied
+    /// without blocking the host if it is page-locked, otherwise the CUDA
+    /// driver stages it synchronously. Both buffers must stay alive until the
+    /// stream is synchronized. CPU to CPU copies are synchronous.
+    static void MemcpyAsync(void* dst_ptr,
+                            const Device& dst_device,
+                            const void* src_ptr,
+                            const Device& src_device,
+                            size_t num_bytes,
+                            const CUDAStream& stream);
+    /// Allocates page-locked (pinned) host memory on CPU:0. Copies between
+    /// pinned memory and CUDA devices run at full bandwidth and can overlap
+    /// with computation when queued with MemcpyAsync. Without CUDA support,
+    /// this falls back to the regular CPU allocator.
+    static void* MallocPinned(size_t byte_size);
+    /// Frees memory allocated with MallocPinned.
+    static void FreePinned(void* ptr);
     /// Same as Memcpy, but with host (CPU:0) as default src_device
     static void MemcpyFromHost(void* dst_ptr,
                                const Device& dst_device,
@@ -62,6 +82,7 @@ public:
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
+    static std::shared_ptr<DeviceMemoryManager> GetPinnedMemoryManager();
 };
 
 class DeviceMemoryManager {
@@ -76,6 +97,23 @@ public:
     virtual ~DeviceMemoryManager() {}
 };
 
+/// Statistics of a caching memory manager.
+struct MemoryCacheStatistics {
+    /// Number of Malloc calls served from the cache.
+    int64_t num_hits_ = 0;
+    /// Number of Malloc calls that went to the system allocator.
+    int64_t num_misses_ = 0;
+    /// Bytes currently held by the cache (not in use by any tensor).
+    int64_t cached_bytes_ = 0;
+
+    /// Returns num_hits_ / (num_hits_ + num_misses_), or 0 if no Malloc call
+    /// has been recorded.
+    double HitRate() const {
+        int64_t total = num_hits_ + num_misses_;
+        return total == 0 ? 0.0 : static_cast<double>(num_hits_) / total;
+    }
+};
+
 class CPUMemoryManager : public DeviceMemoryManager {
 public:
     CPUMemoryManager();
@@ -86,6 +124,46 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+
+public:
+    /// Enables or disables the size-class cache. When enabled, freed blocks
+    /// are kept in per-thread and global free lists and reused by following
+    /// Malloc calls of the same size class. It can be toggled at any time,
+    /// memory allocated in either mode can be freed in the other mode.
+    ///
+    /// The initial value is read from the environment variable
+    /// OPEN3D_CPU_MEMORY_CACHE (1 to enable), and defaults to disabled.
+    static void SetCacheEnabled(bool enabled);
+    static bool IsCacheEnabled();
+
+    /// Releases the global cache and the cache of the calling thread to the
+    /// system. The caches of other threads are released on their next
+    /// Malloc or Free.
+    static void ReleaseCache();
+
+    static MemoryCacheStatistics GetCacheStatistics();
+};
+
+/// Page-locked host memory manager. Freed blocks are cached by exact size,
+/// since pinning pages is much more expensive than a regular allocation and
+/// staging buffers (e.g. sensor frames) are usually reallocated with the same
+/// size. Memory is always addressed as CPU:0 memory.
+class CPUPinnedMemoryManager : public DeviceMemoryManager {
+public:
+    CPUPinnedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Releases all cached pinned blocks to the system.
+    static void ReleaseCache();
+
+    static MemoryCacheStatistics GetCacheStatistics();
 };
 
 #ifdef BUILD_CUDA_MODULE
@@ -121,6 +199,8 @@ public:
 public:
     static void ReleaseCache();
 
+    static MemoryCacheStatistics GetCacheStatistics();
+
 protected:
     bool IsCUDAPointer(const void* ptr);
 };
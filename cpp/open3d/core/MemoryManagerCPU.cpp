@@ -24,28 +24,288 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <atomic>
 #include <cstdlib>
+#include <mutex>
+#include <vector>
 
 #include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace core {
 
+// Every CPU allocation is prefixed with a header that records its size class,
+// such that Free works regardless of whether the cache was enabled at Malloc
+// time. The header size keeps the 16-byte alignment of std::malloc.
+struct CPUBlockHeader {
+    int64_t size_class_;
+    int64_t padding_;
+};
+static_assert(sizeof(CPUBlockHeader) == 16, "CPUBlockHeader must be 16 bytes");
+
+// Size classes. Each power-of-two interval (2^k, 2^(k+1)] is split into 4
+// classes to bound the internal fragmentation to 25%. Blocks larger than
+// kMaxCachedSize are never cached.
+static constexpr int64_t kUncachedSizeClass = -1;
+static constexpr int kMinSizeLog2 = 6;   // 64 bytes.
+static constexpr int kMaxSizeLog2 = 28;  // 256 MiB.
+static constexpr int kNumSizeClasses = (kMaxSizeLog2 - kMinSizeLog2) * 4 + 1;
+static constexpr size_t kMaxCachedSize = size_t(1) << kMaxSizeLog2;
+
+// Per-thread fast path limits. Larger blocks only go to the global cache.
+static constexpr int kMaxThreadBlocksPerClass = 4;
+static constexpr size_t kMaxThreadCachedSize = size_t(1) << 20;  // 1 MiB.
+
+// Cached blocks beyond this limit are returned to the system.
+static constexpr int64_t kMaxGlobalCachedBytes = int64_t(1) << 30;  // 1 GiB.
+
+/// Returns the size class of \p byte_size and writes the class' block size to
+/// \p class_size. Returns kUncachedSizeClass for oversized blocks.
+static int64_t GetSizeClass(size_t byte_size, size_t& class_size) {
+    if (byte_size > kMaxCachedSize) {
+        class_size = byte_size;
+        return kUncachedSizeClass;
+    }
+    if (byte_size <= (size_t(1) << kMinSizeLog2)) {
+        class_size = size_t(1) << kMinSizeLog2;
+        return 0;
+    }
+    int k = kMinSizeLog2;
+    while ((size_t(1) << (k + 1)) < byte_size) {
+        ++k;
+    }
+    // 2^k < byte_size <= 2^(k+1).
+    const size_t base = size_t(1) << k;
+    const size_t step = base >> 2;
+    const size_t m = (byte_size - base + step - 1) / step;  // 1..4
+    class_size = base + m * step;
+    return (k - kMinSizeLog2) * 4 + static_cast<int64_t>(m);
+}
+
+static size_t GetSizeClassBytes(int64_t size_class) {
+    if (size_class == 0) {
+        return size_t(1) << kMinSizeLog2;
+    }
+    const int k = static_cast<int>((size_class - 1) / 4) + kMinSizeLog2;
+    const size_t m = static_cast<size_t>((size_class - 1) % 4) + 1;
+    return (size_t(1) << k) + m * ((size_t(1) << k) >> 2);
+}
+
+static bool ReadCacheEnabledFromEnv() {
+    const char* env = std::getenv("OPEN3D_CPU_MEMORY_CACHE");
+    return env != nullptr && std::string(env) == "1";
+}
+
+/// Global state of the CPU cache. Free lists are protected by one mutex per
+/// size class. The statistics are updated with relaxed atomics.
+class CPUCacher {
+public:
+    /// The instance is intentionally leaked, since tensors with static storage
+    /// duration may be freed after static destructors have run.
+    static CPUCacher& GetInstance() {
+        static CPUCacher* instance = new CPUCacher();
+        return *instance;
+    }
+
+    /// Pops a block of \p size_class from the global free list, or returns
+    /// nullptr.
+    void* Pop(int64_t size_class) {
+        std::lock_guard<std::mutex> lock(mutexes_[size_class]);
+        std::vector<void*>& list = free_lists_[size_class];
+        if (list.empty()) {
+            return nullptr;
+        }
+        void* base = list.back();
+        list.pop_back();
+        cached_bytes_ -= GetSizeClassBytes(size_class);
+        return base;
+    }
+
+    /// Pushes a block to the global free list. Returns false if the cache is
+    /// full and the block shall be returned to the system.
+    bool Push(int64_t size_class, void* base) {
+        const int64_t bytes = GetSizeClassBytes(size_class);
+        if (cached_bytes_ + bytes > kMaxGlobalCachedBytes) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutexes_[size_class]);
+        free_lists_[size_class].push_back(base);
+        cached_bytes_ += bytes;
+        return true;
+    }
+
+    void ReleaseGlobal() {
+        int64_t total_bytes = 0;
+        for (int64_t size_class = 0; size_class < kNumSizeClasses;
+             ++size_class) {
+            std::lock_guard<std::mutex> lock(mutexes_[size_class]);
+            for (void* base : free_lists_[size_class]) {
+                std::free(base);
+            }
+            const int64_t bytes = GetSizeClassBytes(size_class) *
+                                  free_lists_[size_class].size();
+            cached_bytes_ -= bytes;
+            total_bytes += bytes;
+            free_lists_[size_class].clear();
+        }
+        utility::LogDebug("[CPUCacher] {} bytes released.", total_bytes);
+    }
+
+    std::atomic<bool> enabled_{ReadCacheEnabledFromEnv()};
+    std::atomic<int64_t> epoch_{0};
+    std::atomic<int64_t> num_hits_{0};
+    std::atomic<int64_t> num_misses_{0};
+    std::atomic<int64_t> cached_bytes_{0};
+
+private:
+    CPUCacher() = default;
+
+    std::vector<void*> free_lists_[kNumSizeClasses];
+    std::mutex mutexes_[kNumSizeClasses];
+};
+
+/// Per-thread fast path for small blocks that does not take any lock. Blocks
+/// are handed back to the global cache when the thread exits, or dropped when
+/// ReleaseCache() has been called since the last access (epoch mismatch).
+class CPUThreadCacher {
+public:
+    /// Returns nullptr if the calling thread's cache has been destroyed, e.g.
+    /// when a tensor is freed during thread exit.
+    static CPUThreadCacher* GetInstance() {
+        if (destroyed_) {
+            return nullptr;
+        }
+        thread_local CPUThreadCacher instance;
+        return &instance;
+    }
+
+    CPUThreadCacher() : global_(CPUCacher::GetInstance()) {
+        epoch_ = global_.epoch_.load();
+    }
+
+    ~CPUThreadCacher() {
+        Flush(/*to_global=*/true);
+        destroyed_ = true;
+    }
+
+    void* Pop(int64_t size_class) {
+        SyncEpoch();
+        Slot& slot = slots_[size_class];
+        if (slot.count_ == 0) {
+            return nullptr;
+        }
+        global_.cached_bytes_ -= GetSizeClassBytes(size_class);
+        return slot.blocks_[--slot.count_];
+    }
+
+    bool Push(int64_t size_class, void* base) {
+        SyncEpoch();
+        Slot& slot = slots_[size_class];
+        if (slot.count_ == kMaxThreadBlocksPerClass) {
+            return false;
+        }
+        slot.blocks_[slot.count_++] = base;
+        global_.cached_bytes_ += GetSizeClassBytes(size_class);
+        return true;
+    }
+
+    /// Returns all blocks either to the global cache or to the system.
+    void Flush(bool to_global) {
+        for (int64_t size_class = 0; size_class < kNumSizeClasses;
+             ++size_class) {
+            Slot& slot = slots_[size_class];
+            for (int i = 0; i < slot.count_; ++i) {
+                global_.cached_bytes_ -= GetSizeClassBytes(size_class);
+                if (!to_global || !global_.Push(size_class, slot.blocks_[i])) {
+                    std::free(slot.blocks_[i]);
+                }
+            }
+            slot.count_ = 0;
+        }
+    }
+
+private:
+    void SyncEpoch() {
+        int64_t global_epoch = global_.epoch_.load(std::memory_order_relaxed);
+        if (epoch_ != global_epoch) {
+            Flush(/*to_global=*/false);
+            epoch_ = global_epoch;
+        }
+    }
+
+    struct Slot {
+        void* blocks_[kMaxThreadBlocksPerClass];
+        int count_ = 0;
+    };
+
+    CPUCacher& global_;
+    int64_t epoch_;
+    Slot slots_[kNumSizeClasses];
+
+    // Trivially destructible, hence valid during the whole thread lifetime.
+    static thread_local bool destroyed_;
+};
+
+thread_local bool CPUThreadCacher::destroyed_ = false;
+
 CPUMemoryManager::CPUMemoryManager() {}
 
 void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
-    void* ptr;
-    ptr = std::malloc(byte_size);
-    if (byte_size != 0 && !ptr) {
-        utility::LogError("CPU malloc failed");
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    size_t class_size = byte_size;
+    int64_t size_class = kUncachedSizeClass;
+    void* base = nullptr;
+
+    if (cacher.enabled_.load(std::memory_order_relaxed)) {
+        size_class = GetSizeClass(byte_size, class_size);
+        if (size_class != kUncachedSizeClass) {
+            CPUThreadCacher* thread_cacher = CPUThreadCacher::GetInstance();
+            if (thread_cacher && class_size <= kMaxThreadCachedSize) {
+                base = thread_cacher->Pop(size_class);
+            }
+            if (base == nullptr) {
+                base = cacher.Pop(size_class);
+            }
+            if (base != nullptr) {
+                cacher.num_hits_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                cacher.num_misses_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
     }
-    return ptr;
+
+    if (base == nullptr) {
+        base = std::malloc(sizeof(CPUBlockHeader) + class_size);
+        if (!base) {
+            utility::LogError("CPU malloc failed");
+        }
+        static_cast<CPUBlockHeader*>(base)->size_class_ = size_class;
+    }
+    return static_cast<char*>(base) + sizeof(CPUBlockHeader);
 }
 
 void CPUMemoryManager::Free(void* ptr, const Device& device) {
-    if (ptr) {
-        std::free(ptr);
+    if (!ptr) {
+        return;
+    }
+    void* base = static_cast<char*>(ptr) - sizeof(CPUBlockHeader);
+    const int64_t size_class = static_cast<CPUBlockHeader*>(base)->size_class_;
+
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    if (size_class != kUncachedSizeClass &&
+        cacher.enabled_.load(std::memory_order_relaxed)) {
+        CPUThreadCacher* thread_cacher = CPUThreadCacher::GetInstance();
+        if (thread_cacher &&
+            GetSizeClassBytes(size_class) <= kMaxThreadCachedSize &&
+            thread_cacher->Push(size_class, base)) {
+            return;
+        }
+        if (cacher.Push(size_class, base)) {
+            return;
+        }
     }
+    std::free(base);
 }
 
 void CPUMemoryManager::Memcpy(void* dst_ptr,
@@ -56,5 +316,34 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
     std::memcpy(dst_ptr, src_ptr, num_bytes);
 }
 
+void CPUMemoryManager::SetCacheEnabled(bool enabled) {
+    CPUCacher::GetInstance().enabled_ = enabled;
+    if (!enabled) {
+        ReleaseCache();
+    }
+}
+
+bool CPUMemoryManager::IsCacheEnabled() {
+    return CPUCacher::GetInstance().enabled_;
+}
+
+void CPUMemoryManager::ReleaseCache() {
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    cacher.epoch_++;
+    if (CPUThreadCacher* thread_cacher = CPUThreadCacher::GetInstance()) {
+        thread_cacher->Flush(/*to_global=*/false);
+    }
+    cacher.ReleaseGlobal();
+}
+
+MemoryCacheStatistics CPUMemoryManager::GetCacheStatistics() {
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    MemoryCacheStatistics stats;
+    stats.num_hits_ = cacher.num_hits_;
+    stats.num_misses_ = cacher.num_misses_;
+    stats.cached_bytes_ = cacher.cached_bytes_;
+    return stats;
+}
+
 }  // namespace core
 }  // namespace open3d
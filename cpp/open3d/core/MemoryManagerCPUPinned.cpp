@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef BUILD_CUDA_MODULE
+#include <cuda_runtime.h>
+#endif
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+// Cached blocks beyond this limit are returned to the system.
+static constexpr size_t kMaxPinnedCachedBytes = size_t(1) << 29;  // 512 MiB.
+
+class PinnedCacher {
+public:
+    // Intentionally leaked, such that tensors destroyed during static
+    // destruction can still be freed.
+    static PinnedCacher& GetInstance() {
+        static PinnedCacher* instance = new PinnedCacher();
+        return *instance;
+    }
+
+    void* Malloc(size_t byte_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = free_blocks_.find(byte_size);
+        if (it != free_blocks_.end()) {
+            void* ptr = it->second;
+            free_blocks_.erase(it);
+            cached_bytes_ -= byte_size;
+            ++num_hits_;
+            used_blocks_[ptr] = byte_size;
+            return ptr;
+        }
+        ++num_misses_;
+        void* ptr = AllocateRaw(byte_size);
+        used_blocks_[ptr] = byte_size;
+        return ptr;
+    }
+
+    void Free(void* ptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = used_blocks_.find(ptr);
+        if (it == used_blocks_.end()) {
+            utility::LogError(
+                    "CPUPinnedMemoryManager::Free: memory {} was not "
+                    "allocated by this manager.",
+                    fmt::ptr(ptr));
+        }
+        size_t byte_size = it->second;
+        used_blocks_.erase(it);
+        if (cached_bytes_ + byte_size > kMaxPinnedCachedBytes) {
+            FreeRaw(ptr);
+        } else {
+            free_blocks_.emplace(byte_size, ptr);
+            cached_bytes_ += byte_size;
+        }
+    }
+
+    void ReleaseCache() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kv : free_blocks_) {
+            FreeRaw(kv.second);
+        }
+        free_blocks_.clear();
+        cached_bytes_ = 0;
+    }
+
+    MemoryCacheStatistics GetStatistics() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        MemoryCacheStatistics stats;
+        stats.num_hits_ = num_hits_;
+        stats.num_misses_ = num_misses_;
+        stats.cached_bytes_ = static_cast<int64_t>(cached_bytes_);
+        return stats;
+    }
+
+private:
+    PinnedCacher() {}
+
+    static void* AllocateRaw(size_t byte_size) {
+#ifdef BUILD_CUDA_MODULE
+        void* ptr = nullptr;
+        // Portable: the memory is pinned for all CUDA contexts.
+        OPEN3D_CUDA_CHECK(
+                cudaHostAlloc(&ptr, byte_size, cudaHostAllocPortable));
+        return ptr;
+#else
+        void* ptr = std::malloc(byte_size);
+        if (byte_size != 0 && !ptr) {
+            utility::LogError("CPUPinnedMemoryManager::Malloc failed.");
+        }
+        return ptr;
+#endif
+    }
+
+    static void FreeRaw(void* ptr) {
+#ifdef BUILD_CUDA_MODULE
+        OPEN3D_CUDA_CHECK(cudaFreeHost(ptr));
+#else
+        std::free(ptr);
+#endif
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<void*, size_t> used_blocks_;
+    std::multimap<size_t, void*> free_blocks_;
+    size_t cached_bytes_ = 0;
+    int64_t num_hits_ = 0;
+    int64_t num_misses_ = 0;
+};
+
+CPUPinnedMemoryManager::CPUPinnedMemoryManager() {}
+
+void* CPUPinnedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "CPUPinnedMemoryManager::Malloc: Unimplemented device {}.",
+                device.ToString());
+    }
+    return PinnedCacher::GetInstance().Malloc(byte_size);
+}
+
+void CPUPinnedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr) {
+        PinnedCacher::GetInstance().Free(ptr);
+    }
+}
+
+void CPUPinnedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUPinnedMemoryManager::ReleaseCache() {
+    PinnedCacher::GetInstance().ReleaseCache();
+}
+
+MemoryCacheStatistics CPUPinnedMemoryManager::GetCacheStatistics() {
+    return PinnedCacher::GetInstance().GetStatistics();
+}
+
+}  // namespace core
+}  // namespace open3d
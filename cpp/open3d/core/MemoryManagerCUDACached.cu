@@ -141,12 +141,14 @@ public:
         BlockPtr found_block = find_free_block(&query_block);
 
         if (found_block == nullptr) {
+            num_misses_++;
             // Allocate a new block and insert it to the allocated pool
             OPEN3D_CUDA_CHECK(cudaMalloc(&ptr, alloc_size));
             BlockPtr new_block = new Block(device.GetID(), alloc_size, ptr);
             new_block->in_use_ = true;
             allocated_blocks_.insert({ptr, new_block});
         } else {
+            num_hits_++;
             ptr = found_block->ptr_;
 
             size_t remain_size = found_block->size_ - alloc_size;
@@ -283,11 +285,31 @@ public:
         utility::LogDebug("[CUDACacher] {} bytes released.", total_bytes);
     }
 
+    MemoryCacheStatistics GetCacheStatistics() {
+        auto pool_bytes = [](const BlockPool& pool) {
+            int64_t bytes = 0;
+            for (const BlockPtr& block : pool) {
+                bytes += block->size_;
+            }
+            return bytes;
+        };
+
+        MemoryCacheStatistics stats;
+        stats.num_hits_ = num_hits_;
+        stats.num_misses_ = num_misses_;
+        stats.cached_bytes_ =
+                pool_bytes(*small_block_pool_) + pool_bytes(*large_block_pool_);
+        return stats;
+    }
+
 private:
     std::unordered_map<void*, BlockPtr> allocated_blocks_;
     std::shared_ptr<BlockPool> small_block_pool_;
     std::shared_ptr<BlockPool> large_block_pool_;
 
+    int64_t num_hits_ = 0;
+    int64_t num_misses_ = 0;
+
     static std::shared_ptr<CUDACacher> instance_;
 };
 
@@ -402,5 +424,10 @@ void CUDACachedMemoryManager::ReleaseCache() {
     instance->ReleaseCache();
 }
 
+MemoryCacheStatistics CUDACachedMemoryManager::GetCacheStatistics() {
+    std::shared_ptr<CUDACacher> instance = CUDACacher::GetInstance();
+    return instance->GetCacheStatistics();
+}
+
 }  // namespace core
 }  // namespace open3d
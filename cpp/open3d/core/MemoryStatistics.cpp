@@ -0,0 +1,200 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/MemoryStatistics.h"
+
+#include <cstdlib>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+std::string MemoryStatistics::ToString() const {
+    return fmt::format(
+            "live_bytes: {}, peak_bytes: {}, num_allocs: {}, num_frees: {}, "
+            "memcpy_in_bytes: {}, memcpy_out_bytes: {}",
+            live_bytes_, peak_bytes_, num_allocs_, num_frees_,
+            memcpy_in_bytes_, memcpy_out_bytes_);
+}
+
+static void AddAlloc(MemoryStatistics& stats, int64_t byte_size) {
+    stats.live_bytes_ += byte_size;
+    stats.peak_bytes_ = std::max(stats.peak_bytes_, stats.live_bytes_);
+    stats.num_allocs_++;
+}
+
+static void AddFree(MemoryStatistics& stats, int64_t byte_size) {
+    stats.live_bytes_ -= byte_size;
+    stats.num_frees_++;
+}
+
+MemoryTracker::MemoryTracker() {
+    const char* env = std::getenv("OPEN3D_MEMORY_STATISTICS");
+    enabled_ = env != nullptr && std::string(env) == "1";
+}
+
+MemoryTracker& MemoryTracker::GetInstance() {
+    // Leaked on purpose: tensors with static storage duration may be freed
+    // after static destructors have run.
+    static MemoryTracker* instance = new MemoryTracker();
+    return *instance;
+}
+
+void MemoryTracker::SetEnabled(bool enabled) { enabled_ = enabled; }
+
+MemoryStatistics MemoryTracker::GetStatistics(const Device& device) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = device_stats_.find(device.ToString());
+    return it == device_stats_.end() ? MemoryStatistics() : it->second;
+}
+
+MemoryStatistics MemoryTracker::GetStatistics(const Device& device,
+                                              const std::string& tag) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tag_stats_.find(device.ToString());
+    if (it == tag_stats_.end()) {
+        return MemoryStatistics();
+    }
+    auto tag_it = it->second.find(tag);
+    return tag_it == it->second.end() ? MemoryStatistics() : tag_it->second;
+}
+
+std::map<std::string, MemoryStatistics> MemoryTracker::GetTagStatistics(
+        const Device& device) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tag_stats_.find(device.ToString());
+    return it == tag_stats_.end() ? std::map<std::string, MemoryStatistics>()
+                                  : it->second;
+}
+
+std::vector<Device> MemoryTracker::GetDevices() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Device> devices;
+    for (const auto& kv : device_stats_) {
+        devices.push_back(Device(kv.first));
+    }
+    return devices;
+}
+
+void MemoryTracker::ResetStatistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto reset = [](MemoryStatistics& stats) {
+        MemoryStatistics new_stats;
+        new_stats.live_bytes_ = stats.live_bytes_;
+        new_stats.peak_bytes_ = stats.live_bytes_;
+        stats = new_stats;
+    };
+    for (auto& kv : device_stats_) {
+        reset(kv.second);
+    }
+    for (auto& kv : tag_stats_) {
+        for (auto& tag_kv : kv.second) {
+            reset(tag_kv.second);
+        }
+    }
+}
+
+void MemoryTracker::PrintStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& kv : device_stats_) {
+        utility::LogInfo("[MemoryTracker] {}: {}", kv.first,
+                         kv.second.ToString());
+        auto it = tag_stats_.find(kv.first);
+        if (it == tag_stats_.end()) {
+            continue;
+        }
+        for (const auto& tag_kv : it->second) {
+            utility::LogInfo("[MemoryTracker]     tag \"{}\": {}", tag_kv.first,
+                             tag_kv.second.ToString());
+        }
+    }
+}
+
+void MemoryTracker::RecordMalloc(void* ptr,
+                                 size_t byte_size,
+                                 const Device& device) {
+    if (!enabled_ || ptr == nullptr) {
+        return;
+    }
+    const std::string& tag = CurrentTag();
+    std::string device_str = device.ToString();
+    std::lock_guard<std::mutex> lock(mutex_);
+    AddAlloc(device_stats_[device_str], byte_size);
+    AddAlloc(tag_stats_[device_str][tag], byte_size);
+    allocations_[ptr] = {byte_size, device_str, tag};
+}
+
+void MemoryTracker::RecordFree(void* ptr, const Device& device) {
+    if (!enabled_ || ptr == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = allocations_.find(ptr);
+    if (it == allocations_.end()) {
+        // Allocated while tracking was disabled.
+        return;
+    }
+    const Allocation& allocation = it->second;
+    AddFree(device_stats_[allocation.device_], allocation.byte_size_);
+    AddFree(tag_stats_[allocation.device_][allocation.tag_],
+            allocation.byte_size_);
+    allocations_.erase(it);
+}
+
+void MemoryTracker::RecordMemcpy(const Device& dst_device,
+                                 const Device& src_device,
+                                 size_t num_bytes) {
+    if (!enabled_) {
+        return;
+    }
+    std::string dst_str = dst_device.ToString();
+    std::string src_str = src_device.ToString();
+    const std::string& tag = CurrentTag();
+    std::lock_guard<std::mutex> lock(mutex_);
+    device_stats_[dst_str].memcpy_in_bytes_ += num_bytes;
+    device_stats_[src_str].memcpy_out_bytes_ += num_bytes;
+    tag_stats_[dst_str][tag].memcpy_in_bytes_ += num_bytes;
+    tag_stats_[src_str][tag].memcpy_out_bytes_ += num_bytes;
+}
+
+std::string& MemoryTracker::CurrentTag() {
+    thread_local std::string tag;
+    return tag;
+}
+
+ScopedMemoryTag::ScopedMemoryTag(const std::string& tag) {
+    std::string& current_tag = MemoryTracker::CurrentTag();
+    parent_tag_ = current_tag;
+    current_tag = parent_tag_.empty() ? tag : parent_tag_ + "/" + tag;
+}
+
+ScopedMemoryTag::~ScopedMemoryTag() {
+    MemoryTracker::CurrentTag() = parent_tag_;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+/// Allocation statistics of one device, or of one tag on one device.
+struct MemoryStatistics {
+    /// Bytes currently allocated and not yet freed.
+    int64_t live_bytes_ = 0;
+    /// Maximum of live_bytes_ since the last reset.
+    int64_t peak_bytes_ = 0;
+    /// Number of Malloc calls.
+    int64_t num_allocs_ = 0;
+    /// Number of Free calls.
+    int64_t num_frees_ = 0;
+    /// Bytes copied to this device by Memcpy.
+    int64_t memcpy_in_bytes_ = 0;
+    /// Bytes copied from this device by Memcpy.
+    int64_t memcpy_out_bytes_ = 0;
+
+    std::string ToString() const;
+};
+
+/// \class MemoryTracker
+///
+/// Records the statistics of MemoryManager::Malloc, Free and Memcpy per device
+/// and per tag. Tags are set with ScopedMemoryTag and apply to allocations of
+/// the calling thread.
+///
+/// Tracking is disabled by default since it takes a lock on every allocation.
+/// It can be enabled with SetEnabled(true) or the environment variable
+/// OPEN3D_MEMORY_STATISTICS=1. Allocations made while tracking is disabled
+/// are not accounted for when freed.
+///
+/// Example usage:
+///
+/// ```cpp
+/// MemoryTracker::GetInstance().SetEnabled(true);
+/// {
+///     ScopedMemoryTag tag("integrate");
+///     volume.Integrate(depth, color, intrinsic, extrinsic);
+/// }
+/// MemoryStatistics stats =
+///         MemoryTracker::GetInstance().GetStatistics(Device("CUDA:0"));
+/// ```
+class MemoryTracker {
+public:
+    static MemoryTracker& GetInstance();
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return enabled_.load(); }
+
+    /// Statistics of all allocations on \p device.
+    MemoryStatistics GetStatistics(const Device& device) const;
+
+    /// Statistics of allocations on \p device made under \p tag. Untagged
+    /// allocations are recorded under the empty tag "".
+    MemoryStatistics GetStatistics(const Device& device,
+                                   const std::string& tag) const;
+
+    /// Returns statistics of all tags on \p device.
+    std::map<std::string, MemoryStatistics> GetTagStatistics(
+            const Device& device) const;
+
+    /// Returns all devices that have been recorded.
+    std::vector<Device> GetDevices() const;
+
+    /// Resets peaks to the current live bytes and clears the counters. Live
+    /// allocations keep being tracked.
+    void ResetStatistics();
+
+    /// Prints the statistics of all devices and tags with LogInfo.
+    void PrintStatistics() const;
+
+    /// Called by MemoryManager.
+    void RecordMalloc(void* ptr, size_t byte_size, const Device& device);
+    void RecordFree(void* ptr, const Device& device);
+    void RecordMemcpy(const Device& dst_device,
+                      const Device& src_device,
+                      size_t num_bytes);
+
+    /// Tag of the calling thread. Managed by ScopedMemoryTag.
+    static std::string& CurrentTag();
+
+private:
+    MemoryTracker();
+
+    struct Allocation {
+        size_t byte_size_;
+        std::string device_;
+        std::string tag_;
+    };
+
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_;
+    std::unordered_map<void*, Allocation> allocations_;
+    // device string -> tag -> statistics. The device total is kept separately
+    // since the peaks of the device and of its tags are taken at different
+    // times.
+    std::map<std::string, MemoryStatistics> device_stats_;
+    std::map<std::string, std::map<std::string, MemoryStatistics>> tag_stats_;
+};
+
+/// RAII guard that tags the allocations of the calling thread. Guards can be
+/// nested, the innermost tag is joined to its parents with "/", e.g.
+/// "slam/integrate".
+class ScopedMemoryTag {
+public:
+    explicit ScopedMemoryTag(const std::string& tag);
+    ~ScopedMemoryTag();
+
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+private:
+    std::string parent_tag_;
+};
+
+}  // namespace core
+}  // namespace open3d
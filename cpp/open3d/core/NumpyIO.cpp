@@ -50,6 +50,15 @@
 
 #include "open3d/core/NumpyIO.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <memory>
 #include <numeric>
 #include <regex>
@@ -243,6 +252,18 @@ NumpyArray::NumpyArray(const SizeVector& shape,
     blob_ = std::make_shared<Blob>(num_elements_ * word_size_, Device("CPU:0"));
 }
 
+NumpyArray::NumpyArray(const SizeVector& shape,
+                       char type,
+                       int64_t word_size,
+                       bool fortran_order,
+                       const std::shared_ptr<Blob>& blob)
+    : blob_(blob),
+      shape_(shape),
+      type_(type),
+      word_size_(word_size),
+      fortran_order_(fortran_order),
+      num_elements_(shape.NumElements()) {}
+
 NumpyArray::NumpyArray(const Tensor& t)
     : shape_(t.GetShape()),
       type_(DtypeToChar(t.GetDtype())),
@@ -304,6 +325,124 @@ NumpyArray NumpyArray::Load(const std::string& file_name) {
     return arr;
 }
 
+/// Maps the whole file into memory and returns a CPU:0 Blob pointing at byte
+/// \p data_offset of the mapping. The file is unmapped when the Blob is
+/// destroyed.
+static std::shared_ptr<Blob> MmapFileToBlob(const std::string& file_name,
+                                            int64_t data_offset,
+                                            int64_t data_size,
+                                            bool writable) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(
+            file_name.c_str(),
+            writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+            FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        utility::LogError("NumpyLoadMmap: Unable to open file {}.", file_name);
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) ||
+        file_size.QuadPart < data_offset + data_size) {
+        CloseHandle(file);
+        utility::LogError("NumpyLoadMmap: file {} is truncated.", file_name);
+    }
+    HANDLE mapping = CreateFileMappingA(
+            file, nullptr, writable ? PAGE_READWRITE : PAGE_WRITECOPY, 0, 0,
+            nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        utility::LogError("NumpyLoadMmap: Unable to map file {}.", file_name);
+    }
+    // The view keeps the mapping object alive.
+    void* base = MapViewOfFile(
+            mapping, writable ? FILE_MAP_WRITE : FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (base == nullptr) {
+        utility::LogError("NumpyLoadMmap: Unable to map file {}.", file_name);
+    }
+    auto deleter = [base](void*) { UnmapViewOfFile(base); };
+#else
+    int fd = open(file_name.c_str(), writable ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+        utility::LogError("NumpyLoadMmap: Unable to open file {}.", file_name);
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 ||
+        static_cast<int64_t>(file_stat.st_size) < data_offset + data_size) {
+        close(fd);
+        utility::LogError("NumpyLoadMmap: file {} is truncated.", file_name);
+    }
+    const size_t map_size = static_cast<size_t>(file_stat.st_size);
+    // A private mapping is copy-on-write: the tensor stays writable, but
+    // the file is only modified through a shared mapping.
+    void* base = mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+                      writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        utility::LogError("NumpyLoadMmap: Unable to map file {}.", file_name);
+    }
+    auto deleter = [base, map_size](void*) { munmap(base, map_size); };
+#endif
+    return std::make_shared<Blob>(Device("CPU:0"),
+                                  static_cast<char*>(base) + data_offset,
+                                  deleter);
+}
+
+NumpyArray NumpyArray::LoadMmap(const std::string& file_name, bool writable) {
+    FILE* fp = fopen(file_name.c_str(), "rb");
+    if (!fp) {
+        utility::LogError("NumpyLoadMmap: Unable to open file {}.", file_name);
+    }
+    SizeVector shape;
+    int64_t word_size;
+    bool fortran_order;
+    char type;
+    std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(fp);
+    const int64_t data_offset = static_cast<int64_t>(ftell(fp));
+    fclose(fp);
+
+    std::shared_ptr<Blob> blob =
+            MmapFileToBlob(file_name, data_offset,
+                           shape.NumElements() * word_size, writable);
+    return NumpyArray(shape, type, word_size, fortran_order, blob);
+}
+
+NumpyArray NumpyArray::CreateMmap(const std::string& file_name,
+                                  const SizeVector& shape,
+                                  const Dtype& dtype) {
+    std::vector<char> header = CreateNumpyHeader(shape, dtype);
+    const int64_t data_size = shape.NumElements() * dtype.ByteSize();
+    FILE* fp = fopen(file_name.c_str(), "wb");
+    if (!fp) {
+        utility::LogError("NumpyCreateMmap: Unable to open file {}.",
+                          file_name);
+    }
+    fwrite(&header[0], sizeof(char), header.size(), fp);
+    if (data_size > 0) {
+        // Extend the file to its full size by writing its last byte. On most
+        // file systems the data section stays sparse until it is written.
+        const char zero = 0;
+        const int64_t last_byte =
+                static_cast<int64_t>(header.size()) + data_size - 1;
+#ifdef _WIN32
+        _fseeki64(fp, last_byte, SEEK_SET);
+#else
+        fseeko(fp, static_cast<off_t>(last_byte), SEEK_SET);
+#endif
+        fwrite(&zero, sizeof(char), 1, fp);
+    }
+    if (fclose(fp) != 0) {
+        utility::LogError("NumpyCreateMmap: failed to write file {}.",
+                          file_name);
+    }
+
+    std::shared_ptr<Blob> blob = MmapFileToBlob(
+            file_name, static_cast<int64_t>(header.size()), data_size, true);
+    return NumpyArray(shape, DtypeToChar(dtype), dtype.ByteSize(), false,
+                      blob);
+}
+
 void NumpyArray::Save(std::string file_name) const {
     FILE* fp = fopen(file_name.c_str(), "wb");
     std::vector<char> header = CreateNumpyHeader(shape_, GetDtype());
@@ -67,9 +67,31 @@ public:
 
     static NumpyArray Load(const std::string& file_name);
 
+    /// Maps the data section of a .npy file into memory instead of reading
+    /// it. Pages are read from disk lazily, on first access. If \p writable
+    /// is true, the mapping is shared with the file and writes to the array
+    /// are written back to the file. Otherwise writes are private
+    /// (copy-on-write) and the file is not modified.
+    static NumpyArray LoadMmap(const std::string& file_name,
+                               bool writable = false);
+
+    /// Creates a .npy file with the given shape and dtype, and maps its
+    /// (uninitialized) data section into memory for writing. The file holds
+    /// the written values once the array and all tensors referring to it are
+    /// destroyed.
+    static NumpyArray CreateMmap(const std::string& file_name,
+                                 const SizeVector& shape,
+                                 const Dtype& dtype);
+
     void Save(std::string file_name) const;
 
 private:
+    NumpyArray(const SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<Blob>& blob);
+
     std::shared_ptr<Blob> blob_ = nullptr;
     SizeVector shape_;
     char type_;
@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ParallelPrimitives.h"
+
+#include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/kernel/ParallelPrimitives.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+static void AssertOneDimensional(const char* func_name, const Tensor& tensor) {
+    if (tensor.NumDims() != 1) {
+        utility::LogError("{}: expected a 1D tensor, but got shape {}.",
+                          func_name, tensor.GetShape());
+    }
+}
+
+Tensor Scan(const Tensor& src, bool exclusive /* = false */) {
+    AssertOneDimensional(__FUNCTION__, src);
+    Tensor src_contiguous = src.GetDtype() == Dtype::Bool
+                                    ? src.To(Dtype::Int64)
+                                    : src.Contiguous();
+    Tensor dst = Tensor::EmptyLike(src_contiguous);
+    if (src.GetLength() == 0) {
+        return dst;
+    }
+
+    Device device = src.GetDevice();
+    kernel::RecordKernelLaunch(device, src.GetLength());
+    if (device.GetType() == Device::DeviceType::CPU) {
+        kernel::ScanCPU(src_contiguous, dst, exclusive);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        kernel::ScanCUDA(src_contiguous, dst, exclusive);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Scan: Unimplemented device.");
+    }
+    return dst;
+}
+
+Tensor ArgSort(const Tensor& keys) {
+    AssertOneDimensional(__FUNCTION__, keys);
+    // The radix sort kernels handle 8 to 64-bit integers and 32 and 64-bit
+    // floats. Other dtypes are converted, which preserves the order.
+    Dtype dtype = keys.GetDtype();
+    Tensor keys_contiguous;
+    if (dtype == Dtype::Bool) {
+        keys_contiguous = keys.To(Dtype::UInt8);
+    } else if (dtype == Dtype::Float16 || dtype == Dtype::BFloat16) {
+        keys_contiguous = keys.To(Dtype::Float32);
+    } else {
+        keys_contiguous = keys.Contiguous();
+    }
+    Tensor permutation({keys.GetLength()}, Dtype::Int64, keys.GetDevice());
+    if (keys.GetLength() == 0) {
+        return permutation;
+    }
+
+    Device device = keys.GetDevice();
+    kernel::RecordKernelLaunch(device, keys.GetLength());
+    if (device.GetType() == Device::DeviceType::CPU) {
+        kernel::ArgSortCPU(keys_contiguous, permutation);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        kernel::ArgSortCUDA(keys_contiguous, permutation);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("ArgSort: Unimplemented device.");
+    }
+    return permutation;
+}
+
+std::pair<Tensor, Tensor> SortByKey(const Tensor& keys, const Tensor& values) {
+    values.AssertDevice(keys.GetDevice());
+    if (values.NumDims() == 0 || values.GetLength() != keys.GetLength()) {
+        utility::LogError(
+                "SortByKey: values of shape {} do not match keys of shape {}.",
+                values.GetShape(), keys.GetShape());
+    }
+    Tensor permutation = ArgSort(keys);
+    return std::make_pair(keys.IndexGet({permutation}),
+                          values.IndexGet({permutation}));
+}
+
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src) {
+    AssertOneDimensional(__FUNCTION__, src);
+    Device device = src.GetDevice();
+    int64_t n = src.GetLength();
+    if (n == 0) {
+        return std::make_tuple(src.Clone(),
+                               Tensor({0}, Dtype::Int64, device),
+                               Tensor({0}, Dtype::Int64, device));
+    }
+
+    Tensor permutation = ArgSort(src);
+    Tensor sorted = src.IndexGet({permutation});
+
+    // Flag the first element of each run of equal elements.
+    Tensor is_first({n}, Dtype::Bool, device);
+    is_first.Slice(0, 0, 1).Fill(true);
+    is_first.Slice(0, 1, n).AsRvalue() =
+            sorted.Slice(0, 1, n).Ne(sorted.Slice(0, 0, n - 1));
+    Tensor starts = CompactIndices(is_first);
+    int64_t num_unique = starts.GetLength();
+
+    // The run index of each sorted element, scattered back to the input order.
+    Tensor run_indices = Scan(is_first).Sub(1);
+    Tensor inverse({n}, Dtype::Int64, device);
+    inverse.IndexSet({permutation}, run_indices);
+
+    Tensor bounds({num_unique + 1}, Dtype::Int64, device);
+    bounds.Slice(0, 0, num_unique).AsRvalue() = starts;
+    bounds.Slice(0, num_unique, num_unique + 1).Fill(n);
+    Tensor counts = bounds.Slice(0, 1, num_unique + 1)
+                            .Sub(bounds.Slice(0, 0, num_unique));
+
+    return std::make_tuple(sorted.IndexGet({starts}), inverse, counts);
+}
+
+Tensor SegmentedReduce(const Tensor& src,
+                       const Tensor& offsets,
+                       kernel::ReductionOpCode op_code) {
+    if (op_code != kernel::ReductionOpCode::Sum &&
+        op_code != kernel::ReductionOpCode::Prod &&
+        op_code != kernel::ReductionOpCode::Min &&
+        op_code != kernel::ReductionOpCode::Max) {
+        utility::LogError(
+                "SegmentedReduce: only Sum, Prod, Min and Max are supported.");
+    }
+    if (src.NumDims() == 0) {
+        utility::LogError("SegmentedReduce: src must have at least 1 dim.");
+    }
+    AssertOneDimensional(__FUNCTION__, offsets);
+    offsets.AssertDtype(Dtype::Int64);
+    offsets.AssertDevice(src.GetDevice());
+    if (offsets.GetLength() == 0) {
+        utility::LogError("SegmentedReduce: offsets must not be empty.");
+    }
+    Dtype dtype = src.GetDtype();
+    if (dtype == Dtype::Bool || dtype == Dtype::Float16 ||
+        dtype == Dtype::BFloat16) {
+        utility::LogError("SegmentedReduce: unsupported dtype {}.",
+                          dtype.ToString());
+    }
+
+    int64_t num_segments = offsets.GetLength() - 1;
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    int64_t num_cols =
+            SizeVector(dst_shape.begin() + 1, dst_shape.end()).NumElements();
+    if (num_segments == 0) {
+        return Tensor(dst_shape, dtype, src.GetDevice());
+    }
+    Tensor src_2d = src.Contiguous().Reshape({src.GetLength(), num_cols});
+    Tensor offsets_contiguous = offsets.Contiguous();
+    Tensor dst({num_segments, num_cols}, dtype, src.GetDevice());
+
+    Device device = src.GetDevice();
+    kernel::RecordKernelLaunch(device, src.NumElements());
+    if (device.GetType() == Device::DeviceType::CPU) {
+        kernel::SegmentedReduceCPU(src_2d, offsets_contiguous, dst, op_code);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        kernel::SegmentedReduceCUDA(src_2d, offsets_contiguous, dst, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentedReduce: Unimplemented device.");
+    }
+    return dst.Reshape(dst_shape);
+}
+
+Tensor CompactIndices(const Tensor& mask) {
+    AssertOneDimensional(__FUNCTION__, mask);
+    mask.AssertDtype(Dtype::Bool);
+    Tensor mask_contiguous = mask.Contiguous();
+
+    Device device = mask.GetDevice();
+    kernel::RecordKernelLaunch(device, mask.GetLength());
+    if (device.GetType() == Device::DeviceType::CPU) {
+        return kernel::CompactIndicesCPU(mask_contiguous);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return kernel::CompactIndicesCUDA(mask_contiguous);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("CompactIndices: Unimplemented device.");
+    }
+}
+
+Tensor Compact(const Tensor& src, const Tensor& mask) {
+    mask.AssertDevice(src.GetDevice());
+    if (src.NumDims() == 0 || src.GetLength() != mask.GetLength()) {
+        utility::LogError(
+                "Compact: mask of shape {} does not match src of shape {}.",
+                mask.GetShape(), src.GetShape());
+    }
+    return src.IndexGet({CompactIndices(mask)});
+}
+
+}  // namespace core
+}  // namespace open3d
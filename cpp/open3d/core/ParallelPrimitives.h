@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
+
+namespace open3d {
+namespace core {
+
+/// Data-parallel building blocks on 1D tensors. All primitives run on the
+/// device of their inputs: CUDA tensors are processed with CUB, CPU tensors
+/// with the parallel executor, see utility::ParallelFor().
+
+/// Prefix sum of the 1D tensor \p src.
+///
+/// \param src The input tensor. Bool tensors are summed as Int64, all other
+/// dtypes keep their dtype.
+/// \param exclusive If false, dst[i] = src[0] + ... + src[i]. If true,
+/// dst[0] = 0 and dst[i] = src[0] + ... + src[i - 1].
+Tensor Scan(const Tensor& src, bool exclusive = false);
+
+/// Returns the Int64 permutation that stably sorts the 1D tensor \p keys in
+/// ascending order, i.e. keys.IndexGet({ArgSort(keys)}) is sorted. Keys are
+/// sorted with a radix sort, so the cost is linear in the number of keys.
+Tensor ArgSort(const Tensor& keys);
+
+/// Stably sorts the 1D tensor \p keys in ascending order and reorders the
+/// rows of \p values along with them.
+///
+/// \param keys The sort keys of shape {N}.
+/// \param values Tensor of shape {N, ...} on the same device as \p keys.
+/// \return The sorted keys and the reordered values.
+std::pair<Tensor, Tensor> SortByKey(const Tensor& keys, const Tensor& values);
+
+/// Finds the unique elements of the 1D tensor \p src.
+///
+/// \return A tuple (unique, inverse, counts). unique holds the sorted unique
+/// elements, inverse is the Int64 index of each element of \p src in unique,
+/// i.e. unique.IndexGet({inverse}) equals \p src, and counts is the Int64
+/// number of occurrences of each unique element.
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src);
+
+/// Reduces contiguous segments of rows of \p src.
+///
+/// \param src Tensor of shape {N, ...}.
+/// \param offsets Int64 tensor of shape {S + 1} on the same device as \p src.
+/// Segment i consists of the rows offsets[i] to offsets[i + 1] - 1. The
+/// offsets must be non-decreasing and within [0, N].
+/// \param op_code One of ReductionOpCode::Sum, Prod, Min and Max.
+/// \return Tensor of shape {S, ...}. Empty segments are set to the identity of
+/// the reduction, e.g. 0 for Sum and the largest value of the dtype for Min.
+Tensor SegmentedReduce(const Tensor& src,
+                       const Tensor& offsets,
+                       kernel::ReductionOpCode op_code);
+
+/// Returns the Int64 indices of the true elements of the 1D Bool tensor
+/// \p mask in ascending order.
+Tensor CompactIndices(const Tensor& mask);
+
+/// Stream compaction: returns the rows of \p src where the 1D Bool tensor
+/// \p mask is true, keeping their order.
+Tensor Compact(const Tensor& src, const Tensor& mask);
+
+}  // namespace core
+}  // namespace open3d
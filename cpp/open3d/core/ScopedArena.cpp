@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ScopedArena.h"
+
+#include <atomic>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+/// Allocations are aligned like those of cudaMalloc.
+static constexpr int64_t kArenaAlignment = 256;
+
+struct ScopedArena::Block {
+    Block(const Device& device, int64_t capacity)
+        : device_(device),
+          data_ptr_(static_cast<uint8_t*>(
+                  MemoryManager::Malloc(capacity, device))),
+          capacity_(capacity) {}
+    ~Block() { MemoryManager::Free(data_ptr_, device_); }
+
+    Device device_;
+    uint8_t* data_ptr_;
+    int64_t capacity_;
+    /// Only changed by the thread owning the arena.
+    int64_t offset_ = 0;
+    /// Decremented by the deleters, which may run on any thread.
+    std::atomic<int64_t> num_live_{0};
+};
+
+static ScopedArena*& CurrentArena() {
+    thread_local ScopedArena* arena = nullptr;
+    return arena;
+}
+
+ScopedArena::ScopedArena(const Device& device, int64_t byte_size) {
+    if (byte_size <= 0) {
+        utility::LogError("ScopedArena: byte_size must be positive, got {}.",
+                          byte_size);
+    }
+    block_ = std::make_shared<Block>(device, byte_size);
+    parent_ = CurrentArena();
+    CurrentArena() = this;
+}
+
+ScopedArena::~ScopedArena() { CurrentArena() = parent_; }
+
+Device ScopedArena::GetDevice() const { return block_->device_; }
+
+int64_t ScopedArena::GetCapacity() const { return block_->capacity_; }
+
+int64_t ScopedArena::GetUsedBytes() const { return block_->offset_; }
+
+void* ScopedArena::Allocate(int64_t byte_size,
+                            const Device& device,
+                            std::function<void(void*)>& deleter) {
+    ScopedArena* arena = CurrentArena();
+    while (arena != nullptr && arena->block_->device_ != device) {
+        arena = arena->parent_;
+    }
+    if (arena == nullptr || byte_size <= 0) {
+        return nullptr;
+    }
+
+    std::shared_ptr<Block> block = arena->block_;
+    if (block->num_live_.load(std::memory_order_acquire) == 0) {
+        block->offset_ = 0;
+    }
+    int64_t aligned_size =
+            (byte_size + kArenaAlignment - 1) / kArenaAlignment *
+            kArenaAlignment;
+    if (block->offset_ + aligned_size > block->capacity_) {
+        return nullptr;
+    }
+
+    void* ptr = block->data_ptr_ + block->offset_;
+    block->offset_ += aligned_size;
+    block->num_live_.fetch_add(1, std::memory_order_relaxed);
+    deleter = [block](void*) {
+        block->num_live_.fetch_sub(1, std::memory_order_release);
+    };
+    return ptr;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+/// \class ScopedArena
+///
+/// RAII guard that serves the Blob (and thus Tensor) allocations of the
+/// calling thread on its device from one pre-allocated block. Allocations
+/// bump a pointer in the block and their frees are no-ops, so iterative
+/// algorithms that allocate the same temporaries in every iteration no longer
+/// go through the MemoryManager in their inner loop. The block is returned to
+/// the MemoryManager as a whole when the arena goes out of scope.
+///
+/// Tensors allocated in the arena may outlive it: they keep the block alive,
+/// which is then released with the last of them. Whenever all allocations of
+/// a live arena have been freed, the arena restarts from the beginning of the
+/// block. Allocations that do not fit into the remaining space fall back to
+/// the MemoryManager. Arenas can be nested, the innermost arena of a device
+/// is used.
+///
+/// Example usage:
+///
+/// ```cpp
+/// for (int iter = 0; iter < max_iterations; ++iter) {
+///     ScopedArena arena(device, 1 << 20);
+///     // Temporaries of the iteration are allocated from the arena.
+/// }
+/// ```
+class ScopedArena {
+public:
+    /// Reserves a block of \p byte_size bytes on \p device.
+    ScopedArena(const Device& device, int64_t byte_size);
+    ~ScopedArena();
+
+    ScopedArena(const ScopedArena&) = delete;
+    ScopedArena& operator=(const ScopedArena&) = delete;
+
+    Device GetDevice() const;
+    /// Size of the block in bytes.
+    int64_t GetCapacity() const;
+    /// Bytes of the block handed out since the arena last restarted,
+    /// including alignment padding.
+    int64_t GetUsedBytes() const;
+
+    /// Allocates \p byte_size bytes from the innermost arena of \p device of
+    /// the calling thread. Returns nullptr if there is no such arena or if it
+    /// is full. Otherwise, \p deleter is set to the function releasing the
+    /// allocation. Used by Blob.
+    static void* Allocate(int64_t byte_size,
+                          const Device& device,
+                          std::function<void(void*)>& deleter);
+
+private:
+    struct Block;
+    std::shared_ptr<Block> block_;
+    ScopedArena* parent_;
+};
+
+}  // namespace core
+}  // namespace open3d
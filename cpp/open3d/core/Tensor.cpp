@@ -34,6 +34,7 @@
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/NumpyIO.h"
+#include "open3d/core/ParallelPrimitives.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/TensorKey.h"
@@ -55,6 +56,7 @@ namespace core {
 static DLDataTypeCode DtypeToDLDataTypeCode(const Dtype& dtype) {
     if (dtype == Dtype::Float32) return DLDataTypeCode::kDLFloat;
     if (dtype == Dtype::Float64) return DLDataTypeCode::kDLFloat;
+    if (dtype == Dtype::Float16) return DLDataTypeCode::kDLFloat;
     if (dtype == Dtype::Int8) return DLDataTypeCode::kDLInt;
     if (dtype == Dtype::Int16) return DLDataTypeCode::kDLInt;
     if (dtype == Dtype::Int32) return DLDataTypeCode::kDLInt;
@@ -105,6 +107,8 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (dltype.bits) {
+                case 16:
+                    return Dtype::Float16;
                 case 32:
                     return Dtype::Float32;
                 case 64:
@@ -237,6 +241,16 @@ Tensor Tensor::Empty(const SizeVector& shape,
     return Tensor(shape, dtype, device);
 }
 
+Tensor Tensor::EmptyPinned(const SizeVector& shape, Dtype dtype) {
+    int64_t byte_size = shape.NumElements() * dtype.ByteSize();
+    void* data_ptr = MemoryManager::MallocPinned(byte_size);
+    auto blob = std::make_shared<Blob>(
+            Device("CPU:0"), data_ptr,
+            [data_ptr](void*) { MemoryManager::FreePinned(data_ptr); });
+    return Tensor(shape, shape_util::DefaultStrides(shape), data_ptr, dtype,
+                  blob);
+}
+
 Tensor Tensor::Zeros(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
@@ -560,6 +574,24 @@ Tensor Tensor::To(const Device& device, bool copy) const {
     return dst_tensor;
 }
 
+Tensor Tensor::To(const Device& device,
+                  const CUDAStream& stream,
+                  bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return *this;
+    }
+    Tensor src_tensor = Contiguous();
+    Tensor dst_tensor(shape_, dtype_, device);
+    MemoryManager::MemcpyAsync(dst_tensor.GetDataPtr(), device,
+                               src_tensor.GetDataPtr(), GetDevice(),
+                               NumElements() * dtype_.ByteSize(), stream);
+    if (src_tensor.GetBlob() != GetBlob()) {
+        // The temporary contiguous copy is released when we return.
+        stream.Synchronize();
+    }
+    return dst_tensor;
+}
+
 Tensor Tensor::To(const Device& device, Dtype dtype, bool copy) const {
     Tensor dst_tensor = To(dtype, copy);
     dst_tensor = dst_tensor.To(device, copy);
@@ -627,6 +659,12 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
         str = *static_cast<const unsigned char*>(ptr) ? "True" : "False";
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
+    } else if (dtype_ == Dtype::Float16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const Half*>(ptr)));
+    } else if (dtype_ == Dtype::BFloat16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const BFloat16*>(ptr)));
     } else {
         DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
@@ -701,7 +739,40 @@ Tensor Tensor::Slice(int64_t dim,
     return Tensor(new_shape, new_strides, new_data_ptr, dtype_, blob_);
 }
 
+/// Indexing a contiguous tensor with a single 1D Int64 or Bool index selects
+/// whole rows along dim 0, which the row gather/scatter kernels copy without
+/// per-element offset computation. Returns true and sets \p row_indices to
+/// Int64 indices on the device of \p tensor if the fast path applies.
+static bool GetRowIndices(const Tensor& tensor,
+                          const std::vector<Tensor>& index_tensors,
+                          Tensor& row_indices) {
+    if (index_tensors.size() != 1 || tensor.NumDims() == 0 ||
+        !tensor.IsContiguous() || index_tensors[0].NumDims() != 1) {
+        return false;
+    }
+    const Tensor& index = index_tensors[0];
+    if (index.GetDtype() == Dtype::Int64) {
+        row_indices = index.To(tensor.GetDevice()).Contiguous();
+        return true;
+    }
+    if (index.GetDtype() == Dtype::Bool &&
+        index.GetLength() == tensor.GetLength()) {
+        row_indices = CompactIndices(index.To(tensor.GetDevice()));
+        return true;
+    }
+    return false;
+}
+
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    Tensor row_indices;
+    if (GetRowIndices(*this, index_tensors, row_indices)) {
+        SizeVector dst_shape = shape_;
+        dst_shape[0] = row_indices.GetLength();
+        Tensor dst(dst_shape, dtype_, GetDevice());
+        kernel::IndexGetRows(*this, row_indices, dst);
+        return dst;
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -712,12 +783,57 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
 
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                       const Tensor& src_tensor) {
+    Tensor row_indices;
+    if (src_tensor.GetDtype() == dtype_ &&
+        GetRowIndices(*this, index_tensors, row_indices)) {
+        SizeVector src_shape = shape_;
+        src_shape[0] = row_indices.GetLength();
+        // Broadcast sources are left to the general path.
+        if (src_tensor.GetShape() == src_shape) {
+            kernel::IndexSetRows(src_tensor.To(GetDevice()).Contiguous(),
+                                 row_indices, *this);
+            return;
+        }
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor pre_processed_dst = aip.GetTensor();
     kernel::IndexSet(src_tensor, pre_processed_dst, aip.GetIndexTensors(),
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
 }
 
+Tensor Tensor::IndexAdd_(int64_t dim, const Tensor& index, const Tensor& src) {
+    if (NumDims() == 0) {
+        utility::LogError("IndexAdd_: tensor must have at least 1 dim.");
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    if (index.NumDims() != 1) {
+        utility::LogError("IndexAdd_: index must be 1D, but got shape {}.",
+                          index.GetShape());
+    }
+    index.AssertDtype(Dtype::Int64);
+    src.AssertDtype(dtype_);
+    SizeVector src_shape = shape_;
+    src_shape[dim] = index.GetLength();
+    src.AssertShape(src_shape);
+
+    // Move dim to the front, so that the kernel accumulates whole rows.
+    SizeVector dims = {dim};
+    for (int64_t i = 0; i < NumDims(); ++i) {
+        if (i != dim) dims.push_back(i);
+    }
+    Tensor src_rows = src.To(GetDevice()).Permute(dims).Contiguous();
+    Tensor index_rows = index.To(GetDevice()).Contiguous();
+    if (dim == 0 && IsContiguous()) {
+        kernel::IndexAdd(src_rows, index_rows, *this);
+    } else {
+        Tensor dst_rows = Permute(dims).Contiguous();
+        kernel::IndexAdd(src_rows, index_rows, dst_rows);
+        Permute(dims).AsRvalue() = dst_rows;
+    }
+    return *this;
+}
+
 Tensor Tensor::Permute(const SizeVector& dims) const {
     // Check dimension size
     if (static_cast<int64_t>(dims.size()) != NumDims()) {
@@ -784,6 +900,8 @@ Tensor Tensor::T() const {
 
 double Tensor::Det() const { return core::Det(*this); }
 
+Tensor Tensor::BatchedDet() const { return core::BatchedDet(*this); }
+
 Tensor Tensor::Add(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -840,9 +958,10 @@ Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
 }
 
 Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
-    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+    if (dtype_.GetDtypeCode() != Dtype::DtypeCode::Float) {
         utility::LogError(
-                "Can only compute mean for Float32 or Float64, got {} instead.",
+                "Can only compute mean for floating point dtypes, got {} "
+                "instead.",
                 dtype_.ToString());
     }
 
@@ -878,6 +997,54 @@ Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+std::pair<Tensor, Tensor> Tensor::MinMax(const SizeVector& dims,
+                                         bool keepdim) const {
+    SizeVector non_keepdim_shape =
+            shape_util::ReductionShape(shape_, dims, false);
+    if (NumElements() == 0) {
+        utility::LogError("MinMax: zero-size Tensor is not supported.");
+    }
+
+    // Move the reduced dims to the front, so that the reduction runs over the
+    // rows of a (N, D) matrix.
+    int64_t ndims = NumDims();
+    std::vector<bool> reduced(ndims, false);
+    SizeVector permutation;
+    for (const int64_t& dim : dims) {
+        int64_t wrapped_dim = shape_util::WrapDim(dim, ndims);
+        reduced[wrapped_dim] = true;
+        permutation.push_back(wrapped_dim);
+    }
+    for (int64_t dim = 0; dim < ndims; ++dim) {
+        if (!reduced[dim]) {
+            permutation.push_back(dim);
+        }
+    }
+    int64_t num_cols = non_keepdim_shape.NumElements();
+    Tensor src = Permute(permutation).Contiguous().Reshape(
+            {NumElements() / num_cols, num_cols});
+
+    Tensor min({num_cols}, dtype_, GetDevice());
+    Tensor max({num_cols}, dtype_, GetDevice());
+    kernel::MinMax(src, min, max);
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    return std::make_pair(min.Reshape(dst_shape), max.Reshape(dst_shape));
+}
+
+std::pair<Tensor, Tensor> Tensor::MeanAndCovariance() const {
+    if (NumDims() != 2) {
+        utility::LogError(
+                "MeanAndCovariance: expected a (N, D) tensor, but got shape "
+                "{}.",
+                shape_.ToString());
+    }
+    int64_t num_cols = GetShape(1);
+    Tensor mean({num_cols}, dtype_, GetDevice());
+    Tensor covariance({num_cols, num_cols}, dtype_, GetDevice());
+    kernel::MeanAndCovariance(Contiguous(), mean, covariance);
+    return std::make_pair(mean, covariance);
+}
+
 Tensor Tensor::ArgMin(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), Dtype::Int64,
                GetDevice());
@@ -959,7 +1126,7 @@ Tensor Tensor::Abs_() {
 }
 
 Tensor Tensor::IsNan() const {
-    if (dtype_ == Dtype::Float32 || dtype_ == Dtype::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, Dtype::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsNan);
         return dst_tensor;
@@ -969,7 +1136,7 @@ Tensor Tensor::IsNan() const {
 }
 
 Tensor Tensor::IsInf() const {
-    if (dtype_ == Dtype::Float32 || dtype_ == Dtype::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, Dtype::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsInf);
         return dst_tensor;
@@ -979,7 +1146,7 @@ Tensor Tensor::IsInf() const {
 }
 
 Tensor Tensor::IsFinite() const {
-    if (dtype_ == Dtype::Float32 || dtype_ == Dtype::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, Dtype::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsFinite);
         return dst_tensor;
@@ -1163,6 +1330,45 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::Sort(int64_t dim, bool descending) const {
+    Tensor values;
+    kernel::Sort(*this, dim, descending, &values, nullptr);
+    return values;
+}
+
+Tensor Tensor::ArgSort(int64_t dim, bool descending) const {
+    Tensor indices;
+    kernel::Sort(*this, dim, descending, nullptr, &indices);
+    return indices;
+}
+
+std::pair<Tensor, Tensor> Tensor::TopK(int64_t k,
+                                       int64_t dim,
+                                       bool largest) const {
+    if (NumDims() == 0) {
+        utility::LogError("TopK: tensor must have at least 1 dim.");
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    if (k < 0 || k > GetShape(dim)) {
+        utility::LogError("TopK: k = {} is out of range [0, {}].", k,
+                          GetShape(dim));
+    }
+    Tensor values, indices;
+    kernel::Sort(*this, dim, largest, &values, &indices);
+    return std::make_pair(values.Slice(dim, 0, k).Contiguous(),
+                          indices.Slice(dim, 0, k).Contiguous());
+}
+
+Tensor Tensor::Unique() const {
+    return std::get<0>(core::Unique(Reshape({NumElements()})));
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::UniqueWithInverseAndCounts() const {
+    Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = core::Unique(Reshape({NumElements()}));
+    return std::make_tuple(unique, inverse.Reshape(GetShape()), counts);
+}
+
 bool Tensor::IsNonZero() const {
     if (shape_.NumElements() != 1) {
         utility::LogError(
@@ -1170,7 +1376,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
@@ -1246,6 +1452,16 @@ Tensor Tensor::Load(const std::string& file_name) {
     return NumpyArray::Load(file_name).ToTensor();
 }
 
+Tensor Tensor::LoadMmap(const std::string& file_name, bool writable) {
+    return NumpyArray::LoadMmap(file_name, writable).ToTensor();
+}
+
+Tensor Tensor::EmptyMmap(const std::string& file_name,
+                         const SizeVector& shape,
+                         Dtype dtype) {
+    return NumpyArray::CreateMmap(file_name, shape, dtype).ToTensor();
+}
+
 bool Tensor::AllClose(const Tensor& other, double rtol, double atol) const {
     // TODO: support nan;
     return IsClose(other, rtol, atol).All();
@@ -30,9 +30,12 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "open3d/core/Blob.h"
+#include "open3d/core/CUDAStream.h"
 #include "open3d/core/DLPack.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
@@ -191,6 +194,13 @@ public:
         return Tensor::Empty(other.shape_, other.dtype_, other.GetDevice());
     }
 
+    /// Create a CPU:0 tensor with uninitialized values, backed by page-locked
+    /// (pinned) host memory. Host-to-device and device-to-host copies of
+    /// pinned tensors run at full bandwidth and do not block the host when
+    /// queued on a CUDAStream. Use it for staging buffers that are copied to
+    /// CUDA devices repeatedly. See MemoryManager::MallocPinned.
+    static Tensor EmptyPinned(const SizeVector& shape, Dtype dtype);
+
     /// Create a tensor fill with specified value.
     template <typename T>
     static Tensor Full(const SizeVector& shape,
@@ -406,6 +416,19 @@ public:
     /// is avoided when the original tensor is already on the targeted device.
     Tensor To(const Device& device, bool copy = false) const;
 
+    /// Returns a tensor with the specified \p device, where the copy is
+    /// queued on \p stream instead of blocking the host. The tensor must stay
+    /// alive and unmodified until \p stream is synchronized. Non-contiguous
+    /// tensors are made contiguous first, and the stream is then synchronized
+    /// before returning.
+    /// \param device The targeted device to convert to.
+    /// \param stream The CUDA stream on which the copy is queued.
+    /// \param copy If true, a new tensor is always created; if false, the copy
+    /// is avoided when the original tensor is already on the targeted device.
+    Tensor To(const Device& device,
+              const CUDAStream& stream,
+              bool copy = false) const;
+
     /// Returns a tensor with the specified \p device and \p dtype.
     /// \param device The targeted device to convert to.
     /// \param dtype The targeted dtype to convert to.
@@ -461,6 +484,13 @@ public:
     void IndexSet(const std::vector<Tensor>& index_tensors,
                   const Tensor& src_tensor);
 
+    /// \brief Accumulates the slices of \p src into this tensor along \p dim,
+    /// i.e. this[..., index[i], ...] += src[..., i, ...]. Slices with duplicate
+    /// indices are all added. \p index is a 1D Int64 tensor and \p src has the
+    /// shape of this tensor, except for \p dim whose size is index's length.
+    /// Supports Int32, Int64, Float32 and Float64.
+    Tensor IndexAdd_(int64_t dim, const Tensor& index, const Tensor& src);
+
     /// \brief Permute (dimension shuffle) the Tensor, returns a view.
     ///
     /// \param dims The desired ordering of dimensions.
@@ -487,6 +517,11 @@ public:
     /// \return returns the determinant of the matrix (double).
     double Det() const;
 
+    /// \brief Compute the determinants of a (N, n, n) batch of square
+    /// matrices.
+    /// \return returns a (N,) tensor of the same dtype and device.
+    Tensor BatchedDet() const;
+
     /// Helper function to return scalar value of a scalar Tensor, the Tensor
     /// mush have empty shape ()
     template <typename T>
@@ -627,6 +662,18 @@ public:
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Max(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Returns the min and the max of the tensor along the given \p dims,
+    /// computed in a single pass over the data.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    std::pair<Tensor, Tensor> MinMax(const SizeVector& dims,
+                                     bool keepdim = false) const;
+
+    /// Returns the mean (D,) and the covariance (D, D) of the rows of a
+    /// (N, D) tensor, computed in a single pass over the data. The covariance
+    /// is normalized by N.
+    std::pair<Tensor, Tensor> MeanAndCovariance() const;
+
     /// Returns minimum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -912,6 +959,27 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Stable sort along \p dim. Equal elements keep their relative order.
+    Tensor Sort(int64_t dim = -1, bool descending = false) const;
+
+    /// Int64 indices along \p dim that stably sort the tensor along \p dim.
+    Tensor ArgSort(int64_t dim = -1, bool descending = false) const;
+
+    /// The \p k largest (or smallest, if \p largest is false) elements along
+    /// \p dim in sorted order. Returns a pair of (values, indices).
+    std::pair<Tensor, Tensor> TopK(int64_t k,
+                                   int64_t dim = -1,
+                                   bool largest = true) const;
+
+    /// Sorted unique elements of the flattened tensor.
+    Tensor Unique() const;
+
+    /// Sorted unique elements of the flattened tensor. Returns a tuple of
+    /// (unique, inverse, counts), where the Int64 inverse has the shape of the
+    /// tensor and holds the index of each element in unique, and counts holds
+    /// the number of occurrences of each unique element.
+    std::tuple<Tensor, Tensor, Tensor> UniqueWithInverseAndCounts() const;
+
     /// Evaluate a single-element Tensor as a boolean value. This can be used to
     /// implement Tensor.__bool__() in Python, e.g.
     /// ```python
@@ -1004,15 +1072,16 @@ public:
     Tensor Contiguous() const;
 
     /// Computes matrix multiplication with *this and rhs and returns the
-    /// result.
+    /// result. A (N, m, k) tensor is multiplied with a (N, k, n) rhs matrix by
+    /// matrix.
     Tensor Matmul(const Tensor& rhs) const;
 
     /// Solves the linear system AX = B with LU decomposition and returns X.
-    /// A must be a square matrix.
+    /// A must be a square matrix, or a (N, n, n) batch of square matrices.
     Tensor Solve(const Tensor& rhs) const;
 
     /// Solves the linear system AX = B with QR decomposition and returns X.
-    /// A is a (m, n) matrix with m >= n.
+    /// A is a (m, n) matrix with m >= n, or a (N, m, n) batch of matrices.
     Tensor LeastSquares(const Tensor& rhs) const;
 
     /// \brief Computes LU factorisation of the 2D square tensor,
@@ -1074,7 +1143,8 @@ public:
     std::tuple<Tensor, Tensor> Triul(const int diagonal = 0) const;
 
     /// Computes the matrix inversion of the square matrix *this with LU
-    /// factorization and returns the result.
+    /// factorization and returns the result. Each matrix of a (N, n, n) batch
+    /// is inverted.
     Tensor Inverse() const;
 
     /// Computes the matrix SVD decomposition A = U S VT and returns the result.
@@ -1157,6 +1227,21 @@ public:
     /// Load tensor from numpy's npy format.
     static Tensor Load(const std::string& file_name);
 
+    /// Load tensor from numpy's npy format by memory-mapping the file. No data
+    /// is read upfront: pages are read from disk on first access, so slicing
+    /// a large file only reads the sliced part. If \p writable is true,
+    /// in-place modifications of the tensor are written back to the file,
+    /// otherwise they are private to the process.
+    static Tensor LoadMmap(const std::string& file_name, bool writable = false);
+
+    /// Create a npy file of the given shape and dtype, and return a CPU:0
+    /// tensor with uninitialized values that is memory-mapped to the file.
+    /// Values written to the tensor are stored in the file, which allows
+    /// writing files larger than the available memory.
+    static Tensor EmptyMmap(const std::string& file_name,
+                            const SizeVector& shape,
+                            Dtype dtype);
+
     /// Assert that the Tensor has the specified shape.
     void AssertShape(const SizeVector& expected_shape,
                      const std::string& error_msg = "") const;
@@ -1283,7 +1368,7 @@ inline bool Tensor::Item() const {
 
 template <typename S>
 inline void Tensor::Fill(S v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
@@ -26,6 +26,7 @@
 
 #include "open3d/core/TensorList.h"
 
+#include <algorithm>
 #include <string>
 
 #include "open3d/core/SizeVector.h"
@@ -72,6 +73,23 @@ TensorList TensorList::FromTensor(const Tensor& tensor, bool inplace) {
     }
 }
 
+TensorList TensorList::Chunked(const SizeVector& element_shape,
+                               Dtype dtype,
+                               const Device& device,
+                               int64_t chunk_size) {
+    if (chunk_size <= 0) {
+        utility::LogError("Chunk size must be positive, but got {}.",
+                          chunk_size);
+    }
+    Tensor chunk(shape_util::Concat({chunk_size}, element_shape), dtype,
+                 device);
+    TensorList tensorlist(element_shape, 0, chunk_size, chunk,
+                          /*is_resizable=*/true);
+    tensorlist.chunk_size_ = chunk_size;
+    tensorlist.chunks_ = {chunk};
+    return tensorlist;
+}
+
 TensorList TensorList::Clone() const {
     TensorList copied(*this);
     copied.CopyFrom(*this);
@@ -81,13 +99,49 @@ TensorList TensorList::Clone() const {
 void TensorList::CopyFrom(const TensorList& other) {
     *this = other;
     // Copy the full other.internal_tensor_, not just other.AsTensor().
-    internal_tensor_ = other.internal_tensor_.Clone();
+    if (IsChunked()) {
+        for (Tensor& chunk : chunks_) {
+            chunk = chunk.Clone();
+        }
+        internal_tensor_ = chunks_[0];
+    } else {
+        internal_tensor_ = other.internal_tensor_.Clone();
+    }
     // After copy, the resulting tensorlist is always resizable.
     is_resizable_ = true;
 }
 
 Tensor TensorList::AsTensor() const {
-    return internal_tensor_.Slice(0, 0, size_);
+    if (!IsChunked() || size_ <= chunk_size_) {
+        return internal_tensor_.Slice(0, 0, size_);
+    }
+    Tensor tensor(shape_util::Concat({size_}, element_shape_), GetDtype(),
+                  GetDevice());
+    int64_t offset = 0;
+    for (const Tensor& slice : GetChunkSlices(0, size_)) {
+        int64_t length = slice.GetLength();
+        tensor.Slice(0, offset, offset + length) = slice;
+        offset += length;
+    }
+    return tensor;
+}
+
+TensorList TensorList::Contiguous() const {
+    if (!IsChunked()) {
+        return *this;
+    }
+    int64_t reserved_size = ComputeReserveSize(size_);
+    Tensor internal_tensor(
+            shape_util::Concat({reserved_size}, element_shape_), GetDtype(),
+            GetDevice());
+    int64_t offset = 0;
+    for (const Tensor& slice : GetChunkSlices(0, size_)) {
+        int64_t length = slice.GetLength();
+        internal_tensor.Slice(0, offset, offset + length) = slice;
+        offset += length;
+    }
+    return TensorList(element_shape_, size_, reserved_size, internal_tensor,
+                      /*is_resizable=*/true);
 }
 
 void TensorList::Resize(int64_t new_size) {
@@ -96,7 +150,9 @@ void TensorList::Resize(int64_t new_size) {
     // Increase internal tensor size.
     int64_t old_size = size_;
     ResizeWithExpand(new_size);
-    internal_tensor_.Slice(0, old_size, new_size).Fill(0);
+    for (Tensor& slice : GetChunkSlices(old_size, new_size)) {
+        slice.Fill(0);
+    }
 }
 
 void TensorList::PushBack(const Tensor& tensor) {
@@ -117,7 +173,7 @@ void TensorList::PushBack(const Tensor& tensor) {
                           tensor.GetDevice().ToString());
     }
     ResizeWithExpand(size_ + 1);
-    internal_tensor_[size_ - 1] = tensor;  // same as operator[](-1) = tensor;
+    (*this)[size_ - 1] = tensor;  // Assigning to a Tensor rvalue is a copy.
 }
 
 void TensorList::Extend(const TensorList& other) {
@@ -137,14 +193,19 @@ void TensorList::Extend(const TensorList& other) {
                           GetDtype().ToString(), other.GetDtype().ToString());
     }
 
-    // Expand *this.
+    // Take the views of other before expanding *this, since *this and other
+    // can be the same tensorlist. The views keep the source memory alive if
+    // expanding reallocates the internal tensor.
     int64_t other_size = other.GetSize();
-    ResizeWithExpand(size_ + other_size);
+    std::vector<Tensor> other_slices = other.GetChunkSlices(0, other_size);
 
-    // Needs to slice other since *this and other can be the same tensorlist.
-    // Assigning to a Tensor rvalue is an actual copy.
-    internal_tensor_.Slice(0, size_ - other_size, size_) =
-            other.AsTensor().Slice(0, 0, other_size);
+    // Expand *this.
+    int64_t begin = size_;
+    ResizeWithExpand(size_ + other_size);
+    for (const Tensor& slice : other_slices) {
+        SetRange(begin, slice);
+        begin += slice.GetLength();
+    }
 }
 
 TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
@@ -157,16 +218,38 @@ TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
 Tensor TensorList::operator[](int64_t index) const {
     // WrapDim asserts index is within range.
     index = shape_util::WrapDim(index, size_);
+    if (IsChunked()) {
+        return chunks_[index / chunk_size_][index % chunk_size_];
+    }
     return internal_tensor_[index];
 }
 
 void TensorList::Clear() {
     AssertIsResizable(*this, __FUNCTION__);
-    *this = TensorList(element_shape_, GetDtype(), GetDevice());
+    if (IsChunked()) {
+        *this = Chunked(element_shape_, GetDtype(), GetDevice(), chunk_size_);
+    } else {
+        *this = TensorList(element_shape_, GetDtype(), GetDevice());
+    }
 }
 
 // Protected
 void TensorList::ResizeWithExpand(int64_t new_size) {
+    if (IsChunked()) {
+        // Only allocate the missing chunks, existing chunks are never moved.
+        if (new_size < 0) {
+            utility::LogError("Negative tensorlist size {} is not supported.",
+                              new_size);
+        }
+        while (reserved_size_ < new_size) {
+            chunks_.emplace_back(
+                    shape_util::Concat({chunk_size_}, element_shape_),
+                    GetDtype(), GetDevice());
+            reserved_size_ += chunk_size_;
+        }
+        size_ = new_size;
+        return;
+    }
     int64_t new_reserved_size = ComputeReserveSize(new_size);
     if (new_reserved_size <= reserved_size_) {
         size_ = new_size;
@@ -211,6 +294,34 @@ int64_t TensorList::ComputeReserveSize(int64_t n) {
     return 1;
 }
 
+std::vector<Tensor> TensorList::GetChunkSlices(int64_t begin,
+                                               int64_t end) const {
+    std::vector<Tensor> slices;
+    if (!IsChunked()) {
+        slices.push_back(internal_tensor_.Slice(0, begin, end));
+        return slices;
+    }
+    while (begin < end) {
+        int64_t chunk_idx = begin / chunk_size_;
+        int64_t chunk_begin = begin % chunk_size_;
+        int64_t chunk_end = std::min(chunk_size_, chunk_begin + end - begin);
+        slices.push_back(chunks_[chunk_idx].Slice(0, chunk_begin, chunk_end));
+        begin += chunk_end - chunk_begin;
+    }
+    return slices;
+}
+
+void TensorList::SetRange(int64_t begin, const Tensor& src) {
+    int64_t offset = 0;
+    int64_t end = begin + src.GetLength();
+    for (const Tensor& slice : GetChunkSlices(begin, end)) {
+        int64_t length = slice.GetLength();
+        // Assigning to a Tensor rvalue is an actual copy.
+        slice.AsRvalue() = src.Slice(0, offset, offset + length);
+        offset += length;
+    }
+}
+
 std::string TensorList::ToString() const {
     return fmt::format(
             "TensorList[size: {}, element_shape: {}, dtype: {}, device: {}]",
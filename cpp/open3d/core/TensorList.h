@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
@@ -182,6 +183,24 @@ public:
     /// tensor values will be copied when creating the tensorlist.
     static TensorList FromTensor(const Tensor& tensor, bool inplace = false);
 
+    /// Factory function to create an empty chunked tensorlist.
+    ///
+    /// A chunked tensorlist stores its tensors in a list of internal tensors
+    /// of chunk_size elements each. Growing it allocates new chunks instead
+    /// of reallocating and copying all the tensors, so appending never
+    /// increases the peak memory by more than the new chunks. AsTensor()
+    /// copies the tensors to a single tensor when they span several chunks,
+    /// and Contiguous() converts to a regular tensorlist.
+    ///
+    /// \param element_shape Shape of the contained tensors, e.g. {3,}.
+    /// \param dtype Data type of the contained tensors. e.g. Dtype::Float32.
+    /// \param device Device of the contained tensors. e.g. Device("CPU:0").
+    /// \param chunk_size Number of tensors per chunk, must be positive.
+    static TensorList Chunked(const SizeVector& element_shape,
+                              Dtype dtype,
+                              const Device& device,
+                              int64_t chunk_size);
+
     /// Copy constructor for tensorlist. The internal tensor will share the same
     /// memory as the input. Also see: the copy constructor for Tensor.
     TensorList(const TensorList& other) = default;
@@ -208,8 +227,15 @@ public:
     TensorList Clone() const;
 
     /// Return the reference of the contained valid tensors with shared memory.
+    /// For a chunked tensorlist whose tensors span several chunks, the
+    /// tensors are copied to a new tensor instead.
     Tensor AsTensor() const;
 
+    /// Return a tensorlist storing the tensors in a single internal tensor.
+    /// Returns *this if the tensorlist is not chunked, otherwise the tensors
+    /// are copied to a new, resizable tensorlist.
+    TensorList Contiguous() const;
+
     /// Resize tensorlist.
     /// If the size increases, the increased part will be initialized with 0.
     /// If the size decreases, the reserved_size_ remain unchanged. This
@@ -284,10 +310,24 @@ public:
 
     int64_t GetReservedSize() const { return reserved_size_; }
 
-    const Tensor& GetInternalTensor() const { return internal_tensor_; }
+    /// Returns the internal tensor. Chunked tensorlists have no single
+    /// internal tensor, use Contiguous() to convert them first.
+    const Tensor& GetInternalTensor() const {
+        if (IsChunked()) {
+            utility::LogError(
+                    "A chunked TensorList has no single internal tensor, "
+                    "call Contiguous() first.");
+        }
+        return internal_tensor_;
+    }
 
     bool IsResizable() const { return is_resizable_; }
 
+    bool IsChunked() const { return chunk_size_ > 0; }
+
+    /// Number of tensors per chunk, or 0 if the tensorlist is not chunked.
+    int64_t GetChunkSize() const { return chunk_size_; }
+
 protected:
     /// Fully specified constructor.
     TensorList(const SizeVector element_shape,
@@ -315,6 +355,14 @@ protected:
     /// with reserved_size_ = (1 << (ceil(log2(size_)) + 1)).
     static int64_t ComputeReserveSize(int64_t size);
 
+    /// Returns views of the internal tensors covering the elements in
+    /// [begin, end), in order. A tensorlist that is not chunked returns a
+    /// single view.
+    std::vector<Tensor> GetChunkSlices(int64_t begin, int64_t end) const;
+
+    /// Copies the elements of src to [begin, begin + src.GetLength()).
+    void SetRange(int64_t begin, const Tensor& src);
+
 protected:
     /// The shape for each element tensor in the tensorlist.
     SizeVector element_shape_;
@@ -342,6 +390,14 @@ protected:
     /// created with pre-allocated shared buffer, the tensorlist is not
     /// resizable.
     bool is_resizable_ = true;
+
+    /// Number of tensors per chunk for chunked tensorlists, 0 otherwise.
+    int64_t chunk_size_ = 0;
+
+    /// Internal tensors of shape (chunk_size_, *element_shape_) of a chunked
+    /// tensorlist, where element i is stored in chunks_[i / chunk_size_].
+    /// internal_tensor_ is chunks_[0] and reserved_size_ is the total size.
+    std::vector<Tensor> chunks_;
 };
 }  // namespace core
 }  // namespace open3d
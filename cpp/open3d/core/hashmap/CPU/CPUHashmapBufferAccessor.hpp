@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "open3d/core/hashmap/HashmapBuffer.h"
+#include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace core {
@@ -43,17 +44,24 @@ class CPUHashmapBufferAccessor {
 public:
     CPUHashmapBufferAccessor(int64_t capacity,
                              int64_t dsize_key,
-                             int64_t dsize_value,
+                             const std::vector<int64_t> &dsize_values,
                              Tensor &keys,
-                             Tensor &values,
+                             std::vector<Tensor> &values,
                              Tensor &heap)
         : capacity_(capacity),
           dsize_key_(dsize_key),
-          dsize_value_(dsize_value),
+          n_values_(static_cast<int64_t>(dsize_values.size())),
           keys_(keys.GetDataPtr<uint8_t>()),
-          values_(values.GetDataPtr<uint8_t>()),
           heap_(static_cast<addr_t *>(heap.GetDataPtr())) {
-        std::memset(values_, 0, capacity_ * dsize_value_);
+        if (n_values_ < 1 || n_values_ > kMaxValueBuffers) {
+            utility::LogError("Expected 1 to {} value buffers, but got {}.",
+                              kMaxValueBuffers, n_values_);
+        }
+        for (int64_t j = 0; j < n_values_; ++j) {
+            dsize_values_[j] = dsize_values[j];
+            values_[j] = values[j].GetDataPtr<uint8_t>();
+            std::memset(values_[j], 0, capacity_ * dsize_values_[j]);
+        }
     }
 
     void Reset() {
@@ -71,20 +79,36 @@ public:
 
     int HeapCounter() const { return heap_counter_.load(); }
 
+    /// Returns the key and the first value buffer of entry \p ptr.
     std::pair<void *, void *> ExtractIterator(addr_t ptr) {
         return std::make_pair(keys_ + ptr * dsize_key_,
-                              values_ + ptr * dsize_value_);
+                              values_[0] + ptr * dsize_values_[0]);
+    }
+
+    /// Copies row \p i of each input value array into the matching value
+    /// buffer of entry \p ptr. Zeroes the values if \p src holds no buffers.
+    void CopyValues(addr_t ptr, const HashmapValueInputs &src, int64_t i) {
+        for (int64_t j = 0; j < n_values_; ++j) {
+            int64_t dsize = dsize_values_[j];
+            uint8_t *dst = values_[j] + ptr * dsize;
+            if (src.n_buffers > 0) {
+                std::memcpy(dst, src.buffers[j].ptr + i * dsize, dsize);
+            } else {
+                std::memset(dst, 0, dsize);
+            }
+        }
     }
 
 public:
     int64_t capacity_;
     int64_t dsize_key_;
-    int64_t dsize_value_;
+    int64_t n_values_;
+    int64_t dsize_values_[kMaxValueBuffers];
 
-    uint8_t *keys_;                 /* [N] * sizeof(Key) */
-    uint8_t *values_;               /* [N] * sizeof(Value) */
-    addr_t *heap_;                  /* [N] */
-    std::atomic<int> heap_counter_; /* [1] */
+    uint8_t *keys_;                     /* [N] * sizeof(Key) */
+    uint8_t *values_[kMaxValueBuffers]; /* [M][N] * sizeof(Value_m) */
+    addr_t *heap_;                      /* [N] */
+    std::atomic<int> heap_counter_;     /* [1] */
 };
 
 }  // namespace core
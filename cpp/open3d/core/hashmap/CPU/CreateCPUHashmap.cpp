@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/hashmap/CPU/LinearProbingHashmap.h"
 #include "open3d/core/hashmap/CPU/TBBHashmap.h"
 #include "open3d/core/hashmap/Dispatch.h"
 #include "open3d/core/hashmap/Hashmap.h"
@@ -35,26 +36,38 @@ namespace core {
 std::shared_ptr<DeviceHashmap> CreateCPUHashmap(
         int64_t init_capacity,
         const Dtype& dtype_key,
-        const Dtype& dtype_value,
+        const std::vector<Dtype>& dtypes_value,
         const SizeVector& element_shape_key,
-        const SizeVector& element_shape_value,
+        const std::vector<SizeVector>& element_shapes_value,
         const Device& device,
         const HashmapBackend& backend) {
-    if (backend != HashmapBackend::Default && backend != HashmapBackend::TBB) {
+    if (backend != HashmapBackend::Default && backend != HashmapBackend::TBB &&
+        backend != HashmapBackend::LinearProbing) {
         utility::LogError("Unsupported backend for CPU hashmap.");
     }
 
     int64_t dim = element_shape_key.NumElements();
 
     int64_t dsize_key = dim * dtype_key.ByteSize();
-    int64_t dsize_value =
-            element_shape_value.NumElements() * dtype_value.ByteSize();
+    std::vector<int64_t> dsize_values;
+    for (size_t i = 0; i < dtypes_value.size(); ++i) {
+        dsize_values.push_back(element_shapes_value[i].NumElements() *
+                               dtypes_value[i].ByteSize());
+    }
 
     std::shared_ptr<DeviceHashmap> device_hashmap_ptr;
-    DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(dtype_key, dim, [&] {
-        device_hashmap_ptr = std::make_shared<TBBHashmap<key_t, hash_t>>(
-                init_capacity, dsize_key, dsize_value, device);
-    });
+    if (backend == HashmapBackend::Default || backend == HashmapBackend::TBB) {
+        DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(dtype_key, dim, [&] {
+            device_hashmap_ptr = std::make_shared<TBBHashmap<key_t, hash_t>>(
+                    init_capacity, dsize_key, dsize_values, device);
+        });
+    } else {  // if (backend == HashmapBackend::LinearProbing) {
+        DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(dtype_key, dim, [&] {
+            device_hashmap_ptr =
+                    std::make_shared<LinearProbingHashmap<key_t, hash_t>>(
+                            init_capacity, dsize_key, dsize_values, device);
+        });
+    }
     return device_hashmap_ptr;
 }
 
@@ -0,0 +1,545 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/CPUHashmapBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+/// Lock-free open addressing hashmap with linear probing.
+///
+/// The table is a power-of-two array of 64-bit slots. Each slot packs the
+/// upper 32 bits of the key hash (fingerprint) with the buffer address of its
+/// key-value pair. Keys are written to the buffer before their slot is
+/// published with a single compare-and-swap, so lookups never observe a
+/// partially inserted entry, and most mismatching slots are rejected by the
+/// fingerprint without touching the key buffer. Erased slots become
+/// tombstones that are only reclaimed by Rehash; insertions never reuse them,
+/// which keeps concurrent insertions of the same key consistent.
+template <typename Key, typename Hash>
+class LinearProbingHashmap : public DeviceHashmap {
+public:
+    LinearProbingHashmap(int64_t init_capacity,
+                         int64_t dsize_key,
+                         const std::vector<int64_t>& dsize_values,
+                         const Device& device);
+    ~LinearProbingHashmap();
+
+    void Rehash(int64_t buckets) override;
+
+    void Insert(const void* input_keys,
+                const HashmapValueInputs& input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void FindOrInsert(const void* input_keys,
+                      const HashmapValueInputs& input_values,
+                      addr_t* output_addrs,
+                      bool* output_masks,
+                      int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    void Restore(const void* input_keys,
+                 const addr_t* input_addrs,
+                 int64_t count) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+protected:
+    static constexpr uint64_t kEmptySlot = std::numeric_limits<uint64_t>::max();
+    static constexpr uint64_t kTombstoneSlot = kEmptySlot - 1;
+    static constexpr uint64_t kAddrMask = 0xFFFFFFFF;
+    static constexpr uint64_t kFingerprintMask = ~kAddrMask;
+
+    /// Capacity is at most this fraction of the bucket count, so that probe
+    /// sequences stay short.
+    static constexpr float kMaxLoadFactor = 0.5f;
+    /// Tombstones are purged when live entries and tombstones would exceed
+    /// this fraction of the bucket count.
+    static constexpr float kMaxOccupancy = 0.75f;
+
+    static constexpr int64_t kGrainSize = 1024;
+
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+    int64_t bucket_count_;
+    std::atomic<int64_t> tombstone_count_;
+
+    std::shared_ptr<CPUHashmapBufferAccessor> buffer_ctx_;
+
+    /// Rehash, Insert, Activate and FindOrInsert all call InsertImpl. If
+    /// return_existing is true, output_addrs of existing keys point to their
+    /// entries, otherwise they are set to 0.
+    void InsertImpl(const void* input_keys,
+                    const HashmapValueInputs& input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count,
+                    bool return_existing);
+
+    /// Rehash ahead of inserting count more keys if the capacity could be
+    /// exceeded, or purge tombstones if the occupancy could be exceeded.
+    void ReserveForInsertion(int64_t count);
+
+    /// Rebuild the slot table from the live entries, dropping tombstones.
+    /// Unlike Rehash, the buffer and hence the addresses are left untouched.
+    void PurgeTombstones();
+
+    /// Publish count entries of distinct keys already stored in the buffer at
+    /// addrs to a slot table without tombstones.
+    void PublishDistinctEntries(const addr_t* addrs, int64_t count);
+
+    void Allocate(int64_t capacity, int64_t bucket_count);
+
+    /// MurmurHash3 finalizer, since the low bits of Hash are used as the
+    /// bucket index and the high bits as the fingerprint.
+    static uint64_t MixHash(uint64_t hash) {
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    static bool IsLiveSlot(uint64_t slot) {
+        return (slot & kAddrMask) < (kTombstoneSlot & kAddrMask);
+    }
+
+    bool SlotMatches(uint64_t slot, uint64_t hash, const Key& key) const {
+        return IsLiveSlot(slot) &&
+               (slot & kFingerprintMask) == (hash & kFingerprintMask) &&
+               *static_cast<const Key*>(
+                       buffer_ctx_->ExtractIterator(slot & kAddrMask).first) ==
+                       key;
+    }
+
+    /// Returns the index of the slot holding key, or -1 if absent.
+    int64_t FindSlot(const Key& key, uint64_t hash) const {
+        const uint64_t mask = bucket_count_ - 1;
+        for (uint64_t i = hash & mask;; i = (i + 1) & mask) {
+            uint64_t slot = slots_[i].load(std::memory_order_acquire);
+            if (slot == kEmptySlot) {
+                return -1;
+            }
+            if (SlotMatches(slot, hash, key)) {
+                return static_cast<int64_t>(i);
+            }
+        }
+    }
+};
+
+template <typename Key, typename Hash>
+LinearProbingHashmap<Key, Hash>::LinearProbingHashmap(
+        int64_t init_capacity,
+        int64_t dsize_key,
+        const std::vector<int64_t>& dsize_values,
+        const Device& device)
+    : DeviceHashmap(init_capacity, dsize_key, dsize_values, device) {
+    int64_t bucket_count = 1;
+    while (bucket_count * kMaxLoadFactor < init_capacity) {
+        bucket_count *= 2;
+    }
+    Allocate(init_capacity, bucket_count);
+}
+
+template <typename Key, typename Hash>
+LinearProbingHashmap<Key, Hash>::~LinearProbingHashmap() {}
+
+template <typename Key, typename Hash>
+int64_t LinearProbingHashmap<Key, Hash>::Size() const {
+    return buffer_ctx_->HeapCounter();
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Insert(
+        const void* input_keys,
+        const HashmapValueInputs& input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
+    ReserveForInsertion(count);
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count,
+               /*return_existing=*/false);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Activate(const void* input_keys,
+                                               addr_t* output_addrs,
+                                               bool* output_masks,
+                                               int64_t count) {
+    Insert(input_keys, HashmapValueInputs(), output_addrs, output_masks,
+           count);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::FindOrInsert(
+        const void* input_keys,
+        const HashmapValueInputs& input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
+    ReserveForInsertion(count);
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count,
+               /*return_existing=*/true);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Find(const void* input_keys,
+                                           addr_t* output_addrs,
+                                           bool* output_masks,
+                                           int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    utility::ParallelFor(
+            0, count,
+            [&](int64_t i) {
+                const Key& key = input_keys_templated[i];
+                int64_t slot_idx = FindSlot(key, MixHash(Hash()(key)));
+                bool flag = slot_idx >= 0;
+                output_masks[i] = flag;
+                output_addrs[i] =
+                        flag ? addr_t(slots_[slot_idx].load(
+                                              std::memory_order_acquire) &
+                                      kAddrMask)
+                             : 0;
+            },
+            kGrainSize);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Erase(const void* input_keys,
+                                            bool* output_masks,
+                                            int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    utility::ParallelFor(
+            0, count,
+            [&](int64_t i) {
+                const Key& key = input_keys_templated[i];
+                output_masks[i] = false;
+
+                int64_t slot_idx = FindSlot(key, MixHash(Hash()(key)));
+                if (slot_idx < 0) {
+                    return;
+                }
+
+                // Only one of the duplicated keys in the batch succeeds.
+                uint64_t slot =
+                        slots_[slot_idx].load(std::memory_order_acquire);
+                if (IsLiveSlot(slot) &&
+                    slots_[slot_idx].compare_exchange_strong(
+                            slot, kTombstoneSlot, std::memory_order_acq_rel)) {
+                    buffer_ctx_->DeviceFree(addr_t(slot & kAddrMask));
+                    tombstone_count_.fetch_add(1);
+                    output_masks[i] = true;
+                }
+            },
+            kGrainSize);
+}
+
+template <typename Key, typename Hash>
+int64_t LinearProbingHashmap<Key, Hash>::GetActiveIndices(
+        addr_t* output_indices) {
+    int64_t count = 0;
+    for (int64_t i = 0; i < bucket_count_; ++i) {
+        uint64_t slot = slots_[i].load(std::memory_order_relaxed);
+        if (IsLiveSlot(slot)) {
+            output_indices[count++] = addr_t(slot & kAddrMask);
+        }
+    }
+    return count;
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Restore(const void* /*input_keys*/,
+                                              const addr_t* input_addrs,
+                                              int64_t count) {
+    // Keys are read back from the buffer when published.
+    buffer_ctx_->heap_counter_ = static_cast<int>(count);
+    PublishDistinctEntries(input_addrs, count);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Clear() {
+    utility::ParallelFor(
+            0, bucket_count_,
+            [&](int64_t i) {
+                slots_[i].store(kEmptySlot, std::memory_order_relaxed);
+            },
+            kGrainSize);
+    tombstone_count_ = 0;
+    buffer_ctx_->Reset();
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Rehash(int64_t buckets) {
+    RecordHashmapRehash(this->device_);
+    int64_t iterator_count = Size();
+
+    Tensor active_keys;
+    std::vector<Tensor> active_values;
+    HashmapValueInputs active_value_inputs;
+
+    if (iterator_count > 0) {
+        Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
+        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
+
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        active_keys = this->GetKeyBuffer().IndexGet({active_indices});
+        active_value_inputs =
+                this->GatherValues(active_indices, active_values);
+    }
+
+    float avg_capacity_per_bucket =
+            float(this->capacity_) / float(bucket_count_);
+    int64_t bucket_count = 1;
+    while (bucket_count < buckets) {
+        bucket_count *= 2;
+    }
+    int64_t new_capacity =
+            int64_t(std::ceil(bucket_count * avg_capacity_per_bucket));
+
+    Allocate(new_capacity, bucket_count);
+
+    if (iterator_count > 0) {
+        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
+        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+
+        InsertImpl(active_keys.GetDataPtr(), active_value_inputs,
+                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
+                   output_masks.GetDataPtr<bool>(), iterator_count,
+                   /*return_existing=*/false);
+    }
+}
+
+template <typename Key, typename Hash>
+int64_t LinearProbingHashmap<Key, Hash>::GetBucketCount() const {
+    return bucket_count_;
+}
+
+template <typename Key, typename Hash>
+std::vector<int64_t> LinearProbingHashmap<Key, Hash>::BucketSizes() const {
+    std::vector<int64_t> ret(bucket_count_);
+    for (int64_t i = 0; i < bucket_count_; ++i) {
+        ret[i] = IsLiveSlot(slots_[i].load(std::memory_order_relaxed)) ? 1 : 0;
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash>
+float LinearProbingHashmap<Key, Hash>::LoadFactor() const {
+    return float(Size()) / float(bucket_count_);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::InsertImpl(
+        const void* input_keys,
+        const HashmapValueInputs& input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count,
+        bool return_existing) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    // Reserve and fill an entry for every key before publishing any of them.
+    // Allocation and free are not safe to mix, and published entries must
+    // already hold their keys for concurrent lookups.
+    utility::ParallelFor(
+            0, count,
+            [&](int64_t i) {
+                addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+                auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+                *static_cast<Key*>(dst_kv_iter.first) = input_keys_templated[i];
+                output_addrs[i] = dst_kv_addr;
+            },
+            kGrainSize);
+
+    const uint64_t mask = bucket_count_ - 1;
+    utility::ParallelFor(
+            0, count,
+            [&](int64_t i) {
+                const Key& key = input_keys_templated[i];
+                addr_t dst_kv_addr = output_addrs[i];
+                uint64_t hash = MixHash(Hash()(key));
+                uint64_t new_slot = (hash & kFingerprintMask) | dst_kv_addr;
+
+                // Probe until the key is found or published in the first
+                // empty slot of its sequence.
+                bool inserted = false;
+                uint64_t found_slot = kEmptySlot;
+                for (uint64_t s = hash & mask;; s = (s + 1) & mask) {
+                    uint64_t slot = slots_[s].load(std::memory_order_acquire);
+                    while (slot == kEmptySlot) {
+                        if (slots_[s].compare_exchange_weak(
+                                    slot, new_slot,
+                                    std::memory_order_acq_rel)) {
+                            inserted = true;
+                            break;
+                        }
+                    }
+                    if (inserted) {
+                        break;
+                    }
+                    if (SlotMatches(slot, hash, key)) {
+                        found_slot = slot;
+                        break;
+                    }
+                }
+
+                if (inserted) {
+                    // Copy/reset non-templated value in buffers
+                    buffer_ctx_->CopyValues(dst_kv_addr, input_values, i);
+                    output_masks[i] = true;
+                } else {
+                    // All the reserved entries have been read, so freeing is
+                    // safe here.
+                    buffer_ctx_->DeviceFree(dst_kv_addr);
+                    output_addrs[i] = return_existing
+                                              ? addr_t(found_slot & kAddrMask)
+                                              : 0;
+                    output_masks[i] = false;
+                }
+            },
+            kGrainSize);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::ReserveForInsertion(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(bucket_count_);
+        int64_t expected_buckets = std::max(
+                bucket_count_ * 2,
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+        Rehash(expected_buckets);
+    } else if (new_size + tombstone_count_.load() >
+               bucket_count_ * kMaxOccupancy) {
+        PurgeTombstones();
+    }
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::PurgeTombstones() {
+    std::vector<addr_t> active_addrs(Size());
+    int64_t count = GetActiveIndices(active_addrs.data());
+
+    utility::ParallelFor(
+            0, bucket_count_,
+            [&](int64_t i) {
+                slots_[i].store(kEmptySlot, std::memory_order_relaxed);
+            },
+            kGrainSize);
+    tombstone_count_ = 0;
+
+    PublishDistinctEntries(active_addrs.data(), count);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::PublishDistinctEntries(
+        const addr_t* addrs, int64_t count) {
+    // Keys are unique, so every entry takes the first empty slot in its
+    // probe sequence.
+    const uint64_t mask = bucket_count_ - 1;
+    utility::ParallelFor(
+            0, count,
+            [&](int64_t i) {
+                addr_t addr = addrs[i];
+                const Key& key = *static_cast<const Key*>(
+                        buffer_ctx_->ExtractIterator(addr).first);
+                uint64_t hash = MixHash(Hash()(key));
+                uint64_t new_slot = (hash & kFingerprintMask) | addr;
+                for (uint64_t s = hash & mask;; s = (s + 1) & mask) {
+                    uint64_t slot = kEmptySlot;
+                    if (slots_[s].compare_exchange_strong(
+                                slot, new_slot, std::memory_order_acq_rel)) {
+                        break;
+                    }
+                }
+            },
+            kGrainSize);
+}
+
+template <typename Key, typename Hash>
+void LinearProbingHashmap<Key, Hash>::Allocate(int64_t capacity,
+                                               int64_t bucket_count) {
+    this->capacity_ = capacity;
+    bucket_count_ = bucket_count;
+
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_values_, this->device_);
+
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferAccessor>(
+            this->capacity_, this->dsize_key_, this->dsize_values_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffers(),
+            this->buffer_->GetHeap());
+    buffer_ctx_->Reset();
+
+    slots_.reset(new std::atomic<uint64_t>[bucket_count_]);
+    utility::ParallelFor(
+            0, bucket_count_,
+            [&](int64_t i) {
+                slots_[i].store(kEmptySlot, std::memory_order_relaxed);
+            },
+            kGrainSize);
+    tombstone_count_ = 0;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -41,14 +41,14 @@ class TBBHashmap : public DeviceHashmap {
 public:
     TBBHashmap(int64_t init_capacity,
                int64_t dsize_key,
-               int64_t dsize_value,
+               const std::vector<int64_t>& dsize_values,
                const Device& device);
     ~TBBHashmap();
 
     void Rehash(int64_t buckets) override;
 
     void Insert(const void* input_keys,
-                const void* input_values,
+                const HashmapValueInputs& input_values,
                 addr_t* output_addrs,
                 bool* output_masks,
                 int64_t count) override;
@@ -58,6 +58,12 @@ public:
                   bool* output_masks,
                   int64_t count) override;
 
+    void FindOrInsert(const void* input_keys,
+                      const HashmapValueInputs& input_values,
+                      addr_t* output_addrs,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Find(const void* input_keys,
               addr_t* output_addrs,
               bool* output_masks,
@@ -69,6 +75,10 @@ public:
 
     int64_t GetActiveIndices(addr_t* output_indices) override;
 
+    void Restore(const void* input_keys,
+                 const addr_t* input_addrs,
+                 int64_t count) override;
+
     void Clear() override;
 
     int64_t Size() const override;
@@ -87,20 +97,24 @@ protected:
     std::shared_ptr<CPUHashmapBufferAccessor> buffer_ctx_;
 
     void InsertImpl(const void* input_keys,
-                    const void* input_values,
+                    const HashmapValueInputs& input_values,
                     addr_t* output_addrs,
                     bool* output_masks,
                     int64_t count);
 
+    /// Rehash ahead of inserting count more keys if the capacity could be
+    /// exceeded.
+    void ReserveForInsertion(int64_t count);
+
     void Allocate(int64_t capacity);
 };
 
 template <typename Key, typename Hash>
 TBBHashmap<Key, Hash>::TBBHashmap(int64_t init_capacity,
                                   int64_t dsize_key,
-                                  int64_t dsize_value,
+                                  const std::vector<int64_t>& dsize_values,
                                   const Device& device)
-    : DeviceHashmap(init_capacity, dsize_key, dsize_value, device) {
+    : DeviceHashmap(init_capacity, dsize_key, dsize_values, device) {
     Allocate(init_capacity);
 }
 
@@ -114,22 +128,11 @@ int64_t TBBHashmap<Key, Hash>::Size() const {
 
 template <typename Key, typename Hash>
 void TBBHashmap<Key, Hash>::Insert(const void* input_keys,
-                                   const void* input_values,
+                                   const HashmapValueInputs& input_values,
                                    addr_t* output_addrs,
                                    bool* output_masks,
                                    int64_t count) {
-    int64_t new_size = Size() + count;
-    if (new_size > this->capacity_) {
-        int64_t bucket_count = GetBucketCount();
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(bucket_count);
-
-        int64_t expected_buckets = std::max(
-                bucket_count * 2,
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-
-        Rehash(expected_buckets);
-    }
+    ReserveForInsertion(count);
     InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
 }
 
@@ -138,7 +141,50 @@ void TBBHashmap<Key, Hash>::Activate(const void* input_keys,
                                      addr_t* output_addrs,
                                      bool* output_masks,
                                      int64_t count) {
-    Insert(input_keys, nullptr, output_addrs, output_masks, count);
+    Insert(input_keys, HashmapValueInputs(), output_addrs, output_masks,
+           count);
+}
+
+template <typename Key, typename Hash>
+void TBBHashmap<Key, Hash>::FindOrInsert(const void* input_keys,
+                                         const HashmapValueInputs& input_values,
+                                         addr_t* output_addrs,
+                                         bool* output_masks,
+                                         int64_t count) {
+    ReserveForInsertion(count);
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+    // Reserve an entry for every key before touching the map, so that a key is
+    // published together with its final address and concurrent duplicates in
+    // the same batch can read it back safely.
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        output_addrs[i] = buffer_ctx_->DeviceAllocate();
+    }
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+        addr_t dst_kv_addr = output_addrs[i];
+
+        auto res = impl_->insert({key, dst_kv_addr});
+        if (res.second) {
+            auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+
+            // Copy templated key to buffer
+            *static_cast<Key*>(dst_kv_iter.first) = key;
+
+            // Copy/reset non-templated placeholder value in buffers
+            buffer_ctx_->CopyValues(dst_kv_addr, input_values, i);
+            output_masks[i] = true;
+        } else {
+            // Existing key: return its entry and release the reserved one.
+            output_addrs[i] = res.first->second;
+            output_masks[i] = false;
+            buffer_ctx_->DeviceFree(dst_kv_addr);
+        }
+    }
 }
 
 template <typename Key, typename Hash>
@@ -189,6 +235,19 @@ int64_t TBBHashmap<Key, Hash>::GetActiveIndices(addr_t* output_indices) {
     return count;
 }
 
+template <typename Key, typename Hash>
+void TBBHashmap<Key, Hash>::Restore(const void* input_keys,
+                                    const addr_t* input_addrs,
+                                    int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    buffer_ctx_->heap_counter_ = static_cast<int>(count);
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        impl_->insert({input_keys_templated[i], input_addrs[i]});
+    }
+}
+
 template <typename Key, typename Hash>
 void TBBHashmap<Key, Hash>::Clear() {
     impl_->clear();
@@ -197,10 +256,12 @@ void TBBHashmap<Key, Hash>::Clear() {
 
 template <typename Key, typename Hash>
 void TBBHashmap<Key, Hash>::Rehash(int64_t buckets) {
+    RecordHashmapRehash(this->device_);
     int64_t iterator_count = Size();
 
     Tensor active_keys;
-    Tensor active_values;
+    std::vector<Tensor> active_values;
+    HashmapValueInputs active_value_inputs;
 
     if (iterator_count > 0) {
         Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
@@ -208,7 +269,8 @@ void TBBHashmap<Key, Hash>::Rehash(int64_t buckets) {
 
         Tensor active_indices = active_addrs.To(Dtype::Int64);
         active_keys = this->GetKeyBuffer().IndexGet({active_indices});
-        active_values = this->GetValueBuffer().IndexGet({active_indices});
+        active_value_inputs =
+                this->GatherValues(active_indices, active_values);
     }
 
     float avg_capacity_per_bucket =
@@ -222,7 +284,7 @@ void TBBHashmap<Key, Hash>::Rehash(int64_t buckets) {
         Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
         Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
 
-        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+        InsertImpl(active_keys.GetDataPtr(), active_value_inputs,
                    static_cast<addr_t*>(output_addrs.GetDataPtr()),
                    output_masks.GetDataPtr<bool>(), iterator_count);
     }
@@ -252,7 +314,7 @@ float TBBHashmap<Key, Hash>::LoadFactor() const {
 
 template <typename Key, typename Hash>
 void TBBHashmap<Key, Hash>::InsertImpl(const void* input_keys,
-                                       const void* input_values,
+                                       const HashmapValueInputs& input_values,
                                        addr_t* output_addrs,
                                        bool* output_masks,
                                        int64_t count) {
@@ -276,16 +338,8 @@ void TBBHashmap<Key, Hash>::InsertImpl(const void* input_keys,
             // Copy templated key to buffer
             *static_cast<Key*>(dst_kv_iter.first) = key;
 
-            // Copy/reset non-templated value in buffer
-            uint8_t* dst_value = static_cast<uint8_t*>(dst_kv_iter.second);
-            if (input_values != nullptr) {
-                const uint8_t* src_value =
-                        static_cast<const uint8_t*>(input_values) +
-                        this->dsize_value_ * i;
-                std::memcpy(dst_value, src_value, this->dsize_value_);
-            } else {
-                std::memset(dst_value, 0, this->dsize_value_);
-            }
+            // Copy/reset non-templated value in buffers
+            buffer_ctx_->CopyValues(dst_kv_addr, input_values, i);
 
             // Update from dummy 0
             res.first->second = dst_kv_addr;
@@ -297,17 +351,33 @@ void TBBHashmap<Key, Hash>::InsertImpl(const void* input_keys,
     }
 }
 
+template <typename Key, typename Hash>
+void TBBHashmap<Key, Hash>::ReserveForInsertion(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        int64_t bucket_count = GetBucketCount();
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(bucket_count);
+
+        int64_t expected_buckets = std::max(
+                bucket_count * 2,
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+
+        Rehash(expected_buckets);
+    }
+}
+
 template <typename Key, typename Hash>
 void TBBHashmap<Key, Hash>::Allocate(int64_t capacity) {
     this->capacity_ = capacity;
 
     this->buffer_ =
             std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
-                                            this->dsize_value_, this->device_);
+                                            this->dsize_values_, this->device_);
 
     buffer_ctx_ = std::make_shared<CPUHashmapBufferAccessor>(
-            this->capacity_, this->dsize_key_, this->dsize_value_,
-            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->capacity_, this->dsize_key_, this->dsize_values_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffers(),
             this->buffer_->GetHeap());
     buffer_ctx_->Reset();
 
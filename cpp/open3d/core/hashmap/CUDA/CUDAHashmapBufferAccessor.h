@@ -36,6 +36,7 @@
 #include "open3d/core/hashmap/CUDA/SlabMacros.h"
 #include "open3d/core/hashmap/CUDA/SlabTraits.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
+#include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace core {
@@ -49,17 +50,25 @@ class CUDAHashmapBufferAccessor {
 public:
     __host__ void Setup(int64_t capacity,
                         int64_t dsize_key,
-                        int64_t dsize_value,
+                        const std::vector<int64_t> &dsize_values,
                         Tensor &keys,
-                        Tensor &values,
+                        std::vector<Tensor> &values,
                         Tensor &heap) {
+        n_values_ = static_cast<int64_t>(dsize_values.size());
+        if (n_values_ < 1 || n_values_ > kMaxValueBuffers) {
+            utility::LogError("Expected 1 to {} value buffers, but got {}.",
+                              kMaxValueBuffers, n_values_);
+        }
         capacity_ = capacity;
         dsize_key_ = dsize_key;
-        dsize_value_ = dsize_value;
         keys_ = keys.GetDataPtr<uint8_t>();
-        values_ = values.GetDataPtr<uint8_t>();
+        for (int64_t j = 0; j < n_values_; ++j) {
+            dsize_values_[j] = dsize_values[j];
+            values_[j] = values[j].GetDataPtr<uint8_t>();
+            OPEN3D_CUDA_CHECK(
+                    cudaMemset(values_[j], 0, capacity_ * dsize_values_[j]));
+        }
         heap_ = static_cast<addr_t *>(heap.GetDataPtr());
-        OPEN3D_CUDA_CHECK(cudaMemset(values_, 0, capacity_ * dsize_value_));
         OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
@@ -106,19 +115,51 @@ public:
         return heap_counter;
     }
 
+    /// Returns the key and the first value buffer of entry \p ptr.
     __device__ iterator_t ExtractIterator(addr_t ptr) {
         return iterator_t(keys_ + ptr * dsize_key_,
-                          values_ + ptr * dsize_value_);
+                          values_[0] + ptr * dsize_values_[0]);
+    }
+
+    /// Copies row \p i of each input value array into the matching value
+    /// buffer of entry \p ptr. Zeroes the values if \p src holds no buffers.
+    /// Rows are copied by 4-byte words when the sizes and addresses allow it.
+    __device__ void CopyValues(addr_t ptr,
+                               const HashmapValueInputs &src,
+                               int64_t i) {
+        for (int64_t j = 0; j < n_values_; ++j) {
+            int64_t dsize = dsize_values_[j];
+            uint8_t *dst = values_[j] + ptr * dsize;
+            const uint8_t *src_row =
+                    src.n_buffers > 0 ? src.buffers[j].ptr + i * dsize
+                                      : nullptr;
+            bool word_aligned = ((reinterpret_cast<uintptr_t>(dst) |
+                                  reinterpret_cast<uintptr_t>(src_row) |
+                                  static_cast<uintptr_t>(dsize)) &
+                                 3) == 0;
+            if (word_aligned) {
+                int *dst_words = reinterpret_cast<int *>(dst);
+                const int *src_words = reinterpret_cast<const int *>(src_row);
+                for (int64_t w = 0; w < dsize / 4; ++w) {
+                    dst_words[w] = src_row != nullptr ? src_words[w] : 0;
+                }
+            } else {
+                for (int64_t byte = 0; byte < dsize; ++byte) {
+                    dst[byte] = src_row != nullptr ? src_row[byte] : 0;
+                }
+            }
+        }
     }
 
 public:
-    uint8_t *keys_;               /* [N] * sizeof(Key) */
-    uint8_t *values_;             /* [N] * sizeof(Value) */
-    addr_t *heap_;                /* [N] */
-    int *heap_counter_ = nullptr; /* [1] */
+    uint8_t *keys_;                     /* [N] * sizeof(Key) */
+    uint8_t *values_[kMaxValueBuffers]; /* [M][N] * sizeof(Value_m) */
+    addr_t *heap_;                      /* [N] */
+    int *heap_counter_ = nullptr;       /* [1] */
 
     int64_t dsize_key_;
-    int64_t dsize_value_;
+    int64_t n_values_;
+    int64_t dsize_values_[kMaxValueBuffers];
     int64_t capacity_;
 };
 
@@ -40,7 +40,7 @@ class SlabHashmap : public DeviceHashmap {
 public:
     SlabHashmap(int64_t init_capacity,
                 int64_t dsize_key,
-                int64_t dsize_value,
+                const std::vector<int64_t>& dsize_values,
                 const Device& device);
 
     ~SlabHashmap();
@@ -48,7 +48,7 @@ public:
     void Rehash(int64_t buckets) override;
 
     void Insert(const void* input_keys,
-                const void* input_values,
+                const HashmapValueInputs& input_values,
                 addr_t* output_addrs,
                 bool* output_masks,
                 int64_t count) override;
@@ -58,6 +58,12 @@ public:
                   bool* output_masks,
                   int64_t count) override;
 
+    void FindOrInsert(const void* input_keys,
+                      const HashmapValueInputs& input_values,
+                      addr_t* output_addrs,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Find(const void* input_keys,
               addr_t* output_addrs,
               bool* output_masks,
@@ -68,6 +74,9 @@ public:
                int64_t count) override;
 
     int64_t GetActiveIndices(addr_t* output_indices) override;
+    void Restore(const void* input_keys,
+                 const addr_t* input_addrs,
+                 int64_t count) override;
     void Clear() override;
 
     int64_t Size() const override;
@@ -88,11 +97,31 @@ protected:
     /// Rehash, Insert, Activate all call InsertImpl. It will be clean to
     /// separate this implementation and avoid shared checks.
     void InsertImpl(const void* input_keys,
-                    const void* input_values,
+                    const HashmapValueInputs& input_values,
                     addr_t* output_addrs,
                     bool* output_masks,
                     int64_t count);
 
+    /// Make room for count more keys if the capacity could be exceeded. The
+    /// key-value buffer is grown in place while the bucket lists can absorb
+    /// the new entries, and the table is only rehashed beyond that.
+    void ReserveForInsertion(int64_t count);
+
+    /// Grow the key-value buffer and the heap to new_capacity, keeping the
+    /// addresses of active entries, hence the bucket lists, untouched. This
+    /// costs a device copy of the buffer instead of a full re-insertion.
+    void GrowBuffer(int64_t new_capacity);
+
+    /// Maximal average number of entries per bucket reached by GrowBuffer.
+    /// Lists stay within their head slab (31 entries) with high probability.
+    static constexpr int64_t kMaxGrowthEntriesPerBucket = 8;
+
+    /// Pre-allocate count buffer entries in output_addrs and write the keys to
+    /// them, so that they can be published to the slab lists in one shot.
+    void PreallocateEntries(const void* input_keys,
+                            addr_t* output_addrs,
+                            int64_t count);
+
     void Allocate(int64_t bucket_count, int64_t capacity);
     void Free();
 
@@ -102,9 +131,9 @@ protected:
 template <typename Key, typename Hash>
 SlabHashmap<Key, Hash>::SlabHashmap(int64_t init_capacity,
                                     int64_t dsize_key,
-                                    int64_t dsize_value,
+                                    const std::vector<int64_t>& dsize_values,
                                     const Device& device)
-    : DeviceHashmap(init_capacity, dsize_key, dsize_value, device) {
+    : DeviceHashmap(init_capacity, dsize_key, dsize_values, device) {
     int64_t init_buckets = init_capacity * 2;
     Allocate(init_buckets, init_capacity);
 }
@@ -116,10 +145,12 @@ SlabHashmap<Key, Hash>::~SlabHashmap() {
 
 template <typename Key, typename Hash>
 void SlabHashmap<Key, Hash>::Rehash(int64_t buckets) {
+    RecordHashmapRehash(this->device_);
     int64_t iterator_count = Size();
 
     Tensor active_keys;
-    Tensor active_values;
+    std::vector<Tensor> active_values;
+    HashmapValueInputs active_value_inputs;
 
     if (iterator_count > 0) {
         Tensor active_addrs =
@@ -128,8 +159,8 @@ void SlabHashmap<Key, Hash>::Rehash(int64_t buckets) {
 
         Tensor active_indices = active_addrs.To(Dtype::Int64);
         active_keys = this->buffer_->GetKeyBuffer().IndexGet({active_indices});
-        active_values =
-                this->buffer_->GetValueBuffer().IndexGet({active_indices});
+        active_value_inputs =
+                this->GatherValues(active_indices, active_values);
     }
 
     float avg_capacity_per_bucket =
@@ -144,7 +175,7 @@ void SlabHashmap<Key, Hash>::Rehash(int64_t buckets) {
         Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
         Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
 
-        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+        InsertImpl(active_keys.GetDataPtr(), active_value_inputs,
                    static_cast<addr_t*>(output_addrs.GetDataPtr()),
                    output_masks.GetDataPtr<bool>(), iterator_count);
     }
@@ -153,20 +184,11 @@ void SlabHashmap<Key, Hash>::Rehash(int64_t buckets) {
 
 template <typename Key, typename Hash>
 void SlabHashmap<Key, Hash>::Insert(const void* input_keys,
-                                    const void* input_values,
+                                    const HashmapValueInputs& input_values,
                                     addr_t* output_addrs,
                                     bool* output_masks,
                                     int64_t count) {
-    int64_t new_size = Size() + count;
-    if (new_size > this->capacity_) {
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(this->bucket_count_);
-        int64_t expected_buckets = std::max(
-                int64_t(this->bucket_count_ * 2),
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
-    }
-
+    ReserveForInsertion(count);
     InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
 }
 
@@ -175,7 +197,30 @@ void SlabHashmap<Key, Hash>::Activate(const void* input_keys,
                                       addr_t* output_addrs,
                                       bool* output_masks,
                                       int64_t count) {
-    Insert(input_keys, nullptr, output_addrs, output_masks, count);
+    Insert(input_keys, HashmapValueInputs(), output_addrs, output_masks,
+           count);
+}
+
+template <typename Key, typename Hash>
+void SlabHashmap<Key, Hash>::FindOrInsert(
+        const void* input_keys,
+        const HashmapValueInputs& input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
+    if (count == 0) return;
+
+    ReserveForInsertion(count);
+    PreallocateEntries(input_keys, output_addrs, count);
+
+    const int64_t num_blocks =
+            (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    FindOrInsertKernelPass1<<<num_blocks, kThreadsPerBlock>>>(
+            impl_, input_keys, output_addrs, output_masks, count);
+    FindOrInsertKernelPass2<<<num_blocks, kThreadsPerBlock>>>(
+            impl_, input_values, output_addrs, output_masks, count);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
 }
 
 template <typename Key, typename Hash>
@@ -245,6 +290,28 @@ int64_t SlabHashmap<Key, Hash>::GetActiveIndices(addr_t* output_addrs) {
     return static_cast<int64_t>(ret);
 }
 
+template <typename Key, typename Hash>
+void SlabHashmap<Key, Hash>::Restore(const void* input_keys,
+                                     const addr_t* input_addrs,
+                                     int64_t count) {
+    *thrust::device_ptr<int>(impl_.buffer_accessor_.heap_counter_) =
+            static_cast<int>(count);
+    if (count == 0) return;
+
+    // Keys are distinct, so every entry is published to its slab list in a
+    // single pass, without copying keys or values.
+    bool* output_masks = static_cast<bool*>(
+            MemoryManager::Malloc(count * sizeof(bool), this->device_));
+    const int64_t num_blocks =
+            (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    InsertKernelPass1<<<num_blocks, kThreadsPerBlock>>>(
+            impl_, input_keys, const_cast<addr_t*>(input_addrs), output_masks,
+            count);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    MemoryManager::Free(output_masks, this->device_);
+}
+
 template <typename Key, typename Hash>
 void SlabHashmap<Key, Hash>::Clear() {
     // Clear the heap
@@ -295,12 +362,92 @@ float SlabHashmap<Key, Hash>::LoadFactor() const {
 
 template <typename Key, typename Hash>
 void SlabHashmap<Key, Hash>::InsertImpl(const void* input_keys,
-                                        const void* input_values,
+                                        const HashmapValueInputs& input_values,
                                         addr_t* output_addrs,
                                         bool* output_masks,
                                         int64_t count) {
     if (count == 0) return;
 
+    PreallocateEntries(input_keys, output_addrs, count);
+
+    const int64_t num_blocks =
+            (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    InsertKernelPass1<<<num_blocks, kThreadsPerBlock>>>(
+            impl_, input_keys, output_addrs, output_masks, count);
+    InsertKernelPass2<<<num_blocks, kThreadsPerBlock>>>(
+            impl_, input_values, output_addrs, output_masks, count);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+template <typename Key, typename Hash>
+void SlabHashmap<Key, Hash>::ReserveForInsertion(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size <= this->capacity_) {
+        return;
+    }
+
+    int64_t new_capacity = std::max(this->capacity_ * 2, new_size);
+    if (new_capacity <= this->bucket_count_ * kMaxGrowthEntriesPerBucket) {
+        GrowBuffer(new_capacity);
+    } else {
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(this->bucket_count_);
+        int64_t expected_buckets = std::max(
+                int64_t(this->bucket_count_ * 2),
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+        Rehash(expected_buckets);
+    }
+}
+
+template <typename Key, typename Hash>
+void SlabHashmap<Key, Hash>::GrowBuffer(int64_t new_capacity) {
+    int64_t old_capacity = this->capacity_;
+    std::shared_ptr<HashmapBuffer> old_buffer = this->buffer_;
+
+    this->capacity_ = new_capacity;
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_values_, this->device_);
+
+    // Setup zeroes the values, and the heap counter is kept as is.
+    buffer_accessor_.Setup(this->capacity_, this->dsize_key_,
+                           this->dsize_values_, this->buffer_->GetKeyBuffer(),
+                           this->buffer_->GetValueBuffers(),
+                           this->buffer_->GetHeap());
+
+    MemoryManager::Memcpy(this->buffer_->GetKeyBuffer().GetDataPtr(),
+                          this->device_,
+                          old_buffer->GetKeyBuffer().GetDataPtr(),
+                          this->device_, old_capacity * this->dsize_key_);
+    for (size_t j = 0; j < this->dsize_values_.size(); ++j) {
+        MemoryManager::Memcpy(
+                this->buffer_->GetValueBuffer(j).GetDataPtr(), this->device_,
+                old_buffer->GetValueBuffer(j).GetDataPtr(), this->device_,
+                old_capacity * this->dsize_values_[j]);
+    }
+
+    // Free addresses are stored above the heap counter: keep the old ones in
+    // place, followed by the new addresses old_capacity, ..., new_capacity-1.
+    addr_t* heap = static_cast<addr_t*>(this->buffer_->GetHeap().GetDataPtr());
+    const int blocks = (this->capacity_ + kThreadsPerBlock - 1) /
+                       kThreadsPerBlock;
+    ResetHashmapBufferKernel<<<blocks, kThreadsPerBlock>>>(heap,
+                                                           this->capacity_);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    MemoryManager::Memcpy(heap, this->device_,
+                          old_buffer->GetHeap().GetDataPtr(), this->device_,
+                          old_capacity * sizeof(addr_t));
+
+    impl_.Setup(this->bucket_count_, this->capacity_, this->dsize_key_,
+                this->dsize_value_, node_mgr_->impl_, buffer_accessor_);
+}
+
+template <typename Key, typename Hash>
+void SlabHashmap<Key, Hash>::PreallocateEntries(const void* input_keys,
+                                                addr_t* output_addrs,
+                                                int64_t count) {
     /// Increase heap_counter to pre-allocate potential memory increment and
     /// avoid atomicAdd in kernel.
     int prev_heap_counter = buffer_accessor_.HeapCounter(this->device_);
@@ -311,12 +458,6 @@ void SlabHashmap<Key, Hash>::InsertImpl(const void* input_keys,
             (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
     InsertKernelPass0<<<num_blocks, kThreadsPerBlock>>>(
             impl_, input_keys, output_addrs, prev_heap_counter, count);
-    InsertKernelPass1<<<num_blocks, kThreadsPerBlock>>>(
-            impl_, input_keys, output_addrs, output_masks, count);
-    InsertKernelPass2<<<num_blocks, kThreadsPerBlock>>>(
-            impl_, input_values, output_addrs, output_masks, count);
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
-    OPEN3D_CUDA_CHECK(cudaGetLastError());
 }
 
 template <typename Key, typename Hash>
@@ -327,11 +468,11 @@ void SlabHashmap<Key, Hash>::Allocate(int64_t bucket_count, int64_t capacity) {
     // Allocate buffer for key values.
     this->buffer_ =
             std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
-                                            this->dsize_value_, this->device_);
+                                            this->dsize_values_, this->device_);
     buffer_accessor_.HostAllocate(this->device_);
     buffer_accessor_.Setup(this->capacity_, this->dsize_key_,
-                           this->dsize_value_, this->buffer_->GetKeyBuffer(),
-                           this->buffer_->GetValueBuffer(),
+                           this->dsize_values_, this->buffer_->GetKeyBuffer(),
+                           this->buffer_->GetValueBuffers(),
                            this->buffer_->GetHeap());
     buffer_accessor_.Reset(this->device_);
 
@@ -62,11 +62,14 @@ public:
                         const SlabNodeManagerImpl& node_mgr_impl,
                         const CUDAHashmapBufferAccessor& buffer_accessor);
 
-    __device__ bool Insert(bool lane_active,
-                           uint32_t lane_id,
-                           uint32_t bucket_id,
-                           const Key& key,
-                           addr_t iterator_addr);
+    /// Returns the address of the entry holding key, i.e. iterator_addr on
+    /// success, or the address of the existing entry otherwise, and whether
+    /// the insertion succeeded.
+    __device__ Pair<addr_t, bool> Insert(bool lane_active,
+                                         uint32_t lane_id,
+                                         uint32_t bucket_id,
+                                         const Key& key,
+                                         addr_t iterator_addr);
 
     __device__ Pair<addr_t, bool> Find(bool lane_active,
                                        uint32_t lane_id,
@@ -135,11 +138,25 @@ __global__ void InsertKernelPass1(SlabHashmapImpl<Key, Hash> impl,
 
 template <typename Key, typename Hash>
 __global__ void InsertKernelPass2(SlabHashmapImpl<Key, Hash> impl,
-                                  const void* input_values,
+                                  HashmapValueInputs input_values,
                                   addr_t* output_addrs,
                                   bool* output_masks,
                                   int64_t count);
 
+template <typename Key, typename Hash>
+__global__ void FindOrInsertKernelPass1(SlabHashmapImpl<Key, Hash> impl,
+                                        const void* input_keys,
+                                        addr_t* output_addrs,
+                                        bool* output_masks,
+                                        int64_t count);
+
+template <typename Key, typename Hash>
+__global__ void FindOrInsertKernelPass2(SlabHashmapImpl<Key, Hash> impl,
+                                        HashmapValueInputs input_values,
+                                        addr_t* output_addrs,
+                                        bool* output_masks,
+                                        int64_t count);
+
 template <typename Key, typename Hash>
 __global__ void FindKernel(SlabHashmapImpl<Key, Hash> impl,
                            const void* input_keys,
@@ -191,16 +208,18 @@ void SlabHashmapImpl<Key, Hash>::Setup(
 }
 
 template <typename Key, typename Hash>
-__device__ bool SlabHashmapImpl<Key, Hash>::Insert(bool lane_active,
-                                                   uint32_t lane_id,
-                                                   uint32_t bucket_id,
-                                                   const Key& key,
-                                                   addr_t iterator_addr) {
+__device__ Pair<addr_t, bool> SlabHashmapImpl<Key, Hash>::Insert(
+        bool lane_active,
+        uint32_t lane_id,
+        uint32_t bucket_id,
+        const Key& key,
+        addr_t iterator_addr) {
     uint32_t work_queue = 0;
     uint32_t prev_work_queue = 0;
     uint32_t curr_slab_ptr = kHeadSlabAddr;
     Key src_key;
 
+    addr_t result_addr = iterator_addr;
     bool mask = false;
 
     // > Loop when we have active lanes
@@ -225,9 +244,13 @@ __device__ bool SlabHashmapImpl<Key, Hash>::Insert(bool lane_active,
 
         // Branch 1: key already existing, ABORT
         if (lane_found >= 0) {
+            // broadcast the existing entry
+            addr_t found_iterator_addr = __shfl_sync(
+                    kSyncLanesMask, unit_data, lane_found, kWarpSize);
             if (lane_id == src_lane) {
                 // free memory heap
                 lane_active = false;
+                result_addr = found_iterator_addr;
             }
         }
 
@@ -303,7 +326,7 @@ __device__ bool SlabHashmapImpl<Key, Hash>::Insert(bool lane_active,
         prev_work_queue = work_queue;
     }
 
-    return mask;
+    return make_pair(result_addr, mask);
 }
 
 template <typename Key, typename Hash>
@@ -549,17 +572,17 @@ __global__ void InsertKernelPass1(SlabHashmapImpl<Key, Hash> impl,
     }
 
     // Index out-of-bound threads still have to run for warp synchronization.
-    bool mask =
+    Pair<addr_t, bool> result =
             impl.Insert(lane_active, lane_id, bucket_id, key, iterator_addr);
 
     if (tid < count) {
-        output_masks[tid] = mask;
+        output_masks[tid] = result.second;
     }
 }
 
 template <typename Key, typename Hash>
 __global__ void InsertKernelPass2(SlabHashmapImpl<Key, Hash> impl,
-                                  const void* input_values,
+                                  HashmapValueInputs input_values,
                                   addr_t* output_addrs,
                                   bool* output_masks,
                                   int64_t count) {
@@ -569,15 +592,10 @@ __global__ void InsertKernelPass2(SlabHashmapImpl<Key, Hash> impl,
         addr_t iterator_addr = output_addrs[tid];
 
         if (output_masks[tid]) {
-            iterator_t iterator =
-                    impl.buffer_accessor_.ExtractIterator(iterator_addr);
-
             // Success: copy remaining input_values
-            if (input_values != nullptr) {
-                MEMCPY_AS_INTS(iterator.second,
-                               static_cast<const uint8_t*>(input_values) +
-                                       tid * impl.dsize_value_,
-                               impl.dsize_value_);
+            if (input_values.n_buffers > 0) {
+                impl.buffer_accessor_.CopyValues(iterator_addr, input_values,
+                                                 tid);
             }
         } else {
             impl.buffer_accessor_.DeviceFree(iterator_addr);
@@ -585,6 +603,64 @@ __global__ void InsertKernelPass2(SlabHashmapImpl<Key, Hash> impl,
     }
 }
 
+template <typename Key, typename Hash>
+__global__ void FindOrInsertKernelPass1(SlabHashmapImpl<Key, Hash> impl,
+                                        const void* input_keys,
+                                        addr_t* output_addrs,
+                                        bool* output_masks,
+                                        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    uint32_t lane_id = tid & 0x1F;
+
+    if (tid - lane_id >= count) {
+        return;
+    }
+
+    impl.node_mgr_impl_.Init(tid, lane_id);
+
+    bool lane_active = false;
+    uint32_t bucket_id = 0;
+    addr_t iterator_addr = 0;
+
+    // Dummy for warp sync.
+    Key key;
+    if (tid < count) {
+        lane_active = true;
+        key = input_keys_templated[tid];
+        iterator_addr = output_addrs[tid];
+        bucket_id = impl.ComputeBucket(key);
+    }
+
+    // Index out-of-bound threads still have to run for warp synchronization.
+    Pair<addr_t, bool> result =
+            impl.Insert(lane_active, lane_id, bucket_id, key, iterator_addr);
+
+    if (tid < count) {
+        // Existing key: return its entry and release the pre-allocated one.
+        // All heap slots were read in pass 0, so freeing here is safe.
+        if (!result.second) {
+            impl.buffer_accessor_.DeviceFree(iterator_addr);
+        }
+        output_addrs[tid] = result.first;
+        output_masks[tid] = result.second;
+    }
+}
+
+template <typename Key, typename Hash>
+__global__ void FindOrInsertKernelPass2(SlabHashmapImpl<Key, Hash> impl,
+                                        HashmapValueInputs input_values,
+                                        addr_t* output_addrs,
+                                        bool* output_masks,
+                                        int64_t count) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+
+    if (tid < count && output_masks[tid]) {
+        // New entry: copy/reset the placeholder value.
+        impl.buffer_accessor_.CopyValues(output_addrs[tid], input_values, tid);
+    }
+}
+
 template <typename Key, typename Hash>
 __global__ void FindKernel(SlabHashmapImpl<Key, Hash> impl,
                            const void* input_keys,
@@ -47,14 +47,14 @@ class StdGPUHashmap : public DeviceHashmap {
 public:
     StdGPUHashmap(int64_t init_capacity,
                   int64_t dsize_key,
-                  int64_t dsize_value,
+                  const std::vector<int64_t>& dsize_values,
                   const Device& device);
     ~StdGPUHashmap();
 
     void Rehash(int64_t buckets) override;
 
     void Insert(const void* input_keys,
-                const void* input_values,
+                const HashmapValueInputs& input_values,
                 addr_t* output_addrs,
                 bool* output_masks,
                 int64_t count) override;
@@ -64,6 +64,12 @@ public:
                   bool* output_masks,
                   int64_t count) override;
 
+    void FindOrInsert(const void* input_keys,
+                      const HashmapValueInputs& input_values,
+                      addr_t* output_addrs,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Find(const void* input_keys,
               addr_t* output_addrs,
               bool* output_masks,
@@ -75,6 +81,10 @@ public:
 
     int64_t GetActiveIndices(addr_t* output_indices) override;
 
+    void Restore(const void* input_keys,
+                 const addr_t* input_addrs,
+                 int64_t count) override;
+
     void Clear() override;
 
     int64_t Size() const override;
@@ -93,21 +103,26 @@ protected:
     CUDAHashmapBufferAccessor buffer_accessor_;
 
     void InsertImpl(const void* input_keys,
-                    const void* input_values,
+                    const HashmapValueInputs& input_values,
                     addr_t* output_addrs,
                     bool* output_masks,
                     int64_t count);
 
+    /// Rehash ahead of inserting count more keys if the capacity could be
+    /// exceeded.
+    void ReserveForInsertion(int64_t count);
+
     void Allocate(int64_t capacity);
     void Free();
 };
 
 template <typename Key, typename Hash>
-StdGPUHashmap<Key, Hash>::StdGPUHashmap(int64_t init_capacity,
-                                        int64_t dsize_key,
-                                        int64_t dsize_value,
-                                        const Device& device)
-    : DeviceHashmap(init_capacity, dsize_key, dsize_value, device) {
+StdGPUHashmap<Key, Hash>::StdGPUHashmap(
+        int64_t init_capacity,
+        int64_t dsize_key,
+        const std::vector<int64_t>& dsize_values,
+        const Device& device)
+    : DeviceHashmap(init_capacity, dsize_key, dsize_values, device) {
     Allocate(init_capacity);
 }
 
@@ -123,20 +138,11 @@ int64_t StdGPUHashmap<Key, Hash>::Size() const {
 
 template <typename Key, typename Hash>
 void StdGPUHashmap<Key, Hash>::Insert(const void* input_keys,
-                                      const void* input_values,
+                                      const HashmapValueInputs& input_values,
                                       addr_t* output_addrs,
                                       bool* output_masks,
                                       int64_t count) {
-    int64_t new_size = Size() + count;
-    if (new_size > this->capacity_) {
-        int64_t bucket_count = GetBucketCount();
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(bucket_count);
-        int64_t expected_buckets = std::max(
-                bucket_count * 2,
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
-    }
+    ReserveForInsertion(count);
     InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
 }
 
@@ -145,7 +151,80 @@ void StdGPUHashmap<Key, Hash>::Activate(const void* input_keys,
                                         addr_t* output_addrs,
                                         bool* output_masks,
                                         int64_t count) {
-    Insert(input_keys, nullptr, output_addrs, output_masks, count);
+    Insert(input_keys, HashmapValueInputs(), output_addrs, output_masks,
+           count);
+}
+
+template <typename Key, typename Hash>
+__global__ void STDGPUPreallocateKernel(
+        CUDAHashmapBufferAccessor buffer_accessor,
+        addr_t* output_addrs,
+        int64_t count) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    if (tid >= count) return;
+
+    output_addrs[tid] = buffer_accessor.DeviceAllocate();
+}
+
+// Need an explicit kernel for non-const access to map
+template <typename Key, typename Hash>
+__global__ void STDGPUFindOrInsertKernel(
+        stdgpu::unordered_map<Key, addr_t, Hash> map,
+        CUDAHashmapBufferAccessor buffer_accessor,
+        const Key* input_keys,
+        HashmapValueInputs input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    if (tid >= count) return;
+
+    Key key = input_keys[tid];
+    addr_t dst_kv_addr = output_addrs[tid];
+
+    // Insert with the pre-allocated index, so that duplicates in the same
+    // batch never observe a dummy index.
+    auto res = map.emplace(key, dst_kv_addr);
+
+    if (res.second) {
+        auto dst_kv_iter = buffer_accessor.ExtractIterator(dst_kv_addr);
+
+        // Copy templated key to buffer (duplicate)
+        *static_cast<Key*>(dst_kv_iter.first) = key;
+
+        // Copy/reset non-templated placeholder value in buffers
+        buffer_accessor.CopyValues(dst_kv_addr, input_values, tid);
+        output_masks[tid] = true;
+    } else {
+        // Existing key: return its entry and release the pre-allocated one.
+        output_addrs[tid] = res.first->second;
+        output_masks[tid] = false;
+        buffer_accessor.DeviceFree(dst_kv_addr);
+    }
+}
+
+template <typename Key, typename Hash>
+void StdGPUHashmap<Key, Hash>::FindOrInsert(
+        const void* input_keys,
+        const HashmapValueInputs& input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
+    if (count == 0) return;
+
+    ReserveForInsertion(count);
+
+    uint32_t threads = 128;
+    uint32_t blocks = (count + threads - 1) / threads;
+
+    // Allocation and free can not be mixed in one kernel, so reserve the
+    // entries in a separate launch.
+    STDGPUPreallocateKernel<Key, Hash>
+            <<<blocks, threads>>>(buffer_accessor_, output_addrs, count);
+    STDGPUFindOrInsertKernel<<<blocks, threads>>>(
+            impl_, buffer_accessor_, static_cast<const Key*>(input_keys),
+            input_values, output_addrs, output_masks, count);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
 }
 
 // Need an explicit kernel for non-const access to map
@@ -240,6 +319,37 @@ int64_t StdGPUHashmap<Key, Hash>::GetActiveIndices(addr_t* output_indices) {
     return impl_.size();
 }
 
+// Need an explicit kernel for non-const access to map
+template <typename Key, typename Hash>
+__global__ void STDGPURestoreKernel(
+        stdgpu::unordered_map<Key, addr_t, Hash> map,
+        const Key* input_keys,
+        const addr_t* input_addrs,
+        int64_t count) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    if (tid >= count) return;
+
+    map.emplace(input_keys[tid], input_addrs[tid]);
+}
+
+template <typename Key, typename Hash>
+void StdGPUHashmap<Key, Hash>::Restore(const void* input_keys,
+                                       const addr_t* input_addrs,
+                                       int64_t count) {
+    int heap_counter = static_cast<int>(count);
+    MemoryManager::Memcpy(buffer_accessor_.heap_counter_, this->device_,
+                          &heap_counter, Device("CPU:0"), sizeof(int));
+
+    if (count == 0) return;
+    uint32_t threads = 128;
+    uint32_t blocks = (count + threads - 1) / threads;
+
+    STDGPURestoreKernel<<<blocks, threads>>>(
+            impl_, static_cast<const Key*>(input_keys), input_addrs, count);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
 template <typename Key, typename Hash>
 void StdGPUHashmap<Key, Hash>::Clear() {
     impl_.clear();
@@ -248,10 +358,12 @@ void StdGPUHashmap<Key, Hash>::Clear() {
 
 template <typename Key, typename Hash>
 void StdGPUHashmap<Key, Hash>::Rehash(int64_t buckets) {
+    RecordHashmapRehash(this->device_);
     int64_t iterator_count = Size();
 
     Tensor active_keys;
-    Tensor active_values;
+    std::vector<Tensor> active_values;
+    HashmapValueInputs active_value_inputs;
 
     if (iterator_count > 0) {
         Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
@@ -259,7 +371,8 @@ void StdGPUHashmap<Key, Hash>::Rehash(int64_t buckets) {
 
         Tensor active_indices = active_addrs.To(Dtype::Int64);
         active_keys = this->GetKeyBuffer().IndexGet({active_indices});
-        active_values = this->GetValueBuffer().IndexGet({active_indices});
+        active_value_inputs =
+                this->GatherValues(active_indices, active_values);
     }
 
     float avg_capacity_per_bucket =
@@ -274,7 +387,7 @@ void StdGPUHashmap<Key, Hash>::Rehash(int64_t buckets) {
         Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
         Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
 
-        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+        InsertImpl(active_keys.GetDataPtr(), active_value_inputs,
                    static_cast<addr_t*>(output_addrs.GetDataPtr()),
                    output_masks.GetDataPtr<bool>(), iterator_count);
     }
@@ -300,8 +413,7 @@ template <typename Key, typename Hash>
 __global__ void STDGPUInsertKernel(stdgpu::unordered_map<Key, addr_t, Hash> map,
                                    CUDAHashmapBufferAccessor buffer_accessor,
                                    const Key* input_keys,
-                                   const void* input_values,
-                                   int64_t dsize_value,
+                                   HashmapValueInputs input_values,
                                    addr_t* output_addrs,
                                    bool* output_masks,
                                    int64_t count) {
@@ -324,15 +436,9 @@ __global__ void STDGPUInsertKernel(stdgpu::unordered_map<Key, addr_t, Hash> map,
         // TODO: hack stdgpu inside and take out the buffer directly
         *static_cast<Key*>(dst_kv_iter.first) = key;
 
-        // Copy/reset non-templated value in buffer
-        uint8_t* dst_value = static_cast<uint8_t*>(dst_kv_iter.second);
-        if (input_values != nullptr) {
-            const uint8_t* src_value =
-                    static_cast<const uint8_t*>(input_values) +
-                    dsize_value * tid;
-            for (int byte = 0; byte < dsize_value; ++byte) {
-                dst_value[byte] = src_value[byte];
-            }
+        // Copy non-templated value in buffers
+        if (input_values.n_buffers > 0) {
+            buffer_accessor.CopyValues(dst_kv_addr, input_values, tid);
         }
 
         // Update from the dummy index
@@ -345,21 +451,36 @@ __global__ void STDGPUInsertKernel(stdgpu::unordered_map<Key, addr_t, Hash> map,
 }
 
 template <typename Key, typename Hash>
-void StdGPUHashmap<Key, Hash>::InsertImpl(const void* input_keys,
-                                          const void* input_values,
-                                          addr_t* output_addrs,
-                                          bool* output_masks,
-                                          int64_t count) {
+void StdGPUHashmap<Key, Hash>::InsertImpl(
+        const void* input_keys,
+        const HashmapValueInputs& input_values,
+        addr_t* output_addrs,
+        bool* output_masks,
+        int64_t count) {
     uint32_t threads = 128;
     uint32_t blocks = (count + threads - 1) / threads;
 
     STDGPUInsertKernel<<<blocks, threads>>>(impl_, buffer_accessor_,
                                             static_cast<const Key*>(input_keys),
-                                            input_values, this->dsize_value_,
-                                            output_addrs, output_masks, count);
+                                            input_values, output_addrs,
+                                            output_masks, count);
     OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
 }
 
+template <typename Key, typename Hash>
+void StdGPUHashmap<Key, Hash>::ReserveForInsertion(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        int64_t bucket_count = GetBucketCount();
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(bucket_count);
+        int64_t expected_buckets = std::max(
+                bucket_count * 2,
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+        Rehash(expected_buckets);
+    }
+}
+
 template <typename Key, typename Hash>
 void StdGPUHashmap<Key, Hash>::Allocate(int64_t capacity) {
     this->capacity_ = capacity;
@@ -367,12 +488,12 @@ void StdGPUHashmap<Key, Hash>::Allocate(int64_t capacity) {
     // Allocate buffer for key values.
     this->buffer_ =
             std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
-                                            this->dsize_value_, this->device_);
+                                            this->dsize_values_, this->device_);
 
     buffer_accessor_.HostAllocate(this->device_);
     buffer_accessor_.Setup(this->capacity_, this->dsize_key_,
-                           this->dsize_value_, this->buffer_->GetKeyBuffer(),
-                           this->buffer_->GetValueBuffer(),
+                           this->dsize_values_, this->buffer_->GetKeyBuffer(),
+                           this->buffer_->GetValueBuffers(),
                            this->buffer_->GetHeap());
     buffer_accessor_.Reset(this->device_);
 
@@ -27,6 +27,7 @@
 #include "open3d/core/hashmap/DeviceHashmap.h"
 
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
 
@@ -36,21 +37,21 @@ namespace core {
 std::shared_ptr<DeviceHashmap> CreateDeviceHashmap(
         int64_t init_capacity,
         const Dtype& dtype_key,
-        const Dtype& dtype_value,
+        const std::vector<Dtype>& dtypes_value,
         const SizeVector& element_shape_key,
-        const SizeVector& element_shape_value,
+        const std::vector<SizeVector>& element_shapes_value,
         const Device& device,
         const HashmapBackend& backend) {
     if (device.GetType() == Device::DeviceType::CPU) {
-        return CreateCPUHashmap(init_capacity, dtype_key, dtype_value,
-                                element_shape_key, element_shape_value, device,
-                                backend);
+        return CreateCPUHashmap(init_capacity, dtype_key, dtypes_value,
+                                element_shape_key, element_shapes_value,
+                                device, backend);
     }
 #if defined(BUILD_CUDA_MODULE)
     else if (device.GetType() == Device::DeviceType::CUDA) {
-        return CreateCUDAHashmap(init_capacity, dtype_key, dtype_value,
-                                 element_shape_key, element_shape_value, device,
-                                 backend);
+        return CreateCUDAHashmap(init_capacity, dtype_key, dtypes_value,
+                                 element_shape_key, element_shapes_value,
+                                 device, backend);
     }
 #endif
     else {
@@ -58,5 +59,30 @@ std::shared_ptr<DeviceHashmap> CreateDeviceHashmap(
     }
 }
 
+HashmapValueInputs DeviceHashmap::GatherValues(const Tensor& indices,
+                                               std::vector<Tensor>& values) {
+    HashmapValueInputs inputs;
+    inputs.n_buffers = static_cast<int64_t>(dsize_values_.size());
+    values.clear();
+    for (size_t j = 0; j < dsize_values_.size(); ++j) {
+        values.push_back(GetValueBuffer(j).IndexGet({indices}));
+        inputs.buffers[j].ptr = values[j].GetDataPtr<uint8_t>();
+        inputs.buffers[j].dsize = dsize_values_[j];
+    }
+    return inputs;
+}
+
+void RecordHashmapInsert(const Device& device, int64_t count) {
+    kernel::GetDeviceCounter("open3d_core_hashmap_inserted_keys_total", device,
+                             "Number of keys passed to hash map insertions.")
+            .Add(count);
+}
+
+void RecordHashmapRehash(const Device& device) {
+    kernel::GetDeviceCounter("open3d_core_hashmap_rehashes_total", device,
+                             "Number of hash map rehashes.")
+            .Add();
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <numeric>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
@@ -38,14 +40,19 @@ enum class HashmapBackend;
 
 class DeviceHashmap {
 public:
-    /// Comprehensive constructor for the developer.
+    /// Comprehensive constructor for the developer. \p dsize_values holds
+    /// the element byte size of each value buffer, and dsize_value_ their sum.
+    /// Input values reach the backends as one array per value buffer, see
+    /// HashmapValueInputs.
     DeviceHashmap(int64_t init_capacity,
                   int64_t dsize_key,
-                  int64_t dsize_value,
+                  const std::vector<int64_t>& dsize_values,
                   const Device& device)
         : capacity_(init_capacity),
           dsize_key_(dsize_key),
-          dsize_value_(dsize_value),
+          dsize_value_(std::accumulate(
+                  dsize_values.begin(), dsize_values.end(), int64_t(0))),
+          dsize_values_(dsize_values),
           device_(device) {}
     virtual ~DeviceHashmap() {}
 
@@ -59,7 +66,7 @@ public:
 
     /// Parallel insert contiguous arrays of keys and values.
     virtual void Insert(const void* input_keys,
-                        const void* input_values,
+                        const HashmapValueInputs& input_values,
                         addr_t* output_iterators,
                         bool* output_masks,
                         int64_t count) = 0;
@@ -72,6 +79,17 @@ public:
                           bool* output_masks,
                           int64_t count) = 0;
 
+    /// Parallel find-or-insert a contiguous array of keys in one pass.
+    /// Output iterators are valid for every key: they point to the
+    /// existing entry if the key was present, or to a newly allocated entry
+    /// otherwise. Output masks flag the newly inserted keys, whose values are
+    /// initialized from input_values, or zeroed if input_values is empty.
+    virtual void FindOrInsert(const void* input_keys,
+                              const HashmapValueInputs& input_values,
+                              addr_t* output_iterators,
+                              bool* output_masks,
+                              int64_t count) = 0;
+
     /// Parallel find a contiguous array of keys.
     virtual void Find(const void* input_keys,
                       addr_t* output_iterators,
@@ -86,6 +104,15 @@ public:
     /// Parallel collect all iterators in the hash table
     virtual int64_t GetActiveIndices(addr_t* output_indices) = 0;
 
+    /// Rebuild the index of an empty hash table over count entries that are
+    /// already stored in the buffers at input_addrs, with their keys gathered
+    /// in input_keys. Neither the buffers nor the heap are modified apart from
+    /// the heap counter, so the caller must have moved input_addrs to the
+    /// bottom of the heap beforehand.
+    virtual void Restore(const void* input_keys,
+                         const addr_t* input_addrs,
+                         int64_t count) = 0;
+
     /// Clear stored map without reallocating memory.
     virtual void Clear() = 0;
 
@@ -96,10 +123,22 @@ public:
     int64_t GetCapacity() const { return capacity_; }
     int64_t GetKeyBytesize() const { return dsize_key_; }
     int64_t GetValueBytesize() const { return dsize_value_; }
+    const std::vector<int64_t>& GetValueBytesizes() const {
+        return dsize_values_;
+    }
     Device GetDevice() const { return device_; }
 
     Tensor& GetKeyBuffer() { return buffer_->GetKeyBuffer(); }
-    Tensor& GetValueBuffer() { return buffer_->GetValueBuffer(); }
+    Tensor& GetValueBuffer(size_t i = 0) { return buffer_->GetValueBuffer(i); }
+    std::vector<Tensor>& GetValueBuffers() {
+        return buffer_->GetValueBuffers();
+    }
+
+    /// Gathers the values of the entries at \p indices into one tensor per
+    /// value buffer in \p values, and returns them as input values for Insert.
+    /// Used to re-insert the active entries on rehashing.
+    HashmapValueInputs GatherValues(const Tensor& indices,
+                                    std::vector<Tensor>& values);
 
     /// Return number of elems per bucket.
     /// High performance not required, so directly returns a vector.
@@ -109,6 +148,7 @@ public:
     int64_t capacity_;
     int64_t dsize_key_;
     int64_t dsize_value_;
+    std::vector<int64_t> dsize_values_;
 
     Device device_;
 
@@ -122,29 +162,37 @@ public:
 std::shared_ptr<DeviceHashmap> CreateDeviceHashmap(
         int64_t init_capacity,
         const Dtype& dtype_key,
-        const Dtype& dtype_value,
+        const std::vector<Dtype>& dtypes_value,
         const SizeVector& element_shape_key,
-        const SizeVector& element_shape_value,
+        const std::vector<SizeVector>& element_shapes_value,
         const Device& device,
         const HashmapBackend& backend);
 
 std::shared_ptr<DeviceHashmap> CreateCPUHashmap(
         int64_t init_capacity,
         const Dtype& dtype_key,
-        const Dtype& dtype_value,
+        const std::vector<Dtype>& dtypes_value,
         const SizeVector& element_shape_key,
-        const SizeVector& element_shape_value,
+        const std::vector<SizeVector>& element_shapes_value,
         const Device& device,
         const HashmapBackend& backend);
 
 std::shared_ptr<DeviceHashmap> CreateCUDAHashmap(
         int64_t init_capacity,
         const Dtype& dtype_key,
-        const Dtype& dtype_value,
+        const std::vector<Dtype>& dtypes_value,
         const SizeVector& element_shape_key,
-        const SizeVector& element_shape_value,
+        const std::vector<SizeVector>& element_shapes_value,
         const Device& device,
         const HashmapBackend& backend);
 
+/// Counts \p count keys passed to an insertion on \p device, see
+/// utility::Metrics.
+void RecordHashmapInsert(const Device& device, int64_t count);
+
+/// Counts a rehash on \p device, see utility::Metrics. Called by the
+/// backends, since they also rehash on their own when they run full.
+void RecordHashmapRehash(const Device& device);
+
 }  // namespace core
 }  // namespace open3d
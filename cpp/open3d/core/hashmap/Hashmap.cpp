@@ -26,6 +26,10 @@
 
 #include "open3d/core/hashmap/Hashmap.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/DeviceHashmap.h"
 #include "open3d/utility/Console.h"
@@ -34,6 +38,83 @@
 namespace open3d {
 namespace core {
 
+/// Binary layout written by Hashmap::Save:
+/// - magic "O3DHMAP\0" and format version (uint32)
+/// - key dtype and element shape
+/// - number of value buffers M (int64), then the dtype and element shape of
+///   each value buffer
+/// - M value buffer names, each as its length (int64) and characters, empty
+///   if the buffers are not named
+/// - capacity and number of active entries N (int64)
+/// - N addresses (uint32), N keys, then N values of each value buffer, in the
+///   same order
+/// Version 1 files have no M field and a single value buffer, version 2 files
+/// have no names.
+static const char kHashmapFileMagic[8] = "O3DHMAP";
+static constexpr uint32_t kHashmapFileVersion = 3;
+static constexpr size_t kDtypeNameLength = 16;
+
+static void WriteBytes(FILE* fp,
+                       const void* data,
+                       size_t num_bytes,
+                       const std::string& file_name) {
+    if (num_bytes > 0 && fwrite(data, 1, num_bytes, fp) != num_bytes) {
+        fclose(fp);
+        utility::LogError("[Hashmap] Failed to write file {}.", file_name);
+    }
+}
+
+static void ReadBytes(FILE* fp,
+                      void* data,
+                      size_t num_bytes,
+                      const std::string& file_name) {
+    if (num_bytes > 0 && fread(data, 1, num_bytes, fp) != num_bytes) {
+        fclose(fp);
+        utility::LogError("[Hashmap] File {} is truncated.", file_name);
+    }
+}
+
+static void WriteDtypeAndShape(FILE* fp,
+                               const Dtype& dtype,
+                               const SizeVector& element_shape,
+                               const std::string& file_name) {
+    int32_t code = static_cast<int32_t>(dtype.GetDtypeCode());
+    int64_t byte_size = dtype.ByteSize();
+    char name[kDtypeNameLength] = {0};
+    std::strncpy(name, dtype.ToString().c_str(), kDtypeNameLength - 1);
+    WriteBytes(fp, &code, sizeof(code), file_name);
+    WriteBytes(fp, &byte_size, sizeof(byte_size), file_name);
+    WriteBytes(fp, name, kDtypeNameLength, file_name);
+
+    int64_t ndims = element_shape.size();
+    WriteBytes(fp, &ndims, sizeof(ndims), file_name);
+    WriteBytes(fp, element_shape.data(), ndims * sizeof(int64_t), file_name);
+}
+
+static std::pair<Dtype, SizeVector> ReadDtypeAndShape(
+        FILE* fp, const std::string& file_name) {
+    int32_t code;
+    int64_t byte_size;
+    char name[kDtypeNameLength];
+    ReadBytes(fp, &code, sizeof(code), file_name);
+    ReadBytes(fp, &byte_size, sizeof(byte_size), file_name);
+    ReadBytes(fp, name, kDtypeNameLength, file_name);
+    name[kDtypeNameLength - 1] = '\0';
+
+    int64_t ndims;
+    ReadBytes(fp, &ndims, sizeof(ndims), file_name);
+    if (ndims < 0 || ndims > 64) {
+        fclose(fp);
+        utility::LogError("[Hashmap] File {} is corrupted.", file_name);
+    }
+    SizeVector element_shape(ndims);
+    ReadBytes(fp, element_shape.data(), ndims * sizeof(int64_t), file_name);
+
+    return std::make_pair(
+            Dtype(static_cast<Dtype::DtypeCode>(code), byte_size, name),
+            element_shape);
+}
+
 Hashmap::Hashmap(int64_t init_capacity,
                  const Dtype& dtype_key,
                  const Dtype& dtype_value,
@@ -41,26 +122,80 @@ Hashmap::Hashmap(int64_t init_capacity,
                  const SizeVector& element_shape_value,
                  const Device& device,
                  const HashmapBackend& backend)
+    : Hashmap(init_capacity,
+              dtype_key,
+              std::vector<Dtype>{dtype_value},
+              element_shape_key,
+              std::vector<SizeVector>{element_shape_value},
+              device,
+              backend) {}
+
+Hashmap::Hashmap(int64_t init_capacity,
+                 const Dtype& dtype_key,
+                 const std::vector<Dtype>& dtypes_value,
+                 const SizeVector& element_shape_key,
+                 const std::vector<SizeVector>& element_shapes_value,
+                 const Device& device,
+                 const HashmapBackend& backend,
+                 const std::vector<std::string>& value_names)
     : dtype_key_(dtype_key),
-      dtype_value_(dtype_value),
+      dtypes_value_(dtypes_value),
       element_shape_key_(element_shape_key),
-      element_shape_value_(element_shape_value) {
-    if (dtype_key_.GetDtypeCode() == Dtype::DtypeCode::Undefined ||
-        dtype_value_.GetDtypeCode() == Dtype::DtypeCode::Undefined) {
+      element_shapes_value_(element_shapes_value),
+      value_names_(value_names) {
+    if (dtypes_value_.empty() ||
+        dtypes_value_.size() > size_t(kMaxValueBuffers) ||
+        dtypes_value_.size() != element_shapes_value_.size()) {
+        utility::LogError(
+                "[Hashmap] Expected 1 to {} value buffers with one dtype and "
+                "one element shape each, but got {} dtypes and {} shapes.",
+                kMaxValueBuffers, dtypes_value_.size(),
+                element_shapes_value_.size());
+    }
+    if (dtype_key_.GetDtypeCode() == Dtype::DtypeCode::Undefined) {
         utility::LogError(
                 "[Hashmap] DtypeCore::Undefined is not supported for input "
                 "key/value.");
     }
-    if (element_shape_key_.NumElements() == 0 ||
-        element_shape_value_.NumElements() == 0) {
+    if (element_shape_key_.NumElements() == 0) {
         utility::LogError(
                 "[Hashmap] element shape 0 is not supported for input "
                 "key/value.");
     }
+    for (size_t i = 0; i < dtypes_value_.size(); ++i) {
+        if (dtypes_value_[i].GetDtypeCode() == Dtype::DtypeCode::Undefined) {
+            utility::LogError(
+                    "[Hashmap] DtypeCore::Undefined is not supported for "
+                    "input key/value.");
+        }
+        if (element_shapes_value_[i].NumElements() == 0) {
+            utility::LogError(
+                    "[Hashmap] element shape 0 is not supported for input "
+                    "key/value.");
+        }
+    }
 
-    device_hashmap_ = CreateDeviceHashmap(init_capacity, dtype_key, dtype_value,
-                                          element_shape_key,
-                                          element_shape_value, device, backend);
+    if (!value_names_.empty()) {
+        if (value_names_.size() != dtypes_value_.size()) {
+            utility::LogError(
+                    "[Hashmap] Expected {} value buffer names, but got {}.",
+                    dtypes_value_.size(), value_names_.size());
+        }
+        for (size_t i = 0; i < value_names_.size(); ++i) {
+            if (value_names_[i].empty() ||
+                std::count(value_names_.begin(), value_names_.end(),
+                           value_names_[i]) > 1) {
+                utility::LogError(
+                        "[Hashmap] Value buffer names must be non-empty and "
+                        "unique, but got \"{}\".",
+                        value_names_[i]);
+            }
+        }
+    }
+
+    device_hashmap_ = CreateDeviceHashmap(
+            init_capacity, dtype_key, dtypes_value, element_shape_key,
+            element_shapes_value, device, backend);
 }
 
 void Hashmap::Rehash(int64_t buckets) {
@@ -71,14 +206,18 @@ void Hashmap::Insert(const Tensor& input_keys,
                      const Tensor& input_values,
                      Tensor& output_addrs,
                      Tensor& output_masks) {
+    Insert(input_keys, std::vector<Tensor>{input_values}, output_addrs,
+           output_masks);
+}
+
+void Hashmap::Insert(const Tensor& input_keys,
+                     const std::vector<Tensor>& input_values,
+                     Tensor& output_addrs,
+                     Tensor& output_masks) {
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
 
-    SizeVector input_value_elem_shape(input_values.GetShape());
-    input_value_elem_shape.erase(input_value_elem_shape.begin());
-    AssertValueDtype(input_values.GetDtype(), input_value_elem_shape);
-
     SizeVector shape = input_keys.GetShape();
     if (shape.size() == 0 || shape[0] == 0) {
         utility::LogError("[Hashmap]: Invalid key tensor shape");
@@ -89,21 +228,16 @@ void Hashmap::Insert(const Tensor& input_keys,
                 GetDevice().ToString(), input_keys.GetDevice().ToString());
     }
 
-    SizeVector value_shape = input_values.GetShape();
-    if (value_shape.size() == 0 || value_shape[0] != shape[0]) {
-        utility::LogError("[Hashmap]: Invalid value tensor shape");
-    }
-    if (input_values.GetDevice() != GetDevice()) {
-        utility::LogError(
-                "[Hashmap]: Incompatible value device, expected {}, but got {}",
-                GetDevice().ToString(), input_values.GetDevice().ToString());
-    }
-
     int64_t count = shape[0];
+    std::vector<Tensor> contiguous_values;
+    HashmapValueInputs value_inputs =
+            GetValueInputs(input_values, count, contiguous_values);
+
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
+    RecordHashmapInsert(GetDevice(), count);
 
-    device_hashmap_->Insert(input_keys.GetDataPtr(), input_values.GetDataPtr(),
+    device_hashmap_->Insert(input_keys.GetDataPtr(), value_inputs,
                             static_cast<addr_t*>(output_addrs.GetDataPtr()),
                             output_masks.GetDataPtr<bool>(), count);
 }
@@ -129,12 +263,83 @@ void Hashmap::Activate(const Tensor& input_keys,
 
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
+    RecordHashmapInsert(GetDevice(), count);
 
     device_hashmap_->Activate(input_keys.GetDataPtr(),
                               static_cast<addr_t*>(output_addrs.GetDataPtr()),
                               output_masks.GetDataPtr<bool>(), count);
 }
 
+void Hashmap::FindOrInsert(const Tensor& input_keys,
+                           Tensor& output_addrs,
+                           Tensor& output_masks) {
+    SizeVector input_key_elem_shape(input_keys.GetShape());
+    input_key_elem_shape.erase(input_key_elem_shape.begin());
+    AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
+
+    SizeVector shape = input_keys.GetShape();
+    if (shape.size() == 0 || shape[0] == 0) {
+        utility::LogError("[Hashmap]: Invalid key tensor shape");
+    }
+    if (input_keys.GetDevice() != GetDevice()) {
+        utility::LogError(
+                "[Hashmap]: Incompatible device, expected {}, but got {}",
+                GetDevice().ToString(), input_keys.GetDevice().ToString());
+    }
+
+    int64_t count = shape[0];
+
+    output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
+    output_masks = Tensor({count}, Dtype::Bool, GetDevice());
+    RecordHashmapInsert(GetDevice(), count);
+
+    device_hashmap_->FindOrInsert(
+            input_keys.GetDataPtr(), HashmapValueInputs(),
+            static_cast<addr_t*>(output_addrs.GetDataPtr()),
+            output_masks.GetDataPtr<bool>(), count);
+}
+
+void Hashmap::FindOrInsert(const Tensor& input_keys,
+                           const Tensor& input_values,
+                           Tensor& output_addrs,
+                           Tensor& output_masks) {
+    FindOrInsert(input_keys, std::vector<Tensor>{input_values}, output_addrs,
+                 output_masks);
+}
+
+void Hashmap::FindOrInsert(const Tensor& input_keys,
+                           const std::vector<Tensor>& input_values,
+                           Tensor& output_addrs,
+                           Tensor& output_masks) {
+    SizeVector input_key_elem_shape(input_keys.GetShape());
+    input_key_elem_shape.erase(input_key_elem_shape.begin());
+    AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
+
+    SizeVector shape = input_keys.GetShape();
+    if (shape.size() == 0 || shape[0] == 0) {
+        utility::LogError("[Hashmap]: Invalid key tensor shape");
+    }
+    if (input_keys.GetDevice() != GetDevice()) {
+        utility::LogError(
+                "[Hashmap]: Incompatible key device, expected {}, but got {}",
+                GetDevice().ToString(), input_keys.GetDevice().ToString());
+    }
+
+    int64_t count = shape[0];
+    std::vector<Tensor> contiguous_values;
+    HashmapValueInputs value_inputs =
+            GetValueInputs(input_values, count, contiguous_values);
+
+    output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
+    output_masks = Tensor({count}, Dtype::Bool, GetDevice());
+    RecordHashmapInsert(GetDevice(), count);
+
+    device_hashmap_->FindOrInsert(
+            input_keys.GetDataPtr(), value_inputs,
+            static_cast<addr_t*>(output_addrs.GetDataPtr()),
+            output_masks.GetDataPtr<bool>(), count);
+}
+
 void Hashmap::Find(const Tensor& input_keys,
                    Tensor& output_addrs,
                    Tensor& output_masks) {
@@ -201,23 +406,238 @@ Hashmap Hashmap::To(const Device& device, bool copy) const {
         return *this;
     }
 
-    Hashmap new_hashmap(GetCapacity(), dtype_key_, dtype_value_,
-                        element_shape_key_, element_shape_value_, device);
-
-    Tensor keys = GetKeyTensor().To(device, /*copy=*/true);
-    Tensor values = GetValueTensor().To(device, /*copy=*/true);
+    Hashmap new_hashmap(GetCapacity(), dtype_key_, dtypes_value_,
+                        element_shape_key_, element_shapes_value_, device,
+                        HashmapBackend::Default, value_names_);
+
+    MemoryManager::Memcpy(new_hashmap.GetKeyBuffer().GetDataPtr(), device,
+                          GetKeyBuffer().GetDataPtr(), GetDevice(),
+                          GetCapacity() * GetKeyBytesize());
+    std::vector<int64_t> dsize_values = GetValueBytesizes();
+    for (size_t i = 0; i < dsize_values.size(); ++i) {
+        MemoryManager::Memcpy(new_hashmap.GetValueBuffer(i).GetDataPtr(),
+                              device, GetValueBuffer(i).GetDataPtr(),
+                              GetDevice(), GetCapacity() * dsize_values[i]);
+    }
 
-    core::Tensor active_addrs;
+    Tensor active_addrs;
     GetActiveIndices(active_addrs);
-    core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+    active_addrs = active_addrs.To(device);
 
-    core::Tensor addrs, masks;
-    new_hashmap.Insert(keys.IndexGet({active_indices}),
-                       values.IndexGet({active_indices}), addrs, masks);
+    Tensor active_keys;
+    if (active_addrs.GetLength() > 0) {
+        active_keys = new_hashmap.GetKeyTensor().IndexGet(
+                {active_addrs.To(Dtype::Int64)});
+    }
+    new_hashmap.RestoreIndex(active_keys, active_addrs);
 
     return new_hashmap;
 }
 
+void Hashmap::Save(const std::string& file_name) const {
+    Device host("CPU:0");
+
+    Tensor active_addrs;
+    GetActiveIndices(active_addrs);
+    int64_t count = active_addrs.GetLength();
+
+    int64_t value_buffer_count = GetValueBufferCount();
+    Tensor active_keys;
+    std::vector<Tensor> active_values(value_buffer_count);
+    if (count > 0) {
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        active_keys = GetKeyTensor().IndexGet({active_indices}).To(host);
+        for (int64_t i = 0; i < value_buffer_count; ++i) {
+            active_values[i] =
+                    GetValueTensor(i).IndexGet({active_indices}).To(host);
+        }
+        active_addrs = active_addrs.To(host);
+    }
+
+    FILE* fp = fopen(file_name.c_str(), "wb");
+    if (!fp) {
+        utility::LogError("[Hashmap] Unable to open file {}.", file_name);
+    }
+
+    int64_t capacity = GetCapacity();
+    WriteBytes(fp, kHashmapFileMagic, sizeof(kHashmapFileMagic), file_name);
+    WriteBytes(fp, &kHashmapFileVersion, sizeof(kHashmapFileVersion),
+               file_name);
+    WriteDtypeAndShape(fp, dtype_key_, element_shape_key_, file_name);
+    WriteBytes(fp, &value_buffer_count, sizeof(value_buffer_count),
+               file_name);
+    for (int64_t i = 0; i < value_buffer_count; ++i) {
+        WriteDtypeAndShape(fp, dtypes_value_[i], element_shapes_value_[i],
+                           file_name);
+    }
+    for (int64_t i = 0; i < value_buffer_count; ++i) {
+        std::string name = value_names_.empty() ? "" : value_names_[i];
+        int64_t name_length = name.size();
+        WriteBytes(fp, &name_length, sizeof(name_length), file_name);
+        WriteBytes(fp, name.data(), name_length, file_name);
+    }
+    WriteBytes(fp, &capacity, sizeof(capacity), file_name);
+    WriteBytes(fp, &count, sizeof(count), file_name);
+
+    if (count > 0) {
+        WriteBytes(fp, active_addrs.GetDataPtr(), count * sizeof(addr_t),
+                   file_name);
+        WriteBytes(fp, active_keys.GetDataPtr(), count * GetKeyBytesize(),
+                   file_name);
+        std::vector<int64_t> dsize_values = GetValueBytesizes();
+        for (int64_t i = 0; i < value_buffer_count; ++i) {
+            WriteBytes(fp, active_values[i].GetDataPtr(),
+                       count * dsize_values[i], file_name);
+        }
+    }
+
+    if (fclose(fp) != 0) {
+        utility::LogError("[Hashmap] Failed to write file {}.", file_name);
+    }
+}
+
+Hashmap Hashmap::Load(const std::string& file_name,
+                      const Device& device,
+                      const HashmapBackend& backend) {
+    Device host("CPU:0");
+
+    FILE* fp = fopen(file_name.c_str(), "rb");
+    if (!fp) {
+        utility::LogError("[Hashmap] Unable to open file {}.", file_name);
+    }
+
+    char magic[sizeof(kHashmapFileMagic)];
+    uint32_t version;
+    ReadBytes(fp, magic, sizeof(magic), file_name);
+    ReadBytes(fp, &version, sizeof(version), file_name);
+    if (std::memcmp(magic, kHashmapFileMagic, sizeof(magic)) != 0 ||
+        version < 1 || version > kHashmapFileVersion) {
+        fclose(fp);
+        utility::LogError(
+                "[Hashmap] {} is not a hashmap file of version 1 to {}.",
+                file_name, kHashmapFileVersion);
+    }
+
+    Dtype dtype_key;
+    SizeVector element_shape_key;
+    std::tie(dtype_key, element_shape_key) = ReadDtypeAndShape(fp, file_name);
+
+    int64_t value_buffer_count = 1;
+    if (version >= 2) {
+        ReadBytes(fp, &value_buffer_count, sizeof(value_buffer_count),
+                  file_name);
+        if (value_buffer_count < 1 || value_buffer_count > kMaxValueBuffers) {
+            fclose(fp);
+            utility::LogError("[Hashmap] File {} is corrupted.", file_name);
+        }
+    }
+    std::vector<Dtype> dtypes_value(value_buffer_count);
+    std::vector<SizeVector> element_shapes_value(value_buffer_count);
+    for (int64_t i = 0; i < value_buffer_count; ++i) {
+        std::tie(dtypes_value[i], element_shapes_value[i]) =
+                ReadDtypeAndShape(fp, file_name);
+    }
+    std::vector<std::string> value_names;
+    if (version >= 3) {
+        for (int64_t i = 0; i < value_buffer_count; ++i) {
+            int64_t name_length;
+            ReadBytes(fp, &name_length, sizeof(name_length), file_name);
+            if (name_length < 0 || name_length > 1024) {
+                fclose(fp);
+                utility::LogError("[Hashmap] File {} is corrupted.",
+                                  file_name);
+            }
+            std::string name(name_length, '\0');
+            ReadBytes(fp, &name[0], name_length, file_name);
+            value_names.push_back(name);
+        }
+        // Unnamed buffers are saved with empty names.
+        if (value_names[0].empty()) {
+            value_names.clear();
+        }
+    }
+
+    int64_t capacity, count;
+    ReadBytes(fp, &capacity, sizeof(capacity), file_name);
+    ReadBytes(fp, &count, sizeof(count), file_name);
+    if (capacity <= 0 || count < 0 || count > capacity) {
+        fclose(fp);
+        utility::LogError("[Hashmap] File {} is corrupted.", file_name);
+    }
+
+    SizeVector key_shape = element_shape_key;
+    key_shape.insert(key_shape.begin(), count);
+
+    Tensor active_addrs({count}, Dtype::Int32, host);
+    Tensor active_keys(key_shape, dtype_key, host);
+    ReadBytes(fp, active_addrs.GetDataPtr(), count * sizeof(addr_t),
+              file_name);
+    ReadBytes(fp, active_keys.GetDataPtr(),
+              count * dtype_key.ByteSize() * element_shape_key.NumElements(),
+              file_name);
+    std::vector<Tensor> active_values;
+    for (int64_t i = 0; i < value_buffer_count; ++i) {
+        SizeVector value_shape = element_shapes_value[i];
+        value_shape.insert(value_shape.begin(), count);
+        active_values.emplace_back(value_shape, dtypes_value[i], host);
+        ReadBytes(fp, active_values[i].GetDataPtr(),
+                  count * dtypes_value[i].ByteSize() *
+                          element_shapes_value[i].NumElements(),
+                  file_name);
+    }
+    fclose(fp);
+
+    const addr_t* addrs_ptr =
+            static_cast<const addr_t*>(active_addrs.GetDataPtr());
+    for (int64_t i = 0; i < count; ++i) {
+        if (addrs_ptr[i] >= capacity) {
+            utility::LogError("[Hashmap] File {} is corrupted.", file_name);
+        }
+    }
+
+    Hashmap hashmap(capacity, dtype_key, dtypes_value, element_shape_key,
+                    element_shapes_value, device, backend, value_names);
+    active_addrs = active_addrs.To(device);
+    active_keys = active_keys.To(device);
+    if (count > 0) {
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        hashmap.GetKeyTensor().IndexSet({active_indices}, active_keys);
+        for (int64_t i = 0; i < value_buffer_count; ++i) {
+            hashmap.GetValueTensor(i).IndexSet({active_indices},
+                                               active_values[i].To(device));
+        }
+    }
+    hashmap.RestoreIndex(active_keys, active_addrs);
+
+    return hashmap;
+}
+
+void Hashmap::RestoreIndex(const Tensor& active_keys,
+                           const Tensor& active_addrs) {
+    int64_t count = active_addrs.GetLength();
+    int64_t capacity = GetCapacity();
+    if (count > 0) {
+        // Active addresses go to the bottom of the heap, followed by the free
+        // ones.
+        Tensor free_mask = Tensor::Ones({capacity}, Dtype::UInt8, GetDevice());
+        free_mask.IndexSet({active_addrs.To(Dtype::Int64)},
+                           Tensor::Zeros({count}, Dtype::UInt8, GetDevice()));
+
+        Tensor& heap = device_hashmap_->buffer_->GetHeap();
+        heap.Slice(0, 0, count) = active_addrs;
+        if (count < capacity) {
+            heap.Slice(0, count, capacity) =
+                    free_mask.NonZero()[0].To(Dtype::Int32);
+        }
+    }
+
+    device_hashmap_->Restore(count > 0 ? active_keys.GetDataPtr() : nullptr,
+                             count > 0 ? static_cast<const addr_t*>(
+                                                 active_addrs.GetDataPtr())
+                                       : nullptr,
+                             count);
+}
+
 Hashmap Hashmap::CPU() const { return To(Device("CPU:0"), /*copy=*/false); }
 
 Hashmap Hashmap::CUDA(int device_id) const {
@@ -240,12 +660,30 @@ int64_t Hashmap::GetKeyBytesize() const {
 int64_t Hashmap::GetValueBytesize() const {
     return device_hashmap_->GetValueBytesize();
 }
+std::vector<int64_t> Hashmap::GetValueBytesizes() const {
+    return device_hashmap_->GetValueBytesizes();
+}
+int64_t Hashmap::GetValueBufferCount() const {
+    return static_cast<int64_t>(dtypes_value_.size());
+}
 
 Tensor& Hashmap::GetKeyBuffer() const {
     return device_hashmap_->GetKeyBuffer();
 }
-Tensor& Hashmap::GetValueBuffer() const {
-    return device_hashmap_->GetValueBuffer();
+Tensor& Hashmap::GetValueBuffer(size_t i) const {
+    return device_hashmap_->GetValueBuffer(i);
+}
+Tensor& Hashmap::GetValueBuffer(const std::string& name) const {
+    return GetValueBuffer(GetValueBufferIndex(name));
+}
+
+size_t Hashmap::GetValueBufferIndex(const std::string& name) const {
+    auto it = std::find(value_names_.begin(), value_names_.end(), name);
+    if (it == value_names_.end()) {
+        utility::LogError("[Hashmap] No value buffer is called \"{}\".",
+                          name);
+    }
+    return static_cast<size_t>(it - value_names_.begin());
 }
 
 Tensor Hashmap::GetKeyTensor() const {
@@ -257,13 +695,16 @@ Tensor Hashmap::GetKeyTensor() const {
                   GetKeyBuffer().GetBlob());
 }
 
-Tensor Hashmap::GetValueTensor() const {
+Tensor Hashmap::GetValueTensor(size_t i) const {
     int64_t capacity = GetCapacity();
-    SizeVector value_shape = element_shape_value_;
+    SizeVector value_shape = element_shapes_value_.at(i);
     value_shape.insert(value_shape.begin(), capacity);
     return Tensor(value_shape, shape_util::DefaultStrides(value_shape),
-                  GetValueBuffer().GetDataPtr(), dtype_value_,
-                  GetValueBuffer().GetBlob());
+                  GetValueBuffer(i).GetDataPtr(), dtypes_value_[i],
+                  GetValueBuffer(i).GetBlob());
+}
+Tensor Hashmap::GetValueTensor(const std::string& name) const {
+    return GetValueTensor(GetValueBufferIndex(name));
 }
 
 /// Return number of elems per bucket.
@@ -290,11 +731,12 @@ void Hashmap::AssertKeyDtype(const Dtype& dtype_key,
 }
 
 void Hashmap::AssertValueDtype(const Dtype& dtype_value,
-                               const SizeVector& element_shape_value) const {
+                               const SizeVector& element_shape_value,
+                               size_t i) const {
     int64_t elem_byte_size =
             dtype_value.ByteSize() * element_shape_value.NumElements();
-    int64_t stored_elem_byte_size =
-            dtype_value_.ByteSize() * element_shape_value_.NumElements();
+    int64_t stored_elem_byte_size = dtypes_value_.at(i).ByteSize() *
+                                    element_shapes_value_.at(i).NumElements();
     if (elem_byte_size != stored_elem_byte_size) {
         utility::LogError(
                 "[Hashmap] Inconsistent element-wise value byte size, expected "
@@ -302,5 +744,45 @@ void Hashmap::AssertValueDtype(const Dtype& dtype_value,
                 stored_elem_byte_size, elem_byte_size);
     }
 }
+
+HashmapValueInputs Hashmap::GetValueInputs(
+        const std::vector<Tensor>& input_values,
+        int64_t count,
+        std::vector<Tensor>& contiguous_values) const {
+    if (input_values.size() != dtypes_value_.size()) {
+        utility::LogError(
+                "[Hashmap]: Expected {} value tensors, one per value buffer, "
+                "but got {}",
+                dtypes_value_.size(), input_values.size());
+    }
+
+    std::vector<int64_t> dsize_values = GetValueBytesizes();
+    HashmapValueInputs value_inputs;
+    value_inputs.n_buffers = static_cast<int64_t>(input_values.size());
+    contiguous_values.clear();
+    for (size_t i = 0; i < input_values.size(); ++i) {
+        SizeVector input_value_elem_shape(input_values[i].GetShape());
+        if (input_value_elem_shape.size() == 0 ||
+            input_value_elem_shape[0] != count) {
+            utility::LogError("[Hashmap]: Invalid value tensor shape");
+        }
+        input_value_elem_shape.erase(input_value_elem_shape.begin());
+        AssertValueDtype(input_values[i].GetDtype(), input_value_elem_shape, i);
+
+        if (input_values[i].GetDevice() != GetDevice()) {
+            utility::LogError(
+                    "[Hashmap]: Incompatible value device, expected {}, but "
+                    "got {}",
+                    GetDevice().ToString(),
+                    input_values[i].GetDevice().ToString());
+        }
+
+        contiguous_values.push_back(input_values[i].Contiguous());
+        value_inputs.buffers[i].ptr =
+                static_cast<const uint8_t*>(contiguous_values[i].GetDataPtr());
+        value_inputs.buffers[i].dsize = dsize_values[i];
+    }
+    return value_inputs;
+}
 }  // namespace core
 }  // namespace open3d
@@ -35,7 +35,10 @@ namespace core {
 
 class DeviceHashmap;
 
-enum class HashmapBackend { Slab, StdGPU, TBB, Default };
+/// Hashmap implementations. Default resolves to StdGPU on CUDA and TBB on CPU.
+/// LinearProbing is a lock-free open addressing table on CPU, suited for dense
+/// integer keys such as voxel coordinates.
+enum class HashmapBackend { Slab, StdGPU, TBB, LinearProbing, Default };
 
 class Hashmap {
 public:
@@ -52,6 +55,25 @@ public:
             const Device& device,
             const HashmapBackend& backend = HashmapBackend::Default);
 
+    /// Constructor for multiple value buffers (struct-of-arrays). Each value
+    /// buffer i stores elements of dtypes_value[i] and element_shapes_value[i]
+    /// in a separate array. Buffers are addressed by their index in
+    /// construction order, e.g. in GetValueTensor(i), or by their name if
+    /// value_names is given.
+    /// Example:
+    /// Voxel block with TSDF, weight and color in separate buffers:
+    /// - dtypes_value = {Dtype::Float32, Dtype::UInt16, Dtype::UInt16}
+    /// - element_shapes_value = {{8, 8, 8}, {8, 8, 8}, {8, 8, 8, 3}}
+    /// - value_names = {"tsdf", "weight", "color"}
+    Hashmap(int64_t init_capacity,
+            const Dtype& dtype_key,
+            const std::vector<Dtype>& dtypes_value,
+            const SizeVector& element_shape_key,
+            const std::vector<SizeVector>& element_shapes_value,
+            const Device& device,
+            const HashmapBackend& backend = HashmapBackend::Default,
+            const std::vector<std::string>& value_names = {});
+
     ~Hashmap(){};
 
     /// Rehash expects extra memory space at runtime, since it consists of
@@ -71,6 +93,13 @@ public:
                 Tensor& output_addrs,
                 Tensor& output_masks);
 
+    /// Same as above for a hashmap with multiple value buffers, with one value
+    /// tensor per buffer.
+    void Insert(const Tensor& input_keys,
+                const std::vector<Tensor>& input_values,
+                Tensor& output_addrs,
+                Tensor& output_masks);
+
     /// Parallel activate arrays of keys in Tensor.
     /// Specifically useful for large value elements (e.g., a tensor), where we
     /// can do in-place management after activation.
@@ -82,6 +111,29 @@ public:
                   Tensor& output_addrs,
                   Tensor& output_masks);
 
+    /// Parallel find-or-insert an array of keys in Tensor in a single pass.
+    /// Equivalent to Activate followed by Find, at the cost of one of them.
+    /// Return addrs: internal indices that can be directly used for advanced
+    /// indexing in Tensor key/value buffers, valid for all the input keys.
+    /// masks: newly inserted keys, whose values are zero-initialized.
+    void FindOrInsert(const Tensor& input_keys,
+                      Tensor& output_addrs,
+                      Tensor& output_masks);
+
+    /// Same as above, but the values of newly inserted keys are initialized
+    /// from the corresponding placeholders in input_values.
+    void FindOrInsert(const Tensor& input_keys,
+                      const Tensor& input_values,
+                      Tensor& output_addrs,
+                      Tensor& output_masks);
+
+    /// Same as above for a hashmap with multiple value buffers, with one value
+    /// tensor per buffer.
+    void FindOrInsert(const Tensor& input_keys,
+                      const std::vector<Tensor>& input_values,
+                      Tensor& output_addrs,
+                      Tensor& output_masks);
+
     /// Parallel find an array of keys in Tensor.
     /// Return addrs: internal indices that can be directly used for advanced
     /// indexing in Tensor key/value buffers.
@@ -106,6 +158,10 @@ public:
     void Clear();
 
     Hashmap Clone() const;
+
+    /// Transfer the hashmap to device. The key and value buffers are copied
+    /// as a whole, so addresses of the active entries are preserved and only
+    /// the index is rebuilt over them, without re-inserting the entries.
     Hashmap To(const Device& device, bool copy = false) const;
     Hashmap CPU() const;
     Hashmap CUDA(int device_id = 0) const;
@@ -116,13 +172,26 @@ public:
     int64_t GetBucketCount() const;
     Device GetDevice() const;
     int64_t GetKeyBytesize() const;
+    /// Element byte size summed over all the value buffers.
     int64_t GetValueBytesize() const;
+    /// Element byte size of each value buffer.
+    std::vector<int64_t> GetValueBytesizes() const;
+    int64_t GetValueBufferCount() const;
+
+    /// Names of the value buffers, empty if they were not named.
+    const std::vector<std::string>& GetValueNames() const {
+        return value_names_;
+    }
+    /// Index of the value buffer called \p name.
+    size_t GetValueBufferIndex(const std::string& name) const;
 
     Tensor& GetKeyBuffer() const;
-    Tensor& GetValueBuffer() const;
+    Tensor& GetValueBuffer(size_t i = 0) const;
+    Tensor& GetValueBuffer(const std::string& name) const;
 
     Tensor GetKeyTensor() const;
-    Tensor GetValueTensor() const;
+    Tensor GetValueTensor(size_t i = 0) const;
+    Tensor GetValueTensor(const std::string& name) const;
 
     /// Return number of elems per bucket.
     /// High performance not required, so directly returns a vector.
@@ -135,23 +204,52 @@ public:
         return device_hashmap_;
     }
 
+    /// Save the active entries with their addresses to a binary file, which
+    /// can be loaded back with Load.
+    void Save(const std::string& file_name) const;
+
+    /// Load a hashmap saved with Save to device. Entries are restored at their
+    /// original addresses, so tensors of addresses computed before saving
+    /// remain valid.
+    static Hashmap Load(
+            const std::string& file_name,
+            const Device& device = Device("CPU:0"),
+            const HashmapBackend& backend = HashmapBackend::Default);
+
 protected:
+    /// Rebuild the index over the entries at active_addrs, whose keys are
+    /// gathered in active_keys, after the buffers have been overwritten. Must
+    /// be called on an empty hashmap.
+    void RestoreIndex(const Tensor& active_keys, const Tensor& active_addrs);
+
     void AssertKeyDtype(const Dtype& dtype_key,
                         const SizeVector& elem_shape) const;
     void AssertValueDtype(const Dtype& dtype_val,
-                          const SizeVector& elem_shape) const;
+                          const SizeVector& elem_shape,
+                          size_t i = 0) const;
+
+    /// Validates the value tensors of an insertion of count keys and returns
+    /// their data pointers, which the backends copy from directly. Tensors
+    /// that are not contiguous are copied into \p contiguous_values, which
+    /// must outlive the insertion.
+    HashmapValueInputs GetValueInputs(
+            const std::vector<Tensor>& input_values,
+            int64_t count,
+            std::vector<Tensor>& contiguous_values) const;
 
     Dtype GetKeyDtype() const { return dtype_key_; }
-    Dtype GetValueDtype() const { return dtype_value_; }
+    Dtype GetValueDtype(size_t i = 0) const { return dtypes_value_.at(i); }
 
 private:
     std::shared_ptr<DeviceHashmap> device_hashmap_;
 
     Dtype dtype_key_;
-    Dtype dtype_value_;
+    std::vector<Dtype> dtypes_value_;
 
     SizeVector element_shape_key_;
-    SizeVector element_shape_value_;
+    std::vector<SizeVector> element_shapes_value_;
+
+    std::vector<std::string> value_names_;
 };
 
 }  // namespace core
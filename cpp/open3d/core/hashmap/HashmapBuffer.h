@@ -57,38 +57,68 @@ namespace core {
 // Type for the internal heap. Dtype::Int32 is used to store it in Tensors.
 typedef uint32_t addr_t;
 
+/// Maximum number of value buffers per hashmap entry. Buffer accessors keep
+/// the value buffers in fixed-size arrays so that they can be passed to
+/// kernels by value.
+constexpr int64_t kMaxValueBuffers = 8;
+
+/// Input values of a batched insertion, one entry per value buffer. Entry j
+/// points to a contiguous array of rows of dsize bytes, one row per input key,
+/// that the backends copy straight into value buffer j. With n_buffers == 0
+/// the values of the inserted entries are zeroed instead. Kept in a
+/// fixed-size array so that it can be passed to kernels by value.
+struct HashmapValueInputs {
+    struct Buffer {
+        const uint8_t *ptr;
+        int64_t dsize;
+    };
+
+    int64_t n_buffers = 0;
+    Buffer buffers[kMaxValueBuffers];
+};
+
+/// Holds the keys, the values and the heap of a hashmap. The values of an
+/// entry may be split across several buffers (struct-of-arrays), each with
+/// its own element byte size, so that a kernel reading a single field of the
+/// values only touches the buffer that stores it.
 class HashmapBuffer {
 public:
     HashmapBuffer(int64_t capacity,
                   int64_t dsize_key,
-                  int64_t dsize_value,
+                  const std::vector<int64_t> &dsize_values,
                   const Device &device)
         : capacity_(capacity),
           dsize_key_(dsize_key),
-          dsize_value_(dsize_value),
+          dsize_values_(dsize_values),
           device_(device) {
         key_buffer_ =
                 Tensor({capacity_},
                        Dtype(Dtype::DtypeCode::Object, dsize_key_, "_hash_k"),
                        device_);
-        value_buffer_ =
-                Tensor({capacity_},
-                       Dtype(Dtype::DtypeCode::Object, dsize_value_, "_hash_v"),
-                       device_);
+        for (int64_t dsize_value : dsize_values_) {
+            value_buffers_.push_back(Tensor(
+                    {capacity_},
+                    Dtype(Dtype::DtypeCode::Object, dsize_value, "_hash_v"),
+                    device_));
+        }
         heap_ = Tensor({capacity_}, Dtype::Int32, device_);
     }
 
     Tensor &GetKeyBuffer() { return key_buffer_; }
-    Tensor &GetValueBuffer() { return value_buffer_; }
+    Tensor &GetValueBuffer(size_t i = 0) { return value_buffers_.at(i); }
+    std::vector<Tensor> &GetValueBuffers() { return value_buffers_; }
+    const std::vector<int64_t> &GetValueBytesizes() const {
+        return dsize_values_;
+    }
     Tensor &GetHeap() { return heap_; }
 
 protected:
     int64_t capacity_;
     int64_t dsize_key_;
-    int64_t dsize_value_;
+    std::vector<int64_t> dsize_values_;
 
     Tensor key_buffer_;
-    Tensor value_buffer_;
+    std::vector<Tensor> value_buffers_;
     Tensor heap_;
 
     Device device_;
@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/SpillingHashmap.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+SpillingHashmap::SpillingHashmap(int64_t max_device_capacity,
+                                 const Dtype& dtype_key,
+                                 const Dtype& dtype_value,
+                                 const SizeVector& element_shape_key,
+                                 const SizeVector& element_shape_value,
+                                 const Device& device,
+                                 const HashmapBackend& backend)
+    : max_device_capacity_(max_device_capacity),
+      device_hashmap_(max_device_capacity,
+                      dtype_key,
+                      dtype_value,
+                      element_shape_key,
+                      element_shape_value,
+                      device,
+                      backend),
+      host_hashmap_(max_device_capacity,
+                    dtype_key,
+                    dtype_value,
+                    element_shape_key,
+                    element_shape_value,
+                    Device("CPU:0")) {
+    last_touched_ = Tensor::Zeros({device_hashmap_.GetCapacity()},
+                                  Dtype::Int64, device);
+}
+
+void SpillingHashmap::Insert(const Tensor& input_keys,
+                             const Tensor& input_values,
+                             Tensor& output_addrs,
+                             Tensor& output_masks) {
+    Prepare(input_keys, input_keys.GetLength());
+    device_hashmap_.Insert(input_keys, input_values, output_addrs,
+                           output_masks);
+    Touch(output_addrs.IndexGet({output_masks}));
+}
+
+void SpillingHashmap::Activate(const Tensor& input_keys,
+                               Tensor& output_addrs,
+                               Tensor& output_masks) {
+    Prepare(input_keys, input_keys.GetLength());
+    device_hashmap_.Activate(input_keys, output_addrs, output_masks);
+    Touch(output_addrs.IndexGet({output_masks}));
+}
+
+void SpillingHashmap::FindOrInsert(const Tensor& input_keys,
+                                   Tensor& output_addrs,
+                                   Tensor& output_masks) {
+    Prepare(input_keys, input_keys.GetLength());
+    device_hashmap_.FindOrInsert(input_keys, output_addrs, output_masks);
+    Touch(output_addrs);
+}
+
+void SpillingHashmap::Find(const Tensor& input_keys,
+                           Tensor& output_addrs,
+                           Tensor& output_masks) {
+    Prepare(input_keys, 0);
+    device_hashmap_.Find(input_keys, output_addrs, output_masks);
+    Touch(output_addrs.IndexGet({output_masks}));
+}
+
+void SpillingHashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    device_hashmap_.Erase(input_keys, output_masks);
+    if (GetHostSize() > 0) {
+        Tensor host_masks;
+        host_hashmap_.Erase(input_keys.To(Device("CPU:0")), host_masks);
+        output_masks = output_masks.LogicalOr(
+                host_masks.To(device_hashmap_.GetDevice()));
+    }
+}
+
+int64_t SpillingHashmap::Evict(int64_t count) {
+    if (count <= 0 || GetDeviceSize() == 0) {
+        return 0;
+    }
+
+    Tensor active_addrs;
+    device_hashmap_.GetActiveIndices(active_addrs);
+    Tensor active_indices = active_addrs.To(Dtype::Int64);
+
+    // Entries touched in the current frame may be in use by the caller.
+    Tensor stamps = last_touched_.IndexGet({active_indices});
+    Tensor cold_masks = stamps.Lt(frame_);
+    Tensor cold_indices = active_indices.IndexGet({cold_masks});
+    int64_t num_cold = cold_indices.GetLength();
+    if (num_cold == 0) {
+        return 0;
+    }
+
+    Tensor evict_indices = cold_indices;
+    if (count < num_cold) {
+        // Partial selection of the least recently touched entries.
+        std::vector<int64_t> cold_stamps =
+                stamps.IndexGet({cold_masks}).ToFlatVector<int64_t>();
+        std::vector<int64_t> order(num_cold);
+        std::iota(order.begin(), order.end(), 0);
+        std::nth_element(order.begin(), order.begin() + count, order.end(),
+                         [&](int64_t a, int64_t b) {
+                             return cold_stamps[a] < cold_stamps[b];
+                         });
+        order.resize(count);
+        evict_indices = cold_indices.IndexGet({Tensor(
+                order, {count}, Dtype::Int64, cold_indices.GetDevice())});
+    } else {
+        count = num_cold;
+    }
+
+    Tensor keys = device_hashmap_.GetKeyTensor().IndexGet({evict_indices});
+    Tensor values = device_hashmap_.GetValueTensor().IndexGet({evict_indices});
+
+    Tensor addrs, masks;
+    host_hashmap_.Insert(keys.To(Device("CPU:0")), values.To(Device("CPU:0")),
+                         addrs, masks);
+    device_hashmap_.Erase(keys, masks);
+    return count;
+}
+
+void SpillingHashmap::Clear() {
+    device_hashmap_.Clear();
+    host_hashmap_.Clear();
+}
+
+int64_t SpillingHashmap::Size() const {
+    return GetDeviceSize() + GetHostSize();
+}
+
+int64_t SpillingHashmap::GetDeviceSize() const {
+    return device_hashmap_.Size();
+}
+
+int64_t SpillingHashmap::GetHostSize() const { return host_hashmap_.Size(); }
+
+void SpillingHashmap::Prepare(const Tensor& input_keys, int64_t num_new_keys) {
+    Tensor addrs, masks;
+
+    // Protect the input entries already on the device from eviction.
+    if (GetDeviceSize() > 0) {
+        device_hashmap_.Find(input_keys, addrs, masks);
+        Touch(addrs.IndexGet({masks}));
+    }
+
+    Tensor upload_keys, upload_values;
+    int64_t num_upload = 0;
+    if (GetHostSize() > 0) {
+        host_hashmap_.Find(input_keys.To(Device("CPU:0")), addrs, masks);
+        Tensor host_indices = addrs.IndexGet({masks}).To(Dtype::Int64);
+        num_upload = host_indices.GetLength();
+        if (num_upload > 0) {
+            upload_keys = host_hashmap_.GetKeyTensor().IndexGet({host_indices});
+            upload_values =
+                    host_hashmap_.GetValueTensor().IndexGet({host_indices});
+        }
+    }
+
+    // Device backends reserve room for a whole batch before inserting it, so
+    // the bound is checked against the batch sizes rather than the number of
+    // actually new keys. Keeping within the capacity also prevents rehashing,
+    // which would invalidate the stamps indexed by address.
+    int64_t required = GetDeviceSize() + num_upload + num_new_keys;
+    if (required > max_device_capacity_) {
+        int64_t excess = required - max_device_capacity_;
+        if (Evict(excess) < excess) {
+            utility::LogError(
+                    "[SpillingHashmap] The working set of frame {} exceeds "
+                    "the device capacity {}.",
+                    frame_, max_device_capacity_);
+        }
+    }
+
+    if (num_upload > 0) {
+        Device device = device_hashmap_.GetDevice();
+        host_hashmap_.Erase(upload_keys, masks);
+        device_hashmap_.Insert(upload_keys.To(device),
+                               upload_values.To(device), addrs, masks);
+        Touch(addrs.IndexGet({masks}));
+    }
+}
+
+void SpillingHashmap::Touch(const Tensor& addrs) {
+    int64_t count = addrs.GetLength();
+    if (count == 0) {
+        return;
+    }
+    last_touched_.IndexSet({addrs.To(Dtype::Int64)},
+                           Tensor::Full({count}, frame_, Dtype::Int64,
+                                        last_touched_.GetDevice()));
+}
+
+}  // namespace core
+}  // namespace open3d
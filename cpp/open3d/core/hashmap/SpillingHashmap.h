@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// Hashmap keeping a bounded working set on its device and spilling the least
+/// recently touched entries to a host (CPU) hashmap.
+///
+/// Every entry on the device is stamped with the frame in which it was last
+/// inserted or queried. When a batch does not fit in the device capacity, the
+/// entries with the oldest stamps are evicted to host memory. Evicted entries
+/// are uploaded back transparently when they are queried again by Find,
+/// Activate, FindOrInsert or Insert, so that callers only ever see addresses
+/// into the device key/value buffers.
+///
+/// Entries touched in the current frame are never evicted, hence a single
+/// frame may touch at most max_device_capacity keys.
+class SpillingHashmap {
+public:
+    SpillingHashmap(int64_t max_device_capacity,
+                    const Dtype& dtype_key,
+                    const Dtype& dtype_value,
+                    const SizeVector& element_shape_key,
+                    const SizeVector& element_shape_value,
+                    const Device& device,
+                    const HashmapBackend& backend = HashmapBackend::Default);
+
+    /// Start a new frame. Entries touched afterwards are stamped with it.
+    void NextFrame() { ++frame_; }
+    int64_t GetFrame() const { return frame_; }
+
+    /// Same as Hashmap::Insert. Existing keys, on device or on host, are not
+    /// overwritten.
+    void Insert(const Tensor& input_keys,
+                const Tensor& input_values,
+                Tensor& output_addrs,
+                Tensor& output_masks);
+
+    /// Same as Hashmap::Activate.
+    void Activate(const Tensor& input_keys,
+                  Tensor& output_addrs,
+                  Tensor& output_masks);
+
+    /// Same as Hashmap::FindOrInsert.
+    void FindOrInsert(const Tensor& input_keys,
+                      Tensor& output_addrs,
+                      Tensor& output_masks);
+
+    /// Same as Hashmap::Find. Keys found on host are uploaded to the device.
+    void Find(const Tensor& input_keys,
+              Tensor& output_addrs,
+              Tensor& output_masks);
+
+    /// Erase keys from both the device and the host.
+    void Erase(const Tensor& input_keys, Tensor& output_masks);
+
+    /// Move up to count device entries that were not touched in the current
+    /// frame to host, least recently touched first. Return the number of
+    /// evicted entries.
+    int64_t Evict(int64_t count);
+
+    /// Clear both the device and the host entries.
+    void Clear();
+
+    /// Total number of entries, on device and on host.
+    int64_t Size() const;
+    int64_t GetDeviceSize() const;
+    int64_t GetHostSize() const;
+    int64_t GetMaxDeviceCapacity() const { return max_device_capacity_; }
+
+    /// Addresses returned by the queries index the buffers of this hashmap.
+    Hashmap& GetDeviceHashmap() { return device_hashmap_; }
+    Hashmap& GetHostHashmap() { return host_hashmap_; }
+
+protected:
+    /// Upload the host entries of the input keys, making room for them and
+    /// for num_new_keys potentially new keys on the device. After this call
+    /// all the input keys that exist in the map are on the device.
+    void Prepare(const Tensor& input_keys, int64_t num_new_keys);
+
+    /// Stamp the device entries at addrs with the current frame.
+    void Touch(const Tensor& addrs);
+
+private:
+    int64_t max_device_capacity_;
+    int64_t frame_ = 0;
+
+    Hashmap device_hashmap_;
+    Hashmap host_hashmap_;
+
+    /// Int64 last touched frame of each device buffer entry.
+    Tensor last_touched_;
+};
+
+}  // namespace core
+}  // namespace open3d
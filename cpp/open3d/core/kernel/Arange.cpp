@@ -27,6 +27,7 @@
 #include "open3d/core/kernel/Arange.h"
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
 
 namespace open3d {
 namespace core {
@@ -82,6 +83,7 @@ Tensor Arange(const Tensor& start, const Tensor& stop, const Tensor& step) {
     // Output.
     Tensor dst = Tensor({num_elements}, dtype, device);
 
+    RecordKernelLaunch(device, num_elements);
     if (device_type == Device::DeviceType::CPU) {
         ArangeCPU(start, stop, step, dst);
     } else if (device_type == Device::DeviceType::CUDA) {
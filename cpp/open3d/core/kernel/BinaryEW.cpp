@@ -30,6 +30,7 @@
 
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -68,6 +69,7 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    RecordKernelLaunch(lhs.GetDevice(), dst.NumElements());
     Device::DeviceType device_type = lhs.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
@@ -31,6 +31,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/BinaryEW.h"
 #include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/VectorizedCPU.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -181,7 +182,7 @@ void BinaryEWCPU(const Tensor& lhs,
 
     if (s_boolean_binary_ew_op_codes.find(op_code) !=
         s_boolean_binary_ew_op_codes.end()) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 // Inplace boolean op's output type is the same as the
                 // input. e.g. np.logical_and(a, b, out=a), where a, b are
@@ -201,9 +202,9 @@ void BinaryEWCPU(const Tensor& lhs,
                         "same type as the input.");
             }
         });
-    } else {
+    } else if (!BinaryEWVectorizedCPU(lhs, rhs, dst, op_code)) {
         Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
                     CPULauncher::LaunchBinaryEWKernel(
@@ -34,6 +34,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -41,6 +42,10 @@ namespace kernel {
 
 class CPULauncher {
 public:
+    /// Minimum number of element-wise workloads scheduled as one task of the
+    /// parallel executor, such that the scheduling cost is amortized.
+    static constexpr int64_t kGrainSize = 32768;
+
     /// Fills tensor[:][i] with element_kernel(i).
     ///
     /// \param indexer The input tensor and output tensor to the indexer are the
@@ -51,45 +56,83 @@ public:
     template <typename func_t>
     static void LaunchIndexFillKernel(const Indexer& indexer,
                                       func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx), workload_idx);
-        }
+        utility::ParallelFor(
+                0, indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   workload_idx);
+                },
+                kGrainSize);
     }
 
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+        if (indexer.IsFlat()) {
+            // Flat pointer loop, see Indexer::IsFlat().
+            char* src = indexer.GetInputPtr(0, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            const int64_t src_stride = indexer.GetInputByteStride(0);
+            const int64_t dst_stride = indexer.GetOutputByteStride();
+            utility::ParallelFor(
+                    0, indexer.NumWorkloads(),
+                    [&](int64_t workload_idx) {
+                        element_kernel(src + workload_idx * src_stride,
+                                       dst + workload_idx * dst_stride);
+                    },
+                    kGrainSize);
+            return;
         }
+        utility::ParallelFor(
+                0, indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                kGrainSize);
     }
 
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+        if (indexer.IsFlat()) {
+            // Flat pointer loop, see Indexer::IsFlat().
+            char* lhs = indexer.GetInputPtr(0, 0);
+            char* rhs = indexer.GetInputPtr(1, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            const int64_t lhs_stride = indexer.GetInputByteStride(0);
+            const int64_t rhs_stride = indexer.GetInputByteStride(1);
+            const int64_t dst_stride = indexer.GetOutputByteStride();
+            utility::ParallelFor(
+                    0, indexer.NumWorkloads(),
+                    [&](int64_t workload_idx) {
+                        element_kernel(lhs + workload_idx * lhs_stride,
+                                       rhs + workload_idx * rhs_stride,
+                                       dst + workload_idx * dst_stride);
+                    },
+                    kGrainSize);
+            return;
         }
+        utility::ParallelFor(
+                0, indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   indexer.GetInputPtr(1, workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                kGrainSize);
     }
 
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        utility::ParallelFor(
+                0, indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                kGrainSize);
     }
 
     template <typename scalar_t, typename func_t>
@@ -119,8 +162,7 @@ public:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        utility::ParallelFor(0, num_threads, [&](int64_t thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
             for (int64_t workload_idx = start; workload_idx < end;
@@ -128,7 +170,7 @@ public:
                 element_kernel(indexer.GetInputPtr(0, workload_idx),
                                &thread_results[thread_idx]);
             }
-        }
+        });
         void* output_ptr = indexer.GetOutputPtr(0);
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             element_kernel(&thread_results[thread_idx], output_ptr);
@@ -163,21 +205,17 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+        utility::ParallelFor(0, indexer_shape[best_dim], [&](int64_t i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
             LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        });
     }
 
     /// General kernels with non-conventional indexers
     template <typename func_t>
     static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
-            element_kernel(workload_idx);
-        }
+        utility::ParallelFor(0, n, element_kernel);
     }
 };
 
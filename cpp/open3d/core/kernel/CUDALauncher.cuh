@@ -30,6 +30,7 @@
 #include <cuda_runtime.h>
 
 #include "open3d/core/AdvancedIndexing.h"
+#include "open3d/core/CUDAStream.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/SizeVector.h"
@@ -77,13 +78,33 @@ public:
         int64_t items_per_block = default_block_size * default_thread_size;
         int64_t grid_size = (n + items_per_block - 1) / items_per_block;
 
-        auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        };
-
-        ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+        if (indexer.IsFlat()) {
+            // Flat pointer loop, see Indexer::IsFlat(). Only the pointers and
+            // strides are copied to the device instead of the whole Indexer.
+            char* src = indexer.GetInputPtr(0, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            int64_t src_stride = indexer.GetInputByteStride(0);
+            int64_t dst_stride = indexer.GetOutputByteStride();
+            auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                element_kernel(src + workload_idx * src_stride,
+                               dst + workload_idx * dst_stride);
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0,
+                      CUDAStream::GetCurrent().Get()>>>(n, f);
+        } else if (indexer.NumDims() == 2) {
+            LaunchStaticUnaryEWKernel<2>(indexer, n, grid_size, element_kernel);
+        } else if (indexer.NumDims() == 3) {
+            LaunchStaticUnaryEWKernel<3>(indexer, n, grid_size, element_kernel);
+        } else {
+            auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                element_kernel(indexer.GetInputPtr(0, workload_idx),
+                               indexer.GetOutputPtr(workload_idx));
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0,
+                      CUDAStream::GetCurrent().Get()>>>(n, f);
+        }
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
     }
 
@@ -99,14 +120,38 @@ public:
         int64_t items_per_block = default_block_size * default_thread_size;
         int64_t grid_size = (n + items_per_block - 1) / items_per_block;
 
-        auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        };
-
-        ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+        if (indexer.IsFlat()) {
+            // Flat pointer loop, see Indexer::IsFlat().
+            char* lhs = indexer.GetInputPtr(0, 0);
+            char* rhs = indexer.GetInputPtr(1, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            int64_t lhs_stride = indexer.GetInputByteStride(0);
+            int64_t rhs_stride = indexer.GetInputByteStride(1);
+            int64_t dst_stride = indexer.GetOutputByteStride();
+            auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                element_kernel(lhs + workload_idx * lhs_stride,
+                               rhs + workload_idx * rhs_stride,
+                               dst + workload_idx * dst_stride);
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0,
+                      CUDAStream::GetCurrent().Get()>>>(n, f);
+        } else if (indexer.NumDims() == 2) {
+            LaunchStaticBinaryEWKernel<2>(indexer, n, grid_size,
+                                           element_kernel);
+        } else if (indexer.NumDims() == 3) {
+            LaunchStaticBinaryEWKernel<3>(indexer, n, grid_size,
+                                           element_kernel);
+        } else {
+            auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                element_kernel(indexer.GetInputPtr(0, workload_idx),
+                               indexer.GetInputPtr(1, workload_idx),
+                               indexer.GetOutputPtr(workload_idx));
+            };
+            ElementWiseKernel<default_block_size, default_thread_size>
+                    <<<grid_size, default_block_size, 0,
+                      CUDAStream::GetCurrent().Get()>>>(n, f);
+        }
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchBinaryEWKernel failed.");
     }
 
@@ -128,10 +173,47 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0,
+                  CUDAStream::GetCurrent().Get()>>>(n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchAdvancedIndexerKernel failed.");
     }
 
+private:
+    /// Launches with a StaticIndexer of rank NDIMS, which is copied to the
+    /// device instead of the whole Indexer. Ranks 2 and 3 are the common ones
+    /// left over after the dimensions are coalesced.
+    template <int NDIMS, typename func_t>
+    static void LaunchStaticUnaryEWKernel(const Indexer& indexer,
+                                          int64_t n,
+                                          int64_t grid_size,
+                                          func_t element_kernel) {
+        StaticIndexer<NDIMS, 1> static_indexer(indexer);
+        auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+            element_kernel(static_indexer.GetInputPtr(0, workload_idx),
+                           static_indexer.GetOutputPtr(workload_idx));
+        };
+        ElementWiseKernel<default_block_size, default_thread_size>
+                <<<grid_size, default_block_size, 0,
+                  CUDAStream::GetCurrent().Get()>>>(n, f);
+    }
+
+    template <int NDIMS, typename func_t>
+    static void LaunchStaticBinaryEWKernel(const Indexer& indexer,
+                                           int64_t n,
+                                           int64_t grid_size,
+                                           func_t element_kernel) {
+        StaticIndexer<NDIMS, 2> static_indexer(indexer);
+        auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+            element_kernel(static_indexer.GetInputPtr(0, workload_idx),
+                           static_indexer.GetInputPtr(1, workload_idx),
+                           static_indexer.GetOutputPtr(workload_idx));
+        };
+        ElementWiseKernel<default_block_size, default_thread_size>
+                <<<grid_size, default_block_size, 0,
+                  CUDAStream::GetCurrent().Get()>>>(n, f);
+    }
+
+public:
     /// General kernels with non-conventional indexers
     /// Do not assert host_device compatible, because there can be some GPU-only
     /// operations (e.g., atomicAdd, __shfl_sync).
@@ -144,7 +226,8 @@ public:
         int64_t grid_size = (n + items_per_block - 1) / items_per_block;
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, element_kernel);
+                <<<grid_size, default_block_size, 0,
+                  CUDAStream::GetCurrent().Get()>>>(n, element_kernel);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchGeneralKernel failed.");
     }
 };
@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+bool FusedEWProgram::RequiresFloat() const {
+    for (int64_t i = 0; i < num_instructions_; ++i) {
+        switch (instructions_[i].op_code_) {
+            case FusedEWOpCode::Sqrt:
+            case FusedEWOpCode::Sin:
+            case FusedEWOpCode::Cos:
+            case FusedEWOpCode::Exp:
+                return true;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+void FusedEWProgram::Validate(int64_t num_inputs) const {
+    int64_t depth = 0;
+    for (int64_t i = 0; i < num_instructions_; ++i) {
+        const FusedEWInstruction& inst = instructions_[i];
+        switch (inst.op_code_) {
+            case FusedEWOpCode::LoadInput:
+                if (inst.arg_ < 0 || inst.arg_ >= num_inputs) {
+                    utility::LogError(
+                            "Fused program loads input {}, but only {} "
+                            "inputs are given.",
+                            inst.arg_, num_inputs);
+                }
+                depth++;
+                break;
+            case FusedEWOpCode::LoadScalar:
+                depth++;
+                break;
+            case FusedEWOpCode::Add:
+            case FusedEWOpCode::Sub:
+            case FusedEWOpCode::Mul:
+            case FusedEWOpCode::Div:
+                if (depth < 2) {
+                    utility::LogError(
+                            "Fused program stack underflow at instruction {}.",
+                            i);
+                }
+                depth--;
+                break;
+            default:
+                if (depth < 1) {
+                    utility::LogError(
+                            "Fused program stack underflow at instruction {}.",
+                            i);
+                }
+                break;
+        }
+        if (depth > MAX_FUSED_STACK_DEPTH) {
+            utility::LogError("Fused program exceeds stack depth {}.",
+                              MAX_FUSED_STACK_DEPTH);
+        }
+    }
+    if (depth != 1) {
+        utility::LogError(
+                "Fused program must leave exactly one value on the stack, but "
+                "{} are left.",
+                depth);
+    }
+}
+
+std::string FusedEWProgram::ToExpression(const std::string& scalar_type) const {
+    std::vector<std::string> stack;
+    for (int64_t i = 0; i < num_instructions_; ++i) {
+        const FusedEWInstruction& inst = instructions_[i];
+        switch (inst.op_code_) {
+            case FusedEWOpCode::LoadInput:
+                stack.push_back(fmt::format("v{}", inst.arg_));
+                break;
+            case FusedEWOpCode::LoadScalar:
+                // 17 significant digits round-trip any double.
+                stack.push_back(fmt::format("(({})({:.17g}))", scalar_type,
+                                            inst.value_));
+                break;
+            case FusedEWOpCode::Add:
+            case FusedEWOpCode::Sub:
+            case FusedEWOpCode::Mul:
+            case FusedEWOpCode::Div: {
+                const char* op =
+                        inst.op_code_ == FusedEWOpCode::Add   ? "+"
+                        : inst.op_code_ == FusedEWOpCode::Sub ? "-"
+                        : inst.op_code_ == FusedEWOpCode::Mul ? "*"
+                                                              : "/";
+                std::string rhs = stack.back();
+                stack.pop_back();
+                stack.back() = fmt::format("({} {} {})", stack.back(), op, rhs);
+                break;
+            }
+            case FusedEWOpCode::Neg:
+                stack.back() = fmt::format("(-{})", stack.back());
+                break;
+            case FusedEWOpCode::Abs:
+                stack.back() = fmt::format("o3d_abs({})", stack.back());
+                break;
+            case FusedEWOpCode::Sqrt:
+                stack.back() = fmt::format("o3d_sqrt({})", stack.back());
+                break;
+            case FusedEWOpCode::Sin:
+                stack.back() = fmt::format("o3d_sin({})", stack.back());
+                break;
+            case FusedEWOpCode::Cos:
+                stack.back() = fmt::format("o3d_cos({})", stack.back());
+                break;
+            case FusedEWOpCode::Exp:
+                stack.back() = fmt::format("o3d_exp({})", stack.back());
+                break;
+        }
+    }
+    return stack.empty() ? std::string() : stack.back();
+}
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             Tensor& dst,
+             const FusedEWProgram& program) {
+    if (static_cast<int64_t>(inputs.size()) > MAX_INPUTS) {
+        utility::LogError("Fused program has too many (>{}) inputs.",
+                          MAX_INPUTS);
+    }
+    program.Validate(static_cast<int64_t>(inputs.size()));
+
+    // Inputs and dst must be on the same device and have the same dtype.
+    SizeVector broadcasted_input_shape({});
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (input.GetDtype() != dst.GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              input.GetDtype().ToString(),
+                              dst.GetDtype().ToString());
+        }
+        broadcasted_input_shape = shape_util::BroadcastedShape(
+                broadcasted_input_shape, input.GetShape());
+    }
+    if (!shape_util::CanBeBrocastedToShape(broadcasted_input_shape,
+                                           dst.GetShape())) {
+        utility::LogError(
+                "The broadcasted input shape {} cannot be broadcasted to the "
+                "output shape {}.",
+                broadcasted_input_shape, dst.GetShape());
+    }
+    if (program.RequiresFloat() && dst.GetDtype() != Dtype::Float32 &&
+        dst.GetDtype() != Dtype::Float64) {
+        utility::LogError(
+                "Fused program contains float-only ops, but dtype is {}.",
+                dst.GetDtype().ToString());
+    }
+
+    RecordKernelLaunch(dst.GetDevice(), dst.NumElements());
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, dst, program);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWCUDA(inputs, dst, program);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,202 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWOpCode {
+    LoadInput,   // Push the value of input tensor arg_ to the stack.
+    LoadScalar,  // Push the scalar value_ to the stack.
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Abs,
+    Sqrt,
+    Sin,
+    Cos,
+    Exp,
+};
+
+// Maximum number of instructions in a fused program. The program is passed as a
+// CUDA kernel argument together with the Indexer, which bounds its size.
+static constexpr int64_t MAX_FUSED_INSTRUCTIONS = 32;
+
+// Maximum depth of the evaluation stack of a fused program.
+static constexpr int64_t MAX_FUSED_STACK_DEPTH = 16;
+
+struct FusedEWInstruction {
+    FusedEWOpCode op_code_;
+    int64_t arg_;   // Input tensor index for LoadInput.
+    double value_;  // Scalar value for LoadScalar.
+};
+
+/// A fused element-wise program in postfix (reverse Polish) order. The program
+/// is a POD that is copied by value into the CPU and CUDA kernels, so that one
+/// kernel launch evaluates the whole expression per element without any
+/// intermediate buffer.
+struct FusedEWProgram {
+    FusedEWInstruction instructions_[MAX_FUSED_INSTRUCTIONS];
+    int64_t num_instructions_ = 0;
+
+    /// Appends an instruction. Throws if the program is full.
+    void Push(FusedEWOpCode op_code, int64_t arg = 0, double value = 0) {
+        if (num_instructions_ >= MAX_FUSED_INSTRUCTIONS) {
+            utility::LogError("Fused program has too many (>{}) instructions.",
+                              MAX_FUSED_INSTRUCTIONS);
+        }
+        instructions_[num_instructions_++] = {op_code, arg, value};
+    }
+
+    /// Returns true iff the program contains float-only ops (e.g. Sqrt).
+    bool RequiresFloat() const;
+
+    /// Checks stack balance and depth. Throws if the program is malformed.
+    void Validate(int64_t num_inputs) const;
+
+    /// Returns the program as a single C++ expression, where the i-th input is
+    /// the variable v<i> and scalars are cast to \p scalar_type. Unary math ops
+    /// are emitted as calls to o3d_<op>(), e.g. o3d_sqrt(v0), which the
+    /// generated kernel source defines. Used to JIT-compile the program.
+    std::string ToExpression(const std::string& scalar_type) const;
+};
+
+// Float-only ops are evaluated in float for Float32 and in double otherwise.
+// Integer dtypes never reach them, as FusedEW rejects such programs.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline double FusedToFloat(scalar_t x) {
+    return static_cast<double>(x);
+}
+OPEN3D_HOST_DEVICE inline float FusedToFloat(float x) { return x; }
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t FusedApplyUnary(FusedEWOpCode op_code,
+                                                   scalar_t x) {
+    using std::cos;
+    using std::exp;
+    using std::sin;
+    using std::sqrt;
+    switch (op_code) {
+        case FusedEWOpCode::Neg:
+            return -x;
+        case FusedEWOpCode::Abs:
+            return x < static_cast<scalar_t>(0) ? -x : x;
+        case FusedEWOpCode::Sqrt:
+            return static_cast<scalar_t>(sqrt(FusedToFloat(x)));
+        case FusedEWOpCode::Sin:
+            return static_cast<scalar_t>(sin(FusedToFloat(x)));
+        case FusedEWOpCode::Cos:
+            return static_cast<scalar_t>(cos(FusedToFloat(x)));
+        case FusedEWOpCode::Exp:
+            return static_cast<scalar_t>(exp(FusedToFloat(x)));
+        default:
+            return x;
+    }
+}
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t FusedApplyBinary(FusedEWOpCode op_code,
+                                                    scalar_t lhs,
+                                                    scalar_t rhs) {
+    switch (op_code) {
+        case FusedEWOpCode::Add:
+            return lhs + rhs;
+        case FusedEWOpCode::Sub:
+            return lhs - rhs;
+        case FusedEWOpCode::Mul:
+            return lhs * rhs;
+        case FusedEWOpCode::Div:
+            return lhs / rhs;
+        default:
+            return lhs;
+    }
+}
+
+/// Evaluates \p program for one element. \p get_input(i) returns the pointer
+/// to the i-th input's element.
+template <typename scalar_t, typename func_t>
+OPEN3D_HOST_DEVICE inline scalar_t FusedEvaluate(const FusedEWProgram& program,
+                                                 func_t get_input) {
+    scalar_t stack[MAX_FUSED_STACK_DEPTH];
+    int64_t top = 0;
+    for (int64_t i = 0; i < program.num_instructions_; ++i) {
+        const FusedEWInstruction& inst = program.instructions_[i];
+        switch (inst.op_code_) {
+            case FusedEWOpCode::LoadInput:
+                stack[top++] = *reinterpret_cast<const scalar_t*>(
+                        get_input(inst.arg_));
+                break;
+            case FusedEWOpCode::LoadScalar:
+                stack[top++] = static_cast<scalar_t>(inst.value_);
+                break;
+            case FusedEWOpCode::Add:
+            case FusedEWOpCode::Sub:
+            case FusedEWOpCode::Mul:
+            case FusedEWOpCode::Div:
+                top--;
+                stack[top - 1] = FusedApplyBinary(inst.op_code_, stack[top - 1],
+                                                  stack[top]);
+                break;
+            default:
+                stack[top - 1] = FusedApplyUnary(inst.op_code_, stack[top - 1]);
+                break;
+        }
+    }
+    return stack[0];
+}
+
+/// Evaluates \p program element-wise over \p inputs (broadcasted to \p dst)
+/// with a single kernel launch. All inputs and \p dst must have the same dtype
+/// and device.
+void FusedEW(const std::vector<Tensor>& inputs,
+             Tensor& dst,
+             const FusedEWProgram& program);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                Tensor& dst,
+                const FusedEWProgram& program);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 Tensor& dst,
+                 const FusedEWProgram& program);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/core/kernel/FusedEWJIT.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 Tensor& dst,
+                 const FusedEWProgram& program) {
+    if (FusedEWJITCUDA(inputs, dst, program)) {
+        return;
+    }
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CUDALauncher::LaunchGeneralKernel(
+                indexer.NumWorkloads(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    *reinterpret_cast<scalar_t*>(
+                            indexer.GetOutputPtr(workload_idx)) =
+                            FusedEvaluate<scalar_t>(
+                                    program, [&](int64_t input_idx) {
+                                        return indexer.GetInputPtr(
+                                                input_idx, workload_idx);
+                                    });
+                });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEWJIT.h"
+
+#include <cstdlib>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static const char* ScalarTypeName(Dtype dtype) {
+    if (dtype == Dtype::Float32) {
+        return "float";
+    } else if (dtype == Dtype::Float64) {
+        return "double";
+    } else if (dtype == Dtype::Int32) {
+        return "int";
+    } else if (dtype == Dtype::Int64) {
+        return "long long";
+    } else {
+        utility::LogError("Fused program JIT: unsupported dtype {}.",
+                          dtype.ToString());
+    }
+}
+
+std::string GenerateFusedEWSource(const FusedEWProgram& program,
+                                  Dtype dtype,
+                                  const std::vector<bool>& input_is_scalar) {
+    std::string source = fmt::format(
+            "typedef {} scalar_t;\n"
+            "__device__ inline float o3d_sqrt(float x) {{ return sqrtf(x); }}\n"
+            "__device__ inline double o3d_sqrt(double x) {{ return sqrt(x); }}"
+            "\n"
+            "__device__ inline float o3d_sin(float x) {{ return sinf(x); }}\n"
+            "__device__ inline double o3d_sin(double x) {{ return sin(x); }}\n"
+            "__device__ inline float o3d_cos(float x) {{ return cosf(x); }}\n"
+            "__device__ inline double o3d_cos(double x) {{ return cos(x); }}\n"
+            "__device__ inline float o3d_exp(float x) {{ return expf(x); }}\n"
+            "__device__ inline double o3d_exp(double x) {{ return exp(x); }}\n"
+            "__device__ inline scalar_t o3d_abs(scalar_t x) {{\n"
+            "    return x < (scalar_t)0 ? -x : x;\n"
+            "}}\n"
+            "struct FusedEWArgs {{\n"
+            "    const scalar_t* in[{}];\n"
+            "    scalar_t* out;\n"
+            "    long long n;\n"
+            "}};\n"
+            "extern \"C\" __global__ void fused_ew(FusedEWArgs args) {{\n"
+            "    for (long long i = (long long)blockIdx.x * blockDim.x +\n"
+            "                       threadIdx.x;\n"
+            "         i < args.n; i += (long long)blockDim.x * gridDim.x) {{\n",
+            ScalarTypeName(dtype), MAX_INPUTS);
+    for (size_t i = 0; i < input_is_scalar.size(); ++i) {
+        source += fmt::format("        const scalar_t v{} = args.in[{}][{}];\n",
+                              i, i, input_is_scalar[i] ? "0" : "i");
+    }
+    source += fmt::format("        args.out[i] = {};\n    }}\n}}\n",
+                          program.ToExpression("scalar_t"));
+    return source;
+}
+
+std::string GetFusedEWCacheDir() {
+    if (const char* dir = std::getenv("OPEN3D_KERNEL_CACHE_DIR")) {
+        return dir;
+    }
+#ifdef _WIN32
+    const char* home = std::getenv("USERPROFILE");
+#else
+    const char* home = std::getenv("HOME");
+#endif
+    std::string base = home ? home : utility::filesystem::GetWorkingDirectory();
+    return base + "/.cache/open3d/kernels";
+}
+
+bool IsFusedEWJITEnabled() {
+#ifdef BUILD_NVRTC
+    static const bool enabled = []() {
+        const char* env = std::getenv("OPEN3D_FUSED_EW_JIT");
+        return env == nullptr || std::string(env) != "0";
+    }();
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
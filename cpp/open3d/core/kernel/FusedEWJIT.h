@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Runtime compilation of fused element-wise programs with NVRTC. Instead of
+// interpreting the postfix program per element, a kernel is generated with the
+// whole expression inlined, compiled to PTX for the current device, and cached
+// in memory and on disk, keyed by the generated source.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns the CUDA source of the kernel that evaluates \p program for
+/// \p dtype. The i-th input is read at the element index, or at index 0 if
+/// \p input_is_scalar[i] is true.
+std::string GenerateFusedEWSource(const FusedEWProgram& program,
+                                  Dtype dtype,
+                                  const std::vector<bool>& input_is_scalar);
+
+/// Returns the directory of the on-disk cache of compiled kernels, which is
+/// $OPEN3D_KERNEL_CACHE_DIR if set, or $HOME/.cache/open3d/kernels otherwise.
+std::string GetFusedEWCacheDir();
+
+/// Returns true if fused programs are JIT-compiled, i.e. Open3D is built with
+/// WITH_NVRTC and the environment variable OPEN3D_FUSED_EW_JIT is not 0.
+bool IsFusedEWJITEnabled();
+
+#ifdef BUILD_CUDA_MODULE
+/// Evaluates \p program with a JIT-compiled kernel. Returns false without
+/// touching \p dst if the JIT is disabled or the operands are not supported,
+/// in which case the caller falls back to the interpreted kernel. Supported are
+/// Float32, Float64, Int32 and Int64 with a contiguous \p dst, where each input
+/// is contiguous with the shape of \p dst or has a single element.
+bool FusedEWJITCUDA(const std::vector<Tensor>& inputs,
+                    Tensor& dst,
+                    const FusedEWProgram& program);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
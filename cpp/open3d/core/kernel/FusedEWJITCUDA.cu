@@ -0,0 +1,231 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/kernel/FusedEWJIT.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+#ifdef BUILD_NVRTC
+#include <nvrtc.h>
+#endif
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+#ifdef BUILD_NVRTC
+
+static void NVRTCCheck(nvrtcResult result, const char* call) {
+    if (result != NVRTC_SUCCESS) {
+        utility::LogError("{} failed: {}.", call, nvrtcGetErrorString(result));
+    }
+}
+
+static void CUCheck(CUresult result, const char* call) {
+    if (result != CUDA_SUCCESS) {
+        const char* message = nullptr;
+        cuGetErrorString(result, &message);
+        utility::LogError("{} failed: {}.", call,
+                          message ? message : "unknown error");
+    }
+}
+
+/// 64-bit FNV-1a hash, which is stable across runs and platforms, unlike
+/// std::hash, so that it can name the cache files.
+static uint64_t StableHash(const std::string& str) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static std::string CompileToPTX(const std::string& source,
+                                const std::string& arch) {
+    nvrtcProgram program;
+    NVRTCCheck(nvrtcCreateProgram(&program, source.c_str(), "fused_ew.cu", 0,
+                                  nullptr, nullptr),
+               "nvrtcCreateProgram");
+    std::string arch_option = "--gpu-architecture=" + arch;
+    const char* options[] = {arch_option.c_str()};
+    nvrtcResult result = nvrtcCompileProgram(program, 1, options);
+    if (result != NVRTC_SUCCESS) {
+        size_t log_size = 0;
+        nvrtcGetProgramLogSize(program, &log_size);
+        std::string log(log_size, '\0');
+        nvrtcGetProgramLog(program, &log[0]);
+        nvrtcDestroyProgram(&program);
+        utility::LogError("Failed to compile fused kernel:\n{}\n{}", source,
+                          log);
+    }
+    size_t ptx_size = 0;
+    NVRTCCheck(nvrtcGetPTXSize(program, &ptx_size), "nvrtcGetPTXSize");
+    std::string ptx(ptx_size, '\0');
+    NVRTCCheck(nvrtcGetPTX(program, &ptx[0]), "nvrtcGetPTX");
+    NVRTCCheck(nvrtcDestroyProgram(&program), "nvrtcDestroyProgram");
+    return ptx;
+}
+
+/// Returns the PTX of \p source from the disk cache, or compiles and caches
+/// it. Failing to write the cache is not an error.
+static std::string GetPTX(const std::string& source, const std::string& arch) {
+    int nvrtc_major = 0, nvrtc_minor = 0;
+    NVRTCCheck(nvrtcVersion(&nvrtc_major, &nvrtc_minor), "nvrtcVersion");
+    std::string key = fmt::format("{}// {} nvrtc {}.{}\n", source, arch,
+                                  nvrtc_major, nvrtc_minor);
+    std::string cache_dir = GetFusedEWCacheDir();
+    std::string path =
+            fmt::format("{}/{:016x}.ptx", cache_dir, StableHash(key));
+
+    std::vector<char> bytes;
+    if (utility::filesystem::FileExists(path) &&
+        utility::filesystem::FReadToBuffer(path, bytes, nullptr)) {
+        return std::string(bytes.begin(), bytes.end());
+    }
+    std::string ptx = CompileToPTX(source, arch);
+    if (utility::filesystem::MakeDirectoryHierarchy(cache_dir)) {
+        // Write to a temporary file first, such that concurrent processes
+        // never read a partially written file.
+        std::string tmp_path =
+                fmt::format("{}.{}.tmp", path, std::random_device()());
+        std::ofstream file(tmp_path, std::ios::binary);
+        file.write(ptx.c_str(), ptx.size());
+        file.close();
+        if (!file || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            utility::LogDebug("Failed to cache fused kernel at {}.", path);
+        }
+    }
+    return ptx;
+}
+
+static CUfunction GetFusedEWFunction(const std::string& source,
+                                     const Device& device) {
+    static std::mutex mutex;
+    // Modules are loaded into the context of each device and never unloaded.
+    static std::unordered_map<std::string, CUfunction> functions;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string memory_key = fmt::format("{}\n{}", device.ToString(), source);
+    auto it = functions.find(memory_key);
+    if (it != functions.end()) {
+        return it->second;
+    }
+
+    int major = 0, minor = 0;
+    OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(
+            &major, cudaDevAttrComputeCapabilityMajor, device.GetID()));
+    OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(
+            &minor, cudaDevAttrComputeCapabilityMinor, device.GetID()));
+    std::string ptx = GetPTX(source, fmt::format("compute_{}{}", major, minor));
+
+    CUmodule module;
+    CUCheck(cuModuleLoadData(&module, ptx.c_str()), "cuModuleLoadData");
+    CUfunction function;
+    CUCheck(cuModuleGetFunction(&function, module, "fused_ew"),
+            "cuModuleGetFunction");
+    functions[memory_key] = function;
+    return function;
+}
+
+bool FusedEWJITCUDA(const std::vector<Tensor>& inputs,
+                    Tensor& dst,
+                    const FusedEWProgram& program) {
+    Dtype dtype = dst.GetDtype();
+    if (!IsFusedEWJITEnabled() || !dst.IsContiguous() ||
+        (dtype != Dtype::Float32 && dtype != Dtype::Float64 &&
+         dtype != Dtype::Int32 && dtype != Dtype::Int64)) {
+        return false;
+    }
+    int64_t n = dst.NumElements();
+    std::vector<bool> input_is_scalar;
+    for (const Tensor& input : inputs) {
+        bool is_scalar = input.NumElements() == 1;
+        if (!input.IsContiguous() ||
+            (!is_scalar && input.GetShape() != dst.GetShape())) {
+            return false;
+        }
+        input_is_scalar.push_back(is_scalar);
+    }
+    if (n == 0) {
+        return true;
+    }
+
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    // Makes the primary context of the device current for the driver API.
+    OPEN3D_CUDA_CHECK(cudaFree(nullptr));
+    CUfunction function = GetFusedEWFunction(
+            GenerateFusedEWSource(program, dtype, input_is_scalar),
+            dst.GetDevice());
+
+    struct {
+        const void* in[MAX_INPUTS];
+        void* out;
+        int64_t n;
+    } args = {};
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        args.in[i] = inputs[i].GetDataPtr();
+    }
+    args.out = dst.GetDataPtr();
+    args.n = n;
+    void* params[] = {&args};
+
+    // The kernel is a grid-stride loop, so the grid size is bounded.
+    const int64_t block_size = 256;
+    const int64_t grid_size =
+            std::min<int64_t>((n + block_size - 1) / block_size, 65535);
+    CUCheck(cuLaunchKernel(function, static_cast<unsigned int>(grid_size), 1,
+                           1, static_cast<unsigned int>(block_size), 1, 1, 0,
+                           CUDAStream::GetCurrent().Get(), params, nullptr),
+            "cuLaunchKernel");
+    return true;
+}
+
+#else
+
+bool FusedEWJITCUDA(const std::vector<Tensor>&,
+                    Tensor&,
+                    const FusedEWProgram&) {
+    return false;
+}
+
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Console.h"
 
@@ -52,6 +53,7 @@ void IndexGet(const Tensor& src,
         return;
     }
 
+    RecordKernelLaunch(src.GetDevice(), dst.NumElements());
     if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexGetCPU(src, dst, index_tensors, indexed_shape, indexed_strides);
     } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -72,6 +74,7 @@ void IndexSet(const Tensor& src,
     // however, src may be on a different device.
     Tensor src_same_device = src.To(dst.GetDevice());
 
+    RecordKernelLaunch(dst.GetDevice(), src_same_device.NumElements());
     if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexSetCPU(src_same_device, dst, index_tensors, indexed_shape,
                     indexed_strides);
@@ -85,6 +88,56 @@ void IndexSet(const Tensor& src,
     }
 }
 
+void IndexGetRows(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    RecordKernelLaunch(src.GetDevice(), dst.NumElements());
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexGetRowsCPU(src, indices, dst);
+    } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexGetRowsCUDA(src, indices, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("IndexGetRows: Unimplemented device");
+    }
+}
+
+void IndexSetRows(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    RecordKernelLaunch(dst.GetDevice(), src.NumElements());
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexSetRowsCPU(src, indices, dst);
+    } else if (dst.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexSetRowsCUDA(src, indices, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("IndexSetRows: Unimplemented device");
+    }
+}
+
+void IndexAdd(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    Dtype dtype = dst.GetDtype();
+    if (dtype != Dtype::Int32 && dtype != Dtype::Int64 &&
+        dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError("IndexAdd: unsupported dtype {}.", dtype.ToString());
+    }
+    RecordKernelLaunch(dst.GetDevice(), src.NumElements());
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexAddCPU(src, indices, dst);
+    } else if (dst.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexAddCUDA(src, indices, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("IndexAdd: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
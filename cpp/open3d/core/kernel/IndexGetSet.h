@@ -73,6 +73,41 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Gathers whole rows along dim 0: dst[i] = src[indices[i]]. This is the fast
+/// path of IndexGet for a single 1D index into a contiguous tensor. \p src and
+/// \p dst are contiguous, \p indices is a 1D Int64 tensor on the device of
+/// \p src, and \p dst has shape {indices.GetLength(), src.GetShape()[1:]}.
+/// Negative indices count from the end.
+void IndexGetRows(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexGetRowsCUDA(const Tensor& src, const Tensor& indices, Tensor& dst);
+#endif
+
+/// Scatters whole rows along dim 0: dst[indices[i]] = src[i], with the same
+/// layout requirements as IndexGetRows. For duplicate indices, which row is
+/// written last is unspecified.
+void IndexSetRows(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+void IndexSetRowsCPU(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexSetRowsCUDA(const Tensor& src, const Tensor& indices, Tensor& dst);
+#endif
+
+/// Accumulates whole rows along dim 0: dst[indices[i]] += src[i]. Rows with
+/// duplicate indices are all added. Supports Int32, Int64, Float32 and
+/// Float64.
+void IndexAdd(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+void IndexAddCPU(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexAddCUDA(const Tensor& src, const Tensor& indices, Tensor& dst);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,12 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/IndexGetSet.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -63,7 +69,7 @@ void IndexGetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             CPULauncher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
@@ -85,13 +91,107 @@ void IndexSetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             CPULauncher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
     }
 }
 
+/// Number of elements in each slice along dim 0.
+static int64_t RowElements(const Tensor& tensor) {
+    const SizeVector& shape = tensor.GetShape();
+    return SizeVector(shape.begin() + 1, shape.end()).NumElements();
+}
+
+/// Rows per parallel task, such that each task copies at least
+/// CPULauncher::kGrainSize elements.
+static int64_t RowGrainSize(int64_t row_elements) {
+    return std::max<int64_t>(
+            1, CPULauncher::kGrainSize / std::max<int64_t>(row_elements, 1));
+}
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    const int64_t num_rows = src.GetLength();
+    const int64_t row_elements = RowElements(src);
+    const int64_t row_bytes = row_elements * src.GetDtype().ByteSize();
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    const int64_t* index_ptr = indices.GetDataPtr<int64_t>();
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    utility::ParallelFor(
+            0, indices.GetLength(),
+            [&](int64_t i) {
+                int64_t row = index_ptr[i];
+                assert(row >= -num_rows && row < num_rows &&
+                       "Index out of bounds");
+                row += num_rows * (row < 0);
+                std::memcpy(dst_ptr + i * row_bytes, src_ptr + row * row_bytes,
+                            row_bytes);
+            },
+            RowGrainSize(row_elements));
+}
+
+void IndexSetRowsCPU(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    const int64_t num_rows = dst.GetLength();
+    const int64_t row_elements = RowElements(dst);
+    const int64_t row_bytes = row_elements * dst.GetDtype().ByteSize();
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    const int64_t* index_ptr = indices.GetDataPtr<int64_t>();
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    utility::ParallelFor(
+            0, indices.GetLength(),
+            [&](int64_t i) {
+                int64_t row = index_ptr[i];
+                assert(row >= -num_rows && row < num_rows &&
+                       "Index out of bounds");
+                row += num_rows * (row < 0);
+                std::memcpy(dst_ptr + row * row_bytes, src_ptr + i * row_bytes,
+                            row_bytes);
+            },
+            RowGrainSize(row_elements));
+}
+
+void IndexAddCPU(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    const int64_t num_rows = dst.GetLength();
+    const int64_t num_indices = indices.GetLength();
+    const int64_t row_elements = RowElements(dst);
+    const int64_t* index_ptr = indices.GetDataPtr<int64_t>();
+
+    // Each task owns a range of destination rows and scans all indices, so
+    // no two tasks write the same row and no atomics are needed. Rows are
+    // accumulated in the order of the indices, as in a serial loop.
+    int64_t num_tasks = 1;
+    if (!InParallel()) {
+        num_tasks = std::max<int64_t>(
+                1, std::min<int64_t>(
+                           num_indices * row_elements / CPULauncher::kGrainSize,
+                           GetMaxThreads()));
+        num_tasks = std::min(num_tasks, std::max<int64_t>(num_rows, 1));
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        utility::ParallelFor(0, num_tasks, [&](int64_t task_idx) {
+            const int64_t row_begin = num_rows * task_idx / num_tasks;
+            const int64_t row_end = num_rows * (task_idx + 1) / num_tasks;
+            for (int64_t i = 0; i < num_indices; ++i) {
+                int64_t row = index_ptr[i];
+                assert(row >= -num_rows && row < num_rows &&
+                       "Index out of bounds");
+                row += num_rows * (row < 0);
+                if (row < row_begin || row >= row_end) {
+                    continue;
+                }
+                scalar_t* dst_row = dst_ptr + row * row_elements;
+                const scalar_t* src_row = src_ptr + i * row_elements;
+                for (int64_t j = 0; j < row_elements; ++j) {
+                    dst_row[j] += src_row[j];
+                }
+            }
+        });
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
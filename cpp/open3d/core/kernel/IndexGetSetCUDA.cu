@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdint>
+
 #include "open3d/core/CUDAState.cuh"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
@@ -66,7 +68,7 @@ void IndexGetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             CUDALauncher::LaunchAdvancedIndexerKernel(
                     ai,
                     // Need to wrap as extended CUDA lambda function
@@ -93,7 +95,7 @@ void IndexSetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             CUDALauncher::LaunchAdvancedIndexerKernel(
                     ai,
                     // Need to wrap as extended CUDA lambda function
@@ -104,6 +106,137 @@ void IndexSetCUDA(const Tensor& src,
     }
 }
 
+/// Number of elements in each slice along dim 0.
+static int64_t RowElements(const Tensor& tensor) {
+    const SizeVector& shape = tensor.GetShape();
+    return SizeVector(shape.begin() + 1, shape.end()).NumElements();
+}
+
+/// Copies rows of \p row_bytes bytes between src and dst, one word_t per
+/// thread. Gathers dst[i] = src[indices[i]], or scatters
+/// dst[indices[i]] = src[i] if \p scatter is true.
+template <typename word_t>
+static void CopyRowsCUDA(const void* src,
+                         void* dst,
+                         const int64_t* indices,
+                         int64_t num_indices,
+                         int64_t num_rows,
+                         int64_t row_bytes,
+                         bool scatter) {
+    const word_t* src_words = static_cast<const word_t*>(src);
+    word_t* dst_words = static_cast<word_t*>(dst);
+    const int64_t row_words = row_bytes / sizeof(word_t);
+    CUDALauncher::LaunchGeneralKernel(
+            num_indices * row_words,
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t i = workload_idx / row_words;
+                int64_t word = workload_idx % row_words;
+                int64_t row = indices[i];
+                row += num_rows * (row < 0);
+                if (scatter) {
+                    dst_words[row * row_words + word] =
+                            src_words[i * row_words + word];
+                } else {
+                    dst_words[i * row_words + word] =
+                            src_words[row * row_words + word];
+                }
+            });
+}
+
+/// Copies rows with the widest word that divides the row size and both base
+/// addresses, so that wide rows are moved with 16-byte vector loads.
+static void CopyRowsCUDA(const void* src,
+                         void* dst,
+                         const int64_t* indices,
+                         int64_t num_indices,
+                         int64_t num_rows,
+                         int64_t row_bytes,
+                         bool scatter) {
+    const uintptr_t alignment = reinterpret_cast<uintptr_t>(src) |
+                                reinterpret_cast<uintptr_t>(dst) |
+                                static_cast<uintptr_t>(row_bytes);
+    if (alignment % 16 == 0) {
+        CopyRowsCUDA<uint4>(src, dst, indices, num_indices, num_rows,
+                            row_bytes, scatter);
+    } else if (alignment % 8 == 0) {
+        CopyRowsCUDA<uint2>(src, dst, indices, num_indices, num_rows,
+                            row_bytes, scatter);
+    } else if (alignment % 4 == 0) {
+        CopyRowsCUDA<uint32_t>(src, dst, indices, num_indices, num_rows,
+                               row_bytes, scatter);
+    } else if (alignment % 2 == 0) {
+        CopyRowsCUDA<uint16_t>(src, dst, indices, num_indices, num_rows,
+                               row_bytes, scatter);
+    } else {
+        CopyRowsCUDA<uint8_t>(src, dst, indices, num_indices, num_rows,
+                              row_bytes, scatter);
+    }
+}
+
+void IndexGetRowsCUDA(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    CopyRowsCUDA(src.GetDataPtr(), dst.GetDataPtr(),
+                 indices.GetDataPtr<int64_t>(), indices.GetLength(),
+                 src.GetLength(), RowElements(src) * src.GetDtype().ByteSize(),
+                 /*scatter=*/false);
+}
+
+void IndexSetRowsCUDA(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    CopyRowsCUDA(src.GetDataPtr(), dst.GetDataPtr(),
+                 indices.GetDataPtr<int64_t>(), indices.GetLength(),
+                 dst.GetLength(), RowElements(dst) * dst.GetDtype().ByteSize(),
+                 /*scatter=*/true);
+}
+
+template <typename scalar_t>
+static OPEN3D_DEVICE void AtomicAddElement(scalar_t* dst, scalar_t value) {
+    atomicAdd(dst, value);
+}
+
+static OPEN3D_DEVICE void AtomicAddElement(int64_t* dst, int64_t value) {
+    // Two's complement addition is the same for signed and unsigned values.
+    atomicAdd(reinterpret_cast<unsigned long long*>(dst),
+              static_cast<unsigned long long>(value));
+}
+
+template <typename scalar_t>
+static void AccumulateRowsCUDA(const Tensor& src,
+                               const Tensor& indices,
+                               Tensor& dst) {
+    const int64_t num_rows = dst.GetLength();
+    const int64_t row_elements = RowElements(dst);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    const int64_t* index_ptr = indices.GetDataPtr<int64_t>();
+    scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+    CUDALauncher::LaunchGeneralKernel(
+            indices.GetLength() * row_elements,
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t i = workload_idx / row_elements;
+                int64_t j = workload_idx % row_elements;
+                int64_t row = index_ptr[i];
+                row += num_rows * (row < 0);
+                AtomicAddElement(dst_ptr + row * row_elements + j,
+                                 src_ptr[workload_idx]);
+            });
+}
+
+void IndexAddCUDA(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    Dtype dtype = dst.GetDtype();
+    if (dtype == Dtype::Int32) {
+        AccumulateRowsCUDA<int32_t>(src, indices, dst);
+    } else if (dtype == Dtype::Int64) {
+        AccumulateRowsCUDA<int64_t>(src, indices, dst);
+    } else if (dtype == Dtype::Float32) {
+        AccumulateRowsCUDA<float>(src, indices, dst);
+    } else if (dtype == Dtype::Float64) {
+        AccumulateRowsCUDA<double>(src, indices, dst);
+    } else {
+        utility::LogError("IndexAdd: unsupported dtype {}.", dtype.ToString());
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #include "open3d/core/kernel/Kernel.h"
 
 #include <cmath>
+#include <tuple>
 #include <vector>
 
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
@@ -65,6 +66,32 @@ void TestLinalgIntegration() {
     utility::LogInfo("TestLapack Done.");
 }
 
+utility::Counter& GetDeviceCounter(const char* name,
+                                   const Device& device,
+                                   const std::string& help) {
+    // Linear scan, as a thread only ever sees a handful of counters.
+    thread_local std::vector<std::tuple<const char*, Device, utility::Counter*>>
+            cache;
+    for (const auto& entry : cache) {
+        if (std::get<0>(entry) == name && std::get<1>(entry) == device) {
+            return *std::get<2>(entry);
+        }
+    }
+    utility::Counter& counter = utility::Metrics::GetCounter(
+            name, {{"device", device.ToString()}}, help);
+    cache.emplace_back(name, device, &counter);
+    return counter;
+}
+
+void RecordKernelLaunch(const Device& device, int64_t num_elements) {
+    GetDeviceCounter("open3d_core_kernel_launches_total", device,
+                     "Number of core kernels launched.")
+            .Add();
+    GetDeviceCounter("open3d_core_kernel_elements_total", device,
+                     "Number of elements processed by core kernels.")
+            .Add(num_elements);
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
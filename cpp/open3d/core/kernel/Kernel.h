@@ -26,11 +26,17 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string>
+
+#include "open3d/core/Device.h"
 #include "open3d/core/kernel/BinaryEW.h"
 #include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/core/kernel/NonZero.h"
 #include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/Sort.h"
 #include "open3d/core/kernel/UnaryEW.h"
+#include "open3d/utility/Metrics.h"
 
 namespace open3d {
 namespace core {
@@ -38,6 +44,17 @@ namespace kernel {
 
 void TestLinalgIntegration();
 
+/// Returns the metrics counter \p name labeled with \p device. Lookups are
+/// cached per thread, so this is cheap enough to call on every kernel launch.
+/// \p name must be a string literal or otherwise outlive the process.
+utility::Counter& GetDeviceCounter(const char* name,
+                                   const Device& device,
+                                   const std::string& help);
+
+/// Counts a kernel launch over \p num_elements elements on \p device, see
+/// utility::Metrics.
+void RecordKernelLaunch(const Device& device, int64_t num_elements);
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
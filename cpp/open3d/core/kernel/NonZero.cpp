@@ -28,6 +28,7 @@
 
 #include "open3d/core/Device.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -35,6 +36,7 @@ namespace core {
 namespace kernel {
 
 Tensor NonZero(const Tensor& src) {
+    RecordKernelLaunch(src.GetDevice(), src.NumElements());
     Device::DeviceType device_type = src.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         return NonZeroCPU(src);
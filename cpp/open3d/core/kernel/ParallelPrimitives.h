@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Device kernels of the primitives in core/ParallelPrimitives.h. All tensors
+// are contiguous and on the same device, and the inputs are validated by the
+// callers.
+
+/// \p src and \p dst are 1D with the same dtype and length.
+void ScanCPU(const Tensor& src, Tensor& dst, bool exclusive);
+
+/// \p keys is 1D, \p permutation is Int64 with the same length.
+void ArgSortCPU(const Tensor& keys, Tensor& permutation);
+
+/// \p mask is 1D Bool.
+Tensor CompactIndicesCPU(const Tensor& mask);
+
+/// \p src is {N, C}, \p offsets is Int64 {S + 1} and \p dst is {S, C}.
+void SegmentedReduceCPU(const Tensor& src,
+                        const Tensor& offsets,
+                        Tensor& dst,
+                        ReductionOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void ScanCUDA(const Tensor& src, Tensor& dst, bool exclusive);
+
+void ArgSortCUDA(const Tensor& keys, Tensor& permutation);
+
+Tensor CompactIndicesCUDA(const Tensor& mask);
+
+void SegmentedReduceCUDA(const Tensor& src,
+                         const Tensor& offsets,
+                         Tensor& dst,
+                         ReductionOpCode op_code);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
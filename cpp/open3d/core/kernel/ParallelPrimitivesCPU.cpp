@@ -0,0 +1,331 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/ParallelPrimitives.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Minimum number of elements per chunk of the multi-pass primitives.
+static constexpr int64_t kPrimitiveGrainSize = 32768;
+
+/// Returns the number of chunks that [0, n) is split into. Each chunk is
+/// processed by one worker in every pass, so results of earlier passes can be
+/// kept per chunk.
+static int64_t NumChunks(int64_t n) {
+    if (InParallel()) {
+        return 1;
+    }
+    return std::max<int64_t>(
+            1, std::min<int64_t>(n / kPrimitiveGrainSize, GetMaxThreads()));
+}
+
+void ScanCPU(const Tensor& src, Tensor& dst, bool exclusive) {
+    int64_t n = src.GetLength();
+    int64_t num_chunks = NumChunks(n);
+    int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+
+        // First pass: the sum of each chunk, turned into the sum of all
+        // elements before the chunk.
+        std::vector<scalar_t> chunk_offsets(num_chunks, 0);
+        if (num_chunks > 1) {
+            utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+                int64_t start = chunk_idx * chunk_size;
+                int64_t end = std::min(start + chunk_size, n);
+                scalar_t sum = 0;
+                for (int64_t i = start; i < end; ++i) {
+                    sum += src_ptr[i];
+                }
+                chunk_offsets[chunk_idx] = sum;
+            });
+            scalar_t carry = 0;
+            for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+                scalar_t chunk_sum = chunk_offsets[chunk_idx];
+                chunk_offsets[chunk_idx] = carry;
+                carry += chunk_sum;
+            }
+        }
+
+        // Second pass: scan each chunk starting from its offset.
+        utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+            int64_t start = chunk_idx * chunk_size;
+            int64_t end = std::min(start + chunk_size, n);
+            scalar_t sum = chunk_offsets[chunk_idx];
+            if (exclusive) {
+                for (int64_t i = start; i < end; ++i) {
+                    dst_ptr[i] = sum;
+                    sum += src_ptr[i];
+                }
+            } else {
+                for (int64_t i = start; i < end; ++i) {
+                    sum += src_ptr[i];
+                    dst_ptr[i] = sum;
+                }
+            }
+        });
+    });
+}
+
+/// Maps keys to unsigned integers of the same size and order, which can be
+/// radix sorted.
+template <typename scalar_t>
+struct RadixKey {
+    using bits_t = typename std::conditional<
+            sizeof(scalar_t) == 1,
+            uint8_t,
+            typename std::conditional<
+                    sizeof(scalar_t) == 2,
+                    uint16_t,
+                    typename std::conditional<sizeof(scalar_t) == 4,
+                                              uint32_t,
+                                              uint64_t>::type>::type>::type;
+
+    static bits_t ToBits(scalar_t key) {
+        static constexpr bits_t kSignBit = bits_t(1)
+                                           << (sizeof(bits_t) * 8 - 1);
+        if (std::is_floating_point<scalar_t>::value && key == scalar_t(0)) {
+            // -0.0 and +0.0 compare equal and must keep their order.
+            key = scalar_t(0);
+        }
+        bits_t bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        if (std::is_floating_point<scalar_t>::value) {
+            // Negative floats are ordered by decreasing magnitude.
+            return (bits & kSignBit) ? bits_t(~bits) : bits_t(bits | kSignBit);
+        } else if (std::is_signed<scalar_t>::value) {
+            return bits_t(bits ^ kSignBit);
+        } else {
+            return bits;
+        }
+    }
+};
+
+/// Stable least-significant-digit radix sort of the indices of \p keys. Each
+/// pass counts the digits of every chunk in parallel, then scatters each
+/// chunk in parallel to its precomputed offsets. Passes in which all keys
+/// share the same digit are skipped.
+template <typename scalar_t>
+static void RadixArgSortCPU(const scalar_t* keys,
+                            int64_t n,
+                            int64_t* permutation) {
+    using bits_t = typename RadixKey<scalar_t>::bits_t;
+    static constexpr int kRadixBits = 8;
+    static constexpr int64_t kRadix = int64_t(1) << kRadixBits;
+
+    int64_t num_chunks = NumChunks(n);
+    int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<bits_t> bits(n);
+    std::vector<bits_t> bits_alt(n);
+    std::vector<int64_t> indices_alt(n);
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        int64_t start = chunk_idx * chunk_size;
+        int64_t end = std::min(start + chunk_size, n);
+        for (int64_t i = start; i < end; ++i) {
+            bits[i] = RadixKey<scalar_t>::ToBits(keys[i]);
+            permutation[i] = i;
+        }
+    });
+
+    bits_t* src_bits = bits.data();
+    bits_t* dst_bits = bits_alt.data();
+    int64_t* src_indices = permutation;
+    int64_t* dst_indices = indices_alt.data();
+    std::vector<int64_t> offsets(num_chunks * kRadix);
+    for (int shift = 0; shift < static_cast<int>(sizeof(bits_t) * 8);
+         shift += kRadixBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+            int64_t start = chunk_idx * chunk_size;
+            int64_t end = std::min(start + chunk_size, n);
+            int64_t* histogram = offsets.data() + chunk_idx * kRadix;
+            for (int64_t i = start; i < end; ++i) {
+                ++histogram[(src_bits[i] >> shift) & (kRadix - 1)];
+            }
+        });
+
+        // Exclusive scan over digits, then chunks, which keeps the sort
+        // stable. A digit with n elements means the pass is a no-op.
+        bool skip_pass = false;
+        int64_t offset = 0;
+        for (int64_t digit = 0; digit < kRadix && !skip_pass; ++digit) {
+            int64_t digit_start = offset;
+            for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+                int64_t count = offsets[chunk_idx * kRadix + digit];
+                offsets[chunk_idx * kRadix + digit] = offset;
+                offset += count;
+            }
+            skip_pass = offset - digit_start == n;
+        }
+        if (skip_pass) {
+            continue;
+        }
+
+        utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+            int64_t start = chunk_idx * chunk_size;
+            int64_t end = std::min(start + chunk_size, n);
+            int64_t* chunk_offsets = offsets.data() + chunk_idx * kRadix;
+            for (int64_t i = start; i < end; ++i) {
+                int64_t pos =
+                        chunk_offsets[(src_bits[i] >> shift) & (kRadix - 1)]++;
+                dst_bits[pos] = src_bits[i];
+                dst_indices[pos] = src_indices[i];
+            }
+        });
+        std::swap(src_bits, dst_bits);
+        std::swap(src_indices, dst_indices);
+    }
+    if (src_indices != permutation) {
+        std::copy(src_indices, src_indices + n, permutation);
+    }
+}
+
+void ArgSortCPU(const Tensor& keys, Tensor& permutation) {
+    DISPATCH_DTYPE_TO_TEMPLATE(keys.GetDtype(), [&]() {
+        RadixArgSortCPU(keys.GetDataPtr<scalar_t>(), keys.GetLength(),
+                        permutation.GetDataPtr<int64_t>());
+    });
+}
+
+Tensor CompactIndicesCPU(const Tensor& mask) {
+    int64_t n = mask.GetLength();
+    int64_t num_chunks = NumChunks(n);
+    int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+
+    // chunk_offsets[i + 1] is the number of true elements in chunk i, and
+    // then the number of true elements before chunk i + 1.
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        int64_t start = chunk_idx * chunk_size;
+        int64_t end = std::min(start + chunk_size, n);
+        chunk_offsets[chunk_idx + 1] =
+                std::count(mask_ptr + start, mask_ptr + end, true);
+    });
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        chunk_offsets[chunk_idx + 1] += chunk_offsets[chunk_idx];
+    }
+
+    Tensor indices({chunk_offsets[num_chunks]}, Dtype::Int64, mask.GetDevice());
+    int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        int64_t start = chunk_idx * chunk_size;
+        int64_t end = std::min(start + chunk_size, n);
+        int64_t pos = chunk_offsets[chunk_idx];
+        for (int64_t i = start; i < end; ++i) {
+            if (mask_ptr[i]) {
+                indices_ptr[pos++] = i;
+            }
+        }
+    });
+    return indices;
+}
+
+template <typename scalar_t, typename func_t>
+static void ReduceSegmentsCPU(const scalar_t* src_ptr,
+                              const int64_t* offsets_ptr,
+                              scalar_t* dst_ptr,
+                              int64_t num_segments,
+                              int64_t num_cols,
+                              scalar_t identity,
+                              func_t reduce) {
+    utility::ParallelFor(0, num_segments, [&](int64_t segment) {
+        scalar_t* dst_row = dst_ptr + segment * num_cols;
+        std::fill(dst_row, dst_row + num_cols, identity);
+        for (int64_t row = offsets_ptr[segment]; row < offsets_ptr[segment + 1];
+             ++row) {
+            const scalar_t* src_row = src_ptr + row * num_cols;
+            for (int64_t col = 0; col < num_cols; ++col) {
+                dst_row[col] = reduce(dst_row[col], src_row[col]);
+            }
+        }
+    });
+}
+
+void SegmentedReduceCPU(const Tensor& src,
+                        const Tensor& offsets,
+                        Tensor& dst,
+                        ReductionOpCode op_code) {
+    int64_t num_segments = dst.GetShape(0);
+    int64_t num_cols = dst.GetShape(1);
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                ReduceSegmentsCPU(
+                        src_ptr, offsets_ptr, dst_ptr, num_segments, num_cols,
+                        scalar_t(0), [](scalar_t a, scalar_t b) -> scalar_t {
+                            return a + b;
+                        });
+                break;
+            case ReductionOpCode::Prod:
+                ReduceSegmentsCPU(
+                        src_ptr, offsets_ptr, dst_ptr, num_segments, num_cols,
+                        scalar_t(1), [](scalar_t a, scalar_t b) -> scalar_t {
+                            return a * b;
+                        });
+                break;
+            case ReductionOpCode::Min:
+                ReduceSegmentsCPU(src_ptr, offsets_ptr, dst_ptr, num_segments,
+                                  num_cols,
+                                  std::numeric_limits<scalar_t>::max(),
+                                  [](scalar_t a, scalar_t b) {
+                                      return std::min(a, b);
+                                  });
+                break;
+            case ReductionOpCode::Max:
+                ReduceSegmentsCPU(src_ptr, offsets_ptr, dst_ptr, num_segments,
+                                  num_cols,
+                                  std::numeric_limits<scalar_t>::lowest(),
+                                  [](scalar_t a, scalar_t b) {
+                                      return std::max(a, b);
+                                  });
+                break;
+            default:
+                utility::LogError("Unsupported segmented reduction op.");
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,218 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cub/cub.cuh>
+#include <limits>
+
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/core/kernel/ParallelPrimitives.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// CUB's device-wide algorithms take the number of items as int.
+static int ToNumItems(int64_t n) {
+    if (n > std::numeric_limits<int>::max()) {
+        utility::LogError("CUB primitives support at most {} elements, got {}.",
+                          std::numeric_limits<int>::max(), n);
+    }
+    return static_cast<int>(n);
+}
+
+/// Runs the CUB device-wide algorithm func(temp_storage, temp_bytes) twice:
+/// once to query the size of its temporary storage, and once to run it.
+template <typename func_t>
+static void RunCUBAlgorithm(const Device& device, func_t func) {
+    size_t temp_bytes = 0;
+    OPEN3D_CUDA_CHECK(func(nullptr, temp_bytes));
+    Tensor temp_storage({std::max<int64_t>(1, temp_bytes)}, Dtype::UInt8,
+                        device);
+    OPEN3D_CUDA_CHECK(func(temp_storage.GetDataPtr(), temp_bytes));
+}
+
+void ScanCUDA(const Tensor& src, Tensor& dst, bool exclusive) {
+    int num_items = ToNumItems(src.GetLength());
+    cudaStream_t stream = CUDAStream::GetCurrent().Get();
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        RunCUBAlgorithm(src.GetDevice(),
+                        [&](void* temp_storage, size_t& temp_bytes) {
+                            if (exclusive) {
+                                return cub::DeviceScan::ExclusiveSum(
+                                        temp_storage, temp_bytes, src_ptr,
+                                        dst_ptr, num_items, stream);
+                            } else {
+                                return cub::DeviceScan::InclusiveSum(
+                                        temp_storage, temp_bytes, src_ptr,
+                                        dst_ptr, num_items, stream);
+                            }
+                        });
+    });
+}
+
+void ArgSortCUDA(const Tensor& keys, Tensor& permutation) {
+    int num_items = ToNumItems(keys.GetLength());
+    cudaStream_t stream = CUDAStream::GetCurrent().Get();
+    Tensor indices = Tensor::Arange(0, keys.GetLength(), 1, Dtype::Int64,
+                                    keys.GetDevice());
+    Tensor sorted_keys = Tensor::EmptyLike(keys);
+    DISPATCH_DTYPE_TO_TEMPLATE(keys.GetDtype(), [&]() {
+        const scalar_t* keys_ptr = keys.GetDataPtr<scalar_t>();
+        scalar_t* sorted_keys_ptr = sorted_keys.GetDataPtr<scalar_t>();
+        const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+        int64_t* permutation_ptr = permutation.GetDataPtr<int64_t>();
+        RunCUBAlgorithm(keys.GetDevice(), [&](void* temp_storage,
+                                              size_t& temp_bytes) {
+            return cub::DeviceRadixSort::SortPairs(
+                    temp_storage, temp_bytes, keys_ptr, sorted_keys_ptr,
+                    indices_ptr, permutation_ptr, num_items, 0,
+                    static_cast<int>(sizeof(scalar_t) * 8), stream);
+        });
+    });
+}
+
+Tensor CompactIndicesCUDA(const Tensor& mask) {
+    int num_items = ToNumItems(mask.GetLength());
+    cudaStream_t stream = CUDAStream::GetCurrent().Get();
+    Tensor indices({mask.GetLength()}, Dtype::Int64, mask.GetDevice());
+    Tensor num_selected({}, Dtype::Int32, mask.GetDevice());
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+    int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    int* num_selected_ptr = num_selected.GetDataPtr<int>();
+    RunCUBAlgorithm(mask.GetDevice(), [&](void* temp_storage,
+                                          size_t& temp_bytes) {
+        cub::CountingInputIterator<int64_t> counting_iter(0);
+        return cub::DeviceSelect::Flagged(temp_storage, temp_bytes,
+                                          counting_iter, mask_ptr, indices_ptr,
+                                          num_selected_ptr, num_items, stream);
+    });
+    return indices.Slice(0, 0, num_selected.Item<int>());
+}
+
+struct SumOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(const T& a, const T& b) const {
+        return a + b;
+    }
+};
+
+struct ProdOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(const T& a, const T& b) const {
+        return a * b;
+    }
+};
+
+struct MinOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(const T& a, const T& b) const {
+        return b < a ? b : a;
+    }
+};
+
+struct MaxOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(const T& a, const T& b) const {
+        return a < b ? b : a;
+    }
+};
+
+/// Single-column segments are reduced with CUB, one thread block per segment.
+/// Otherwise, one thread reduces one column of one segment.
+template <typename scalar_t, typename op_t>
+static void ReduceSegmentsCUDA(const Tensor& src,
+                               const Tensor& offsets,
+                               Tensor& dst,
+                               scalar_t identity,
+                               op_t op) {
+    int64_t num_segments = dst.GetShape(0);
+    int64_t num_cols = dst.GetShape(1);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+    if (num_cols == 1) {
+        int num_items = ToNumItems(num_segments);
+        cudaStream_t stream = CUDAStream::GetCurrent().Get();
+        RunCUBAlgorithm(src.GetDevice(), [&](void* temp_storage,
+                                             size_t& temp_bytes) {
+            return cub::DeviceSegmentedReduce::Reduce(
+                    temp_storage, temp_bytes, src_ptr, dst_ptr, num_items,
+                    offsets_ptr, offsets_ptr + 1, op, identity, stream);
+        });
+    } else {
+        CUDALauncher::LaunchGeneralKernel(
+                num_segments * num_cols,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t segment = workload_idx / num_cols;
+                    int64_t col = workload_idx % num_cols;
+                    scalar_t acc = identity;
+                    for (int64_t row = offsets_ptr[segment];
+                         row < offsets_ptr[segment + 1]; ++row) {
+                        acc = op(acc, src_ptr[row * num_cols + col]);
+                    }
+                    dst_ptr[workload_idx] = acc;
+                });
+    }
+}
+
+void SegmentedReduceCUDA(const Tensor& src,
+                         const Tensor& offsets,
+                         Tensor& dst,
+                         ReductionOpCode op_code) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                ReduceSegmentsCUDA(src, offsets, dst, scalar_t(0), SumOp());
+                break;
+            case ReductionOpCode::Prod:
+                ReduceSegmentsCUDA(src, offsets, dst, scalar_t(1), ProdOp());
+                break;
+            case ReductionOpCode::Min:
+                ReduceSegmentsCUDA(src, offsets, dst,
+                                   std::numeric_limits<scalar_t>::max(),
+                                   MinOp());
+                break;
+            case ReductionOpCode::Max:
+                ReduceSegmentsCUDA(src, offsets, dst,
+                                   std::numeric_limits<scalar_t>::lowest(),
+                                   MaxOp());
+                break;
+            default:
+                utility::LogError("Unsupported segmented reduction op.");
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
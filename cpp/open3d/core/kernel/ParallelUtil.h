@@ -26,24 +26,24 @@
 
 #pragma once
 
+#include "open3d/utility/Parallel.h"
+
 namespace open3d {
 namespace core {
 namespace kernel {
 
-inline int GetMaxThreads() {
-#ifdef _OPENMP
-    return omp_get_max_threads();
-#else
-    return 1;
-#endif
-}
+/// Returns the number of workers of the parallel executor, see
+/// utility::GetParallelExecutor().
+inline int GetMaxThreads() { return utility::GetMaxParallelism(); }
 
+/// Returns true if called from within a parallel loop.
 inline bool InParallel() {
 #ifdef _OPENMP
-    return omp_in_parallel();
-#else
-    return false;
+    if (omp_in_parallel()) {
+        return true;
+    }
 #endif
+    return utility::InParallelRegion();
 }
 
 }  // namespace kernel
@@ -26,7 +26,11 @@
 
 #include "open3d/core/kernel/Reduction.h"
 
+#include <string>
+#include <vector>
+
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/Kernel.h"
 
 namespace open3d {
 namespace core {
@@ -77,6 +81,21 @@ void Reduction(const Tensor& src,
         return;
     }
 
+    // 16-bit floats accumulate in Float32, since summing many of them in 16
+    // bits quickly loses all precision.
+    Dtype src_dtype = src.GetDtype();
+    if (src_dtype == Dtype::Float16 || src_dtype == Dtype::BFloat16) {
+        Tensor src_float = src.To(Dtype::Float32);
+        if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
+            Tensor dst_float(dst.GetShape(), Dtype::Float32, dst.GetDevice());
+            Reduction(src_float, dst_float, dims, keepdim, op_code);
+            dst.AsRvalue() = dst_float;
+        } else {
+            Reduction(src_float, dst, dims, keepdim, op_code);
+        }
+        return;
+    }
+
     // Always reshape to keepdim case. This reshaping is copy-free.
     if (!keepdim) {
         dst = dst.Reshape(keepdim_shape);
@@ -88,6 +107,7 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
+    RecordKernelLaunch(src.GetDevice(), src.NumElements());
     Device::DeviceType device_type = src.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         ReductionCPU(src, dst, dims, keepdim, op_code);
@@ -106,6 +126,96 @@ void Reduction(const Tensor& src,
     }
 }
 
+/// Multi-output reductions take a contiguous (N, D) matrix with N > 0, and
+/// contiguous outputs of shape (D,) or (D, D) with the same dtype and device.
+static void AssertMultiOutputReduction(const std::string& func_name,
+                                       const Tensor& src,
+                                       const std::vector<Tensor>& dsts) {
+    if (src.NumDims() != 2 || !src.IsContiguous()) {
+        utility::LogError(
+                "{}: expected a contiguous (N, D) tensor, but got shape {}.",
+                func_name, src.GetShape().ToString());
+    }
+    if (src.GetShape(0) == 0) {
+        utility::LogError("{}: zero-size Tensor is not supported.", func_name);
+    }
+    for (const Tensor& dst : dsts) {
+        if (!dst.IsContiguous() || dst.GetDtype() != src.GetDtype() ||
+            dst.GetDevice() != src.GetDevice() ||
+            dst.GetShape(0) != src.GetShape(1)) {
+            utility::LogError(
+                    "{}: output with shape {}, dtype {} and device {} does "
+                    "not match the input.",
+                    func_name, dst.GetShape().ToString(),
+                    dst.GetDtype().ToString(), dst.GetDevice().ToString());
+        }
+    }
+}
+
+void MinMax(const Tensor& src, Tensor& min, Tensor& max) {
+    AssertMultiOutputReduction(__FUNCTION__, src, {min, max});
+
+    Dtype dtype = src.GetDtype();
+    if (dtype == Dtype::Float16 || dtype == Dtype::BFloat16) {
+        Tensor src_float = src.To(Dtype::Float32);
+        Tensor min_float = min.To(Dtype::Float32);
+        Tensor max_float = max.To(Dtype::Float32);
+        MinMax(src_float, min_float, max_float);
+        min.AsRvalue() = min_float;
+        max.AsRvalue() = max_float;
+        return;
+    }
+
+    RecordKernelLaunch(src.GetDevice(), src.NumElements());
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MinMaxCPU(src, min, max);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MinMaxCUDA(src, min, max);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void MeanAndCovariance(const Tensor& src, Tensor& mean, Tensor& covariance) {
+    AssertMultiOutputReduction(__FUNCTION__, src, {mean, covariance});
+
+    Dtype dtype = src.GetDtype();
+    if (dtype == Dtype::Float16 || dtype == Dtype::BFloat16) {
+        Tensor src_float = src.To(Dtype::Float32);
+        Tensor mean_float = mean.To(Dtype::Float32);
+        Tensor covariance_float = covariance.To(Dtype::Float32);
+        MeanAndCovariance(src_float, mean_float, covariance_float);
+        mean.AsRvalue() = mean_float;
+        covariance.AsRvalue() = covariance_float;
+        return;
+    }
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "MeanAndCovariance: only supports floating point dtypes, but "
+                "{} is used.",
+                dtype.ToString());
+    }
+
+    RecordKernelLaunch(src.GetDevice(), src.NumElements());
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MeanAndCovarianceCPU(src, mean, covariance);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MeanAndCovarianceCUDA(src, mean, covariance);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -86,6 +86,52 @@ void ReductionCUDA(const Tensor& src,
                    ReductionOpCode op_code);
 #endif
 
+/// Multi-output reductions read the input once and compute several results
+/// per column of a contiguous (N, D) matrix.
+///
+/// MinMax computes the per-column minimum and maximum into \p min and \p max
+/// of shape (D,), with the same dtype as \p src.
+void MinMax(const Tensor& src, Tensor& min, Tensor& max);
+
+/// MeanAndCovariance computes the mean of shape (D,) and the covariance of
+/// shape (D, D), normalized by N, of the N rows of a Float32 or Float64
+/// \p src. The outputs have the same dtype as \p src.
+void MeanAndCovariance(const Tensor& src, Tensor& mean, Tensor& covariance);
+
+/// Computes the mean and covariance of MeanAndCovariance on the host, from
+/// the num_cols sums followed by the num_cols * (num_cols + 1) / 2 row-major
+/// upper-triangle sums of products of the rows shifted by \p shift.
+template <typename scalar_t>
+inline void FinalizeMeanAndCovariance(const double* accs,
+                                      const scalar_t* shift,
+                                      int64_t num_rows,
+                                      int64_t num_cols,
+                                      scalar_t* mean,
+                                      scalar_t* covariance) {
+    const double* products = accs + num_cols;
+    for (int64_t i = 0; i < num_cols; ++i) {
+        double mean_i = accs[i] / num_rows;
+        mean[i] = static_cast<scalar_t>(shift[i] + mean_i);
+        for (int64_t j = i; j < num_cols; ++j) {
+            double mean_j = accs[j] / num_rows;
+            scalar_t c = static_cast<scalar_t>(*products++ / num_rows -
+                                               mean_i * mean_j);
+            covariance[i * num_cols + j] = c;
+            covariance[j * num_cols + i] = c;
+        }
+    }
+}
+
+void MinMaxCPU(const Tensor& src, Tensor& min, Tensor& max);
+
+void MeanAndCovarianceCPU(const Tensor& src, Tensor& mean, Tensor& covariance);
+
+#ifdef BUILD_CUDA_MODULE
+void MinMaxCUDA(const Tensor& src, Tensor& min, Tensor& max);
+
+void MeanAndCovarianceCUDA(const Tensor& src, Tensor& mean, Tensor& covariance);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,14 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/VectorizedCPU.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -136,8 +140,7 @@ private:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        utility::ParallelFor(0, num_threads, [&](int64_t thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
             for (int64_t workload_idx = start; workload_idx < end;
@@ -147,7 +150,7 @@ private:
                 thread_results[thread_idx] =
                         element_kernel(*src, thread_results[thread_idx]);
             }
-        }
+        });
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             *dst = element_kernel(thread_results[thread_idx], *dst);
@@ -182,12 +185,11 @@ private:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+        utility::ParallelFor(0, indexer_shape[best_dim], [&](int64_t i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
             LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        });
     }
 
 private:
@@ -208,9 +210,7 @@ public:
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
 
-#pragma omp parallel for schedule(static)
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
+        utility::ParallelFor(0, num_output_elements, [&](int64_t output_idx) {
             // sub_indexer.NumWorkloads() == ipo.
             // sub_indexer's workload_idx is indexer_'s ipo_idx.
             Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
@@ -225,7 +225,7 @@ public:
                 std::tie(*dst_idx, dst_val) =
                         reduce_func(src_idx, *src_val, *dst_idx, dst_val);
             }
-        }
+        });
     }
 
 private:
@@ -237,6 +237,9 @@ void ReductionCPU(const Tensor& src,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
+    if (ReductionVectorizedCPU(src, dst, dims, op_code)) {
+        return;
+    }
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
@@ -347,6 +350,128 @@ void ReductionCPU(const Tensor& src,
     }
 }
 
+// Minimum number of input elements reduced by each thread.
+static constexpr int64_t kMultiOutputGrainSize = 32768;
+
+/// Reduces the rows of a (num_rows, num_cols) matrix into num_accs
+/// accumulators. Each thread reduces a contiguous chunk of rows into its own
+/// accumulators, which are then combined in order.
+///
+/// init(acc_t* accs) sets the identities, accumulate(int64_t row, acc_t* accs)
+/// reduces one row, and combine(acc_t* accs, const acc_t* other) merges the
+/// accumulators of another chunk.
+template <typename acc_t,
+          typename init_func_t,
+          typename accumulate_func_t,
+          typename combine_func_t>
+static std::vector<acc_t> MultiOutputReduceRowsCPU(
+        int64_t num_rows,
+        int64_t num_cols,
+        int64_t num_accs,
+        init_func_t init,
+        accumulate_func_t accumulate,
+        combine_func_t combine) {
+    int64_t num_chunks = 1;
+    if (!InParallel()) {
+        int64_t num_elements = num_rows * num_cols;
+        num_chunks = std::max<int64_t>(
+                1, std::min<int64_t>(num_elements / kMultiOutputGrainSize,
+                                     GetMaxThreads()));
+    }
+    int64_t rows_per_chunk = (num_rows + num_chunks - 1) / num_chunks;
+    std::vector<acc_t> accs(num_chunks * num_accs);
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        acc_t* chunk_accs = accs.data() + chunk_idx * num_accs;
+        init(chunk_accs);
+        int64_t start = chunk_idx * rows_per_chunk;
+        int64_t end = std::min(start + rows_per_chunk, num_rows);
+        for (int64_t row = start; row < end; ++row) {
+            accumulate(row, chunk_accs);
+        }
+    });
+    for (int64_t chunk_idx = 1; chunk_idx < num_chunks; ++chunk_idx) {
+        combine(accs.data(), accs.data() + chunk_idx * num_accs);
+    }
+    accs.resize(num_accs);
+    return accs;
+}
+
+void MinMaxCPU(const Tensor& src, Tensor& min, Tensor& max) {
+    int64_t num_rows = src.GetShape(0);
+    int64_t num_cols = src.GetShape(1);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        std::vector<scalar_t> accs = MultiOutputReduceRowsCPU<scalar_t>(
+                num_rows, num_cols, 2 * num_cols,
+                [&](scalar_t* accs) {
+                    std::fill(accs, accs + num_cols,
+                              std::numeric_limits<scalar_t>::max());
+                    std::fill(accs + num_cols, accs + 2 * num_cols,
+                              std::numeric_limits<scalar_t>::lowest());
+                },
+                [&](int64_t row, scalar_t* accs) {
+                    const scalar_t* row_ptr = src_ptr + row * num_cols;
+                    for (int64_t col = 0; col < num_cols; ++col) {
+                        accs[col] = std::min(accs[col], row_ptr[col]);
+                        accs[num_cols + col] =
+                                std::max(accs[num_cols + col], row_ptr[col]);
+                    }
+                },
+                [&](scalar_t* accs, const scalar_t* other) {
+                    for (int64_t col = 0; col < num_cols; ++col) {
+                        accs[col] = std::min(accs[col], other[col]);
+                        accs[num_cols + col] = std::max(accs[num_cols + col],
+                                                        other[num_cols + col]);
+                    }
+                });
+        std::copy(accs.begin(), accs.begin() + num_cols,
+                  min.GetDataPtr<scalar_t>());
+        std::copy(accs.begin() + num_cols, accs.end(),
+                  max.GetDataPtr<scalar_t>());
+    });
+}
+
+void MeanAndCovarianceCPU(const Tensor& src, Tensor& mean, Tensor& covariance) {
+    int64_t num_rows = src.GetShape(0);
+    int64_t num_cols = src.GetShape(1);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        // Accumulates the sums and the sums of products of the rows shifted
+        // by the first row, in double. Shifting avoids the catastrophic
+        // cancellation of E[xx^T] - E[x]E[x]^T for data far from the origin.
+        // Only the upper triangle of the products is accumulated.
+        int64_t num_products = num_cols * (num_cols + 1) / 2;
+        std::vector<double> accs = MultiOutputReduceRowsCPU<double>(
+                num_rows, num_cols, num_cols + num_products,
+                [&](double* accs) {
+                    std::fill(accs, accs + num_cols + num_products, 0.0);
+                },
+                [&](int64_t row, double* accs) {
+                    const scalar_t* row_ptr = src_ptr + row * num_cols;
+                    double* products = accs + num_cols;
+                    for (int64_t i = 0; i < num_cols; ++i) {
+                        double xi = static_cast<double>(row_ptr[i]) -
+                                    static_cast<double>(src_ptr[i]);
+                        accs[i] += xi;
+                        for (int64_t j = i; j < num_cols; ++j) {
+                            double xj = static_cast<double>(row_ptr[j]) -
+                                        static_cast<double>(src_ptr[j]);
+                            *products++ += xi * xj;
+                        }
+                    }
+                },
+                [&](double* accs, const double* other) {
+                    for (int64_t k = 0; k < num_cols + num_products; ++k) {
+                        accs[k] += other[k];
+                    }
+                });
+
+        FinalizeMeanAndCovariance(accs.data(), src_ptr, num_rows, num_cols,
+                                  mean.GetDataPtr<scalar_t>(),
+                                  covariance.GetDataPtr<scalar_t>());
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
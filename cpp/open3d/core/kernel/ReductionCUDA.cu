@@ -34,9 +34,11 @@
 #include <sstream>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAStream.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dispatch.h"
@@ -1000,8 +1002,8 @@ private:
         // Launch reduce kernel
         int shared_memory = config.SharedMemorySize();
         ReduceKernel<ReduceConfig::MAX_NUM_THREADS>
-                <<<config.GridDim(), config.BlockDim(), shared_memory>>>(
-                        reduce_op);
+                <<<config.GridDim(), config.BlockDim(), shared_memory,
+                  CUDAStream::GetCurrent().Get()>>>(reduce_op);
         OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
@@ -1148,6 +1150,230 @@ void ReductionCUDA(const Tensor& src,
     }
 }
 
+// Multi-output reductions of the rows of a (num_rows, num_cols) matrix.
+//
+// Each thread keeps its accumulators in shared memory, strided by the block
+// size to avoid bank conflicts, and reduces a grid-stride range of rows. The
+// accumulators are then tree-reduced with warp shuffles, first within each
+// warp and then across the warps of the block by the first warp. Each block
+// writes one partial result per accumulator, and the few partials are combined
+// on the host.
+//
+// An op_t provides NumAccs(), Identity(k), Accumulate(row, accs, stride) and
+// Combine(k, a, b) for the k-th accumulator.
+static constexpr int kMultiOutputMaxThreads = 256;
+static constexpr int64_t kMultiOutputMaxBlocks = 256;
+static constexpr int64_t kMultiOutputMaxSharedMemory = 48 * 1024;
+
+// Whether the accumulators of a warp fit in the shared memory.
+static bool FitsMultiOutputSharedMemory(int64_t num_accs, int64_t acc_size) {
+    return num_accs * acc_size * 32 <= kMultiOutputMaxSharedMemory;
+}
+
+template <typename acc_t, typename op_t>
+__global__ void MultiOutputReduceKernel(op_t op,
+                                        int64_t num_rows,
+                                        acc_t* partials) {
+    extern __shared__ __align__(sizeof(double)) unsigned char shared_bytes[];
+    acc_t* block_accs = reinterpret_cast<acc_t*>(shared_bytes);
+    acc_t* accs = block_accs + threadIdx.x;
+    const int stride = blockDim.x;
+    const int num_accs = op.NumAccs();
+
+    for (int k = 0; k < num_accs; ++k) {
+        accs[k * stride] = op.Identity(k);
+    }
+    for (int64_t row = blockIdx.x * blockDim.x + threadIdx.x; row < num_rows;
+         row += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+        op.Accumulate(row, accs, stride);
+    }
+
+    // Reduce within each warp. Lane 0 stores the result in its own slot.
+    const int lane = threadIdx.x % warpSize;
+    const int warp = threadIdx.x / warpSize;
+    for (int k = 0; k < num_accs; ++k) {
+        acc_t value = accs[k * stride];
+        for (int offset = warpSize / 2; offset > 0; offset >>= 1) {
+            value = op.Combine(k, value, WARP_SHFL_DOWN(value, offset));
+        }
+        if (lane == 0) {
+            accs[k * stride] = value;
+        }
+    }
+    __syncthreads();
+
+    // Reduce the results of the warps with the first warp.
+    if (warp == 0) {
+        const int num_warps = blockDim.x / warpSize;
+        for (int k = 0; k < num_accs; ++k) {
+            acc_t value = lane < num_warps
+                                  ? block_accs[k * stride + lane * warpSize]
+                                  : op.Identity(k);
+            for (int offset = warpSize / 2; offset > 0; offset >>= 1) {
+                value = op.Combine(k, value, WARP_SHFL_DOWN(value, offset));
+            }
+            if (lane == 0) {
+                partials[blockIdx.x * num_accs + k] = value;
+            }
+        }
+    }
+}
+
+template <typename acc_t, typename op_t>
+static std::vector<acc_t> MultiOutputReduceRowsCUDA(const Tensor& src,
+                                                    const op_t& op) {
+    int64_t num_rows = src.GetShape(0);
+    int num_accs = op.NumAccs();
+    int threads = kMultiOutputMaxThreads;
+    while (threads > 32 && threads * num_accs * sizeof(acc_t) >
+                                   kMultiOutputMaxSharedMemory) {
+        threads /= 2;
+    }
+    int64_t blocks = std::min(kMultiOutputMaxBlocks, DivUp(num_rows, threads));
+    int shared_memory = threads * num_accs * sizeof(acc_t);
+
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    Tensor partials({blocks, num_accs}, Dtype::FromType<acc_t>(),
+                    src.GetDevice());
+    MultiOutputReduceKernel<acc_t>
+            <<<blocks, threads, shared_memory,
+               CUDAStream::GetCurrent().Get()>>>(op, num_rows,
+                                                 partials.GetDataPtr<acc_t>());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+    std::vector<acc_t> partials_host = partials.ToFlatVector<acc_t>();
+    std::vector<acc_t> accs(partials_host.begin(),
+                            partials_host.begin() + num_accs);
+    for (int64_t block = 1; block < blocks; ++block) {
+        for (int k = 0; k < num_accs; ++k) {
+            accs[k] = op.Combine(k, accs[k],
+                                 partials_host[block * num_accs + k]);
+        }
+    }
+    return accs;
+}
+
+/// Accumulates the per-column minimum in accumulators [0, num_cols) and the
+/// maximum in [num_cols, 2 * num_cols).
+template <typename scalar_t>
+struct MinMaxReduceOp {
+    const scalar_t* src;
+    int64_t num_cols;
+    scalar_t max_value;
+    scalar_t lowest_value;
+
+    OPEN3D_HOST_DEVICE int NumAccs() const { return 2 * num_cols; }
+    OPEN3D_HOST_DEVICE scalar_t Identity(int k) const {
+        return k < num_cols ? max_value : lowest_value;
+    }
+    OPEN3D_DEVICE void Accumulate(int64_t row,
+                                  scalar_t* accs,
+                                  int stride) const {
+        const scalar_t* row_ptr = src + row * num_cols;
+        for (int64_t col = 0; col < num_cols; ++col) {
+            scalar_t value = row_ptr[col];
+            scalar_t& min_acc = accs[col * stride];
+            scalar_t& max_acc = accs[(num_cols + col) * stride];
+            min_acc = value < min_acc ? value : min_acc;
+            max_acc = value > max_acc ? value : max_acc;
+        }
+    }
+    OPEN3D_HOST_DEVICE scalar_t Combine(int k, scalar_t a, scalar_t b) const {
+        if (k < num_cols) {
+            return a < b ? a : b;
+        } else {
+            return a > b ? a : b;
+        }
+    }
+};
+
+/// Accumulates the sums and the upper-triangle sums of products of the rows
+/// shifted by the first row, see FinalizeMeanAndCovariance.
+template <typename scalar_t>
+struct MeanAndCovarianceReduceOp {
+    const scalar_t* src;
+    int64_t num_cols;
+
+    OPEN3D_HOST_DEVICE int NumAccs() const {
+        return num_cols + num_cols * (num_cols + 1) / 2;
+    }
+    OPEN3D_HOST_DEVICE double Identity(int k) const { return 0; }
+    OPEN3D_DEVICE void Accumulate(int64_t row, double* accs, int stride) const {
+        const scalar_t* row_ptr = src + row * num_cols;
+        int64_t product_idx = num_cols;
+        for (int64_t i = 0; i < num_cols; ++i) {
+            double xi = static_cast<double>(row_ptr[i]) -
+                        static_cast<double>(src[i]);
+            accs[i * stride] += xi;
+            for (int64_t j = i; j < num_cols; ++j) {
+                double xj = static_cast<double>(row_ptr[j]) -
+                            static_cast<double>(src[j]);
+                accs[product_idx++ * stride] += xi * xj;
+            }
+        }
+    }
+    OPEN3D_HOST_DEVICE double Combine(int k, double a, double b) const {
+        return a + b;
+    }
+};
+
+void MinMaxCUDA(const Tensor& src, Tensor& min, Tensor& max) {
+    int64_t num_cols = src.GetShape(1);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        if (!FitsMultiOutputSharedMemory(2 * num_cols, sizeof(scalar_t))) {
+            // Too many columns for the per-thread accumulators.
+            min.AsRvalue() = src.Min({0});
+            max.AsRvalue() = src.Max({0});
+            return;
+        }
+        MinMaxReduceOp<scalar_t> op{src.GetDataPtr<scalar_t>(), num_cols,
+                                    std::numeric_limits<scalar_t>::max(),
+                                    std::numeric_limits<scalar_t>::lowest()};
+        std::vector<scalar_t> accs =
+                MultiOutputReduceRowsCUDA<scalar_t>(src, op);
+        Device host("CPU:0");
+        min.AsRvalue() = Tensor(std::vector<scalar_t>(accs.begin(),
+                                                      accs.begin() + num_cols),
+                                {num_cols}, src.GetDtype(), host);
+        max.AsRvalue() = Tensor(std::vector<scalar_t>(accs.begin() + num_cols,
+                                                      accs.end()),
+                                {num_cols}, src.GetDtype(), host);
+    });
+}
+
+void MeanAndCovarianceCUDA(const Tensor& src,
+                           Tensor& mean,
+                           Tensor& covariance) {
+    int64_t num_rows = src.GetShape(0);
+    int64_t num_cols = src.GetShape(1);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        MeanAndCovarianceReduceOp<scalar_t> op{src.GetDataPtr<scalar_t>(),
+                                               num_cols};
+        if (!FitsMultiOutputSharedMemory(op.NumAccs(), sizeof(double))) {
+            // Too many columns for the per-thread accumulators.
+            Tensor mean_row = src.Mean({0}, /*keepdim=*/true);
+            Tensor centered = src - mean_row;
+            mean.AsRvalue() = mean_row.Reshape({num_cols});
+            covariance.AsRvalue() = centered.T().Matmul(centered) /
+                                    static_cast<double>(num_rows);
+            return;
+        }
+        std::vector<double> accs = MultiOutputReduceRowsCUDA<double>(src, op);
+        std::vector<scalar_t> shift =
+                src.Slice(0, 0, 1).ToFlatVector<scalar_t>();
+        std::vector<scalar_t> mean_host(num_cols);
+        std::vector<scalar_t> covariance_host(num_cols * num_cols);
+        FinalizeMeanAndCovariance(accs.data(), shift.data(), num_rows,
+                                  num_cols, mean_host.data(),
+                                  covariance_host.data());
+        Device host("CPU:0");
+        mean.AsRvalue() =
+                Tensor(mean_host, {num_cols}, src.GetDtype(), host);
+        covariance.AsRvalue() = Tensor(covariance_host, {num_cols, num_cols},
+                                       src.GetDtype(), host);
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
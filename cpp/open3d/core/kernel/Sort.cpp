@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/ParallelPrimitives.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Stable permutation that sorts each consecutive segment of \p length keys.
+static Tensor SegmentedArgSort(const Tensor& keys,
+                               int64_t length,
+                               bool descending) {
+    Device device = keys.GetDevice();
+    int64_t n = keys.GetLength();
+    Tensor permutation;
+    if (descending) {
+        // Sorting the reversed keys and reversing the result gives the
+        // descending order with ties in their original order.
+        Tensor reverse = Tensor::Arange(n - 1, -1, -1, Dtype::Int64, device);
+        permutation = reverse.IndexGet({ArgSort(keys.IndexGet({reverse}))})
+                              .IndexGet({reverse});
+    } else {
+        permutation = ArgSort(keys);
+    }
+    if (length < n) {
+        // A second stable sort by segment keeps the key order within each
+        // segment.
+        permutation = permutation.IndexGet({ArgSort(permutation.Div(length))});
+    }
+    return permutation;
+}
+
+void Sort(const Tensor& src,
+          int64_t dim,
+          bool descending,
+          Tensor* values,
+          Tensor* indices) {
+    Device device = src.GetDevice();
+    if (src.NumDims() == 0) {
+        if (values) *values = src.Clone();
+        if (indices) *indices = Tensor::Zeros({}, Dtype::Int64, device);
+        return;
+    }
+    int64_t num_dims = src.NumDims();
+    dim = shape_util::WrapDim(dim, num_dims);
+
+    // Move dim to the last position so that each slice is contiguous.
+    SizeVector dims;
+    for (int64_t i = 0; i < num_dims; ++i) {
+        if (i != dim) dims.push_back(i);
+    }
+    dims.push_back(dim);
+    SizeVector inverse_dims(num_dims);
+    for (int64_t i = 0; i < num_dims; ++i) {
+        inverse_dims[dims[i]] = i;
+    }
+    Tensor permuted = src.Permute(dims).Contiguous();
+    SizeVector permuted_shape = permuted.GetShape();
+    int64_t n = permuted.NumElements();
+    int64_t length = src.GetShape(dim);
+    if (n == 0) {
+        if (values) *values = src.Clone();
+        if (indices) {
+            *indices = Tensor::Empty(src.GetShape(), Dtype::Int64, device);
+        }
+        return;
+    }
+
+    Tensor flat = permuted.Reshape({n});
+    Tensor permutation = SegmentedArgSort(flat, length, descending);
+    if (values) {
+        *values = flat.IndexGet({permutation})
+                          .Reshape(permuted_shape)
+                          .Permute(inverse_dims)
+                          .Contiguous();
+    }
+    if (indices) {
+        Tensor segment_starts = Tensor::Arange(0, n, 1, Dtype::Int64, device)
+                                        .Div(length)
+                                        .Mul(length);
+        *indices = permutation.Sub(segment_starts)
+                           .Reshape(permuted_shape)
+                           .Permute(inverse_dims)
+                           .Contiguous();
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
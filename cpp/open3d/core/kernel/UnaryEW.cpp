@@ -28,6 +28,7 @@
 
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -49,6 +50,7 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    RecordKernelLaunch(src_device, dst.NumElements());
     if (src_device.GetType() == Device::DeviceType::CPU) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.GetType() == Device::DeviceType::CUDA) {
@@ -78,6 +80,10 @@ void Copy(const Tensor& src, Tensor& dst) {
          dst_device_type != Device::DeviceType::CUDA)) {
         utility::LogError("Copy: Unimplemented device");
     }
+    RecordKernelLaunch(dst_device_type == Device::DeviceType::CUDA
+                               ? dst.GetDevice()
+                               : src.GetDevice(),
+                       dst.NumElements());
     if (src_device_type == Device::DeviceType::CPU &&
         dst_device_type == Device::DeviceType::CPU) {
         CopyCPU(src, dst);
@@ -171,7 +171,7 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                    src.NumElements() == 1 && !src_dtype.IsObject()) {
             int64_t num_elements = dst.NumElements();
 
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
                 scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
                 scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
                 CUDALauncher::LaunchGeneralKernel(
@@ -196,19 +196,21 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                         });
 
             } else {
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                     using src_t = scalar_t;
-                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
-                        using dst_t = scalar_t;
-                        CUDALauncher::LaunchUnaryEWKernel(
-                                indexer,
-                                // Need to wrap as extended CUDA lambda function
-                                [] OPEN3D_HOST_DEVICE(const void* src,
-                                                      void* dst) {
-                                    CUDACopyElementKernel<src_t, dst_t>(src,
-                                                                        dst);
-                                });
-                    });
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(
+                            dst_dtype, [&]() {
+                                using dst_t = scalar_t;
+                                CUDALauncher::LaunchUnaryEWKernel(
+                                        indexer,
+                                        // Need to wrap as extended CUDA lambda
+                                        // function
+                                        [] OPEN3D_HOST_DEVICE(const void* src,
+                                                              void* dst) {
+                                            CUDACopyElementKernel<src_t, dst_t>(
+                                                    src, dst);
+                                        });
+                            });
                 });
             }
         } else {
@@ -239,15 +241,15 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype.GetDtypeCode() != Dtype::DtypeCode::Float) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports floating point dtypes, but {} is used.",
                     dtype.ToString());
         }
     };
 
     if (op_code == UnaryEWOpCode::LogicalNot) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
                 CUDALauncher::LaunchUnaryEWKernel(
@@ -276,7 +278,7 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                op_code == UnaryEWOpCode::IsFinite) {
         assert_dtype_is_float(src_dtype);
         Indexer indexer({src}, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
                 CUDALauncher::LaunchUnaryEWKernel(
                         indexer,
@@ -299,7 +301,7 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         });
     } else {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
@@ -0,0 +1,811 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/VectorizedCPU.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+        (defined(__x86_64__) || defined(__i386__))
+#define OPEN3D_VECTORIZED_X86
+#endif
+
+#ifdef _MSC_VER
+#define OPEN3D_VECTORIZED_INLINE __forceinline
+#else
+#define OPEN3D_VECTORIZED_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Dtypes supported by the vectorized kernels.
+#define DISPATCH_VECTORIZED_DTYPE_TO_TEMPLATE(DTYPE, ...)   \
+    [&] {                                                   \
+        if (DTYPE == open3d::core::Dtype::Float32) {        \
+            using scalar_t = float;                         \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Float64) { \
+            using scalar_t = double;                        \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int32) {   \
+            using scalar_t = int32_t;                       \
+            return __VA_ARGS__();                           \
+        } else {                                            \
+            using scalar_t = int64_t;                       \
+            return __VA_ARGS__();                           \
+        }                                                   \
+    }()
+
+static bool IsVectorizedDtype(Dtype dtype) {
+    return dtype == Dtype::Float32 || dtype == Dtype::Float64 ||
+           dtype == Dtype::Int32 || dtype == Dtype::Int64;
+}
+
+enum class CPUVectorISA { Generic, AVX2, AVX512 };
+
+static CPUVectorISA DetectCPUVectorISA() {
+    CPUVectorISA isa = CPUVectorISA::Generic;
+#ifdef OPEN3D_VECTORIZED_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        isa = CPUVectorISA::AVX512;
+    } else if (__builtin_cpu_supports("avx2") &&
+               __builtin_cpu_supports("fma")) {
+        isa = CPUVectorISA::AVX2;
+    }
+#endif
+    if (const char* env = std::getenv("OPEN3D_CPU_ISA")) {
+        std::string cap = utility::ToUpper(env);
+        if (cap == "GENERIC" || cap == "NEON") {
+            isa = CPUVectorISA::Generic;
+        } else if (cap == "AVX2" && isa == CPUVectorISA::AVX512) {
+            isa = CPUVectorISA::AVX2;
+        }
+    }
+    return isa;
+}
+
+static CPUVectorISA GetISA() {
+    static const CPUVectorISA isa = DetectCPUVectorISA();
+    return isa;
+}
+
+std::string GetCPUVectorISA() {
+    switch (GetISA()) {
+        case CPUVectorISA::AVX512:
+            return "AVX512";
+        case CPUVectorISA::AVX2:
+            return "AVX2";
+        default:
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+            // NEON is part of the baseline ISA of AArch64.
+            return "NEON";
+#else
+            return "Generic";
+#endif
+    }
+}
+
+// Element-wise ops. Reduction ops are called as op(accumulator, element) and
+// keep the operand order of the kernels in ReductionCPU.cpp.
+template <typename scalar_t>
+struct AddOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a + b;
+    }
+};
+
+template <typename scalar_t>
+struct SubOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a - b;
+    }
+};
+
+template <typename scalar_t>
+struct MulOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a * b;
+    }
+};
+
+template <typename scalar_t>
+struct DivOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a / b;
+    }
+};
+
+template <typename scalar_t>
+struct NegOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t a) const {
+        return -a;
+    }
+};
+
+template <typename scalar_t>
+struct AbsOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t a) const {
+        return std::abs(a);
+    }
+};
+
+template <typename scalar_t>
+struct MinOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t acc,
+                                                 scalar_t x) const {
+        return std::min(x, acc);
+    }
+};
+
+template <typename scalar_t>
+struct MaxOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t acc,
+                                                 scalar_t x) const {
+        return std::max(x, acc);
+    }
+};
+
+// Arg-reductions only replace the accumulator by a strictly better element,
+// so NaNs are never selected.
+template <typename scalar_t>
+struct ArgMinValueOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t acc,
+                                                 scalar_t x) const {
+        return x < acc ? x : acc;
+    }
+};
+
+template <typename scalar_t>
+struct ArgMaxValueOp {
+    OPEN3D_VECTORIZED_INLINE scalar_t operator()(scalar_t acc,
+                                                 scalar_t x) const {
+        return x > acc ? x : acc;
+    }
+};
+
+// Loop bodies. They are force-inlined into the per-ISA entry points below,
+// such that each copy is compiled for the entry point's instruction set.
+template <typename scalar_t, typename op_t>
+OPEN3D_VECTORIZED_INLINE void BinaryLoop(const scalar_t* lhs,
+                                         bool lhs_scalar,
+                                         const scalar_t* rhs,
+                                         bool rhs_scalar,
+                                         scalar_t* dst,
+                                         int64_t n,
+                                         op_t op) {
+    if (lhs_scalar) {
+        const scalar_t a = *lhs;
+#pragma omp simd
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op(a, rhs[i]);
+        }
+    } else if (rhs_scalar) {
+        const scalar_t b = *rhs;
+#pragma omp simd
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op(lhs[i], b);
+        }
+    } else {
+#pragma omp simd
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op(lhs[i], rhs[i]);
+        }
+    }
+}
+
+/// Applies op between the contiguous (num_rows, row_size) operand \p full and
+/// the row \p row, which is broadcast to every row of \p full. Short rows are
+/// repeated into a tile of whole rows, so that the inner loop runs over up to
+/// kTileSize contiguous elements instead of row_size ones. row_t is an
+/// std::integral_constant holding the row size if it is known at compile time,
+/// or 0 otherwise. Fixing it (e.g. to 3 for (N, 3) points) makes the tile size
+/// a constant, so that the inner loop is fully unrolled.
+template <typename row_t, typename scalar_t, typename op_t>
+OPEN3D_VECTORIZED_INLINE void RowBroadcastLoop(const scalar_t* full,
+                                               const scalar_t* row,
+                                               int64_t row_size,
+                                               bool row_is_lhs,
+                                               scalar_t* dst,
+                                               int64_t num_rows,
+                                               op_t op,
+                                               row_t) {
+    constexpr int64_t kTileSize = 64;
+    const int64_t r = row_t::value > 0 ? row_t::value : row_size;
+    if (r > kTileSize) {
+        for (int64_t i = 0; i < num_rows; ++i) {
+            BinaryLoop(row_is_lhs ? row : full + i * r, false,
+                       row_is_lhs ? full + i * r : row, false, dst + i * r, r,
+                       op);
+        }
+        return;
+    }
+    const int64_t tile_size = kTileSize / r * r;
+    scalar_t tile[kTileSize];
+    for (int64_t k = 0; k < tile_size; ++k) {
+        tile[k] = row[k % r];
+    }
+    const int64_t n = num_rows * r;
+    int64_t i = 0;
+    for (; i + tile_size <= n; i += tile_size) {
+        if (row_is_lhs) {
+#pragma omp simd
+            for (int64_t k = 0; k < tile_size; ++k) {
+                dst[i + k] = op(tile[k], full[i + k]);
+            }
+        } else {
+#pragma omp simd
+            for (int64_t k = 0; k < tile_size; ++k) {
+                dst[i + k] = op(full[i + k], tile[k]);
+            }
+        }
+    }
+    // i is a multiple of the row size, so the tile is aligned with the rows.
+    for (int64_t k = 0; i + k < n; ++k) {
+        dst[i + k] = row_is_lhs ? op(tile[k], full[i + k])
+                                : op(full[i + k], tile[k]);
+    }
+}
+
+template <typename scalar_t, typename op_t>
+OPEN3D_VECTORIZED_INLINE void UnaryLoop(const scalar_t* src,
+                                        scalar_t* dst,
+                                        int64_t n,
+                                        op_t op) {
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = op(src[i]);
+    }
+}
+
+/// Reduces with kLanes independent accumulators. The fixed lane count makes
+/// the summation order independent of the instruction set.
+template <typename scalar_t, typename op_t>
+OPEN3D_VECTORIZED_INLINE scalar_t ReduceLoop(const scalar_t* src,
+                                             int64_t n,
+                                             scalar_t identity,
+                                             op_t op) {
+    constexpr int64_t kLanes = 16;
+    scalar_t acc[kLanes];
+    for (int64_t k = 0; k < kLanes; ++k) {
+        acc[k] = identity;
+    }
+    int64_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+        for (int64_t k = 0; k < kLanes; ++k) {
+            acc[k] = op(acc[k], src[i + k]);
+        }
+    }
+    scalar_t result = identity;
+    for (int64_t k = 0; k < kLanes; ++k) {
+        result = op(result, acc[k]);
+    }
+    for (; i < n; ++i) {
+        result = op(result, src[i]);
+    }
+    return result;
+}
+
+/// Returns the first index of the extremum found by the value op, or -1 if
+/// no element was selected (e.g. all elements are NaN).
+template <typename scalar_t, typename op_t>
+OPEN3D_VECTORIZED_INLINE int64_t ArgReduceLoop(const scalar_t* src,
+                                               int64_t n,
+                                               scalar_t identity,
+                                               op_t op,
+                                               scalar_t* value) {
+    *value = ReduceLoop(src, n, identity, op);
+    for (int64_t i = 0; i < n; ++i) {
+        if (src[i] == *value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#define OPEN3D_DEFINE_VECTORIZED_ENTRY_POINTS(ISA, TARGET)                   \
+    template <typename scalar_t, typename op_t>                              \
+    TARGET void VectorizedBinaryEW##ISA(                                     \
+            const scalar_t* lhs, bool lhs_scalar, const scalar_t* rhs,       \
+            bool rhs_scalar, scalar_t* dst, int64_t n, op_t op) {            \
+        BinaryLoop(lhs, lhs_scalar, rhs, rhs_scalar, dst, n, op);            \
+    }                                                                        \
+    template <typename row_t, typename scalar_t, typename op_t>              \
+    TARGET void VectorizedRowBroadcastEW##ISA(                               \
+            const scalar_t* full, const scalar_t* row, int64_t row_size,     \
+            bool row_is_lhs, scalar_t* dst, int64_t num_rows, op_t op,       \
+            row_t row_tag) {                                                 \
+        RowBroadcastLoop(full, row, row_size, row_is_lhs, dst, num_rows, op, \
+                         row_tag);                                           \
+    }                                                                        \
+    template <typename scalar_t, typename op_t>                              \
+    TARGET void VectorizedUnaryEW##ISA(const scalar_t* src, scalar_t* dst,   \
+                                       int64_t n, op_t op) {                 \
+        UnaryLoop(src, dst, n, op);                                          \
+    }                                                                        \
+    template <typename scalar_t, typename op_t>                              \
+    TARGET scalar_t VectorizedReduce##ISA(const scalar_t* src, int64_t n,    \
+                                          scalar_t identity, op_t op) {      \
+        return ReduceLoop(src, n, identity, op);                             \
+    }                                                                        \
+    template <typename scalar_t, typename op_t>                              \
+    TARGET int64_t VectorizedArgReduce##ISA(const scalar_t* src, int64_t n,  \
+                                            scalar_t identity, op_t op,      \
+                                            scalar_t* value) {               \
+        return ArgReduceLoop(src, n, identity, op, value);                   \
+    }
+
+OPEN3D_DEFINE_VECTORIZED_ENTRY_POINTS(Generic, )
+#ifdef OPEN3D_VECTORIZED_X86
+OPEN3D_DEFINE_VECTORIZED_ENTRY_POINTS(AVX2,
+                                      __attribute__((target("avx2,fma"))))
+OPEN3D_DEFINE_VECTORIZED_ENTRY_POINTS(AVX512,
+                                      __attribute__((target("avx512f"))))
+#endif
+
+#ifdef OPEN3D_VECTORIZED_X86
+#define OPEN3D_VECTORIZED_DISPATCH(FUNC, ...)    \
+    switch (GetISA()) {                          \
+        case CPUVectorISA::AVX512:               \
+            return FUNC##AVX512(__VA_ARGS__);    \
+        case CPUVectorISA::AVX2:                 \
+            return FUNC##AVX2(__VA_ARGS__);      \
+        default:                                 \
+            return FUNC##Generic(__VA_ARGS__);   \
+    }
+#else
+#define OPEN3D_VECTORIZED_DISPATCH(FUNC, ...) return FUNC##Generic(__VA_ARGS__);
+#endif
+
+template <typename scalar_t, typename op_t>
+static void VectorizedBinaryEW(const scalar_t* lhs,
+                               bool lhs_scalar,
+                               const scalar_t* rhs,
+                               bool rhs_scalar,
+                               scalar_t* dst,
+                               int64_t n,
+                               op_t op) {
+    OPEN3D_VECTORIZED_DISPATCH(VectorizedBinaryEW, lhs, lhs_scalar, rhs,
+                               rhs_scalar, dst, n, op);
+}
+
+template <typename row_t, typename scalar_t, typename op_t>
+static void VectorizedRowBroadcastEW(const scalar_t* full,
+                                     const scalar_t* row,
+                                     int64_t row_size,
+                                     bool row_is_lhs,
+                                     scalar_t* dst,
+                                     int64_t num_rows,
+                                     op_t op,
+                                     row_t row_tag) {
+    OPEN3D_VECTORIZED_DISPATCH(VectorizedRowBroadcastEW, full, row, row_size,
+                               row_is_lhs, dst, num_rows, op, row_tag);
+}
+
+template <typename scalar_t, typename op_t>
+static void VectorizedUnaryEW(const scalar_t* src,
+                              scalar_t* dst,
+                              int64_t n,
+                              op_t op) {
+    OPEN3D_VECTORIZED_DISPATCH(VectorizedUnaryEW, src, dst, n, op);
+}
+
+template <typename scalar_t, typename op_t>
+static scalar_t VectorizedReduce(const scalar_t* src,
+                                 int64_t n,
+                                 scalar_t identity,
+                                 op_t op) {
+    OPEN3D_VECTORIZED_DISPATCH(VectorizedReduce, src, n, identity, op);
+}
+
+template <typename scalar_t, typename op_t>
+static int64_t VectorizedArgReduce(const scalar_t* src,
+                                   int64_t n,
+                                   scalar_t identity,
+                                   op_t op,
+                                   scalar_t* value) {
+    OPEN3D_VECTORIZED_DISPATCH(VectorizedArgReduce, src, n, identity, op,
+                               value);
+}
+
+// Minimum number of elements processed by each thread, such that small
+// tensors are not slowed down by the threading overhead.
+static constexpr int64_t kGrainSize = 32768;
+
+static int64_t NumChunks(int64_t num_items, int64_t grain_size) {
+    if (InParallel()) {
+        return 1;
+    }
+    int64_t num_chunks = (num_items + grain_size - 1) / grain_size;
+    return std::max<int64_t>(
+            1, std::min<int64_t>(num_chunks, GetMaxThreads()));
+}
+
+/// Calls func(chunk_idx, start, end) for num_chunks contiguous chunks of
+/// [0, num_items) in parallel.
+template <typename func_t>
+static void ParallelChunks(int64_t num_items, int64_t num_chunks, func_t func) {
+    if (num_chunks <= 1) {
+        func(0, 0, num_items);
+        return;
+    }
+    int64_t chunk_size = (num_items + num_chunks - 1) / num_chunks;
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        int64_t start = chunk_idx * chunk_size;
+        int64_t end = std::min(start + chunk_size, num_items);
+        if (start < end) {
+            func(chunk_idx, start, end);
+        }
+    });
+}
+
+/// Operands of the vectorized kernels are on CPU, contiguous and have the
+/// same dtype.
+static bool IsVectorizedOperand(const Tensor& t, Dtype dtype) {
+    return t.GetDevice().GetType() == Device::DeviceType::CPU &&
+           t.GetDtype() == dtype && t.IsContiguous();
+}
+
+template <typename scalar_t, typename op_t>
+static void LaunchBinaryEW(const Tensor& lhs,
+                           const Tensor& rhs,
+                           Tensor& dst,
+                           op_t op) {
+    const scalar_t* lhs_ptr = static_cast<const scalar_t*>(lhs.GetDataPtr());
+    const scalar_t* rhs_ptr = static_cast<const scalar_t*>(rhs.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    int64_t n = dst.NumElements();
+    bool lhs_scalar = lhs.NumElements() == 1 && n != 1;
+    bool rhs_scalar = rhs.NumElements() == 1 && n != 1;
+    ParallelChunks(n, NumChunks(n, kGrainSize),
+                   [&](int64_t, int64_t start, int64_t end) {
+                       VectorizedBinaryEW(
+                               lhs_scalar ? lhs_ptr : lhs_ptr + start,
+                               lhs_scalar,
+                               rhs_scalar ? rhs_ptr : rhs_ptr + start,
+                               rhs_scalar, dst_ptr + start, end - start, op);
+                   });
+}
+
+/// Returns true if \p t has more than one element and broadcasts to \p shape
+/// by repeating all of its elements, e.g. a {3} or {1, 3} operand of a {N, 3}
+/// output.
+static bool IsRowOperand(const Tensor& t, const SizeVector& shape) {
+    const SizeVector& t_shape = t.GetShape();
+    int64_t num_leading_ones = 0;
+    while (num_leading_ones < t.NumDims() && t_shape[num_leading_ones] == 1) {
+        num_leading_ones++;
+    }
+    int64_t row_ndims = t.NumDims() - num_leading_ones;
+    if (t.NumElements() <= 1 ||
+        row_ndims >= static_cast<int64_t>(shape.size())) {
+        return false;
+    }
+    return std::equal(t_shape.begin() + num_leading_ones, t_shape.end(),
+                      shape.end() - row_ndims);
+}
+
+template <typename scalar_t, typename op_t>
+static void LaunchRowBroadcastBinaryEW(const Tensor& full,
+                                       const Tensor& row,
+                                       bool row_is_lhs,
+                                       Tensor& dst,
+                                       op_t op) {
+    const scalar_t* full_ptr = static_cast<const scalar_t*>(full.GetDataPtr());
+    const scalar_t* row_ptr = static_cast<const scalar_t*>(row.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    int64_t row_size = row.NumElements();
+    int64_t num_rows = dst.NumElements() / row_size;
+    ParallelChunks(
+            num_rows, NumChunks(dst.NumElements(), kGrainSize),
+            [&](int64_t, int64_t start, int64_t end) {
+                int64_t offset = start * row_size;
+                if (row_size == 3) {
+                    // (N, 3) points, normals and colors.
+                    VectorizedRowBroadcastEW(
+                            full_ptr + offset, row_ptr, row_size, row_is_lhs,
+                            dst_ptr + offset, end - start, op,
+                            std::integral_constant<int64_t, 3>());
+                } else {
+                    VectorizedRowBroadcastEW(
+                            full_ptr + offset, row_ptr, row_size, row_is_lhs,
+                            dst_ptr + offset, end - start, op,
+                            std::integral_constant<int64_t, 0>());
+                }
+            });
+}
+
+bool BinaryEWVectorizedCPU(const Tensor& lhs,
+                           const Tensor& rhs,
+                           Tensor& dst,
+                           BinaryEWOpCode op_code) {
+    Dtype dtype = dst.GetDtype();
+    if (!IsVectorizedDtype(dtype) || !IsVectorizedOperand(dst, dtype) ||
+        !IsVectorizedOperand(lhs, dtype) || !IsVectorizedOperand(rhs, dtype)) {
+        return false;
+    }
+    // Either each input has the shape of dst or a single element, or one
+    // input has the shape of dst and the other one is a broadcast row.
+    const SizeVector& shape = dst.GetShape();
+    bool lhs_row = IsRowOperand(lhs, shape);
+    bool rhs_row = IsRowOperand(rhs, shape);
+    if (lhs_row || rhs_row) {
+        if (lhs_row == rhs_row ||
+            (lhs_row ? rhs : lhs).GetShape() != dst.GetShape()) {
+            return false;
+        }
+    } else if ((lhs.GetShape() != dst.GetShape() && lhs.NumElements() != 1) ||
+               (rhs.GetShape() != dst.GetShape() && rhs.NumElements() != 1)) {
+        return false;
+    }
+    if (op_code == BinaryEWOpCode::Div && dtype != Dtype::Float32 &&
+        dtype != Dtype::Float64) {
+        // Integer division is not vectorized by the hardware.
+        return false;
+    }
+    return DISPATCH_VECTORIZED_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        auto launch = [&](auto op) {
+            if (lhs_row) {
+                LaunchRowBroadcastBinaryEW<scalar_t>(rhs, lhs, true, dst, op);
+            } else if (rhs_row) {
+                LaunchRowBroadcastBinaryEW<scalar_t>(lhs, rhs, false, dst, op);
+            } else {
+                LaunchBinaryEW<scalar_t>(lhs, rhs, dst, op);
+            }
+        };
+        switch (op_code) {
+            case BinaryEWOpCode::Add:
+                launch(AddOp<scalar_t>());
+                return true;
+            case BinaryEWOpCode::Sub:
+                launch(SubOp<scalar_t>());
+                return true;
+            case BinaryEWOpCode::Mul:
+                launch(MulOp<scalar_t>());
+                return true;
+            case BinaryEWOpCode::Div:
+                launch(DivOp<scalar_t>());
+                return true;
+            default:
+                return false;
+        }
+    });
+}
+
+template <typename scalar_t, typename op_t>
+static void LaunchUnaryEW(const Tensor& src, Tensor& dst, op_t op) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    int64_t n = dst.NumElements();
+    ParallelChunks(n, NumChunks(n, kGrainSize),
+                   [&](int64_t, int64_t start, int64_t end) {
+                       VectorizedUnaryEW(src_ptr + start, dst_ptr + start,
+                                         end - start, op);
+                   });
+}
+
+bool UnaryEWVectorizedCPU(const Tensor& src,
+                          Tensor& dst,
+                          UnaryEWOpCode op_code) {
+    Dtype dtype = dst.GetDtype();
+    if (!IsVectorizedDtype(dtype) || !IsVectorizedOperand(dst, dtype) ||
+        !IsVectorizedOperand(src, dtype) ||
+        src.GetShape() != dst.GetShape()) {
+        return false;
+    }
+    return DISPATCH_VECTORIZED_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        switch (op_code) {
+            case UnaryEWOpCode::Neg:
+                LaunchUnaryEW<scalar_t>(src, dst, NegOp<scalar_t>());
+                return true;
+            case UnaryEWOpCode::Abs:
+                LaunchUnaryEW<scalar_t>(src, dst, AbsOp<scalar_t>());
+                return true;
+            default:
+                return false;
+        }
+    });
+}
+
+template <typename scalar_t, typename op_t>
+static void LaunchReduction(const scalar_t* src_ptr,
+                            scalar_t* dst_ptr,
+                            int64_t num_rows,
+                            int64_t row_size,
+                            scalar_t identity,
+                            op_t op) {
+    if (num_rows == 1) {
+        int64_t num_chunks = NumChunks(row_size, kGrainSize);
+        std::vector<scalar_t> partials(num_chunks, identity);
+        ParallelChunks(row_size, num_chunks,
+                       [&](int64_t chunk_idx, int64_t start, int64_t end) {
+                           partials[chunk_idx] = VectorizedReduce(
+                                   src_ptr + start, end - start, identity, op);
+                       });
+        scalar_t result = identity;
+        for (const scalar_t& partial : partials) {
+            result = op(result, partial);
+        }
+        *dst_ptr = result;
+    } else {
+        int64_t grain_rows = std::max<int64_t>(1, kGrainSize / row_size);
+        ParallelChunks(num_rows, NumChunks(num_rows, grain_rows),
+                       [&](int64_t, int64_t start, int64_t end) {
+                           for (int64_t row = start; row < end; ++row) {
+                               dst_ptr[row] = VectorizedReduce(
+                                       src_ptr + row * row_size, row_size,
+                                       identity, op);
+                           }
+                       });
+    }
+}
+
+template <typename scalar_t, typename op_t>
+static void LaunchArgReduction(const scalar_t* src_ptr,
+                               int64_t* dst_ptr,
+                               int64_t num_rows,
+                               int64_t row_size,
+                               scalar_t identity,
+                               op_t op) {
+    if (num_rows == 1) {
+        int64_t num_chunks = NumChunks(row_size, kGrainSize);
+        std::vector<int64_t> partial_indices(num_chunks, -1);
+        std::vector<scalar_t> partial_values(num_chunks, identity);
+        ParallelChunks(row_size, num_chunks,
+                       [&](int64_t chunk_idx, int64_t start, int64_t end) {
+                           int64_t idx = VectorizedArgReduce(
+                                   src_ptr + start, end - start, identity, op,
+                                   &partial_values[chunk_idx]);
+                           partial_indices[chunk_idx] =
+                                   idx < 0 ? -1 : start + idx;
+                       });
+        // Earlier chunks win ties, such that the first extremum is returned.
+        int64_t best_idx = -1;
+        scalar_t best_value = identity;
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            if (partial_indices[chunk_idx] < 0) {
+                continue;
+            }
+            if (best_idx < 0 ||
+                op(best_value, partial_values[chunk_idx]) != best_value) {
+                best_idx = partial_indices[chunk_idx];
+                best_value = partial_values[chunk_idx];
+            }
+        }
+        *dst_ptr = std::max<int64_t>(best_idx, 0);
+    } else {
+        int64_t grain_rows = std::max<int64_t>(1, kGrainSize / row_size);
+        ParallelChunks(num_rows, NumChunks(num_rows, grain_rows),
+                       [&](int64_t, int64_t start, int64_t end) {
+                           scalar_t value;
+                           for (int64_t row = start; row < end; ++row) {
+                               int64_t idx = VectorizedArgReduce(
+                                       src_ptr + row * row_size, row_size,
+                                       identity, op, &value);
+                               dst_ptr[row] = std::max<int64_t>(idx, 0);
+                           }
+                       });
+    }
+}
+
+bool ReductionVectorizedCPU(const Tensor& src,
+                            Tensor& dst,
+                            const SizeVector& dims,
+                            ReductionOpCode op_code) {
+    Dtype dtype = src.GetDtype();
+    bool is_arg_op = s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end();
+    bool is_regular_op =
+            s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end();
+    if ((!is_arg_op && !is_regular_op) || !IsVectorizedDtype(dtype) ||
+        !IsVectorizedOperand(src, dtype) ||
+        !IsVectorizedOperand(dst, is_arg_op ? Dtype::Int64 : dtype) ||
+        src.NumElements() == 0 || dims.size() == 0) {
+        return false;
+    }
+
+    // The reduction dims must be the innermost dims of src.
+    int64_t ndims = src.NumDims();
+    std::vector<int64_t> sorted_dims;
+    for (int64_t dim : dims) {
+        sorted_dims.push_back(shape_util::WrapDim(dim, ndims));
+    }
+    std::sort(sorted_dims.begin(), sorted_dims.end());
+    sorted_dims.erase(std::unique(sorted_dims.begin(), sorted_dims.end()),
+                      sorted_dims.end());
+    int64_t first_reduced_dim =
+            ndims - static_cast<int64_t>(sorted_dims.size());
+    for (size_t i = 0; i < sorted_dims.size(); ++i) {
+        if (sorted_dims[i] != first_reduced_dim + static_cast<int64_t>(i)) {
+            return false;
+        }
+    }
+    const SizeVector& shape = src.GetShape();
+    int64_t num_rows = 1;
+    for (int64_t dim = 0; dim < first_reduced_dim; ++dim) {
+        num_rows *= shape[dim];
+    }
+    int64_t row_size = src.NumElements() / num_rows;
+    if (dst.NumElements() != num_rows) {
+        return false;
+    }
+
+    DISPATCH_VECTORIZED_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        int64_t* dst_idx_ptr = static_cast<int64_t*>(dst.GetDataPtr());
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                LaunchReduction(src_ptr, dst_ptr, num_rows, row_size,
+                                static_cast<scalar_t>(0), AddOp<scalar_t>());
+                break;
+            case ReductionOpCode::Prod:
+                LaunchReduction(src_ptr, dst_ptr, num_rows, row_size,
+                                static_cast<scalar_t>(1), MulOp<scalar_t>());
+                break;
+            case ReductionOpCode::Min:
+                LaunchReduction(src_ptr, dst_ptr, num_rows, row_size,
+                                std::numeric_limits<scalar_t>::max(),
+                                MinOp<scalar_t>());
+                break;
+            case ReductionOpCode::Max:
+                LaunchReduction(src_ptr, dst_ptr, num_rows, row_size,
+                                std::numeric_limits<scalar_t>::lowest(),
+                                MaxOp<scalar_t>());
+                break;
+            case ReductionOpCode::ArgMin:
+                LaunchArgReduction(src_ptr, dst_idx_ptr, num_rows, row_size,
+                                   std::numeric_limits<scalar_t>::max(),
+                                   ArgMinValueOp<scalar_t>());
+                break;
+            case ReductionOpCode::ArgMax:
+                LaunchArgReduction(src_ptr, dst_idx_ptr, num_rows, row_size,
+                                   std::numeric_limits<scalar_t>::lowest(),
+                                   ArgMaxValueOp<scalar_t>());
+                break;
+            default:
+                break;
+        }
+    });
+    return true;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Vectorized CPU kernels for contiguous operands. The generic CPU kernels
+// compute the offsets of every element through the Indexer and call the
+// element kernel through a function pointer, which prevents the compiler from
+// vectorizing the loop. The kernels here run flat typed loops instead, and are
+// compiled for several instruction sets (AVX-512, AVX2 and the baseline ISA),
+// where the best one supported by the CPU is selected at runtime.
+//
+// Each function returns false without touching the outputs if the operands
+// are not supported, in which case the caller shall fall back to the
+// Indexer-based kernels.
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns the instruction set used by the vectorized CPU kernels, one of
+/// "AVX512", "AVX2", "NEON" or "Generic".
+///
+/// The instruction set is detected at the first call. It can be capped with
+/// the environment variable OPEN3D_CPU_ISA (e.g. OPEN3D_CPU_ISA=AVX2 or
+/// OPEN3D_CPU_ISA=Generic), which is useful for benchmarking.
+std::string GetCPUVectorISA();
+
+/// Add, Sub, Mul and Div of Float32, Float64, Int32 and Int64 tensors (no Div
+/// for integers), where all operands have the same dtype, \p dst is
+/// contiguous, and each input is either contiguous with the shape of \p dst
+/// or has a single element. Alternatively, one input has the shape of \p dst
+/// and the other one is a contiguous row broadcast along the leading dims,
+/// e.g. points of shape {N, 3} minus a center of shape {3}.
+bool BinaryEWVectorizedCPU(const Tensor& lhs,
+                           const Tensor& rhs,
+                           Tensor& dst,
+                           BinaryEWOpCode op_code);
+
+/// Neg and Abs of contiguous Float32, Float64, Int32 and Int64 tensors with
+/// the same dtype and shape.
+bool UnaryEWVectorizedCPU(const Tensor& src,
+                          Tensor& dst,
+                          UnaryEWOpCode op_code);
+
+/// Sum, Prod, Min, Max, ArgMin and ArgMax of a contiguous Float32, Float64,
+/// Int32 or Int64 tensor, where \p dims are the innermost dimensions of
+/// \p src, i.e. each output element reduces a contiguous row of \p src.
+/// ArgMin and ArgMax return the first index of the extremum.
+bool ReductionVectorizedCPU(const Tensor& src,
+                            Tensor& dst,
+                            const SizeVector& dims,
+                            ReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Batched backends for small dense matrices. All matrices are contiguous and
+// row-major, stored back to back: matrix b of an (N, m, n) batch starts at
+// element b * m * n.
+
+#pragma once
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Largest matrix size handled by the register-resident CPU kernels. Larger
+/// batched matrices use the generic per-matrix CPU path.
+constexpr int64_t kMaxFixedSizeBatchedLinalg = 6;
+
+/// Solve, Inverse and Det on CUDA operands with at most this many elements in
+/// total run on the host. Copying a few small matrices back and forth is
+/// cheaper than the cuBLAS/cuSOLVER launches, workspace allocations and info
+/// read-backs of the device path, e.g. for the 6x6 systems of ICP.
+constexpr int64_t kMaxHostFallbackLinalgElements = 4096;
+
+/// Returns true if an operation on CUDA operands of num_elements in total
+/// should run on the host instead.
+inline bool UseHostFallbackLinalg(const Device& device, int64_t num_elements) {
+    return device.GetType() == Device::DeviceType::CUDA &&
+           num_elements <= kMaxHostFallbackLinalgElements;
+}
+
+/// C[b] = A[b] @ B[b], with A: (batch, m, k), B: (batch, k, n).
+void MatmulBatchedCPU(const void* A_data,
+                      const void* B_data,
+                      void* C_data,
+                      int64_t batch,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype);
+
+/// output[b] = A[b]^{-1}, with A: (batch, n, n).
+void InverseBatchedCPU(const void* A_data,
+                       void* output_data,
+                       int64_t batch,
+                       int64_t n,
+                       Dtype dtype);
+
+/// Solves A[b] X[b] = B[b], A: (batch, n, n), B: (batch, n, k). B is
+/// overwritten by X.
+void SolveBatchedCPU(const void* A_data,
+                     void* B_data,
+                     int64_t batch,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype);
+
+/// output[b] = det(A[b]), with A: (batch, n, n) and output: (batch,).
+void DetBatchedCPU(const void* A_data,
+                   void* output_data,
+                   int64_t batch,
+                   int64_t n,
+                   Dtype dtype);
+
+#ifdef BUILD_CUDA_MODULE
+void MatmulBatchedCUDA(const void* A_data,
+                       const void* B_data,
+                       void* C_data,
+                       int64_t batch,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       Dtype dtype,
+                       const Device& device);
+
+/// A is overwritten by its LU factors.
+void InverseBatchedCUDA(void* A_data,
+                        void* output_data,
+                        int64_t batch,
+                        int64_t n,
+                        Dtype dtype,
+                        const Device& device);
+
+/// B is (batch, k, n) here, i.e. the transposed right-hand sides, and is
+/// overwritten by the transposed solutions. A is overwritten by its LU
+/// factors.
+void SolveBatchedCUDA(void* A_data,
+                      void* B_T_data,
+                      int64_t batch,
+                      int64_t n,
+                      int64_t k,
+                      Dtype dtype,
+                      const Device& device);
+
+/// Computes the LU factorization of each matrix in place, and returns the
+/// 1-based pivots in ipiv: (batch, n), Int32. The determinant is the product
+/// of the diagonal, negated for every pivot that is a row swap.
+void LUBatchedCUDA(void* A_data,
+                   void* ipiv_data,
+                   int64_t batch,
+                   int64_t n,
+                   Dtype dtype,
+                   const Device& device);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,357 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/Matmul.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+/// Number of matrices processed per task of the parallel executor.
+constexpr int64_t kBatchGrainSize = 256;
+
+/// Size of the matrices, known at compile time (N > 0) or at run time
+/// (N == 0). With a compile-time size the loops below are fully unrolled and
+/// the factors are kept in registers.
+template <int N>
+inline int64_t MatrixSize(int64_t n) {
+    return N > 0 ? N : n;
+}
+
+/// Calls func(std::integral_constant<int, N>) with N = n for the sizes that
+/// have a fixed-size kernel, and N = 0 otherwise.
+template <typename func_t>
+void DispatchMatrixSize(int64_t n, const func_t& func) {
+    switch (n) {
+        case 2:
+            func(std::integral_constant<int, 2>());
+            break;
+        case 3:
+            func(std::integral_constant<int, 3>());
+            break;
+        case 4:
+            func(std::integral_constant<int, 4>());
+            break;
+        case 6:
+            func(std::integral_constant<int, 6>());
+            break;
+        default:
+            func(std::integral_constant<int, 0>());
+            break;
+    }
+}
+
+/// Scratch space for the LU factors of one matrix.
+template <typename scalar_t, int N>
+class LUWorkspace {
+public:
+    explicit LUWorkspace(int64_t n) {}
+    scalar_t* LU() { return lu_; }
+    int64_t* Perm() { return perm_; }
+
+private:
+    scalar_t lu_[N * N];
+    int64_t perm_[N];
+};
+
+template <typename scalar_t>
+class LUWorkspace<scalar_t, 0> {
+public:
+    explicit LUWorkspace(int64_t n) : lu_(n * n), perm_(n) {}
+    scalar_t* LU() { return lu_.data(); }
+    int64_t* Perm() { return perm_.data(); }
+
+private:
+    std::vector<scalar_t> lu_;
+    std::vector<int64_t> perm_;
+};
+
+/// Computes PA = LU with partial pivoting. L (unit diagonal, not stored) and U
+/// are written to lu, the row permutation to perm. Returns false if A is
+/// singular.
+template <typename scalar_t, int N>
+inline bool LUFactor(const scalar_t* A,
+                     int64_t size,
+                     scalar_t* lu,
+                     int64_t* perm,
+                     scalar_t* sign) {
+    const int64_t n = MatrixSize<N>(size);
+    for (int64_t i = 0; i < n * n; ++i) {
+        lu[i] = A[i];
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        perm[i] = i;
+    }
+    *sign = 1;
+    for (int64_t c = 0; c < n; ++c) {
+        int64_t pivot = c;
+        scalar_t max_abs = std::abs(lu[c * n + c]);
+        for (int64_t r = c + 1; r < n; ++r) {
+            const scalar_t v = std::abs(lu[r * n + c]);
+            if (v > max_abs) {
+                max_abs = v;
+                pivot = r;
+            }
+        }
+        if (max_abs == 0) {
+            return false;
+        }
+        if (pivot != c) {
+            for (int64_t j = 0; j < n; ++j) {
+                std::swap(lu[c * n + j], lu[pivot * n + j]);
+            }
+            std::swap(perm[c], perm[pivot]);
+            *sign = -*sign;
+        }
+        const scalar_t inv_pivot = scalar_t(1) / lu[c * n + c];
+        for (int64_t r = c + 1; r < n; ++r) {
+            const scalar_t f = lu[r * n + c] * inv_pivot;
+            lu[r * n + c] = f;
+            for (int64_t j = c + 1; j < n; ++j) {
+                lu[r * n + j] -= f * lu[c * n + j];
+            }
+        }
+    }
+    return true;
+}
+
+/// Solves LU X = PB for the (n, k) matrix X. X is initialized by the caller
+/// with PB, and is overwritten in place.
+template <typename scalar_t, int N>
+inline void LUSolveInPlace(const scalar_t* lu,
+                           int64_t size,
+                           int64_t k,
+                           scalar_t* X) {
+    const int64_t n = MatrixSize<N>(size);
+    for (int64_t i = 1; i < n; ++i) {
+        for (int64_t p = 0; p < i; ++p) {
+            const scalar_t f = lu[i * n + p];
+            for (int64_t j = 0; j < k; ++j) {
+                X[i * k + j] -= f * X[p * k + j];
+            }
+        }
+    }
+    for (int64_t i = n - 1; i >= 0; --i) {
+        for (int64_t p = i + 1; p < n; ++p) {
+            const scalar_t f = lu[i * n + p];
+            for (int64_t j = 0; j < k; ++j) {
+                X[i * k + j] -= f * X[p * k + j];
+            }
+        }
+        const scalar_t inv_diag = scalar_t(1) / lu[i * n + i];
+        for (int64_t j = 0; j < k; ++j) {
+            X[i * k + j] *= inv_diag;
+        }
+    }
+}
+
+template <typename scalar_t, int N>
+inline void MatmulFixed(const scalar_t* A,
+                        const scalar_t* B,
+                        scalar_t* C,
+                        int64_t m,
+                        int64_t k,
+                        int64_t n) {
+    if (N > 0) {
+        m = k = n = N;
+    }
+    for (int64_t i = 0; i < m * n; ++i) {
+        C[i] = 0;
+    }
+    for (int64_t i = 0; i < m; ++i) {
+        for (int64_t p = 0; p < k; ++p) {
+            const scalar_t a = A[i * k + p];
+            for (int64_t j = 0; j < n; ++j) {
+                C[i * n + j] += a * B[p * n + j];
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void MatmulBatchedCPU(const void* A_data,
+                      const void* B_data,
+                      void* C_data,
+                      int64_t batch,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        const scalar_t* B = static_cast<const scalar_t*>(B_data);
+        scalar_t* C = static_cast<scalar_t*>(C_data);
+        const int64_t max_dim = std::max(std::max(m, k), n);
+        if (max_dim > kMaxFixedSizeBatchedLinalg) {
+            // Large matrices: one BLAS call per matrix. Row-major C = A @ B
+            // is column-major C^T = B^T @ A^T.
+            utility::ParallelFor(0, batch, [&](int64_t b) {
+                MatmulCPU(const_cast<scalar_t*>(B + b * k * n),
+                          const_cast<scalar_t*>(A + b * m * k), C + b * m * n,
+                          n, k, m, dtype);
+            });
+            return;
+        }
+        const int64_t square = (m == k && k == n) ? n : 0;
+        DispatchMatrixSize(square, [&](auto size) {
+            constexpr int N = decltype(size)::value;
+            utility::ParallelFor(
+                    0, batch,
+                    [&](int64_t b) {
+                        MatmulFixed<scalar_t, N>(A + b * m * k, B + b * k * n,
+                                                 C + b * m * n, m, k, n);
+                    },
+                    kBatchGrainSize);
+        });
+    });
+}
+
+void InverseBatchedCPU(const void* A_data,
+                       void* output_data,
+                       int64_t batch,
+                       int64_t n,
+                       Dtype dtype) {
+    std::atomic<bool> singular(false);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* output = static_cast<scalar_t*>(output_data);
+        DispatchMatrixSize(n, [&](auto size) {
+            constexpr int N = decltype(size)::value;
+            utility::ParallelForRange(
+                    0, batch, kBatchGrainSize, [&](int64_t begin, int64_t end) {
+                        LUWorkspace<scalar_t, N> ws(n);
+                        for (int64_t b = begin; b < end; ++b) {
+                            scalar_t* X = output + b * n * n;
+                            scalar_t sign;
+                            if (!LUFactor<scalar_t, N>(A + b * n * n, n,
+                                                       ws.LU(), ws.Perm(),
+                                                       &sign)) {
+                                singular = true;
+                                continue;
+                            }
+                            // X = P I.
+                            for (int64_t i = 0; i < n; ++i) {
+                                for (int64_t j = 0; j < n; ++j) {
+                                    X[i * n + j] = ws.Perm()[i] == j ? 1 : 0;
+                                }
+                            }
+                            LUSolveInPlace<scalar_t, N>(ws.LU(), n, n, X);
+                        }
+                    });
+        });
+    });
+    if (singular) {
+        utility::LogError("InverseBatchedCPU: singular condition detected.");
+    }
+}
+
+void SolveBatchedCPU(const void* A_data,
+                     void* B_data,
+                     int64_t batch,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype) {
+    std::atomic<bool> singular(false);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* B = static_cast<scalar_t*>(B_data);
+        DispatchMatrixSize(n, [&](auto size) {
+            constexpr int N = decltype(size)::value;
+            utility::ParallelForRange(
+                    0, batch, kBatchGrainSize, [&](int64_t begin, int64_t end) {
+                        LUWorkspace<scalar_t, N> ws(n);
+                        std::vector<scalar_t> rhs(n * k);
+                        for (int64_t b = begin; b < end; ++b) {
+                            scalar_t* X = B + b * n * k;
+                            scalar_t sign;
+                            if (!LUFactor<scalar_t, N>(A + b * n * n, n,
+                                                       ws.LU(), ws.Perm(),
+                                                       &sign)) {
+                                singular = true;
+                                continue;
+                            }
+                            // X = P B.
+                            std::copy(X, X + n * k, rhs.begin());
+                            for (int64_t i = 0; i < n; ++i) {
+                                std::copy(rhs.begin() + ws.Perm()[i] * k,
+                                          rhs.begin() + (ws.Perm()[i] + 1) * k,
+                                          X + i * k);
+                            }
+                            LUSolveInPlace<scalar_t, N>(ws.LU(), n, k, X);
+                        }
+                    });
+        });
+    });
+    if (singular) {
+        utility::LogError("SolveBatchedCPU: singular condition detected.");
+    }
+}
+
+void DetBatchedCPU(const void* A_data,
+                   void* output_data,
+                   int64_t batch,
+                   int64_t n,
+                   Dtype dtype) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* output = static_cast<scalar_t*>(output_data);
+        DispatchMatrixSize(n, [&](auto size) {
+            constexpr int N = decltype(size)::value;
+            utility::ParallelForRange(
+                    0, batch, kBatchGrainSize, [&](int64_t begin, int64_t end) {
+                        LUWorkspace<scalar_t, N> ws(n);
+                        for (int64_t b = begin; b < end; ++b) {
+                            scalar_t det;
+                            if (LUFactor<scalar_t, N>(A + b * n * n, n,
+                                                      ws.LU(), ws.Perm(),
+                                                      &det)) {
+                                for (int64_t i = 0; i < n; ++i) {
+                                    det *= ws.LU()[i * n + i];
+                                }
+                            } else {
+                                det = 0;
+                            }
+                            output[b] = det;
+                        }
+                    });
+        });
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
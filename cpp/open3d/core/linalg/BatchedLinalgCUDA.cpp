@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// cuBLAS is column-major and the batches are row-major, so every matrix is
+// seen transposed by cuBLAS. The functions below account for this.
+
+#include <vector>
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/BlasWrapper.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+
+namespace open3d {
+namespace core {
+
+/// Returns a device array with the addresses of the matrices of a batch.
+template <typename scalar_t>
+static Tensor BatchPointers(const void* data,
+                            int64_t batch,
+                            int64_t matrix_size,
+                            const Device& device) {
+    static_assert(sizeof(scalar_t*) == sizeof(int64_t),
+                  "Pointers must be 64-bit.");
+    std::vector<int64_t> ptrs(batch);
+    const scalar_t* ptr = static_cast<const scalar_t*>(data);
+    for (int64_t b = 0; b < batch; ++b) {
+        ptrs[b] = reinterpret_cast<int64_t>(ptr + b * matrix_size);
+    }
+    return Tensor(ptrs, {batch}, Dtype::Int64).To(device);
+}
+
+static void CheckBatchedInfo(const Tensor& info, const std::string& msg) {
+    std::vector<int> info_cpu = info.ToFlatVector<int>();
+    for (int hinfo : info_cpu) {
+        if (hinfo < 0) {
+            utility::LogError("{}: {}-th parameter is invalid.", msg, -hinfo);
+        } else if (hinfo > 0) {
+            utility::LogError("{}: singular condition detected.", msg);
+        }
+    }
+}
+
+void MatmulBatchedCUDA(const void* A_data,
+                       const void* B_data,
+                       void* C_data,
+                       int64_t batch,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       Dtype dtype,
+                       const Device& device) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t alpha = 1, beta = 0;
+        // Row-major C = A @ B is column-major C^T = B^T @ A^T.
+        OPEN3D_CUBLAS_CHECK(
+                gemm_strided_batched_cuda<scalar_t>(
+                        handle, CUBLAS_OP_N, CUBLAS_OP_N, n, m, k, &alpha,
+                        static_cast<const scalar_t*>(B_data), n, k * n,
+                        static_cast<const scalar_t*>(A_data), k, m * k, &beta,
+                        static_cast<scalar_t*>(C_data), n, m * n, batch),
+                "cuda batched gemm failed");
+    });
+}
+
+void InverseBatchedCUDA(void* A_data,
+                        void* output_data,
+                        int64_t batch,
+                        int64_t n,
+                        Dtype dtype,
+                        const Device& device) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        // inv(A^T) = inv(A)^T, so no transposition is needed.
+        Tensor A_ptrs = BatchPointers<scalar_t>(A_data, batch, n * n, device);
+        Tensor output_ptrs =
+                BatchPointers<scalar_t>(output_data, batch, n * n, device);
+        Tensor ipiv = Tensor::Empty({batch, n}, Dtype::Int32, device);
+        Tensor info = Tensor::Empty({batch}, Dtype::Int32, device);
+
+        OPEN3D_CUBLAS_CHECK(
+                getrf_batched_cuda<scalar_t>(
+                        handle, n,
+                        static_cast<scalar_t**>(A_ptrs.GetDataPtr()), n,
+                        static_cast<int*>(ipiv.GetDataPtr()),
+                        static_cast<int*>(info.GetDataPtr()), batch),
+                "getrf_batched failed in InverseBatchedCUDA");
+        CheckBatchedInfo(info, "getrf_batched failed in InverseBatchedCUDA");
+
+        OPEN3D_CUBLAS_CHECK(
+                getri_batched_cuda<scalar_t>(
+                        handle, n,
+                        static_cast<scalar_t**>(A_ptrs.GetDataPtr()), n,
+                        static_cast<int*>(ipiv.GetDataPtr()),
+                        static_cast<scalar_t**>(output_ptrs.GetDataPtr()), n,
+                        static_cast<int*>(info.GetDataPtr()), batch),
+                "getri_batched failed in InverseBatchedCUDA");
+        CheckBatchedInfo(info, "getri_batched failed in InverseBatchedCUDA");
+    });
+}
+
+void SolveBatchedCUDA(void* A_data,
+                      void* B_T_data,
+                      int64_t batch,
+                      int64_t n,
+                      int64_t k,
+                      Dtype dtype,
+                      const Device& device) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        // cuBLAS sees A^T and factorizes it. Solving with the transposed
+        // factors solves A X = B, where the (k, n) row-major B^T is the
+        // (n, k) column-major B.
+        Tensor A_ptrs = BatchPointers<scalar_t>(A_data, batch, n * n, device);
+        Tensor B_ptrs = BatchPointers<scalar_t>(B_T_data, batch, n * k, device);
+        Tensor ipiv = Tensor::Empty({batch, n}, Dtype::Int32, device);
+        Tensor info = Tensor::Empty({batch}, Dtype::Int32, device);
+
+        OPEN3D_CUBLAS_CHECK(
+                getrf_batched_cuda<scalar_t>(
+                        handle, n,
+                        static_cast<scalar_t**>(A_ptrs.GetDataPtr()), n,
+                        static_cast<int*>(ipiv.GetDataPtr()),
+                        static_cast<int*>(info.GetDataPtr()), batch),
+                "getrf_batched failed in SolveBatchedCUDA");
+        CheckBatchedInfo(info, "getrf_batched failed in SolveBatchedCUDA");
+
+        int hinfo = 0;
+        OPEN3D_CUBLAS_CHECK(
+                getrs_batched_cuda<scalar_t>(
+                        handle, CUBLAS_OP_T, n, k,
+                        static_cast<scalar_t**>(A_ptrs.GetDataPtr()), n,
+                        static_cast<int*>(ipiv.GetDataPtr()),
+                        static_cast<scalar_t**>(B_ptrs.GetDataPtr()), n,
+                        &hinfo, batch),
+                "getrs_batched failed in SolveBatchedCUDA");
+        if (hinfo < 0) {
+            utility::LogError(
+                    "getrs_batched failed in SolveBatchedCUDA: {}-th "
+                    "parameter is invalid.",
+                    -hinfo);
+        }
+    });
+}
+
+void LUBatchedCUDA(void* A_data,
+                   void* ipiv_data,
+                   int64_t batch,
+                   int64_t n,
+                   Dtype dtype,
+                   const Device& device) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        // det(A^T) = det(A), singular matrices are not an error here.
+        Tensor A_ptrs = BatchPointers<scalar_t>(A_data, batch, n * n, device);
+        Tensor info = Tensor::Empty({batch}, Dtype::Int32, device);
+        OPEN3D_CUBLAS_CHECK(
+                getrf_batched_cuda<scalar_t>(
+                        handle, n,
+                        static_cast<scalar_t**>(A_ptrs.GetDataPtr()), n,
+                        static_cast<int*>(ipiv_data),
+                        static_cast<int*>(info.GetDataPtr()), batch),
+                "getrf_batched failed in LUBatchedCUDA");
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
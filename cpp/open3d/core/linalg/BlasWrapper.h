@@ -207,6 +207,207 @@ inline cublasStatus_t trsm_cuda<double>(cublasHandle_t handle,
     return cublasDtrsm(handle, side, uplo, trans, diag, m, n, alpha, A, lda, B,
                        ldb);
 }
+
+template <typename scalar_t>
+inline cublasStatus_t gemm_strided_batched_cuda(cublasHandle_t handle,
+                                                cublasOperation_t transa,
+                                                cublasOperation_t transb,
+                                                int m,
+                                                int n,
+                                                int k,
+                                                const scalar_t *alpha,
+                                                const scalar_t *A_data,
+                                                int lda,
+                                                long long stride_A,
+                                                const scalar_t *B_data,
+                                                int ldb,
+                                                long long stride_B,
+                                                const scalar_t *beta,
+                                                scalar_t *C_data,
+                                                int ldc,
+                                                long long stride_C,
+                                                int batch_count) {
+    utility::LogError("Unsupported data type.");
+    return CUBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <typename scalar_t>
+inline cublasStatus_t getrf_batched_cuda(cublasHandle_t handle,
+                                         int n,
+                                         scalar_t *const A_array[],
+                                         int lda,
+                                         int *ipiv_data,
+                                         int *info_data,
+                                         int batch_size) {
+    utility::LogError("Unsupported data type.");
+    return CUBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <typename scalar_t>
+inline cublasStatus_t getri_batched_cuda(cublasHandle_t handle,
+                                         int n,
+                                         const scalar_t *const A_array[],
+                                         int lda,
+                                         const int *ipiv_data,
+                                         scalar_t *const C_array[],
+                                         int ldc,
+                                         int *info_data,
+                                         int batch_size) {
+    utility::LogError("Unsupported data type.");
+    return CUBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <typename scalar_t>
+inline cublasStatus_t getrs_batched_cuda(cublasHandle_t handle,
+                                         cublasOperation_t trans,
+                                         int n,
+                                         int nrhs,
+                                         const scalar_t *const A_array[],
+                                         int lda,
+                                         const int *ipiv_data,
+                                         scalar_t *const B_array[],
+                                         int ldb,
+                                         int *info,
+                                         int batch_size) {
+    utility::LogError("Unsupported data type.");
+    return CUBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <>
+inline cublasStatus_t gemm_strided_batched_cuda<float>(
+        cublasHandle_t handle,
+        cublasOperation_t transa,
+        cublasOperation_t transb,
+        int m,
+        int n,
+        int k,
+        const float *alpha,
+        const float *A_data,
+        int lda,
+        long long stride_A,
+        const float *B_data,
+        int ldb,
+        long long stride_B,
+        const float *beta,
+        float *C_data,
+        int ldc,
+        long long stride_C,
+        int batch_count) {
+    return cublasSgemmStridedBatched(handle, transa, transb, m, n, k, alpha,
+                                     A_data, lda, stride_A, B_data, ldb,
+                                     stride_B, beta, C_data, ldc, stride_C,
+                                     batch_count);
+}
+
+template <>
+inline cublasStatus_t getrf_batched_cuda<float>(cublasHandle_t handle,
+                                                int n,
+                                                float *const A_array[],
+                                                int lda,
+                                                int *ipiv_data,
+                                                int *info_data,
+                                                int batch_size) {
+    return cublasSgetrfBatched(handle, n, A_array, lda, ipiv_data, info_data,
+                               batch_size);
+}
+
+template <>
+inline cublasStatus_t getri_batched_cuda<float>(cublasHandle_t handle,
+                                                int n,
+                                                const float *const A_array[],
+                                                int lda,
+                                                const int *ipiv_data,
+                                                float *const C_array[],
+                                                int ldc,
+                                                int *info_data,
+                                                int batch_size) {
+    return cublasSgetriBatched(handle, n, A_array, lda, ipiv_data, C_array,
+                               ldc, info_data, batch_size);
+}
+
+template <>
+inline cublasStatus_t getrs_batched_cuda<float>(cublasHandle_t handle,
+                                                cublasOperation_t trans,
+                                                int n,
+                                                int nrhs,
+                                                const float *const A_array[],
+                                                int lda,
+                                                const int *ipiv_data,
+                                                float *const B_array[],
+                                                int ldb,
+                                                int *info,
+                                                int batch_size) {
+    return cublasSgetrsBatched(handle, trans, n, nrhs, A_array, lda,
+                               ipiv_data, B_array, ldb, info, batch_size);
+}
+
+template <>
+inline cublasStatus_t gemm_strided_batched_cuda<double>(
+        cublasHandle_t handle,
+        cublasOperation_t transa,
+        cublasOperation_t transb,
+        int m,
+        int n,
+        int k,
+        const double *alpha,
+        const double *A_data,
+        int lda,
+        long long stride_A,
+        const double *B_data,
+        int ldb,
+        long long stride_B,
+        const double *beta,
+        double *C_data,
+        int ldc,
+        long long stride_C,
+        int batch_count) {
+    return cublasDgemmStridedBatched(handle, transa, transb, m, n, k, alpha,
+                                     A_data, lda, stride_A, B_data, ldb,
+                                     stride_B, beta, C_data, ldc, stride_C,
+                                     batch_count);
+}
+
+template <>
+inline cublasStatus_t getrf_batched_cuda<double>(cublasHandle_t handle,
+                                                 int n,
+                                                 double *const A_array[],
+                                                 int lda,
+                                                 int *ipiv_data,
+                                                 int *info_data,
+                                                 int batch_size) {
+    return cublasDgetrfBatched(handle, n, A_array, lda, ipiv_data, info_data,
+                               batch_size);
+}
+
+template <>
+inline cublasStatus_t getri_batched_cuda<double>(cublasHandle_t handle,
+                                                 int n,
+                                                 const double *const A_array[],
+                                                 int lda,
+                                                 const int *ipiv_data,
+                                                 double *const C_array[],
+                                                 int ldc,
+                                                 int *info_data,
+                                                 int batch_size) {
+    return cublasDgetriBatched(handle, n, A_array, lda, ipiv_data, C_array,
+                               ldc, info_data, batch_size);
+}
+
+template <>
+inline cublasStatus_t getrs_batched_cuda<double>(cublasHandle_t handle,
+                                                 cublasOperation_t trans,
+                                                 int n,
+                                                 int nrhs,
+                                                 const double *const A_array[],
+                                                 int lda,
+                                                 const int *ipiv_data,
+                                                 double *const B_array[],
+                                                 int ldb,
+                                                 int *info,
+                                                 int batch_size) {
+    return cublasDgetrsBatched(handle, trans, n, nrhs, A_array, lda,
+                               ipiv_data, B_array, ldb, info, batch_size);
+}
 #endif
 
 }  // namespace core
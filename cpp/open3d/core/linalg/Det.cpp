@@ -27,12 +27,17 @@
 #include "open3d/core/linalg/Det.h"
 
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/LU.h"
 
 namespace open3d {
 namespace core {
 
 double Det(const Tensor& A) {
+    if (UseHostFallbackLinalg(A.GetDevice(), A.NumElements())) {
+        return Det(A.To(Device("CPU:0")));
+    }
+
     Tensor ipiv, output;
     LUIpiv(A, ipiv, output);
     // Sequential loop to compute determinant from LU output, is more efficient
@@ -56,5 +61,60 @@ double Det(const Tensor& A) {
     return det;
 }
 
+Tensor BatchedDet(const Tensor& A) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "Only tensors with Float32 or Float64 are supported, but "
+                "received {}.",
+                dtype.ToString());
+    }
+    SizeVector A_shape = A.GetShape();
+    if (A_shape.size() != 3) {
+        utility::LogError("Tensor must be 3D, but got {}D.", A_shape.size());
+    }
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError("Tensor must be square, but got {} x {}.", A_shape[1],
+                          A_shape[2]);
+    }
+    int64_t batch = A_shape[0];
+    int64_t n = A_shape[1];
+    if (n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (batch == 0) {
+        return Tensor::Empty({0}, dtype, device);
+    }
+    if (UseHostFallbackLinalg(device, A.NumElements())) {
+        return BatchedDet(A.To(Device("CPU:0"))).To(device);
+    }
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        Tensor LU = A.To(device, /*copy=*/true);
+        Tensor ipiv = Tensor::Empty({batch, n}, Dtype::Int32, device);
+        LUBatchedCUDA(LU.GetDataPtr(), ipiv.GetDataPtr(), batch, n, dtype,
+                      device);
+        // Product of the diagonal of U, negated for each row swap. The pivots
+        // are 1-based.
+        Tensor diag = LU.Reshape({batch, n * n}).Slice(1, 0, n * n, n + 1);
+        Tensor swapped =
+                ipiv.Ne(Tensor::Arange(1, n + 1, 1, Dtype::Int32, device))
+                        .To(dtype);
+        Tensor sign = swapped.Mul(-2).Add(1).Prod({1});
+        return diag.Prod({1}).Mul(sign);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    }
+    Tensor A_contiguous = A.Contiguous();
+    Tensor output = Tensor::Empty({batch}, dtype, device);
+    DetBatchedCPU(A_contiguous.GetDataPtr(), output.GetDataPtr(), batch, n,
+                  dtype);
+    return output;
+}
+
 }  // namespace core
 }  // namespace open3d
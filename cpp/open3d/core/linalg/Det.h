@@ -34,5 +34,8 @@ namespace core {
 // See documentation for `core::Tensor::Det`.
 double Det(const Tensor& A);
 
+// See documentation for `core::Tensor::BatchedDet`.
+Tensor BatchedDet(const Tensor& A);
+
 }  // namespace core
 }  // namespace open3d
@@ -28,11 +28,48 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 
 namespace open3d {
 namespace core {
 
+/// Inverse of a (N, n, n) tensor of a supported dtype.
+static void InverseBatched(const Tensor &A, Tensor &output) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    SizeVector A_shape = A.GetShape();
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError("Tensor must be square, but got {} x {}.", A_shape[1],
+                          A_shape[2]);
+    }
+    int64_t batch = A_shape[0];
+    int64_t n = A_shape[1];
+    if (n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    output = Tensor::Empty({batch, n, n}, dtype, device);
+    if (batch == 0) {
+        return;
+    }
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // A is modified in-place by the LU factorization.
+        Tensor A_copy = A.To(device, /*copy=*/true);
+        InverseBatchedCUDA(A_copy.GetDataPtr(), output.GetDataPtr(), batch, n,
+                           dtype, device);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        Tensor A_contiguous = A.Contiguous();
+        InverseBatchedCPU(A_contiguous.GetDataPtr(), output.GetDataPtr(),
+                          batch, n, dtype);
+    }
+}
+
 void Inverse(const Tensor &A, Tensor &output) {
     // Check devices
     Device device = A.GetDevice();
@@ -46,10 +83,21 @@ void Inverse(const Tensor &A, Tensor &output) {
                 dtype.ToString());
     }
 
+    if (UseHostFallbackLinalg(device, A.NumElements())) {
+        Inverse(A.To(Device("CPU:0")), output);
+        output = output.To(device);
+        return;
+    }
+
     // Check dimensions
     SizeVector A_shape = A.GetShape();
+    if (A_shape.size() == 3) {
+        InverseBatched(A, output);
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor must be 2D, but got {}D.", A_shape.size());
+        utility::LogError("Tensor must be 2D or 3D, but got {}D.",
+                          A_shape.size());
     }
     if (A_shape[0] != A_shape[1]) {
         utility::LogError("Tensor must be square, but got {} x {}.", A_shape[0],
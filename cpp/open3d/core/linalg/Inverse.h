@@ -32,6 +32,7 @@ namespace open3d {
 namespace core {
 
 /// Computes A^{-1} with LU factorization, where A is a N x N square matrix.
+/// If A is a (B, N, N) batch of matrices, each matrix is inverted.
 void Inverse(const Tensor& A, Tensor& output);
 
 void InverseCPU(void* A_data,
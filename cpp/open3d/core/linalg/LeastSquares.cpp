@@ -56,8 +56,30 @@ void LeastSquares(const Tensor &A, const Tensor &B, Tensor &X) {
     // Check dimensions
     SizeVector A_shape = A.GetShape();
     SizeVector B_shape = B.GetShape();
+    if (A_shape.size() == 3) {
+        // QR decompositions of a batch are computed one matrix at a time.
+        if (B_shape.size() != 2 && B_shape.size() != 3) {
+            utility::LogError(
+                    "Tensor B must be 2D (batch of vectors) or 3D (batch of "
+                    "matrices), but got {}D.",
+                    B_shape.size());
+        }
+        if (B_shape[0] != A_shape[0]) {
+            utility::LogError("Tensor A and B's batch size mismatch.");
+        }
+        SizeVector X_shape = B_shape;
+        X_shape[1] = A_shape[2];
+        X = Tensor::Empty(X_shape, dtype, device);
+        for (int64_t b = 0; b < A_shape[0]; ++b) {
+            Tensor X_b;
+            LeastSquares(A[b], B[b], X_b);
+            X[b] = X_b;
+        }
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor A must be 2D, but got {}D", A_shape.size());
+        utility::LogError("Tensor A must be 2D or 3D, but got {}D",
+                          A_shape.size());
     }
     if (B_shape.size() != 1 && B_shape.size() != 2) {
         utility::LogError(
@@ -32,6 +32,8 @@ namespace open3d {
 namespace core {
 
 /// Solve AX = B with QR decomposition. A is a full-rank m x n matrix (m >= n).
+/// For a (N, m, n) batch A and a (N, m) or (N, m, k) batch B, the systems are
+/// solved matrix by matrix.
 void LeastSquares(const Tensor& A, const Tensor& B, Tensor& X);
 
 #ifdef BUILD_CUDA_MODULE
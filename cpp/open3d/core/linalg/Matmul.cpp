@@ -28,9 +28,59 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
+
 namespace open3d {
 namespace core {
 
+/// Matmul of (N, m, k) and (N, k, n) tensors of a supported dtype.
+static void MatmulBatched(const Tensor& A, const Tensor& B, Tensor& output) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    SizeVector A_shape = A.GetShape();
+    SizeVector B_shape = B.GetShape();
+    if (B_shape.size() != 3) {
+        utility::LogError(
+                "Tensor B must be 3D for batched Matmul, but got {}D.",
+                B_shape.size());
+    }
+    if (A_shape[0] != B_shape[0]) {
+        utility::LogError("Tensor A batch size {} mismatch with Tensor B {}.",
+                          A_shape[0], B_shape[0]);
+    }
+    if (A_shape[2] != B_shape[1]) {
+        utility::LogError("Tensor A columns {} mismatch with Tensor B rows {}.",
+                          A_shape[2], B_shape[1]);
+    }
+
+    int64_t batch = A_shape[0];
+    int64_t m = A_shape[1];
+    int64_t k = A_shape[2];
+    int64_t n = B_shape[2];
+    if (m == 0 || k == 0 || n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    output = Tensor::Empty({batch, m, n}, dtype, device);
+    if (batch == 0) {
+        return;
+    }
+
+    Tensor A_contiguous = A.Contiguous();
+    Tensor B_contiguous = B.Contiguous();
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MatmulBatchedCUDA(A_contiguous.GetDataPtr(), B_contiguous.GetDataPtr(),
+                          output.GetDataPtr(), batch, m, k, n, dtype, device);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        MatmulBatchedCPU(A_contiguous.GetDataPtr(), B_contiguous.GetDataPtr(),
+                         output.GetDataPtr(), batch, m, k, n, dtype);
+    }
+}
+
 void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
     // Check devices
     Device device = A.GetDevice();
@@ -56,8 +106,14 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
     SizeVector A_shape = A.GetShape();
     SizeVector B_shape = B.GetShape();
 
+    if (A_shape.size() == 3) {
+        MatmulBatched(A.To(dtype), B.To(dtype), output);
+        output = output.To(dtype_original);
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor A must be 2D, but got {}D.", A_shape.size());
+        utility::LogError("Tensor A must be 2D or 3D, but got {}D.",
+                          A_shape.size());
     }
     if (B_shape.size() != 1 && B_shape.size() != 2) {
         utility::LogError(
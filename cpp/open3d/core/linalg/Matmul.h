@@ -31,7 +31,8 @@
 namespace open3d {
 namespace core {
 
-/// Computes matrix multiplication C = AB.
+/// Computes matrix multiplication C = AB. If A is a (N, m, k) batch of
+/// matrices, B must be a (N, k, n) batch and C[i] = A[i] B[i].
 void Matmul(const Tensor& A, const Tensor& B, Tensor& C);
 
 #ifdef BUILD_CUDA_MODULE
@@ -46,8 +46,24 @@ void SVD(const Tensor &A, Tensor &U, Tensor &S, Tensor &VT) {
 
     // Check dimensions
     SizeVector A_shape = A.GetShape();
+    if (A_shape.size() == 3) {
+        // Matrices of a batch are decomposed one at a time.
+        int64_t batch = A_shape[0], m = A_shape[1], n = A_shape[2];
+        U = Tensor::Empty({batch, m, m}, dtype, device);
+        S = Tensor::Empty({batch, n}, dtype, device);
+        VT = Tensor::Empty({batch, n, n}, dtype, device);
+        for (int64_t b = 0; b < batch; ++b) {
+            Tensor U_b, S_b, VT_b;
+            SVD(A[b], U_b, S_b, VT_b);
+            U[b] = U_b;
+            S[b] = S_b;
+            VT[b] = VT_b;
+        }
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor must be 2D, but got {}D", A_shape.size());
+        utility::LogError("Tensor must be 2D or 3D, but got {}D",
+                          A_shape.size());
     }
 
     int64_t m = A_shape[0], n = A_shape[1];
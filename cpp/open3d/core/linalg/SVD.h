@@ -32,7 +32,8 @@ namespace open3d {
 namespace core {
 
 /// Computes SVD decomposition A = U S VT, where A is an m x n, U is an m x m, S
-/// is a min(m, n), VT is an n x n tensor.
+/// is a min(m, n), VT is an n x n tensor. A (N, m, n) batch of matrices is
+/// decomposed matrix by matrix into (N, m, m), (N, n) and (N, n, n) tensors.
 void SVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
 
 #ifdef BUILD_CUDA_MODULE
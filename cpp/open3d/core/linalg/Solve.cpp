@@ -32,11 +32,66 @@
 
 #include <unordered_map>
 
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 
 namespace open3d {
 namespace core {
 
+/// Solve for a (N, n, n) A and a (N, n) or (N, n, k) B of a supported dtype.
+static void SolveBatched(const Tensor &A, const Tensor &B, Tensor &X) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    SizeVector A_shape = A.GetShape();
+    SizeVector B_shape = B.GetShape();
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError("Tensor A must be square, but got {} x {}.",
+                          A_shape[1], A_shape[2]);
+    }
+    if (B_shape.size() != 2 && B_shape.size() != 3) {
+        utility::LogError(
+                "Tensor B must be 2D (batch of vectors) or 3D (batch of "
+                "matrices), but got {}D",
+                B_shape.size());
+    }
+    if (B_shape[0] != A_shape[0] || B_shape[1] != A_shape[1]) {
+        utility::LogError("Tensor A and B's first two dimensions mismatch.");
+    }
+
+    int64_t batch = A_shape[0];
+    int64_t n = A_shape[1];
+    int64_t k = B_shape.size() == 3 ? B_shape[2] : 1;
+    if (n == 0 || k == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (batch == 0) {
+        X = Tensor::Empty(B_shape, dtype, device);
+        return;
+    }
+    Tensor B_3d = B.Reshape({batch, n, k});
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // A and B are modified in-place.
+        Tensor A_copy = A.To(device, /*copy=*/true);
+        Tensor X_T = B_3d.Transpose(1, 2).To(device, /*copy=*/true);
+        SolveBatchedCUDA(A_copy.GetDataPtr(), X_T.GetDataPtr(), batch, n, k,
+                         dtype, device);
+        X = X_T.Transpose(1, 2).Contiguous();
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        Tensor A_contiguous = A.Contiguous();
+        // B is modified in-place.
+        X = B_3d.To(device, /*copy=*/true);
+        SolveBatchedCPU(A_contiguous.GetDataPtr(), X.GetDataPtr(), batch, n, k,
+                        dtype);
+    }
+    X = X.Reshape(B_shape);
+}
+
 void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
     // Check devices
     Device device = A.GetDevice();
@@ -59,11 +114,23 @@ void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
                 dtype.ToString());
     }
 
+    if (UseHostFallbackLinalg(device, A.NumElements() + B.NumElements())) {
+        Device host("CPU:0");
+        Solve(A.To(host), B.To(host), X);
+        X = X.To(device);
+        return;
+    }
+
     // Check dimensions
     SizeVector A_shape = A.GetShape();
     SizeVector B_shape = B.GetShape();
+    if (A_shape.size() == 3) {
+        SolveBatched(A, B, X);
+        return;
+    }
     if (A_shape.size() != 2) {
-        utility::LogError("Tensor A must be 2D, but got {}D", A_shape.size());
+        utility::LogError("Tensor A must be 2D or 3D, but got {}D",
+                          A_shape.size());
     }
     if (A_shape[0] != A_shape[1]) {
         utility::LogError("Tensor A must be square, but got {} x {}.",
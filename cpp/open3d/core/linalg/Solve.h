@@ -31,7 +31,9 @@
 namespace open3d {
 namespace core {
 
-/// Solve AX = B with LU decomposition. A is a square matrix.
+/// Solve AX = B with LU decomposition. A is a square matrix. If A is a
+/// (N, n, n) batch of matrices, B must be a (N, n) or (N, n, k) batch and
+/// each system A[i] X[i] = B[i] is solved.
 void Solve(const Tensor& A, const Tensor& B, Tensor& X);
 
 void SolveCPU(void* A_data,
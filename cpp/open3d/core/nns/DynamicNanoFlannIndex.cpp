@@ -0,0 +1,397 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/DynamicNanoFlannIndex.h"
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Stack the rows of \p a on top of the rows of \p b.
+static Tensor ConcatenateRows(const Tensor &a, const Tensor &b) {
+    SizeVector shape = a.GetShape();
+    shape[0] = a.GetLength() + b.GetLength();
+    Tensor dst(shape, a.GetDtype(), a.GetDevice());
+    dst.Slice(0, 0, a.GetLength()) = a;
+    dst.Slice(0, a.GetLength(), shape[0]) = b;
+    return dst;
+}
+
+DynamicNanoFlannIndex::DynamicNanoFlannIndex(){};
+
+DynamicNanoFlannIndex::DynamicNanoFlannIndex(const Tensor &dataset_points) {
+    Add(dataset_points);
+};
+
+DynamicNanoFlannIndex::~DynamicNanoFlannIndex(){};
+
+Tensor DynamicNanoFlannIndex::Add(const Tensor &points) {
+    if (points.GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "[DynamicNanoFlannIndex::Add] points should be CPU Tensor.");
+    }
+    if (points.NumDims() != 2) {
+        utility::LogError(
+                "[DynamicNanoFlannIndex::Add] points must be 2D matrix, with "
+                "shape {n_points, d}.");
+    }
+    if (dtype_ == Dtype::Undefined) {
+        if (points.GetDtype() != Dtype::Float32 &&
+            points.GetDtype() != Dtype::Float64) {
+            utility::LogError(
+                    "[DynamicNanoFlannIndex::Add] points must be Float32 or "
+                    "Float64, but got {}.",
+                    points.GetDtype().ToString());
+        }
+        dtype_ = points.GetDtype();
+        dimension_ = static_cast<int>(points.GetShape(1));
+    }
+    points.AssertDtype(dtype_);
+    points.AssertShapeCompatible({utility::nullopt, dimension_});
+
+    int64_t num_points = points.GetLength();
+    int64_t first_id = static_cast<int64_t>(id_to_tree_.size());
+    Tensor ids = Tensor::Arange(first_id, first_id + num_points, 1,
+                                Dtype::Int64, points.GetDevice());
+    if (num_points == 0) {
+        return ids;
+    }
+    id_to_tree_.resize(first_id + num_points, nullptr);
+
+    // Merge with the smaller trees, so that the sizes of the trees keep
+    // decreasing geometrically.
+    Tensor block_points = points.Contiguous();
+    Tensor block_ids = ids;
+    while (!trees_.empty() &&
+           trees_.back()->NumAlive() <= block_ids.GetLength()) {
+        std::pair<Tensor, Tensor> alive = AlivePointsAndIds(*trees_.back());
+        block_points = ConcatenateRows(alive.first, block_points);
+        block_ids = ConcatenateRows(alive.second, block_ids);
+        trees_.pop_back();
+    }
+    trees_.push_back(BuildTree(block_points, block_ids));
+    SortTrees();
+    num_alive_ += num_points;
+    return ids;
+}
+
+int64_t DynamicNanoFlannIndex::Remove(const Tensor &ids) {
+    ids.AssertDtype(Dtype::Int64);
+    if (ids.NumDims() != 1) {
+        utility::LogError(
+                "[DynamicNanoFlannIndex::Remove] ids must be 1D, but got "
+                "shape {}.",
+                ids.GetShape().ToString());
+    }
+    Tensor ids_cpu = ids.To(Device("CPU:0")).Contiguous();
+    const int64_t *ids_ptr = ids_cpu.GetDataPtr<int64_t>();
+    int64_t num_ids = ids_cpu.GetLength();
+    int64_t max_id = static_cast<int64_t>(id_to_tree_.size());
+
+    int64_t num_removed = 0;
+    std::unordered_set<Tree *> touched_trees;
+    for (int64_t i = 0; i < num_ids; ++i) {
+        int64_t id = ids_ptr[i];
+        if (id < 0 || id >= max_id || id_to_tree_[id] == nullptr) {
+            continue;
+        }
+        Tree *tree = id_to_tree_[id];
+        tree->num_removed_++;
+        id_to_tree_[id] = nullptr;
+        touched_trees.insert(tree);
+        num_removed++;
+    }
+    num_alive_ -= num_removed;
+
+    // Rebuild the trees that lost at least half of their points, so that the
+    // search never wades through more removed points than alive ones.
+    for (auto it = trees_.begin(); it != trees_.end();) {
+        Tree *tree = it->get();
+        if (touched_trees.count(tree) == 0 ||
+            tree->num_removed_ * 2 < tree->Size()) {
+            ++it;
+        } else if (tree->NumAlive() == 0) {
+            it = trees_.erase(it);
+        } else {
+            std::pair<Tensor, Tensor> alive = AlivePointsAndIds(*tree);
+            *it = BuildTree(alive.first, alive.second);
+            ++it;
+        }
+    }
+    SortTrees();
+    return num_removed;
+}
+
+std::pair<Tensor, Tensor> DynamicNanoFlannIndex::SearchKnn(
+        const Tensor &query_points, int knn) const {
+    AssertQueryPoints(query_points);
+    if (knn <= 0) {
+        utility::LogError(
+                "[DynamicNanoFlannIndex::SearchKnn] knn should be larger than "
+                "0.");
+    }
+
+    int64_t num_query_points = query_points.GetLength();
+    int64_t num_neighbors = std::min<int64_t>(knn, num_alive_);
+    Tensor indices = Tensor::Empty({num_query_points, num_neighbors},
+                                   Dtype::Int64);
+    Tensor distances = Tensor::Empty({num_query_points, num_neighbors}, dtype_);
+    if (num_neighbors == 0) {
+        return std::make_pair(indices, distances);
+    }
+
+    // Search each tree for enough neighbors to cover its removed points.
+    std::vector<std::pair<Tensor, Tensor>> tree_results;
+    for (const std::unique_ptr<Tree> &tree : trees_) {
+        int tree_knn = static_cast<int>(
+                std::min<int64_t>(knn + tree->num_removed_, tree->Size()));
+        tree_results.push_back(tree->index_.SearchKnn(query_points, tree_knn));
+    }
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_query_points),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    std::vector<std::pair<scalar_t, int64_t>> candidates;
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        candidates.clear();
+                        for (size_t t = 0; t < trees_.size(); ++t) {
+                            const Tree *tree = trees_[t].get();
+                            const int64_t *tree_ids =
+                                    tree->ids_.GetDataPtr<int64_t>();
+                            const Tensor &tree_indices = tree_results[t].first;
+                            int64_t tree_knn = tree_indices.GetShape(1);
+                            const int64_t *row_indices =
+                                    tree_indices.GetDataPtr<int64_t>() +
+                                    i * tree_knn;
+                            const scalar_t *row_distances =
+                                    tree_results[t]
+                                            .second.GetDataPtr<scalar_t>() +
+                                    i * tree_knn;
+                            for (int64_t k = 0; k < tree_knn; ++k) {
+                                int64_t id = tree_ids[row_indices[k]];
+                                if (id_to_tree_[id] == tree) {
+                                    candidates.emplace_back(row_distances[k],
+                                                            id);
+                                }
+                            }
+                        }
+                        std::partial_sort(candidates.begin(),
+                                          candidates.begin() + num_neighbors,
+                                          candidates.end());
+                        for (int64_t k = 0; k < num_neighbors; ++k) {
+                            distances_ptr[i * num_neighbors + k] =
+                                    candidates[k].first;
+                            indices_ptr[i * num_neighbors + k] =
+                                    candidates[k].second;
+                        }
+                    }
+                });
+    });
+    return std::make_pair(indices, distances);
+}
+
+std::tuple<Tensor, Tensor, Tensor> DynamicNanoFlannIndex::SearchRadius(
+        const Tensor &query_points, double radius, bool sort) const {
+    AssertQueryPoints(query_points);
+    if (radius <= 0) {
+        utility::LogError(
+                "[DynamicNanoFlannIndex::SearchRadius] radius should be "
+                "larger than 0.");
+    }
+
+    int64_t num_query_points = query_points.GetLength();
+    std::vector<std::tuple<Tensor, Tensor, Tensor>> tree_results;
+    for (const std::unique_ptr<Tree> &tree : trees_) {
+        tree_results.push_back(
+                tree->index_.SearchRadius(query_points, radius, sort));
+    }
+
+    Tensor indices, distances, neighbors_row_splits;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+        std::vector<std::vector<std::pair<scalar_t, int64_t>>> batch_neighbors(
+                num_query_points);
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_query_points),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        auto &neighbors = batch_neighbors[i];
+                        for (size_t t = 0; t < trees_.size(); ++t) {
+                            const Tree *tree = trees_[t].get();
+                            const int64_t *tree_ids =
+                                    tree->ids_.GetDataPtr<int64_t>();
+                            const int64_t *tree_indices =
+                                    std::get<0>(tree_results[t])
+                                            .GetDataPtr<int64_t>();
+                            const scalar_t *tree_distances =
+                                    std::get<1>(tree_results[t])
+                                            .GetDataPtr<scalar_t>();
+                            const int64_t *tree_splits =
+                                    std::get<2>(tree_results[t])
+                                            .GetDataPtr<int64_t>();
+                            for (int64_t k = tree_splits[i];
+                                 k < tree_splits[i + 1]; ++k) {
+                                int64_t id = tree_ids[tree_indices[k]];
+                                if (id_to_tree_[id] == tree) {
+                                    neighbors.emplace_back(tree_distances[k],
+                                                           id);
+                                }
+                            }
+                        }
+                        if (sort) {
+                            std::sort(neighbors.begin(), neighbors.end());
+                        }
+                    }
+                });
+
+        // Flatten.
+        std::vector<int64_t> batch_row_splits(num_query_points + 1, 0);
+        for (int64_t i = 0; i < num_query_points; ++i) {
+            batch_row_splits[i + 1] =
+                    batch_row_splits[i] + batch_neighbors[i].size();
+        }
+        int64_t total_num = batch_row_splits[num_query_points];
+        std::vector<int64_t> batch_indices(total_num);
+        std::vector<scalar_t> batch_distances(total_num);
+        for (int64_t i = 0; i < num_query_points; ++i) {
+            int64_t offset = batch_row_splits[i];
+            for (const auto &neighbor : batch_neighbors[i]) {
+                batch_distances[offset] = neighbor.first;
+                batch_indices[offset] = neighbor.second;
+                offset++;
+            }
+        }
+        indices = Tensor(batch_indices, {total_num}, Dtype::Int64);
+        distances = Tensor(batch_distances, {total_num}, dtype_);
+        neighbors_row_splits =
+                Tensor(batch_row_splits, {num_query_points + 1}, Dtype::Int64);
+    });
+    return std::make_tuple(indices, distances, neighbors_row_splits);
+}
+
+std::pair<Tensor, Tensor> DynamicNanoFlannIndex::SearchHybrid(
+        const Tensor &query_points, double radius, int max_knn) const {
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[DynamicNanoFlannIndex::SearchHybrid] max_knn should be "
+                "larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[DynamicNanoFlannIndex::SearchHybrid] radius should be "
+                "larger than 0.");
+    }
+
+    // The max_knn nearest neighbors, without the ones out of the radius.
+    int64_t num_query_points = query_points.GetLength();
+    std::pair<Tensor, Tensor> knn_result = SearchKnn(query_points, max_knn);
+    int64_t num_neighbors = knn_result.first.GetShape(1);
+    Tensor indices = Tensor::Full({num_query_points, max_knn}, -1,
+                                  Dtype::Int64);
+    Tensor distances = Tensor::Zeros({num_query_points, max_knn}, dtype_);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+        const scalar_t radius_squared = static_cast<scalar_t>(radius * radius);
+        const int64_t *knn_indices_ptr = knn_result.first.GetDataPtr<int64_t>();
+        const scalar_t *knn_distances_ptr =
+                knn_result.second.GetDataPtr<scalar_t>();
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        for (int64_t i = 0; i < num_query_points; ++i) {
+            for (int64_t k = 0; k < num_neighbors; ++k) {
+                scalar_t distance = knn_distances_ptr[i * num_neighbors + k];
+                if (distance > radius_squared) {
+                    break;
+                }
+                indices_ptr[i * max_knn + k] =
+                        knn_indices_ptr[i * num_neighbors + k];
+                distances_ptr[i * max_knn + k] = distance;
+            }
+        }
+    });
+    return std::make_pair(indices, distances);
+}
+
+void DynamicNanoFlannIndex::AssertQueryPoints(
+        const Tensor &query_points) const {
+    if (dtype_ == Dtype::Undefined) {
+        utility::LogError("[DynamicNanoFlannIndex] Index is empty.");
+    }
+    query_points.AssertDtype(dtype_);
+    query_points.AssertShapeCompatible({utility::nullopt, dimension_});
+    query_points.AssertDevice(Device("CPU:0"));
+}
+
+std::unique_ptr<DynamicNanoFlannIndex::Tree> DynamicNanoFlannIndex::BuildTree(
+        const Tensor &points, const Tensor &ids) {
+    std::unique_ptr<Tree> tree(new Tree());
+    tree->points_ = points.Contiguous();
+    tree->ids_ = ids.Contiguous();
+    tree->index_.SetTensorData(tree->points_);
+
+    const int64_t *ids_ptr = tree->ids_.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < tree->Size(); ++i) {
+        id_to_tree_[ids_ptr[i]] = tree.get();
+    }
+    return tree;
+}
+
+std::pair<Tensor, Tensor> DynamicNanoFlannIndex::AlivePointsAndIds(
+        const Tree &tree) const {
+    const int64_t *ids_ptr = tree.ids_.GetDataPtr<int64_t>();
+    std::vector<int64_t> alive_rows;
+    alive_rows.reserve(tree.NumAlive());
+    for (int64_t i = 0; i < tree.Size(); ++i) {
+        if (id_to_tree_[ids_ptr[i]] == &tree) {
+            alive_rows.push_back(i);
+        }
+    }
+    Tensor rows(alive_rows, {static_cast<int64_t>(alive_rows.size())},
+                Dtype::Int64);
+    return std::make_pair(tree.points_.IndexGet({rows}),
+                          tree.ids_.IndexGet({rows}));
+}
+
+void DynamicNanoFlannIndex::SortTrees() {
+    std::stable_sort(trees_.begin(), trees_.end(),
+                     [](const std::unique_ptr<Tree> &a,
+                        const std::unique_ptr<Tree> &b) {
+                         return a->NumAlive() > b->NumAlive();
+                     });
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
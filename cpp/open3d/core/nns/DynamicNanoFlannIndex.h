@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class DynamicNanoFlannIndex
+///
+/// \brief Incrementally updatable KDTree index for nearest neighbor search.
+///
+/// Points are stored in a log-structured forest of NanoFlann KDTrees, sorted
+/// by decreasing size. Added points form a new tree, which is merged with the
+/// smaller trees as long as they are no larger than it, so each point is
+/// rebuilt O(log n) times in total and search visits O(log n) trees. Removed
+/// points are only marked; a tree is rebuilt once half of its points are
+/// removed.
+///
+/// Each point gets a stable id from Add(), and all searches return these ids
+/// instead of row indices. Only CPU tensors are supported.
+class DynamicNanoFlannIndex {
+public:
+    /// \brief Default Constructor.
+    DynamicNanoFlannIndex();
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Initial points, with ids [0, n). Must be 2D,
+    /// with shape {n, d}.
+    DynamicNanoFlannIndex(const Tensor &dataset_points);
+    ~DynamicNanoFlannIndex();
+    DynamicNanoFlannIndex(const DynamicNanoFlannIndex &) = delete;
+    DynamicNanoFlannIndex &operator=(const DynamicNanoFlannIndex &) = delete;
+
+public:
+    /// Add points to the index.
+    ///
+    /// \param points Points to add. Must be 2D, with shape {n, d}. The dtype
+    /// and d must match the points added before.
+    /// \return Tensor of shape {n,}, with dtype Int64, holding the ids of the
+    /// added points.
+    Tensor Add(const Tensor &points);
+
+    /// Remove points from the index. Unknown or already removed ids are
+    /// ignored.
+    ///
+    /// \param ids Ids returned by Add(). Must be 1D, with dtype Int64.
+    /// \return The number of removed points.
+    int64_t Remove(const Tensor &ids);
+
+    /// Perform K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (ids, distances):
+    /// - ids: Tensor of shape {n, min(knn, size)}, with dtype Int64.
+    /// - distances: Tensor of shape {n, min(knn, size)}, same dtype with the
+    /// points. The distances are squared L2 distances.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const;
+
+    /// Perform radius search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param radius Radius.
+    /// \return Tuple of Tensors, (ids, distances, neighbors_row_splits):
+    /// - ids: Tensor of shape {total_num_neighbors,}, dtype Int64.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// the points. The distances are squared L2 distances.
+    /// - neighbors_row_splits: Tensor of shape {n + 1,}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(const Tensor &query_points,
+                                                    double radius,
+                                                    bool sort = true) const;
+
+    /// Perform hybrid search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query point.
+    /// \return Pair of Tensors, (ids, distances):
+    /// - ids: Tensor of shape {n, max_knn}, with dtype Int64, padded with -1.
+    /// - distances: Tensor of shape {n, max_knn}, padded with 0.
+    std::pair<Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                           double radius,
+                                           int max_knn) const;
+
+    /// Get the number of points in the index, excluding removed points.
+    int64_t GetDatasetSize() const { return num_alive_; }
+
+    /// Get the number of KDTrees in the forest.
+    int64_t GetNumTrees() const { return static_cast<int64_t>(trees_.size()); }
+
+    /// Get dimension of the points.
+    int GetDimension() const { return dimension_; }
+
+    /// Get dtype of the points.
+    Dtype GetDtype() const { return dtype_; }
+
+protected:
+    /// A KDTree of the forest.
+    struct Tree {
+        NanoFlannIndex index_;
+        /// Points of the KDTree, with shape {n, d}.
+        Tensor points_;
+        /// Ids of the points of the KDTree, with shape {n,}.
+        Tensor ids_;
+        int64_t num_removed_ = 0;
+
+        int64_t Size() const { return ids_.GetLength(); }
+        int64_t NumAlive() const { return Size() - num_removed_; }
+    };
+
+    /// Check that query points match the points of the index.
+    void AssertQueryPoints(const Tensor &query_points) const;
+
+    /// Build a tree from points and ids and register it as the owner of the
+    /// ids.
+    std::unique_ptr<Tree> BuildTree(const Tensor &points, const Tensor &ids);
+
+    /// Returns the points and ids of \p tree that are not removed.
+    std::pair<Tensor, Tensor> AlivePointsAndIds(const Tree &tree) const;
+
+    /// Sort the trees by decreasing size.
+    void SortTrees();
+
+protected:
+    std::vector<std::unique_ptr<Tree>> trees_;
+    /// The owner tree of each id, or nullptr if the point is removed.
+    std::vector<Tree *> id_to_tree_;
+    int64_t num_alive_ = 0;
+    int dimension_ = 0;
+    Dtype dtype_ = Dtype::Undefined;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
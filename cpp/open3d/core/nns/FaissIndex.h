@@ -85,6 +85,8 @@ public:
         utility::LogError("FaissIndex::SearchHybrid not implemented.");
     }
 
+    using NNSIndex::SearchHybrid;
+
     // query_points must be float32.
     std::pair<Tensor, Tensor> SearchHybrid(const Tensor &query_points,
                                            double radius,
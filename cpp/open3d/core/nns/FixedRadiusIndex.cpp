@@ -224,6 +224,17 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
 
 std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
         const Tensor &query_points, double radius, int max_knn) const {
+    Tensor neighbors_index, neighbors_distance;
+    SearchHybrid(query_points, radius, max_knn, neighbors_index,
+                 neighbors_distance);
+    return std::make_pair(neighbors_index, neighbors_distance);
+}
+
+void FixedRadiusIndex::SearchHybrid(const Tensor &query_points,
+                                    double radius,
+                                    int max_knn,
+                                    Tensor &neighbors_index,
+                                    Tensor &neighbors_distance) const {
 #ifdef BUILD_CUDA_MODULE
     Dtype dtype = GetDtype();
     Device device = GetDevice();
@@ -246,12 +257,13 @@ std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
     std::vector<int64_t> queries_row_splits({0, num_query_points});
-
-    Tensor neighbors_index, neighbors_distance;
+    PrepareHybridOutputs(num_query_points, max_knn, neighbors_index,
+                         neighbors_distance);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        NeighborSearchAllocator<scalar_t> output_allocator(device);
-        // Determine temp_size.
+        // Write the results into the prepared outputs.
+        NeighborSearchAllocator<scalar_t> output_allocator(
+                device, neighbors_index, neighbors_distance);
         HybridSearchCUDA(
                 num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
                 num_query_points, query_points_.GetDataPtr<scalar_t>(),
@@ -262,11 +274,11 @@ std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
                 hash_table_cell_splits_.GetDataPtr<int64_t>(),
                 hash_table_index_.GetDataPtr<int64_t>(), output_allocator);
 
-        neighbors_index = output_allocator.NeighborsIndex();
-        neighbors_distance = output_allocator.NeighborsDistance();
+        neighbors_index = output_allocator.NeighborsIndex().View(
+                {num_query_points, max_knn});
+        neighbors_distance = output_allocator.NeighborsDistance().View(
+                {num_query_points, max_knn});
     });
-    return std::make_pair(neighbors_index.View({num_query_points, max_knn}),
-                          neighbors_distance.View({num_query_points, max_knn}));
 #else
     utility::LogError(
             "FixedRadiusIndex::SearchHybrid BUILD_CUDA_MODULE is OFF. Please "
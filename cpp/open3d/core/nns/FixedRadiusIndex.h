@@ -85,6 +85,12 @@ public:
                                            double radius,
                                            int max_knn) const override;
 
+    void SearchHybrid(const Tensor& query_points,
+                      double radius,
+                      int max_knn,
+                      Tensor& indices,
+                      Tensor& distances) const override;
+
     const double hash_table_size_factor = 1.0 / 32;
     const int64_t max_hash_tabls_size = 33554432;
 
@@ -100,25 +106,46 @@ class NeighborSearchAllocator {
 public:
     NeighborSearchAllocator(Device device) : device_(device) {}
 
+    /// The given \p indices and \p distances are written in place when they
+    /// are contiguous with the requested number of elements, instead of
+    /// allocating new outputs.
+    NeighborSearchAllocator(Device device,
+                            const Tensor& indices,
+                            const Tensor& distances)
+        : indices_(indices), distances_(distances), device_(device) {}
+
     void AllocIndices(int64_t** ptr, size_t num) {
-        indices_ = Tensor::Empty({int64_t(num)}, Dtype::Int64, device_);
+        if (!CanReuse(indices_, num, Dtype::Int64)) {
+            indices_ = Tensor::Empty({int64_t(num)}, Dtype::Int64, device_);
+        }
         *ptr = indices_.GetDataPtr<int64_t>();
     }
 
     void AllocIndices(int64_t** ptr, size_t num, int64_t value) {
-        indices_ = Tensor::Full({int64_t(num)}, value, Dtype::Int64, device_);
+        if (CanReuse(indices_, num, Dtype::Int64)) {
+            indices_.Fill(value);
+        } else {
+            indices_ = Tensor::Full({int64_t(num)}, value, Dtype::Int64,
+                                    device_);
+        }
         *ptr = indices_.GetDataPtr<int64_t>();
     }
 
     void AllocDistances(T** ptr, size_t num) {
-        distances_ =
-                Tensor::Empty({int64_t(num)}, Dtype::FromType<T>(), device_);
+        if (!CanReuse(distances_, num, Dtype::FromType<T>())) {
+            distances_ = Tensor::Empty({int64_t(num)}, Dtype::FromType<T>(),
+                                       device_);
+        }
         *ptr = distances_.GetDataPtr<T>();
     }
 
     void AllocDistances(T** ptr, size_t num, T value) {
-        distances_ = Tensor::Full({int64_t(num)}, value, Dtype::FromType<T>(),
-                                  device_);
+        if (CanReuse(distances_, num, Dtype::FromType<T>())) {
+            distances_.Fill(value);
+        } else {
+            distances_ = Tensor::Full({int64_t(num)}, value,
+                                      Dtype::FromType<T>(), device_);
+        }
         *ptr = distances_.GetDataPtr<T>();
     }
 
@@ -129,6 +156,13 @@ public:
     const Tensor& NeighborsIndex() const { return indices_; }
     const Tensor& NeighborsDistance() const { return distances_; }
 
+private:
+    bool CanReuse(const Tensor& t, size_t num, Dtype dtype) const {
+        return num > 0 && t.NumElements() == int64_t(num) &&
+               t.IsContiguous() && t.GetDtype() == dtype &&
+               t.GetDevice() == device_;
+    }
+
 private:
     Tensor indices_;
     Tensor distances_;
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KnnIndex.h"
+
+#ifdef BUILD_CUDA_MODULE
+#include "open3d/core/nns/KnnSearchOps.h"
+#endif
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+KnnIndex::KnnIndex(){};
+
+KnnIndex::KnnIndex(const Tensor &dataset_points) {
+    SetTensorData(dataset_points);
+};
+
+KnnIndex::~KnnIndex(){};
+
+bool KnnIndex::SetTensorData(const Tensor &dataset_points) {
+#ifdef BUILD_CUDA_MODULE
+    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points should be GPU "
+                "Tensor.");
+    }
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points must be 2D matrix, "
+                "with shape {n_dataset_points, d}.");
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    return true;
+#else
+    utility::LogError(
+            "KnnIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please compile "
+            "Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+};
+
+std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor &query_points,
+                                              int knn) const {
+#ifdef BUILD_CUDA_MODULE
+    Dtype dtype = GetDtype();
+    Device device = GetDevice();
+
+    // Check dtype.
+    query_points.AssertDtype(dtype);
+
+    // Check shape.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    // Check device.
+    query_points.AssertDevice(device);
+
+    if (knn <= 0) {
+        utility::LogError("[KnnIndex::SearchKnn] knn should be larger than 0.");
+    }
+
+    // Same as the CPU search, at most all dataset points are returned.
+    int64_t num_dataset_points = GetDatasetSize();
+    knn = static_cast<int>(std::min<int64_t>(knn, num_dataset_points));
+
+    Tensor query_points_ = query_points.Contiguous();
+    int64_t num_query_points = query_points_.GetShape()[0];
+    Tensor neighbors_index =
+            Tensor::Empty({num_query_points, knn}, Dtype::Int64, device);
+    Tensor neighbors_distance =
+            Tensor::Empty({num_query_points, knn}, dtype, device);
+    if (num_query_points == 0 || knn == 0) {
+        return std::make_pair(neighbors_index, neighbors_distance);
+    }
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        KnnSearchCUDA<scalar_t>(dataset_points_, query_points_, knn,
+                                neighbors_index, neighbors_distance);
+    });
+    return std::make_pair(neighbors_index, neighbors_distance);
+#else
+    utility::LogError(
+            "KnnIndex::SearchKnn BUILD_CUDA_MODULE is OFF. Please compile "
+            "Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
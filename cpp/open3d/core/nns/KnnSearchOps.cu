@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <limits>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/nns/KnnSearchOps.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+constexpr int kKnnBlockSize = 128;
+constexpr int kKnnMaxTileSize = 256;
+constexpr int64_t kKnnMaxSharedMemory = 48 * 1024;
+
+/// Each thread searches the neighbors of one query point. The block loads
+/// \p tile_size dataset points at a time into shared memory, and every thread
+/// insertion-sorts the candidates into its own output row, which keeps the
+/// current best \p knn neighbors in increasing order of distance.
+template <class T>
+__global__ void KnnSearchKernel(const T* __restrict__ points,
+                                int64_t num_points,
+                                const T* __restrict__ queries,
+                                int64_t num_queries,
+                                int dim,
+                                int knn,
+                                int tile_size,
+                                int64_t* __restrict__ indices,
+                                T* __restrict__ distances) {
+    extern __shared__ __align__(sizeof(double)) unsigned char shared_bytes[];
+    T* tile = reinterpret_cast<T*>(shared_bytes);
+
+    const int64_t query_idx =
+            static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    const bool valid = query_idx < num_queries;
+    const T* query = queries + query_idx * dim;
+    int64_t* row_indices = indices + query_idx * knn;
+    T* row_distances = distances + query_idx * knn;
+
+    if (valid) {
+        for (int k = 0; k < knn; ++k) {
+            row_indices[k] = -1;
+            row_distances[k] = std::numeric_limits<T>::max();
+        }
+    }
+
+    for (int64_t tile_begin = 0; tile_begin < num_points;
+         tile_begin += tile_size) {
+        const int num_tile_points = static_cast<int>(
+                min(static_cast<int64_t>(tile_size), num_points - tile_begin));
+        const T* tile_src = points + tile_begin * dim;
+        for (int i = threadIdx.x; i < num_tile_points * dim; i += blockDim.x) {
+            tile[i] = tile_src[i];
+        }
+        __syncthreads();
+
+        if (valid) {
+            T worst = row_distances[knn - 1];
+            for (int p = 0; p < num_tile_points; ++p) {
+                const T* point = tile + p * dim;
+                T dist = 0;
+                for (int d = 0; d < dim; ++d) {
+                    T diff = point[d] - query[d];
+                    dist += diff * diff;
+                }
+                if (dist < worst) {
+                    // Shift the worse neighbors back. On ties the earlier
+                    // dataset point stays in front.
+                    int k = knn - 1;
+                    while (k > 0 && row_distances[k - 1] > dist) {
+                        row_distances[k] = row_distances[k - 1];
+                        row_indices[k] = row_indices[k - 1];
+                        --k;
+                    }
+                    row_distances[k] = dist;
+                    row_indices[k] = tile_begin + p;
+                    worst = row_distances[knn - 1];
+                }
+            }
+        }
+        __syncthreads();
+    }
+}
+
+}  // namespace
+
+template <class T>
+void KnnSearchCUDA(const Tensor& points,
+                   const Tensor& queries,
+                   int knn,
+                   Tensor& neighbors_index,
+                   Tensor& neighbors_distance) {
+    int64_t num_points = points.GetShape(0);
+    int64_t num_queries = queries.GetShape(0);
+    int dim = static_cast<int>(points.GetShape(1));
+
+    // Shrink the tile for high dimensional features to fit shared memory.
+    int64_t point_bytes = std::max<int64_t>(1, dim * sizeof(T));
+    if (point_bytes > kKnnMaxSharedMemory) {
+        utility::LogError(
+                "[KnnSearchCUDA] Dimension {} is too large for the shared "
+                "memory.",
+                dim);
+    }
+    int tile_size = static_cast<int>(std::min<int64_t>(
+            kKnnMaxTileSize, kKnnMaxSharedMemory / point_bytes));
+    size_t shared_memory = static_cast<size_t>(tile_size) * dim * sizeof(T);
+
+    CUDADeviceSwitcher switcher(points.GetDevice());
+    const dim3 block(kKnnBlockSize);
+    const dim3 grid(static_cast<unsigned int>(
+            (num_queries + kKnnBlockSize - 1) / kKnnBlockSize));
+    KnnSearchKernel<T><<<grid, block, shared_memory,
+                         CUDAStream::GetCurrent().Get()>>>(
+            points.GetDataPtr<T>(), num_points, queries.GetDataPtr<T>(),
+            num_queries, dim, knn, tile_size,
+            neighbors_index.GetDataPtr<int64_t>(),
+            neighbors_distance.GetDataPtr<T>());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+template void KnnSearchCUDA<float>(const Tensor& points,
+                                   const Tensor& queries,
+                                   int knn,
+                                   Tensor& neighbors_index,
+                                   Tensor& neighbors_distance);
+
+template void KnnSearchCUDA<double>(const Tensor& points,
+                                    const Tensor& queries,
+                                    int knn,
+                                    Tensor& neighbors_index,
+                                    Tensor& neighbors_distance);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Brute-force K nearest neighbor search of \p queries in \p points.
+///
+/// Each thread keeps the sorted K best candidates of one query point, while
+/// the block streams the dataset points through shared memory in tiles.
+///
+/// \param points    Contiguous CUDA Tensor of shape {num_points, d}.
+///
+/// \param queries    Contiguous CUDA Tensor of shape {num_queries, d}, with
+///        the same dtype and device as \p points.
+///
+/// \param knn    The number of neighbors to search. Must be in the range
+///        [1, num_points].
+///
+/// \param neighbors_index    Output Tensor of shape {num_queries, knn} with
+///        dtype Int64, sorted by increasing distance.
+///
+/// \param neighbors_distance    Output Tensor of shape {num_queries, knn} with
+///        the dtype of \p points, holding the squared L2 distances.
+///
+template <class T>
+void KnnSearchCUDA(const Tensor& points,
+                   const Tensor& queries,
+                   int knn,
+                   Tensor& neighbors_index,
+                   Tensor& neighbors_distance);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -44,6 +44,36 @@ Dtype NNSIndex::GetDtype() const { return dataset_points_.GetDtype(); }
 
 Device NNSIndex::GetDevice() const { return dataset_points_.GetDevice(); }
 
+void NNSIndex::SearchHybrid(const Tensor &query_points,
+                            double radius,
+                            int max_knn,
+                            Tensor &indices,
+                            Tensor &distances) const {
+    std::pair<Tensor, Tensor> result =
+            SearchHybrid(query_points, radius, max_knn);
+    PrepareHybridOutputs(query_points.GetShape()[0], max_knn, indices,
+                         distances);
+    indices.AsRvalue() = result.first;
+    distances.AsRvalue() = result.second;
+}
+
+void NNSIndex::PrepareHybridOutputs(int64_t num_query_points,
+                                    int max_knn,
+                                    Tensor &indices,
+                                    Tensor &distances) const {
+    SizeVector shape{num_query_points, max_knn};
+    Device device = GetDevice();
+    if (indices.GetShape() != shape || !indices.IsContiguous() ||
+        indices.GetDtype() != Dtype::Int64 || indices.GetDevice() != device) {
+        indices = Tensor::Empty(shape, Dtype::Int64, device);
+    }
+    if (distances.GetShape() != shape || !distances.IsContiguous() ||
+        distances.GetDtype() != GetDtype() ||
+        distances.GetDevice() != device) {
+        distances = Tensor::Empty(shape, GetDtype(), device);
+    }
+}
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
@@ -112,6 +112,25 @@ public:
                                                    double radius,
                                                    int max_knn) const = 0;
 
+    /// Perform hybrid search, writing the results into preallocated tensors.
+    ///
+    /// \p indices and \p distances are written in place if they are
+    /// contiguous, with shape {n, max_knn} and the dtype and device of the
+    /// results. Otherwise they are reallocated, so passing the same tensors
+    /// over repeated searches allocates the outputs only once.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query point.
+    /// \param indices Output Tensor of shape {n, max_knn}, with dtype Int64.
+    /// \param distances Output Tensor of shape {n, max_knn}, same dtype with
+    /// dataset_points.
+    virtual void SearchHybrid(const Tensor &query_points,
+                              double radius,
+                              int max_knn,
+                              Tensor &indices,
+                              Tensor &distances) const;
+
     /// Get dimension of the dataset points.
     /// \return dimension of dataset points.
     int GetDimension() const;
@@ -128,6 +147,14 @@ public:
     /// \return device of dataset points.
     Device GetDevice() const;
 
+protected:
+    /// Reallocate \p indices and \p distances unless they can hold the
+    /// {num_query_points, max_knn} results of a hybrid search.
+    void PrepareHybridOutputs(int64_t num_query_points,
+                              int max_knn,
+                              Tensor &indices,
+                              Tensor &distances) const;
+
 protected:
     Tensor dataset_points_;
 };
@@ -234,6 +234,16 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
 
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
         const Tensor &query_points, double radius, int max_knn) const {
+    Tensor indices, distances;
+    SearchHybrid(query_points, radius, max_knn, indices, distances);
+    return std::make_pair(indices, distances);
+}
+
+void NanoFlannIndex::SearchHybrid(const Tensor &query_points,
+                                  double radius,
+                                  int max_knn,
+                                  Tensor &indices,
+                                  Tensor &distances) const {
     query_points.AssertDtype(GetDtype());
     query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
 
@@ -249,15 +259,16 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
     }
 
     double radius_squared = radius * radius;
-    int64_t num_query_points = query_points.GetShape()[0];
-    Tensor indices, distances;
+    Tensor query_points_ = query_points.Contiguous();
+    int64_t num_query_points = query_points_.GetShape()[0];
+    int dimension = GetDimension();
     Dtype dtype = GetDtype();
+    PrepareHybridOutputs(num_query_points, max_knn, indices, distances);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        indices = Tensor::Empty({num_query_points, max_knn}, Dtype::Int64);
         auto indices_ptr = indices.GetDataPtr<int64_t>();
-        distances = Tensor::Empty({num_query_points, max_knn}, dtype);
         auto distances_ptr = distances.GetDataPtr<scalar_t>();
+        const scalar_t *query_ptr = query_points_.GetDataPtr<scalar_t>();
 
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
@@ -274,9 +285,7 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
                         int64_t result_idx = workload_idx * max_knn;
 
                         size_t num_results = holder->index_->radiusSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[workload_idx]
-                                                .GetDataPtr()),
+                                query_ptr + workload_idx * dimension,
                                 radius_squared, ret_matches, params);
                         ret_matches.resize(num_results);
 
@@ -297,7 +306,6 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
                     }
                 });
     });
-    return std::make_pair(indices, distances);
 }
 
 }  // namespace nns
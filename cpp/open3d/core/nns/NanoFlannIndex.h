@@ -161,6 +161,12 @@ public:
                                            double radius,
                                            int max_knn) const override;
 
+    void SearchHybrid(const Tensor &query_points,
+                      double radius,
+                      int max_knn,
+                      Tensor &indices,
+                      Tensor &distances) const override;
+
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
@@ -26,12 +26,24 @@
 
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
+#include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+
+/// Counts the query points of a search, see utility::Metrics.
+void RecordQueries(const char* counter_name, const Tensor& query_points) {
+    kernel::GetDeviceCounter(counter_name, query_points.GetDevice(),
+                             "Number of nearest neighbor search query points.")
+            .Add(query_points.GetLength());
+}
+
+}  // namespace
+
 NearestNeighborSearch::~NearestNeighborSearch(){};
 
 bool NearestNeighborSearch::SetIndex() {
@@ -41,13 +53,17 @@ bool NearestNeighborSearch::SetIndex() {
 
 bool NearestNeighborSearch::KnnIndex() {
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
-#ifdef WITH_FAISS
+#if defined(WITH_FAISS)
         faiss_index_.reset(new FaissIndex());
         return faiss_index_->SetTensorData(dataset_points_);
+#elif defined(BUILD_CUDA_MODULE)
+        knn_index_.reset(new nns::KnnIndex());
+        return knn_index_->SetTensorData(dataset_points_);
 #else
         utility::LogError(
-                "[NearestNeighborSearch::KnnIndex] Currently, Faiss is "
-                "disabled. Please recompile Open3D with WITH_FAISS=ON.");
+                "[NearestNeighborSearch::KnnIndex] KnnIndex with GPU tensor "
+                "is disabled since BUILD_CUDA_MODULE is OFF. Please recompile "
+                "Open3D with BUILD_CUDA_MODULE=ON.");
 #endif
     } else {
         return SetIndex();
@@ -100,13 +116,23 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
     }
 };
 
+bool NearestNeighborSearch::ShardedFixedRadiusIndex(
+        double radius, const std::vector<Device>& devices) {
+    sharded_index_.reset(new nns::ShardedFixedRadiusIndex(devices));
+    return sharded_index_->SetTensorData(dataset_points_, radius);
+}
+
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    RecordQueries("open3d_core_nns_knn_queries_total", query_points);
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchKnn(query_points, knn);
     }
 #endif
+    if (knn_index_) {
+        return knn_index_->SearchKnn(query_points, knn);
+    }
     if (nanoflann_index_) {
         return nanoflann_index_->SearchKnn(query_points, knn);
     } else {
@@ -117,6 +143,10 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius, bool sort) {
+    RecordQueries("open3d_core_nns_fixed_radius_queries_total", query_points);
+    if (sharded_index_) {
+        return sharded_index_->SearchRadius(query_points, radius, sort);
+    }
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius,
@@ -139,6 +169,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
+    RecordQueries("open3d_core_nns_multi_radius_queries_total", query_points);
     AssertNotCUDA(query_points);
     if (!nanoflann_index_) {
         utility::LogError(
@@ -160,6 +191,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points, double radius, int max_knn) {
+    RecordQueries("open3d_core_nns_hybrid_queries_total", query_points);
+    if (sharded_index_) {
+        return sharded_index_->SearchHybrid(query_points, radius, max_knn);
+    }
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchHybrid(query_points, radius,
@@ -179,6 +214,36 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::HybridSearch(
     }
 }
 
+void NearestNeighborSearch::HybridSearch(const Tensor& query_points,
+                                         double radius,
+                                         int max_knn,
+                                         Tensor& indices,
+                                         Tensor& distances) {
+    RecordQueries("open3d_core_nns_hybrid_queries_total", query_points);
+    if (sharded_index_) {
+        sharded_index_->SearchHybrid(query_points, radius, max_knn, indices,
+                                     distances);
+        return;
+    }
+    if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
+        if (fixed_radius_index_) {
+            fixed_radius_index_->SearchHybrid(query_points, radius, max_knn,
+                                              indices, distances);
+        } else {
+            utility::LogError(
+                    "[NearestNeighborSearch::HybridSearch] Index is not set.");
+        }
+    } else {
+        if (nanoflann_index_) {
+            nanoflann_index_->SearchHybrid(query_points, radius, max_knn,
+                                           indices, distances);
+        } else {
+            utility::LogError(
+                    "[NearestNeighborSearch::HybridSearch] Index is not set.");
+        }
+    }
+}
+
 void NearestNeighborSearch::AssertNotCUDA(const Tensor& t) const {
     if (t.GetDevice().GetType() == Device::DeviceType::CUDA) {
         utility::LogError(
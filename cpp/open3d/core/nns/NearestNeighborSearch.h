@@ -31,7 +31,9 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FaissIndex.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/KnnIndex.h"
 #include "open3d/core/nns/NanoFlannIndex.h"
+#include "open3d/core/nns/ShardedFixedRadiusIndex.h"
 #include "open3d/utility/Optional.h"
 
 namespace open3d {
@@ -76,6 +78,15 @@ public:
     /// \return Returns true if building index success, otherwise false.
     bool HybridIndex(utility::optional<double> radius = {});
 
+    /// Set index for fixed-radius and hybrid search, sharded spatially over
+    /// \p devices, e.g. several GPUs. Searches must use radii up to \p radius.
+    ///
+    /// \param radius Maximum search radius.
+    /// \param devices Devices holding the shards, one shard per device.
+    /// \return Returns true if building index success, otherwise false.
+    bool ShardedFixedRadiusIndex(double radius,
+                                 const std::vector<Device> &devices);
+
     /// Perform knn search.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}.
@@ -128,6 +139,26 @@ public:
                                            double radius,
                                            int max_knn);
 
+    /// Perform hybrid search, writing the results into preallocated tensors.
+    ///
+    /// \p indices and \p distances are written in place if they are
+    /// contiguous, with shape {n, max_knn} and the expected dtype and device,
+    /// and are reallocated otherwise. Reusing them over repeated searches,
+    /// e.g. over ICP iterations, allocates the outputs only once.
+    ///
+    /// \param query_points Data points for querying. Must be 2D, with shape {n,
+    /// d}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query.
+    /// \param indices Output Tensor of shape {n, max_knn}, with dtype Int64.
+    /// \param distances Output Tensor of shape {n, max_knn}, with same dtype
+    /// with query_points. The distances are squared L2 distances.
+    void HybridSearch(const Tensor &query_points,
+                      double radius,
+                      int max_knn,
+                      Tensor &indices,
+                      Tensor &distances);
+
 private:
     bool SetIndex();
 
@@ -138,6 +169,8 @@ protected:
     std::unique_ptr<NanoFlannIndex> nanoflann_index_;
     std::unique_ptr<FaissIndex> faiss_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
+    std::unique_ptr<nns::KnnIndex> knn_index_;
+    std::unique_ptr<nns::ShardedFixedRadiusIndex> sharded_index_;
     const Tensor dataset_points_;
 };
 }  // namespace nns
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/NeighborListOps.h"
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+static void AssertValueDtype(const Tensor& tensor, const char* name) {
+    const Dtype dtype = tensor.GetDtype();
+    if (dtype != Dtype::Int32 && dtype != Dtype::Int64 &&
+        dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "{} must be Int32, Int64, Float32 or Float64, but got {}.",
+                name, dtype.ToString());
+    }
+}
+
+static void AssertRowSplits(const Tensor& row_splits, const Device& device) {
+    row_splits.AssertDtype(Dtype::Int64);
+    row_splits.AssertDevice(device);
+    if (row_splits.NumDims() != 1 || row_splits.GetLength() < 1) {
+        utility::LogError(
+                "row_splits must have shape {{num_rows + 1}}, but got {}.",
+                row_splits.GetShape().ToString());
+    }
+}
+
+void InvertNeighborsList(int64_t num_points,
+                         const Tensor& inp_neighbors_index,
+                         const Tensor& inp_neighbors_row_splits,
+                         const Tensor& inp_neighbors_attributes,
+                         Tensor& neighbors_index,
+                         Tensor& neighbors_row_splits,
+                         Tensor& neighbors_attributes) {
+    const Device device = inp_neighbors_index.GetDevice();
+    const Dtype index_dtype = inp_neighbors_index.GetDtype();
+    if (index_dtype != Dtype::Int32 && index_dtype != Dtype::Int64) {
+        utility::LogError(
+                "inp_neighbors_index must be Int32 or Int64, but got {}.",
+                index_dtype.ToString());
+    }
+    if (inp_neighbors_index.NumDims() != 1) {
+        utility::LogError(
+                "inp_neighbors_index must have shape {{num_neighbors}}, but "
+                "got {}.",
+                inp_neighbors_index.GetShape().ToString());
+    }
+    AssertRowSplits(inp_neighbors_row_splits, device);
+    AssertValueDtype(inp_neighbors_attributes, "inp_neighbors_attributes");
+    inp_neighbors_attributes.AssertDevice(device);
+    if (inp_neighbors_attributes.NumDims() == 0 ||
+        (inp_neighbors_attributes.GetLength() != 0 &&
+         inp_neighbors_attributes.GetLength() !=
+                 inp_neighbors_index.GetLength())) {
+        utility::LogError(
+                "inp_neighbors_attributes must have shape {{0}} or "
+                "{{num_neighbors, ...}}, but got {}.",
+                inp_neighbors_attributes.GetShape().ToString());
+    }
+    if (num_points < 0) {
+        utility::LogError("num_points must not be negative, but got {}.",
+                          num_points);
+    }
+
+    neighbors_index =
+            Tensor::Empty(inp_neighbors_index.GetShape(), index_dtype, device);
+    neighbors_row_splits =
+            Tensor::Empty({num_points + 1}, Dtype::Int64, device);
+    neighbors_attributes =
+            Tensor::Empty(inp_neighbors_attributes.GetShape(),
+                          inp_neighbors_attributes.GetDtype(), device);
+
+    if (device.GetType() == Device::DeviceType::CPU) {
+        InvertNeighborsListCPU(num_points, inp_neighbors_index.Contiguous(),
+                               inp_neighbors_row_splits.Contiguous(),
+                               inp_neighbors_attributes.Contiguous(),
+                               neighbors_index, neighbors_row_splits,
+                               neighbors_attributes);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        InvertNeighborsListCUDA(num_points, inp_neighbors_index.Contiguous(),
+                                inp_neighbors_row_splits.Contiguous(),
+                                inp_neighbors_attributes.Contiguous(),
+                                neighbors_index, neighbors_row_splits,
+                                neighbors_attributes);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+Tensor ReduceSubarraysSum(const Tensor& values, const Tensor& row_splits) {
+    const Device device = values.GetDevice();
+    AssertValueDtype(values, "values");
+    if (values.NumDims() != 1) {
+        utility::LogError("values must have shape {{n}}, but got {}.",
+                          values.GetShape().ToString());
+    }
+    AssertRowSplits(row_splits, device);
+
+    Tensor sums = Tensor::Empty({row_splits.GetLength() - 1},
+                                values.GetDtype(), device);
+    if (device.GetType() == Device::DeviceType::CPU) {
+        ReduceSubarraysSumCPU(values.Contiguous(), row_splits.Contiguous(),
+                              sums);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ReduceSubarraysSumCUDA(values.Contiguous(), row_splits.Contiguous(),
+                               sums);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return sums;
+}
+
+Tensor RaggedToDense(const Tensor& values,
+                     const Tensor& row_splits,
+                     int64_t out_col_size,
+                     const Tensor& default_value) {
+    const Device device = values.GetDevice();
+    AssertValueDtype(values, "values");
+    if (values.NumDims() == 0) {
+        utility::LogError("values must have shape {{n, ...}}, but got {}.",
+                          values.GetShape().ToString());
+    }
+    AssertRowSplits(row_splits, device);
+    const SizeVector item_shape(values.GetShape().begin() + 1,
+                                values.GetShape().end());
+    default_value.AssertShape(item_shape);
+    default_value.AssertDtype(values.GetDtype());
+    default_value.AssertDevice(device);
+    if (out_col_size < 0) {
+        utility::LogError("out_col_size must not be negative, but got {}.",
+                          out_col_size);
+    }
+
+    SizeVector out_shape({row_splits.GetLength() - 1, out_col_size});
+    out_shape.insert(out_shape.end(), item_shape.begin(), item_shape.end());
+    Tensor out = Tensor::Empty(out_shape, values.GetDtype(), device);
+    if (device.GetType() == Device::DeviceType::CPU) {
+        RaggedToDenseCPU(values.Contiguous(), row_splits.Contiguous(),
+                         default_value.Contiguous(), out);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RaggedToDenseCUDA(values.Contiguous(), row_splits.Contiguous(),
+                          default_value.Contiguous(), out);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return out;
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
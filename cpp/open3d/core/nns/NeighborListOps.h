@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file NeighborListOps.h
+/// \brief Operations on ragged neighbor lists, as returned by the radius
+/// searches.
+///
+/// The operations run the kernels of open3d/ml/impl directly on Tensors of
+/// the device of the inputs, the same kernels as the ML ops. CUDA kernels are
+/// queued on the current stream (see CUDAScopedStream and
+/// CUDAStream::FromNative) and temporary memory comes from the MemoryManager.
+/// Tensors of ML frameworks can be passed without copies through
+/// Tensor::FromDLPack.
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \brief Inverts a neighbors list, i.e. the query points of the input become
+/// the neighbors of the output and vice versa.
+///
+/// \param num_points Number of points of the dataset the input indices refer
+/// to. This is the number of queries of the output.
+/// \param inp_neighbors_index Int32 or Int64 Tensor of shape {num_neighbors}.
+/// \param inp_neighbors_row_splits Int64 Tensor of shape {num_queries + 1}
+/// with the start and end of the neighbors of each query.
+/// \param inp_neighbors_attributes Tensor of shape {num_neighbors, ...} or
+/// {0}, Int32, Int64, Float32 or Float64.
+/// \param neighbors_index Output Tensor of shape {num_neighbors} with the
+/// query indices of each point.
+/// \param neighbors_row_splits Output Int64 Tensor of shape {num_points + 1}.
+/// \param neighbors_attributes Output Tensor with the attributes reordered
+/// like \p neighbors_index.
+void InvertNeighborsList(int64_t num_points,
+                         const Tensor& inp_neighbors_index,
+                         const Tensor& inp_neighbors_row_splits,
+                         const Tensor& inp_neighbors_attributes,
+                         Tensor& neighbors_index,
+                         Tensor& neighbors_row_splits,
+                         Tensor& neighbors_attributes);
+
+/// \brief Computes the sum of each subarray of \p values.
+///
+/// \param values Tensor of shape {n}, Int32, Int64, Float32 or Float64.
+/// \param row_splits Int64 Tensor of shape {num_arrays + 1} with the start
+/// and end of each subarray.
+/// \return Tensor of shape {num_arrays} with the dtype of \p values.
+Tensor ReduceSubarraysSum(const Tensor& values, const Tensor& row_splits);
+
+/// \brief Converts a ragged tensor to a dense tensor, e.g. a neighbors list
+/// to a matrix with one row per query.
+///
+/// \param values Tensor of shape {n, ...}, Int32, Int64, Float32 or Float64.
+/// \param row_splits Int64 Tensor of shape {num_rows + 1} with the start and
+/// end of each row.
+/// \param out_col_size Number of columns of the output. Longer rows are
+/// truncated.
+/// \param default_value Tensor of shape values.shape[1:] used to pad the
+/// rows, with the dtype of \p values.
+/// \return Tensor of shape {num_rows, out_col_size, ...}.
+Tensor RaggedToDense(const Tensor& values,
+                     const Tensor& row_splits,
+                     int64_t out_col_size,
+                     const Tensor& default_value);
+
+void InvertNeighborsListCPU(int64_t num_points,
+                            const Tensor& inp_neighbors_index,
+                            const Tensor& inp_neighbors_row_splits,
+                            const Tensor& inp_neighbors_attributes,
+                            Tensor& neighbors_index,
+                            Tensor& neighbors_row_splits,
+                            Tensor& neighbors_attributes);
+
+void ReduceSubarraysSumCPU(const Tensor& values,
+                           const Tensor& row_splits,
+                           Tensor& sums);
+
+void RaggedToDenseCPU(const Tensor& values,
+                      const Tensor& row_splits,
+                      const Tensor& default_value,
+                      Tensor& out);
+
+#ifdef BUILD_CUDA_MODULE
+void InvertNeighborsListCUDA(int64_t num_points,
+                             const Tensor& inp_neighbors_index,
+                             const Tensor& inp_neighbors_row_splits,
+                             const Tensor& inp_neighbors_attributes,
+                             Tensor& neighbors_index,
+                             Tensor& neighbors_row_splits,
+                             Tensor& neighbors_attributes);
+
+void ReduceSubarraysSumCUDA(const Tensor& values,
+                            const Tensor& row_splits,
+                            Tensor& sums);
+
+void RaggedToDenseCUDA(const Tensor& values,
+                       const Tensor& row_splits,
+                       const Tensor& default_value,
+                       Tensor& out);
+#endif
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3D.h.
+
+#pragma once
+
+#include <algorithm>
+
+#include "open3d/core/nns/NeighborListOps.h"
+#include "open3d/utility/Console.h"
+
+#if defined(__CUDACC__)
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAStream.h"
+#include "open3d/ml/impl/misc/InvertNeighborsList.cuh"
+#include "open3d/ml/impl/misc/RaggedToDense.cuh"
+#include "open3d/ml/impl/misc/ReduceSubarraysSum.cuh"
+#else
+#include "open3d/ml/impl/misc/InvertNeighborsList.h"
+#include "open3d/ml/impl/misc/RaggedToDense.h"
+#include "open3d/ml/impl/misc/ReduceSubarraysSum.h"
+#endif
+
+/// Dispatches the dtypes supported by the ml/impl kernels.
+#define DISPATCH_NEIGHBOR_VALUE_DTYPE(DTYPE, ...)                  \
+    [&] {                                                          \
+        if (DTYPE == open3d::core::Dtype::Int32) {                 \
+            using scalar_t = int32_t;                              \
+            return __VA_ARGS__();                                  \
+        } else if (DTYPE == open3d::core::Dtype::Int64) {          \
+            using scalar_t = int64_t;                              \
+            return __VA_ARGS__();                                  \
+        } else if (DTYPE == open3d::core::Dtype::Float32) {        \
+            using scalar_t = float;                                \
+            return __VA_ARGS__();                                  \
+        } else if (DTYPE == open3d::core::Dtype::Float64) {        \
+            using scalar_t = double;                               \
+            return __VA_ARGS__();                                  \
+        } else {                                                   \
+            open3d::utility::LogError("Unsupported data type {}.", \
+                                      DTYPE.ToString());           \
+        }                                                          \
+    }()
+
+#define DISPATCH_NEIGHBOR_INDEX_DTYPE(DTYPE, ...)                   \
+    [&] {                                                           \
+        if (DTYPE == open3d::core::Dtype::Int32) {                  \
+            using index_t = int32_t;                                \
+            return __VA_ARGS__();                                   \
+        } else if (DTYPE == open3d::core::Dtype::Int64) {           \
+            using index_t = int64_t;                                \
+            return __VA_ARGS__();                                   \
+        } else {                                                    \
+            open3d::utility::LogError("Unsupported index type {}.", \
+                                      DTYPE.ToString());            \
+        }                                                           \
+    }()
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+#if defined(__CUDACC__)
+void InvertNeighborsListCUDA
+#else
+void InvertNeighborsListCPU
+#endif
+        (int64_t num_points,
+         const Tensor& inp_neighbors_index,
+         const Tensor& inp_neighbors_row_splits,
+         const Tensor& inp_neighbors_attributes,
+         Tensor& neighbors_index,
+         Tensor& neighbors_row_splits,
+         Tensor& neighbors_attributes) {
+    const int64_t index_size = inp_neighbors_index.GetLength();
+    const int64_t inp_num_queries = inp_neighbors_row_splits.GetLength() - 1;
+    const int num_attributes =
+            inp_neighbors_attributes.GetLength() == 0
+                    ? 0
+                    : int(inp_neighbors_attributes.NumElements() /
+                          inp_neighbors_attributes.GetLength());
+
+    DISPATCH_NEIGHBOR_INDEX_DTYPE(inp_neighbors_index.GetDtype(), [&]() {
+        DISPATCH_NEIGHBOR_VALUE_DTYPE(
+                inp_neighbors_attributes.GetDtype(), [&]() {
+                    const scalar_t* inp_attributes =
+                            num_attributes ? inp_neighbors_attributes
+                                                     .GetDataPtr<scalar_t>()
+                                           : nullptr;
+                    scalar_t* out_attributes =
+                            num_attributes
+                                    ? neighbors_attributes
+                                              .GetDataPtr<scalar_t>()
+                                    : nullptr;
+#if defined(__CUDACC__)
+                    CUDADeviceSwitcher switcher(
+                            inp_neighbors_index.GetDevice());
+                    const CUDAStream stream = CUDAStream::GetCurrent();
+                    const int texture_alignment = 512;
+                    auto invert = [&](void* temp_ptr, size_t& temp_size) {
+                        ml::impl::InvertNeighborsListCUDA(
+                                stream.Get(), temp_ptr, temp_size,
+                                texture_alignment,
+                                inp_neighbors_index.GetDataPtr<index_t>(),
+                                inp_attributes, num_attributes,
+                                inp_neighbors_row_splits
+                                        .GetDataPtr<int64_t>(),
+                                inp_num_queries,
+                                neighbors_index.GetDataPtr<index_t>(),
+                                out_attributes, index_size,
+                                neighbors_row_splits.GetDataPtr<int64_t>(),
+                                num_points);
+                    };
+
+                    // The first call only computes the size of the
+                    // temporary memory.
+                    size_t temp_size = 0;
+                    invert(nullptr, temp_size);
+                    Tensor temp = Tensor::Empty(
+                            {std::max<int64_t>(temp_size, 1)}, Dtype::UInt8,
+                            inp_neighbors_index.GetDevice());
+                    invert(temp.GetDataPtr(), temp_size);
+
+                    // The MemoryManager is not stream-aware, so the temporary
+                    // memory must not be released while a non-default stream
+                    // may still access it.
+                    if (!stream.IsDefault()) {
+                        stream.Synchronize();
+                    }
+#else
+                    ml::impl::InvertNeighborsListCPU(
+                            inp_neighbors_index.GetDataPtr<index_t>(),
+                            inp_attributes, num_attributes,
+                            inp_neighbors_row_splits.GetDataPtr<int64_t>(),
+                            inp_num_queries,
+                            neighbors_index.GetDataPtr<index_t>(),
+                            out_attributes, index_size,
+                            neighbors_row_splits.GetDataPtr<int64_t>(),
+                            num_points);
+#endif
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ReduceSubarraysSumCUDA
+#else
+void ReduceSubarraysSumCPU
+#endif
+        (const Tensor& values, const Tensor& row_splits, Tensor& sums) {
+    DISPATCH_NEIGHBOR_VALUE_DTYPE(values.GetDtype(), [&]() {
+#if defined(__CUDACC__)
+        CUDADeviceSwitcher switcher(values.GetDevice());
+        ml::impl::ReduceSubarraysSumCUDA(
+                CUDAStream::GetCurrent().Get(), values.GetDataPtr<scalar_t>(),
+                values.GetLength(), row_splits.GetDataPtr<int64_t>(),
+                sums.GetLength(), sums.GetDataPtr<scalar_t>());
+#else
+        ml::impl::ReduceSubarraysSumCPU(
+                values.GetDataPtr<scalar_t>(), values.GetLength(),
+                row_splits.GetDataPtr<int64_t>(), sums.GetLength(),
+                sums.GetDataPtr<scalar_t>());
+#endif
+    });
+}
+
+#if defined(__CUDACC__)
+void RaggedToDenseCUDA
+#else
+void RaggedToDenseCPU
+#endif
+        (const Tensor& values,
+         const Tensor& row_splits,
+         const Tensor& default_value,
+         Tensor& out) {
+    DISPATCH_NEIGHBOR_VALUE_DTYPE(values.GetDtype(), [&]() {
+#if defined(__CUDACC__)
+        CUDADeviceSwitcher switcher(values.GetDevice());
+        ml::impl::RaggedToDenseCUDA(
+                CUDAStream::GetCurrent().Get(), values.GetDataPtr<scalar_t>(),
+                row_splits.GetDataPtr<int64_t>(), row_splits.GetLength(),
+                out.GetShape(1), default_value.GetDataPtr<scalar_t>(),
+                default_value.NumElements(), out.GetDataPtr<scalar_t>());
+#else
+        ml::impl::RaggedToDenseCPU(
+                values.GetDataPtr<scalar_t>(), row_splits.GetDataPtr<int64_t>(),
+                row_splits.GetLength(), out.GetShape(1),
+                default_value.GetDataPtr<scalar_t>(),
+                default_value.NumElements(), out.GetDataPtr<scalar_t>());
+#endif
+    });
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,324 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/ShardedFixedRadiusIndex.h"
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Coordinates of \p points along \p axis, as doubles on the host.
+static std::vector<double> GetHostCoordinates(const Tensor &points,
+                                              int64_t axis) {
+    return points.Slice(1, axis, axis + 1)
+            .Reshape({points.GetShape(0)})
+            .To(Device("CPU:0"), Dtype::Float64)
+            .ToFlatVector<double>();
+}
+
+ShardedFixedRadiusIndex::ShardedFixedRadiusIndex(
+        const std::vector<Device> &devices)
+    : devices_(devices) {}
+
+ShardedFixedRadiusIndex::ShardedFixedRadiusIndex(
+        const Tensor &dataset_points,
+        double radius,
+        const std::vector<Device> &devices)
+    : devices_(devices) {
+    SetTensorData(dataset_points, radius);
+}
+
+ShardedFixedRadiusIndex::~ShardedFixedRadiusIndex() {}
+
+bool ShardedFixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
+                                            double radius) {
+    if (devices_.empty()) {
+        utility::LogError(
+                "[ShardedFixedRadiusIndex::SetTensorData] at least one device "
+                "is required.");
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[ShardedFixedRadiusIndex::SetTensorData] radius should be "
+                "positive.");
+    }
+    if (dataset_points.NumDims() != 2 || dataset_points.GetShape(0) == 0) {
+        utility::LogError(
+                "[ShardedFixedRadiusIndex::SetTensorData] dataset_points must "
+                "be a non-empty 2D matrix, with shape {n, d}.");
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
+    int64_t num_dataset_points = GetDatasetSize();
+    int64_t num_shards = GetNumShards();
+
+    // Split along the axis with the largest extent.
+    std::vector<double> min_bound =
+            dataset_points_.Min({0}).To(Device("CPU:0"), Dtype::Float64)
+                    .ToFlatVector<double>();
+    std::vector<double> max_bound =
+            dataset_points_.Max({0}).To(Device("CPU:0"), Dtype::Float64)
+                    .ToFlatVector<double>();
+    split_axis_ = 0;
+    for (int64_t i = 1; i < GetDimension(); ++i) {
+        if (max_bound[i] - min_bound[i] >
+            max_bound[split_axis_] - min_bound[split_axis_]) {
+            split_axis_ = i;
+        }
+    }
+    std::vector<double> coords =
+            GetHostCoordinates(dataset_points_, split_axis_);
+
+    // Split at the quantiles of the coordinates, so that the slabs hold the
+    // same number of points.
+    std::vector<double> sorted_coords = coords;
+    split_values_.clear();
+    auto begin = sorted_coords.begin();
+    for (int64_t k = 1; k < num_shards; ++k) {
+        auto nth = sorted_coords.begin() + k * num_dataset_points / num_shards;
+        std::nth_element(begin, nth, sorted_coords.end());
+        split_values_.push_back(*nth);
+        begin = nth;
+    }
+
+    // Each shard holds its slab and the points within the radius around it,
+    // so a query in the slab finds all its neighbors in that shard alone.
+    shard_indices_.clear();
+    shard_point_indices_.clear();
+    for (int64_t k = 0; k < num_shards; ++k) {
+        double lower = k == 0 ? -std::numeric_limits<double>::infinity()
+                              : split_values_[k - 1] - radius;
+        double upper = k == num_shards - 1
+                               ? std::numeric_limits<double>::infinity()
+                               : split_values_[k] + radius;
+        std::vector<int64_t> point_indices;
+        for (int64_t i = 0; i < num_dataset_points; ++i) {
+            if (coords[i] >= lower && coords[i] <= upper) {
+                point_indices.push_back(i);
+            }
+        }
+        int64_t num_shard_points = point_indices.size();
+        if (num_shard_points == 0) {
+            shard_indices_.push_back(nullptr);
+            shard_point_indices_.push_back(Tensor());
+            continue;
+        }
+
+        Tensor shard_points =
+                dataset_points_
+                        .IndexGet({Tensor(point_indices, {num_shard_points},
+                                          Dtype::Int64, GetDevice())})
+                        .To(devices_[k]);
+        if (devices_[k].GetType() == Device::DeviceType::CUDA) {
+            shard_indices_.emplace_back(
+                    new FixedRadiusIndex(shard_points, radius));
+        } else {
+            shard_indices_.emplace_back(new NanoFlannIndex(shard_points));
+        }
+        point_indices.push_back(-1);
+        shard_point_indices_.push_back(Tensor(point_indices,
+                                              {num_shard_points + 1},
+                                              Dtype::Int64, devices_[k]));
+    }
+    return true;
+}
+
+void ShardedFixedRadiusIndex::AssertQuery(const std::string &func_name,
+                                          const Tensor &query_points,
+                                          double radius) const {
+    query_points.AssertDtype(GetDtype());
+    query_points.AssertDevice(GetDevice());
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+    if (radius <= 0 || radius > radius_) {
+        utility::LogError(
+                "[ShardedFixedRadiusIndex::{}] radius should be positive and "
+                "at most the index radius {}, but got {}.",
+                func_name, radius_, radius);
+    }
+}
+
+std::vector<Tensor> ShardedFixedRadiusIndex::RouteQueries(
+        const Tensor &query_points) const {
+    std::vector<double> coords = GetHostCoordinates(query_points, split_axis_);
+    std::vector<std::vector<int64_t>> shard_queries(GetNumShards());
+    for (int64_t i = 0; i < static_cast<int64_t>(coords.size()); ++i) {
+        int64_t k = std::upper_bound(split_values_.begin(),
+                                     split_values_.end(), coords[i]) -
+                    split_values_.begin();
+        shard_queries[k].push_back(i);
+    }
+
+    std::vector<Tensor> query_indices;
+    for (const std::vector<int64_t> &queries : shard_queries) {
+        query_indices.push_back(Tensor(queries, {int64_t(queries.size())},
+                                       Dtype::Int64, GetDevice()));
+    }
+    return query_indices;
+}
+
+std::tuple<Tensor, Tensor, Tensor> ShardedFixedRadiusIndex::SearchRadius(
+        const Tensor &query_points, double radius, bool sort) const {
+    AssertQuery(__FUNCTION__, query_points, radius);
+    Tensor query = query_points.Contiguous();
+    int64_t num_query_points = query.GetShape(0);
+    int64_t num_shards = GetNumShards();
+    Device host("CPU:0");
+
+    // Search each shard with its routed queries, the shards being on
+    // different devices. Results are gathered on the host for the merge.
+    std::vector<Tensor> query_indices = RouteQueries(query);
+    std::vector<Tensor> shard_indices(num_shards);
+    std::vector<Tensor> shard_distances(num_shards);
+    std::vector<Tensor> shard_row_splits(num_shards);
+    for (int64_t k = 0; k < num_shards; ++k) {
+        query_indices[k] = query_indices[k].To(host);
+        if (query_indices[k].GetLength() == 0 || !shard_indices_[k]) {
+            continue;
+        }
+        Tensor shard_query = query.IndexGet({query_indices[k].To(GetDevice())})
+                                     .To(devices_[k]);
+        Tensor indices, distances, row_splits;
+        std::tie(indices, distances, row_splits) =
+                shard_indices_[k]->SearchRadius(shard_query, radius, sort);
+        shard_indices[k] =
+                shard_point_indices_[k].IndexGet({indices}).To(host);
+        shard_distances[k] = distances.To(host).Contiguous();
+        shard_row_splits[k] = row_splits.To(host).Contiguous();
+    }
+
+    // Global row splits from the per-query neighbor counts.
+    std::vector<int64_t> row_splits(num_query_points + 1, 0);
+    for (int64_t k = 0; k < num_shards; ++k) {
+        if (!shard_row_splits[k].NumElements()) continue;
+        const int64_t *query_ptr = query_indices[k].GetDataPtr<int64_t>();
+        const int64_t *splits_ptr = shard_row_splits[k].GetDataPtr<int64_t>();
+        for (int64_t i = 0; i < query_indices[k].GetLength(); ++i) {
+            row_splits[query_ptr[i] + 1] = splits_ptr[i + 1] - splits_ptr[i];
+        }
+    }
+    std::partial_sum(row_splits.begin(), row_splits.end(), row_splits.begin());
+
+    // Scatter each query's neighbors to its place in the query order.
+    int64_t num_neighbors = row_splits.back();
+    int64_t element_size = GetDtype().ByteSize();
+    Tensor indices = Tensor::Empty({num_neighbors}, Dtype::Int64, host);
+    Tensor distances = Tensor::Empty({num_neighbors}, GetDtype(), host);
+    int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+    char *distances_ptr = static_cast<char *>(distances.GetDataPtr());
+    for (int64_t k = 0; k < num_shards; ++k) {
+        if (!shard_row_splits[k].NumElements()) continue;
+        const int64_t *query_ptr = query_indices[k].GetDataPtr<int64_t>();
+        const int64_t *splits_ptr = shard_row_splits[k].GetDataPtr<int64_t>();
+        const int64_t *shard_indices_ptr =
+                shard_indices[k].GetDataPtr<int64_t>();
+        const char *shard_distances_ptr =
+                static_cast<const char *>(shard_distances[k].GetDataPtr());
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, query_indices[k].GetLength()),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        int64_t src = splits_ptr[i];
+                        int64_t dst = row_splits[query_ptr[i]];
+                        int64_t count = splits_ptr[i + 1] - src;
+                        std::copy(shard_indices_ptr + src,
+                                  shard_indices_ptr + src + count,
+                                  indices_ptr + dst);
+                        std::memcpy(distances_ptr + dst * element_size,
+                                    shard_distances_ptr + src * element_size,
+                                    count * element_size);
+                    }
+                });
+    }
+
+    return std::make_tuple(
+            indices.To(GetDevice()), distances.To(GetDevice()),
+            Tensor(row_splits, {num_query_points + 1}, Dtype::Int64,
+                   GetDevice()));
+}
+
+std::pair<Tensor, Tensor> ShardedFixedRadiusIndex::SearchHybrid(
+        const Tensor &query_points, double radius, int max_knn) const {
+    Tensor indices, distances;
+    SearchHybrid(query_points, radius, max_knn, indices, distances);
+    return std::make_pair(indices, distances);
+}
+
+void ShardedFixedRadiusIndex::SearchHybrid(const Tensor &query_points,
+                                           double radius,
+                                           int max_knn,
+                                           Tensor &indices,
+                                           Tensor &distances) const {
+    AssertQuery(__FUNCTION__, query_points, radius);
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[ShardedFixedRadiusIndex::SearchHybrid] max_knn should be "
+                "larger than 0.");
+    }
+    Tensor query = query_points.Contiguous();
+    int64_t num_query_points = query.GetShape(0);
+    PrepareHybridOutputs(num_query_points, max_knn, indices, distances);
+    indices.Fill(-1);
+    distances.Fill(0);
+
+    std::vector<Tensor> query_indices = RouteQueries(query);
+    for (int64_t k = 0; k < GetNumShards(); ++k) {
+        int64_t num_shard_queries = query_indices[k].GetLength();
+        if (num_shard_queries == 0 || !shard_indices_[k]) {
+            continue;
+        }
+        Tensor shard_query = query.IndexGet({query_indices[k]}).To(devices_[k]);
+        Tensor shard_indices, shard_distances;
+        std::tie(shard_indices, shard_distances) =
+                shard_indices_[k]->SearchHybrid(shard_query, radius, max_knn);
+
+        // Padding entries (-1) pick the trailing -1 of the index map.
+        int64_t num_shard_points = shard_point_indices_[k].GetLength() - 1;
+        shard_indices = shard_indices.Reshape({-1});
+        shard_indices = shard_indices.Add(
+                shard_indices.Lt(0).To(Dtype::Int64).Mul(num_shard_points + 1));
+        Tensor global_indices = shard_point_indices_[k]
+                                        .IndexGet({shard_indices})
+                                        .Reshape({num_shard_queries, max_knn})
+                                        .To(GetDevice());
+        indices.IndexSet({query_indices[k]}, global_indices);
+        distances.IndexSet({query_indices[k]}, shard_distances.To(GetDevice()));
+    }
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class ShardedFixedRadiusIndex
+///
+/// \brief Fixed-radius index that shards the dataset spatially across several
+/// devices, e.g. one shard per GPU.
+///
+/// The dataset is cut into slabs with equal point counts along its longest
+/// axis, one slab per device. Each shard indexes its slab together with the
+/// points within the index radius around it, with a FixedRadiusIndex on CUDA
+/// devices and a NanoFlannIndex on CPU devices. Every query is routed to the
+/// shard of the slab it falls into, which holds all of its neighbors, and the
+/// per-shard results are merged back in query order with indices into the
+/// full dataset.
+class ShardedFixedRadiusIndex : public NNSIndex {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param devices Devices to distribute the shards on, one shard per
+    /// device. A device may be listed more than once.
+    ShardedFixedRadiusIndex(const std::vector<Device>& devices);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Dataset points of shape {n, d}.
+    /// \param radius Maximum radius that will be searched.
+    /// \param devices Devices to distribute the shards on, one shard per
+    /// device. A device may be listed more than once.
+    ShardedFixedRadiusIndex(const Tensor& dataset_points,
+                            double radius,
+                            const std::vector<Device>& devices);
+    ~ShardedFixedRadiusIndex();
+    ShardedFixedRadiusIndex(const ShardedFixedRadiusIndex&) = delete;
+    ShardedFixedRadiusIndex& operator=(const ShardedFixedRadiusIndex&) =
+            delete;
+
+public:
+    bool SetTensorData(const Tensor& dataset_points) override {
+        utility::LogError(
+                "ShardedFixedRadiusIndex::SetTensorData without radius not "
+                "implemented.");
+    }
+
+    bool SetTensorData(const Tensor& dataset_points, double radius) override;
+
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor& query_points,
+                                        int knn) const override {
+        utility::LogError(
+                "ShardedFixedRadiusIndex::SearchKnn not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor& query_points,
+            const Tensor& radii,
+            bool sort = true) const override {
+        utility::LogError(
+                "ShardedFixedRadiusIndex::SearchRadius with multi-radii not "
+                "implemented.");
+    }
+
+    /// \p radius must not exceed the radius the index was built with, since
+    /// each shard only holds the points within that radius of its slab.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor& query_points,
+            double radius,
+            bool sort = true) const override;
+
+    /// \p radius must not exceed the radius the index was built with.
+    std::pair<Tensor, Tensor> SearchHybrid(const Tensor& query_points,
+                                           double radius,
+                                           int max_knn) const override;
+
+    void SearchHybrid(const Tensor& query_points,
+                      double radius,
+                      int max_knn,
+                      Tensor& indices,
+                      Tensor& distances) const override;
+
+    /// Number of shards, equal to the number of devices.
+    int64_t GetNumShards() const { return devices_.size(); }
+
+protected:
+    /// Returns the query indices (on the query device) routed to each shard.
+    std::vector<Tensor> RouteQueries(const Tensor& query_points) const;
+
+    /// Checks the query points and the search radius against the index.
+    void AssertQuery(const std::string& func_name,
+                     const Tensor& query_points,
+                     double radius) const;
+
+protected:
+    std::vector<Device> devices_;
+    double radius_ = 0;
+    int64_t split_axis_ = 0;
+    /// Slab k spans [split_values_[k - 1], split_values_[k]) along the split
+    /// axis. The first and the last slab are unbounded.
+    std::vector<double> split_values_;
+    /// Per-shard index, nullptr if the shard holds no points.
+    std::vector<std::unique_ptr<NNSIndex>> shard_indices_;
+    /// Per-shard indices into the full dataset of the shard's points, on the
+    /// shard's device, followed by a trailing -1 that padded hybrid search
+    /// results map to.
+    std::vector<Tensor> shard_point_indices_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class ConcurrentDisjointSets
+///
+/// \brief Lock-free union-find, safe to use from parallel loops. Roots are
+/// always linked below smaller roots, so the root of a set is its smallest
+/// element regardless of the order of unions.
+class ConcurrentDisjointSets {
+public:
+    explicit ConcurrentDisjointSets(size_t size) : parents_(size) {
+        for (size_t i = 0; i < size; ++i) {
+            parents_[i].store(int(i), std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int x) {
+        int parent = parents_[x].load(std::memory_order_relaxed);
+        while (parent != x) {
+            // Path halving. Racing writes only ever store an ancestor.
+            int grandparent = parents_[parent].load(std::memory_order_relaxed);
+            parents_[x].store(grandparent, std::memory_order_relaxed);
+            x = grandparent;
+            parent = parents_[x].load(std::memory_order_relaxed);
+        }
+        return x;
+    }
+
+    void Union(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            // Fails if a stopped being a root in the meantime.
+            int expected = a;
+            if (parents_[a].compare_exchange_weak(expected, b)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/geometry/DerivedDataCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+inline uint64_t Mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+uint64_t HashChunk(const unsigned char *data, size_t size, uint64_t h) {
+    size_t num_words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < num_words; ++i) {
+        uint64_t word;
+        std::memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+        h = (h ^ Mix(word)) * 0x9e3779b97f4a7c15ULL;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, data + num_words * sizeof(uint64_t),
+                size - num_words * sizeof(uint64_t));
+    return Mix(h ^ Mix(tail));
+}
+
+}  // unnamed namespace
+
+uint64_t DerivedDataCache::Fingerprint(const void *data,
+                                       size_t size,
+                                       uint64_t seed) {
+    const size_t chunk_size = size_t(1) << 18;
+    const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    std::vector<uint64_t> chunk_hashes(num_chunks);
+    utility::ParallelFor(0, int64_t(num_chunks), [&](int64_t chunk) {
+        size_t begin = size_t(chunk) * chunk_size;
+        size_t end = std::min(begin + chunk_size, size);
+        chunk_hashes[chunk] =
+                HashChunk(bytes + begin, end - begin, Mix(uint64_t(chunk)));
+    });
+    uint64_t h = Mix(seed ^ Mix(uint64_t(size)));
+    for (uint64_t chunk_hash : chunk_hashes) {
+        h = Mix(h ^ chunk_hash) + 0x9e3779b97f4a7c15ULL;
+    }
+    return h;
+}
+
+}  // namespace geometry
+}  // namespace open3d
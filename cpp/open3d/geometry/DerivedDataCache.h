@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class DerivedDataCache
+///
+/// \brief Cache of data derived from a geometry, e.g. bounding boxes, KDTrees
+/// or edge maps, computed on first use.
+///
+/// The data members of legacy geometries are public and may be edited
+/// anywhere, e.g. in place through numpy, so entries are not invalidated by
+/// the mutating methods. Instead, each entry is tagged with a fingerprint of
+/// the data it was derived from, see Fingerprint(), and is recomputed when the
+/// fingerprint changes. Copies of a cache are empty.
+class DerivedDataCache {
+public:
+    DerivedDataCache() {}
+    DerivedDataCache(const DerivedDataCache &) {}
+    DerivedDataCache &operator=(const DerivedDataCache &) {
+        Clear();
+        return *this;
+    }
+
+    /// Returns the data cached under \p key if it was derived from data with
+    /// the given \p fingerprint, nullptr otherwise.
+    template <typename T>
+    std::shared_ptr<const T> Find(const std::string &key,
+                                  uint64_t fingerprint) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.fingerprint != fingerprint) {
+            return nullptr;
+        }
+        return std::static_pointer_cast<const T>(it->second.data);
+    }
+
+    /// Caches \p data under \p key, replacing any previous entry.
+    template <typename T>
+    void Set(const std::string &key,
+             uint64_t fingerprint,
+             std::shared_ptr<const T> data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[key] = Entry{fingerprint, std::move(data)};
+    }
+
+    /// Returns the data cached under \p key if it was derived from data with
+    /// the given \p fingerprint, otherwise caches and returns the result of
+    /// \p compute, a function returning a std::shared_ptr<T>.
+    template <typename T, typename func_t>
+    std::shared_ptr<const T> Get(const std::string &key,
+                                 uint64_t fingerprint,
+                                 const func_t &compute) {
+        std::shared_ptr<const T> data = Find<T>(key, fingerprint);
+        if (!data) {
+            data = compute();
+            Set<T>(key, fingerprint, data);
+        }
+        return data;
+    }
+
+    /// Removes all entries.
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+
+    /// Hashes \p size bytes at \p data, combined with \p seed. The bytes are
+    /// hashed in parallel chunks, at memory bandwidth.
+    static uint64_t Fingerprint(const void *data, size_t size, uint64_t seed);
+
+    /// Hashes the contents of \p data, combined with \p seed.
+    template <typename T>
+    static uint64_t Fingerprint(const std::vector<T> &data, uint64_t seed = 0) {
+        return Fingerprint(data.data(), data.size() * sizeof(T), seed);
+    }
+
+private:
+    struct Entry {
+        uint64_t fingerprint;
+        std::shared_ptr<const void> data;
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -24,15 +24,23 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Eigenvalues>
-#include <queue>
+#include <atomic>
+#include <mutex>
+#include <numeric>
 #include <tuple>
 
+#include "open3d/geometry/ConcurrentDisjointSets.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/PointCloudFloat.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 
@@ -221,14 +229,14 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
     }
 }
 
-Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
+template <typename PointType>
+Eigen::Vector3d ComputeNormal(const std::vector<PointType> &points,
                               const std::vector<int> &indices,
                               bool fast_normal_computation) {
     if (indices.size() == 0) {
         return Eigen::Vector3d::Zero();
     }
-    Eigen::Matrix3d covariance =
-            utility::ComputeCovariance(cloud.points_, indices);
+    Eigen::Matrix3d covariance = utility::ComputeCovariance(points, indices);
 
     if (fast_normal_computation) {
         return FastEigen3x3(covariance);
@@ -239,45 +247,6 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
-// Disjoint set data structure to find cycles in graphs
-class DisjointSet {
-public:
-    DisjointSet(size_t size) : parent_(size), size_(size) {
-        for (size_t idx = 0; idx < size; idx++) {
-            parent_[idx] = idx;
-            size_[idx] = 0;
-        }
-    }
-
-    // find representative element for given x
-    // using path compression
-    size_t Find(size_t x) {
-        if (x != parent_[x]) {
-            parent_[x] = Find(parent_[x]);
-        }
-        return parent_[x];
-    }
-
-    // combine two sets using size of sets
-    void Union(size_t x, size_t y) {
-        x = Find(x);
-        y = Find(y);
-        if (x != y) {
-            if (size_[x] < size_[y]) {
-                size_[y] += size_[x];
-                parent_[x] = y;
-            } else {
-                size_[x] += size_[y];
-                parent_[y] = x;
-            }
-        }
-    }
-
-private:
-    std::vector<size_t> parent_;
-    std::vector<size_t> size_;
-};
-
 struct WeightedEdge {
     WeightedEdge(size_t v0, size_t v1, double weight)
         : v0_(v0), v1_(v1), weight_(weight) {}
@@ -286,61 +255,186 @@ struct WeightedEdge {
     double weight_;
 };
 
-// Minimum Spanning Tree algorithm (Kruskal's algorithm)
-std::vector<WeightedEdge> Kruskal(std::vector<WeightedEdge> &edges,
-                                  size_t n_vertices) {
-    std::sort(edges.begin(), edges.end(),
-              [](WeightedEdge &e0, WeightedEdge &e1) {
-                  return e0.weight_ < e1.weight_;
-              });
-    DisjointSet disjoint_set(n_vertices);
-    std::vector<WeightedEdge> mst;
-    for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
-        size_t set0 = disjoint_set.Find(edges[eidx].v0_);
-        size_t set1 = disjoint_set.Find(edges[eidx].v1_);
-        if (set0 != set1) {
-            mst.push_back(edges[eidx]);
-            disjoint_set.Union(set0, set1);
-        }
-    }
-    return mst;
+// Padding key for slots without an edge, sorted after every valid key.
+constexpr uint64_t kNoEdge = std::numeric_limits<uint64_t>::max();
+
+// Packs an undirected edge in a 64-bit key, smaller vertex first.
+uint64_t EdgeKey(size_t v0, size_t v1) {
+    return v0 < v1 ? (uint64_t(v0) << 32 | v1) : (uint64_t(v1) << 32 | v0);
 }
 
-}  // unnamed namespace
+// Sorts the edge keys, drops duplicates and padding, and weights the edges.
+// The keys are left sorted and unique.
+template <typename WeightFunc>
+std::vector<WeightedEdge> EdgesFromKeys(std::vector<uint64_t> &keys,
+                                        const WeightFunc &weight) {
+    tbb::parallel_sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    if (!keys.empty() && keys.back() == kNoEdge) {
+        keys.pop_back();
+    }
+    std::vector<WeightedEdge> edges(keys.size(), WeightedEdge(0, 0, 0.0));
+    utility::ParallelFor(0, int64_t(keys.size()), [&](int64_t eidx) {
+        size_t v0 = size_t(keys[eidx] >> 32);
+        size_t v1 = size_t(keys[eidx] & 0xffffffff);
+        edges[eidx] = WeightedEdge(v0, v1, weight(v0, v1));
+    });
+    return edges;
+}
 
-namespace geometry {
+// Minimum spanning forest (Boruvka's algorithm). In every round, each
+// component picks its lightest outgoing edge in parallel and all picked edges
+// are merged at once, hence there are at most log2(n_vertices) rounds. Ties
+// are broken by position in edges, so the forest is deterministic.
+std::vector<WeightedEdge> Boruvka(const std::vector<WeightedEdge> &edges,
+                                  size_t n_vertices) {
+    // Edges are referred to by their rank in (weight, position) order.
+    int64_t n_edges = int64_t(edges.size());
+    std::vector<int64_t> order(n_edges);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return std::tie(edges[a].weight_, a) < std::tie(edges[b].weight_, b);
+    });
+
+    ConcurrentDisjointSets components(n_vertices);
+    auto EdgeComponents = [&](int64_t rank) {
+        const WeightedEdge &edge = edges[order[rank]];
+        return std::make_pair(components.Find(int(edge.v0_)),
+                              components.Find(int(edge.v1_)));
+    };
+    std::vector<std::atomic<int64_t>> lightest(n_vertices);
+    std::vector<uint8_t> in_forest(n_edges, 0);
+    std::vector<int64_t> candidates(n_edges);
+    std::iota(candidates.begin(), candidates.end(), 0);
+    while (!candidates.empty()) {
+        int64_t n_candidates = int64_t(candidates.size());
+        utility::ParallelFor(0, int64_t(n_vertices), [&](int64_t v) {
+            lightest[v].store(n_edges, std::memory_order_relaxed);
+        });
+        utility::ParallelFor(0, n_candidates, [&](int64_t i) {
+            int64_t rank = candidates[i];
+            auto ends = EdgeComponents(rank);
+            if (ends.first == ends.second) {
+                return;
+            }
+            for (int component : {ends.first, ends.second}) {
+                int64_t current =
+                        lightest[component].load(std::memory_order_relaxed);
+                while (rank < current &&
+                       !lightest[component].compare_exchange_weak(
+                               current, rank, std::memory_order_relaxed)) {
+                }
+            }
+        });
+        utility::ParallelFor(0, n_candidates, [&](int64_t i) {
+            int64_t rank = candidates[i];
+            auto ends = EdgeComponents(rank);
+            if (ends.first != ends.second &&
+                (lightest[ends.first].load(std::memory_order_relaxed) ==
+                         rank ||
+                 lightest[ends.second].load(std::memory_order_relaxed) ==
+                         rank)) {
+                in_forest[rank] = 1;
+            }
+        });
+        utility::ParallelFor(0, n_candidates, [&](int64_t i) {
+            int64_t rank = candidates[i];
+            if (in_forest[rank]) {
+                const WeightedEdge &edge = edges[order[rank]];
+                components.Union(int(edge.v0_), int(edge.v1_));
+            }
+        });
+
+        // Keep the edges that still connect two components.
+        std::vector<int64_t> keep(n_candidates);
+        utility::ParallelFor(0, n_candidates, [&](int64_t i) {
+            auto ends = EdgeComponents(candidates[i]);
+            keep[i] = ends.first != ends.second ? 1 : 0;
+        });
+        std::vector<int64_t> position(n_candidates);
+        utility::InclusivePrefixSum(keep.data(), keep.data() + n_candidates,
+                                    position.data());
+        std::vector<int64_t> remaining(position.back());
+        utility::ParallelFor(0, n_candidates, [&](int64_t i) {
+            if (keep[i]) {
+                remaining[position[i] - 1] = candidates[i];
+            }
+        });
+        candidates.swap(remaining);
+    }
 
-void PointCloud::EstimateNormals(
-        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
-        bool fast_normal_computation /* = true */) {
-    bool has_normal = HasNormals();
-    if (!has_normal) {
-        normals_.resize(points_.size());
+    std::vector<WeightedEdge> forest;
+    for (int64_t rank = 0; rank < n_edges; ++rank) {
+        if (in_forest[rank]) {
+            forest.push_back(edges[order[rank]]);
+        }
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    return forest;
+}
+
+/// Shared by PointCloud::EstimateNormals and PointCloudFloat::EstimateNormals.
+/// If \p has_normal is set, the normals are oriented along the existing ones.
+template <typename PointType, typename KDTreeType>
+void EstimateNormalsWithKDTree(const std::vector<PointType> &points,
+                               std::vector<PointType> &normals,
+                               bool has_normal,
+                               const KDTreeType &kdtree,
+                               const KDTreeSearchParam &search_param,
+                               bool fast_normal_computation) {
+    typedef typename PointType::Scalar Scalar;
+    utility::ParallelFor(0, (int64_t)points.size(), [&](int64_t i) {
         std::vector<int> indices;
-        std::vector<double> distance2;
+        std::vector<Scalar> distance2;
         Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
+        if (kdtree.Search(points[i], search_param, indices, distance2) >= 3) {
+            normal = ComputeNormal(points, indices, fast_normal_computation);
             if (normal.norm() == 0.0) {
                 if (has_normal) {
-                    normal = normals_[i];
+                    normal = normals[i].template cast<double>();
                 } else {
                     normal = Eigen::Vector3d(0.0, 0.0, 1.0);
                 }
             }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
+            if (has_normal &&
+                normal.dot(normals[i].template cast<double>()) < 0.0) {
                 normal *= -1.0;
             }
-            normals_[i] = normal;
+            normals[i] = normal.template cast<Scalar>();
         } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
+            normals[i] = PointType(0.0, 0.0, 1.0);
         }
+    });
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+
+void PointCloud::EstimateNormals(
+        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
+        bool fast_normal_computation /* = true */) {
+    bool has_normal = HasNormals();
+    if (!has_normal) {
+        normals_.resize(points_.size());
     }
+    auto kdtree_ptr = GetKDTree();
+    EstimateNormalsWithKDTree(points_, normals_, has_normal, *kdtree_ptr,
+                              search_param, fast_normal_computation);
+}
+
+void PointCloudFloat::EstimateNormals(
+        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
+        bool fast_normal_computation /* = true */) {
+    bool has_normal = HasNormals();
+    if (!has_normal) {
+        normals_.resize(points_.size());
+    }
+    if (points_.empty()) {
+        return;
+    }
+    KDTreeFlannFloat kdtree(*this);
+    EstimateNormalsWithKDTree(points_, normals_, has_normal, kdtree,
+                              search_param, fast_normal_computation);
 }
 
 void PointCloud::OrientNormalsToAlignWithDirection(
@@ -351,15 +445,14 @@ void PointCloud::OrientNormalsToAlignWithDirection(
                 "[OrientNormalsToAlignWithDirection] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t i) {
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
             normal = orientation_reference;
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsTowardsCameraLocation(
@@ -369,8 +462,7 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
                 "[OrientNormalsTowardsCameraLocation] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t i) {
         Eigen::Vector3d orientation_reference = camera_location - points_[i];
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
@@ -383,7 +475,7 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
@@ -398,70 +490,76 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
     std::shared_ptr<TetraMesh> delaunay_mesh;
     std::vector<size_t> pt_map;
     std::tie(delaunay_mesh, pt_map) = TetraMesh::CreateFromPointCloud(*this);
-    std::vector<WeightedEdge> delaunay_graph;
-    std::unordered_set<size_t> graph_edges;
-    auto EdgeIndex = [&](size_t v0, size_t v1) -> size_t {
-        return std::min(v0, v1) * points_.size() + std::max(v0, v1);
-    };
-    auto AddEdgeToDelaunayGraph = [&](size_t v0, size_t v1) {
-        v0 = pt_map[v0];
-        v1 = pt_map[v1];
-        size_t edge = EdgeIndex(v0, v1);
-        if (graph_edges.count(edge) == 0) {
-            double dist = (points_[v0] - points_[v1]).squaredNorm();
-            delaunay_graph.push_back(WeightedEdge(v0, v1, dist));
-            graph_edges.insert(edge);
-        }
-    };
-    for (const Eigen::Vector4i &tetra : delaunay_mesh->tetras_) {
-        AddEdgeToDelaunayGraph(tetra[0], tetra[1]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[2], tetra[3]);
-    }
-
-    std::vector<WeightedEdge> mst = Kruskal(delaunay_graph, points_.size());
-
-    auto NormalWeight = [&](size_t v0, size_t v1) -> double {
-        return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
-    };
-    for (auto &edge : mst) {
-        edge.weight_ = NormalWeight(edge.v0_, edge.v1_);
-    }
-
-    // Add k nearest neighbors to Riemannian graph
-    KDTreeFlann kdtree(*this);
-    for (size_t v0 = 0; v0 < points_.size(); ++v0) {
-        std::vector<int> neighbors;
-        std::vector<double> dists2;
-        kdtree.SearchKNN(points_[v0], int(k), neighbors, dists2);
-        for (size_t vidx1 = 0; vidx1 < neighbors.size(); ++vidx1) {
-            size_t v1 = size_t(neighbors[vidx1]);
-            if (v0 == v1) {
-                continue;
-            }
-            size_t edge = EdgeIndex(v0, v1);
-            if (graph_edges.count(edge) == 0) {
-                double weight = NormalWeight(v0, v1);
-                mst.push_back(WeightedEdge(v0, v1, weight));
-                graph_edges.insert(edge);
+    const auto &tetras = delaunay_mesh->tetras_;
+    std::vector<uint64_t> delaunay_keys(6 * tetras.size());
+    utility::ParallelFor(0, int64_t(tetras.size()), [&](int64_t tidx) {
+        const Eigen::Vector4i &tetra = tetras[tidx];
+        uint64_t *keys = delaunay_keys.data() + 6 * tidx;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = i + 1; j < 4; ++j) {
+                *keys++ = EdgeKey(pt_map[tetra[i]], pt_map[tetra[j]]);
             }
         }
-    }
+    });
+    std::vector<WeightedEdge> delaunay_graph =
+            EdgesFromKeys(delaunay_keys, [&](size_t v0, size_t v1) {
+                return (points_[v0] - points_[v1]).squaredNorm();
+            });
+    std::vector<WeightedEdge> mst = Boruvka(delaunay_graph, points_.size());
+
+    // Add k nearest neighbors to Riemannian graph, searched in one batch.
+    // As Delaunay edges, only the ones of the Euclidean MST are kept.
+    auto kdtree_ptr = GetKDTree();
+    const KDTreeFlann &kdtree = *kdtree_ptr;
+    const int64_t n_points = int64_t(points_.size());
+    Eigen::MatrixXd queries =
+            Eigen::Map<const Eigen::MatrixXd>(points_[0].data(), 3, n_points);
+    std::vector<int> neighbors;
+    std::vector<double> dists2;
+    int64_t knn = std::max(
+            kdtree.SearchKNNBatch(queries, int(k), neighbors, dists2), 0);
+    int64_t n_knn_edges = n_points * knn;
+    std::vector<uint64_t> riemannian_keys(n_knn_edges + mst.size());
+    utility::ParallelFor(0, n_knn_edges, [&](int64_t i) {
+        int64_t v0 = i / knn;
+        int64_t v1 = neighbors[i];
+        if (v1 < 0 || v0 == v1) {
+            riemannian_keys[i] = kNoEdge;
+            return;
+        }
+        uint64_t key = EdgeKey(v0, v1);
+        riemannian_keys[i] = std::binary_search(delaunay_keys.begin(),
+                                                delaunay_keys.end(), key)
+                                     ? kNoEdge
+                                     : key;
+    });
+    utility::ParallelFor(0, int64_t(mst.size()), [&](int64_t eidx) {
+        riemannian_keys[n_knn_edges + eidx] =
+                EdgeKey(mst[eidx].v0_, mst[eidx].v1_);
+    });
+    std::vector<WeightedEdge> riemannian_graph =
+            EdgesFromKeys(riemannian_keys, [&](size_t v0, size_t v1) {
+                return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
+            });
 
     // extract MST from Riemannian graph
-    mst = Kruskal(mst, points_.size());
-
-    // convert list of edges to graph
-    std::vector<std::unordered_set<size_t>> mst_graph(points_.size());
-    for (const auto &edge : mst) {
-        size_t v0 = edge.v0_;
-        size_t v1 = edge.v1_;
-        mst_graph[v0].insert(v1);
-        mst_graph[v1].insert(v0);
-    }
+    mst = Boruvka(riemannian_graph, points_.size());
+
+    // convert list of edges to graph in CSR format
+    std::vector<uint64_t> mst_keys(2 * mst.size());
+    utility::ParallelFor(0, int64_t(mst.size()), [&](int64_t eidx) {
+        uint64_t v0 = mst[eidx].v0_;
+        uint64_t v1 = mst[eidx].v1_;
+        mst_keys[2 * eidx] = v0 << 32 | v1;
+        mst_keys[2 * eidx + 1] = v1 << 32 | v0;
+    });
+    tbb::parallel_sort(mst_keys.begin(), mst_keys.end());
+    std::vector<int64_t> mst_offsets(n_points + 1);
+    utility::ParallelFor(0, n_points + 1, [&](int64_t v) {
+        mst_offsets[v] = std::lower_bound(mst_keys.begin(), mst_keys.end(),
+                                          uint64_t(v) << 32) -
+                         mst_keys.begin();
+    });
 
     // find start node for tree traversal
     // init with node that maximizes z
@@ -475,10 +573,9 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
         }
     }
 
-    // traverse MST and orient normals consistently
-    std::queue<size_t> traversal_queue;
-    std::vector<bool> visited(points_.size(), false);
-    traversal_queue.push(v0);
+    // traverse MST level by level and orient normals consistently. In a tree
+    // the unvisited neighbors of a level all belong to the next level, each
+    // with a single parent, so a level can be processed in parallel.
     auto TestAndOrientNormal = [&](const Eigen::Vector3d &n0,
                                    Eigen::Vector3d &n1) {
         if (n0.dot(n1) < 0) {
@@ -486,16 +583,34 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
         }
     };
     TestAndOrientNormal(Eigen::Vector3d(0, 0, 1), normals_[v0]);
-    while (!traversal_queue.empty()) {
-        v0 = traversal_queue.front();
-        traversal_queue.pop();
-        visited[v0] = true;
-        for (size_t v1 : mst_graph[v0]) {
-            if (!visited[v1]) {
-                traversal_queue.push(v1);
-                TestAndOrientNormal(normals_[v0], normals_[v1]);
-            }
-        }
+    std::vector<uint8_t> visited(points_.size(), 0);
+    visited[v0] = 1;
+    std::vector<size_t> level = {v0};
+    std::mutex next_level_mutex;
+    while (!level.empty()) {
+        std::vector<size_t> next_level;
+        utility::ParallelForRange(
+                0, int64_t(level.size()), 64,
+                [&](int64_t chunk_begin, int64_t chunk_end) {
+                    std::vector<size_t> children;
+                    for (int64_t i = chunk_begin; i < chunk_end; ++i) {
+                        size_t parent = level[i];
+                        for (int64_t e = mst_offsets[parent];
+                             e < mst_offsets[parent + 1]; ++e) {
+                            size_t child = size_t(mst_keys[e] & 0xffffffff);
+                            if (!visited[child]) {
+                                visited[child] = 1;
+                                TestAndOrientNormal(normals_[parent],
+                                                    normals_[child]);
+                                children.push_back(child);
+                            }
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(next_level_mutex);
+                    next_level.insert(next_level.end(), children.begin(),
+                                      children.end());
+                });
+        level.swap(next_level);
     }
 }
 
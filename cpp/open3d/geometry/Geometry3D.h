@@ -29,6 +29,7 @@
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include "open3d/geometry/DerivedDataCache.h"
 #include "open3d/geometry/Geometry.h"
 #include "open3d/utility/Eigen.h"
 
@@ -192,6 +193,9 @@ protected:
     /// \param normals A list of normals to be transformed.
     void RotateNormals(const Eigen::Matrix3d& R,
                        std::vector<Eigen::Vector3d>& normals) const;
+
+    /// Data derived from the geometry, e.g. bounding boxes and KDTrees.
+    mutable DerivedDataCache derived_data_;
 };
 
 }  // namespace geometry
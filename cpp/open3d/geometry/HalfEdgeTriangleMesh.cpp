@@ -26,11 +26,14 @@
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 
+#include <atomic>
 #include <numeric>
 
+#include "open3d/geometry/MeshAdjacency.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -171,112 +174,76 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->RemoveUnreferencedVertices();
     mesh_cpy->RemoveDegenerateTriangles();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0;
-         triangle_index < mesh_cpy->triangles_.size(); triangle_index++) {
-        const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
-        size_t num_half_edges = het_mesh->half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
+    // Half-edge 3 * t + k of the adjacency is the k-th half-edge of triangle
+    // t, which is the numbering of half_edges_.
+    MeshAdjacency adjacency(mesh_cpy->triangles_, mesh_cpy->vertices_.size());
+    int num_half_edges = int(adjacency.NumHalfEdges());
+    het_mesh->half_edges_.resize(num_half_edges);
+    utility::ParallelFor(0, num_half_edges, [&](int64_t half_edge_index) {
+        int he_index = int(half_edge_index);
+        het_mesh->half_edges_[he_index] = HalfEdge(
+                Eigen::Vector2i(adjacency.HalfEdgeSource(he_index),
+                                adjacency.HalfEdgeTarget(he_index)),
+                MeshAdjacency::HalfEdgeTriangle(he_index),
+                MeshAdjacency::NextHalfEdge(he_index), -1);
+    });
+
+    // Fill twin half-edges. For valid manifolds, there mustn't be duplicated
+    // half-edges, so each edge has at most one half-edge in each direction.
+    for (int edge = 0; edge < int(adjacency.NumEdges()); ++edge) {
+        const int *half_edges = adjacency.EdgeHalfEdgesBegin(edge);
+        int degree = adjacency.EdgeDegree(edge);
+        if (degree > 2 ||
+            (degree == 2 && adjacency.HalfEdgeSource(half_edges[0]) ==
+                                    adjacency.HalfEdgeSource(half_edges[1]))) {
             utility::LogError(
                     "ComputeHalfEdges failed. Duplicated half-edges.");
         }
-
-        het_mesh->half_edges_.push_back(he_0);
-        het_mesh->half_edges_.push_back(he_1);
-        het_mesh->half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
-    }
-
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < het_mesh->half_edges_.size();
-         this_he_index++) {
-        HalfEdge &this_he = het_mesh->half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
+        if (degree == 2) {
+            het_mesh->half_edges_[half_edges[0]].twin_ = half_edges[1];
+            het_mesh->half_edges_[half_edges[1]].twin_ = half_edges[0];
         }
     }
 
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(
-            mesh_cpy->vertices_.size());
-    for (size_t half_edge_index = 0;
-         half_edge_index < het_mesh->half_edges_.size(); half_edge_index++) {
-        int src_vertex_index =
-                het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
-    }
-
     // Find ordered half-edges from each vertex by traversal. To be a valid
     // manifold, there can be at most 1 boundary half-edge from each vertex.
-    het_mesh->ordered_half_edge_from_vertex_.resize(mesh_cpy->vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
-         vertex_index++) {
+    int num_vertices = int(mesh_cpy->vertices_.size());
+    het_mesh->ordered_half_edge_from_vertex_.resize(num_vertices);
+    std::atomic<bool> has_invalid_vertex(false);
+    utility::ParallelFor(0, num_vertices, [&](int64_t vertex_index) {
         size_t num_boundaries = 0;
         int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
-            if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
+        for (const int *it = adjacency.VertexHalfEdgesBegin(int(vertex_index));
+             it != adjacency.VertexHalfEdgesEnd(int(vertex_index)); ++it) {
+            if (het_mesh->half_edges_[*it].IsBoundary()) {
                 num_boundaries++;
-                init_half_edge_index = half_edge_index;
+                init_half_edge_index = *it;
             }
         }
         if (num_boundaries > 1) {
-            utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+            has_invalid_vertex = true;
+            return;
         }
         // If there is a boundary edge, start from that; otherwise start
         // with any half-edge (default 0) started from this vertex.
         if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
+            init_half_edge_index =
+                    *adjacency.VertexHalfEdgesBegin(int(vertex_index));
         }
 
         // Push edges to ordered_half_edge_from_vertex_.
+        std::vector<int> &ordered_half_edges =
+                het_mesh->ordered_half_edge_from_vertex_[vertex_index];
         int curr_he_index = init_half_edge_index;
-        het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                curr_he_index);
-        int next_next_twin_he_index =
-                het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-        curr_he_index = next_next_twin_he_index;
+        ordered_half_edges.push_back(curr_he_index);
+        curr_he_index = het_mesh->NextHalfEdgeFromVertex(curr_he_index);
         while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
-            next_next_twin_he_index =
-                    het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-            curr_he_index = next_next_twin_he_index;
+            ordered_half_edges.push_back(curr_he_index);
+            curr_he_index = het_mesh->NextHalfEdgeFromVertex(curr_he_index);
         }
+    });
+    if (has_invalid_vertex) {
+        utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
     }
 
     mesh_cpy->ComputeVertexNormals();
@@ -40,6 +40,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
@@ -87,7 +88,8 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
         return std::make_shared<PointCloud>();
     }
     const auto& points = input.points_;
-    KDTreeFlann kdtree(input);
+    auto kdtree_ptr = input.GetKDTree();
+    const KDTreeFlann& kdtree = *kdtree_ptr;
 
     if (salient_radius == 0.0 || non_max_radius == 0.0) {
         const double resolution = ComputeModelResolution(points, kdtree);
@@ -100,19 +102,18 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
     }
 
     std::vector<double> third_eigen_values(points.size());
-#pragma omp parallel for schedule(static) shared(third_eigen_values)
-    for (int i = 0; i < (int)points.size(); i++) {
+    utility::ParallelFor(0, int64_t(points.size()), [&](int64_t i) {
         std::vector<int> indices;
         std::vector<double> dist;
         int nb_neighbors =
                 kdtree.SearchRadius(points[i], salient_radius, indices, dist);
         if (nb_neighbors < min_neighbors) {
-            continue;
+            return;
         }
 
         Eigen::Matrix3d cov = utility::ComputeCovariance(points, indices);
         if (cov.isZero()) {
-            continue;
+            return;
         }
 
         Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
@@ -123,12 +124,11 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
         if ((e2c / e1c) < gamma_21 && e3c / e2c < gamma_32) {
             third_eigen_values[i] = e3c;
         }
-    }
+    });
 
-    std::vector<size_t> kp_indices;
-    kp_indices.reserve(points.size());
-#pragma omp parallel for schedule(static) shared(kp_indices)
-    for (int i = 0; i < (int)points.size(); i++) {
+    // std::vector<bool> packs bits, which cannot be written concurrently.
+    std::vector<char> is_keypoint(points.size(), 0);
+    utility::ParallelFor(0, int64_t(points.size()), [&](int64_t i) {
         if (third_eigen_values[i] > 0.0) {
             std::vector<int> nn_indices;
             std::vector<double> dist;
@@ -136,10 +136,16 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
                                                    nn_indices, dist);
 
             if (nb_neighbors >= min_neighbors &&
-                IsLocalMaxima(i, nn_indices, third_eigen_values)) {
-                kp_indices.emplace_back(i);
+                IsLocalMaxima(int(i), nn_indices, third_eigen_values)) {
+                is_keypoint[i] = 1;
             }
         }
+    });
+    std::vector<size_t> kp_indices;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (is_keypoint[i]) {
+            kp_indices.push_back(i);
+        }
     }
 
     utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
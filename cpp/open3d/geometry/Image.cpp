@@ -26,6 +26,8 @@
 
 #include "open3d/geometry/Image.h"
 
+#include <algorithm>
+
 namespace {
 /// Isotropic 2D kernels are separable:
 /// two 1D kernels are applied in x and y direction.
@@ -35,6 +37,82 @@ const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
                                        0.21875, 0.109375, 0.03125};
 const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
 const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+/// Convolves each row of a single channel float image with \p kernel, with
+/// the border pixels repeated. Each row is padded once so that the inner loop
+/// over the pixels has no branches and is vectorized.
+///
+/// The products are taken in float and summed in double in the order of the
+/// kernel, so the result does not depend on the loop order.
+void FilterRows(const float *input,
+                float *output,
+                int width,
+                int height,
+                const std::vector<double> &kernel) {
+    const int kernel_size = (int)kernel.size();
+    const int half_kernel_size = kernel_size / 2;
+    std::vector<float> weights(kernel.begin(), kernel.end());
+#pragma omp parallel
+    {
+        std::vector<float> padded(width + kernel_size - 1);
+        std::vector<double> sums(width);
+#pragma omp for schedule(static)
+        for (int y = 0; y < height; y++) {
+            const float *row = input + (size_t)y * width;
+            std::fill(padded.begin(), padded.begin() + half_kernel_size,
+                      row[0]);
+            std::copy(row, row + width, padded.begin() + half_kernel_size);
+            std::fill(padded.begin() + half_kernel_size + width, padded.end(),
+                      row[width - 1]);
+            std::fill(sums.begin(), sums.end(), 0.0);
+            for (int i = 0; i < kernel_size; i++) {
+                const float *pi = padded.data() + i;
+                const float w = weights[i];
+                for (int x = 0; x < width; x++) {
+                    sums[x] += pi[x] * w;
+                }
+            }
+            float *po = output + (size_t)y * width;
+            for (int x = 0; x < width; x++) {
+                po[x] = (float)sums[x];
+            }
+        }
+    }
+}
+
+/// Convolves each column of a single channel float image with \p kernel,
+/// like FilterRows. The kernel is applied to whole rows at a time, so the
+/// memory is read contiguously and the image does not need to be transposed.
+void FilterColumns(const float *input,
+                   float *output,
+                   int width,
+                   int height,
+                   const std::vector<double> &kernel) {
+    const int kernel_size = (int)kernel.size();
+    const int half_kernel_size = kernel_size / 2;
+    std::vector<float> weights(kernel.begin(), kernel.end());
+#pragma omp parallel
+    {
+        std::vector<double> sums(width);
+#pragma omp for schedule(static)
+        for (int y = 0; y < height; y++) {
+            std::fill(sums.begin(), sums.end(), 0.0);
+            for (int i = 0; i < kernel_size; i++) {
+                int y_shift = std::min(std::max(y + i - half_kernel_size, 0),
+                                       height - 1);
+                const float *pi = input + (size_t)y_shift * width;
+                const float w = weights[i];
+                for (int x = 0; x < width; x++) {
+                    sums[x] += pi[x] * w;
+                }
+            }
+            float *po = output + (size_t)y * width;
+            for (int x = 0; x < width; x++) {
+                po[x] = (float)sums[x];
+            }
+        }
+    }
+}
 }  // unnamed namespace
 
 namespace open3d {
@@ -154,19 +232,14 @@ std::shared_ptr<Image> Image::Downsample() const {
     int half_height = (int)floor((double)height_ / 2.0);
     output->Prepare(half_width, half_height, 1, 4);
 
-#ifdef _WIN32
 #pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
     for (int y = 0; y < output->height_; y++) {
+        const float *p1 = PointerAt<float>(0, y * 2);
+        const float *p2 = PointerAt<float>(0, y * 2 + 1);
+        float *p = output->PointerAt<float>(0, y);
         for (int x = 0; x < output->width_; x++) {
-            float *p1 = PointerAt<float>(x * 2, y * 2);
-            float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
-            float *p3 = PointerAt<float>(x * 2, y * 2 + 1);
-            float *p4 = PointerAt<float>(x * 2 + 1, y * 2 + 1);
-            float *p = output->PointerAt<float>(x, y);
-            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
+            p[x] = (p1[x * 2] + p1[x * 2 + 1] + p2[x * 2] + p2[x * 2 + 1]) /
+                   4.0f;
         }
     }
     return output;
@@ -183,26 +256,9 @@ std::shared_ptr<Image> Image::FilterHorizontal(
     }
     output->Prepare(width_, height_, 1, 4);
 
-    const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
-
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *po = output->PointerAt<float>(x, y, 0);
-            double temp = 0;
-            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
-                int x_shift = x + i;
-                if (x_shift < 0) x_shift = 0;
-                if (x_shift > width_ - 1) x_shift = width_ - 1;
-                float *pi = PointerAt<float>(x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
-            }
-            *po = (float)temp;
-        }
+    if (width_ > 0) {
+        FilterRows(PointerAs<float>(), output->PointerAs<float>(), width_,
+                   height_, kernel);
     }
     return output;
 }
@@ -253,11 +309,22 @@ std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
         utility::LogError("[Filter] Unsupported image format.");
     }
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Transpose();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Transpose();
-    return temp4;
+    if (dx.size() % 2 != 1 || dy.size() % 2 != 1) {
+        utility::LogError("[Filter] Unsupported kernel size.");
+    }
+    output->Prepare(width_, height_, 1, 4);
+    if (width_ == 0 || height_ == 0) {
+        return output;
+    }
+
+    // The intermediate image is kept per thread, so that filtering every
+    // level of every frame does not reallocate it.
+    static thread_local std::vector<float> filtered_rows;
+    filtered_rows.resize((size_t)width_ * height_);
+    FilterRows(PointerAs<float>(), filtered_rows.data(), width_, height_, dx);
+    FilterColumns(filtered_rows.data(), output->PointerAs<float>(), width_,
+                  height_, dy);
+    return output;
 }
 
 std::shared_ptr<Image> Image::Transpose() const {
@@ -31,12 +31,15 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <flann/flann.hpp>
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/PointCloudFloat.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -84,6 +87,14 @@ bool KDTreeFlann::SetFeature(const pipelines::registration::Feature &feature) {
     return SetMatrixData(feature.data_);
 }
 
+void KDTreeFlann::SetApproximateSearch(int num_trees, int checks) {
+    num_trees_ = std::max(num_trees, 0);
+    checks_ = checks;
+    if (flann_dataset_) {
+        BuildIndex();
+    }
+}
+
 template <typename T>
 int KDTreeFlann::Search(const T &query,
                         const KDTreeSearchParam &param,
@@ -126,12 +137,40 @@ int KDTreeFlann::SearchKNN(const T &query,
     flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
     flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
     int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
-                                    knn, flann::SearchParams(-1, 0.0));
+                                    knn, flann::SearchParams(checks_, 0.0));
     indices.resize(k);
     distance2.resize(k);
     return k;
 }
 
+int KDTreeFlann::SearchKNNBatch(const Eigen::MatrixXd &queries,
+                                int knn,
+                                std::vector<int> &indices,
+                                std::vector<double> &distance2) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    knn = std::min(knn, int(dataset_size_));
+    size_t num_queries = size_t(queries.cols());
+    // Eigen stores the columns contiguously, so each query is a FLANN row.
+    flann::Matrix<double> query_flann((double *)queries.data(), num_queries,
+                                      dimension_);
+    indices.assign(num_queries * knn, -1);
+    distance2.assign(num_queries * knn, 0.0);
+    if (num_queries == 0 || knn == 0) {
+        return knn;
+    }
+    flann::Matrix<int> indices_flann(indices.data(), num_queries, knn);
+    flann::Matrix<double> dists_flann(distance2.data(), num_queries, knn);
+    flann::SearchParams param(checks_, 0.0);
+    // FLANN splits the queries over its OpenMP threads.
+    param.cores = utility::GetMaxParallelism();
+    flann_index_->knnSearch(query_flann, indices_flann, dists_flann, knn,
+                            param);
+    return knn;
+}
+
 template <typename T>
 int KDTreeFlann::SearchRadius(const T &query,
                               double radius,
@@ -146,7 +185,7 @@ int KDTreeFlann::SearchRadius(const T &query,
         return -1;
     }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
+    flann::SearchParams param(checks_, 0.0);
     param.max_neighbors = -1;
     std::vector<std::vector<int>> indices_vec(1);
     std::vector<std::vector<double>> dists_vec(1);
@@ -172,7 +211,7 @@ int KDTreeFlann::SearchHybrid(const T &query,
         return -1;
     }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
+    flann::SearchParams param(checks_, 0.0);
     param.max_neighbors = max_nn;
     indices.resize(max_nn);
     distance2.resize(max_nn);
@@ -198,12 +237,21 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
            dataset_size_ * dimension_ * sizeof(double));
     flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
                                                    dataset_size_, dimension_));
-    flann_index_.reset(new flann::Index<flann::L2<double>>(
-            *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
-    flann_index_->buildIndex();
+    BuildIndex();
     return true;
 }
 
+void KDTreeFlann::BuildIndex() {
+    if (num_trees_ > 0) {
+        flann_index_.reset(new flann::Index<flann::L2<double>>(
+                *flann_dataset_, flann::KDTreeIndexParams(num_trees_)));
+    } else {
+        flann_index_.reset(new flann::Index<flann::L2<double>>(
+                *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
+    }
+    flann_index_->buildIndex();
+}
+
 template int KDTreeFlann::Search<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         const KDTreeSearchParam &param,
@@ -248,6 +296,116 @@ template int KDTreeFlann::SearchHybrid<Eigen::VectorXd>(
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
 
+KDTreeFlannFloat::KDTreeFlannFloat() {}
+
+KDTreeFlannFloat::KDTreeFlannFloat(const PointCloudFloat &cloud) {
+    SetPointCloud(cloud);
+}
+
+KDTreeFlannFloat::~KDTreeFlannFloat() {}
+
+bool KDTreeFlannFloat::SetPointCloud(const PointCloudFloat &cloud) {
+    dataset_size_ = cloud.points_.size();
+    if (dataset_size_ == 0) {
+        utility::LogWarning(
+                "[KDTreeFlannFloat::SetPointCloud] Failed due to no data.");
+        return false;
+    }
+    data_.resize(dataset_size_ * 3);
+    memcpy(data_.data(), cloud.points_.data(),
+           dataset_size_ * 3 * sizeof(float));
+    flann_dataset_.reset(
+            new flann::Matrix<float>(data_.data(), dataset_size_, 3));
+    flann_index_.reset(new flann::Index<flann::L2<float>>(
+            *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
+    flann_index_->buildIndex();
+    return true;
+}
+
+int KDTreeFlannFloat::Search(const Eigen::Vector3f &query,
+                             const KDTreeSearchParam &param,
+                             std::vector<int> &indices,
+                             std::vector<float> &distance2) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNN(query, ((const KDTreeSearchParamKNN &)param).knn_,
+                             indices, distance2);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadius(
+                    query, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybrid(
+                    query, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2);
+        default:
+            return -1;
+    }
+    return -1;
+}
+
+int KDTreeFlannFloat::SearchKNN(const Eigen::Vector3f &query,
+                                int knn,
+                                std::vector<int> &indices,
+                                std::vector<float> &distance2) const {
+    if (data_.empty() || knn < 0) {
+        return -1;
+    }
+    flann::Matrix<float> query_flann((float *)query.data(), 1, 3);
+    indices.resize(knn);
+    distance2.resize(knn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
+    flann::Matrix<float> dists_flann(distance2.data(), query_flann.rows, knn);
+    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
+                                    knn, flann::SearchParams(-1, 0.0));
+    indices.resize(k);
+    distance2.resize(k);
+    return k;
+}
+
+int KDTreeFlannFloat::SearchRadius(const Eigen::Vector3f &query,
+                                   double radius,
+                                   std::vector<int> &indices,
+                                   std::vector<float> &distance2) const {
+    if (data_.empty()) {
+        return -1;
+    }
+    flann::Matrix<float> query_flann((float *)query.data(), 1, 3);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = -1;
+    std::vector<std::vector<int>> indices_vec(1);
+    std::vector<std::vector<float>> dists_vec(1);
+    int k = flann_index_->radiusSearch(query_flann, indices_vec, dists_vec,
+                                       float(radius * radius), param);
+    indices = indices_vec[0];
+    distance2 = dists_vec[0];
+    return k;
+}
+
+int KDTreeFlannFloat::SearchHybrid(const Eigen::Vector3f &query,
+                                   double radius,
+                                   int max_nn,
+                                   std::vector<int> &indices,
+                                   std::vector<float> &distance2) const {
+    if (data_.empty() || max_nn < 0) {
+        return -1;
+    }
+    flann::Matrix<float> query_flann((float *)query.data(), 1, 3);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = max_nn;
+    indices.resize(max_nn);
+    distance2.resize(max_nn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
+    flann::Matrix<float> dists_flann(distance2.data(), query_flann.rows,
+                                     max_nn);
+    int k = flann_index_->radiusSearch(query_flann, indices_flann, dists_flann,
+                                       float(radius * radius), param);
+    indices.resize(k);
+    distance2.resize(k);
+    return k;
+}
+
 }  // namespace geometry
 }  // namespace open3d
 
@@ -48,6 +48,8 @@ class Index;
 namespace open3d {
 namespace geometry {
 
+class PointCloudFloat;
+
 /// \class KDTreeFlann
 ///
 /// \brief KDTree with FLANN for nearest neighbor search.
@@ -86,6 +88,19 @@ public:
     /// \param feature Set of features for KDTree construction.
     bool SetFeature(const pipelines::registration::Feature &feature);
 
+    /// \brief Switches between exact and approximate search.
+    ///
+    /// Approximate search uses a forest of randomized KDTrees and stops after
+    /// visiting a bounded number of leaves, trading recall for speed. This
+    /// is mostly useful for high dimensional data such as features. The
+    /// index is rebuilt if the data is already set.
+    ///
+    /// \param num_trees Number of randomized KDTrees. 0 uses a single KDTree
+    /// with exact search.
+    /// \param checks Maximum number of leaves visited per search. Higher
+    /// values improve the recall but are slower. -1 visits all leaves.
+    void SetApproximateSearch(int num_trees, int checks);
+
     template <typename T>
     int Search(const T &query,
                const KDTreeSearchParam &param,
@@ -98,6 +113,25 @@ public:
                   std::vector<int> &indices,
                   std::vector<double> &distance2) const;
 
+    /// \brief Searches the \p knn nearest neighbors of many queries at once.
+    ///
+    /// The queries are searched in parallel without any per-query
+    /// allocation. The outputs are flat buffers of size `knn * num_queries`,
+    /// where the neighbors of query `i` are stored at `[i * knn, (i + 1) *
+    /// knn)` in ascending order of distance. Slots without a neighbor have
+    /// index -1. \p knn is clamped to the dataset size. Reusing the output
+    /// vectors across calls avoids reallocating them.
+    ///
+    /// \param queries Query points, one per column.
+    /// \param knn Number of neighbors per query.
+    /// \param indices Output neighbor indices.
+    /// \param distance2 Output squared distances.
+    /// \return The clamped \p knn, or -1 on invalid input.
+    int SearchKNNBatch(const Eigen::MatrixXd &queries,
+                       int knn,
+                       std::vector<int> &indices,
+                       std::vector<double> &distance2) const;
+
     template <typename T>
     int SearchRadius(const T &query,
                      double radius,
@@ -118,12 +152,71 @@ private:
     /// features, geometry, etc.
     bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
 
+    /// Build the FLANN index over flann_dataset_.
+    void BuildIndex();
+
 protected:
     std::vector<double> data_;
     std::unique_ptr<flann::Matrix<double>> flann_dataset_;
     std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
+    /// Number of randomized KDTrees, 0 for a single exact KDTree.
+    int num_trees_ = 0;
+    /// Maximum number of leaves visited per search, -1 for all.
+    int checks_ = -1;
+};
+
+/// \class KDTreeFlannFloat
+///
+/// \brief KDTree with FLANN over the points of a PointCloudFloat.
+///
+/// Same searches as KDTreeFlann, but the points, the queries and the returned
+/// squared distances are in single precision.
+class KDTreeFlannFloat {
+public:
+    /// \brief Default Constructor.
+    KDTreeFlannFloat();
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cloud Provides the points from which the KDTree is constructed.
+    KDTreeFlannFloat(const PointCloudFloat &cloud);
+    ~KDTreeFlannFloat();
+    KDTreeFlannFloat(const KDTreeFlannFloat &) = delete;
+    KDTreeFlannFloat &operator=(const KDTreeFlannFloat &) = delete;
+
+public:
+    /// Sets the data for the KDTree from the points of a point cloud.
+    ///
+    /// \param cloud Point cloud for KDTree construction.
+    bool SetPointCloud(const PointCloudFloat &cloud);
+
+    int Search(const Eigen::Vector3f &query,
+               const KDTreeSearchParam &param,
+               std::vector<int> &indices,
+               std::vector<float> &distance2) const;
+
+    int SearchKNN(const Eigen::Vector3f &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<float> &distance2) const;
+
+    int SearchRadius(const Eigen::Vector3f &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<float> &distance2) const;
+
+    int SearchHybrid(const Eigen::Vector3f &query,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<float> &distance2) const;
+
+protected:
+    std::vector<float> data_;
+    std::unique_ptr<flann::Matrix<float>> flann_dataset_;
+    std::unique_ptr<flann::Index<flann::L2<float>>> flann_index_;
+    size_t dataset_size_ = 0;
 };
 
 }  // namespace geometry
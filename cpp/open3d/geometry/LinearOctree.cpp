@@ -0,0 +1,260 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+int64_t LinearOctree::Node::GetChild(size_t child_index) const {
+    if (IsLeaf() || !(child_mask_ & (1 << child_index))) {
+        return -1;
+    }
+    // Children are stored contiguously in child index order, so the offset
+    // is the number of existing children before child_index.
+    int64_t offset = 0;
+    for (size_t i = 0; i < child_index; ++i) {
+        offset += (child_mask_ >> i) & 1;
+    }
+    return first_child_ + offset;
+}
+
+LinearOctree::LinearOctree(size_t max_depth)
+    : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError(
+                "LinearOctree supports a max depth of {}, but got {}.",
+                kMaxDepth, max_depth_);
+    }
+}
+
+bool LinearOctree::ComputeLeafKey(const Eigen::Vector3d &point,
+                                  uint64_t &key) const {
+    // Descend with the same arithmetic as Octree::InsertPoint, such that the
+    // points end up in the same cells.
+    if (!Octree::IsPointInBound(point, origin_, size_)) {
+        return false;
+    }
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    key = 0;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        double child_size = size / 2.0;
+        size_t x_index = point(0) < origin(0) + child_size ? 0 : 1;
+        size_t y_index = point(1) < origin(1) + child_size ? 0 : 1;
+        size_t z_index = point(2) < origin(2) + child_size ? 0 : 1;
+        origin += Eigen::Vector3d(x_index * child_size, y_index * child_size,
+                                  z_index * child_size);
+        size = child_size;
+        if (!Octree::IsPointInBound(point, origin, size)) {
+            return false;
+        }
+        key = (key << 3) | (x_index + y_index * 2 + z_index * 4);
+    }
+    return true;
+}
+
+void LinearOctree::ConvertFromPointCloud(
+        const geometry::PointCloud &point_cloud, double size_expand) {
+    Octree::ComputeBound(point_cloud, size_expand, origin_, size_);
+    nodes_.clear();
+    point_indices_.clear();
+
+    // Leaf keys of all points in parallel.
+    const int64_t num_points = int64_t(point_cloud.points_.size());
+    std::vector<uint64_t> keys(num_points);
+    std::vector<uint8_t> in_bound(num_points);
+    utility::ParallelFor(0, num_points, [&](int64_t i) {
+        in_bound[i] = ComputeLeafKey(point_cloud.points_[i], keys[i]);
+    });
+    for (int64_t i = 0; i < num_points; ++i) {
+        if (in_bound[i]) {
+            point_indices_.push_back(size_t(i));
+        }
+    }
+    // Ties are broken by index, so each leaf lists its points in input order.
+    tbb::parallel_sort(point_indices_.begin(), point_indices_.end(),
+                       [&keys](size_t a, size_t b) {
+                           return keys[a] < keys[b] ||
+                                  (keys[a] == keys[b] && a < b);
+                       });
+    if (point_indices_.empty()) {
+        return;
+    }
+
+    // Leaves are runs of equal keys.
+    const bool has_colors = point_cloud.HasColors();
+    std::vector<std::vector<Node>> levels(max_depth_ + 1);
+    for (size_t begin = 0; begin < point_indices_.size();) {
+        Node leaf;
+        leaf.key_ = keys[point_indices_[begin]];
+        leaf.depth_ = max_depth_;
+        leaf.begin_ = begin;
+        leaf.end_ = begin;
+        while (leaf.end_ < point_indices_.size() &&
+               keys[point_indices_[leaf.end_]] == leaf.key_) {
+            ++leaf.end_;
+        }
+        if (has_colors) {
+            leaf.color_ = point_cloud.colors_[point_indices_[leaf.end_ - 1]];
+        }
+        levels[max_depth_].push_back(leaf);
+        begin = leaf.end_;
+    }
+
+    // Each level merges the runs of the level below sharing a parent key.
+    for (size_t depth = max_depth_; depth-- > 0;) {
+        const std::vector<Node> &children = levels[depth + 1];
+        for (size_t first = 0; first < children.size();) {
+            Node parent;
+            parent.key_ = children[first].key_ >> 3;
+            parent.depth_ = depth;
+            parent.first_child_ = int64_t(first);
+            parent.begin_ = children[first].begin_;
+            size_t last = first;
+            while (last < children.size() &&
+                   (children[last].key_ >> 3) == parent.key_) {
+                parent.child_mask_ |= uint8_t(1 << (children[last].key_ & 7));
+                ++last;
+            }
+            parent.end_ = children[last - 1].end_;
+            levels[depth].push_back(parent);
+            first = last;
+        }
+    }
+
+    // Concatenate root first, turning per-level child offsets into indices.
+    std::vector<size_t> level_offsets(max_depth_ + 2, 0);
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        level_offsets[depth + 1] = level_offsets[depth] + levels[depth].size();
+    }
+    nodes_.reserve(level_offsets.back());
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        for (Node &node : levels[depth]) {
+            if (!node.IsLeaf()) {
+                node.first_child_ += int64_t(level_offsets[depth + 1]);
+            }
+            nodes_.push_back(node);
+        }
+    }
+}
+
+std::vector<int64_t> LinearOctree::LocateLeafNodes(
+        const std::vector<Eigen::Vector3d> &points) const {
+    std::vector<int64_t> leaf_indices(points.size(), -1);
+    if (nodes_.empty()) {
+        return leaf_indices;
+    }
+    utility::ParallelFor(0, int64_t(points.size()), [&](int64_t i) {
+        uint64_t key;
+        if (!ComputeLeafKey(points[i], key)) {
+            return;
+        }
+        int64_t node_index = 0;
+        for (size_t depth = 0; depth < max_depth_ && node_index >= 0;
+             ++depth) {
+            size_t child_index = (key >> (3 * (max_depth_ - 1 - depth))) & 7;
+            node_index = nodes_[node_index].GetChild(child_index);
+        }
+        leaf_indices[i] = node_index;
+    });
+    return leaf_indices;
+}
+
+Eigen::Vector3d LinearOctree::GetNodeOrigin(const Node &node) const {
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    for (size_t depth = 0; depth < node.depth_; ++depth) {
+        size_t child_index = (node.key_ >> (3 * (node.depth_ - 1 - depth))) & 7;
+        size /= 2.0;
+        origin += Eigen::Vector3d(double(child_index % 2),
+                                  double((child_index / 2) % 2),
+                                  double((child_index / 4) % 2)) *
+                  size;
+    }
+    return origin;
+}
+
+double LinearOctree::GetNodeSize(const Node &node) const {
+    double size = size_;
+    for (size_t depth = 0; depth < node.depth_; ++depth) {
+        size /= 2.0;
+    }
+    return size;
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (nodes_.empty()) {
+        return octree;
+    }
+
+    std::vector<std::shared_ptr<OctreeNode>> octree_nodes(nodes_.size());
+    utility::ParallelFor(0, int64_t(nodes_.size()), [&](int64_t i) {
+        const Node &node = nodes_[i];
+        std::vector<size_t> indices(point_indices_.begin() + node.begin_,
+                                    point_indices_.begin() + node.end_);
+        if (node.IsLeaf()) {
+            auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+            leaf_node->color_ = node.color_;
+            leaf_node->indices_ = std::move(indices);
+            octree_nodes[i] = leaf_node;
+        } else {
+            // Internal nodes list their points in input order.
+            std::sort(indices.begin(), indices.end());
+            auto internal_node = std::make_shared<OctreeInternalPointNode>();
+            internal_node->indices_ = std::move(indices);
+            octree_nodes[i] = internal_node;
+        }
+    });
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        if (nodes_[i].IsLeaf()) {
+            continue;
+        }
+        auto internal_node =
+                std::static_pointer_cast<OctreeInternalNode>(octree_nodes[i]);
+        for (size_t child_index = 0; child_index < 8; ++child_index) {
+            int64_t child = nodes_[i].GetChild(child_index);
+            if (child >= 0) {
+                internal_node->children_[child_index] = octree_nodes[child];
+            }
+        }
+    }
+    octree->root_node_ = octree_nodes[0];
+    return octree;
+}
+
+}  // namespace geometry
+}  // namespace open3d
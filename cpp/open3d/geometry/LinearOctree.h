@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class Octree;
+class PointCloud;
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree stored as a flat array of Morton-keyed nodes.
+///
+/// The octree is built bottom-up: every point is assigned the Morton key of
+/// its leaf cell in parallel, the points are sorted by key, and each level is
+/// derived from the one below it by merging the keys sharing a parent. The
+/// nodes are stored level by level from the root, and the children of a node
+/// are contiguous, so a descent only touches a handful of cache lines.
+///
+/// The cell subdivision is the same as in Octree, and ToOctree() creates the
+/// equivalent pointer based tree.
+class LinearOctree {
+public:
+    /// Maximum supported depth, limited by the 63-bit Morton keys.
+    static constexpr size_t kMaxDepth = 21;
+
+    /// \class Node
+    ///
+    /// \brief A node of the LinearOctree.
+    struct Node {
+        /// Morton key of the node cell among the cells of its depth. The
+        /// lowest 3 bits are the child index of the node in its parent.
+        uint64_t key_ = 0;
+        /// Depth of the node. The root is of depth 0.
+        size_t depth_ = 0;
+        /// Index of the first child in nodes_, or -1 for leaf nodes.
+        int64_t first_child_ = -1;
+        /// Bit i is set if the child with child index i exists.
+        uint8_t child_mask_ = 0;
+        /// Range [begin_, end_) of the node points in point_indices_.
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        /// For leaf nodes, color of the last point in the node.
+        Eigen::Vector3d color_ = Eigen::Vector3d::Zero();
+
+        bool IsLeaf() const { return first_child_ < 0; }
+        /// Returns the index in nodes_ of the child, or -1 if it is empty.
+        int64_t GetChild(size_t child_index) const;
+    };
+
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Max depth of the octree, at most kMaxDepth.
+    explicit LinearOctree(size_t max_depth);
+
+    /// \brief Builds the octree over all points of \p point_cloud.
+    ///
+    /// The bounds are computed as in Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const geometry::PointCloud &point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Returns the index in nodes_ of the leaf node containing each
+    /// point, or -1 if the point is out of bound or in an empty cell.
+    ///
+    /// The queries are processed in parallel.
+    ///
+    /// \param points Query points.
+    std::vector<int64_t> LocateLeafNodes(
+            const std::vector<Eigen::Vector3d> &points) const;
+
+    /// Returns the min bound of the cell of \p node.
+    Eigen::Vector3d GetNodeOrigin(const Node &node) const;
+
+    /// Returns the edge size of the cell of \p node.
+    double GetNodeSize(const Node &node) const;
+
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// \brief Creates the equivalent pointer based Octree.
+    ///
+    /// Internal nodes are OctreeInternalPointNode and leaf nodes are
+    /// OctreePointColorLeafNode, as created by Octree::ConvertFromPointCloud.
+    std::shared_ptr<Octree> ToOctree() const;
+
+private:
+    /// Computes the Morton key of the leaf cell containing \p point. Returns
+    /// false if the point is out of bound.
+    bool ComputeLeafKey(const Eigen::Vector3d &point, uint64_t &key) const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+    /// Max depth of the octree.
+    size_t max_depth_;
+    /// Nodes ordered by depth, then by key. nodes_[0] is the root.
+    std::vector<Node> nodes_;
+    /// Point indices sorted by leaf key. The points of a node are contiguous.
+    std::vector<size_t> point_indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
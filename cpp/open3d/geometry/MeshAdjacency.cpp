@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/MeshAdjacency.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+MeshAdjacency::MeshAdjacency(const std::vector<Eigen::Vector3i> &triangles,
+                             size_t num_vertices)
+    : triangles_(&triangles) {
+    if (triangles.size() > size_t(std::numeric_limits<int>::max() / 3)) {
+        utility::LogError("[MeshAdjacency] Too many triangles: {}.",
+                          triangles.size());
+    }
+    const int num_half_edges = int(3 * triangles.size());
+
+    // Counting sort of the half-edges by source vertex.
+    vertex_offsets_.assign(num_vertices + 1, 0);
+    for (const Eigen::Vector3i &triangle : triangles) {
+        for (int k = 0; k < 3; ++k) {
+            if (triangle(k) < 0 || size_t(triangle(k)) >= num_vertices) {
+                utility::LogError(
+                        "[MeshAdjacency] Vertex index {} is out of range [0, "
+                        "{}).",
+                        triangle(k), num_vertices);
+            }
+            vertex_offsets_[triangle(k) + 1]++;
+        }
+    }
+    std::partial_sum(vertex_offsets_.begin(), vertex_offsets_.end(),
+                     vertex_offsets_.begin());
+    vertex_half_edges_.resize(num_half_edges);
+    std::vector<int> vertex_fill(vertex_offsets_.begin(),
+                                 vertex_offsets_.end() - 1);
+    for (int half_edge = 0; half_edge < num_half_edges; ++half_edge) {
+        vertex_half_edges_[vertex_fill[HalfEdgeSource(half_edge)]++] =
+                half_edge;
+    }
+
+    // Sort the half-edges by undirected edge, packed in a 64-bit key.
+    std::vector<std::pair<uint64_t, int>> keyed_half_edges(num_half_edges);
+    utility::ParallelFor(0, num_half_edges, [&](int64_t half_edge) {
+        uint64_t v0 = uint64_t(HalfEdgeSource(int(half_edge)));
+        uint64_t v1 = uint64_t(HalfEdgeTarget(int(half_edge)));
+        uint64_t key = v0 < v1 ? (v0 << 32 | v1) : (v1 << 32 | v0);
+        keyed_half_edges[half_edge] = std::make_pair(key, int(half_edge));
+    });
+    tbb::parallel_sort(keyed_half_edges.begin(), keyed_half_edges.end());
+
+    edge_half_edges_.resize(num_half_edges);
+    half_edge_edges_.resize(num_half_edges);
+    for (int i = 0; i < num_half_edges; ++i) {
+        uint64_t key = keyed_half_edges[i].first;
+        if (i == 0 || key != keyed_half_edges[i - 1].first) {
+            edge_offsets_.push_back(i);
+            edges_.emplace_back(int(key >> 32), int(key & 0xffffffff));
+        }
+        edge_half_edges_[i] = keyed_half_edges[i].second;
+        half_edge_edges_[keyed_half_edges[i].second] = int(edges_.size()) - 1;
+    }
+    edge_offsets_.push_back(num_half_edges);
+}
+
+std::vector<int> MeshAdjacency::GetVertexNeighbors(int vertex) const {
+    std::vector<int> neighbors;
+    neighbors.reserve(2 * VertexDegree(vertex));
+    for (const int *it = VertexHalfEdgesBegin(vertex);
+         it != VertexHalfEdgesEnd(vertex); ++it) {
+        neighbors.push_back(HalfEdgeTarget(*it));
+        neighbors.push_back(HalfEdgeSource(PrevHalfEdge(*it)));
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+    return neighbors;
+}
+
+bool MeshAdjacency::IsVertexManifold(int vertex) const {
+    // The edges opposite to the vertex, one per triangle. The half-edges of a
+    // triangle are contiguous since they are sorted.
+    std::vector<std::pair<int, int>> link_edges;
+    int prev_triangle = -1;
+    for (const int *it = VertexHalfEdgesBegin(vertex);
+         it != VertexHalfEdgesEnd(vertex); ++it) {
+        int triangle = HalfEdgeTriangle(*it);
+        if (triangle == prev_triangle) {
+            continue;
+        }
+        prev_triangle = triangle;
+        int v0 = HalfEdgeTarget(*it);
+        int v1 = HalfEdgeSource(PrevHalfEdge(*it));
+        if (v0 != vertex && v1 != vertex) {
+            link_edges.emplace_back(v0, v1);
+        }
+    }
+    if (link_edges.empty()) {
+        return true;
+    }
+
+    // Count the connected components of the link with a union-find.
+    std::vector<int> link_vertices;
+    link_vertices.reserve(2 * link_edges.size());
+    for (const auto &edge : link_edges) {
+        link_vertices.push_back(edge.first);
+        link_vertices.push_back(edge.second);
+    }
+    std::sort(link_vertices.begin(), link_vertices.end());
+    link_vertices.erase(
+            std::unique(link_vertices.begin(), link_vertices.end()),
+            link_vertices.end());
+    auto local_index = [&](int v) {
+        return int(std::lower_bound(link_vertices.begin(), link_vertices.end(),
+                                    v) -
+                   link_vertices.begin());
+    };
+    std::vector<int> parents(link_vertices.size());
+    std::iota(parents.begin(), parents.end(), 0);
+    auto find = [&](int i) {
+        while (parents[i] != i) {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    };
+    size_t num_components = link_vertices.size();
+    for (const auto &edge : link_edges) {
+        int root0 = find(local_index(edge.first));
+        int root1 = find(local_index(edge.second));
+        if (root0 != root1) {
+            parents[root0] = root1;
+            num_components--;
+        }
+    }
+    return num_components == 1;
+}
+
+}  // namespace geometry
+}  // namespace open3d
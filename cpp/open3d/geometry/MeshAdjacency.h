@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class MeshAdjacency
+///
+/// \brief Edge and vertex adjacency of triangles, stored as flat index
+/// arrays.
+///
+/// Half-edge 3 * t + k goes from corner k to corner (k + 1) % 3 of triangle
+/// t, so half-edges are implicit and only their groupings are stored. The
+/// half-edges are sorted by undirected edge with a parallel sort, and by
+/// source vertex with a counting sort, into compressed sparse row (CSR)
+/// arrays. Within each group the half-edges are in increasing order, i.e. in
+/// the order of the triangles.
+///
+/// This replaces the per-edge hash maps and vector-of-vectors that the mesh
+/// functions used to rebuild each time.
+class MeshAdjacency {
+public:
+    /// \brief Builds the adjacency of \p triangles.
+    ///
+    /// \param triangles Triangles with vertex indices in [0, num_vertices).
+    /// They are referenced, not copied, and must outlive the adjacency.
+    /// \param num_vertices Number of vertices.
+    MeshAdjacency(const std::vector<Eigen::Vector3i> &triangles,
+                  size_t num_vertices);
+
+    /// Number of half-edges, three per triangle.
+    size_t NumHalfEdges() const { return half_edge_edges_.size(); }
+    /// Number of distinct undirected edges.
+    size_t NumEdges() const { return edges_.size(); }
+    /// Number of vertices.
+    size_t NumVertices() const { return vertex_offsets_.size() - 1; }
+
+    /// Triangle of the half-edge.
+    static int HalfEdgeTriangle(int half_edge) { return half_edge / 3; }
+    /// Next half-edge in the same triangle.
+    static int NextHalfEdge(int half_edge) {
+        return half_edge % 3 == 2 ? half_edge - 2 : half_edge + 1;
+    }
+    /// Previous half-edge in the same triangle.
+    static int PrevHalfEdge(int half_edge) {
+        return half_edge % 3 == 0 ? half_edge + 2 : half_edge - 1;
+    }
+
+    /// Source vertex of the half-edge.
+    int HalfEdgeSource(int half_edge) const {
+        return (*triangles_)[half_edge / 3](half_edge % 3);
+    }
+    /// Target vertex of the half-edge.
+    int HalfEdgeTarget(int half_edge) const {
+        return HalfEdgeSource(NextHalfEdge(half_edge));
+    }
+    /// Undirected edge of the half-edge.
+    int HalfEdgeEdge(int half_edge) const {
+        return half_edge_edges_[half_edge];
+    }
+
+    /// Vertices of the undirected edge, the smaller one first. The edges are
+    /// sorted.
+    const Eigen::Vector2i &GetEdge(int edge) const { return edges_[edge]; }
+    /// Number of half-edges along the undirected edge, i.e. of triangles
+    /// sharing it when the triangles are not degenerate.
+    int EdgeDegree(int edge) const {
+        return edge_offsets_[edge + 1] - edge_offsets_[edge];
+    }
+    /// Half-edges along the undirected edge, as the range [begin, end).
+    const int *EdgeHalfEdgesBegin(int edge) const {
+        return edge_half_edges_.data() + edge_offsets_[edge];
+    }
+    const int *EdgeHalfEdgesEnd(int edge) const {
+        return edge_half_edges_.data() + edge_offsets_[edge + 1];
+    }
+
+    /// Number of half-edges starting at the vertex.
+    int VertexDegree(int vertex) const {
+        return vertex_offsets_[vertex + 1] - vertex_offsets_[vertex];
+    }
+    /// Half-edges starting at the vertex, as the range [begin, end).
+    const int *VertexHalfEdgesBegin(int vertex) const {
+        return vertex_half_edges_.data() + vertex_offsets_[vertex];
+    }
+    const int *VertexHalfEdgesEnd(int vertex) const {
+        return vertex_half_edges_.data() + vertex_offsets_[vertex + 1];
+    }
+
+    /// \brief Returns the neighbors of the vertex, i.e. the other corners of
+    /// its triangles, sorted and without duplicates.
+    std::vector<int> GetVertexNeighbors(int vertex) const;
+
+    /// \brief Returns true if the triangles around the vertex form a single
+    /// fan, i.e. if the edges opposite to the vertex are connected.
+    ///
+    /// Degenerate triangles with the vertex at two corners are ignored, and
+    /// vertices without triangles are manifold.
+    bool IsVertexManifold(int vertex) const;
+
+private:
+    const std::vector<Eigen::Vector3i> *triangles_;
+    /// Sorted undirected edges.
+    std::vector<Eigen::Vector2i> edges_;
+    /// CSR of the half-edges of each edge.
+    std::vector<int> edge_offsets_;
+    std::vector<int> edge_half_edges_;
+    /// Undirected edge of each half-edge.
+    std::vector<int> half_edge_edges_;
+    /// CSR of the half-edges starting at each vertex.
+    std::vector<int> vertex_offsets_;
+    std::vector<int> vertex_half_edges_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -47,6 +47,7 @@ MeshBase &MeshBase::Clear() {
     vertices_.clear();
     vertex_normals_.clear();
     vertex_colors_.clear();
+    derived_data_.Clear();
     return *this;
 }
 
@@ -63,11 +64,21 @@ Eigen::Vector3d MeshBase::GetMaxBound() const {
 Eigen::Vector3d MeshBase::GetCenter() const { return ComputeCenter(vertices_); }
 
 AxisAlignedBoundingBox MeshBase::GetAxisAlignedBoundingBox() const {
-    return AxisAlignedBoundingBox::CreateFromPoints(vertices_);
+    return *derived_data_.Get<AxisAlignedBoundingBox>(
+            "axis_aligned_bounding_box",
+            DerivedDataCache::Fingerprint(vertices_), [this]() {
+                return std::make_shared<AxisAlignedBoundingBox>(
+                        AxisAlignedBoundingBox::CreateFromPoints(vertices_));
+            });
 }
 
 OrientedBoundingBox MeshBase::GetOrientedBoundingBox() const {
-    return OrientedBoundingBox::CreateFromPoints(vertices_);
+    return *derived_data_.Get<OrientedBoundingBox>(
+            "oriented_bounding_box", DerivedDataCache::Fingerprint(vertices_),
+            [this]() {
+                return std::make_shared<OrientedBoundingBox>(
+                        OrientedBoundingBox::CreateFromPoints(vertices_));
+            });
 }
 
 MeshBase &MeshBase::Transform(const Eigen::Matrix4d &transformation) {
@@ -33,6 +33,7 @@
 #include <unordered_map>
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/utility/Console.h"
@@ -555,26 +556,54 @@ Octree& Octree::Rotate(const Eigen::Matrix3d& R,
     return *this;
 }
 
-void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
-                                   double size_expand) {
+void Octree::ComputeBound(const geometry::PointCloud& point_cloud,
+                          double size_expand,
+                          Eigen::Vector3d& origin,
+                          double& size) {
     if (size_expand > 1 || size_expand < 0) {
         utility::LogError("size_expand shall be between 0 and 1");
     }
-
-    // Set bounds
-    Clear();
     Eigen::Array3d min_bound = point_cloud.GetMinBound();
     Eigen::Array3d max_bound = point_cloud.GetMaxBound();
     Eigen::Array3d center = (min_bound + max_bound) / 2;
     Eigen::Array3d half_sizes = center - min_bound;
     double max_half_size = half_sizes.maxCoeff();
-    origin_ = min_bound.min(center - max_half_size);
+    origin = min_bound.min(center - max_half_size);
     if (max_half_size == 0) {
-        size_ = size_expand;
+        size = size_expand;
     } else {
-        size_ = max_half_size * 2 * (1 + size_expand);
+        size = max_half_size * 2 * (1 + size_expand);
+    }
+}
+
+void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
+                                   double size_expand) {
+    if (max_depth_ <= LinearOctree::kMaxDepth) {
+        LinearOctree linear_octree(max_depth_);
+        linear_octree.ConvertFromPointCloud(point_cloud, size_expand);
+        Clear();
+        origin_ = linear_octree.origin_;
+        size_ = linear_octree.size_;
+        root_node_ = linear_octree.ToOctree()->root_node_;
+        // Like InsertPoint, create the root even if no point is in bound.
+        if (root_node_ == nullptr && point_cloud.HasPoints()) {
+            if (max_depth_ == 0) {
+                root_node_ = OctreePointColorLeafNode::GetInitFunction()();
+            } else {
+                root_node_ = OctreeInternalPointNode::GetInitFunction()();
+            }
+        }
+        return;
     }
 
+    // Set bounds
+    Eigen::Vector3d origin;
+    double size;
+    ComputeBound(point_cloud, size_expand, origin, size);
+    Clear();
+    origin_ = origin;
+    size_ = size;
+
     // Insert points
     const bool has_colors = point_cloud.HasColors();
     for (size_t idx = 0; idx < point_cloud.points_.size(); idx++) {
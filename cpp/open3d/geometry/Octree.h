@@ -315,9 +315,23 @@ public:
     /// \param size_expand A small expansion size such that the octree is
     /// slightly bigger than the original point cloud bounds to accomodate all
     /// points.
+    ///
+    /// For max depths up to LinearOctree::kMaxDepth, the tree is built in
+    /// parallel as a LinearOctree and converted to this pointer based view.
     void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
                                double size_expand = 0.01);
 
+    /// \brief Computes the cubic bound of an octree over \p point_cloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand Relative expansion of the bound, between 0 and 1.
+    /// \param origin Output global min bound.
+    /// \param size Output edge size.
+    static void ComputeBound(const geometry::PointCloud& point_cloud,
+                             double size_expand,
+                             Eigen::Vector3d& origin,
+                             double& size);
+
     /// Root of the octree.
     std::shared_ptr<OctreeNode> root_node_ = nullptr;
 
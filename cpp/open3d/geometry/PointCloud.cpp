@@ -26,17 +26,22 @@
 
 #include "open3d/geometry/PointCloud.h"
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <random>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloudFloat.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -45,6 +50,7 @@ PointCloud &PointCloud::Clear() {
     points_.clear();
     normals_.clear();
     colors_.clear();
+    derived_data_.Clear();
     return *this;
 }
 
@@ -61,11 +67,30 @@ Eigen::Vector3d PointCloud::GetMaxBound() const {
 Eigen::Vector3d PointCloud::GetCenter() const { return ComputeCenter(points_); }
 
 AxisAlignedBoundingBox PointCloud::GetAxisAlignedBoundingBox() const {
-    return AxisAlignedBoundingBox::CreateFromPoints(points_);
+    return *derived_data_.Get<AxisAlignedBoundingBox>(
+            "axis_aligned_bounding_box",
+            DerivedDataCache::Fingerprint(points_), [this]() {
+                return std::make_shared<AxisAlignedBoundingBox>(
+                        AxisAlignedBoundingBox::CreateFromPoints(points_));
+            });
 }
 
 OrientedBoundingBox PointCloud::GetOrientedBoundingBox() const {
-    return OrientedBoundingBox::CreateFromPoints(points_);
+    return *derived_data_.Get<OrientedBoundingBox>(
+            "oriented_bounding_box", DerivedDataCache::Fingerprint(points_),
+            [this]() {
+                return std::make_shared<OrientedBoundingBox>(
+                        OrientedBoundingBox::CreateFromPoints(points_));
+            });
+}
+
+std::shared_ptr<const KDTreeFlann> PointCloud::GetKDTree() const {
+    return derived_data_.Get<KDTreeFlann>(
+            "kdtree", DerivedDataCache::Fingerprint(points_), [this]() {
+                auto kdtree = std::make_shared<KDTreeFlann>();
+                kdtree->SetGeometry(*this);
+                return kdtree;
+            });
 }
 
 PointCloud &PointCloud::Transform(const Eigen::Matrix4d &transformation) {
@@ -127,10 +152,9 @@ PointCloud PointCloud::operator+(const PointCloud &cloud) const {
 std::vector<double> PointCloud::ComputePointCloudDistance(
         const PointCloud &target) {
     std::vector<double> distances(points_.size());
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    auto kdtree_ptr = target.GetKDTree();
+    const KDTreeFlann &kdtree = *kdtree_ptr;
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t i) {
         std::vector<int> indices(1);
         std::vector<double> dists(1);
         if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
@@ -141,7 +165,7 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
         } else {
             distances[i] = std::sqrt(dists[0]);
         }
-    }
+    });
     return distances;
 }
 
@@ -174,6 +198,64 @@ PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
     return *this;
 }
 
+/// Spreads the lower 21 bits of \p x so that two zero bits separate each of
+/// them.
+static uint64_t MortonSplitBy3(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+template <typename T>
+static void ApplyPermutation(std::vector<T> &values,
+                             const std::vector<size_t> &order) {
+    std::vector<T> permuted(values.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        permuted[i] = values[order[i]];
+    }
+    values.swap(permuted);
+}
+
+PointCloud &PointCloud::SortByMortonCode() {
+    const size_t n = points_.size();
+    if (n < 2) {
+        return *this;
+    }
+    // Quantize on a 2^21 cubic grid over the bounding box.
+    const Eigen::Vector3d min_bound = GetMinBound();
+    const double extent = (GetMaxBound() - min_bound).maxCoeff();
+    const double grid_max = double((1 << 21) - 1);
+    const double scale = extent > 0 ? grid_max / extent : 0.0;
+
+    std::vector<uint64_t> codes(n);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(n); i++) {
+        uint64_t code = 0;
+        for (int d = 0; d < 3; d++) {
+            // Clamping also maps NaN coordinates into the grid.
+            double q = (points_[i](d) - min_bound(d)) * scale;
+            q = q >= 0 ? std::min(q, grid_max) : 0;
+            code |= MortonSplitBy3(uint64_t(q)) << d;
+        }
+        codes[i] = code;
+    }
+
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&codes](size_t a, size_t b) {
+        return codes[a] < codes[b];
+    });
+
+    ApplyPermutation(points_, order);
+    if (HasNormals()) ApplyPermutation(normals_, order);
+    if (HasColors()) ApplyPermutation(colors_, order);
+    return *this;
+}
+
 std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
         const std::vector<size_t> &indices, bool invert /* = false */) const {
     auto output = std::make_shared<PointCloud>();
@@ -209,17 +291,18 @@ public:
           color_(0.0, 0.0, 0.0) {}
 
 public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
+    template <typename PointCloudType>
+    void AddPoint(const PointCloudType &cloud, int index) {
+        point_ += cloud.points_[index].template cast<double>();
         if (cloud.HasNormals()) {
             if (!std::isnan(cloud.normals_[index](0)) &&
                 !std::isnan(cloud.normals_[index](1)) &&
                 !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
+                normal_ += cloud.normals_[index].template cast<double>();
             }
         }
         if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
+            color_ += cloud.colors_[index].template cast<double>();
         }
         num_of_points_++;
     }
@@ -301,50 +384,112 @@ private:
     std::vector<point_cubic_id> original_id;
     std::unordered_map<int, int> classes;
 };
-}  // namespace
 
-std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
-        double voxel_size) const {
-    auto output = std::make_shared<PointCloud>();
+/// Points grouped by voxel. order_ lists the point indices sorted by voxel
+/// index, with the points of each voxel in increasing index order, so that
+/// averages are accumulated in the same order as a sequential pass. The
+/// points of voxel v are order_[splits_[v]] to order_[splits_[v + 1] - 1].
+class VoxelGroups {
+public:
+    template <typename PointType>
+    VoxelGroups(const std::vector<PointType> &points,
+                const Eigen::Vector3d &voxel_min_bound,
+                double voxel_size) {
+        const int64_t num_points = int64_t(points.size());
+        std::vector<Eigen::Vector3i> voxel_indices(num_points);
+        utility::ParallelFor(0, num_points, [&](int64_t i) {
+            Eigen::Vector3d ref_coord =
+                    (points[i].template cast<double>() - voxel_min_bound) /
+                    voxel_size;
+            voxel_indices[i] << int(floor(ref_coord(0))),
+                    int(floor(ref_coord(1))), int(floor(ref_coord(2)));
+        });
+
+        order_.resize(num_points);
+        std::iota(order_.begin(), order_.end(), 0);
+        tbb::parallel_sort(order_.begin(), order_.end(),
+                           [&voxel_indices](size_t a, size_t b) {
+                               const Eigen::Vector3i &va = voxel_indices[a];
+                               const Eigen::Vector3i &vb = voxel_indices[b];
+                               for (int d = 0; d < 3; d++) {
+                                   if (va(d) != vb(d)) return va(d) < vb(d);
+                               }
+                               return a < b;
+                           });
+
+        for (int64_t i = 0; i < num_points; i++) {
+            if (i == 0 ||
+                voxel_indices[order_[i]] != voxel_indices[order_[i - 1]]) {
+                splits_.push_back(i);
+            }
+        }
+        splits_.push_back(num_points);
+    }
+
+    int64_t NumVoxels() const { return int64_t(splits_.size()) - 1; }
+
+public:
+    std::vector<size_t> order_;
+    std::vector<size_t> splits_;
+};
+
+
+/// Shared by PointCloud::VoxelDownSample and PointCloudFloat::VoxelDownSample.
+template <typename PointCloudType>
+std::shared_ptr<PointCloudType> VoxelDownSampleImpl(
+        const PointCloudType &cloud, double voxel_size) {
+    typedef typename std::decay<decltype(cloud.points_[0])>::type PointType;
+    typedef typename PointType::Scalar Scalar;
+    auto output = std::make_shared<PointCloudType>();
     if (voxel_size <= 0.0) {
         utility::LogError("[VoxelDownSample] voxel_size <= 0.");
     }
     Eigen::Vector3d voxel_size3 =
             Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
-    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
-    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_min_bound = cloud.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = cloud.GetMaxBound() + voxel_size3 * 0.5;
     if (voxel_size * std::numeric_limits<int>::max() <
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    // Points are grouped by sorting on their voxel index, and each voxel is
+    // then averaged independently.
+    VoxelGroups groups(cloud.points_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = groups.NumVoxels();
+    bool has_normals = cloud.HasNormals();
+    bool has_colors = cloud.HasColors();
+    output->points_.resize(num_voxels);
+    if (has_normals) output->normals_.resize(num_voxels);
+    if (has_colors) output->colors_.resize(num_voxels);
+    utility::ParallelFor(0, num_voxels, [&](int64_t v) {
+        AccumulatedPoint accpoint;
+        for (size_t i = groups.splits_[v]; i < groups.splits_[v + 1]; i++) {
+            accpoint.AddPoint(cloud, int(groups.order_[i]));
+        }
+        output->points_[v] = accpoint.GetAveragePoint().cast<Scalar>();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal().cast<Scalar>();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[v] = accpoint.GetAverageColor().cast<Scalar>();
         }
-    }
+    });
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
-            (int)points_.size(), (int)output->points_.size());
+            (int)cloud.points_.size(), (int)output->points_.size());
     return output;
 }
+}  // namespace
+
+std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
+        double voxel_size) const {
+    return VoxelDownSampleImpl(*this, voxel_size);
+}
+
+std::shared_ptr<PointCloudFloat> PointCloudFloat::VoxelDownSample(
+        double voxel_size) const {
+    return VoxelDownSampleImpl(*this, voxel_size);
+}
 
 std::tuple<std::shared_ptr<PointCloud>,
            Eigen::MatrixXi,
@@ -366,52 +511,46 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    VoxelGroups groups(points_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = groups.NumVoxels();
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    output->points_.resize(num_voxels);
+    if (has_normals) output->normals_.resize(num_voxels);
+    if (has_colors) output->colors_.resize(num_voxels);
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    int cid_temp[3] = {1, 2, 4};
+    utility::ParallelFor(0, num_voxels, [&](int64_t v) {
+        AccumulatedPointForTrace accpoint;
+        for (size_t i = groups.splits_[v]; i < groups.splits_[v + 1]; i++) {
+            size_t pid = groups.order_[i];
+            auto ref_coord = (points_[pid] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - floor(ref_coord(c))) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            accpoint.AddPoint(*this, pid, cid, approximate_class);
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                output->colors_[v] = accpoint.GetMaxClass();
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[v] = accpoint.GetAverageColor();
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+        for (const point_cubic_id &id : accpoint.GetOriginalID()) {
+            cubic_id(v, id.cubic_id) = int(id.point_id);
+            original_indices[v].push_back(int(id.point_id));
         }
-        cnt++;
-    }
+    });
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
@@ -472,17 +611,17 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
                 "[RemoveRadiusOutliers] Illegal input parameters,"
                 "number of points and radius must be positive");
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(points_.size()); i++) {
+    auto kdtree_ptr = GetKDTree();
+    const KDTreeFlann &kdtree = *kdtree_ptr;
+    // std::vector<bool> packs bits, which cannot be written concurrently.
+    std::vector<char> mask(points_.size(), 0);
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t i) {
         std::vector<int> tmp_indices;
         std::vector<double> dist;
         size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
                                                   tmp_indices, dist);
         mask[i] = (nb_neighbors > nb_points);
-    }
+    });
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
         if (mask[i]) {
@@ -504,14 +643,13 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
+    auto kdtree_ptr = GetKDTree();
+    const KDTreeFlann &kdtree = *kdtree_ptr;
     std::vector<double> avg_distances = std::vector<double>(points_.size());
     std::vector<size_t> indices;
-    size_t valid_distances = 0;
+    std::atomic<size_t> valid_distances(0);
 
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(points_.size()); i++) {
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t i) {
         std::vector<int> tmp_indices;
         std::vector<double> dist;
         kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
@@ -523,7 +661,7 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
             mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
         }
         avg_distances[i] = mean;
-    }
+    });
     if (valid_distances == 0) {
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
@@ -566,11 +704,10 @@ std::vector<double> PointCloud::ComputeMahalanobisDistance() const {
     Eigen::Matrix3d covariance;
     std::tie(mean, covariance) = ComputeMeanAndCovariance();
     Eigen::Matrix3d cov_inv = covariance.inverse();
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t i) {
         Eigen::Vector3d p = points_[i] - mean;
         mahalanobis[i] = std::sqrt(p.transpose() * cov_inv * p);
-    }
+    });
     return mahalanobis;
 }
 
@@ -580,9 +717,9 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
     }
 
     std::vector<double> nn_dis(points_.size());
-    KDTreeFlann kdtree(*this);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    auto kdtree_ptr = GetKDTree();
+    const KDTreeFlann &kdtree = *kdtree_ptr;
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t i) {
         std::vector<int> indices(2);
         std::vector<double> dists(2);
         if (kdtree.SearchKNN(points_[i], 2, indices, dists) <= 1) {
@@ -593,7 +730,7 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
         } else {
             nn_dis[i] = std::sqrt(dists[1]);
         }
-    }
+    });
     return nn_dis;
 }
 
@@ -611,17 +748,17 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
     }
 
     // perform spherical projection
-    std::vector<Eigen::Vector3d> spherical_projection;
-    for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
+    std::vector<Eigen::Vector3d> spherical_projection(points_.size() + 1);
+    utility::ParallelFor(0, (int64_t)points_.size(), [&](int64_t pidx) {
         Eigen::Vector3d projected_point = points_[pidx] - camera_location;
         double norm = projected_point.norm();
-        spherical_projection.push_back(
-                projected_point + 2 * (radius - norm) * projected_point / norm);
-    }
+        spherical_projection[pidx] =
+                projected_point + 2 * (radius - norm) * projected_point / norm;
+    });
 
     // add origin
-    size_t origin_pidx = spherical_projection.size();
-    spherical_projection.push_back(Eigen::Vector3d(0, 0, 0));
+    size_t origin_pidx = points_.size();
+    spherical_projection[origin_pidx] = Eigen::Vector3d(0, 0, 0);
 
     // calculate convex hull of spherical projection
     std::shared_ptr<TriangleMesh> visible_mesh;
@@ -630,37 +767,34 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
             Qhull::ComputeConvexHull(spherical_projection);
 
     // reassign original points to mesh
-    size_t origin_vidx = pt_map.size();
+    int origin_vidx = -1;
     for (size_t vidx = 0; vidx < pt_map.size(); vidx++) {
         size_t pidx = pt_map[vidx];
         if (pidx != origin_pidx) {
             visible_mesh->vertices_[vidx] = points_[pidx];
         } else {
-            origin_vidx = vidx;
-            visible_mesh->vertices_[vidx] = camera_location;
+            origin_vidx = int(vidx);
         }
     }
 
-    // erase origin if part of mesh
-    if (origin_vidx < visible_mesh->vertices_.size()) {
+    // erase origin and its triangles if part of mesh
+    if (origin_vidx >= 0) {
         visible_mesh->vertices_.erase(visible_mesh->vertices_.begin() +
                                       origin_vidx);
         pt_map.erase(pt_map.begin() + origin_vidx);
-        for (size_t tidx = visible_mesh->triangles_.size(); tidx-- > 0;) {
-            if (visible_mesh->triangles_[tidx](0) == (int)origin_vidx ||
-                visible_mesh->triangles_[tidx](1) == (int)origin_vidx ||
-                visible_mesh->triangles_[tidx](2) == (int)origin_vidx) {
-                visible_mesh->triangles_.erase(
-                        visible_mesh->triangles_.begin() + tidx);
-            } else {
-                if (visible_mesh->triangles_[tidx](0) > (int)origin_vidx)
-                    visible_mesh->triangles_[tidx](0) -= 1;
-                if (visible_mesh->triangles_[tidx](1) > (int)origin_vidx)
-                    visible_mesh->triangles_[tidx](1) -= 1;
-                if (visible_mesh->triangles_[tidx](2) > (int)origin_vidx)
-                    visible_mesh->triangles_[tidx](2) -= 1;
+        auto &triangles = visible_mesh->triangles_;
+        size_t num_kept = 0;
+        for (const Eigen::Vector3i &triangle : triangles) {
+            if (triangle(0) == origin_vidx || triangle(1) == origin_vidx ||
+                triangle(2) == origin_vidx) {
+                continue;
+            }
+            Eigen::Vector3i &kept = triangles[num_kept++];
+            for (int i = 0; i < 3; ++i) {
+                kept(i) = triangle(i) - (triangle(i) > origin_vidx ? 1 : 0);
             }
         }
+        triangles.resize(num_kept);
     }
     return std::make_tuple(visible_mesh, pt_map);
 }
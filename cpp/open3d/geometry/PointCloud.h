@@ -43,6 +43,7 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class KDTreeFlann;
 class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
@@ -51,6 +52,9 @@ class VoxelGrid;
 ///
 /// \brief A point cloud consists of point coordinates, and optionally point
 /// colors and point normals.
+///
+/// Attributes are stored in double precision. See PointCloudFloat for single
+/// precision storage.
 class PointCloud : public Geometry3D {
 public:
     /// \brief Default Constructor.
@@ -120,6 +124,13 @@ public:
     PointCloud &RemoveNonFinitePoints(bool remove_nan = true,
                                       bool remove_infinite = true);
 
+    /// \brief Reorders the points along a Z-order (Morton) curve.
+    ///
+    /// Points that are close in space end up close in memory, which improves
+    /// cache locality of neighbor searches and voxel operations. Normals and
+    /// colors are reordered consistently.
+    PointCloud &SortByMortonCode();
+
     /// \brief Function to select points from \p input pointcloud into
     /// \p output pointcloud.
     ///
@@ -242,6 +253,11 @@ public:
     /// propagation.
     void OrientNormalsConsistentTangentPlane(size_t k);
 
+    /// \brief Returns a KDTreeFlann over the points.
+    ///
+    /// The tree is built on first use and cached until the points change.
+    std::shared_ptr<const KDTreeFlann> GetKDTree() const;
+
     /// \brief Function to compute the point to point distances between point
     /// clouds.
     ///
@@ -304,13 +320,42 @@ public:
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// The iterations stop early once a plane at least as good as the best one
+    /// so far has been sampled with this probability.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment up to \p max_num_planes planes in the PointCloud with
+    /// the RANSAC algorithm.
+    ///
+    /// The planes are extracted one after the other, each one among the points
+    /// that are not inliers of the previous ones.
+    ///
+    /// \param max_num_planes Maximum number of planes.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param min_num_inliers The extraction stops at the first plane with
+    /// fewer inliers.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Returns the plane models ax + by + cz + d = 0 and the indices of
+    /// their inliers, in the order of extraction.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> SegmentPlanes(
+            const int max_num_planes,
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const size_t min_num_inliers = 3,
+            const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
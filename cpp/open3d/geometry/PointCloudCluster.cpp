@@ -24,89 +24,198 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/ConcurrentDisjointSets.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
-
-    // Precompute all neighbors.
-    utility::LogDebug("Precompute neighbors.");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute neighbors.", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
-
-#pragma omp critical
-        { ++progress_bar; }
-    }
-    utility::LogDebug("Done Precompute neighbors.");
-
-    // Set all labels to undefined (-2).
-    utility::LogDebug("Compute Clusters");
-    progress_bar.Reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        // Label is not undefined.
-        if (labels[idx] != -2) {
-            continue;
-        }
+namespace {
 
-        // Check density.
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
-        }
+typedef Eigen::Matrix<int64_t, 3, 1> Cell;
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            // Noise label.
-            if (labels[nb] == -1) {
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            // Not undefined label.
-            if (labels[nb] != -2) {
-                continue;
+/// Uniform grid with cells of size eps. The eps-neighborhood of a point lies
+/// in the 27 cells around it, so it can be enumerated without a KDTree and
+/// without storing it.
+class DBSCANGrid {
+public:
+    DBSCANGrid(const std::vector<Eigen::Vector3d> &points,
+               const Eigen::Vector3d &min_bound,
+               double eps)
+        : points_(points),
+          // Same threshold as KDTreeFlann::SearchRadius.
+          eps2_(float(eps * eps)),
+          cells_(points.size()),
+          order_(points.size()) {
+        utility::ParallelFor(0, int64_t(points.size()), [&](int64_t idx) {
+            cells_[idx] = ((points[idx] - min_bound) / eps)
+                                  .array()
+                                  .floor()
+                                  .matrix()
+                                  .cast<int64_t>();
+        });
+        for (size_t idx = 0; idx < points.size(); ++idx) {
+            order_[idx] = int(idx);
+        }
+        tbb::parallel_sort(order_.begin(), order_.end(), [&](int a, int b) {
+            const Cell &ca = cells_[a];
+            const Cell &cb = cells_[b];
+            return std::lexicographical_compare(ca.data(), ca.data() + 3,
+                                                cb.data(),
+                                                cb.data() + 3) ||
+                   (ca == cb && a < b);
+        });
+        size_t begin = 0;
+        for (size_t i = 1; i <= order_.size(); ++i) {
+            if (i == order_.size() ||
+                cells_[order_[i]] != cells_[order_[begin]]) {
+                ranges_[cells_[order_[begin]]] = std::make_pair(begin, i);
+                begin = i;
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+        }
+    }
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+    /// Calls f(nb) for every point nb within eps of point idx, including
+    /// idx itself.
+    template <typename func_t>
+    void ForEachNeighbor(int idx, const func_t &f) const {
+        const Eigen::Vector3d &p = points_[idx];
+        const Cell &c = cells_[idx];
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    auto it = ranges_.find(c + Cell(dx, dy, dz));
+                    if (it == ranges_.end()) {
+                        continue;
+                    }
+                    for (size_t i = it->second.first; i < it->second.second;
+                         ++i) {
+                        int nb = order_[i];
+                        if ((points_[nb] - p).squaredNorm() < eps2_) {
+                            f(nb);
+                        }
                     }
                 }
             }
         }
+    }
+
+private:
+    const std::vector<Eigen::Vector3d> &points_;
+    double eps2_;
+    std::vector<Cell> cells_;
+    /// Point indices sorted by cell.
+    std::vector<int> order_;
+    /// Range of each non-empty cell in order_.
+    std::unordered_map<Cell,
+                       std::pair<size_t, size_t>,
+                       utility::hash_eigen<Cell>>
+            ranges_;
+};
+
+}  // namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(double eps,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    if (eps <= 0) {
+        utility::LogError("[ClusterDBSCAN] eps must be positive, but got {}.",
+                          eps);
+    }
+    if (points_.size() > size_t(std::numeric_limits<int>::max())) {
+        utility::LogError("[ClusterDBSCAN] Too many points: {}.",
+                          points_.size());
+    }
+    const int64_t num_points = int64_t(points_.size());
+    DBSCANGrid grid(points_, GetMinBound(), eps);
+
+    utility::ConsoleProgressBar progress_bar(num_points * 4, "Clustering",
+                                             print_progress);
+    std::mutex progress_mutex;
+    size_t progress = 0;
+    auto parallel_for = [&](const std::function<void(int)> &f) {
+        utility::ParallelForRange(
+                0, num_points, 1024, [&](int64_t begin, int64_t end) {
+                    for (int64_t idx = begin; idx < end; ++idx) {
+                        f(int(idx));
+                    }
+                    std::lock_guard<std::mutex> lock(progress_mutex);
+                    progress += size_t(end - begin);
+                    progress_bar.SetCurrentCount(progress);
+                });
+    };
+
+    // Core points have at least min_points neighbors, including themselves.
+    // Only the counts are kept, so memory stays linear in the point count.
+    utility::LogDebug("Count neighbors.");
+    std::vector<char> is_core_flags(num_points, 0);
+    parallel_for([&](int idx) {
+        size_t num_neighbors = 0;
+        grid.ForEachNeighbor(idx, [&](int) { ++num_neighbors; });
+        is_core_flags[idx] = num_neighbors >= min_points;
+    });
+
+    // Clusters are the connected components of core points within eps.
+    utility::LogDebug("Connect core points.");
+    ConcurrentDisjointSets sets(num_points);
+    parallel_for([&](int idx) {
+        if (!is_core_flags[idx]) {
+            return;
+        }
+        grid.ForEachNeighbor(idx, [&](int nb) {
+            if (nb < idx && is_core_flags[nb]) {
+                sets.Union(idx, nb);
+            }
+        });
+    });
 
-        cluster_label++;
+    // Number the clusters by their smallest core point, i.e. in the order in
+    // which the serial algorithm discovers them.
+    std::vector<int> labels(num_points, -1);
+    int num_clusters = 0;
+    for (int idx = 0; idx < int(num_points); ++idx) {
+        if (is_core_flags[idx] && sets.Find(idx) == idx) {
+            labels[idx] = num_clusters++;
+        }
     }
 
-    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    // Border points join the first cluster that reaches them in the serial
+    // algorithm, which is the one with the smallest label.
+    utility::LogDebug("Label points.");
+    std::vector<int> core_labels(num_points, -1);
+    parallel_for([&](int idx) {
+        if (is_core_flags[idx]) {
+            core_labels[idx] = labels[sets.Find(idx)];
+        }
+    });
+    parallel_for([&](int idx) {
+        if (is_core_flags[idx]) {
+            labels[idx] = core_labels[idx];
+            return;
+        }
+        int label = -1;
+        grid.ForEachNeighbor(idx, [&](int nb) {
+            if (is_core_flags[nb] && (label == -1 || core_labels[nb] < label)) {
+                label = core_labels[nb];
+            }
+        });
+        labels[idx] = label;
+    });
+
+    utility::LogDebug("Done Compute Clusters: {:d}", num_clusters);
     return labels;
 }
 
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/geometry/PointCloudFloat.h"
+
+#include "open3d/geometry/PointCloud.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+std::vector<Eigen::Vector3f> ToFloat(
+        const std::vector<Eigen::Vector3d> &vectors) {
+    std::vector<Eigen::Vector3f> out(vectors.size());
+    for (size_t i = 0; i < vectors.size(); i++) {
+        out[i] = vectors[i].cast<float>();
+    }
+    return out;
+}
+
+std::vector<Eigen::Vector3d> ToDouble(
+        const std::vector<Eigen::Vector3f> &vectors) {
+    std::vector<Eigen::Vector3d> out(vectors.size());
+    for (size_t i = 0; i < vectors.size(); i++) {
+        out[i] = vectors[i].cast<double>();
+    }
+    return out;
+}
+}  // namespace
+
+PointCloudFloat::PointCloudFloat(const PointCloud &cloud)
+    : points_(ToFloat(cloud.points_)),
+      normals_(ToFloat(cloud.normals_)),
+      colors_(ToFloat(cloud.colors_)) {}
+
+PointCloudFloat &PointCloudFloat::Clear() {
+    points_.clear();
+    normals_.clear();
+    colors_.clear();
+    return *this;
+}
+
+Eigen::Vector3d PointCloudFloat::GetMinBound() const {
+    if (points_.empty()) {
+        return Eigen::Vector3d(0.0, 0.0, 0.0);
+    }
+    Eigen::Vector3f min_bound = points_[0];
+    for (const auto &point : points_) {
+        min_bound = min_bound.cwiseMin(point);
+    }
+    return min_bound.cast<double>();
+}
+
+Eigen::Vector3d PointCloudFloat::GetMaxBound() const {
+    if (points_.empty()) {
+        return Eigen::Vector3d(0.0, 0.0, 0.0);
+    }
+    Eigen::Vector3f max_bound = points_[0];
+    for (const auto &point : points_) {
+        max_bound = max_bound.cwiseMax(point);
+    }
+    return max_bound.cast<double>();
+}
+
+PointCloudFloat &PointCloudFloat::Transform(
+        const Eigen::Matrix4d &transformation) {
+    for (auto &point : points_) {
+        Eigen::Vector4d new_point =
+                transformation *
+                Eigen::Vector4d(point(0), point(1), point(2), 1.0);
+        point = (new_point.head<3>() / new_point(3)).cast<float>();
+    }
+    for (auto &normal : normals_) {
+        Eigen::Vector4d new_normal =
+                transformation *
+                Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0);
+        normal = new_normal.head<3>().cast<float>();
+    }
+    return *this;
+}
+
+PointCloud PointCloudFloat::ToPointCloud() const {
+    PointCloud cloud(ToDouble(points_));
+    cloud.normals_ = ToDouble(normals_);
+    cloud.colors_ = ToDouble(colors_);
+    return cloud;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class PointCloudFloat
+///
+/// \brief A point cloud that stores its attributes in single precision.
+///
+/// Holds the same attributes as PointCloud with half of the memory footprint,
+/// which matters for large scans where the algorithms are bound by memory
+/// bandwidth. Supports normal estimation, voxel downsampling and
+/// pipelines::registration::RegistrationICP. Intermediate sums are
+/// accumulated in double precision. Use ToPointCloud() for the other
+/// algorithms.
+class PointCloudFloat {
+public:
+    /// \brief Default Constructor.
+    PointCloudFloat() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param points Points coordinates.
+    explicit PointCloudFloat(const std::vector<Eigen::Vector3f> &points)
+        : points_(points) {}
+    /// \brief Converts a double precision point cloud.
+    ///
+    /// \param cloud Point cloud whose points, normals and colors are copied.
+    explicit PointCloudFloat(const PointCloud &cloud);
+
+public:
+    PointCloudFloat &Clear();
+    bool IsEmpty() const { return !HasPoints(); }
+    Eigen::Vector3d GetMinBound() const;
+    Eigen::Vector3d GetMaxBound() const;
+    PointCloudFloat &Transform(const Eigen::Matrix4d &transformation);
+
+    /// Returns 'true' if the point cloud contains points.
+    bool HasPoints() const { return points_.size() > 0; }
+
+    /// Returns `true` if the point cloud contains point normals.
+    bool HasNormals() const {
+        return points_.size() > 0 && normals_.size() == points_.size();
+    }
+
+    /// Returns `true` if the point cloud contains point colors.
+    bool HasColors() const {
+        return points_.size() > 0 && colors_.size() == points_.size();
+    }
+
+    /// Returns a double precision copy of the point cloud.
+    PointCloud ToPointCloud() const;
+
+    /// \brief Downsamples the point cloud with a voxel, see
+    /// PointCloud::VoxelDownSample.
+    ///
+    /// \param voxel_size Voxel size to downsample into.
+    std::shared_ptr<PointCloudFloat> VoxelDownSample(double voxel_size) const;
+
+    /// \brief Computes the normals of the points, see
+    /// PointCloud::EstimateNormals.
+    ///
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    /// \param fast_normal_computation If true, the normal estimation uses a
+    /// non-iterative method to extract the eigenvector from the covariance
+    /// matrix.
+    void EstimateNormals(
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
+            bool fast_normal_computation = true);
+
+public:
+    /// Points coordinates.
+    std::vector<Eigen::Vector3f> points_;
+    /// Points normals.
+    std::vector<Eigen::Vector3f> normals_;
+    /// RGB colors of points.
+    std::vector<Eigen::Vector3f> colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
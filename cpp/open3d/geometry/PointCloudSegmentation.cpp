@@ -26,6 +26,7 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <numeric>
 #include <random>
@@ -34,6 +35,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -51,37 +53,69 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
-    RANSACResult result;
+// Number of plane models that are scored together in one pass over the
+// points.
+static const int kRANSACBatchSize = 32;
+// Number of points per parallel work item when scoring plane models.
+static const int64_t kRANSACBlockSize = 4096;
 
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
+// Calculates, for each of a batch of plane models, the number of inliers among
+// a list of points and the total distance between the inliers and the plane.
+// These numbers are then used to evaluate how well the plane models fit the
+// given points. The points are traversed once for the whole batch, and the
+// partial sums of each block of points are reduced in a fixed order so that
+// the results do not depend on the scheduling.
+std::vector<RANSACResult> EvaluateRANSACBatchBasedOnDistance(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<Eigen::Vector4d> &plane_models,
+        double distance_threshold) {
+    const size_t num_models = plane_models.size();
+    std::vector<double> a(num_models), b(num_models), c(num_models),
+            d(num_models);
+    for (size_t m = 0; m < num_models; ++m) {
+        a[m] = plane_models[m](0);
+        b[m] = plane_models[m](1);
+        c[m] = plane_models[m](2);
+        d[m] = plane_models[m](3);
+    }
 
-        if (distance < distance_threshold) {
-            error += distance;
-            inliers.emplace_back(idx);
+    const int64_t num_points = int64_t(points.size());
+    const int64_t num_blocks =
+            (num_points + kRANSACBlockSize - 1) / kRANSACBlockSize;
+    std::vector<size_t> block_counts(num_blocks * num_models, 0);
+    std::vector<double> block_errors(num_blocks * num_models, 0);
+    utility::ParallelFor(0, num_blocks, [&](int64_t block) {
+        size_t *counts = block_counts.data() + block * num_models;
+        double *errors = block_errors.data() + block * num_models;
+        const int64_t end =
+                std::min(num_points, (block + 1) * kRANSACBlockSize);
+        for (int64_t idx = block * kRANSACBlockSize; idx < end; ++idx) {
+            const double x = points[idx](0), y = points[idx](1),
+                         z = points[idx](2);
+            for (size_t m = 0; m < num_models; ++m) {
+                double distance = std::abs(a[m] * x + b[m] * y + c[m] * z +
+                                           d[m]);
+                bool is_inlier = distance < distance_threshold;
+                counts[m] += is_inlier;
+                errors[m] += is_inlier ? distance : 0;
+            }
         }
-    }
+    });
 
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
-        result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
+    std::vector<RANSACResult> results(num_models);
+    for (size_t m = 0; m < num_models; ++m) {
+        size_t inlier_num = 0;
+        double error = 0;
+        for (int64_t block = 0; block < num_blocks; ++block) {
+            inlier_num += block_counts[block * num_models + m];
+            error += block_errors[block * num_models + m];
+        }
+        if (inlier_num > 0) {
+            results[m].fitness_ = (double)inlier_num / (double)points.size();
+            results[m].inlier_rmse_ = error / std::sqrt((double)inlier_num);
+        }
     }
-    return result;
+    return results;
 }
 
 // Find the plane such that the summed squared distance from the
@@ -132,72 +166,71 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
+// Runs RANSAC on the given points, and returns the refined plane model and
+// the indices of its inliers. Hypotheses are sampled in the same order as one
+// at a time, but scored in batches. The number of iterations shrinks with the
+// fitness of the best model so far, such that a model at least as good is
+// found with the given probability.
+static std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        std::mt19937 &rng) {
     RANSACResult result;
-    double error = 0;
 
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
     // Initialize the best plane model.
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
-
-    size_t num_points = points_.size();
+    size_t num_points = points.size();
     std::vector<size_t> indices(num_points);
     std::iota(std::begin(indices), std::end(indices), 0);
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
-
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
-
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+    double break_iteration = num_iterations;
+    int itr = 0;
+    std::vector<Eigen::Vector4d> plane_models;
+    while (itr < break_iteration) {
+        int batch_end = std::min(itr + kRANSACBatchSize,
+                                 int(std::ceil(break_iteration)));
+        plane_models.clear();
+        for (; itr < batch_end; ++itr) {
+            for (int i = 0; i < ransac_n; ++i) {
+                std::swap(indices[i], indices[rng() % num_points]);
+            }
+            // Fit model to num_model_parameters randomly selected points
+            // among the inliers.
+            Eigen::Vector4d plane_model = TriangleMesh::ComputeTrianglePlane(
+                    points[indices[0]], points[indices[1]],
+                    points[indices[2]]);
+            if (!plane_model.isZero(0)) {
+                plane_models.push_back(plane_model);
+            }
         }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+        std::vector<RANSACResult> batch_results =
+                EvaluateRANSACBatchBasedOnDistance(points, plane_models,
+                                                   distance_threshold);
+        for (size_t m = 0; m < plane_models.size(); ++m) {
+            const RANSACResult &this_result = batch_results[m];
+            if (this_result.fitness_ > result.fitness_ ||
+                (this_result.fitness_ == result.fitness_ &&
+                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = this_result;
+                best_plane_model = plane_models[m];
+                break_iteration = std::min(
+                        std::log(1 - probability) /
+                                std::log(1 - std::pow(result.fitness_,
+                                                      ransac_n)),
+                        double(num_iterations));
+            }
         }
     }
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
+    std::vector<size_t> inliers;
+    for (size_t idx = 0; idx < points.size(); ++idx) {
+        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(best_plane_model.dot(point));
 
@@ -207,12 +240,92 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
+    utility::LogDebug(
+            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iteration: "
+            "{:d}",
+            inliers.size(), result.fitness_, result.inlier_rmse_, itr);
     return std::make_tuple(best_plane_model, inliers);
 }
 
+static void CheckRANSACParameters(const int ransac_n,
+                                  const double probability) {
+    // Return if ransac_n is less than the required plane model parameters.
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be > 0 and <= 1.0.");
+    }
+}
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, probability);
+    if (points_.size() < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return SegmentPlaneRANSAC(points_, distance_threshold, ransac_n,
+                              num_iterations, probability, rng);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const int max_num_planes,
+                          const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const size_t min_num_inliers /* = 3 */,
+                          const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, probability);
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+
+    // Each plane is searched among the points left by the previous ones,
+    // which are kept contiguous for the scoring passes.
+    std::vector<Eigen::Vector3d> remaining_points = points_;
+    std::vector<size_t> remaining_indices(points_.size());
+    std::iota(remaining_indices.begin(), remaining_indices.end(), 0);
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    while (int(planes.size()) < max_num_planes &&
+           remaining_points.size() >= size_t(ransac_n)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) =
+                SegmentPlaneRANSAC(remaining_points, distance_threshold,
+                                   ransac_n, num_iterations, probability, rng);
+        if (plane_model.isZero(0) || inliers.size() < min_num_inliers) {
+            break;
+        }
+
+        std::vector<bool> is_inlier(remaining_points.size(), false);
+        for (size_t &idx : inliers) {
+            is_inlier[idx] = true;
+            idx = remaining_indices[idx];
+        }
+        size_t num_remaining = 0;
+        for (size_t idx = 0; idx < remaining_points.size(); ++idx) {
+            if (!is_inlier[idx]) {
+                remaining_points[num_remaining] = remaining_points[idx];
+                remaining_indices[num_remaining] = remaining_indices[idx];
+                ++num_remaining;
+            }
+        }
+        remaining_points.resize(num_remaining);
+        remaining_indices.resize(num_remaining);
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
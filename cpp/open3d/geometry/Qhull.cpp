@@ -26,7 +26,10 @@
 
 #include "open3d/geometry/Qhull.h"
 
-#include "libqhullcpp/PointCoordinates.h"
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
 #include "libqhullcpp/Qhull.h"
 #include "libqhullcpp/QhullFacet.h"
 #include "libqhullcpp/QhullFacetList.h"
@@ -34,34 +37,31 @@
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
+// Eigen::Vector3d is unaligned and unpadded, so a vector of points can be
+// handed to Qhull as packed xyz coordinates without copying.
+static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+              "Eigen::Vector3d must be packed.");
+
+/// Runs Qhull on \p num_points packed xyz \p coordinates. The point ids of
+/// the hull vertices are mapped through \p point_ids if it is not empty.
+static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+RunConvexHull(const double* coordinates,
+              size_t num_points,
+              const std::vector<size_t>& point_ids) {
     auto convex_hull = std::make_shared<TriangleMesh>();
     std::vector<size_t> pt_map;
 
-    std::vector<double> qhull_points_data(points.size() * 3);
-    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
-        const auto& pt = points[pidx];
-        qhull_points_data[pidx * 3 + 0] = pt(0);
-        qhull_points_data[pidx * 3 + 1] = pt(1);
-        qhull_points_data[pidx * 3 + 2] = pt(2);
-    }
-
-    orgQhull::PointCoordinates qhull_points(3, "");
-    qhull_points.append(qhull_points_data);
-
     orgQhull::Qhull qhull;
-    qhull.runQhull(qhull_points.comment().c_str(), qhull_points.dimension(),
-                   qhull_points.count(), qhull_points.coordinates(), "Qt");
+    qhull.runQhull("", 3, int(num_points), coordinates, "Qt");
 
     orgQhull::QhullFacetList facets = qhull.facetList();
     convex_hull->triangles_.resize(facets.count());
-    std::unordered_map<int, int> vert_map;
-    std::unordered_set<int> inserted_vertices;
+    std::vector<int> vert_map(num_points, -1);
     int tidx = 0;
     for (orgQhull::QhullFacetList::iterator it = facets.begin();
          it != facets.end(); ++it) {
@@ -76,29 +76,170 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
             orgQhull::QhullPoint p = v.point();
 
             int vidx = p.id();
-            convex_hull->triangles_[tidx](triangle_subscript) = vidx;
-            triangle_subscript++;
-
-            if (inserted_vertices.count(vidx) == 0) {
-                inserted_vertices.insert(vidx);
+            if (vert_map[vidx] < 0) {
                 vert_map[vidx] = int(convex_hull->vertices_.size());
                 double* coords = p.coordinates();
                 convex_hull->vertices_.push_back(
                         Eigen::Vector3d(coords[0], coords[1], coords[2]));
-                pt_map.push_back(vidx);
+                pt_map.push_back(point_ids.empty() ? size_t(vidx)
+                                                   : point_ids[vidx]);
             }
+            convex_hull->triangles_[tidx](triangle_subscript) =
+                    vert_map[vidx];
+            triangle_subscript++;
         }
 
         tidx++;
     }
+    convex_hull->triangles_.resize(tidx);
 
-    for (Eigen::Vector3i& triangle : convex_hull->triangles_) {
-        triangle(0) = vert_map[triangle(0)];
-        triangle(1) = vert_map[triangle(1)];
-        triangle(2) = vert_map[triangle(2)];
+    return std::make_tuple(convex_hull, pt_map);
+}
+
+/// Akl-Toussaint heuristic: returns the indices of the points that are not
+/// strictly inside the hull of the extreme points along 26 directions, i.e.
+/// the candidate vertices of the convex hull. Returns an empty vector if no
+/// point can be discarded.
+static std::vector<size_t> CullInteriorPoints(
+        const std::vector<Eigen::Vector3d>& points) {
+    std::vector<Eigen::Vector3d> directions;
+    for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                if (dx != 0 || dy != 0 || dz != 0) {
+                    directions.emplace_back(dx, dy, dz);
+                }
+            }
+        }
     }
+    const size_t num_directions = directions.size();
 
-    return std::make_tuple(convex_hull, pt_map);
+    // Extreme points along each direction, ties broken by the lowest index.
+    std::vector<size_t> extreme(num_directions, 0);
+    std::vector<double> extreme_dot(num_directions,
+                                    -std::numeric_limits<double>::infinity());
+    std::mutex extreme_mutex;
+    utility::ParallelForRange(
+            0, int64_t(points.size()), 4096,
+            [&](int64_t begin, int64_t end) {
+                std::vector<size_t> extreme_private(num_directions, 0);
+                std::vector<double> dot_private(
+                        num_directions,
+                        -std::numeric_limits<double>::infinity());
+                for (int64_t i = begin; i < end; ++i) {
+                    for (size_t d = 0; d < num_directions; ++d) {
+                        double dot = directions[d].dot(points[i]);
+                        if (dot > dot_private[d]) {
+                            dot_private[d] = dot;
+                            extreme_private[d] = size_t(i);
+                        }
+                    }
+                }
+                std::lock_guard<std::mutex> lock(extreme_mutex);
+                for (size_t d = 0; d < num_directions; ++d) {
+                    if (dot_private[d] > extreme_dot[d] ||
+                        (dot_private[d] == extreme_dot[d] &&
+                         extreme_private[d] < extreme[d])) {
+                        extreme_dot[d] = dot_private[d];
+                        extreme[d] = extreme_private[d];
+                    }
+                }
+            });
+    std::sort(extreme.begin(), extreme.end());
+    extreme.erase(std::unique(extreme.begin(), extreme.end()), extreme.end());
+    if (extreme.size() < 4) {
+        return {};
+    }
+
+    std::vector<Eigen::Vector3d> extreme_points;
+    for (size_t pidx : extreme) {
+        extreme_points.push_back(points[pidx]);
+    }
+    std::shared_ptr<TriangleMesh> polytope;
+    try {
+        std::tie(polytope, std::ignore) =
+                RunConvexHull(extreme_points[0].data(), extreme_points.size(),
+                              std::vector<size_t>());
+    } catch (const std::exception&) {
+        // Degenerate extreme points, e.g. a planar point cloud.
+        return {};
+    }
+
+    // Outward facing planes of the polytope, oriented with its centroid.
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (const Eigen::Vector3d& vertex : polytope->vertices_) {
+        centroid += vertex;
+    }
+    centroid /= double(polytope->vertices_.size());
+    double scale = 0;
+    for (const Eigen::Vector3d& vertex : polytope->vertices_) {
+        scale = std::max(scale, (vertex - centroid).norm());
+    }
+    const double margin = 1e-9 * scale;
+    std::vector<Eigen::Vector4d> planes;
+    for (const Eigen::Vector3i& triangle : polytope->triangles_) {
+        const Eigen::Vector3d& a = polytope->vertices_[triangle(0)];
+        const Eigen::Vector3d& b = polytope->vertices_[triangle(1)];
+        const Eigen::Vector3d& c = polytope->vertices_[triangle(2)];
+        Eigen::Vector3d normal = (b - a).cross(c - a);
+        double norm = normal.norm();
+        if (norm == 0) {
+            return {};
+        }
+        normal /= norm;
+        if (normal.dot(centroid - a) > 0) {
+            normal = -normal;
+        }
+        planes.emplace_back(normal(0), normal(1), normal(2), -normal.dot(a));
+    }
+
+    std::vector<uint8_t> keep(points.size());
+    utility::ParallelFor(
+            0, int64_t(points.size()),
+            [&](int64_t i) {
+                const Eigen::Vector4d point(points[i](0), points[i](1),
+                                            points[i](2), 1);
+                bool inside = true;
+                for (const Eigen::Vector4d& plane : planes) {
+                    if (plane.dot(point) >= -margin) {
+                        inside = false;
+                        break;
+                    }
+                }
+                keep[i] = !inside;
+            },
+            1024);
+    std::vector<size_t> candidates;
+    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
+        if (keep[pidx]) {
+            candidates.push_back(pidx);
+        }
+    }
+    if (candidates.size() == points.size()) {
+        return {};
+    }
+    return candidates;
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
+    // Below this size culling the interior points does not pay off.
+    constexpr size_t kMinPointsToCull = 1000;
+    std::vector<size_t> candidates;
+    if (points.size() >= kMinPointsToCull) {
+        candidates = CullInteriorPoints(points);
+    }
+    if (candidates.empty()) {
+        return RunConvexHull(points.empty() ? nullptr : points[0].data(),
+                             points.size(), candidates);
+    }
+
+    std::vector<Eigen::Vector3d> candidate_points(candidates.size());
+    utility::ParallelFor(0, int64_t(candidates.size()), [&](int64_t i) {
+        candidate_points[i] = points[candidates[i]];
+    });
+    return RunConvexHull(candidate_points[0].data(), candidate_points.size(),
+                         candidates);
 }
 
 std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
@@ -121,26 +262,12 @@ Qhull::ComputeDelaunayTetrahedralization(
         return std::make_tuple(delaunay_triangulation, pt_map);
     }
 
-    std::vector<double> qhull_points_data(points.size() * 3);
-    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
-        const auto& pt = points[pidx];
-        qhull_points_data[pidx * 3 + 0] = pt(0);
-        qhull_points_data[pidx * 3 + 1] = pt(1);
-        qhull_points_data[pidx * 3 + 2] = pt(2);
-    }
-
-    orgQhull::PointCoordinates qhull_points(3, "");
-    qhull_points.append(qhull_points_data);
-
     orgQhull::Qhull qhull;
-    qhull.runQhull(qhull_points.comment().c_str(), qhull_points.dimension(),
-                   qhull_points.count(), qhull_points.coordinates(),
-                   "d Qbb Qt");
+    qhull.runQhull("", 3, int(points.size()), points[0].data(), "d Qbb Qt");
 
     orgQhull::QhullFacetList facets = qhull.facetList();
     delaunay_triangulation->tetras_.resize(facets.count());
-    std::unordered_map<int, int> vert_map;
-    std::unordered_set<int> inserted_vertices;
+    std::vector<int> vert_map(points.size(), -1);
     int tidx = 0;
     for (orgQhull::QhullFacetList::iterator it = facets.begin();
          it != facets.end(); ++it) {
@@ -155,29 +282,21 @@ Qhull::ComputeDelaunayTetrahedralization(
             orgQhull::QhullPoint p = v.point();
 
             int vidx = p.id();
-            delaunay_triangulation->tetras_[tidx](tetra_subscript) = vidx;
-            tetra_subscript++;
-
-            if (inserted_vertices.count(vidx) == 0) {
-                inserted_vertices.insert(vidx);
+            if (vert_map[vidx] < 0) {
                 vert_map[vidx] = int(delaunay_triangulation->vertices_.size());
                 double* coords = p.coordinates();
                 delaunay_triangulation->vertices_.push_back(
                         Eigen::Vector3d(coords[0], coords[1], coords[2]));
                 pt_map.push_back(vidx);
             }
+            delaunay_triangulation->tetras_[tidx](tetra_subscript) =
+                    vert_map[vidx];
+            tetra_subscript++;
         }
 
         tidx++;
     }
 
-    for (auto& tetra : delaunay_triangulation->tetras_) {
-        tetra(0) = vert_map[tetra(0)];
-        tetra(1) = vert_map[tetra(1)];
-        tetra(2) = vert_map[tetra(2)];
-        tetra(3) = vert_map[tetra(3)];
-    }
-
     return std::make_tuple(delaunay_triangulation, pt_map);
 }
 
@@ -24,66 +24,87 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <tuple>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
-        const PointCloud& pcd,
-        double alpha,
-        std::shared_ptr<TetraMesh> tetra_mesh,
-        std::vector<size_t>* pt_map) {
-    std::vector<size_t> pt_map_computed;
-    if (tetra_mesh == nullptr) {
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] "
-                "ComputeDelaunayTetrahedralization");
-        std::tie(tetra_mesh, pt_map_computed) =
-                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
-        pt_map = &pt_map_computed;
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] done "
-                "ComputeDelaunayTetrahedralization");
-    }
+/// Delaunay tetrahedralization and the alpha interval of each of its faces.
+struct AlphaShapeFaces {
+    std::shared_ptr<TetraMesh> tetra_mesh;
+    /// Map from tetra_mesh vertex indices to points, identity if empty.
+    std::vector<size_t> pt_map;
 
-    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
-    auto mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_ = tetra_mesh->vertices_;
-    if (pcd.HasNormals()) {
-        mesh->vertex_normals_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
-        }
+    /// Face i belongs to the alpha shape iff alpha_lo[i] <= alpha <
+    /// alpha_hi[i]. The faces are sorted by alpha_lo. The position of a face
+    /// is 4 * t + k if it is the k-th face of the tetra t of circumradius
+    /// alpha_lo, and orders the triangles of the alpha shape.
+    std::vector<Eigen::Vector3i> faces;
+    std::vector<double> alpha_lo;
+    std::vector<double> alpha_hi;
+    std::vector<int64_t> positions;
+};
+
+struct AlphaShapeCache::Impl {
+    /// Points the tetrahedralization was computed for.
+    std::vector<Eigen::Vector3d> points;
+    AlphaShapeFaces faces;
+};
+
+AlphaShapeCache::AlphaShapeCache() {}
+
+AlphaShapeCache::~AlphaShapeCache() {}
+
+void AlphaShapeCache::Clear() { impl_.reset(); }
+
+bool AlphaShapeCache::IsEmpty() const { return !impl_; }
+
+std::vector<double> AlphaShapeCache::GetAlphaSpectrum() const {
+    std::vector<double> spectrum;
+    if (IsEmpty()) {
+        return spectrum;
     }
-    if (pcd.HasColors()) {
-        mesh->vertex_colors_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
+    const AlphaShapeFaces &faces = impl_->faces;
+    for (size_t i = 0; i < faces.faces.size(); ++i) {
+        for (double alpha : {faces.alpha_lo[i], faces.alpha_hi[i]}) {
+            if (std::isfinite(alpha)) {
+                spectrum.push_back(alpha);
+            }
         }
     }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
-
-    std::vector<double> vsqn(tetra_mesh->vertices_.size());
-    for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
-        vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
-    }
+    tbb::parallel_sort(spectrum.begin(), spectrum.end());
+    spectrum.erase(std::unique(spectrum.begin(), spectrum.end()),
+                   spectrum.end());
+    return spectrum;
+}
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
-            "satisfy constraint");
-    const auto& verts = tetra_mesh->vertices_;
-    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
-        const auto& tetra = tetra_mesh->tetras_[tidx];
+/// Circumradius of each tetra, infinite for degenerate tetras.
+static std::vector<double> ComputeCircumradii(const TetraMesh &tetra_mesh) {
+    const auto &verts = tetra_mesh.vertices_;
+    const auto &tetras = tetra_mesh.tetras_;
+    std::vector<double> radii(tetras.size());
+    std::atomic<int64_t> num_invalid(0);
+    utility::ParallelFor(0, int64_t(tetras.size()), [&](int64_t tidx) {
+        const auto &tetra = tetras[tidx];
+        double vsqn[4];
+        for (int i = 0; i < 4; ++i) {
+            vsqn[i] = verts[tetra(i)].squaredNorm();
+        }
         // clang-format off
         Eigen::Matrix4d tmp;
         tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
@@ -91,90 +112,221 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
                 verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2), 1,
                 verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2), 1;
         double a = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2),
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2),
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2),
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2);
+        tmp << vsqn[0], verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2),
+                vsqn[1], verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2),
+                vsqn[2], verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2),
+                vsqn[3], verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2);
         double c = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](1), verts[tetra(0)](2), 1,
-                vsqn[tetra(1)], verts[tetra(1)](1), verts[tetra(1)](2), 1,
-                vsqn[tetra(2)], verts[tetra(2)](1), verts[tetra(2)](2), 1,
-                vsqn[tetra(3)], verts[tetra(3)](1), verts[tetra(3)](2), 1;
+        tmp << vsqn[0], verts[tetra(0)](1), verts[tetra(0)](2), 1,
+                vsqn[1], verts[tetra(1)](1), verts[tetra(1)](2), 1,
+                vsqn[2], verts[tetra(2)](1), verts[tetra(2)](2), 1,
+                vsqn[3], verts[tetra(3)](1), verts[tetra(3)](2), 1;
         double dx = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](2), 1,
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](2), 1,
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](2), 1,
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](2), 1;
+        tmp << vsqn[0], verts[tetra(0)](0), verts[tetra(0)](2), 1,
+                vsqn[1], verts[tetra(1)](0), verts[tetra(1)](2), 1,
+                vsqn[2], verts[tetra(2)](0), verts[tetra(2)](2), 1,
+                vsqn[3], verts[tetra(3)](0), verts[tetra(3)](2), 1;
         double dy = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), 1,
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), 1,
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), 1,
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), 1;
+        tmp << vsqn[0], verts[tetra(0)](0), verts[tetra(0)](1), 1,
+                vsqn[1], verts[tetra(1)](0), verts[tetra(1)](1), 1,
+                vsqn[2], verts[tetra(2)](0), verts[tetra(2)](1), 1,
+                vsqn[3], verts[tetra(3)](0), verts[tetra(3)](1), 1;
         double dz = tmp.determinant();
         // clang-format on
         if (a == 0) {
-            utility::LogWarning(
-                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
-                    "TetraMesh");
+            radii[tidx] = std::numeric_limits<double>::infinity();
+            num_invalid++;
         } else {
-            double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
-                       (2 * std::abs(a));
-
-            if (r <= alpha) {
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(2)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(2), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(1), tetra(2), tetra(3)));
-            }
+            radii[tidx] = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+                          (2 * std::abs(a));
         }
+    });
+    if (num_invalid > 0) {
+        utility::LogWarning(
+                "[CreateFromPointCloudAlphaShape] {} invalid tetras in "
+                "TetraMesh",
+                num_invalid.load());
     }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
-            "that satisfy constraint");
-
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove triangles within "
-            "the mesh");
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            triangle_count;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count.count(triangle) == 0) {
-            triangle_count[triangle] = 1;
-        } else {
-            triangle_count[triangle] += 1;
+    return radii;
+}
+
+/// Computes the faces of faces.tetra_mesh and their alpha intervals.
+static void ComputeAlphaShapeFaces(AlphaShapeFaces &faces) {
+    const auto &tetras = faces.tetra_mesh->tetras_;
+    std::vector<double> radii = ComputeCircumradii(*faces.tetra_mesh);
+
+    // Sort the faces of all tetras, such that the occurrences of a face are
+    // consecutive and ordered by position.
+    static const int kTetraFaces[4][3] = {
+            {0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}};
+    int64_t num_occurrences = 4 * int64_t(tetras.size());
+    std::vector<Eigen::Vector3i> occurrences(num_occurrences);
+    utility::ParallelFor(0, int64_t(tetras.size()), [&](int64_t tidx) {
+        const auto &tetra = tetras[tidx];
+        for (int k = 0; k < 4; ++k) {
+            occurrences[4 * tidx + k] = TriangleMesh::GetOrderedTriangle(
+                    tetra(kTetraFaces[k][0]), tetra(kTetraFaces[k][1]),
+                    tetra(kTetraFaces[k][2]));
         }
-    }
+    });
+    std::vector<int64_t> order(num_occurrences);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        const Eigen::Vector3i &ta = occurrences[a];
+        const Eigen::Vector3i &tb = occurrences[b];
+        return std::tie(ta(0), ta(1), ta(2), a) <
+               std::tie(tb(0), tb(1), tb(2), b);
+    });
 
-    size_t to_idx = 0;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count[triangle] == 1) {
-            mesh->triangles_[to_idx] = triangle;
-            to_idx++;
+    std::vector<int64_t> is_first(num_occurrences);
+    utility::ParallelFor(0, num_occurrences, [&](int64_t i) {
+        is_first[i] = i == 0 || occurrences[order[i]] !=
+                                        occurrences[order[i - 1]];
+    });
+    std::vector<int64_t> face_ends(num_occurrences);
+    utility::InclusivePrefixSum(is_first.data(),
+                                is_first.data() + num_occurrences,
+                                face_ends.data());
+    int64_t num_faces = num_occurrences > 0 ? face_ends.back() : 0;
+    std::vector<int64_t> firsts(num_faces + 1, num_occurrences);
+    utility::ParallelFor(0, num_occurrences, [&](int64_t i) {
+        if (is_first[i]) {
+            firsts[face_ends[i] - 1] = i;
         }
+    });
+
+    // A face belongs to the alpha shape iff exactly one of its tetras has a
+    // circumradius of at most alpha.
+    std::vector<double> alpha_lo(num_faces), alpha_hi(num_faces);
+    std::vector<int64_t> positions(num_faces);
+    utility::ParallelFor(0, num_faces, [&](int64_t fidx) {
+        double lo = std::numeric_limits<double>::infinity();
+        double hi = lo;
+        int64_t position = order[firsts[fidx]];
+        for (int64_t i = firsts[fidx]; i < firsts[fidx + 1]; ++i) {
+            double radius = radii[order[i] / 4];
+            if (radius < lo) {
+                hi = lo;
+                lo = radius;
+                position = order[i];
+            } else if (radius < hi) {
+                hi = radius;
+            }
+        }
+        alpha_lo[fidx] = lo;
+        alpha_hi[fidx] = hi;
+        positions[fidx] = position;
+    });
+
+    std::vector<int64_t> by_alpha(num_faces);
+    std::iota(by_alpha.begin(), by_alpha.end(), 0);
+    tbb::parallel_sort(by_alpha.begin(), by_alpha.end(),
+                       [&](int64_t a, int64_t b) {
+                           return alpha_lo[a] < alpha_lo[b] ||
+                                  (alpha_lo[a] == alpha_lo[b] && a < b);
+                       });
+    faces.faces.resize(num_faces);
+    faces.alpha_lo.resize(num_faces);
+    faces.alpha_hi.resize(num_faces);
+    faces.positions.resize(num_faces);
+    utility::ParallelFor(0, num_faces, [&](int64_t i) {
+        int64_t fidx = by_alpha[i];
+        faces.faces[i] = occurrences[positions[fidx]];
+        faces.alpha_lo[i] = alpha_lo[fidx];
+        faces.alpha_hi[i] = alpha_hi[fidx];
+        faces.positions[i] = positions[fidx];
+    });
+}
+
+/// Extracts the alpha shape from the faces, with the attributes of \p pcd.
+static std::shared_ptr<TriangleMesh> ExtractAlphaShape(
+        const PointCloud &pcd, double alpha, const AlphaShapeFaces &faces) {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = faces.tetra_mesh->vertices_;
+    int64_t num_vertices = int64_t(mesh->vertices_.size());
+    auto PointIndex = [&](int64_t vidx) {
+        return faces.pt_map.empty() ? size_t(vidx) : faces.pt_map[vidx];
+    };
+    if (pcd.HasNormals()) {
+        mesh->vertex_normals_.resize(num_vertices);
+        utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+            mesh->vertex_normals_[vidx] = pcd.normals_[PointIndex(vidx)];
+        });
     }
-    mesh->triangles_.resize(to_idx);
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove triangles within "
-            "the mesh");
-
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove duplicate triangles and "
-            "unreferenced vertices");
-    mesh->RemoveDuplicatedTriangles();
-    mesh->RemoveUnreferencedVertices();
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove duplicate triangles "
-            "and unreferenced vertices");
+    if (pcd.HasColors()) {
+        mesh->vertex_colors_.resize(num_vertices);
+        utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+            mesh->vertex_colors_[vidx] = pcd.colors_[PointIndex(vidx)];
+        });
+    }
+
+    // Only the faces whose interval starts at or below alpha are candidates.
+    int64_t num_candidates =
+            std::upper_bound(faces.alpha_lo.begin(), faces.alpha_lo.end(),
+                             alpha) -
+            faces.alpha_lo.begin();
+    std::vector<int64_t> keep(num_candidates);
+    utility::ParallelFor(0, num_candidates, [&](int64_t i) {
+        keep[i] = faces.alpha_hi[i] > alpha;
+    });
+    std::vector<int64_t> kept_ends(num_candidates);
+    utility::InclusivePrefixSum(keep.data(), keep.data() + num_candidates,
+                                kept_ends.data());
+    int64_t num_kept = num_candidates > 0 ? kept_ends.back() : 0;
+    std::vector<int64_t> kept(num_kept);
+    utility::ParallelFor(0, num_candidates, [&](int64_t i) {
+        if (keep[i]) {
+            kept[kept_ends[i] - 1] = i;
+        }
+    });
+    tbb::parallel_sort(kept.begin(), kept.end(), [&](int64_t a, int64_t b) {
+        return faces.positions[a] < faces.positions[b];
+    });
+    mesh->triangles_.resize(num_kept);
+    utility::ParallelFor(0, num_kept, [&](int64_t i) {
+        mesh->triangles_[i] = faces.faces[kept[i]];
+    });
 
+    mesh->RemoveUnreferencedVertices();
     return mesh;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud &pcd,
+        double alpha,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t> *pt_map) {
+    if (tetra_mesh == nullptr) {
+        AlphaShapeCache cache;
+        return CreateFromPointCloudAlphaShape(pcd, alpha, cache);
+    }
+    AlphaShapeFaces faces;
+    faces.tetra_mesh = tetra_mesh;
+    if (pt_map != nullptr) {
+        faces.pt_map = *pt_map;
+    }
+    ComputeAlphaShapeFaces(faces);
+    return ExtractAlphaShape(pcd, alpha, faces);
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud &pcd, double alpha, AlphaShapeCache &cache) {
+    if (cache.IsEmpty() || cache.impl_->points != pcd.points_) {
+        cache.impl_.reset(new AlphaShapeCache::Impl());
+        auto &impl = *cache.impl_;
+        impl.points = pcd.points_;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(impl.faces.tetra_mesh, impl.faces.pt_map) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        ComputeAlphaShapeFaces(impl.faces);
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
+    }
+    return ExtractAlphaShape(pcd, alpha, cache.impl_->faces);
+}
+
 }  // namespace geometry
 }  // namespace open3d
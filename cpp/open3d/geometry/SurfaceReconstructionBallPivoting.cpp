@@ -25,155 +25,208 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <deque>
 #include <iostream>
-#include <list>
+#include <limits>
+#include <numeric>
+#include <vector>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
+namespace {
 
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+/// Point clouds with more points than this are reconstructed in spatial tiles
+/// that are processed in parallel and stitched together afterwards.
+constexpr size_t kBallPivotingMaxTilePoints = 1 << 18;
 
-class BallPivotingVertex {
-public:
-    enum Type { Orphan = 0, Front = 1, Inner = 2 };
-
-    BallPivotingVertex(int idx,
-                       const Eigen::Vector3d& point,
-                       const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
-
-    void UpdateType();
-
-public:
-    int idx_;
-    const Eigen::Vector3d& point_;
-    const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
-    Type type_;
-};
+enum class BallPivotingVertexType { Orphan = 0, Front = 1, Inner = 2 };
 
-class BallPivotingEdge {
-public:
+/// Edges and triangles are stored in flat arrays and reference each other
+/// and the vertices by index.
+struct BallPivotingEdge {
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
-
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
-
-public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
+    BallPivotingEdge(int source, int target)
+        : source_(source),
+          target_(target),
+          triangle0_(-1),
+          triangle1_(-1),
+          type_(Type::Front) {}
+
+    int source_;
+    int target_;
+    int triangle0_;
+    int triangle1_;
     Type type_;
 };
 
-class BallPivotingTriangle {
-public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
+struct BallPivotingTriangle {
+    BallPivotingTriangle(int vert0,
+                         int vert1,
+                         int vert2,
+                         const Eigen::Vector3d& ball_center)
         : vert0_(vert0),
           vert1_(vert1),
           vert2_(vert2),
           ball_center_(ball_center) {}
 
-public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
-            }
-        }
-        type_ = Type::Inner;
+/// A spatial tile of the input point cloud. The tile creates triangles only
+/// between its \p owned_ points, while the \p halo_ points within twice the
+/// largest radius of the tile are used for the empty ball tests.
+struct BallPivotingTile {
+    std::vector<int> owned_;
+    std::vector<int> halo_;
+};
+
+void SplitBallPivotingTiles(const std::vector<Eigen::Vector3d>& points,
+                            std::vector<int> owned,
+                            std::vector<int> halo,
+                            Eigen::Vector3d min_bound,
+                            Eigen::Vector3d max_bound,
+                            double margin,
+                            std::vector<BallPivotingTile>& tiles) {
+    if (owned.size() <= kBallPivotingMaxTilePoints) {
+        std::sort(owned.begin(), owned.end());
+        std::sort(halo.begin(), halo.end());
+        tiles.push_back({std::move(owned), std::move(halo)});
+        return;
     }
-}
 
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            BallPivotingVertexPtr opp = GetOppositeVertex();
-            Eigen::Vector3d tr_norm =
-                    (target_->point_ - source_->point_)
-                            .cross(opp->point_ - source_->point_);
-            tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm =
-                    source_->normal_ + target_->normal_ + opp->normal_;
-            pt_norm /= pt_norm.norm();
-            if (pt_norm.dot(tr_norm) < 0) {
-                std::swap(target_, source_);
-            }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
+    int axis;
+    (max_bound - min_bound).maxCoeff(&axis);
+    auto mid = owned.begin() + owned.size() / 2;
+    std::nth_element(owned.begin(), mid, owned.end(), [&](int a, int b) {
+        return points[a](axis) < points[b](axis);
+    });
+    const double split = points[*mid](axis);
+
+    std::vector<int> left_owned(owned.begin(), mid);
+    std::vector<int> right_owned(mid, owned.end());
+    std::vector<int> left_halo;
+    std::vector<int> right_halo;
+    for (int idx : halo) {
+        if (points[idx](axis) <= split + margin) {
+            left_halo.push_back(idx);
+        }
+        if (points[idx](axis) >= split - margin) {
+            right_halo.push_back(idx);
         }
     }
-}
-
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
+    for (int idx : right_owned) {
+        if (points[idx](axis) <= split + margin) {
+            left_halo.push_back(idx);
         }
-    } else {
-        return nullptr;
     }
+    for (int idx : left_owned) {
+        if (points[idx](axis) >= split - margin) {
+            right_halo.push_back(idx);
+        }
+    }
+    owned.clear();
+    owned.shrink_to_fit();
+    halo.clear();
+    halo.shrink_to_fit();
+
+    Eigen::Vector3d left_max_bound = max_bound;
+    left_max_bound(axis) = split;
+    Eigen::Vector3d right_min_bound = min_bound;
+    right_min_bound(axis) = split;
+    SplitBallPivotingTiles(points, std::move(left_owned), std::move(left_halo),
+                           min_bound, left_max_bound, margin, tiles);
+    SplitBallPivotingTiles(points, std::move(right_owned),
+                           std::move(right_halo), right_min_bound, max_bound,
+                           margin, tiles);
 }
 
+}  // namespace
+
 class BallPivoting {
 public:
-    BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
-        mesh_ = std::make_shared<TriangleMesh>();
-        mesh_->vertices_ = pcd.points_;
-        mesh_->vertex_normals_ = pcd.normals_;
-        mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
+    /// Only the first \p num_owned points of \p pcd may become triangle
+    /// vertices; a negative value means that all points may.
+    BallPivoting(const PointCloud& pcd, int num_owned = -1)
+        : has_normals_(pcd.HasNormals()),
+          points_(pcd.points_),
+          normals_(pcd.normals_),
+          num_owned_(num_owned < 0 ? int(pcd.points_.size()) : num_owned),
+          kdtree_(pcd),
+          vertex_types_(pcd.points_.size(), BallPivotingVertexType::Orphan),
+          vertex_edges_(pcd.points_.size()) {}
+
+    bool IsOwned(int vidx) const { return vidx < num_owned_; }
+
+    void UpdateVertexType(int vidx) {
+        if (vertex_edges_[vidx].empty()) {
+            vertex_types_[vidx] = BallPivotingVertexType::Orphan;
+        } else {
+            for (int eidx : vertex_edges_[vidx]) {
+                if (edges_[eidx].type_ != BallPivotingEdge::Type::Inner) {
+                    vertex_types_[vidx] = BallPivotingVertexType::Front;
+                    return;
+                }
+            }
+            vertex_types_[vidx] = BallPivotingVertexType::Inner;
         }
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
+    int GetOppositeVertex(int eidx) const {
+        const BallPivotingEdge& edge = edges_[eidx];
+        if (edge.triangle0_ >= 0) {
+            const BallPivotingTriangle& triangle = triangles_[edge.triangle0_];
+            if (triangle.vert0_ != edge.source_ &&
+                triangle.vert0_ != edge.target_) {
+                return triangle.vert0_;
+            } else if (triangle.vert1_ != edge.source_ &&
+                       triangle.vert1_ != edge.target_) {
+                return triangle.vert1_;
+            } else {
+                return triangle.vert2_;
+            }
+        } else {
+            return -1;
+        }
+    }
+
+    void AddAdjacentTriangle(int eidx, int tidx) {
+        BallPivotingEdge& edge = edges_[eidx];
+        if (tidx != edge.triangle0_ && tidx != edge.triangle1_) {
+            if (edge.triangle0_ < 0) {
+                edge.triangle0_ = tidx;
+                edge.type_ = BallPivotingEdge::Type::Front;
+                // update orientation
+                int opp = GetOppositeVertex(eidx);
+                Eigen::Vector3d tr_norm =
+                        (points_[edge.target_] - points_[edge.source_])
+                                .cross(points_[opp] - points_[edge.source_]);
+                tr_norm /= tr_norm.norm();
+                Eigen::Vector3d pt_norm = normals_[edge.source_] +
+                                          normals_[edge.target_] +
+                                          normals_[opp];
+                pt_norm /= pt_norm.norm();
+                if (pt_norm.dot(tr_norm) < 0) {
+                    std::swap(edge.target_, edge.source_);
+                }
+            } else if (edge.triangle1_ < 0) {
+                edge.triangle1_ = tidx;
+                edge.type_ = BallPivotingEdge::Type::Inner;
+            } else {
+                utility::LogDebug("!!! This case should not happen");
+            }
         }
     }
 
@@ -181,10 +234,10 @@ public:
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = points_[vidx1];
+        const Eigen::Vector3d& v2 = points_[vidx2];
+        const Eigen::Vector3d& v3 = points_[vidx3];
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -215,9 +268,8 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm =
+                    normals_[vidx1] + normals_[vidx2] + normals_[vidx3];
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -230,72 +282,46 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
+    int GetLinkingEdge(int v0, int v1) const {
+        for (int eidx : vertex_edges_[v0]) {
+            const BallPivotingEdge& edge = edges_[eidx];
+            if (edge.source_ == v1 || edge.target_ == v1) {
+                return eidx;
             }
         }
-        return nullptr;
+        return -1;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
+    int GetOrCreateLinkingEdge(int v0, int v1) {
+        int eidx = GetLinkingEdge(v0, v1);
+        if (eidx < 0) {
+            eidx = int(edges_.size());
+            edges_.emplace_back(v0, v1);
+            vertex_edges_[v0].push_back(eidx);
+            vertex_edges_[v1].push_back(eidx);
         }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
-
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
-        }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+        return eidx;
+    }
 
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
-        }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
-
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
-
-        Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
-        } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
-        }
-        mesh_->triangle_normals_.push_back(face_normal);
+    void CreateTriangle(int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        utility::LogDebug(
+                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}", v0,
+                v1, v2);
+        int tidx = int(triangles_.size());
+        triangles_.emplace_back(v0, v1, v2, center);
+
+        AddAdjacentTriangle(GetOrCreateLinkingEdge(v0, v1), tidx);
+        AddAdjacentTriangle(GetOrCreateLinkingEdge(v1, v2), tidx);
+        AddAdjacentTriangle(GetOrCreateLinkingEdge(v2, v0), tidx);
+
+        UpdateVertexType(v0);
+        UpdateVertexType(v1);
+        UpdateVertexType(v2);
     }
 
-    Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
-                                      const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
+    static Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
+                                             const Eigen::Vector3d& v1,
+                                             const Eigen::Vector3d& v2) {
         Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
         double norm = normal.norm();
         if (norm > 0) {
@@ -304,54 +330,43 @@ public:
         return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+    bool IsCompatible(int v0, int v1, int v2) const {
+        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}", v0,
+                          v1, v2);
         Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (normal.dot(normals_[v0]) < -1e-16) {
             normal *= -1;
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
+        bool ret = normal.dot(normals_[v0]) > -1e-16 &&
+                   normal.dot(normals_[v1]) > -1e-16 &&
+                   normal.dot(normals_[v2]) > -1e-16;
         utility::LogDebug("[IsCompatible] returns = {}", ret);
         return ret;
     }
 
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
+    int FindCandidateVertex(int eidx,
+                            double radius,
+                            Eigen::Vector3d& candidate_center) const {
+        const BallPivotingEdge& edge = edges_[eidx];
+        const int src = edge.source_;
+        const int tgt = edge.target_;
+        const int opp = GetOppositeVertex(eidx);
+        utility::LogDebug(
+                "[FindCandidateVertex] edge=({}, {}), opp={}, radius={}", src,
+                tgt, opp, radius);
+
+        const Eigen::Vector3d& src_point = points_[src];
+        const Eigen::Vector3d& tgt_point = points_[tgt];
+        const Eigen::Vector3d& opp_point = points_[opp];
+        Eigen::Vector3d mp = 0.5 * (src_point + tgt_point);
+
+        const Eigen::Vector3d& center =
+                triangles_[edge.triangle0_].ball_center_;
         utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
+                          src, tgt, center.transpose());
 
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+        Eigen::Vector3d v = tgt_point - src_point;
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
@@ -363,62 +378,44 @@ public:
         utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
                           indices.size());
 
-        BallPivotingVertexPtr min_candidate = nullptr;
+        int min_candidate = -1;
         double min_angle = 2 * M_PI;
-        for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+        for (auto candidate : indices) {
+            if (candidate == src || candidate == tgt || candidate == opp) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
+            const Eigen::Vector3d& candidate_point = points_[candidate];
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    src_point, tgt_point, opp_point, candidate_point);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, candidate_point, src_point,
+                                     opp_point) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
+                                     mp, candidate_point, tgt_point,
+                                     opp_point) < 1e-12)) {
                 utility::LogDebug(
                         "[FindCandidateVertex] candidate {:d} is intersecting "
                         "the existing triangle",
-                        candidate->idx_);
+                        candidate);
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
+            if (!ComputeBallCenter(src, tgt, candidate, radius, new_center)) {
                 utility::LogDebug(
                         "[FindCandidateVertex] candidate {:d} can not compute "
                         "ball",
-                        candidate->idx_);
+                        candidate);
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -428,25 +425,19 @@ public:
             }
 
             if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
                 continue;
             }
 
             bool empty_ball = true;
-            for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
+            for (auto nb : indices) {
+                if (nb == src || nb == tgt || nb == candidate) {
                     continue;
                 }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
+                if ((new_center - points_[nb]).norm() < radius - 1e-16) {
                     utility::LogDebug(
                             "[FindCandidateVertex] candidate {:d} not an empty "
                             "ball",
-                            candidate->idx_);
+                            candidate);
                     empty_ball = false;
                     break;
                 }
@@ -454,95 +445,93 @@ public:
 
             if (empty_ball) {
                 utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
+                                  candidate);
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = candidate;
                 candidate_center = new_center;
             }
         }
 
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
+        utility::LogDebug("[FindCandidateVertex] returns {:d}", min_candidate);
         return min_candidate;
     }
 
     void ExpandTriangulation(double radius) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
         while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
+            int eidx = edge_front_.front();
             edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+            if (edges_[eidx].type_ != BallPivotingEdge::Front) {
                 continue;
             }
 
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int candidate = FindCandidateVertex(eidx, radius, center);
+            const int src = edges_[eidx].source_;
+            const int tgt = edges_[eidx].target_;
+            if (candidate < 0 || !IsOwned(candidate) ||
+                vertex_types_[candidate] == BallPivotingVertexType::Inner ||
+                !IsCompatible(candidate, src, tgt)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int e0 = GetLinkingEdge(candidate, src);
+            int e1 = GetLinkingEdge(candidate, tgt);
+            if ((e0 >= 0 &&
+                 edges_[e0].type_ != BallPivotingEdge::Type::Front) ||
+                (e1 >= 0 &&
+                 edges_[e1].type_ != BallPivotingEdge::Type::Front)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(src, tgt, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
+            e0 = GetLinkingEdge(candidate, src);
+            e1 = GetLinkingEdge(candidate, tgt);
+            if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
+            if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
+    bool TryTriangleSeed(int v0,
+                         int v1,
+                         int v2,
                          const std::vector<int>& nb_indices,
                          double radius,
-                         Eigen::Vector3d& center) {
+                         Eigen::Vector3d& center) const {
         utility::LogDebug(
                 "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
                 "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
+                v0, v1, v2, radius);
 
         if (!IsCompatible(v0, v1, v2)) {
             return false;
         }
 
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
+        int e0 = GetLinkingEdge(v0, v2);
+        int e1 = GetLinkingEdge(v1, v2);
+        if (e0 >= 0 && edges_[e0].type_ == BallPivotingEdge::Type::Inner) {
             utility::LogDebug(
                     "[TryTriangleSeed] returns {} because e0 is inner edge",
                     false);
             return false;
         }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
+        if (e1 >= 0 && edges_[e1].type_ == BallPivotingEdge::Type::Inner) {
             utility::LogDebug(
                     "[TryTriangleSeed] returns {} because e1 is inner edge",
                     false);
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
+        if (!ComputeBallCenter(v0, v1, v2, radius, center)) {
             utility::LogDebug(
                     "[TryTriangleSeed] returns {} could not compute ball "
                     "center",
@@ -552,12 +541,10 @@ public:
 
         // test if no other point is within the ball
         for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
+            if (nbidx == v0 || nbidx == v1 || nbidx == v2) {
                 continue;
             }
-            if ((center - v->point_).norm() < radius - 1e-16) {
+            if ((center - points_[nbidx]).norm() < radius - 1e-16) {
                 utility::LogDebug(
                         "[TryTriangleSeed] returns {} computed ball is not "
                         "empty",
@@ -570,58 +557,55 @@ public:
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
+    bool IsSeedCandidate(int vidx) const {
+        return IsOwned(vidx) &&
+               vertex_types_[vidx] == BallPivotingVertexType::Orphan;
+    }
+
+    bool TrySeed(int v, double radius) {
+        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v, radius);
         std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+        kdtree_.SearchRadius(points_[v], 2 * radius, indices, dists2);
         if (indices.size() < 3u) {
             return false;
         }
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
-                continue;
-            }
-            if (nb0->idx_ == v->idx_) {
+            const int nb0 = indices[nbidx0];
+            if (!IsSeedCandidate(nb0) || nb0 == v) {
                 continue;
             }
 
-            int candidate_vidx2 = -1;
+            int nb1 = -1;
             Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
-                    continue;
-                }
-                if (nb1->idx_ == v->idx_) {
+                const int candidate = indices[nbidx1];
+                if (!IsSeedCandidate(candidate) || candidate == v) {
                     continue;
                 }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
+                if (TryTriangleSeed(v, nb0, candidate, indices, radius,
+                                    center)) {
+                    nb1 = candidate;
                     break;
                 }
             }
 
-            if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
-
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
+            if (nb1 >= 0) {
+                int e0 = GetLinkingEdge(v, nb1);
+                if (e0 >= 0 &&
+                    edges_[e0].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
+                int e1 = GetLinkingEdge(nb0, nb1);
+                if (e1 >= 0 &&
+                    edges_[e1].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
+                int e2 = GetLinkingEdge(v, nb0);
+                if (e2 >= 0 &&
+                    edges_[e2].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
 
@@ -630,13 +614,13 @@ public:
                 e0 = GetLinkingEdge(v, nb1);
                 e1 = GetLinkingEdge(nb0, nb1);
                 e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e0);
                 }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e1);
                 }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e2].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e2);
                 }
 
@@ -654,26 +638,62 @@ public:
     }
 
     void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
+        for (int vidx = 0; vidx < num_owned_; ++vidx) {
+            if (vertex_types_[vidx] == BallPivotingVertexType::Orphan) {
+                if (TrySeed(vidx, radius)) {
                     ExpandTriangulation(radius);
                 }
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
+    /// Moves the border edges whose triangle admits an empty ball of the
+    /// given \p radius back to the edge front.
+    void ReactivateBorderEdges(double radius) {
+        size_t num_border_edges = 0;
+        for (int eidx : border_edges_) {
+            BallPivotingEdge& edge = edges_[eidx];
+            const BallPivotingTriangle& triangle = triangles_[edge.triangle0_];
+            utility::LogDebug(
+                    "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
+                    edge.source_, edge.target_, triangle.vert0_,
+                    triangle.vert1_, triangle.vert2_);
+
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                  triangle.vert2_, radius, center)) {
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                bool empty_ball = true;
+                for (auto idx : indices) {
+                    if (idx != triangle.vert0_ && idx != triangle.vert1_ &&
+                        idx != triangle.vert2_) {
+                        empty_ball = false;
+                        break;
+                    }
+                }
+
+                if (empty_ball) {
+                    utility::LogDebug(
+                            "[Run]   yeah, add edge to edge_front_: {:d}",
+                            edge_front_.size());
+                    edge.type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(eidx);
+                    continue;
+                }
+            }
+            border_edges_[num_border_edges++] = eidx;
+        }
+        border_edges_.resize(num_border_edges);
+    }
+
+    void Run(const std::vector<double>& radii) {
         if (!has_normals_) {
             utility::LogError("ReconstructBallPivoting requires normals");
         }
 
-        mesh_->triangles_.clear();
-
         for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
             utility::LogDebug("[Run] change to radius {:.4f}", radius);
             if (radius <= 0) {
                 utility::LogError(
@@ -681,47 +701,7 @@ public:
             }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
+            ReactivateBorderEdges(radius);
 
             // do the reconstruction
             if (edge_front_.empty()) {
@@ -730,26 +710,139 @@ public:
                 ExpandTriangulation(radius);
             }
 
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
+            utility::LogDebug("[Run] {:d} triangles", triangles_.size());
         }
-        return mesh_;
+    }
+
+    /// Adds the triangles reconstructed in separate tiles and closes the gaps
+    /// between them by pivoting over all edges at the tile boundaries, before
+    /// seeding the remaining orphan vertices.
+    void Stitch(const std::vector<BallPivotingTriangle>& triangles,
+                const std::vector<double>& radii) {
+        for (const BallPivotingTriangle& triangle : triangles) {
+            CreateTriangle(triangle.vert0_, triangle.vert1_, triangle.vert2_,
+                           triangle.ball_center_);
+        }
+        for (size_t eidx = 0; eidx < edges_.size(); ++eidx) {
+            if (edges_[eidx].type_ != BallPivotingEdge::Type::Inner) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(int(eidx));
+            }
+        }
+
+        for (double radius : radii) {
+            utility::LogDebug("[Stitch] change to radius {:.4f}", radius);
+            ReactivateBorderEdges(radius);
+            ExpandTriangulation(radius);
+            FindSeedTriangle(radius);
+        }
+    }
+
+    const std::vector<BallPivotingTriangle>& GetTriangles() const {
+        return triangles_;
     }
 
 private:
     bool has_normals_;
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
+    int num_owned_;
     KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
-    std::shared_ptr<TriangleMesh> mesh_;
+    std::vector<BallPivotingVertexType> vertex_types_;
+    std::vector<std::vector<int>> vertex_edges_;
+    std::vector<BallPivotingEdge> edges_;
+    std::vector<BallPivotingTriangle> triangles_;
+    std::deque<int> edge_front_;
+    std::vector<int> border_edges_;
 };
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
         const PointCloud& pcd, const std::vector<double>& radii) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    if (std::any_of(radii.begin(), radii.end(),
+                    [](double radius) { return radius <= 0; })) {
+        utility::LogError("got an invalid, negative radius as parameter");
+    }
+    if (pcd.points_.size() > size_t(std::numeric_limits<int>::max())) {
+        utility::LogError("ReconstructBallPivoting supports at most {} points",
+                          std::numeric_limits<int>::max());
+    }
+
     BallPivoting bp(pcd);
-    return bp.Run(radii);
+    if (pcd.points_.size() <= kBallPivotingMaxTilePoints || radii.empty()) {
+        bp.Run(radii);
+    } else {
+        // Reconstruct balanced spatial tiles in parallel. Each tile sees all
+        // points within twice the largest radius, so that the triangles it
+        // creates are also valid for the whole point cloud.
+        const double margin = 2 * *std::max_element(radii.begin(), radii.end());
+        std::vector<int> owned(pcd.points_.size());
+        std::iota(owned.begin(), owned.end(), 0);
+        std::vector<BallPivotingTile> tiles;
+        SplitBallPivotingTiles(pcd.points_, std::move(owned), {},
+                               pcd.GetMinBound(), pcd.GetMaxBound(), margin,
+                               tiles);
+        utility::LogDebug("[CreateFromPointCloudBallPivoting] {:d} tiles",
+                          tiles.size());
+
+        std::vector<std::vector<BallPivotingTriangle>> tile_triangles(
+                tiles.size());
+        utility::ParallelFor(0, int64_t(tiles.size()), [&](int64_t tile_idx) {
+            const BallPivotingTile& tile = tiles[tile_idx];
+            PointCloud tile_pcd;
+            tile_pcd.points_.reserve(tile.owned_.size() + tile.halo_.size());
+            tile_pcd.normals_.reserve(tile.owned_.size() + tile.halo_.size());
+            for (int idx : tile.owned_) {
+                tile_pcd.points_.push_back(pcd.points_[idx]);
+                tile_pcd.normals_.push_back(pcd.normals_[idx]);
+            }
+            for (int idx : tile.halo_) {
+                tile_pcd.points_.push_back(pcd.points_[idx]);
+                tile_pcd.normals_.push_back(pcd.normals_[idx]);
+            }
+
+            BallPivoting tile_bp(tile_pcd, int(tile.owned_.size()));
+            tile_bp.Run(radii);
+            std::vector<BallPivotingTriangle>& triangles =
+                    tile_triangles[tile_idx];
+            for (const auto& triangle : tile_bp.GetTriangles()) {
+                triangles.emplace_back(tile.owned_[triangle.vert0_],
+                                       tile.owned_[triangle.vert1_],
+                                       tile.owned_[triangle.vert2_],
+                                       triangle.ball_center_);
+            }
+        });
+
+        std::vector<BallPivotingTriangle> triangles;
+        for (const std::vector<BallPivotingTriangle>& t : tile_triangles) {
+            triangles.insert(triangles.end(), t.begin(), t.end());
+        }
+        tile_triangles.clear();
+        bp.Stitch(triangles, radii);
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = pcd.points_;
+    mesh->vertex_normals_ = pcd.normals_;
+    mesh->vertex_colors_ = pcd.colors_;
+    mesh->triangles_.reserve(bp.GetTriangles().size());
+    mesh->triangle_normals_.reserve(bp.GetTriangles().size());
+    for (const BallPivotingTriangle& triangle : bp.GetTriangles()) {
+        const int v0 = triangle.vert0_;
+        const int v1 = triangle.vert1_;
+        const int v2 = triangle.vert2_;
+        Eigen::Vector3d face_normal = BallPivoting::ComputeFaceNormal(
+                pcd.points_[v0], pcd.points_[v1], pcd.points_[v2]);
+        if (face_normal.dot(pcd.normals_[v0]) > -1e-16) {
+            mesh->triangles_.emplace_back(v0, v1, v2);
+        } else {
+            mesh->triangles_.emplace_back(v0, v2, v1);
+        }
+        mesh->triangle_normals_.push_back(face_normal);
+    }
+    return mesh;
 }
 
 }  // namespace geometry
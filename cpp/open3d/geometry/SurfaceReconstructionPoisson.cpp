@@ -31,6 +31,10 @@
 #include <cstdlib>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -185,12 +189,19 @@ public:
     double w_;
 };
 
+typedef std::vector<std::pair<std::string, double>> StageTimings;
+
 template <unsigned int Dim, class Real>
 struct FEMTreeProfiler {
     FEMTree<Dim, Real>& tree;
     double t;
+    StageTimings* timings;
+    size_t max_memory_mb;
 
-    FEMTreeProfiler(FEMTree<Dim, Real>& t) : tree(t) {}
+    FEMTreeProfiler(FEMTree<Dim, Real>& t,
+                    StageTimings* timings = nullptr,
+                    size_t max_memory_mb = 0)
+        : tree(t), timings(timings), max_memory_mb(max_memory_mb) {}
     void start(void) {
         t = Time(), FEMTree<Dim, Real>::ResetLocalMemoryUsage();
     }
@@ -209,6 +220,22 @@ struct FEMTreeProfiler {
                               MemoryInfo::PeakMemoryUsageMB());
         }
     }
+    // Same as dumpOutput(header), and also records the time of the stage and
+    // enforces the memory cap once the stage is done.
+    void dumpOutput(const char* header, const char* stage) const {
+        dumpOutput(header);
+        if (timings) {
+            timings->emplace_back(stage, Time() - t);
+        }
+        double usage_mb = double(MemoryInfo::Usage()) / (1 << 20);
+        if (max_memory_mb > 0 && usage_mb > double(max_memory_mb)) {
+            utility::LogError(
+                    "[CreateFromPointCloudPoisson] Memory usage of {:.1f} MB "
+                    "after stage {} exceeds max_memory_mb = {}. Try a lower "
+                    "depth or a larger width.",
+                    usage_mb, stage, max_memory_mb);
+        }
+    }
 };
 
 template <class Real, unsigned int Dim>
@@ -340,6 +367,8 @@ void ExtractMesh(
                 density,
         const SetVertexFunction& SetVertex,
         XForm<Real, sizeof...(FEMSigs) + 1> iXForm,
+        const std::string& temp_dir,
+        bool compute_densities,
         std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
         std::vector<double>& out_densities) {
     static const int Dim = sizeof...(FEMSigs);
@@ -350,15 +379,19 @@ void ExtractMesh(
                              Real>::template DensityEstimator<WEIGHT_DEGREE>
             DensityEstimator;
 
-    FEMTreeProfiler<Dim, Real> profiler(tree);
-
-    CoredMeshData<Vertex, node_index_type>* mesh;
-    mesh = new CoredVectorMeshData<Vertex, node_index_type>();
+    // Out-of-core extraction streams the iso-surface to temporary files
+    // instead of growing it in memory next to the tree.
+    std::unique_ptr<CoredMeshData<Vertex, node_index_type>> mesh;
+    if (temp_dir.empty()) {
+        mesh.reset(new CoredVectorMeshData<Vertex, node_index_type>());
+    } else {
+        mesh.reset(new CoredFileMeshData<Vertex, node_index_type>(
+                temp_dir.c_str()));
+    }
 
     bool non_manifold = true;
     bool polygon_mesh = false;
 
-    profiler.start();
     typename IsoSurfaceExtractor<Dim, Real, Vertex>::IsoStats isoStats;
     if (sampleData) {
         SparseNodeData<ProjectiveData<Open3DData, Real>,
@@ -387,7 +420,14 @@ void ExtractMesh(
 
     mesh->resetIterator();
     out_densities.clear();
-    for (size_t vidx = 0; vidx < mesh->outOfCorePointCount(); ++vidx) {
+    const size_t num_vertices = mesh->outOfCorePointCount();
+    out_mesh->vertices_.reserve(num_vertices);
+    out_mesh->vertex_normals_.reserve(num_vertices);
+    out_mesh->vertex_colors_.reserve(num_vertices);
+    if (compute_densities) {
+        out_densities.reserve(num_vertices);
+    }
+    for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
         Vertex v;
         mesh->nextOutOfCorePoint(v);
         v.point = iXForm * v.point;
@@ -395,8 +435,11 @@ void ExtractMesh(
                 Eigen::Vector3d(v.point[0], v.point[1], v.point[2]));
         out_mesh->vertex_normals_.push_back(v.normal_);
         out_mesh->vertex_colors_.push_back(v.color_);
-        out_densities.push_back(v.w_);
+        if (compute_densities) {
+            out_densities.push_back(v.w_);
+        }
     }
+    out_mesh->triangles_.reserve(mesh->polygonCount());
     for (size_t tidx = 0; tidx < mesh->polygonCount(); ++tidx) {
         std::vector<CoredVertexIndex<node_index_type>> triangle;
         mesh->nextPolygon(triangle);
@@ -407,8 +450,6 @@ void ExtractMesh(
                     triangle[0].idx, triangle[1].idx, triangle[2].idx));
         }
     }
-
-    delete mesh;
 }
 
 template <class Real, typename... SampleData, unsigned int... FEMSigs>
@@ -419,6 +460,10 @@ void Execute(const open3d::geometry::PointCloud& pcd,
              size_t width,
              float scale,
              bool linear_fit,
+             size_t max_memory_mb,
+             const std::string& temp_dir,
+             bool compute_densities,
+             StageTimings& timings,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -452,19 +497,20 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     Real isoValue = 0;
 
     FEMTree<Dim, Real> tree(MEMORY_ALLOCATOR_BLOCK_SIZE);
-    FEMTreeProfiler<Dim, Real> profiler(tree);
+    FEMTreeProfiler<Dim, Real> profiler(tree, &timings, max_memory_mb);
 
     size_t pointCount;
 
     Real pointWeightSum;
     std::vector<typename FEMTree<Dim, Real>::PointSample> samples;
     std::vector<Open3DData> sampleData;
-    DensityEstimator* density = NULL;
-    SparseNodeData<Point<Real, Dim>, NormalSigs>* normalInfo = NULL;
+    std::unique_ptr<DensityEstimator> density;
+    std::unique_ptr<SparseNodeData<Point<Real, Dim>, NormalSigs>> normalInfo;
     Real targetValue = (Real)0.5;
 
     // Read in the samples (and color data)
     {
+        profiler.start();
         Open3DPointStream<Real> pointStream(&pcd);
 
         if (width > 0) {
@@ -512,6 +558,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
         utility::LogDebug("Input Points / Samples: {} / {}", pointCount,
                           samples.size());
+        profiler.dumpOutput("#       Read samples:", "read_samples");
     }
 
     int kernelDepth = depth - 2;
@@ -524,7 +571,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     DenseNodeData<Real, Sigs> solution;
     {
         DenseNodeData<Real, Sigs> constraints;
-        InterpolationInfo* iInfo = NULL;
+        std::unique_ptr<InterpolationInfo> iInfo;
         int solveDepth = depth;
 
         tree.resetNodeIndices();
@@ -532,15 +579,17 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         // Get the kernel density estimator
         {
             profiler.start();
-            density = tree.template setDensityEstimator<WEIGHT_DEGREE>(
-                    samples, kernelDepth, samples_per_node, 1);
-            profiler.dumpOutput("#   Got kernel density:");
+            density.reset(tree.template setDensityEstimator<WEIGHT_DEGREE>(
+                    samples, kernelDepth, samples_per_node, 1));
+            profiler.dumpOutput("#   Got kernel density:",
+                                "density_estimation");
         }
 
         // Transform the Hermite samples into a vector field
         {
             profiler.start();
-            normalInfo = new SparseNodeData<Point<Real, Dim>, NormalSigs>();
+            normalInfo.reset(
+                    new SparseNodeData<Point<Real, Dim>, NormalSigs>());
             std::function<bool(Open3DData, Point<Real, Dim>&)>
                     ConversionFunction =
                             [](Open3DData in, Point<Real, Dim>& out) {
@@ -574,18 +623,18 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     };
             if (confidence_bias > 0) {
                 *normalInfo = tree.setDataField(
-                        NormalSigs(), samples, sampleData, density,
+                        NormalSigs(), samples, sampleData, density.get(),
                         pointWeightSum, ConversionAndBiasFunction);
             } else {
                 *normalInfo = tree.setDataField(
-                        NormalSigs(), samples, sampleData, density,
+                        NormalSigs(), samples, sampleData, density.get(),
                         pointWeightSum, ConversionFunction);
             }
             ThreadPool::Parallel_for(0, normalInfo->size(),
                                      [&](unsigned int, size_t i) {
                                          (*normalInfo)[i] *= (Real)-1.;
                                      });
-            profiler.dumpOutput("#     Got normal field:");
+            profiler.dumpOutput("#     Got normal field:", "normal_field");
             utility::LogDebug("Point weight / Estimated Area: {:e} / {:e}",
                               pointWeightSum, pointCount * pointWeightSum);
         }
@@ -600,8 +649,8 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     full_depth,
                     typename FEMTree<Dim, Real>::template HasNormalDataFunctor<
                             NormalSigs>(*normalInfo),
-                    normalInfo, density);
-            profiler.dumpOutput("#       Finalized tree:");
+                    normalInfo.get(), density.get());
+            profiler.dumpOutput("#       Finalized tree:", "finalize_tree");
         }
 
         // Add the FEM constraints
@@ -626,17 +675,17 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                  derivatives2)] = 1;
             }
             tree.addFEMConstraints(F, *normalInfo, constraints, solveDepth);
-            profiler.dumpOutput("#  Set FEM constraints:");
+            profiler.dumpOutput("#  Set FEM constraints:", "fem_constraints");
         }
 
         // Free up the normal info
-        delete normalInfo, normalInfo = NULL;
+        normalInfo.reset();
 
         // Add the interpolation constraints
         if (point_weight > 0) {
             profiler.start();
             if (exact_interpolation) {
-                iInfo = FEMTree<Dim, Real>::
+                iInfo.reset(FEMTree<Dim, Real>::
                         template InitializeExactPointInterpolationInfo<Real, 0>(
                                 tree, samples,
                                 ConstraintDual<Dim, Real>(
@@ -644,9 +693,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                         (Real)point_weight * pointWeightSum),
                                 SystemDual<Dim, Real>((Real)point_weight *
                                                       pointWeightSum),
-                                true, false);
+                                true, false));
             } else {
-                iInfo = FEMTree<Dim, Real>::
+                iInfo.reset(FEMTree<Dim, Real>::
                         template InitializeApproximatePointInterpolationInfo<
                                 Real, 0>(
                                 tree, samples,
@@ -655,10 +704,11 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                         (Real)point_weight * pointWeightSum),
                                 SystemDual<Dim, Real>((Real)point_weight *
                                                       pointWeightSum),
-                                true, 1);
+                                true, 1));
             }
             tree.addInterpolationConstraints(constraints, solveDepth, *iInfo);
-            profiler.dumpOutput("#Set point constraints:");
+            profiler.dumpOutput("#Set point constraints:",
+                                "point_constraints");
         }
 
         utility::LogDebug(
@@ -684,9 +734,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                                     IsotropicUIntPack<Dim, 1>>
                     F({0., 1.});
             solution = tree.solveSystem(Sigs(), F, constraints, solveDepth,
-                                        sInfo, iInfo);
-            profiler.dumpOutput("# Linear system solved:");
-            if (iInfo) delete iInfo, iInfo = NULL;
+                                        sInfo, iInfo.get());
+            profiler.dumpOutput("# Linear system solved:", "solve");
+            iInfo.reset();
         }
     }
 
@@ -712,7 +762,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         for (size_t t = 0; t < valueSums.size(); t++)
             valueSum += valueSums[t], weightSum += weightSums[t];
         isoValue = (Real)(valueSum / weightSum);
-        profiler.dumpOutput("Got average:");
+        profiler.dumpOutput("Got average:", "iso_value");
         utility::LogDebug("Iso-Value: {:e} = {:e} / {:e}", isoValue, valueSum,
                           weightSum);
     }
@@ -724,25 +774,35 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         v.color_ = d.color_;
         v.w_ = w;
     };
+    profiler.start();
     ExtractMesh<Open3DVertex<Real>, Real>(
             datax, linear_fit, UIntPack<FEMSigs...>(),
             std::tuple<SampleData...>(), tree, solution, isoValue, &samples,
-            &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
+            &sampleData, density.get(), SetVertex, iXForm, temp_dir,
+            compute_densities, out_mesh, out_densities);
+    profiler.dumpOutput("#       Extracted mesh:", "extract_mesh");
 
-    if (density) delete density, density = NULL;
+    density.reset();
+    timings.emplace_back("total", Time() - startTime);
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
 }  // namespace poisson
 
-std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
-TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
-                                          size_t depth,
-                                          size_t width,
-                                          float scale,
-                                          bool linear_fit,
-                                          int n_threads) {
+std::tuple<std::shared_ptr<TriangleMesh>,
+           std::vector<double>,
+           std::vector<std::pair<std::string, double>>>
+TriangleMesh::CreateFromPointCloudPoissonWithTimings(
+        const PointCloud& pcd,
+        size_t depth,
+        size_t width,
+        float scale,
+        bool linear_fit,
+        int n_threads,
+        size_t max_memory_mb,
+        const std::string& temp_dir,
+        bool compute_densities) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
@@ -767,12 +827,41 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
 
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
-    poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+    poisson::StageTimings timings;
+    try {
+        poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
+                                width, scale, linear_fit, max_memory_mb,
+                                temp_dir, compute_densities, timings,
+                                FEMSigs());
+    } catch (...) {
+        // Exceeding max_memory_mb throws, and the pool must not outlive the
+        // call either way.
+        ThreadPool::Terminate();
+        throw;
+    }
 
     ThreadPool::Terminate();
 
-    return std::make_tuple(mesh, densities);
+    return std::make_tuple(mesh, densities, timings);
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
+                                          size_t depth,
+                                          size_t width,
+                                          float scale,
+                                          bool linear_fit,
+                                          int n_threads,
+                                          size_t max_memory_mb,
+                                          const std::string& temp_dir,
+                                          bool compute_densities) {
+    std::shared_ptr<TriangleMesh> mesh;
+    std::vector<double> densities;
+    std::tie(mesh, densities, std::ignore) =
+            CreateFromPointCloudPoissonWithTimings(
+                    pcd, depth, width, scale, linear_fit, n_threads,
+                    max_memory_mb, temp_dir, compute_densities);
+    return std::make_tuple(mesh, std::move(densities));
 }
 
 }  // namespace geometry
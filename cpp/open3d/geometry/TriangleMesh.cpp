@@ -26,18 +26,26 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <cmath>
 #include <numeric>
 #include <queue>
 #include <random>
 #include <tuple>
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/ConcurrentDisjointSets.h"
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/MeshAdjacency.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace geometry {
@@ -160,19 +168,59 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
+    // adjacency_list_ is public, so it is only left as is if the triangles
+    // are unchanged and it still has the number of entries it was built with.
+    auto num_entries = [this]() {
+        size_t count = adjacency_list_.size();
+        for (const auto &neighbors : adjacency_list_) {
+            count += neighbors.size();
+        }
+        return count;
+    };
+    uint64_t fingerprint =
+            DerivedDataCache::Fingerprint(triangles_, vertices_.size());
+    auto built_entries =
+            derived_data_.Find<size_t>("adjacency_list", fingerprint);
+    if (built_entries && adjacency_list_.size() == vertices_.size() &&
+        *built_entries == num_entries()) {
+        return *this;
+    }
+
+    auto adjacency_ptr = GetMeshAdjacency();
+    const MeshAdjacency &adjacency = *adjacency_ptr;
     adjacency_list_.clear();
     adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
-    }
+    utility::ParallelFor(0, int64_t(vertices_.size()), [&](int64_t vidx) {
+        std::vector<int> neighbors = adjacency.GetVertexNeighbors(int(vidx));
+        adjacency_list_[vidx].insert(neighbors.begin(), neighbors.end());
+    });
+    derived_data_.Set<size_t>("adjacency_list", fingerprint,
+                              std::make_shared<size_t>(num_entries()));
     return *this;
 }
 
+/// Flattens the adjacency list into compressed sparse row (CSR) arrays, so
+/// that the filters read the neighbors of a vertex contiguously and update
+/// the vertices in parallel. The neighbors keep the order of the sets.
+static void AdjacencyListToCSR(
+        const std::vector<std::unordered_set<int>> &adjacency_list,
+        std::vector<int> &offsets,
+        std::vector<int> &neighbors) {
+    offsets.resize(adjacency_list.size() + 1);
+    offsets[0] = 0;
+    for (size_t vidx = 0; vidx < adjacency_list.size(); ++vidx) {
+        offsets[vidx + 1] = offsets[vidx] + int(adjacency_list[vidx].size());
+    }
+    neighbors.resize(offsets.back());
+    utility::ParallelFor(
+            0, int64_t(adjacency_list.size()), [&](int64_t vidx) {
+                std::copy(adjacency_list[vidx].begin(),
+                          adjacency_list[vidx].end(),
+                          neighbors.begin() + offsets[vidx]);
+            },
+            256);
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
         int number_of_iterations, double strength, FilterScope scope) const {
     bool filter_vertex =
@@ -188,52 +236,66 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
+    // The attributes out of scope are copied, since they are swapped with
+    // the previous ones after each iteration.
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
     if (!mesh->HasAdjacencyList()) {
         mesh->ComputeAdjacencyList();
     }
+    std::vector<int> adjacency_offsets, adjacency_neighbors;
+    AdjacencyListToCSR(mesh->adjacency_list_, adjacency_offsets,
+                       adjacency_neighbors);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
+        utility::ParallelFor(
+                0, int64_t(mesh->vertices_.size()),
+                [&](int64_t vidx) {
+                    Eigen::Vector3d vertex_sum(0, 0, 0);
+                    Eigen::Vector3d normal_sum(0, 0, 0);
+                    Eigen::Vector3d color_sum(0, 0, 0);
+                    for (int k = adjacency_offsets[vidx];
+                         k < adjacency_offsets[vidx + 1]; ++k) {
+                        int nbidx = adjacency_neighbors[k];
+                        if (filter_vertex) {
+                            vertex_sum += prev_vertices[nbidx];
+                        }
+                        if (filter_normal) {
+                            normal_sum += prev_vertex_normals[nbidx];
+                        }
+                        if (filter_color) {
+                            color_sum += prev_vertex_colors[nbidx];
+                        }
+                    }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        prev_vertices[vidx] +
-                        strength * (prev_vertices[vidx] * nb_size - vertex_sum);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        prev_vertex_normals[vidx] +
-                        strength * (prev_vertex_normals[vidx] * nb_size -
-                                    normal_sum);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        prev_vertex_colors[vidx] +
-                        strength * (prev_vertex_colors[vidx] * nb_size -
-                                    color_sum);
-            }
-        }
+                    int nb_size = adjacency_offsets[vidx + 1] -
+                                  adjacency_offsets[vidx];
+                    if (filter_vertex) {
+                        mesh->vertices_[vidx] =
+                                prev_vertices[vidx] +
+                                strength * (prev_vertices[vidx] * nb_size -
+                                            vertex_sum);
+                    }
+                    if (filter_normal) {
+                        mesh->vertex_normals_[vidx] =
+                                prev_vertex_normals[vidx] +
+                                strength * (prev_vertex_normals[vidx] *
+                                                    nb_size -
+                                            normal_sum);
+                    }
+                    if (filter_color) {
+                        mesh->vertex_colors_[vidx] =
+                                prev_vertex_colors[vidx] +
+                                strength * (prev_vertex_colors[vidx] *
+                                                    nb_size -
+                                            color_sum);
+                    }
+                },
+                256);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -260,47 +322,58 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
     if (!mesh->HasAdjacencyList()) {
         mesh->ComputeAdjacencyList();
     }
+    std::vector<int> adjacency_offsets, adjacency_neighbors;
+    AdjacencyListToCSR(mesh->adjacency_list_, adjacency_offsets,
+                       adjacency_neighbors);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
+        utility::ParallelFor(
+                0, int64_t(mesh->vertices_.size()),
+                [&](int64_t vidx) {
+                    Eigen::Vector3d vertex_sum(0, 0, 0);
+                    Eigen::Vector3d normal_sum(0, 0, 0);
+                    Eigen::Vector3d color_sum(0, 0, 0);
+                    for (int k = adjacency_offsets[vidx];
+                         k < adjacency_offsets[vidx + 1]; ++k) {
+                        int nbidx = adjacency_neighbors[k];
+                        if (filter_vertex) {
+                            vertex_sum += prev_vertices[nbidx];
+                        }
+                        if (filter_normal) {
+                            normal_sum += prev_vertex_normals[nbidx];
+                        }
+                        if (filter_color) {
+                            color_sum += prev_vertex_colors[nbidx];
+                        }
+                    }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        (prev_vertex_normals[vidx] + normal_sum) /
-                        (1 + nb_size);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        (prev_vertex_colors[vidx] + color_sum) / (1 + nb_size);
-            }
-        }
+                    int nb_size = adjacency_offsets[vidx + 1] -
+                                  adjacency_offsets[vidx];
+                    if (filter_vertex) {
+                        mesh->vertices_[vidx] =
+                                (prev_vertices[vidx] + vertex_sum) /
+                                (1 + nb_size);
+                    }
+                    if (filter_normal) {
+                        mesh->vertex_normals_[vidx] =
+                                (prev_vertex_normals[vidx] + normal_sum) /
+                                (1 + nb_size);
+                    }
+                    if (filter_color) {
+                        mesh->vertex_colors_[vidx] =
+                                (prev_vertex_colors[vidx] + color_sum) /
+                                (1 + nb_size);
+                    }
+                },
+                256);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -315,49 +388,58 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
         const std::vector<Eigen::Vector3d> &prev_vertices,
         const std::vector<Eigen::Vector3d> &prev_vertex_normals,
         const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
+        const std::vector<int> &adjacency_offsets,
+        const std::vector<int> &adjacency_neighbors,
         double lambda,
         bool filter_vertex,
         bool filter_normal,
         bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-        Eigen::Vector3d vertex_sum(0, 0, 0);
-        Eigen::Vector3d normal_sum(0, 0, 0);
-        Eigen::Vector3d color_sum(0, 0, 0);
-        double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
-            total_weight += weight;
-
-            if (filter_vertex) {
-                vertex_sum += weight * prev_vertices[nbidx];
-            }
-            if (filter_normal) {
-                normal_sum += weight * prev_vertex_normals[nbidx];
-            }
-            if (filter_color) {
-                color_sum += weight * prev_vertex_colors[nbidx];
-            }
-        }
+    utility::ParallelFor(
+            0, int64_t(mesh->vertices_.size()),
+            [&](int64_t vidx) {
+                Eigen::Vector3d vertex_sum(0, 0, 0);
+                Eigen::Vector3d normal_sum(0, 0, 0);
+                Eigen::Vector3d color_sum(0, 0, 0);
+                double total_weight = 0;
+                for (int k = adjacency_offsets[vidx];
+                     k < adjacency_offsets[vidx + 1]; ++k) {
+                    int nbidx = adjacency_neighbors[k];
+                    auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
+                    double dist = diff.norm();
+                    double weight = 1. / (dist + 1e-12);
+                    total_weight += weight;
+
+                    if (filter_vertex) {
+                        vertex_sum += weight * prev_vertices[nbidx];
+                    }
+                    if (filter_normal) {
+                        normal_sum += weight * prev_vertex_normals[nbidx];
+                    }
+                    if (filter_color) {
+                        color_sum += weight * prev_vertex_colors[nbidx];
+                    }
+                }
 
-        if (filter_vertex) {
-            mesh->vertices_[vidx] =
-                    prev_vertices[vidx] +
-                    lambda * (vertex_sum / total_weight - prev_vertices[vidx]);
-        }
-        if (filter_normal) {
-            mesh->vertex_normals_[vidx] = prev_vertex_normals[vidx] +
-                                          lambda * (normal_sum / total_weight -
-                                                    prev_vertex_normals[vidx]);
-        }
-        if (filter_color) {
-            mesh->vertex_colors_[vidx] = prev_vertex_colors[vidx] +
-                                         lambda * (color_sum / total_weight -
-                                                   prev_vertex_colors[vidx]);
-        }
-    }
+                if (filter_vertex) {
+                    mesh->vertices_[vidx] =
+                            prev_vertices[vidx] +
+                            lambda * (vertex_sum / total_weight -
+                                      prev_vertices[vidx]);
+                }
+                if (filter_normal) {
+                    mesh->vertex_normals_[vidx] =
+                            prev_vertex_normals[vidx] +
+                            lambda * (normal_sum / total_weight -
+                                      prev_vertex_normals[vidx]);
+                }
+                if (filter_color) {
+                    mesh->vertex_colors_[vidx] =
+                            prev_vertex_colors[vidx] +
+                            lambda * (color_sum / total_weight -
+                                      prev_vertex_colors[vidx]);
+                }
+            },
+            256);
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
@@ -376,20 +458,23 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
     if (!mesh->HasAdjacencyList()) {
         mesh->ComputeAdjacencyList();
     }
+    std::vector<int> adjacency_offsets, adjacency_neighbors;
+    AdjacencyListToCSR(mesh->adjacency_list_, adjacency_offsets,
+                       adjacency_neighbors);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency_offsets,
+                                    adjacency_neighbors, lambda, filter_vertex,
+                                    filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -418,26 +503,29 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
     if (!mesh->HasAdjacencyList()) {
         mesh->ComputeAdjacencyList();
     }
+    std::vector<int> adjacency_offsets, adjacency_neighbors;
+    AdjacencyListToCSR(mesh->adjacency_list_, adjacency_offsets,
+                       adjacency_neighbors);
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency_offsets,
+                                    adjacency_neighbors, lambda, filter_vertex,
+                                    filter_normal, filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency_offsets,
+                                    adjacency_neighbors, mu, filter_vertex,
+                                    filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -585,9 +673,68 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
                                  (2 * std::sqrt(3.)));
     double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
 
-    std::vector<double> weights(pcl->points_.size());
-    std::vector<bool> deleted(pcl->points_.size(), false);
-    KDTreeFlann kdtree(*pcl);
+    const std::vector<Eigen::Vector3d> &points = pcl->points_;
+    int64_t num_points = int64_t(points.size());
+    double r_max2 = r_max * r_max;
+
+    // Hash the samples into a grid of cells of size r_max, so that the
+    // neighbours of a sample lie in the 3x3x3 cells around its own. The grid
+    // is stored as the sample indices sorted by cell key.
+    Eigen::Vector3d min_bound = pcl->GetMinBound();
+    Eigen::Array3d extent = (pcl->GetMaxBound() - min_bound).array() / r_max;
+    if ((extent + 1).prod() > double(std::numeric_limits<int64_t>::max())) {
+        utility::LogError(
+                "[SamplePointsPoissonDisk] The mesh is too large for the "
+                "number of points.");
+    }
+    Eigen::Array<int64_t, 3, 1> dims = extent.floor().cast<int64_t>() + 1;
+    auto CellOf = [&](const Eigen::Vector3d &p) {
+        return (((p - min_bound) / r_max).array().floor().cast<int64_t>())
+                .min(dims - 1)
+                .eval();
+    };
+    auto KeyOf = [&](const Eigen::Array<int64_t, 3, 1> &cell) {
+        return (cell(0) * dims(1) + cell(1)) * dims(2) + cell(2);
+    };
+    std::vector<int64_t> keys(num_points);
+    utility::ParallelFor(0, num_points, [&](int64_t i) {
+        keys[i] = KeyOf(CellOf(points[i]));
+    });
+    std::vector<int> order(num_points);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int a, int b) {
+        return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+    });
+    std::vector<int64_t> sorted_keys(num_points);
+    utility::ParallelFor(0, num_points,
+                         [&](int64_t i) { sorted_keys[i] = keys[order[i]]; });
+
+    // Calls f(pidx1, dist2) for the other samples within r_max of pidx0.
+    auto ForEachNeighbor = [&](int pidx0, const auto &f) {
+        const Eigen::Vector3d &p0 = points[pidx0];
+        Eigen::Array<int64_t, 3, 1> cell0 = CellOf(p0);
+        Eigen::Array<int64_t, 3, 1> cell;
+        for (cell(0) = cell0(0) - 1; cell(0) <= cell0(0) + 1; ++cell(0)) {
+            for (cell(1) = cell0(1) - 1; cell(1) <= cell0(1) + 1; ++cell(1)) {
+                for (cell(2) = cell0(2) - 1; cell(2) <= cell0(2) + 1;
+                     ++cell(2)) {
+                    if ((cell < 0).any() || (cell >= dims).any()) {
+                        continue;
+                    }
+                    auto range = std::equal_range(sorted_keys.begin(),
+                                                  sorted_keys.end(),
+                                                  KeyOf(cell));
+                    for (auto it = range.first; it != range.second; ++it) {
+                        int pidx1 = order[it - sorted_keys.begin()];
+                        double dist2 = (points[pidx1] - p0).squaredNorm();
+                        if (pidx1 != pidx0 && dist2 <= r_max2) {
+                            f(pidx1, dist2);
+                        }
+                    }
+                }
+            }
+        }
+    };
 
     auto WeightFcn = [&](double d2) {
         double d = std::sqrt(d2);
@@ -597,37 +744,28 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         return std::pow(1 - d / r_max, alpha);
     };
 
-    auto ComputePointWeight = [&](int pidx0) {
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
-        double weight = 0;
-        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
-                continue;
-            }
-            weight += WeightFcn(dists2[nbidx]);
-        }
-
-        weights[pidx0] = weight;
-    };
-
     // init weights and priority queue
+    std::vector<double> weights(num_points, 0);
+    utility::ParallelFor(0, num_points, [&](int64_t pidx0) {
+        ForEachNeighbor(int(pidx0), [&](int, double dist2) {
+            weights[pidx0] += WeightFcn(dist2);
+        });
+    });
     typedef std::tuple<int, double> QueueEntry;
     auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
         return std::get<1>(a) < std::get<1>(b);
     };
+    std::vector<QueueEntry> entries(num_points);
+    utility::ParallelFor(0, num_points, [&](int64_t pidx0) {
+        entries[pidx0] = QueueEntry(int(pidx0), weights[pidx0]);
+    });
     std::priority_queue<QueueEntry, std::vector<QueueEntry>,
                         decltype(WeightCmp)>
-            queue(WeightCmp);
-    for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
-        queue.push(QueueEntry(int(pidx0), weights[pidx0]));
-    };
+            queue(WeightCmp, std::move(entries));
 
-    // sample elimination
+    // sample elimination, removing the contribution of each deleted sample
+    // from the weights of its neighbours
+    std::vector<bool> deleted(num_points, false);
     size_t current_number_of_points = pcl->points_.size();
     while (current_number_of_points > number_of_points) {
         int pidx;
@@ -645,13 +783,12 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         current_number_of_points--;
 
         // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
-            queue.push(QueueEntry(nb, weights[nb]));
-        }
+        ForEachNeighbor(pidx, [&](int nb, double dist2) {
+            if (!deleted[nb]) {
+                weights[nb] -= WeightFcn(dist2);
+                queue.push(QueueEntry(nb, weights[nb]));
+            }
+        });
     }
 
     // update pcl
@@ -681,38 +818,106 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     return pcl;
 }
 
-TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t, utility::hash_tuple<Coordinate3>>
-            point_to_old_index;
-    std::vector<int> index_old_to_new(vertices_.size());
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
-    size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
+/// Returns the indices i with keep[i] != 0 in ascending order, and sets
+/// new_index[i] to the position of i among them, or to -1 if i is dropped.
+static std::vector<int> CompactIndices(const std::vector<int> &keep,
+                                       std::vector<int> &new_index) {
+    int64_t n = static_cast<int64_t>(keep.size());
+    std::vector<int> position(n);
+    utility::InclusivePrefixSum(keep.data(), keep.data() + n, position.data());
+    std::vector<int> kept(n > 0 ? position.back() : 0);
+    new_index.resize(n);
+    utility::ParallelFor(0, n, [&](int64_t i) {
+        if (keep[i]) {
+            new_index[i] = position[i] - 1;
+            kept[position[i] - 1] = static_cast<int>(i);
         } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
+            new_index[i] = -1;
         }
-    }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
-    if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
-            triangle(0) = index_old_to_new[triangle(0)];
-            triangle(1) = index_old_to_new[triangle(1)];
-            triangle(2) = index_old_to_new[triangle(2)];
+    });
+    return kept;
+}
+
+/// Replaces \p values by values[kept[0]], values[kept[1]], ...
+template <typename T>
+static void SelectIndices(std::vector<T> &values,
+                          const std::vector<int> &kept) {
+    std::vector<T> selected(kept.size());
+    utility::ParallelFor(0, static_cast<int64_t>(kept.size()),
+                         [&](int64_t i) { selected[i] = values[kept[i]]; });
+    values.swap(selected);
+}
+
+/// Replaces each vertex index v of \p triangles by vertex_map[v].
+static void RemapTriangles(std::vector<Eigen::Vector3i> &triangles,
+                           const std::vector<int> &vertex_map) {
+    utility::ParallelFor(0, static_cast<int64_t>(triangles.size()),
+                         [&](int64_t i) {
+                             Eigen::Vector3i &triangle = triangles[i];
+                             triangle(0) = vertex_map[triangle(0)];
+                             triangle(1) = vertex_map[triangle(1)];
+                             triangle(2) = vertex_map[triangle(2)];
+                         });
+}
+
+TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
+    int64_t old_vertex_num = static_cast<int64_t>(vertices_.size());
+    auto has_nan = [this](int64_t i) {
+        return std::isnan(vertices_[i](0)) || std::isnan(vertices_[i](1)) ||
+               std::isnan(vertices_[i](2));
+    };
+    auto equal = [this](int64_t a, int64_t b) {
+        return vertices_[a](0) == vertices_[b](0) &&
+               vertices_[a](1) == vertices_[b](1) &&
+               vertices_[a](2) == vertices_[b](2);
+    };
+
+    // Sort the vertices, ties broken by index so that each run of equal
+    // vertices starts with the first of them. A NaN coordinate never compares
+    // equal, so such vertices are sorted last and are never merged.
+    std::vector<int> order(old_vertex_num);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int a, int b) {
+        bool a_has_nan = has_nan(a), b_has_nan = has_nan(b);
+        if (a_has_nan || b_has_nan) {
+            return a_has_nan == b_has_nan ? a < b : b_has_nan;
+        }
+        for (int k = 0; k < 3; ++k) {
+            if (vertices_[a](k) != vertices_[b](k)) {
+                return vertices_[a](k) < vertices_[b](k);
+            }
+        }
+        return a < b;
+    });
+
+    // first_of[i] is the first vertex equal to vertex i.
+    std::vector<int> keep(old_vertex_num);
+    std::vector<int> first_of(old_vertex_num);
+    utility::ParallelFor(0, old_vertex_num, [&](int64_t i) {
+        keep[order[i]] = i == 0 || !equal(order[i - 1], order[i]);
+    });
+    // Runs are short, so each one is walked by the thread owning its start.
+    utility::ParallelFor(0, old_vertex_num, [&](int64_t i) {
+        if (keep[order[i]]) {
+            for (int64_t j = i; j < old_vertex_num &&
+                                (j == i || !keep[order[j]]);
+                 ++j) {
+                first_of[order[j]] = order[i];
+            }
         }
+    });
+
+    std::vector<int> index_old_to_new;
+    std::vector<int> kept = CompactIndices(keep, index_old_to_new);
+    size_t k = kept.size();
+    if (static_cast<int64_t>(k) < old_vertex_num) {
+        utility::ParallelFor(0, old_vertex_num, [&](int64_t i) {
+            index_old_to_new[i] = index_old_to_new[first_of[i]];
+        });
+        if (HasVertexNormals()) SelectIndices(vertex_normals_, kept);
+        if (HasVertexColors()) SelectIndices(vertex_colors_, kept);
+        SelectIndices(vertices_, kept);
+        RemapTriangles(triangles_, index_old_to_new);
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -777,37 +982,22 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
 }
 
 TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
-    std::vector<bool> vertex_has_reference(vertices_.size(), false);
+    std::vector<int> vertex_has_reference(vertices_.size(), 0);
     for (const auto &triangle : triangles_) {
-        vertex_has_reference[triangle(0)] = true;
-        vertex_has_reference[triangle(1)] = true;
-        vertex_has_reference[triangle(2)] = true;
+        vertex_has_reference[triangle(0)] = 1;
+        vertex_has_reference[triangle(1)] = 1;
+        vertex_has_reference[triangle(2)] = 1;
     }
-    std::vector<int> index_old_to_new(vertices_.size());
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
     size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        if (vertex_has_reference[i]) {
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
-        } else {
-            index_old_to_new[i] = -1;
-        }
-    }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
+    std::vector<int> index_old_to_new;
+    std::vector<int> kept =
+            CompactIndices(vertex_has_reference, index_old_to_new);
+    size_t k = kept.size();
     if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
-            triangle(0) = index_old_to_new[triangle(0)];
-            triangle(1) = index_old_to_new[triangle(1)];
-            triangle(2) = index_old_to_new[triangle(2)];
-        }
+        if (HasVertexNormals()) SelectIndices(vertex_normals_, kept);
+        if (HasVertexColors()) SelectIndices(vertex_colors_, kept);
+        SelectIndices(vertices_, kept);
+        RemapTriangles(triangles_, index_old_to_new);
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -825,23 +1015,23 @@ TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
                 "[RemoveDegenerateTriangles] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
-    bool has_tri_normal = HasTriangleNormals();
     size_t old_triangle_num = triangles_.size();
-    size_t k = 0;
-    for (size_t i = 0; i < old_triangle_num; i++) {
+    std::vector<int> keep(old_triangle_num);
+    utility::ParallelFor(0, (int64_t)old_triangle_num, [&](int64_t i) {
         const auto &triangle = triangles_[i];
-        if (triangle(0) != triangle(1) && triangle(1) != triangle(2) &&
-            triangle(2) != triangle(0)) {
-            triangles_[k] = triangles_[i];
-            if (has_tri_normal) triangle_normals_[k] = triangle_normals_[i];
-            k++;
+        keep[i] = triangle(0) != triangle(1) && triangle(1) != triangle(2) &&
+                  triangle(2) != triangle(0);
+    });
+    std::vector<int> index_old_to_new;
+    std::vector<int> kept = CompactIndices(keep, index_old_to_new);
+    size_t k = kept.size();
+    if (k < old_triangle_num) {
+        if (HasTriangleNormals()) SelectIndices(triangle_normals_, kept);
+        SelectIndices(triangles_, kept);
+        if (HasAdjacencyList()) {
+            ComputeAdjacencyList();
         }
     }
-    triangles_.resize(k);
-    if (has_tri_normal) triangle_normals_.resize(k);
-    if (k < old_triangle_num && HasAdjacencyList()) {
-        ComputeAdjacencyList();
-    }
     utility::LogDebug(
             "[RemoveDegenerateTriangles] {:d} triangles have been "
             "removed.",
@@ -934,58 +1124,57 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     // precompute all neighbours
     utility::LogDebug("Precompute Neighbours");
     std::vector<std::vector<int>> nbs(vertices_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(vertices_.size()); ++idx) {
+    utility::ParallelFor(0, (int64_t)vertices_.size(), [&](int64_t idx) {
         std::vector<double> dists2;
         kdtree.SearchRadius(vertices_[idx], eps, nbs[idx], dists2);
-    }
+    });
     utility::LogDebug("Done Precompute Neighbours");
 
-    bool has_vertex_normals = HasVertexNormals();
-    bool has_vertex_colors = HasVertexColors();
-    std::vector<Eigen::Vector3d> new_vertices;
-    std::vector<Eigen::Vector3d> new_vertex_normals;
-    std::vector<Eigen::Vector3d> new_vertex_colors;
-    std::unordered_map<int, int> new_vert_mapping;
+    // Greedily assign each unassigned vertex and its unassigned neighbours to
+    // a new vertex. This pass is sequential since the assignment depends on
+    // the earlier ones; the members are averaged in parallel below.
+    std::vector<int> new_vert_mapping(vertices_.size(), -1);
+    std::vector<int> group_offsets(1, 0);
+    std::vector<int> group_members;
+    group_members.reserve(vertices_.size());
     for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        if (new_vert_mapping.count(vidx) > 0) {
+        if (new_vert_mapping[vidx] >= 0) {
             continue;
         }
-
-        int new_vidx = int(new_vertices.size());
+        int new_vidx = int(group_offsets.size()) - 1;
         new_vert_mapping[vidx] = new_vidx;
-
-        Eigen::Vector3d vertex = vertices_[vidx];
-        Eigen::Vector3d normal;
-        if (has_vertex_normals) {
-            normal = vertex_normals_[vidx];
-        }
-        Eigen::Vector3d color;
-        if (has_vertex_colors) {
-            color = vertex_colors_[vidx];
-        }
-        int n = 1;
+        group_members.push_back(vidx);
         for (int nb : nbs[vidx]) {
-            if (vidx == nb || new_vert_mapping.count(nb) > 0) {
-                continue;
+            if (new_vert_mapping[nb] < 0) {
+                new_vert_mapping[nb] = new_vidx;
+                group_members.push_back(nb);
             }
-            vertex += vertices_[nb];
-            if (has_vertex_normals) {
-                normal += vertex_normals_[nb];
-            }
-            if (has_vertex_colors) {
-                color += vertex_colors_[nb];
-            }
-            new_vert_mapping[nb] = new_vidx;
-            n += 1;
-        }
-        new_vertices.push_back(vertex / n);
-        if (has_vertex_normals) {
-            new_vertex_normals.push_back(normal / n);
-        }
-        if (has_vertex_colors) {
-            new_vertex_colors.push_back(color / n);
         }
+        group_offsets.push_back(int(group_members.size()));
+    }
+    int64_t num_new_vertices = int64_t(group_offsets.size()) - 1;
+
+    bool has_vertex_normals = HasVertexNormals();
+    bool has_vertex_colors = HasVertexColors();
+    auto average = [&](const std::vector<Eigen::Vector3d> &values) {
+        std::vector<Eigen::Vector3d> averages(num_new_vertices);
+        utility::ParallelFor(0, num_new_vertices, [&](int64_t g) {
+            Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+            for (int m = group_offsets[g]; m < group_offsets[g + 1]; ++m) {
+                sum += values[group_members[m]];
+            }
+            averages[g] = sum / (group_offsets[g + 1] - group_offsets[g]);
+        });
+        return averages;
+    };
+    std::vector<Eigen::Vector3d> new_vertices = average(vertices_);
+    std::vector<Eigen::Vector3d> new_vertex_normals;
+    std::vector<Eigen::Vector3d> new_vertex_colors;
+    if (has_vertex_normals) {
+        new_vertex_normals = average(vertex_normals_);
+    }
+    if (has_vertex_colors) {
+        new_vertex_colors = average(vertex_colors_);
     }
     utility::LogDebug("Merged {} vertices",
                       vertices_.size() - new_vertices.size());
@@ -994,11 +1183,7 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     std::swap(vertex_normals_, new_vertex_normals);
     std::swap(vertex_colors_, new_vertex_colors);
 
-    for (auto &triangle : triangles_) {
-        triangle(0) = new_vert_mapping[triangle(0)];
-        triangle(1) = new_vert_mapping[triangle(1)];
-        triangle(2) = new_vert_mapping[triangle(2)];
-    }
+    RemapTriangles(triangles_, new_vert_mapping);
 
     if (HasTriangleNormals()) {
         ComputeTriangleNormals();
@@ -1128,42 +1313,69 @@ bool TriangleMesh::OrientTriangles() {
     return OrientTriangleHelper(triangles_, SwapTriangleOrder);
 }
 
+std::shared_ptr<const MeshAdjacency> TriangleMesh::GetMeshAdjacency() const {
+    return derived_data_.Get<MeshAdjacency>(
+            "mesh_adjacency",
+            DerivedDataCache::Fingerprint(triangles_, vertices_.size()),
+            [this]() {
+                return std::make_shared<MeshAdjacency>(triangles_,
+                                                       vertices_.size());
+            });
+}
+
 std::unordered_map<Eigen::Vector2i,
                    std::vector<int>,
                    utility::hash_eigen<Eigen::Vector2i>>
 TriangleMesh::GetEdgeToTrianglesMap() const {
-    std::unordered_map<Eigen::Vector2i, std::vector<int>,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            trias_per_edge;
-    auto AddEdge = [&](int vidx0, int vidx1, int tidx) {
-        trias_per_edge[GetOrderedEdge(vidx0, vidx1)].push_back(tidx);
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        AddEdge(triangle(0), triangle(1), int(tidx));
-        AddEdge(triangle(1), triangle(2), int(tidx));
-        AddEdge(triangle(2), triangle(0), int(tidx));
-    }
-    return trias_per_edge;
+    using EdgeMap = std::unordered_map<Eigen::Vector2i, std::vector<int>,
+                                       utility::hash_eigen<Eigen::Vector2i>>;
+    return *derived_data_.Get<EdgeMap>(
+            "edge_to_triangles_map",
+            DerivedDataCache::Fingerprint(triangles_, vertices_.size()),
+            [this]() {
+                auto adjacency_ptr = GetMeshAdjacency();
+                const MeshAdjacency &adjacency = *adjacency_ptr;
+                auto trias_per_edge =
+                        std::make_shared<EdgeMap>(adjacency.NumEdges());
+                for (int edge = 0; edge < int(adjacency.NumEdges()); ++edge) {
+                    std::vector<int> &trias =
+                            (*trias_per_edge)[adjacency.GetEdge(edge)];
+                    trias.reserve(adjacency.EdgeDegree(edge));
+                    for (const int *it = adjacency.EdgeHalfEdgesBegin(edge);
+                         it != adjacency.EdgeHalfEdgesEnd(edge); ++it) {
+                        trias.push_back(MeshAdjacency::HalfEdgeTriangle(*it));
+                    }
+                }
+                return trias_per_edge;
+            });
 }
 
 std::unordered_map<Eigen::Vector2i,
                    std::vector<int>,
                    utility::hash_eigen<Eigen::Vector2i>>
 TriangleMesh::GetEdgeToVerticesMap() const {
-    std::unordered_map<Eigen::Vector2i, std::vector<int>,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            trias_per_edge;
-    auto AddEdge = [&](int vidx0, int vidx1, int vidx2) {
-        trias_per_edge[GetOrderedEdge(vidx0, vidx1)].push_back(vidx2);
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        AddEdge(triangle(0), triangle(1), triangle(2));
-        AddEdge(triangle(1), triangle(2), triangle(0));
-        AddEdge(triangle(2), triangle(0), triangle(1));
-    }
-    return trias_per_edge;
+    using EdgeMap = std::unordered_map<Eigen::Vector2i, std::vector<int>,
+                                       utility::hash_eigen<Eigen::Vector2i>>;
+    return *derived_data_.Get<EdgeMap>(
+            "edge_to_vertices_map",
+            DerivedDataCache::Fingerprint(triangles_, vertices_.size()),
+            [this]() {
+                auto adjacency_ptr = GetMeshAdjacency();
+                const MeshAdjacency &adjacency = *adjacency_ptr;
+                auto verts_per_edge =
+                        std::make_shared<EdgeMap>(adjacency.NumEdges());
+                for (int edge = 0; edge < int(adjacency.NumEdges()); ++edge) {
+                    std::vector<int> &verts =
+                            (*verts_per_edge)[adjacency.GetEdge(edge)];
+                    verts.reserve(adjacency.EdgeDegree(edge));
+                    for (const int *it = adjacency.EdgeHalfEdgesBegin(edge);
+                         it != adjacency.EdgeHalfEdgesEnd(edge); ++it) {
+                        verts.push_back(adjacency.HalfEdgeSource(
+                                MeshAdjacency::PrevHalfEdge(*it)));
+                    }
+                }
+                return verts_per_edge;
+            });
 }
 
 double TriangleMesh::ComputeTriangleArea(const Eigen::Vector3d &p0,
@@ -1277,13 +1489,14 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    auto adjacency_ptr = GetMeshAdjacency();
+    const MeshAdjacency &adjacency = *adjacency_ptr;
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (int edge = 0; edge < int(adjacency.NumEdges()); ++edge) {
+        int degree = adjacency.EdgeDegree(edge);
+        if ((allow_boundary_edges && (degree < 1 || degree > 2)) ||
+            (!allow_boundary_edges && degree != 2)) {
+            non_manifold_edges.push_back(adjacency.GetEdge(edge));
         }
     }
     return non_manifold_edges;
@@ -1291,11 +1504,12 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
+    auto adjacency_ptr = GetMeshAdjacency();
+    const MeshAdjacency &adjacency = *adjacency_ptr;
+    for (int edge = 0; edge < int(adjacency.NumEdges()); ++edge) {
+        int degree = adjacency.EdgeDegree(edge);
+        if ((allow_boundary_edges && (degree < 1 || degree > 2)) ||
+            (!allow_boundary_edges && degree != 2)) {
             return false;
         }
     }
@@ -1303,58 +1517,19 @@ bool TriangleMesh::IsEdgeManifold(
 }
 
 std::vector<int> TriangleMesh::GetNonManifoldVertices() const {
-    std::vector<std::unordered_set<int>> vert_to_triangles(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &tria = triangles_[tidx];
-        vert_to_triangles[tria(0)].emplace(int(tidx));
-        vert_to_triangles[tria(1)].emplace(int(tidx));
-        vert_to_triangles[tria(2)].emplace(int(tidx));
-    }
+    auto adjacency_ptr = GetMeshAdjacency();
+    const MeshAdjacency &adjacency = *adjacency_ptr;
+    std::vector<uint8_t> is_manifold(vertices_.size());
+    utility::ParallelFor(0, int64_t(vertices_.size()), [&](int64_t vidx) {
+        is_manifold[vidx] = adjacency.IsVertexManifold(int(vidx));
+    });
 
     std::vector<int> non_manifold_verts;
     for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        const auto &triangles = vert_to_triangles[vidx];
-        if (triangles.size() == 0) {
-            continue;
-        }
-
-        // collect edges and vertices
-        std::unordered_map<int, std::unordered_set<int>> edges;
-        for (int tidx : triangles) {
-            const auto &triangle = triangles_[tidx];
-            if (triangle(0) != vidx && triangle(1) != vidx) {
-                edges[triangle(0)].emplace(triangle(1));
-                edges[triangle(1)].emplace(triangle(0));
-            } else if (triangle(0) != vidx && triangle(2) != vidx) {
-                edges[triangle(0)].emplace(triangle(2));
-                edges[triangle(2)].emplace(triangle(0));
-            } else if (triangle(1) != vidx && triangle(2) != vidx) {
-                edges[triangle(1)].emplace(triangle(2));
-                edges[triangle(2)].emplace(triangle(1));
-            }
-        }
-
-        // test if vertices are connected
-        std::queue<int> next;
-        std::unordered_set<int> visited;
-        next.push(edges.begin()->first);
-        visited.emplace(edges.begin()->first);
-        while (!next.empty()) {
-            int vert = next.front();
-            next.pop();
-
-            for (auto nb : edges[vert]) {
-                if (visited.count(nb) == 0) {
-                    visited.emplace(nb);
-                    next.emplace(nb);
-                }
-            }
-        }
-        if (visited.size() != edges.size()) {
+        if (!is_manifold[vidx]) {
             non_manifold_verts.push_back(vidx);
         }
     }
-
     return non_manifold_verts;
 }
 
@@ -1364,31 +1539,47 @@ bool TriangleMesh::IsVertexManifold() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
+    // Only the pairs with overlapping bounds are tested, each one from its
+    // first triangle. The pairs are in the same order as with a test of all
+    // pairs.
+    TriangleMeshBVH bvh(*this);
+    std::vector<std::vector<int>> intersecting(triangles_.size());
+    utility::ParallelFor(0, int64_t(triangles_.size()), [&](int64_t tidx0) {
         const Eigen::Vector3i &tria_p = triangles_[tidx0];
         const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
         const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
         const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
+        bvh.QueryAABB(
+                p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                [&](int tidx1) {
+                    const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                    // check if neighbour triangle
+                    if (tidx1 <= tidx0 || tria_p(0) == tria_q(0) ||
+                        tria_p(0) == tria_q(1) || tria_p(0) == tria_q(2) ||
+                        tria_p(1) == tria_q(0) || tria_p(1) == tria_q(1) ||
+                        tria_p(1) == tria_q(2) || tria_p(2) == tria_q(0) ||
+                        tria_p(2) == tria_q(1) || tria_p(2) == tria_q(2)) {
+                        return true;
+                    }
 
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
+                    // check for intersection
+                    const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
+                    const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
+                    const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
+                    if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0,
+                                                             q1, q2)) {
+                        intersecting[tidx0].push_back(tidx1);
+                    }
+                    return true;
+                });
+        std::sort(intersecting[tidx0].begin(), intersecting[tidx0].end());
+    });
+
+    std::vector<Eigen::Vector2i> self_intersecting_triangles;
+    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
+        for (int tidx1 : intersecting[tidx0]) {
+            self_intersecting_triangles.push_back(
+                    Eigen::Vector2i(int(tidx0), tidx1));
         }
     }
     return self_intersecting_triangles;
@@ -1407,19 +1598,24 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
+    TriangleMeshBVH other_bvh(other);
     for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
         const Eigen::Vector3i &tria_p = triangles_[tidx0];
         const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
         const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
         const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
+        bool completed = other_bvh.QueryAABB(
+                p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                [&](int tidx1) {
+                    const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
+                    const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
+                    const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
+                    const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
+                    return !IntersectionTest::TriangleTriangle3d(p0, p1, p2,
+                                                                 q0, q1, q2);
+                });
+        if (!completed) {
+            return true;
         }
     }
     return false;
@@ -1427,67 +1623,52 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
 TriangleMesh::ClusterConnectedTriangles() const {
-    std::vector<int> triangle_clusters(triangles_.size(), -1);
+    const int num_tris = int(triangles_.size());
+    auto adjacency_ptr = GetMeshAdjacency();
+    const MeshAdjacency &adjacency = *adjacency_ptr;
+
+    // Triangles along the same edge are joined with their first one.
+    ConcurrentDisjointSets sets(num_tris);
+    utility::ParallelFor(
+            0, int64_t(adjacency.NumEdges()),
+            [&](int64_t edge) {
+                const int *begin = adjacency.EdgeHalfEdgesBegin(int(edge));
+                const int *end = adjacency.EdgeHalfEdgesEnd(int(edge));
+                for (const int *it = begin + 1; it < end; ++it) {
+                    sets.Union(MeshAdjacency::HalfEdgeTriangle(*begin),
+                               MeshAdjacency::HalfEdgeTriangle(*it));
+                }
+            },
+            256);
+
+    std::vector<int> triangle_clusters(num_tris);
+    std::vector<double> triangle_areas(num_tris);
+    utility::ParallelFor(0, int64_t(num_tris), [&](int64_t tidx) {
+        triangle_clusters[tidx] = sets.Find(int(tidx));
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    });
+
+    // The root of a cluster is its first triangle, so numbering the roots in
+    // order gives the cluster indices of a breadth-first search. The
+    // statistics are accumulated in the same pass.
     std::vector<size_t> num_triangles;
     std::vector<double> areas;
-
-    utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#pragma omp parallel for schedule(static)
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-    }
-    utility::LogDebug(
-            "[ClusterConnectedTriangles] Done computing triangle adjacency");
-
-    int cluster_idx = 0;
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        if (triangle_clusters[tidx] != -1) {
-            continue;
-        }
-
-        std::queue<int> triangle_queue;
-        int cluster_n_triangles = 0;
-        double cluster_area = 0;
-
-        triangle_queue.push(tidx);
-        triangle_clusters[tidx] = cluster_idx;
-        while (!triangle_queue.empty()) {
-            int cluster_tidx = triangle_queue.front();
-            triangle_queue.pop();
-
-            cluster_n_triangles++;
-            cluster_area += GetTriangleArea(cluster_tidx);
-
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
-                }
-            }
+    for (int tidx = 0; tidx < num_tris; ++tidx) {
+        int root = triangle_clusters[tidx];
+        if (root == tidx) {
+            triangle_clusters[tidx] = int(num_triangles.size());
+            num_triangles.push_back(0);
+            areas.push_back(0);
+        } else {
+            triangle_clusters[tidx] = triangle_clusters[root];
         }
-
-        num_triangles.push_back(cluster_n_triangles);
-        areas.push_back(cluster_area);
-        cluster_idx++;
+        num_triangles[triangle_clusters[tidx]]++;
+        areas[triangle_clusters[tidx]] += triangle_areas[tidx];
     }
 
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done clustering, #clusters={}",
-            cluster_idx);
+            num_triangles.size());
     return std::make_tuple(triangle_clusters, num_triangles, areas);
 }
 
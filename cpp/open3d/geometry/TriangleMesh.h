@@ -29,9 +29,11 @@
 #include <Eigen/Core>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "open3d/geometry/Image.h"
@@ -41,9 +43,70 @@
 namespace open3d {
 namespace geometry {
 
+class MeshAdjacency;
 class PointCloud;
 class TetraMesh;
 
+/// \class DeformAsRigidAsPossibleCache
+///
+/// \brief Factorized system of TriangleMesh::DeformAsRigidAsPossible, reused
+/// across calls with the same constraint vertex indices.
+///
+/// The system only depends on the mesh and on which vertices are constrained,
+/// not on the constraint positions, so deforming the same mesh with handles
+/// moved around only factorizes it once. The cache is rebuilt when the mesh
+/// or the constraint vertex indices change.
+class DeformAsRigidAsPossibleCache {
+public:
+    DeformAsRigidAsPossibleCache();
+    ~DeformAsRigidAsPossibleCache();
+    DeformAsRigidAsPossibleCache(const DeformAsRigidAsPossibleCache &) = delete;
+    DeformAsRigidAsPossibleCache &operator=(
+            const DeformAsRigidAsPossibleCache &) = delete;
+
+    /// Discards the cached system.
+    void Clear();
+    /// Returns true if no system is cached.
+    bool IsEmpty() const;
+
+private:
+    friend class TriangleMesh;
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \class AlphaShapeCache
+///
+/// \brief Delaunay tetrahedralization of a point cloud and the alpha interval
+/// of each of its faces, reused by TriangleMesh::CreateFromPointCloudAlphaShape
+/// across alpha values.
+///
+/// A face belongs to the alpha shape iff alpha is at least the smallest and
+/// below the second smallest circumradius of its tetrahedra. The faces are
+/// sorted by the lower end of their interval, so that extracting a shape only
+/// visits the faces that may belong to it. The cache is rebuilt when the
+/// points change.
+class AlphaShapeCache {
+public:
+    AlphaShapeCache();
+    ~AlphaShapeCache();
+    AlphaShapeCache(const AlphaShapeCache &) = delete;
+    AlphaShapeCache &operator=(const AlphaShapeCache &) = delete;
+
+    /// Discards the cached tetrahedralization.
+    void Clear();
+    /// Returns true if no tetrahedralization is cached.
+    bool IsEmpty() const;
+    /// Returns the sorted alpha values at which the alpha shape changes, i.e.
+    /// the distinct ends of the face intervals. Empty if IsEmpty().
+    std::vector<double> GetAlphaSpectrum() const;
+
+private:
+    friend class TriangleMesh;
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 /// \class TriangleMesh
 ///
 /// \brief Triangle mesh contains vertices and triangles represented by the
@@ -258,7 +321,7 @@ public:
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Tests the triangle pairs with overlapping bounds for intersection.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -430,6 +493,22 @@ public:
             double maximum_error,
             double boundary_weight) const;
 
+    /// Parallel variant of SimplifyQuadricDecimation. Instead of collapsing
+    /// one edge at a time, it collapses in each round a set of independent
+    /// edges among the cheapest candidates in parallel. Hence, the result
+    /// differs slightly from the sequential version.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error defines the maximum error where a vertex is allowed
+    /// to be merged
+    /// \param boundary_weight a weight applied to edge vertices used to
+    /// preserve boundaries
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles,
+            double maximum_error,
+            double boundary_weight) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
@@ -458,6 +537,9 @@ public:
     /// \brief Function that clusters connected triangles, i.e., triangles that
     /// are connected via edges are assigned the same cluster index.
     ///
+    /// The clusters are the connected components of a parallel union-find
+    /// over the shared edges, numbered in the order of their first triangle.
+    ///
     /// \return A vector that contains the cluster index per
     /// triangle, a second vector contains the number of triangles per
     /// cluster, and a third vector contains the surface area per cluster.
@@ -517,6 +599,19 @@ public:
                     DeformAsRigidAsPossibleEnergy::Spokes,
             double smoothed_alpha = 0.01) const;
 
+    /// \brief Same as above, but reuses the system factorized in \p cache by
+    /// a previous call with the same mesh and constraint vertex indices.
+    ///
+    /// \param cache Cache of the factorized system, updated if it does not
+    /// match the mesh or the constraint vertex indices.
+    std::shared_ptr<TriangleMesh> DeformAsRigidAsPossible(
+            const std::vector<int> &constraint_vertex_indices,
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+            size_t max_iter,
+            DeformAsRigidAsPossibleEnergy energy,
+            double smoothed_alpha,
+            DeformAsRigidAsPossibleCache &cache) const;
+
     /// \brief Alpha shapes are a generalization of the convex hull. With
     /// decreasing alpha value the shape schrinks and creates cavities.
     /// See Edelsbrunner and Muecke, "Three-Dimensional Alpha Shapes", 1994.
@@ -534,6 +629,20 @@ public:
             std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
             std::vector<size_t> *pt_map = nullptr);
 
+    /// \brief Computes the alpha shape of \p pcd like the overload above,
+    /// reusing the tetrahedralization and the face intervals of \p cache.
+    ///
+    /// Sweeping alpha over the same point cloud only tetrahedralizes it once,
+    /// and each alpha value then costs a parallel pass over the faces whose
+    /// interval starts below it.
+    /// \param pcd PointCloud for what the alpha shape should be computed.
+    /// \param alpha parameter to control the shape.
+    /// \param cache Tetrahedralization of \p pcd, computed on first use and
+    /// whenever the points change.
+    /// \return TriangleMesh of the alpha shape.
+    static std::shared_ptr<TriangleMesh> CreateFromPointCloudAlphaShape(
+            const PointCloud &pcd, double alpha, AlphaShapeCache &cache);
+
     /// Function that computes a triangle mesh from an oriented PointCloud \p
     /// pcd. This implements the Ball Pivoting algorithm proposed in F.
     /// Bernardini et al., "The ball-pivoting algorithm for surface
@@ -542,7 +651,8 @@ public:
     /// Parallel Ball Pivoting Algorithm", 2014. The surface reconstruction is
     /// done by rolling a ball with a given radius (cf. \p radii) over the
     /// point cloud, whenever the ball touches three points a triangle is
-    /// created.
+    /// created. Large point clouds are split into spatial tiles that are
+    /// reconstructed in parallel and stitched together afterwards.
     /// \param pcd defines the PointCloud from which the TriangleMesh surface is
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
@@ -569,8 +679,16 @@ public:
     /// diameter of the cube used for reconstruction and the diameter of the
     /// samples' bounding cube. \param linear_fit If true, the reconstructor use
     /// linear interpolation to estimate the positions of iso-vertices.
-    /// \param n_threads Number of threads used for reconstruction. Set to -1
-    /// to automatically determine it.
+    /// \param n_threads Number of threads used for reconstruction, including
+    /// the linear solver. Set to -1 to automatically determine it.
+    /// \param max_memory_mb If positive, the reconstruction fails with an
+    /// error as soon as a stage leaves the process using more memory than
+    /// this, instead of running into an out-of-memory at a later stage.
+    /// \param temp_dir If not empty, the iso-surface is extracted out-of-core
+    /// into temporary files in this directory, instead of in memory next to
+    /// the octree.
+    /// \param compute_densities If false, the densities are not collected and
+    /// an empty vector is returned.
     /// \return The estimated TriangleMesh, and per vertex densitie values that
     /// can be used to to trim the mesh.
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -579,7 +697,28 @@ public:
                                 size_t width = 0,
                                 float scale = 1.1f,
                                 bool linear_fit = false,
-                                int n_threads = -1);
+                                int n_threads = -1,
+                                size_t max_memory_mb = 0,
+                                const std::string &temp_dir = "",
+                                bool compute_densities = true);
+
+    /// \brief Same as CreateFromPointCloudPoisson, and also returns the time
+    /// in seconds of each stage of the reconstruction, in the order they run:
+    /// read_samples, density_estimation, normal_field, finalize_tree,
+    /// fem_constraints, point_constraints, solve, iso_value, extract_mesh and
+    /// total.
+    static std::tuple<std::shared_ptr<TriangleMesh>,
+                      std::vector<double>,
+                      std::vector<std::pair<std::string, double>>>
+    CreateFromPointCloudPoissonWithTimings(const PointCloud &pcd,
+                                           size_t depth = 8,
+                                           size_t width = 0,
+                                           float scale = 1.1f,
+                                           bool linear_fit = false,
+                                           int n_threads = -1,
+                                           size_t max_memory_mb = 0,
+                                           const std::string &temp_dir = "",
+                                           bool compute_densities = true);
 
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \p radius defines the
@@ -744,12 +883,17 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
+    /// Returns the edge and vertex adjacency of the triangles, cached until
+    /// the triangles change.
+    std::shared_ptr<const MeshAdjacency> GetMeshAdjacency() const;
+
     void FilterSmoothLaplacianHelper(
             std::shared_ptr<TriangleMesh> &mesh,
             const std::vector<Eigen::Vector3d> &prev_vertices,
             const std::vector<Eigen::Vector3d> &prev_vertex_normals,
             const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
+            const std::vector<int> &adjacency_offsets,
+            const std::vector<int> &adjacency_neighbors,
             double lambda,
             bool filter_vertex,
             bool filter_normal,
@@ -0,0 +1,532 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of bins of the SAH split search along each axis.
+constexpr int kNumBins = 16;
+
+/// Cost of visiting an inner node relative to testing a triangle.
+constexpr double kTraversalCost = 1.0;
+
+double HalfSurfaceArea(const Eigen::Vector3d &min_bound,
+                       const Eigen::Vector3d &max_bound) {
+    Eigen::Vector3d extent = (max_bound - min_bound).cwiseMax(0.0);
+    return extent(0) * extent(1) + extent(1) * extent(2) +
+           extent(2) * extent(0);
+}
+
+/// Slab test of a ray against a box. Returns true if the ray enters the box
+/// before \p t_max, with the entry parameter in \p t_entry.
+bool IntersectRayAABB(const Eigen::Array3d &origin,
+                      const Eigen::Array3d &inv_direction,
+                      const Eigen::Vector3d &min_bound,
+                      const Eigen::Vector3d &max_bound,
+                      double t_max,
+                      double &t_entry) {
+    Eigen::Array3d t0 = (min_bound.array() - origin) * inv_direction;
+    Eigen::Array3d t1 = (max_bound.array() - origin) * inv_direction;
+    t_entry = std::max(t0.min(t1).maxCoeff(), 0.0);
+    double t_exit = std::min(t0.max(t1).minCoeff(), t_max);
+    return t_entry <= t_exit;
+}
+
+/// Two-sided ray triangle test of Moller and Trumbore, "Fast, Minimum Storage
+/// Ray/Triangle Intersection", 1997.
+bool IntersectRayTriangle(const Eigen::Vector3d &origin,
+                          const Eigen::Vector3d &direction,
+                          const Eigen::Vector3d &v0,
+                          const Eigen::Vector3d &v1,
+                          const Eigen::Vector3d &v2,
+                          double &t,
+                          double &u,
+                          double &v) {
+    Eigen::Vector3d e1 = v1 - v0;
+    Eigen::Vector3d e2 = v2 - v0;
+    Eigen::Vector3d p = direction.cross(e2);
+    double det = e1.dot(p);
+    if (det == 0) {
+        return false;
+    }
+    double inv_det = 1.0 / det;
+    Eigen::Vector3d s = origin - v0;
+    u = s.dot(p) * inv_det;
+    if (u < 0 || u > 1) {
+        return false;
+    }
+    Eigen::Vector3d q = s.cross(e1);
+    v = direction.dot(q) * inv_det;
+    if (v < 0 || u + v > 1) {
+        return false;
+    }
+    t = e2.dot(q) * inv_det;
+    return t >= 0;
+}
+
+/// Closest point to \p p on the triangle (\p a, \p b, \p c), by the Voronoi
+/// regions of the triangle, see Ericson, "Real-Time Collision Detection",
+/// 2004.
+Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d &p,
+                                       const Eigen::Vector3d &a,
+                                       const Eigen::Vector3d &b,
+                                       const Eigen::Vector3d &c) {
+    Eigen::Vector3d ab = b - a, ac = c - a, ap = p - a;
+    double d1 = ab.dot(ap), d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) {
+        return a;
+    }
+    Eigen::Vector3d bp = p - b;
+    double d3 = ab.dot(bp), d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) {
+        return b;
+    }
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        return d1 - d3 > 0 ? Eigen::Vector3d(a + d1 / (d1 - d3) * ab) : a;
+    }
+    Eigen::Vector3d cp = p - c;
+    double d5 = ab.dot(cp), d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) {
+        return c;
+    }
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        return d2 - d6 > 0 ? Eigen::Vector3d(a + d2 / (d2 - d6) * ac) : a;
+    }
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+        double denom = (d4 - d3) + (d5 - d6);
+        return denom > 0 ? Eigen::Vector3d(b + (d4 - d3) / denom * (c - b))
+                         : b;
+    }
+    double denom = va + vb + vc;
+    if (denom <= 0) {
+        return a;
+    }
+    return a + ab * (vb / denom) + ac * (vc / denom);
+}
+
+}  // unnamed namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh, int max_leaf_size)
+    : vertices_(mesh.vertices_), triangles_(mesh.triangles_) {
+    if (max_leaf_size < 1) {
+        utility::LogError("[TriangleMeshBVH] max_leaf_size must be positive.");
+    }
+    const int num_triangles = int(triangles_.size());
+    const int num_vertices = int(vertices_.size());
+    triangle_min_bounds_.resize(num_triangles);
+    triangle_max_bounds_.resize(num_triangles);
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        if ((triangle.array() < 0).any() ||
+            (triangle.array() >= num_vertices).any()) {
+            utility::LogError(
+                    "[TriangleMeshBVH] Triangle {} has a vertex index out of "
+                    "range [0, {}).",
+                    tidx, num_vertices);
+        }
+        const Eigen::Vector3d &v0 = vertices_[triangle(0)];
+        const Eigen::Vector3d &v1 = vertices_[triangle(1)];
+        const Eigen::Vector3d &v2 = vertices_[triangle(2)];
+        triangle_min_bounds_[tidx] = v0.cwiseMin(v1).cwiseMin(v2);
+        triangle_max_bounds_[tidx] = v0.cwiseMax(v1).cwiseMax(v2);
+        centroids[tidx] =
+                0.5 * (triangle_min_bounds_[tidx] + triangle_max_bounds_[tidx]);
+    }
+    if (num_triangles == 0) {
+        return;
+    }
+
+    triangle_order_.resize(num_triangles);
+    std::iota(triangle_order_.begin(), triangle_order_.end(), 0);
+    nodes_.reserve(2 * (num_triangles / max_leaf_size) + 1);
+
+    // Pending ranges of triangle_order_ as (begin, end, parent), where parent
+    // is the inner node whose right child the range becomes, or -1. Left
+    // ranges are popped right after their parent, which gives the depth-first
+    // order.
+    std::vector<std::tuple<int, int, int>> stack;
+    stack.emplace_back(0, num_triangles, -1);
+    while (!stack.empty()) {
+        int begin, end, parent;
+        std::tie(begin, end, parent) = stack.back();
+        stack.pop_back();
+        const int node_idx = int(nodes_.size());
+        if (parent >= 0) {
+            nodes_[parent].offset_ = node_idx;
+        }
+
+        Node node;
+        node.min_bound_ = triangle_min_bounds_[triangle_order_[begin]];
+        node.max_bound_ = triangle_max_bounds_[triangle_order_[begin]];
+        Eigen::Vector3d centroid_min = centroids[triangle_order_[begin]];
+        Eigen::Vector3d centroid_max = centroid_min;
+        for (int k = begin + 1; k < end; ++k) {
+            int tidx = triangle_order_[k];
+            node.min_bound_ =
+                    node.min_bound_.cwiseMin(triangle_min_bounds_[tidx]);
+            node.max_bound_ =
+                    node.max_bound_.cwiseMax(triangle_max_bounds_[tidx]);
+            centroid_min = centroid_min.cwiseMin(centroids[tidx]);
+            centroid_max = centroid_max.cwiseMax(centroids[tidx]);
+        }
+        node.offset_ = begin;
+        node.count_ = end - begin;
+        nodes_.push_back(node);
+        if (end - begin <= max_leaf_size) {
+            continue;
+        }
+
+        // Binned SAH: the triangles are binned by centroid along each axis,
+        // and the split between bins with the lowest cost is kept.
+        const Eigen::Vector3d centroid_extent = centroid_max - centroid_min;
+        const double node_area =
+                HalfSurfaceArea(node.min_bound_, node.max_bound_);
+        auto bin_of = [&](int tidx, int axis) {
+            int bin = int(kNumBins *
+                          (centroids[tidx](axis) - centroid_min(axis)) /
+                          centroid_extent(axis));
+            return std::min(bin, kNumBins - 1);
+        };
+        double best_cost = std::numeric_limits<double>::infinity();
+        int best_axis = -1, best_split = 0;
+        for (int axis = 0; axis < 3 && node_area > 0; ++axis) {
+            if (centroid_extent(axis) <= 0) {
+                continue;
+            }
+            std::array<int, kNumBins> counts;
+            std::array<Eigen::Vector3d, kNumBins> bin_min, bin_max;
+            counts.fill(0);
+            bin_min.fill(Eigen::Vector3d::Constant(
+                    std::numeric_limits<double>::infinity()));
+            bin_max.fill(Eigen::Vector3d::Constant(
+                    -std::numeric_limits<double>::infinity()));
+            for (int k = begin; k < end; ++k) {
+                int tidx = triangle_order_[k];
+                int bin = bin_of(tidx, axis);
+                counts[bin]++;
+                bin_min[bin] =
+                        bin_min[bin].cwiseMin(triangle_min_bounds_[tidx]);
+                bin_max[bin] =
+                        bin_max[bin].cwiseMax(triangle_max_bounds_[tidx]);
+            }
+            // Area and count of the bins right of each split.
+            std::array<double, kNumBins> right_area;
+            std::array<int, kNumBins> right_count;
+            Eigen::Vector3d acc_min = bin_min[kNumBins - 1];
+            Eigen::Vector3d acc_max = bin_max[kNumBins - 1];
+            int acc_count = 0;
+            for (int bin = kNumBins - 1; bin > 0; --bin) {
+                acc_min = acc_min.cwiseMin(bin_min[bin]);
+                acc_max = acc_max.cwiseMax(bin_max[bin]);
+                acc_count += counts[bin];
+                right_area[bin] = HalfSurfaceArea(acc_min, acc_max);
+                right_count[bin] = acc_count;
+            }
+            acc_min = bin_min[0];
+            acc_max = bin_max[0];
+            acc_count = 0;
+            for (int split = 1; split < kNumBins; ++split) {
+                acc_min = acc_min.cwiseMin(bin_min[split - 1]);
+                acc_max = acc_max.cwiseMax(bin_max[split - 1]);
+                acc_count += counts[split - 1];
+                if (acc_count == 0 || right_count[split] == 0) {
+                    continue;
+                }
+                double cost = kTraversalCost +
+                              (HalfSurfaceArea(acc_min, acc_max) * acc_count +
+                               right_area[split] * right_count[split]) /
+                                      node_area;
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = split;
+                }
+            }
+        }
+
+        int mid;
+        if (best_axis >= 0) {
+            mid = int(std::partition(triangle_order_.begin() + begin,
+                                     triangle_order_.begin() + end,
+                                     [&](int tidx) {
+                                         return bin_of(tidx, best_axis) <
+                                                best_split;
+                                     }) -
+                      triangle_order_.begin());
+        } else {
+            // Coincident centroids or a flat node: the leaf size is kept by
+            // a median split along the longest axis.
+            int axis;
+            centroid_extent.maxCoeff(&axis);
+            mid = begin + (end - begin) / 2;
+            std::nth_element(triangle_order_.begin() + begin,
+                             triangle_order_.begin() + mid,
+                             triangle_order_.begin() + end,
+                             [&](int a, int b) {
+                                 return centroids[a](axis) < centroids[b](axis);
+                             });
+        }
+        nodes_[node_idx].offset_ = -1;
+        nodes_[node_idx].count_ = 0;
+        stack.emplace_back(mid, end, node_idx);
+        stack.emplace_back(begin, mid, -1);
+    }
+}
+
+TriangleMeshBVH::RayHit TriangleMeshBVH::CastRay(
+        const Eigen::Vector3d &origin,
+        const Eigen::Vector3d &direction,
+        double t_max) const {
+    RayHit hit;
+    if (nodes_.empty()) {
+        return hit;
+    }
+    const Eigen::Array3d origin_array = origin.array();
+    const Eigen::Array3d inv_direction = direction.array().inverse();
+    double t_best = t_max;
+    double t_entry;
+    std::vector<int> stack;
+    if (IntersectRayAABB(origin_array, inv_direction, nodes_[0].min_bound_,
+                         nodes_[0].max_bound_, t_best, t_entry)) {
+        stack.push_back(0);
+    }
+    while (!stack.empty()) {
+        int node_idx = stack.back();
+        stack.pop_back();
+        const Node &node = nodes_[node_idx];
+        if (!IntersectRayAABB(origin_array, inv_direction, node.min_bound_,
+                              node.max_bound_, t_best, t_entry)) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            for (int k = node.offset_; k < node.offset_ + node.count_; ++k) {
+                int tidx = triangle_order_[k];
+                const Eigen::Vector3i &triangle = triangles_[tidx];
+                double t, u, v;
+                if (IntersectRayTriangle(origin, direction,
+                                         vertices_[triangle(0)],
+                                         vertices_[triangle(1)],
+                                         vertices_[triangle(2)], t, u, v) &&
+                    t <= t_best) {
+                    t_best = t;
+                    hit.t_ = t;
+                    hit.triangle_ = tidx;
+                    hit.uv_ = Eigen::Vector2d(u, v);
+                }
+            }
+            continue;
+        }
+        // The nearer child is pushed last, so that it is visited first.
+        int left = node_idx + 1, right = node.offset_;
+        double t_left, t_right;
+        bool hit_left = IntersectRayAABB(origin_array, inv_direction,
+                                         nodes_[left].min_bound_,
+                                         nodes_[left].max_bound_, t_best,
+                                         t_left);
+        bool hit_right = IntersectRayAABB(origin_array, inv_direction,
+                                          nodes_[right].min_bound_,
+                                          nodes_[right].max_bound_, t_best,
+                                          t_right);
+        if (hit_left && hit_right) {
+            if (t_left < t_right) {
+                std::swap(left, right);
+            }
+            stack.push_back(left);
+            stack.push_back(right);
+        } else if (hit_left) {
+            stack.push_back(left);
+        } else if (hit_right) {
+            stack.push_back(right);
+        }
+    }
+    return hit;
+}
+
+std::vector<TriangleMeshBVH::RayHit> TriangleMeshBVH::CastRays(
+        const std::vector<Eigen::Vector3d> &origins,
+        const std::vector<Eigen::Vector3d> &directions,
+        double t_max) const {
+    if (origins.size() != directions.size()) {
+        utility::LogError(
+                "[CastRays] {} origins but {} directions are given.",
+                origins.size(), directions.size());
+    }
+    std::vector<RayHit> hits(origins.size());
+    utility::ParallelFor(0, int64_t(origins.size()), [&](int64_t idx) {
+        hits[idx] = CastRay(origins[idx], directions[idx], t_max);
+    });
+    return hits;
+}
+
+std::vector<int> TriangleMeshBVH::CountIntersections(
+        const std::vector<Eigen::Vector3d> &origins,
+        const std::vector<Eigen::Vector3d> &directions) const {
+    if (origins.size() != directions.size()) {
+        utility::LogError(
+                "[CountIntersections] {} origins but {} directions are given.",
+                origins.size(), directions.size());
+    }
+    std::vector<int> counts(origins.size(), 0);
+    if (nodes_.empty()) {
+        return counts;
+    }
+    const double inf = std::numeric_limits<double>::infinity();
+    utility::ParallelFor(0, int64_t(origins.size()), [&](int64_t idx) {
+        const Eigen::Vector3d &origin = origins[idx];
+        const Eigen::Vector3d &direction = directions[idx];
+        const Eigen::Array3d origin_array = origin.array();
+        const Eigen::Array3d inv_direction = direction.array().inverse();
+        std::vector<int> stack = {0};
+        while (!stack.empty()) {
+            int node_idx = stack.back();
+            stack.pop_back();
+            const Node &node = nodes_[node_idx];
+            double t_entry;
+            if (!IntersectRayAABB(origin_array, inv_direction,
+                                  node.min_bound_, node.max_bound_, inf,
+                                  t_entry)) {
+                continue;
+            }
+            if (!node.IsLeaf()) {
+                stack.push_back(node.offset_);
+                stack.push_back(node_idx + 1);
+                continue;
+            }
+            for (int k = node.offset_; k < node.offset_ + node.count_; ++k) {
+                const Eigen::Vector3i &triangle =
+                        triangles_[triangle_order_[k]];
+                double t, u, v;
+                if (IntersectRayTriangle(origin, direction,
+                                         vertices_[triangle(0)],
+                                         vertices_[triangle(1)],
+                                         vertices_[triangle(2)], t, u, v)) {
+                    counts[idx]++;
+                }
+            }
+        }
+    });
+    return counts;
+}
+
+std::vector<TriangleMeshBVH::ClosestPoint>
+TriangleMeshBVH::ComputeClosestPoints(
+        const std::vector<Eigen::Vector3d> &points) const {
+    std::vector<ClosestPoint> closest(points.size());
+    if (nodes_.empty()) {
+        return closest;
+    }
+    auto box_distance2 = [](const Eigen::Vector3d &p, const Node &node) {
+        return (node.min_bound_ - p)
+                .cwiseMax(p - node.max_bound_)
+                .cwiseMax(0.0)
+                .squaredNorm();
+    };
+    utility::ParallelFor(0, int64_t(points.size()), [&](int64_t idx) {
+        const Eigen::Vector3d &p = points[idx];
+        ClosestPoint &result = closest[idx];
+        double best_dist2 = std::numeric_limits<double>::infinity();
+        std::vector<int> stack = {0};
+        while (!stack.empty()) {
+            int node_idx = stack.back();
+            stack.pop_back();
+            const Node &node = nodes_[node_idx];
+            if (box_distance2(p, node) >= best_dist2) {
+                continue;
+            }
+            if (node.IsLeaf()) {
+                for (int k = node.offset_; k < node.offset_ + node.count_;
+                     ++k) {
+                    int tidx = triangle_order_[k];
+                    const Eigen::Vector3i &triangle = triangles_[tidx];
+                    Eigen::Vector3d q = ClosestPointOnTriangle(
+                            p, vertices_[triangle(0)], vertices_[triangle(1)],
+                            vertices_[triangle(2)]);
+                    double dist2 = (q - p).squaredNorm();
+                    if (dist2 < best_dist2) {
+                        best_dist2 = dist2;
+                        result.point_ = q;
+                        result.triangle_ = tidx;
+                    }
+                }
+                continue;
+            }
+            // The nearer child is pushed last, so that it is visited first
+            // and tightens the bound for the other one.
+            int left = node_idx + 1, right = node.offset_;
+            if (box_distance2(p, nodes_[left]) <
+                box_distance2(p, nodes_[right])) {
+                std::swap(left, right);
+            }
+            stack.push_back(left);
+            stack.push_back(right);
+        }
+        result.distance_ = std::sqrt(best_dist2);
+    });
+    return closest;
+}
+
+std::vector<bool> TriangleMeshBVH::ComputeOccupancy(
+        const std::vector<Eigen::Vector3d> &points) const {
+    // Directions that are unlikely to be aligned with the edges of the mesh.
+    const std::array<Eigen::Vector3d, 3> directions = {
+            Eigen::Vector3d(1.0, 0.3713, 0.1472),
+            Eigen::Vector3d(-0.2437, 1.0, 0.5116),
+            Eigen::Vector3d(0.4186, -0.1851, 1.0)};
+    std::vector<int> votes(points.size(), 0);
+    for (const Eigen::Vector3d &direction : directions) {
+        std::vector<int> counts = CountIntersections(
+                points, std::vector<Eigen::Vector3d>(points.size(), direction));
+        for (size_t idx = 0; idx < points.size(); ++idx) {
+            votes[idx] += counts[idx] % 2;
+        }
+    }
+    std::vector<bool> occupancy(points.size());
+    for (size_t idx = 0; idx < points.size(); ++idx) {
+        occupancy[idx] = votes[idx] >= 2;
+    }
+    return occupancy;
+}
+
+}  // namespace geometry
+}  // namespace open3d
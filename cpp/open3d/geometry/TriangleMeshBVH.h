@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <limits>
+#include <vector>
+
+#include "open3d/geometry/IntersectionTest.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a mesh, for ray
+/// casting, closest point, occupancy and overlap queries.
+///
+/// The tree is built top-down with the binned surface area heuristic (SAH)
+/// and stored as a flat array of nodes in depth-first order, so the left
+/// child of an inner node directly follows it. The batched queries run in
+/// parallel, one query per thread. The vertices and triangles are copied, so
+/// the BVH stays valid when the mesh changes, but does not follow it.
+class TriangleMeshBVH {
+public:
+    /// \brief Node of the BVH.
+    struct Node {
+        /// Minimum corner of the bounds of the node.
+        Eigen::Vector3d min_bound_;
+        /// Maximum corner of the bounds of the node.
+        Eigen::Vector3d max_bound_;
+        /// For an inner node, the index of its right child. For a leaf, the
+        /// offset of its triangles in GetTriangleOrder().
+        int offset_;
+        /// Number of triangles of a leaf, 0 for an inner node.
+        int count_;
+
+        bool IsLeaf() const { return count_ > 0; }
+    };
+
+    /// \brief Closest hit of a ray.
+    struct RayHit {
+        /// Ray parameter of the hit, infinity if there is no hit.
+        double t_ = std::numeric_limits<double>::infinity();
+        /// Index of the triangle that is hit, -1 if there is no hit.
+        int triangle_ = -1;
+        /// Barycentric coordinates of the hit for the second and the third
+        /// vertex of the triangle.
+        Eigen::Vector2d uv_ = Eigen::Vector2d::Zero();
+    };
+
+    /// \brief Closest point on the surface of the mesh.
+    struct ClosestPoint {
+        /// The closest point.
+        Eigen::Vector3d point_ = Eigen::Vector3d::Zero();
+        /// Index of the triangle of the closest point.
+        int triangle_ = -1;
+        /// Distance from the query to the closest point.
+        double distance_ = std::numeric_limits<double>::infinity();
+    };
+
+    /// \brief Builds the BVH of the triangles of \p mesh.
+    ///
+    /// \param mesh The mesh, with vertex indices in range.
+    /// \param max_leaf_size The maximum number of triangles in a leaf.
+    explicit TriangleMeshBVH(const TriangleMesh &mesh, int max_leaf_size = 4);
+
+    /// Returns the nodes of the tree, the root first. Empty if the mesh has no
+    /// triangles.
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+    /// Returns the triangle indices, grouped by leaf.
+    const std::vector<int> &GetTriangleOrder() const { return triangle_order_; }
+
+    /// \brief Casts a ray and returns its closest hit with t in
+    /// [0, \p t_max]. Both sides of the triangles are hit.
+    ///
+    /// \param origin Origin of the ray.
+    /// \param direction Direction of the ray, not necessarily normalized.
+    /// \param t_max Largest ray parameter.
+    RayHit CastRay(
+            const Eigen::Vector3d &origin,
+            const Eigen::Vector3d &direction,
+            double t_max = std::numeric_limits<double>::infinity()) const;
+
+    /// \brief Casts the rays in parallel, see CastRay.
+    std::vector<RayHit> CastRays(
+            const std::vector<Eigen::Vector3d> &origins,
+            const std::vector<Eigen::Vector3d> &directions,
+            double t_max = std::numeric_limits<double>::infinity()) const;
+
+    /// \brief Counts the hits of each ray with t >= 0, in parallel.
+    std::vector<int> CountIntersections(
+            const std::vector<Eigen::Vector3d> &origins,
+            const std::vector<Eigen::Vector3d> &directions) const;
+
+    /// \brief Computes the closest point on the mesh of each query point, in
+    /// parallel.
+    std::vector<ClosestPoint> ComputeClosestPoints(
+            const std::vector<Eigen::Vector3d> &points) const;
+
+    /// \brief Tests if the points are inside the mesh, in parallel.
+    ///
+    /// A point is inside if rays in three fixed directions hit the mesh an odd
+    /// number of times by majority vote, so the mesh should be closed.
+    std::vector<bool> ComputeOccupancy(
+            const std::vector<Eigen::Vector3d> &points) const;
+
+    /// \brief Calls \p func with the index of each triangle whose bounds
+    /// overlap the box [\p min_bound, \p max_bound].
+    ///
+    /// \param func Callable with an int argument that returns false to stop
+    /// the query.
+    /// \return False if the query was stopped by \p func.
+    template <typename Func>
+    bool QueryAABB(const Eigen::Vector3d &min_bound,
+                   const Eigen::Vector3d &max_bound,
+                   Func &&func) const {
+        if (nodes_.empty()) {
+            return true;
+        }
+        std::vector<int> stack = {0};
+        while (!stack.empty()) {
+            int node_idx = stack.back();
+            stack.pop_back();
+            const Node &node = nodes_[node_idx];
+            if (!IntersectionTest::AABBAABB(node.min_bound_, node.max_bound_,
+                                            min_bound, max_bound)) {
+                continue;
+            }
+            if (!node.IsLeaf()) {
+                stack.push_back(node.offset_);
+                stack.push_back(node_idx + 1);
+                continue;
+            }
+            for (int k = node.offset_; k < node.offset_ + node.count_; ++k) {
+                int tidx = triangle_order_[k];
+                if (IntersectionTest::AABBAABB(triangle_min_bounds_[tidx],
+                                               triangle_max_bounds_[tidx],
+                                               min_bound, max_bound) &&
+                    !func(tidx)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Eigen::Vector3d> triangle_min_bounds_;
+    std::vector<Eigen::Vector3d> triangle_max_bounds_;
+    std::vector<Node> nodes_;
+    std::vector<int> triangle_order_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
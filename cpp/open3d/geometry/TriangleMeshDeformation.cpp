@@ -30,99 +30,197 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+struct DeformAsRigidAsPossibleCache::Impl {
+    /// Mesh and constrained vertices the system was built for.
+    std::vector<Eigen::Vector3d> vertices;
+    std::vector<Eigen::Vector3i> triangles;
+    std::vector<int> constraint_indices;
+
+    /// Neighbours of vertex i, with the cotangent weights of their edges, are
+    /// neighbors[offsets[i]:offsets[i + 1]] and weights[...].
+    std::vector<int> offsets;
+    std::vector<int> neighbors;
+    std::vector<double> weights;
+    double surface_area = 0;
+
+    /// Row of each free vertex in the system, -1 for constrained vertices.
+    std::vector<int> rows;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+};
+
+DeformAsRigidAsPossibleCache::DeformAsRigidAsPossibleCache() {}
+
+DeformAsRigidAsPossibleCache::~DeformAsRigidAsPossibleCache() {}
+
+void DeformAsRigidAsPossibleCache::Clear() { impl_.reset(); }
+
+bool DeformAsRigidAsPossibleCache::IsEmpty() const { return !impl_; }
+
 std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         const std::vector<int> &constraint_vertex_indices,
         const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
         size_t max_iter,
         DeformAsRigidAsPossibleEnergy energy_model,
         double smoothed_alpha) const {
-    auto prime = std::make_shared<TriangleMesh>();
-    prime->vertices_ = this->vertices_;
-    prime->triangles_ = this->triangles_;
+    DeformAsRigidAsPossibleCache cache;
+    return DeformAsRigidAsPossible(constraint_vertex_indices,
+                                   constraint_vertex_positions, max_iter,
+                                   energy_model, smoothed_alpha, cache);
+}
 
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
-    auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
-    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
+std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+        const std::vector<int> &constraint_vertex_indices,
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter,
+        DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha,
+        DeformAsRigidAsPossibleCache &cache) const {
+    const int num_vertices = int(vertices_.size());
 
-    std::unordered_map<int, Eigen::Vector3d> constraints;
+    // Later constraints of the same vertex override earlier ones.
+    std::vector<int> constraint_ids(num_vertices, -1);
     for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
                          idx < constraint_vertex_positions.size();
          ++idx) {
-        constraints[constraint_vertex_indices[idx]] =
-                constraint_vertex_positions[idx];
+        int i = constraint_vertex_indices[idx];
+        if (i < 0 || i >= num_vertices) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] constraint vertex index {} out "
+                    "of range [0, {}).",
+                    i, num_vertices);
+        }
+        constraint_ids[i] = int(idx);
     }
-
-    double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
-    std::vector<Eigen::Matrix3d> Rs(vertices_.size());
-    std::vector<Eigen::Matrix3d> Rs_old;
-    if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-        surface_area = prime->GetSurfaceArea();
-        Rs_old.resize(vertices_.size());
+    std::vector<int> constraint_indices;
+    for (int i = 0; i < num_vertices; ++i) {
+        if (constraint_ids[i] >= 0) {
+            constraint_indices.push_back(i);
+        }
     }
 
-    // Build system matrix L and its solver
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
-    std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
+    if (cache.IsEmpty() || cache.impl_->constraint_indices !=
+                                   constraint_indices ||
+        cache.impl_->vertices != vertices_ ||
+        cache.impl_->triangles != triangles_) {
+        cache.impl_.reset(new DeformAsRigidAsPossibleCache::Impl());
+        auto &impl = *cache.impl_;
+        impl.vertices = vertices_;
+        impl.triangles = triangles_;
+        impl.constraint_indices = constraint_indices;
+
+        utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
+        TriangleMesh rest;
+        rest.vertices_ = vertices_;
+        rest.triangles_ = triangles_;
+        rest.ComputeAdjacencyList();
+        auto edge_weights = rest.ComputeEdgeWeightsCot(
+                rest.GetEdgeToVerticesMap(), /*min_weight=*/0);
+        impl.offsets.resize(num_vertices + 1, 0);
+        for (int i = 0; i < num_vertices; ++i) {
+            impl.offsets[i + 1] =
+                    impl.offsets[i] + int(rest.adjacency_list_[i].size());
+        }
+        impl.neighbors.resize(impl.offsets[num_vertices]);
+        impl.weights.resize(impl.offsets[num_vertices]);
+        for (int i = 0; i < num_vertices; ++i) {
+            int k = impl.offsets[i];
+            for (int j : rest.adjacency_list_[i]) {
+                impl.neighbors[k] = j;
+                impl.weights[k] = edge_weights[GetOrderedEdge(i, j)];
+                ++k;
+            }
+        }
+        impl.surface_area = rest.GetSurfaceArea();
+        utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
+
+        // The constrained vertices are moved to the right hand side, which
+        // leaves a symmetric positive (semi-)definite system in the free
+        // vertices.
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] setting up system matrix L");
+        impl.rows.resize(num_vertices);
+        int num_rows = 0;
+        for (int i = 0; i < num_vertices; ++i) {
+            impl.rows[i] = constraint_ids[i] >= 0 ? -1 : num_rows++;
+        }
+        std::vector<Eigen::Triplet<double>> triplets;
+        for (int i = 0; i < num_vertices; ++i) {
+            if (impl.rows[i] < 0) {
+                continue;
+            }
             double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
+            for (int k = impl.offsets[i]; k < impl.offsets[i + 1]; ++k) {
+                int j = impl.neighbors[k];
+                double w = impl.weights[k];
+                if (impl.rows[j] >= 0) {
+                    triplets.push_back(Eigen::Triplet<double>(
+                            impl.rows[i], impl.rows[j], -w));
+                }
                 W += w;
             }
             if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+                triplets.push_back(
+                        Eigen::Triplet<double>(impl.rows[i], impl.rows[i], W));
             }
         }
-    }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
-    L.setFromTriplets(triplets.begin(), triplets.end());
-    utility::LogDebug(
-            "[DeformAsRigidAsPossible] done setting up system matrix L");
-
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
-        utility::LogError(
-                "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
-    } else {
+        Eigen::SparseMatrix<double> L(num_rows, num_rows);
+        L.setFromTriplets(triplets.begin(), triplets.end());
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] done setting up system matrix L");
+
         utility::LogDebug(
-                "[DeformAsRigidAsPossible] done setting up sparse solver");
+                "[DeformAsRigidAsPossible] setting up sparse solver");
+        impl.solver.compute(L);
+        if (impl.solver.info() != Eigen::Success) {
+            cache.Clear();
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Failed to build solver "
+                    "(factorize)");
+        } else {
+            utility::LogDebug(
+                    "[DeformAsRigidAsPossible] done setting up sparse solver");
+        }
+    } else {
+        utility::LogDebug("[DeformAsRigidAsPossible] reusing sparse solver");
+    }
+    const auto &impl = *cache.impl_;
+    const std::vector<int> &offsets = impl.offsets;
+    const std::vector<int> &neighbors = impl.neighbors;
+    const std::vector<double> &weights = impl.weights;
+    const std::vector<int> &rows = impl.rows;
+    const double surface_area = impl.surface_area;
+
+    auto prime = std::make_shared<TriangleMesh>();
+    prime->vertices_ = this->vertices_;
+    prime->triangles_ = this->triangles_;
+
+    std::vector<Eigen::Matrix3d> Rs(vertices_.size());
+    std::vector<Eigen::Matrix3d> Rs_old;
+    if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
+        Rs_old.resize(vertices_.size());
     }
 
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
+    Eigen::MatrixXd b(num_vertices - int(constraint_indices.size()), 3);
     for (size_t iter = 0; iter < max_iter; ++iter) {
         if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
             std::swap(Rs, Rs_old);
         }
 
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        utility::ParallelFor(0, num_vertices, [&](int64_t i) {
             // Update rotations
             Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
             Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
             int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
+            for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+                int j = neighbors[k];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                S += w * (e0 * e1.transpose());
+                S += weights[k] * (e0 * e1.transpose());
                 if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
                     R += Rs_old[j];
                 }
@@ -146,47 +244,49 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
                         "[DeformAsRigidAsPossible] something went wrong with "
                         "updating R");
             }
-        }
+        });
 
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        utility::ParallelFor(0, num_vertices, [&](int64_t i) {
             // Update Positions
+            if (rows[i] < 0) {
+                return;
+            }
             Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
-            } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
-                    bi += w / 2 *
-                          ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
+            for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+                int j = neighbors[k];
+                double w = weights[k];
+                bi += w / 2 * ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
+                if (rows[j] < 0) {
+                    bi += w * constraint_vertex_positions[constraint_ids[j]];
                 }
             }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
-        }
-#pragma omp parallel for schedule(static)
-        for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
-            if (solver.info() != Eigen::Success) {
-                utility::LogError(
-                        "[DeformAsRigidAsPossible] Cholesky solve failed");
-            }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
-            }
+            b.row(rows[i]) = bi.transpose();
+        });
+        Eigen::MatrixXd p_prime = impl.solver.solve(b);
+        if (impl.solver.info() != Eigen::Success) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Cholesky solve failed");
         }
+        utility::ParallelFor(0, num_vertices, [&](int64_t i) {
+            prime->vertices_[i] =
+                    rows[i] < 0
+                            ? constraint_vertex_positions[constraint_ids[i]]
+                            : Eigen::Vector3d(p_prime.row(rows[i]).transpose());
+        });
 
         // Compute energy and log
+        if (utility::GetVerbosityLevel() < utility::VerbosityLevel::Debug) {
+            continue;
+        }
         double energy = 0;
         double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
+        for (int i = 0; i < num_vertices; ++i) {
+            for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+                int j = neighbors[k];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
                 Eigen::Vector3d diff = e1 - Rs[i] * e0;
-                energy += w * diff.squaredNorm();
+                energy += weights[k] * diff.squaredNorm();
                 if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
                     reg += (Rs[i] - Rs[j]).squaredNorm();
                 }
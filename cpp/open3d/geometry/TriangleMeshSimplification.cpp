@@ -25,11 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <queue>
 #include <tuple>
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -88,6 +92,142 @@ public:
     double c_;
 };
 
+namespace {
+
+/// Computes the position \p vbar that minimizes the error quadric \p Qbar of
+/// the edge (v0, v1) and returns the error at this position.
+double ComputeEdgeCollapse(const Quadric& Qbar,
+                           const Eigen::Vector3d& v0,
+                           const Eigen::Vector3d& v1,
+                           Eigen::Vector3d& vbar) {
+    double cost;
+    if (Qbar.IsInvertible()) {
+        vbar = Qbar.Minimum();
+        cost = Qbar.Eval(vbar);
+    } else {
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+    }
+    return cost;
+}
+
+/// Maps each vertex to its adjacent triangles in compressed row storage,
+/// which needs far less memory than a set per vertex.
+class VertexTriangleAdjacency {
+public:
+    void Build(size_t num_vertices,
+               const std::vector<Eigen::Vector3i>& triangles,
+               const std::vector<uint8_t>& triangles_deleted) {
+        offsets_.assign(num_vertices + 1, 0);
+        for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+            if (!triangles_deleted[tidx]) {
+                for (int k = 0; k < 3; ++k) {
+                    offsets_[triangles[tidx](k) + 1]++;
+                }
+            }
+        }
+        for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
+            offsets_[vidx + 1] += offsets_[vidx];
+        }
+        triangles_.resize(offsets_[num_vertices]);
+        std::vector<int> cursors(offsets_.begin(), offsets_.end() - 1);
+        for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+            if (!triangles_deleted[tidx]) {
+                for (int k = 0; k < 3; ++k) {
+                    triangles_[cursors[triangles[tidx](k)]++] = int(tidx);
+                }
+            }
+        }
+    }
+
+    const int* begin(int vidx) const {
+        return triangles_.data() + offsets_[vidx];
+    }
+    const int* end(int vidx) const {
+        return triangles_.data() + offsets_[vidx + 1];
+    }
+
+private:
+    std::vector<int> offsets_;
+    std::vector<int> triangles_;
+};
+
+/// Fraction of the proposed edge collapses of SimplifyQuadricDecimationParallel
+/// that are eligible in a round, e.g. 8 for the cheapest eighth.
+constexpr size_t kQuadricDecimationRoundFraction = 4;
+
+/// Edge collapse (vidx0, vidx1) with vidx0 < vidx1 that moves vidx0 to
+/// \p vbar_ and removes vidx1. Candidates are ordered by their cost and then
+/// by their vertex indices, such that all vertices agree on the same order.
+struct CollapseCandidate {
+    double cost_ = std::numeric_limits<double>::infinity();
+    int vidx0_ = -1;
+    int vidx1_ = -1;
+    Eigen::Vector3d vbar_;
+
+    bool IsValid() const { return vidx0_ >= 0; }
+
+    bool operator<(const CollapseCandidate& other) const {
+        return std::tie(cost_, vidx0_, vidx1_) <
+               std::tie(other.cost_, other.vidx0_, other.vidx1_);
+    }
+};
+
+enum class ProposalStatus : uint8_t { Active, Selected, Dropped };
+
+/// Claim of a vertex by an edge collapse that has been selected.
+constexpr uint64_t kClaimLocked = std::numeric_limits<uint64_t>::max();
+
+/// Returns true if moving \p vidx to \p vbar flips the normal of one of its
+/// triangles that are not shared with \p vidx_other.
+bool CollapseFlipsTriangle(const TriangleMesh& mesh,
+                           const VertexTriangleAdjacency& adjacency,
+                           int vidx,
+                           int vidx_other,
+                           const Eigen::Vector3d& vbar) {
+    for (const int* tidx = adjacency.begin(vidx); tidx != adjacency.end(vidx);
+         ++tidx) {
+        const Eigen::Vector3i& tria = mesh.triangles_[*tidx];
+        if (vidx_other == tria(0) || vidx_other == tria(1) ||
+            vidx_other == tria(2)) {
+            continue;
+        }
+
+        Eigen::Vector3d vert0 = mesh.vertices_[tria(0)];
+        Eigen::Vector3d vert1 = mesh.vertices_[tria(1)];
+        Eigen::Vector3d vert2 = mesh.vertices_[tria(2)];
+        Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
+        norm_before /= norm_before.norm();
+
+        if (vidx == tria(0)) {
+            vert0 = vbar;
+        } else if (vidx == tria(1)) {
+            vert1 = vbar;
+        } else if (vidx == tria(2)) {
+            vert2 = vbar;
+        }
+
+        Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
+        norm_after /= norm_after.norm();
+        if (norm_before.dot(norm_after) < 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         SimplificationContraction
@@ -352,27 +492,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
             const Quadric& Q0 = Qs[min];
             const Quadric& Q1 = Qs[max];
             Quadric Qbar = Q0 + Q1;
-            double cost;
             Eigen::Vector3d vbar;
-            if (Qbar.IsInvertible()) {
-                vbar = Qbar.Minimum();
-                cost = Qbar.Eval(vbar);
-            } else {
-                const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
-                const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
-                Eigen::Vector3d vmid = (v0 + v1) / 2;
-                double cost0 = Qbar.Eval(v0);
-                double cost1 = Qbar.Eval(v1);
-                double costmid = Qbar.Eval(vmid);
-                cost = std::min(cost0, std::min(cost1, costmid));
-                if (cost == costmid) {
-                    vbar = vmid;
-                } else if (cost == cost0) {
-                    vbar = v0;
-                } else {
-                    vbar = v1;
-                }
-            }
+            double cost = ComputeEdgeCollapse(Qbar, mesh->vertices_[vidx0],
+                                              mesh->vertices_[vidx1], vbar);
             vbars[edge] = vbar;
             costs[edge] = cost;
             queue.push(CostEdge(cost, min, max));
@@ -552,5 +674,444 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles,
+        double maximum_error = std::numeric_limits<double>::infinity(),
+        double boundary_weight = 1.0) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimationParallel] This mesh contains "
+                "triangle uvs that are not handled in this function");
+    }
+    if (vertices_.size() > size_t(std::numeric_limits<int>::max()) ||
+        triangles_.size() > size_t(std::numeric_limits<int>::max())) {
+        utility::LogError(
+                "[SimplifyQuadricDecimationParallel] Too many vertices or "
+                "triangles.");
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+
+    const int num_vertices = int(vertices_.size());
+    const int num_triangles = int(triangles_.size());
+    std::vector<uint8_t> vertices_deleted(num_vertices, 0);
+    std::vector<uint8_t> triangles_deleted(num_triangles, 0);
+    VertexTriangleAdjacency adjacency;
+    adjacency.Build(num_vertices, mesh->triangles_, triangles_deleted);
+
+    // Compute the error metric per vertex, and for boundary edges add the
+    // perpendicular plane quadric
+    std::vector<Eigen::Vector4d> triangle_planes(num_triangles);
+    std::vector<double> triangle_areas(num_triangles);
+    utility::ParallelFor(0, num_triangles, [&](int64_t tidx) {
+        triangle_planes[tidx] = GetTrianglePlane(tidx);
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    });
+    auto IsBoundaryEdge = [&](int vidx0, int vidx1) {
+        int count = 0;
+        for (const int* tidx = adjacency.begin(vidx0);
+             tidx != adjacency.end(vidx0); ++tidx) {
+            const Eigen::Vector3i& tria = mesh->triangles_[*tidx];
+            if (vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2)) {
+                count++;
+            }
+        }
+        return count == 1;
+    };
+    std::vector<Quadric> Qs(num_vertices);
+    utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+        for (const int* tidx = adjacency.begin(int(vidx));
+             tidx != adjacency.end(int(vidx)); ++tidx) {
+            Qs[vidx] += Quadric(triangle_planes[*tidx], triangle_areas[*tidx]);
+
+            const Eigen::Vector3i& tria = mesh->triangles_[*tidx];
+            for (int k = 0; k < 3; ++k) {
+                int vidx0 = tria(k);
+                int vidx1 = tria((k + 1) % 3);
+                if ((vidx0 != vidx && vidx1 != vidx) ||
+                    !IsBoundaryEdge(vidx0, vidx1)) {
+                    continue;
+                }
+                const auto& vert0 = vertices_[vidx0];
+                const auto& vert1 = vertices_[vidx1];
+                const auto& vert2 = vertices_[tria((k + 2) % 3)];
+                Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
+                Eigen::Vector4d plane =
+                        ComputeTrianglePlane(vert0, vert1, vert2p);
+                Qs[vidx] += Quadric(plane,
+                                    triangle_areas[*tidx] * boundary_weight);
+            }
+        }
+    });
+    triangle_planes.clear();
+    triangle_planes.shrink_to_fit();
+    triangle_areas.clear();
+    triangle_areas.shrink_to_fit();
+
+    // Collapse edges in rounds. In each round, every vertex proposes its
+    // cheapest valid edge collapse, and an independent set among the cheapest
+    // proposals is collapsed in parallel.
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    int n_triangles = num_triangles;
+    std::vector<CollapseCandidate> candidates(num_vertices);
+    std::vector<int> proposals;
+    std::vector<double> proposal_costs;
+    std::vector<std::atomic<uint64_t>> endpoint_claims(num_vertices);
+    std::vector<std::atomic<uint64_t>> ring_claims(num_vertices);
+    std::vector<int> active_proposals;
+    std::vector<ProposalStatus> proposal_status;
+    std::vector<uint8_t> is_dirty(num_vertices, 0);
+    std::vector<int> dirty_vertices(num_vertices);
+    std::iota(dirty_vertices.begin(), dirty_vertices.end(), 0);
+    std::vector<int> collapses;
+    std::vector<int> collapse_removed_triangles;
+    while (n_triangles > target_number_of_triangles) {
+        const int64_t num_dirty = int64_t(dirty_vertices.size());
+        utility::ParallelFor(0, num_dirty, [&](int64_t idx) {
+            const int vidx = dirty_vertices[idx];
+            candidates[vidx] = CollapseCandidate();
+            if (vertices_deleted[vidx]) {
+                return;
+            }
+            std::vector<int> neighbors;
+            for (const int* tidx = adjacency.begin(vidx);
+                 tidx != adjacency.end(vidx); ++tidx) {
+                const Eigen::Vector3i& tria = mesh->triangles_[*tidx];
+                for (int k = 0; k < 3; ++k) {
+                    if (tria(k) != vidx) {
+                        neighbors.push_back(tria(k));
+                    }
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                            neighbors.end());
+
+            // Take the cheapest collapse that does not flip a triangle
+            std::vector<CollapseCandidate> vertex_candidates;
+            vertex_candidates.reserve(neighbors.size());
+            for (int nb_vidx : neighbors) {
+                CollapseCandidate candidate;
+                candidate.vidx0_ = std::min(vidx, nb_vidx);
+                candidate.vidx1_ = std::max(vidx, nb_vidx);
+                candidate.cost_ = ComputeEdgeCollapse(
+                        Qs[candidate.vidx0_] + Qs[candidate.vidx1_],
+                        mesh->vertices_[candidate.vidx0_],
+                        mesh->vertices_[candidate.vidx1_], candidate.vbar_);
+                if (candidate.cost_ <= maximum_error) {
+                    vertex_candidates.push_back(candidate);
+                }
+            }
+            std::sort(vertex_candidates.begin(), vertex_candidates.end());
+            for (const CollapseCandidate& candidate : vertex_candidates) {
+                if (!CollapseFlipsTriangle(*mesh, adjacency, candidate.vidx0_,
+                                           candidate.vidx1_,
+                                           candidate.vbar_) &&
+                    !CollapseFlipsTriangle(*mesh, adjacency, candidate.vidx1_,
+                                           candidate.vidx0_,
+                                           candidate.vbar_)) {
+                    candidates[vidx] = candidate;
+                    break;
+                }
+            }
+        });
+
+        // Every vertex proposes its candidate, unless the lower vertex of the
+        // edge proposes the same one
+        proposals.clear();
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            const CollapseCandidate& candidate = candidates[vidx];
+            if (candidate.IsValid() &&
+                (candidate.vidx0_ == vidx ||
+                 candidates[candidate.vidx0_].vidx1_ != candidate.vidx1_)) {
+                proposals.push_back(vidx);
+            }
+        }
+        if (proposals.empty()) {
+            break;
+        }
+
+        // Only the cheapest proposals are eligible in this round
+        proposal_costs.resize(proposals.size());
+        for (size_t idx = 0; idx < proposals.size(); ++idx) {
+            proposal_costs[idx] = candidates[proposals[idx]].cost_;
+        }
+        size_t num_eligible = std::max(
+                size_t(1), proposals.size() / kQuadricDecimationRoundFraction);
+        std::nth_element(proposal_costs.begin(),
+                         proposal_costs.begin() + num_eligible - 1,
+                         proposal_costs.end());
+        const double max_cost = proposal_costs[num_eligible - 1];
+
+        active_proposals.clear();
+        for (int vidx : proposals) {
+            if (candidates[vidx].cost_ <= max_cost) {
+                active_proposals.push_back(vidx);
+            }
+        }
+
+        // Select a maximal set of eligible proposals, such that no endpoint of
+        // a selected edge is adjacent to an endpoint of another one. Their
+        // collapses then modify disjoint sets of triangles and do not move
+        // any vertex that another one depends on. Each active proposal claims
+        // its endpoints and the vertices of its adjacent triangles (its ring)
+        // with a pseudo-random priority. A proposal is selected if no other
+        // proposal with a higher priority has an endpoint in its ring or its
+        // endpoints in their ring. Selected proposals lock their claims and
+        // proposals that conflict with a locked claim are dropped.
+        auto GetPriority = [&](int vidx) {
+            const CollapseCandidate& candidate = candidates[vidx];
+            uint64_t hash = uint64_t(candidate.vidx0_) * 0x9E3779B97F4A7C15ull ^
+                            uint64_t(candidate.vidx1_) * 0xC2B2AE3D27D4EB4Full;
+            hash ^= hash >> 29;
+            return (hash & 0xFFFFFFFF00000000ull) | uint64_t(vidx + 1);
+        };
+        auto ForEachRingVertex = [&](const CollapseCandidate& candidate,
+                                     const auto& func) {
+            for (int end_vidx : {candidate.vidx0_, candidate.vidx1_}) {
+                for (const int* tidx = adjacency.begin(end_vidx);
+                     tidx != adjacency.end(end_vidx); ++tidx) {
+                    const Eigen::Vector3i& tria = mesh->triangles_[*tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        func(tria(k));
+                    }
+                }
+            }
+        };
+        auto Claim = [](std::atomic<uint64_t>& claim, uint64_t priority) {
+            uint64_t current = claim.load(std::memory_order_relaxed);
+            while (current < priority &&
+                   !claim.compare_exchange_weak(current, priority)) {
+            }
+        };
+        auto Release = [](std::atomic<uint64_t>& claim) {
+            if (claim.load(std::memory_order_relaxed) != kClaimLocked) {
+                claim.store(0, std::memory_order_relaxed);
+            }
+        };
+        utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+            endpoint_claims[vidx].store(0, std::memory_order_relaxed);
+            ring_claims[vidx].store(0, std::memory_order_relaxed);
+        });
+        collapses.clear();
+        while (!active_proposals.empty()) {
+            const int64_t num_active = int64_t(active_proposals.size());
+            utility::ParallelFor(0, num_active, [&](int64_t idx) {
+                const CollapseCandidate& candidate =
+                        candidates[active_proposals[idx]];
+                const uint64_t priority = GetPriority(active_proposals[idx]);
+                Claim(endpoint_claims[candidate.vidx0_], priority);
+                Claim(endpoint_claims[candidate.vidx1_], priority);
+                ForEachRingVertex(candidate, [&](int nb_vidx) {
+                    Claim(ring_claims[nb_vidx], priority);
+                });
+            });
+            proposal_status.resize(active_proposals.size());
+            utility::ParallelFor(0, num_active, [&](int64_t idx) {
+                const CollapseCandidate& candidate =
+                        candidates[active_proposals[idx]];
+                const uint64_t priority = GetPriority(active_proposals[idx]);
+                ProposalStatus status = ProposalStatus::Selected;
+                auto Check = [&](const std::atomic<uint64_t>& claim) {
+                    uint64_t current = claim.load(std::memory_order_relaxed);
+                    if (current == kClaimLocked) {
+                        status = ProposalStatus::Dropped;
+                    } else if (current > priority &&
+                               status == ProposalStatus::Selected) {
+                        status = ProposalStatus::Active;
+                    }
+                };
+                Check(ring_claims[candidate.vidx0_]);
+                Check(ring_claims[candidate.vidx1_]);
+                ForEachRingVertex(candidate, [&](int nb_vidx) {
+                    Check(endpoint_claims[nb_vidx]);
+                });
+                proposal_status[idx] = status;
+            });
+            utility::ParallelFor(0, num_active, [&](int64_t idx) {
+                if (proposal_status[idx] != ProposalStatus::Selected) {
+                    return;
+                }
+                const CollapseCandidate& candidate =
+                        candidates[active_proposals[idx]];
+                endpoint_claims[candidate.vidx0_].store(
+                        kClaimLocked, std::memory_order_relaxed);
+                endpoint_claims[candidate.vidx1_].store(
+                        kClaimLocked, std::memory_order_relaxed);
+                ForEachRingVertex(candidate, [&](int nb_vidx) {
+                    ring_claims[nb_vidx].store(kClaimLocked,
+                                               std::memory_order_relaxed);
+                });
+            });
+
+            size_t num_still_active = 0;
+            for (size_t idx = 0; idx < active_proposals.size(); ++idx) {
+                if (proposal_status[idx] == ProposalStatus::Selected) {
+                    collapses.push_back(active_proposals[idx]);
+                } else if (proposal_status[idx] == ProposalStatus::Active) {
+                    active_proposals[num_still_active++] =
+                            active_proposals[idx];
+                }
+            }
+            active_proposals.resize(num_still_active);
+            const int64_t num_next = int64_t(num_still_active);
+            utility::ParallelFor(0, num_next, [&](int64_t idx) {
+                ForEachRingVertex(candidates[active_proposals[idx]],
+                                  [&](int nb_vidx) {
+                                      Release(endpoint_claims[nb_vidx]);
+                                      Release(ring_claims[nb_vidx]);
+                                  });
+            });
+        }
+
+        // Apply the cheapest collapses until the target is reached
+        std::sort(collapses.begin(), collapses.end(), [&](int a, int b) {
+            return candidates[a] < candidates[b];
+        });
+        collapse_removed_triangles.resize(collapses.size());
+        utility::ParallelFor(0, int64_t(collapses.size()), [&](int64_t idx) {
+            const CollapseCandidate& candidate = candidates[collapses[idx]];
+            int count = 0;
+            for (const int* tidx = adjacency.begin(candidate.vidx0_);
+                 tidx != adjacency.end(candidate.vidx0_); ++tidx) {
+                const Eigen::Vector3i& tria = mesh->triangles_[*tidx];
+                if (candidate.vidx1_ == tria(0) ||
+                    candidate.vidx1_ == tria(1) ||
+                    candidate.vidx1_ == tria(2)) {
+                    count++;
+                }
+            }
+            collapse_removed_triangles[idx] = count;
+        });
+        size_t num_collapses = 0;
+        while (num_collapses < collapses.size() &&
+               n_triangles > target_number_of_triangles) {
+            n_triangles -= collapse_removed_triangles[num_collapses++];
+        }
+
+        // Only the proposals of vertices within two rings of a collapse
+        // change in the next round
+        dirty_vertices.clear();
+        for (size_t idx = 0; idx < num_collapses; ++idx) {
+            const CollapseCandidate& candidate = candidates[collapses[idx]];
+            for (int end_vidx : {candidate.vidx0_, candidate.vidx1_}) {
+                for (const int* tidx0 = adjacency.begin(end_vidx);
+                     tidx0 != adjacency.end(end_vidx); ++tidx0) {
+                    for (int k0 = 0; k0 < 3; ++k0) {
+                        const int vidx = mesh->triangles_[*tidx0](k0);
+                        for (const int* tidx1 = adjacency.begin(vidx);
+                             tidx1 != adjacency.end(vidx); ++tidx1) {
+                            for (int k1 = 0; k1 < 3; ++k1) {
+                                const int nb_vidx =
+                                        mesh->triangles_[*tidx1](k1);
+                                if (!is_dirty[nb_vidx]) {
+                                    is_dirty[nb_vidx] = 1;
+                                    dirty_vertices.push_back(nb_vidx);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        for (int vidx : dirty_vertices) {
+            is_dirty[vidx] = 0;
+        }
+
+        utility::ParallelFor(0, int64_t(num_collapses), [&](int64_t idx) {
+            const CollapseCandidate& candidate = candidates[collapses[idx]];
+            const int vidx0 = candidate.vidx0_;
+            const int vidx1 = candidate.vidx1_;
+
+            // Connect triangles from vidx1 to vidx0, or mark deleted
+            for (const int* tidx = adjacency.begin(vidx1);
+                 tidx != adjacency.end(vidx1); ++tidx) {
+                Eigen::Vector3i& tria = mesh->triangles_[*tidx];
+                bool has_vidx0 = vidx0 == tria(0) || vidx0 == tria(1) ||
+                                 vidx0 == tria(2);
+                if (has_vidx0) {
+                    triangles_deleted[*tidx] = 1;
+                } else if (vidx1 == tria(0)) {
+                    tria(0) = vidx0;
+                } else if (vidx1 == tria(1)) {
+                    tria(1) = vidx0;
+                } else if (vidx1 == tria(2)) {
+                    tria(2) = vidx0;
+                }
+            }
+
+            // update vertex vidx0 to vbar
+            mesh->vertices_[vidx0] = candidate.vbar_;
+            Qs[vidx0] += Qs[vidx1];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx0] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx0] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
+            }
+            vertices_deleted[vidx1] = 1;
+            candidates[vidx1] = CollapseCandidate();
+        });
+        utility::LogDebug(
+                "[SimplifyQuadricDecimationParallel] {:d} collapses, {:d} "
+                "triangles left",
+                num_collapses, n_triangles);
+
+        adjacency.Build(num_vertices, mesh->triangles_, triangles_deleted);
+    }
+
+    // Apply changes to the triangle mesh
+    int next_free = 0;
+    std::vector<int> vert_remapping(num_vertices, -1);
+    for (int idx = 0; idx < num_vertices; ++idx) {
+        if (!vertices_deleted[idx]) {
+            vert_remapping[idx] = next_free;
+            mesh->vertices_[next_free] = mesh->vertices_[idx];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    mesh->vertices_.resize(next_free);
+    if (has_vert_normal) {
+        mesh->vertex_normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        mesh->vertex_colors_.resize(next_free);
+    }
+
+    next_free = 0;
+    for (int idx = 0; idx < num_triangles; ++idx) {
+        if (!triangles_deleted[idx]) {
+            const Eigen::Vector3i& tria = mesh->triangles_[idx];
+            mesh->triangles_[next_free] =
+                    Eigen::Vector3i(vert_remapping[tria(0)],
+                                    vert_remapping[tria(1)],
+                                    vert_remapping[tria(2)]);
+            next_free++;
+        }
+    }
+    mesh->triangles_.resize(next_free);
+
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -25,15 +25,71 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
+#include "open3d/geometry/MeshAdjacency.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+/// Numbers the edges in the order in which the triangles reach them, i.e. by
+/// their first half-edge. A subdivision step appends the new edge vertices in
+/// this order, which is the order of a serial traversal of the triangles.
+static std::vector<int> NumberEdgesInTriangleOrder(
+        const MeshAdjacency& adjacency) {
+    std::vector<int> edge_numbers(adjacency.NumEdges());
+    int next = 0;
+    for (int half_edge = 0; half_edge < int(adjacency.NumHalfEdges());
+         ++half_edge) {
+        int edge = adjacency.HalfEdgeEdge(half_edge);
+        if (*adjacency.EdgeHalfEdgesBegin(edge) == half_edge) {
+            edge_numbers[edge] = next++;
+        }
+    }
+    return edge_numbers;
+}
+
+/// Splits each triangle into four at the new vertices of its edges.
+static std::vector<Eigen::Vector3i> SplitTriangles(
+        const std::vector<Eigen::Vector3i>& triangles,
+        const MeshAdjacency& adjacency,
+        const std::vector<int>& edge_numbers,
+        int num_old_vertices) {
+    std::vector<Eigen::Vector3i> new_triangles(4 * triangles.size());
+    utility::ParallelFor(
+            0, int64_t(triangles.size()),
+            [&](int64_t tidx) {
+                const auto& triangle = triangles[tidx];
+                int vidx0 = triangle(0);
+                int vidx1 = triangle(1);
+                int vidx2 = triangle(2);
+                int vidx01 = num_old_vertices +
+                             edge_numbers[adjacency.HalfEdgeEdge(
+                                     int(3 * tidx + 0))];
+                int vidx12 = num_old_vertices +
+                             edge_numbers[adjacency.HalfEdgeEdge(
+                                     int(3 * tidx + 1))];
+                int vidx20 = num_old_vertices +
+                             edge_numbers[adjacency.HalfEdgeEdge(
+                                     int(3 * tidx + 2))];
+                new_triangles[tidx * 4 + 0] =
+                        Eigen::Vector3i(vidx0, vidx01, vidx20);
+                new_triangles[tidx * 4 + 1] =
+                        Eigen::Vector3i(vidx01, vidx1, vidx12);
+                new_triangles[tidx * 4 + 2] =
+                        Eigen::Vector3i(vidx12, vidx2, vidx20);
+                new_triangles[tidx * 4 + 3] =
+                        Eigen::Vector3i(vidx01, vidx12, vidx20);
+            },
+            256);
+    return new_triangles;
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
     if (HasTriangleUvs()) {
@@ -50,59 +106,42 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        MeshAdjacency adjacency(mesh->triangles_, mesh->vertices_.size());
+        std::vector<int> edge_numbers = NumberEdgesInTriangleOrder(adjacency);
+        int num_old_vertices = int(mesh->vertices_.size());
+        size_t num_new_vertices = num_old_vertices + adjacency.NumEdges();
+        mesh->vertices_.resize(num_new_vertices);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(num_new_vertices);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(num_new_vertices);
+        }
+
+        // Each new vertex is the midpoint of its edge.
+        utility::ParallelFor(
+                0, int64_t(adjacency.NumEdges()),
+                [&](int64_t edge) {
+                    const Eigen::Vector2i& vidx = adjacency.GetEdge(int(edge));
+                    int vidx01 = num_old_vertices + edge_numbers[edge];
+                    mesh->vertices_[vidx01] =
+                            0.5 * (mesh->vertices_[vidx(0)] +
+                                   mesh->vertices_[vidx(1)]);
                     if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
+                        mesh->vertex_normals_[vidx01] =
+                                0.5 * (mesh->vertex_normals_[vidx(0)] +
+                                       mesh->vertex_normals_[vidx(1)]);
                     }
                     if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
+                        mesh->vertex_colors_[vidx01] =
+                                0.5 * (mesh->vertex_colors_[vidx(0)] +
+                                       mesh->vertex_colors_[vidx(1)]);
                     }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
-            new_triangles[tidx * 4 + 0] =
-                    Eigen::Vector3i(vidx0, vidx01, vidx20);
-            new_triangles[tidx * 4 + 1] =
-                    Eigen::Vector3i(vidx01, vidx1, vidx12);
-            new_triangles[tidx * 4 + 2] =
-                    Eigen::Vector3i(vidx12, vidx2, vidx20);
-            new_triangles[tidx * 4 + 3] =
-                    Eigen::Vector3i(vidx01, vidx12, vidx20);
-        }
-        mesh->triangles_ = new_triangles;
+                },
+                256);
+        mesh->triangles_ = SplitTriangles(mesh->triangles_, adjacency,
+                                          edge_numbers, num_old_vertices);
     }
 
     if (HasTriangleNormals()) {
@@ -119,198 +158,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 "[SubdivideLoop] This mesh contains triangle uvs that are not "
                 "handled in this function");
     }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
 
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    auto UpdateVertex = [&](int vidx,
-                            const std::shared_ptr<TriangleMesh>& old_mesh,
-                            std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
-        // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
-            }
-        }
-
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::LogWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.");
-        }
-
-        double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
-            beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
-            beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
-        } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
-        }
-
-        new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_[vidx] =
-                    alpha * old_mesh->vertex_normals_[vidx];
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_[vidx] =
-                    alpha * old_mesh->vertex_colors_[vidx];
-        }
-
-        auto Update = [&](int nb) {
-            new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx] +=
-                        beta * old_mesh->vertex_normals_[nb];
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx] +=
-                        beta * old_mesh->vertex_colors_[nb];
-            }
-        };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
-            }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
-            }
-        }
-    };
-
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
-                             const std::shared_ptr<TriangleMesh>& old_mesh,
-                             std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
-            Eigen::Vector3d new_vert =
-                    old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
-            Eigen::Vector3d new_normal;
-            if (has_vert_normal) {
-                new_normal = old_mesh->vertex_normals_[vidx0] +
-                             old_mesh->vertex_normals_[vidx1];
-            }
-            Eigen::Vector3d new_color;
-            if (has_vert_color) {
-                new_color = old_mesh->vertex_colors_[vidx0] +
-                            old_mesh->vertex_colors_[vidx1];
-            }
-
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
-                new_vert *= 0.5;
-                if (has_vert_normal) {
-                    new_normal *= 0.5;
-                }
-                if (has_vert_color) {
-                    new_color *= 0.5;
-                }
-            } else {
-                new_vert *= 3. / 8.;
-                if (has_vert_normal) {
-                    new_normal *= 3. / 8.;
-                }
-                if (has_vert_color) {
-                    new_color *= 3. / 8.;
-                }
-                size_t n_adjacent_trias = edge_triangles.size();
-                double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
-                    int vidx2 =
-                            (tria(0) != vidx0 && tria(0) != vidx1)
-                                    ? tria(0)
-                                    : ((tria(1) != vidx0 && tria(1) != vidx1)
-                                               ? tria(1)
-                                               : tria(2));
-                    new_vert += scale * old_mesh->vertices_[vidx2];
-                    if (has_vert_normal) {
-                        new_normal += scale * old_mesh->vertex_normals_[vidx2];
-                    }
-                    if (has_vert_color) {
-                        new_color += scale * old_mesh->vertex_colors_[vidx2];
-                    }
-                }
-            }
-
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
-            }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
-        }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
-        }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
-
     auto old_mesh = std::make_shared<TriangleMesh>();
     old_mesh->vertices_ = vertices_;
     old_mesh->vertex_colors_ = vertex_colors_;
@@ -318,54 +169,188 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
     old_mesh->triangles_ = triangles_;
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        size_t n_new_triangles = 4 * old_mesh->triangles_.size();
+        MeshAdjacency adjacency(old_mesh->triangles_,
+                                old_mesh->vertices_.size());
+        if (iter == 0) {
+            for (int edge = 0; edge < int(adjacency.NumEdges()); ++edge) {
+                if (adjacency.EdgeDegree(edge) > 2) {
+                    utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+                    break;
+                }
+            }
+        }
+        std::vector<int> edge_numbers = NumberEdgesInTriangleOrder(adjacency);
+        int num_old_vertices = int(old_mesh->vertices_.size());
+        size_t num_new_vertices = num_old_vertices + adjacency.NumEdges();
         auto new_mesh = std::make_shared<TriangleMesh>();
-        new_mesh->vertices_.resize(n_new_vertices);
+        new_mesh->vertices_.resize(num_new_vertices);
         if (has_vert_normal) {
-            new_mesh->vertex_normals_.resize(n_new_vertices);
+            new_mesh->vertex_normals_.resize(num_new_vertices);
         }
         if (has_vert_color) {
-            new_mesh->vertex_colors_.resize(n_new_vertices);
+            new_mesh->vertex_colors_.resize(num_new_vertices);
         }
-        new_mesh->triangles_.resize(n_new_triangles);
 
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
+        // The old vertices move towards their neighbors, or towards their
+        // neighbors along the boundary if they are on it.
+        std::atomic<bool> has_boundary_fan(false);
+        utility::ParallelFor(
+                0, int64_t(num_old_vertices),
+                [&](int64_t vidx) {
+                    std::vector<int> nbs =
+                            adjacency.GetVertexNeighbors(int(vidx));
+                    if (nbs.empty()) {
+                        new_mesh->vertices_[vidx] = old_mesh->vertices_[vidx];
+                        if (has_vert_normal) {
+                            new_mesh->vertex_normals_[vidx] =
+                                    old_mesh->vertex_normals_[vidx];
+                        }
+                        if (has_vert_color) {
+                            new_mesh->vertex_colors_[vidx] =
+                                    old_mesh->vertex_colors_[vidx];
+                        }
+                        return;
+                    }
+                    std::vector<int> boundary_nbs;
+                    for (const int* it =
+                                 adjacency.VertexHalfEdgesBegin(int(vidx));
+                         it != adjacency.VertexHalfEdgesEnd(int(vidx)); ++it) {
+                        int next = *it;
+                        int prev = MeshAdjacency::PrevHalfEdge(next);
+                        int next_edge = adjacency.HalfEdgeEdge(next);
+                        int prev_edge = adjacency.HalfEdgeEdge(prev);
+                        if (adjacency.EdgeDegree(next_edge) == 1) {
+                            boundary_nbs.push_back(
+                                    adjacency.HalfEdgeTarget(next));
+                        }
+                        if (adjacency.EdgeDegree(prev_edge) == 1) {
+                            boundary_nbs.push_back(
+                                    adjacency.HalfEdgeSource(prev));
+                        }
+                    }
+                    std::sort(boundary_nbs.begin(), boundary_nbs.end());
+                    boundary_nbs.erase(
+                            std::unique(boundary_nbs.begin(),
+                                        boundary_nbs.end()),
+                            boundary_nbs.end());
+
+                    // in manifold meshes this should not happen
+                    if (boundary_nbs.size() > 2) {
+                        has_boundary_fan = true;
+                    }
+
+                    double beta, alpha;
+                    if (boundary_nbs.size() >= 2) {
+                        beta = 1. / 8.;
+                        alpha = 1. - boundary_nbs.size() * beta;
+                    } else if (nbs.size() == 3) {
+                        beta = 3. / 16.;
+                        alpha = 1. - nbs.size() * beta;
+                    } else {
+                        beta = 3. / (8. * nbs.size());
+                        alpha = 1. - nbs.size() * beta;
+                    }
 
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
+                    new_mesh->vertices_[vidx] =
+                            alpha * old_mesh->vertices_[vidx];
+                    if (has_vert_normal) {
+                        new_mesh->vertex_normals_[vidx] =
+                                alpha * old_mesh->vertex_normals_[vidx];
+                    }
+                    if (has_vert_color) {
+                        new_mesh->vertex_colors_[vidx] =
+                                alpha * old_mesh->vertex_colors_[vidx];
+                    }
+                    for (int nb : boundary_nbs.size() >= 2 ? boundary_nbs
+                                                           : nbs) {
+                        new_mesh->vertices_[vidx] +=
+                                beta * old_mesh->vertices_[nb];
+                        if (has_vert_normal) {
+                            new_mesh->vertex_normals_[vidx] +=
+                                    beta * old_mesh->vertex_normals_[nb];
+                        }
+                        if (has_vert_color) {
+                            new_mesh->vertex_colors_[vidx] +=
+                                    beta * old_mesh->vertex_colors_[nb];
+                        }
+                    }
+                },
+                256);
+        if (has_boundary_fan) {
+            utility::LogWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.");
         }
 
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = old_mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
+        // The new vertex of an interior edge also weighs the corners opposite
+        // to the edge, the one of a boundary edge is its midpoint.
+        utility::ParallelFor(
+                0, int64_t(adjacency.NumEdges()),
+                [&](int64_t edge) {
+                    const Eigen::Vector2i& vidx = adjacency.GetEdge(int(edge));
+                    Eigen::Vector3d new_vert = old_mesh->vertices_[vidx(0)] +
+                                               old_mesh->vertices_[vidx(1)];
+                    Eigen::Vector3d new_normal;
+                    if (has_vert_normal) {
+                        new_normal = old_mesh->vertex_normals_[vidx(0)] +
+                                     old_mesh->vertex_normals_[vidx(1)];
+                    }
+                    Eigen::Vector3d new_color;
+                    if (has_vert_color) {
+                        new_color = old_mesh->vertex_colors_[vidx(0)] +
+                                    old_mesh->vertex_colors_[vidx(1)];
+                    }
 
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
+                    int n_adjacent_trias = adjacency.EdgeDegree(int(edge));
+                    if (n_adjacent_trias < 2) {
+                        new_vert *= 0.5;
+                        if (has_vert_normal) {
+                            new_normal *= 0.5;
+                        }
+                        if (has_vert_color) {
+                            new_color *= 0.5;
+                        }
+                    } else {
+                        new_vert *= 3. / 8.;
+                        if (has_vert_normal) {
+                            new_normal *= 3. / 8.;
+                        }
+                        if (has_vert_color) {
+                            new_color *= 3. / 8.;
+                        }
+                        double scale = 1. / (4. * n_adjacent_trias);
+                        for (const int* it =
+                                     adjacency.EdgeHalfEdgesBegin(int(edge));
+                             it != adjacency.EdgeHalfEdgesEnd(int(edge));
+                             ++it) {
+                            int vidx2 = adjacency.HalfEdgeSource(
+                                    MeshAdjacency::PrevHalfEdge(*it));
+                            new_vert += scale * old_mesh->vertices_[vidx2];
+                            if (has_vert_normal) {
+                                new_normal += scale *
+                                              old_mesh->vertex_normals_[vidx2];
+                            }
+                            if (has_vert_color) {
+                                new_color +=
+                                        scale * old_mesh->vertex_colors_[vidx2];
+                            }
+                        }
+                    }
 
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-        }
+                    int vidx01 = num_old_vertices + edge_numbers[edge];
+                    new_mesh->vertices_[vidx01] = new_vert;
+                    if (has_vert_normal) {
+                        new_mesh->vertex_normals_[vidx01] = new_normal;
+                    }
+                    if (has_vert_color) {
+                        new_mesh->vertex_colors_[vidx01] = new_color;
+                    }
+                },
+                256);
 
+        new_mesh->triangles_ = SplitTriangles(old_mesh->triangles_, adjacency,
+                                              edge_numbers, num_old_vertices);
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
     }
 
     if (HasTriangleNormals()) {
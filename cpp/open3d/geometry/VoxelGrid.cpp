@@ -26,8 +26,10 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include <cstdint>
 #include <numeric>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/camera/PinholeCameraParameters.h"
 #include "open3d/geometry/BoundingVolume.h"
@@ -35,6 +37,7 @@
 #include "open3d/geometry/Octree.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -270,6 +273,28 @@ std::shared_ptr<geometry::Octree> VoxelGrid::ToOctree(
     return octree;
 }
 
+/// Removes the voxels for which \p carve returns true. The voxels are tested
+/// in parallel, and \p carve must be safe to call concurrently.
+template <typename Func>
+static void CarveVoxels(VoxelGrid &grid, Func carve) {
+    std::vector<const Voxel *> voxels;
+    voxels.reserve(grid.voxels_.size());
+    for (const auto &it : grid.voxels_) {
+        voxels.push_back(&it.second);
+    }
+    std::vector<uint8_t> carved(voxels.size());
+    utility::ParallelFor(0, int64_t(voxels.size()), [&](int64_t idx) {
+        carved[idx] = carve(*voxels[idx]) ? 1 : 0;
+    });
+    for (size_t idx = 0; idx < voxels.size(); ++idx) {
+        if (carved[idx]) {
+            // The key is copied, since it is destroyed with the voxel.
+            Eigen::Vector3i grid_index = voxels[idx]->grid_index_;
+            grid.voxels_.erase(grid_index);
+        }
+    }
+}
+
 VoxelGrid &VoxelGrid::CarveDepthMap(
         const Image &depth_map,
         const camera::PinholeCameraParameters &camera_parameter,
@@ -287,9 +312,7 @@ VoxelGrid &VoxelGrid::CarveDepthMap(
 
     // get for each voxel if it projects to a valid pixel and check if the voxel
     // depth is behind the depth of the depth map at the projected pixel.
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
+    CarveVoxels(*this, [&](const geometry::Voxel &voxel) {
         auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
         for (auto &x : pts) {
             auto x_trans = rot * x + trans;
@@ -302,15 +325,11 @@ VoxelGrid &VoxelGrid::CarveDepthMap(
             std::tie(within_boundary, d) = depth_map.FloatValueAt(u, v);
             if ((!within_boundary && keep_voxels_outside_image) ||
                 (within_boundary && d > 0 && z >= d)) {
-                carve = false;
-                break;
+                return false;
             }
         }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
-    }
+        return true;
+    });
     return *this;
 }
 
@@ -331,9 +350,7 @@ VoxelGrid &VoxelGrid::CarveSilhouette(
 
     // get for each voxel if it projects to a valid pixel and check if the pixel
     // is set (>0).
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
+    CarveVoxels(*this, [&](const geometry::Voxel &voxel) {
         auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
         for (auto &x : pts) {
             auto x_trans = rot * x + trans;
@@ -346,15 +363,11 @@ VoxelGrid &VoxelGrid::CarveSilhouette(
             std::tie(within_boundary, d) = silhouette_mask.FloatValueAt(u, v);
             if ((!within_boundary && keep_voxels_outside_image) ||
                 (within_boundary && d > 0)) {
-                carve = false;
-                break;
+                return false;
             }
         }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
-    }
+        return true;
+    });
     return *this;
 }
 
@@ -24,8 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
 #include <numeric>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/PointCloud.h"
@@ -33,10 +37,22 @@
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+/// Lexicographic three-way comparison of voxel indices.
+static int CompareVoxelIndex(const Eigen::Vector3i &a,
+                             const Eigen::Vector3i &b) {
+    for (int i = 0; i < 3; ++i) {
+        if (a(i) != b(i)) {
+            return a(i) < b(i) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
 std::shared_ptr<VoxelGrid> VoxelGrid::CreateDense(const Eigen::Vector3d &origin,
                                                   const Eigen::Vector3d &color,
                                                   double voxel_size,
@@ -76,29 +92,39 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudWithinBounds(
     }
     output->voxel_size_ = voxel_size;
     output->origin_ = min_bound;
-    std::unordered_map<Eigen::Vector3i, AvgColorVoxel,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    bool has_colors = input.HasColors();
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        ref_coord = (input.points_[i] - min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+    // The points are sorted by voxel instead of being accumulated in a hash
+    // map. Within a voxel they stay in input order, so the colors add up in
+    // the same order as when they are inserted one by one.
+    const int num_points = int(input.points_.size());
+    std::vector<Eigen::Vector3i> voxel_indices(num_points);
+    utility::ParallelFor(0, int64_t(num_points), [&](int64_t i) {
+        Eigen::Vector3d ref_coord = (input.points_[i] - min_bound) / voxel_size;
+        voxel_indices[i] << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
                 int(floor(ref_coord(2)));
-        if (has_colors) {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index,
-                                                    input.colors_[i]);
-        } else {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index);
+    });
+    std::vector<int> order(num_points);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int a, int b) {
+        int c = CompareVoxelIndex(voxel_indices[a], voxel_indices[b]);
+        return c < 0 || (c == 0 && a < b);
+    });
+
+    bool has_colors = input.HasColors();
+    for (int begin = 0, end = 0; begin < num_points; begin = end) {
+        const Eigen::Vector3i &voxel_index = voxel_indices[order[begin]];
+        AvgColorVoxel accpoint;
+        for (end = begin;
+             end < num_points && voxel_indices[order[end]] == voxel_index;
+             ++end) {
+            if (has_colors) {
+                accpoint.Add(voxel_index, input.colors_[order[end]]);
+            } else {
+                accpoint.Add(voxel_index);
+            }
         }
-    }
-    for (auto accpoint : voxelindex_to_accpoint) {
-        const Eigen::Vector3i &grid_index = accpoint.second.GetVoxelIndex();
-        const Eigen::Vector3d &color =
-                has_colors ? accpoint.second.GetAverageColor()
-                           : Eigen::Vector3d(0, 0, 0);
-        output->AddVoxel(geometry::Voxel(grid_index, color));
+        const Eigen::Vector3d &color = has_colors ? accpoint.GetAverageColor()
+                                                  : Eigen::Vector3d(0, 0, 0);
+        output->AddVoxel(geometry::Voxel(voxel_index, color));
     }
     utility::LogDebug(
             "Pointcloud is voxelized from {:d} points to {:d} voxels.",
@@ -133,30 +159,64 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
     output->origin_ = min_bound;
 
     Eigen::Vector3d grid_size = max_bound - min_bound;
-    int num_w = int(std::round(grid_size(0) / voxel_size));
-    int num_h = int(std::round(grid_size(1) / voxel_size));
-    int num_d = int(std::round(grid_size(2) / voxel_size));
+    const Eigen::Vector3i num_voxels =
+            (grid_size / voxel_size).array().round().cast<int>();
     const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
                                         voxel_size / 2);
-    for (int widx = 0; widx < num_w; widx++) {
-        for (int hidx = 0; hidx < num_h; hidx++) {
-            for (int didx = 0; didx < num_d; didx++) {
-                const Eigen::Vector3d box_center =
-                        min_bound +
-                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
-                for (const Eigen::Vector3i &tria : input.triangles_) {
-                    const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
-                    const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
-                    const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
-                    if (IntersectionTest::TriangleAABB(
-                                box_center, box_half_size, v0, v1, v2)) {
-                        Eigen::Vector3i grid_index(widx, hidx, didx);
-                        output->AddVoxel(geometry::Voxel(grid_index));
-                        break;
+
+    // Each triangle is only tested against the voxels that overlap its
+    // bounding box. Voxel (w, h, d) is centered at min_bound + (w, h, d) *
+    // voxel_size.
+    std::vector<std::vector<Eigen::Vector3i>> triangle_voxels(
+            input.triangles_.size());
+    utility::ParallelFor(0, int64_t(input.triangles_.size()), [&](int64_t t) {
+        const Eigen::Vector3i &tria = input.triangles_[t];
+        const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
+        const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
+        const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
+        Eigen::Vector3d lo = (v0.cwiseMin(v1).cwiseMin(v2) - min_bound) /
+                                     voxel_size -
+                             Eigen::Vector3d::Constant(0.5);
+        Eigen::Vector3d hi = (v0.cwiseMax(v1).cwiseMax(v2) - min_bound) /
+                                     voxel_size +
+                             Eigen::Vector3d::Constant(0.5);
+        Eigen::Vector3i first, last;
+        for (int i = 0; i < 3; ++i) {
+            first(i) = int(std::max(std::floor(lo(i)), 0.0));
+            last(i) = int(std::min(std::ceil(hi(i)),
+                                   double(num_voxels(i) - 1)));
+        }
+        for (int widx = first(0); widx <= last(0); widx++) {
+            for (int hidx = first(1); hidx <= last(1); hidx++) {
+                for (int didx = first(2); didx <= last(2); didx++) {
+                    const Eigen::Vector3d box_center =
+                            min_bound +
+                            Eigen::Vector3d(widx, hidx, didx) * voxel_size;
+                    if (IntersectionTest::TriangleAABB(box_center,
+                                                       box_half_size, v0, v1,
+                                                       v2)) {
+                        triangle_voxels[t].emplace_back(widx, hidx, didx);
                     }
                 }
             }
         }
+    });
+
+    std::vector<Eigen::Vector3i> voxel_indices;
+    for (const std::vector<Eigen::Vector3i> &voxels : triangle_voxels) {
+        voxel_indices.insert(voxel_indices.end(), voxels.begin(),
+                             voxels.end());
+    }
+    tbb::parallel_sort(voxel_indices.begin(), voxel_indices.end(),
+                       [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                           return CompareVoxelIndex(a, b) < 0;
+                       });
+    voxel_indices.erase(
+            std::unique(voxel_indices.begin(), voxel_indices.end()),
+            voxel_indices.end());
+    output->voxels_.reserve(voxel_indices.size());
+    for (const Eigen::Vector3i &grid_index : voxel_indices) {
+        output->AddVoxel(geometry::Voxel(grid_index));
     }
 
     return output;
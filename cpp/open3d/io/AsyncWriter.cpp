@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/AsyncWriter.h"
+
+#include <algorithm>
+
+#include "open3d/io/PoseGraphIO.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace io {
+
+AsyncWriter::AsyncWriter(const AsyncWriterOption &option) : option_(option) {
+    const int num_threads = std::max(option_.num_threads, 1);
+    for (int i = 0; i < num_threads; ++i) {
+        threads_.emplace_back(&AsyncWriter::WorkerLoop, this);
+    }
+}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    task_queued_.notify_all();
+    for (std::thread &thread : threads_) {
+        thread.join();
+    }
+}
+
+std::future<bool> AsyncWriter::WritePointCloud(
+        const std::string &filename,
+        geometry::PointCloud pointcloud,
+        const WritePointCloudOption &params) {
+    // The shared pointer keeps the task copyable, as std::function requires.
+    auto shared = std::make_shared<geometry::PointCloud>(std::move(pointcloud));
+    return Submit([filename, shared, params]() {
+        return io::WritePointCloud(filename, *shared, params);
+    });
+}
+
+std::future<bool> AsyncWriter::WriteTriangleMesh(const std::string &filename,
+                                                 geometry::TriangleMesh mesh,
+                                                 bool write_ascii,
+                                                 bool compressed,
+                                                 bool write_vertex_normals,
+                                                 bool write_vertex_colors,
+                                                 bool write_triangle_uvs,
+                                                 bool print_progress) {
+    auto shared = std::make_shared<geometry::TriangleMesh>(std::move(mesh));
+    return Submit([=]() {
+        return io::WriteTriangleMesh(filename, *shared, write_ascii,
+                                     compressed, write_vertex_normals,
+                                     write_vertex_colors, write_triangle_uvs,
+                                     print_progress);
+    });
+}
+
+std::future<bool> AsyncWriter::WriteImage(const std::string &filename,
+                                          geometry::Image image,
+                                          int quality) {
+    auto shared = std::make_shared<geometry::Image>(std::move(image));
+    return Submit([filename, shared, quality]() {
+        return io::WriteImage(filename, *shared, quality);
+    });
+}
+
+std::future<bool> AsyncWriter::WritePoseGraph(
+        const std::string &filename,
+        pipelines::registration::PoseGraph pose_graph) {
+    auto shared = std::make_shared<pipelines::registration::PoseGraph>(
+            std::move(pose_graph));
+    return Submit([filename, shared]() {
+        return io::WritePoseGraph(filename, *shared);
+    });
+}
+
+std::future<bool> AsyncWriter::Submit(std::function<bool()> write) {
+    std::packaged_task<bool()> task(std::move(write));
+    std::future<bool> result = task.get_future();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_taken_.wait(lock, [this] {
+            return option_.max_queue_size <= 0 ||
+                   queue_.size() < size_t(option_.max_queue_size);
+        });
+        queue_.push_back(std::move(task));
+        ++pending_;
+    }
+    task_queued_.notify_one();
+    return result;
+}
+
+void AsyncWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_done_.wait(lock, [this] { return pending_ == 0; });
+}
+
+size_t AsyncWriter::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_;
+}
+
+void AsyncWriter::WorkerLoop() {
+    while (true) {
+        std::packaged_task<bool()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_queued_.wait(lock,
+                              [this] { return stop_ || !queue_.empty(); });
+            // Queued writes are completed before stopping.
+            if (queue_.empty()) return;
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task_taken_.notify_one();
+
+        // Exceptions are stored in the future by the packaged task.
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --pending_;
+        }
+        task_done_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
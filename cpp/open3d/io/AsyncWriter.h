@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct AsyncWriterOption
+///
+/// Options of AsyncWriter.
+struct AsyncWriterOption {
+    /// Number of writing threads.
+    int num_threads = 1;
+    /// Maximal number of writes waiting for a thread. Queuing a write to a
+    /// full queue blocks until a thread takes a write. If <= 0, the queue is
+    /// not bounded.
+    int max_queue_size = 8;
+};
+
+/// \class AsyncWriter
+///
+/// Writes geometries on background threads, so that the calling thread can
+/// keep processing while the outputs are written. The geometries are copied,
+/// or moved, into the queue, and each write returns a future holding the
+/// result of the write function. Exceptions thrown while writing are rethrown
+/// by the get function of the future.
+///
+/// \code
+/// io::AsyncWriter writer;
+/// std::future<bool> written =
+///         writer.WritePointCloud("fragment.ply", std::move(pointcloud));
+/// // Keep processing.
+/// writer.Flush();
+/// \endcode
+class AsyncWriter {
+public:
+    explicit AsyncWriter(const AsyncWriterOption &option = {});
+    /// Waits for the queued writes to complete.
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter &) = delete;
+    AsyncWriter &operator=(const AsyncWriter &) = delete;
+
+    /// Queues io::WritePointCloud. Compression is enabled by
+    /// \p params.compressed for the formats supporting it.
+    std::future<bool> WritePointCloud(
+            const std::string &filename,
+            geometry::PointCloud pointcloud,
+            const WritePointCloudOption &params = WritePointCloudOption());
+
+    /// Queues io::WriteTriangleMesh.
+    std::future<bool> WriteTriangleMesh(const std::string &filename,
+                                        geometry::TriangleMesh mesh,
+                                        bool write_ascii = false,
+                                        bool compressed = false,
+                                        bool write_vertex_normals = true,
+                                        bool write_vertex_colors = true,
+                                        bool write_triangle_uvs = true,
+                                        bool print_progress = false);
+
+    /// Queues io::WriteImage.
+    std::future<bool> WriteImage(
+            const std::string &filename,
+            geometry::Image image,
+            int quality = kOpen3DImageIODefaultQuality);
+
+    /// Queues io::WritePoseGraph.
+    std::future<bool> WritePoseGraph(
+            const std::string &filename,
+            pipelines::registration::PoseGraph pose_graph);
+
+    /// Queues an arbitrary write function.
+    std::future<bool> Submit(std::function<bool()> write);
+
+    /// Blocks until the queued writes completed.
+    void Flush();
+
+    /// Number of writes queued or running.
+    size_t GetPendingCount() const;
+
+private:
+    void WorkerLoop();
+
+    AsyncWriterOption option_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable task_queued_;
+    std::condition_variable task_taken_;
+    std::condition_variable task_done_;
+    std::deque<std::packaged_task<bool()>> queue_;
+    size_t pending_ = 0;
+    bool stop_ = false;
+
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -29,6 +29,7 @@
 #include <map>
 
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Metrics.h"
 
 namespace open3d {
 namespace io {
@@ -58,5 +59,33 @@ FileGeometry ReadFileGeometryType(const std::string& path) {
     }
 }
 
+void RecordFileRead(const std::string& filename, const std::string& format) {
+    utility::Metrics::GetCounter("open3d_io_files_read_total",
+                                 {{"format", format}},
+                                 "Number of files read by the io module.")
+            .Add();
+    int64_t size = utility::filesystem::GetFileSize(filename);
+    if (size > 0) {
+        utility::Metrics::GetCounter("open3d_io_bytes_read_total",
+                                     {{"format", format}},
+                                     "Number of bytes read by the io module.")
+                .Add(size);
+    }
+}
+
+void RecordFileWritten(const std::string& filename, const std::string& format) {
+    utility::Metrics::GetCounter("open3d_io_files_written_total",
+                                 {{"format", format}},
+                                 "Number of files written by the io module.")
+            .Add();
+    int64_t size = utility::filesystem::GetFileSize(filename);
+    if (size > 0) {
+        utility::Metrics::GetCounter(
+                "open3d_io_bytes_written_total", {{"format", format}},
+                "Number of bytes written by the io module.")
+                .Add(size);
+    }
+}
+
 }  // namespace io
 }  // namespace open3d
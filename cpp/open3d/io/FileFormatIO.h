@@ -55,5 +55,13 @@ FileGeometry ReadFileGeometryTypeXYZ(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZN(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZRGB(const std::string& path);
 
+/// Counts a successfully read file of \p format and its size in bytes, see
+/// utility::Metrics.
+void RecordFileRead(const std::string& filename, const std::string& format);
+
+/// Counts a successfully written file of \p format and its size in bytes,
+/// see utility::Metrics.
+void RecordFileWritten(const std::string& filename, const std::string& format);
+
 }  // namespace io
 }  // namespace open3d
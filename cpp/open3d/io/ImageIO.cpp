@@ -26,10 +26,14 @@
 
 #include "open3d/io/ImageIO.h"
 
+#include <algorithm>
 #include <unordered_map>
 
+#include "open3d/io/FileFormatIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 
@@ -43,6 +47,7 @@ static const std::unordered_map<
                 {"png", ReadImageFromPNG},
                 {"jpg", ReadImageFromJPG},
                 {"jpeg", ReadImageFromJPG},
+                {"lzf", ReadImageFromLZF},
         };
 
 static const std::unordered_map<
@@ -52,6 +57,7 @@ static const std::unordered_map<
                 {"png", WriteImageToPNG},
                 {"jpg", WriteImageToJPG},
                 {"jpeg", WriteImageToJPG},
+                {"lzf", WriteImageToLZF},
         };
 
 }  // unnamed namespace
@@ -66,6 +72,7 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 }
 
 bool ReadImage(const std::string &filename, geometry::Image &image) {
+    OPEN3D_PROFILE_SCOPE("io::ReadImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -80,12 +87,15 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
                 filename_ext);
         return false;
     }
-    return map_itr->second(filename, image);
+    bool success = map_itr->second(filename, image);
+    if (success) RecordFileRead(filename, filename_ext);
+    return success;
 }
 
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = kOpen3DImageIODefaultQuality*/) {
+    OPEN3D_PROFILE_SCOPE("io::WriteImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -99,7 +109,26 @@ bool WriteImage(const std::string &filename,
                 "Write geometry::Image failed: unknown file extension.");
         return false;
     }
-    return map_itr->second(filename, image, quality);
+    bool success = map_itr->second(filename, image, quality);
+    if (success) RecordFileWritten(filename, filename_ext);
+    return success;
+}
+
+bool WriteImages(const std::vector<std::string> &filenames,
+                 const std::vector<std::shared_ptr<geometry::Image>> &images,
+                 int quality /* = kOpen3DImageIODefaultQuality*/) {
+    if (filenames.size() != images.size()) {
+        utility::LogWarning(
+                "Write geometry::Image failed: {} filenames for {} images.",
+                filenames.size(), images.size());
+        return false;
+    }
+    std::vector<uint8_t> success(images.size(), 0);
+    utility::ParallelFor(0, int64_t(images.size()), [&](int64_t i) {
+        success[i] = images[i] && WriteImage(filenames[i], *images[i], quality);
+    });
+    return std::all_of(success.begin(), success.end(),
+                       [](uint8_t s) { return s != 0; });
 }
 
 }  // namespace io
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/geometry/Image.h"
 
@@ -49,16 +50,29 @@ constexpr int kOpen3DImageIODefaultQuality = -1;
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports quality, the parameter will be used.
 /// Otherwise it will be ignored.
-/// \param quality: PNG: [0-9] <=2 fast write for storing intermediate data
-///                            >=3 (default) normal write for balanced speed and
-///                            file size
+/// \param quality: PNG: [0-9] zlib compression level. <=2 fast write for
+///                            storing intermediate data, 6 (default) for
+///                            balanced speed and file size, 9 for the
+///                            smallest files.
 ///                 JPEG: [0-100] Typically in [70,95]. 90 is default (good
 ///                 quality).
+///                 LZF: 0 stores the data without compression. Any other
+///                 value compresses with LZF, which is much faster than PNG
+///                 for intermediate data, e.g. depth images.
 /// \return return true if the write function is successful, false otherwise.
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality = kOpen3DImageIODefaultQuality);
 
+/// Writes multiple images in parallel, see WriteImage(). The images are
+/// encoded concurrently, so this is faster than calling WriteImage() in a
+/// loop for formats with expensive compression such as PNG. The number of
+/// threads can be bounded with utility::ScopedMaxParallelism.
+/// \return return true if all images were written, false otherwise.
+bool WriteImages(const std::vector<std::string> &filenames,
+                 const std::vector<std::shared_ptr<geometry::Image>> &images,
+                 int quality = kOpen3DImageIODefaultQuality);
+
 bool ReadImageFromPNG(const std::string &filename, geometry::Image &image);
 
 bool WriteImageToPNG(const std::string &filename,
@@ -71,5 +85,16 @@ bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = kOpen3DImageIODefaultQuality);
 
+/// Compresses \p image as JPEG into \p buffer, see WriteImageToJPG().
+bool WriteImageToJPGInMemory(const geometry::Image &image,
+                             std::vector<uint8_t> &buffer,
+                             int quality = kOpen3DImageIODefaultQuality);
+
+bool ReadImageFromLZF(const std::string &filename, geometry::Image &image);
+
+bool WriteImageToLZF(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality = kOpen3DImageIODefaultQuality);
+
 }  // namespace io
 }  // namespace open3d
@@ -68,5 +68,17 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+/// Reads a trajectory in the binary format of
+/// WritePinholeCameraTrajectoryToBIN from a memory-mapped file.
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+/// Writes the extrinsic and intrinsic matrices and the image sizes of the
+/// cameras of \p trajectory as arrays of doubles and integers.
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
 }  // namespace io
 }  // namespace open3d
@@ -29,9 +29,11 @@
 #include <iostream>
 #include <unordered_map>
 
+#include "open3d/io/FileFormatIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -77,6 +79,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("io::ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -99,6 +102,7 @@ bool ReadPointCloud(const std::string &filename,
         pointcloud.RemoveNonFinitePoints(params.remove_nan_points,
                                          params.remove_infinite_points);
     }
+    if (success) RecordFileRead(filename, format);
     return success;
 }
 bool ReadPointCloud(const std::string &filename,
@@ -127,6 +131,7 @@ bool ReadPointCloud(const std::string &filename,
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("io::WritePointCloud");
     std::string format =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     auto map_itr = file_extension_to_pointcloud_write_function.find(format);
@@ -141,6 +146,7 @@ bool WritePointCloud(const std::string &filename,
     bool success = map_itr->second(filename, pointcloud, params);
     utility::LogDebug("Write geometry::PointCloud: {} vertices.",
                       pointcloud.points_.size());
+    if (success) RecordFileWritten(filename, format);
     return success;
 }
 bool WritePointCloud(const std::string &filename,
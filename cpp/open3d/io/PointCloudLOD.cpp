@@ -0,0 +1,729 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/PointCloudLOD.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <queue>
+#include <unordered_set>
+
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+/// A point as stored in the temporary partition files.
+struct PointRecord {
+    double position_[3];
+    float color_[3];
+    float normal_[3];
+};
+using Points = std::vector<PointRecord>;
+
+/// Returns the point cloud with the given index, or nullptr on failure.
+using ChunkReader =
+        std::function<std::shared_ptr<const geometry::PointCloud>(size_t)>;
+
+/// Number of records read from a partition file at once.
+const size_t kReadChunkSize = 1 << 20;
+/// Number of records buffered for a partition before appending to its file.
+const size_t kFlushSize = 1 << 16;
+const char *kHierarchyFilename = "lod.json";
+
+/// Minimal corner and edge length of the cell of the node \p name.
+void GetNodeCell(const std::string &name,
+                 const Eigen::Vector3d &root_min,
+                 double root_size,
+                 Eigen::Vector3d &min_bound,
+                 double &size) {
+    min_bound = root_min;
+    size = root_size;
+    for (size_t i = 1; i < name.size(); ++i) {
+        const int child = name[i] - '0';
+        size *= 0.5;
+        min_bound += size * Eigen::Vector3d(child & 1, (child >> 1) & 1,
+                                            (child >> 2) & 1);
+    }
+}
+
+int GetChildIndex(const double *position,
+                  const Eigen::Vector3d &min_bound,
+                  double size) {
+    const double half = 0.5 * size;
+    return int(position[0] >= min_bound(0) + half) |
+           int(position[1] >= min_bound(1) + half) << 1 |
+           int(position[2] >= min_bound(2) + half) << 2;
+}
+
+class LODBuilder {
+public:
+    LODBuilder(const std::string &directory, const PointCloudLODOption &option)
+        : directory_(directory),
+          tmp_directory_(directory + "/tmp"),
+          option_(option) {}
+
+    bool Build(size_t num_chunks, const ChunkReader &read_chunk) {
+        if (!utility::filesystem::MakeDirectoryHierarchy(tmp_directory_)) {
+            utility::LogWarning("Write LOD failed: unable to create {}",
+                                tmp_directory_);
+            return false;
+        }
+        bool success = ComputeBounds(num_chunks, read_chunk) &&
+                       Partition(num_chunks, read_chunk);
+        // Splitting a partition adds its children to partitions_.
+        const std::map<std::string, size_t> partitions = partitions_;
+        for (auto it = partitions.begin(); success && it != partitions.end();
+             ++it) {
+            success = BuildPartition(it->first, it->second);
+        }
+        success = success && BuildAncestors() && WriteHierarchy();
+        utility::filesystem::DeleteDirectory(tmp_directory_);
+        return success;
+    }
+
+private:
+    size_t GetDepth(const std::string &name) const { return name.size() - 1; }
+
+    double GetSpacing(size_t depth) const {
+        return std::ldexp(spacing_, -int(depth));
+    }
+
+    std::string GetPartitionFilename(const std::string &name) const {
+        return tmp_directory_ + "/" + name + ".part";
+    }
+
+    bool ComputeBounds(size_t num_chunks, const ChunkReader &read_chunk) {
+        Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(INFINITY);
+        Eigen::Vector3d max_bound = Eigen::Vector3d::Constant(-INFINITY);
+        has_colors_ = true;
+        has_normals_ = true;
+        for (size_t i = 0; i < num_chunks; ++i) {
+            auto pointcloud = read_chunk(i);
+            if (!pointcloud) return false;
+            if (!pointcloud->HasPoints()) continue;
+            min_bound = min_bound.cwiseMin(pointcloud->GetMinBound());
+            max_bound = max_bound.cwiseMax(pointcloud->GetMaxBound());
+            has_colors_ = has_colors_ && pointcloud->HasColors();
+            has_normals_ = has_normals_ && pointcloud->HasNormals();
+            num_points_ += pointcloud->points_.size();
+        }
+        if (num_points_ == 0) {
+            utility::LogWarning("Write LOD failed: no points.");
+            return false;
+        }
+        // Enlarge the cube slightly so that the maximal points are inside.
+        size_ = std::max((max_bound - min_bound).maxCoeff(), 1e-6) * 1.001;
+        min_bound_ = 0.5 * (min_bound + max_bound) -
+                     Eigen::Vector3d::Constant(0.5 * size_);
+        spacing_ = option_.spacing > 0 ? option_.spacing : size_ / 128;
+        return true;
+    }
+
+    /// Appends the buffered points of the partition to its file.
+    bool FlushPartition(const std::string &name, Points &buffer) {
+        if (buffer.empty()) return true;
+        const std::string filename = GetPartitionFilename(name);
+        FILE *file = utility::filesystem::FOpen(filename, "ab");
+        if (!file) {
+            utility::LogWarning("Write LOD failed: unable to open {}",
+                                filename);
+            return false;
+        }
+        const size_t written = fwrite(buffer.data(), sizeof(PointRecord),
+                                      buffer.size(), file);
+        fclose(file);
+        partitions_[name] += written;
+        const bool success = written == buffer.size();
+        buffer.clear();
+        if (!success) {
+            utility::LogWarning("Write LOD failed: unable to write {}",
+                                filename);
+        }
+        return success;
+    }
+
+    /// Appends \p point to the buffer of the partition of depth \p depth in
+    /// the cell \p name.
+    bool AddToPartition(const PointRecord &point,
+                        std::string name,
+                        size_t depth,
+                        std::unordered_map<std::string, Points> &buffers) {
+        Eigen::Vector3d min_bound;
+        double size;
+        GetNodeCell(name, min_bound_, size_, min_bound, size);
+        while (GetDepth(name) < depth) {
+            const int child = GetChildIndex(point.position_, min_bound, size);
+            size *= 0.5;
+            min_bound += size * Eigen::Vector3d(child & 1, (child >> 1) & 1,
+                                                (child >> 2) & 1);
+            name += char('0' + child);
+        }
+        Points &buffer = buffers[name];
+        buffer.push_back(point);
+        return buffer.size() < kFlushSize || FlushPartition(name, buffer);
+    }
+
+    /// Writes the points into the partition files of the smallest depth at
+    /// which a partition holds max_points_in_memory points on average.
+    bool Partition(size_t num_chunks, const ChunkReader &read_chunk) {
+        size_t depth = 0;
+        for (size_t n = num_points_;
+             n > option_.max_points_in_memory && depth < option_.max_depth;
+             n /= 8) {
+            ++depth;
+        }
+        std::unordered_map<std::string, Points> buffers;
+        for (size_t i = 0; i < num_chunks; ++i) {
+            auto pointcloud = read_chunk(i);
+            if (!pointcloud) return false;
+            for (size_t j = 0; j < pointcloud->points_.size(); ++j) {
+                PointRecord point = {};
+                for (int k = 0; k < 3; ++k) {
+                    point.position_[k] = pointcloud->points_[j](k);
+                    if (has_colors_) {
+                        point.color_[k] = float(pointcloud->colors_[j](k));
+                    }
+                    if (has_normals_) {
+                        point.normal_[k] = float(pointcloud->normals_[j](k));
+                    }
+                }
+                if (!AddToPartition(point, "r", depth, buffers)) return false;
+            }
+        }
+        for (auto &buffer : buffers) {
+            if (!FlushPartition(buffer.first, buffer.second)) return false;
+        }
+        return true;
+    }
+
+    /// Builds the subtree of a partition in memory, or splits the partition
+    /// if it has too many points.
+    bool BuildPartition(const std::string &name, size_t num_points) {
+        const std::string filename = GetPartitionFilename(name);
+        FILE *file = utility::filesystem::FOpen(filename, "rb");
+        if (!file) {
+            utility::LogWarning("Write LOD failed: unable to open {}",
+                                filename);
+            return false;
+        }
+        const bool split = num_points > option_.max_points_in_memory &&
+                           GetDepth(name) < option_.max_depth;
+        Points points;
+        std::unordered_map<std::string, Points> buffers;
+        bool success = true;
+        if (split) {
+            Points chunk;
+            for (size_t offset = 0; success && offset < num_points;
+                 offset += chunk.size()) {
+                chunk.resize(std::min(kReadChunkSize, num_points - offset));
+                success = fread(chunk.data(), sizeof(PointRecord),
+                                chunk.size(), file) == chunk.size();
+                for (const PointRecord &point : chunk) {
+                    success = success &&
+                              AddToPartition(point, name, GetDepth(name) + 1,
+                                             buffers);
+                }
+            }
+        } else {
+            points.resize(num_points);
+            success = fread(points.data(), sizeof(PointRecord), num_points,
+                            file) == num_points;
+        }
+        fclose(file);
+        utility::filesystem::RemoveFile(filename);
+        if (!success) {
+            utility::LogWarning("Write LOD failed: unable to read {}",
+                                filename);
+            return false;
+        }
+        if (!split) {
+            return BuildNode(std::move(points), name, true);
+        }
+
+        std::vector<std::string> children;
+        for (auto &buffer : buffers) {
+            if (!FlushPartition(buffer.first, buffer.second)) return false;
+            children.push_back(buffer.first);
+        }
+        for (const std::string &child : children) {
+            if (!BuildPartition(child, partitions_[child])) return false;
+        }
+        return true;
+    }
+
+    /// Moves a subsample of \p points with a minimal distance of the spacing
+    /// of the node \p name to \p sampled. Points are taken if their grid cell
+    /// is not in \p occupied yet.
+    void Sample(Points &points,
+                const std::string &name,
+                std::unordered_set<uint64_t> &occupied,
+                Points &sampled) const {
+        Eigen::Vector3d min_bound;
+        double size;
+        GetNodeCell(name, min_bound_, size_, min_bound, size);
+        const double spacing = GetSpacing(GetDepth(name));
+        const int64_t resolution = std::min(
+                int64_t(std::ceil(size / spacing)), int64_t(1) << 20);
+        Points remaining;
+        for (const PointRecord &point : points) {
+            uint64_t key = 0;
+            for (int k = 2; k >= 0; --k) {
+                const int64_t index = std::min(
+                        std::max(int64_t((point.position_[k] - min_bound(k)) /
+                                         size * resolution),
+                                 int64_t(0)),
+                        resolution - 1);
+                key = (key << 21) | uint64_t(index);
+            }
+            if (occupied.insert(key).second) {
+                sampled.push_back(point);
+            } else {
+                remaining.push_back(point);
+            }
+        }
+        points.swap(remaining);
+    }
+
+    /// Builds the node \p name and its descendants from \p points. The root of
+    /// a partition is kept in memory until its ancestors are built.
+    bool BuildNode(Points points, const std::string &name, bool is_partition) {
+        Points node_points;
+        if (points.size() <= option_.max_points_per_node ||
+            GetDepth(name) >= option_.max_depth) {
+            node_points.swap(points);
+        } else {
+            std::unordered_set<uint64_t> occupied;
+            Sample(points, name, occupied, node_points);
+            Eigen::Vector3d min_bound;
+            double size;
+            GetNodeCell(name, min_bound_, size_, min_bound, size);
+            std::array<Points, 8> children;
+            for (const PointRecord &point : points) {
+                children[GetChildIndex(point.position_, min_bound, size)]
+                        .push_back(point);
+            }
+            Points().swap(points);
+            for (int i = 0; i < 8; ++i) {
+                if (children[i].empty()) continue;
+                if (!BuildNode(std::move(children[i]), name + char('0' + i),
+                               false)) {
+                    return false;
+                }
+            }
+        }
+        if (is_partition) {
+            pending_[name].swap(node_points);
+            return true;
+        }
+        return WriteNode(name, node_points);
+    }
+
+    /// Builds the nodes above the partitions, deepest first, by moving a
+    /// subsample of the children points up to the parent.
+    bool BuildAncestors() {
+        while (!pending_.empty()) {
+            size_t depth = 0;
+            for (const auto &node : pending_) {
+                depth = std::max(depth, GetDepth(node.first));
+            }
+            if (depth == 0) {
+                return WriteNode("r", pending_["r"]);
+            }
+            std::map<std::string, std::vector<std::string>> parents;
+            for (const auto &node : pending_) {
+                if (GetDepth(node.first) == depth) {
+                    parents[node.first.substr(0, depth)].push_back(node.first);
+                }
+            }
+            for (const auto &parent : parents) {
+                std::unordered_set<uint64_t> occupied;
+                Points parent_points;
+                for (const std::string &child : parent.second) {
+                    Sample(pending_[child], parent.first, occupied,
+                           parent_points);
+                    if (!WriteNode(child, pending_[child])) return false;
+                    pending_.erase(child);
+                }
+                pending_[parent.first].swap(parent_points);
+            }
+        }
+        return true;
+    }
+
+    bool WriteNode(const std::string &name, const Points &points) {
+        const std::string filename = directory_ + "/" + name + ".bin";
+        std::ofstream file(filename, std::ios::binary);
+        if (!file) {
+            utility::LogWarning("Write LOD failed: unable to open {}",
+                                filename);
+            return false;
+        }
+        // Positions are stored relative to the octree bounds.
+        std::vector<float> positions(points.size() * 3);
+        for (size_t i = 0; i < points.size(); ++i) {
+            for (int k = 0; k < 3; ++k) {
+                positions[i * 3 + k] =
+                        float(points[i].position_[k] - min_bound_(k));
+            }
+        }
+        file.write(reinterpret_cast<const char *>(positions.data()),
+                   positions.size() * sizeof(float));
+        if (has_colors_) {
+            std::vector<uint8_t> colors(points.size() * 3);
+            for (size_t i = 0; i < colors.size(); ++i) {
+                colors[i] = uint8_t(std::round(
+                        std::min(std::max(points[i / 3].color_[i % 3], 0.f),
+                                 1.f) *
+                        255.f));
+            }
+            file.write(reinterpret_cast<const char *>(colors.data()),
+                       colors.size());
+        }
+        if (has_normals_) {
+            std::vector<float> normals(points.size() * 3);
+            for (size_t i = 0; i < normals.size(); ++i) {
+                normals[i] = points[i / 3].normal_[i % 3];
+            }
+            file.write(reinterpret_cast<const char *>(normals.data()),
+                       normals.size() * sizeof(float));
+        }
+        if (!file) {
+            utility::LogWarning("Write LOD failed: unable to write {}",
+                                filename);
+            return false;
+        }
+        nodes_[name] = points.size();
+        return true;
+    }
+
+    bool WriteHierarchy() const {
+        Json::Value root;
+        root["version"] = 1;
+        for (int k = 0; k < 3; ++k) {
+            root["min_bound"].append(min_bound_(k));
+        }
+        root["size"] = size_;
+        root["spacing"] = spacing_;
+        root["has_colors"] = has_colors_;
+        root["has_normals"] = has_normals_;
+        root["nodes"] = Json::objectValue;
+        for (const auto &node : nodes_) {
+            root["nodes"][node.first] = Json::UInt64(node.second);
+        }
+        const std::string filename = directory_ + "/" + kHierarchyFilename;
+        std::ofstream file(filename);
+        if (!file) {
+            utility::LogWarning("Write LOD failed: unable to open {}",
+                                filename);
+            return false;
+        }
+        Json::StreamWriterBuilder builder;
+        builder["commentStyle"] = "None";
+        builder["indentation"] = "";
+        std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+        writer->write(root, &file);
+        return bool(file);
+    }
+
+    const std::string directory_;
+    const std::string tmp_directory_;
+    const PointCloudLODOption option_;
+
+    size_t num_points_ = 0;
+    Eigen::Vector3d min_bound_ = Eigen::Vector3d::Zero();
+    double size_ = 0.0;
+    double spacing_ = 0.0;
+    bool has_colors_ = false;
+    bool has_normals_ = false;
+
+    /// Number of points in each partition file.
+    std::map<std::string, size_t> partitions_;
+    /// Partition roots and their ancestors which are not written yet.
+    std::map<std::string, Points> pending_;
+    /// Number of points of the written nodes.
+    std::map<std::string, size_t> nodes_;
+};
+
+}  // unnamed namespace
+
+namespace io {
+
+bool WritePointCloudLOD(const std::vector<std::string> &filenames,
+                        const std::string &directory,
+                        const PointCloudLODOption &option) {
+    LODBuilder builder(directory, option);
+    return builder.Build(
+            filenames.size(),
+            [&filenames](size_t i)
+                    -> std::shared_ptr<const geometry::PointCloud> {
+                auto pointcloud = std::make_shared<geometry::PointCloud>();
+                if (!ReadPointCloud(filenames[i], *pointcloud)) {
+                    utility::LogWarning("Write LOD failed: unable to read {}",
+                                        filenames[i]);
+                    return nullptr;
+                }
+                return pointcloud;
+            });
+}
+
+bool WritePointCloudLOD(const geometry::PointCloud &pointcloud,
+                        const std::string &directory,
+                        const PointCloudLODOption &option) {
+    LODBuilder builder(directory, option);
+    // The point cloud is not owned by the returned pointer.
+    return builder.Build(1, [&pointcloud](size_t) {
+        return std::shared_ptr<const geometry::PointCloud>(
+                std::shared_ptr<const geometry::PointCloud>(), &pointcloud);
+    });
+}
+
+PointCloudLODReader::PointCloudLODReader(size_t max_cached_points)
+    : max_cached_points_(max_cached_points) {}
+
+bool PointCloudLODReader::Open(const std::string &directory) {
+    directory_ = directory;
+    nodes_.clear();
+    lru_.clear();
+    cache_.clear();
+    cached_points_ = 0;
+
+    const std::string filename = directory + "/" + kHierarchyFilename;
+    std::ifstream file(filename);
+    if (!file) {
+        utility::LogWarning("Read LOD failed: unable to open {}", filename);
+        return false;
+    }
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    Json::String errs;
+    if (!parseFromStream(builder, file, &root, &errs)) {
+        utility::LogWarning("Read LOD failed: {}", errs);
+        return false;
+    }
+    if (root.get("version", 0).asInt() != 1 || !root["nodes"].isObject() ||
+        !root["nodes"].isMember("r") || root["min_bound"].size() != 3) {
+        utility::LogWarning("Read LOD failed: invalid hierarchy {}", filename);
+        return false;
+    }
+    for (int k = 0; k < 3; ++k) {
+        min_bound_(k) = root["min_bound"][k].asDouble();
+    }
+    size_ = root["size"].asDouble();
+    spacing_ = root["spacing"].asDouble();
+    has_colors_ = root["has_colors"].asBool();
+    has_normals_ = root["has_normals"].asBool();
+
+    // Sorting the names puts every parent before its children.
+    std::vector<std::string> names = root["nodes"].getMemberNames();
+    std::sort(names.begin(), names.end());
+    std::unordered_map<std::string, size_t> indices;
+    for (const std::string &name : names) {
+        Node node;
+        node.name_ = name;
+        node.depth_ = name.size() - 1;
+        node.num_points_ = root["nodes"][name].asUInt64();
+        GetNodeCell(name, min_bound_, size_, node.min_bound_, node.size_);
+        if (node.depth_ > 0) {
+            auto parent = indices.find(name.substr(0, node.depth_));
+            if (parent == indices.end()) {
+                utility::LogWarning("Read LOD failed: node {} has no parent",
+                                    name);
+                nodes_.clear();
+                return false;
+            }
+            nodes_[parent->second].children_[name.back() - '0'] =
+                    int(nodes_.size());
+        }
+        indices[name] = nodes_.size();
+        nodes_.push_back(node);
+    }
+    return true;
+}
+
+std::vector<size_t> PointCloudLODReader::SelectNodes(
+        const camera::PinholeCameraParameters &camera,
+        double max_error,
+        size_t max_points) const {
+    std::vector<size_t> selected;
+    if (nodes_.empty()) return selected;
+
+    const Eigen::Matrix3d R = camera.extrinsic_.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = camera.extrinsic_.block<3, 1>(0, 3);
+    const auto focal = camera.intrinsic_.GetFocalLength();
+    const auto principal = camera.intrinsic_.GetPrincipalPoint();
+    const double width = camera.intrinsic_.width_;
+    const double height = camera.intrinsic_.height_;
+    // Inward normals of the side planes of the view frustum.
+    const std::array<Eigen::Vector3d, 4> planes = {
+            Eigen::Vector3d(focal.first, 0, principal.first).normalized(),
+            Eigen::Vector3d(-focal.first, 0, width - principal.first)
+                    .normalized(),
+            Eigen::Vector3d(0, focal.second, principal.second).normalized(),
+            Eigen::Vector3d(0, -focal.second, height - principal.second)
+                    .normalized()};
+
+    // Returns false if the node is outside of the frustum.
+    auto ComputeError = [&](const Node &node, double &error) {
+        const double radius = 0.5 * std::sqrt(3.0) * node.size_;
+        const Eigen::Vector3d center =
+                R * (node.min_bound_ +
+                     Eigen::Vector3d::Constant(0.5 * node.size_)) +
+                t;
+        if (center(2) < -radius) return false;
+        for (const Eigen::Vector3d &plane : planes) {
+            if (plane.dot(center) < -radius) return false;
+        }
+        const double distance = std::max(center.norm() - radius, 1e-6);
+        error = std::ldexp(spacing_, -int(node.depth_)) * focal.second /
+                distance;
+        return true;
+    };
+
+    std::priority_queue<std::pair<double, size_t>> queue;
+    double error;
+    if (ComputeError(nodes_[0], error)) queue.emplace(error, 0);
+    size_t num_points = 0;
+    while (!queue.empty()) {
+        const auto item = queue.top();
+        queue.pop();
+        const Node &node = nodes_[item.second];
+        if (num_points + node.num_points_ > max_points) break;
+        num_points += node.num_points_;
+        selected.push_back(item.second);
+        if (item.first <= max_error) continue;
+        for (int child : node.children_) {
+            if (child >= 0 && ComputeError(nodes_[child], error)) {
+                queue.emplace(error, size_t(child));
+            }
+        }
+    }
+    std::sort(selected.begin(), selected.end());
+    return selected;
+}
+
+std::shared_ptr<const geometry::PointCloud> PointCloudLODReader::ReadNode(
+        size_t index) {
+    auto cached = cache_.find(index);
+    if (cached != cache_.end()) {
+        lru_.splice(lru_.begin(), lru_, cached->second.second);
+        return cached->second.first;
+    }
+
+    const Node &node = nodes_.at(index);
+    const std::string filename = directory_ + "/" + node.name_ + ".bin";
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        utility::LogWarning("Read LOD failed: unable to open {}", filename);
+        return nullptr;
+    }
+    const size_t n = node.num_points_;
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    std::vector<float> values(n * 3);
+    file.read(reinterpret_cast<char *>(values.data()),
+              values.size() * sizeof(float));
+    pointcloud->points_.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        pointcloud->points_[i] =
+                min_bound_ + Eigen::Vector3d(values[i * 3], values[i * 3 + 1],
+                                             values[i * 3 + 2]);
+    }
+    if (has_colors_) {
+        std::vector<uint8_t> colors(n * 3);
+        file.read(reinterpret_cast<char *>(colors.data()), colors.size());
+        pointcloud->colors_.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            pointcloud->colors_[i] =
+                    Eigen::Vector3d(colors[i * 3], colors[i * 3 + 1],
+                                    colors[i * 3 + 2]) /
+                    255.0;
+        }
+    }
+    if (has_normals_) {
+        file.read(reinterpret_cast<char *>(values.data()),
+                  values.size() * sizeof(float));
+        pointcloud->normals_.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            pointcloud->normals_[i] = Eigen::Vector3d(
+                    values[i * 3], values[i * 3 + 1], values[i * 3 + 2]);
+        }
+    }
+    if (!file) {
+        utility::LogWarning("Read LOD failed: unable to read {}", filename);
+        return nullptr;
+    }
+
+    lru_.push_front(index);
+    cache_[index] = std::make_pair(pointcloud, lru_.begin());
+    cached_points_ += n;
+    while (cached_points_ > max_cached_points_ && lru_.size() > 1) {
+        cached_points_ -= nodes_[lru_.back()].num_points_;
+        cache_.erase(lru_.back());
+        lru_.pop_back();
+    }
+    return pointcloud;
+}
+
+std::shared_ptr<geometry::PointCloud> PointCloudLODReader::ReadPointCloud(
+        const camera::PinholeCameraParameters &camera,
+        double max_error,
+        size_t max_points) {
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    for (size_t index : SelectNodes(camera, max_error, max_points)) {
+        auto node = ReadNode(index);
+        if (!node) continue;
+        pointcloud->points_.insert(pointcloud->points_.end(),
+                                   node->points_.begin(), node->points_.end());
+        pointcloud->colors_.insert(pointcloud->colors_.end(),
+                                   node->colors_.begin(), node->colors_.end());
+        pointcloud->normals_.insert(pointcloud->normals_.end(),
+                                    node->normals_.begin(),
+                                    node->normals_.end());
+    }
+    return pointcloud;
+}
+
+size_t PointCloudLODReader::GetNumPoints() const {
+    size_t num_points = 0;
+    for (const Node &node : nodes_) {
+        num_points += node.num_points_;
+    }
+    return num_points;
+}
+
+}  // namespace io
+}  // namespace open3d
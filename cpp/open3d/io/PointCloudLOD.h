@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/camera/PinholeCameraParameters.h"
+#include "open3d/geometry/PointCloud.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct PointCloudLODOption
+///
+/// Options of WritePointCloudLOD.
+struct PointCloudLODOption {
+    /// Nodes with more points are split into a sampled node and 8 children.
+    size_t max_points_per_node = 20000;
+    /// Minimal distance between the points of the root node. The spacing is
+    /// halved at each depth. If <= 0, 1/128 of the octree size is used.
+    double spacing = 0.0;
+    /// Maximal depth of the octree. Nodes at this depth are not split.
+    size_t max_depth = 16;
+    /// Maximal number of points held in memory for building a subtree. The
+    /// input is partitioned into temporary files until each partition fits.
+    size_t max_points_in_memory = 10000000;
+};
+
+/// \brief Writes a level-of-detail octree of a point cloud which does not
+/// need to fit into memory.
+///
+/// Each node holds a subsample of the points in its cell with a minimal
+/// distance of the node spacing, and the points not taken are passed on to
+/// the children. A node together with its ancestors therefore has the point
+/// density of its depth, and every input point is stored in exactly one node.
+///
+/// The input is read twice, once for the bounds and once for partitioning the
+/// points into temporary files, which are then built independently. The
+/// nodes are written to \p directory as binary files named by their path
+/// from the root, e.g. r, r0, r07, and the hierarchy is written to
+/// lod.json.
+///
+/// \param filenames Point cloud files, each of which fits into memory. All
+/// files must have the same attributes. Colors and normals are written if all
+/// files have them.
+/// \return true on success.
+bool WritePointCloudLOD(const std::vector<std::string> &filenames,
+                        const std::string &directory,
+                        const PointCloudLODOption &option = {});
+
+/// Writes a level-of-detail octree of a point cloud in memory.
+bool WritePointCloudLOD(const geometry::PointCloud &pointcloud,
+                        const std::string &directory,
+                        const PointCloudLODOption &option = {});
+
+/// \class PointCloudLODReader
+///
+/// Reads a level-of-detail octree written by WritePointCloudLOD. The nodes
+/// needed for a view are selected by their screen-space error and loaded on
+/// demand. Loaded nodes are kept in a least recently used cache.
+///
+/// \code
+/// io::PointCloudLODReader reader;
+/// reader.Open("lod_dir");
+/// // For each frame
+/// auto pointcloud = reader.ReadPointCloud(camera, 2.0, 5000000);
+/// \endcode
+class PointCloudLODReader {
+public:
+    /// \struct Node
+    ///
+    /// A node of the hierarchy.
+    struct Node {
+        /// Path from the root, e.g. "r0".
+        std::string name_;
+        /// Depth of the node. The root is of depth 0.
+        size_t depth_ = 0;
+        /// Minimal corner of the node cell.
+        Eigen::Vector3d min_bound_ = Eigen::Vector3d::Zero();
+        /// Edge length of the node cell.
+        double size_ = 0.0;
+        /// Number of points stored in the node.
+        size_t num_points_ = 0;
+        /// Indices of the children in nodes_, or -1 for empty cells.
+        int children_[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+    };
+
+    /// \param max_cached_points Loaded nodes are evicted from the cache when
+    /// their total number of points exceeds this value.
+    explicit PointCloudLODReader(size_t max_cached_points = 50000000);
+
+    /// Reads the hierarchy in \p directory and clears the cache.
+    bool Open(const std::string &directory);
+
+    /// \brief Selects the nodes to display for a camera.
+    ///
+    /// Starting from the root, nodes intersecting the view frustum are
+    /// selected in order of their screen-space error, which is the node
+    /// spacing projected to the image in pixels. Children of a node are only
+    /// considered if its error is larger than \p max_error. The selection
+    /// stops when \p max_points would be exceeded.
+    /// \return indices into GetNodes(), ancestors before descendants.
+    std::vector<size_t> SelectNodes(
+            const camera::PinholeCameraParameters &camera,
+            double max_error = 1.0,
+            size_t max_points = 10000000) const;
+
+    /// Reads the points of a node from the cache or from disk.
+    std::shared_ptr<const geometry::PointCloud> ReadNode(size_t index);
+
+    /// Reads the selected nodes for the camera, see SelectNodes().
+    std::shared_ptr<geometry::PointCloud> ReadPointCloud(
+            const camera::PinholeCameraParameters &camera,
+            double max_error = 1.0,
+            size_t max_points = 10000000);
+
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+    /// Spacing of the root node.
+    double GetSpacing() const { return spacing_; }
+    /// Number of points of all nodes.
+    size_t GetNumPoints() const;
+    /// Number of points of the nodes in the cache.
+    size_t GetCachedPointCount() const { return cached_points_; }
+
+private:
+    std::string directory_;
+    std::vector<Node> nodes_;
+    Eigen::Vector3d min_bound_ = Eigen::Vector3d::Zero();
+    double size_ = 0.0;
+    double spacing_ = 0.0;
+    bool has_colors_ = false;
+    bool has_normals_ = false;
+
+    size_t max_cached_points_;
+    size_t cached_points_ = 0;
+    /// Node indices from the most to the least recently used.
+    std::list<size_t> lru_;
+    std::unordered_map<size_t,
+                       std::pair<std::shared_ptr<const geometry::PointCloud>,
+                                 std::list<size_t>::iterator>>
+            cache_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -51,5 +51,15 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const pipelines::registration::PoseGraph &pose_graph);
 
+/// Reads a pose graph in the binary format of WritePoseGraphToBIN. The file is
+/// memory-mapped and the nodes and edges are filled in parallel.
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph);
+
+/// Writes the nodes and edges of \p pose_graph as arrays of doubles and
+/// integers, without any conversion to text.
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const pipelines::registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
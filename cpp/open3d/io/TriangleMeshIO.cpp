@@ -28,8 +28,10 @@
 
 #include <unordered_map>
 
+#include "open3d/io/FileFormatIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 
@@ -43,8 +45,8 @@ static const std::unordered_map<
                            const ReadTriangleMeshOptions &)>>
         file_extension_to_trianglemesh_read_function{
                 {"ply", ReadTriangleMeshFromPLY},
-                {"stl", ReadTriangleMeshUsingASSIMP},
-                {"obj", ReadTriangleMeshUsingASSIMP},
+                {"stl", ReadTriangleMeshFromSTL},
+                {"obj", ReadTriangleMeshFromOBJGeometry},
                 {"off", ReadTriangleMeshFromOFF},
                 {"gltf", ReadTriangleMeshUsingASSIMP},
                 {"glb", ReadTriangleMeshUsingASSIMP},
@@ -86,6 +88,7 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       ReadTriangleMeshOptions params /*={}*/) {
+    OPEN3D_PROFILE_SCOPE("io::ReadTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -123,6 +126,7 @@ bool ReadTriangleMesh(const std::string &filename,
                 "geometry::TriangleMesh appears to be a geometry::PointCloud "
                 "(only contains vertices, but no triangles).");
     }
+    if (success) RecordFileRead(filename, filename_ext);
     return success;
 }
 
@@ -134,6 +138,7 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_vertex_colors /* = true*/,
                        bool write_triangle_uvs /* = true*/,
                        bool print_progress /* = false*/) {
+    OPEN3D_PROFILE_SCOPE("io::WriteTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -156,6 +161,7 @@ bool WriteTriangleMesh(const std::string &filename,
     utility::LogDebug(
             "Write geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
             (int)mesh.triangles_.size(), (int)mesh.vertices_.size());
+    if (success) RecordFileWritten(filename, filename_ext);
     return success;
 }
 
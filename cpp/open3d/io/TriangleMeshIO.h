@@ -88,6 +88,13 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
                             bool write_triangle_uvs,
                             bool print_progress);
 
+/// Reads a binary STL file in parallel. Every facet has its own three
+/// vertices. ASCII files, and reads with post processing, go through
+/// ReadTriangleMeshUsingASSIMP.
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             const ReadTriangleMeshOptions &params);
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
@@ -102,6 +109,14 @@ bool ReadTriangleMeshFromOBJ(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              const ReadTriangleMeshOptions &params);
 
+/// Reads the geometry of an OBJ file with a parallel parser that fills \p mesh
+/// directly. Polygons are triangulated as fans. Files that reference
+/// materials, and reads with post processing, go through
+/// ReadTriangleMeshUsingASSIMP.
+bool ReadTriangleMeshFromOBJGeometry(const std::string &filename,
+                                     geometry::TriangleMesh &mesh,
+                                     const ReadTriangleMeshOptions &params);
+
 bool WriteTriangleMeshToOBJ(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
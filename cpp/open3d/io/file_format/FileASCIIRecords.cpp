@@ -0,0 +1,327 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/file_format/FileASCIIRecords.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+/// Bytes parsed between two progress updates.
+constexpr int64_t kBatchSize = int64_t(64) << 20;
+
+const double kPowersOf10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                              1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                              1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                              1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/// Parses the number starting at \p ptr with strtod. Used for the inputs the
+/// fast path does not handle exactly, e.g. long mantissas, large exponents,
+/// hexadecimal numbers, inf and nan.
+const char *ParseDoubleSlow(const char *ptr, const char *end, double &value) {
+    char buffer[128];
+    size_t length = 0;
+    while (ptr + length < end && !IsSpace(ptr[length]) &&
+           length + 1 < sizeof(buffer)) {
+        buffer[length] = ptr[length];
+        ++length;
+    }
+    buffer[length] = '\0';
+    char *parsed_end;
+    value = std::strtod(buffer, &parsed_end);
+    if (parsed_end == buffer) {
+        return nullptr;
+    }
+    return ptr + (parsed_end - buffer);
+}
+
+}  // unnamed namespace
+
+const char *ParseDouble(const char *ptr, const char *end, double &value) {
+    const char *begin = ptr;
+    bool negative = false;
+    if (ptr < end && (*ptr == '-' || *ptr == '+')) {
+        negative = *ptr == '-';
+        ++ptr;
+    }
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int64_t exponent = 0;
+    bool has_digits = false;
+    bool truncated = false;
+    for (; ptr < end && IsDigit(*ptr); ++ptr) {
+        has_digits = true;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*ptr - '0');
+            num_digits += mantissa != 0;
+        } else {
+            truncated = true;
+            ++exponent;
+        }
+    }
+    if (ptr < end && *ptr == '.') {
+        for (++ptr; ptr < end && IsDigit(*ptr); ++ptr) {
+            has_digits = true;
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + (*ptr - '0');
+                num_digits += mantissa != 0;
+                --exponent;
+            } else {
+                truncated = true;
+            }
+        }
+    }
+    if (!has_digits || (ptr < end && (*ptr == 'x' || *ptr == 'X'))) {
+        return ParseDoubleSlow(begin, end, value);
+    }
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        const char *exp_ptr = ptr + 1;
+        bool exp_negative = false;
+        if (exp_ptr < end && (*exp_ptr == '-' || *exp_ptr == '+')) {
+            exp_negative = *exp_ptr == '-';
+            ++exp_ptr;
+        }
+        if (exp_ptr < end && IsDigit(*exp_ptr)) {
+            int64_t exp_value = 0;
+            for (; exp_ptr < end && IsDigit(*exp_ptr); ++exp_ptr) {
+                if (exp_value < 100000) {
+                    exp_value = exp_value * 10 + (*exp_ptr - '0');
+                }
+            }
+            exponent += exp_negative ? -exp_value : exp_value;
+            ptr = exp_ptr;
+        }
+    }
+    if (truncated || mantissa > (uint64_t(1) << 53) || exponent < -22 ||
+        exponent > 22) {
+        return ParseDoubleSlow(begin, end, value);
+    }
+    value = static_cast<double>(mantissa);
+    value = exponent < 0 ? value / kPowersOf10[-exponent]
+                         : value * kPowersOf10[exponent];
+    if (negative) {
+        value = -value;
+    }
+    return ptr;
+}
+
+namespace {
+
+/// Parses the first \p num_values numbers of the line [ptr, end).
+bool ParseRecord(const char *ptr,
+                 const char *end,
+                 int num_values,
+                 double *record) {
+    for (int k = 0; k < num_values; ++k) {
+        while (ptr < end && IsSpace(*ptr)) {
+            ++ptr;
+        }
+        if (ptr == end || (ptr = ParseDouble(ptr, end, record[k])) == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ParseChunk(const char *begin,
+                const char *end,
+                int num_values,
+                bool keep_invalid_lines,
+                std::vector<double> &values) {
+    while (begin < end) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(begin, '\n', end - begin));
+        if (line_end == nullptr) {
+            line_end = end;
+        }
+        const size_t size = values.size();
+        values.resize(size + num_values);
+        if (!ParseRecord(begin, line_end, num_values, values.data() + size)) {
+            if (keep_invalid_lines) {
+                std::fill(values.begin() + size, values.end(), 0.0);
+            } else {
+                values.resize(size);
+            }
+        }
+        begin = line_end == end ? end : line_end + 1;
+    }
+}
+
+/// Returns the start of the first line beginning at or after \p pos.
+int64_t NextLineStart(const char *data, int64_t size, int64_t pos) {
+    if (pos >= size || pos == 0 || data[pos - 1] == '\n') {
+        return std::min(pos, size);
+    }
+    const char *newline = static_cast<const char *>(
+            std::memchr(data + pos, '\n', size - pos));
+    return newline == nullptr ? size : newline - data + 1;
+}
+
+}  // unnamed namespace
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+#else
+        munmap(const_cast<char *>(data_), static_cast<size_t>(size_));
+#endif
+    }
+}
+
+bool MappedFile::Open(const std::string &filename) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return false;
+    }
+    size_ = static_cast<int64_t>(file_size.QuadPart);
+    if (size_ == 0) {
+        CloseHandle(file);
+        return true;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+                                        nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        return false;
+    }
+    // The view keeps the mapping object alive.
+    data_ = static_cast<const char *>(
+            MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    return data_ != nullptr;
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<int64_t>(file_stat.st_size);
+    if (size_ == 0) {
+        close(fd);
+        return true;
+    }
+    void *base = mmap(nullptr, static_cast<size_t>(size_), PROT_READ,
+                      MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    madvise(base, static_cast<size_t>(size_), MADV_SEQUENTIAL);
+    data_ = static_cast<const char *>(base);
+    return true;
+#endif
+}
+
+bool ReadASCIIRecords(const std::string &filename,
+                      int64_t data_offset,
+                      int num_values,
+                      bool keep_invalid_lines,
+                      std::vector<double> &values,
+                      utility::CountingProgressReporter &reporter) {
+    MappedFile file;
+    if (!file.Open(filename)) {
+        return false;
+    }
+    reporter.SetTotal(file.size_);
+
+    values.clear();
+    const int num_chunks = std::max(1, utility::GetMaxParallelism() * 4);
+    std::vector<int64_t> bounds(num_chunks + 1);
+    std::vector<std::vector<double>> chunk_values(num_chunks);
+    std::vector<size_t> offsets(num_chunks + 1);
+    int64_t pos = std::min(data_offset, file.size_);
+    while (pos < file.size_) {
+        const int64_t batch_end = NextLineStart(
+                file.data_, file.size_, std::min(file.size_, pos + kBatchSize));
+        bounds[0] = pos;
+        for (int k = 1; k < num_chunks; ++k) {
+            bounds[k] = NextLineStart(
+                    file.data_, file.size_,
+                    std::max(bounds[k - 1],
+                             pos + (batch_end - pos) * k / num_chunks));
+        }
+        bounds[num_chunks] = batch_end;
+
+        utility::ParallelFor(0, num_chunks, [&](int64_t k) {
+            chunk_values[k].clear();
+            ParseChunk(file.data_ + bounds[k], file.data_ + bounds[k + 1],
+                       num_values, keep_invalid_lines, chunk_values[k]);
+        });
+
+        offsets[0] = values.size();
+        for (int k = 0; k < num_chunks; ++k) {
+            offsets[k + 1] = offsets[k] + chunk_values[k].size();
+        }
+        values.resize(offsets[num_chunks]);
+        utility::ParallelFor(0, num_chunks, [&](int64_t k) {
+            std::copy(chunk_values[k].begin(), chunk_values[k].end(),
+                      values.begin() + offsets[k]);
+        });
+
+        pos = batch_end;
+        reporter.Update(pos);
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+/// Read-only memory mapping of a whole file.
+class MappedFile {
+public:
+    MappedFile() {}
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// Maps \p filename. Empty files are opened with a null data_.
+    bool Open(const std::string &filename);
+
+    const char *data_ = nullptr;
+    int64_t size_ = 0;
+};
+
+/// Parses the number starting at \p ptr. Returns the position past the number
+/// or nullptr if there is no number. Decimal numbers with at most 19
+/// significant digits whose value is exactly m * 10^e, with m < 2^53 and
+/// |e| <= 22, are computed with a single correctly rounded floating point
+/// operation; all other inputs go through strtod.
+const char *ParseDouble(const char *ptr, const char *end, double &value);
+
+/// Parses the numeric records of an ASCII file, one record per line, starting
+/// at byte \p data_offset. A line holds a record if it starts with
+/// \p num_values numbers separated by white space; trailing fields are
+/// ignored, as with sscanf. The file is memory-mapped and processed in
+/// batches. Each batch is split at line boundaries into one chunk per worker,
+/// the chunks are parsed in parallel and the records are concatenated into
+/// \p values using a prefix sum over the per-chunk record counts. \p reporter
+/// is updated with the number of bytes parsed after every batch.
+///
+/// If \p keep_invalid_lines is true, lines without a record produce a record
+/// of zeros, so that record i corresponds to line i.
+///
+/// Returns false if the file cannot be mapped.
+bool ReadASCIIRecords(const std::string &filename,
+                      int64_t data_offset,
+                      int num_values,
+                      bool keep_invalid_lines,
+                      std::vector<double> &values,
+                      utility::CountingProgressReporter &reporter);
+
+}  // namespace io
+}  // namespace open3d
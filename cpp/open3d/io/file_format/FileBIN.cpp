@@ -25,11 +25,16 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 #include <memory>
 
 #include "open3d/io/FeatureIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/io/PoseGraphIO.h"
+#include "open3d/io/file_format/FileASCIIRecords.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
@@ -72,6 +77,73 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+// Pose graphs and trajectories are stored as an 8 byte magic string, the
+// element counts as uint64 and one section per member, e.g. the poses of all
+// the nodes, followed by the transformations of all the edges. Sections of
+// doubles come first, so that every section is aligned in the mapped file.
+const char *const kPoseGraphMagic = "O3DPOSEG";
+const char *const kTrajectoryMagic = "O3DTRAJC";
+const int64_t kMagicSize = 8;
+
+/// Sequential reader of the sections of a memory-mapped file.
+class MappedSectionReader {
+public:
+    explicit MappedSectionReader(const MappedFile &file)
+        : ptr_(file.data_), end_(file.data_ + file.size_) {}
+
+    /// Returns the next \p count values of type T, or nullptr if the file is
+    /// too short.
+    template <typename T>
+    const char *Next(uint64_t count) {
+        if (count > uint64_t(end_ - ptr_) / sizeof(T)) {
+            return nullptr;
+        }
+        const char *section = ptr_;
+        ptr_ += count * sizeof(T);
+        return section;
+    }
+
+    uint64_t GetRemainingSize() const { return uint64_t(end_ - ptr_); }
+
+private:
+    const char *ptr_;
+    const char *end_;
+};
+
+bool ReadBINHeader(MappedSectionReader &reader,
+                   const char *magic,
+                   uint64_t *counts,
+                   int num_counts) {
+    const char *header = reader.Next<char>(kMagicSize);
+    if (header == nullptr || memcmp(header, magic, kMagicSize) != 0) {
+        utility::LogWarning("Read BIN failed: missing {} header.", magic);
+        return false;
+    }
+    const char *counts_data = reader.Next<uint64_t>(num_counts);
+    if (counts_data == nullptr) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    memcpy(counts, counts_data, num_counts * sizeof(uint64_t));
+    for (int i = 0; i < num_counts; ++i) {
+        // Every element takes at least one byte.
+        if (counts[i] > reader.GetRemainingSize()) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool WriteBINValues(FILE *file, const T *values, size_t count) {
+    if (fwrite(values, sizeof(T), count, file) < count) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +174,185 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph) {
+    MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    MappedSectionReader reader(file);
+    uint64_t counts[2];
+    if (!ReadBINHeader(reader, kPoseGraphMagic, counts, 2)) {
+        return false;
+    }
+    const int64_t num_nodes = int64_t(counts[0]);
+    const int64_t num_edges = int64_t(counts[1]);
+    const char *poses = reader.Next<double>(16 * counts[0]);
+    const char *transformations = reader.Next<double>(16 * counts[1]);
+    const char *informations = reader.Next<double>(36 * counts[1]);
+    const char *confidences = reader.Next<double>(counts[1]);
+    const char *source_ids = reader.Next<int32_t>(counts[1]);
+    const char *target_ids = reader.Next<int32_t>(counts[1]);
+    const char *uncertains = reader.Next<uint8_t>(counts[1]);
+    if (poses == nullptr || transformations == nullptr ||
+        informations == nullptr || confidences == nullptr ||
+        source_ids == nullptr || target_ids == nullptr ||
+        uncertains == nullptr) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+
+    pose_graph.nodes_.resize(num_nodes);
+    pose_graph.edges_.resize(num_edges);
+    utility::ParallelFor(
+            0, num_nodes,
+            [&](int64_t i) {
+                memcpy(pose_graph.nodes_[i].pose_.data(),
+                       poses + i * 16 * sizeof(double), 16 * sizeof(double));
+            },
+            1024);
+    utility::ParallelFor(
+            0, num_edges,
+            [&](int64_t i) {
+                pipelines::registration::PoseGraphEdge &edge =
+                        pose_graph.edges_[i];
+                memcpy(edge.transformation_.data(),
+                       transformations + i * 16 * sizeof(double),
+                       16 * sizeof(double));
+                memcpy(edge.information_.data(),
+                       informations + i * 36 * sizeof(double),
+                       36 * sizeof(double));
+                memcpy(&edge.confidence_, confidences + i * sizeof(double),
+                       sizeof(double));
+                int32_t source_id, target_id;
+                memcpy(&source_id, source_ids + i * sizeof(int32_t),
+                       sizeof(int32_t));
+                memcpy(&target_id, target_ids + i * sizeof(int32_t),
+                       sizeof(int32_t));
+                edge.source_node_id_ = source_id;
+                edge.target_node_id_ = target_id;
+                edge.uncertain_ = uncertains[i] != 0;
+            },
+            1024);
+    return true;
+}
+
+bool WritePoseGraphToBIN(
+        const std::string &filename,
+        const pipelines::registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const auto &nodes = pose_graph.nodes_;
+    const auto &edges = pose_graph.edges_;
+    const uint64_t counts[2] = {nodes.size(), edges.size()};
+    bool success = WriteBINValues(fid, kPoseGraphMagic, kMagicSize) &&
+                   WriteBINValues(fid, counts, 2);
+    for (size_t i = 0; success && i < nodes.size(); ++i) {
+        success = WriteBINValues(fid, nodes[i].pose_.data(), 16);
+    }
+    for (size_t i = 0; success && i < edges.size(); ++i) {
+        success = WriteBINValues(fid, edges[i].transformation_.data(), 16);
+    }
+    for (size_t i = 0; success && i < edges.size(); ++i) {
+        success = WriteBINValues(fid, edges[i].information_.data(), 36);
+    }
+    for (size_t i = 0; success && i < edges.size(); ++i) {
+        success = WriteBINValues(fid, &edges[i].confidence_, 1);
+    }
+    for (size_t i = 0; success && i < edges.size(); ++i) {
+        const int32_t source_id = edges[i].source_node_id_;
+        success = WriteBINValues(fid, &source_id, 1);
+    }
+    for (size_t i = 0; success && i < edges.size(); ++i) {
+        const int32_t target_id = edges[i].target_node_id_;
+        success = WriteBINValues(fid, &target_id, 1);
+    }
+    for (size_t i = 0; success && i < edges.size(); ++i) {
+        const uint8_t uncertain = edges[i].uncertain_ ? 1 : 0;
+        success = WriteBINValues(fid, &uncertain, 1);
+    }
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    MappedSectionReader reader(file);
+    uint64_t count;
+    if (!ReadBINHeader(reader, kTrajectoryMagic, &count, 1)) {
+        return false;
+    }
+    const char *extrinsics = reader.Next<double>(16 * count);
+    const char *intrinsics = reader.Next<double>(9 * count);
+    const char *widths = reader.Next<int32_t>(count);
+    const char *heights = reader.Next<int32_t>(count);
+    if (extrinsics == nullptr || intrinsics == nullptr || widths == nullptr ||
+        heights == nullptr) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+
+    trajectory.parameters_.resize(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        camera::PinholeCameraParameters &parameters =
+                trajectory.parameters_[i];
+        memcpy(parameters.extrinsic_.data(),
+               extrinsics + i * 16 * sizeof(double), 16 * sizeof(double));
+        memcpy(parameters.intrinsic_.intrinsic_matrix_.data(),
+               intrinsics + i * 9 * sizeof(double), 9 * sizeof(double));
+        int32_t width, height;
+        memcpy(&width, widths + i * sizeof(int32_t), sizeof(int32_t));
+        memcpy(&height, heights + i * sizeof(int32_t), sizeof(int32_t));
+        parameters.intrinsic_.width_ = width;
+        parameters.intrinsic_.height_ = height;
+    }
+    return true;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const auto &parameters = trajectory.parameters_;
+    const uint64_t count = parameters.size();
+    bool success = WriteBINValues(fid, kTrajectoryMagic, kMagicSize) &&
+                   WriteBINValues(fid, &count, 1);
+    for (size_t i = 0; success && i < parameters.size(); ++i) {
+        success = WriteBINValues(fid, parameters[i].extrinsic_.data(), 16);
+    }
+    for (size_t i = 0; success && i < parameters.size(); ++i) {
+        success = WriteBINValues(
+                fid, parameters[i].intrinsic_.intrinsic_matrix_.data(), 9);
+    }
+    for (size_t i = 0; success && i < parameters.size(); ++i) {
+        const int32_t width = parameters[i].intrinsic_.width_;
+        success = WriteBINValues(fid, &width, 1);
+    }
+    for (size_t i = 0; success && i < parameters.size(); ++i) {
+        const int32_t height = parameters[i].intrinsic_.height_;
+        success = WriteBINValues(fid, &height, 1);
+    }
+    fclose(fid);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -27,6 +27,7 @@
 // clang-format off
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 #include <jpeglib.h>  // Include after cstddef to define size_t
 // clang-format on
 
@@ -95,9 +96,11 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
-bool WriteImageToJPG(const std::string &filename,
-                     const geometry::Image &image,
-                     int quality /* = kOpen3DImageIODefaultQuality*/) {
+namespace {
+
+/// Checks that \p image can be written as JPEG and replaces the default
+/// \p quality.
+bool CheckJPGImage(const geometry::Image &image, int &quality) {
     if (!image.HasData()) {
         utility::LogWarning("Write JPG failed: image has no data.");
         return false;
@@ -115,21 +118,14 @@ bool WriteImageToJPG(const std::string &filename,
                 "[0,100].");
         return false;
     }
+    return true;
+}
 
-    struct jpeg_compress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    FILE *file_out;
+/// Compresses \p image to the destination of \p cinfo.
+void CompressJPG(jpeg_compress_struct &cinfo,
+                 const geometry::Image &image,
+                 int quality) {
     JSAMPROW row_pointer[1];
-
-    if ((file_out = utility::filesystem::FOpen(filename, "wb")) == NULL) {
-        utility::LogWarning("Write JPG failed: unable to open file: {}",
-                            filename);
-        return false;
-    }
-
-    cinfo.err = jpeg_std_error(&jerr);
-    jpeg_create_compress(&cinfo);
-    jpeg_stdio_dest(&cinfo, file_out);
     cinfo.image_width = image.width_;
     cinfo.image_height = image.height_;
     cinfo.input_components = image.num_of_channels_;
@@ -148,10 +144,57 @@ bool WriteImageToJPG(const std::string &filename,
         pdata += row_stride;
     }
     jpeg_finish_compress(&cinfo);
+}
+
+}  // namespace
+
+bool WriteImageToJPG(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality /* = kOpen3DImageIODefaultQuality*/) {
+    if (!CheckJPGImage(image, quality)) {
+        return false;
+    }
+
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    FILE *file_out;
+
+    if ((file_out = utility::filesystem::FOpen(filename, "wb")) == NULL) {
+        utility::LogWarning("Write JPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_stdio_dest(&cinfo, file_out);
+    CompressJPG(cinfo, image, quality);
     fclose(file_out);
     jpeg_destroy_compress(&cinfo);
     return true;
 }
 
+bool WriteImageToJPGInMemory(const geometry::Image &image,
+                             std::vector<uint8_t> &buffer,
+                             int quality /* = kOpen3DImageIODefaultQuality*/) {
+    if (!CheckJPGImage(image, quality)) {
+        return false;
+    }
+
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    unsigned char *out = nullptr;
+    unsigned long out_size = 0;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &out, &out_size);
+    CompressJPG(cinfo, image, quality);
+    jpeg_destroy_compress(&cinfo);
+    buffer.assign(out, out + out_size);
+    free(out);
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
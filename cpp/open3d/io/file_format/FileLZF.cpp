@@ -0,0 +1,262 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "open3d/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+
+// The LZF image format stores the raw image data compressed with LZF in
+// independent chunks, which are compressed and decompressed in parallel.
+// 8 and 16 bit samples are stored as the difference to the previous sample of
+// the same channel in the row, which turns the smooth gradients of depth
+// images into runs LZF can compress.
+//
+// Layout: header, num_chunks x (raw size, stored size), chunk data. A chunk
+// with stored size equal to its raw size is not compressed.
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+constexpr char kLZFImageMagic[4] = {'O', '3', 'D', 'Z'};
+constexpr uint32_t kLZFImageVersion = 1;
+constexpr uint32_t kLZFImageFlagDelta = 1;
+constexpr int64_t kLZFImageChunkSize = int64_t(1) << 18;
+
+struct LZFImageHeader {
+    char magic[4];
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    int32_t num_of_channels;
+    int32_t bytes_per_channel;
+    uint32_t flags;
+    uint32_t num_chunks;
+};
+
+template <typename T>
+void EncodeDelta(geometry::Image &image) {
+    const int64_t n = int64_t(image.width_) * image.num_of_channels_;
+    utility::ParallelFor(0, image.height_, [&](int64_t y) {
+        T *row = reinterpret_cast<T *>(image.data_.data() +
+                                      y * image.BytesPerLine());
+        for (int64_t i = n - 1; i >= image.num_of_channels_; --i) {
+            row[i] = T(row[i] - row[i - image.num_of_channels_]);
+        }
+    });
+}
+
+template <typename T>
+void DecodeDelta(geometry::Image &image) {
+    const int64_t n = int64_t(image.width_) * image.num_of_channels_;
+    utility::ParallelFor(0, image.height_, [&](int64_t y) {
+        T *row = reinterpret_cast<T *>(image.data_.data() +
+                                      y * image.BytesPerLine());
+        for (int64_t i = image.num_of_channels_; i < n; ++i) {
+            row[i] = T(row[i] + row[i - image.num_of_channels_]);
+        }
+    });
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadImageFromLZF(const std::string &filename, geometry::Image &image) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (!file) {
+        utility::LogWarning("Read LZF failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    LZFImageHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, kLZFImageMagic, sizeof(kLZFImageMagic)) != 0 ||
+        header.version != kLZFImageVersion || header.width <= 0 ||
+        header.height <= 0 || header.num_of_channels <= 0 ||
+        header.bytes_per_channel <= 0) {
+        utility::LogWarning("Read LZF failed: invalid header in file: {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    std::vector<uint32_t> sizes(2 * size_t(header.num_chunks));
+    if (fread(sizes.data(), sizeof(uint32_t), sizes.size(), file) !=
+        sizes.size()) {
+        utility::LogWarning("Read LZF failed: unable to read file: {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    image.Prepare(header.width, header.height, header.num_of_channels,
+                  header.bytes_per_channel);
+    std::vector<int64_t> offsets(header.num_chunks + 1, 0);
+    std::vector<int64_t> stored_offsets(header.num_chunks + 1, 0);
+    for (uint32_t c = 0; c < header.num_chunks; ++c) {
+        offsets[c + 1] = offsets[c] + sizes[2 * c];
+        stored_offsets[c + 1] = stored_offsets[c] + sizes[2 * c + 1];
+    }
+    if (offsets.back() != int64_t(image.data_.size())) {
+        utility::LogWarning("Read LZF failed: invalid chunks in file: {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    std::vector<uint8_t> stored(stored_offsets.back());
+    const bool read_ok =
+            fread(stored.data(), 1, stored.size(), file) == stored.size();
+    fclose(file);
+    if (!read_ok) {
+        utility::LogWarning("Read LZF failed: unable to read file: {}",
+                            filename);
+        return false;
+    }
+
+    std::vector<uint8_t> chunk_ok(header.num_chunks, 0);
+    utility::ParallelFor(0, int64_t(header.num_chunks), [&](int64_t c) {
+        const unsigned int raw_size = sizes[2 * c];
+        const unsigned int stored_size = sizes[2 * c + 1];
+        const uint8_t *src = stored.data() + stored_offsets[c];
+        uint8_t *dst = image.data_.data() + offsets[c];
+        if (stored_size == raw_size) {
+            memcpy(dst, src, raw_size);
+            chunk_ok[c] = 1;
+        } else {
+            chunk_ok[c] = lzf_decompress(src, stored_size, dst, raw_size) ==
+                          raw_size;
+        }
+    });
+    for (uint8_t ok : chunk_ok) {
+        if (!ok) {
+            utility::LogWarning(
+                    "Read LZF failed: unable to decompress file: {}",
+                    filename);
+            return false;
+        }
+    }
+    if (header.flags & kLZFImageFlagDelta) {
+        if (image.bytes_per_channel_ == 1) {
+            DecodeDelta<uint8_t>(image);
+        } else if (image.bytes_per_channel_ == 2) {
+            DecodeDelta<uint16_t>(image);
+        }
+    }
+    return true;
+}
+
+bool WriteImageToLZF(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality) {
+    if (!image.HasData()) {
+        utility::LogWarning("Write LZF failed: image has no data.");
+        return false;
+    }
+
+    LZFImageHeader header;
+    memcpy(header.magic, kLZFImageMagic, sizeof(kLZFImageMagic));
+    header.version = kLZFImageVersion;
+    header.width = image.width_;
+    header.height = image.height_;
+    header.num_of_channels = image.num_of_channels_;
+    header.bytes_per_channel = image.bytes_per_channel_;
+    header.flags = 0;
+
+    // Quality 0 stores the data without compression.
+    const bool compress = quality != 0;
+    geometry::Image encoded;
+    const geometry::Image *data = &image;
+    if (compress && image.bytes_per_channel_ <= 2) {
+        encoded = image;
+        if (image.bytes_per_channel_ == 1) {
+            EncodeDelta<uint8_t>(encoded);
+        } else {
+            EncodeDelta<uint16_t>(encoded);
+        }
+        header.flags |= kLZFImageFlagDelta;
+        data = &encoded;
+    }
+
+    const int64_t size = int64_t(data->data_.size());
+    const int64_t num_chunks =
+            (size + kLZFImageChunkSize - 1) / kLZFImageChunkSize;
+    header.num_chunks = uint32_t(num_chunks);
+    std::vector<std::vector<uint8_t>> chunks(num_chunks);
+    std::vector<uint32_t> sizes(2 * num_chunks);
+    utility::ParallelFor(0, num_chunks, [&](int64_t c) {
+        const int64_t begin = c * kLZFImageChunkSize;
+        const unsigned int length = static_cast<unsigned int>(
+                std::min(kLZFImageChunkSize, size - begin));
+        sizes[2 * c] = length;
+        std::vector<uint8_t> &chunk = chunks[c];
+        unsigned int stored_size = 0;
+        if (compress) {
+            // Only keep the compressed data if it is smaller.
+            chunk.resize(length - 1);
+            stored_size = lzf_compress(data->data_.data() + begin, length,
+                                       chunk.data(), length - 1);
+        }
+        if (stored_size == 0) {
+            chunk.assign(data->data_.begin() + begin,
+                         data->data_.begin() + begin + length);
+            stored_size = length;
+        }
+        chunk.resize(stored_size);
+        sizes[2 * c + 1] = stored_size;
+    });
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (!file) {
+        utility::LogWarning("Write LZF failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(sizes.data(), sizeof(uint32_t), sizes.size(),
+                          file) == sizes.size();
+    for (const auto &chunk : chunks) {
+        success = success &&
+                  fwrite(chunk.data(), 1, chunk.size(), file) == chunk.size();
+    }
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        utility::LogWarning("Write LZF failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include <tiny_obj_loader.h>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <numeric>
 #include <vector>
@@ -33,8 +35,11 @@
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/TriangleMeshIO.h"
+#include "open3d/io/file_format/FileASCIIRecords.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
 namespace io {
@@ -222,6 +227,400 @@ bool ReadTriangleMeshFromOBJ(const std::string& filename,
     return true;
 }
 
+namespace {
+
+enum class OBJLineType { Other, Vertex, Normal, TexCoord, Face, Material };
+
+/// Element counts of a range of lines.
+struct OBJCounts {
+    int64_t vertices = 0;
+    int64_t colored_vertices = 0;
+    int64_t normals = 0;
+    int64_t texcoords = 0;
+    int64_t triangles = 0;
+    bool has_materials = false;
+};
+
+/// Vertex, texture coordinate and normal index of a face corner. Missing
+/// indices are -1.
+struct OBJCorner {
+    int64_t vertex = -1;
+    int64_t texcoord = -1;
+    int64_t normal = -1;
+};
+
+inline bool IsOBJSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline const char* SkipOBJSpaces(const char* ptr, const char* end) {
+    while (ptr < end && IsOBJSpace(*ptr)) {
+        ++ptr;
+    }
+    return ptr;
+}
+
+/// Returns the type of the line starting at \p ptr and moves \p ptr past the
+/// keyword.
+OBJLineType ParseOBJKeyword(const char*& ptr, const char* end) {
+    ptr = SkipOBJSpaces(ptr, end);
+    const char* begin = ptr;
+    while (ptr < end && !IsOBJSpace(*ptr)) {
+        ++ptr;
+    }
+    const size_t length = ptr - begin;
+    auto is = [begin, length](const char* keyword) {
+        return length == std::strlen(keyword) &&
+               std::memcmp(begin, keyword, length) == 0;
+    };
+    if (is("v")) return OBJLineType::Vertex;
+    if (is("vn")) return OBJLineType::Normal;
+    if (is("vt")) return OBJLineType::TexCoord;
+    if (is("f")) return OBJLineType::Face;
+    if (is("mtllib") || is("usemtl")) return OBJLineType::Material;
+    return OBJLineType::Other;
+}
+
+/// Parses up to \p max_values numbers and returns how many were parsed.
+int ParseOBJValues(const char* ptr,
+                   const char* end,
+                   int max_values,
+                   double* values) {
+    int num_values = 0;
+    while (num_values < max_values) {
+        ptr = SkipOBJSpaces(ptr, end);
+        if (ptr == end ||
+            (ptr = ParseDouble(ptr, end, values[num_values])) == nullptr) {
+            break;
+        }
+        ++num_values;
+    }
+    return num_values;
+}
+
+const char* ParseOBJIndex(const char* ptr, const char* end, int64_t& index) {
+    bool negative = false;
+    if (ptr < end && (*ptr == '-' || *ptr == '+')) {
+        negative = *ptr == '-';
+        ++ptr;
+    }
+    if (ptr == end || *ptr < '0' || *ptr > '9') {
+        return nullptr;
+    }
+    index = 0;
+    for (; ptr < end && *ptr >= '0' && *ptr <= '9'; ++ptr) {
+        index = index * 10 + (*ptr - '0');
+    }
+    if (negative) {
+        index = -index;
+    }
+    return ptr;
+}
+
+/// Converts a 1-based or negative (relative to the \p count elements defined
+/// so far) OBJ index to a 0-based index. Invalid indices become -2.
+inline int64_t ResolveOBJIndex(int64_t index, int64_t count) {
+    if (index > 0) return index - 1;
+    if (index < 0 && count + index >= 0) return count + index;
+    return -2;
+}
+
+/// Parses the face corner "v", "v/vt", "v//vn" or "v/vt/vn" at \p ptr.
+const char* ParseOBJCorner(const char* ptr,
+                           const char* end,
+                           const OBJCounts& defined,
+                           OBJCorner& corner) {
+    int64_t index;
+    if ((ptr = ParseOBJIndex(ptr, end, index)) == nullptr) {
+        return nullptr;
+    }
+    corner = OBJCorner();
+    corner.vertex = ResolveOBJIndex(index, defined.vertices);
+    if (ptr < end && *ptr == '/') {
+        ++ptr;
+        if (ptr < end && *ptr != '/') {
+            if ((ptr = ParseOBJIndex(ptr, end, index)) == nullptr) {
+                return nullptr;
+            }
+            corner.texcoord = ResolveOBJIndex(index, defined.texcoords);
+        }
+        if (ptr < end && *ptr == '/') {
+            if ((ptr = ParseOBJIndex(ptr + 1, end, index)) == nullptr) {
+                return nullptr;
+            }
+            corner.normal = ResolveOBJIndex(index, defined.normals);
+        }
+    }
+    return ptr;
+}
+
+inline const char* FindLineEnd(const char* ptr, const char* end) {
+    const char* line_end =
+            static_cast<const char*>(std::memchr(ptr, '\n', end - ptr));
+    return line_end == nullptr ? end : line_end;
+}
+
+/// Counts the elements of the lines [begin, end).
+void CountOBJChunk(const char* begin, const char* end, OBJCounts& counts) {
+    while (begin < end) {
+        const char* line_end = FindLineEnd(begin, end);
+        const char* ptr = begin;
+        switch (ParseOBJKeyword(ptr, line_end)) {
+            case OBJLineType::Vertex: {
+                double values[6];
+                ++counts.vertices;
+                if (ParseOBJValues(ptr, line_end, 6, values) == 6) {
+                    ++counts.colored_vertices;
+                }
+                break;
+            }
+            case OBJLineType::Normal:
+                ++counts.normals;
+                break;
+            case OBJLineType::TexCoord:
+                ++counts.texcoords;
+                break;
+            case OBJLineType::Face: {
+                int64_t num_corners = 0;
+                while ((ptr = SkipOBJSpaces(ptr, line_end)) < line_end) {
+                    ++num_corners;
+                    while (ptr < line_end && !IsOBJSpace(*ptr)) {
+                        ++ptr;
+                    }
+                }
+                counts.triangles += std::max(num_corners - 2, int64_t(0));
+                break;
+            }
+            case OBJLineType::Material:
+                counts.has_materials = true;
+                break;
+            case OBJLineType::Other:
+                break;
+        }
+        begin = line_end == end ? end : line_end + 1;
+    }
+}
+
+/// Output arrays of the OBJ parser. \p corners holds three corners per
+/// triangle.
+struct OBJArrays {
+    std::vector<Eigen::Vector3d>* vertices;
+    std::vector<Eigen::Vector3d>* colors;
+    std::vector<Eigen::Vector3d> normals;
+    std::vector<Eigen::Vector2d> texcoords;
+    std::vector<OBJCorner> corners;
+};
+
+/// Parses the lines [begin, end). \p defined holds the number of elements
+/// defined before \p begin, i.e. the output offsets of the chunk.
+bool ParseOBJChunk(const char* begin,
+                   const char* end,
+                   OBJCounts defined,
+                   OBJArrays& arrays) {
+    while (begin < end) {
+        const char* line_end = FindLineEnd(begin, end);
+        const char* ptr = begin;
+        double values[6];
+        switch (ParseOBJKeyword(ptr, line_end)) {
+            case OBJLineType::Vertex: {
+                const int num_values = ParseOBJValues(ptr, line_end, 6, values);
+                if (num_values < 3) {
+                    return false;
+                }
+                (*arrays.vertices)[defined.vertices] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                if (!arrays.colors->empty()) {
+                    (*arrays.colors)[defined.vertices] =
+                            Eigen::Vector3d(values[3], values[4], values[5]);
+                }
+                ++defined.vertices;
+                break;
+            }
+            case OBJLineType::Normal:
+                if (ParseOBJValues(ptr, line_end, 3, values) < 3) {
+                    return false;
+                }
+                arrays.normals[defined.normals++] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                break;
+            case OBJLineType::TexCoord: {
+                const int num_values = ParseOBJValues(ptr, line_end, 2, values);
+                if (num_values < 1) {
+                    return false;
+                }
+                arrays.texcoords[defined.texcoords++] = Eigen::Vector2d(
+                        values[0], num_values > 1 ? values[1] : 0.0);
+                break;
+            }
+            case OBJLineType::Face: {
+                // Polygons are triangulated as fans around their first corner.
+                OBJCorner first, previous, corner;
+                int64_t num_corners = 0;
+                while ((ptr = SkipOBJSpaces(ptr, line_end)) < line_end) {
+                    ptr = ParseOBJCorner(ptr, line_end, defined, corner);
+                    if (ptr == nullptr) {
+                        return false;
+                    }
+                    if (num_corners >= 2) {
+                        OBJCorner* triangle =
+                                &arrays.corners[3 * defined.triangles++];
+                        triangle[0] = first;
+                        triangle[1] = previous;
+                        triangle[2] = corner;
+                    }
+                    if (num_corners == 0) {
+                        first = corner;
+                    }
+                    previous = corner;
+                    ++num_corners;
+                }
+                break;
+            }
+            case OBJLineType::Material:
+            case OBJLineType::Other:
+                break;
+        }
+        begin = line_end == end ? end : line_end + 1;
+    }
+    return true;
+}
+
+/// Returns the start of the first line beginning at or after \p pos.
+int64_t NextOBJLineStart(const char* data, int64_t size, int64_t pos) {
+    if (pos >= size || pos == 0 || data[pos - 1] == '\n') {
+        return std::min(pos, size);
+    }
+    const char* newline = static_cast<const char*>(
+            std::memchr(data + pos, '\n', size - pos));
+    return newline == nullptr ? size : newline - data + 1;
+}
+
+}  // unnamed namespace
+
+bool ReadTriangleMeshFromOBJGeometry(const std::string& filename,
+                                     geometry::TriangleMesh& mesh,
+                                     const ReadTriangleMeshOptions& params) {
+    if (params.enable_post_processing) {
+        return ReadTriangleMeshUsingASSIMP(filename, mesh, params);
+    }
+    MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(2 * file.size_);
+
+    // First pass: count the elements of every chunk of lines.
+    const int num_chunks = std::max(1, utility::GetMaxParallelism() * 4);
+    std::vector<int64_t> bounds(num_chunks + 1, 0);
+    for (int k = 1; k <= num_chunks; ++k) {
+        bounds[k] = NextOBJLineStart(
+                file.data_, file.size_,
+                std::max(bounds[k - 1], file.size_ * k / num_chunks));
+    }
+    std::vector<OBJCounts> counts(num_chunks);
+    utility::ParallelFor(0, num_chunks, [&](int64_t k) {
+        CountOBJChunk(file.data_ + bounds[k], file.data_ + bounds[k + 1],
+                      counts[k]);
+    });
+    reporter.Update(file.size_);
+
+    // Materials need the full ASSIMP importer.
+    std::vector<OBJCounts> offsets(num_chunks + 1);
+    for (int k = 0; k < num_chunks; ++k) {
+        if (counts[k].has_materials) {
+            return ReadTriangleMeshUsingASSIMP(filename, mesh, params);
+        }
+        offsets[k + 1].vertices = offsets[k].vertices + counts[k].vertices;
+        offsets[k + 1].colored_vertices =
+                offsets[k].colored_vertices + counts[k].colored_vertices;
+        offsets[k + 1].normals = offsets[k].normals + counts[k].normals;
+        offsets[k + 1].texcoords = offsets[k].texcoords + counts[k].texcoords;
+        offsets[k + 1].triangles = offsets[k].triangles + counts[k].triangles;
+    }
+    const OBJCounts& total = offsets[num_chunks];
+
+    // Second pass: parse every chunk into its slice of the outputs.
+    mesh.Clear();
+    mesh.vertices_.resize(total.vertices);
+    if (total.vertices > 0 && total.colored_vertices == total.vertices) {
+        mesh.vertex_colors_.resize(total.vertices);
+    }
+    OBJArrays arrays;
+    arrays.vertices = &mesh.vertices_;
+    arrays.colors = &mesh.vertex_colors_;
+    arrays.normals.resize(total.normals);
+    arrays.texcoords.resize(total.texcoords);
+    arrays.corners.resize(3 * total.triangles);
+    std::vector<char> parsed(num_chunks, 0);
+    utility::ParallelFor(0, num_chunks, [&](int64_t k) {
+        parsed[k] = ParseOBJChunk(file.data_ + bounds[k],
+                                  file.data_ + bounds[k + 1], offsets[k],
+                                  arrays);
+    });
+    if (std::find(parsed.begin(), parsed.end(), 0) != parsed.end()) {
+        utility::LogWarning("Read OBJ failed: malformed line in {}.",
+                            filename);
+        return false;
+    }
+
+    // Check the indices and fill the triangles and their uvs.
+    const int64_t num_corners = int64_t(arrays.corners.size());
+    bool all_texcoords = total.texcoords > 0;
+    bool valid = true;
+    for (const OBJCorner& corner : arrays.corners) {
+        valid = valid && corner.vertex >= 0 &&
+                corner.vertex < total.vertices &&
+                corner.texcoord < total.texcoords &&
+                corner.texcoord >= -1 && corner.normal < total.normals &&
+                corner.normal >= -1;
+        all_texcoords = all_texcoords && corner.texcoord >= 0;
+    }
+    if (!valid) {
+        utility::LogWarning("Read OBJ failed: invalid face index in {}.",
+                            filename);
+        mesh.Clear();
+        return false;
+    }
+    mesh.triangles_.resize(total.triangles);
+    utility::ParallelFor(int64_t(0), total.triangles, [&](int64_t t) {
+        const OBJCorner* corners = &arrays.corners[3 * t];
+        mesh.triangles_[t] = Eigen::Vector3i(int(corners[0].vertex),
+                                             int(corners[1].vertex),
+                                             int(corners[2].vertex));
+    });
+    if (all_texcoords) {
+        mesh.triangle_uvs_.resize(num_corners);
+        utility::ParallelFor(int64_t(0), num_corners, [&](int64_t c) {
+            mesh.triangle_uvs_[c] =
+                    arrays.texcoords[arrays.corners[c].texcoord];
+        });
+    }
+
+    // Every vertex takes the normal of its first corner. Normals are dropped
+    // unless all vertices have one, as in ReadTriangleMeshFromOBJ.
+    if (total.normals > 0) {
+        mesh.vertex_normals_.resize(total.vertices);
+        std::vector<bool> has_normal(total.vertices, false);
+        int64_t num_assigned = 0;
+        for (const OBJCorner& corner : arrays.corners) {
+            if (corner.normal >= 0 && !has_normal[corner.vertex]) {
+                mesh.vertex_normals_[corner.vertex] =
+                        arrays.normals[corner.normal];
+                has_normal[corner.vertex] = true;
+                ++num_assigned;
+            }
+        }
+        if (num_assigned != total.vertices) {
+            mesh.vertex_normals_.clear();
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
 bool WriteTriangleMeshToOBJ(const std::string& filename,
                             const geometry::TriangleMesh& mesh,
                             bool write_ascii /* = false*/,
@@ -26,15 +26,19 @@
 
 #include <liblzf/lzf.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <limits>
 #include <sstream>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/FilePCD.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 // References for PCD file IO
@@ -47,39 +51,11 @@ namespace open3d {
 namespace {
 using namespace io;
 
-enum PCDDataType {
-    PCD_DATA_ASCII = 0,
-    PCD_DATA_BINARY = 1,
-    PCD_DATA_BINARY_COMPRESSED = 2
-};
-
-struct PCLPointField {
-public:
-    std::string name;
-    int size;
-    char type;
-    int count;
-    // helper variable
-    int count_offset;
-    int offset;
-};
-
-struct PCDHeader {
-public:
-    std::string version;
-    std::vector<PCLPointField> fields;
-    int width;
-    int height;
-    int points;
-    PCDDataType datatype;
-    std::string viewpoint;
-    // helper variables
-    int elementnum;
-    int pointsize;
-    bool has_points;
-    bool has_normals;
-    bool has_colors;
-};
+/// Points decoded or encoded per parallel work item.
+constexpr int64_t kPCDGrainSize = 4096;
+
+/// Bytes compressed per parallel work item of binary_compressed data.
+constexpr int64_t kLZFChunkSize = int64_t(1) << 20;
 
 bool CheckHeader(PCDHeader &header) {
     if (header.points <= 0 || header.pointsize <= 0) {
@@ -131,111 +107,6 @@ bool CheckHeader(PCDHeader &header) {
     return true;
 }
 
-bool ReadPCDHeader(FILE *file, PCDHeader &header) {
-    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-    size_t specified_channel_count = 0;
-
-    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        std::string line(line_buffer);
-        if (line == "") {
-            continue;
-        }
-        std::vector<std::string> st = utility::SplitString(line, "\t\r\n ");
-        std::stringstream sstream(line);
-        sstream.imbue(std::locale::classic());
-        std::string line_type;
-        sstream >> line_type;
-        if (line_type.substr(0, 1) == "#") {
-        } else if (line_type.substr(0, 7) == "VERSION") {
-            if (st.size() >= 2) {
-                header.version = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "FIELDS" ||
-                   line_type.substr(0, 7) == "COLUMNS") {
-            specified_channel_count = st.size() - 1;
-            if (specified_channel_count == 0) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            header.fields.resize(specified_channel_count);
-            int count_offset = 0, offset = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, count_offset += 1, offset += 4) {
-                header.fields[i].name = st[i + 1];
-                header.fields[i].size = 4;
-                header.fields[i].type = 'F';
-                header.fields[i].count = 1;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "SIZE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int offset = 0, col_type = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 i++, offset += col_type) {
-                sstream >> col_type;
-                header.fields[i].size = col_type;
-                header.fields[i].offset = offset;
-            }
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "TYPE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            for (size_t i = 0; i < specified_channel_count; i++) {
-                header.fields[i].type = st[i + 1].c_str()[0];
-            }
-        } else if (line_type.substr(0, 5) == "COUNT") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int count_offset = 0, offset = 0, col_count = 0;
-            for (size_t i = 0; i < specified_channel_count; i++) {
-                sstream >> col_count;
-                header.fields[i].count = col_count;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-                count_offset += col_count;
-                offset += col_count * header.fields[i].size;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 5) == "WIDTH") {
-            sstream >> header.width;
-        } else if (line_type.substr(0, 6) == "HEIGHT") {
-            sstream >> header.height;
-            header.points = header.width * header.height;
-        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
-            if (st.size() >= 2) {
-                header.viewpoint = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "POINTS") {
-            sstream >> header.points;
-        } else if (line_type.substr(0, 4) == "DATA") {
-            header.datatype = PCD_DATA_ASCII;
-            if (st.size() >= 2) {
-                if (st[1].substr(0, 17) == "binary_compressed") {
-                    header.datatype = PCD_DATA_BINARY_COMPRESSED;
-                } else if (st[1].substr(0, 6) == "binary") {
-                    header.datatype = PCD_DATA_BINARY;
-                }
-            }
-            break;
-        }
-    }
-    if (!CheckHeader(header)) {
-        return false;
-    }
-    return true;
-}
-
 double UnpackBinaryPCDElement(const char *data_ptr,
                               const char type,
                               const int size) {
@@ -276,6 +147,10 @@ double UnpackBinaryPCDElement(const char *data_ptr,
             float data;
             memcpy(&data, data_ptr, sizeof(data));
             return (double)data;
+        } else if (size == 8) {
+            double data;
+            memcpy(&data, data_ptr, sizeof(data));
+            return data;
         } else {
             return 0.0;
         }
@@ -332,6 +207,90 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+template <typename T>
+void StorePCDElement(char *data_ptr, T value) {
+    memcpy(data_ptr, &value, sizeof(T));
+}
+
+template <typename T>
+T LoadPCDElement(const char *data_ptr) {
+    T value;
+    memcpy(&value, data_ptr, sizeof(T));
+    return value;
+}
+
+/// Stores the ascii value \p data_ptr in the binary representation of
+/// \p field at \p element_ptr.
+void PackASCIIPCDElement(const char *data_ptr,
+                         const PCLPointField &field,
+                         char *element_ptr) {
+    char *end;
+    if (field.type == 'I') {
+        const long long value = std::strtoll(data_ptr, &end, 0);
+        if (field.size == 1) {
+            StorePCDElement(element_ptr, static_cast<std::int8_t>(value));
+        } else if (field.size == 2) {
+            StorePCDElement(element_ptr, static_cast<std::int16_t>(value));
+        } else if (field.size == 4) {
+            StorePCDElement(element_ptr, static_cast<std::int32_t>(value));
+        } else if (field.size == 8) {
+            StorePCDElement(element_ptr, static_cast<std::int64_t>(value));
+        }
+    } else if (field.type == 'U') {
+        const unsigned long long value = std::strtoull(data_ptr, &end, 0);
+        if (field.size == 1) {
+            StorePCDElement(element_ptr, static_cast<std::uint8_t>(value));
+        } else if (field.size == 2) {
+            StorePCDElement(element_ptr, static_cast<std::uint16_t>(value));
+        } else if (field.size == 4) {
+            StorePCDElement(element_ptr, static_cast<std::uint32_t>(value));
+        } else if (field.size == 8) {
+            StorePCDElement(element_ptr, static_cast<std::uint64_t>(value));
+        }
+    } else if (field.type == 'F') {
+        if (field.size == 4) {
+            StorePCDElement(element_ptr, std::strtof(data_ptr, &end));
+        } else if (field.size == 8) {
+            StorePCDElement(element_ptr, std::strtod(data_ptr, &end));
+        }
+    }
+}
+
+/// Writes the element of \p field at \p element_ptr as ascii.
+void WriteASCIIPCDElement(FILE *file,
+                          const char *element_ptr,
+                          const PCLPointField &field) {
+    if (field.type == 'I') {
+        long long value = 0;
+        if (field.size == 1) {
+            value = LoadPCDElement<std::int8_t>(element_ptr);
+        } else if (field.size == 2) {
+            value = LoadPCDElement<std::int16_t>(element_ptr);
+        } else if (field.size == 4) {
+            value = LoadPCDElement<std::int32_t>(element_ptr);
+        } else if (field.size == 8) {
+            value = LoadPCDElement<std::int64_t>(element_ptr);
+        }
+        fprintf(file, "%lld", value);
+    } else if (field.type == 'U') {
+        unsigned long long value = 0;
+        if (field.size == 1) {
+            value = LoadPCDElement<std::uint8_t>(element_ptr);
+        } else if (field.size == 2) {
+            value = LoadPCDElement<std::uint16_t>(element_ptr);
+        } else if (field.size == 4) {
+            value = LoadPCDElement<std::uint32_t>(element_ptr);
+        } else if (field.size == 8) {
+            value = LoadPCDElement<std::uint64_t>(element_ptr);
+        }
+        fprintf(file, "%llu", value);
+    } else if (field.type == 'F' && field.size == 8) {
+        fprintf(file, "%.17g", LoadPCDElement<double>(element_ptr));
+    } else {
+        fprintf(file, "%.10g", LoadPCDElement<float>(element_ptr));
+    }
+}
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud,
@@ -401,137 +360,42 @@ bool ReadPCDData(FILE *file,
                 reporter.Update(idx);
             }
         }
-    } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; i++) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
-                utility::LogWarning(
-                        "[ReadPCDData] Failed to read data record.");
-                pointcloud.Clear();
-                return false;
-            }
-            for (const auto &field : header.fields) {
-                if (field.name == "x") {
-                    pointcloud.points_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[i] =
-                            UnpackBinaryPCDColor(buffer.get() + field.offset,
-                                                 field.type, field.size);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
-        }
-    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double reporter_total = 100.0;
-        reporter.SetTotal(int(reporter_total));
-        reporter.Update(int(reporter_total * 0.01));
-        std::uint32_t compressed_size;
-        std::uint32_t uncompressed_size;
-        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        if (fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
-            1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        utility::LogDebug(
-                "PCD data with {:d} compressed size, and {:d} uncompressed "
-                "size.",
-                compressed_size, uncompressed_size);
-        std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
-        reporter.Update(int(reporter_total * .1));
-        if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
-            compressed_size) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
-        reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
-            utility::LogWarning("[ReadPCDData] Uncompression failed.");
+    } else {
+        PCDBuffer buffer;
+        if (!ReadPCDBuffer(file, header, buffer)) {
             pointcloud.Clear();
             return false;
         }
+        reporter.Update(header.points / 2);
         for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
+            std::vector<Eigen::Vector3d> *target = nullptr;
+            int k = 0;
+            if (field.name == "x" || field.name == "y" || field.name == "z") {
+                target = &pointcloud.points_;
+                k = field.name[0] - 'x';
+            } else if (field.name == "normal_x" || field.name == "normal_y" ||
+                       field.name == "normal_z") {
+                target = &pointcloud.normals_;
+                k = field.name[7] - 'x';
+            } else if (field.name != "rgb" && field.name != "rgba") {
+                continue;
             }
+            int64_t stride;
+            const char *base_ptr = buffer.GetField(header, field, stride);
+            utility::ParallelForRange(
+                    0, header.points, kPCDGrainSize,
+                    [&](int64_t begin, int64_t end) {
+                        for (int64_t i = begin; i < end; i++) {
+                            const char *data_ptr = base_ptr + i * stride;
+                            if (target != nullptr) {
+                                (*target)[i](k) = UnpackBinaryPCDElement(
+                                        data_ptr, field.type, field.size);
+                            } else {
+                                pointcloud.colors_[i] = UnpackBinaryPCDColor(
+                                        data_ptr, field.type, field.size);
+                            }
+                        }
+                    });
         }
     }
     reporter.Finish();
@@ -590,7 +454,197 @@ bool GenerateHeader(const geometry::PointCloud &pointcloud,
     return true;
 }
 
-bool WritePCDHeader(FILE *file, const PCDHeader &header) {
+float ConvertRGBToFloat(const Eigen::Vector3d &color) {
+    auto rgb = utility::ColorToUint8(color);
+    std::uint8_t rgba[4] = {rgb(2), rgb(1), rgb(0), 0};
+    float value;
+    memcpy(&value, rgba, 4);
+    return value;
+}
+
+bool WritePCDData(FILE *file,
+                  const PCDHeader &header,
+                  const geometry::PointCloud &pointcloud,
+                  const WritePointCloudOption &params) {
+    bool has_normal = pointcloud.HasNormals();
+    bool has_color = pointcloud.HasColors();
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(pointcloud.points_.size());
+    if (header.datatype == PCD_DATA_ASCII) {
+        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+            const auto &point = pointcloud.points_[i];
+            fprintf(file, "%.10g %.10g %.10g", point(0), point(1), point(2));
+            if (has_normal) {
+                const auto &normal = pointcloud.normals_[i];
+                fprintf(file, " %.10g %.10g %.10g", normal(0), normal(1),
+                        normal(2));
+            }
+            if (has_color) {
+                const auto &color = pointcloud.colors_[i];
+                fprintf(file, " %.10g", ConvertRGBToFloat(color));
+            }
+            fprintf(file, "\n");
+            if (i % 1000 == 0) {
+                reporter.Update(i);
+            }
+        }
+    } else {
+        // All fields are float. binary data is interleaved point by point,
+        // binary_compressed data is stored field by field.
+        PCDBuffer buffer;
+        buffer.Resize(header);
+        std::vector<char *> field_ptrs;
+        std::vector<int64_t> strides(header.fields.size());
+        for (size_t f = 0; f < header.fields.size(); f++) {
+            field_ptrs.push_back(
+                    buffer.GetField(header, header.fields[f], strides[f]));
+        }
+        utility::ParallelForRange(
+                0, header.points, kPCDGrainSize,
+                [&](int64_t begin, int64_t end) {
+                    float data[7];
+                    for (int64_t i = begin; i < end; i++) {
+                        const auto &point = pointcloud.points_[i];
+                        data[0] = (float)point(0);
+                        data[1] = (float)point(1);
+                        data[2] = (float)point(2);
+                        int idx = 3;
+                        if (has_normal) {
+                            const auto &normal = pointcloud.normals_[i];
+                            data[idx + 0] = (float)normal(0);
+                            data[idx + 1] = (float)normal(1);
+                            data[idx + 2] = (float)normal(2);
+                            idx += 3;
+                        }
+                        if (has_color) {
+                            const auto &color = pointcloud.colors_[i];
+                            data[idx] = ConvertRGBToFloat(color);
+                        }
+                        for (int f = 0; f < header.elementnum; f++) {
+                            memcpy(field_ptrs[f] + i * strides[f], &data[f],
+                                   sizeof(float));
+                        }
+                    }
+                });
+        reporter.Update(header.points / 2);
+        if (!WritePCDBuffer(file, header, buffer)) {
+            return false;
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPCDHeader(FILE *file, PCDHeader &header) {
+    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    size_t specified_channel_count = 0;
+
+    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::string line(line_buffer);
+        if (line == "") {
+            continue;
+        }
+        std::vector<std::string> st = utility::SplitString(line, "\t\r\n ");
+        std::stringstream sstream(line);
+        sstream.imbue(std::locale::classic());
+        std::string line_type;
+        sstream >> line_type;
+        if (line_type.substr(0, 1) == "#") {
+        } else if (line_type.substr(0, 7) == "VERSION") {
+            if (st.size() >= 2) {
+                header.version = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "FIELDS" ||
+                   line_type.substr(0, 7) == "COLUMNS") {
+            specified_channel_count = st.size() - 1;
+            if (specified_channel_count == 0) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            header.fields.resize(specified_channel_count);
+            int count_offset = 0, offset = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, count_offset += 1, offset += 4) {
+                header.fields[i].name = st[i + 1];
+                header.fields[i].size = 4;
+                header.fields[i].type = 'F';
+                header.fields[i].count = 1;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "SIZE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int offset = 0, col_type = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, offset += col_type) {
+                sstream >> col_type;
+                header.fields[i].size = col_type;
+                header.fields[i].offset = offset;
+            }
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "TYPE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                header.fields[i].type = st[i + 1].c_str()[0];
+            }
+        } else if (line_type.substr(0, 5) == "COUNT") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int count_offset = 0, offset = 0, col_count = 0;
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                sstream >> col_count;
+                header.fields[i].count = col_count;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+                count_offset += col_count;
+                offset += col_count * header.fields[i].size;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 5) == "WIDTH") {
+            sstream >> header.width;
+        } else if (line_type.substr(0, 6) == "HEIGHT") {
+            sstream >> header.height;
+            header.points = header.width * header.height;
+        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
+            if (st.size() >= 2) {
+                header.viewpoint = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "POINTS") {
+            sstream >> header.points;
+        } else if (line_type.substr(0, 4) == "DATA") {
+            header.datatype = PCD_DATA_ASCII;
+            if (st.size() >= 2) {
+                if (st[1].substr(0, 17) == "binary_compressed") {
+                    header.datatype = PCD_DATA_BINARY_COMPRESSED;
+                } else if (st[1].substr(0, 6) == "binary") {
+                    header.datatype = PCD_DATA_BINARY;
+                }
+            }
+            break;
+        }
+    }
+    if (!CheckHeader(header)) {
+        return false;
+    }
+    return true;
+}
+
+bool WritePCDHeader(FILE *file, const PCDHeader &header, int count_width) {
     fprintf(file, "# .PCD v%s - Point Cloud Data file format\n",
             header.version.c_str());
     fprintf(file, "VERSION %s\n", header.version.c_str());
@@ -614,10 +668,10 @@ bool WritePCDHeader(FILE *file, const PCDHeader &header) {
         fprintf(file, " %d", field.count);
     }
     fprintf(file, "\n");
-    fprintf(file, "WIDTH %d\n", header.width);
+    fprintf(file, "WIDTH %0*d\n", count_width, header.width);
     fprintf(file, "HEIGHT %d\n", header.height);
     fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
-    fprintf(file, "POINTS %d\n", header.points);
+    fprintf(file, "POINTS %0*d\n", count_width, header.points);
 
     switch (header.datatype) {
         case PCD_DATA_BINARY:
@@ -634,119 +688,180 @@ bool WritePCDHeader(FILE *file, const PCDHeader &header) {
     return true;
 }
 
-float ConvertRGBToFloat(const Eigen::Vector3d &color) {
-    auto rgb = utility::ColorToUint8(color);
-    std::uint8_t rgba[4] = {rgb(2), rgb(1), rgb(0), 0};
-    float value;
-    memcpy(&value, rgba, 4);
-    return value;
+void PCDBuffer::Resize(const PCDHeader &header) {
+    data_.assign(static_cast<size_t>(header.points) * header.pointsize, 0);
+    is_columnar_ = header.datatype == PCD_DATA_BINARY_COMPRESSED;
 }
 
-bool WritePCDData(FILE *file,
-                  const PCDHeader &header,
-                  const geometry::PointCloud &pointcloud,
-                  const WritePointCloudOption &params) {
-    bool has_normal = pointcloud.HasNormals();
-    bool has_color = pointcloud.HasColors();
-    utility::CountingProgressReporter reporter(params.update_progress);
-    reporter.SetTotal(pointcloud.points_.size());
+char *PCDBuffer::GetField(const PCDHeader &header,
+                          const PCLPointField &field,
+                          int64_t &stride) {
+    if (is_columnar_) {
+        stride = int64_t(field.size) * field.count;
+        return data_.data() + int64_t(field.offset) * header.points;
+    }
+    stride = header.pointsize;
+    return data_.data() + field.offset;
+}
+
+const char *PCDBuffer::GetField(const PCDHeader &header,
+                                const PCLPointField &field,
+                                int64_t &stride) const {
+    return const_cast<PCDBuffer *>(this)->GetField(header, field, stride);
+}
+
+bool ReadPCDBuffer(FILE *file, const PCDHeader &header, PCDBuffer &buffer) {
+    buffer.Resize(header);
     if (header.datatype == PCD_DATA_ASCII) {
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            fprintf(file, "%.10g %.10g %.10g", point(0), point(1), point(2));
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                fprintf(file, " %.10g %.10g %.10g", normal(0), normal(1),
-                        normal(2));
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                fprintf(file, " %.10g", ConvertRGBToFloat(color));
+        char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+        int idx = 0;
+        while (idx < header.points &&
+               fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+            std::vector<std::string> strs =
+                    utility::SplitString(line_buffer, "\t\r\n ");
+            if ((int)strs.size() < header.elementnum) {
+                continue;
             }
-            fprintf(file, "\n");
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+            for (const auto &field : header.fields) {
+                int64_t stride;
+                char *field_ptr = buffer.GetField(header, field, stride) +
+                                  idx * stride;
+                for (int k = 0; k < field.count; k++) {
+                    PackASCIIPCDElement(strs[field.count_offset + k].c_str(),
+                                        field, field_ptr + k * field.size);
+                }
             }
+            idx++;
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<float[]> data(new float[header.elementnum]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            data[0] = (float)point(0);
-            data[1] = (float)point(1);
-            data[2] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                data[idx + 0] = (float)normal(0);
-                data[idx + 1] = (float)normal(1);
-                data[idx + 2] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                data[idx] = ConvertRGBToFloat(color);
-            }
-            fwrite(data.get(), sizeof(float), header.elementnum, file);
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        if (fread(buffer.data_.data(), 1, buffer.data_.size(), file) !=
+            buffer.data_.size()) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double report_total = double(pointcloud.points_.size() * 2);
-        // 0%-50% packing into buffer
-        // 50%-75% compressing buffer
-        // 75%-100% writing compressed buffer
-        reporter.SetTotal(int(report_total));
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
+        std::uint32_t compressed_size;
+        std::uint32_t uncompressed_size;
+        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1 ||
+            fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
+                    1) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        utility::LogDebug(
+                "PCD data with {:d} compressed size, and {:d} uncompressed "
+                "size.",
+                compressed_size, uncompressed_size);
+        if (uncompressed_size != buffer.data_.size()) {
+            utility::LogWarning(
+                    "[ReadPCDData] Uncompressed size {:d} does not match the "
+                    "header ({:d} bytes).",
+                    uncompressed_size, buffer.data_.size());
+            return false;
+        }
+        std::vector<char> buffer_compressed(compressed_size);
+        if (fread(buffer_compressed.data(), 1, compressed_size, file) !=
+            compressed_size) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        if (lzf_decompress(buffer_compressed.data(),
+                           (unsigned int)compressed_size, buffer.data_.data(),
+                           (unsigned int)uncompressed_size) !=
+            uncompressed_size) {
+            utility::LogWarning("[ReadPCDData] Uncompression failed.");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WritePCDBuffer(FILE *file,
+                    const PCDHeader &header,
+                    const PCDBuffer &buffer) {
+    if (header.datatype == PCD_DATA_ASCII) {
+        std::vector<const char *> field_ptrs;
+        std::vector<int64_t> strides(header.fields.size());
+        for (size_t f = 0; f < header.fields.size(); f++) {
+            field_ptrs.push_back(
+                    buffer.GetField(header, header.fields[f], strides[f]));
+        }
+        for (int i = 0; i < header.points; i++) {
+            for (size_t f = 0; f < header.fields.size(); f++) {
+                const auto &field = header.fields[f];
+                const char *field_ptr = field_ptrs[f] + i * strides[f];
+                for (int k = 0; k < field.count; k++) {
+                    if (f > 0 || k > 0) {
+                        fprintf(file, " ");
+                    }
+                    WriteASCIIPCDElement(file, field_ptr + k * field.size,
+                                         field);
+                }
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+            fprintf(file, "\n");
+        }
+    } else if (header.datatype == PCD_DATA_BINARY) {
+        if (fwrite(buffer.data_.data(), 1, buffer.data_.size(), file) !=
+            buffer.data_.size()) {
+            utility::LogWarning("[WritePCDData] Failed to write data.");
+            return false;
+        }
+    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
+        const int64_t size = static_cast<int64_t>(buffer.data_.size());
+        if (size > std::numeric_limits<std::uint32_t>::max()) {
+            utility::LogWarning(
+                    "[WritePCDData] {:d} bytes exceed the size limit of "
+                    "binary_compressed data.",
+                    size);
+            return false;
+        }
+        const int64_t num_chunks =
+                (size + kLZFChunkSize - 1) / kLZFChunkSize;
+        std::vector<std::vector<char>> chunks(num_chunks);
+        utility::ParallelFor(0, num_chunks, [&](int64_t c) {
+            const int64_t begin = c * kLZFChunkSize;
+            const unsigned int length = static_cast<unsigned int>(
+                    std::min(kLZFChunkSize, size - begin));
+            std::vector<char> &chunk = chunks[c];
+            chunk.resize(length + length / 16 + 64);
+            chunk.resize(lzf_compress(buffer.data_.data() + begin, length,
+                                      chunk.data(),
+                                      static_cast<unsigned int>(chunk.size())));
+        });
+        int64_t size_compressed = 0;
+        for (const auto &chunk : chunks) {
+            if (chunk.empty()) {
+                utility::LogWarning("[WritePCDData] Failed to compress data.");
+                return false;
             }
+            size_compressed += static_cast<int64_t>(chunk.size());
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
+        if (size_compressed > std::numeric_limits<std::uint32_t>::max()) {
+            utility::LogWarning(
+                    "[WritePCDData] {:d} compressed bytes exceed the size "
+                    "limit of binary_compressed data.",
+                    size_compressed);
             return false;
         }
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        reporter.Update(int(report_total * 0.75));
-        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+                size, size_compressed);
+        const std::uint32_t compressed_size =
+                static_cast<std::uint32_t>(size_compressed);
+        const std::uint32_t uncompressed_size =
+                static_cast<std::uint32_t>(size);
+        fwrite(&compressed_size, sizeof(compressed_size), 1, file);
+        fwrite(&uncompressed_size, sizeof(uncompressed_size), 1, file);
+        for (const auto &chunk : chunks) {
+            if (fwrite(chunk.data(), 1, chunk.size(), file) != chunk.size()) {
+                utility::LogWarning("[WritePCDData] Failed to write data.");
+                return false;
+            }
+        }
     }
-    reporter.Finish();
     return true;
 }
 
-}  // unnamed namespace
-
-namespace io {
 FileGeometry ReadFileGeometryTypePCD(const std::string &path) {
     return CONTAINS_POINTS;
 }
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+enum PCDDataType {
+    PCD_DATA_ASCII = 0,
+    PCD_DATA_BINARY = 1,
+    PCD_DATA_BINARY_COMPRESSED = 2
+};
+
+struct PCLPointField {
+public:
+    std::string name;
+    int size;
+    char type;
+    int count;
+    // helper variable
+    int count_offset;
+    int offset;
+};
+
+struct PCDHeader {
+public:
+    std::string version;
+    std::vector<PCLPointField> fields;
+    int width;
+    int height;
+    int points;
+    PCDDataType datatype;
+    std::string viewpoint;
+    // helper variables
+    int elementnum;
+    int pointsize;
+    bool has_points;
+    bool has_normals;
+    bool has_colors;
+};
+
+/// \class PCDBuffer
+///
+/// Raw data section of a PCD file. Fields are interleaved point by point for
+/// ascii and binary data, and stored field by field for binary_compressed
+/// data, as in the compressed payload of the file.
+class PCDBuffer {
+public:
+    /// Allocates a zero-initialized buffer for \p header.
+    void Resize(const PCDHeader &header);
+
+    /// Returns the address of \p field of the first point and sets \p stride
+    /// to the number of bytes between the fields of consecutive points.
+    char *GetField(const PCDHeader &header,
+                   const PCLPointField &field,
+                   int64_t &stride);
+    const char *GetField(const PCDHeader &header,
+                         const PCLPointField &field,
+                         int64_t &stride) const;
+
+public:
+    std::vector<char> data_;
+    bool is_columnar_ = false;
+};
+
+/// Reads the header of a PCD file, leaving \p file at the start of the data.
+bool ReadPCDHeader(FILE *file, PCDHeader &header);
+
+/// Writes the header of a PCD file. WIDTH and POINTS are zero-padded to
+/// \p count_width digits, so that streaming writers can rewrite them in place.
+bool WritePCDHeader(FILE *file, const PCDHeader &header, int count_width = 0);
+
+/// Reads the data section of a PCD file. ascii values are converted to the
+/// binary representation of their fields. binary_compressed data is
+/// decompressed with a single LZF call, as the format has no chunk index.
+bool ReadPCDBuffer(FILE *file, const PCDHeader &header, PCDBuffer &buffer);
+
+/// Writes the data section of a PCD file. For binary_compressed data, the
+/// buffer is compressed in independent chunks in parallel. The LZF streams of
+/// the chunks are concatenated, which decodes to the concatenated chunks, so
+/// the file remains a single LZF block readable by PCL.
+bool WritePCDBuffer(FILE *file,
+                    const PCDHeader &header,
+                    const PCDBuffer &buffer);
+
+}  // namespace io
+}  // namespace open3d
@@ -31,6 +31,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/io/VoxelGridIO.h"
+#include "open3d/io/file_format/FilePLYBinary.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/ProgressReporters.h"
 
@@ -393,11 +394,68 @@ FileGeometry ReadFileGeometryTypePLY(const std::string &path) {
     return FileGeometry(contents);
 }
 
+// Reads binary little-endian point clouds in bulk. Returns false if the file
+// has to be read by rply.
+static bool ReadPointCloudFromBinaryPLY(const std::string &filename,
+                                        geometry::PointCloud &pointcloud,
+                                        const ReadPointCloudOption &params) {
+    PLYBinaryElement vertex;
+    if (!vertex.Read(filename, "vertex")) {
+        return false;
+    }
+    auto get_properties = [&vertex](const char *a, const char *b,
+                                    const char *c) {
+        return std::vector<const PLYBinaryElement::Property *>{
+                vertex.GetProperty(a), vertex.GetProperty(b),
+                vertex.GetProperty(c)};
+    };
+    auto is_complete =
+            [](const std::vector<const PLYBinaryElement::Property *> &ps) {
+                return ps[0] && ps[1] && ps[2];
+            };
+    auto is_absent =
+            [](const std::vector<const PLYBinaryElement::Property *> &ps) {
+                return !ps[0] && !ps[1] && !ps[2];
+            };
+    auto points = get_properties("x", "y", "z");
+    auto normals = get_properties("nx", "ny", "nz");
+    auto colors = get_properties("red", "green", "blue");
+    if (!is_complete(points) || !(is_complete(normals) || is_absent(normals)) ||
+        !(is_complete(colors) || is_absent(colors))) {
+        return false;
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(vertex.count_);
+
+    pointcloud.Clear();
+    pointcloud.points_.resize(vertex.count_);
+    pointcloud.normals_.resize(is_complete(normals) ? vertex.count_ : 0);
+    pointcloud.colors_.resize(is_complete(colors) ? vertex.count_ : 0);
+    for (int k = 0; k < 3; k++) {
+        vertex.Decode(*points[k], pointcloud.points_.data()->data() + k, 3);
+        if (pointcloud.HasNormals()) {
+            vertex.Decode(*normals[k], pointcloud.normals_.data()->data() + k,
+                          3);
+        }
+        if (pointcloud.HasColors()) {
+            vertex.Decode(*colors[k], pointcloud.colors_.data()->data() + k, 3,
+                          255.0);
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     using namespace ply_pointcloud_reader;
 
+    if (ReadPointCloudFromBinaryPLY(filename, pointcloud, params)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
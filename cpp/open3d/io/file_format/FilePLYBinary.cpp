@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/file_format/FilePLYBinary.h"
+
+#include <cstdio>
+#include <sstream>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+struct PLYHeaderElement {
+    std::string name_;
+    int64_t count_ = 0;
+    int64_t stride_ = 0;
+    bool has_list_ = false;
+    std::vector<PLYBinaryElement::Property> properties_;
+};
+
+bool ParseScalarType(const std::string &type_name,
+                     PLYBinaryElement::ScalarType &type,
+                     int64_t &size) {
+    using ScalarType = PLYBinaryElement::ScalarType;
+    if (type_name == "char" || type_name == "int8") {
+        type = ScalarType::Int8;
+        size = 1;
+    } else if (type_name == "uchar" || type_name == "uint8") {
+        type = ScalarType::UInt8;
+        size = 1;
+    } else if (type_name == "short" || type_name == "int16") {
+        type = ScalarType::Int16;
+        size = 2;
+    } else if (type_name == "ushort" || type_name == "uint16") {
+        type = ScalarType::UInt16;
+        size = 2;
+    } else if (type_name == "int" || type_name == "int32") {
+        type = ScalarType::Int32;
+        size = 4;
+    } else if (type_name == "uint" || type_name == "uint32") {
+        type = ScalarType::UInt32;
+        size = 4;
+    } else if (type_name == "float" || type_name == "float32") {
+        type = ScalarType::Float32;
+        size = 4;
+    } else if (type_name == "double" || type_name == "float64") {
+        type = ScalarType::Float64;
+        size = 8;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool IsLittleEndianHost() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+bool ReadHeader(FILE *file, std::vector<PLYHeaderElement> &elements) {
+    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    bool is_first_line = true;
+    bool is_binary_little_endian = false;
+    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::istringstream line(line_buffer);
+        std::string keyword;
+        line >> keyword;
+        if (is_first_line) {
+            if (keyword != "ply") {
+                return false;
+            }
+            is_first_line = false;
+        } else if (keyword == "format") {
+            std::string format;
+            line >> format;
+            is_binary_little_endian = format == "binary_little_endian";
+        } else if (keyword == "element") {
+            PLYHeaderElement element;
+            line >> element.name_ >> element.count_;
+            if (line.fail() || element.count_ < 0) {
+                return false;
+            }
+            elements.push_back(element);
+        } else if (keyword == "property") {
+            if (elements.empty()) {
+                return false;
+            }
+            PLYHeaderElement &element = elements.back();
+            PLYBinaryElement::Property property;
+            line >> property.type_name_;
+            if (property.type_name_ == "list") {
+                element.has_list_ = true;
+                continue;
+            }
+            int64_t size;
+            line >> property.name_;
+            if (line.fail() || !ParseScalarType(property.type_name_,
+                                                property.type_, size)) {
+                return false;
+            }
+            property.offset_ = element.stride_;
+            element.stride_ += size;
+            element.properties_.push_back(property);
+        } else if (keyword == "end_header") {
+            return is_binary_little_endian;
+        } else if (keyword != "comment" && keyword != "obj_info") {
+            return false;
+        }
+    }
+    return false;
+}
+
+}  // unnamed namespace
+
+bool PLYBinaryElement::Read(const std::string &filename,
+                            const std::string &element_name) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    bool success = Open(file, element_name) && count_ > 0;
+    if (success && !ReadRecords(file, count_)) {
+        utility::LogDebug("Bulk PLY read of {} failed, falling back to rply.",
+                          filename);
+        success = false;
+    }
+    fclose(file);
+    return success;
+}
+
+bool PLYBinaryElement::Open(FILE *file, const std::string &element_name) {
+    data_.clear();
+    if (!IsLittleEndianHost()) {
+        return false;
+    }
+    std::vector<PLYHeaderElement> elements;
+    if (!ReadHeader(file, elements)) {
+        return false;
+    }
+
+    // Records of the preceding elements have a fixed size, so the payload of
+    // the requested element starts at a known offset.
+    int64_t skip = 0;
+    const PLYHeaderElement *target = nullptr;
+    for (const PLYHeaderElement &element : elements) {
+        if (element.has_list_) {
+            break;
+        }
+        if (element.name_ == element_name) {
+            target = &element;
+            break;
+        }
+        skip += element.count_ * element.stride_;
+    }
+    if (target == nullptr) {
+        return false;
+    }
+
+    count_ = target->count_;
+    stride_ = target->stride_;
+    properties_ = target->properties_;
+    return skip == 0 || fseek(file, skip, SEEK_CUR) == 0;
+}
+
+bool PLYBinaryElement::ReadRecords(FILE *file, int64_t num_records) {
+    data_.resize(num_records * stride_);
+    if (fread(data_.data(), 1, data_.size(), file) != data_.size()) {
+        data_.clear();
+        return false;
+    }
+    return true;
+}
+
+const PLYBinaryElement::Property *PLYBinaryElement::GetProperty(
+        const std::string &name) const {
+    for (const Property &property : properties_) {
+        if (property.name_ == name) {
+            return &property;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace io
+}  // namespace open3d
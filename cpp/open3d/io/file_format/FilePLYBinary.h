@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+/// \class PLYBinaryElement
+///
+/// Bulk reader for one element of a binary little-endian PLY file. The payload
+/// of the element is read with a single fread and each property is decoded
+/// with a strided copy in parallel chunks, bypassing the per-value callbacks of
+/// rply. Only elements made of scalar properties, preceded by elements made of
+/// scalar properties, are supported; other files are left to rply.
+class PLYBinaryElement {
+public:
+    enum class ScalarType {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float32,
+        Float64
+    };
+
+    struct Property {
+        std::string name_;
+        /// Type name as written in the header, e.g. "uchar".
+        std::string type_name_;
+        ScalarType type_;
+        /// Byte offset of the property within an element record.
+        int64_t offset_;
+    };
+
+public:
+    /// Reads the header of \p filename and the payload of \p element_name.
+    /// Returns false if the file is not binary little-endian, cannot be parsed
+    /// or has an element layout that requires rply.
+    bool Read(const std::string &filename, const std::string &element_name);
+
+    /// Reads the header of an opened file and moves \p file to the first
+    /// record of \p element_name, without reading any record. Returns false
+    /// under the same conditions as Read.
+    bool Open(FILE *file, const std::string &element_name);
+
+    /// Reads the next \p num_records records from \p file, replacing the
+    /// records held by this object.
+    bool ReadRecords(FILE *file, int64_t num_records);
+
+    /// Number of records held by this object, i.e. decoded by Decode.
+    int64_t GetNumRecords() const {
+        return stride_ > 0 ? int64_t(data_.size()) / stride_ : 0;
+    }
+
+    /// Returns the property named \p name, or nullptr if there is none.
+    const Property *GetProperty(const std::string &name) const;
+
+    /// Decodes \p property of every held record to dst[i * dst_stride],
+    /// converting the values to T and dividing them by \p divisor.
+    template <typename T>
+    void Decode(const Property &property,
+                T *dst,
+                int64_t dst_stride,
+                double divisor = 1.0) const {
+        switch (property.type_) {
+            case ScalarType::Int8:
+                DecodeAs<int8_t>(property, dst, dst_stride, divisor);
+                break;
+            case ScalarType::UInt8:
+                DecodeAs<uint8_t>(property, dst, dst_stride, divisor);
+                break;
+            case ScalarType::Int16:
+                DecodeAs<int16_t>(property, dst, dst_stride, divisor);
+                break;
+            case ScalarType::UInt16:
+                DecodeAs<uint16_t>(property, dst, dst_stride, divisor);
+                break;
+            case ScalarType::Int32:
+                DecodeAs<int32_t>(property, dst, dst_stride, divisor);
+                break;
+            case ScalarType::UInt32:
+                DecodeAs<uint32_t>(property, dst, dst_stride, divisor);
+                break;
+            case ScalarType::Float32:
+                DecodeAs<float>(property, dst, dst_stride, divisor);
+                break;
+            case ScalarType::Float64:
+                DecodeAs<double>(property, dst, dst_stride, divisor);
+                break;
+        }
+    }
+
+private:
+    template <typename S, typename T>
+    void DecodeAs(const Property &property,
+                  T *dst,
+                  int64_t dst_stride,
+                  double divisor) const {
+        const uint8_t *src = data_.data() + property.offset_;
+        const int64_t stride = stride_;
+        utility::ParallelForRange(
+                0, GetNumRecords(), 4096, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        S value;
+                        std::memcpy(&value, src + i * stride, sizeof(S));
+                        dst[i * dst_stride] =
+                                divisor == 1.0
+                                        ? static_cast<T>(value)
+                                        : static_cast<T>(value / divisor);
+                    }
+                });
+    }
+
+public:
+    /// Number of records of the element in the file.
+    int64_t count_ = 0;
+    /// Size of a record in bytes.
+    int64_t stride_ = 0;
+    std::vector<Property> properties_;
+
+private:
+    std::vector<uint8_t> data_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -28,33 +28,37 @@
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
 
 namespace open3d {
 
 namespace {
 using namespace io;
 
-void SetPNGImageFromImage(const geometry::Image &image,
-                          int quality,
-                          png_image &pngimage) {
-    pngimage.width = image.width_;
-    pngimage.height = image.height_;
-    pngimage.format = pngimage.flags = 0;
-
-    if (image.bytes_per_channel_ == 2) {
-        pngimage.format |= PNG_FORMAT_FLAG_LINEAR;
-    }
-    if (image.num_of_channels_ >= 3) {
-        pngimage.format |= PNG_FORMAT_FLAG_COLOR;
-    }
-    if (image.num_of_channels_ == 4) {
-        pngimage.format |= PNG_FORMAT_FLAG_ALPHA;
-    }
-    if (quality <= 2) {
-        pngimage.flags |= PNG_IMAGE_FLAG_FAST;
+int GetPNGColorType(int num_of_channels) {
+    switch (num_of_channels) {
+        case 1:
+            return PNG_COLOR_TYPE_GRAY;
+        case 2:
+            return PNG_COLOR_TYPE_GRAY_ALPHA;
+        case 3:
+            return PNG_COLOR_TYPE_RGB;
+        case 4:
+            return PNG_COLOR_TYPE_RGB_ALPHA;
+        default:
+            return -1;
     }
 }
 
+void PNGErrorHandler(png_structp png_ptr, png_const_charp message) {
+    utility::LogWarning("PNG error: {}", message);
+    longjmp(png_jmpbuf(png_ptr), 1);
+}
+
+void PNGWarningHandler(png_structp, png_const_charp message) {
+    utility::LogDebug("PNG warning: {}", message);
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -103,12 +107,65 @@ bool WriteImageToPNG(const std::string &filename,
                 quality);
         return false;
     }
-    png_image pngimage;
-    memset(&pngimage, 0, sizeof(pngimage));
-    pngimage.version = PNG_IMAGE_VERSION;
-    SetPNGImageFromImage(image, quality, pngimage);
-    if (png_image_write_to_file(&pngimage, filename.c_str(), 0,
-                                image.data_.data(), 0, NULL) == 0) {
+    const int color_type = GetPNGColorType(image.num_of_channels_);
+    if (color_type < 0 ||
+        (image.bytes_per_channel_ != 1 && image.bytes_per_channel_ != 2)) {
+        utility::LogWarning(
+                "Write PNG failed: unsupported image with {} channels and {} "
+                "bytes per channel.",
+                image.num_of_channels_, image.bytes_per_channel_);
+        return false;
+    }
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (!file) {
+        utility::LogWarning("Write PNG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    png_structp png_ptr = png_create_write_struct(
+            PNG_LIBPNG_VER_STRING, NULL, PNGErrorHandler, PNGWarningHandler);
+    png_infop info_ptr = png_ptr ? png_create_info_struct(png_ptr) : NULL;
+    if (!info_ptr) {
+        png_destroy_write_struct(&png_ptr, NULL);
+        fclose(file);
+        utility::LogWarning("Write PNG failed: unable to allocate memory.");
+        return false;
+    }
+    if (setjmp(png_jmpbuf(png_ptr))) {
+        png_destroy_write_struct(&png_ptr, &info_ptr);
+        fclose(file);
+        utility::LogWarning("Write PNG failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+
+    png_init_io(png_ptr, file);
+    // The quality is the zlib compression level. The fast levels also skip
+    // the filter selection, which dominates the time of low levels.
+    png_set_compression_level(png_ptr, quality);
+    if (quality <= 2) {
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+    }
+    png_set_IHDR(png_ptr, info_ptr, image.width_, image.height_,
+                 image.bytes_per_channel_ * 8, color_type, PNG_INTERLACE_NONE,
+                 PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+    png_write_info(png_ptr, info_ptr);
+    if (image.bytes_per_channel_ == 2) {
+        // PNG stores 16 bit samples in big endian order.
+        const uint16_t one = 1;
+        if (*reinterpret_cast<const uint8_t *>(&one) == 1) {
+            png_set_swap(png_ptr);
+        }
+    }
+    const size_t row_bytes = image.BytesPerLine();
+    for (int y = 0; y < image.height_; ++y) {
+        png_write_row(png_ptr, const_cast<png_bytep>(image.data_.data() +
+                                                     y * row_bytes));
+    }
+    png_write_end(png_ptr, NULL);
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    if (fclose(file) != 0) {
         utility::LogWarning("Write PNG failed: unable to write file: {}",
                             filename);
         return false;
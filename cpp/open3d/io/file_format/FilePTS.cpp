@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/FileASCIIRecords.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -60,43 +61,43 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
+        const int64_t data_offset = file.CurPos();
+        pointcloud.Clear();
+        if (!(line_buffer = file.ReadLine())) {
+            return true;
+        }
+        num_of_fields = (int)utility::SplitString(line_buffer, " ").size();
+        file.Close();
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+
+        // X Y Z I R G B if there are at least 7 fields, X Y Z otherwise. A
+        // line that cannot be parsed leaves its point at zero.
+        const int num_values = num_of_fields >= 7 ? 7 : 3;
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
+        std::vector<double> values;
+        if (!ReadASCIIRecords(filename, data_offset, num_values, true, values,
+                              reporter)) {
+            utility::LogWarning("Read PTS failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
 
-        pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st =
-                        utility::SplitString(line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z;
-            int i, r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        pointcloud.points_.resize(num_of_pts);
+        if (num_values == 7) {
+            pointcloud.colors_.resize(num_of_pts);
+        }
+        const size_t num_records =
+                std::min(num_of_pts, values.size() / num_values);
+        for (size_t idx = 0; idx < num_records; idx++) {
+            const double *record = values.data() + num_values * idx;
+            pointcloud.points_[idx] =
+                    Eigen::Vector3d(record[0], record[1], record[2]);
+            if (num_values == 7) {
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        (int)record[4], (int)record[5], (int)record[6]);
             }
         }
         reporter.Finish();
@@ -24,13 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
 #include <fstream>
 #include <vector>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/TriangleMeshIO.h"
+#include "open3d/io/file_format/FileASCIIRecords.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace io {
@@ -39,6 +42,68 @@ FileGeometry ReadFileGeometryTypeSTL(const std::string &path) {
     return FileGeometry(CONTAINS_TRIANGLES | CONTAINS_POINTS);
 }
 
+namespace {
+
+/// Binary STL: 80 byte header, uint32 triangle count, then one 50 byte record
+/// per triangle with the facet normal, the three vertices and a uint16
+/// attribute.
+constexpr int64_t kSTLHeaderSize = 84;
+constexpr int64_t kSTLRecordSize = 50;
+
+inline Eigen::Vector3d ReadSTLVector(const char *ptr) {
+    float values[3];
+    std::memcpy(values, ptr, sizeof(values));
+    return Eigen::Vector3d(values[0], values[1], values[2]);
+}
+
+}  // unnamed namespace
+
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             const ReadTriangleMeshOptions &params) {
+    if (params.enable_post_processing) {
+        return ReadTriangleMeshUsingASSIMP(filename, mesh, params);
+    }
+    MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read STL failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    // ASCII files do not match the size implied by the triangle count.
+    uint32_t num_triangles = 0;
+    if (file.size_ >= kSTLHeaderSize) {
+        std::memcpy(&num_triangles, file.data_ + 80, 4);
+    }
+    if (file.size_ < kSTLHeaderSize ||
+        file.size_ != kSTLHeaderSize + kSTLRecordSize * num_triangles) {
+        return ReadTriangleMeshUsingASSIMP(filename, mesh, params);
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_triangles);
+    mesh.Clear();
+    // Vertices are not shared between facets, as with ASSIMP without post
+    // processing. Facet normals are kept as triangle and vertex normals.
+    mesh.vertices_.resize(int64_t(num_triangles) * 3);
+    mesh.vertex_normals_.resize(int64_t(num_triangles) * 3);
+    mesh.triangles_.resize(num_triangles);
+    mesh.triangle_normals_.resize(num_triangles);
+    utility::ParallelFor(int64_t(0), int64_t(num_triangles), [&](int64_t i) {
+        const char *record = file.data_ + kSTLHeaderSize + kSTLRecordSize * i;
+        const Eigen::Vector3d normal = ReadSTLVector(record);
+        mesh.triangle_normals_[i] = normal;
+        for (int64_t k = 0; k < 3; ++k) {
+            mesh.vertices_[3 * i + k] = ReadSTLVector(record + 12 + 12 * k);
+            mesh.vertex_normals_[3 * i + k] = normal;
+        }
+        mesh.triangles_[i] = Eigen::Vector3i(int(3 * i), int(3 * i + 1),
+                                             int(3 * i + 2));
+    });
+    reporter.Finish();
+    return true;
+}
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii /* = false*/,
@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/FileASCIIRecords.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -42,35 +43,24 @@ FileGeometry ReadFileGeometryTypeXYZ(const std::string &path) {
 bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
-    try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
-            utility::LogWarning("Read XYZ failed: unable to open file: {}",
-                                filename);
-            return false;
-        }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-
-        pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
-        reporter.Finish();
-
-        return true;
-    } catch (const std::exception &e) {
-        utility::LogWarning("Read XYZ failed with exception: {}", e.what());
+    utility::CountingProgressReporter reporter(params.update_progress);
+    std::vector<double> values;
+    if (!ReadASCIIRecords(filename, 0, 3, false, values, reporter)) {
+        utility::LogWarning("Read XYZ failed: unable to open file: {}",
+                            filename);
         return false;
     }
+
+    pointcloud.Clear();
+    pointcloud.points_.resize(values.size() / 3);
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const double *record = values.data() + 3 * i;
+        pointcloud.points_[i] =
+                Eigen::Vector3d(record[0], record[1], record[2]);
+    }
+    reporter.Finish();
+
+    return true;
 }
 
 bool WritePointCloudToXYZ(const std::string &filename,
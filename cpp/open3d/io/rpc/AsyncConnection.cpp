@@ -0,0 +1,266 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/AsyncConnection.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/utility/Console.h"
+
+using namespace open3d::utility;
+
+namespace {
+
+std::shared_ptr<zmq::message_t> CreateStatusMessage(
+        const open3d::io::rpc::messages::Status& status) {
+    msgpack::sbuffer sbuf;
+    open3d::io::rpc::messages::Reply reply{status.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, status);
+    return std::make_shared<zmq::message_t>(sbuf.data(), sbuf.size());
+}
+
+std::unique_ptr<zmq::socket_t> CreateDealerSocket(zmq::context_t& context,
+                                                  const std::string& address,
+                                                  int connect_timeout,
+                                                  int timeout) {
+    std::unique_ptr<zmq::socket_t> socket(
+            new zmq::socket_t(context, ZMQ_DEALER));
+    socket->set(zmq::sockopt::linger, timeout);
+    socket->set(zmq::sockopt::connect_timeout, connect_timeout);
+    socket->set(zmq::sockopt::sndtimeo, timeout);
+    socket->connect(address.c_str());
+    return socket;
+}
+
+}  // namespace
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+AsyncConnection::AsyncConnection(const std::string& address,
+                                 int connect_timeout,
+                                 int timeout,
+                                 const AsyncConnectionOption& option)
+    : context_(GetZMQContext()),
+      address_(address),
+      connect_timeout_(connect_timeout),
+      timeout_(timeout),
+      option_(option) {
+    thread_ = std::thread(&AsyncConnection::Mainloop, this);
+}
+
+AsyncConnection::~AsyncConnection() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    queue_changed_.notify_all();
+    thread_.join();
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(
+        zmq::message_t& send_msg) {
+    return Enqueue(std::make_shared<zmq::message_t>(std::move(send_msg)));
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(const void* data,
+                                                      size_t size) {
+    return Enqueue(std::make_shared<zmq::message_t>(data, size));
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::SendMultipart(
+        const std::vector<std::pair<const void*, size_t>>& parts) {
+    size_t size = 0;
+    for (const auto& part : parts) {
+        size += part.second;
+    }
+    auto msg = std::make_shared<zmq::message_t>(size);
+    size_t offset = 0;
+    for (const auto& part : parts) {
+        memcpy((char*)msg->data() + offset, part.first, part.second);
+        offset += part.second;
+    }
+    return Enqueue(msg);
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Enqueue(
+        std::shared_ptr<zmq::message_t> msg) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto has_space = [this] {
+        return stop_ || queue_.size() < option_.max_queue_size;
+    };
+    if (!has_space() &&
+        !(option_.block_when_full &&
+          queue_changed_.wait_for(lock, std::chrono::milliseconds(timeout_),
+                                  has_space))) {
+        ++dropped_;
+        return CreateStatusMessage(messages::Status::ErrorQueueFull());
+    }
+    queue_.push_back(std::move(msg));
+    queue_changed_.notify_all();
+    return CreateStatusOKMsg();
+}
+
+bool AsyncConnection::Flush(int timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto done = [this] { return queue_.empty() && in_flight_ == 0; };
+    if (timeout < 0) {
+        queue_changed_.wait(lock, done);
+        return true;
+    }
+    return queue_changed_.wait_for(lock, std::chrono::milliseconds(timeout),
+                                   done);
+}
+
+size_t AsyncConnection::GetQueueSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+size_t AsyncConnection::GetDroppedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+}
+
+size_t AsyncConnection::GetErrorCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return errors_;
+}
+
+void AsyncConnection::Mainloop() {
+    std::unique_ptr<zmq::socket_t> socket = CreateDealerSocket(
+            *context_, address_, connect_timeout_, timeout_);
+    // Number of messages in each request in flight, oldest first.
+    std::deque<size_t> in_flight;
+    auto last_reply = std::chrono::steady_clock::now();
+
+    while (true) {
+        std::vector<std::shared_ptr<zmq::message_t>> batch;
+        bool queue_empty;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (in_flight.empty()) {
+                queue_changed_.wait(
+                        lock, [this] { return stop_ || !queue_.empty(); });
+                // Stop only after all messages are sent and replied to.
+                if (queue_.empty()) break;
+            }
+            if (in_flight.size() < option_.max_in_flight) {
+                size_t batch_bytes = 0;
+                while (!queue_.empty() &&
+                       (batch.empty() || batch_bytes + queue_.front()->size() <=
+                                                 option_.max_batch_bytes)) {
+                    batch_bytes += queue_.front()->size();
+                    batch.push_back(std::move(queue_.front()));
+                    queue_.pop_front();
+                }
+            }
+            queue_empty = queue_.empty();
+        }
+
+        if (!batch.empty()) {
+            // The empty delimiter frame makes the request look like one from
+            // a REQ socket to the REP socket of the receiver, which joins the
+            // following frames into one buffer.
+            bool sent = socket->send(zmq::message_t(), zmq::send_flags::sndmore)
+                                .has_value();
+            for (size_t i = 0; i < batch.size() && sent; ++i) {
+                const auto flags = i + 1 < batch.size()
+                                           ? zmq::send_flags::sndmore
+                                           : zmq::send_flags::none;
+                sent = socket->send(*batch[i], flags).has_value();
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (sent) {
+                if (in_flight.empty()) {
+                    last_reply = std::chrono::steady_clock::now();
+                }
+                in_flight.push_back(batch.size());
+                ++in_flight_;
+            } else {
+                LogInfo("AsyncConnection: send failed, dropping {} messages",
+                        batch.size());
+                errors_ += batch.size();
+            }
+            // Make space for blocked senders.
+            queue_changed_.notify_all();
+        }
+
+        if (in_flight.empty()) continue;
+        // Do not wait for replies if more messages can be sent right away.
+        const bool can_send =
+                !queue_empty && in_flight.size() < option_.max_in_flight;
+        zmq::pollitem_t item{socket->handle(), 0, ZMQ_POLLIN, 0};
+        zmq::poll(&item, 1, std::chrono::milliseconds(can_send ? 0 : 1));
+        if (item.revents & ZMQ_POLLIN) {
+            zmq::message_t delimiter, reply;
+            if (!socket->recv(delimiter) ||
+                (delimiter.more() && !socket->recv(reply))) {
+                continue;
+            }
+            size_t offset = 0, num_ok = 0;
+            while (offset < reply.size()) {
+                if (ReplyIsOKStatus(reply, offset)) ++num_ok;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            errors_ += in_flight.front() - std::min(num_ok, in_flight.front());
+            in_flight.pop_front();
+            --in_flight_;
+            last_reply = std::chrono::steady_clock::now();
+            queue_changed_.notify_all();
+        } else if (std::chrono::steady_clock::now() - last_reply >
+                   std::chrono::milliseconds(timeout_)) {
+            LogInfo("AsyncConnection: no reply within {} ms, {} requests "
+                    "failed",
+                    timeout_, in_flight.size());
+            // Recreate the socket such that late replies are discarded.
+            socket->set(zmq::sockopt::linger, 0);
+            socket->close();
+            socket = CreateDealerSocket(*context_, address_, connect_timeout_,
+                                        timeout_);
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t count : in_flight) {
+                errors_ += count;
+            }
+            in_flight.clear();
+            in_flight_ = 0;
+            queue_changed_.notify_all();
+        }
+    }
+    socket->close();
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
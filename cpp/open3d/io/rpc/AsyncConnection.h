@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "open3d/io/rpc/ConnectionBase.h"
+
+namespace zmq {
+class context_t;
+}  // namespace zmq
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// Options for AsyncConnection.
+struct AsyncConnectionOption {
+    /// Max number of messages waiting to be sent.
+    size_t max_queue_size = 64;
+    /// Max number of requests sent without having received the reply.
+    size_t max_in_flight = 8;
+    /// Queued messages are sent together in one request up to this size in
+    /// bytes. A single larger message is sent alone.
+    size_t max_batch_bytes = 4 * 1024 * 1024;
+    /// If true, sending to a full queue waits up to the timeout for space.
+    /// Else the message is rejected immediately.
+    bool block_when_full = true;
+};
+
+/// This class implements a Connection which does not wait for replies.
+///
+/// Messages are queued and the send functions return immediately with an OK
+/// status, or with a Status::ErrorQueueFull() status if the queue is full. A
+/// background thread sends the queued messages over a DEALER socket. It
+/// batches consecutive messages into one request and keeps several requests
+/// in flight. The receiving end can be any ReceiverBase. Errors reported in
+/// the replies are counted, see GetErrorCount().
+class AsyncConnection : public ConnectionBase {
+public:
+    /// Creates an AsyncConnection object used for sending data.
+    /// \param address          The address of the receiving end.
+    ///
+    /// \param connect_timeout  The timeout for the connect operation of the
+    /// socket.
+    ///
+    /// \param timeout          The timeout for sending data and for
+    /// receiving the reply to a request.
+    ///
+    /// \param option           Queue and batching options.
+    ///
+    AsyncConnection(const std::string& address = "tcp://127.0.0.1:51454",
+                    int connect_timeout = 5000,
+                    int timeout = 10000,
+                    const AsyncConnectionOption& option =
+                            AsyncConnectionOption());
+    AsyncConnection(const AsyncConnection&) = delete;
+    AsyncConnection& operator=(const AsyncConnection&) = delete;
+
+    /// Sends the queued messages and waits for their replies before
+    /// destruction.
+    ~AsyncConnection();
+
+    /// Queues a message. The message is moved into the queue.
+    std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) override;
+
+    /// Queues a copy of the data.
+    std::shared_ptr<zmq::message_t> Send(const void* data,
+                                         size_t size) override;
+
+    /// Queues a copy of the concatenated buffers.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            const std::vector<std::pair<const void*, size_t>>& parts) override;
+
+    /// Waits until all queued messages are sent and replied to.
+    /// \param timeout  Timeout in milliseconds. Negative values wait forever.
+    /// \return false if the timeout expired.
+    bool Flush(int timeout = -1);
+
+    /// Returns the number of messages waiting to be sent.
+    size_t GetQueueSize() const;
+
+    /// Returns the number of messages rejected because the queue was full.
+    size_t GetDroppedCount() const;
+
+    /// Returns the number of messages which failed on the receiving end or
+    /// whose reply did not arrive within the timeout.
+    size_t GetErrorCount() const;
+
+private:
+    std::shared_ptr<zmq::message_t> Enqueue(
+            std::shared_ptr<zmq::message_t> msg);
+    void Mainloop();
+
+    std::shared_ptr<zmq::context_t> context_;
+    const std::string address_;
+    const int connect_timeout_;
+    const int timeout_;
+    const AsyncConnectionOption option_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable queue_changed_;
+    std::deque<std::shared_ptr<zmq::message_t>> queue_;
+    size_t in_flight_ = 0;
+    size_t dropped_ = 0;
+    size_t errors_ = 0;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "open3d/io/rpc/Connection.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <zmq.hpp>
 
 #include "open3d/io/rpc/ZMQContext.h"
@@ -41,6 +43,21 @@ struct ConnectionDefaults {
     int timeout = 10000;
 } defaults;
 
+/// Counts the frames of a multipart message still referenced by ZMQ.
+struct PendingFrames {
+    std::mutex mutex;
+    std::condition_variable released;
+    size_t count = 0;
+};
+
+/// Called by ZMQ when it no longer needs the data of a frame.
+void ReleaseFrame(void* /*data*/, void* hint) {
+    PendingFrames* pending = static_cast<PendingFrames*>(hint);
+    std::lock_guard<std::mutex> lock(pending->mutex);
+    --pending->count;
+    pending->released.notify_all();
+}
+
 }  // namespace
 
 namespace open3d {
@@ -55,10 +72,14 @@ Connection::Connection(const std::string& address,
                        int connect_timeout,
                        int timeout)
     : context_(GetZMQContext()),
-      socket_(new zmq::socket_t(*GetZMQContext(), ZMQ_REQ)),
       address_(address),
       connect_timeout_(connect_timeout),
       timeout_(timeout) {
+    CreateSocket();
+}
+
+void Connection::CreateSocket() {
+    socket_.reset(new zmq::socket_t(*context_, ZMQ_REQ));
     socket_->set(zmq::sockopt::linger, timeout_);
     socket_->set(zmq::sockopt::connect_timeout, connect_timeout_);
     socket_->set(zmq::sockopt::rcvtimeo, timeout_);
@@ -95,6 +116,57 @@ std::shared_ptr<zmq::message_t> Connection::Send(const void* data,
     return Send(send_msg);
 }
 
+std::shared_ptr<zmq::message_t> Connection::SendMultipart(
+        const std::vector<std::pair<const void*, size_t>>& parts) {
+    PendingFrames pending;
+    bool sent = true;
+    for (size_t i = 0; i < parts.size() && sent; ++i) {
+        {
+            std::lock_guard<std::mutex> lock(pending.mutex);
+            ++pending.count;
+        }
+        // The frame references the buffer. ZMQ calls ReleaseFrame() once the
+        // frame is transmitted or discarded.
+        zmq::message_t frame(const_cast<void*>(parts[i].first),
+                             parts[i].second, &ReleaseFrame, &pending);
+        const auto flags = i + 1 < parts.size() ? zmq::send_flags::sndmore
+                                                : zmq::send_flags::none;
+        if (!socket_->send(frame, flags)) {
+            zmq::error_t err;
+            LogInfo("Connection::SendMultipart() send failed with: {}",
+                    err.what());
+            sent = false;
+        }
+    }
+
+    std::shared_ptr<zmq::message_t> msg(new zmq::message_t());
+    bool received = false;
+    if (sent) {
+        if (socket_->recv(*msg)) {
+            LogDebug("Connection::SendMultipart() received answer with {} "
+                     "bytes",
+                     msg->size());
+            received = true;
+        } else {
+            zmq::error_t err;
+            if (err.num()) {
+                LogInfo("Connection::SendMultipart() recv failed with: {}",
+                        err.what());
+            }
+        }
+    }
+    if (!received) {
+        // Discard the queued frames, such that the buffers are released.
+        socket_->set(zmq::sockopt::linger, 0);
+        socket_->close();
+        CreateSocket();
+    }
+    // The buffers belong to the caller, so wait until ZMQ is done with them.
+    std::unique_lock<std::mutex> lock(pending.mutex);
+    pending.released.wait(lock, [&pending] { return pending.count == 0; });
+    return msg;
+}
+
 std::string Connection::DefaultAddress() { return defaults.address; }
 
 }  // namespace rpc
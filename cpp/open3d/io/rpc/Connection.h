@@ -60,9 +60,18 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Function for sending a message stored in multiple buffers. The buffers
+    /// are sent as the frames of a ZMQ multipart message without copying them.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            const std::vector<std::pair<const void*, size_t>>& parts) override;
+
     static std::string DefaultAddress();
 
 private:
+    /// Creates and connects the socket. A REQ socket cannot be reused after a
+    /// request without a reply, and is recreated in this case.
+    void CreateSocket();
+
     std::shared_ptr<zmq::context_t> context_;
     std::unique_ptr<zmq::socket_t> socket_;
     const std::string address_;
@@ -27,6 +27,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace zmq {
 class message_t;
@@ -47,6 +50,19 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Function for sending a message stored in multiple buffers, e.g. the
+    /// header and the referenced array data of a packed message. The buffers
+    /// must stay valid until the function returns. The default implementation
+    /// concatenates the buffers.
+    virtual std::shared_ptr<zmq::message_t> SendMultipart(
+            const std::vector<std::pair<const void*, size_t>>& parts) {
+        std::string buffer;
+        for (const auto& part : parts) {
+            buffer.append(static_cast<const char*>(part.first), part.second);
+        }
+        return Send(buffer.data(), buffer.size());
+    }
 };
 }  // namespace rpc
 }  // namespace io
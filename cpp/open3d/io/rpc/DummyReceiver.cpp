@@ -32,6 +32,21 @@
 
 namespace open3d {
 namespace io {
-namespace rpc {}  // namespace rpc
+namespace rpc {
+
+std::shared_ptr<zmq::message_t> DummyReceiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::GetFrame& msg,
+        const MsgpackObject& obj) {
+    messages::FrameData data;
+    data.encoding = msg.encoding;
+    msgpack::sbuffer sbuf;
+    messages::Reply reply{data.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, data);
+    return std::make_shared<zmq::message_t>(sbuf.data(), sbuf.size());
+}
+
+}  // namespace rpc
 }  // namespace io
 }  // namespace open3d
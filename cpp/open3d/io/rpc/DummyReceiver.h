@@ -46,6 +46,12 @@ public:
             const MsgpackObject& obj) override {
         return CreateStatusOKMsg();
     }
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::UpdateMeshData& msg,
+            const MsgpackObject& obj) override {
+        return CreateStatusOKMsg();
+    }
     std::shared_ptr<zmq::message_t> ProcessMessage(
             const messages::Request& req,
             const messages::GetMeshData& msg,
@@ -76,6 +82,17 @@ public:
             const MsgpackObject& obj) override {
         return CreateStatusOKMsg();
     }
+    /// Replies that no frame has been drawn.
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::GetFrame& msg,
+            const MsgpackObject& obj) override;
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::InputEvent& msg,
+            const MsgpackObject& obj) override {
+        return CreateStatusOKMsg();
+    }
 };
 
 }  // namespace rpc
@@ -358,6 +358,59 @@ struct SetMeshData {
     MSGPACK_DEFINE_MAP(path, time, layer, data);
 };
 
+/// struct for defining an "update_mesh_data" message, which overwrites a range
+/// of vertices of mesh data previously sent with "set_mesh_data".
+struct UpdateMeshData {
+    static std::string MsgId() { return "update_mesh_data"; }
+
+    UpdateMeshData() : time(0), vertex_offset(0), num_vertices(-1) {}
+
+    /// Path defining the location in the scene tree.
+    std::string path;
+    /// The time associated with the data to update
+    int32_t time;
+    /// The layer for this data
+    std::string layer;
+
+    /// Index of the first vertex to overwrite.
+    int64_t vertex_offset;
+    /// The new number of vertices. Existing vertices are truncated or new
+    /// vertices are appended before the update is applied. A negative value
+    /// keeps the number of vertices.
+    int64_t num_vertices;
+    /// Arrays with the new values for the vertices [vertex_offset,
+    /// vertex_offset+n). Use the key "vertices" for updating the positions.
+    /// All arrays must have the same first dim n.
+    std::map<std::string, Array> vertex_attributes;
+
+    bool CheckMessage(std::string& errstr) const {
+        std::string tmp = "invalid update_mesh_data message:";
+        bool status = vertex_offset >= 0 && !vertex_attributes.empty();
+        if (!status) tmp += " negative vertex_offset or no attributes";
+        int64_t n = -1;
+        for (const auto& item : vertex_attributes) {
+            if (!status) break;
+            status = item.second.CheckRank({2}, tmp);
+            if (status && n >= 0 && item.second.shape[0] != n) {
+                tmp += " attribute " + item.first + " has " +
+                       std::to_string(item.second.shape[0]) +
+                       " rows but expected " + std::to_string(n);
+                status = false;
+            }
+            if (status) n = item.second.shape[0];
+        }
+        if (status && num_vertices >= 0 && vertex_offset + n > num_vertices) {
+            tmp += " vertex range exceeds num_vertices";
+            status = false;
+        }
+        if (!status) errstr += tmp;
+        return status;
+    }
+
+    MSGPACK_DEFINE_MAP(
+            path, time, layer, vertex_offset, num_vertices, vertex_attributes);
+};
+
 /// struct for defining a "get_mesh_data" message, which requests mesh data.
 struct GetMeshData {
     static std::string MsgId() { return "get_mesh_data"; }
@@ -455,6 +508,129 @@ struct SetProperties {
     MSGPACK_DEFINE_MAP(path);
 };
 
+/// struct for defining a "get_frame" message, which requests the last frame
+/// drawn by the visualizer window. The reply is a "frame_data" message.
+struct GetFrame {
+    static std::string MsgId() { return "get_frame"; }
+    GetFrame() : last_frame_id(-1), encoding("jpeg"), quality(80), wait_ms(0) {}
+    /// The id of the frame the client already has. If no newer frame has
+    /// been drawn, the receiver waits up to wait_ms milliseconds for one and
+    /// replies without data if there is none.
+    int64_t last_frame_id;
+    /// "jpeg" or "raw" (rows of uint8 pixels)
+    std::string encoding;
+    /// JPEG quality in [0, 100]
+    int32_t quality;
+    int32_t wait_ms;
+
+    MSGPACK_DEFINE_MAP(last_frame_id, encoding, quality, wait_ms);
+};
+
+/// struct for defining a "frame_data" message, which is the reply to a
+/// "get_frame" message.
+struct FrameData {
+    static std::string MsgId() { return "frame_data"; }
+    FrameData() : frame_id(-1), width(0), height(0), channels(0) {}
+    /// Frames are numbered consecutively. -1 if no frame has been drawn.
+    int64_t frame_id;
+    int32_t width;
+    int32_t height;
+    int32_t channels;
+    std::string encoding;
+    /// The encoded frame. Empty if the frame is the one the client has.
+    msgpack::type::raw_ref data;
+
+    MSGPACK_DEFINE_MAP(frame_id, width, height, channels, encoding, data);
+};
+
+/// struct for defining an "input_event" message, which delivers a mouse or
+/// keyboard event to the visualizer window, as if it had happened there.
+struct InputEvent {
+    static std::string MsgId() { return "input_event"; }
+    InputEvent()
+        : x(0),
+          y(0),
+          buttons(0),
+          modifiers(0),
+          wheel_dx(0.f),
+          wheel_dy(0.f),
+          key(0) {}
+    /// One of "mouse_move", "mouse_drag", "mouse_down", "mouse_up",
+    /// "mouse_wheel", "key_down", "key_up" and "text"
+    std::string type;
+    /// Mouse position in pixels, from the top left corner of the window
+    int32_t x;
+    int32_t y;
+    /// gui::MouseButton values ORed together. For "mouse_down" and
+    /// "mouse_up", the button that changed.
+    int32_t buttons;
+    /// gui::KeyModifier values ORed together
+    int32_t modifiers;
+    float wheel_dx;
+    float wheel_dy;
+    /// gui::KeyName of the key
+    uint32_t key;
+    /// UTF-8 text for "text" events
+    std::string text;
+
+    MSGPACK_DEFINE_MAP(
+            type, x, y, buttons, modifiers, wheel_dx, wheel_dy, key, text);
+};
+
+/// struct for defining a "get_task" message, which requests the next task
+/// from a TaskScheduler. The reply is a "task_data" message.
+struct GetTask {
+    static std::string MsgId() { return "get_task"; }
+    /// Name of the worker, used for logging.
+    std::string worker;
+
+    MSGPACK_DEFINE_MAP(worker);
+};
+
+/// struct for defining a "task_data" message, which is the reply to a
+/// "get_task" message.
+struct TaskData {
+    static std::string MsgId() { return "task_data"; }
+    TaskData() : id(-1), attempt(0), finished(false) {}
+    /// The task id. -1 if there is no task to hand out at the moment.
+    int64_t id;
+    /// The attempt number, starting at 1. Results of previous attempts of
+    /// a task that has been handed out again are ignored.
+    int32_t attempt;
+    /// True if all tasks are done and no new tasks will be added. The worker
+    /// should exit.
+    bool finished;
+    /// The type of the task, e.g. "register_pair"
+    std::string type;
+    /// Integer arguments of the task, e.g. fragment ids
+    std::vector<int64_t> args;
+    /// Additional arguments of the task, e.g. a JSON string
+    std::string payload;
+
+    MSGPACK_DEFINE_MAP(id, attempt, finished, type, args, payload);
+};
+
+/// struct for defining a "task_result" message, which returns the result of
+/// a task to the TaskScheduler.
+struct TaskResult {
+    static std::string MsgId() { return "task_result"; }
+    TaskResult() : id(-1), attempt(0), success(false) {}
+    /// Name of the worker, used for logging.
+    std::string worker;
+    int64_t id;
+    int32_t attempt;
+    /// False if the task failed. Failed tasks are handed out again.
+    bool success;
+    /// Description of the error if the task failed.
+    std::string error;
+    /// Numeric results, e.g. a transformation and an information matrix
+    std::vector<double> values;
+    /// Additional results, e.g. the path of a written file
+    std::string data;
+
+    MSGPACK_DEFINE_MAP(worker, id, attempt, success, error, values, data);
+};
+
 /// struct for defining a "request" message, which describes the subsequent
 /// message by storing the msg_id.
 struct Request {
@@ -486,6 +662,7 @@ struct Status {
     static Status ErrorProcessingMessage() {
         return Status(3, "error while processing message");
     }
+    static Status ErrorQueueFull() { return Status(4, "send queue full"); }
 
     /// return code. 0 means everything is OK.
     int32_t code;
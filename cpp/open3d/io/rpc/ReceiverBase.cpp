@@ -152,6 +152,26 @@ void ReceiverBase::Mainloop() {
             if (!socket_->recv(message)) {
                 continue;
             }
+            // The frames of a multipart message form a single buffer.
+            if (message.more()) {
+                std::vector<zmq::message_t> frames;
+                size_t size = message.size();
+                frames.push_back(std::move(message));
+                do {
+                    frames.emplace_back();
+                    if (!socket_->recv(frames.back())) {
+                        throw zmq::error_t();
+                    }
+                    size += frames.back().size();
+                } while (frames.back().more());
+                message.rebuild(size);
+                size_t frame_offset = 0;
+                for (const zmq::message_t& frame : frames) {
+                    memcpy((char*)message.data() + frame_offset, frame.data(),
+                           frame.size());
+                    frame_offset += frame.size();
+                }
+            }
 
             const char* buffer = (char*)message.data();
             size_t buffer_size = message.size();
@@ -186,11 +206,16 @@ void ReceiverBase::Mainloop() {
         }                                                               \
     }
                     PROCESS_MESSAGE(messages::SetMeshData)
+                    PROCESS_MESSAGE(messages::UpdateMeshData)
                     PROCESS_MESSAGE(messages::GetMeshData)
                     PROCESS_MESSAGE(messages::SetCameraData)
                     PROCESS_MESSAGE(messages::SetProperties)
                     PROCESS_MESSAGE(messages::SetActiveCamera)
                     PROCESS_MESSAGE(messages::SetTime)
+                    PROCESS_MESSAGE(messages::GetFrame)
+                    PROCESS_MESSAGE(messages::InputEvent)
+                    PROCESS_MESSAGE(messages::GetTask)
+                    PROCESS_MESSAGE(messages::TaskResult)
                     else {
                         LogInfo("ReceiverBase::Mainloop: unsupported msg "
                                 "id '{}'",
@@ -242,6 +267,18 @@ std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
     status.str += ": messages with id " + msg.MsgId() + " are not supported";
     return CreateStatusMessage(status);
 }
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::UpdateMeshData& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
 std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
         const messages::Request& req,
         const messages::GetMeshData& msg,
@@ -302,6 +339,54 @@ std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
     status.str += ": messages with id " + msg.MsgId() + " are not supported";
     return CreateStatusMessage(status);
 }
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::GetFrame& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::InputEvent& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::GetTask& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
+std::shared_ptr<zmq::message_t> ReceiverBase::ProcessMessage(
+        const messages::Request& req,
+        const messages::TaskResult& msg,
+        const MsgpackObject& obj) {
+    utility::LogInfo(
+            "ReceiverBase::ProcessMessage: messages with id {} will be "
+            "ignored",
+            msg.MsgId());
+    auto status = messages::Status::ErrorProcessingMessage();
+    status.str += ": messages with id " + msg.MsgId() + " are not supported";
+    return CreateStatusMessage(status);
+}
 
 }  // namespace rpc
 }  // namespace io
@@ -45,11 +45,16 @@ namespace rpc {
 namespace messages {
 struct Request;
 struct SetMeshData;
+struct UpdateMeshData;
 struct GetMeshData;
 struct SetCameraData;
 struct SetProperties;
 struct SetActiveCamera;
 struct SetTime;
+struct GetFrame;
+struct InputEvent;
+struct GetTask;
+struct TaskResult;
 }  // namespace messages
 
 /// Base class for the server side receiving requests from a client.
@@ -95,6 +100,10 @@ protected:
             const messages::Request& req,
             const messages::SetMeshData& msg,
             const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::UpdateMeshData& msg,
+            const MsgpackObject& obj);
     virtual std::shared_ptr<zmq::message_t> ProcessMessage(
             const messages::Request& req,
             const messages::GetMeshData& msg,
@@ -115,6 +124,22 @@ protected:
             const messages::Request& req,
             const messages::SetTime& msg,
             const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::GetFrame& msg,
+            const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::InputEvent& msg,
+            const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::GetTask& msg,
+            const MsgpackObject& obj);
+    virtual std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::TaskResult& msg,
+            const MsgpackObject& obj);
 
 private:
     void Mainloop();
@@ -41,6 +41,32 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+/// Array data of at least this size is referenced by the packed message instead
+/// of being copied into it.
+static const size_t ZERO_COPY_MIN_BYTES = 64 * 1024;
+
+/// Packs the message into a Request and sends it. Large arrays are sent
+/// directly from the memory of the geometry or tensor.
+template <class Msg>
+static bool SendRequest(const Msg& msg,
+                        std::shared_ptr<ConnectionBase> connection) {
+    msgpack::vrefbuffer vbuf(ZERO_COPY_MIN_BYTES);
+    messages::Request request{msg.MsgId()};
+    msgpack::pack(vbuf, request);
+    msgpack::pack(vbuf, msg);
+
+    std::vector<std::pair<const void*, size_t>> parts;
+    const auto* vec = vbuf.vector();
+    for (size_t i = 0; i < vbuf.vector_size(); ++i) {
+        parts.emplace_back(vec[i].iov_base, vec[i].iov_len);
+    }
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    auto reply = connection->SendMultipart(parts);
+    return ReplyIsOKStatus(*reply);
+}
+
 bool SetPointCloud(const geometry::PointCloud& pcd,
                    const std::string& path,
                    int time,
@@ -69,17 +95,7 @@ bool SetPointCloud(const geometry::PointCloud& pcd,
                 (double*)pcd.colors_.data(), {int64_t(pcd.colors_.size()), 3});
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendRequest(msg, connection);
 }
 
 bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
@@ -147,17 +163,7 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendRequest(msg, connection);
 }
 
 bool SetMeshData(const core::Tensor& vertices,
@@ -301,17 +307,54 @@ bool SetMeshData(const core::Tensor& vertices,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
+    return SendRequest(msg, connection);
+}
 
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
+bool UpdateMeshData(
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        const std::map<std::string, core::Tensor>& vertex_attributes,
+        int64_t vertex_offset,
+        int64_t num_vertices,
+        std::shared_ptr<ConnectionBase> connection) {
+    if (vertex_attributes.empty()) {
+        LogInfo("UpdateMeshData: no vertex attributes to update");
+        return false;
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    if (vertex_offset < 0) {
+        LogError("UpdateMeshData: vertex_offset must be >=0 but is {}",
+                 vertex_offset);
+    }
+
+    messages::UpdateMeshData msg;
+    msg.path = path;
+    msg.time = time;
+    msg.layer = layer;
+    msg.vertex_offset = vertex_offset;
+    msg.num_vertices = num_vertices;
+
+    std::vector<core::Tensor> tensor_cache;
+    for (const auto& item : vertex_attributes) {
+        tensor_cache.push_back(
+                item.second.To(core::Device("CPU:0")).Contiguous());
+        const core::Tensor& tensor = tensor_cache.back();
+        if (tensor.NumDims() != 2 ||
+            tensor.GetShape()[0] !=
+                    vertex_attributes.begin()->second.GetShape()[0]) {
+            LogError("UpdateMeshData: Attribute {} has incompatible shape {}",
+                     item.first, tensor.GetShape().ToString());
+        }
+        msg.vertex_attributes[item.first] =
+                DISPATCH_DTYPE_TO_TEMPLATE(tensor.GetDtype(), [&]() {
+                    return messages::Array::FromPtr(
+                            (scalar_t*)tensor.GetDataPtr(),
+                            static_cast<std::vector<int64_t>>(
+                                    tensor.GetShape()));
+                });
+    }
+
+    return SendRequest(msg, connection);
 }
 
 bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
@@ -358,34 +401,14 @@ bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendRequest(msg, connection);
 }
 
 bool SetTime(int time, std::shared_ptr<ConnectionBase> connection) {
     messages::SetTime msg;
     msg.time = time;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendRequest(msg, connection);
 }
 
 bool SetActiveCamera(const std::string& path,
@@ -393,17 +416,86 @@ bool SetActiveCamera(const std::string& path,
     messages::SetActiveCamera msg;
     msg.path = path;
 
+    return SendRequest(msg, connection);
+}
+
+bool GetFrame(Frame& frame,
+              int64_t last_frame_id,
+              const std::string& encoding,
+              int quality,
+              int wait_ms,
+              std::shared_ptr<ConnectionBase> connection) {
+    messages::GetFrame msg;
+    msg.last_frame_id = last_frame_id;
+    msg.encoding = encoding;
+    msg.quality = quality;
+    msg.wait_ms = wait_ms;
+
     msgpack::sbuffer sbuf;
     messages::Request request{msg.MsgId()};
     msgpack::pack(sbuf, request);
     msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    auto reply = connection->Send(sbuf.data(), sbuf.size());
+    if (!reply) {
+        LogInfo("GetFrame: no reply");
+        return false;
+    }
+
+    const char* buffer = (const char*)reply->data();
+    const size_t buffer_size = reply->size();
+    try {
+        size_t offset = 0;
+        auto reply_handle = msgpack::unpack(buffer, buffer_size, offset);
+        auto reply_msg = reply_handle.get().as<messages::Reply>();
+        if (reply_msg.msg_id != messages::FrameData::MsgId()) {
+            offset = 0;
+            bool ok;
+            auto status = UnpackStatusFromReply(*reply, offset, ok);
+            LogInfo("GetFrame: {}", ok ? status->str : "unexpected reply");
+            return false;
+        }
+        auto data_handle = msgpack::unpack(buffer, buffer_size, offset);
+        auto data = data_handle.get().as<messages::FrameData>();
+        frame.id = data.frame_id;
+        frame.width = data.width;
+        frame.height = data.height;
+        frame.channels = data.channels;
+        frame.encoding = data.encoding;
+        if (data.data.size > 0) {
+            frame.data.assign(data.data.ptr, data.data.ptr + data.data.size);
+        }
+    } catch (std::exception& err) {
+        LogInfo("GetFrame: {}", err.what());
+        return false;
+    }
+    return true;
+}
+
+bool SendInputEvent(const std::string& type,
+                    int x,
+                    int y,
+                    int buttons,
+                    int modifiers,
+                    float wheel_dx,
+                    float wheel_dy,
+                    int key,
+                    const std::string& text,
+                    std::shared_ptr<ConnectionBase> connection) {
+    messages::InputEvent msg;
+    msg.type = type;
+    msg.x = x;
+    msg.y = y;
+    msg.buttons = buttons;
+    msg.modifiers = modifiers;
+    msg.wheel_dx = wheel_dx;
+    msg.wheel_dy = wheel_dy;
+    msg.key = uint32_t(key);
+    msg.text = text;
+
+    return SendRequest(msg, connection);
 }
 
 }  // namespace rpc
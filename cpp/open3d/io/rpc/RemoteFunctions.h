@@ -141,6 +141,37 @@ bool SetMeshData(const core::Tensor& vertices,
                  std::shared_ptr<ConnectionBase> connection =
                          std::shared_ptr<ConnectionBase>());
 
+/// Function for updating a range of vertices of mesh data that was sent
+/// before with SetMeshData, SetPointCloud or SetTriangleMesh. Only the
+/// specified attributes of the vertices in the range are sent.
+/// \param path               Path descriptor of the object to update.
+///
+/// \param time               The time point associated with the object.
+///
+/// \param layer              The layer of the object.
+///
+/// \param vertex_attributes  Map with Tensors storing the new values. Use the
+/// key "vertices" for the positions. The first dim of all attributes must be
+/// the same.
+///
+/// \param vertex_offset      Index of the first vertex to overwrite.
+///
+/// \param num_vertices       The new number of vertices. A negative value
+/// keeps the number of vertices of the object.
+///
+/// \param connection  The connection object used for sending the data.
+///                    If nullptr a default connection object will be used.
+///
+bool UpdateMeshData(
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        const std::map<std::string, core::Tensor>& vertex_attributes,
+        int64_t vertex_offset = 0,
+        int64_t num_vertices = -1,
+        std::shared_ptr<ConnectionBase> connection =
+                std::shared_ptr<ConnectionBase>());
+
 /// Function for sending Camera data.
 /// \param camera      The PinholeCameraParameters object.
 ///
@@ -182,6 +213,63 @@ bool SetActiveCamera(const std::string& path,
                      std::shared_ptr<ConnectionBase> connection =
                              std::shared_ptr<ConnectionBase>());
 
+/// A frame drawn by the external visualizer, see GetFrame().
+struct Frame {
+    /// Frames are numbered consecutively. -1 if no frame has been drawn.
+    int64_t id = -1;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    /// "jpeg" or "raw" (rows of uint8 pixels)
+    std::string encoding;
+    std::vector<uint8_t> data;
+};
+
+/// Requests the last frame drawn by the external visualizer window. This
+/// requires a synchronous Connection.
+/// \param frame          Receives the frame. Its data is left unchanged if
+/// the visualizer has not drawn a frame after \p last_frame_id.
+///
+/// \param last_frame_id  The id of the frame the client already has, or -1.
+///
+/// \param encoding       "jpeg" or "raw".
+///
+/// \param quality        JPEG quality in [0, 100].
+///
+/// \param wait_ms        Time in milliseconds to wait for a frame newer than
+/// \p last_frame_id.
+///
+/// \param connection     The connection object used for sending the data.
+///                       If nullptr a default connection object will be used.
+///
+bool GetFrame(Frame& frame,
+              int64_t last_frame_id = -1,
+              const std::string& encoding = "jpeg",
+              int quality = 80,
+              int wait_ms = 0,
+              std::shared_ptr<ConnectionBase> connection =
+                      std::shared_ptr<ConnectionBase>());
+
+/// Sends a mouse or keyboard event to the external visualizer window. See
+/// messages::InputEvent for the parameters.
+/// \param type        One of "mouse_move", "mouse_drag", "mouse_down",
+/// "mouse_up", "mouse_wheel", "key_down", "key_up" and "text".
+///
+/// \param connection  The connection object used for sending the data.
+///                    If nullptr a default connection object will be used.
+///
+bool SendInputEvent(const std::string& type,
+                    int x = 0,
+                    int y = 0,
+                    int buttons = 0,
+                    int modifiers = 0,
+                    float wheel_dx = 0.f,
+                    float wheel_dy = 0.f,
+                    int key = 0,
+                    const std::string& text = "",
+                    std::shared_ptr<ConnectionBase> connection =
+                            std::shared_ptr<ConnectionBase>());
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/TaskScheduler.h"
+
+#include <algorithm>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+TaskScheduler::TaskScheduler(const std::string& address,
+                             int lease_ms,
+                             int max_attempts,
+                             int timeout)
+    : ReceiverBase(address, timeout),
+      lease_ms_(lease_ms),
+      max_attempts_(std::max(1, max_attempts)),
+      num_finished_(0),
+      closed_(false) {}
+
+TaskScheduler::~TaskScheduler() { Stop(); }
+
+int64_t TaskScheduler::AddTask(const Task& task) {
+    const std::lock_guard<std::mutex> lock(tasks_mutex_);
+    if (closed_) {
+        utility::LogError("TaskScheduler::AddTask: the scheduler is closed");
+    }
+    const int64_t id = int64_t(tasks_.size());
+    tasks_.emplace_back();
+    tasks_.back().task_ = task;
+    queue_.push_back(id);
+    return id;
+}
+
+void TaskScheduler::Close() {
+    const std::lock_guard<std::mutex> lock(tasks_mutex_);
+    closed_ = true;
+}
+
+bool TaskScheduler::Wait(int timeout_ms) {
+    const auto end = Clock::now() + std::chrono::milliseconds(timeout_ms);
+    std::unique_lock<std::mutex> lock(tasks_mutex_);
+    while (num_finished_ < int64_t(tasks_.size())) {
+        // Wake up regularly to expire the leases of tasks whose workers have
+        // died, as no worker may be left to trigger this.
+        auto wake_up = Clock::now() + std::chrono::seconds(1);
+        if (timeout_ms >= 0) {
+            if (Clock::now() >= end) {
+                return false;
+            }
+            wake_up = std::min(wake_up, end);
+        }
+        tasks_cv_.wait_until(lock, wake_up);
+        ExpireLeases();
+    }
+    return true;
+}
+
+Task TaskScheduler::GetTask(int64_t id) const {
+    const std::lock_guard<std::mutex> lock(tasks_mutex_);
+    if (id < 0 || id >= int64_t(tasks_.size())) {
+        utility::LogError("TaskScheduler::GetTask: invalid task id {}", id);
+    }
+    return tasks_[id].task_;
+}
+
+TaskOutcome TaskScheduler::GetOutcome(int64_t id) const {
+    const std::lock_guard<std::mutex> lock(tasks_mutex_);
+    if (id < 0 || id >= int64_t(tasks_.size())) {
+        utility::LogError("TaskScheduler::GetOutcome: invalid task id {}", id);
+    }
+    return tasks_[id].outcome_;
+}
+
+int64_t TaskScheduler::GetTaskCount() const {
+    const std::lock_guard<std::mutex> lock(tasks_mutex_);
+    return int64_t(tasks_.size());
+}
+
+int64_t TaskScheduler::GetFailedTaskCount() const {
+    const std::lock_guard<std::mutex> lock(tasks_mutex_);
+    int64_t count = 0;
+    for (const auto& entry : tasks_) {
+        if (entry.state_ == TaskState::Failed) ++count;
+    }
+    return count;
+}
+
+void TaskScheduler::RetryOrFail(int64_t id, const std::string& error) {
+    TaskEntry& entry = tasks_[id];
+    entry.outcome_.success_ = false;
+    entry.outcome_.error_ = error;
+    if (entry.outcome_.attempts_ < max_attempts_) {
+        utility::LogInfo("TaskScheduler: task {} failed ({}), retrying", id,
+                         error);
+        entry.state_ = TaskState::Queued;
+        queue_.push_back(id);
+    } else {
+        utility::LogWarning("TaskScheduler: task {} failed after {} attempts",
+                            id, entry.outcome_.attempts_);
+        entry.state_ = TaskState::Failed;
+        ++num_finished_;
+        tasks_cv_.notify_all();
+    }
+}
+
+void TaskScheduler::ExpireLeases() {
+    const auto now = Clock::now();
+    for (int64_t id = 0; id < int64_t(tasks_.size()); ++id) {
+        if (tasks_[id].state_ == TaskState::Running &&
+            tasks_[id].deadline_ < now) {
+            RetryOrFail(id, "lease of worker " + tasks_[id].outcome_.worker_ +
+                                    " expired");
+        }
+    }
+}
+
+std::shared_ptr<zmq::message_t> TaskScheduler::ProcessMessage(
+        const messages::Request& req,
+        const messages::GetTask& msg,
+        const MsgpackObject& obj) {
+    messages::TaskData data;
+    {
+        const std::lock_guard<std::mutex> lock(tasks_mutex_);
+        ExpireLeases();
+        if (!queue_.empty()) {
+            const int64_t id = queue_.front();
+            queue_.pop_front();
+            TaskEntry& entry = tasks_[id];
+            entry.state_ = TaskState::Running;
+            entry.deadline_ =
+                    Clock::now() + std::chrono::milliseconds(lease_ms_);
+            entry.outcome_.worker_ = msg.worker;
+            ++entry.outcome_.attempts_;
+            data.id = id;
+            data.attempt = entry.outcome_.attempts_;
+            data.type = entry.task_.type_;
+            data.args = entry.task_.args_;
+            data.payload = entry.task_.payload_;
+        } else {
+            data.finished =
+                    closed_ && num_finished_ == int64_t(tasks_.size());
+        }
+    }
+
+    msgpack::sbuffer sbuf;
+    messages::Reply reply{data.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, data);
+    return std::make_shared<zmq::message_t>(sbuf.data(), sbuf.size());
+}
+
+std::shared_ptr<zmq::message_t> TaskScheduler::ProcessMessage(
+        const messages::Request& req,
+        const messages::TaskResult& msg,
+        const MsgpackObject& obj) {
+    const std::lock_guard<std::mutex> lock(tasks_mutex_);
+    if (msg.id < 0 || msg.id >= int64_t(tasks_.size())) {
+        auto status = messages::Status::ErrorProcessingMessage();
+        status.str += ": invalid task id " + std::to_string(msg.id);
+        msgpack::sbuffer sbuf;
+        messages::Reply reply{status.MsgId()};
+        msgpack::pack(sbuf, reply);
+        msgpack::pack(sbuf, status);
+        return std::make_shared<zmq::message_t>(sbuf.data(), sbuf.size());
+    }
+
+    TaskEntry& entry = tasks_[msg.id];
+    if (msg.success) {
+        // Accept the first successful result, even from an attempt whose
+        // lease has expired.
+        if (entry.state_ != TaskState::Succeeded) {
+            if (entry.state_ == TaskState::Failed) {
+                --num_finished_;
+            }
+            if (entry.state_ == TaskState::Queued) {
+                queue_.erase(std::remove(queue_.begin(), queue_.end(), msg.id),
+                             queue_.end());
+            }
+            entry.state_ = TaskState::Succeeded;
+            entry.outcome_.success_ = true;
+            entry.outcome_.error_.clear();
+            entry.outcome_.values_ = msg.values;
+            entry.outcome_.data_ = msg.data;
+            entry.outcome_.worker_ = msg.worker;
+            ++num_finished_;
+            tasks_cv_.notify_all();
+        }
+    } else if (entry.state_ == TaskState::Running &&
+               msg.attempt == entry.outcome_.attempts_) {
+        RetryOrFail(msg.id, msg.worker + ": " + msg.error);
+    }
+    return CreateStatusOKMsg();
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "open3d/io/rpc/ReceiverBase.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// A unit of work that a TaskScheduler hands out to remote workers.
+struct Task {
+    /// The type of the task, which selects the handler of the worker.
+    std::string type_;
+    /// Integer arguments, e.g. the ids of a fragment pair.
+    std::vector<int64_t> args_;
+    /// Additional arguments, e.g. a JSON string.
+    std::string payload_;
+};
+
+/// The result of a Task as returned by a worker.
+struct TaskOutcome {
+    /// True if the task succeeded. False if it failed or was not finished
+    /// after all attempts.
+    bool success_ = false;
+    /// Description of the error of the last failed attempt.
+    std::string error_;
+    /// Numeric results, e.g. a transformation and an information matrix.
+    std::vector<double> values_;
+    /// Additional results, e.g. the path of a written file.
+    std::string data_;
+    /// The worker that returned the result.
+    std::string worker_;
+    /// Number of times the task has been handed out.
+    int attempts_ = 0;
+};
+
+/// Server that distributes tasks to workers on other nodes, see TaskWorker.
+///
+/// Workers pull tasks with "get_task" messages and return the results with
+/// "task_result" messages. A task that fails or is not returned within the
+/// lease time, e.g. because its worker died, is handed out again until
+/// \p max_attempts is reached.
+class TaskScheduler : public ReceiverBase {
+public:
+    /// \param address      Address to listen on. The default accepts workers
+    /// on all interfaces.
+    /// \param lease_ms     Time in milliseconds after which a task that has
+    /// been handed out is considered lost and is handed out again.
+    /// \param max_attempts Maximum number of times a task is handed out.
+    /// \param timeout      Timeout in milliseconds for sending the reply.
+    TaskScheduler(const std::string& address = "tcp://*:51455",
+                  int lease_ms = 600000,
+                  int max_attempts = 3,
+                  int timeout = 10000);
+
+    /// Stops the mainloop before the tasks are destroyed.
+    ~TaskScheduler() override;
+
+    /// Adds a task and returns its id. Ids are consecutive, starting at 0.
+    int64_t AddTask(const Task& task);
+
+    /// Signals that no more tasks will be added. Workers exit once all tasks
+    /// are finished.
+    void Close();
+
+    /// Blocks until all tasks added so far have succeeded or failed after
+    /// all attempts.
+    /// \param timeout_ms  Maximum time to wait. Negative values wait forever.
+    /// \return False if the timeout expired.
+    bool Wait(int timeout_ms = -1);
+
+    /// Returns the task with id \p id.
+    Task GetTask(int64_t id) const;
+
+    /// Returns the outcome of the task with id \p id.
+    TaskOutcome GetOutcome(int64_t id) const;
+
+    /// Returns the number of tasks added so far.
+    int64_t GetTaskCount() const;
+
+    /// Returns the number of tasks that failed after all attempts.
+    int64_t GetFailedTaskCount() const;
+
+protected:
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::GetTask& msg,
+            const MsgpackObject& obj) override;
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::TaskResult& msg,
+            const MsgpackObject& obj) override;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    enum class TaskState { Queued, Running, Succeeded, Failed };
+
+    struct TaskEntry {
+        Task task_;
+        TaskState state_ = TaskState::Queued;
+        Clock::time_point deadline_;
+        TaskOutcome outcome_;
+    };
+
+    /// Hands out the task again or marks it as failed if all attempts are
+    /// used up. The mutex must be locked.
+    void RetryOrFail(int64_t id, const std::string& error);
+
+    /// Calls RetryOrFail for all tasks with an expired lease. The mutex must
+    /// be locked.
+    void ExpireLeases();
+
+    const int lease_ms_;
+    const int max_attempts_;
+    mutable std::mutex tasks_mutex_;
+    std::condition_variable tasks_cv_;
+    std::vector<TaskEntry> tasks_;
+    std::deque<int64_t> queue_;
+    int64_t num_finished_;
+    bool closed_;
+};
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
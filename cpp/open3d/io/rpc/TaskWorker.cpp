@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/TaskWorker.h"
+
+#include <chrono>
+#include <thread>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace {
+/// Sends a "get_task" message. Returns false if there is no valid reply.
+bool RequestTask(ConnectionBase& connection,
+                 const std::string& worker,
+                 messages::TaskData& data) {
+    msgpack::sbuffer sbuf;
+    messages::GetTask msg;
+    msg.worker = worker;
+    messages::Request request{msg.MsgId()};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, msg);
+    auto reply = connection.Send(sbuf.data(), sbuf.size());
+    if (!reply || reply->size() == 0) {
+        return false;
+    }
+
+    const char* buffer = (const char*)reply->data();
+    const size_t buffer_size = reply->size();
+    try {
+        size_t offset = 0;
+        auto reply_handle = msgpack::unpack(buffer, buffer_size, offset);
+        auto reply_msg = reply_handle.get().as<messages::Reply>();
+        if (reply_msg.msg_id != messages::TaskData::MsgId()) {
+            offset = 0;
+            bool ok;
+            auto status = UnpackStatusFromReply(*reply, offset, ok);
+            utility::LogInfo("TaskWorker: {}",
+                             ok ? status->str : "unexpected reply");
+            return false;
+        }
+        auto data_handle = msgpack::unpack(buffer, buffer_size, offset);
+        data = data_handle.get().as<messages::TaskData>();
+    } catch (std::exception& err) {
+        utility::LogInfo("TaskWorker: {}", err.what());
+        return false;
+    }
+    return true;
+}
+}  // namespace
+
+TaskWorker::TaskWorker(std::shared_ptr<ConnectionBase> connection,
+                       const std::string& worker)
+    : connection_(connection), worker_(worker) {}
+
+void TaskWorker::SetHandler(const std::string& type, TaskHandler handler) {
+    handlers_[type] = handler;
+}
+
+int64_t TaskWorker::Run(int poll_ms, int max_missed_replies) {
+    int64_t num_processed = 0;
+    int missed_replies = 0;
+    while (missed_replies < max_missed_replies) {
+        messages::TaskData data;
+        if (!RequestTask(*connection_, worker_, data)) {
+            ++missed_replies;
+            std::this_thread::sleep_for(std::chrono::milliseconds(poll_ms));
+            continue;
+        }
+        missed_replies = 0;
+        if (data.finished) {
+            break;
+        }
+        if (data.id < 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(poll_ms));
+            continue;
+        }
+
+        Task task{data.type, data.args, data.payload};
+        TaskOutcome outcome;
+        outcome.success_ = true;
+        auto handler = handlers_.find(task.type_);
+        if (handler == handlers_.end()) {
+            outcome.success_ = false;
+            outcome.error_ = "no handler for tasks of type " + task.type_;
+        } else {
+            try {
+                handler->second(task, outcome);
+            } catch (std::exception& err) {
+                outcome.success_ = false;
+                outcome.error_ = err.what();
+            }
+        }
+        ++num_processed;
+
+        messages::TaskResult result;
+        result.worker = worker_;
+        result.id = data.id;
+        result.attempt = data.attempt;
+        result.success = outcome.success_;
+        result.error = outcome.error_;
+        result.values = outcome.values_;
+        result.data = outcome.data_;
+        msgpack::sbuffer sbuf;
+        messages::Request request{result.MsgId()};
+        msgpack::pack(sbuf, request);
+        msgpack::pack(sbuf, result);
+        auto reply = connection_->Send(sbuf.data(), sbuf.size());
+        // The scheduler hands out the task again once its lease expires.
+        if (!reply || reply->size() == 0 || !ReplyIsOKStatus(*reply)) {
+            utility::LogWarning("TaskWorker: failed to return task {}",
+                                data.id);
+        }
+    }
+    return num_processed;
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
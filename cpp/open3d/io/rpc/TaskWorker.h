@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "open3d/io/rpc/ConnectionBase.h"
+#include "open3d/io/rpc/TaskScheduler.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// Function that processes a Task. The function stores the results in the
+/// values_ and data_ members of the outcome. A task fails if the function
+/// sets success_ to false or throws an exception.
+typedef std::function<void(const Task& task, TaskOutcome& outcome)>
+        TaskHandler;
+
+/// Client that processes the tasks of a TaskScheduler running on another
+/// node. Run as many workers as there are nodes or devices.
+class TaskWorker {
+public:
+    /// \param connection  The connection to the scheduler.
+    /// \param worker      Name of the worker, used for logging on the
+    /// scheduler side.
+    TaskWorker(std::shared_ptr<ConnectionBase> connection,
+               const std::string& worker);
+
+    /// Sets the handler for tasks of type \p type.
+    void SetHandler(const std::string& type, TaskHandler handler);
+
+    /// Requests and processes tasks until the scheduler reports that all
+    /// tasks are finished.
+    /// \param poll_ms          Time to wait before asking again if the
+    /// scheduler has no task to hand out.
+    /// \param max_missed_replies  Number of consecutive requests without a
+    /// reply after which the scheduler is considered gone.
+    /// \return The number of processed tasks.
+    int64_t Run(int poll_ms = 500, int max_missed_replies = 10);
+
+private:
+    std::shared_ptr<ConnectionBase> connection_;
+    const std::string worker_;
+    std::map<std::string, TaskHandler> handlers_;
+};
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -36,6 +36,7 @@
 #include <Eigen/Core>
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <ctime>
 #include <iostream>
 
@@ -48,13 +49,30 @@
 namespace open3d {
 namespace io {
 
+static void AddLatency(double latency_ms,
+                       size_t count,
+                       double& mean_ms,
+                       double& max_ms) {
+    mean_ms += (latency_ms - mean_ms) / static_cast<double>(count);
+    max_ms = std::max(max_ms, latency_ms);
+}
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+                   std::chrono::steady_clock::now() - start)
+            .count();
+}
+
 AzureKinectRecorder::AzureKinectRecorder(
         const AzureKinectSensorConfig& sensor_config, size_t sensor_index)
     : RGBDRecorder(),
       sensor_(AzureKinectSensor(sensor_config)),
       device_index_(sensor_index) {}
 
-AzureKinectRecorder::~AzureKinectRecorder() { CloseRecord(); }
+AzureKinectRecorder::~AzureKinectRecorder() {
+    StopAsyncRecord();
+    CloseRecord();
+}
 
 bool AzureKinectRecorder::InitSensor() {
     return sensor_.Connect(device_index_);
@@ -76,12 +94,15 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
         }
         utility::LogInfo("Writing to header");
 
+        // The capture thread of an asynchronous recording checks this flag.
+        std::lock_guard<std::mutex> lock(mutex_);
         is_record_created_ = true;
     }
     return true;
 }
 
 bool AzureKinectRecorder::CloseRecord() {
+    StopAsyncRecord();
     if (is_record_created_) {
         utility::LogInfo("Saving recording...");
         if (K4A_FAILED(k4a_plugin::k4a_record_flush(recording_))) {
@@ -98,6 +119,11 @@ bool AzureKinectRecorder::CloseRecord() {
 
 std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
         bool write, bool enable_align_depth_to_color) {
+    if (capture_thread_.joinable()) {
+        utility::LogError(
+                "Asynchronous recording in progress, use NextFrame() "
+                "instead.");
+    }
     k4a_capture_t capture = sensor_.CaptureRawFrame();
     if (capture != nullptr && is_record_created_ && write) {
         if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(recording_,
@@ -110,12 +136,200 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
             capture, enable_align_depth_to_color
                              ? sensor_.transform_depth_to_color_
                              : nullptr);
+    if (capture != nullptr) k4a_plugin::k4a_capture_release(capture);
     if (im_rgbd == nullptr) {
         utility::LogInfo("Invalid capture, skipping this frame");
         return nullptr;
     }
-    k4a_plugin::k4a_capture_release(capture);
     return im_rgbd;
 }
+
+bool AzureKinectRecorder::StartAsyncRecord(bool write,
+                                           bool enable_align_depth_to_color,
+                                           size_t queue_size) {
+    if (capture_thread_.joinable()) {
+        utility::LogWarning("Asynchronous recording already in progress.");
+        return true;
+    }
+    enable_align_depth_to_color_ = enable_align_depth_to_color;
+    queue_size_ = std::max<size_t>(queue_size, 1);
+    async_write_ = write;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = false;
+        stats_ = AzureKinectRecorderStats();
+        last_device_timestamp_us_ = 0;
+        latest_frame_.reset();
+    }
+    capture_thread_ = std::thread(&AzureKinectRecorder::CaptureLoop, this);
+    write_thread_ = std::thread(&AzureKinectRecorder::WriteLoop, this);
+    decode_thread_ = std::thread(&AzureKinectRecorder::DecodeLoop, this);
+    return true;
+}
+
+std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::NextFrame(
+        bool wait) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (wait) {
+        frame_ready_.wait(lock, [this] {
+            return latest_frame_ != nullptr || stop_ ||
+                   !decode_thread_.joinable();
+        });
+    }
+    std::shared_ptr<geometry::RGBDImage> frame = latest_frame_;
+    latest_frame_.reset();
+    return frame;
+}
+
+void AzureKinectRecorder::StopAsyncRecord() {
+    if (!capture_thread_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    queue_changed_.notify_all();
+    frame_ready_.notify_all();
+    capture_thread_.join();
+    write_thread_.join();
+    decode_thread_.join();
+    for (TimedCapture& item : decode_queue_) {
+        k4a_plugin::k4a_capture_release(item.first);
+    }
+    decode_queue_.clear();
+
+    const AzureKinectRecorderStats stats = GetStats();
+    utility::LogInfo(
+            "Captured {} frames, wrote {} frames. Dropped {} frames on the "
+            "device, {} frames for writing. Write latency: {:.1f}ms mean, "
+            "{:.1f}ms max.",
+            stats.captured_frames, stats.written_frames,
+            stats.device_dropped_frames, stats.write_dropped_frames,
+            stats.mean_write_latency_ms, stats.max_write_latency_ms);
+}
+
+AzureKinectRecorderStats AzureKinectRecorder::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void AzureKinectRecorder::CaptureLoop() {
+    const uint64_t frame_interval_us =
+            static_cast<uint64_t>(sensor_.timeout_) * 1000;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) return;
+        }
+        k4a_capture_t capture = sensor_.CaptureRawFrame();
+        if (capture == nullptr) continue;
+        const auto captured_at = std::chrono::steady_clock::now();
+
+        uint64_t device_timestamp_us = 0;
+        k4a_image_t image = k4a_plugin::k4a_capture_get_depth_image(capture);
+        if (image == nullptr) {
+            image = k4a_plugin::k4a_capture_get_color_image(capture);
+        }
+        if (image != nullptr) {
+            device_timestamp_us =
+                    k4a_plugin::k4a_image_get_timestamp_usec(image);
+            k4a_plugin::k4a_image_release(image);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) {
+            k4a_plugin::k4a_capture_release(capture);
+            return;
+        }
+        ++stats_.captured_frames;
+        if (device_timestamp_us > 0) {
+            // A gap of more than 1.5 frame intervals means missing frames.
+            if (last_device_timestamp_us_ > 0 && frame_interval_us > 0 &&
+                device_timestamp_us > last_device_timestamp_us_ +
+                                              frame_interval_us * 3 / 2) {
+                const uint64_t gap_us =
+                        device_timestamp_us - last_device_timestamp_us_;
+                stats_.device_dropped_frames +=
+                        (gap_us + frame_interval_us / 2) / frame_interval_us -
+                        1;
+            }
+            last_device_timestamp_us_ = device_timestamp_us;
+        }
+        if (async_write_ && is_record_created_) {
+            if (write_queue_.size() < queue_size_) {
+                k4a_plugin::k4a_capture_reference(capture);
+                write_queue_.emplace_back(capture, captured_at);
+            } else {
+                ++stats_.write_dropped_frames;
+            }
+        }
+        // Only the latest frames are of interest for display.
+        if (decode_queue_.size() >= queue_size_) {
+            k4a_plugin::k4a_capture_release(decode_queue_.front().first);
+            decode_queue_.pop_front();
+            ++stats_.decode_dropped_frames;
+        }
+        decode_queue_.emplace_back(capture, captured_at);
+        queue_changed_.notify_all();
+    }
+}
+
+void AzureKinectRecorder::WriteLoop() {
+    while (true) {
+        TimedCapture item;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queue_changed_.wait(
+                    lock, [this] { return stop_ || !write_queue_.empty(); });
+            // Queued captures are written before stopping.
+            if (write_queue_.empty()) return;
+            item = write_queue_.front();
+            write_queue_.pop_front();
+        }
+        const bool written = K4A_SUCCEEDED(
+                k4a_plugin::k4a_record_write_capture(recording_, item.first));
+        k4a_plugin::k4a_capture_release(item.first);
+        const double latency_ms = MillisecondsSince(item.second);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!written) {
+            utility::LogWarning("Unable to write to capture");
+            ++stats_.write_dropped_frames;
+            continue;
+        }
+        ++stats_.written_frames;
+        AddLatency(latency_ms, stats_.written_frames,
+                   stats_.mean_write_latency_ms, stats_.max_write_latency_ms);
+    }
+}
+
+void AzureKinectRecorder::DecodeLoop() {
+    while (true) {
+        TimedCapture item;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queue_changed_.wait(
+                    lock, [this] { return stop_ || !decode_queue_.empty(); });
+            if (stop_) return;
+            item = decode_queue_.front();
+            decode_queue_.pop_front();
+        }
+        auto im_rgbd = AzureKinectSensor::DecompressCapture(
+                item.first, enable_align_depth_to_color_
+                                    ? sensor_.transform_depth_to_color_
+                                    : nullptr);
+        k4a_plugin::k4a_capture_release(item.first);
+        if (im_rgbd == nullptr) continue;
+        // DecompressCapture() reuses its output buffer.
+        auto frame = std::make_shared<geometry::RGBDImage>(*im_rgbd);
+        const double latency_ms = MillisecondsSince(item.second);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        latest_frame_ = frame;
+        ++stats_.decoded_frames;
+        AddLatency(latency_ms, stats_.decoded_frames,
+                   stats_.mean_decode_latency_ms, stats_.max_decode_latency_ms);
+        frame_ready_.notify_all();
+    }
+}
 }  // namespace io
 }  // namespace open3d
@@ -27,14 +27,21 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 
 #include "open3d/io/sensor/RGBDRecorder.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensor.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensorConfig.h"
 
-struct _k4a_record_t;  // typedef _k4a_record_t* k4a_record_t;
+struct _k4a_record_t;   // typedef _k4a_record_t* k4a_record_t;
+struct _k4a_capture_t;  // typedef _k4a_capture_t* k4a_capture_t;
 
 namespace open3d {
 
@@ -45,6 +52,31 @@ class Image;
 
 namespace io {
 
+/// Frame counts and per-stage latencies of the asynchronous recording pipeline
+/// of AzureKinectRecorder. Latencies are measured from the time a capture is
+/// received from the device.
+struct AzureKinectRecorderStats {
+    /// Captures received from the device.
+    size_t captured_frames = 0;
+    /// Frames missing between consecutive captures, judged from the device
+    /// timestamps. These are dropped by the device or the SDK.
+    size_t device_dropped_frames = 0;
+    /// Captures written to the mkv file.
+    size_t written_frames = 0;
+    /// Captures not written because the write queue was full.
+    size_t write_dropped_frames = 0;
+    /// Captures decoded to RGBD images.
+    size_t decoded_frames = 0;
+    /// Captures not decoded because the decode queue was full.
+    size_t decode_dropped_frames = 0;
+    /// Mean and max latency (in ms) until a capture is written.
+    double mean_write_latency_ms = 0.0;
+    double max_write_latency_ms = 0.0;
+    /// Mean and max latency (in ms) until a capture is decoded.
+    double mean_decode_latency_ms = 0.0;
+    double max_decode_latency_ms = 0.0;
+};
+
 /// \class AzureKinectRecorder
 ///
 /// AzureKinect recorder.
@@ -60,7 +92,8 @@ public:
     ///
     /// \param filename Path to the mkv file.
     bool OpenRecord(const std::string& filename) override;
-    /// Close the recorded mkv file.
+    /// Close the recorded mkv file. An asynchronous recording is stopped
+    /// first.
     bool CloseRecord() override;
     /// Record a frame to mkv if flag is on and return an RGBD object.
     ///
@@ -73,12 +106,69 @@ public:
     /// Check if the mkv file is created.
     bool IsRecordCreated() { return is_record_created_; }
 
+    /// Start the asynchronous recording pipeline.
+    ///
+    /// Captures are read from the device on a capture thread and handed over
+    /// through bounded queues to a writer thread, which writes them to the
+    /// mkv file, and to a decoder thread, which decompresses and optionally
+    /// aligns them for NextFrame(). When a queue is full the capture is
+    /// dropped from that stage and counted in GetStats(), so a slow stage
+    /// never stalls the capture. RecordFrame() is unavailable meanwhile.
+    /// \param write Enable recording to the mkv file.
+    /// \param enable_align_depth_to_color Enable aligning WFOV depth image to
+    /// the color image.
+    /// \param queue_size Max number of captures waiting in each queue.
+    bool StartAsyncRecord(bool write,
+                          bool enable_align_depth_to_color,
+                          size_t queue_size = 16);
+
+    /// Enable or pause writing to the mkv file during asynchronous recording.
+    void SetAsyncWrite(bool write) { async_write_ = write; }
+
+    /// Get the latest decoded frame of the asynchronous recording. Older
+    /// undecoded captures are skipped.
+    ///
+    /// \param wait If true wait for a frame, else return nullptr if no new
+    /// frame is available.
+    std::shared_ptr<geometry::RGBDImage> NextFrame(bool wait = true);
+
+    /// Stop the asynchronous recording pipeline. Queued captures are still
+    /// written to the mkv file.
+    void StopAsyncRecord();
+
+    /// Get the statistics of the asynchronous recording pipeline.
+    AzureKinectRecorderStats GetStats() const;
+
 protected:
     AzureKinectSensor sensor_;
     _k4a_record_t* recording_;
     size_t device_index_;
 
     bool is_record_created_ = false;
+
+private:
+    using TimedCapture =
+            std::pair<_k4a_capture_t*, std::chrono::steady_clock::time_point>;
+
+    void CaptureLoop();
+    void WriteLoop();
+    void DecodeLoop();
+
+    bool enable_align_depth_to_color_ = true;
+    size_t queue_size_ = 16;
+    std::atomic<bool> async_write_{false};
+    mutable std::mutex mutex_;
+    std::condition_variable queue_changed_;
+    std::condition_variable frame_ready_;
+    std::deque<TimedCapture> write_queue_;
+    std::deque<TimedCapture> decode_queue_;
+    std::shared_ptr<geometry::RGBDImage> latest_frame_;
+    AzureKinectRecorderStats stats_;
+    uint64_t last_device_timestamp_us_ = 0;
+    bool stop_ = false;
+    std::thread capture_thread_;
+    std::thread write_thread_;
+    std::thread decode_thread_;
 };
 
 }  // namespace io
@@ -24,6 +24,10 @@
 
 #include "open3d/ml/contrib/GridSubsampling.h"
 
+#include <tbb/parallel_for.h>
+
+#include <numeric>
+
 namespace open3d {
 namespace ml {
 namespace contrib {
@@ -149,9 +153,6 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
     // Initialize variables
     // ******************
 
-    int b = 0;
-    int sum_b = 0;
-
     // Number of points in the cloud
     size_t N = original_points.size();
 
@@ -162,10 +163,22 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
     // Handle max_p = 0
     if (max_p < 1) max_p = static_cast<int>(N);
 
-    // Loop over batches
-    // *****************
+    // Start of each batch element
+    int num_batches = static_cast<int>(original_batches.size());
+    std::vector<int> batch_starts(num_batches + 1, 0);
+    std::partial_sum(original_batches.begin(), original_batches.end(),
+                     batch_starts.begin() + 1);
+
+    // Subsample the batch elements in parallel
+    // ****************************************
+
+    std::vector<std::vector<PointXYZ>> b_s_points(num_batches);
+    std::vector<std::vector<float>> b_s_features(num_batches);
+    std::vector<std::vector<int>> b_s_classes(num_batches);
+
+    tbb::parallel_for(0, num_batches, [&](int b) {
+        int sum_b = batch_starts[b];
 
-    for (b = 0; b < static_cast<int>(original_batches.size()); b++) {
         // Extract batch points features and labels
         std::vector<PointXYZ> b_o_points = std::vector<PointXYZ>(
                 original_points.begin() + sum_b,
@@ -181,60 +194,41 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
 
         std::vector<int> b_o_classes;
         if (original_classes.size() > 0) {
-            b_o_classes =
-                    std::vector<int>(original_classes.begin() + sum_b * ldim,
-                                     original_classes.begin() + sum_b +
-                                             original_batches[b] * ldim);
+            b_o_classes = std::vector<int>(
+                    original_classes.begin() + sum_b * ldim,
+                    original_classes.begin() +
+                            (sum_b + original_batches[b]) * ldim);
         }
 
-        // Create result containers
-        std::vector<PointXYZ> b_s_points;
-        std::vector<float> b_s_features;
-        std::vector<int> b_s_classes;
-
         // Compute subsampling on current batch
-        grid_subsampling(b_o_points, b_s_points, b_o_features, b_s_features,
-                         b_o_classes, b_s_classes, sampleDl, 0);
+        grid_subsampling(b_o_points, b_s_points[b], b_o_features,
+                         b_s_features[b], b_o_classes, b_s_classes[b],
+                         sampleDl, 0);
+    });
 
-        // Stack batches points features and labels
-        // ****************************************
+    // Stack batches points features and labels
+    // ****************************************
 
+    for (int b = 0; b < num_batches; b++) {
         // If too many points remove some
-        if (static_cast<int>(b_s_points.size()) <= max_p) {
-            subsampled_points.insert(subsampled_points.end(),
-                                     b_s_points.begin(), b_s_points.end());
-
-            if (original_features.size() > 0)
-                subsampled_features.insert(subsampled_features.end(),
-                                           b_s_features.begin(),
-                                           b_s_features.end());
-
-            if (original_classes.size() > 0)
-                subsampled_classes.insert(subsampled_classes.end(),
-                                          b_s_classes.begin(),
-                                          b_s_classes.end());
-
-            subsampled_batches.push_back(static_cast<int>(b_s_points.size()));
-        } else {
-            subsampled_points.insert(subsampled_points.end(),
-                                     b_s_points.begin(),
-                                     b_s_points.begin() + max_p);
-
-            if (original_features.size() > 0)
-                subsampled_features.insert(subsampled_features.end(),
-                                           b_s_features.begin(),
-                                           b_s_features.begin() + max_p * fdim);
-
-            if (original_classes.size() > 0)
-                subsampled_classes.insert(subsampled_classes.end(),
-                                          b_s_classes.begin(),
-                                          b_s_classes.begin() + max_p * ldim);
-
-            subsampled_batches.push_back(max_p);
-        }
+        int num_points =
+                std::min(static_cast<int>(b_s_points[b].size()), max_p);
+
+        subsampled_points.insert(subsampled_points.end(),
+                                 b_s_points[b].begin(),
+                                 b_s_points[b].begin() + num_points);
+
+        if (original_features.size() > 0)
+            subsampled_features.insert(
+                    subsampled_features.end(), b_s_features[b].begin(),
+                    b_s_features[b].begin() + num_points * fdim);
+
+        if (original_classes.size() > 0)
+            subsampled_classes.insert(
+                    subsampled_classes.end(), b_s_classes[b].begin(),
+                    b_s_classes[b].begin() + num_points * ldim);
 
-        // Stack new batch lengths
-        sum_b += original_batches[b];
+        subsampled_batches.push_back(num_points);
     }
 
     return;
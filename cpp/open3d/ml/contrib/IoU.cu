@@ -24,39 +24,92 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "open3d/ml/contrib/IoU.h"
 #include "open3d/ml/contrib/IoUImpl.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace ml {
 namespace contrib {
 
-static constexpr int block_size = 128;
-static constexpr int thread_size = 4;
+// Each block computes the IoU of a tile of boxes_a against a tile of boxes_b.
+// The boxes of both tiles are loaded once into the shared memory and reused
+// by all threads of the block instead of being fetched per pair.
+static constexpr int tile_size = 16;
+// Limit of gridDim.y. Larger num_a is handled with a grid-stride loop.
+static constexpr int max_grid_y = 65535;
+
+struct IoUBevOp {
+    static constexpr int box_dim = 5;
+    OPEN3D_DEVICE float operator()(const float *box_a,
+                                   const float *box_b) const {
+        return IoUBev2DWithCenterAndSize(box_a, box_b);
+    }
+};
+
+struct IoU3dOp {
+    static constexpr int box_dim = 7;
+    OPEN3D_DEVICE float operator()(const float *box_a,
+                                   const float *box_b) const {
+        return IoU3DWithCenterAndSize(box_a, box_b);
+    }
+};
 
-__global__ void IoUBevElementKernel(const float *boxes_a,
-                                    const float *boxes_b,
-                                    float *iou,
-                                    int num_a,
-                                    int num_b) {
-    // Using the "grid-stride loops" pattern.
-    int n = num_a * num_b;
-    int items_per_block = block_size * thread_size;
-    int idx = blockIdx.x * items_per_block + threadIdx.x;
-#pragma unroll
-    for (int i = 0; i < thread_size; i++) {
-        if (idx < n) {
-            int idx_a = idx / num_b;
-            int idx_b = idx % num_b;
+template <class TIoUOp>
+__global__ void IoUTiledKernel(const float *boxes_a,
+                               const float *boxes_b,
+                               float *iou,
+                               int num_a,
+                               int num_b) {
+    constexpr int box_dim = TIoUOp::box_dim;
+    constexpr int num_threads = tile_size * tile_size;
+    __shared__ float tile_a[tile_size * box_dim];
+    __shared__ float tile_b[tile_size * box_dim];
 
-            const float *box_a = boxes_a + idx_a * 5;
-            const float *box_b = boxes_b + idx_b * 5;
-            float *out = iou + idx_a * num_b + idx_b;
-            *out = IoUBev2DWithCenterAndSize(box_a, box_b);
+    const int thread_idx = threadIdx.y * tile_size + threadIdx.x;
+    const int b_begin = blockIdx.x * tile_size;
+    const int num_tile_b = min(num_b - b_begin, tile_size);
+    for (int i = thread_idx; i < num_tile_b * box_dim; i += num_threads) {
+        tile_b[i] = boxes_b[int64_t(b_begin) * box_dim + i];
+    }
 
-            idx += block_size;
+    const int idx_b = b_begin + threadIdx.x;
+    for (int a_begin = blockIdx.y * tile_size; a_begin < num_a;
+         a_begin += gridDim.y * tile_size) {
+        const int num_tile_a = min(num_a - a_begin, tile_size);
+        // Wait until all threads are done with the previous tile.
+        __syncthreads();
+        for (int i = thread_idx; i < num_tile_a * box_dim; i += num_threads) {
+            tile_a[i] = boxes_a[int64_t(a_begin) * box_dim + i];
         }
+        __syncthreads();
+
+        if (threadIdx.y < num_tile_a && threadIdx.x < num_tile_b) {
+            const int idx_a = a_begin + threadIdx.y;
+            // Consecutive threads write consecutive elements of a row.
+            iou[int64_t(idx_a) * num_b + idx_b] =
+                    TIoUOp()(tile_a + threadIdx.y * box_dim,
+                             tile_b + threadIdx.x * box_dim);
+        }
+    }
+}
+
+template <class TIoUOp>
+static void IoUTiledCUDAKernel(const float *boxes_a,
+                               const float *boxes_b,
+                               float *iou,
+                               int num_a,
+                               int num_b) {
+    if (num_a == 0 || num_b == 0) {
+        return;
     }
+    dim3 threads(tile_size, tile_size);
+    dim3 blocks(utility::DivUp(num_b, tile_size),
+                std::min(utility::DivUp(num_a, tile_size), max_grid_y));
+    IoUTiledKernel<TIoUOp>
+            <<<blocks, threads>>>(boxes_a, boxes_b, iou, num_a, num_b);
 }
 
 void IoUBevCUDAKernel(const float *boxes_a,
@@ -64,39 +117,7 @@ void IoUBevCUDAKernel(const float *boxes_a,
                       float *iou,
                       int num_a,
                       int num_b) {
-    int n = num_a * num_b;
-    if (n == 0) {
-        return;
-    }
-    int items_per_block = block_size * thread_size;
-    int grid_size = (n + items_per_block - 1) / items_per_block;
-    IoUBevElementKernel<<<grid_size, block_size>>>(boxes_a, boxes_b, iou, num_a,
-                                                   num_b);
-}
-
-__global__ void IoU3dElementKernel(const float *boxes_a,
-                                   const float *boxes_b,
-                                   float *iou,
-                                   int num_a,
-                                   int num_b) {
-    // Using the "grid-stride loops" pattern.
-    int n = num_a * num_b;
-    int items_per_block = block_size * thread_size;
-    int idx = blockIdx.x * items_per_block + threadIdx.x;
-#pragma unroll
-    for (int i = 0; i < thread_size; i++) {
-        if (idx < n) {
-            int idx_a = idx / num_b;
-            int idx_b = idx % num_b;
-
-            const float *box_a = boxes_a + idx_a * 7;
-            const float *box_b = boxes_b + idx_b * 7;
-            float *out = iou + idx_a * num_b + idx_b;
-            *out = IoU3DWithCenterAndSize(box_a, box_b);
-
-            idx += block_size;
-        }
-    }
+    IoUTiledCUDAKernel<IoUBevOp>(boxes_a, boxes_b, iou, num_a, num_b);
 }
 
 void IoU3dCUDAKernel(const float *boxes_a,
@@ -104,14 +125,7 @@ void IoU3dCUDAKernel(const float *boxes_a,
                      float *iou,
                      int num_a,
                      int num_b) {
-    int n = num_a * num_b;
-    if (n == 0) {
-        return;
-    }
-    int items_per_block = block_size * thread_size;
-    int grid_size = (n + items_per_block - 1) / items_per_block;
-    IoU3dElementKernel<<<grid_size, block_size>>>(boxes_a, boxes_b, iou, num_a,
-                                                  num_b);
+    IoUTiledCUDAKernel<IoU3dOp>(boxes_a, boxes_b, iou, num_a, num_b);
 }
 
 }  // namespace contrib
@@ -157,6 +157,22 @@ OPEN3D_HOST_DEVICE inline float BoxOverlap(const float *box_a,
     Point center_a((a_x1 + a_x2) / 2, (a_y1 + a_y2) / 2);
     Point center_b((b_x1 + b_x2) / 2, (b_y1 + b_y2) / 2);
 
+    // Early exit for far apart boxes. Rotated boxes never leave their
+    // circumscribed circle, so disjoint circles imply zero overlap. For dense
+    // proposals most pairs are rejected here without clipping polygons.
+    float a_diag_sqr = (a_x2 - a_x1) * (a_x2 - a_x1) +
+                       (a_y2 - a_y1) * (a_y2 - a_y1);
+    float b_diag_sqr = (b_x2 - b_x1) * (b_x2 - b_x1) +
+                       (b_y2 - b_y1) * (b_y2 - b_y1);
+    Point center_diff = center_a - center_b;
+    float center_dist_sqr = center_diff.x_ * center_diff.x_ +
+                            center_diff.y_ * center_diff.y_;
+    // Circumscribed radius of each box is half of its diagonal.
+    float radius_sum = 0.5f * (sqrtf(a_diag_sqr) + sqrtf(b_diag_sqr));
+    if (center_dist_sqr > radius_sum * radius_sum) {
+        return 0;
+    }
+
     Point box_a_corners[5];
     box_a_corners[0].set(a_x1, a_y1);
     box_a_corners[1].set(a_x2, a_y1);
@@ -37,6 +37,7 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 
@@ -69,6 +70,7 @@ static std::vector<int64_t> SortIndexes(const T *values,
 
 static void AllPairsSortedIoU(const float *boxes,
                               const float *scores,
+                              const int64_t *labels,
                               const int64_t *sort_indices,
                               uint64_t *mask,
                               int n,
@@ -84,8 +86,13 @@ static void AllPairsSortedIoU(const float *boxes,
             [&](const tbb::blocked_range<int> &r) {
                 for (int block_col_idx = r.begin(); block_col_idx != r.end();
                      ++block_col_idx) {
-                    for (int block_row_idx = 0; block_row_idx < num_block_rows;
-                         ++block_row_idx) {
+                    // Boxes are sorted by score and the keep loop only reads
+                    // mask[i, j] with j >= i / BS, so the blocks below the
+                    // diagonal are never used and can be skipped.
+                    const int num_used_block_rows =
+                            std::min(block_col_idx + 1, num_block_rows);
+                    for (int block_row_idx = 0;
+                         block_row_idx < num_used_block_rows; ++block_row_idx) {
                         // Local block row size.
                         const int row_size =
                                 fminf(n - block_row_idx * NMS_BLOCK_SIZE,
@@ -112,24 +119,32 @@ static void AllPairsSortedIoU(const float *boxes,
                              NMS_BLOCK_SIZE * block_row_idx + row_size;
                              src_idx++) {
                             uint64_t t = 0;
+                            const int64_t src_box = sort_indices[src_idx];
                             for (int dst_idx = NMS_BLOCK_SIZE * block_col_idx;
                                  dst_idx <
                                  NMS_BLOCK_SIZE * block_col_idx + col_size;
                                  dst_idx++) {
+                                const int64_t dst_box = sort_indices[dst_idx];
+                                // Boxes of different classes never suppress
+                                // each other.
+                                if (labels &&
+                                    labels[src_box] != labels[dst_box]) {
+                                    continue;
+                                }
                                 // Unlike the CUDA impl, both src_idx and
                                 // dst_idx here are indexes to the global
                                 // memory. Thus we need to compute the local
                                 // index for dst_idx.
-                                if (IoUBev2DWithMinAndMax(
-                                            boxes + sort_indices[src_idx] * 5,
-                                            boxes + sort_indices[dst_idx] * 5) >
+                                if (IoUBev2DWithMinAndMax(boxes + src_box * 5,
+                                                          boxes + dst_box * 5) >
                                     nms_overlap_thresh) {
                                     t |= 1ULL
                                          << (dst_idx -
                                              NMS_BLOCK_SIZE * block_col_idx);
                                 }
                             }
-                            mask[src_idx * num_block_cols + block_col_idx] = t;
+                            mask[int64_t(src_idx) * num_block_cols +
+                                 block_col_idx] = t;
                         }
                     }
                 }
@@ -139,7 +154,8 @@ static void AllPairsSortedIoU(const float *boxes,
 std::vector<int64_t> NmsCPUKernel(const float *boxes,
                                   const float *scores,
                                   int n,
-                                  double nms_overlap_thresh) {
+                                  double nms_overlap_thresh,
+                                  const int64_t *labels) {
     std::vector<int64_t> sort_indices = SortIndexes(scores, n, true);
 
     const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
@@ -147,9 +163,9 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
     // Call kernel. Results will be saved in masks.
     // boxes: (n, 5)
     // mask:  (n, n/BS)
-    std::vector<uint64_t> mask_vec(n * num_block_cols);
+    std::vector<uint64_t> mask_vec(int64_t(n) * num_block_cols);
     uint64_t *mask = mask_vec.data();
-    AllPairsSortedIoU(boxes, scores, sort_indices.data(), mask, n,
+    AllPairsSortedIoU(boxes, scores, labels, sort_indices.data(), mask, n,
                       nms_overlap_thresh);
 
     // Write to keep. remv_cpu has n bits in total. If the bit is 1, the
@@ -168,7 +184,7 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
             keep_indices.push_back(sort_indices[i]);
 
             // Any box that overlaps with the i-th box will be removed.
-            uint64_t *p = mask + i * num_block_cols;
+            uint64_t *p = mask + int64_t(i) * num_block_cols;
             for (int j = block_col_idx; j < num_block_cols; j++) {
                 remv_cpu[j] |= p[j];
             }
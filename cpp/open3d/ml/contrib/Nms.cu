@@ -71,6 +71,7 @@ static void SortIndices(T *values,
 }
 
 __global__ void NmsKernel(const float *boxes,
+                          const int64_t *labels,
                           const int64_t *sort_indices,
                           uint64_t *mask,
                           const int n,
@@ -81,6 +82,12 @@ __global__ void NmsKernel(const float *boxes,
     // Column-wise block index.
     const int block_col_idx = blockIdx.x;
 
+    // Boxes are sorted by score and the keep loop only reads mask[i, j] with
+    // j >= i / BS. The blocks below the diagonal are never used.
+    if (block_row_idx > block_col_idx) {
+        return;
+    }
+
     // Local block row size.
     const int row_size =
             fminf(n - block_row_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
@@ -90,10 +97,8 @@ __global__ void NmsKernel(const float *boxes,
 
     // Fill local block_boxes by fetching the global box memory.
     // block_boxes = boxes[NBS*block_col_idx : NBS*block_col_idx+col_size, :].
-    //
-    // TODO: It is also possible to load the comparison target to the shared
-    // memory as well.
     __shared__ float block_boxes[NMS_BLOCK_SIZE * 5];
+    __shared__ int64_t block_labels[NMS_BLOCK_SIZE];
     if (threadIdx.x < col_size) {
         float *dst = block_boxes + threadIdx.x * 5;
         const int src_idx = NMS_BLOCK_SIZE * block_col_idx + threadIdx.x;
@@ -103,6 +108,9 @@ __global__ void NmsKernel(const float *boxes,
         dst[2] = src[2];
         dst[3] = src[3];
         dst[4] = src[4];
+        if (labels) {
+            block_labels[threadIdx.x] = labels[sort_indices[src_idx]];
+        }
     }
     __syncthreads();
 
@@ -122,23 +130,34 @@ __global__ void NmsKernel(const float *boxes,
         // dst_idx indices the shared memory.
         int dst_idx = block_row_idx == block_col_idx ? threadIdx.x + 1 : 0;
 
+        // The src box is compared against all boxes of the block, keep it in
+        // registers instead of reading the global memory in every iteration.
+        const int64_t src_box_idx = sort_indices[src_idx];
+        float src_box[5];
+        for (int k = 0; k < 5; ++k) {
+            src_box[k] = boxes[src_box_idx * 5 + k];
+        }
+        const int64_t src_label = labels ? labels[src_box_idx] : 0;
+
         uint64_t t = 0;
         while (dst_idx < col_size) {
-            if (IoUBev2DWithMinAndMax(boxes + sort_indices[src_idx] * 5,
-                                      block_boxes + dst_idx * 5) >
-                nms_overlap_thresh) {
+            // Boxes of different classes never suppress each other.
+            if ((!labels || block_labels[dst_idx] == src_label) &&
+                IoUBev2DWithMinAndMax(src_box, block_boxes + dst_idx * 5) >
+                        nms_overlap_thresh) {
                 t |= 1ULL << dst_idx;
             }
             dst_idx++;
         }
-        mask[src_idx * num_block_cols + block_col_idx] = t;
+        mask[int64_t(src_idx) * num_block_cols + block_col_idx] = t;
     }
 }
 
 std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
-                                   double nms_overlap_thresh) {
+                                   double nms_overlap_thresh,
+                                   const int64_t *labels) {
     if (n == 0) {
         return {};
     }
@@ -158,22 +177,23 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
     OPEN3D_ML_CUDA_CHECK(cudaFree(scores_copy));
 
     // Allocate masks on device.
+    const int64_t mask_size = int64_t(n) * num_block_cols;
     uint64_t *mask_ptr = nullptr;
-    OPEN3D_ML_CUDA_CHECK(cudaMalloc((void **)&mask_ptr,
-                                    n * num_block_cols * sizeof(uint64_t)));
+    OPEN3D_ML_CUDA_CHECK(
+            cudaMalloc((void **)&mask_ptr, mask_size * sizeof(uint64_t)));
 
     // Launch kernel.
     dim3 blocks(utility::DivUp(n, NMS_BLOCK_SIZE),
                 utility::DivUp(n, NMS_BLOCK_SIZE));
     dim3 threads(NMS_BLOCK_SIZE);
-    NmsKernel<<<blocks, threads>>>(boxes, sort_indices, mask_ptr, n,
+    NmsKernel<<<blocks, threads>>>(boxes, labels, sort_indices, mask_ptr, n,
                                    nms_overlap_thresh, num_block_cols);
 
     // Copy cuda masks to cpu.
-    std::vector<uint64_t> mask_vec(n * num_block_cols);
+    std::vector<uint64_t> mask_vec(mask_size);
     uint64_t *mask = mask_vec.data();
     OPEN3D_ML_CUDA_CHECK(cudaMemcpy(mask_vec.data(), mask_ptr,
-                                    n * num_block_cols * sizeof(uint64_t),
+                                    mask_size * sizeof(uint64_t),
                                     cudaMemcpyDeviceToHost));
     OPEN3D_ML_CUDA_CHECK(cudaFree(mask_ptr));
 
@@ -202,7 +222,7 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
             keep_indices.push_back(sort_indices_cpu[i]);
 
             // Any box that overlaps with the i-th box will be removed.
-            uint64_t *p = mask + i * num_block_cols;
+            uint64_t *p = mask + int64_t(i) * num_block_cols;
             for (int j = block_col_idx; j < num_block_cols; j++) {
                 remv_cpu[j] |= p[j];
             }
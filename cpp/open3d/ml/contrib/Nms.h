@@ -49,11 +49,15 @@ namespace contrib {
 /// \param n Number of boxes.
 /// \param nms_overlap_thresh When a high-score box is selected, other remaining
 /// boxes with IoU > nms_overlap_thresh will be discarded.
+/// \param labels Optional (n,) int64 class labels. If given, only boxes with
+/// the same label suppress each other, i.e. NMS is done for all classes in a
+/// single call.
 /// \return Selected box indices to keep.
 std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
-                                   double nms_overlap_thresh);
+                                   double nms_overlap_thresh,
+                                   const int64_t *labels = nullptr);
 #endif
 
 /// \param boxes (n, 5) float32.
@@ -61,11 +65,15 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
 /// \param n Number of boxes.
 /// \param nms_overlap_thresh When a high-score box is selected, other remaining
 /// boxes with IoU > nms_overlap_thresh will be discarded.
+/// \param labels Optional (n,) int64 class labels. If given, only boxes with
+/// the same label suppress each other, i.e. NMS is done for all classes in a
+/// single call.
 /// \return Selected box indices to keep.
 std::vector<int64_t> NmsCPUKernel(const float *boxes,
                                   const float *scores,
                                   int n,
-                                  double nms_overlap_thresh);
+                                  double nms_overlap_thresh,
+                                  const int64_t *labels = nullptr);
 
 }  // namespace contrib
 }  // namespace ml
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cub/cub.cuh>
+
+#include "open3d/ml/contrib/cuda_utils.h"
+
 namespace open3d {
 namespace ml {
 namespace contrib {
@@ -136,6 +140,110 @@ __global__ void furthest_point_sampling_kernel(
     }
 }
 
+// The kernel above uses a single block per batch item and is limited by the
+// serial loop over the m samples when n is large. The kernels below split
+// the points of an item over many blocks and launch one grid per sample.
+// The furthest point of a step is found with an atomicMax on a 64-bit key
+// with the distance in the high and the inverted point index in the low 32
+// bits. Distances are non-negative, so their bit patterns order like the
+// values, and ties are resolved to the smallest index.
+
+/// Number of points per batch item from which the multi-block kernels are
+/// faster than furthest_point_sampling_kernel.
+constexpr int FPS_MULTI_BLOCK_MIN_POINTS = 16384;
+
+static __device__ inline int __key_to_index(unsigned long long key) {
+    return int(~static_cast<unsigned int>(key));
+}
+
+template <unsigned int block_size>
+__global__ void furthest_point_sampling_step_kernel(
+        int b,
+        int n,
+        int m,
+        int j,
+        const float *__restrict__ dataset,
+        float *__restrict__ temp,
+        unsigned long long *__restrict__ best,
+        int *__restrict__ idxs) {
+    // dataset: (B, N, 3)
+    // tmp: (B, N)
+    // best: (B, M), key of the furthest point of each step
+    // output:
+    //      idx: (B, M)
+
+    int batch_index = blockIdx.y;
+    dataset += batch_index * n * 3;
+    temp += batch_index * n;
+    best += batch_index * m;
+    idxs += batch_index * m;
+
+    // The previous step selected the point to add now.
+    int old = j == 1 ? 0 : __key_to_index(best[j - 1]);
+    if (blockIdx.x == 0 && threadIdx.x == 0) idxs[j - 1] = old;
+
+    float x1 = dataset[old * 3 + 0];
+    float y1 = dataset[old * 3 + 1];
+    float z1 = dataset[old * 3 + 2];
+    unsigned long long key = 0;
+    for (int k = blockIdx.x * block_size + threadIdx.x; k < n;
+         k += gridDim.x * block_size) {
+        float x2 = dataset[k * 3 + 0];
+        float y2 = dataset[k * 3 + 1];
+        float z2 = dataset[k * 3 + 2];
+        float d = (x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1) +
+                  (z2 - z1) * (z2 - z1);
+        float d2 = min(d, temp[k]);
+        temp[k] = d2;
+        unsigned long long k_key =
+                (static_cast<unsigned long long>(__float_as_uint(d2)) << 32) |
+                ~static_cast<unsigned int>(k);
+        key = max(key, k_key);
+    }
+
+    typedef cub::BlockReduce<unsigned long long, block_size> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    key = BlockReduce(temp_storage).Reduce(key, cub::Max());
+    if (threadIdx.x == 0) atomicMax(best + j, key);
+}
+
+__global__ void furthest_point_sampling_last_kernel(
+        int b,
+        int m,
+        const unsigned long long *__restrict__ best,
+        int *__restrict__ idxs) {
+    int batch_index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (batch_index >= b) return;
+    idxs[batch_index * m + m - 1] =
+            m == 1 ? 0 : __key_to_index(best[batch_index * m + m - 1]);
+}
+
+/// Furthest point sampling with multiple blocks per batch item.
+/// \param best Temporary buffer of shape (B, M).
+inline void furthest_point_sampling_multi_block(cudaStream_t stream,
+                                                int b,
+                                                int n,
+                                                int m,
+                                                const float *dataset,
+                                                float *temp,
+                                                unsigned long long *best,
+                                                int *idxs) {
+    if (m <= 0) return;
+    constexpr int block_size = 512;
+    constexpr int points_per_thread = 8;
+    cudaMemsetAsync(best, 0, sizeof(unsigned long long) * b * m, stream);
+
+    dim3 blocks(DIVUP(n, block_size * points_per_thread), b);
+    for (int j = 1; j < m; j++) {
+        furthest_point_sampling_step_kernel<block_size>
+                <<<blocks, block_size, 0, stream>>>(b, n, m, j, dataset, temp,
+                                                    best, idxs);
+    }
+    furthest_point_sampling_last_kernel<<<DIVUP(b, THREADS_PER_BLOCK),
+                                          THREADS_PER_BLOCK, 0, stream>>>(
+            b, m, best, idxs);
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -109,35 +109,19 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
     }
     int64_t num_batches = query_batches.GetShape()[0];
 
-    // Check consistentency of batch sizes with total number of points.
-    if (query_batches.Sum({0}).Item<int32_t>() != query_points.GetShape()[0]) {
-        utility::LogError(
-                "query_batches is not consistent with query_points: {} != {}.",
-                query_batches.Sum({0}).Item<int32_t>(),
-                query_points.GetShape()[0]);
-    }
-    if (dataset_batches.Sum({0}).Item<int32_t>() !=
-        dataset_points.GetShape()[0]) {
-        utility::LogError(
-                "dataset_batches is not consistent with dataset_points: {} != "
-                "{}.",
-                dataset_batches.Sum({0}).Item<int32_t>(),
-                dataset_points.GetShape()[0]);
-    }
-    int64_t num_query_points = query_points.GetShape()[0];
-
-    // Call radius search for each batch.
-    std::vector<core::Tensor> batched_indices(num_batches);
-    std::vector<core::Tensor> batched_num_neighbors(num_batches);
+    // The batch sizes are needed on the host to slice the points, which may
+    // live on a CUDA device.
+    const core::Device host("CPU:0");
+    core::Tensor query_batches_host = query_batches.To(host).Contiguous();
+    core::Tensor dataset_batches_host = dataset_batches.To(host).Contiguous();
 
     // Calculate prefix-sum.
     std::vector<int32_t> query_prefix_indices(num_batches + 1, 0);
     std::vector<int32_t> dataset_prefix_indices(num_batches + 1, 0);
 
-    const int32_t* query_batch_flat =
-            static_cast<const int32_t*>(query_batches.GetDataPtr());
+    const int32_t* query_batch_flat = query_batches_host.GetDataPtr<int32_t>();
     const int32_t* dataset_batch_flat =
-            static_cast<const int32_t*>(dataset_batches.GetDataPtr());
+            dataset_batches_host.GetDataPtr<int32_t>();
 
     // TODO: implement Cumsum function in Tensor.
     std::partial_sum(query_batch_flat, query_batch_flat + num_batches,
@@ -145,7 +129,26 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
     std::partial_sum(dataset_batch_flat, dataset_batch_flat + num_batches,
                      dataset_prefix_indices.data() + 1);
 
-    // Parallelization is applied point-wise in NanoFlannIndex.
+    // Check consistentency of batch sizes with total number of points.
+    if (query_prefix_indices[num_batches] != query_points.GetShape()[0]) {
+        utility::LogError(
+                "query_batches is not consistent with query_points: {} != {}.",
+                query_prefix_indices[num_batches], query_points.GetShape()[0]);
+    }
+    if (dataset_prefix_indices[num_batches] != dataset_points.GetShape()[0]) {
+        utility::LogError(
+                "dataset_batches is not consistent with dataset_points: {} != "
+                "{}.",
+                dataset_prefix_indices[num_batches],
+                dataset_points.GetShape()[0]);
+    }
+    int64_t num_query_points = query_points.GetShape()[0];
+
+    // Call radius search for each batch. The search runs on the device of
+    // the points and is parallelized point-wise.
+    std::vector<core::Tensor> batched_indices(num_batches);
+    std::vector<core::Tensor> batched_row_splits(num_batches);
+    int64_t max_num_neighbors = 0;
     for (int64_t batch_idx = 0; batch_idx < num_batches; ++batch_idx) {
         core::Tensor current_query_points =
                 query_points.Slice(0, query_prefix_indices[batch_idx],
@@ -157,64 +160,51 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
 
         // Call radius search.
         core::nns::NearestNeighborSearch nns(current_dataset_points);
-        nns.FixedRadiusIndex();
+        nns.FixedRadiusIndex(radius);
         core::Tensor indices;
         core::Tensor distances;
         core::Tensor neighbors_row_splits;
         std::tie(indices, distances, neighbors_row_splits) =
                 nns.FixedRadiusSearch(current_query_points, radius);
-        batched_indices[batch_idx] = indices;
-        int64_t current_num_query_points = current_query_points.GetShape()[0];
-        core::Tensor num_neighbors =
-                neighbors_row_splits.Slice(0, 1, current_num_query_points + 1)
-                        .Sub(neighbors_row_splits.Slice(
-                                0, 0, current_num_query_points));
-        batched_num_neighbors[batch_idx] = num_neighbors;
-    }
-
-    // Find global maximum number of neighbors.
-    int64_t max_num_neighbors = 0;
-    for (const auto& num_neighbors : batched_num_neighbors) {
-        max_num_neighbors = std::max(num_neighbors.Max({0}).Item<int64_t>(),
-                                     max_num_neighbors);
+        batched_indices[batch_idx] =
+                indices.To(host, core::Dtype::Int64).Contiguous();
+        batched_row_splits[batch_idx] =
+                neighbors_row_splits.To(host, core::Dtype::Int64).Contiguous();
+
+        // Find global maximum number of neighbors.
+        const int64_t* row_splits =
+                batched_row_splits[batch_idx].GetDataPtr<int64_t>();
+        for (int32_t i = 0; i < query_batch_flat[batch_idx]; ++i) {
+            max_num_neighbors = std::max(row_splits[i + 1] - row_splits[i],
+                                         max_num_neighbors);
+        }
     }
 
     // Convert to the required output format. Pad with -1.
-    core::Tensor result = core::Tensor::Full(
-            {num_query_points, max_num_neighbors}, -1, core::Dtype::Int64);
+    std::vector<int32_t> result(num_query_points * max_num_neighbors, -1);
 
-#pragma omp parallel for schedule(static)
     for (int64_t batch_idx = 0; batch_idx < num_batches; ++batch_idx) {
-        int32_t result_start_idx = query_prefix_indices[batch_idx];
-        int32_t result_end_idx = query_prefix_indices[batch_idx + 1];
-
-        core::Tensor indices = batched_indices[batch_idx].Add(
-                dataset_prefix_indices[batch_idx]);
-        core::Tensor num_neighbors = batched_num_neighbors[batch_idx];
-
-        // Sanity check.
-        int64_t batch_size =
-                result_end_idx - result_start_idx;  // Exclusive result_end_idx.
-        if (num_neighbors.GetShape()[0] != batch_size) {
-            utility::LogError(
-                    "Sanity check failed, batch_id {}: {} != batchsize {}.",
-                    batch_idx, num_neighbors.GetShape()[0], batch_size);
-        }
+        const int64_t* indices =
+                batched_indices[batch_idx].GetDataPtr<int64_t>();
+        const int64_t* row_splits =
+                batched_row_splits[batch_idx].GetDataPtr<int64_t>();
+        const int32_t result_start_idx = query_prefix_indices[batch_idx];
+        const int32_t dataset_start_idx = dataset_prefix_indices[batch_idx];
 
-        int64_t indices_start_idx = 0;
-        for (int64_t i = 0; i < batch_size; i++) {
-            int64_t num_neighbor = num_neighbors[i].Item<int64_t>();
-            core::Tensor result_slice = result.Slice(0, result_start_idx + i,
-                                                     result_start_idx + i + 1)
-                                                .Slice(1, 0, num_neighbor);
-            core::Tensor indices_slice = indices.Slice(
-                    0, indices_start_idx, indices_start_idx + num_neighbor);
-            result_slice.AsRvalue() = indices_slice.View({1, num_neighbor});
-            indices_start_idx += num_neighbor;
+#pragma omp parallel for schedule(static)
+        for (int32_t i = 0; i < query_batch_flat[batch_idx]; ++i) {
+            int32_t* result_row =
+                    result.data() + (result_start_idx + i) * max_num_neighbors;
+            for (int64_t j = row_splits[i]; j < row_splits[i + 1]; ++j) {
+                result_row[j - row_splits[i]] =
+                        int32_t(indices[j] + dataset_start_idx);
+            }
         }
     }
 
-    return result.To(core::Dtype::Int32);
+    return core::Tensor(result, {num_query_points, max_num_neighbors},
+                        core::Dtype::Int32)
+            .To(query_points.GetDevice());
 }
 }  // namespace contrib
 }  // namespace ml
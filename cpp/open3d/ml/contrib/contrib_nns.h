@@ -54,7 +54,8 @@ const core::Tensor KnnSearch(const core::Tensor& query_points,
 /// \return Tensor of shape {n_query_points, max_neighbor}, dtype Int32, where
 /// max_neighbor is the maximum number neighbor of neighbors for all query
 /// points. For query points with less than max_neighbor neighbors, the neighbor
-/// index will be padded by -1.
+/// index will be padded by -1. The points may be on a CPU or CUDA device and
+/// the result is on the same device.
 const core::Tensor RadiusSearch(const core::Tensor& query_points,
                                 const core::Tensor& dataset_points,
                                 const core::Tensor& query_batches,
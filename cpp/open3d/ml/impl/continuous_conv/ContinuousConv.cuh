@@ -28,10 +28,8 @@
 
 #define EIGEN_USE_GPU
 
-#include <cutlass/gemm/gemm.h>
-#include <cutlass/gemm/sgemm_traits.h>
-
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
+#include "open3d/ml/impl/continuous_conv/ContinuousConvGemm.cuh"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/Helper.h"
 
@@ -43,8 +41,18 @@ namespace impl {
 
 /// Computes the output features of a continuous convolution.
 ///
+/// If the temporary memory can hold the column matrix for at least 32
+/// output points the features are computed with FillColumn and a GEMM.
+/// Otherwise the fused kernel CConvFusedFeatures is used, which does not
+/// materialize the column matrix. Passing only the minimum \p temp_size
+/// therefore selects the fused kernel.
+///
 /// All pointer arguments point to device memory unless stated otherwise.
 ///
+/// \tparam TFeat    The type of the filter and the features. For half the
+///         column matrix and the accumulators use TReal and the GEMMs use
+///         tensor cores if CConvUseTensorCores returns true.
+///
 /// \param temp    Pointer to temporary memory. If nullptr then the required
 ///        size of temporary memory will be written to \p temp_size and no
 ///        work is done. This function can make use of more memory and
@@ -52,7 +60,7 @@ namespace impl {
 ///
 /// \param temp_size    The size of the temporary memory in bytes. This is
 ///        used as an output if temp is nullptr and returns the minimum temp
-///        size required.
+///        size required, which is only a few bytes for the fused kernel.
 ///
 /// \param max_temp_size    This is used as an output if temp is nullptr and
 ///        returns the maximum temp size that can be used.
@@ -127,20 +135,20 @@ namespace impl {
 ///        number of points (neighbors_importance is null) or by the sum of
 ///        the respective values in neighbors_importance.
 ///
-template <class TReal, class TIndex>
+template <class TReal, class TIndex, class TFeat = TReal>
 void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
                               void* temp,
                               size_t& temp_size,
                               size_t& max_temp_size,
                               int texture_alignment,
-                              TReal* out_features,
+                              TFeat* out_features,
                               const std::vector<int>& filter_dims,
-                              const TReal* filter,
+                              const TFeat* filter,
                               TIndex num_out,
                               const TReal* out_positions,
                               TIndex num_inp,
                               const TReal* inp_positions,
-                              const TReal* inp_features,
+                              const TFeat* inp_features,
                               const TReal* inp_importance,
                               size_t neighbors_index_size,
                               const TIndex* neighbors_index,
@@ -168,19 +176,35 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
 
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
+    const int column_size = spatial_filter_size * in_channels;
+
+    // half features need float buffers for the GEMM results and either a
+    // half copy of the columns for the tensor cores or a float copy of the
+    // filter.
+    const bool mixed_precision = !std::is_same<TFeat, TReal>::value;
+    const bool use_tensor_cores =
+            mixed_precision && CConvUseTensorCores(out_channels, column_size);
+    const size_t fixed_bytes = mixed_precision && !use_tensor_cores
+                                       ? sizeof(TReal) * column_size *
+                                                 out_channels
+                                       : 0;
 
     // this defines how much temporary storage we need at least.
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
     const size_t max_num_cols_per_run = num_out;
-    const size_t bytes_per_column =
-            sizeof(TReal) * (spatial_filter_size * in_channels);
-    const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
-    const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
+    size_t bytes_per_column = sizeof(TReal) * column_size;
+    if (mixed_precision) bytes_per_column += sizeof(TReal) * out_channels;
+    if (use_tensor_cores) bytes_per_column += sizeof(half) * column_size;
+    const size_t min_temp_size_bytes =
+            fixed_bytes + min_num_cols_per_run * bytes_per_column;
+    const size_t max_temp_size_bytes =
+            fixed_bytes + max_num_cols_per_run * bytes_per_column;
 
     if (get_temp_size) {
-        std::pair<char*, size_t> tmp =
-                mem_temp.Alloc<char>(min_temp_size_bytes);
+        // the fused kernel needs no temporary memory but temp must not be
+        // null to distinguish the calls.
+        std::pair<char*, size_t> tmp = mem_temp.Alloc<char>(1);
         temp_size = mem_temp.MaxUsed();
         mem_temp.Free(tmp);
         mem_temp.Alloc<char>(max_temp_size_bytes);
@@ -192,31 +216,38 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
     std::pair<void*, size_t> mem_columns = mem_temp.AllocLargestSegment();
 
     if (mem_columns.second < min_temp_size_bytes) {
-        std::stringstream ss;
-        ss << "temp is too small " << mem_columns.second
-           << " bytes. Expected at least " << min_temp_size_bytes << " bytes\n";
-        throw std::runtime_error(ss.str());
+        // not enough memory for the column matrix
+        CConvFusedFeatures<TReal, TIndex, TFeat>(
+                stream, out_features, in_channels, out_channels, filter,
+                num_out, out_positions, inp_positions, inp_features,
+                inp_importance, neighbors_index, neighbors_importance,
+                neighbors_row_splits, extents, offsets, filter_dims,
+                interpolation, coordinate_mapping, align_corners,
+                individual_extent, isotropic_extent, normalize);
+        return;
     }
 
-    // init output
-    cudaMemsetAsync(out_features, 0, sizeof(TReal) * num_out * out_channels,
-                    stream);
-
     size_t num_cols_per_run =
-            std::min(mem_columns.second / bytes_per_column, size_t(num_out));
-
-    typedef cutlass::gemm::SgemmTraits<
-            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix (filter)
-            cutlass::MatrixLayout::kColumnMajor,  // layout of B matrix
-                                                  // (columns)
-            cutlass::Shape<8, 64, 64>             // threadblock tile size
-            >
-            GemmTraits;
-
-    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
+            std::min((mem_columns.second - fixed_bytes) / bytes_per_column,
+                     size_t(num_out));
 
+    // partition the temporary memory. All buffers have sizes which are
+    // multiples of 8 elements if tensor cores are used.
+    CConvGemmTemp gemm_temp;
+    char* temp_ptr = (char*)mem_columns.first;
+    if (fixed_bytes) {
+        gemm_temp.A = (float*)temp_ptr;
+        temp_ptr += fixed_bytes;
+    }
     // this is the pointer to the patch matrix
-    TReal* columns = (TReal*)mem_columns.first;
+    TReal* columns = (TReal*)temp_ptr;
+    temp_ptr += sizeof(TReal) * num_cols_per_run * column_size;
+    TReal* accumulator = nullptr;
+    if (mixed_precision) {
+        accumulator = (TReal*)temp_ptr;
+        temp_ptr += sizeof(TReal) * num_cols_per_run * out_channels;
+    }
+    if (use_tensor_cores) gemm_temp.columns = (half*)temp_ptr;
 
     // if we cannot process all data at once we need multiple runs
     const size_t num_runs = DivUp(num_out, num_cols_per_run);
@@ -227,7 +258,7 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
         const size_t num_cols_this_run = end_idx - begin_idx;
 
         // compute the patch matrix
-        FillColumn<TReal, TIndex>(
+        FillColumn<TReal, TIndex, TFeat>(
                 stream, columns, in_channels, begin_idx, end_idx, num_out,
                 out_positions, num_inp, inp_positions, inp_features,
                 inp_importance, neighbors_index_size, neighbors_index,
@@ -238,39 +269,18 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
         // C is MxN
         // B is KxN
         // A is MxK
-        int m = out_channels;
-        int k = spatial_filter_size * in_channels;
-        int n = num_cols_this_run;
-        float alpha = 1;
-        const float* const A = filter;
-        int lda = m;
-        const float* const B = columns;
-        int ldb = k;
-        float beta = 1;
-        float* C = out_features + (run_i * num_cols_per_run * out_channels);
-        int ldc = m;
-
-        typename Gemm::Params params;
-        int result = params.initialize(m,      // GEMM M dimension
-                                       n,      // GEMM N dimension
-                                       k,      // GEMM K dimension
-                                       alpha,  // scalar alpha
-                                       A,      // matrix A operand
-                                       lda,
-                                       B,  // matrix B operand
-                                       ldb,
-                                       beta,  // scalar beta
-                                       C,     // source matrix C
-                                       ldc,
-                                       C,  // destination matrix C
-                                       ldc);
+        TFeat* out_features_run =
+                out_features + (run_i * num_cols_per_run * out_channels);
+        TReal* C = CConvAccumulator(out_features_run, accumulator);
+        cudaMemsetAsync(C, 0, sizeof(TReal) * num_cols_this_run * out_channels,
+                        stream);
 
-        if (result) {
-            throw std::runtime_error(
-                    "Failed to initialize CUTLASS Gemm::Params object.");
-        }
+        CConvGemm<cutlass::MatrixLayout::kColumnMajor>(
+                stream, out_channels, num_cols_this_run, column_size, filter,
+                columns, C, gemm_temp);
 
-        Gemm::launch(params, stream);
+        CConvStoreAccumulator(stream, num_cols_this_run * out_channels,
+                              out_features_run, C);
     }
 }
 
@@ -27,10 +27,8 @@
 #pragma once
 #define EIGEN_USE_GPU
 
-#include <cutlass/gemm/gemm.h>
-#include <cutlass/gemm/sgemm_traits.h>
-
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
+#include "open3d/ml/impl/continuous_conv/ContinuousConvGemm.cuh"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/Helper.h"
 
@@ -44,6 +42,9 @@ namespace impl {
 ///
 /// All pointer arguments point to device memory unless stated otherwise.
 ///
+/// \tparam TFeat    The type of the filter backprop, the features and the
+///         gradient. For half the filter backprop is accumulated with TReal.
+///
 /// \param temp    Pointer to temporary memory. If nullptr then the required
 ///        size of temporary memory will be written to \p temp_size and no
 ///        work is done. This function can make use of more memory and
@@ -124,19 +125,19 @@ namespace impl {
 ///        by the number of points (neighbors_importance is null) or by the sum
 ///        of the respective values in neighbors_importance.
 ///
-template <class TReal, class TIndex>
+template <class TReal, class TIndex, class TFeat = TReal>
 void CConvBackpropFilterCUDA(const cudaStream_t& stream,
                              void* temp,
                              size_t& temp_size,
                              size_t& max_temp_size,
                              int texture_alignment,
-                             TReal* filter_backprop,
+                             TFeat* filter_backprop,
                              const std::vector<int>& filter_dims,
                              TIndex num_out,
                              const TReal* out_positions,
                              TIndex num_inp,
                              const TReal* inp_positions,
-                             const TReal* inp_features,
+                             const TFeat* inp_features,
                              const TReal* inp_importance,
                              size_t neighbors_index_size,
                              const TIndex* neighbors_index,
@@ -144,7 +145,7 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
                              const int64_t* neighbors_row_splits,
                              const TReal* extents,
                              const TReal* offsets,
-                             const TReal* out_features_gradient,
+                             const TFeat* out_features_gradient,
                              InterpolationMode interpolation,
                              CoordinateMapping coordinate_mapping,
                              bool align_corners,
@@ -165,15 +166,31 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
 
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
+    const int column_size = spatial_filter_size * in_channels;
+    const size_t filter_size = size_t(column_size) * out_channels;
+
+    // half features need a float buffer for accumulating the filter backprop
+    // and either a half copy of the columns for the tensor cores or a float
+    // copy of the gradient.
+    const bool mixed_precision = !std::is_same<TFeat, TReal>::value;
+    const bool use_tensor_cores =
+            mixed_precision && CConvUseTensorCores(out_channels, column_size);
+    const size_t fixed_bytes =
+            mixed_precision ? sizeof(TReal) * filter_size : 0;
 
     // this defines how much temporary storage we need at least
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
     const size_t max_num_cols_per_run = num_out;
-    const size_t bytes_per_column =
-            sizeof(TReal) * (spatial_filter_size * in_channels);
-    const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
-    const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
+    size_t bytes_per_column = sizeof(TReal) * column_size;
+    if (use_tensor_cores)
+        bytes_per_column += sizeof(half) * column_size;
+    else if (mixed_precision)
+        bytes_per_column += sizeof(TReal) * out_channels;
+    const size_t min_temp_size_bytes =
+            fixed_bytes + min_num_cols_per_run * bytes_per_column;
+    const size_t max_temp_size_bytes =
+            fixed_bytes + max_num_cols_per_run * bytes_per_column;
 
     if (get_temp_size) {
         std::pair<char*, size_t> tmp =
@@ -195,25 +212,29 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
         throw std::runtime_error(ss.str());
     }
 
-    // init output
-    cudaMemsetAsync(
-            filter_backprop, 0,
-            sizeof(TReal) * spatial_filter_size * in_channels * out_channels,
-            stream);
-
     size_t num_cols_per_run =
-            std::min(mem_columns.second / bytes_per_column, size_t(num_out));
-
-    typedef cutlass::gemm::SgemmTraits<
-            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
-            cutlass::MatrixLayout::kRowMajor,     // layout of B matrix
-            cutlass::Shape<8, 64, 64>             // threadblock tile size
-            >
-            GemmTraits;
+            std::min((mem_columns.second - fixed_bytes) / bytes_per_column,
+                     size_t(num_out));
 
-    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
+    // partition the temporary memory. All buffers have sizes which are
+    // multiples of 8 elements if tensor cores are used.
+    CConvGemmTemp gemm_temp;
+    char* temp_ptr = (char*)mem_columns.first;
+    TReal* accumulator = nullptr;
+    if (mixed_precision) {
+        accumulator = (TReal*)temp_ptr;
+        temp_ptr += fixed_bytes;
+    }
+    TReal* columns = (TReal*)temp_ptr;
+    temp_ptr += sizeof(TReal) * num_cols_per_run * column_size;
+    if (use_tensor_cores)
+        gemm_temp.columns = (half*)temp_ptr;
+    else if (mixed_precision)
+        gemm_temp.A = (float*)temp_ptr;
 
-    TReal* columns = (TReal*)mem_columns.first;
+    // init output
+    TReal* C = CConvAccumulator(filter_backprop, accumulator);
+    cudaMemsetAsync(C, 0, sizeof(TReal) * filter_size, stream);
 
     // if we cannot process all data at once we need multiple runs
     size_t num_runs = DivUp(num_out, num_cols_per_run);
@@ -223,7 +244,7 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
                 std::min(size_t(num_out), (run_i + 1) * num_cols_per_run);
         const size_t num_cols_this_run = end_idx - begin_idx;
 
-        FillColumn<TReal, TIndex>(
+        FillColumn<TReal, TIndex, TFeat>(
                 stream, columns, in_channels, begin_idx, end_idx, num_out,
                 out_positions, num_inp, inp_positions, inp_features,
                 inp_importance, neighbors_index_size, neighbors_index,
@@ -231,44 +252,18 @@ void CConvBackpropFilterCUDA(const cudaStream_t& stream,
                 filter_dims, interpolation, coordinate_mapping, align_corners,
                 individual_extent, isotropic_extent, normalize);
 
-        typename Gemm::Params params;
         // C is MxN
         // B is KxN
         // A is MxK
-        int m = out_channels;
-        int k = num_cols_this_run;
-        int n = spatial_filter_size * in_channels;
-        float alpha = 1;
-        const float* const A = out_features_gradient +
+        const TFeat* const A = out_features_gradient +
                                (run_i * num_cols_per_run * out_channels);
-        int lda = m;
-        const float* const B = columns;
-        int ldb = n;
-        float beta = 1;
-        float* C = filter_backprop;
-        int ldc = m;
-
-        int result = params.initialize(m,      // GEMM M dimension
-                                       n,      // GEMM N dimension
-                                       k,      // GEMM K dimension
-                                       alpha,  // scalar alpha
-                                       A,      // matrix A operand
-                                       lda,
-                                       B,  // matrix B operand
-                                       ldb,
-                                       beta,  // scalar beta
-                                       C,     // source matrix C
-                                       ldc,
-                                       C,  // destination matrix C
-                                       ldc);
-
-        if (result) {
-            throw std::runtime_error(
-                    "Failed to initialize CUTLASS Gemm::Params object.");
-        }
-
-        Gemm::launch(params, stream);
+        CConvGemm<cutlass::MatrixLayout::kRowMajor>(stream, out_channels,
+                                                    column_size,
+                                                    num_cols_this_run, A,
+                                                    columns, C, gemm_temp);
     }
+
+    CConvStoreAccumulator(stream, filter_size, filter_backprop, C);
 }
 
 }  // namespace impl
@@ -36,6 +36,7 @@ namespace impl {
 /// Kernel for FillColumn
 template <class TReal,
           class TIndex,
+          class TFeat,
           bool ALIGN_CORNERS,
           CoordinateMapping MAPPING,
           InterpolationMode INTERPOLATION>
@@ -48,7 +49,7 @@ __global__ void FillColumnKernel(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         const TReal* const __restrict__ inp_importance,
         size_t neighbors_index_size,
         const TIndex* const __restrict__ neighbors_index,
@@ -151,7 +152,8 @@ __global__ void FillColumnKernel(
         if (NORMALIZE && normalizer != 0) importance /= normalizer;
 
         for (int ic = threadIdx.x; ic < in_channels; ic += blockDim.x) {
-            infeat = importance * inp_features[inp_idx * in_channels + ic];
+            infeat = importance *
+                     TReal(inp_features[inp_idx * in_channels + ic]);
             for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
                 TReal value = interp_weights[j] * infeat;
                 out_column[interp_indices[j] * in_channels + ic] += value;
@@ -160,7 +162,7 @@ __global__ void FillColumnKernel(
     }  // for n
 }
 
-template <class TReal, class TIndex>
+template <class TReal, class TIndex, class TFeat>
 void FillColumn(const cudaStream_t& stream,
                 TReal* columns,
                 int in_channels,
@@ -170,7 +172,7 @@ void FillColumn(const cudaStream_t& stream,
                 const TReal* const __restrict__ out_positions,
                 TIndex num_inp,
                 const TReal* const __restrict__ inp_positions,
-                const TReal* const __restrict__ inp_features,
+                const TFeat* const __restrict__ inp_features,
                 const TReal* const __restrict__ inp_importance,
                 size_t neighbors_index_size,
                 const TIndex* const __restrict__ neighbors_index,
@@ -212,7 +214,8 @@ void FillColumn(const cudaStream_t& stream,
 #define CALL_TEMPLATE(INTERPOLATION, MAPPING, ALIGN_CORNERS)                   \
     if (INTERPOLATION == interpolation && MAPPING == coordinate_mapping &&     \
         ALIGN_CORNERS == align_corners)                                        \
-        FillColumnKernel<TReal, TIndex, ALIGN_CORNERS, MAPPING, INTERPOLATION> \
+        FillColumnKernel<TReal, TIndex, TFeat, ALIGN_CORNERS, MAPPING,         \
+                         INTERPOLATION>                                        \
                 <<<grid, block, 0, stream>>>(FN_PARAMETERS);
 
 #define CALL_TEMPLATE2(INTERPOLATION, MAPPING)  \
@@ -269,8 +272,340 @@ template void FillColumn<float, int32_t>(
         bool isotropic_extent,
         bool normalize);
 
+template void FillColumn<float, int32_t, half>(
+        const cudaStream_t& stream,
+        float* columns,
+        int in_channels,
+        int32_t begin_idx,
+        int32_t end_idx,
+        int32_t num_out,
+        const float* const __restrict__ out_positions,
+        int32_t num_inp,
+        const float* const __restrict__ inp_positions,
+        const half* const __restrict__ inp_features,
+        const float* const __restrict__ inp_importance,
+        size_t neighbors_index_size,
+        const int32_t* const __restrict__ neighbors_index,
+        const float* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const float* const __restrict__ extents,
+        const float* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize);
+
+/// Kernel for CConvFusedFeatures. Each block computes the output features of
+/// one output point. The threads of the block prepare a tile of neighbors
+/// with their filter indices and interpolation weights in shared memory and
+/// then accumulate the products with the filter for a range of output
+/// channels in registers.
+template <class TReal,
+          class TIndex,
+          class TFeat,
+          bool ALIGN_CORNERS,
+          CoordinateMapping MAPPING,
+          InterpolationMode INTERPOLATION>
+__global__ void CConvFusedFeaturesKernel(
+        TFeat* __restrict__ out_features,
+        int in_channels,
+        int out_channels,
+        const TFeat* const __restrict__ filter,
+        TIndex num_out,
+        const TReal* const __restrict__ out_positions,
+        const TReal* const __restrict__ inp_positions,
+        const TFeat* const __restrict__ inp_features,
+        const TReal* const __restrict__ inp_importance,
+        const TIndex* const __restrict__ neighbors_index,
+        const TReal* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const TReal* const __restrict__ extents,
+        const TReal* const __restrict__ offsets,
+        int filter_size_x,
+        int filter_size_y,
+        int filter_size_z,
+        bool INDIVIDUAL_EXTENT,
+        bool ISOTROPIC_EXTENT,
+        bool NORMALIZE,
+        bool POINT_IMPORTANCE,
+        bool NEIGHBOR_IMPORTANCE) {
+    TIndex out_idx = blockIdx.x;
+    if (out_idx >= num_out) return;
+    const int NUM_INTERP_VALUES =
+            (INTERPOLATION == InterpolationMode::LINEAR ||
+                             INTERPOLATION == InterpolationMode::LINEAR_BORDER
+                     ? 8
+                     : 1);
+    __shared__ TReal tile_weights[CCONV_FUSED_NEIGHBOR_TILE][NUM_INTERP_VALUES];
+    __shared__ int tile_filter_indices[CCONV_FUSED_NEIGHBOR_TILE]
+                                      [NUM_INTERP_VALUES];
+    __shared__ TIndex tile_inp_indices[CCONV_FUSED_NEIGHBOR_TILE];
+
+    TReal offset[3] = {offsets[0], offsets[1], offsets[2]};
+
+    const int64_t neighbor_start = neighbors_row_splits[out_idx];
+    const int64_t neighbor_end = neighbors_row_splits[out_idx + 1];
+
+    TReal out_pos[3] = {out_positions[out_idx * 3 + 0],
+                        out_positions[out_idx * 3 + 1],
+                        out_positions[out_idx * 3 + 2]};
+
+    TReal inv_extents[3];
+    if (INDIVIDUAL_EXTENT) {
+        if (ISOTROPIC_EXTENT) {
+            inv_extents[0] = TReal(1) / extents[out_idx];
+            inv_extents[1] = inv_extents[0];
+            inv_extents[2] = inv_extents[0];
+        } else {
+            inv_extents[0] = TReal(1) / extents[3 * out_idx + 0];
+            inv_extents[1] = TReal(1) / extents[3 * out_idx + 1];
+            inv_extents[2] = TReal(1) / extents[3 * out_idx + 2];
+        }
+    } else {
+        if (ISOTROPIC_EXTENT) {
+            inv_extents[0] = TReal(1) / extents[0];
+            inv_extents[1] = inv_extents[0];
+            inv_extents[2] = inv_extents[0];
+        } else {
+            inv_extents[0] = TReal(1) / extents[0];
+            inv_extents[1] = TReal(1) / extents[1];
+            inv_extents[2] = TReal(1) / extents[2];
+        }
+    }
+
+    TReal normalizer = TReal(0);
+    if (NORMALIZE) {
+        if (NEIGHBOR_IMPORTANCE) {
+            for (int64_t n_idx = neighbor_start + threadIdx.x;
+                 n_idx < neighbor_end; n_idx += blockDim.x) {
+                TReal n_importance = neighbors_importance[n_idx];
+                normalizer += n_importance;
+            }
+            unsigned int mask = __activemask();
+            for (int offset = blockDim.x / 2; offset > 0; offset /= 2)
+                normalizer += __shfl_down_sync(mask, normalizer, offset);
+            normalizer = __shfl_sync(mask, normalizer, 0);
+        } else {
+            int64_t num_neighbors = neighbor_end - neighbor_start;
+            normalizer = num_neighbors;
+        }
+    }
+
+    const int out_channels_per_pass =
+            CCONV_FUSED_BLOCKSIZE * CCONV_FUSED_CHANNELS_PER_THREAD;
+    for (int oc_start = 0; oc_start < out_channels;
+         oc_start += out_channels_per_pass) {
+        TReal accum[CCONV_FUSED_CHANNELS_PER_THREAD];
+        for (int c = 0; c < CCONV_FUSED_CHANNELS_PER_THREAD; ++c)
+            accum[c] = TReal(0);
+
+        for (int64_t tile_start = neighbor_start; tile_start < neighbor_end;
+             tile_start += CCONV_FUSED_NEIGHBOR_TILE) {
+            const int tile_size =
+                    neighbor_end - tile_start < CCONV_FUSED_NEIGHBOR_TILE
+                            ? int(neighbor_end - tile_start)
+                            : CCONV_FUSED_NEIGHBOR_TILE;
+            __syncthreads();
+            // each thread prepares one neighbor of the tile
+            for (int t = threadIdx.x; t < tile_size; t += blockDim.x) {
+                const int64_t n_idx = tile_start + t;
+                const TIndex inp_idx = neighbors_index[n_idx];
+
+                TReal x, y, z;
+                x = inp_positions[inp_idx * 3 + 0] - out_pos[0];
+                y = inp_positions[inp_idx * 3 + 1] - out_pos[1];
+                z = inp_positions[inp_idx * 3 + 2] - out_pos[2];
+
+                ComputeFilterCoordinates<ALIGN_CORNERS, MAPPING>(
+                        x, y, z, filter_size_x, filter_size_y, filter_size_z,
+                        inv_extents[0], inv_extents[1], inv_extents[2],
+                        offset[0], offset[1], offset[2]);
+                TReal interp_weights[NUM_INTERP_VALUES];
+                int interp_indices[NUM_INTERP_VALUES];
+                Interpolate<INTERPOLATION>(interp_weights, interp_indices, x,
+                                           y, z, filter_size_x, filter_size_y,
+                                           filter_size_z);
+
+                TReal importance = 1;
+                if (POINT_IMPORTANCE) importance = inp_importance[inp_idx];
+                if (NEIGHBOR_IMPORTANCE)
+                    importance *= neighbors_importance[n_idx];
+                if (NORMALIZE && normalizer != 0) importance /= normalizer;
+
+                for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
+                    tile_weights[t][j] = importance * interp_weights[j];
+                    tile_filter_indices[t][j] = interp_indices[j];
+                }
+                tile_inp_indices[t] = inp_idx;
+            }
+            __syncthreads();
+
+            for (int t = 0; t < tile_size; ++t) {
+                const TFeat* const inp_feat =
+                        inp_features +
+                        size_t(tile_inp_indices[t]) * in_channels;
+                for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
+                    const TReal weight = tile_weights[t][j];
+                    // the weight is the same for all threads of the block
+                    if (weight == TReal(0)) continue;
+                    const TFeat* const filter_j =
+                            filter + size_t(tile_filter_indices[t][j]) *
+                                             in_channels * out_channels;
+                    for (int ic = 0; ic < in_channels; ++ic) {
+                        const TReal value = weight * TReal(inp_feat[ic]);
+                        const TFeat* const filter_ic =
+                                filter_j + size_t(ic) * out_channels;
+                        for (int c = 0; c < CCONV_FUSED_CHANNELS_PER_THREAD;
+                             ++c) {
+                            const int oc = oc_start +
+                                           c * CCONV_FUSED_BLOCKSIZE +
+                                           threadIdx.x;
+                            if (oc < out_channels)
+                                accum[c] += value * TReal(filter_ic[oc]);
+                        }
+                    }
+                }
+            }
+        }  // for tile
+
+        for (int c = 0; c < CCONV_FUSED_CHANNELS_PER_THREAD; ++c) {
+            const int oc = oc_start + c * CCONV_FUSED_BLOCKSIZE + threadIdx.x;
+            if (oc < out_channels)
+                out_features[size_t(out_idx) * out_channels + oc] =
+                        TFeat(accum[c]);
+        }
+    }
+}
+
+template <class TReal, class TIndex, class TFeat>
+void CConvFusedFeatures(const cudaStream_t& stream,
+                        TFeat* out_features,
+                        int in_channels,
+                        int out_channels,
+                        const TFeat* const __restrict__ filter,
+                        TIndex num_out,
+                        const TReal* const __restrict__ out_positions,
+                        const TReal* const __restrict__ inp_positions,
+                        const TFeat* const __restrict__ inp_features,
+                        const TReal* const __restrict__ inp_importance,
+                        const TIndex* const __restrict__ neighbors_index,
+                        const TReal* const __restrict__ neighbors_importance,
+                        const int64_t* const __restrict__ neighbors_row_splits,
+                        const TReal* const __restrict__ extents,
+                        const TReal* const __restrict__ offsets,
+                        const std::vector<int>& filter_dims,
+                        InterpolationMode interpolation,
+                        CoordinateMapping coordinate_mapping,
+                        bool align_corners,
+                        bool individual_extent,
+                        bool isotropic_extent,
+                        bool normalize) {
+    const int filter_size_z = filter_dims[0];
+    const int filter_size_y = filter_dims[1];
+    const int filter_size_x = filter_dims[2];
+
+    // the block size must be the warp size for the normalizer reduction
+    const int BLOCKSIZE = CCONV_FUSED_BLOCKSIZE;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = num_out;
+
+#define FN_PARAMETERS                                                        \
+    out_features, in_channels, out_channels, filter, num_out, out_positions, \
+            inp_positions, inp_features, inp_importance, neighbors_index,    \
+            neighbors_importance, neighbors_row_splits, extents, offsets,    \
+            filter_size_x, filter_size_y, filter_size_z, individual_extent,  \
+            isotropic_extent, normalize, inp_importance != nullptr,          \
+            neighbors_importance != nullptr
+
+#define CALL_TEMPLATE(INTERPOLATION, MAPPING, ALIGN_CORNERS)               \
+    if (INTERPOLATION == interpolation && MAPPING == coordinate_mapping && \
+        ALIGN_CORNERS == align_corners)                                    \
+        CConvFusedFeaturesKernel<TReal, TIndex, TFeat, ALIGN_CORNERS,      \
+                                 MAPPING, INTERPOLATION>                   \
+                <<<grid, block, 0, stream>>>(FN_PARAMETERS);
+
+#define CALL_TEMPLATE2(INTERPOLATION, MAPPING)  \
+    CALL_TEMPLATE(INTERPOLATION, MAPPING, true) \
+    CALL_TEMPLATE(INTERPOLATION, MAPPING, false)
+
+#define CALL_TEMPLATE3(INTERPOLATION)                                     \
+    CALL_TEMPLATE2(INTERPOLATION, CoordinateMapping::BALL_TO_CUBE_RADIAL) \
+    CALL_TEMPLATE2(INTERPOLATION,                                         \
+                   CoordinateMapping::BALL_TO_CUBE_VOLUME_PRESERVING)     \
+    CALL_TEMPLATE2(INTERPOLATION, CoordinateMapping::IDENTITY)
+
+#define CALL_TEMPLATE4                               \
+    CALL_TEMPLATE3(InterpolationMode::LINEAR)        \
+    CALL_TEMPLATE3(InterpolationMode::LINEAR_BORDER) \
+    CALL_TEMPLATE3(InterpolationMode::NEAREST_NEIGHBOR)
+
+    if (grid.x) {
+        CALL_TEMPLATE4
+    }
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+#undef CALL_TEMPLATE3
+#undef CALL_TEMPLATE4
+
+#undef FN_PARAMETERS
+}
+
+template void CConvFusedFeatures<float, int32_t>(
+        const cudaStream_t& stream,
+        float* out_features,
+        int in_channels,
+        int out_channels,
+        const float* const __restrict__ filter,
+        int32_t num_out,
+        const float* const __restrict__ out_positions,
+        const float* const __restrict__ inp_positions,
+        const float* const __restrict__ inp_features,
+        const float* const __restrict__ inp_importance,
+        const int32_t* const __restrict__ neighbors_index,
+        const float* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const float* const __restrict__ extents,
+        const float* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize);
+
+template void CConvFusedFeatures<float, int32_t, half>(
+        const cudaStream_t& stream,
+        half* out_features,
+        int in_channels,
+        int out_channels,
+        const half* const __restrict__ filter,
+        int32_t num_out,
+        const float* const __restrict__ out_positions,
+        const float* const __restrict__ inp_positions,
+        const half* const __restrict__ inp_features,
+        const float* const __restrict__ inp_importance,
+        const int32_t* const __restrict__ neighbors_index,
+        const float* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const float* const __restrict__ extents,
+        const float* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize);
+
 template <class TReal,
           class TIndex,
+          class TFeat,
           bool ALIGN_CORNERS,
           CoordinateMapping MAPPING,
           InterpolationMode INTERPOLATION>
@@ -283,7 +618,7 @@ __global__ void FillColumnTransposeKernel(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         size_t neighbors_index_size,
         const TIndex* const __restrict__ neighbors_index,
         const TReal* const __restrict__ inp_neighbors_importance_sum,
@@ -383,7 +718,7 @@ __global__ void FillColumnTransposeKernel(
 
         TReal infeat = 0;
         for (int ic = threadIdx.x; ic < in_channels; ic += blockDim.x) {
-            infeat = inp_features[inp_idx * in_channels + ic];
+            infeat = TReal(inp_features[inp_idx * in_channels + ic]);
             if (NEIGHBOR_IMPORTANCE) infeat *= neighbors_importance[n_idx];
             if (NORMALIZE) infeat *= num_inp_neighbors_normalizer;
             for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
@@ -394,7 +729,7 @@ __global__ void FillColumnTransposeKernel(
     }  // for n
 }
 
-template <class TReal, class TIndex>
+template <class TReal, class TIndex, class TFeat>
 void FillColumnTranspose(
         const cudaStream_t& stream,
         TReal* columns,
@@ -405,7 +740,7 @@ void FillColumnTranspose(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         const TReal* const __restrict__ inp_neighbors_importance_sum,
         const int64_t* const __restrict__ inp_neighbors_prefix_sum,
         size_t neighbors_index_size,
@@ -450,8 +785,8 @@ void FillColumnTranspose(
 #define CALL_TEMPLATE(INTERPOLATION, MAPPING, ALIGN_CORNERS)               \
     if (INTERPOLATION == interpolation && MAPPING == coordinate_mapping && \
         ALIGN_CORNERS == align_corners)                                    \
-        FillColumnTransposeKernel<TReal, TIndex, ALIGN_CORNERS, MAPPING,   \
-                                  INTERPOLATION>                           \
+        FillColumnTransposeKernel<TReal, TIndex, TFeat, ALIGN_CORNERS,     \
+                                  MAPPING, INTERPOLATION>                  \
                 <<<grid, block, 0, stream>>>(FN_PARAMETERS);
 
 #define CALL_TEMPLATE2(INTERPOLATION, MAPPING)  \
@@ -509,78 +844,106 @@ template void FillColumnTranspose<float, int32_t>(
         bool isotropic_extent,
         bool normalize);
 
-template <class T>
+template void FillColumnTranspose<float, int32_t, half>(
+        const cudaStream_t& stream,
+        float* columns,
+        int in_channels,
+        int32_t begin_idx,
+        int32_t end_idx,
+        int32_t num_out,
+        const float* const __restrict__ out_positions,
+        int32_t num_inp,
+        const float* const __restrict__ inp_positions,
+        const half* const __restrict__ inp_features,
+        const float* const __restrict__ inp_neighbors_importance_sum,
+        const int64_t* const __restrict__ inp_neighbors_prefix_sum,
+        size_t neighbors_index_size,
+        const int32_t* const __restrict__ neighbors_index,
+        const float* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const float* const __restrict__ extents,
+        const float* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize);
+
+template <class T, class TScale>
 __global__ void MultiplyColumnsKernel(size_t rows,
                                       size_t cols,
                                       T* __restrict__ col_major_matrix,
-                                      const T* const __restrict__ vector) {
+                                      const TScale* const __restrict__ vector) {
     size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (idx >= rows * cols) return;
 
     size_t col = idx / rows;
 
-    T factor = vector[col];
-    col_major_matrix[idx] *= factor;
+    TScale factor = vector[col];
+    col_major_matrix[idx] = T(TScale(col_major_matrix[idx]) * factor);
 }
 
-template <class T>
+template <class T, class TScale>
 void MultiplyColumns(const cudaStream_t& stream,
                      size_t rows,
                      size_t cols,
                      T* __restrict__ col_major_matrix,
-                     const T* const __restrict__ vector) {
+                     const TScale* const __restrict__ vector) {
     const int BLOCKSIZE = 128;
     dim3 block(BLOCKSIZE, 1, 1);
     dim3 grid(0, 1, 1);
     grid.x = DivUp(rows * cols, BLOCKSIZE);
 
     if (grid.x) {
-        MultiplyColumnsKernel<T><<<grid, block, 0, stream>>>(
+        MultiplyColumnsKernel<T, TScale><<<grid, block, 0, stream>>>(
                 rows, cols, col_major_matrix, vector);
     }
 }
 
-template void MultiplyColumns<float>(const cudaStream_t& stream,
-                                     size_t rows,
-                                     size_t cols,
-                                     float* __restrict__ col_major_matrix,
-                                     const float* const __restrict__ vector);
+template void MultiplyColumns<float, float>(
+        const cudaStream_t& stream,
+        size_t rows,
+        size_t cols,
+        float* __restrict__ col_major_matrix,
+        const float* const __restrict__ vector);
 
-template <class T>
+template <class T, class TScale>
 __global__ void MultiplyAndCopyColumnsKernel(
         size_t rows,
         size_t cols,
         T* __restrict__ out_ptr,
         const T* const __restrict__ col_major_matrix,
-        const T* const __restrict__ vector) {
+        const TScale* const __restrict__ vector) {
     size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (idx >= rows * cols) return;
 
     size_t col = idx / rows;
 
-    T factor = vector[col];
-    out_ptr[idx] = col_major_matrix[idx] * factor;
+    TScale factor = vector[col];
+    out_ptr[idx] = T(TScale(col_major_matrix[idx]) * factor);
 }
 
-template <class T>
+template <class T, class TScale>
 void MultiplyAndCopyColumns(const cudaStream_t& stream,
                             size_t rows,
                             size_t cols,
                             T* __restrict__ out_ptr,
                             const T* const __restrict__ col_major_matrix,
-                            const T* const __restrict__ vector) {
+                            const TScale* const __restrict__ vector) {
     const int BLOCKSIZE = 128;
     dim3 block(BLOCKSIZE, 1, 1);
     dim3 grid(0, 1, 1);
     grid.x = DivUp(rows * cols, BLOCKSIZE);
 
     if (grid.x) {
-        MultiplyAndCopyColumnsKernel<T><<<grid, block, 0, stream>>>(
+        MultiplyAndCopyColumnsKernel<T, TScale><<<grid, block, 0, stream>>>(
                 rows, cols, out_ptr, col_major_matrix, vector);
     }
 }
 
-template void MultiplyAndCopyColumns<float>(
+template void MultiplyAndCopyColumns<float, float>(
         const cudaStream_t& stream,
         size_t rows,
         size_t cols,
@@ -588,6 +951,52 @@ template void MultiplyAndCopyColumns<float>(
         const float* const __restrict__ col_major_matrix,
         const float* const __restrict__ vector);
 
+template void MultiplyAndCopyColumns<half, float>(
+        const cudaStream_t& stream,
+        size_t rows,
+        size_t cols,
+        half* __restrict__ out_ptr,
+        const half* const __restrict__ col_major_matrix,
+        const float* const __restrict__ vector);
+
+template <class TOut, class TIn>
+__global__ void ConvertArrayKernel(size_t size,
+                                   TOut* __restrict__ out_ptr,
+                                   const TIn* const __restrict__ inp_ptr) {
+    size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= size) return;
+
+    out_ptr[idx] = TOut(inp_ptr[idx]);
+}
+
+template <class TOut, class TIn>
+void ConvertArray(const cudaStream_t& stream,
+                  size_t size,
+                  TOut* __restrict__ out_ptr,
+                  const TIn* const __restrict__ inp_ptr) {
+    const int BLOCKSIZE = 128;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = DivUp(size, BLOCKSIZE);
+
+    if (grid.x) {
+        ConvertArrayKernel<TOut, TIn>
+                <<<grid, block, 0, stream>>>(size, out_ptr, inp_ptr);
+    }
+}
+
+template void ConvertArray<half, float>(
+        const cudaStream_t& stream,
+        size_t size,
+        half* __restrict__ out_ptr,
+        const float* const __restrict__ inp_ptr);
+
+template void ConvertArray<float, half>(
+        const cudaStream_t& stream,
+        size_t size,
+        float* __restrict__ out_ptr,
+        const half* const __restrict__ inp_ptr);
+
 }  // namespace impl
 }  // namespace ml
 }  // namespace open3d
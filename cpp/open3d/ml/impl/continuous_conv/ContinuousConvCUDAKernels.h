@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <cuda_fp16.h>
+
 #include <vector>
 
 #include "open3d/ml/impl/continuous_conv/CoordinateTransformation.cuh"
@@ -37,8 +39,10 @@ namespace impl {
 /// Copies and transforms the features to a column, which can be multiplied
 /// with the filter matrix.
 ///
-/// \tparam TReal    Type for positions and features.
+/// \tparam TReal    Type for positions and the column matrix.
 /// \tparam TIndex    Type for addressing neighbors.
+/// \tparam TFeat    Type for the input features. This can be half while
+///         the column matrix is accumulated with TReal.
 ///
 /// \param columns    Output array with shape
 //         [num_out, spatial filter dims, in_channels].
@@ -110,7 +114,7 @@ namespace impl {
 ///        number of points (neighbors_importance is null) or by the sum of
 ///        the respective values in neighbors_importance.
 ///
-template <class TReal, class TIndex>
+template <class TReal, class TIndex, class TFeat = TReal>
 void FillColumn(const cudaStream_t& stream,
                 TReal* columns,
                 int in_channels,
@@ -120,7 +124,7 @@ void FillColumn(const cudaStream_t& stream,
                 const TReal* const __restrict__ out_positions,
                 TIndex num_inp,
                 const TReal* const __restrict__ inp_positions,
-                const TReal* const __restrict__ inp_features,
+                const TFeat* const __restrict__ inp_features,
                 const TReal* const __restrict__ inp_importance,
                 size_t neighbors_index_size,
                 const TIndex* const __restrict__ neighbors_index,
@@ -136,7 +140,70 @@ void FillColumn(const cudaStream_t& stream,
                 bool isotropic_extent,
                 bool normalize);
 
-template <class TReal, class TIndex>
+/// Number of threads per output point for CConvFusedFeatures. This must be
+/// the warp size.
+constexpr int CCONV_FUSED_BLOCKSIZE = 32;
+
+/// Number of neighbors for which the filter indices and interpolation weights
+/// are staged in shared memory at once by CConvFusedFeatures.
+constexpr int CCONV_FUSED_NEIGHBOR_TILE = 32;
+
+/// Number of output channels accumulated in registers by each thread of
+/// CConvFusedFeatures. Filters with more than
+/// CCONV_FUSED_BLOCKSIZE*CCONV_FUSED_CHANNELS_PER_THREAD output channels
+/// are processed in multiple passes.
+constexpr int CCONV_FUSED_CHANNELS_PER_THREAD = 4;
+
+/// Computes the output features of a continuous convolution without the
+/// intermediate column matrix used by FillColumn and the subsequent GEMM.
+/// The interpolated input features are multiplied with the filter and
+/// accumulated in registers. This needs no temporary memory but is slower
+/// than the GEMM for large numbers of channels.
+///
+/// Each output point is processed by a block of CCONV_FUSED_BLOCKSIZE
+/// threads. The neighbors are processed in tiles of
+/// CCONV_FUSED_NEIGHBOR_TILE and each thread accumulates up to
+/// CCONV_FUSED_CHANNELS_PER_THREAD output channels per pass.
+///
+/// \tparam TFeat    Type for the filter and the input and output features.
+///         The products are accumulated with TReal.
+///
+/// \param out_features    Output array for the computed features with shape
+///        [num_out, out channels]. The array will be overwritten.
+///
+/// \param in_channels    Number of input channels.
+///
+/// \param out_channels    Number of output channels.
+///
+/// \param filter    Pointer to the filter values.
+///
+/// See FillColumn for the description of the remaining parameters.
+///
+template <class TReal, class TIndex, class TFeat = TReal>
+void CConvFusedFeatures(const cudaStream_t& stream,
+                        TFeat* out_features,
+                        int in_channels,
+                        int out_channels,
+                        const TFeat* const __restrict__ filter,
+                        TIndex num_out,
+                        const TReal* const __restrict__ out_positions,
+                        const TReal* const __restrict__ inp_positions,
+                        const TFeat* const __restrict__ inp_features,
+                        const TReal* const __restrict__ inp_importance,
+                        const TIndex* const __restrict__ neighbors_index,
+                        const TReal* const __restrict__ neighbors_importance,
+                        const int64_t* const __restrict__ neighbors_row_splits,
+                        const TReal* const __restrict__ extents,
+                        const TReal* const __restrict__ offsets,
+                        const std::vector<int>& filter_dims,
+                        InterpolationMode interpolation,
+                        CoordinateMapping coordinate_mapping,
+                        bool align_corners,
+                        bool individual_extent,
+                        bool isotropic_extent,
+                        bool normalize);
+
+template <class TReal, class TIndex, class TFeat = TReal>
 void FillColumnTranspose(
         const cudaStream_t& stream,
         TReal* columns,
@@ -147,7 +214,7 @@ void FillColumnTranspose(
         const TReal* const __restrict__ out_positions,
         TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
-        const TReal* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_features,
         const TReal* const __restrict__ inp_neighbors_importance_sum,
         const int64_t* const __restrict__ inp_neighbors_prefix_sum,
         size_t neighbors_index_size,
@@ -171,12 +238,12 @@ void FillColumnTranspose(
 ///
 /// \param vector    A vector with shape [cols].
 ///
-template <class T>
+template <class T, class TScale>
 void MultiplyColumns(const cudaStream_t& stream,
                      size_t rows,
                      size_t cols,
                      T* __restrict__ col_major_matrix,
-                     const T* const __restrict__ vector);
+                     const TScale* const __restrict__ vector);
 
 /// Multiplies each column with a scalar.
 ///
@@ -187,13 +254,27 @@ void MultiplyColumns(const cudaStream_t& stream,
 ///
 /// \param vector    A vector with shape [cols].
 ///
-template <class T>
+template <class T, class TScale>
 void MultiplyAndCopyColumns(const cudaStream_t& stream,
                             size_t rows,
                             size_t cols,
                             T* __restrict__ out_ptr,
                             const T* const __restrict__ col_major_matrix,
-                            const T* const __restrict__ vector);
+                            const TScale* const __restrict__ vector);
+
+/// Converts the elements of an array to another type, e.g. float to half.
+///
+/// \param size    The number of elements.
+///
+/// \param out_ptr    Output array with \p size elements.
+///
+/// \param inp_ptr    Input array with \p size elements.
+///
+template <class TOut, class TIn>
+void ConvertArray(const cudaStream_t& stream,
+                  size_t size,
+                  TOut* __restrict__ out_ptr,
+                  const TIn* const __restrict__ inp_ptr);
 
 }  // namespace impl
 }  // namespace ml
@@ -0,0 +1,204 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cuda_fp16.h>
+#include <cutlass/gemm/gemm.h>
+#include <cutlass/gemm/sgemm_traits.h>
+#include <cutlass/wmma_matrix.h>
+#ifdef CUTLASS_USE_WMMA_API
+#include <cutlass/gemm/wmma_gemm_traits.h>
+#endif
+
+#include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+/// Temporary buffers used by CConvGemm for half precision operands.
+struct CConvGemmTemp {
+    /// Buffer for a half copy of the column matrix with the same number of
+    /// elements. Used if tensor cores are available.
+    half* columns = nullptr;
+    /// Buffer for a float copy of the A matrix. Used if tensor cores are not
+    /// available.
+    float* A = nullptr;
+};
+
+/// Returns true if the GEMMs of a continuous convolution with half
+/// precision features can use tensor cores on the current device.
+/// Tensor cores need compute capability 7.0 and the leading dimensions of
+/// all matrices must be multiples of 8.
+///
+/// \param out_channels    The number of output channels.
+///
+/// \param column_size    The size of a column which is the spatial filter
+///        size times the number of input channels.
+///
+inline bool CConvUseTensorCores(int out_channels, int column_size) {
+#ifdef CUTLASS_USE_WMMA_API
+    if (out_channels % 8 || column_size % 8) return false;
+    int device = 0;
+    int major = 0;
+    if (cudaGetDevice(&device) != cudaSuccess ||
+        cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor,
+                               device) != cudaSuccess) {
+        return false;
+    }
+    return major >= 7;
+#else
+    return false;
+#endif
+}
+
+/// Launches the CUTLASS GEMM C = A*B + C for column major A and C.
+template <class GemmTraits>
+void CConvLaunchGemm(const cudaStream_t& stream,
+                     int m,
+                     int n,
+                     int k,
+                     const typename GemmTraits::ScalarA* A,
+                     int lda,
+                     const typename GemmTraits::ScalarB* B,
+                     int ldb,
+                     float* C,
+                     int ldc) {
+    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
+
+    typename Gemm::Params params;
+    int result = params.initialize(m,    // GEMM M dimension
+                                   n,    // GEMM N dimension
+                                   k,    // GEMM K dimension
+                                   1.f,  // scalar alpha
+                                   A,    // matrix A operand
+                                   lda,
+                                   B,  // matrix B operand
+                                   ldb,
+                                   1.f,  // scalar beta
+                                   C,    // source matrix C
+                                   ldc,
+                                   C,  // destination matrix C
+                                   ldc);
+
+    if (result) {
+        throw std::runtime_error(
+                "Failed to initialize CUTLASS Gemm::Params object.");
+    }
+
+    Gemm::launch(params, stream);
+}
+
+/// Computes C = A*B + C with float accumulation.
+///
+/// \tparam kLayoutB    The layout of B. The leading dimension is k for
+///         column major and n for row major layout.
+///
+/// \param A    Column major matrix with shape [m, k].
+///
+/// \param B    The column matrix with shape [k, n].
+///
+/// \param C    Column major matrix with shape [m, n].
+///
+/// \param temp    Temporary buffers. Not used for float A.
+///
+template <cutlass::MatrixLayout::Kind kLayoutB>
+void CConvGemm(const cudaStream_t& stream,
+               int m,
+               int n,
+               int k,
+               const float* A,
+               const float* B,
+               float* C,
+               const CConvGemmTemp& temp) {
+    typedef cutlass::gemm::SgemmTraits<
+            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
+            kLayoutB,                             // layout of B matrix
+            cutlass::Shape<8, 64, 64>             // threadblock tile size
+            >
+            GemmTraits;
+
+    const int ldb = kLayoutB == cutlass::MatrixLayout::kColumnMajor ? k : n;
+    CConvLaunchGemm<GemmTraits>(stream, m, n, k, A, m, B, ldb, C, m);
+}
+
+/// Computes C = A*B + C for a half precision A with float accumulation.
+/// If temp.columns is set then B is converted to half and the product is
+/// computed with tensor cores. Otherwise A is converted to float and the
+/// SGEMM is used.
+template <cutlass::MatrixLayout::Kind kLayoutB>
+void CConvGemm(const cudaStream_t& stream,
+               int m,
+               int n,
+               int k,
+               const half* A,
+               const float* B,
+               float* C,
+               const CConvGemmTemp& temp) {
+#ifdef CUTLASS_USE_WMMA_API
+    if (temp.columns) {
+        // the default traits use half for A and B and float for C and the
+        // accumulators
+        typedef cutlass::gemm::WmmaGemmTraits<
+                cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
+                kLayoutB                              // layout of B matrix
+                >
+                GemmTraits;
+
+        ConvertArray(stream, size_t(k) * n, temp.columns, B);
+        const int ldb =
+                kLayoutB == cutlass::MatrixLayout::kColumnMajor ? k : n;
+        CConvLaunchGemm<GemmTraits>(stream, m, n, k, A, m, temp.columns, ldb,
+                                    C, m);
+        return;
+    }
+#endif
+    ConvertArray(stream, size_t(m) * k, temp.A, A);
+    CConvGemm<kLayoutB>(stream, m, n, k, temp.A, B, C, temp);
+}
+
+/// Returns the matrix which accumulates the GEMM results for \p out.
+/// This is \p out itself for float and the float buffer \p acc for half.
+inline float* CConvAccumulator(float* out, float* acc) { return out; }
+inline float* CConvAccumulator(half* out, float* acc) { return acc; }
+
+/// Stores the accumulated GEMM results in \p out. This is a no-op for float
+/// since the results are already in \p out.
+inline void CConvStoreAccumulator(const cudaStream_t& stream,
+                                  size_t size,
+                                  float* out,
+                                  const float* acc) {}
+inline void CConvStoreAccumulator(const cudaStream_t& stream,
+                                  size_t size,
+                                  half* out,
+                                  const float* acc) {
+    ConvertArray(stream, size, out, acc);
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
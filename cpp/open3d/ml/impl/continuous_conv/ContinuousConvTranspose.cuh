@@ -27,10 +27,8 @@
 #pragma once
 #define EIGEN_USE_GPU
 
-#include <cutlass/gemm/gemm.h>
-#include <cutlass/gemm/sgemm_traits.h>
-
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
+#include "open3d/ml/impl/continuous_conv/ContinuousConvGemm.cuh"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/Helper.h"
 
@@ -40,22 +38,22 @@ namespace open3d {
 namespace ml {
 namespace impl {
 
-template <class TReal, class TIndex>
+template <class TReal, class TIndex, class TFeat = TReal>
 void CConvTransposeComputeFeaturesCUDA(
         const cudaStream_t& stream,
         void* temp,
         size_t& temp_size,
         size_t& max_temp_size,
         int texture_alignment,
-        TReal* out_features,
+        TFeat* out_features,
         const std::vector<int>& filter_dims,
-        const TReal* filter,
+        const TFeat* filter,
         TIndex num_out,
         const TReal* out_positions,
         const TReal* out_importance,
         TIndex num_inp,
         const TReal* inp_positions,
-        const TReal* inp_features,
+        const TFeat* inp_features,
         const TReal* inp_neighbors_importance_sum,
         const int64_t* inp_neighbors_prefix_sum,
         size_t neighbors_index_size,
@@ -84,15 +82,30 @@ void CConvTransposeComputeFeaturesCUDA(
 
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
+    const int column_size = spatial_filter_size * in_channels;
+
+    // half features need float buffers for the GEMM results and either a
+    // half copy of the columns for the tensor cores or a float copy of the
+    // filter.
+    const bool mixed_precision = !std::is_same<TFeat, TReal>::value;
+    const bool use_tensor_cores =
+            mixed_precision && CConvUseTensorCores(out_channels, column_size);
+    const size_t fixed_bytes = mixed_precision && !use_tensor_cores
+                                       ? sizeof(TReal) * column_size *
+                                                 out_channels
+                                       : 0;
 
     // this defines how much temporary storage we need at least.
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
     const size_t max_num_cols_per_run = num_out;
-    const size_t bytes_per_column =
-            sizeof(TReal) * (spatial_filter_size * in_channels);
-    const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
-    const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
+    size_t bytes_per_column = sizeof(TReal) * column_size;
+    if (mixed_precision) bytes_per_column += sizeof(TReal) * out_channels;
+    if (use_tensor_cores) bytes_per_column += sizeof(half) * column_size;
+    const size_t min_temp_size_bytes =
+            fixed_bytes + min_num_cols_per_run * bytes_per_column;
+    const size_t max_temp_size_bytes =
+            fixed_bytes + max_num_cols_per_run * bytes_per_column;
 
     if (get_temp_size) {
         std::pair<char*, size_t> tmp =
@@ -114,23 +127,26 @@ void CConvTransposeComputeFeaturesCUDA(
         throw std::runtime_error(ss.str());
     }
 
-    // init output
-    cudaMemsetAsync(out_features, 0, sizeof(TReal) * num_out * out_channels,
-                    stream);
-
     size_t num_cols_per_run =
-            std::min(mem_columns.second / bytes_per_column, size_t(num_out));
-
-    typedef cutlass::gemm::SgemmTraits<
-            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
-            cutlass::MatrixLayout::kColumnMajor,  // layout of B matrix
-            cutlass::Shape<8, 64, 64>             // threadblock tile size
-            >
-            GemmTraits;
-
-    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
-
-    TReal* columns = (TReal*)mem_columns.first;
+            std::min((mem_columns.second - fixed_bytes) / bytes_per_column,
+                     size_t(num_out));
+
+    // partition the temporary memory. All buffers have sizes which are
+    // multiples of 8 elements if tensor cores are used.
+    CConvGemmTemp gemm_temp;
+    char* temp_ptr = (char*)mem_columns.first;
+    if (fixed_bytes) {
+        gemm_temp.A = (float*)temp_ptr;
+        temp_ptr += fixed_bytes;
+    }
+    TReal* columns = (TReal*)temp_ptr;
+    temp_ptr += sizeof(TReal) * num_cols_per_run * column_size;
+    TReal* accumulator = nullptr;
+    if (mixed_precision) {
+        accumulator = (TReal*)temp_ptr;
+        temp_ptr += sizeof(TReal) * num_cols_per_run * out_channels;
+    }
+    if (use_tensor_cores) gemm_temp.columns = (half*)temp_ptr;
 
     // if we cannot process all data at once we need multiple runs
     size_t num_runs = DivUp(num_out, num_cols_per_run);
@@ -140,7 +156,7 @@ void CConvTransposeComputeFeaturesCUDA(
                 std::min(size_t(num_out), (run_i + 1) * num_cols_per_run);
         const size_t num_cols_this_run = end_idx - begin_idx;
 
-        FillColumnTranspose<TReal, TIndex>(
+        FillColumnTranspose<TReal, TIndex, TFeat>(
                 stream, columns, in_channels, begin_idx, end_idx, num_out,
                 out_positions, num_inp, inp_positions, inp_features,
                 inp_neighbors_importance_sum, inp_neighbors_prefix_sum,
@@ -149,49 +165,26 @@ void CConvTransposeComputeFeaturesCUDA(
                 interpolation, coordinate_mapping, align_corners,
                 individual_extent, isotropic_extent, normalize);
 
-        typename Gemm::Params params;
         // C is MxN
         // B is KxN
         // A is MxK
-        int m = out_channels;
-        int k = spatial_filter_size * in_channels;
-        int n = num_cols_this_run;
-        float alpha = 1;
-        const float* const A = filter;
-        int lda = m;
-        const float* const B = columns;
-        int ldb = k;
-        float beta = 1;
-        float* C = out_features + (run_i * num_cols_per_run * out_channels);
-        int ldc = m;
-
-        int result =
-                params.initialize(m,      // GEMM M dimension
-                                  n,      // GEMM N dimension
-                                  k,      // GEMM K dimension
-                                  alpha,  // scalar alpha
-                                  A,      // matrix A operand
-                                  lda,
-                                  B,  // matrix B operand
-                                  ldb,
-                                  beta,  // scalar beta
-                                  C,     // source matrix C
-                                  ldc,
-                                  C,  // destination matrix C (may be different
-                                      // memory than source C matrix)
-                                  ldc);
-
-        if (result) {
-            throw std::runtime_error(
-                    "Failed to initialize CUTLASS Gemm::Params object.");
+        TFeat* out_features_run =
+                out_features + (run_i * num_cols_per_run * out_channels);
+        TReal* C = CConvAccumulator(out_features_run, accumulator);
+        cudaMemsetAsync(C, 0, sizeof(TReal) * num_cols_this_run * out_channels,
+                        stream);
+
+        CConvGemm<cutlass::MatrixLayout::kColumnMajor>(
+                stream, out_channels, num_cols_this_run, column_size, filter,
+                columns, C, gemm_temp);
+
+        if (out_importance) {
+            MultiplyColumns(stream, out_channels, num_cols_this_run, C,
+                            out_importance + (run_i * num_cols_per_run));
         }
 
-        Gemm::launch(params, stream);
-    }
-
-    if (out_importance) {
-        MultiplyColumns(stream, out_channels, num_out, out_features,
-                        out_importance);
+        CConvStoreAccumulator(stream, num_cols_this_run * out_channels,
+                              out_features_run, C);
     }
 }
 
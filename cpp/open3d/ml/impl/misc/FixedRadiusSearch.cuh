@@ -79,31 +79,94 @@ inline __device__ bool NeighborTest(const Vec3<T>& p1,
     return result;
 }
 
+/// Returns the batch item for a point or query index.
+///
+/// \param row_splits    The row splits array in device memory with size
+///        \p batch_size + 1.
+/// \param batch_size    The number of batch items.
+/// \param idx    The index of the point or query.
+///
+/// \return Returns the largest batch item i with row_splits[i] <= idx. This
+///         skips empty batch items.
+///
+inline __device__ int FindBatchItem(const int64_t* const row_splits,
+                                    int batch_size,
+                                    int64_t idx) {
+    int first = 0;
+    int last = batch_size;
+    while (last - first > 1) {
+        const int mid = (first + last) / 2;
+        if (row_splits[mid] <= idx)
+            first = mid;
+        else
+            last = mid;
+    }
+    return first;
+}
+
+/// Copies a row splits array from host memory to a segment of the temporary
+/// memory. This allows the kernels to process all batch items with a single
+/// launch.
+///
+/// \return Returns the device memory segment. Nothing is copied if
+///         \p get_temp_size is true.
+///
+template <class TIndex>
+std::pair<TIndex*, size_t> CopyRowSplitsToDevice(const cudaStream_t& stream,
+                                                 MemoryAllocation& mem_temp,
+                                                 const TIndex* row_splits,
+                                                 size_t row_splits_size,
+                                                 bool get_temp_size) {
+    std::pair<TIndex*, size_t> result =
+            mem_temp.Alloc<TIndex>(row_splits_size);
+    if (!get_temp_size) {
+        cudaMemcpyAsync(result.first, row_splits,
+                        sizeof(TIndex) * row_splits_size,
+                        cudaMemcpyHostToDevice, stream);
+    }
+    return result;
+}
+
 /// Kernel for CountHashTableEntries
 template <class T>
-__global__ void CountHashTableEntriesKernel(uint32_t* count_table,
-                                            size_t hash_table_size,
-                                            T inv_voxel_size,
-                                            const T* const __restrict__ points,
-                                            size_t num_points) {
+__global__ void CountHashTableEntriesKernel(
+        uint32_t* count_table,
+        const uint32_t* const __restrict__ hash_table_splits,
+        const int64_t* const __restrict__ points_row_splits,
+        int batch_size,
+        T inv_voxel_size,
+        const T* const __restrict__ points,
+        size_t num_points) {
     const int idx = blockDim.x * blockIdx.x + threadIdx.x;
     if (idx >= num_points) return;
 
+    const int batch_idx = FindBatchItem(points_row_splits, batch_size, idx);
+    const size_t first_cell_idx = hash_table_splits[batch_idx];
+    const size_t hash_table_size =
+            hash_table_splits[batch_idx + 1] - first_cell_idx;
+
     Vec3<T> pos(&points[idx * 3]);
 
     Vec3<int> voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
     size_t hash = SpatialHash(voxel_index) % hash_table_size;
-    atomicAdd(&count_table[hash + 1], 1);
+    atomicAdd(&count_table[first_cell_idx + hash + 1], 1);
 }
 
 /// Counts for each hash entry the number of points that map to this entry.
+/// The points of all batch items are processed with a single launch.
 ///
 /// \param count_table    Pointer to the table for counting.
 ///        The first element will not be used, i.e. the
 ///        number of points for the first hash entry is in count_table[1].
 ///        This array must be initialized before calling this function.
 ///
-/// \param count_table_size    This is the size of the hash table + 1.
+/// \param hash_table_splits    Device array defining the start and end of
+///        the hash table for each batch item.
+///
+/// \param points_row_splits    Device array defining the start and end of
+///        the points for each batch item.
+///
+/// \param batch_size    The number of batch items.
 ///
 /// \param inv_voxel_size    Reciproval of the voxel size
 ///
@@ -114,7 +177,9 @@ __global__ void CountHashTableEntriesKernel(uint32_t* count_table,
 template <class T>
 void CountHashTableEntries(const cudaStream_t& stream,
                            uint32_t* count_table,
-                           size_t count_table_size,
+                           const uint32_t* const hash_table_splits,
+                           const int64_t* const points_row_splits,
+                           int batch_size,
                            T inv_voxel_size,
                            const T* points,
                            size_t num_points) {
@@ -125,8 +190,8 @@ void CountHashTableEntries(const cudaStream_t& stream,
 
     if (grid.x)
         CountHashTableEntriesKernel<T><<<grid, block, 0, stream>>>(
-                count_table, count_table_size - 1, inv_voxel_size, points,
-                num_points);
+                count_table, hash_table_splits, points_row_splits, batch_size,
+                inv_voxel_size, points, num_points);
 }
 
 /// Kernel for ComputePointIndexTable
@@ -135,25 +200,33 @@ __global__ void ComputePointIndexTableKernel(
         uint32_t* __restrict__ point_index_table,
         uint32_t* __restrict__ count_tmp,
         const uint32_t* const __restrict__ hash_table_cell_splits,
-        size_t hash_table_size,
+        const uint32_t* const __restrict__ hash_table_splits,
+        const int64_t* const __restrict__ points_row_splits,
+        int batch_size,
         T inv_voxel_size,
         const T* const __restrict__ points,
-        const size_t points_start_idx,
-        const size_t points_end_idx) {
-    const int idx = blockDim.x * blockIdx.x + threadIdx.x + points_start_idx;
-    if (idx >= points_end_idx) return;
+        size_t num_points) {
+    const int idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (idx >= num_points) return;
+
+    const int batch_idx = FindBatchItem(points_row_splits, batch_size, idx);
+    const size_t first_cell_idx = hash_table_splits[batch_idx];
+    const size_t hash_table_size =
+            hash_table_splits[batch_idx + 1] - first_cell_idx;
 
     Vec3<T> pos(&points[idx * 3]);
 
     Vec3<int> voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
     size_t hash = SpatialHash(voxel_index[0], voxel_index[1], voxel_index[2]) %
                   hash_table_size;
+    hash += first_cell_idx;
 
     point_index_table[hash_table_cell_splits[hash] +
                       atomicAdd(&count_tmp[hash], 1)] = idx;
 }
 
 /// Writes the index of the points to the hash cells.
+/// The points of all batch items are processed with a single launch.
 ///
 /// \param point_index_table    The output array storing the point indices for
 ///        all cells. Start and end of each cell is defined by
@@ -163,9 +236,17 @@ __global__ void ComputePointIndexTableKernel(
 /// .
 ///
 /// \param hash_table_cell_splits    The row splits array describing the start
-///        and end of each cell.
+///        and end of each cell of all batch items.
+///
+/// \param hash_table_cell_splits_size    The size of all hash tables + 1.
 ///
-/// \param hash_table_cell_splits_size    The size of the hash table.
+/// \param hash_table_splits    Device array defining the start and end of
+///        the hash table for each batch item.
+///
+/// \param points_row_splits    Device array defining the start and end of
+///        the points for each batch item.
+///
+/// \param batch_size    The number of batch items.
 ///
 /// \param inv_voxel_size    Reciproval of the voxel size
 ///
@@ -180,13 +261,14 @@ void ComputePointIndexTable(
         uint32_t* __restrict__ count_tmp,
         const uint32_t* const __restrict__ hash_table_cell_splits,
         size_t hash_table_cell_splits_size,
+        const uint32_t* const __restrict__ hash_table_splits,
+        const int64_t* const __restrict__ points_row_splits,
+        int batch_size,
         T inv_voxel_size,
         const T* const __restrict__ points,
-        size_t points_start_idx,
-        size_t points_end_idx) {
+        size_t num_points) {
     cudaMemsetAsync(count_tmp, 0,
                     sizeof(uint32_t) * hash_table_cell_splits_size, stream);
-    size_t num_points = points_end_idx - points_start_idx;
 
     const int BLOCKSIZE = 64;
     dim3 block(BLOCKSIZE, 1, 1);
@@ -196,8 +278,8 @@ void ComputePointIndexTable(
     if (grid.x)
         ComputePointIndexTableKernel<T><<<grid, block, 0, stream>>>(
                 point_index_table, count_tmp, hash_table_cell_splits,
-                hash_table_cell_splits_size - 1, inv_voxel_size, points,
-                points_start_idx, points_end_idx);
+                hash_table_splits, points_row_splits, batch_size,
+                inv_voxel_size, points, num_points);
 }
 
 /// Kernel for CountNeighbors
@@ -205,18 +287,27 @@ template <int METRIC, bool IGNORE_QUERY_POINT, class T>
 __global__ void CountNeighborsKernel(
         uint32_t* __restrict__ neighbors_count,
         const uint32_t* const __restrict__ point_index_table,
-        const uint32_t* const __restrict__ hash_table_cell_splits,
-        size_t hash_table_size,
+        const uint32_t* const __restrict__ all_hash_table_cell_splits,
+        const uint32_t* const __restrict__ hash_table_splits,
+        const int64_t* const __restrict__ queries_row_splits,
+        int batch_size,
         const T* const __restrict__ query_points,
         size_t num_queries,
         const T* const __restrict__ points,
-        size_t num_points,
         const T inv_voxel_size,
         const T radius,
         const T threshold) {
     int query_idx = blockDim.x * blockIdx.x + threadIdx.x;
     if (query_idx >= num_queries) return;
 
+    // select the hash table of the batch item of this query point
+    const int batch_idx =
+            FindBatchItem(queries_row_splits, batch_size, query_idx);
+    const uint32_t* const hash_table_cell_splits =
+            all_hash_table_cell_splits + hash_table_splits[batch_idx];
+    const size_t hash_table_size =
+            hash_table_splits[batch_idx + 1] - hash_table_splits[batch_idx];
+
     int count = 0;  // counts the number of neighbors for this query point
 
     Vec3<T> query_pos(query_points[query_idx * 3 + 0],
@@ -280,19 +371,22 @@ __global__ void CountNeighborsKernel(
 ///        hash_table_cell_splits
 ///
 /// \param hash_table_cell_splits    The row splits array describing the start
-///        and end of each cell.
+///        and end of each cell of all batch items.
 ///
-/// \param hash_table_cell_splits_size    This is the length of the
-///        hash_table_cell_splits array.
+/// \param hash_table_splits    Device array defining the start and end of
+///        the hash table for each batch item.
 ///
-/// \param query_points    Array with the 3D query positions. This may be the
-///        same array as \p points.
+/// \param queries_row_splits    Device array defining the start and end of
+///        the queries for each batch item.
 ///
-/// \param num_queries    The number of query points.
+/// \param batch_size    The number of batch items.
 ///
-/// \param points    Array with the 3D point positions.
+/// \param query_points    Array with the 3D query positions of all batch
+///        items. This may be the same array as \p points.
 ///
-/// \param num_points    The number of points.
+/// \param num_queries    The number of query points of all batch items.
+///
+/// \param points    Array with the 3D point positions.
 ///
 /// \param inv_voxel_size    Reciproval of the voxel size
 ///
@@ -309,11 +403,12 @@ void CountNeighbors(const cudaStream_t& stream,
                     uint32_t* neighbors_count,
                     const uint32_t* const point_index_table,
                     const uint32_t* const hash_table_cell_splits,
-                    size_t hash_table_cell_splits_size,
+                    const uint32_t* const hash_table_splits,
+                    const int64_t* const queries_row_splits,
+                    int batch_size,
                     const T* const query_points,
                     size_t num_queries,
                     const T* const points,
-                    size_t num_points,
                     const T inv_voxel_size,
                     const T radius,
                     const Metric metric,
@@ -326,10 +421,11 @@ void CountNeighbors(const cudaStream_t& stream,
     grid.x = DivUp(num_queries, block.x);
 
     if (grid.x) {
-#define FN_PARAMETERS                                                   \
-    neighbors_count, point_index_table, hash_table_cell_splits,         \
-            hash_table_cell_splits_size - 1, query_points, num_queries, \
-            points, num_points, inv_voxel_size, radius, threshold
+#define FN_PARAMETERS                                                     \
+    neighbors_count, point_index_table, hash_table_cell_splits,           \
+            hash_table_splits, queries_row_splits, batch_size,            \
+            query_points, num_queries, points, inv_voxel_size, radius, \
+            threshold
 
 #define CALL_TEMPLATE(METRIC)                                    \
     if (METRIC == metric) {                                      \
@@ -357,18 +453,27 @@ __global__ void WriteNeighborsIndicesAndDistancesKernel(
         T* __restrict__ distances,
         const int64_t* const __restrict__ neighbors_row_splits,
         const uint32_t* const __restrict__ point_index_table,
-        const uint32_t* const __restrict__ hash_table_cell_splits,
-        size_t hash_table_size,
+        const uint32_t* const __restrict__ all_hash_table_cell_splits,
+        const uint32_t* const __restrict__ hash_table_splits,
+        const int64_t* const __restrict__ queries_row_splits,
+        int batch_size,
         const T* const __restrict__ query_points,
         size_t num_queries,
         const T* const __restrict__ points,
-        size_t num_points,
         const T inv_voxel_size,
         const T radius,
         const T threshold) {
     int query_idx = blockDim.x * blockIdx.x + threadIdx.x;
     if (query_idx >= num_queries) return;
 
+    // select the hash table of the batch item of this query point
+    const int batch_idx =
+            FindBatchItem(queries_row_splits, batch_size, query_idx);
+    const uint32_t* const hash_table_cell_splits =
+            all_hash_table_cell_splits + hash_table_splits[batch_idx];
+    const size_t hash_table_size =
+            hash_table_splits[batch_idx + 1] - hash_table_splits[batch_idx];
+
     int count = 0;  // counts the number of neighbors for this query point
 
     size_t indices_offset = neighbors_row_splits[query_idx];
@@ -441,19 +546,22 @@ __global__ void WriteNeighborsIndicesAndDistancesKernel(
 ///        hash_table_cell_splits
 ///
 /// \param hash_table_cell_splits    The row splits array describing the start
-///        and end of each cell.
+///        and end of each cell of all batch items.
 ///
-/// \param hash_table_cell_splits_size    This is the length of the
-///        hash_table_cell_splits array.
+/// \param hash_table_splits    Device array defining the start and end of
+///        the hash table for each batch item.
 ///
-/// \param query_points    Array with the 3D query positions. This may be the
-///        same array as \p points.
+/// \param queries_row_splits    Device array defining the start and end of
+///        the queries for each batch item.
 ///
-/// \param num_queries    The number of query points.
+/// \param batch_size    The number of batch items.
 ///
-/// \param points    Array with the 3D point positions.
+/// \param query_points    Array with the 3D query positions of all batch
+///        items. This may be the same array as \p points.
 ///
-/// \param num_points    The number of points.
+/// \param num_queries    The number of query points of all batch items.
+///
+/// \param points    Array with the 3D point positions.
 ///
 /// \param inv_voxel_size    Reciproval of the voxel size
 ///
@@ -477,11 +585,12 @@ void WriteNeighborsIndicesAndDistances(
         const int64_t* const neighbors_row_splits,
         const uint32_t* const point_index_table,
         const uint32_t* const hash_table_cell_splits,
-        size_t hash_table_cell_splits_size,
+        const uint32_t* const hash_table_splits,
+        const int64_t* const queries_row_splits,
+        int batch_size,
         const T* const query_points,
         size_t num_queries,
         const T* const points,
-        size_t num_points,
         const T inv_voxel_size,
         const T radius,
         const Metric metric,
@@ -495,10 +604,10 @@ void WriteNeighborsIndicesAndDistances(
     grid.x = DivUp(num_queries, block.x);
 
     if (grid.x) {
-#define FN_PARAMETERS                                                      \
-    indices, distances, neighbors_row_splits, point_index_table,           \
-            hash_table_cell_splits, hash_table_cell_splits_size - 1,       \
-            query_points, num_queries, points, num_points, inv_voxel_size, \
+#define FN_PARAMETERS                                                       \
+    indices, distances, neighbors_row_splits, point_index_table,            \
+            hash_table_cell_splits, hash_table_splits, queries_row_splits,  \
+            batch_size, query_points, num_queries, points, inv_voxel_size, \
             radius, threshold
 
 #define CALL_TEMPLATE(METRIC, IGNORE_QUERY_POINT, RETURN_DISTANCES)            \
@@ -606,23 +715,24 @@ void BuildSpatialHashTableCUDA(const cudaStream_t& stream,
     const TReal voxel_size = 2 * radius;
     const TReal inv_voxel_size = 1 / voxel_size;
 
+    // device copies of the splits arrays for processing all batch items with
+    // a single kernel launch
+    std::pair<int64_t*, size_t> points_row_splits_dev = CopyRowSplitsToDevice(
+            stream, mem_temp, points_row_splits, points_row_splits_size,
+            get_temp_size);
+    std::pair<TIndex*, size_t> hash_table_splits_dev = CopyRowSplitsToDevice(
+            stream, mem_temp, hash_table_splits, points_row_splits_size,
+            get_temp_size);
+
     // count number of points per hash entry
     if (!get_temp_size) {
         cudaMemsetAsync(count_tmp.first, 0, sizeof(TIndex) * count_tmp.second,
                         stream);
 
-        for (int i = 0; i < batch_size; ++i) {
-            const size_t hash_table_size =
-                    hash_table_splits[i + 1] - hash_table_splits[i];
-            const size_t first_cell_idx = hash_table_splits[i];
-            const size_t num_points_i =
-                    points_row_splits[i + 1] - points_row_splits[i];
-            const TReal* const points_i = points + 3 * points_row_splits[i];
-
-            CountHashTableEntries(stream, count_tmp.first + first_cell_idx,
-                                  hash_table_size + 1, inv_voxel_size, points_i,
-                                  num_points_i);
-        }
+        CountHashTableEntries(stream, count_tmp.first,
+                              hash_table_splits_dev.first,
+                              points_row_splits_dev.first, batch_size,
+                              inv_voxel_size, points, num_points);
     }
 
     // compute prefix sum of the hash entry counts and store in
@@ -649,19 +759,16 @@ void BuildSpatialHashTableCUDA(const cudaStream_t& stream,
     // now compute the global indices which allows us to lookup the point index
     // for the entries in the hash cell
     if (!get_temp_size) {
-        for (int i = 0; i < batch_size; ++i) {
-            const size_t hash_table_size =
-                    hash_table_splits[i + 1] - hash_table_splits[i];
-            const size_t first_cell_idx = hash_table_splits[i];
-            const size_t points_start_idx = points_row_splits[i];
-            const size_t points_end_idx = points_row_splits[i + 1];
-            ComputePointIndexTable(stream, hash_table_index, count_tmp.first,
-                                   hash_table_cell_splits + first_cell_idx,
-                                   hash_table_size + 1, inv_voxel_size, points,
-                                   points_start_idx, points_end_idx);
-        }
+        ComputePointIndexTable(stream, hash_table_index, count_tmp.first,
+                               hash_table_cell_splits,
+                               hash_table_cell_splits_size,
+                               hash_table_splits_dev.first,
+                               points_row_splits_dev.first, batch_size,
+                               inv_voxel_size, points, num_points);
     }
 
+    mem_temp.Free(hash_table_splits_dev);
+    mem_temp.Free(points_row_splits_dev);
     mem_temp.Free(count_tmp);
 
     if (get_temp_size) {
@@ -812,27 +919,25 @@ void FixedRadiusSearchCUDA(const cudaStream_t& stream,
     const T voxel_size = 2 * radius;
     const T inv_voxel_size = 1 / voxel_size;
 
+    // device copies of the splits arrays for processing all batch items with
+    // a single kernel launch
+    std::pair<int64_t*, size_t> queries_row_splits_dev = CopyRowSplitsToDevice(
+            stream, mem_temp, queries_row_splits, queries_row_splits_size,
+            get_temp_size);
+    std::pair<uint32_t*, size_t> hash_table_splits_dev = CopyRowSplitsToDevice(
+            stream, mem_temp, hash_table_splits, queries_row_splits_size,
+            get_temp_size);
+
     std::pair<uint32_t*, size_t> query_neighbors_count =
             mem_temp.Alloc<uint32_t>(num_queries);
 
     // we need this value to compute the size of the index array
     if (!get_temp_size) {
-        for (int i = 0; i < batch_size; ++i) {
-            const size_t hash_table_size =
-                    hash_table_splits[i + 1] - hash_table_splits[i];
-            const size_t first_cell_idx = hash_table_splits[i];
-            const size_t queries_start_idx = queries_row_splits[i];
-            const T* const queries_i = queries + 3 * queries_row_splits[i];
-            const size_t num_queries_i =
-                    queries_row_splits[i + 1] - queries_row_splits[i];
-
-            CountNeighbors(
-                    stream, query_neighbors_count.first + queries_start_idx,
-                    hash_table_index, hash_table_cell_splits + first_cell_idx,
-                    hash_table_size + 1, queries_i, num_queries_i, points,
-                    num_points, inv_voxel_size, radius, metric,
-                    ignore_query_point);
-        }
+        CountNeighbors(stream, query_neighbors_count.first, hash_table_index,
+                       hash_table_cell_splits, hash_table_splits_dev.first,
+                       queries_row_splits_dev.first, batch_size, queries,
+                       num_queries, points, inv_voxel_size, radius, metric,
+                       ignore_query_point);
     }
 
     // we need this value to compute the size of the index array
@@ -885,24 +990,15 @@ void FixedRadiusSearchCUDA(const cudaStream_t& stream,
     else
         output_allocator.AllocDistances(&distances_ptr, 0);
 
-    if (!get_temp_size) {
-        for (int i = 0; i < batch_size; ++i) {
-            const size_t hash_table_size =
-                    hash_table_splits[i + 1] - hash_table_splits[i];
-            const size_t first_cell_idx = hash_table_splits[i];
-            const T* const queries_i = queries + 3 * queries_row_splits[i];
-            const size_t num_queries_i =
-                    queries_row_splits[i + 1] - queries_row_splits[i];
-
-            WriteNeighborsIndicesAndDistances(
-                    stream, indices_ptr, distances_ptr,
-                    query_neighbors_row_splits + queries_row_splits[i],
-                    hash_table_index, hash_table_cell_splits + first_cell_idx,
-                    hash_table_size + 1, queries_i, num_queries_i, points,
-                    num_points, inv_voxel_size, radius, metric,
-                    ignore_query_point, return_distances);
-        }
-    }
+    WriteNeighborsIndicesAndDistances(
+            stream, indices_ptr, distances_ptr, query_neighbors_row_splits,
+            hash_table_index, hash_table_cell_splits,
+            hash_table_splits_dev.first, queries_row_splits_dev.first,
+            batch_size, queries, num_queries, points, inv_voxel_size, radius,
+            metric, ignore_query_point, return_distances);
+
+    mem_temp.Free(hash_table_splits_dev);
+    mem_temp.Free(queries_row_splits_dev);
 }
 
 }  // namespace impl
@@ -0,0 +1,562 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cub/cub.cuh>
+
+#include "open3d/ml/impl/misc/MemoryAllocation.h"
+#include "open3d/ml/impl/misc/NeighborSearchCommon.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+namespace {
+
+/// The number of threads per block for the knn kernels. This is also the
+/// number of points in each tile of points staged in shared memory.
+constexpr int KNN_BLOCKSIZE = 128;
+
+/// Computes the distance between two points for the KNN search.
+///
+/// \tparam METRIC    The distance metric. One of L1, L2.
+/// \tparam T    Floating point type for the distances.
+///
+/// \return Returns the distance. For L2 the squared distance is returned.
+///
+template <int METRIC, class T>
+inline __device__ T KnnDistance(const utility::MiniVec<T, 3>& p1,
+                                const utility::MiniVec<T, 3>& p2) {
+    if (METRIC == L1) {
+        utility::MiniVec<T, 3> d = (p1 - p2).abs();
+        return d[0] + d[1] + d[2];
+    } else {
+        utility::MiniVec<T, 3> d = p1 - p2;
+        return d.dot(d);
+    }
+}
+
+/// Restores the max-heap property for the heap of a single query point.
+/// The heap elements are strided to allow coalesced accesses by neighboring
+/// threads.
+///
+/// \param distances    Pointer to the first distance of the heap.
+/// \param indices    Pointer to the first index of the heap.
+/// \param stride    The stride between heap elements.
+/// \param i    The element to move down.
+/// \param size    The number of elements in the heap.
+///
+template <class T>
+inline __device__ void KnnHeapSiftDown(T* __restrict__ distances,
+                                       int32_t* __restrict__ indices,
+                                       size_t stride,
+                                       int i,
+                                       int size) {
+    const T dist = distances[i * stride];
+    const int32_t idx = indices[i * stride];
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= size) break;
+        if (child + 1 < size &&
+            distances[(child + 1) * stride] > distances[child * stride]) {
+            ++child;
+        }
+        if (distances[child * stride] <= dist) break;
+        distances[i * stride] = distances[child * stride];
+        indices[i * stride] = indices[child * stride];
+        i = child;
+    }
+    distances[i * stride] = dist;
+    indices[i * stride] = idx;
+}
+
+/// Kernel for SelectKnn. Each thread maintains a max-heap with the k nearest
+/// points for one query point. The points are processed in tiles which are
+/// staged in shared memory and shared by all threads of a block.
+template <class T, int METRIC>
+__global__ void SelectKnnKernel(T* __restrict__ heap_distances,
+                                int32_t* __restrict__ heap_indices,
+                                uint32_t* __restrict__ neighbors_count,
+                                const T* const __restrict__ query_points,
+                                size_t num_queries,
+                                const T* const __restrict__ points,
+                                size_t points_start_idx,
+                                size_t num_points,
+                                int k,
+                                bool ignore_query_point) {
+    __shared__ T tile[3 * KNN_BLOCKSIZE];
+
+    const size_t query_idx = size_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    const bool active = query_idx < num_queries;
+
+    T* distances = heap_distances + query_idx;
+    int32_t* indices = heap_indices + query_idx;
+
+    utility::MiniVec<T, 3> query_pos(T(0), T(0), T(0));
+    T max_dist = T(INFINITY);
+    if (active) {
+        query_pos = utility::MiniVec<T, 3>(&query_points[query_idx * 3]);
+        for (int i = 0; i < k; ++i) {
+            distances[i * num_queries] = max_dist;
+            indices[i * num_queries] = -1;
+        }
+    }
+
+    const T* const points_i = points + 3 * points_start_idx;
+    for (size_t tile_start = 0; tile_start < num_points;
+         tile_start += KNN_BLOCKSIZE) {
+        const int tile_size = num_points - tile_start < KNN_BLOCKSIZE
+                                      ? int(num_points - tile_start)
+                                      : KNN_BLOCKSIZE;
+        __syncthreads();
+        for (int i = threadIdx.x; i < 3 * tile_size; i += blockDim.x) {
+            tile[i] = points_i[3 * tile_start + i];
+        }
+        __syncthreads();
+        if (!active) continue;
+
+        for (int i = 0; i < tile_size; ++i) {
+            utility::MiniVec<T, 3> p(&tile[3 * i]);
+            T dist = KnnDistance<METRIC>(query_pos, p);
+            if (dist < max_dist) {
+                distances[0] = dist;
+                indices[0] = int32_t(points_start_idx + tile_start + i);
+                KnnHeapSiftDown(distances, indices, num_queries, 0, k);
+                max_dist = distances[0];
+            }
+        }
+    }
+    if (!active) return;
+
+    // heap sort to return the neighbors ordered by distance like nanoflann
+    for (int end = k - 1; end > 0; --end) {
+        T tmp_dist = distances[0];
+        int32_t tmp_idx = indices[0];
+        distances[0] = distances[end * num_queries];
+        indices[0] = indices[end * num_queries];
+        distances[end * num_queries] = tmp_dist;
+        indices[end * num_queries] = tmp_idx;
+        KnnHeapSiftDown(distances, indices, num_queries, 0, end);
+    }
+
+    uint32_t count = 0;
+    for (int i = 0; i < k; ++i) {
+        const int32_t idx = indices[i * num_queries];
+        if (idx < 0) break;
+        if (ignore_query_point &&
+            (query_pos == utility::MiniVec<T, 3>(&points[3 * idx])).all()) {
+            continue;
+        }
+        ++count;
+    }
+    neighbors_count[query_idx] = count;
+}
+
+/// Selects the k nearest points for each query point with a tiled brute force
+/// search and counts the number of neighbors after removing invalid entries.
+///
+/// \param heap_distances    Temporary array with size \p k * \p num_queries
+///        for the distances. After the call the distances for each query are
+///        ordered by distance.
+///
+/// \param heap_indices    Temporary array with size \p k * \p num_queries
+///        for the indices of the neighbors.
+///
+/// \param neighbors_count    Output array for counting the number of
+///        neighbors. The size of the array is \p num_queries.
+///
+/// \param query_points    Array with the 3D query positions.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param points    Array with the 3D point positions of all batch items.
+///
+/// \param points_start_idx    Index of the first point of the batch item.
+///
+/// \param num_points    The number of points of the batch item.
+///
+/// \param k    The number of neighbors to search.
+///
+/// \param metric    One of L1, L2. Defines the distance metric.
+///
+/// \param ignore_query_point    If true then points with the same position as
+///        the query point will be ignored.
+///
+template <class T>
+void SelectKnn(const cudaStream_t& stream,
+               T* heap_distances,
+               int32_t* heap_indices,
+               uint32_t* neighbors_count,
+               const T* const query_points,
+               size_t num_queries,
+               const T* const points,
+               size_t points_start_idx,
+               size_t num_points,
+               int k,
+               const Metric metric,
+               const bool ignore_query_point) {
+    using namespace open3d::utility;
+
+    const int BLOCKSIZE = KNN_BLOCKSIZE;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = DivUp(num_queries, block.x);
+
+    if (grid.x) {
+#define FN_PARAMETERS                                                        \
+    heap_distances, heap_indices, neighbors_count, query_points, num_queries, \
+            points, points_start_idx, num_points, k, ignore_query_point
+
+#define CALL_TEMPLATE(METRIC)                                            \
+    if (METRIC == metric) {                                              \
+        SelectKnnKernel<T, METRIC>                                       \
+                <<<grid, block, 0, stream>>>(FN_PARAMETERS);             \
+    }
+
+        CALL_TEMPLATE(L1)
+        CALL_TEMPLATE(L2)
+
+#undef CALL_TEMPLATE
+#undef FN_PARAMETERS
+    }
+}
+
+/// Kernel for WriteKnnIndicesAndDistances
+template <class T>
+__global__ void WriteKnnIndicesAndDistancesKernel(
+        int32_t* __restrict__ indices,
+        T* __restrict__ distances,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const T* const __restrict__ heap_distances,
+        const int32_t* const __restrict__ heap_indices,
+        const T* const __restrict__ query_points,
+        size_t num_queries,
+        const T* const __restrict__ points,
+        int k,
+        bool ignore_query_point,
+        bool return_distances) {
+    const size_t query_idx = size_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (query_idx >= num_queries) return;
+
+    utility::MiniVec<T, 3> query_pos(&query_points[query_idx * 3]);
+    int64_t out_idx = neighbors_row_splits[query_idx];
+    for (int i = 0; i < k; ++i) {
+        const int32_t idx = heap_indices[i * num_queries + query_idx];
+        if (idx < 0) break;
+        if (ignore_query_point &&
+            (query_pos == utility::MiniVec<T, 3>(&points[3 * idx])).all()) {
+            continue;
+        }
+        indices[out_idx] = idx;
+        if (return_distances) {
+            distances[out_idx] = heap_distances[i * num_queries + query_idx];
+        }
+        ++out_idx;
+    }
+}
+
+/// Writes the neighbor indices and distances selected by SelectKnn to the
+/// output arrays.
+///
+/// \param indices    Output array with the neighbor indices.
+///
+/// \param distances    Output array with the neighbor distances. May be null
+///        if return_distances is false.
+///
+/// \param neighbors_row_splits    This is the prefix sum which describes
+///        start and end of the neighbors for each query point.
+///
+/// \param heap_distances    The sorted distances returned by SelectKnn.
+///
+/// \param heap_indices    The sorted indices returned by SelectKnn.
+///
+/// \param query_points    Array with the 3D query positions.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param points    Array with the 3D point positions of all batch items.
+///
+/// \param k    The number of neighbors to search.
+///
+/// \param ignore_query_point    If true then points with the same position as
+///        the query point will be ignored.
+///
+/// \param return_distances    If true then this function will write the
+///        distances for each neighbor.
+///
+template <class T>
+void WriteKnnIndicesAndDistances(const cudaStream_t& stream,
+                                 int32_t* indices,
+                                 T* distances,
+                                 const int64_t* const neighbors_row_splits,
+                                 const T* const heap_distances,
+                                 const int32_t* const heap_indices,
+                                 const T* const query_points,
+                                 size_t num_queries,
+                                 const T* const points,
+                                 int k,
+                                 const bool ignore_query_point,
+                                 const bool return_distances) {
+    using namespace open3d::utility;
+
+    const int BLOCKSIZE = KNN_BLOCKSIZE;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = DivUp(num_queries, block.x);
+
+    if (grid.x) {
+        WriteKnnIndicesAndDistancesKernel<T><<<grid, block, 0, stream>>>(
+                indices, distances, neighbors_row_splits, heap_distances,
+                heap_indices, query_points, num_queries, points, k,
+                ignore_query_point, return_distances);
+    }
+}
+
+}  // namespace
+
+/// KNN search. This function computes a list of neighbor indices
+/// for each query point. The lists are stored linearly and an exclusive prefix
+/// sum defines the start and end of each list in the array.
+/// In addition the function optionally can return the distances for each
+/// neighbor in the same format as the indices to the neighbors.
+///
+/// This is the CUDA counterpart of KnnSearchCPU. The search is a tiled brute
+/// force search, i.e. the points of each batch item are streamed through
+/// shared memory and each thread keeps a heap with the k nearest points for
+/// one query point. Unlike a spatial hash table this does not need a search
+/// radius, which is unknown for the KNN search. The neighbors of each query
+/// point are ordered by distance as in the CPU version.
+///
+/// \tparam T    Floating-point data type for the point positions.
+///
+/// \tparam OUTPUT_ALLOCATOR    Type of the output_allocator. See
+///         \p output_allocator for more information.
+///
+/// \param temp    Pointer to temporary memory. If nullptr then the required
+///        size of temporary memory will be written to \p temp_size and no
+///        work is done.
+///
+/// \param temp_size    The size of the temporary memory in bytes. This is
+///        used as an output if temp is nullptr
+///
+/// \param texture_alignment    The texture alignment in bytes. This is used
+///        for allocating segments within the temporary memory.
+///
+/// \param query_neighbors_row_splits    This is the output pointer for the
+///        prefix sum. The length of this array is \p num_queries + 1.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    Array with the 3D point positions. This may be the same
+///        array as \p queries.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 3D query positions. This may be the same
+///                   array as \p points.
+///
+/// \param points_row_splits_size    The size of the points_row_splits array.
+///        The size of the array is batch_size+1.
+///
+/// \param points_row_splits    This pointer points to host memory.
+///        Defines the start and end of the points in each batch item.
+///        The size of the array is batch_size+1. If there is
+///        only 1 batch item then this array is [0, num_points]
+///
+/// \param queries_row_splits_size    The size of the queries_row_splits array.
+///        The size of the array is batch_size+1.
+///
+/// \param queries_row_splits    This pointer points to host memory.
+///        Defines the start and end of the queries in each batch item.
+///        The size of the array is batch_size+1. If there is
+///        only 1 batch item then this array is [0, num_queries]
+///
+/// \param k    The number of neighbors to search.
+///
+/// \param metric    One of L1, L2. Defines the distance metric for the
+///        search.
+///
+/// \param ignore_query_point    If true then points with the same position as
+///        the query point will be ignored.
+///
+/// \param return_distances    If true then this function will return the
+///        distances for each neighbor to its query point in the same format
+///        as the indices.
+///        Note that for the L2 metric the squared distances will be returned!!
+///
+/// \param output_allocator    An object that implements functions for
+///         allocating the output arrays. The object must implement functions
+///         AllocIndices(int32_t** ptr, size_t size) and
+///         AllocDistances(T** ptr, size_t size). Both functions should
+///         allocate memory and return a pointer to that memory in ptr.
+///         Argument size specifies the size of the array as the number of
+///         elements. Both functions must accept the argument size==0.
+///         In this case ptr does not need to be set.
+///
+template <class T, class OUTPUT_ALLOCATOR>
+void KnnSearchCUDA(const cudaStream_t& stream,
+                   void* temp,
+                   size_t& temp_size,
+                   int texture_alignment,
+                   int64_t* query_neighbors_row_splits,
+                   size_t num_points,
+                   const T* const points,
+                   size_t num_queries,
+                   const T* const queries,
+                   const size_t points_row_splits_size,
+                   const int64_t* const points_row_splits,
+                   const size_t queries_row_splits_size,
+                   const int64_t* const queries_row_splits,
+                   const int k,
+                   const Metric metric,
+                   const bool ignore_query_point,
+                   const bool return_distances,
+                   OUTPUT_ALLOCATOR& output_allocator) {
+    const bool get_temp_size = !temp;
+
+    if (get_temp_size) {
+        temp = (char*)1;  // worst case pointer alignment
+        temp_size = std::numeric_limits<int64_t>::max();
+    }
+
+    // return empty output arrays if there are no points
+    if ((0 == num_points || 0 == num_queries) && !get_temp_size) {
+        cudaMemsetAsync(query_neighbors_row_splits, 0,
+                        sizeof(int64_t) * (num_queries + 1), stream);
+        int32_t* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+
+        return;
+    }
+
+    MemoryAllocation mem_temp(temp, temp_size, texture_alignment);
+
+    const int batch_size = points_row_splits_size - 1;
+
+    // the heaps for all query points. The heaps stay allocated until the
+    // neighbors have been written to the output arrays.
+    std::pair<T*, size_t> heap_distances =
+            mem_temp.Alloc<T>(size_t(k) * num_queries);
+    std::pair<int32_t*, size_t> heap_indices =
+            mem_temp.Alloc<int32_t>(size_t(k) * num_queries);
+
+    std::pair<uint32_t*, size_t> query_neighbors_count =
+            mem_temp.Alloc<uint32_t>(num_queries);
+
+    if (!get_temp_size) {
+        for (int i = 0; i < batch_size; ++i) {
+            const size_t queries_start_idx = queries_row_splits[i];
+            const size_t num_queries_i =
+                    queries_row_splits[i + 1] - queries_row_splits[i];
+            const size_t num_points_i =
+                    points_row_splits[i + 1] - points_row_splits[i];
+
+            SelectKnn(stream, heap_distances.first + k * queries_start_idx,
+                      heap_indices.first + k * queries_start_idx,
+                      query_neighbors_count.first + queries_start_idx,
+                      queries + 3 * queries_start_idx, num_queries_i, points,
+                      points_row_splits[i], num_points_i, k, metric,
+                      ignore_query_point);
+        }
+    }
+
+    // we need this value to compute the size of the index array
+    int64_t last_prefix_sum_entry = 0;
+    {
+        std::pair<void*, size_t> inclusive_scan_temp(nullptr, 0);
+        cub::DeviceScan::InclusiveSum(
+                inclusive_scan_temp.first, inclusive_scan_temp.second,
+                query_neighbors_count.first, query_neighbors_row_splits + 1,
+                num_queries, stream);
+
+        inclusive_scan_temp = mem_temp.Alloc(inclusive_scan_temp.second);
+
+        if (!get_temp_size) {
+            // set first element to zero
+            cudaMemsetAsync(query_neighbors_row_splits, 0, sizeof(int64_t),
+                            stream);
+            cub::DeviceScan::InclusiveSum(
+                    inclusive_scan_temp.first, inclusive_scan_temp.second,
+                    query_neighbors_count.first, query_neighbors_row_splits + 1,
+                    num_queries, stream);
+
+            // get the last value
+            cudaMemcpyAsync(&last_prefix_sum_entry,
+                            query_neighbors_row_splits + num_queries,
+                            sizeof(int64_t), cudaMemcpyDeviceToHost, stream);
+            // wait for the async copies
+            while (cudaErrorNotReady == cudaStreamQuery(stream)) { /*empty*/
+            }
+        }
+        mem_temp.Free(inclusive_scan_temp);
+    }
+
+    mem_temp.Free(query_neighbors_count);
+
+    if (get_temp_size) {
+        // return the memory peak as the required temporary memory size.
+        temp_size = mem_temp.MaxUsed();
+        return;
+    }
+
+    // allocate the output array for the neighbor indices
+    const size_t num_indices = last_prefix_sum_entry;
+    int32_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+
+    T* distances_ptr;
+    if (return_distances)
+        output_allocator.AllocDistances(&distances_ptr, num_indices);
+    else
+        output_allocator.AllocDistances(&distances_ptr, 0);
+
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t queries_start_idx = queries_row_splits[i];
+        const size_t num_queries_i =
+                queries_row_splits[i + 1] - queries_row_splits[i];
+
+        WriteKnnIndicesAndDistances(
+                stream, indices_ptr, distances_ptr,
+                query_neighbors_row_splits + queries_start_idx,
+                heap_distances.first + k * queries_start_idx,
+                heap_indices.first + k * queries_start_idx,
+                queries + 3 * queries_start_idx, num_queries_i, points, k,
+                ignore_query_point, return_distances);
+    }
+
+    mem_temp.Free(heap_indices);
+    mem_temp.Free(heap_distances);
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
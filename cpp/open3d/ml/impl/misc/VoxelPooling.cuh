@@ -0,0 +1,562 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cub/cub.cuh>
+
+#include "open3d/ml/impl/misc/MemoryAllocation.h"
+#include "open3d/ml/impl/misc/VoxelPooling.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+namespace {
+
+using namespace open3d::utility;
+
+/// Returns a 3D grid with at least \p num threads for 1D problems that may
+/// exceed the maximum grid size in x direction.
+inline dim3 VoxelPoolingGrid(int64_t num, const dim3& block) {
+    dim3 grid;
+    grid.y = std::ceil(std::cbrt(num));
+    grid.z = grid.y;
+    grid.x = DivUp(num, int64_t(grid.z) * grid.y * block.x);
+    return grid;
+}
+
+__device__ inline int64_t VoxelPoolingLinearIdx() {
+    const int64_t x = blockDim.x * blockIdx.x + threadIdx.x;
+    const int64_t y = blockDim.y * blockIdx.y + threadIdx.y;
+    const int64_t z = blockDim.z * blockIdx.z + threadIdx.z;
+    return z * gridDim.x * blockDim.x * gridDim.y +
+           y * gridDim.x * blockDim.x + x;
+}
+
+template <class TReal>
+__global__ void ComputeVoxelIndexKernel(int32_t* __restrict__ voxel_index,
+                                        int64_t* __restrict__ point_indices,
+                                        int64_t num_points,
+                                        const TReal* const __restrict__ points,
+                                        const TReal inv_voxel_size) {
+    const int64_t linear_idx = VoxelPoolingLinearIdx();
+    if (linear_idx >= num_points) return;
+
+    for (int i = 0; i < 3; ++i) {
+        voxel_index[linear_idx * 3 + i] =
+                int32_t(floor(points[linear_idx * 3 + i] * inv_voxel_size));
+    }
+    point_indices[linear_idx] = linear_idx;
+}
+
+__global__ void GatherSortKeysKernel(
+        uint32_t* __restrict__ keys,
+        int64_t num_points,
+        const int32_t* const __restrict__ voxel_index,
+        const int64_t* const __restrict__ point_indices,
+        int dim) {
+    const int64_t linear_idx = VoxelPoolingLinearIdx();
+    if (linear_idx >= num_points) return;
+
+    // flip the sign bit to get the order of signed integers with an
+    // unsigned radix sort
+    const int64_t idx = point_indices[linear_idx];
+    keys[linear_idx] = uint32_t(voxel_index[idx * 3 + dim]) ^ 0x80000000u;
+}
+
+__global__ void MarkVoxelBeginKernel(
+        int64_t* __restrict__ flags,
+        int64_t num_points,
+        const int32_t* const __restrict__ voxel_index,
+        const int64_t* const __restrict__ point_indices) {
+    const int64_t linear_idx = VoxelPoolingLinearIdx();
+    if (linear_idx >= num_points) return;
+
+    int64_t flag = 1;
+    if (linear_idx > 0) {
+        const int64_t a = point_indices[linear_idx - 1] * 3;
+        const int64_t b = point_indices[linear_idx] * 3;
+        flag = voxel_index[a + 0] != voxel_index[b + 0] ||
+               voxel_index[a + 1] != voxel_index[b + 1] ||
+               voxel_index[a + 2] != voxel_index[b + 2];
+    }
+    flags[linear_idx] = flag;
+}
+
+__global__ void ComputeVoxelRowSplitsKernel(
+        int64_t* __restrict__ row_splits,
+        int64_t num_points,
+        const int64_t* const __restrict__ voxel_ids) {
+    const int64_t linear_idx = VoxelPoolingLinearIdx();
+    if (linear_idx >= num_points) return;
+
+    // voxel_ids is the inclusive sum of the begin flags and starts with 1
+    const int64_t id = voxel_ids[linear_idx];
+    if (linear_idx == 0 || id != voxel_ids[linear_idx - 1]) {
+        row_splits[id - 1] = linear_idx;
+    }
+    if (linear_idx == num_points - 1) {
+        row_splits[id] = num_points;
+    }
+}
+
+template <class TReal>
+__global__ void PoolPositionsKernel(
+        TReal* __restrict__ out_positions,
+        int64_t* __restrict__ nearest_neighbor,
+        int64_t num_voxels,
+        const int64_t* const __restrict__ row_splits,
+        const int64_t* const __restrict__ point_indices,
+        const int32_t* const __restrict__ voxel_index,
+        const TReal* const __restrict__ points,
+        const TReal voxel_size,
+        const AccumulationFn position_fn) {
+    const int64_t linear_idx = VoxelPoolingLinearIdx();
+    if (linear_idx >= num_voxels) return;
+
+    const int64_t begin = row_splits[linear_idx];
+    const int64_t end = row_splits[linear_idx + 1];
+    const TReal half_voxel_size = TReal(0.5) * voxel_size;
+
+    TReal center[3];
+    for (int i = 0; i < 3; ++i) {
+        center[i] = voxel_index[point_indices[begin] * 3 + i] * voxel_size +
+                    half_voxel_size;
+    }
+
+    // The points of a voxel are sorted by their original index. The strict
+    // comparison picks the same nearest neighbor as the CPU implementation.
+    TReal sum[3] = {0, 0, 0};
+    TReal min_sqr_dist = 0;
+    int64_t nn_idx = point_indices[begin];
+    for (int64_t j = begin; j < end; ++j) {
+        const int64_t idx = point_indices[j];
+        TReal sqr_dist = 0;
+        for (int i = 0; i < 3; ++i) {
+            const TReal p = points[idx * 3 + i];
+            sum[i] += p;
+            sqr_dist += (center[i] - p) * (center[i] - p);
+        }
+        if (j == begin || sqr_dist < min_sqr_dist) {
+            min_sqr_dist = sqr_dist;
+            nn_idx = idx;
+        }
+    }
+    nearest_neighbor[linear_idx] = nn_idx;
+
+    for (int i = 0; i < 3; ++i) {
+        TReal value;
+        if (position_fn == AVERAGE) {
+            value = sum[i] / (end - begin);
+        } else if (position_fn == NEAREST_NEIGHBOR) {
+            value = points[nn_idx * 3 + i];
+        } else {
+            value = center[i];
+        }
+        out_positions[linear_idx * 3 + i] = value;
+    }
+}
+
+template <class TFeat>
+__global__ void PoolFeaturesKernel(
+        TFeat* __restrict__ out_features,
+        int64_t num_voxels,
+        int in_channels,
+        const int64_t* const __restrict__ row_splits,
+        const int64_t* const __restrict__ point_indices,
+        const int64_t* const __restrict__ nearest_neighbor,
+        const TFeat* const __restrict__ features,
+        const AccumulationFn feature_fn) {
+    const int64_t linear_idx = VoxelPoolingLinearIdx();
+    if (linear_idx >= num_voxels * in_channels) return;
+
+    const int64_t voxel = linear_idx / in_channels;
+    const int channel = linear_idx % in_channels;
+    const int64_t begin = row_splits[voxel];
+    const int64_t end = row_splits[voxel + 1];
+
+    TFeat value;
+    if (feature_fn == AVERAGE) {
+        value = 0;
+        for (int64_t j = begin; j < end; ++j) {
+            value += features[point_indices[j] * in_channels + channel];
+        }
+        value /= TFeat(end - begin);
+    } else if (feature_fn == MAX) {
+        value = features[point_indices[begin] * in_channels + channel];
+        for (int64_t j = begin + 1; j < end; ++j) {
+            const TFeat f = features[point_indices[j] * in_channels + channel];
+            value = f > value ? f : value;
+        }
+    } else {
+        value = features[nearest_neighbor[voxel] * in_channels + channel];
+    }
+    out_features[linear_idx] = value;
+}
+
+template <class TFeat>
+__global__ void PoolFeaturesBackpropKernel(
+        TFeat* __restrict__ features_backprop,
+        int64_t num_voxels,
+        int in_channels,
+        const int64_t* const __restrict__ row_splits,
+        const int64_t* const __restrict__ point_indices,
+        const int64_t* const __restrict__ nearest_neighbor,
+        const TFeat* const __restrict__ features,
+        const TFeat* const __restrict__ pooled_features_gradient,
+        const AccumulationFn feature_fn) {
+    const int64_t linear_idx = VoxelPoolingLinearIdx();
+    if (linear_idx >= num_voxels * in_channels) return;
+
+    const int64_t voxel = linear_idx / in_channels;
+    const int channel = linear_idx % in_channels;
+    const int64_t begin = row_splits[voxel];
+    const int64_t end = row_splits[voxel + 1];
+    const TFeat grad = pooled_features_gradient[linear_idx];
+
+    if (feature_fn == AVERAGE) {
+        const TFeat value = grad / TFeat(end - begin);
+        for (int64_t j = begin; j < end; ++j) {
+            features_backprop[point_indices[j] * in_channels + channel] = value;
+        }
+    } else if (feature_fn == MAX) {
+        int64_t max_idx = point_indices[begin];
+        TFeat max_value = features[max_idx * in_channels + channel];
+        for (int64_t j = begin + 1; j < end; ++j) {
+            const int64_t idx = point_indices[j];
+            const TFeat f = features[idx * in_channels + channel];
+            if (f > max_value) {
+                max_value = f;
+                max_idx = idx;
+            }
+        }
+        features_backprop[max_idx * in_channels + channel] = grad;
+    } else {
+        features_backprop[nearest_neighbor[voxel] * in_channels + channel] =
+                grad;
+    }
+}
+
+/// Sorts the points by their integer voxel index in lexicographic order and
+/// computes the row splits that define the voxels. The sort is stable, i.e.
+/// the points of each voxel are ordered by their original index.
+///
+/// \param point_indices    Output array with the sorted point indices.
+///        The array must have space for \p num_points elements.
+///
+/// \param row_splits    Output array with the start index into
+///        \p point_indices for each voxel. The array must have space for
+///        \p num_points + 1 elements.
+///
+/// \param voxel_index    Output array with the integer voxel index for each
+///        point. The shape is [num_points,3].
+///
+/// \return The number of voxels. The returned value is 0 if \p get_temp_size
+///         is true.
+template <class TReal>
+int64_t SortPointsByVoxel(const cudaStream_t& stream,
+                          MemoryAllocation& mem_temp,
+                          bool get_temp_size,
+                          int64_t* point_indices,
+                          int64_t* row_splits,
+                          int32_t* voxel_index,
+                          size_t num_points,
+                          const TReal* const points,
+                          TReal voxel_size) {
+    const int BLOCKSIZE = 128;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid = VoxelPoolingGrid(num_points, block);
+
+    std::pair<int64_t*, size_t> point_indices_alt =
+            mem_temp.Alloc<int64_t>(num_points);
+    std::pair<uint32_t*, size_t> keys = mem_temp.Alloc<uint32_t>(num_points);
+    std::pair<uint32_t*, size_t> keys_alt =
+            mem_temp.Alloc<uint32_t>(num_points);
+
+    cub::DoubleBuffer<int64_t> point_indices_dbuf(point_indices,
+                                                  point_indices_alt.first);
+    cub::DoubleBuffer<uint32_t> keys_dbuf(keys.first, keys_alt.first);
+
+    if (!get_temp_size && num_points) {
+        ComputeVoxelIndexKernel<TReal><<<grid, block, 0, stream>>>(
+                voxel_index, point_indices, num_points, points,
+                TReal(1) / voxel_size);
+    }
+
+    {
+        // Sort with one stable pass per dimension starting with the least
+        // significant dimension.
+        std::pair<void*, size_t> sort_pairs_temp(nullptr, 0);
+        cub::DeviceRadixSort::SortPairs(sort_pairs_temp.first,
+                                        sort_pairs_temp.second, keys_dbuf,
+                                        point_indices_dbuf, num_points, 0,
+                                        sizeof(uint32_t) * 8, stream);
+        sort_pairs_temp = mem_temp.Alloc(sort_pairs_temp.second);
+        if (!get_temp_size && num_points) {
+            for (int dim = 2; dim >= 0; --dim) {
+                GatherSortKeysKernel<<<grid, block, 0, stream>>>(
+                        keys_dbuf.Current(), num_points, voxel_index,
+                        point_indices_dbuf.Current(), dim);
+                cub::DeviceRadixSort::SortPairs(
+                        sort_pairs_temp.first, sort_pairs_temp.second,
+                        keys_dbuf, point_indices_dbuf, num_points, 0,
+                        sizeof(uint32_t) * 8, stream);
+            }
+            if (point_indices_dbuf.Current() != point_indices) {
+                cudaMemcpyAsync(point_indices, point_indices_dbuf.Current(),
+                                sizeof(int64_t) * num_points,
+                                cudaMemcpyDeviceToDevice, stream);
+            }
+        }
+        mem_temp.Free(sort_pairs_temp);
+    }
+    mem_temp.Free(keys_alt);
+    mem_temp.Free(keys);
+    mem_temp.Free(point_indices_alt);
+
+    std::pair<int64_t*, size_t> flags = mem_temp.Alloc<int64_t>(num_points);
+    std::pair<int64_t*, size_t> voxel_ids =
+            mem_temp.Alloc<int64_t>(num_points);
+
+    if (!get_temp_size && num_points) {
+        MarkVoxelBeginKernel<<<grid, block, 0, stream>>>(
+                flags.first, num_points, voxel_index, point_indices);
+    }
+
+    {
+        std::pair<void*, size_t> inclusive_scan_temp(nullptr, 0);
+        cub::DeviceScan::InclusiveSum(inclusive_scan_temp.first,
+                                      inclusive_scan_temp.second, flags.first,
+                                      voxel_ids.first, num_points, stream);
+        inclusive_scan_temp = mem_temp.Alloc(inclusive_scan_temp.second);
+        if (!get_temp_size && num_points) {
+            cub::DeviceScan::InclusiveSum(
+                    inclusive_scan_temp.first, inclusive_scan_temp.second,
+                    flags.first, voxel_ids.first, num_points, stream);
+        }
+        mem_temp.Free(inclusive_scan_temp);
+    }
+
+    int64_t num_voxels = 0;
+    if (!get_temp_size && num_points) {
+        ComputeVoxelRowSplitsKernel<<<grid, block, 0, stream>>>(
+                row_splits, num_points, voxel_ids.first);
+
+        cudaMemcpyAsync(&num_voxels, voxel_ids.first + num_points - 1,
+                        sizeof(int64_t), cudaMemcpyDeviceToHost, stream);
+        // wait for the async copies
+        while (cudaErrorNotReady == cudaStreamQuery(stream)) { /*empty*/
+        }
+    }
+    mem_temp.Free(voxel_ids);
+    mem_temp.Free(flags);
+
+    return num_voxels;
+}
+
+}  // namespace
+
+/// CUDA implementation of VoxelPooling. Aggregates points that are inside
+/// the same voxel.
+///
+/// The pooled points are ordered by their integer voxel index in
+/// lexicographic order, which makes the result independent of the thread
+/// scheduling. VoxelPoolingBackpropCUDA relies on this order.
+///
+/// All pointer arguments point to device memory unless stated otherwise.
+///
+/// \param stream    The cuda stream for all kernel launches.
+///
+/// \param temp    Pointer to temporary memory. If nullptr then the required
+///        size of temporary memory will be written to \p temp_size and no
+///        work is done.
+///
+/// \param temp_size    The size of the temporary memory in bytes. This is
+///        used as an output if temp is nullptr
+///
+/// \param texture_alignment    The texture alignment in bytes. This is used
+///        for allocating segments within the temporary memory.
+///
+/// \param output_allocator    An object that implements functions for
+///         allocating the output arrays. See \p VoxelPooling for the
+///         requirements. The functions must allocate device memory.
+///
+/// See \p VoxelPooling for the description of the remaining parameters.
+///
+template <class TReal, class TFeat, class OUTPUT_ALLOCATOR>
+void VoxelPoolingCUDA(const cudaStream_t& stream,
+                      void* temp,
+                      size_t& temp_size,
+                      int texture_alignment,
+                      size_t num_inp,
+                      const TReal* const inp_positions,
+                      int in_channels,
+                      const TFeat* inp_features,
+                      TReal voxel_size,
+                      OUTPUT_ALLOCATOR& output_allocator,
+                      AccumulationFn position_fn,
+                      AccumulationFn feature_fn) {
+    const bool get_temp_size = !temp;
+
+    if (get_temp_size) {
+        temp = (char*)1;  // worst case pointer alignment
+        temp_size = std::numeric_limits<int64_t>::max();
+    }
+
+    MemoryAllocation mem_temp(temp, temp_size, texture_alignment);
+
+    std::pair<int64_t*, size_t> point_indices =
+            mem_temp.Alloc<int64_t>(num_inp);
+    std::pair<int64_t*, size_t> row_splits =
+            mem_temp.Alloc<int64_t>(num_inp + 1);
+    std::pair<int32_t*, size_t> voxel_index =
+            mem_temp.Alloc<int32_t>(3 * num_inp);
+
+    const int64_t num_voxels = SortPointsByVoxel(
+            stream, mem_temp, get_temp_size, point_indices.first,
+            row_splits.first, voxel_index.first, num_inp, inp_positions,
+            voxel_size);
+
+    std::pair<int64_t*, size_t> nearest_neighbor =
+            mem_temp.Alloc<int64_t>(num_inp);
+
+    if (get_temp_size) {
+        // return the memory peak as the required temporary memory size.
+        temp_size = mem_temp.MaxUsed();
+        return;
+    }
+
+    TReal* out_pos_ptr;
+    TFeat* out_feat_ptr;
+    output_allocator.AllocPooledPositions(&out_pos_ptr, num_voxels);
+    output_allocator.AllocPooledFeatures(&out_feat_ptr, num_voxels,
+                                         in_channels);
+
+    if (num_voxels) {
+        const int BLOCKSIZE = 128;
+        dim3 block(BLOCKSIZE, 1, 1);
+        dim3 grid = VoxelPoolingGrid(num_voxels, block);
+        PoolPositionsKernel<TReal><<<grid, block, 0, stream>>>(
+                out_pos_ptr, nearest_neighbor.first, num_voxels,
+                row_splits.first, point_indices.first, voxel_index.first,
+                inp_positions, voxel_size, position_fn);
+
+        if (in_channels) {
+            grid = VoxelPoolingGrid(num_voxels * in_channels, block);
+            PoolFeaturesKernel<TFeat><<<grid, block, 0, stream>>>(
+                    out_feat_ptr, num_voxels, in_channels, row_splits.first,
+                    point_indices.first, nearest_neighbor.first, inp_features,
+                    feature_fn);
+        }
+    }
+}
+
+/// CUDA implementation of VoxelPoolingBackprop.
+///
+/// The gradient \p pooled_features_gradient must use the order of the
+/// pooled points returned by VoxelPoolingCUDA for the same input.
+/// \p pooled_positions is not used and only exists for consistency with
+/// the CPU implementation.
+///
+/// See \p VoxelPoolingCUDA and \p VoxelPoolingBackprop for the description
+/// of the parameters.
+///
+template <class TReal, class TFeat>
+void VoxelPoolingBackpropCUDA(const cudaStream_t& stream,
+                              void* temp,
+                              size_t& temp_size,
+                              int texture_alignment,
+                              TFeat* features_backprop,
+                              size_t num_inp,
+                              const TReal* const inp_positions,
+                              int in_channels,
+                              const TFeat* const inp_features,
+                              size_t num_pooled,
+                              const TReal* const pooled_positions,
+                              const TFeat* const pooled_features_gradient,
+                              TReal voxel_size,
+                              AccumulationFn position_fn,
+                              AccumulationFn feature_fn) {
+    const bool get_temp_size = !temp;
+
+    if (get_temp_size) {
+        temp = (char*)1;  // worst case pointer alignment
+        temp_size = std::numeric_limits<int64_t>::max();
+    }
+
+    MemoryAllocation mem_temp(temp, temp_size, texture_alignment);
+
+    std::pair<int64_t*, size_t> point_indices =
+            mem_temp.Alloc<int64_t>(num_inp);
+    std::pair<int64_t*, size_t> row_splits =
+            mem_temp.Alloc<int64_t>(num_inp + 1);
+    std::pair<int32_t*, size_t> voxel_index =
+            mem_temp.Alloc<int32_t>(3 * num_inp);
+
+    const int64_t num_voxels = SortPointsByVoxel(
+            stream, mem_temp, get_temp_size, point_indices.first,
+            row_splits.first, voxel_index.first, num_inp, inp_positions,
+            voxel_size);
+
+    std::pair<int64_t*, size_t> nearest_neighbor =
+            mem_temp.Alloc<int64_t>(num_inp);
+    std::pair<TReal*, size_t> tmp_positions =
+            mem_temp.Alloc<TReal>(3 * num_inp);
+
+    if (get_temp_size) {
+        // return the memory peak as the required temporary memory size.
+        temp_size = mem_temp.MaxUsed();
+        return;
+    }
+
+    if (num_inp == 0) {
+        return;
+    }
+    cudaMemsetAsync(features_backprop, 0,
+                    sizeof(TFeat) * num_inp * in_channels, stream);
+
+    const int BLOCKSIZE = 128;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid = VoxelPoolingGrid(num_voxels, block);
+    PoolPositionsKernel<TReal><<<grid, block, 0, stream>>>(
+            tmp_positions.first, nearest_neighbor.first, num_voxels,
+            row_splits.first, point_indices.first, voxel_index.first,
+            inp_positions, voxel_size, position_fn);
+
+    if (in_channels) {
+        grid = VoxelPoolingGrid(num_voxels * in_channels, block);
+        PoolFeaturesBackpropKernel<TFeat><<<grid, block, 0, stream>>>(
+                features_backprop, num_voxels, in_channels, row_splits.first,
+                point_indices.first, nearest_neighbor.first, inp_features,
+                pooled_features_gradient, feature_fn);
+    }
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
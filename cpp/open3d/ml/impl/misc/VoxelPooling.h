@@ -84,7 +84,11 @@ public:
         } else if (FEAT_FN == NEAREST_NEIGHBOR && new_nearest_neighbor) {
             features_ = feat;
         } else if (FEAT_FN == MAX) {
-            features_ = features_.max(feat);
+            if (count_ == 0) {
+                features_ = feat;
+            } else {
+                features_ = features_.max(feat);
+            }
         }
         ++count_;
     }
@@ -29,6 +29,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
 
+#include <cstring>
 #include <vector>
 
 #include "open3d/core/Atomic.h"
@@ -33,8 +33,8 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
-void ContinuousConvBackpropFilterCUDA(
+template <class TFeat, class TReal, class TIndex>
+void ContinuousConvBackpropFilterCUDAImpl(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
         const torch::Tensor& extents,
@@ -70,19 +70,19 @@ void ContinuousConvBackpropFilterCUDA(
     size_t max_temp_size = 0;
 
     // determine temp_size
-    CConvBackpropFilterCUDA<TReal, TIndex>(
+    CConvBackpropFilterCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            filter_backprop.data_ptr<TReal>(), filter_dims,
+            (TFeat*)filter_backprop.data_ptr(), filter_dims,
             out_positions.size(0), out_positions.data_ptr<TReal>(),
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeat*)inp_features.data_ptr(),
             inp_importance.size(0) ? inp_importance.data_ptr<TReal>() : nullptr,
             neighbors_index.size(0), neighbors_index.data_ptr<TIndex>(),
             neighbors_importance.size(0)
                     ? neighbors_importance.data_ptr<TReal>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(), extents.data_ptr<TReal>(),
-            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TReal>(),
+            offset.data_ptr<TReal>(), (TFeat*)out_features_gradient.data_ptr(),
             interpolation, coordinate_mapping, align_corners,
             individual_extents, isotropic_extents, normalize);
 
@@ -93,22 +93,58 @@ void ContinuousConvBackpropFilterCUDA(
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
     // actually run the operation
-    CConvBackpropFilterCUDA<TReal, TIndex>(
+    CConvBackpropFilterCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            filter_backprop.data_ptr<TReal>(), filter_dims,
+            (TFeat*)filter_backprop.data_ptr(), filter_dims,
             out_positions.size(0), out_positions.data_ptr<TReal>(),
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeat*)inp_features.data_ptr(),
             inp_importance.size(0) ? inp_importance.data_ptr<TReal>() : nullptr,
             neighbors_index.size(0), neighbors_index.data_ptr<TIndex>(),
             neighbors_importance.size(0)
                     ? neighbors_importance.data_ptr<TReal>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(), extents.data_ptr<TReal>(),
-            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TReal>(),
+            offset.data_ptr<TReal>(), (TFeat*)out_features_gradient.data_ptr(),
             interpolation, coordinate_mapping, align_corners,
             individual_extents, isotropic_extents, normalize);
 }
+
+template <class TReal, class TIndex>
+void ContinuousConvBackpropFilterCUDA(
+        const torch::Tensor& filters,
+        const torch::Tensor& out_positions,
+        const torch::Tensor& extents,
+        const torch::Tensor& offset,
+        const torch::Tensor& inp_positions,
+        const torch::Tensor& inp_features,
+        const torch::Tensor& inp_importance,
+        const torch::Tensor& neighbors_index,
+        const torch::Tensor& neighbors_importance,
+        const torch::Tensor& neighbors_row_splits,
+        const torch::Tensor& out_features_gradient,
+        const bool align_corners,
+        const open3d::ml::impl::CoordinateMapping coordinate_mapping,
+        const bool normalize,
+        const open3d::ml::impl::InterpolationMode interpolation,
+        const int64_t max_temp_mem_MB,
+        torch::Tensor& filter_backprop) {
+    if (filters.scalar_type() == torch::kFloat16) {
+        ContinuousConvBackpropFilterCUDAImpl<half, TReal, TIndex>(
+                filters, out_positions, extents, offset, inp_positions,
+                inp_features, inp_importance, neighbors_index,
+                neighbors_importance, neighbors_row_splits,
+                out_features_gradient, align_corners, coordinate_mapping,
+                normalize, interpolation, max_temp_mem_MB, filter_backprop);
+    } else {
+        ContinuousConvBackpropFilterCUDAImpl<TReal, TReal, TIndex>(
+                filters, out_positions, extents, offset, inp_positions,
+                inp_features, inp_importance, neighbors_index,
+                neighbors_importance, neighbors_row_splits,
+                out_features_gradient, align_corners, coordinate_mapping,
+                normalize, interpolation, max_temp_mem_MB, filter_backprop);
+    }
+}
 #define INSTANTIATE(TReal, TIndex)                                            \
     template void ContinuousConvBackpropFilterCUDA<TReal, TIndex>(            \
             const torch::Tensor& filters, const torch::Tensor& out_positions, \
@@ -34,23 +34,23 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
-void ContinuousConvCUDA(const torch::Tensor& filters,
-                        const torch::Tensor& out_positions,
-                        const torch::Tensor& extents,
-                        const torch::Tensor& offset,
-                        const torch::Tensor& inp_positions,
-                        const torch::Tensor& inp_features,
-                        const torch::Tensor& inp_importance,
-                        const torch::Tensor& neighbors_index,
-                        const torch::Tensor& neighbors_importance,
-                        const torch::Tensor& neighbors_row_splits,
-                        const bool align_corners,
-                        const CoordinateMapping coordinate_mapping,
-                        const bool normalize,
-                        const InterpolationMode interpolation,
-                        const int64_t max_temp_mem_MB,
-                        torch::Tensor& out_features) {
+template <class TFeat, class TReal, class TIndex>
+void ContinuousConvCUDAImpl(const torch::Tensor& filters,
+                            const torch::Tensor& out_positions,
+                            const torch::Tensor& extents,
+                            const torch::Tensor& offset,
+                            const torch::Tensor& inp_positions,
+                            const torch::Tensor& inp_features,
+                            const torch::Tensor& inp_importance,
+                            const torch::Tensor& neighbors_index,
+                            const torch::Tensor& neighbors_importance,
+                            const torch::Tensor& neighbors_row_splits,
+                            const bool align_corners,
+                            const CoordinateMapping coordinate_mapping,
+                            const bool normalize,
+                            const InterpolationMode interpolation,
+                            const int64_t max_temp_mem_MB,
+                            torch::Tensor& out_features) {
     const bool individual_extents = extents.size(0) > 1;
     const bool isotropic_extents = extents.size(1) == 1;
     std::vector<int> filter_dims;
@@ -69,12 +69,12 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
     size_t max_temp_size = 0;
 
     // determine temp_size
-    CConvComputeFeaturesCUDA<TReal, TIndex>(
+    CConvComputeFeaturesCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeat*)out_features.data_ptr(), filter_dims,
+            (TFeat*)filters.data_ptr(), out_positions.size(0),
             out_positions.data_ptr<TReal>(), inp_positions.size(0),
-            inp_positions.data_ptr<TReal>(), inp_features.data_ptr<TReal>(),
+            inp_positions.data_ptr<TReal>(), (TFeat*)inp_features.data_ptr(),
             inp_importance.size(0) ? inp_importance.data_ptr<TReal>() : nullptr,
             neighbors_index.size(0), neighbors_index.data_ptr<TIndex>(),
             neighbors_importance.size(0)
@@ -91,12 +91,12 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
     // actually run the operation
-    CConvComputeFeaturesCUDA<TReal, TIndex>(
+    CConvComputeFeaturesCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeat*)out_features.data_ptr(), filter_dims,
+            (TFeat*)filters.data_ptr(), out_positions.size(0),
             out_positions.data_ptr<TReal>(), inp_positions.size(0),
-            inp_positions.data_ptr<TReal>(), inp_features.data_ptr<TReal>(),
+            inp_positions.data_ptr<TReal>(), (TFeat*)inp_features.data_ptr(),
             inp_importance.size(0) ? inp_importance.data_ptr<TReal>() : nullptr,
             neighbors_index.size(0), neighbors_index.data_ptr<TIndex>(),
             neighbors_importance.size(0)
@@ -106,6 +106,40 @@ void ContinuousConvCUDA(const torch::Tensor& filters,
             offset.data_ptr<TReal>(), interpolation, coordinate_mapping,
             align_corners, individual_extents, isotropic_extents, normalize);
 }
+
+template <class TReal, class TIndex>
+void ContinuousConvCUDA(const torch::Tensor& filters,
+                        const torch::Tensor& out_positions,
+                        const torch::Tensor& extents,
+                        const torch::Tensor& offset,
+                        const torch::Tensor& inp_positions,
+                        const torch::Tensor& inp_features,
+                        const torch::Tensor& inp_importance,
+                        const torch::Tensor& neighbors_index,
+                        const torch::Tensor& neighbors_importance,
+                        const torch::Tensor& neighbors_row_splits,
+                        const bool align_corners,
+                        const CoordinateMapping coordinate_mapping,
+                        const bool normalize,
+                        const InterpolationMode interpolation,
+                        const int64_t max_temp_mem_MB,
+                        torch::Tensor& out_features) {
+    if (filters.scalar_type() == torch::kFloat16) {
+        ContinuousConvCUDAImpl<half, TReal, TIndex>(
+                filters, out_positions, extents, offset, inp_positions,
+                inp_features, inp_importance, neighbors_index,
+                neighbors_importance, neighbors_row_splits, align_corners,
+                coordinate_mapping, normalize, interpolation, max_temp_mem_MB,
+                out_features);
+    } else {
+        ContinuousConvCUDAImpl<TReal, TReal, TIndex>(
+                filters, out_positions, extents, offset, inp_positions,
+                inp_features, inp_importance, neighbors_index,
+                neighbors_importance, neighbors_row_splits, align_corners,
+                coordinate_mapping, normalize, interpolation, max_temp_mem_MB,
+                out_features);
+    }
+}
 #define INSTANTIATE(TReal, TIndex)                                            \
     template void ContinuousConvCUDA<TReal, TIndex>(                          \
             const torch::Tensor& filters, const torch::Tensor& out_positions, \
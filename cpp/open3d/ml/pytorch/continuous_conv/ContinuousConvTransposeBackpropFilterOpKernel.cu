@@ -33,8 +33,8 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
-void ContinuousConvTransposeBackpropFilterCUDA(
+template <class TFeat, class TReal, class TIndex>
+void ContinuousConvTransposeBackpropFilterCUDAImpl(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
         const torch::Tensor& out_importance,
@@ -72,13 +72,13 @@ void ContinuousConvTransposeBackpropFilterCUDA(
     size_t max_temp_size = 0;
 
     // determine temp_size
-    CConvTransposeBackpropFilterCUDA<TReal, TIndex>(
+    CConvTransposeBackpropFilterCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            filter_backprop.data_ptr<TReal>(), filter_dims,
+            (TFeat*)filter_backprop.data_ptr(), filter_dims,
             out_positions.size(0), out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeat*)inp_features.data_ptr(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -88,7 +88,7 @@ void ContinuousConvTransposeBackpropFilterCUDA(
                     ? neighbors_importance.data_ptr<TReal>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(), extents.data_ptr<TReal>(),
-            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TReal>(),
+            offset.data_ptr<TReal>(), (TFeat*)out_features_gradient.data_ptr(),
             interpolation, coordinate_mapping, align_corners,
             individual_extents, isotropic_extents, normalize);
 
@@ -99,13 +99,13 @@ void ContinuousConvTransposeBackpropFilterCUDA(
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
     // actually run the operation
-    CConvTransposeBackpropFilterCUDA<TReal, TIndex>(
+    CConvTransposeBackpropFilterCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            filter_backprop.data_ptr<TReal>(), filter_dims,
+            (TFeat*)filter_backprop.data_ptr(), filter_dims,
             out_positions.size(0), out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeat*)inp_features.data_ptr(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -115,10 +115,50 @@ void ContinuousConvTransposeBackpropFilterCUDA(
                     ? neighbors_importance.data_ptr<TReal>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(), extents.data_ptr<TReal>(),
-            offset.data_ptr<TReal>(), out_features_gradient.data_ptr<TReal>(),
+            offset.data_ptr<TReal>(), (TFeat*)out_features_gradient.data_ptr(),
             interpolation, coordinate_mapping, align_corners,
             individual_extents, isotropic_extents, normalize);
 }
+
+template <class TReal, class TIndex>
+void ContinuousConvTransposeBackpropFilterCUDA(
+        const torch::Tensor& filters,
+        const torch::Tensor& out_positions,
+        const torch::Tensor& out_importance,
+        const torch::Tensor& extents,
+        const torch::Tensor& offset,
+        const torch::Tensor& inp_positions,
+        const torch::Tensor& inp_features,
+        const torch::Tensor& inp_neighbors_importance_sum,
+        const torch::Tensor& inp_neighbors_row_splits,
+        const torch::Tensor& neighbors_index,
+        const torch::Tensor& neighbors_importance,
+        const torch::Tensor& neighbors_row_splits,
+        const torch::Tensor& out_features_gradient,
+        const bool align_corners,
+        const CoordinateMapping coordinate_mapping,
+        const bool normalize,
+        const InterpolationMode interpolation,
+        const int64_t max_temp_mem_MB,
+        torch::Tensor& filter_backprop) {
+    if (filters.scalar_type() == torch::kFloat16) {
+        ContinuousConvTransposeBackpropFilterCUDAImpl<half, TReal, TIndex>(
+                filters, out_positions, out_importance, extents, offset,
+                inp_positions, inp_features, inp_neighbors_importance_sum,
+                inp_neighbors_row_splits, neighbors_index, neighbors_importance,
+                neighbors_row_splits, out_features_gradient, align_corners,
+                coordinate_mapping, normalize, interpolation, max_temp_mem_MB,
+                filter_backprop);
+    } else {
+        ContinuousConvTransposeBackpropFilterCUDAImpl<TReal, TReal, TIndex>(
+                filters, out_positions, out_importance, extents, offset,
+                inp_positions, inp_features, inp_neighbors_importance_sum,
+                inp_neighbors_row_splits, neighbors_index, neighbors_importance,
+                neighbors_row_splits, out_features_gradient, align_corners,
+                coordinate_mapping, normalize, interpolation, max_temp_mem_MB,
+                filter_backprop);
+    }
+}
 #define INSTANTIATE(TReal, TIndex)                                             \
     template void ContinuousConvTransposeBackpropFilterCUDA<TReal, TIndex>(    \
             const torch::Tensor& filters, const torch::Tensor& out_positions,  \
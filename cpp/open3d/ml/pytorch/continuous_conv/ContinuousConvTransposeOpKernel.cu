@@ -34,8 +34,8 @@
 
 using namespace open3d::ml::impl;
 
-template <class TReal, class TIndex>
-void ContinuousConvTransposeCUDA(
+template <class TFeat, class TReal, class TIndex>
+void ContinuousConvTransposeCUDAImpl(
         const torch::Tensor& filters,
         const torch::Tensor& out_positions,
         const torch::Tensor& out_importance,
@@ -73,14 +73,14 @@ void ContinuousConvTransposeCUDA(
     size_t max_temp_size = 0;
 
     // determine temp_size
-    CConvTransposeComputeFeaturesCUDA<TReal, TIndex>(
+    CConvTransposeComputeFeaturesCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeat*)out_features.data_ptr(), filter_dims,
+            (TFeat*)filters.data_ptr(), out_positions.size(0),
             out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeat*)inp_features.data_ptr(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -100,14 +100,14 @@ void ContinuousConvTransposeCUDA(
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
     // actually run the operation
-    CConvTransposeComputeFeaturesCUDA<TReal, TIndex>(
+    CConvTransposeComputeFeaturesCUDA<TReal, TIndex, TFeat>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
-            out_features.data_ptr<TReal>(), filter_dims,
-            filters.data_ptr<TReal>(), out_positions.size(0),
+            (TFeat*)out_features.data_ptr(), filter_dims,
+            (TFeat*)filters.data_ptr(), out_positions.size(0),
             out_positions.data_ptr<TReal>(),
             out_importance.size(0) ? out_importance.data_ptr<TReal>() : nullptr,
             inp_positions.size(0), inp_positions.data_ptr<TReal>(),
-            inp_features.data_ptr<TReal>(),
+            (TFeat*)inp_features.data_ptr(),
             inp_neighbors_importance_sum.size(0)
                     ? inp_neighbors_importance_sum.data_ptr<TReal>()
                     : nullptr,
@@ -120,6 +120,46 @@ void ContinuousConvTransposeCUDA(
             offset.data_ptr<TReal>(), interpolation, coordinate_mapping,
             align_corners, individual_extents, isotropic_extents, normalize);
 }
+
+template <class TReal, class TIndex>
+void ContinuousConvTransposeCUDA(
+        const torch::Tensor& filters,
+        const torch::Tensor& out_positions,
+        const torch::Tensor& out_importance,
+        const torch::Tensor& extents,
+        const torch::Tensor& offset,
+        const torch::Tensor& inp_positions,
+        const torch::Tensor& inp_features,
+        const torch::Tensor& inp_neighbors_index,
+        const torch::Tensor& inp_neighbors_importance_sum,
+        const torch::Tensor& inp_neighbors_row_splits,
+        const torch::Tensor& neighbors_index,
+        const torch::Tensor& neighbors_importance,
+        const torch::Tensor& neighbors_row_splits,
+        const bool align_corners,
+        const CoordinateMapping coordinate_mapping,
+        const bool normalize,
+        const InterpolationMode interpolation,
+        const int64_t max_temp_mem_MB,
+        torch::Tensor& out_features) {
+    if (filters.scalar_type() == torch::kFloat16) {
+        ContinuousConvTransposeCUDAImpl<half, TReal, TIndex>(
+                filters, out_positions, out_importance, extents, offset,
+                inp_positions, inp_features, inp_neighbors_index,
+                inp_neighbors_importance_sum, inp_neighbors_row_splits,
+                neighbors_index, neighbors_importance, neighbors_row_splits,
+                align_corners, coordinate_mapping, normalize, interpolation,
+                max_temp_mem_MB, out_features);
+    } else {
+        ContinuousConvTransposeCUDAImpl<TReal, TReal, TIndex>(
+                filters, out_positions, out_importance, extents, offset,
+                inp_positions, inp_features, inp_neighbors_index,
+                inp_neighbors_importance_sum, inp_neighbors_row_splits,
+                neighbors_index, neighbors_importance, neighbors_row_splits,
+                align_corners, coordinate_mapping, normalize, interpolation,
+                max_temp_mem_MB, out_features);
+    }
+}
 #define INSTANTIATE(TReal, TIndex)                                             \
     template void ContinuousConvTransposeCUDA<TReal, TIndex>(                  \
             const torch::Tensor& filters, const torch::Tensor& out_positions,  \
@@ -73,8 +73,14 @@ public:
         CHECK_TYPE(neighbors_row_splits, kInt64);
         CHECK_TYPE(inp_neighbors_row_splits, kInt64);
         CHECK_SAME_DTYPE(neighbors_index, inp_neighbors_index);
-        CHECK_SAME_DTYPE(filters, out_positions, extents, offset, inp_positions,
-                         inp_features, out_importance, neighbors_importance);
+        CHECK_SAME_DTYPE(filters, inp_features);
+        CHECK_SAME_DTYPE(out_positions, extents, offset, inp_positions,
+                         out_importance, neighbors_importance);
+        // the CUDA kernels support half filters and features with float
+        // positions and importance
+        if (filters.scalar_type() != torch::kFloat16 || !filters.is_cuda()) {
+            CHECK_SAME_DTYPE(filters, out_positions);
+        }
         CHECK_SAME_DEVICE_TYPE(filters, out_positions, inp_positions,
                                inp_features, out_importance);
 
@@ -143,12 +149,13 @@ public:
                                 inp_neighbors_row_splits, neighbors_index,
                                 neighbors_importance, neighbors_row_splits});
 
-        const auto& real_dtype = filters.dtype();
+        const auto& real_dtype = out_positions.dtype();
+        const auto& feat_dtype = filters.dtype();
         const auto& index_dtype = neighbors_index.dtype();
 
         torch::Tensor out_features =
                 torch::empty({num_out_points.value(), out_channels.value()},
-                             torch::dtype(real_dtype).device(device));
+                             torch::dtype(feat_dtype).device(device));
 #define FN_PARAMETERS                                                        \
     filters, out_positions, out_importance, extents, offset, inp_positions,  \
             inp_features, inp_neighbors_index, inp_neighbors_importance_sum, \
@@ -217,7 +224,8 @@ public:
         auto neighbors_row_splits = saved_vars[11];
 
         auto device = inp_features.device();
-        const auto& real_dtype = filters.dtype();
+        const auto& real_dtype = out_positions.dtype();
+        const auto& feat_dtype = filters.dtype();
         const auto& index_dtype = neighbors_index.dtype();
         auto out_features_gradient = grad_output[0].contiguous();
         CHECK_SAME_DTYPE(out_features_gradient, inp_features, filters);
@@ -231,7 +239,7 @@ public:
     if (CompareTorchDtype<real_t>(real_dtype) &&                              \
         CompareTorchDtype<index_t>(index_dtype)) {                            \
         filters_backprop = torch::empty(                                      \
-                filters.sizes(), torch::dtype(real_dtype).device(device));    \
+                filters.sizes(), torch::dtype(feat_dtype).device(device));    \
         ContinuousConvTransposeBackpropFilter##fn_suffix<real_t, index_t>(    \
                 filters, out_positions, out_importance, extents, offset,      \
                 inp_positions, inp_features, inp_neighbors_importance_sum,    \
@@ -249,7 +257,7 @@ public:
                                     neighbors_importance);                    \
         inp_features_backprop =                                               \
                 torch::ones(inp_features.sizes(),                             \
-                            torch::dtype(real_dtype).device(device));         \
+                            torch::dtype(feat_dtype).device(device));         \
         auto filters_transposed = filters.transpose(3, 4).contiguous();       \
                                                                               \
         ContinuousConv##fn_suffix<real_t, index_t>(                           \
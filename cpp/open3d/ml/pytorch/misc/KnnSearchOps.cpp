@@ -45,6 +45,20 @@ void KnnSearchCPU(const torch::Tensor& points,
                   torch::Tensor& neighbors_index,
                   torch::Tensor& neighbors_row_splits,
                   torch::Tensor& neighbors_distance);
+#ifdef BUILD_CUDA_MODULE
+template <class T>
+void KnnSearchCUDA(const torch::Tensor& points,
+                   const torch::Tensor& queries,
+                   const int64_t k,
+                   const torch::Tensor& points_row_splits,
+                   const torch::Tensor& queries_row_splits,
+                   const Metric metric,
+                   const bool ignore_query_point,
+                   const bool return_distances,
+                   torch::Tensor& neighbors_index,
+                   torch::Tensor& neighbors_row_splits,
+                   torch::Tensor& neighbors_distance);
+#endif
 
 std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> KnnSearch(
         torch::Tensor points,
@@ -112,7 +126,13 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> KnnSearch(
     }
 
     if (points.is_cuda()) {
-        TORCH_CHECK(false, "KnnSearch does not support CUDA")
+#ifdef BUILD_CUDA_MODULE
+        // pass to cuda function
+        CALL(float, KnnSearchCUDA)
+        CALL(double, KnnSearchCUDA)
+#else
+        TORCH_CHECK(false, "KnnSearch was not compiled with CUDA support")
+#endif
     } else {
         CALL(float, KnnSearchCPU)
         CALL(double, KnnSearchCPU)
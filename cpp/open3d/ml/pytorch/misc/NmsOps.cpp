@@ -30,18 +30,15 @@
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "torch/script.h"
 
-torch::Tensor Nms(torch::Tensor boxes,
-                  torch::Tensor scores,
-                  double nms_overlap_thresh) {
-    boxes = boxes.contiguous();
-    CHECK_TYPE(boxes, kFloat);
-    CHECK_TYPE(scores, kFloat);
-
+static torch::Tensor NmsWithLabels(torch::Tensor boxes,
+                                   torch::Tensor scores,
+                                   const int64_t *labels,
+                                   double nms_overlap_thresh) {
     if (boxes.is_cuda()) {
 #ifdef BUILD_CUDA_MODULE
         std::vector<int64_t> keep_indices = open3d::ml::contrib::NmsCUDAKernel(
                 boxes.data_ptr<float>(), scores.data_ptr<float>(),
-                boxes.size(0), nms_overlap_thresh);
+                boxes.size(0), nms_overlap_thresh, labels);
         return torch::from_blob(keep_indices.data(),
                                 {static_cast<int64_t>(keep_indices.size())},
                                 torch::TensorOptions().dtype(torch::kLong))
@@ -53,7 +50,7 @@ torch::Tensor Nms(torch::Tensor boxes,
     } else {
         std::vector<int64_t> keep_indices = open3d::ml::contrib::NmsCPUKernel(
                 boxes.data_ptr<float>(), scores.data_ptr<float>(),
-                boxes.size(0), nms_overlap_thresh);
+                boxes.size(0), nms_overlap_thresh, labels);
         return torch::from_blob(keep_indices.data(),
                                 {static_cast<int64_t>(keep_indices.size())},
                                 torch::TensorOptions().dtype(torch::kLong))
@@ -61,8 +58,40 @@ torch::Tensor Nms(torch::Tensor boxes,
     }
 }
 
+torch::Tensor Nms(torch::Tensor boxes,
+                  torch::Tensor scores,
+                  double nms_overlap_thresh) {
+    boxes = boxes.contiguous();
+    CHECK_TYPE(boxes, kFloat);
+    CHECK_TYPE(scores, kFloat);
+
+    return NmsWithLabels(boxes, scores, nullptr, nms_overlap_thresh);
+}
+
+torch::Tensor BatchedNms(torch::Tensor boxes,
+                         torch::Tensor scores,
+                         torch::Tensor labels,
+                         double nms_overlap_thresh) {
+    boxes = boxes.contiguous();
+    scores = scores.contiguous();
+    labels = labels.contiguous();
+    CHECK_TYPE(boxes, kFloat);
+    CHECK_TYPE(scores, kFloat);
+    CHECK_TYPE(labels, kLong);
+    CHECK_SAME_DEVICE_TYPE(boxes, scores, labels);
+
+    return NmsWithLabels(boxes, scores, labels.data_ptr<int64_t>(),
+                         nms_overlap_thresh);
+}
+
 static auto registry = torch::RegisterOperators(
         "open3d::nms(Tensor boxes, Tensor scores, float "
         "nms_overlap_thresh) -> "
         "Tensor keep_indices",
         &Nms);
+
+static auto registry_batched = torch::RegisterOperators(
+        "open3d::batched_nms(Tensor boxes, Tensor scores, Tensor labels, "
+        "float nms_overlap_thresh) -> "
+        "Tensor keep_indices",
+        &BatchedNms);
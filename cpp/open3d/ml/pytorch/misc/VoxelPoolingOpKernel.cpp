@@ -25,46 +25,14 @@
 // ----------------------------------------------------------------------------
 //
 
+#include "open3d/ml/pytorch/misc/VoxelPoolingOpKernel.h"
+
 #include "open3d/ml/impl/misc/VoxelPooling.h"
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "torch/script.h"
 
 using namespace open3d::ml::impl;
 
-namespace {
-
-template <class TReal, class TFeat>
-class OutputAllocator {
-public:
-    OutputAllocator(torch::DeviceType device_type, int device_idx)
-        : device_type(device_type), device_idx(device_idx) {}
-
-    void AllocPooledPositions(TReal** ptr, size_t num) {
-        positions = torch::empty({int64_t(num), 3},
-                                 torch::dtype(ToTorchDtype<TReal>())
-                                         .device(device_type, device_idx));
-        *ptr = positions.data_ptr<TReal>();
-    }
-
-    void AllocPooledFeatures(TFeat** ptr, size_t num, size_t channels) {
-        features = torch::empty({int64_t(num), int64_t(channels)},
-                                torch::dtype(ToTorchDtype<TFeat>())
-                                        .device(device_type, device_idx));
-        *ptr = features.data_ptr<TFeat>();
-    }
-
-    const torch::Tensor& PooledPositions() const { return positions; }
-    const torch::Tensor& PooledFeatures() const { return features; }
-
-private:
-    torch::Tensor positions;
-    torch::Tensor features;
-    torch::DeviceType device_type;
-    int device_idx;
-};
-
-}  // namespace
-
 template <class TReal, class TFeat>
 std::tuple<torch::Tensor, torch::Tensor> VoxelPoolingCPU(
         const torch::Tensor& positions,
@@ -73,8 +41,8 @@ std::tuple<torch::Tensor, torch::Tensor> VoxelPoolingCPU(
         const AccumulationFn position_fn,
         const AccumulationFn feature_fn,
         const bool debug) {
-    OutputAllocator<TReal, TFeat> output_allocator(positions.device().type(),
-                                                   positions.device().index());
+    VoxelPoolingOutputAllocator<TReal, TFeat> output_allocator(
+            positions.device().type(), positions.device().index());
 
     if (debug) {
         std::string err;
@@ -29,6 +29,7 @@
 
 #include "open3d/ml/impl/misc/VoxelPooling.h"
 #include "open3d/ml/pytorch/TorchHelper.h"
+#include "open3d/ml/pytorch/misc/VoxelPoolingOpKernel.h"
 #include "torch/script.h"
 
 using namespace open3d::ml::impl;
@@ -37,25 +38,6 @@ using torch::autograd::Function;
 using torch::autograd::Variable;
 using torch::autograd::variable_list;
 
-template <class TReal, class TFeat>
-std::tuple<torch::Tensor, torch::Tensor> VoxelPoolingCPU(
-        const torch::Tensor& positions,
-        const torch::Tensor& features,
-        const double voxel_size,
-        const AccumulationFn position_fn,
-        const AccumulationFn feature_fn,
-        const bool debug);
-
-template <class TReal, class TFeat>
-void VoxelPoolingGradCPU(torch::Tensor& features_backprop,
-                         const torch::Tensor& positions,
-                         const torch::Tensor& features,
-                         const torch::Tensor& pooled_positions,
-                         const torch::Tensor& pooled_features_gradient,
-                         const double voxel_size,
-                         const AccumulationFn position_fn,
-                         const AccumulationFn feature_fn);
-
 class VoxelPoolingFunction : public Function<VoxelPoolingFunction> {
 public:
     static variable_list forward(AutogradContext* ctx,
@@ -123,7 +105,19 @@ public:
 
         CHECK_SAME_DEVICE_TYPE(positions, features);
         if (positions.is_cuda()) {
-            TORCH_CHECK(false, "VoxelPooling does not support CUDA")
+#ifdef BUILD_CUDA_MODULE
+            CALL(float, float, VoxelPoolingCUDA)
+            CALL(float, int32_t, VoxelPoolingCUDA)
+            CALL(float, int64_t, VoxelPoolingCUDA)
+            CALL(float, double, VoxelPoolingCUDA)
+            CALL(double, float, VoxelPoolingCUDA)
+            CALL(double, int32_t, VoxelPoolingCUDA)
+            CALL(double, int64_t, VoxelPoolingCUDA)
+            CALL(double, double, VoxelPoolingCUDA)
+#else
+            TORCH_CHECK(false,
+                        "VoxelPooling was not compiled with CUDA support")
+#endif
         } else {
             CALL(float, float, VoxelPoolingCPU)
             CALL(float, int32_t, VoxelPoolingCPU)
@@ -187,8 +181,9 @@ public:
         features = features.contiguous();
         pooled_positions = pooled_positions.contiguous();
 
-        torch::Tensor features_backprop =
-                torch::empty(features.sizes(), features.dtype());
+        torch::Tensor features_backprop = torch::empty(
+                features.sizes(),
+                torch::dtype(features.scalar_type()).device(features.device()));
 
         const auto& positions_type = positions.dtype();
         const auto& features_type = features.dtype();
@@ -205,20 +200,29 @@ public:
     }
 
         CHECK_SAME_DEVICE_TYPE(positions, features);
+        bool dispatch_success = false;
         if (positions.is_cuda()) {
-            TORCH_CHECK(false, "VoxelPooling backward does not support CUDA")
+#ifdef BUILD_CUDA_MODULE
+            CALL(float, float, VoxelPoolingGradCUDA)
+            CALL(float, double, VoxelPoolingGradCUDA)
+            CALL(double, float, VoxelPoolingGradCUDA)
+            CALL(double, double, VoxelPoolingGradCUDA)
+#else
+            TORCH_CHECK(false,
+                        "VoxelPooling backward was not compiled with CUDA "
+                        "support")
+#endif
         } else {
-            bool dispatch_success = false;
             CALL(float, float, VoxelPoolingGradCPU)
             CALL(float, double, VoxelPoolingGradCPU)
             CALL(double, float, VoxelPoolingGradCPU)
             CALL(double, double, VoxelPoolingGradCPU)
-            TORCH_CHECK(dispatch_success,
-                        "VoxelPooling backward does not support " +
-                                positions.toString() +
-                                " as input for positions and " +
-                                features.toString() + " as input for features")
         }
+        TORCH_CHECK(dispatch_success,
+                    "VoxelPooling backward does not support " +
+                            positions.toString() +
+                            " as input for positions and " +
+                            features.toString() + " as input for features")
 #undef FN_PARAMETERS
 #undef CALL
 
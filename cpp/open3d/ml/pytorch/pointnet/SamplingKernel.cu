@@ -48,6 +48,22 @@ void furthest_point_sampling_launcher(
 
     auto stream = at::cuda::getCurrentCUDAStream();
 
+    if (n >= FPS_MULTI_BLOCK_MIN_POINTS) {
+        at::Tensor best = at::empty(
+                {b, m}, at::TensorOptions().dtype(at::kLong).device(
+                                at::kCUDA, at::cuda::current_device()));
+        furthest_point_sampling_multi_block(
+                stream, b, n, m, dataset, temp,
+                reinterpret_cast<unsigned long long *>(best.data_ptr()), idxs);
+        err = cudaGetLastError();
+        if (cudaSuccess != err) {
+            fprintf(stderr, "CUDA kernel failed : %s\n",
+                    cudaGetErrorString(err));
+            exit(-1);
+        }
+        return;
+    }
+
     unsigned int n_threads = opt_n_threads(n);
 
     switch (n_threads) {
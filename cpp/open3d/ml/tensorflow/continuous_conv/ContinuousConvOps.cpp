@@ -238,9 +238,10 @@ interpolation: If interpolation is "linear" then each filter value lookup is a
 
 
 max_temp_mem_MB: Defines the maximum temporary memory in megabytes to be used
-  for the GPU implementation. More memory means fewer kernel invocations. Note
-  that the a minimum amount of temp memory will always be allocated even if 
-  this variable is set to 0.
+  for the GPU implementation. More memory means fewer kernel invocations. If
+  the memory is not sufficient for the intermediate matrix of 32 output points
+  a fused kernel is used which does not need temporary memory. Setting this
+  variable to 0 selects the fused kernel and minimizes the memory usage.
 
 
 filters: The filter parameters. The shape of the filter is 
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#define EIGEN_USE_GPU
+#include "KnnSearchOpKernel.h"
+#include "open3d/ml/Helper.h"
+#include "open3d/ml/impl/misc/KnnSearch.cuh"
+
+using namespace open3d;
+using namespace open3d::ml;
+using namespace open3d::ml::impl;
+using namespace knn_search_opkernel;
+using namespace tensorflow;
+
+template <class T>
+class KnnSearchOpKernelCUDA : public KnnSearchOpKernel {
+public:
+    explicit KnnSearchOpKernelCUDA(OpKernelConstruction* construction)
+        : KnnSearchOpKernel(construction) {
+        texture_alignment = GetCUDACurrentDeviceTextureAlignment();
+    }
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                const tensorflow::Tensor& points,
+                const tensorflow::Tensor& queries,
+                const int k,
+                const tensorflow::Tensor& points_row_splits,
+                const tensorflow::Tensor& queries_row_splits,
+                tensorflow::Tensor& query_neighbors_row_splits) {
+        auto device = context->eigen_gpu_device();
+
+        OutputAllocator<T> output_allocator(context);
+
+        void* temp_ptr = nullptr;
+        size_t temp_size = 0;
+
+        // determine temp_size
+        KnnSearchCUDA(
+                device.stream(), temp_ptr, temp_size, texture_alignment,
+                (int64_t*)query_neighbors_row_splits.flat<int64>().data(),
+                points.shape().dim_size(0), points.flat<T>().data(),
+                queries.shape().dim_size(0), queries.flat<T>().data(),
+                points_row_splits.shape().dim_size(0),
+                (int64_t*)points_row_splits.flat<int64>().data(),
+                queries_row_splits.shape().dim_size(0),
+                (int64_t*)queries_row_splits.flat<int64>().data(), k, metric,
+                ignore_query_point, return_distances, output_allocator);
+
+        Tensor temp_tensor;
+        TensorShape temp_shape({ssize_t(temp_size)});
+        OP_REQUIRES_OK(context,
+                       context->allocate_temp(DataTypeToEnum<uint8_t>::v(),
+                                              temp_shape, &temp_tensor));
+        temp_ptr = temp_tensor.flat<uint8_t>().data();
+
+        // actually run the search
+        KnnSearchCUDA(
+                device.stream(), temp_ptr, temp_size, texture_alignment,
+                (int64_t*)query_neighbors_row_splits.flat<int64>().data(),
+                points.shape().dim_size(0), points.flat<T>().data(),
+                queries.shape().dim_size(0), queries.flat<T>().data(),
+                points_row_splits.shape().dim_size(0),
+                (int64_t*)points_row_splits.flat<int64>().data(),
+                queries_row_splits.shape().dim_size(0),
+                (int64_t*)queries_row_splits.flat<int64>().data(), k, metric,
+                ignore_query_point, return_distances, output_allocator);
+    }
+
+private:
+    int texture_alignment;
+};
+
+#define REG_KB(type)                                                   \
+    REGISTER_KERNEL_BUILDER(Name("Open3DKnnSearch")                    \
+                                    .Device(DEVICE_GPU)                \
+                                    .TypeConstraint<type>("T")         \
+                                    .HostMemory("k")                   \
+                                    .HostMemory("points_row_splits")   \
+                                    .HostMemory("queries_row_splits"), \
+                            KnnSearchOpKernelCUDA<type>);
+REG_KB(float)
+REG_KB(double)
+#undef REG_KB
@@ -32,6 +32,39 @@
 // namespace for code that is common for all kernels
 namespace knn_search_opkernel {
 
+// class for the allocator object
+template <class T>
+class OutputAllocator {
+public:
+    explicit OutputAllocator(tensorflow::OpKernelContext* context)
+        : context(context) {}
+
+    void AllocIndices(int32_t** ptr, size_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({int64_t(num)});
+        OP_REQUIRES_OK(context, context->allocate_output(0, shape, &tensor));
+        auto flat_tensor = tensor->flat<int32>();
+        static_assert(sizeof(int32) == sizeof(int32_t),
+                      "int32 and int32_t not compatible");
+        *ptr = (int32_t*)flat_tensor.data();
+    }
+
+    void AllocDistances(T** ptr, size_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({int64_t(num)});
+        OP_REQUIRES_OK(context, context->allocate_output(2, shape, &tensor));
+        auto flat_tensor = tensor->flat<T>();
+        *ptr = flat_tensor.data();
+    }
+
+private:
+    tensorflow::OpKernelContext* context;
+};
+
 class KnnSearchOpKernel : public tensorflow::OpKernel {
 public:
     explicit KnnSearchOpKernel(tensorflow::OpKernelConstruction* construction)
@@ -38,10 +38,11 @@ public:
 
     void Kernel(tensorflow::OpKernelContext* context,
                 const tensorflow::Tensor& boxes,
-                const tensorflow::Tensor& scores) {
+                const tensorflow::Tensor& scores,
+                const int64_t* labels) {
         std::vector<int64_t> keep_indices = open3d::ml::contrib::NmsCPUKernel(
                 boxes.flat<float>().data(), scores.flat<float>().data(),
-                boxes.dim_size(0), this->nms_overlap_thresh);
+                boxes.dim_size(0), this->nms_overlap_thresh, labels);
 
         OutputAllocator output_allocator(context);
         int64_t* ret_keep_indices = nullptr;
@@ -55,6 +56,10 @@ public:
 #define REG_KB(type)                                                        \
     REGISTER_KERNEL_BUILDER(                                                \
             Name("Open3DNms").Device(DEVICE_CPU).TypeConstraint<type>("T"), \
-            NmsOpKernelCPU);
+            NmsOpKernelCPU);                                                \
+    REGISTER_KERNEL_BUILDER(Name("Open3DBatchedNms")                        \
+                                    .Device(DEVICE_CPU)                     \
+                                    .TypeConstraint<type>("T"),             \
+                            NmsOpKernelCPU);
 REG_KB(float)
 #undef REG_KB
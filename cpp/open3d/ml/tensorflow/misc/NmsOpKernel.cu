@@ -38,10 +38,11 @@ public:
 
     void Kernel(tensorflow::OpKernelContext* context,
                 const tensorflow::Tensor& boxes,
-                const tensorflow::Tensor& scores) {
+                const tensorflow::Tensor& scores,
+                const int64_t* labels) {
         std::vector<int64_t> keep_indices = open3d::ml::contrib::NmsCUDAKernel(
                 boxes.flat<float>().data(), scores.flat<float>().data(),
-                boxes.dim_size(0), this->nms_overlap_thresh);
+                boxes.dim_size(0), this->nms_overlap_thresh, labels);
 
         OutputAllocator output_allocator(context);
         int64_t* ret_keep_indices = nullptr;
@@ -56,6 +57,10 @@ public:
 #define REG_KB(type)                                                        \
     REGISTER_KERNEL_BUILDER(                                                \
             Name("Open3DNms").Device(DEVICE_GPU).TypeConstraint<type>("T"), \
-            NmsOpKernelCUDA);
+            NmsOpKernelCUDA);                                               \
+    REGISTER_KERNEL_BUILDER(Name("Open3DBatchedNms")                        \
+                                    .Device(DEVICE_GPU)                     \
+                                    .TypeConstraint<type>("T"),             \
+                            NmsOpKernelCUDA);
 REG_KB(float)
 #undef REG_KB
@@ -50,7 +50,8 @@ private:
     tensorflow::OpKernelContext* context;
 };
 
-// Base class with common code for the OpKernel implementations
+// Base class with common code for the OpKernel implementations. Also used for
+// the batched op, which has the additional labels input.
 class NmsOpKernel : public tensorflow::OpKernel {
 public:
     explicit NmsOpKernel(tensorflow::OpKernelConstruction* construction)
@@ -64,6 +65,7 @@ public:
         using namespace tensorflow;
         const Tensor& boxes = context->input(0);
         const Tensor& scores = context->input(1);
+        const int64_t* labels = nullptr;
 
         {
             using namespace open3d::ml::op_util;
@@ -71,15 +73,21 @@ public:
             Dim five(5, "five");
             CHECK_SHAPE(context, boxes, num_points, five);
             CHECK_SHAPE(context, scores, num_points);
+            if (context->num_inputs() > 2) {
+                const Tensor& labels_tensor = context->input(2);
+                CHECK_SHAPE(context, labels_tensor, num_points);
+                labels = (const int64_t*)labels_tensor.flat<int64>().data();
+            }
         }
 
-        Kernel(context, boxes, scores);
+        Kernel(context, boxes, scores, labels);
     }
 
     // Function with the device specific code
     virtual void Kernel(tensorflow::OpKernelContext* context,
                         const tensorflow::Tensor& boxes,
-                        const tensorflow::Tensor& scores) = 0;
+                        const tensorflow::Tensor& scores,
+                        const int64_t* labels) = 0;
 
 protected:
     float nms_overlap_thresh;
@@ -61,6 +61,25 @@ public:
 
         cudaError_t err;
 
+        if (n >= FPS_MULTI_BLOCK_MIN_POINTS) {
+            Tensor best_tensor;
+            OP_REQUIRES_OK(context, context->allocate_temp(
+                                            DataTypeToEnum<int64>::value,
+                                            TensorShape{b, m}, &best_tensor));
+            furthest_point_sampling_multi_block(
+                    stream, b, n, m, dataset, temp,
+                    reinterpret_cast<unsigned long long *>(
+                            best_tensor.flat<int64>().data()),
+                    idxs);
+            err = cudaGetLastError();
+            if (cudaSuccess != err) {
+                fprintf(stderr, "CUDA kernel failed : %s\n",
+                        cudaGetErrorString(err));
+                exit(-1);
+            }
+            return;
+        }
+
         unsigned int n_threads = opt_n_threads(n);
 
         switch (n_threads) {
@@ -32,6 +32,7 @@
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/pipelines/color_map/ImageWarpingField.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -51,38 +52,48 @@ static std::tuple<float, float, float> Project3DPointAndGetUVDepth(
     return std::make_tuple(u, v, z);
 }
 
-template <typename T>
-static std::tuple<bool, T> QueryImageIntensity(
+/// Projects \p V into \p img, displaced by \p warping_field if it is not
+/// nullptr, and returns the pixel it falls into if it is inside the image
+/// boundary margin.
+static std::tuple<bool, int, int> QueryImagePixel(
         const geometry::Image& img,
-        const utility::optional<ImageWarpingField>& optional_warping_field,
+        const ImageWarpingField* warping_field,
         const Eigen::Vector3d& V,
         const camera::PinholeCameraParameters& camera_parameter,
-        utility::optional<int> channel,
         int image_boundary_margin) {
     float u, v, depth;
     std::tie(u, v, depth) = Project3DPointAndGetUVDepth(V, camera_parameter);
     // TODO: check why we use the u, ve before warpping for TestImageBoundary.
     if (img.TestImageBoundary(u, v, image_boundary_margin)) {
-        if (optional_warping_field.has_value()) {
+        if (warping_field != nullptr) {
             Eigen::Vector2d uv_shift =
-                    optional_warping_field.value().GetImageWarpingField(u, v);
+                    warping_field->GetImageWarpingField(u, v);
             u = static_cast<float>(uv_shift(0));
             v = static_cast<float>(uv_shift(1));
         }
         if (img.TestImageBoundary(u, v, image_boundary_margin)) {
-            int u_round = int(u);
-            int v_round = int(v);
-            if (channel.has_value()) {
-                return std::make_tuple(
-                        true,
-                        *img.PointerAt<T>(u_round, v_round, channel.value()));
-            } else {
-                return std::make_tuple(true,
-                                       *img.PointerAt<T>(u_round, v_round));
-            }
+            return std::make_tuple(true, int(u), int(v));
         }
     }
-    return std::make_tuple(false, 0);
+    return std::make_tuple(false, 0, 0);
+}
+
+template <typename T>
+static std::tuple<bool, T> QueryImageIntensity(
+        const geometry::Image& img,
+        const ImageWarpingField* warping_field,
+        const Eigen::Vector3d& V,
+        const camera::PinholeCameraParameters& camera_parameter,
+        int image_boundary_margin) {
+    bool valid;
+    int u, v;
+    std::tie(valid, u, v) = QueryImagePixel(img, warping_field, V,
+                                            camera_parameter,
+                                            image_boundary_margin);
+    if (!valid) {
+        return std::make_tuple(false, T(0));
+    }
+    return std::make_tuple(true, *img.PointerAt<T>(u, v));
 }
 
 std::tuple<std::vector<geometry::Image>,
@@ -147,29 +158,34 @@ CreateVertexAndImageVisibility(
     std::vector<std::vector<int>> visibility_vertex_to_image;
     visibility_vertex_to_image.resize(n_vertex);
 
-#pragma omp parallel for schedule(static)
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+    // Each camera only writes its own list, so the cameras are processed
+    // without any synchronization. The sensor depth map acts as the z-buffer
+    // of the camera: a vertex is visible if its depth agrees with the depth
+    // stored at the pixel it projects to.
+    utility::ParallelFor(0, (int64_t)n_camera, [&](int64_t camera_id) {
+        const geometry::Image& depth = images_depth[camera_id];
+        const geometry::Image& mask = images_mask[camera_id];
+        std::vector<int>& visible_vertices =
+                visibility_image_to_vertex[camera_id];
         for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
-            Eigen::Vector3d X = mesh.vertices_[vertex_id];
             float u, v, d;
             std::tie(u, v, d) = Project3DPointAndGetUVDepth(
-                    X, camera_trajectory.parameters_[camera_id]);
+                    mesh.vertices_[vertex_id],
+                    camera_trajectory.parameters_[camera_id]);
             int u_d = int(round(u)), v_d = int(round(v));
             // Skip if vertex in image boundary.
-            if (d < 0.0 ||
-                !images_depth[camera_id].TestImageBoundary(u_d, v_d)) {
+            if (d < 0.0 || !depth.TestImageBoundary(u_d, v_d)) {
                 continue;
             }
             // Skip if vertex's depth is too large (e.g. background).
-            float d_sensor =
-                    *images_depth[camera_id].PointerAt<float>(u_d, v_d);
+            float d_sensor = *depth.PointerAt<float>(u_d, v_d);
             if (d_sensor > maximum_allowable_depth) {
                 continue;
             }
             // Check depth boundary mask. If a vertex is located at the boundary
             // of an object, its color will be highly diverse from different
             // viewing angles.
-            if (*images_mask[camera_id].PointerAt<uint8_t>(u_d, v_d) == 255) {
+            if (*mask.PointerAt<uint8_t>(u_d, v_d) == 255) {
                 continue;
             }
             // Check depth errors.
@@ -177,9 +193,26 @@ CreateVertexAndImageVisibility(
                 depth_threshold_for_visibility_check) {
                 continue;
             }
-            visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
+            visible_vertices.push_back(vertex_id);
+        }
+    });
+
+    // Invert the per-camera lists. Cameras are visited in order, so the
+    // cameras of every vertex are sorted.
+    std::vector<int> n_visible_cameras(n_vertex, 0);
+    for (const std::vector<int>& visible_vertices :
+         visibility_image_to_vertex) {
+        for (int vertex_id : visible_vertices) {
+            n_visible_cameras[vertex_id]++;
+        }
+    }
+    for (size_t vertex_id = 0; vertex_id < n_vertex; vertex_id++) {
+        visibility_vertex_to_image[vertex_id].reserve(
+                n_visible_cameras[vertex_id]);
+    }
+    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+        for (int vertex_id : visibility_image_to_vertex[camera_id]) {
+            visibility_vertex_to_image[vertex_id].push_back(camera_id);
         }
     }
 
@@ -206,8 +239,7 @@ void SetProxyIntensityForVertex(
     auto n_vertex = mesh.vertices_.size();
     proxy_intensity.resize(n_vertex);
 
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(n_vertex); i++) {
+    utility::ParallelFor(0, (int64_t)n_vertex, [&](int64_t i) {
         proxy_intensity[i] = 0.0;
         float sum = 0.0;
         for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
@@ -215,18 +247,12 @@ void SetProxyIntensityForVertex(
             int j = visibility_vertex_to_image[i][iter];
             float gray;
             bool valid = false;
-            if (warping_fields.has_value()) {
-                std::tie(valid, gray) = QueryImageIntensity<float>(
-                        images_gray[j], warping_fields.value()[j],
-                        mesh.vertices_[i], camera_trajectory.parameters_[j],
-                        utility::nullopt, image_boundary_margin);
-            } else {
-                std::tie(valid, gray) = QueryImageIntensity<float>(
-                        images_gray[j], utility::nullopt, mesh.vertices_[i],
-                        camera_trajectory.parameters_[j], utility::nullopt,
-                        image_boundary_margin);
-            }
-
+            std::tie(valid, gray) = QueryImageIntensity<float>(
+                    images_gray[j],
+                    warping_fields.has_value() ? &warping_fields.value()[j]
+                                               : nullptr,
+                    mesh.vertices_[i], camera_trajectory.parameters_[j],
+                    image_boundary_margin);
             if (valid) {
                 sum += 1.0;
                 proxy_intensity[i] += gray;
@@ -235,7 +261,7 @@ void SetProxyIntensityForVertex(
         if (sum > 0) {
             proxy_intensity[i] /= sum;
         }
-    }
+    });
 }
 
 void SetGeometryColorAverage(
@@ -249,56 +275,49 @@ void SetGeometryColorAverage(
     size_t n_vertex = mesh.vertices_.size();
     mesh.vertex_colors_.clear();
     mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)n_vertex; i++) {
+    std::vector<uint8_t> is_valid_vertex(n_vertex, 0);
+    utility::ParallelFor(0, (int64_t)n_vertex, [&](int64_t i) {
         mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
         double sum = 0.0;
         for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
              iter++) {
             int j = visibility_vertex_to_image[i][iter];
-            uint8_t r_temp, g_temp, b_temp;
             bool valid = false;
-            utility::optional<ImageWarpingField> optional_warping_field;
-            if (warping_fields.has_value()) {
-                optional_warping_field = warping_fields.value()[j];
-            } else {
-                optional_warping_field = utility::nullopt;
-            }
-            std::tie(valid, r_temp) = QueryImageIntensity<uint8_t>(
-                    images_color[j], optional_warping_field, mesh.vertices_[i],
-                    camera_trajectory.parameters_[j], 0, image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<uint8_t>(
-                    images_color[j], optional_warping_field, mesh.vertices_[i],
-                    camera_trajectory.parameters_[j], 1, image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<uint8_t>(
-                    images_color[j], optional_warping_field, mesh.vertices_[i],
-                    camera_trajectory.parameters_[j], 2, image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
+            int u, v;
+            std::tie(valid, u, v) = QueryImagePixel(
+                    images_color[j],
+                    warping_fields.has_value() ? &warping_fields.value()[j]
+                                               : nullptr,
+                    mesh.vertices_[i], camera_trajectory.parameters_[j],
+                    image_boundary_margin);
             if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
+                const uint8_t* rgb =
+                        images_color[j].PointerAt<uint8_t>(u, v, 0);
+                mesh.vertex_colors_[i] += Eigen::Vector3d(
+                        rgb[0] / 255.0f, rgb[1] / 255.0f, rgb[2] / 255.0f);
                 sum += 1.0;
             }
         }
-#pragma omp critical
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+        if (sum > 0.0) {
+            mesh.vertex_colors_[i] /= sum;
+            is_valid_vertex[i] = 1;
+        }
+    });
+    std::vector<size_t> valid_vertices;
+    std::vector<size_t> invalid_vertices;
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (is_valid_vertex[i]) {
+            valid_vertices.push_back(i);
+        } else {
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
         std::shared_ptr<geometry::TriangleMesh> valid_mesh =
                 mesh.SelectByIndex(valid_vertices);
         geometry::KDTreeFlann kd_tree(*valid_mesh);
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < (int)invalid_vertices.size(); ++i) {
+        const int64_t num_invalid = int64_t(invalid_vertices.size());
+        utility::ParallelFor(0, num_invalid, [&](int64_t i) {
             size_t invalid_vertex = invalid_vertices[i];
             std::vector<int> indices;  // indices to valid_mesh
             std::vector<double> dists;
@@ -312,7 +331,7 @@ void SetGeometryColorAverage(
                 new_color /= static_cast<double>(indices.size());
             }
             mesh.vertex_colors_[invalid_vertex] = new_color;
-        }
+        });
     }
 }
 
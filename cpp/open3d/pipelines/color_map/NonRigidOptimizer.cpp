@@ -26,6 +26,7 @@
 
 #include "open3d/pipelines/color_map/NonRigidOptimizer.h"
 
+#include <Eigen/Sparse>
 #include <memory>
 #include <vector>
 
@@ -63,52 +64,57 @@ static std::vector<ImageWarpingField> CreateWarpingFields(
 
 /// Function to compute JTJ and Jtr
 /// Input: function pointer f and total number of rows of Jacobian matrix
-/// Output: JTJ, JTr, sum of r^2
-/// Note: this function is almost identical to the functions in
-/// Utility/Eigen.h/cpp, but this function takes additional multiplication
-/// pattern that can produce JTJ having hundreds of rows and columns.
-template <typename VecInTypeDouble,
-          typename VecInTypeInt,
-          typename MatOutType,
-          typename VecOutType>
-static std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
-        std::function<void(int, VecInTypeDouble&, double&, VecInTypeInt&)> f,
+/// Output: triplets of JTJ, JTr, sum of r^2
+/// Note: a row only involves the camera pose and the four anchors of the
+/// warping field cell the vertex projects to. The rows are therefore
+/// accumulated in one 14x14 block per cell, and JTJ is returned as the
+/// triplets of a sparse (6 + nonrigidval)x(6 + nonrigidval) matrix.
+static std::tuple<std::vector<Eigen::Triplet<double>>, Eigen::VectorXd, double>
+ComputeJTJandJTrNonRigid(
+        std::function<void(int, Eigen::Vector14d&, double&, Eigen::Vector14i&)>
+                f,
         int iteration_num,
-        int nonrigidval,
+        int anchor_w,
+        int anchor_h,
         bool verbose /*=true*/) {
-    MatOutType JTJ(6 + nonrigidval, 6 + nonrigidval);
-    VecOutType JTr(6 + nonrigidval);
+    int nonrigidval = anchor_w * anchor_h * 2;
+    Eigen::VectorXd JTr = Eigen::VectorXd::Zero(6 + nonrigidval);
     double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#pragma omp parallel
-    {
-        MatOutType JTJ_private(6 + nonrigidval, 6 + nonrigidval);
-        VecOutType JTr_private(6 + nonrigidval);
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
-        VecInTypeDouble J_r;
-        VecInTypeInt pattern;
-        double r;
-#pragma omp for nowait
-        for (int i = 0; i < iteration_num; i++) {
-            f(i, J_r, r, pattern);
-            for (auto x = 0; x < J_r.size(); x++) {
-                for (auto y = 0; y < J_r.size(); y++) {
-                    JTJ_private(pattern(x), pattern(y)) += J_r(x) * J_r(y);
-                }
-            }
-            for (auto x = 0; x < J_r.size(); x++) {
-                JTr_private(pattern(x)) += r * J_r(x);
-            }
-            r2_sum_private += r * r;
+    // Blocks are indexed by the top-left anchor of the cell.
+    std::vector<Eigen::Matrix<double, 14, 14>> JTJ_cells(anchor_w * anchor_h);
+    std::vector<Eigen::Vector14i> cell_patterns(anchor_w * anchor_h);
+    std::vector<bool> is_cell_used(anchor_w * anchor_h, false);
+    Eigen::Vector14d J_r;
+    Eigen::Vector14i pattern;
+    double r;
+    for (int i = 0; i < iteration_num; i++) {
+        f(i, J_r, r, pattern);
+        r2_sum += r * r;
+        // Rows of vertices outside of the image have an empty pattern.
+        if (pattern(6) == 0) {
+            continue;
         }
-#pragma omp critical
-        {
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
+        int cell = (pattern(6) - 6) / 2;
+        if (!is_cell_used[cell]) {
+            is_cell_used[cell] = true;
+            JTJ_cells[cell].setZero();
+            cell_patterns[cell] = pattern;
+        }
+        JTJ_cells[cell].noalias() += J_r * J_r.transpose();
+        for (int x = 0; x < 14; x++) {
+            JTr(pattern(x)) += r * J_r(x);
+        }
+    }
+    std::vector<Eigen::Triplet<double>> JTJ;
+    for (size_t cell = 0; cell < JTJ_cells.size(); cell++) {
+        if (!is_cell_used[cell]) {
+            continue;
+        }
+        for (int y = 0; y < 14; y++) {
+            for (int x = 0; x < 14; x++) {
+                JTJ.emplace_back(cell_patterns[cell](x),
+                                 cell_patterns[cell](y), JTJ_cells[cell](x, y));
+            }
         }
     }
     if (verbose) {
@@ -327,31 +333,41 @@ geometry::TriangleMesh RunNonRigidOptimizer(
                         visibility_image_to_vertex[c],
                         option.image_boundary_margin_);
             };
-            Eigen::MatrixXd JTJ;
+            std::vector<Eigen::Triplet<double>> JTJ_triplets;
             Eigen::VectorXd JTr;
             double r2;
-            std::tie(JTJ, JTr, r2) =
-                    ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
-                                             Eigen::MatrixXd, Eigen::VectorXd>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            nonrigidval, false);
+            std::tie(JTJ_triplets, JTr, r2) = ComputeJTJandJTrNonRigid(
+                    f_lambda, int(visibility_image_to_vertex[c].size()),
+                    warping_fields[c].anchor_w_, warping_fields[c].anchor_h_,
+                    false);
 
             double weight = option.non_rigid_anchor_point_weight_ *
                             visibility_image_to_vertex[c].size() / n_vertex;
             for (int j = 0; j < nonrigidval; j++) {
                 double r = weight * (warping_fields[c].flow_(j) -
                                      warping_fields_init[c].flow_(j));
-                JTJ(6 + j, 6 + j) += weight * weight;
+                JTJ_triplets.emplace_back(6 + j, 6 + j, weight * weight);
                 JTr(6 + j) += weight * r;
                 rr_reg += r * r;
             }
+            Eigen::SparseMatrix<double> JTJ(6 + nonrigidval, 6 + nonrigidval);
+            JTJ.setFromTriplets(JTJ_triplets.begin(), JTJ_triplets.end());
 
-            bool success;
+            // The anchors only couple with their neighbors, so a sparse
+            // factorization is much cheaper than a dense one. Fall back to
+            // the dense solver if JTJ is numerically singular.
             Eigen::VectorXd result;
-            std::tie(success, result) = utility::SolveLinearSystemPSD(
-                    JTJ, -JTr, /*prefer_sparse=*/false,
-                    /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(JTJ);
+            if (solver.info() == Eigen::Success) {
+                result = solver.solve(-JTr);
+            }
+            if (solver.info() != Eigen::Success || !result.allFinite()) {
+                bool success;
+                std::tie(success, result) = utility::SolveLinearSystemPSD(
+                        Eigen::MatrixXd(JTJ), -JTr, /*prefer_sparse=*/false,
+                        /*check_symmetric=*/false,
+                        /*check_det=*/false, /*check_psd=*/false);
+            }
             Eigen::Vector6d result_pose;
             result_pose << result.block(0, 0, 6, 1);
             auto delta = utility::TransformVector6dToMatrix4d(result_pose);
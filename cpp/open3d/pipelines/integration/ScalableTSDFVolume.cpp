@@ -26,12 +26,21 @@
 
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 
-#include <unordered_set>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <numeric>
+#include <vector>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace pipelines {
@@ -94,130 +103,209 @@ void ScalableTSDFVolume::Integrate(
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+    // Collect the units within sdf_trunc_ of the sampled points of the
+    // frustum, then integrate them in parallel: units do not share voxels.
+    const auto &points = pointcloud->points_;
+    const Eigen::Vector3d trunc(sdf_trunc_, sdf_trunc_, sdf_trunc_);
+    std::vector<std::array<int, 3>> touched_volume_units;
+    std::mutex touched_mutex;
+    utility::ParallelForRange(
+            0, int64_t(points.size()), 256, [&](int64_t begin, int64_t end) {
+                std::vector<std::array<int, 3>> local_units;
+                for (int64_t k = begin; k < end; ++k) {
+                    auto min_bound = LocateVolumeUnit(points[k] - trunc);
+                    auto max_bound = LocateVolumeUnit(points[k] + trunc);
+                    for (auto x = min_bound(0); x <= max_bound(0); x++) {
+                        for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                            for (auto z = min_bound(2); z <= max_bound(2);
+                                 z++) {
+                                local_units.push_back({x, y, z});
+                            }
+                        }
                     }
                 }
-            }
+                std::sort(local_units.begin(), local_units.end());
+                local_units.erase(
+                        std::unique(local_units.begin(), local_units.end()),
+                        local_units.end());
+                std::lock_guard<std::mutex> lock(touched_mutex);
+                touched_volume_units.insert(touched_volume_units.end(),
+                                            local_units.begin(),
+                                            local_units.end());
+            });
+    tbb::parallel_sort(touched_volume_units.begin(),
+                       touched_volume_units.end());
+    touched_volume_units.erase(std::unique(touched_volume_units.begin(),
+                                           touched_volume_units.end()),
+                               touched_volume_units.end());
+
+    std::vector<std::shared_ptr<UniformTSDFVolume>> volumes;
+    volumes.reserve(touched_volume_units.size());
+    for (const auto &loc : touched_volume_units) {
+        volumes.push_back(
+                OpenVolumeUnit(Eigen::Vector3i(loc[0], loc[1], loc[2])));
+    }
+    utility::ParallelFor(0, int64_t(volumes.size()), [&](int64_t u) {
+        volumes[u]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
+    });
+}
+
+/// The allocated units of \p volume_units, in iteration order.
+static std::vector<const ScalableTSDFVolume::VolumeUnit *> AllocatedVolumeUnits(
+        const std::unordered_map<Eigen::Vector3i,
+                                 ScalableTSDFVolume::VolumeUnit,
+                                 utility::hash_eigen<Eigen::Vector3i>>
+                &volume_units) {
+    std::vector<const ScalableTSDFVolume::VolumeUnit *> units;
+    for (const auto &unit : volume_units) {
+        if (unit.second.volume_) {
+            units.push_back(&unit.second);
         }
     }
+    return units;
 }
 
+/// Points extracted from a single volume unit, concatenated afterwards.
+struct UnitPointCloud {
+    std::vector<Eigen::Vector3d> points_;
+    std::vector<Eigen::Vector3d> normals_;
+    std::vector<Eigen::Vector3d> colors_;
+};
+
+/// Marching cubes output of a single volume unit. Triangles index edges_,
+/// whose vertices are merged across units afterwards.
+struct UnitMesh {
+    std::vector<std::array<int, 4>> edges_;
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3d> vertex_colors_;
+    std::vector<Eigen::Vector3i> triangles_;
+};
+
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
-    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    // Units are extracted in parallel into their own point clouds, which are
+    // then concatenated in the order of volume_units_.
+    std::vector<const VolumeUnit *> units = AllocatedVolumeUnits(volume_units_);
+    std::vector<UnitPointCloud> unit_pointclouds(units.size());
     double half_voxel_length = voxel_length_ * 0.5;
-    float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
-                        if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
-                        if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
-                            Eigen::Vector3d p0 =
-                                    Eigen::Vector3d(half_voxel_length +
-                                                            voxel_length_ * x,
-                                                    half_voxel_length +
-                                                            voxel_length_ * y,
-                                                    half_voxel_length +
-                                                            voxel_length_ * z) +
-                                    index0.cast<double>() * volume_unit_length_;
-                            for (int i = 0; i < 3; i++) {
-                                Eigen::Vector3d p1 = p0;
-                                Eigen::Vector3i idx1 = idx0;
-                                Eigen::Vector3i index1 = index0;
-                                p1(i) += voxel_length_;
-                                idx1(i) += 1;
-                                if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+    utility::ParallelFor(0, int64_t(units.size()), [&](int64_t u) {
+        const auto &volume0 = *units[u]->volume_;
+        const auto &index0 = units[u]->index_;
+        auto &pointcloud = unit_pointclouds[u];
+        float w0, w1, f0, f1;
+        Eigen::Vector3f c0, c1;
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
+                    f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
+                    if (color_type_ != TSDFVolumeColorType::NoColor)
+                        c0 = volume0.voxels_[volume0.IndexOf(idx0)]
+                                     .color_.cast<float>();
+                    if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
+                        Eigen::Vector3d p0 =
+                                Eigen::Vector3d(half_voxel_length +
+                                                        voxel_length_ * x,
+                                                half_voxel_length +
+                                                        voxel_length_ * y,
+                                                half_voxel_length +
+                                                        voxel_length_ * z) +
+                                index0.cast<double>() * volume_unit_length_;
+                        for (int i = 0; i < 3; i++) {
+                            Eigen::Vector3d p1 = p0;
+                            Eigen::Vector3i idx1 = idx0;
+                            Eigen::Vector3i index1 = index0;
+                            p1(i) += voxel_length_;
+                            idx1(i) += 1;
+                            if (idx1(i) < volume0.resolution_) {
+                                w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .weight_;
+                                f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .tsdf_;
+                                if (color_type_ !=
+                                    TSDFVolumeColorType::NoColor)
+                                    c1 = volume0.voxels_[volume0.IndexOf(
+                                                                 idx1)]
+                                                 .color_.cast<float>();
+                            } else {
+                                idx1(i) -= volume0.resolution_;
+                                index1(i) += 1;
+                                auto unit_itr = volume_units_.find(index1);
+                                if (unit_itr == volume_units_.end()) {
+                                    w1 = 0.0f;
+                                    f1 = 0.0f;
+                                } else {
+                                    const auto &volume1 =
+                                            *unit_itr->second.volume_;
+                                    w1 = volume1.voxels_[volume1.IndexOf(
+                                                                 idx1)]
                                                  .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                    f1 = volume1.voxels_[volume1.IndexOf(
+                                                                 idx1)]
                                                  .tsdf_;
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
-                                                                     idx1)]
-                                                     .color_.cast<float>();
-                                } else {
-                                    idx1(i) -= volume0.resolution_;
-                                    index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
-                                        w1 = 0.0f;
-                                        f1 = 0.0f;
-                                    } else {
-                                        const auto &volume1 =
-                                                *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
-                                        if (color_type_ !=
-                                            TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
-                                    }
+                                        c1 = volume1.voxels_
+                                                     [volume1.IndexOf(idx1)]
+                                                             .color_
+                                                             .cast<float>();
                                 }
-                                if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
-                                    f0 * f1 < 0) {
-                                    float r0 = std::fabs(f0);
-                                    float r1 = std::fabs(f1);
-                                    Eigen::Vector3d p = p0;
-                                    p(i) = (p0(i) * r1 + p1(i) * r0) /
-                                           (r0 + r1);
-                                    pointcloud->points_.push_back(p);
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1) / 255.0f)
-                                                        .cast<double>());
-                                    } else if (color_type_ ==
-                                               TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1))
-                                                        .cast<double>());
-                                    }
-                                    // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
+                            }
+                            if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
+                                f0 * f1 < 0) {
+                                float r0 = std::fabs(f0);
+                                float r1 = std::fabs(f1);
+                                Eigen::Vector3d p = p0;
+                                p(i) = (p0(i) * r1 + p1(i) * r0) /
+                                       (r0 + r1);
+                                pointcloud.points_.push_back(p);
+                                if (color_type_ ==
+                                    TSDFVolumeColorType::RGB8) {
+                                    pointcloud.colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) /
+                                             (r0 + r1) / 255.0f)
+                                                    .cast<double>());
+                                } else if (color_type_ ==
+                                           TSDFVolumeColorType::Gray32) {
+                                    pointcloud.colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) /
+                                             (r0 + r1))
+                                                    .cast<double>());
                                 }
+                                // has_normal
+                                pointcloud.normals_.push_back(
+                                        GetNormalAt(p));
                             }
                         }
                     }
                 }
             }
         }
+    });
+
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    std::vector<size_t> offsets(units.size() + 1, 0);
+    for (size_t u = 0; u < units.size(); u++) {
+        offsets[u + 1] = offsets[u] + unit_pointclouds[u].points_.size();
+    }
+    pointcloud->points_.resize(offsets.back());
+    pointcloud->normals_.resize(offsets.back());
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        pointcloud->colors_.resize(offsets.back());
     }
+    utility::ParallelFor(0, int64_t(units.size()), [&](int64_t u) {
+        const auto &unit_pointcloud = unit_pointclouds[u];
+        std::copy(unit_pointcloud.points_.begin(),
+                  unit_pointcloud.points_.end(),
+                  pointcloud->points_.begin() + offsets[u]);
+        std::copy(unit_pointcloud.normals_.begin(),
+                  unit_pointcloud.normals_.end(),
+                  pointcloud->normals_.begin() + offsets[u]);
+        std::copy(unit_pointcloud.colors_.begin(),
+                  unit_pointcloud.colors_.end(),
+                  pointcloud->colors_.begin() + offsets[u]);
+    });
     return pointcloud;
 }
 
@@ -225,149 +313,204 @@ std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    //
+    // Units are polygonized in parallel, with a vertex for each cube crossing
+    // an edge. The vertices of a same edge are then merged by sorting the
+    // edge indices instead of sharing a map, and numbered by their first
+    // occurrence like in a serial sweep over volume_units_.
+    std::vector<const VolumeUnit *> units = AllocatedVolumeUnits(volume_units_);
+    std::vector<UnitMesh> unit_meshes(units.size());
     double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+    utility::ParallelFor(0, int64_t(units.size()), [&](int64_t u) {
+        const auto &volume0 = *units[u]->volume_;
+        const auto &index0 = units[u]->index_;
+        UnitMesh &unit_mesh = unit_meshes[u];
+        int edge_to_index[12];
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    int cube_index = 0;
+                    float w[8];
+                    float f[8];
+                    Eigen::Vector3d c[8];
+                    for (int i = 0; i < 8; i++) {
+                        Eigen::Vector3i index1 = index0;
+                        Eigen::Vector3i idx1 = idx0 + shift[i];
+                        if (idx1(0) < volume_unit_resolution_ &&
+                            idx1(1) < volume_unit_resolution_ &&
+                            idx1(2) < volume_unit_resolution_) {
+                            w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                           .weight_;
+                            f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                           .tsdf_;
+                            if (color_type_ == TSDFVolumeColorType::RGB8)
+                                c[i] = volume0.voxels_[volume0.IndexOf(
+                                                               idx1)]
+                                               .color_.cast<double>() /
+                                       255.0;
+                            else if (color_type_ ==
+                                     TSDFVolumeColorType::Gray32)
+                                c[i] = volume0.voxels_[volume0.IndexOf(
+                                                               idx1)]
+                                               .color_.cast<double>();
+                        } else {
+                            for (int j = 0; j < 3; j++) {
+                                if (idx1(j) >= volume_unit_resolution_) {
+                                    idx1(j) -= volume_unit_resolution_;
+                                    index1(j) += 1;
+                                }
+                            }
+                            auto unit_itr1 = volume_units_.find(index1);
+                            if (unit_itr1 == volume_units_.end()) {
+                                w[i] = 0.0f;
+                                f[i] = 0.0f;
+                            } else {
+                                const auto &volume1 =
+                                        *unit_itr1->second.volume_;
+                                w[i] = volume1.voxels_[volume1.IndexOf(
+                                                               idx1)]
                                                .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                f[i] = volume1.voxels_[volume1.IndexOf(
+                                                               idx1)]
                                                .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
+                                if (color_type_ ==
+                                    TSDFVolumeColorType::RGB8)
+                                    c[i] = volume1.voxels_[volume1.IndexOf(
                                                                    idx1)]
                                                    .color_.cast<double>() /
                                            255.0;
                                 else if (color_type_ ==
                                          TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
+                                    c[i] = volume1.voxels_[volume1.IndexOf(
                                                                    idx1)]
                                                    .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
                             }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
+                        }
+                        if (w[i] == 0.0f) {
+                            cube_index = 0;
+                            break;
+                        } else {
+                            if (f[i] < 0.0f) {
+                                cube_index |= (1 << i);
                             }
                         }
-                        if (cube_index == 0 || cube_index == 255) {
+                    }
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (!(edge_table[cube_index] & (1 << i))) {
                             continue;
                         }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
-                            }
-                        }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                        Eigen::Vector4i edge_index =
+                                Eigen::Vector4i(index0(0), index0(1),
+                                                index0(2), 0) *
+                                        volume_unit_resolution_ +
+                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                        edge_to_index[i] = (int)unit_mesh.edges_.size();
+                        unit_mesh.edges_.push_back({edge_index(0),
+                                                    edge_index(1),
+                                                    edge_index(2),
+                                                    edge_index(3)});
+                        Eigen::Vector3d pt(
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(0),
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(1),
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(2));
+                        double f0 = std::abs((double)f[edge_to_vert[i][0]]);
+                        double f1 = std::abs((double)f[edge_to_vert[i][1]]);
+                        pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
+                        unit_mesh.vertices_.push_back(pt);
+                        if (color_type_ != TSDFVolumeColorType::NoColor) {
+                            const auto &c0 = c[edge_to_vert[i][0]];
+                            const auto &c1 = c[edge_to_vert[i][1]];
+                            unit_mesh.vertex_colors_.push_back(
+                                    (f1 * c0 + f0 * c1) / (f0 + f1));
                         }
                     }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        unit_mesh.triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]));
+                    }
                 }
             }
         }
+    });
+
+    std::vector<int64_t> edge_offsets(units.size() + 1, 0);
+    std::vector<int64_t> triangle_offsets(units.size() + 1, 0);
+    for (size_t u = 0; u < units.size(); u++) {
+        edge_offsets[u + 1] = edge_offsets[u] + unit_meshes[u].edges_.size();
+        triangle_offsets[u + 1] =
+                triangle_offsets[u] + unit_meshes[u].triangles_.size();
+    }
+    const int64_t num_edges = edge_offsets.back();
+    std::vector<std::array<int, 4>> edges(num_edges);
+    utility::ParallelFor(0, int64_t(units.size()), [&](int64_t u) {
+        std::copy(unit_meshes[u].edges_.begin(), unit_meshes[u].edges_.end(),
+                  edges.begin() + edge_offsets[u]);
+    });
+
+    // first[e] is the first occurrence of the edge of occurrence e.
+    std::vector<int64_t> order(num_edges);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return edges[a] < edges[b] || (edges[a] == edges[b] && a < b);
+    });
+    std::vector<int64_t> first(num_edges);
+    utility::ParallelFor(
+            0, num_edges,
+            [&](int64_t k) {
+                // An edge is shared by at most 4 cubes.
+                int64_t k0 = k;
+                while (k0 > 0 && edges[order[k0 - 1]] == edges[order[k]]) {
+                    k0--;
+                }
+                first[order[k]] = order[k0];
+            },
+            1024);
+    std::vector<int64_t> is_first(num_edges);
+    utility::ParallelFor(
+            0, num_edges, [&](int64_t e) { is_first[e] = first[e] == e; },
+            1024);
+    std::vector<int64_t> vertex_end(num_edges);
+    utility::InclusivePrefixSum(is_first.data(), is_first.data() + num_edges,
+                                vertex_end.data());
+
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    const int64_t num_vertices = num_edges > 0 ? vertex_end.back() : 0;
+    mesh->vertices_.resize(num_vertices);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.resize(num_vertices);
     }
+    mesh->triangles_.resize(triangle_offsets.back());
+    utility::ParallelFor(0, int64_t(units.size()), [&](int64_t u) {
+        const UnitMesh &unit_mesh = unit_meshes[u];
+        for (size_t i = 0; i < unit_mesh.edges_.size(); i++) {
+            int64_t e = edge_offsets[u] + i;
+            if (first[e] != e) {
+                continue;
+            }
+            mesh->vertices_[vertex_end[e] - 1] = unit_mesh.vertices_[i];
+            if (color_type_ != TSDFVolumeColorType::NoColor) {
+                mesh->vertex_colors_[vertex_end[e] - 1] =
+                        unit_mesh.vertex_colors_[i];
+            }
+        }
+        for (size_t i = 0; i < unit_mesh.triangles_.size(); i++) {
+            Eigen::Vector3i &triangle =
+                    mesh->triangles_[triangle_offsets[u] + i];
+            for (int j = 0; j < 3; j++) {
+                int64_t e = edge_offsets[u] + unit_mesh.triangles_[i](j);
+                triangle(j) = (int)vertex_end[first[e]] - 1;
+            }
+        }
+    });
     return mesh;
 }
 
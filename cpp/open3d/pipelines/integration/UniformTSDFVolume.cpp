@@ -33,6 +33,7 @@
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -312,78 +313,76 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
     const float safe_width_f = intrinsic.width_ - 0.0001f;
     const float safe_height_f = intrinsic.height_ - 0.0001f;
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
-                                             voxel_length_f * x + origin_(0)),
-                                       float(half_voxel_length_f +
-                                             voxel_length_f * y + origin_(1)),
-                                       float(half_voxel_length_f + origin_(2)),
-                                       1.f);
-            Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
-            for (int z = 0; z < resolution_; z++,
-                     pt_camera(0) += extrinsic_scaled_f(0, 2),
-                     pt_camera(1) += extrinsic_scaled_f(1, 2),
-                     pt_camera(2) += extrinsic_scaled_f(2, 2)) {
-                // Skip if negative depth after projection
-                if (pt_camera(2) <= 0) {
-                    continue;
-                }
-                // Skip if x-y coordinate not in range
-                float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
-                float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
-                if (!(u_f >= 0.0001f && u_f < safe_width_f && v_f >= 0.0001f &&
-                      v_f < safe_height_f)) {
-                    continue;
-                }
-                // Skip if negative depth in depth image
-                int u = (int)u_f;
-                int v = (int)v_f;
-                float d = *image.depth_.PointerAt<float>(u, v);
-                if (d <= 0.0f) {
-                    continue;
-                }
+    // Columns of voxels are independent, and run nested in the unit-level
+    // loop of ScalableTSDFVolume::Integrate.
+    const int64_t num_columns = int64_t(resolution_) * resolution_;
+    utility::ParallelFor(0, num_columns, [&](int64_t xy) {
+        const int x = int(xy / resolution_);
+        const int y = int(xy % resolution_);
+        Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
+                                         voxel_length_f * x + origin_(0)),
+                                   float(half_voxel_length_f +
+                                         voxel_length_f * y + origin_(1)),
+                                   float(half_voxel_length_f + origin_(2)),
+                                   1.f);
+        Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
+        for (int z = 0; z < resolution_; z++,
+                 pt_camera(0) += extrinsic_scaled_f(0, 2),
+                 pt_camera(1) += extrinsic_scaled_f(1, 2),
+                 pt_camera(2) += extrinsic_scaled_f(2, 2)) {
+            // Skip if negative depth after projection
+            if (pt_camera(2) <= 0) {
+                continue;
+            }
+            // Skip if x-y coordinate not in range
+            float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
+            float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
+            if (!(u_f >= 0.0001f && u_f < safe_width_f && v_f >= 0.0001f &&
+                  v_f < safe_height_f)) {
+                continue;
+            }
+            // Skip if negative depth in depth image
+            int u = (int)u_f;
+            int v = (int)v_f;
+            float d = *image.depth_.PointerAt<float>(u, v);
+            if (d <= 0.0f) {
+                continue;
+            }
 
-                int v_ind = IndexOf(x, y, z);
-                float sdf =
-                        (d - pt_camera(2)) *
-                        (*depth_to_camera_distance_multiplier.PointerAt<float>(
-                                u, v));
-                if (sdf > -sdf_trunc_f) {
-                    // integrate
-                    float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
+            int v_ind = IndexOf(x, y, z);
+            float sdf =
+                    (d - pt_camera(2)) *
+                    (*depth_to_camera_distance_multiplier.PointerAt<float>(
+                            u, v));
+            if (sdf > -sdf_trunc_f) {
+                // integrate
+                float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
+                voxels_[v_ind].tsdf_ =
+                        (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
+                         tsdf) /
+                        (voxels_[v_ind].weight_ + 1.0f);
+                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                    const uint8_t *rgb =
+                            image.color_.PointerAt<uint8_t>(u, v, 0);
+                    Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
+                    voxels_[v_ind].color_ =
+                            (voxels_[v_ind].color_ *
+                                     voxels_[v_ind].weight_ +
+                             rgb_f) /
+                            (voxels_[v_ind].weight_ + 1.0f);
+                } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+                    const float *intensity =
+                            image.color_.PointerAt<float>(u, v, 0);
+                    voxels_[v_ind].color_ =
+                            (voxels_[v_ind].color_.array() *
+                                     voxels_[v_ind].weight_ +
+                             (*intensity)) /
                             (voxels_[v_ind].weight_ + 1.0f);
-                    if (color_type_ == TSDFVolumeColorType::RGB8) {
-                        const uint8_t *rgb =
-                                image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    }
-                    voxels_[v_ind].weight_ += 1.0f;
                 }
+                voxels_[v_ind].weight_ += 1.0f;
             }
         }
-    }
+    });
 }
 
 Eigen::Vector3d UniformTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
@@ -28,168 +28,89 @@
 
 #include <Eigen/Dense>
 #include <memory>
+#include <numeric>
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace pipelines {
 namespace odometry {
 
-static std::tuple<std::shared_ptr<geometry::Image>,
-                  std::shared_ptr<geometry::Image>>
-InitializeCorrespondenceMap(int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    auto correspondence_map = std::make_shared<geometry::Image>();
-    auto depth_buffer = std::make_shared<geometry::Image>();
-    correspondence_map->Prepare(width, height, 2, 4);
-    depth_buffer->Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map->height_; v++) {
-        for (int u = 0; u < correspondence_map->width_; u++) {
-            *correspondence_map->PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map->PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer->PointerAt<float>(u, v, 0) = -1.0f;
-        }
-    }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
-
-static inline void AddElementToCorrespondenceMap(
-        geometry::Image &correspondence_map,
-        geometry::Image &depth_buffer,
-        int u_s,
-        int v_s,
-        int u_t,
-        int v_t,
-        float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-    }
-}
-
-static void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                                    geometry::Image &depth_buffer,
-                                    geometry::Image &correspondence_map_part,
-                                    geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
-            }
-        }
-    }
-}
-
-static int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
-            }
-        }
-    }
-    return correspondence_count;
-}
-
-static std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
-        const Eigen::Matrix3d intrinsic_matrix,
-        const Eigen::Matrix4d &extrinsic,
-        const geometry::Image &depth_s,
-        const geometry::Image &depth_t,
-        const OdometryOption &option) {
+/// Fills \p correspondence_map, an Int32 image of the size of \p depth_s,
+/// with the linear index v_t * width + u_t of the target pixel that each
+/// source pixel is associated with, or -1. The associated pixels are then
+/// compacted into \p correspondence in row-major order of the source. Both
+/// outputs are reused across calls.
+static void ComputeCorrespondence(const Eigen::Matrix3d intrinsic_matrix,
+                                  const Eigen::Matrix4d &extrinsic,
+                                  const geometry::Image &depth_s,
+                                  const geometry::Image &depth_t,
+                                  const OdometryOption &option,
+                                  geometry::Image &correspondence_map,
+                                  CorrespondenceSetPixelWise &correspondence) {
     const Eigen::Matrix3d K = intrinsic_matrix;
     const Eigen::Matrix3d K_inv = K.inverse();
     const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
     Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
 
-    std::shared_ptr<geometry::Image> correspondence_map;
-    std::shared_ptr<geometry::Image> depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#pragma omp parallel
-    {
-        std::shared_ptr<geometry::Image> correspondence_map_private;
-        std::shared_ptr<geometry::Image> depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#pragma omp for nowait
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
-            for (int u_s = 0; u_s < depth_s.width_; u_s++) {
-                double d_s = *depth_s.PointerAt<float>(u_s, v_s);
-                if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.max_depth_diff_) {
-                            AddElementToCorrespondenceMap(
-                                    *correspondence_map_private,
-                                    *depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
+    const int width_s = depth_s.width_;
+    const int height_s = depth_s.height_;
+    const int width_t = depth_t.width_;
+    const int height_t = depth_t.height_;
+    const float *depth_s_ptr = depth_s.PointerAs<float>();
+    const float *depth_t_ptr = depth_t.PointerAs<float>();
+    correspondence_map.Prepare(width_s, height_s, 1, 4);
+    int *map_ptr = correspondence_map.PointerAs<int>();
+
+    // Offsets of the first correspondence of each row.
+    std::vector<int> row_offsets(height_s + 1, 0);
+#pragma omp parallel for schedule(static)
+    for (int v_s = 0; v_s < height_s; v_s++) {
+        int row_count = 0;
+        for (int u_s = 0; u_s < width_s; u_s++) {
+            int &index_t = map_ptr[v_s * width_s + u_s];
+            index_t = -1;
+            double d_s = depth_s_ptr[v_s * width_s + u_s];
+            if (!std::isnan(d_s)) {
+                Eigen::Vector3d uv_in_s =
+                        d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
+                double transformed_d_s = uv_in_s(2);
+                int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+                int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+                if (u_t >= 0 && u_t < width_t && v_t >= 0 && v_t < height_t) {
+                    double d_t = depth_t_ptr[v_t * width_t + u_t];
+                    if (!std::isnan(d_t) &&
+                        std::abs(transformed_d_s - d_t) <=
+                                option.max_depth_diff_) {
+                        index_t = v_t * width_t + u_t;
+                        row_count++;
                     }
                 }
             }
         }
-#pragma omp critical
-        {
-            MergeCorrespondenceMaps(*correspondence_map, *depth_buffer,
-                                    *correspondence_map_private,
-                                    *depth_buffer_private);
-
-        }  //    omp critical
-    }      //    omp parallel
-
-    auto correspondence = std::make_shared<CorrespondenceSetPixelWise>();
-    int correspondence_count = CountCorrespondence(*correspondence_map);
-    correspondence->resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map->height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map->width_; u_s++) {
-            int u_t = *correspondence_map->PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map->PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                (*correspondence)[cnt] = pixel_correspondence;
-                cnt++;
+        row_offsets[v_s + 1] = row_count;
+    }
+    std::partial_sum(row_offsets.begin(), row_offsets.end(),
+                     row_offsets.begin());
+
+    correspondence.resize(row_offsets[height_s]);
+#pragma omp parallel for schedule(static)
+    for (int v_s = 0; v_s < height_s; v_s++) {
+        int cnt = row_offsets[v_s];
+        for (int u_s = 0; u_s < width_s; u_s++) {
+            int index_t = map_ptr[v_s * width_s + u_s];
+            if (index_t >= 0) {
+                correspondence[cnt++] = Eigen::Vector4i(
+                        u_s, v_s, index_t % width_t, index_t / width_t);
             }
         }
     }
-    return correspondence;
 }
 
 static std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
@@ -238,16 +159,15 @@ static std::vector<Eigen::Matrix3d> CreateCameraMatrixPyramid(
 
 static Eigen::Matrix6d CreateInformationMatrix(
         const Eigen::Matrix4d &extrinsic,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const Eigen::Matrix3d &intrinsic_matrix,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
+        const geometry::Image &xyz_t,
         const OdometryOption &option) {
-    auto correspondence =
-            ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
-                                  extrinsic, depth_s, depth_t, option);
-
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
+    geometry::Image correspondence_map;
+    CorrespondenceSetPixelWise correspondence;
+    ComputeCorrespondence(intrinsic_matrix, extrinsic, depth_s, depth_t, option,
+                          correspondence_map, correspondence);
 
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
@@ -258,12 +178,12 @@ static Eigen::Matrix6d CreateInformationMatrix(
         Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Identity();
         Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
 #pragma omp for nowait
-        for (int row = 0; row < int(correspondence->size()); row++) {
-            int u_t = (*correspondence)[row](2);
-            int v_t = (*correspondence)[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+        for (int row = 0; row < int(correspondence.size()); row++) {
+            int u_t = correspondence[row](2);
+            int v_t = correspondence[row](3);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
@@ -286,9 +206,12 @@ static Eigen::Matrix6d CreateInformationMatrix(
     return GTG;
 }
 
-static void NormalizeIntensity(geometry::Image &image_s,
-                               geometry::Image &image_t,
-                               CorrespondenceSetPixelWise &correspondence) {
+/// Returns the factors that scale the mean intensity over the corresponding
+/// pixels to 0.5 in the source and in the target image.
+static std::tuple<double, double> ComputeIntensityScales(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
+        const CorrespondenceSetPixelWise &correspondence) {
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
         utility::LogError(
@@ -306,14 +229,7 @@ static void NormalizeIntensity(geometry::Image &image_s,
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
-}
-
-static inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
-        const geometry::Image &color, const geometry::Image &depth) {
-    return std::make_shared<geometry::RGBDImage>(
-            geometry::RGBDImage(color, depth));
+    return std::make_tuple(0.5 / mean_s, 0.5 / mean_t);
 }
 
 static std::shared_ptr<geometry::Image> PreprocessDepth(
@@ -341,77 +257,81 @@ static inline bool IsColorImageRGB(const geometry::Image &image) {
     return (image.num_of_channels_ == 3);
 }
 
-static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
-                                      const geometry::RGBDImage &target) {
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        return (CheckImagePair(source.color_, target.color_) &&
-                CheckImagePair(source.depth_, target.depth_) &&
-                CheckImagePair(source.color_, source.depth_) &&
-                CheckImagePair(target.color_, target.depth_) &&
-                CheckImagePair(source.color_, target.color_) &&
-                source.color_.num_of_channels_ == 3 &&
-                target.color_.num_of_channels_ == 3 &&
-                source.depth_.num_of_channels_ == 1 &&
-                target.depth_.num_of_channels_ == 1 &&
-                source.color_.bytes_per_channel_ == 1 &&
-                target.color_.bytes_per_channel_ == 1 &&
-                source.depth_.bytes_per_channel_ == 4 &&
-                target.depth_.bytes_per_channel_ == 4);
+static inline bool CheckRGBDImage(const geometry::RGBDImage &rgbd) {
+    if (!CheckImagePair(rgbd.color_, rgbd.depth_) ||
+        rgbd.depth_.num_of_channels_ != 1 ||
+        rgbd.depth_.bytes_per_channel_ != 4) {
+        return false;
     }
-    if (!IsColorImageRGB(source.color_) && !IsColorImageRGB(target.color_)) {
-        return (CheckImagePair(source.color_, target.color_) &&
-                CheckImagePair(source.depth_, target.depth_) &&
-                CheckImagePair(source.color_, source.depth_) &&
-                CheckImagePair(target.color_, target.depth_) &&
-                CheckImagePair(source.color_, target.color_) &&
-                source.color_.num_of_channels_ == 1 &&
-                source.depth_.num_of_channels_ == 1 &&
-                target.color_.num_of_channels_ == 1 &&
-                target.depth_.num_of_channels_ == 1 &&
-                source.color_.bytes_per_channel_ == 4 &&
-                target.color_.bytes_per_channel_ == 4 &&
-                source.depth_.bytes_per_channel_ == 4 &&
-                target.depth_.bytes_per_channel_ == 4);
+    if (IsColorImageRGB(rgbd.color_)) {
+        return rgbd.color_.bytes_per_channel_ == 1;
     }
-    return false;
+    return (rgbd.color_.num_of_channels_ == 1 &&
+            rgbd.color_.bytes_per_channel_ == 4);
 }
 
-static std::tuple<std::shared_ptr<geometry::RGBDImage>,
-                  std::shared_ptr<geometry::RGBDImage>>
-InitializeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &odo_init,
-        const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
+static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
+                                      const geometry::RGBDImage &target) {
+    return (CheckRGBDImage(source) && CheckRGBDImage(target) &&
+            CheckImagePair(source.color_, target.color_) &&
+            IsColorImageRGB(source.color_) == IsColorImageRGB(target.color_));
+}
+
+/// Preprocessed image pyramids of one frame, from fine to coarse. The
+/// intensity is not normalized yet, since the normalization depends on the
+/// frame it is paired with. Filtering is linear, so the pyramids of the
+/// normalized intensity are scaled copies of these.
+struct OdometryPyramids {
+    /// Gaussian filtered intensity and depth.
+    geometry::RGBDImagePyramid rgbd_;
+    /// Sobel gradients of rgbd_, only built for target frames.
+    geometry::RGBDImagePyramid rgbd_dx_;
+    geometry::RGBDImagePyramid rgbd_dy_;
+    /// Vertex images of the depth in rgbd_. Source frames have all levels,
+    /// target frames only the finest one for the information matrix.
+    geometry::ImagePyramid xyz_;
+};
+
+static std::shared_ptr<OdometryPyramids> CreateOdometryPyramids(
+        const geometry::RGBDImage &rgbd,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
+        const OdometryOption &option,
+        bool as_source,
+        bool as_target) {
+    std::shared_ptr<geometry::Image> gray;
+    if (IsColorImageRGB(rgbd.color_)) {
+        gray = rgbd.color_.CreateFloatImage()->Filter(
+                geometry::Image::FilterType::Gaussian3);
     } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
+        gray = rgbd.color_.Filter(geometry::Image::FilterType::Gaussian3);
+    }
+    auto depth = PreprocessDepth(rgbd.depth_, option)
+                         ->Filter(geometry::Image::FilterType::Gaussian3);
+
+    int num_levels = (int)pyramid_camera_matrix.size();
+    auto pyramids = std::make_shared<OdometryPyramids>();
+    pyramids->rgbd_ =
+            geometry::RGBDImage(*gray, *depth).CreatePyramid(num_levels);
+    if (as_target) {
+        pyramids->rgbd_dx_ = geometry::RGBDImage::FilterPyramid(
+                pyramids->rgbd_, geometry::Image::FilterType::Sobel3Dx);
+        pyramids->rgbd_dy_ = geometry::RGBDImage::FilterPyramid(
+                pyramids->rgbd_, geometry::Image::FilterType::Sobel3Dy);
     }
+    int num_xyz_levels = as_source ? num_levels : 1;
+    for (int level = 0; level < num_xyz_levels; level++) {
+        pyramids->xyz_.push_back(ConvertDepthImageToXYZImage(
+                pyramids->rgbd_[level]->depth_, pyramid_camera_matrix[level]));
+    }
+    return pyramids;
+}
 
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-
-    auto correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, *correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
-    return std::make_tuple(source_out, target_out);
+/// Returns a copy of \p rgbd with the intensity scaled by \p scale.
+static inline geometry::RGBDImage ScaleIntensity(
+        const geometry::RGBDImage &rgbd, double scale) {
+    geometry::RGBDImage scaled = rgbd;
+    scaled.color_.LinearTransform(scale, 0.0);
+    return scaled;
 }
 
 static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
@@ -425,27 +345,20 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix3d intrinsic,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
-    auto correspondence = ComputeCorrespondence(
-            intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
-    int corresps_count = (int)correspondence->size();
-
-    auto f_lambda =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r, std::vector<double> &w) {
-                jacobian_method.ComputeJacobianAndResidual(
-                        i, J_r, r, w, source, target, source_xyz, target_dx,
-                        target_dy, intrinsic, extrinsic_initial,
-                        *correspondence);
-            };
+        const OdometryOption &option,
+        geometry::Image &correspondence_map,
+        CorrespondenceSetPixelWise &correspondence) {
+    ComputeCorrespondence(intrinsic, extrinsic_initial, source.depth_,
+                          target.depth_, option, correspondence_map,
+                          correspondence);
+
     utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    f_lambda, corresps_count);
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic_initial, correspondence);
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
@@ -460,52 +373,44 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const OdometryPyramids &source,
+        const OdometryPyramids &target,
+        double scale_s,
+        double scale_t,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
+    // Reused by every iteration.
+    geometry::Image correspondence_map;
+    CorrespondenceSetPixelWise correspondence;
 
     for (int level = num_levels - 1; level >= 0; level--) {
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
 
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
+        auto source_level = ScaleIntensity(*source.rgbd_[level], scale_s);
+        auto target_level = ScaleIntensity(*target.rgbd_[level], scale_t);
+        auto target_dx_level =
+                ScaleIntensity(*target.rgbd_dx_[level], scale_t);
+        auto target_dy_level =
+                ScaleIntensity(*target.rgbd_dy_[level], scale_t);
 
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    iter, level, source_level, target_level,
+                    *source.xyz_[level], target_dx_level, target_dy_level,
+                    level_camera_matrix, result_odo, jacobian_method, option,
+                    correspondence_map, correspondence);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -517,6 +422,44 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     return std::make_tuple(true, result_odo);
 }
 
+static std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d>
+ComputeRGBDOdometryFromPyramids(
+        const OdometryPyramids &source,
+        const OdometryPyramids &target,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
+        const Eigen::Matrix4d &odo_init,
+        const RGBDOdometryJacobian &jacobian_method,
+        const OdometryOption &option) {
+    const geometry::RGBDImage &source_finest = *source.rgbd_[0];
+    const geometry::RGBDImage &target_finest = *target.rgbd_[0];
+
+    geometry::Image correspondence_map;
+    CorrespondenceSetPixelWise correspondence;
+    ComputeCorrespondence(pyramid_camera_matrix[0], odo_init,
+                          source_finest.depth_, target_finest.depth_, option,
+                          correspondence_map, correspondence);
+    double scale_s, scale_t;
+    std::tie(scale_s, scale_t) = ComputeIntensityScales(
+            source_finest.color_, target_finest.color_, correspondence);
+
+    Eigen::Matrix4d extrinsic;
+    bool is_success;
+    std::tie(is_success, extrinsic) = ComputeMultiscale(
+            source, target, scale_s, scale_t, pyramid_camera_matrix, odo_init,
+            jacobian_method, option);
+
+    if (is_success) {
+        Eigen::Matrix4d trans_output = extrinsic;
+        Eigen::MatrixXd info_output = CreateInformationMatrix(
+                extrinsic, pyramid_camera_matrix[0], source_finest.depth_,
+                target_finest.depth_, *target.xyz_[0], option);
+        return std::make_tuple(true, trans_output, info_output);
+    } else {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Identity());
+    }
+}
+
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
@@ -526,6 +469,7 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const RGBDOdometryJacobian &jacobian_method
         /*=RGBDOdometryJacobianFromHybridTerm*/,
         const OdometryOption &option /*= OdometryOption()*/) {
+    OPEN3D_PROFILE_SCOPE("pipelines::odometry::ComputeRGBDOdometry");
     if (!CheckRGBDImagePair(source, target)) {
         utility::LogWarning(
                 "[RGBDOdometry] Two RGBD pairs should be same in size.");
@@ -533,26 +477,58 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                                Eigen::Matrix6d::Zero());
     }
 
-    std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
-    std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
-
-    Eigen::Matrix4d extrinsic;
-    bool is_success;
-    std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(
+                    pinhole_camera_intrinsic,
+                    (int)option.iteration_number_per_pyramid_level_.size());
+    auto source_pyramids = CreateOdometryPyramids(
+            source, pyramid_camera_matrix, option, /*as_source=*/true,
+            /*as_target=*/false);
+    auto target_pyramids = CreateOdometryPyramids(
+            target, pyramid_camera_matrix, option, /*as_source=*/false,
+            /*as_target=*/true);
+    return ComputeRGBDOdometryFromPyramids(*source_pyramids, *target_pyramids,
+                                           pyramid_camera_matrix, odo_init,
+                                           jacobian_method, option);
+}
 
-    if (is_success) {
-        Eigen::Matrix4d trans_output = extrinsic;
-        Eigen::MatrixXd info_output = CreateInformationMatrix(
-                extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
-        return std::make_tuple(true, trans_output, info_output);
-    } else {
+RGBDOdometryTracker::RGBDOdometryTracker(
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const OdometryOption &option /*= OdometryOption()*/)
+    : option_(option),
+      camera_matrices_(CreateCameraMatrixPyramid(
+              pinhole_camera_intrinsic,
+              (int)option.iteration_number_per_pyramid_level_.size())) {}
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RGBDOdometryTracker::Track(
+        const geometry::RGBDImage &rgbd,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/) {
+    if (!CheckRGBDImage(rgbd) ||
+        (HasReference() &&
+         !CheckImagePair(rgbd.depth_, reference_->rgbd_[0]->depth_))) {
+        utility::LogWarning(
+                "[RGBDOdometryTracker] RGBD frames should be same in size.");
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
-                               Eigen::Matrix6d::Identity());
+                               Eigen::Matrix6d::Zero());
+    }
+
+    // The pyramids serve as the source now and as the target of the next
+    // call, so they hold the images of both roles.
+    auto pyramids =
+            CreateOdometryPyramids(rgbd, camera_matrices_, option_,
+                                   /*as_source=*/true, /*as_target=*/true);
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> result(
+            false, Eigen::Matrix4d::Identity(), Eigen::Matrix6d::Zero());
+    if (HasReference()) {
+        result = ComputeRGBDOdometryFromPyramids(*pyramids, *reference_,
+                                                 camera_matrices_, odo_init,
+                                                 jacobian_method, option_);
     }
+    reference_ = std::move(pyramids);
+    return result;
 }
 
 }  // namespace odometry
@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <iostream>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -65,6 +66,55 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// Preprocessed image pyramids of one frame, defined in Odometry.cpp.
+struct OdometryPyramids;
+
+/// \class RGBDOdometryTracker
+///
+/// \brief Estimates 6D rigid motion between consecutive RGBD frames.
+///
+/// The preprocessed image pyramids of each frame passed to Track are kept and
+/// used as the target of the next call. Every frame is thus filtered and
+/// downsampled once, while ComputeRGBDOdometry on consecutive pairs processes
+/// each frame twice.
+class RGBDOdometryTracker {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameteres.
+    RGBDOdometryTracker(const camera::PinholeCameraIntrinsic
+                                &pinhole_camera_intrinsic =
+                                        camera::PinholeCameraIntrinsic(),
+                        const OdometryOption &option = OdometryOption());
+
+    /// \brief Estimates the motion from \p rgbd to the previous frame and
+    /// keeps \p rgbd as the target of the next call.
+    ///
+    /// The first frame after construction or Reset has no target, so only its
+    /// pyramids are kept and is_success is false.
+    /// \param rgbd Current RGBD image, of the same size as the previous one.
+    /// \param odo_init Initial 4x4 motion matrix estimation.
+    /// \param jacobian_method The odometry Jacobian method to use.
+    /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> Track(
+            const geometry::RGBDImage &rgbd,
+            const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+            const RGBDOdometryJacobian &jacobian_method =
+                    RGBDOdometryJacobianFromHybridTerm());
+
+    /// Drops the previous frame, such that the next Track call starts over.
+    void Reset() { reference_.reset(); }
+
+    /// Returns true if a previous frame is available to track against.
+    bool HasReference() const { return reference_ != nullptr; }
+
+private:
+    OdometryOption option_;
+    std::vector<Eigen::Matrix3d> camera_matrices_;
+    std::shared_ptr<OdometryPyramids> reference_;
+};
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
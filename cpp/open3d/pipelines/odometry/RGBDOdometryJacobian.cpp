@@ -26,6 +26,9 @@
 
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 
+#include <cmath>
+#include <typeinfo>
+
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/Odometry.h"
@@ -36,11 +39,194 @@ namespace {
 
 const double SOBEL_SCALE = 0.125;
 const double LAMBDA_HYBRID_DEPTH = 0.968;
+const double SQRT_LAMBDA_DEPTH = std::sqrt(LAMBDA_HYBRID_DEPTH);
+const double SQRT_LAMBDA_IMG = std::sqrt(1.0 - LAMBDA_HYBRID_DEPTH);
+
+/// Raw Float32 buffers of the input images and the constants shared by all
+/// rows, resolved once per evaluation.
+struct JacobianInput {
+    JacobianInput(const geometry::RGBDImage &source,
+                  const geometry::RGBDImage &target,
+                  const geometry::Image &source_xyz,
+                  const geometry::RGBDImage &target_dx,
+                  const geometry::RGBDImage &target_dy,
+                  const Eigen::Matrix3d &intrinsic,
+                  const Eigen::Matrix4d &extrinsic,
+                  bool with_depth)
+        : source_color_(source.color_.PointerAs<float>()),
+          target_color_(target.color_.PointerAs<float>()),
+          target_dx_color_(target_dx.color_.PointerAs<float>()),
+          target_dy_color_(target_dy.color_.PointerAs<float>()),
+          source_xyz_(source_xyz.PointerAs<float>()),
+          source_width_(source.color_.width_),
+          source_xyz_width_(source_xyz.width_),
+          target_width_(target.color_.width_),
+          fx_(intrinsic(0, 0)),
+          fy_(intrinsic(1, 1)),
+          R_(extrinsic.block<3, 3>(0, 0)),
+          t_(extrinsic.block<3, 1>(0, 3)) {
+        if (with_depth) {
+            target_depth_ = target.depth_.PointerAs<float>();
+            target_dx_depth_ = target_dx.depth_.PointerAs<float>();
+            target_dy_depth_ = target_dy.depth_.PointerAs<float>();
+        }
+    }
+
+    int SourceIndex(const Eigen::Vector4i &corresp) const {
+        return corresp(1) * source_width_ + corresp(0);
+    }
+    int TargetIndex(const Eigen::Vector4i &corresp) const {
+        return corresp(3) * target_width_ + corresp(2);
+    }
+    Eigen::Vector3d TransformedSourcePoint(
+            const Eigen::Vector4i &corresp) const {
+        const float *p =
+                source_xyz_ + 3 * (corresp(1) * source_xyz_width_ + corresp(0));
+        return R_ * Eigen::Vector3d(p[0], p[1], p[2]) + t_;
+    }
+
+    const float *source_color_;
+    const float *target_color_;
+    const float *target_dx_color_;
+    const float *target_dy_color_;
+    const float *source_xyz_;
+    const float *target_depth_ = nullptr;
+    const float *target_dx_depth_ = nullptr;
+    const float *target_dy_depth_ = nullptr;
+    int source_width_;
+    int source_xyz_width_;
+    int target_width_;
+    double fx_;
+    double fy_;
+    Eigen::Matrix3d R_;
+    Eigen::Vector3d t_;
+};
+
+inline void ComputeColorTermRow(const JacobianInput &in,
+                                const Eigen::Vector4i &corresp,
+                                Eigen::Vector6d &J_r,
+                                double &r) {
+    int s = in.SourceIndex(corresp);
+    int t = in.TargetIndex(corresp);
+    double diff = in.target_color_[t] - in.source_color_[s];
+    double dIdx = SOBEL_SCALE * in.target_dx_color_[t];
+    double dIdy = SOBEL_SCALE * in.target_dy_color_[t];
+    Eigen::Vector3d p3d_trans = in.TransformedSourcePoint(corresp);
+    double invz = 1. / p3d_trans(2);
+    double c0 = dIdx * in.fx_ * invz;
+    double c1 = dIdy * in.fy_ * invz;
+    double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+
+    J_r(0) = -p3d_trans(2) * c1 + p3d_trans(1) * c2;
+    J_r(1) = p3d_trans(2) * c0 - p3d_trans(0) * c2;
+    J_r(2) = -p3d_trans(1) * c0 + p3d_trans(0) * c1;
+    J_r(3) = c0;
+    J_r(4) = c1;
+    J_r(5) = c2;
+    r = diff;
+}
+
+inline void ComputeHybridTermRow(const JacobianInput &in,
+                                 const Eigen::Vector4i &corresp,
+                                 Eigen::Vector6d &J_photo,
+                                 double &r_photo,
+                                 Eigen::Vector6d &J_geo,
+                                 double &r_geo) {
+    int s = in.SourceIndex(corresp);
+    int t = in.TargetIndex(corresp);
+    double diff_photo = in.target_color_[t] - in.source_color_[s];
+    double dIdx = SOBEL_SCALE * in.target_dx_color_[t];
+    double dIdy = SOBEL_SCALE * in.target_dy_color_[t];
+    double dDdx = SOBEL_SCALE * in.target_dx_depth_[t];
+    double dDdy = SOBEL_SCALE * in.target_dy_depth_[t];
+    if (std::isnan(dDdx)) dDdx = 0;
+    if (std::isnan(dDdy)) dDdy = 0;
+    Eigen::Vector3d p3d_trans = in.TransformedSourcePoint(corresp);
+
+    double diff_geo = in.target_depth_[t] - p3d_trans(2);
+    double invz = 1. / p3d_trans(2);
+    double c0 = dIdx * in.fx_ * invz;
+    double c1 = dIdy * in.fy_ * invz;
+    double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+    double d0 = dDdx * in.fx_ * invz;
+    double d1 = dDdy * in.fy_ * invz;
+    double d2 = -(d0 * p3d_trans(0) + d1 * p3d_trans(1)) * invz;
+
+    J_photo(0) = SQRT_LAMBDA_IMG * (-p3d_trans(2) * c1 + p3d_trans(1) * c2);
+    J_photo(1) = SQRT_LAMBDA_IMG * (p3d_trans(2) * c0 - p3d_trans(0) * c2);
+    J_photo(2) = SQRT_LAMBDA_IMG * (-p3d_trans(1) * c0 + p3d_trans(0) * c1);
+    J_photo(3) = SQRT_LAMBDA_IMG * (c0);
+    J_photo(4) = SQRT_LAMBDA_IMG * (c1);
+    J_photo(5) = SQRT_LAMBDA_IMG * (c2);
+    r_photo = SQRT_LAMBDA_IMG * diff_photo;
+
+    J_geo(0) = SQRT_LAMBDA_DEPTH *
+               ((-p3d_trans(2) * d1 + p3d_trans(1) * d2) - p3d_trans(1));
+    J_geo(1) = SQRT_LAMBDA_DEPTH *
+               ((p3d_trans(2) * d0 - p3d_trans(0) * d2) + p3d_trans(0));
+    J_geo(2) = SQRT_LAMBDA_DEPTH * ((-p3d_trans(1) * d0 + p3d_trans(0) * d1));
+    J_geo(3) = SQRT_LAMBDA_DEPTH * (d0);
+    J_geo(4) = SQRT_LAMBDA_DEPTH * (d1);
+    J_geo(5) = SQRT_LAMBDA_DEPTH * (d2 - 1.0f);
+    r_geo = SQRT_LAMBDA_DEPTH * diff_geo;
+}
+
+/// Reduces J^T J, J^T r and r^2 over \p num_rows rows. \p add_row is inlined
+/// into the loop and adds the terms of one row to thread-local sums.
+template <typename AddRow>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> AccumulateRows(
+        int num_rows, const AddRow &add_row) {
+    Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+    double r2_sum = 0.0;
+#pragma omp parallel
+    {
+        Eigen::Matrix6d JTJ_private = Eigen::Matrix6d::Zero();
+        Eigen::Vector6d JTr_private = Eigen::Vector6d::Zero();
+        double r2_sum_private = 0.0;
+#pragma omp for nowait
+        for (int row = 0; row < num_rows; row++) {
+            add_row(row, JTJ_private, JTr_private, r2_sum_private);
+        }
+#pragma omp critical
+        {
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+        }
+    }
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      r2_sum / (double)num_rows, num_rows);
+    return std::make_tuple(JTJ, JTr, r2_sum);
+}
 
 }  // unnamed namespace
 
 namespace pipelines {
 namespace odometry {
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobian::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    auto f_lambda =
+            [&](int i,
+                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+                std::vector<double> &r, std::vector<double> &w) {
+                ComputeJacobianAndResidual(i, J_r, r, w, source, target,
+                                           source_xyz, target_dx, target_dy,
+                                           intrinsic, extrinsic, corresps);
+            };
+    return utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+            f_lambda, int(corresps.size()));
+}
+
 void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -54,39 +240,47 @@ void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
         const Eigen::Matrix3d &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const CorrespondenceSetPixelWise &corresps) const {
-    Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
-    Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
-
-    int u_s = corresps[row](0);
-    int v_s = corresps[row](1);
-    int u_t = corresps[row](2);
-    int v_t = corresps[row](3);
-    double diff = *target.color_.PointerAt<float>(u_t, v_t) -
-                  *source.color_.PointerAt<float>(u_s, v_s);
-    double dIdx = SOBEL_SCALE * (*target_dx.color_.PointerAt<float>(u_t, v_t));
-    double dIdy = SOBEL_SCALE * (*target_dy.color_.PointerAt<float>(u_t, v_t));
-    Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 1),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 2));
-    Eigen::Vector3d p3d_trans = R * p3d_mat + t;
-    double invz = 1. / p3d_trans(2);
-    double c0 = dIdx * intrinsic(0, 0) * invz;
-    double c1 = dIdy * intrinsic(1, 1) * invz;
-    double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
-
+    JacobianInput input(source, target, source_xyz, target_dx, target_dy,
+                        intrinsic, extrinsic, /*with_depth=*/false);
     J_r.resize(1);
-    J_r[0](0) = -p3d_trans(2) * c1 + p3d_trans(1) * c2;
-    J_r[0](1) = p3d_trans(2) * c0 - p3d_trans(0) * c2;
-    J_r[0](2) = -p3d_trans(1) * c0 + p3d_trans(0) * c1;
-    J_r[0](3) = c0;
-    J_r[0](4) = c1;
-    J_r[0](5) = c2;
     r.resize(1);
-    r[0] = diff;
     w.resize(1);
+    ComputeColorTermRow(input, corresps[row], J_r[0], r[0]);
     w[0] = 1.0;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromColorTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    // Derived classes may override the per-row evaluation.
+    if (typeid(*this) != typeid(RGBDOdometryJacobianFromColorTerm)) {
+        return RGBDOdometryJacobian::ComputeJTJandJTr(
+                source, target, source_xyz, target_dx, target_dy, intrinsic,
+                extrinsic, corresps);
+    }
+
+    JacobianInput input(source, target, source_xyz, target_dx, target_dy,
+                        intrinsic, extrinsic, /*with_depth=*/false);
+    return AccumulateRows(
+            int(corresps.size()),
+            [&](int row, Eigen::Matrix6d &JTJ, Eigen::Vector6d &JTr,
+                double &r2_sum) {
+                Eigen::Vector6d J_r;
+                double r;
+                ComputeColorTermRow(input, corresps[row], J_r, r);
+                JTJ.noalias() += J_r * J_r.transpose();
+                JTr.noalias() += J_r * r;
+                r2_sum += r * r;
+            });
+}
+
 void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -100,67 +294,50 @@ void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
         const Eigen::Matrix3d &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const CorrespondenceSetPixelWise &corresps) const {
-    double sqrt_lamba_dep, sqrt_lambda_img;
-    sqrt_lamba_dep = sqrt(LAMBDA_HYBRID_DEPTH);
-    sqrt_lambda_img = sqrt(1.0 - LAMBDA_HYBRID_DEPTH);
-
-    const double fx = intrinsic(0, 0);
-    const double fy = intrinsic(1, 1);
-    Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
-    Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
-
-    int u_s = corresps[row](0);
-    int v_s = corresps[row](1);
-    int u_t = corresps[row](2);
-    int v_t = corresps[row](3);
-    double diff_photo = (*target.color_.PointerAt<float>(u_t, v_t) -
-                         *source.color_.PointerAt<float>(u_s, v_s));
-    double dIdx = SOBEL_SCALE * (*target_dx.color_.PointerAt<float>(u_t, v_t));
-    double dIdy = SOBEL_SCALE * (*target_dy.color_.PointerAt<float>(u_t, v_t));
-    double dDdx = SOBEL_SCALE * (*target_dx.depth_.PointerAt<float>(u_t, v_t));
-    double dDdy = SOBEL_SCALE * (*target_dy.depth_.PointerAt<float>(u_t, v_t));
-    if (std::isnan(dDdx)) dDdx = 0;
-    if (std::isnan(dDdy)) dDdy = 0;
-    Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 1),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 2));
-    Eigen::Vector3d p3d_trans = R * p3d_mat + t;
-
-    double diff_geo = *target.depth_.PointerAt<float>(u_t, v_t) - p3d_trans(2);
-    double invz = 1. / p3d_trans(2);
-    double c0 = dIdx * fx * invz;
-    double c1 = dIdy * fy * invz;
-    double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
-    double d0 = dDdx * fx * invz;
-    double d1 = dDdy * fy * invz;
-    double d2 = -(d0 * p3d_trans(0) + d1 * p3d_trans(1)) * invz;
-
+    JacobianInput input(source, target, source_xyz, target_dx, target_dy,
+                        intrinsic, extrinsic, /*with_depth=*/true);
     J_r.resize(2);
     r.resize(2);
     w.resize(2);
-    J_r[0](0) = sqrt_lambda_img * (-p3d_trans(2) * c1 + p3d_trans(1) * c2);
-    J_r[0](1) = sqrt_lambda_img * (p3d_trans(2) * c0 - p3d_trans(0) * c2);
-    J_r[0](2) = sqrt_lambda_img * (-p3d_trans(1) * c0 + p3d_trans(0) * c1);
-    J_r[0](3) = sqrt_lambda_img * (c0);
-    J_r[0](4) = sqrt_lambda_img * (c1);
-    J_r[0](5) = sqrt_lambda_img * (c2);
-    double r_photo = sqrt_lambda_img * diff_photo;
-    r[0] = r_photo;
+    ComputeHybridTermRow(input, corresps[row], J_r[0], r[0], J_r[1], r[1]);
     w[0] = 1.0;
-
-    J_r[1](0) = sqrt_lamba_dep *
-                ((-p3d_trans(2) * d1 + p3d_trans(1) * d2) - p3d_trans(1));
-    J_r[1](1) = sqrt_lamba_dep *
-                ((p3d_trans(2) * d0 - p3d_trans(0) * d2) + p3d_trans(0));
-    J_r[1](2) = sqrt_lamba_dep * ((-p3d_trans(1) * d0 + p3d_trans(0) * d1));
-    J_r[1](3) = sqrt_lamba_dep * (d0);
-    J_r[1](4) = sqrt_lamba_dep * (d1);
-    J_r[1](5) = sqrt_lamba_dep * (d2 - 1.0f);
-    double r_geo = sqrt_lamba_dep * diff_geo;
-    r[1] = r_geo;
     w[1] = 1.0;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromHybridTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    // Derived classes may override the per-row evaluation.
+    if (typeid(*this) != typeid(RGBDOdometryJacobianFromHybridTerm)) {
+        return RGBDOdometryJacobian::ComputeJTJandJTr(
+                source, target, source_xyz, target_dx, target_dy, intrinsic,
+                extrinsic, corresps);
+    }
+
+    JacobianInput input(source, target, source_xyz, target_dx, target_dy,
+                        intrinsic, extrinsic, /*with_depth=*/true);
+    return AccumulateRows(
+            int(corresps.size()),
+            [&](int row, Eigen::Matrix6d &JTJ, Eigen::Vector6d &JTr,
+                double &r2_sum) {
+                Eigen::Vector6d J_photo, J_geo;
+                double r_photo, r_geo;
+                ComputeHybridTermRow(input, corresps[row], J_photo, r_photo,
+                                     J_geo, r_geo);
+                JTJ.noalias() += J_photo * J_photo.transpose();
+                JTJ.noalias() += J_geo * J_geo.transpose();
+                JTr.noalias() += J_photo * r_photo + J_geo * r_geo;
+                r2_sum += r_photo * r_photo + r_geo * r_geo;
+            });
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
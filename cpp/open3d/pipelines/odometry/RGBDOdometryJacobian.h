@@ -77,6 +77,21 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const = 0;
+
+    /// Function to accumulate J^T J, J^T r and the sum of squared residuals
+    /// over all rows of \p corresps. The default implementation calls
+    /// ComputeJacobianAndResidual once per row. The built-in terms evaluate
+    /// all rows in a single loop without virtual calls, unless they are
+    /// further derived.
+    virtual std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTr(const geometry::RGBDImage &source,
+                     const geometry::RGBDImage &target,
+                     const geometry::Image &source_xyz,
+                     const geometry::RGBDImage &target_dx,
+                     const geometry::RGBDImage &target_dy,
+                     const Eigen::Matrix3d &intrinsic,
+                     const Eigen::Matrix4d &extrinsic,
+                     const CorrespondenceSetPixelWise &corresps) const;
 };
 
 /// \class RGBDOdometryJacobianFromColorTerm
@@ -109,6 +124,16 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
 };
 
 /// \class RGBDOdometryJacobianFromHybridTerm
@@ -140,6 +165,16 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
 };
 
 }  // namespace odometry
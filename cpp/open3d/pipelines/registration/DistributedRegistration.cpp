@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/DistributedRegistration.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+namespace {
+// Layout of the values of a "register_pair" outcome: the transformation and
+// the information matrix in column-major order, the fitness and the rmse.
+const size_t kTransformationOffset = 0;
+const size_t kInformationOffset = 16;
+const size_t kPairRegistrationValueCount = 16 + 36 + 2;
+}  // namespace
+
+std::vector<int64_t> AddFragmentTasks(io::rpc::TaskScheduler &scheduler,
+                                      int num_fragments) {
+    std::vector<int64_t> task_ids;
+    for (int i = 0; i < num_fragments; ++i) {
+        task_ids.push_back(scheduler.AddTask({"make_fragment", {i}, ""}));
+    }
+    return task_ids;
+}
+
+std::vector<int64_t> AddPairRegistrationTasks(
+        io::rpc::TaskScheduler &scheduler,
+        int num_fragments,
+        bool loop_closure) {
+    std::vector<int64_t> task_ids;
+    for (int s = 0; s < num_fragments; ++s) {
+        const int t_end = loop_closure ? num_fragments : s + 2;
+        for (int t = s + 1; t < std::min(t_end, num_fragments); ++t) {
+            task_ids.push_back(
+                    scheduler.AddTask({"register_pair", {s, t}, ""}));
+        }
+    }
+    return task_ids;
+}
+
+void SetPairRegistrationOutcome(const RegistrationResult &result,
+                                const Eigen::Matrix6d &information,
+                                io::rpc::TaskOutcome &outcome) {
+    outcome.values_.resize(kPairRegistrationValueCount);
+    Eigen::Map<Eigen::Matrix4d>(outcome.values_.data() +
+                                kTransformationOffset) = result.transformation_;
+    Eigen::Map<Eigen::Matrix6d>(outcome.values_.data() + kInformationOffset) =
+            information;
+    outcome.values_[kPairRegistrationValueCount - 2] = result.fitness_;
+    outcome.values_[kPairRegistrationValueCount - 1] = result.inlier_rmse_;
+}
+
+PoseGraph CreatePoseGraphFromPairRegistrationTasks(
+        const io::rpc::TaskScheduler &scheduler,
+        const std::vector<int64_t> &task_ids,
+        int num_fragments) {
+    std::vector<PoseGraphEdge> odometry_edges(num_fragments);
+    std::vector<bool> has_odometry(num_fragments, false);
+    PoseGraph pose_graph;
+    for (int64_t id : task_ids) {
+        const io::rpc::Task task = scheduler.GetTask(id);
+        const io::rpc::TaskOutcome outcome = scheduler.GetOutcome(id);
+        if (task.args_.size() != 2) {
+            utility::LogError("Task {} is not a \"register_pair\" task.", id);
+        }
+        const int s = int(task.args_[0]);
+        const int t = int(task.args_[1]);
+        if (!outcome.success_) {
+            utility::LogWarning(
+                    "Registration of fragments {} and {} failed: {}", s, t,
+                    outcome.error_);
+            continue;
+        }
+        if (outcome.values_.empty()) {
+            continue;
+        }
+        if (outcome.values_.size() != kPairRegistrationValueCount) {
+            utility::LogError("Task {} has an invalid outcome.", id);
+        }
+        const Eigen::Matrix4d transformation =
+                Eigen::Map<const Eigen::Matrix4d>(outcome.values_.data() +
+                                                  kTransformationOffset);
+        const Eigen::Matrix6d information =
+                Eigen::Map<const Eigen::Matrix6d>(outcome.values_.data() +
+                                                  kInformationOffset);
+        PoseGraphEdge edge(s, t, transformation, information, t != s + 1);
+        if (t == s + 1) {
+            odometry_edges[s] = edge;
+            has_odometry[s] = true;
+        } else {
+            pose_graph.edges_.push_back(edge);
+        }
+    }
+
+    // Chain the odometry in fragment order, independent of the order in which
+    // the tasks finished.
+    Eigen::Matrix4d odometry = Eigen::Matrix4d::Identity();
+    pose_graph.nodes_.push_back(PoseGraphNode(odometry));
+    for (int s = 0; s + 1 < num_fragments; ++s) {
+        if (has_odometry[s]) {
+            odometry = odometry_edges[s].transformation_ * odometry;
+            pose_graph.edges_.push_back(odometry_edges[s]);
+        } else {
+            utility::LogWarning(
+                    "No odometry between fragments {} and {}, assuming "
+                    "identity.",
+                    s, s + 1);
+        }
+        pose_graph.nodes_.push_back(PoseGraphNode(odometry.inverse()));
+    }
+    return pose_graph;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
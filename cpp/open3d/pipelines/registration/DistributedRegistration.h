@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "open3d/io/rpc/TaskScheduler.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/pipelines/registration/Registration.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+/// \brief Adds a "make_fragment" task for each fragment of a reconstruction
+/// to the scheduler. The only argument of each task is the fragment id.
+///
+/// \param scheduler The scheduler distributing the tasks.
+/// \param num_fragments Number of fragments.
+/// \return The ids of the tasks.
+std::vector<int64_t> AddFragmentTasks(io::rpc::TaskScheduler &scheduler,
+                                      int num_fragments);
+
+/// \brief Adds a "register_pair" task for each pair of fragments to be
+/// registered to the scheduler. The arguments of each task are the source and
+/// the target fragment id.
+///
+/// \param scheduler The scheduler distributing the tasks.
+/// \param num_fragments Number of fragments.
+/// \param loop_closure If false, only consecutive fragments are registered.
+/// \return The ids of the tasks.
+std::vector<int64_t> AddPairRegistrationTasks(
+        io::rpc::TaskScheduler &scheduler,
+        int num_fragments,
+        bool loop_closure = true);
+
+/// \brief Stores the result of a pairwise registration in the outcome of a
+/// "register_pair" task on the worker side.
+///
+/// Workers leave the outcome empty for pairs that do not match. These pairs
+/// do not add an edge to the pose graph.
+///
+/// \param result The result of the registration of the fragment pair.
+/// \param information The information matrix of the registration.
+/// \param outcome The outcome to be returned to the scheduler.
+void SetPairRegistrationOutcome(const RegistrationResult &result,
+                                const Eigen::Matrix6d &information,
+                                io::rpc::TaskOutcome &outcome);
+
+/// \brief Creates the global pose graph of the fragments from the outcomes of
+/// finished "register_pair" tasks.
+///
+/// The node poses are chained from the registrations of consecutive
+/// fragments. Registrations of other pairs add uncertain edges.
+///
+/// \param scheduler The scheduler that distributed the tasks.
+/// \param task_ids The ids of the "register_pair" tasks.
+/// \param num_fragments Number of fragments.
+PoseGraph CreatePoseGraphFromPairRegistrationTasks(
+        const io::rpc::TaskScheduler &scheduler,
+        const std::vector<int64_t> &task_ids,
+        int num_fragments);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
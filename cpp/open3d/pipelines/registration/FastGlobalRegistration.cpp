@@ -40,7 +40,8 @@ namespace registration {
 static std::vector<std::pair<int, int>> AdvancedMatching(
         const std::vector<geometry::PointCloud>& point_cloud_vec,
         const std::vector<Feature>& features_vec,
-        const FastGlobalRegistrationOption& option) {
+        const FastGlobalRegistrationOption& option,
+        double& recall) {
     // STEP 0) Swap source and target if necessary
     int fi = 0, fj = 1;
     utility::LogDebug("Advanced matching : [{:d} - {:d}]", fi, fj);
@@ -56,8 +57,19 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
     // STEP 1) Initial matching
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
+    geometry::KDTreeFlann feature_tree_i;
+    geometry::KDTreeFlann feature_tree_j;
+    option.matching_option_.Apply(feature_tree_i);
+    option.matching_option_.Apply(feature_tree_j);
+    feature_tree_i.SetFeature(features_vec[fi]);
+    feature_tree_j.SetFeature(features_vec[fj]);
+    recall = 1.0;
+    if (option.matching_option_.IsApproximate()) {
+        recall = EstimateFeatureMatchingRecall(
+                feature_tree_i, features_vec[fi], features_vec[fj],
+                option.matching_option_.recall_sample_size_);
+        utility::LogDebug("Estimated feature matching recall: {:.3f}", recall);
+    }
     std::vector<int> corresK;
     std::vector<double> dis;
     std::vector<std::pair<int, int>> corres;
@@ -351,18 +363,21 @@ RegistrationResult FastGlobalRegistration(
     std::tie(pcd_mean_vec, scale_global, scale_start) =
             NormalizePointCloud(point_cloud_vec, option);
     std::vector<std::pair<int, int>> corres;
-    corres = AdvancedMatching(point_cloud_vec, features_vec, option);
+    double recall;
+    corres = AdvancedMatching(point_cloud_vec, features_vec, option, recall);
     Eigen::Matrix4d transformation;
     transformation = OptimizePairwiseRegistration(point_cloud_vec, corres,
                                                   scale_global, option);
 
     // as the original code T * point_cloud_vec[1] is aligned with
     // point_cloud_vec[0] matrix inverse is applied here.
-    return EvaluateRegistration(
+    auto result = EvaluateRegistration(
             source_orig, target_orig, option.maximum_correspondence_distance_,
             GetTransformationOriginalScale(transformation, pcd_mean_vec,
                                            scale_global)
                     .inverse());
+    result.feature_matching_recall_ = recall;
+    return result;
 }
 
 }  // namespace registration
@@ -27,6 +27,7 @@
 #include "open3d/pipelines/registration/Feature.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
@@ -154,6 +155,54 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     return feature;
 }
 
+void FeatureMatchingOption::Apply(geometry::KDTreeFlann &kdtree) const {
+    if (IsApproximate()) {
+        kdtree.SetApproximateSearch(num_trees_, checks_);
+    } else {
+        kdtree.SetApproximateSearch(0, -1);
+    }
+}
+
+double EstimateFeatureMatchingRecall(const geometry::KDTreeFlann &kdtree,
+                                     const Feature &reference,
+                                     const Feature &query,
+                                     int sample_size) {
+    if (reference.Num() == 0 || query.Num() == 0 || sample_size <= 0) {
+        return 1.0;
+    }
+    if (reference.Dimension() != query.Dimension()) {
+        utility::LogError(
+                "[EstimateFeatureMatchingRecall] Feature dimensions do not "
+                "match: {} != {}.",
+                reference.Dimension(), query.Dimension());
+    }
+    const int num_query = static_cast<int>(query.Num());
+    const int num_sample = std::min(sample_size, num_query);
+    // Evenly spaced samples keep the estimate deterministic.
+    const double stride = double(num_query) / num_sample;
+    int num_hit = 0;
+#pragma omp parallel for schedule(static) reduction(+ : num_hit)
+    for (int s = 0; s < num_sample; s++) {
+        const int i = static_cast<int>(s * stride);
+        Eigen::VectorXd q = query.data_.col(i);
+        std::vector<int> indices(1);
+        std::vector<double> dists(1);
+        if (kdtree.SearchKNN(q, 1, indices, dists) <= 0) {
+            continue;
+        }
+        double exact_dist = (reference.data_.colwise() - q)
+                                    .colwise()
+                                    .squaredNorm()
+                                    .minCoeff();
+        // Ties count as hits, any point at the nearest distance is a correct
+        // match.
+        if (dists[0] <= exact_dist * (1.0 + 1e-12)) {
+            num_hit++;
+        }
+    }
+    return double(num_hit) / num_sample;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -36,7 +36,8 @@ namespace open3d {
 
 namespace geometry {
 class PointCloud;
-}
+class KDTreeFlann;
+}  // namespace geometry
 
 namespace pipelines {
 namespace registration {
@@ -64,6 +65,60 @@ public:
     Eigen::MatrixXd data_;
 };
 
+/// \class FeatureMatchingOption
+///
+/// \brief Options for nearest neighbor matching in feature space.
+///
+/// By default features are matched exactly with a single KDTree. For large
+/// point clouds, matching can instead use a forest of randomized KDTrees that
+/// visits a bounded number of leaves per query, trading recall for speed.
+class FeatureMatchingOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param num_trees Number of randomized KDTrees. 0 matches exactly.
+    /// \param checks Maximum number of leaves visited per query in
+    /// approximate mode.
+    /// \param recall_sample_size Number of queries checked against brute
+    /// force to estimate the recall in approximate mode.
+    FeatureMatchingOption(int num_trees = 0,
+                          int checks = 64,
+                          int recall_sample_size = 256)
+        : num_trees_(num_trees),
+          checks_(checks),
+          recall_sample_size_(recall_sample_size) {}
+    ~FeatureMatchingOption() {}
+
+    /// Returns true if matching is approximate.
+    bool IsApproximate() const { return num_trees_ > 0; }
+    /// Configures \p kdtree for this option. Must be called before the
+    /// feature is set to avoid building the index twice.
+    void Apply(geometry::KDTreeFlann &kdtree) const;
+
+public:
+    /// Number of randomized KDTrees. 0 matches exactly.
+    int num_trees_;
+    /// Maximum number of leaves visited per query in approximate mode.
+    int checks_;
+    /// Number of queries used to estimate the recall in approximate mode.
+    int recall_sample_size_;
+};
+
+/// \brief Estimates the recall of nearest neighbor matching.
+///
+/// A sample of \p query features is matched with \p kdtree and compared to
+/// a brute force search over \p reference. Returns the fraction of sampled
+/// queries for which \p kdtree found a true nearest neighbor.
+///
+/// \param kdtree KDTree built over \p reference.
+/// \param reference The features \p kdtree is built over.
+/// \param query The query features.
+/// \param sample_size Number of sampled queries.
+double EstimateFeatureMatchingRecall(const geometry::KDTreeFlann &kdtree,
+                                     const Feature &reference,
+                                     const Feature &query,
+                                     int sample_size);
+
 /// Function to compute FPFH feature for a point cloud.
 ///
 /// \param input The Input point cloud.
@@ -28,6 +28,9 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
+#include <array>
+#include <numeric>
 #include <tuple>
 #include <vector>
 
@@ -36,6 +39,7 @@
 #include "open3d/pipelines/registration/PoseGraph.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
@@ -184,15 +188,22 @@ static double ComputeResidual(const PoseGraph &pose_graph,
 static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
     int n_edges = (int)pose_graph.edges_.size();
     Eigen::VectorXd output(n_edges * 6);
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+    utility::ParallelFor(0, n_edges, [&](int64_t iter_edge) {
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        std::tie(X_inv, Ts, Tt_inv) =
+                GetRelativePoses(pose_graph, (int)iter_edge);
         Eigen::Vector6d e = GetMisalignmentVector(X_inv, Ts, Tt_inv);
         output.block<6, 1>(iter_edge * 6, 0) = e;
-    }
+    });
     return output;
 }
 
+/// \class PoseGraphLinearSystem
+///
+/// Sparse normal equations H * delta = b of the pose graph, with one 6x6
+/// block per free node and two off-diagonal blocks per connected pair of
+/// free nodes. Nodes that are not free are held fixed.
+///
 /// The information matrix used here is consistent with [Choi et al 2015].
 /// It is [-p_x | I]^T[-p_x | I]. \zeta is [\alpha \beta \gamma a b c]
 /// Another definition of information matrix used for [Kümmerle et al 2011] is
@@ -204,48 +215,229 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 /// https ://github.com/RainerKuemmerle/g2o/blob/master/doc/g2o.pdf
 /// Eq (20) and Eq (21). (There is a typo in the equation though. B should be J)
 ///
-/// This function focuses the case that every edge has two nodes (not hyper
+/// This class focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
+///
+/// The sparsity pattern only depends on the graph topology. It is built and
+/// symbolically factorized once, and every Compute() only refreshes values.
+class PoseGraphLinearSystem {
+public:
+    /// Normal equations of the whole graph.
+    explicit PoseGraphLinearSystem(const PoseGraph &pose_graph)
+        : PoseGraphLinearSystem(pose_graph,
+                                Range((int)pose_graph.edges_.size()),
+                                Range((int)pose_graph.nodes_.size())) {}
+
+    /// Normal equations over the edges \p edges, where node i is the free
+    /// variable node_to_var[i], or is held fixed if node_to_var[i] < 0.
+    PoseGraphLinearSystem(const PoseGraph &pose_graph,
+                          const std::vector<int> &edges,
+                          const std::vector<int> &node_to_var)
+        : edges_(edges), node_to_var_(node_to_var) {
+        int n_vars = 0;
+        for (int var : node_to_var_) {
+            n_vars = std::max(n_vars, var + 1);
+        }
+        int n_edges = (int)edges_.size();
 
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+        // Block rows of each block column, always including the diagonal.
+        std::vector<std::vector<int>> block_rows(n_vars);
+        for (int i = 0; i < n_vars; i++) {
+            block_rows[i].push_back(i);
+        }
+        has_fixed_nodes_ = false;
+        for (int iter_edge : edges_) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            int i = node_to_var_[t.source_node_id_];
+            int j = node_to_var_[t.target_node_id_];
+            if (i >= 0 && j >= 0) {
+                block_rows[i].push_back(j);
+                block_rows[j].push_back(i);
+            } else {
+                has_fixed_nodes_ = true;
+            }
+        }
+        Eigen::VectorXi nnz_per_col(n_vars * 6);
+        for (int j = 0; j < n_vars; j++) {
+            std::sort(block_rows[j].begin(), block_rows[j].end());
+            block_rows[j].erase(
+                    std::unique(block_rows[j].begin(), block_rows[j].end()),
+                    block_rows[j].end());
+            nnz_per_col.segment<6>(j * 6).setConstant(
+                    (int)block_rows[j].size() * 6);
+        }
 
-        Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
-
-        Eigen::Matrix6d Js, Jt;
-        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
-        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
-        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
-        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
-        double line_process_iter = t.confidence_;
-
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+        H_.resize(n_vars * 6, n_vars * 6);
+        H_.reserve(nnz_per_col);
+        for (int j = 0; j < n_vars; j++) {
+            for (int k = 0; k < 6; k++) {
+                for (int i : block_rows[j]) {
+                    for (int r = 0; r < 6; r++) {
+                        H_.insert(i * 6 + r, j * 6 + k) = 0.0;
+                    }
+                }
+            }
+        }
+        H_.makeCompressed();
+        b_.resize(n_vars * 6);
+
+        // Entry (6i + r, 6j + k) is stored at
+        // outerIndexPtr()[6j + k] + 6 * rank of i in block_rows[j] + r.
+        auto rank = [&block_rows](int i, int j) {
+            if (i < 0 || j < 0) return -1;
+            return (int)(std::lower_bound(block_rows[j].begin(),
+                                          block_rows[j].end(), i) -
+                         block_rows[j].begin());
+        };
+        edge_ranks_.resize(n_edges);
+        for (int k = 0; k < n_edges; k++) {
+            const PoseGraphEdge &t = pose_graph.edges_[edges_[k]];
+            int i = node_to_var_[t.source_node_id_];
+            int j = node_to_var_[t.target_node_id_];
+            edge_ranks_[k] = {rank(i, i), rank(i, j), rank(j, i), rank(j, j)};
+        }
+        diagonal_.resize(n_vars * 6);
+        for (int j = 0; j < n_vars; j++) {
+            for (int k = 0; k < 6; k++) {
+                diagonal_[j * 6 + k] = H_.outerIndexPtr()[j * 6 + k] +
+                                       6 * rank(j, j) + k;
+            }
+        }
+        edge_terms_.resize(n_edges);
+        solver_.analyzePattern(H_);
     }
-    return std::make_tuple(std::move(H), std::move(b));
-}
+
+    /// Recomputes H and b at the current poses. Jacobians are evaluated in
+    /// parallel over edges, and the blocks are then scattered into H.
+    void Compute(const PoseGraph &pose_graph) {
+        int n_edges = (int)edges_.size();
+        utility::ParallelFor(0, n_edges, [&](int64_t k) {
+            int iter_edge = edges_[k];
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+
+            Eigen::Matrix4d X_inv, Ts, Tt_inv;
+            std::tie(X_inv, Ts, Tt_inv) =
+                    GetRelativePoses(pose_graph, iter_edge);
+            Eigen::Vector6d e = GetMisalignmentVector(X_inv, Ts, Tt_inv);
+
+            Eigen::Matrix6d Js, Jt;
+            std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+            Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
+            Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
+            Eigen::Vector6d eT_Info = e.transpose() * t.information_;
+            double line_process_iter = t.confidence_;
+
+            EdgeTerms &terms = edge_terms_[k];
+            terms.H_ss_ = line_process_iter * JsT_Info * Js;
+            terms.H_st_ = line_process_iter * JsT_Info * Jt;
+            terms.H_ts_ = line_process_iter * JtT_Info * Js;
+            terms.H_tt_ = line_process_iter * JtT_Info * Jt;
+            terms.b_s_ = -line_process_iter * Js.transpose() * eT_Info;
+            terms.b_t_ = -line_process_iter * Jt.transpose() * eT_Info;
+        });
+
+        std::fill(H_.valuePtr(), H_.valuePtr() + H_.nonZeros(), 0.0);
+        b_.setZero();
+        for (int k = 0; k < n_edges; k++) {
+            const PoseGraphEdge &t = pose_graph.edges_[edges_[k]];
+            const EdgeTerms &terms = edge_terms_[k];
+            const std::array<int, 4> &ranks = edge_ranks_[k];
+            int i = node_to_var_[t.source_node_id_];
+            int j = node_to_var_[t.target_node_id_];
+            if (i >= 0) {
+                AddBlock(i, ranks[0], terms.H_ss_);
+                b_.block<6, 1>(i * 6, 0) += terms.b_s_;
+            }
+            if (i >= 0 && j >= 0) {
+                AddBlock(j, ranks[1], terms.H_st_);
+                AddBlock(i, ranks[2], terms.H_ts_);
+            }
+            if (j >= 0) {
+                AddBlock(j, ranks[3], terms.H_tt_);
+                b_.block<6, 1>(j * 6, 0) += terms.b_t_;
+            }
+        }
+    }
+
+    /// Largest diagonal entry of H.
+    double MaxDiagonal() const {
+        double max_diag = 0.0;
+        for (int64_t idx : diagonal_) {
+            max_diag = std::max(max_diag, H_.valuePtr()[idx]);
+        }
+        return max_diag;
+    }
+
+    /// Solves (H + lambda * I) * delta = b. The symbolic factorization is
+    /// reused; conjugate gradients are used if the factorization fails.
+    ///
+    /// Without damping and fixed nodes, H is singular along the global rigid
+    /// motion of the graph. The first variable is then anchored by a penalty
+    /// on its increment, which selects one of the equivalent minimizers
+    /// instead of leaving the gauge to round-off.
+    Eigen::VectorXd Solve(double lambda = 0.0) {
+        Eigen::SparseMatrix<double> A = H_;
+        if (lambda != 0.0) {
+            for (int64_t idx : diagonal_) {
+                A.valuePtr()[idx] += lambda;
+            }
+        } else if (!has_fixed_nodes_ && !diagonal_.empty()) {
+            double anchor = std::max(MaxDiagonal(), 1.0);
+            for (int k = 0; k < 6; k++) {
+                A.valuePtr()[diagonal_[k]] += anchor;
+            }
+        }
+        solver_.factorize(A);
+        if (solver_.info() == Eigen::Success) {
+            Eigen::VectorXd x = solver_.solve(b_);
+            if (solver_.info() == Eigen::Success) {
+                return x;
+            }
+        }
+        utility::LogWarning(
+                "Sparse LDLT failed, switched to conjugate gradient solver");
+        Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                                 Eigen::Lower | Eigen::Upper>
+                cg(A);
+        return cg.solve(b_);
+    }
+
+public:
+    Eigen::SparseMatrix<double> H_;
+    Eigen::VectorXd b_;
+
+private:
+    struct EdgeTerms {
+        Eigen::Matrix6d_u H_ss_, H_st_, H_ts_, H_tt_;
+        Eigen::Matrix<double, 6, 1, Eigen::DontAlign> b_s_, b_t_;
+    };
+
+    static std::vector<int> Range(int n) {
+        std::vector<int> range(n);
+        std::iota(range.begin(), range.end(), 0);
+        return range;
+    }
+
+    /// Adds a 6x6 block to block column \p j at block row rank \p rank.
+    void AddBlock(int j, int rank, const Eigen::Matrix6d_u &block) {
+        double *values = H_.valuePtr();
+        const int *outer = H_.outerIndexPtr();
+        for (int k = 0; k < 6; k++) {
+            double *col = values + outer[j * 6 + k] + rank * 6;
+            for (int r = 0; r < 6; r++) {
+                col[r] += block(r, k);
+            }
+        }
+    }
+
+    std::vector<int> edges_;
+    std::vector<int> node_to_var_;
+    bool has_fixed_nodes_;
+    std::vector<std::array<int, 4>> edge_ranks_;
+    std::vector<int64_t> diagonal_;
+    std::vector<EdgeTerms> edge_terms_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+};
 
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
@@ -511,11 +703,11 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    PoseGraphLinearSystem system(pose_graph);
+    const Eigen::VectorXd &b = system.b_;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    system.Compute(pose_graph);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
@@ -529,13 +721,8 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
-        bool solver_success = false;
-
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        Eigen::VectorXd delta = system.Solve();
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -558,7 +745,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             x = UpdatePoseVector(pose_graph);
             valid_edges_num = UpdateConfidence(pose_graph, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            system.Compute(pose_graph);
 
             stop = stop || CheckRightTerm(b, criteria);
             if (stop) break;
@@ -602,16 +789,14 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    PoseGraphLinearSystem system(pose_graph);
+    const Eigen::VectorXd &b = system.b_;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    system.Compute(pose_graph);
 
-    Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
-    double current_lambda = tau * H_diag.maxCoeff();
+    double current_lambda = tau * system.MaxDiagonal();
     double ni = 2.0;
     double rho = 0.0;
 
@@ -629,14 +814,8 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
-            bool solver_success = false;
-
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            // Solve (H + lambda * I) @ delta == b using a sparse solver
+            Eigen::VectorXd delta = system.Solve(current_lambda);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -667,7 +846,7 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    system.Compute(pose_graph);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
@@ -717,6 +896,155 @@ void GlobalOptimization(PoseGraph &pose_graph,
     pose_graph = *pose_graph_pre_pruned_2;
 }
 
+IncrementalGlobalOptimization::IncrementalGlobalOptimization(
+        const GlobalOptimizationOption &option
+        /* = GlobalOptimizationOption() */,
+        double relinearization_threshold /* = 1e-3 */)
+    : option_(option),
+      relinearization_threshold_(relinearization_threshold),
+      information_sum_(0.0) {}
+
+int IncrementalGlobalOptimization::AddNode(const PoseGraphNode &node) {
+    pose_graph_.nodes_.push_back(node);
+    node_edges_.emplace_back();
+    pending_.push_back(false);
+    return (int)pose_graph_.nodes_.size() - 1;
+}
+
+void IncrementalGlobalOptimization::AddEdge(const PoseGraphEdge &edge) {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    if (edge.source_node_id_ < 0 || edge.source_node_id_ >= n_nodes ||
+        edge.target_node_id_ < 0 || edge.target_node_id_ >= n_nodes) {
+        utility::LogError(
+                "[IncrementalGlobalOptimization] Edge ({:d}, {:d}) refers to "
+                "a node that has not been added.",
+                edge.source_node_id_, edge.target_node_id_);
+    }
+    int edge_id = (int)pose_graph_.edges_.size();
+    pose_graph_.edges_.push_back(edge);
+    node_edges_[edge.source_node_id_].push_back(edge_id);
+    node_edges_[edge.target_node_id_].push_back(edge_id);
+    pending_[edge.source_node_id_] = true;
+    pending_[edge.target_node_id_] = true;
+    information_sum_ += edge.information_(5, 5);
+}
+
+int IncrementalGlobalOptimization::OptimizeIncremental(
+        const GlobalOptimizationConvergenceCriteria &criteria
+        /* = GlobalOptimizationConvergenceCriteria() */,
+        double time_budget /* = -1.0 */) {
+    double start_time = utility::Timer::GetSystemTimeInMilliseconds();
+    auto out_of_time = [&]() {
+        return time_budget >= 0.0 &&
+               utility::Timer::GetSystemTimeInMilliseconds() - start_time >
+                       time_budget;
+    };
+
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    int n_edges = (int)pose_graph_.edges_.size();
+    int reference_node = option_.reference_node_ >= 0 &&
+                                         option_.reference_node_ < n_nodes
+                                 ? option_.reference_node_
+                                 : 0;
+    // see Section 5 in [Choi et al 2015]
+    double line_process_weight =
+            n_edges > 0 ? option_.preference_loop_closure_ *
+                                  pow(option_.max_correspondence_distance_,
+                                      2) *
+                                  information_sum_ / (double)n_edges
+                        : 0.0;
+
+    std::vector<int> node_to_var(n_nodes, -1);
+    bool done = false;
+    while (!done && !out_of_time()) {
+        // The reference node is held fixed and isolated nodes have nothing
+        // to optimize.
+        std::vector<int> active;
+        for (int i = 0; i < n_nodes; i++) {
+            if (pending_[i] && i != reference_node && !node_edges_[i].empty()) {
+                node_to_var[i] = (int)active.size();
+                active.push_back(i);
+            }
+            pending_[i] = false;
+        }
+        if (active.empty()) break;
+
+        std::vector<int> edges;
+        for (int i : active) {
+            edges.insert(edges.end(), node_edges_[i].begin(),
+                         node_edges_[i].end());
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        PoseGraphLinearSystem system(pose_graph_, edges, node_to_var);
+        Eigen::VectorXd moved = Eigen::VectorXd::Zero(active.size() * 6);
+        for (int iter = 0; iter < criteria.max_iteration_; iter++) {
+            for (int iter_edge : edges) {
+                PoseGraphEdge &t = pose_graph_.edges_[iter_edge];
+                if (t.uncertain_) {
+                    Eigen::Matrix4d X_inv, Ts, Tt_inv;
+                    std::tie(X_inv, Ts, Tt_inv) =
+                            GetRelativePoses(pose_graph_, iter_edge);
+                    Eigen::Vector6d e =
+                            GetMisalignmentVector(X_inv, Ts, Tt_inv);
+                    double residual_square = e.transpose() * t.information_ * e;
+                    double temp = line_process_weight /
+                                  (line_process_weight + residual_square);
+                    t.confidence_ = temp * temp;
+                }
+            }
+            system.Compute(pose_graph_);
+            if (CheckRightTerm(system.b_, criteria)) break;
+
+            Eigen::VectorXd delta = system.Solve();
+            for (size_t k = 0; k < active.size(); k++) {
+                Eigen::Vector6d delta_iter = delta.block<6, 1>(k * 6, 0);
+                pose_graph_.nodes_[active[k]].pose_ =
+                        utility::TransformVector6dToMatrix4d(delta_iter) *
+                        pose_graph_.nodes_[active[k]].pose_;
+            }
+            moved += delta;
+            if (delta.lpNorm<Eigen::Infinity>() < relinearization_threshold_ ||
+                out_of_time()) {
+                break;
+            }
+        }
+
+        // Neighbors of nodes that moved by more than the threshold are
+        // relinearized together with the current nodes in the next round.
+        done = true;
+        for (size_t k = 0; k < active.size(); k++) {
+            if (moved.block<6, 1>(k * 6, 0).lpNorm<Eigen::Infinity>() <
+                relinearization_threshold_) {
+                continue;
+            }
+            for (int iter_edge : node_edges_[active[k]]) {
+                const PoseGraphEdge &t = pose_graph_.edges_[iter_edge];
+                for (int i : {t.source_node_id_, t.target_node_id_}) {
+                    if (node_to_var[i] < 0 && i != reference_node &&
+                        !pending_[i]) {
+                        pending_[i] = true;
+                        done = false;
+                    }
+                }
+            }
+        }
+        for (int i : active) {
+            if (!done) pending_[i] = true;
+            node_to_var[i] = -1;
+        }
+    }
+
+    int n_pending = (int)std::count(pending_.begin(), pending_.end(), true);
+    utility::LogDebug(
+            "[IncrementalGlobalOptimization] {:d} nodes left to relinearize "
+            "after {:.3f} ms.",
+            n_pending,
+            utility::Timer::GetSystemTimeInMilliseconds() - start_time);
+    return n_pending;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
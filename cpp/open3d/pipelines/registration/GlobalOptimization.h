@@ -27,16 +27,16 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
 #include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
-class PoseGraph;
-
 /// Function to optimize a PoseGraph
 /// Reference:
 /// [Kümmerle et al 2011]
@@ -62,6 +62,60 @@ void GlobalOptimization(
 std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
         const PoseGraph &pose_graph, const GlobalOptimizationOption &option);
 
+/// \class IncrementalGlobalOptimization
+///
+/// \brief Incremental pose graph optimization for online reconstruction.
+///
+/// Nodes and edges are added as they arrive. OptimizeIncremental() only
+/// relinearizes the nodes touched by new edges, and grows the optimized
+/// region to neighboring nodes while their poses move by more than the
+/// relinearization threshold, similar to the fluid relinearization of iSAM2.
+/// All other nodes, and always the reference node, are held fixed.
+class IncrementalGlobalOptimization {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param option Global optimization options. reference_node_ selects the
+    /// node that is held fixed, the first node is used if it is -1.
+    /// \param relinearization_threshold Minimum change of a node's linearized
+    /// pose (radians and meters) that triggers relinearization of its
+    /// neighbors.
+    IncrementalGlobalOptimization(
+            const GlobalOptimizationOption &option = GlobalOptimizationOption(),
+            double relinearization_threshold = 1e-3);
+
+public:
+    /// Adds a node and returns its index.
+    int AddNode(const PoseGraphNode &node);
+    /// Adds an edge between two existing nodes. Both nodes are relinearized
+    /// by the next call to OptimizeIncremental().
+    void AddEdge(const PoseGraphEdge &edge);
+    /// \brief Optimizes the nodes affected since the last call.
+    ///
+    /// \param criteria Convergence criteria. max_iteration_ bounds the
+    /// Gauss-Newton iterations per relinearization round.
+    /// \param time_budget Time budget in milliseconds, negative for no limit.
+    /// Work left when the budget runs out is resumed by the next call.
+    /// \return Number of nodes still waiting to be relinearized.
+    int OptimizeIncremental(
+            const GlobalOptimizationConvergenceCriteria &criteria =
+                    GlobalOptimizationConvergenceCriteria(),
+            double time_budget = -1.0);
+    /// Returns the current pose graph.
+    const PoseGraph &GetPoseGraph() const { return pose_graph_; }
+
+private:
+    GlobalOptimizationOption option_;
+    double relinearization_threshold_;
+    PoseGraph pose_graph_;
+    /// Indices of the edges incident to each node.
+    std::vector<std::vector<int>> node_edges_;
+    /// Nodes to relinearize in the next round.
+    std::vector<bool> pending_;
+    /// Sum of information_(5, 5) over all edges, for the line process weight.
+    double information_sum_;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -64,6 +64,11 @@ public:
 /// \class GlobalOptimizationGaussNewton
 ///
 /// \brief Global optimization with Gauss-Newton algorithm.
+///
+/// The normal equations are singular along the global rigid motion of the
+/// graph. Each increment is computed with the increment of the first node
+/// penalized, which picks one of the equivalent solutions; the result is then
+/// expressed relative to GlobalOptimizationOption::reference_node_.
 class GlobalOptimizationGaussNewton : public GlobalOptimizationMethod {
 public:
     /// \brief Default Constructor.
@@ -26,22 +26,33 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/PointCloudFloat.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+template <typename PointCloudType, typename KDTreeType>
 static RegistrationResult GetRegistrationResultAndCorrespondences(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const geometry::KDTreeFlann &target_kdtree,
+        const PointCloudType &source,
+        const PointCloudType &target,
+        const KDTreeType &target_kdtree,
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
+    typedef typename std::decay<decltype(source.points_[0])>::type PointType;
+    typedef typename PointType::Scalar Scalar;
     RegistrationResult result(transformation);
     if (max_correspondence_distance <= 0.0) {
         return result;
@@ -49,31 +60,31 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
 
     double error2 = 0.0;
 
-#pragma omp parallel
-    {
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#pragma omp for nowait
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#pragma omp critical
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
-            }
-            error2 += error2_private;
-        }
-    }
+    std::mutex result_mutex;
+    utility::ParallelForRange(
+            0, (int64_t)source.points_.size(), 256,
+            [&](int64_t begin, int64_t end) {
+                double error2_private = 0.0;
+                CorrespondenceSet correspondence_set_private;
+                std::vector<int> indices(1);
+                std::vector<Scalar> dists(1);
+                for (int i = (int)begin; i < (int)end; i++) {
+                    const auto &point = source.points_[i];
+                    if (target_kdtree.SearchHybrid(
+                                point, max_correspondence_distance, 1,
+                                indices, dists) > 0) {
+                        error2_private += dists[0];
+                        correspondence_set_private.push_back(
+                                Eigen::Vector2i(i, indices[0]));
+                    }
+                }
+                std::lock_guard<std::mutex> lock(result_mutex);
+                result.correspondence_set_.insert(
+                        result.correspondence_set_.end(),
+                        correspondence_set_private.begin(),
+                        correspondence_set_private.end());
+                error2 += error2_private;
+            });
 
     if (result.correspondence_set_.empty()) {
         result.fitness_ = 0.0;
@@ -86,6 +97,37 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+/// Counts the correspondences that \p transformation brings within
+/// sqrt(\p max_dis2) and accumulates their squared distances into \p error2.
+/// Scoring stops early and returns -1 as soon as the hypothesis can no longer
+/// reach \p min_inliers inliers.
+static int CountRANSACInliers(const geometry::PointCloud &source,
+                              const geometry::PointCloud &target,
+                              const CorrespondenceSet &corres,
+                              double max_dis2,
+                              const Eigen::Matrix4d &transformation,
+                              int min_inliers,
+                              double &error2) {
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+    const int num_corres = static_cast<int>(corres.size());
+    int good = 0;
+    error2 = 0.0;
+    for (int i = 0; i < num_corres; i++) {
+        if (good + (num_corres - i) < min_inliers) {
+            return -1;
+        }
+        const Eigen::Vector2i &c = corres[i];
+        double dis2 = (R * source.points_[c[0]] + t - target.points_[c[1]])
+                              .squaredNorm();
+        if (dis2 < max_dis2) {
+            good++;
+            error2 += dis2;
+        }
+    }
+    return good;
+}
+
 static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -93,12 +135,14 @@ static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
     RegistrationResult result(transformation);
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
     double error2 = 0.0;
     int good = 0;
     double max_dis2 = max_correspondence_distance * max_correspondence_distance;
     for (const auto &c : corres) {
-        double dis2 =
-                (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        double dis2 = (R * source.points_[c[0]] + t - target.points_[c[1]])
+                              .squaredNorm();
         if (dis2 < max_dis2) {
             good++;
             error2 += dis2;
@@ -131,15 +175,10 @@ RegistrationResult EvaluateRegistration(
             pcd, target, kdtree, max_correspondence_distance, transformation);
 }
 
-RegistrationResult RegistrationICP(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        double max_correspondence_distance,
-        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
-        const TransformationEstimation &estimation
-        /* = TransformationEstimationPointToPoint(false)*/,
-        const ICPConvergenceCriteria
-                &criteria /* = ICPConvergenceCriteria()*/) {
+template <typename PointCloudType>
+static void CheckICPInputs(const PointCloudType &target,
+                           double max_correspondence_distance,
+                           const TransformationEstimation &estimation) {
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
@@ -153,11 +192,51 @@ RegistrationResult RegistrationICP(
                 "TransformationEstimationColoredICP "
                 "require pre-computed normal vectors for target PointCloud.");
     }
+}
+
+static Eigen::Matrix4d ComputeICPUpdate(
+        const TransformationEstimation &estimation,
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) {
+    return estimation.ComputeTransformation(source, target, corres);
+}
+
+/// Single precision clouds are only supported by the point to point and the
+/// point to plane estimations.
+static Eigen::Matrix4d ComputeICPUpdate(
+        const TransformationEstimation &estimation,
+        const geometry::PointCloudFloat &source,
+        const geometry::PointCloudFloat &target,
+        const CorrespondenceSet &corres) {
+    if (auto point_to_point =
+                dynamic_cast<const TransformationEstimationPointToPoint *>(
+                        &estimation)) {
+        return point_to_point->ComputeTransformation(source, target, corres);
+    }
+    if (auto point_to_plane =
+                dynamic_cast<const TransformationEstimationPointToPlane *>(
+                        &estimation)) {
+        return point_to_plane->ComputeTransformation(source, target, corres);
+    }
+    utility::LogError(
+            "PointCloudFloat only supports "
+            "TransformationEstimationPointToPoint and "
+            "TransformationEstimationPointToPlane.");
+    return Eigen::Matrix4d::Identity();
+}
 
+template <typename PointCloudType, typename KDTreeType>
+static RegistrationResult RegistrationICPWithKDTree(
+        const PointCloudType &source,
+        const PointCloudType &target,
+        const KDTreeType &kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
-    geometry::PointCloud pcd = source;
+    PointCloudType pcd = source;
     if (!init.isIdentity()) {
         pcd.Transform(init);
     }
@@ -167,8 +246,8 @@ RegistrationResult RegistrationICP(
     for (int i = 0; i < criteria.max_iteration_; i++) {
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
                           result.fitness_, result.inlier_rmse_);
-        Eigen::Matrix4d update = estimation.ComputeTransformation(
-                pcd, target, result.correspondence_set_);
+        Eigen::Matrix4d update = ComputeICPUpdate(estimation, pcd, target,
+                                                  result.correspondence_set_);
         transformation = update * transformation;
         pcd.Transform(update);
         RegistrationResult backup = result;
@@ -186,6 +265,41 @@ RegistrationResult RegistrationICP(
     return result;
 }
 
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    OPEN3D_PROFILE_SCOPE("pipelines::registration::RegistrationICP");
+    CheckICPInputs(target, max_correspondence_distance, estimation);
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    return RegistrationICPWithKDTree(source, target, kdtree,
+                                     max_correspondence_distance, init,
+                                     estimation, criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloudFloat &source,
+        const geometry::PointCloudFloat &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    OPEN3D_PROFILE_SCOPE("pipelines::registration::RegistrationICP");
+    CheckICPInputs(target, max_correspondence_distance, estimation);
+    geometry::KDTreeFlannFloat kdtree(target);
+    return RegistrationICPWithKDTree(source, target, kdtree,
+                                     max_correspondence_distance, init,
+                                     estimation, criteria);
+}
+
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -203,124 +317,147 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         return RegistrationResult();
     }
 
-    RegistrationResult best_result;
-    int exit_itr = -1;
-
-#pragma omp parallel
-    {
-        CorrespondenceSet ransac_corres(ransac_n);
-        RegistrationResult best_result_local;
-        int exit_itr_local = criteria.max_iteration_;
-
-#pragma omp for nowait
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (itr < exit_itr_local) {
-                for (int j = 0; j < ransac_n; j++) {
-                    ransac_corres[j] = corres[utility::UniformRandInt(
-                            0, static_cast<int>(corres.size()) - 1)];
+    // Hypotheses are generated, checked and scored in batches. Within a
+    // batch, the best inlier count found so far is shared so that scoring of
+    // hypotheses that cannot win stops early. The confidence-based iteration
+    // bound is tightened between batches.
+    struct Hypothesis {
+        Eigen::Matrix4d_u transformation_;
+        int good_;
+        double error2_;
+    };
+    const int batch_size = 1024;
+    const double max_dis2 =
+            max_correspondence_distance * max_correspondence_distance;
+    const int num_corres = static_cast<int>(corres.size());
+
+    std::vector<Hypothesis> hypotheses(
+            std::min(batch_size, std::max(criteria.max_iteration_, 0)));
+    Eigen::Matrix4d best_transformation = Eigen::Matrix4d::Identity();
+    int best_good = 0;
+    double best_error2 = 0.0;
+    int exit_itr = criteria.max_iteration_;
+    int itr = 0;
+    while (itr < exit_itr) {
+        const int num_hypotheses = std::min(batch_size, exit_itr - itr);
+        std::atomic<int> shared_best_good(best_good);
+        utility::ParallelFor(0, num_hypotheses, [&](int64_t k) {
+            Hypothesis &hypothesis = hypotheses[k];
+            hypothesis.good_ = -1;
+
+            CorrespondenceSet ransac_corres(ransac_n);
+            for (int j = 0; j < ransac_n; j++) {
+                ransac_corres[j] =
+                        corres[utility::UniformRandInt(0, num_corres - 1)];
+            }
+            Eigen::Matrix4d transformation = estimation.ComputeTransformation(
+                    source, target, ransac_corres);
+
+            // Check transformation: inexpensive
+            for (const auto &checker : checkers) {
+                if (!checker.get().Check(source, target, ransac_corres,
+                                         transformation)) {
+                    return;
                 }
+            }
 
-                Eigen::Matrix4d transformation =
-                        estimation.ComputeTransformation(source, target,
-                                                         ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (!check) continue;
-
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto result = EvaluateRANSACBasedOnCorrespondence(
-                        pcd, target, corres, max_correspondence_distance,
-                        transformation);
-
-                if (result.IsBetterRANSACThan(best_result_local)) {
-                    best_result_local = result;
-
-                    // Update exit condition if necessary
-                    double exit_itr_d =
-                            std::log(1.0 - criteria.confidence_) /
-                            std::log(1.0 - std::pow(result.fitness_, ransac_n));
-                    exit_itr_local =
-                            exit_itr_d < double(criteria.max_iteration_)
-                                    ? static_cast<int>(std::ceil(exit_itr_d))
-                                    : exit_itr_local;
-                }
-            }  // if < exit_itr_local
-        }      // for loop
-#pragma omp critical
-        {
-            if (best_result_local.IsBetterRANSACThan(best_result)) {
-                best_result = best_result_local;
+            hypothesis.transformation_ = transformation;
+            hypothesis.good_ = CountRANSACInliers(
+                    source, target, corres, max_dis2, transformation,
+                    shared_best_good.load(std::memory_order_relaxed),
+                    hypothesis.error2_);
+            int current = shared_best_good.load(std::memory_order_relaxed);
+            while (hypothesis.good_ > current &&
+                   !shared_best_good.compare_exchange_weak(
+                           current, hypothesis.good_,
+                           std::memory_order_relaxed)) {
             }
-            if (exit_itr_local > exit_itr) {
-                exit_itr = exit_itr_local;
+        });
+
+        bool improved = false;
+        for (int k = 0; k < num_hypotheses; k++) {
+            const Hypothesis &hypothesis = hypotheses[k];
+            if (hypothesis.good_ <= 0) continue;
+            if (hypothesis.good_ > best_good ||
+                (hypothesis.good_ == best_good &&
+                 hypothesis.error2_ < best_error2)) {
+                best_transformation = hypothesis.transformation_;
+                best_good = hypothesis.good_;
+                best_error2 = hypothesis.error2_;
+                improved = true;
+            }
+        }
+        itr += num_hypotheses;
+
+        if (improved) {
+            // Update exit condition if necessary
+            double fitness = (double)best_good / (double)num_corres;
+            double exit_itr_d = std::log(1.0 - criteria.confidence_) /
+                                std::log(1.0 - std::pow(fitness, ransac_n));
+            if (exit_itr_d < double(exit_itr)) {
+                exit_itr = static_cast<int>(std::ceil(exit_itr_d));
             }
         }
     }
+
+    RegistrationResult best_result;
+    if (best_good > 0) {
+        best_result = EvaluateRANSACBasedOnCorrespondence(
+                source, target, corres, max_correspondence_distance,
+                best_transformation);
+    }
     utility::LogDebug(
             "RANSAC exits at {:d}-th iteration: inlier ratio {:e}, "
             "RMSE {:e}",
-            exit_itr, best_result.fitness_, best_result.inlier_rmse_);
+            itr, best_result.fitness_, best_result.inlier_rmse_);
     return best_result;
 }
 
-RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+/// Feature matching RANSAC with prebuilt feature KD-trees. \p kdtree_source is
+/// only used if \p mutual_filter is set.
+static RegistrationResult RegistrationRANSACBasedOnFeatureMatchingWithKDTrees(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const Feature &source_feature,
         const Feature &target_feature,
+        const geometry::KDTreeFlann *kdtree_source,
+        const geometry::KDTreeFlann &kdtree_target,
         bool mutual_filter,
         double max_correspondence_distance,
-        const TransformationEstimation &estimation
-        /* = TransformationEstimationPointToPoint(false)*/,
-        int ransac_n /* = 3*/,
+        const TransformationEstimation &estimation,
+        int ransac_n,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
-                &checkers /* = {}*/,
-        const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
-    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
-        return RegistrationResult();
-    }
-
+                &checkers,
+        const RANSACConvergenceCriteria &criteria,
+        const FeatureMatchingOption &matching_option) {
     int num_src_pts = int(source.points_.size());
     int num_tgt_pts = int(target.points_.size());
 
-    geometry::KDTreeFlann kdtree_target(target_feature);
+    double recall = 1.0;
+    if (matching_option.IsApproximate()) {
+        recall = EstimateFeatureMatchingRecall(
+                kdtree_target, target_feature, source_feature,
+                matching_option.recall_sample_size_);
+        utility::LogDebug("Estimated feature matching recall: {:.3f}", recall);
+    }
     pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
+    std::vector<int> corres_tmp;
+    std::vector<double> dist_tmp;
 
-#pragma omp parallel for
-    for (int i = 0; i < num_src_pts; i++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
+    kdtree_target.SearchKNNBatch(source_feature.data_, 1, corres_tmp,
+                                 dist_tmp);
+    for (int i = 0; i < num_src_pts; ++i) {
+        corres_ij[i] = Eigen::Vector2i(i, corres_tmp[i]);
     }
 
     // Do reverse check if mutual_filter is enabled
     if (mutual_filter) {
-        geometry::KDTreeFlann kdtree_source(source_feature);
         pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
 
-#pragma omp parallel for
+        kdtree_source->SearchKNNBatch(target_feature.data_, 1, corres_tmp,
+                                      dist_tmp);
         for (int j = 0; j < num_tgt_pts; ++j) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
+            corres_ji[j] = Eigen::Vector2i(corres_tmp[j], j);
         }
 
         pipelines::registration::CorrespondenceSet corres_mutual;
@@ -335,18 +472,178 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         if (int(corres_mutual.size()) >= ransac_n * 3) {
             utility::LogDebug("{:d} correspondences remain after mutual filter",
                               corres_mutual.size());
-            return RegistrationRANSACBasedOnCorrespondence(
+            auto result = RegistrationRANSACBasedOnCorrespondence(
                     source, target, corres_mutual, max_correspondence_distance,
                     estimation, ransac_n, checkers, criteria);
+            result.feature_matching_recall_ = recall;
+            return result;
         }
         utility::LogDebug(
                 "Too few correspondences after mutual filter, fall back to "
                 "original correspondences.");
     }
 
-    return RegistrationRANSACBasedOnCorrespondence(
+    auto result = RegistrationRANSACBasedOnCorrespondence(
             source, target, corres_ij, max_correspondence_distance, estimation,
             ransac_n, checkers, criteria);
+    result.feature_matching_recall_ = recall;
+    return result;
+}
+
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const Feature &source_feature,
+        const Feature &target_feature,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 3*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/,
+        const FeatureMatchingOption &matching_option
+        /* = FeatureMatchingOption()*/) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
+    }
+
+    geometry::KDTreeFlann kdtree_target;
+    matching_option.Apply(kdtree_target);
+    kdtree_target.SetFeature(target_feature);
+    geometry::KDTreeFlann kdtree_source;
+    if (mutual_filter) {
+        matching_option.Apply(kdtree_source);
+        kdtree_source.SetFeature(source_feature);
+    }
+    return RegistrationRANSACBasedOnFeatureMatchingWithKDTrees(
+            source, target, source_feature, target_feature, &kdtree_source,
+            kdtree_target, mutual_filter, max_correspondence_distance,
+            estimation, ransac_n, checkers, criteria, matching_option);
+}
+
+/// Returns the order in which to process \p pairs, largest source fragments
+/// first so that the most expensive pairs do not end up last in the queue.
+static std::vector<size_t> GetPairSchedule(
+        const std::vector<std::reference_wrapper<const geometry::PointCloud>>
+                &fragments,
+        const std::vector<RegistrationPair> &pairs) {
+    for (const auto &pair : pairs) {
+        if (pair.source_id_ < 0 || pair.source_id_ >= (int)fragments.size() ||
+            pair.target_id_ < 0 || pair.target_id_ >= (int)fragments.size()) {
+            utility::LogError("Invalid fragment pair ({:d}, {:d}).",
+                              pair.source_id_, pair.target_id_);
+        }
+    }
+    std::vector<size_t> order(pairs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return fragments[pairs[a].source_id_].get().points_.size() >
+               fragments[pairs[b].source_id_].get().points_.size();
+    });
+    return order;
+}
+
+std::vector<RegistrationResult> RegistrationICPMultiPair(
+        const std::vector<std::reference_wrapper<const geometry::PointCloud>>
+                &fragments,
+        const std::vector<RegistrationPair> &pairs,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    std::vector<size_t> order = GetPairSchedule(fragments, pairs);
+
+    // Build the KD-tree of every target fragment once.
+    std::vector<std::unique_ptr<geometry::KDTreeFlann>> kdtrees(
+            fragments.size());
+    for (const auto &pair : pairs) {
+        if (!kdtrees[pair.target_id_]) {
+            CheckICPInputs(fragments[pair.target_id_].get(),
+                           max_correspondence_distance, estimation);
+            kdtrees[pair.target_id_] =
+                    std::make_unique<geometry::KDTreeFlann>();
+        }
+    }
+    utility::ParallelFor(0, (int64_t)fragments.size(), [&](int64_t i) {
+        if (kdtrees[i]) {
+            kdtrees[i]->SetGeometry(fragments[i].get());
+        }
+    });
+
+    std::vector<RegistrationResult> results(pairs.size());
+    utility::ParallelFor(0, (int64_t)pairs.size(), [&](int64_t k) {
+        const RegistrationPair &pair = pairs[order[k]];
+        results[order[k]] = RegistrationICPWithKDTree(
+                fragments[pair.source_id_].get(),
+                fragments[pair.target_id_].get(), *kdtrees[pair.target_id_],
+                max_correspondence_distance, pair.init_, estimation, criteria);
+    });
+    return results;
+}
+
+std::vector<RegistrationResult>
+RegistrationRANSACBasedOnFeatureMatchingMultiPair(
+        const std::vector<std::reference_wrapper<const geometry::PointCloud>>
+                &fragments,
+        const std::vector<std::reference_wrapper<const Feature>> &features,
+        const std::vector<RegistrationPair> &pairs,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 3*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/,
+        const FeatureMatchingOption &matching_option
+        /* = FeatureMatchingOption()*/) {
+    if (features.size() != fragments.size()) {
+        utility::LogError(
+                "Number of features ({:d}) does not match number of fragments "
+                "({:d}).",
+                features.size(), fragments.size());
+    }
+    std::vector<size_t> order = GetPairSchedule(fragments, pairs);
+    std::vector<RegistrationResult> results(pairs.size());
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+        return results;
+    }
+
+    // Build the feature KD-tree of every fragment that is matched against
+    // once. Sources are only matched against with the mutual filter.
+    std::vector<std::unique_ptr<geometry::KDTreeFlann>> kdtrees(
+            fragments.size());
+    for (const auto &pair : pairs) {
+        for (int i : {pair.target_id_, mutual_filter ? pair.source_id_ : -1}) {
+            if (i >= 0 && !kdtrees[i]) {
+                kdtrees[i] = std::make_unique<geometry::KDTreeFlann>();
+                matching_option.Apply(*kdtrees[i]);
+            }
+        }
+    }
+    utility::ParallelFor(0, (int64_t)fragments.size(), [&](int64_t i) {
+        if (kdtrees[i]) {
+            kdtrees[i]->SetFeature(features[i].get());
+        }
+    });
+
+    utility::ParallelFor(0, (int64_t)pairs.size(), [&](int64_t k) {
+        const RegistrationPair &pair = pairs[order[k]];
+        results[order[k]] = RegistrationRANSACBasedOnFeatureMatchingWithKDTrees(
+                fragments[pair.source_id_].get(),
+                fragments[pair.target_id_].get(),
+                features[pair.source_id_].get(),
+                features[pair.target_id_].get(), kdtrees[pair.source_id_].get(),
+                *kdtrees[pair.target_id_], mutual_filter,
+                max_correspondence_distance, estimation, ransac_n, checkers,
+                criteria, matching_option);
+    });
+    return results;
 }
 
 Eigen::Matrix6d GetInformationMatrixFromPointClouds(
@@ -368,35 +665,39 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first in this implementation
     Eigen::Matrix6d GTG = Eigen::Matrix6d::Zero();
-#pragma omp parallel
-    {
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
-#pragma omp for nowait
-        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
-            int t = result.correspondence_set_[c](1);
-            double x = target.points_[t](0);
-            double y = target.points_[t](1);
-            double z = target.points_[t](2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-        }
-#pragma omp critical
-        { GTG += GTG_private; }
-    }
+    std::mutex GTG_mutex;
+    utility::ParallelForRange(
+            0, (int64_t)result.correspondence_set_.size(), 256,
+            [&](int64_t begin, int64_t end) {
+                Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
+                Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
+                for (int c = (int)begin; c < (int)end; c++) {
+                    int t = result.correspondence_set_[c](1);
+                    double x = target.points_[t](0);
+                    double y = target.points_[t](1);
+                    double z = target.points_[t](2);
+                    G_r_private.setZero();
+                    G_r_private(1) = z;
+                    G_r_private(2) = -y;
+                    G_r_private(3) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = -z;
+                    G_r_private(2) = x;
+                    G_r_private(4) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = y;
+                    G_r_private(1) = -x;
+                    G_r_private(5) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                }
+                std::lock_guard<std::mutex> lock(GTG_mutex);
+                GTG += GTG_private;
+            });
     return GTG;
 }
 
@@ -27,10 +27,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <functional>
 #include <tuple>
 #include <vector>
 
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Eigen.h"
 
@@ -38,11 +40,11 @@ namespace open3d {
 
 namespace geometry {
 class PointCloud;
-}
+class PointCloudFloat;
+}  // namespace geometry
 
 namespace pipelines {
 namespace registration {
-class Feature;
 
 /// \class ICPConvergenceCriteria
 ///
@@ -119,7 +121,10 @@ public:
     /// \param transformation The estimated transformation matrix.
     RegistrationResult(
             const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity())
-        : transformation_(transformation), inlier_rmse_(0.0), fitness_(0.0) {}
+        : transformation_(transformation),
+          inlier_rmse_(0.0),
+          fitness_(0.0),
+          feature_matching_recall_(1.0) {}
     ~RegistrationResult() {}
     bool IsBetterRANSACThan(const RegistrationResult &other) const {
         return fitness_ > other.fitness_ || (fitness_ == other.fitness_ &&
@@ -138,6 +143,35 @@ public:
     /// For RANSAC: inlier ratio (# of inlier correspondences / # of
     /// all correspondences)
     double fitness_;
+    /// For feature based registration: estimated fraction of feature matches
+    /// that found the true nearest neighbor. 1.0 for exact matching.
+    double feature_matching_recall_;
+};
+
+/// \class RegistrationPair
+///
+/// \brief A pair of fragments to register in a batch, given by their indices
+/// in the fragment list, and an initial transformation from source to target.
+class RegistrationPair {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param source_id Index of the source fragment.
+    /// \param target_id Index of the target fragment.
+    /// \param init Initial transformation estimation.
+    RegistrationPair(int source_id = 0,
+                     int target_id = 0,
+                     const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity())
+        : source_id_(source_id), target_id_(target_id), init_(init) {}
+    ~RegistrationPair() {}
+
+public:
+    /// Index of the source fragment.
+    int source_id_;
+    /// Index of the target fragment.
+    int target_id_;
+    /// Initial transformation estimation.
+    Eigen::Matrix4d_u init_;
 };
 
 /// \brief Function for evaluating registration between point clouds.
@@ -173,6 +207,20 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief ICP registration of single precision point clouds.
+///
+/// Same as RegistrationICP() on PointCloud. Only
+/// TransformationEstimationPointToPoint and
+/// TransformationEstimationPointToPlane are supported.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloudFloat &source,
+        const geometry::PointCloudFloat &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -211,6 +259,7 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param ransac_n Fit ransac with `ransac_n` correspondences.
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
+/// \param matching_option Exact or approximate feature matching.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -223,8 +272,65 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         int ransac_n = 3,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
-        const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+        const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
+        const FeatureMatchingOption &matching_option = FeatureMatchingOption());
+
+/// \brief Function for ICP registration of many fragment pairs.
+///
+/// The KD-tree of each target fragment is built once and shared by all pairs
+/// using it. Pairs are processed in parallel.
+///
+/// \param fragments The fragment point clouds.
+/// \param pairs Fragment pairs to register, with initial transformations.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \return One result per pair, in the order of \p pairs.
+std::vector<RegistrationResult> RegistrationICPMultiPair(
+        const std::vector<std::reference_wrapper<const geometry::PointCloud>>
+                &fragments,
+        const std::vector<RegistrationPair> &pairs,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for feature matching RANSAC registration of many fragment
+/// pairs.
+///
+/// The feature KD-tree of each fragment is built once and shared by all pairs
+/// using it. Pairs are processed in parallel. The initial transformations of
+/// \p pairs are ignored.
+///
+/// \param fragments The fragment point clouds.
+/// \param features Features of the fragments.
+/// \param pairs Fragment pairs to register.
+/// \param mutual_filter Enables mutual filter such that the correspondence of
+/// the source point's correspondence is itself.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param estimation Estimation method.
+/// \param ransac_n Fit ransac with `ransac_n` correspondences.
+/// \param checkers Correspondence checker.
+/// \param criteria Convergence criteria.
+/// \param matching_option Exact or approximate feature matching.
+/// \return One result per pair, in the order of \p pairs.
+std::vector<RegistrationResult>
+RegistrationRANSACBasedOnFeatureMatchingMultiPair(
+        const std::vector<std::reference_wrapper<const geometry::PointCloud>>
+                &fragments,
+        const std::vector<std::reference_wrapper<const Feature>> &features,
+        const std::vector<RegistrationPair> &pairs,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        int ransac_n = 3,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers = {},
+        const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
+        const FeatureMatchingOption &matching_option = FeatureMatchingOption());
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
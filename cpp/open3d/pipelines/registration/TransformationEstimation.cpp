@@ -29,12 +29,71 @@
 #include <Eigen/Geometry>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/PointCloudFloat.h"
 #include "open3d/utility/Eigen.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+namespace {
+template <typename PointCloudType>
+Eigen::Matrix4d ComputePointToPointTransformation(
+        const PointCloudType &source,
+        const PointCloudType &target,
+        const CorrespondenceSet &corres,
+        bool with_scaling) {
+    if (corres.empty()) return Eigen::Matrix4d::Identity();
+    Eigen::MatrixXd source_mat(3, corres.size());
+    Eigen::MatrixXd target_mat(3, corres.size());
+    for (size_t i = 0; i < corres.size(); i++) {
+        source_mat.block<3, 1>(0, i) =
+                source.points_[corres[i][0]].template cast<double>();
+        target_mat.block<3, 1>(0, i) =
+                target.points_[corres[i][1]].template cast<double>();
+    }
+    return Eigen::umeyama(source_mat, target_mat, with_scaling);
+}
+
+template <typename PointCloudType>
+Eigen::Matrix4d ComputePointToPlaneTransformation(
+        const PointCloudType &source,
+        const PointCloudType &target,
+        const CorrespondenceSet &corres,
+        const RobustKernel &kernel) {
+    if (corres.empty() || !target.HasNormals())
+        return Eigen::Matrix4d::Identity();
+
+    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
+                                             double &r, double &w) {
+        const Eigen::Vector3d vs =
+                source.points_[corres[i][0]].template cast<double>();
+        const Eigen::Vector3d vt =
+                target.points_[corres[i][1]].template cast<double>();
+        const Eigen::Vector3d nt =
+                target.normals_[corres[i][1]].template cast<double>();
+        r = (vs - vt).dot(nt);
+        w = kernel.Weight(r);
+        J_r.block<3, 1>(0, 0) = vs.cross(nt);
+        J_r.block<3, 1>(3, 0) = nt;
+    };
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) =
+            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                    compute_jacobian_and_residual, (int)corres.size());
+
+    bool is_success;
+    Eigen::Matrix4d extrinsic;
+    std::tie(is_success, extrinsic) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+
+    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+}
+}  // namespace
+
 double TransformationEstimationPointToPoint::ComputeRMSE(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -51,14 +110,16 @@ Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres) const {
-    if (corres.empty()) return Eigen::Matrix4d::Identity();
-    Eigen::MatrixXd source_mat(3, corres.size());
-    Eigen::MatrixXd target_mat(3, corres.size());
-    for (size_t i = 0; i < corres.size(); i++) {
-        source_mat.block<3, 1>(0, i) = source.points_[corres[i][0]];
-        target_mat.block<3, 1>(0, i) = target.points_[corres[i][1]];
-    }
-    return Eigen::umeyama(source_mat, target_mat, with_scaling_);
+    return ComputePointToPointTransformation(source, target, corres,
+                                             with_scaling_);
+}
+
+Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
+        const geometry::PointCloudFloat &source,
+        const geometry::PointCloudFloat &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPointTransformation(source, target, corres,
+                                             with_scaling_);
 }
 
 double TransformationEstimationPointToPlane::ComputeRMSE(
@@ -79,33 +140,14 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres) const {
-    if (corres.empty() || !target.HasNormals())
-        return Eigen::Matrix4d::Identity();
-
-    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
-                                             double &r, double &w) {
-        const Eigen::Vector3d &vs = source.points_[corres[i][0]];
-        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
-        const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
-        r = (vs - vt).dot(nt);
-        w = kernel_->Weight(r);
-        J_r.block<3, 1>(0, 0) = vs.cross(nt);
-        J_r.block<3, 1>(3, 0) = nt;
-    };
-
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
-
-    bool is_success;
-    Eigen::Matrix4d extrinsic;
-    std::tie(is_success, extrinsic) =
-            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    return ComputePointToPlaneTransformation(source, target, corres, *kernel_);
+}
 
-    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
+        const geometry::PointCloudFloat &source,
+        const geometry::PointCloudFloat &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPlaneTransformation(source, target, corres, *kernel_);
 }
 
 }  // namespace registration
@@ -38,7 +38,8 @@ namespace open3d {
 
 namespace geometry {
 class PointCloud;
-}
+class PointCloudFloat;
+}  // namespace geometry
 
 namespace pipelines {
 namespace registration {
@@ -112,6 +113,12 @@ public:
             const geometry::PointCloud &source,
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
+    /// Single precision variant of ComputeTransformation(), used by
+    /// RegistrationICP on PointCloudFloat.
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloudFloat &source,
+            const geometry::PointCloudFloat &target,
+            const CorrespondenceSet &corres) const;
 
 public:
     /// \brief Set to True to estimate scaling, False to force scaling to be 1.
@@ -154,6 +161,12 @@ public:
             const geometry::PointCloud &source,
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
+    /// Single precision variant of ComputeTransformation(), used by
+    /// RegistrationICP on PointCloudFloat.
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloudFloat &source,
+            const geometry::PointCloudFloat &target,
+            const CorrespondenceSet &corres) const;
 
 public:
     /// shared_ptr to an Abstract RobustKernel that could mutate at runtime.
@@ -26,6 +26,7 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <cmath>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -105,7 +106,7 @@ Image Image::To(core::Dtype dtype,
             {core::Dtype::UInt16},  {core::Dtype::Int32},
             {core::Dtype::Float32}, {core::Dtype::Float64}};
 
-    [[maybe_unused]] double scale = 1.0;
+    double scale = 1.0;
     if (!scale_.has_value() &&
         (dtype == core::Dtype::Float32 || dtype == core::Dtype::Float64)) {
         if (GetDtype() == core::Dtype::UInt8) {
@@ -118,47 +119,21 @@ Image Image::To(core::Dtype dtype,
     }
 
     Image dst_im;
+    if (!copy && dtype == GetDtype()) {
+        dst_im.data_ = data_;
+    } else {
+        dst_im.data_ = core::Tensor::Empty(
+                std::vector<int64_t>{GetRows(), GetCols(), GetChannels()},
+                dtype, GetDevice());
+    }
     if (HAVE_IPPICV &&
+        data_.GetDevice().GetType() == core::Device::DeviceType::CPU &&
         std::count(ipp_supported.begin(), ipp_supported.end(), GetDtype()) >
                 0 &&
         std::count(ipp_supported.begin(), ipp_supported.end(), dtype) > 0) {
-        // TODO: Tensor based Op for saturate_cast / LinearTransform
-        // NPP does not expose a useful API, so as a workaround, move data to
-        // CPU and use IPP.
-        auto device = data_.GetDevice();
-        if (device.GetType() != core::Device::DeviceType::CPU) {
-            core::Tensor data_CPU = data_.To(core::Device("CPU:0"));
-            core::Tensor dst_data_CPU =
-                    (dtype == GetDtype()
-                             ? data_CPU
-                             : core::Tensor::Empty(
-                                       std::vector<int64_t>{GetRows(),
-                                                            GetCols(),
-                                                            GetChannels()},
-                                       dtype, core::Device("CPU:0")));
-            IPP_CALL(ipp::To, data_CPU, dst_data_CPU, scale, offset);
-            if (!copy && dtype == GetDtype()) {
-                const_cast<core::Tensor &>(data_).CopyFrom(dst_data_CPU);
-                dst_im.data_ = data_;
-            } else {
-                dst_im.data_ = dst_data_CPU.To(device);
-            }
-        } else {
-            if (!copy && dtype == GetDtype()) {
-                dst_im.data_ = data_;
-            } else {
-                dst_im.data_ = core::Tensor::Empty(
-                        std::vector<int64_t>{GetRows(), GetCols(),
-                                             GetChannels()},
-                        dtype, GetDevice());
-            }
-            IPP_CALL(ipp::To, data_, dst_im.data_, scale, offset);
-        }
+        IPP_CALL(ipp::To, data_, dst_im.data_, scale, offset);
     } else {
-        utility::LogError(
-                "Conversion from {} to {} on device {} is not implemented!",
-                GetDtype().ToString(), dtype.ToString(),
-                GetDevice().ToString());
+        kernel::image::To(data_, dst_im.data_, scale, offset);
     }
     return dst_im;
 }
@@ -193,9 +168,7 @@ Image Image::RGBToGray() const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::RGBToGray, data_, dst_im.data_);
     } else {
-        utility::LogError(
-                "RGBToGray with data type {} on device {} is not implemented!",
-                GetDtype().ToString(), GetDevice().ToString());
+        kernel::image::RGBToGray(data_, dst_im.data_);
     }
     return dst_im;
 }
@@ -238,10 +211,9 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Resize, data_, dst_im.data_, interp_type);
     } else {
-        utility::LogError(
-                "Resize with data type {} on device {} is not "
-                "implemented!",
-                GetDtype().ToString(), GetDevice().ToString());
+        kernel::image::Resize(
+                data_, dst_im.data_,
+                static_cast<kernel::image::InterpType>(interp_type));
     }
     return dst_im;
 }
@@ -280,9 +252,7 @@ Image Image::Dilate(int kernel_size) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Dilate, data_, dst_im.data_, kernel_size);
     } else {
-        utility::LogError(
-                "Dilate with data type {} on device {} is not implemented!",
-                GetDtype().ToString(), GetDevice().ToString());
+        kernel::image::Dilate(data_, dst_im.data_, kernel_size);
     }
     return dst_im;
 }
@@ -320,10 +290,8 @@ Image Image::FilterBilateral(int kernel_size,
         IPP_CALL(ipp::FilterBilateral, data_, dst_im.data_, kernel_size,
                  value_sigma, dist_sigma);
     } else {
-        utility::LogError(
-                "FilterBilateral with data type {} on device {} is not "
-                "implemented!",
-                GetDtype().ToString(), GetDevice().ToString());
+        kernel::image::FilterBilateral(data_, dst_im.data_, kernel_size,
+                                       value_sigma, dist_sigma);
     }
     return dst_im;
 }
@@ -356,10 +324,7 @@ Image Image::Filter(const core::Tensor &kernel) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Filter, data_, dst_im.data_, kernel);
     } else {
-        utility::LogError(
-                "Filter with data type {} on device {} is not "
-                "implemented!",
-                GetDtype().ToString(), GetDevice().ToString());
+        kernel::image::Filter(data_, dst_im.data_, kernel);
     }
     return dst_im;
 }
@@ -397,10 +362,18 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterGaussian, data_, dst_im.data_, kernel_size, sigma);
     } else {
-        utility::LogError(
-                "FilterGaussian with data type {} on device {} is not "
-                "implemented!",
-                GetDtype().ToString(), GetDevice().ToString());
+        std::vector<float> weights(kernel_size);
+        float weight_sum = 0;
+        for (int i = 0; i < kernel_size; ++i) {
+            float d = static_cast<float>(i - kernel_size / 2);
+            weights[i] = std::exp(-d * d / (2 * sigma * sigma));
+            weight_sum += weights[i];
+        }
+        for (float &w : weights) {
+            w /= weight_sum;
+        }
+        core::Tensor kernel(weights, {kernel_size}, core::Dtype::Float32);
+        kernel::image::FilterSeparable(data_, dst_im.data_, kernel, kernel);
     }
     return dst_im;
 }
@@ -426,14 +399,14 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
     // Routines: 8u16s, 32f
     Image dst_im_dx, dst_im_dy;
     core::Dtype dtype = GetDtype();
-    if (dtype == core::Dtype::Float32) {
-        dst_im_dx = core::Tensor::EmptyLike(data_);
-        dst_im_dy = core::Tensor::EmptyLike(data_);
-    } else if (dtype == core::Dtype::UInt8) {
+    if (dtype == core::Dtype::UInt8) {
         dst_im_dx = core::Tensor::Empty(data_.GetShape(), core::Dtype::Int16,
                                         data_.GetDevice());
         dst_im_dy = core::Tensor::Empty(data_.GetShape(), core::Dtype::Int16,
                                         data_.GetDevice());
+    } else {
+        dst_im_dx = core::Tensor::EmptyLike(data_);
+        dst_im_dy = core::Tensor::EmptyLike(data_);
     }
 
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
@@ -448,17 +421,59 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
         IPP_CALL(ipp::FilterSobel, data_, dst_im_dx.data_, dst_im_dy.data_,
                  kernel_size);
     } else {
-        utility::LogError(
-                "FilterSobel with data type {} on device {} is not "
-                "implemented!",
-                GetDtype().ToString(), GetDevice().ToString());
+        // The derivative is taken along one axis and smoothed along the
+        // other. dx is right minus left and dy is bottom minus top.
+        static const std::vector<float> derivative3{-1, 0, 1};
+        static const std::vector<float> smooth3{1, 2, 1};
+        static const std::vector<float> derivative5{-1, -2, 0, 2, 1};
+        static const std::vector<float> smooth5{1, 4, 6, 4, 1};
+        const int64_t size = kernel_size;
+        core::Tensor derivative(kernel_size == 3 ? derivative3 : derivative5,
+                                {size}, core::Dtype::Float32);
+        core::Tensor smooth(kernel_size == 3 ? smooth3 : smooth5, {size},
+                            core::Dtype::Float32);
+        kernel::image::FilterSeparable(data_, dst_im_dx.data_, derivative,
+                                       smooth);
+        kernel::image::FilterSeparable(data_, dst_im_dy.data_, smooth,
+                                       derivative);
     }
     return std::make_pair(dst_im_dx, dst_im_dy);
 }
 
 Image Image::PyrDown() const {
-    Image blur = FilterGaussian(5, 1.0f);
-    return blur.Resize(0.5, InterpType::Nearest);
+    if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA ||
+        HAVE_IPPICV) {
+        Image blur = FilterGaussian(5, 1.0f);
+        return blur.Resize(0.5, InterpType::Nearest);
+    }
+
+    // Evaluates the Gaussian filter only at the pixels kept by the resize.
+    Image dst_im;
+    dst_im.data_ = core::Tensor::Empty(
+            {GetRows() / 2, GetCols() / 2, GetChannels()}, GetDtype(),
+            GetDevice());
+    kernel::image::PyrDown(data_, dst_im.data_);
+    return dst_im;
+}
+
+Image Image::PyrDownDepth(float diff_threshold, float invalid_fill) const {
+    if (GetRows() <= 0 || GetCols() <= 0 || GetChannels() != 1) {
+        utility::LogError(
+                "Invalid shape, expected a 1 channel image, but got ({}, {}, "
+                "{})",
+                GetRows(), GetCols(), GetChannels());
+    }
+    if (GetDtype() != core::Dtype::Float32) {
+        utility::LogError("Expected a Float32 image, but got {}",
+                          GetDtype().ToString());
+    }
+
+    Image dst_im;
+    dst_im.data_ = core::Tensor::Empty({GetRows() / 2, GetCols() / 2, 1},
+                                       GetDtype(), GetDevice());
+    kernel::image::PyrDownDepth(data_, dst_im.data_, diff_threshold,
+                                invalid_fill);
+    return dst_im;
 }
 
 Image Image::ClipTransform(float scale,
@@ -563,6 +578,41 @@ Image Image::ColorizeDepth(float scale, float min_value, float max_value) {
     return dst_im;
 }
 
+Image Image::AlignDepth(int64_t rows,
+                        int64_t cols,
+                        const core::Tensor &depth_intrinsics,
+                        const core::Tensor &intrinsics,
+                        const core::Tensor &depth_to_camera,
+                        float depth_scale) const {
+    if (GetRows() <= 0 || GetCols() <= 0 || GetChannels() != 1) {
+        utility::LogError(
+                "Invalid shape, expected a 1 channel image, but got ({}, {}, "
+                "{})",
+                GetRows(), GetCols(), GetChannels());
+    }
+    if (GetDtype() != core::Dtype::UInt16) {
+        utility::LogError("Expected a UInt16 image, but got {}",
+                          GetDtype().ToString());
+    }
+    if (rows <= 0 || cols <= 0 || depth_scale <= 0) {
+        utility::LogError(
+                "Expected positive rows, cols and depth_scale, but got {}, {} "
+                "and {}",
+                rows, cols, depth_scale);
+    }
+    depth_intrinsics.AssertShape({3, 3});
+    intrinsics.AssertShape({3, 3});
+    depth_to_camera.AssertShape({4, 4});
+
+    Image dst_im;
+    dst_im.data_ =
+            core::Tensor::Empty({rows, cols, 1}, GetDtype(), GetDevice());
+    kernel::image::AlignDepth(data_.Contiguous(), dst_im.data_,
+                              depth_intrinsics, intrinsics, depth_to_camera,
+                              depth_scale);
+    return dst_im;
+}
+
 Image Image::FromLegacyImage(const open3d::geometry::Image &image_legacy,
                              const core::Device &device) {
     static const std::unordered_map<int, core::Dtype> kBytesToDtypeMap = {
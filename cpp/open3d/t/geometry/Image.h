@@ -205,8 +205,7 @@ public:
     Image Resize(float sampling_rate = 0.5f,
                  InterpType interp_type = InterpType::Nearest) const;
 
-    /// Return a new image after performing morphological dilation. Supported
-    /// datatypes are UInt8, UInt16 and Float32 with {1, 3, 4} channels. An
+    /// Return a new image after performing morphological dilation. An
     /// 8-connected neighborhood is used to create the dilation mask.
     /// \param kernel_size An odd number >= 3.
     Image Dilate(int kernel_size = 3) const;
@@ -220,7 +219,8 @@ public:
     /// Note: CPU (IPP) and CUDA (NPP) versions are inconsistent:
     /// CPU uses a round kernel (radius = floor(kernel_size / 2)),
     /// while CUDA uses a square kernel (width = kernel_size).
-    /// Make sure to tune parameters accordingly.
+    /// Make sure to tune parameters accordingly. The native kernels, used
+    /// when neither supports the image, follow the CPU version.
     Image FilterBilateral(int kernel_size = 3,
                           float value_sigma = 20.0f,
                           float distance_sigma = 10.0f) const;
@@ -239,6 +239,12 @@ public:
     /// resize (ratio = 0.5) operation.
     Image PyrDown() const;
 
+    /// Return a new downsampled depth image of (H/2, W/2, 1) in Float32. Each
+    /// pixel is a Gaussian filter (kernel_size = 5, sigma = 1.0) of the valid
+    /// neighbors whose depth differs from the center by less than
+    /// \p diff_threshold. Pixels equal to \p invalid_fill are invalid.
+    Image PyrDownDepth(float diff_threshold, float invalid_fill) const;
+
     /// Preprocess a image of (H, W, 1), typically used for a depth image.
     /// Each pixel will be transformed by
     /// x = x / scale
@@ -270,6 +276,24 @@ public:
     /// (min_range, max_range)
     Image ColorizeDepth(float scale, float min_range, float max_range);
 
+    /// Reproject a UInt16 depth image of (H, W, 1) into another camera with
+    /// an image of (\p rows, \p cols), e.g. to align the depth image of an
+    /// RGB-D sensor to its color image. Each pixel is splatted to the
+    /// footprint of the pixel in the other image and the nearest depth is
+    /// kept, as in librealsense. Pixels without depth are 0. Lens distortion
+    /// is ignored.
+    /// \param depth_intrinsics Pinhole camera model of this image, (3, 3).
+    /// \param intrinsics Pinhole camera model of the other camera, (3, 3).
+    /// \param depth_to_camera Transformation of (4, 4) from this camera to the
+    /// other camera, in meters.
+    /// \param depth_scale Number of depth units per meter.
+    Image AlignDepth(int64_t rows,
+                     int64_t cols,
+                     const core::Tensor &depth_intrinsics,
+                     const core::Tensor &intrinsics,
+                     const core::Tensor &depth_to_camera,
+                     float depth_scale = 1000.0f) const;
+
     /// Compute min 2D coordinates for the data (always {0, 0}).
     core::Tensor GetMinBound() const {
         return core::Tensor::Zeros({2}, core::Dtype::Int64);
@@ -0,0 +1,394 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
+
+#include <algorithm>
+#include <future>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// Concatenates \p tensors along the first dimension on \p device. Skips
+/// empty tensors.
+static core::Tensor Concatenate(const std::vector<core::Tensor> &tensors,
+                                const core::Device &device) {
+    int64_t length = 0;
+    for (const core::Tensor &tensor : tensors) {
+        length += tensor.GetLength();
+    }
+    core::SizeVector shape = tensors[0].GetShape();
+    shape[0] = length;
+    core::Tensor result(shape, tensors[0].GetDtype(), device);
+    int64_t offset = 0;
+    for (const core::Tensor &tensor : tensors) {
+        int64_t n = tensor.GetLength();
+        if (n > 0) {
+            result.Slice(0, offset, offset + n).AsRvalue() = tensor;
+            offset += n;
+        }
+    }
+    return result;
+}
+
+PartitionedTSDFVoxelGrid::PartitionedTSDFVoxelGrid(
+        const std::vector<core::Device> &devices,
+        std::unordered_map<std::string, core::Dtype> attr_dtype_map,
+        float voxel_size,
+        float sdf_trunc,
+        int64_t block_resolution,
+        int64_t block_count,
+        int64_t slab_width,
+        int axis,
+        const core::HashmapBackend &backend)
+    : devices_(devices),
+      voxel_size_(voxel_size),
+      block_resolution_(block_resolution),
+      slab_width_(slab_width),
+      axis_(axis) {
+    if (devices.empty()) {
+        utility::LogError(
+                "[PartitionedTSDFVoxelGrid] at least one device is "
+                "required.");
+    }
+    if (slab_width <= 0) {
+        utility::LogError(
+                "[PartitionedTSDFVoxelGrid] slab_width must be positive, but "
+                "got {}.",
+                slab_width);
+    }
+    if (axis < 0 || axis > 2) {
+        utility::LogError(
+                "[PartitionedTSDFVoxelGrid] axis must be 0, 1 or 2, but got "
+                "{}.",
+                axis);
+    }
+    for (const core::Device &device : devices) {
+        partitions_.emplace_back(attr_dtype_map, voxel_size, sdf_trunc,
+                                 block_resolution, block_count, device,
+                                 backend);
+    }
+}
+
+void PartitionedTSDFVoxelGrid::Integrate(const Image &depth,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max,
+                                         int64_t stride,
+                                         bool visibility_culling) {
+    Image empty_color;
+    Integrate(depth, empty_color, intrinsics, extrinsics, depth_scale,
+              depth_max, stride, visibility_culling);
+}
+
+void PartitionedTSDFVoxelGrid::Integrate(const Image &depth,
+                                         const Image &color,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max,
+                                         int64_t stride,
+                                         bool visibility_culling) {
+    // Touch the blocks of the frame once, on the first device.
+    core::Tensor block_coords = partitions_[0].TouchBlocks(
+            depth.To(devices_[0]), intrinsics, extrinsics, depth_scale,
+            depth_max, stride, visibility_culling);
+
+    // A block goes to its owner, and to the owners of its two neighbors
+    // along the slab axis.
+    core::Tensor coords = block_coords.Slice(1, axis_, axis_ + 1)
+                                  .Reshape({-1})
+                                  .To(core::Dtype::Int64);
+    core::Tensor owners = GetOwners(coords);
+    core::Tensor prev_owners = GetOwners(coords.Sub(1));
+    core::Tensor next_owners = GetOwners(coords.Add(1));
+    std::vector<core::Tensor> partition_blocks;
+    for (int64_t i = 0; i < GetPartitionCount(); ++i) {
+        core::Tensor mask =
+                owners.Eq(i).LogicalOr(prev_owners.Eq(i)).LogicalOr(
+                        next_owners.Eq(i));
+        partition_blocks.push_back(block_coords.IndexGet({mask}));
+    }
+
+    ForEachPartition([&](int64_t i) {
+        if (partition_blocks[i].GetLength() == 0) {
+            return;
+        }
+        const core::Device &device = devices_[i];
+        partitions_[i].IntegrateBlocks(
+                partition_blocks[i].To(device), depth.To(device),
+                color.IsEmpty() ? color : color.To(device), intrinsics,
+                extrinsics, depth_scale, depth_max);
+    });
+}
+
+std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
+PartitionedTSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
+                                  const core::Tensor &extrinsics,
+                                  int width,
+                                  int height,
+                                  float depth_scale,
+                                  float depth_min,
+                                  float depth_max,
+                                  float weight_threshold,
+                                  int ray_cast_mask) {
+    using SurfaceMaskCode = TSDFVoxelGrid::SurfaceMaskCode;
+
+    // The depth map decides which partition a pixel is taken from.
+    std::vector<std::unordered_map<SurfaceMaskCode, core::Tensor>> results(
+            partitions_.size());
+    ForEachPartition([&](int64_t i) {
+        results[i] = partitions_[i].RayCast(
+                intrinsics, extrinsics, width, height, depth_scale, depth_min,
+                depth_max, weight_threshold,
+                ray_cast_mask | SurfaceMaskCode::DepthMap);
+    });
+
+    const core::Device &device = devices_[0];
+    const int64_t num_pixels = static_cast<int64_t>(width) * height;
+    std::vector<SurfaceMaskCode> codes;
+    for (SurfaceMaskCode code :
+         {SurfaceMaskCode::VertexMap, SurfaceMaskCode::ColorMap,
+          SurfaceMaskCode::NormalMap}) {
+        if (ray_cast_mask & code) {
+            codes.push_back(code);
+        }
+    }
+
+    // Misses have zero depth. Keep the closest hit of every pixel.
+    core::Tensor depth = results[0]
+                                 .at(SurfaceMaskCode::DepthMap)
+                                 .To(device)
+                                 .Reshape({num_pixels});
+    std::unordered_map<SurfaceMaskCode, core::Tensor> maps;
+    for (SurfaceMaskCode code : codes) {
+        maps[code] = results[0].at(code).To(device).Reshape({num_pixels, 3});
+    }
+    for (size_t i = 1; i < results.size(); ++i) {
+        core::Tensor partition_depth = results[i]
+                                               .at(SurfaceMaskCode::DepthMap)
+                                               .To(device)
+                                               .Reshape({num_pixels});
+        core::Tensor closer = partition_depth.Gt(0.0f).LogicalAnd(
+                depth.Eq(0.0f).LogicalOr(partition_depth.Lt(depth)));
+        for (SurfaceMaskCode code : codes) {
+            maps[code].IndexSet({closer},
+                                results[i]
+                                        .at(code)
+                                        .To(device)
+                                        .Reshape({num_pixels, 3})
+                                        .IndexGet({closer}));
+        }
+        depth.IndexSet({closer}, partition_depth.IndexGet({closer}));
+    }
+
+    std::unordered_map<SurfaceMaskCode, core::Tensor> merged;
+    for (SurfaceMaskCode code : codes) {
+        merged.emplace(code, maps[code].Reshape({height, width, 3}));
+    }
+    if (ray_cast_mask & SurfaceMaskCode::DepthMap) {
+        merged.emplace(SurfaceMaskCode::DepthMap,
+                       depth.Reshape({height, width, 1}));
+    }
+    return merged;
+}
+
+PointCloud PartitionedTSDFVoxelGrid::ExtractSurfacePoints(
+        float weight_threshold, int surface_mask) {
+    const core::Device &device = devices_[0];
+    std::vector<core::Tensor> points(partitions_.size());
+    std::vector<core::Tensor> normals(partitions_.size());
+    std::vector<core::Tensor> colors(partitions_.size());
+    ForEachPartition([&](int64_t i) {
+        PointCloud pcd = partitions_[i].ExtractSurfacePoints(
+                -1, weight_threshold, surface_mask);
+        if (!pcd.HasPoints()) {
+            return;
+        }
+        core::Tensor owned = GetPointOwners(pcd.GetPoints()).Eq(i);
+        points[i] = pcd.GetPoints().IndexGet({owned}).To(device);
+        if (pcd.HasPointNormals()) {
+            normals[i] = pcd.GetPointNormals().IndexGet({owned}).To(device);
+        }
+        if (pcd.HasPointColors()) {
+            colors[i] = pcd.GetPointColors().IndexGet({owned}).To(device);
+        }
+    });
+
+    // Partitions without points have no attributes.
+    auto merge = [&](std::vector<core::Tensor> &tensors) {
+        tensors.erase(std::remove_if(tensors.begin(), tensors.end(),
+                                     [](const core::Tensor &tensor) {
+                                         return tensor.NumDims() == 0;
+                                     }),
+                      tensors.end());
+        return tensors.empty() ? core::Tensor() : Concatenate(tensors, device);
+    };
+    PointCloud pcd(device);
+    core::Tensor merged_points = merge(points);
+    if (merged_points.NumDims() == 0) {
+        return pcd;
+    }
+    pcd.SetPoints(merged_points);
+    if (surface_mask & TSDFVoxelGrid::SurfaceMaskCode::NormalMap) {
+        pcd.SetPointNormals(merge(normals));
+    }
+    if (surface_mask & TSDFVoxelGrid::SurfaceMaskCode::ColorMap) {
+        core::Tensor merged_colors = merge(colors);
+        if (merged_colors.NumDims() != 0) {
+            pcd.SetPointColors(merged_colors);
+        }
+    }
+    return pcd;
+}
+
+TriangleMesh PartitionedTSDFVoxelGrid::ExtractSurfaceMesh(
+        float weight_threshold) {
+    const core::Device &device = devices_[0];
+    std::vector<TriangleMesh> meshes(partitions_.size());
+    ForEachPartition([&](int64_t i) {
+        TriangleMesh mesh = partitions_[i].ExtractSurfaceMesh(weight_threshold);
+        if (!mesh.HasTriangles() || mesh.GetTriangles().GetLength() == 0) {
+            return;
+        }
+        core::Tensor triangles = mesh.GetTriangles();
+        core::Tensor vertices = mesh.GetVertices();
+        const int64_t num_triangles = triangles.GetLength();
+
+        // Keep the triangles whose centroid is owned, and the vertices they
+        // reference, renumbered in order.
+        core::Tensor centroids = vertices.IndexGet({triangles.Reshape({-1})})
+                                         .Reshape({num_triangles, 3, 3})
+                                         .Sum({1})
+                                         .Div(3.0f);
+        core::Tensor owned = GetPointOwners(centroids).Eq(i);
+        core::Tensor vertex_ids, inverse, counts;
+        std::tie(vertex_ids, inverse, counts) =
+                triangles.IndexGet({owned})
+                        .Reshape({-1})
+                        .UniqueWithInverseAndCounts();
+
+        TriangleMesh owned_mesh(
+                vertices.IndexGet({vertex_ids}).To(device),
+                inverse.Reshape({-1, 3}).To(device));
+        if (mesh.HasVertexNormals()) {
+            owned_mesh.SetVertexNormals(
+                    mesh.GetVertexNormals().IndexGet({vertex_ids}).To(device));
+        }
+        if (mesh.HasVertexColors()) {
+            owned_mesh.SetVertexColors(
+                    mesh.GetVertexColors().IndexGet({vertex_ids}).To(device));
+        }
+        meshes[i] = owned_mesh;
+    });
+
+    std::vector<core::Tensor> vertices, triangles, normals, colors;
+    int64_t offset = 0;
+    for (const TriangleMesh &mesh : meshes) {
+        if (!mesh.HasTriangles()) {
+            continue;
+        }
+        vertices.push_back(mesh.GetVertices());
+        triangles.push_back(mesh.GetTriangles().Add(offset));
+        if (mesh.HasVertexNormals()) {
+            normals.push_back(mesh.GetVertexNormals());
+        }
+        if (mesh.HasVertexColors()) {
+            colors.push_back(mesh.GetVertexColors());
+        }
+        offset += mesh.GetVertices().GetLength();
+    }
+    if (vertices.empty()) {
+        return TriangleMesh(device);
+    }
+
+    TriangleMesh mesh(Concatenate(vertices, device),
+                      Concatenate(triangles, device));
+    if (normals.size() == vertices.size()) {
+        mesh.SetVertexNormals(Concatenate(normals, device));
+    }
+    if (colors.size() == vertices.size()) {
+        mesh.SetVertexColors(Concatenate(colors, device));
+    }
+    return mesh;
+}
+
+core::Tensor PartitionedTSDFVoxelGrid::GetOwners(
+        const core::Tensor &coords) const {
+    // Floor division of the coordinates by the slab width, then the
+    // non-negative remainder by the number of partitions. Integer division
+    // of tensors truncates towards zero.
+    const int64_t n = GetPartitionCount();
+    core::Tensor slabs =
+            coords.Sub(coords.Lt(0).To(core::Dtype::Int64).Mul(slab_width_ - 1))
+                    .Div(slab_width_);
+    core::Tensor owners = slabs.Sub(slabs.Div(n).Mul(n)).Add(n);
+    return owners.Sub(owners.Div(n).Mul(n));
+}
+
+core::Tensor PartitionedTSDFVoxelGrid::GetPointOwners(
+        const core::Tensor &points) const {
+    const float block_size = voxel_size_ * block_resolution_;
+    return GetOwners(points.Slice(1, axis_, axis_ + 1)
+                             .Reshape({-1})
+                             .Div(block_size)
+                             .Floor()
+                             .To(core::Dtype::Int64));
+}
+
+void PartitionedTSDFVoxelGrid::ForEachPartition(
+        const std::function<void(int64_t)> &func) {
+    bool concurrent =
+            partitions_.size() > 1 &&
+            std::all_of(devices_.begin(), devices_.end(),
+                        [](const core::Device &device) {
+                            return device.GetType() ==
+                                   core::Device::DeviceType::CUDA;
+                        });
+    if (!concurrent) {
+        for (int64_t i = 0; i < GetPartitionCount(); ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    // Exceptions of the partitions are rethrown by get().
+    std::vector<std::future<void>> futures;
+    for (int64_t i = 0; i < GetPartitionCount(); ++i) {
+        futures.push_back(std::async(std::launch::async, func, i));
+    }
+    for (std::future<void> &future : futures) {
+        future.get();
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
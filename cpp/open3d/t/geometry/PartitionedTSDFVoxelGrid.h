@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class PartitionedTSDFVoxelGrid
+///
+/// A TSDFVoxelGrid partitioned across devices, e.g. to integrate the depth
+/// streams of a multi-camera rig on several GPUs. Space is cut into slabs of
+/// \p slab_width blocks along \p axis, which are assigned to the partitions
+/// in a round-robin fashion, such that every camera spreads its work over all
+/// the devices.
+///
+/// Each frame is touched once on the first device. The touched blocks are
+/// then routed to their owners, together with the blocks that neighbor an
+/// owned slab, so that every partition holds one block of overlap with its
+/// neighbors. Trilinear interpolation in ray casting and marching cubes thus
+/// see complete neighborhoods at slab boundaries. Ray casting and surface
+/// extraction run on all partitions and their results are merged on the
+/// first device, where the overlap is resolved by ownership.
+class PartitionedTSDFVoxelGrid {
+public:
+    /// \param devices Device of each partition. A device may be listed more
+    /// than once. Partitions on different CUDA devices run concurrently.
+    /// \param slab_width Width of the slabs in blocks.
+    /// \param axis Axis (0, 1 or 2) along which space is cut into slabs.
+    /// See TSDFVoxelGrid for the other parameters. \p block_count is the
+    /// initial capacity of each partition.
+    PartitionedTSDFVoxelGrid(
+            const std::vector<core::Device> &devices,
+            std::unordered_map<std::string, core::Dtype> attr_dtype_map =
+                    {{"tsdf", core::Dtype::Float32},
+                     {"weight", core::Dtype::UInt16},
+                     {"color", core::Dtype::UInt16}},
+            float voxel_size = 3.0 / 512.0,
+            float sdf_trunc = 0.04,
+            int64_t block_resolution = 16,
+            int64_t block_count = 1000,
+            int64_t slab_width = 4,
+            int axis = 0,
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// Depth-only integration, see TSDFVoxelGrid::Integrate.
+    void Integrate(const Image &depth,
+                   const core::Tensor &intrinsics,
+                   const core::Tensor &extrinsics,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   int64_t stride = 4,
+                   bool visibility_culling = false);
+
+    /// RGB-D integration, see TSDFVoxelGrid::Integrate.
+    void Integrate(const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsics,
+                   const core::Tensor &extrinsics,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   int64_t stride = 4,
+                   bool visibility_culling = false);
+
+    /// Ray casts every partition and keeps, per pixel, the closest surface.
+    /// See TSDFVoxelGrid::RayCast. The maps are on the first device. The
+    /// range map is an intermediate result of each partition and is not
+    /// returned.
+    std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor> RayCast(
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_scale = 1000.0f,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f,
+            float weight_threshold = 3.0f,
+            int ray_cast_mask = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+                                TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
+
+    /// Extracts the surface points of every partition, keeps the points in
+    /// owned slabs and merges them on the first device. See
+    /// TSDFVoxelGrid::ExtractSurfacePoints.
+    PointCloud ExtractSurfacePoints(
+            float weight_threshold = 3.0f,
+            int surface_mask = TSDFVoxelGrid::SurfaceMaskCode::VertexMap |
+                               TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
+
+    /// Extracts the mesh of every partition, keeps the triangles whose
+    /// centroid lies in an owned slab and merges them on the first device.
+    /// See TSDFVoxelGrid::ExtractSurfaceMesh.
+    TriangleMesh ExtractSurfaceMesh(float weight_threshold = 3.0f);
+
+    int64_t GetPartitionCount() const {
+        return static_cast<int64_t>(partitions_.size());
+    }
+
+    TSDFVoxelGrid &GetPartition(int64_t index) { return partitions_[index]; }
+
+    /// Returns the partition index owning each block coordinate along the
+    /// slab axis in the Int64 tensor \p coords.
+    core::Tensor GetOwners(const core::Tensor &coords) const;
+
+protected:
+    /// Returns the partition index owning each (N, 3) Float32 position in
+    /// \p points.
+    core::Tensor GetPointOwners(const core::Tensor &points) const;
+
+    /// Calls \p func(index) for every partition, concurrently if all the
+    /// partitions are on CUDA devices.
+    void ForEachPartition(const std::function<void(int64_t)> &func);
+
+    std::vector<TSDFVoxelGrid> partitions_;
+    std::vector<core::Device> devices_;
+    float voxel_size_;
+    int64_t block_resolution_;
+    int64_t slab_width_;
+    int axis_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -27,16 +27,28 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <mutex>
+#include <numeric>
+#include <random>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/EigenConverter.h"
+#include "open3d/core/ParallelPrimitives.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 
 namespace open3d {
@@ -76,6 +88,48 @@ core::Tensor PointCloud::GetMaxBound() const { return GetPoints().Max({0}); }
 
 core::Tensor PointCloud::GetCenter() const { return GetPoints().Mean({0}); }
 
+std::pair<core::Tensor, core::Tensor> PointCloud::GetMinMaxBound() const {
+    return GetPoints().MinMax({0});
+}
+
+std::pair<core::Tensor, core::Tensor> PointCloud::ComputeMeanAndCovariance()
+        const {
+    return GetPoints().MeanAndCovariance();
+}
+
+/// Number of segments of the point cloud \p points, the largest segment id
+/// plus 1.
+static int64_t NumSegments(const core::Tensor &points,
+                           const core::Tensor &segment_ids) {
+    segment_ids.AssertShape({points.GetLength()});
+    if (segment_ids.GetLength() == 0) {
+        return 0;
+    }
+    int64_t max_id =
+            segment_ids.Max({0}).To(core::Dtype::Int64).Item<int64_t>();
+    return std::max<int64_t>(max_id + 1, 0);
+}
+
+std::tuple<core::Tensor, core::Tensor>
+PointCloud::GetSegmentAxisAlignedBoundingBoxes(
+        const core::Tensor &segment_ids) const {
+    core::Tensor min_bounds, max_bounds;
+    kernel::pointcloud::ComputeSegmentAxisAlignedBoundingBoxes(
+            GetPoints(), segment_ids, NumSegments(GetPoints(), segment_ids),
+            min_bounds, max_bounds);
+    return std::make_tuple(min_bounds, max_bounds);
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+PointCloud::GetSegmentOrientedBoundingBoxes(const core::Tensor &segment_ids,
+                                            bool minimal) const {
+    core::Tensor centers, rotations, extents;
+    kernel::pointcloud::ComputeSegmentOrientedBoundingBoxes(
+            GetPoints(), segment_ids, NumSegments(GetPoints(), segment_ids),
+            minimal, centers, rotations, extents);
+    return std::make_tuple(centers, rotations, extents);
+}
+
 PointCloud PointCloud::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
@@ -116,6 +170,70 @@ PointCloud &PointCloud::Transform(const core::Tensor &transformation) {
     return *this;
 }
 
+PointCloud &PointCloud::TransformSegments(const core::Tensor &transformations,
+                                          const core::Tensor &offsets) {
+    transformations.AssertDevice(device_);
+    offsets.AssertShapeCompatible({utility::nullopt});
+    const int64_t num_segments = offsets.GetLength() - 1;
+    transformations.AssertShape({std::max<int64_t>(num_segments, 0), 4, 4});
+    if (num_segments <= 0) {
+        return *this;
+    }
+    std::vector<int64_t> bounds = offsets.To(core::Dtype::Int64)
+                                          .To(core::Device("CPU:0"))
+                                          .ToFlatVector<int64_t>();
+    core::Tensor &points = GetPoints();
+    const int64_t n = points.GetLength();
+    for (int64_t s = 0; s < num_segments; ++s) {
+        if (bounds[s] < 0 || bounds[s] > bounds[s + 1] ||
+            bounds[s + 1] > n) {
+            utility::LogError(
+                    "Segment offsets must be non-decreasing and between 0 "
+                    "and {}.",
+                    n);
+        }
+    }
+
+    points = points.Contiguous();
+    std::vector<core::Tensor> segment_points, segment_normals;
+    for (int64_t s = 0; s < num_segments; ++s) {
+        segment_points.push_back(points.Slice(0, bounds[s], bounds[s + 1]));
+    }
+    if (HasPointNormals()) {
+        core::Tensor &normals = GetPointNormals();
+        normals = normals.Contiguous();
+        for (int64_t s = 0; s < num_segments; ++s) {
+            segment_normals.push_back(
+                    normals.Slice(0, bounds[s], bounds[s + 1]));
+        }
+    }
+    kernel::pointcloud::TransformSegments(segment_points, segment_normals,
+                                          transformations);
+    return *this;
+}
+
+void PointCloud::TransformBatch(std::vector<PointCloud> &pcds,
+                                const core::Tensor &transformations) {
+    std::vector<core::Tensor> points, normals;
+    bool has_normals = false;
+    for (PointCloud &pcd : pcds) {
+        pcd.GetPoints() = pcd.GetPoints().Contiguous();
+        points.push_back(pcd.GetPoints());
+        has_normals = has_normals || pcd.HasPointNormals();
+    }
+    if (has_normals) {
+        for (PointCloud &pcd : pcds) {
+            if (pcd.HasPointNormals()) {
+                pcd.GetPointNormals() = pcd.GetPointNormals().Contiguous();
+                normals.push_back(pcd.GetPointNormals());
+            } else {
+                normals.push_back(core::Tensor());
+            }
+        }
+    }
+    kernel::pointcloud::TransformSegments(points, normals, transformations);
+}
+
 PointCloud &PointCloud::Translate(const core::Tensor &translation,
                                   bool relative) {
     translation.AssertShape({3});
@@ -156,6 +274,15 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     return *this;
 }
 
+PointCloud &PointCloud::SortByMortonCode() {
+    core::Tensor order;
+    kernel::pointcloud::ComputeMortonOrder(GetPoints(), order);
+    for (auto &kv : point_attr_) {
+        kv.second = kv.second.IndexGet({order});
+    }
+    return *this;
+}
+
 PointCloud PointCloud::VoxelDownSample(
         double voxel_size, const core::HashmapBackend &backend) const {
     if (voxel_size <= 0) {
@@ -185,12 +312,734 @@ PointCloud PointCloud::VoxelDownSample(
     return pcd_down;
 }
 
-PointCloud PointCloud::CreateFromDepthImage(const Image &depth,
-                                            const core::Tensor &intrinsics,
-                                            const core::Tensor &extrinsics,
-                                            float depth_scale,
-                                            float depth_max,
-                                            int stride) {
+PointCloud PointCloud::VoxelDownSampleAndTrace(double voxel_size,
+                                               core::Tensor &trace) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    const core::Tensor &points = GetPoints();
+    int64_t n = points.GetLength();
+    PointCloud pcd_down(device_);
+    if (n == 0) {
+        trace = core::Tensor({0}, core::Dtype::Int64, device_);
+        return pcd_down;
+    }
+
+    // Voxel keys with 21 bits per axis, relative to the lowest voxel.
+    core::Tensor voxels = (points / voxel_size).Floor().To(core::Dtype::Int64);
+    voxels = voxels.Sub(voxels.Min({0}));
+    if (voxels.Max({0, 1}).Item<int64_t>() >= (int64_t(1) << 21)) {
+        utility::LogError(
+                "voxel_size {} is too small for the extent of the points.",
+                voxel_size);
+    }
+    core::Tensor keys = voxels.Slice(1, 0, 1).Mul(int64_t(1) << 42) +
+                        voxels.Slice(1, 1, 2).Mul(int64_t(1) << 21) +
+                        voxels.Slice(1, 2, 3);
+    keys = keys.Reshape({n});
+
+    // Sort the points by voxel and find the start of each voxel.
+    core::Tensor order = core::ArgSort(keys);
+    core::Tensor sorted_keys = keys.IndexGet({order});
+    core::Tensor is_first({n}, core::Dtype::Bool, device_);
+    is_first.Slice(0, 0, 1).Fill(true);
+    is_first.Slice(0, 1, n).AsRvalue() =
+            sorted_keys.Slice(0, 1, n).Ne(sorted_keys.Slice(0, 0, n - 1));
+    core::Tensor starts = core::CompactIndices(is_first);
+    int64_t num_voxels = starts.GetLength();
+
+    trace = core::Tensor({n}, core::Dtype::Int64, device_);
+    trace.IndexSet({order}, core::Scan(is_first).Sub(1));
+
+    core::Tensor offsets({num_voxels + 1}, core::Dtype::Int64, device_);
+    offsets.Slice(0, 0, num_voxels).AsRvalue() = starts;
+    offsets.Slice(0, num_voxels, num_voxels + 1).Fill(n);
+    core::Tensor counts = offsets.Slice(0, 1, num_voxels + 1)
+                                  .Sub(offsets.Slice(0, 0, num_voxels));
+
+    // Gather all the attributes as columns of one matrix, so that they are
+    // reduced at once. Float64 is used if any attribute needs it.
+    core::Dtype dtype = core::Dtype::Float32;
+    int64_t num_columns = 0;
+    for (auto &kv : point_attr_) {
+        if (kv.second.GetDtype() == core::Dtype::Float64) {
+            dtype = core::Dtype::Float64;
+        }
+        num_columns += kv.second.NumElements() / n;
+    }
+    core::Tensor columns({n, num_columns}, dtype, device_);
+    int64_t offset = 0;
+    for (auto &kv : point_attr_) {
+        int64_t width = kv.second.NumElements() / n;
+        columns.Slice(1, offset, offset + width) =
+                kv.second.Reshape({n, width}).To(dtype);
+        offset += width;
+    }
+
+    core::Tensor means =
+            core::SegmentedReduce(columns.IndexGet({order}), offsets,
+                                  core::kernel::ReductionOpCode::Sum)
+                    .Div(counts.Reshape({num_voxels, 1}).To(dtype));
+
+    offset = 0;
+    for (auto &kv : point_attr_) {
+        core::Dtype attr_dtype = kv.second.GetDtype();
+        int64_t width = kv.second.NumElements() / n;
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = num_voxels;
+        core::Tensor attr_down =
+                means.Slice(1, offset, offset + width).Contiguous().Reshape(
+                        shape);
+        if (attr_dtype != core::Dtype::Float32 &&
+            attr_dtype != core::Dtype::Float64) {
+            attr_down = attr_down.Round();
+        }
+        pcd_down.SetPointAttr(kv.first, attr_down.To(attr_dtype));
+        offset += width;
+    }
+
+    return pcd_down;
+}
+
+PointCloud PointCloud::FarthestPointDownSample(int64_t num_samples,
+                                               double voxel_size) const {
+    const core::Tensor &points = GetPoints();
+    if (num_samples < 0 || num_samples > points.GetLength()) {
+        utility::LogError("num_samples must be in [0, {}], but got {}.",
+                          points.GetLength(), num_samples);
+    }
+
+    // For the approximate sampling, the candidates are the first point of
+    // each occupied voxel.
+    core::Tensor candidates;
+    if (voxel_size > 0 && num_samples > 0) {
+        core::Tensor points_voxeli =
+                (points / voxel_size).Floor().To(core::Dtype::Int64);
+        core::Hashmap points_voxeli_hashmap(
+                points_voxeli.GetLength(), core::Dtype::Int64,
+                core::Dtype::Int32, {3}, {1}, device_);
+        core::Tensor addrs, masks;
+        points_voxeli_hashmap.Activate(points_voxeli, addrs, masks);
+        candidates = masks.NonZero()[0];
+        if (candidates.GetLength() < num_samples) {
+            candidates = core::Tensor();
+        }
+    }
+
+    core::Tensor indices;
+    if (candidates.NumElements() > 0) {
+        kernel::pointcloud::FarthestPointSample(
+                points.IndexGet({candidates}), num_samples, 0, indices);
+        indices = candidates.IndexGet({indices});
+    } else {
+        kernel::pointcloud::FarthestPointSample(points, num_samples, 0,
+                                                indices);
+    }
+
+    PointCloud pcd(GetDevice());
+    for (auto &kv : point_attr_) {
+        pcd.SetPointAttr(kv.first, kv.second.IndexGet({indices}));
+    }
+    return pcd;
+}
+
+PointCloud PointCloud::SelectByMask(const core::Tensor &mask,
+                                    bool invert) const {
+    mask.AssertDtype(core::Dtype::Bool);
+    mask.AssertDevice(GetDevice());
+    mask.AssertShape({GetPoints().GetLength()});
+    core::Tensor indices = (invert ? mask.LogicalNot() : mask).NonZero()[0];
+
+    PointCloud pcd(GetDevice());
+    for (auto &kv : point_attr_) {
+        pcd.SetPointAttr(kv.first, kv.second.IndexGet({indices}));
+    }
+    return pcd;
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
+        int nb_points, double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "Illegal input parameters, number of points and radius must be "
+                "positive.");
+    }
+    const core::Tensor &points = GetPoints();
+    if (points.GetLength() == 0) {
+        return std::make_tuple(
+                PointCloud(GetDevice()),
+                core::Tensor::Empty({0}, core::Dtype::Bool, GetDevice()));
+    }
+
+    // A point is kept if it has more than nb_points neighbors, itself
+    // included, which a hybrid search with nb_points + 1 neighbors tells
+    // without storing all of them.
+    core::nns::NearestNeighborSearch nns(points);
+    nns.HybridIndex(search_radius);
+    core::Tensor indices, distances;
+    std::tie(indices, distances) =
+            nns.HybridSearch(points, search_radius, nb_points + 1);
+    core::Tensor mask = indices.Slice(1, nb_points, nb_points + 1)
+                                .Reshape({points.GetLength()})
+                                .Ge(0);
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
+        int nb_neighbors, double std_ratio) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "Illegal input parameters, number of neighbors and standard "
+                "deviation ratio must be positive.");
+    }
+    const core::Tensor &points = GetPoints();
+    const int64_t num_points = points.GetLength();
+    if (num_points == 0) {
+        return std::make_tuple(
+                PointCloud(GetDevice()),
+                core::Tensor::Empty({0}, core::Dtype::Bool, GetDevice()));
+    }
+
+    core::nns::NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = nns.KnnSearch(
+            points, int(std::min<int64_t>(nb_neighbors, num_points)));
+    core::Tensor avg_distances =
+            distances.Sqrt().Mean({1}).To(core::Dtype::Float64);
+
+    // Same statistics as the legacy point cloud: points with a zero average
+    // distance are left out of the sums, but not of the counts.
+    core::Tensor valid = avg_distances.Gt(0);
+    double cloud_mean = avg_distances.Sum({0}).Item<double>() / num_points;
+    core::Tensor deviations =
+            (avg_distances - cloud_mean) * valid.To(core::Dtype::Float64);
+    double sq_sum = (deviations * deviations).Sum({0}).Item<double>();
+    double std_dev =
+            num_points > 1 ? std::sqrt(sq_sum / (num_points - 1)) : 0.0;
+    double distance_threshold = cloud_mean + std_ratio * std_dev;
+
+    core::Tensor mask = valid.LogicalAnd(avg_distances.Lt(distance_threshold));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+PointCloud &PointCloud::EstimateNormals(
+        int max_nn, const utility::optional<double> radius) {
+    if (max_nn < 1) {
+        utility::LogError("max_nn must be positive.");
+    }
+    const core::Tensor &points = GetPoints();
+    if (points.GetLength() == 0) {
+        return *this;
+    }
+
+    core::nns::NearestNeighborSearch nns(points);
+    core::Tensor neighbors, distances;
+    if (radius.has_value()) {
+        nns.HybridIndex(radius.value());
+        std::tie(neighbors, distances) =
+                nns.HybridSearch(points, radius.value(), max_nn);
+    } else {
+        nns.KnnIndex();
+        std::tie(neighbors, distances) = nns.KnnSearch(
+                points, int(std::min<int64_t>(max_nn, points.GetLength())));
+    }
+
+    core::Tensor normals;
+    if (HasPointNormals()) {
+        normals = GetPointNormals();
+    }
+    kernel::pointcloud::EstimateNormals(points, neighbors, normals);
+    SetPointNormals(normals);
+    return *this;
+}
+
+PointCloud &PointCloud::EstimateColorGradients(
+        int max_nn, const utility::optional<double> radius) {
+    if (max_nn < 1) {
+        utility::LogError("max_nn must be positive.");
+    }
+    if (!HasPointNormals() || !HasPointColors()) {
+        utility::LogError(
+                "EstimateColorGradients requires normals and colors.");
+    }
+    const core::Tensor &points = GetPoints();
+    if (points.GetLength() == 0) {
+        return *this;
+    }
+
+    core::nns::NearestNeighborSearch nns(points);
+    core::Tensor neighbors, distances;
+    if (radius.has_value()) {
+        nns.HybridIndex(radius.value());
+        std::tie(neighbors, distances) =
+                nns.HybridSearch(points, radius.value(), max_nn);
+    } else {
+        nns.KnnIndex();
+        std::tie(neighbors, distances) = nns.KnnSearch(
+                points, int(std::min<int64_t>(max_nn, points.GetLength())));
+    }
+
+    core::Tensor color_gradients;
+    kernel::pointcloud::EstimateColorGradients(
+            points, GetPointNormals(), GetPointColors().To(points.GetDtype()),
+            neighbors, color_gradients);
+    SetPointAttr("color_gradients", color_gradients);
+    return *this;
+}
+
+core::Tensor PointCloud::ClusterDBSCAN(double eps, size_t min_points) const {
+    core::Tensor labels;
+    kernel::pointcloud::ClusterDBSCAN(GetPoints(), eps, int64_t(min_points),
+                                      labels);
+    return labels;
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::ComputeISSKeypoints(
+        double salient_radius,
+        double non_max_radius,
+        double gamma_21,
+        double gamma_32,
+        int min_neighbors) const {
+    if (salient_radius < 0 || non_max_radius < 0) {
+        utility::LogError(
+                "[ComputeISSKeypoints] salient_radius and non_max_radius must "
+                "not be negative.");
+    }
+    const core::Tensor &points = GetPoints();
+    const int64_t num_points = points.GetLength();
+    if (num_points == 0) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return std::make_tuple(
+                PointCloud(GetDevice()),
+                core::Tensor::Empty({0}, core::Dtype::Bool, GetDevice()));
+    }
+
+    core::nns::NearestNeighborSearch nns(points);
+    if (salient_radius == 0 || non_max_radius == 0) {
+        double resolution = 0;
+        if (num_points > 1) {
+            nns.KnnIndex();
+            core::Tensor indices, distances;
+            std::tie(indices, distances) = nns.KnnSearch(points, 2);
+            resolution = distances.Slice(1, 1, 2)
+                                 .To(core::Dtype::Float64)
+                                 .Sqrt()
+                                 .Mean({0, 1})
+                                 .Item<double>();
+        }
+        salient_radius = 6 * resolution;
+        non_max_radius = 4 * resolution;
+        utility::LogDebug(
+                "[ComputeISSKeypoints] Computed salient_radius = {}, "
+                "non_max_radius = {} from input model",
+                salient_radius, non_max_radius);
+        if (resolution == 0) {
+            utility::LogWarning(
+                    "[ComputeISSKeypoints] The model resolution is 0.");
+            core::Tensor mask = core::Tensor::Zeros(
+                    {num_points}, core::Dtype::Bool, GetDevice());
+            return std::make_tuple(SelectByMask(mask), mask);
+        }
+    }
+
+    // A single index serves both searches, since a FixedRadiusIndex answers
+    // searches up to its radius.
+    nns.FixedRadiusIndex(std::max(salient_radius, non_max_radius));
+    core::Tensor indices, distances, num_neighbors;
+    std::tie(indices, distances, num_neighbors) =
+            nns.FixedRadiusSearch(points, salient_radius, /*sort=*/false);
+    core::Tensor saliency;
+    kernel::pointcloud::ComputeISSSaliency(points, indices, num_neighbors,
+                                           gamma_21, gamma_32,
+                                           int64_t(min_neighbors), saliency);
+
+    std::tie(indices, distances, num_neighbors) =
+            nns.FixedRadiusSearch(points, non_max_radius, /*sort=*/false);
+    core::Tensor mask;
+    kernel::pointcloud::SuppressNonMaxima(saliency, indices, num_neighbors,
+                                          int64_t(min_neighbors), mask);
+    utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
+                      mask.To(core::Dtype::Int64).Sum({0}).Item<int64_t>());
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+/// Least-squares plane through points with the given centroid and covariance,
+/// computed like in the legacy geometry::PointCloud::SegmentPlane.
+static Eigen::Vector4d GetPlaneFromMeanAndCovariance(
+        const std::vector<double> &mean, const std::vector<double> &cov) {
+    double xx = cov[0], xy = cov[1], xz = cov[2];
+    double yy = cov[4], yz = cov[5], zz = cov[8];
+    double det_x = yy * zz - yz * yz;
+    double det_y = xx * zz - xz * xz;
+    double det_z = xx * yy - xy * xy;
+
+    Eigen::Vector3d abc;
+    if (det_x > det_y && det_x > det_z) {
+        abc = Eigen::Vector3d(det_x, xz * yz - xy * zz, xy * yz - xz * yy);
+    } else if (det_y > det_z) {
+        abc = Eigen::Vector3d(xz * yz - xy * zz, det_y, xy * xz - yz * xx);
+    } else {
+        abc = Eigen::Vector3d(xy * yz - xz * yy, xy * xz - yz * xx, det_z);
+    }
+    double norm = abc.norm();
+    if (norm == 0) {
+        return Eigen::Vector4d(0, 0, 0, 0);
+    }
+    abc /= norm;
+    double d = -abc.dot(Eigen::Vector3d(mean[0], mean[1], mean[2]));
+    return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability) const {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be > 0 and <= 1.0.");
+    }
+    const core::Tensor &points = GetPoints();
+    const int64_t num_points = points.GetLength();
+    if (num_points < ransac_n) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    const core::Device device = GetDevice();
+    const core::Dtype dtype = points.GetDtype();
+    static const core::Device host("CPU:0");
+
+    // Hypotheses are scored in batches as (N, batch) distance matrices, with
+    // the batch small enough for the temporaries to stay around 2^24
+    // elements.
+    const int64_t batch_size =
+            std::max<int64_t>(1, std::min<int64_t>(32, (1 << 24) / num_points));
+    const core::Tensor x = points.Slice(1, 0, 1);
+    const core::Tensor y = points.Slice(1, 1, 2);
+    const core::Tensor z = points.Slice(1, 2, 3);
+    auto distances_to = [&](const std::vector<Eigen::Vector4d> &planes) {
+        std::vector<double> coeffs[4];
+        for (const Eigen::Vector4d &plane : planes) {
+            for (int i = 0; i < 4; ++i) {
+                coeffs[i].push_back(plane(i));
+            }
+        }
+        const int64_t num_planes = int64_t(planes.size());
+        core::Tensor abcd[4];
+        for (int i = 0; i < 4; ++i) {
+            abcd[i] = core::Tensor(coeffs[i], {1, num_planes},
+                                   core::Dtype::Float64, host)
+                              .To(device, dtype);
+        }
+        return (x * abcd[0] + y * abcd[1] + z * abcd[2] + abcd[3]).Abs();
+    };
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::vector<int64_t> indices(num_points);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    // Same sampling, scoring and early termination as the legacy point
+    // cloud.
+    double best_fitness = 0, best_rmse = 0;
+    Eigen::Vector4d best_plane_model(0, 0, 0, 0);
+    double break_iteration = num_iterations;
+    int itr = 0;
+    while (itr < break_iteration) {
+        int batch_end = std::min(itr + int(batch_size),
+                                 int(std::ceil(break_iteration)));
+        std::vector<int64_t> samples;
+        for (; itr < batch_end; ++itr) {
+            for (int i = 0; i < ransac_n; ++i) {
+                std::swap(indices[i], indices[rng() % num_points]);
+            }
+            samples.insert(samples.end(), indices.begin(), indices.begin() + 3);
+        }
+        int64_t num_samples = int64_t(samples.size());
+        std::vector<double> sample_points =
+                points.IndexGet({core::Tensor(samples, {num_samples},
+                                              core::Dtype::Int64, host)
+                                         .To(device)})
+                        .To(host, core::Dtype::Float64)
+                        .ToFlatVector<double>();
+        auto sample_point = [&](int64_t k) {
+            return Eigen::Vector3d(sample_points[3 * k],
+                                   sample_points[3 * k + 1],
+                                   sample_points[3 * k + 2]);
+        };
+        std::vector<Eigen::Vector4d> planes;
+        for (int64_t k = 0; k < num_samples; k += 3) {
+            Eigen::Vector4d plane =
+                    open3d::geometry::TriangleMesh::ComputeTrianglePlane(
+                            sample_point(k), sample_point(k + 1),
+                            sample_point(k + 2));
+            if (!plane.isZero(0)) {
+                planes.push_back(plane);
+            }
+        }
+        if (planes.empty()) {
+            continue;
+        }
+
+        core::Tensor distances = distances_to(planes);
+        core::Tensor is_inlier = distances.Lt(distance_threshold);
+        std::vector<int64_t> counts = is_inlier.To(core::Dtype::Int64)
+                                              .Sum({0})
+                                              .To(host)
+                                              .ToFlatVector<int64_t>();
+        std::vector<double> errors = (distances * is_inlier.To(dtype))
+                                             .Sum({0})
+                                             .To(host, core::Dtype::Float64)
+                                             .ToFlatVector<double>();
+        for (size_t m = 0; m < planes.size(); ++m) {
+            if (counts[m] == 0) {
+                continue;
+            }
+            double fitness = double(counts[m]) / double(num_points);
+            double rmse = errors[m] / std::sqrt(double(counts[m]));
+            if (fitness > best_fitness ||
+                (fitness == best_fitness && rmse < best_rmse)) {
+                best_fitness = fitness;
+                best_rmse = rmse;
+                best_plane_model = planes[m];
+                break_iteration = std::min(
+                        std::log(1 - probability) /
+                                std::log(1 - std::pow(fitness, ransac_n)),
+                        double(num_iterations));
+            }
+        }
+    }
+
+    // Refine the best plane model with its inliers.
+    core::Tensor best_distances =
+            distances_to({best_plane_model}).Reshape({-1});
+    core::Tensor inliers = best_distances.Lt(distance_threshold).NonZero()[0];
+    Eigen::Vector4d plane_model(0, 0, 0, 0);
+    if (inliers.GetLength() > 0) {
+        core::Tensor mean, covariance;
+        std::tie(mean, covariance) =
+                points.IndexGet({inliers}).MeanAndCovariance();
+        plane_model = GetPlaneFromMeanAndCovariance(
+                mean.To(host, core::Dtype::Float64).ToFlatVector<double>(),
+                covariance.To(host, core::Dtype::Float64)
+                        .ToFlatVector<double>());
+    }
+    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
+                      inliers.GetLength(), best_fitness, best_rmse);
+    return std::make_tuple(
+            core::Tensor(std::vector<double>(plane_model.data(),
+                                             plane_model.data() + 4),
+                         {4}, core::Dtype::Float64, host),
+            inliers);
+}
+
+std::tuple<TriangleMesh, core::Tensor> PointCloud::HiddenPointRemoval(
+        const core::Tensor &camera_location, double radius) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemoval] radius must be larger than zero.");
+    }
+    camera_location.AssertShape({3});
+    const core::Tensor &points = GetPoints();
+    const core::Device device = GetDevice();
+    static const core::Device host("CPU:0");
+
+    // Spherical flip on the device, in double precision like the legacy
+    // point cloud.
+    core::Tensor projected =
+            points.To(core::Dtype::Float64)
+                    .Sub(camera_location.To(device, core::Dtype::Float64)
+                                 .Reshape({1, 3}));
+    core::Tensor norm = projected.Mul(projected).Sum({1}, true).Sqrt();
+    projected.Add_(projected.Mul(norm.Neg().Add(radius).Mul(2).Div(norm)));
+
+    std::vector<Eigen::Vector3d> spherical_projection =
+            core::eigen_converter::TensorToEigenVector3dVector(
+                    projected.To(host));
+    const size_t origin_pidx = spherical_projection.size();
+    spherical_projection.push_back(Eigen::Vector3d(0, 0, 0));
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> hull;
+    std::vector<size_t> pt_map;
+    std::tie(hull, pt_map) =
+            open3d::geometry::Qhull::ComputeConvexHull(spherical_projection);
+
+    // Drops the origin and its triangles from the hull.
+    std::vector<int64_t> visible;
+    int64_t origin_vidx = -1;
+    for (size_t vidx = 0; vidx < pt_map.size(); ++vidx) {
+        if (pt_map[vidx] == origin_pidx) {
+            origin_vidx = int64_t(vidx);
+        } else {
+            visible.push_back(int64_t(pt_map[vidx]));
+        }
+    }
+    std::vector<int64_t> triangles;
+    for (const Eigen::Vector3i &triangle : hull->triangles_) {
+        if (triangle(0) == origin_vidx || triangle(1) == origin_vidx ||
+            triangle(2) == origin_vidx) {
+            continue;
+        }
+        for (int i = 0; i < 3; ++i) {
+            triangles.push_back(triangle(i) - (origin_vidx >= 0 &&
+                                                       triangle(i) > origin_vidx
+                                               ? 1
+                                               : 0));
+        }
+    }
+
+    const int64_t num_visible = int64_t(visible.size());
+    const int64_t num_triangles = int64_t(triangles.size()) / 3;
+    core::Tensor indices =
+            core::Tensor(visible, {num_visible}, core::Dtype::Int64, host)
+                    .To(device);
+    TriangleMesh mesh(
+            points.IndexGet({indices}),
+            core::Tensor(triangles, {num_triangles, 3}, core::Dtype::Int64,
+                         host)
+                    .To(device));
+    for (const auto &kv : point_attr_) {
+        if (kv.first != "points") {
+            mesh.SetVertexAttr(kv.first, kv.second.IndexGet({indices}));
+        }
+    }
+    return std::make_tuple(mesh, indices);
+}
+
+core::Tensor PointCloud::ComputePointCloudDistance(
+        const PointCloud &target) const {
+    const core::Tensor &points = GetPoints();
+    const core::Tensor &target_points = target.GetPoints();
+    target_points.AssertDevice(GetDevice());
+    target_points.AssertDtype(points.GetDtype());
+    if (points.GetLength() == 0) {
+        return core::Tensor::Empty({0}, points.GetDtype(), GetDevice());
+    }
+    if (target_points.GetLength() == 0) {
+        utility::LogError(
+                "[ComputePointCloudDistance] The target point cloud is "
+                "empty.");
+    }
+
+    core::nns::NearestNeighborSearch nns(target_points);
+    nns.KnnIndex();
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = nns.KnnSearch(points, 1);
+    return distances.Reshape({-1}).Sqrt();
+}
+
+core::Tensor PointCloud::ComputeNearestNeighborDistance() const {
+    const core::Tensor &points = GetPoints();
+    const int64_t num_points = points.GetLength();
+    if (num_points < 2) {
+        return core::Tensor::Zeros({num_points}, points.GetDtype(),
+                                   GetDevice());
+    }
+
+    // The nearest neighbor of a point is the point itself, so the second one
+    // is used. Duplicated points have a zero distance, like in the legacy
+    // point cloud.
+    core::nns::NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = nns.KnnSearch(points, 2);
+    return distances.Slice(1, 1, 2).Reshape({-1}).Sqrt();
+}
+
+double PointCloud::ComputeHausdorffDistance(const PointCloud &target,
+                                            bool symmetric) const {
+    if (IsEmpty() || GetPoints().GetLength() == 0 ||
+        target.GetPoints().GetLength() == 0) {
+        utility::LogError(
+                "[ComputeHausdorffDistance] The point clouds must not be "
+                "empty.");
+    }
+    double distance = ComputePointCloudDistance(target)
+                              .Max({0})
+                              .To(core::Dtype::Float64)
+                              .Item<double>();
+    if (symmetric) {
+        distance = std::max(distance, target.ComputePointCloudDistance(*this)
+                                              .Max({0})
+                                              .To(core::Dtype::Float64)
+                                              .Item<double>());
+    }
+    return distance;
+}
+
+double PointCloud::ComputeChamferDistance(const PointCloud &target) const {
+    if (IsEmpty() || GetPoints().GetLength() == 0 ||
+        target.GetPoints().GetLength() == 0) {
+        utility::LogError(
+                "[ComputeChamferDistance] The point clouds must not be "
+                "empty.");
+    }
+    // The means are accumulated in Float64, since the clouds can have
+    // millions of points.
+    return ComputePointCloudDistance(target)
+                   .To(core::Dtype::Float64)
+                   .Mean({0})
+                   .Item<double>() +
+           target.ComputePointCloudDistance(*this)
+                   .To(core::Dtype::Float64)
+                   .Mean({0})
+                   .Item<double>();
+}
+
+/// Returns the undistortion map of a camera, or nullopt if \p distortion is
+/// all zero. The maps are cached per intrinsics, distortion, image size and
+/// device, since a stream of frames comes from a few cameras.
+static utility::optional<core::Tensor> GetUndistortionMap(
+        const core::Tensor &intrinsics,
+        const std::vector<double> &distortion,
+        int64_t rows,
+        int64_t cols,
+        const core::Device &device) {
+    if (std::all_of(distortion.begin(), distortion.end(),
+                    [](double k) { return k == 0.0; })) {
+        return utility::nullopt;
+    }
+    std::vector<double> key =
+            intrinsics.To(core::Device("CPU:0"), core::Dtype::Float64)
+                    .Contiguous()
+                    .ToFlatVector<double>();
+    key.insert(key.end(), distortion.begin(), distortion.end());
+    key.push_back(static_cast<double>(rows));
+    key.push_back(static_cast<double>(cols));
+
+    static std::mutex mutex;
+    // Intentionally leaked, so that no device memory is freed at exit after
+    // the device runtime is torn down.
+    static auto *cache = new std::vector<
+            std::tuple<std::vector<double>, core::Device, core::Tensor>>();
+    const size_t max_cache_size = 8;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &entry : *cache) {
+        if (std::get<0>(entry) == key && std::get<1>(entry) == device) {
+            return std::get<2>(entry);
+        }
+    }
+    core::Tensor map;
+    kernel::pointcloud::ComputeUndistortionMap(intrinsics, distortion, rows,
+                                               cols, device, map);
+    if (cache->size() >= max_cache_size) {
+        cache->erase(cache->begin());
+    }
+    cache->emplace_back(key, device, map);
+    return map;
+}
+
+PointCloud PointCloud::CreateFromDepthImage(
+        const Image &depth,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max,
+        int stride,
+        const std::vector<double> &distortion) {
     core::Dtype dtype = depth.AsTensor().GetDtype();
     if (dtype != core::Dtype::UInt16 && dtype != core::Dtype::Float32) {
         utility::LogError(
@@ -199,19 +1048,32 @@ PointCloud PointCloud::CreateFromDepthImage(const Image &depth,
                 dtype.ToString());
     }
 
+    utility::optional<core::Tensor> undistortion_map =
+            GetUndistortionMap(intrinsics, distortion, depth.GetRows(),
+                               depth.GetCols(), depth.GetDevice());
     core::Tensor points;
-    kernel::pointcloud::Unproject(depth.AsTensor(), utility::nullopt, points,
-                                  utility::nullopt, intrinsics, extrinsics,
-                                  depth_scale, depth_max, stride);
+    if (undistortion_map.has_value()) {
+        kernel::pointcloud::Unproject(depth.AsTensor(), utility::nullopt,
+                                      points, utility::nullopt, intrinsics,
+                                      extrinsics, depth_scale, depth_max,
+                                      stride, undistortion_map.value());
+    } else {
+        kernel::pointcloud::Unproject(depth.AsTensor(), utility::nullopt,
+                                      points, utility::nullopt, intrinsics,
+                                      extrinsics, depth_scale, depth_max,
+                                      stride);
+    }
     return PointCloud(points);
 }
 
-PointCloud PointCloud::CreateFromRGBDImage(const RGBDImage &rgbd_image,
-                                           const core::Tensor &intrinsics,
-                                           const core::Tensor &extrinsics,
-                                           float depth_scale,
-                                           float depth_max,
-                                           int stride) {
+PointCloud PointCloud::CreateFromRGBDImage(
+        const RGBDImage &rgbd_image,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max,
+        int stride,
+        const std::vector<double> &distortion) {
     auto dtype = rgbd_image.depth_.AsTensor().GetDtype();
     if (dtype != core::Dtype::UInt16 && dtype != core::Dtype::Float32) {
         utility::LogError(
@@ -220,83 +1082,240 @@ PointCloud PointCloud::CreateFromRGBDImage(const RGBDImage &rgbd_image,
                 dtype.ToString());
     }
 
+    // The kernel converts the common color dtypes to Float32 in place of a
+    // separate pass over the image.
+    core::Dtype color_dtype = rgbd_image.color_.GetDtype();
     core::Tensor image_colors =
-            rgbd_image.color_.To(core::Dtype::Float32, /*copy=*/false)
-                    .AsTensor();
+            (color_dtype == core::Dtype::UInt8 ||
+             color_dtype == core::Dtype::UInt16 ||
+             color_dtype == core::Dtype::Float32 ||
+             color_dtype == core::Dtype::Float64)
+                    ? rgbd_image.color_.AsTensor()
+                    : rgbd_image.color_.To(core::Dtype::Float32, /*copy=*/false)
+                              .AsTensor();
 
+    const core::Tensor &image_depth = rgbd_image.depth_.AsTensor();
+    utility::optional<core::Tensor> undistortion_map = GetUndistortionMap(
+            intrinsics, distortion, rgbd_image.depth_.GetRows(),
+            rgbd_image.depth_.GetCols(), rgbd_image.depth_.GetDevice());
     core::Tensor points, colors;
-    kernel::pointcloud::Unproject(rgbd_image.depth_.AsTensor(), image_colors,
-                                  points, colors, intrinsics, extrinsics,
-                                  depth_scale, depth_max, stride);
+    if (undistortion_map.has_value()) {
+        kernel::pointcloud::Unproject(image_depth, image_colors, points, colors,
+                                      intrinsics, extrinsics, depth_scale,
+                                      depth_max, stride,
+                                      undistortion_map.value());
+    } else {
+        kernel::pointcloud::Unproject(image_depth, image_colors, points, colors,
+                                      intrinsics, extrinsics, depth_scale,
+                                      depth_max, stride);
+    }
     return PointCloud({{"points", points}, {"colors", colors}});
 }
 
+/// Projects the points, and optionally the colors, of \p pcd into the images
+/// of the cameras \p extrinsics of shape (B, 4, 4).
+static void ProjectPointCloud(const PointCloud &pcd,
+                              int width,
+                              int height,
+                              const core::Tensor &intrinsics,
+                              const core::Tensor &extrinsics,
+                              float depth_scale,
+                              float depth_max,
+                              core::Tensor &depth,
+                              utility::optional<core::Tensor> &colors) {
+    if (!pcd.HasPoints()) {
+        utility::LogError("The point cloud has no points to project.");
+    }
+    core::Tensor points = pcd.GetPoints().To(core::Dtype::Float32);
+    if (colors.has_value()) {
+        if (!pcd.HasPointColors()) {
+            utility::LogError("The point cloud has no colors to project.");
+        }
+        // Scale the colors like Image::To.
+        const core::Tensor &pcd_colors = pcd.GetPointColors();
+        core::Tensor point_colors = pcd_colors.To(core::Dtype::Float32);
+        if (pcd_colors.GetDtype() == core::Dtype::UInt8) {
+            point_colors.Div_(255.0f);
+        } else if (pcd_colors.GetDtype() == core::Dtype::UInt16) {
+            point_colors.Div_(65535.0f);
+        }
+        kernel::pointcloud::Project(points, point_colors, depth,
+                                    colors.value(), intrinsics, extrinsics,
+                                    height, width, depth_scale, depth_max);
+    } else {
+        kernel::pointcloud::Project(points, utility::nullopt, depth,
+                                    utility::nullopt, intrinsics, extrinsics,
+                                    height, width, depth_scale, depth_max);
+    }
+}
+
+Image PointCloud::ProjectToDepthImage(int width,
+                                      int height,
+                                      const core::Tensor &intrinsics,
+                                      const core::Tensor &extrinsics,
+                                      float depth_scale,
+                                      float depth_max) const {
+    extrinsics.AssertShape({4, 4});
+    return ProjectToDepthImages(width, height, intrinsics,
+                                extrinsics.Reshape({1, 4, 4}), depth_scale,
+                                depth_max)[0];
+}
+
+RGBDImage PointCloud::ProjectToRGBDImage(int width,
+                                         int height,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max) const {
+    extrinsics.AssertShape({4, 4});
+    return ProjectToRGBDImages(width, height, intrinsics,
+                               extrinsics.Reshape({1, 4, 4}), depth_scale,
+                               depth_max)[0];
+}
+
+std::vector<Image> PointCloud::ProjectToDepthImages(
+        int width,
+        int height,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max) const {
+    core::Tensor depth;
+    utility::optional<core::Tensor> colors;
+    ProjectPointCloud(*this, width, height, intrinsics, extrinsics,
+                      depth_scale, depth_max, depth, colors);
+    std::vector<Image> images;
+    for (int64_t b = 0; b < depth.GetLength(); ++b) {
+        images.emplace_back(depth[b]);
+    }
+    return images;
+}
+
+std::vector<RGBDImage> PointCloud::ProjectToRGBDImages(
+        int width,
+        int height,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max) const {
+    core::Tensor depth;
+    utility::optional<core::Tensor> colors = core::Tensor();
+    ProjectPointCloud(*this, width, height, intrinsics, extrinsics,
+                      depth_scale, depth_max, depth, colors);
+    std::vector<RGBDImage> images;
+    for (int64_t b = 0; b < depth.GetLength(); ++b) {
+        images.emplace_back(Image(colors.value()[b]), Image(depth[b]));
+    }
+    return images;
+}
+
 PointCloud PointCloud::FromLegacyPointCloud(
         const open3d::geometry::PointCloud &pcd_legacy,
         core::Dtype dtype,
+        const core::Device &device,
+        bool copy) {
+    // The legacy storage can only be aliased by Float64 tensors on the CPU.
+    const bool alias = !copy && dtype == core::Dtype::Float64 &&
+                       device == core::Device("CPU:0");
+    auto to_tensor =
+            [&](const std::vector<Eigen::Vector3d> &values) -> core::Tensor {
+        if (alias) {
+            return core::eigen_converter::EigenVector3dVectorAsTensor(
+                    const_cast<std::vector<Eigen::Vector3d> &>(values));
+        }
+        return core::eigen_converter::EigenVector3dVectorToTensor(
+                values, dtype, device);
+    };
+
+    geometry::PointCloud pcd(device);
+    if (pcd_legacy.HasPoints()) {
+        pcd.SetPoints(to_tensor(pcd_legacy.points_));
+    } else {
+        utility::LogWarning("Creating from an empty legacy PointCloud.");
+    }
+    if (pcd_legacy.HasColors()) {
+        pcd.SetPointColors(to_tensor(pcd_legacy.colors_));
+    }
+    if (pcd_legacy.HasNormals()) {
+        pcd.SetPointNormals(to_tensor(pcd_legacy.normals_));
+    }
+    return pcd;
+}
+
+PointCloud PointCloud::FromLegacyPointCloud(
+        open3d::geometry::PointCloud &&pcd_legacy,
+        core::Dtype dtype,
         const core::Device &device) {
+    if (dtype != core::Dtype::Float64 || device != core::Device("CPU:0")) {
+        return FromLegacyPointCloud(
+                static_cast<const open3d::geometry::PointCloud &>(pcd_legacy),
+                dtype, device);
+    }
+
+    // The legacy HasColors() and HasNormals() compare against the number of
+    // points, so evaluate them before the points are moved out.
+    const bool has_colors = pcd_legacy.HasColors();
+    const bool has_normals = pcd_legacy.HasNormals();
+
     geometry::PointCloud pcd(device);
     if (pcd_legacy.HasPoints()) {
         pcd.SetPoints(core::eigen_converter::EigenVector3dVectorToTensor(
-                pcd_legacy.points_, dtype, device));
+                std::move(pcd_legacy.points_)));
     } else {
         utility::LogWarning("Creating from an empty legacy PointCloud.");
     }
-    if (pcd_legacy.HasColors()) {
+    if (has_colors) {
         pcd.SetPointColors(core::eigen_converter::EigenVector3dVectorToTensor(
-                pcd_legacy.colors_, dtype, device));
+                std::move(pcd_legacy.colors_)));
     }
-    if (pcd_legacy.HasNormals()) {
+    if (has_normals) {
         pcd.SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
-                pcd_legacy.normals_, dtype, device));
+                std::move(pcd_legacy.normals_)));
     }
     return pcd;
 }
 
-open3d::geometry::PointCloud PointCloud::ToLegacyPointCloud() const {
+/// Converts a color attribute to legacy colors in [0, 1]. Passing an rvalue
+/// lets Float64 colors hand back their storage without copying.
+static std::vector<Eigen::Vector3d> ToLegacyColors(core::Tensor colors) {
+    double normalization_factor = 1.0;
+    core::Dtype point_color_dtype = colors.GetDtype();
+
+    if (point_color_dtype == core::Dtype::UInt8) {
+        normalization_factor =
+                1.0 / static_cast<double>(std::numeric_limits<uint8_t>::max());
+    } else if (point_color_dtype == core::Dtype::UInt16) {
+        normalization_factor =
+                1.0 / static_cast<double>(std::numeric_limits<uint16_t>::max());
+    } else if (point_color_dtype != core::Dtype::Float32 &&
+               point_color_dtype != core::Dtype::Float64) {
+        utility::LogWarning(
+                "Dtype {} of color attribute is not supported for "
+                "conversion to LegacyPointCloud and will be skipped. "
+                "Supported dtypes include UInt8, UIn16, Float32, and "
+                "Float64",
+                point_color_dtype.ToString());
+        return {};
+    }
+
+    if (normalization_factor != 1.0) {
+        core::Tensor rescaled_colors =
+                colors.To(core::Dtype::Float64) * normalization_factor;
+        return core::eigen_converter::TensorToEigenVector3dVector(
+                rescaled_colors);
+    }
+    return core::eigen_converter::TensorToEigenVector3dVector(
+            std::move(colors));
+}
+
+open3d::geometry::PointCloud PointCloud::ToLegacyPointCloud() const & {
     open3d::geometry::PointCloud pcd_legacy;
     if (HasPoints()) {
         pcd_legacy.points_ =
                 core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
     }
     if (HasPointColors()) {
-        bool dtype_is_supported_for_conversion = true;
-        double normalization_factor = 1.0;
-        core::Dtype point_color_dtype = GetPointColors().GetDtype();
-
-        if (point_color_dtype == core::Dtype::UInt8) {
-            normalization_factor =
-                    1.0 /
-                    static_cast<double>(std::numeric_limits<uint8_t>::max());
-        } else if (point_color_dtype == core::Dtype::UInt16) {
-            normalization_factor =
-                    1.0 /
-                    static_cast<double>(std::numeric_limits<uint16_t>::max());
-        } else if (point_color_dtype != core::Dtype::Float32 &&
-                   point_color_dtype != core::Dtype::Float64) {
-            utility::LogWarning(
-                    "Dtype {} of color attribute is not supported for "
-                    "conversion to LegacyPointCloud and will be skipped. "
-                    "Supported dtypes include UInt8, UIn16, Float32, and "
-                    "Float64",
-                    point_color_dtype.ToString());
-            dtype_is_supported_for_conversion = false;
-        }
-
-        if (dtype_is_supported_for_conversion) {
-            if (normalization_factor != 1.0) {
-                core::Tensor rescaled_colors =
-                        GetPointColors().To(core::Dtype::Float64) *
-                        normalization_factor;
-                pcd_legacy.colors_ =
-                        core::eigen_converter::TensorToEigenVector3dVector(
-                                rescaled_colors);
-            } else {
-                pcd_legacy.colors_ =
-                        core::eigen_converter::TensorToEigenVector3dVector(
-                                GetPointColors());
-            }
-        }
+        pcd_legacy.colors_ = ToLegacyColors(GetPointColors());
     }
     if (HasPointNormals()) {
         pcd_legacy.normals_ =
@@ -306,6 +1325,25 @@ open3d::geometry::PointCloud PointCloud::ToLegacyPointCloud() const {
     return pcd_legacy;
 }
 
+open3d::geometry::PointCloud PointCloud::ToLegacyPointCloud() && {
+    open3d::geometry::PointCloud pcd_legacy;
+    // HasPointAttr() compares lengths against the points, so the points are
+    // moved out last.
+    if (HasPointColors()) {
+        pcd_legacy.colors_ = ToLegacyColors(std::move(GetPointColors()));
+    }
+    if (HasPointNormals()) {
+        pcd_legacy.normals_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        std::move(GetPointNormals()));
+    }
+    if (HasPoints()) {
+        pcd_legacy.points_ = core::eigen_converter::TensorToEigenVector3dVector(
+                std::move(GetPoints()));
+    }
+    return pcd_legacy;
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
@@ -29,6 +29,8 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
@@ -43,6 +45,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class TriangleMesh;
+
 /// \class PointCloud
 /// \brief A pointcloud contains a set of 3D points.
 ///
@@ -263,6 +267,41 @@ public:
     /// Returns the center for point coordinates.
     core::Tensor GetCenter() const;
 
+    /// Returns the min bound and the max bound for point coordinates, computed
+    /// in a single pass over the points.
+    std::pair<core::Tensor, core::Tensor> GetMinMaxBound() const;
+
+    /// Returns the mean (3,) and the covariance (3, 3) of point coordinates,
+    /// computed in a single pass over the points.
+    std::pair<core::Tensor, core::Tensor> ComputeMeanAndCovariance() const;
+
+    /// \brief Computes the axis-aligned bounding boxes of many segments of
+    /// the point cloud at once, on its device.
+    ///
+    /// \param segment_ids Int32 or Int64 tensor of shape {n,} with the
+    /// segment of each point, e.g. the labels of ClusterDBSCAN. Points with a
+    /// negative id are ignored.
+    /// \return Tuple of the min bounds and the max bounds of shape {s, 3},
+    /// where s is the largest segment id plus 1. Empty segments have zero
+    /// bounds.
+    std::tuple<core::Tensor, core::Tensor> GetSegmentAxisAlignedBoundingBoxes(
+            const core::Tensor &segment_ids) const;
+
+    /// \brief Computes the oriented bounding boxes of many segments of the
+    /// point cloud at once, on its device.
+    ///
+    /// \param segment_ids Int32 or Int64 tensor of shape {n,} with the
+    /// segment of each point. Points with a negative id are ignored.
+    /// \param minimal If false, the boxes are aligned with the principal axes
+    /// of their points. If true, they are rotated to minimize their volume,
+    /// see kernel::pointcloud::ComputeSegmentOrientedBoundingBoxes.
+    /// \return Tuple of the centers {s, 3}, the rotations {s, 3, 3} whose
+    /// columns are the axes of the boxes, and the extents {s, 3}, where s is
+    /// the largest segment id plus 1.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    GetSegmentOrientedBoundingBoxes(const core::Tensor &segment_ids,
+                                    bool minimal = false) const;
+
     /// \brief Transforms the points and normals (if exist)
     /// of the PointCloud.
     /// Extracts R, t from Transformation
@@ -276,6 +315,34 @@ public:
     /// \return Transformed pointcloud
     PointCloud &Transform(const core::Tensor &transformation);
 
+    /// \brief Transforms segments of the PointCloud, each by its own
+    /// transformation, in a single parallel pass.
+    ///
+    /// The points and normals (if exist) of segment s, the rows offsets[s] to
+    /// offsets[s + 1] - 1, are transformed like Transform does with
+    /// transformations[s]. Rows outside of all segments are left unchanged.
+    /// The points and normals are modified in place, so that point clouds
+    /// sharing them are transformed as well.
+    /// \param transformations Transformations [Tensor of dim {M,4,4}].
+    /// Should be on the same device as the PointCloud
+    /// \param offsets Non-decreasing segment offsets [Tensor of dim {M+1}],
+    /// between 0 and the number of points.
+    /// \return Transformed pointcloud
+    PointCloud &TransformSegments(const core::Tensor &transformations,
+                                  const core::Tensor &offsets);
+
+    /// \brief Transforms each of the point clouds \p pcds by its own
+    /// transformation, in a single parallel pass.
+    ///
+    /// The point clouds must be on the same device, and their points and
+    /// normals (if exist) must share one float dtype. They are transformed
+    /// in place like with TransformSegments.
+    /// \param pcds The point clouds.
+    /// \param transformations Transformations [Tensor of dim {M,4,4}], one
+    /// per point cloud.
+    static void TransformBatch(std::vector<PointCloud> &pcds,
+                               const core::Tensor &transformations);
+
     /// \brief Translates the points of the PointCloud.
     /// \param translation translation tensor of dimension {3}
     /// Should be on the same device as the PointCloud
@@ -299,12 +366,210 @@ public:
     /// \return Rotated pointcloud
     PointCloud &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Reorders the points along a Z-order (Morton) curve.
+    ///
+    /// Points that are close in space end up close in memory, which improves
+    /// cache locality of neighbor searches and voxel operations. All point
+    /// attributes are reordered consistently. On CUDA the codes are sorted
+    /// with a radix sort.
+    /// \return Reordered pointcloud
+    PointCloud &SortByMortonCode();
+
     /// \brief Downsamples a point cloud with a specified voxel size.
     /// \param voxel_size Voxel size. A positive number.
     PointCloud VoxelDownSample(double voxel_size,
                                const core::HashmapBackend &backend =
                                        core::HashmapBackend::Default) const;
 
+    /// \brief Downsamples a point cloud by averaging the points and all the
+    /// point attributes within each voxel, like the legacy
+    /// geometry::PointCloud::VoxelDownSample.
+    ///
+    /// The points are sorted by voxel with a radix sort and all attributes
+    /// are then averaged per voxel in a single segmented reduction, without a
+    /// hashmap. Integer and boolean attributes are averaged in floating point
+    /// and rounded.
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param trace Output Int64 tensor of shape (N,) holding the index of
+    /// the output point of each input point.
+    /// \return Pointcloud with one point per occupied voxel, ordered by voxel.
+    PointCloud VoxelDownSampleAndTrace(double voxel_size,
+                                       core::Tensor &trace) const;
+
+    /// \brief Downsamples a point cloud with farthest point sampling.
+    ///
+    /// Starting from the first point, each step adds the point farthest from
+    /// the points selected so far, which covers the cloud evenly. Runs on the
+    /// device of the point cloud.
+    /// \param num_samples Number of points to select, at most the number of
+    /// points.
+    /// \param voxel_size If positive, the sampling is approximate and only
+    /// considers one point per voxel of this size, which is much faster for
+    /// dense clouds. Falls back to the exact sampling if there are fewer
+    /// occupied voxels than \p num_samples.
+    /// \return Pointcloud with all attributes of the selected points, in the
+    /// order of selection.
+    PointCloud FarthestPointDownSample(int64_t num_samples,
+                                       double voxel_size = 0.0) const;
+
+    /// \brief Selects the points where \p mask is true.
+    ///
+    /// \param mask Boolean Tensor of shape {n,}, on the device of the point
+    /// cloud.
+    /// \param invert If true, selects the points where \p mask is false.
+    /// \return Pointcloud with all attributes of the selected points.
+    PointCloud SelectByMask(const core::Tensor &mask,
+                            bool invert = false) const;
+
+    /// \brief Removes the points that have less than \p nb_points neighbors
+    /// in a sphere of radius \p search_radius, the point itself included.
+    ///
+    /// Runs on the device of the point cloud, with a FixedRadiusIndex on CUDA.
+    /// \param nb_points Minimum number of neighbors besides the point itself.
+    /// \param search_radius Radius of the sphere.
+    /// \return Tuple of the filtered pointcloud and the Boolean mask of shape
+    /// {n,} of the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
+            int nb_points, double search_radius) const;
+
+    /// \brief Removes the points whose average distance to their
+    /// \p nb_neighbors nearest neighbors exceeds the mean over the cloud by
+    /// more than \p std_ratio standard deviations.
+    ///
+    /// Runs on the device of the point cloud, with a KnnIndex on CUDA.
+    /// \param nb_neighbors Number of neighbors, the point itself included.
+    /// \param std_ratio Standard deviation ratio.
+    /// \return Tuple of the filtered pointcloud and the Boolean mask of shape
+    /// {n,} of the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveStatisticalOutliers(
+            int nb_neighbors, double std_ratio) const;
+
+    /// \brief Estimates the normals of the points and stores them in the
+    /// "normals" attribute.
+    ///
+    /// The normal of a point is the eigenvector of the smallest eigenvalue of
+    /// the covariance of its neighbors. Existing normals are used to orient
+    /// the new ones. Runs on the device of the point cloud.
+    /// \param max_nn Maximum number of neighbors, the point itself included.
+    /// \param radius If set, only neighbors within the radius are used
+    /// (hybrid search). Otherwise the \p max_nn nearest neighbors are used.
+    /// \return Reference to this pointcloud.
+    PointCloud &EstimateNormals(
+            int max_nn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Estimates the gradients of the color intensity on the tangent
+    /// planes of the points, used by colored ICP, and stores them in the
+    /// "color_gradients" attribute.
+    ///
+    /// Requires normals and colors. Runs on the device of the point cloud.
+    /// \param max_nn Maximum number of neighbors, the point itself included.
+    /// \param radius If set, only neighbors within the radius are used
+    /// (hybrid search). Otherwise the \p max_nn nearest neighbors are used.
+    /// \return Reference to this pointcloud.
+    PointCloud &EstimateColorGradients(
+            int max_nn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Clusters the points with the DBSCAN algorithm, Ester et al., "A
+    /// Density-Based Algorithm for Discovering Clusters in Large Spatial
+    /// Databases with Noise", 1996.
+    ///
+    /// Runs on the device of the point cloud, with memory linear in the
+    /// number of points. The labels are the same as the ones of the legacy
+    /// point cloud.
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \return Int32 tensor of shape {n,} with the cluster label of each
+    /// point, -1 for noise.
+    core::Tensor ClusterDBSCAN(double eps, size_t min_points) const;
+
+    /// \brief Detects the Intrinsic Shape Signatures keypoints of the point
+    /// cloud, like the legacy geometry::keypoint::ComputeISSKeypoints.
+    ///
+    /// Runs on the device of the point cloud. The neighbors are found with a
+    /// FixedRadiusIndex on CUDA, and the saliency of each point and the
+    /// non-maximum suppression are computed in parallel.
+    /// \param salient_radius Radius of the neighborhood of the saliency. If it
+    /// or \p non_max_radius is 0, both are computed from the model resolution,
+    /// the average distance of the points to their nearest neighbor.
+    /// \param non_max_radius Radius of the non-maximum suppression.
+    /// \param gamma_21 Upper bound on the ratio between the second and the
+    /// first eigenvalue.
+    /// \param gamma_32 Upper bound on the ratio between the third and the
+    /// second eigenvalue.
+    /// \param min_neighbors Minimum number of neighbors of a keypoint.
+    /// \return Tuple of the keypoints and the Boolean mask of shape {n,} of
+    /// the keypoints.
+    std::tuple<PointCloud, core::Tensor> ComputeISSKeypoints(
+            double salient_radius = 0.0,
+            double non_max_radius = 0.0,
+            double gamma_21 = 0.975,
+            double gamma_32 = 0.975,
+            int min_neighbors = 5) const;
+
+    /// \brief Segments a plane in the point cloud with the RANSAC algorithm.
+    ///
+    /// The hypotheses are scored in batches on the device of the point cloud,
+    /// and the iterations stop early like in the legacy point cloud.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Tuple of the plane model ax + by + cz + d = 0 as a Float64
+    /// tensor of shape {4,} on the CPU, and the Int64 indices of the inliers.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlane(
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Removes the points hidden from \p camera_location, like the
+    /// legacy geometry::PointCloud::HiddenPointRemoval.
+    ///
+    /// The spherical flip of the points runs on the device of the point
+    /// cloud, and the convex hull of the flipped points is computed on the
+    /// CPU.
+    /// \param camera_location Tensor of shape {3,} with the position of the
+    /// camera.
+    /// \param radius Radius of the spherical projection.
+    /// \return Tuple of the mesh of the visible points, on the device of the
+    /// point cloud, and the Int64 indices of the visible points.
+    std::tuple<TriangleMesh, core::Tensor> HiddenPointRemoval(
+            const core::Tensor &camera_location, double radius) const;
+
+    /// \brief Computes the distance from each point to its nearest neighbor
+    /// in the \p target point cloud.
+    ///
+    /// Runs on the device of the point cloud, with a KnnIndex on CUDA.
+    /// \param target The target point cloud, on the same device.
+    /// \return Tensor of shape {n,} with the dtype of the points.
+    core::Tensor ComputePointCloudDistance(const PointCloud &target) const;
+
+    /// \brief Computes the distance from each point to its nearest neighbor
+    /// in this point cloud, the point itself excluded.
+    ///
+    /// \return Tensor of shape {n,} with the dtype of the points. The
+    /// distances are zero if there is a single point.
+    core::Tensor ComputeNearestNeighborDistance() const;
+
+    /// \brief Computes the Hausdorff distance to the \p target point cloud.
+    ///
+    /// \param target The target point cloud, on the same device.
+    /// \param symmetric If false, only the largest distance from this point
+    /// cloud to the target is used.
+    /// \return The largest nearest neighbor distance in either direction.
+    double ComputeHausdorffDistance(const PointCloud &target,
+                                    bool symmetric = true) const;
+
+    /// \brief Computes the Chamfer distance to the \p target point cloud, the
+    /// sum of the mean nearest neighbor distances in both directions.
+    ///
+    /// \param target The target point cloud, on the same device.
+    double ComputeChamferDistance(const PointCloud &target) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -322,6 +587,10 @@ public:
     /// \param depth_max Truncated at \p depth_max distance.
     /// \param stride Sampling factor to support coarse point cloud extraction.
     /// There is no low pass filtering, so aliasing is possible for stride>1.
+    /// \param distortion Brown-Conrady lens distortion coefficients (k1, k2,
+    /// p1, p2, k3) of the camera. Empty for an undistorted image. The
+    /// undistortion map is cached per camera, so it is computed once for a
+    /// stream of frames.
     ///
     /// \return Created pointcloud with the 'points' property set. Thus is empty
     /// if the conversion fails.
@@ -332,7 +601,8 @@ public:
                     4, core::Dtype::Float32, core::Device("CPU:0")),
             float depth_scale = 1000.0f,
             float depth_max = 3.0f,
-            int stride = 1);
+            int stride = 1,
+            const std::vector<double> &distortion = {});
 
     /// \brief Factory function to create a pointcloud from an RGB-D image and a
     /// camera model.
@@ -342,13 +612,19 @@ public:
     /// / fy\n
     ///
     /// \param rgbd_image The input RGBD image should have a uint16_t or float
-    /// depth image and RGB image with any DType and the same size.
+    /// depth image and RGB image with any DType and the same size. UInt8,
+    /// UInt16, Float32 and Float64 colors are converted to Float32 while
+    /// unprojecting.
     /// \param intrinsics Intrinsic parameters of the camera.
     /// \param extrinsics Extrinsic parameters of the camera.
     /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
     /// \param depth_max Truncated at \p depth_max distance.
     /// \param stride Sampling factor to support coarse point cloud extraction.
     /// There is no low pass filtering, so aliasing is possible for stride>1.
+    /// \param distortion Brown-Conrady lens distortion coefficients (k1, k2,
+    /// p1, p2, k3) of the camera. Empty for an undistorted image. The
+    /// undistortion map is cached per camera, so it is computed once for a
+    /// stream of frames.
     ///
     /// \return Created pointcloud with the 'points' and 'colors' properties
     /// set. This is empty if the conversion fails.
@@ -359,16 +635,102 @@ public:
                     4, core::Dtype::Float32, core::Device("CPU:0")),
             float depth_scale = 1000.0f,
             float depth_max = 3.0f,
-            int stride = 1);
+            int stride = 1,
+            const std::vector<double> &distortion = {});
+
+    /// \brief Projects the point cloud into a depth image, the inverse of
+    /// CreateFromDepthImage.
+    ///
+    /// Each pixel holds the depth of the closest point that projects to it,
+    /// or 0 if there is none.
+    ///
+    /// \param width Width of the image.
+    /// \param height Height of the image.
+    /// \param intrinsics Intrinsic parameters of the camera.
+    /// \param extrinsics Extrinsic parameters of the camera.
+    /// \param depth_scale The depth is scaled by \p depth_scale.
+    /// \param depth_max Points at \p depth_max or farther are dropped.
+    ///
+    /// \return Float32 depth image of shape (height, width, 1).
+    Image ProjectToDepthImage(
+            int width,
+            int height,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics = core::Tensor::Eye(
+                    4, core::Dtype::Float32, core::Device("CPU:0")),
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f) const;
+
+    /// \brief Projects the point cloud and its colors into an RGB-D image,
+    /// the inverse of CreateFromRGBDImage. The point cloud must have colors.
+    ///
+    /// \return RGB-D image with a Float32 depth image of shape
+    /// (height, width, 1) and a Float32 color image of shape (height, width,
+    /// 3). UInt8 and UInt16 colors are scaled to [0, 1] like Image::To.
+    RGBDImage ProjectToRGBDImage(
+            int width,
+            int height,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics = core::Tensor::Eye(
+                    4, core::Dtype::Float32, core::Device("CPU:0")),
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f) const;
 
-    /// Create a PointCloud from a legacy Open3D PointCloud.
+    /// \brief Projects the point cloud into the depth images of a batch of
+    /// cameras in a single pass, e.g. for visibility checks.
+    ///
+    /// \param extrinsics Extrinsic parameters of the cameras, of shape
+    /// (B, 4, 4).
+    /// \return B depth images, see ProjectToDepthImage.
+    std::vector<Image> ProjectToDepthImages(int width,
+                                            int height,
+                                            const core::Tensor &intrinsics,
+                                            const core::Tensor &extrinsics,
+                                            float depth_scale = 1000.0f,
+                                            float depth_max = 3.0f) const;
+
+    /// \brief Projects the point cloud and its colors into the RGB-D images of
+    /// a batch of cameras in a single pass, e.g. to render synthetic frames.
+    ///
+    /// \param extrinsics Extrinsic parameters of the cameras, of shape
+    /// (B, 4, 4).
+    /// \return B RGB-D images, see ProjectToRGBDImage.
+    std::vector<RGBDImage> ProjectToRGBDImages(
+            int width,
+            int height,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f) const;
+
+    /// \brief Create a PointCloud from a legacy Open3D PointCloud.
+    ///
+    /// \param pcd_legacy The legacy PointCloud.
+    /// \param dtype The dtype of the attributes.
+    /// \param device The device of the attributes.
+    /// \param copy If false and \p dtype is Float64 on CPU:0, the attributes
+    /// alias the storage of \p pcd_legacy without copying. \p pcd_legacy must
+    /// then outlive the returned PointCloud and must not be resized.
     static PointCloud FromLegacyPointCloud(
             const open3d::geometry::PointCloud &pcd_legacy,
             core::Dtype dtype = core::Dtype::Float32,
+            const core::Device &device = core::Device("CPU:0"),
+            bool copy = true);
+
+    /// \brief Create a PointCloud from a legacy Open3D PointCloud, taking over
+    /// its storage without copying if \p dtype is Float64 on CPU:0.
+    static PointCloud FromLegacyPointCloud(
+            open3d::geometry::PointCloud &&pcd_legacy,
+            core::Dtype dtype = core::Dtype::Float32,
             const core::Device &device = core::Device("CPU:0"));
 
     /// Convert to a legacy Open3D PointCloud.
-    open3d::geometry::PointCloud ToLegacyPointCloud() const;
+    open3d::geometry::PointCloud ToLegacyPointCloud() const &;
+
+    /// \brief Convert to a legacy Open3D PointCloud. Attributes that took over
+    /// the storage of a legacy PointCloud and are not shared with other tensors
+    /// are moved back without copying.
+    open3d::geometry::PointCloud ToLegacyPointCloud() &&;
 
 protected:
     core::Device device_ = core::Device("CPU:0");
@@ -26,10 +26,17 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <cstring>
+#include <functional>
+
 #include "open3d/Open3D.h"
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/Half.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/kernel/TSDFVoxel.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -59,7 +66,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
     int64_t total_bytes = 0;
     if (attr_dtype_map_.count("tsdf") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("tsdf");
-        if (dtype != core::Dtype::Float32) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float16 &&
+            dtype != core::Dtype::Int8 && dtype != core::Dtype::Int16) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected TSDF dtype, please "
                     "implement your own Voxel structure in "
@@ -70,7 +78,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
 
     if (attr_dtype_map_.count("weight") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("weight");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16 &&
+            dtype != core::Dtype::Float16) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected weight dtype, please "
                     "implement your own Voxel structure in "
@@ -82,7 +91,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
 
     if (attr_dtype_map_.count("color") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("color");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16 &&
+            dtype != core::Dtype::Float16 && dtype != core::Dtype::UInt8) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected color dtype, please "
                     "implement your own Voxel structure in "
@@ -92,6 +102,39 @@ TSDFVoxelGrid::TSDFVoxelGrid(
     }
     // Users can add other key/dtype checkers here for potential extensions.
 
+    // Voxel structures are dispatched by byte size, so the half layout must
+    // not be mixed with the others to avoid aliasing their sizes.
+    bool use_half = attr_dtype_map_.at("tsdf") == core::Dtype::Float16;
+    for (const auto &kv : attr_dtype_map_) {
+        if ((kv.second == core::Dtype::Float16) != use_half) {
+            utility::LogError(
+                    "[TSDFVoxelGrid] Float16 attributes cannot be mixed with "
+                    "other dtypes, but tsdf is {} and {} is {}.",
+                    attr_dtype_map_.at("tsdf").ToString(), kv.first,
+                    kv.second.ToString());
+        }
+    }
+
+    // Likewise, quantized tsdf comes with uint16_t weight and uint8_t color
+    // only. The 4-byte layout without color would alias Voxel16f.
+    core::Dtype tsdf_dtype = attr_dtype_map_.at("tsdf");
+    if (tsdf_dtype == core::Dtype::Int8 || tsdf_dtype == core::Dtype::Int16) {
+        bool has_color = attr_dtype_map_.count("color") != 0;
+        if (attr_dtype_map_.at("weight") != core::Dtype::UInt16 ||
+            (has_color && attr_dtype_map_.at("color") != core::Dtype::UInt8) ||
+            (!has_color && tsdf_dtype == core::Dtype::Int16)) {
+            utility::LogError(
+                    "[TSDFVoxelGrid] quantized {} tsdf expects UInt16 weight "
+                    "and UInt8 color (required for Int16).",
+                    tsdf_dtype.ToString());
+        }
+    } else if (attr_dtype_map_.count("color") != 0 &&
+               attr_dtype_map_.at("color") == core::Dtype::UInt8) {
+        utility::LogError(
+                "[TSDFVoxelGrid] UInt8 color expects quantized Int8 or Int16 "
+                "tsdf.");
+    }
+
     // SDF trunc check, critical for TSDF touch operation that allocates TSDF
     // volumes.
     if (sdf_trunc > block_resolution_ * voxel_size_ * 0.499) {
@@ -112,10 +155,12 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                               const core::Tensor &intrinsics,
                               const core::Tensor &extrinsics,
                               float depth_scale,
-                              float depth_max) {
+                              float depth_max,
+                              int64_t stride,
+                              bool visibility_culling) {
     Image empty_color;
     Integrate(depth, empty_color, intrinsics, extrinsics, depth_scale,
-              depth_max);
+              depth_max, stride, visibility_culling);
 }
 
 void TSDFVoxelGrid::Integrate(const Image &depth,
@@ -123,21 +168,39 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                               const core::Tensor &intrinsics,
                               const core::Tensor &extrinsics,
                               float depth_scale,
-                              float depth_max) {
+                              float depth_max,
+                              int64_t stride,
+                              bool visibility_culling) {
+    OPEN3D_CUDA_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::Integrate", device_);
+    core::Tensor block_coords =
+            TouchBlocks(depth, intrinsics, extrinsics, depth_scale, depth_max,
+                        stride, visibility_culling);
+    IntegrateBlocks(block_coords, depth, color, intrinsics, extrinsics,
+                    depth_scale, depth_max);
+}
+
+core::Tensor TSDFVoxelGrid::TouchBlocks(const Image &depth,
+                                        const core::Tensor &intrinsics,
+                                        const core::Tensor &extrinsics,
+                                        float depth_scale,
+                                        float depth_max,
+                                        int64_t stride,
+                                        bool visibility_culling) {
     if (depth.IsEmpty()) {
         utility::LogError(
                 "[TSDFVoxelGrid] input depth is empty for integration.");
     }
+    if (stride <= 0) {
+        utility::LogError(
+                "[TSDFVoxelGrid] stride must be positive, but got {}.",
+                stride);
+    }
 
-    // Create a point cloud from a low-resolution depth input to roughly
-    // estimate surfaces.
-    // TODO(wei): merge CreateFromDepth and Touch in one kernel.
-    int down_factor = 4;
-    PointCloud pcd = PointCloud::CreateFromDepthImage(
-            depth, intrinsics, extrinsics, depth_scale, depth_max, down_factor);
-    int64_t capacity = (depth.GetCols() / down_factor) *
-                       (depth.GetRows() / down_factor) * 8;
-
+    // Unproject a subsampled depth input to roughly estimate surfaces and
+    // collect the unique blocks around them in a single pass. Repeated
+    // blocks of neighboring pixels are dropped before the local hashmap.
+    int64_t capacity =
+            (depth.GetCols() / stride) * (depth.GetRows() / stride) * 8;
     if (point_hashmap_ == nullptr) {
         point_hashmap_ = std::make_shared<core::Hashmap>(
                 capacity, core::Dtype::Int32, core::Dtype::UInt8,
@@ -148,15 +211,33 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     }
 
     core::Tensor block_coords;
-    kernel::tsdf::Touch(point_hashmap_, pcd.GetPoints().Contiguous(),
-                        block_coords, block_resolution_, voxel_size_,
-                        sdf_trunc_);
+    kernel::tsdf::DepthTouch(point_hashmap_, depth.AsTensor().Contiguous(),
+                             intrinsics, extrinsics, block_coords,
+                             block_resolution_, voxel_size_, sdf_trunc_,
+                             depth_scale, depth_max, stride,
+                             visibility_culling);
+    return block_coords;
+}
 
-    // Active voxel blocks in the block hashmap.
+void TSDFVoxelGrid::IntegrateBlocks(const core::Tensor &block_coords,
+                                    const Image &depth,
+                                    const Image &color,
+                                    const core::Tensor &intrinsics,
+                                    const core::Tensor &extrinsics,
+                                    float depth_scale,
+                                    float depth_max) {
+    if (depth.IsEmpty()) {
+        utility::LogError(
+                "[TSDFVoxelGrid] input depth is empty for integration.");
+    }
+
+    // Activate voxel blocks in the block hashmap and collect all the blocks in
+    // the viewing frustum, including the ones activated in previous launches,
+    // in a single pass. New blocks start with zero-initialized voxels.
     core::Tensor addrs, masks;
     int64_t n = block_hashmap_->Size();
     try {
-        block_hashmap_->Activate(block_coords, addrs, masks);
+        block_hashmap_->FindOrInsert(block_coords, addrs, masks);
     } catch (const std::runtime_error &) {
         utility::LogError(
                 "[TSDFIntegrate] Unable to allocate volume during rehashing. "
@@ -167,13 +248,14 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 n, voxel_size_);
     }
 
-    // Collect voxel blocks in the viewing frustum. Note we cannot directly
-    // reuse addrs from Activate, since some blocks might have been activated in
-    // previous launches and return false.
-    // TODO(wei): support one-pass operation ActivateAndFind.
+    // Record the integrated blocks for incremental mesh extraction.
+    if (dirty_block_hashmap_ != nullptr) {
+        core::Tensor dirty_addrs, dirty_masks;
+        dirty_block_hashmap_->Activate(block_coords, dirty_addrs, dirty_masks);
+    }
+
     // TODO(wei): set point_hashmap_[block_coords] = addrs and use the small
     // hashmap for raycasting
-    block_hashmap_->Find(block_coords, addrs, masks);
 
     // TODO(wei): directly reuse it without intermediate variables.
     // Reserved for raycasting
@@ -204,11 +286,31 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     core::Tensor dst = block_hashmap_->GetValueTensor();
 
     // TODO(wei): use a fixed buffer.
-    kernel::tsdf::Integrate(depth_tensor, color_tensor,
-                            addrs.To(core::Dtype::Int64).IndexGet({masks}),
+    core::Tensor block_indices = addrs.To(core::Dtype::Int64);
+
+    // Record the frame the blocks are observed in for EraseStaleBlocks. All
+    // the blocks count as observed when rehashing reassigns the addresses.
+    if (block_last_frame_.GetLength() != block_hashmap_->GetCapacity()) {
+        block_last_frame_ = core::Tensor::Full({block_hashmap_->GetCapacity()},
+                                               frame_count_, core::Dtype::Int64,
+                                               device_);
+    }
+    block_last_frame_.IndexSet(
+            {block_indices},
+            core::Tensor::Full({block_indices.GetLength()}, frame_count_,
+                               core::Dtype::Int64, device_));
+    ++frame_count_;
+    kernel::tsdf::Integrate(depth_tensor, color_tensor, block_indices,
                             block_hashmap_->GetKeyTensor(), dst, intrinsics,
                             extrinsics, block_resolution_, voxel_size_,
                             sdf_trunc_, depth_scale, depth_max);
+
+    if (block_min_tsdf_.GetLength() == block_hashmap_->GetCapacity()) {
+        kernel::tsdf::UpdateBlockMinTSDF(block_indices, dst, block_min_tsdf_,
+                                         block_resolution_);
+    } else {
+        block_min_tsdf_ = core::Tensor();
+    }
 }
 
 std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
@@ -221,6 +323,7 @@ TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
                        float depth_max,
                        float weight_threshold,
                        int ray_cast_mask) {
+    OPEN3D_CUDA_PROFILE_SCOPE("t::geometry::TSDFVoxelGrid::RayCast", device_);
     // Extrinsic: world to camera -> pose: camera to world
     core::Tensor vertex_map, depth_map, color_map, normal_map;
     if (ray_cast_mask & TSDFVoxelGrid::SurfaceMaskCode::VertexMap) {
@@ -248,10 +351,12 @@ TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
                                 depth_min, depth_max);
 
     core::Tensor block_values = block_hashmap_->GetValueTensor();
+    RefreshBlockMinTSDF();
+
     auto device_hashmap = block_hashmap_->GetDeviceHashmap();
     kernel::tsdf::RayCast(device_hashmap, block_values, range_minmax_map,
-                          vertex_map, depth_map, color_map, normal_map,
-                          intrinsics, extrinsics, height, width,
+                          block_min_tsdf_, vertex_map, depth_map, color_map,
+                          normal_map, intrinsics, extrinsics, height, width,
                           block_resolution_, voxel_size_, sdf_trunc_,
                           depth_scale, depth_min, depth_max, weight_threshold);
 
@@ -283,18 +388,15 @@ PointCloud TSDFVoxelGrid::ExtractSurfacePoints(int estimated_number,
 
     core::Tensor active_addrs;
     block_hashmap_->GetActiveIndices(active_addrs);
-    core::Tensor active_nb_addrs, active_nb_masks;
-    std::tie(active_nb_addrs, active_nb_masks) =
-            BufferRadiusNeighbors(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    core::Tensor sorted_addrs = BufferBlockLookup(active_addrs);
 
     // Extract points around zero-crossings.
     core::Tensor points, normals, colors;
 
     kernel::tsdf::ExtractSurfacePoints(
-            active_addrs.To(core::Dtype::Int64),
-            active_nb_addrs.To(core::Dtype::Int64), active_nb_masks,
-            block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
-            points,
+            active_addrs, sorted_addrs, block_hashmap_->GetKeyTensor(),
+            block_hashmap_->GetValueTensor(), points,
             surface_mask & SurfaceMaskCode::NormalMap
                     ? utility::optional<std::reference_wrapper<core::Tensor>>(
                               normals)
@@ -317,12 +419,12 @@ PointCloud TSDFVoxelGrid::ExtractSurfacePoints(int estimated_number,
 }
 
 TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(float weight_threshold) {
-    // Query active blocks and their nearest neighbors to handle boundary cases.
+    // Query active blocks and a lookup of their neighbors to handle boundary
+    // cases.
     core::Tensor active_addrs;
     block_hashmap_->GetActiveIndices(active_addrs);
-    core::Tensor active_nb_addrs, active_nb_masks;
-    std::tie(active_nb_addrs, active_nb_masks) =
-            BufferRadiusNeighbors(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    core::Tensor sorted_addrs = BufferBlockLookup(active_addrs);
 
     // Map active indices to [0, num_blocks] to be allocated for surface mesh.
     int64_t num_blocks = block_hashmap_->Size();
@@ -331,16 +433,16 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(float weight_threshold) {
     std::vector<int64_t> iota_map(num_blocks);
     std::iota(iota_map.begin(), iota_map.end(), 0);
     inverse_index_map.IndexSet(
-            {active_addrs.To(core::Dtype::Int64)},
+            {active_addrs},
             core::Tensor(iota_map, {num_blocks}, core::Dtype::Int64, device_));
 
     core::Tensor vertices, triangles, vertex_normals, vertex_colors;
     kernel::tsdf::ExtractSurfaceMesh(
-            active_addrs.To(core::Dtype::Int64), inverse_index_map,
-            active_nb_addrs.To(core::Dtype::Int64), active_nb_masks,
+            active_addrs, inverse_index_map, sorted_addrs,
             block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
             vertices, triangles, vertex_normals, vertex_colors,
-            block_resolution_, voxel_size_, weight_threshold);
+            block_resolution_, voxel_size_, weight_threshold, utility::nullopt,
+            utility::nullopt);
 
     TriangleMesh mesh(vertices, triangles);
     mesh.SetVertexNormals(vertex_normals);
@@ -350,6 +452,321 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(float weight_threshold) {
     return mesh;
 }
 
+/// Return the unique keys of \p block_keys shifted by the offsets in
+/// {0, direction}^3, i.e. the blocks and their neighbors in one direction.
+static core::Tensor GetUniqueNeighborBlockKeys(const core::Tensor &block_keys,
+                                               int direction) {
+    core::Device device = block_keys.GetDevice();
+    int64_t n = block_keys.GetLength();
+    std::vector<int> offsets;
+    for (int dx = 0; dx <= 1; ++dx) {
+        for (int dy = 0; dy <= 1; ++dy) {
+            for (int dz = 0; dz <= 1; ++dz) {
+                offsets.insert(offsets.end(), {dx * direction, dy * direction,
+                                               dz * direction});
+            }
+        }
+    }
+    core::Tensor neighbor_keys =
+            block_keys.Reshape({n, 1, 3})
+                    .Add(core::Tensor(offsets, {1, 8, 3}, core::Dtype::Int32,
+                                      device))
+                    .Reshape({n * 8, 3});
+
+    core::Hashmap unique_set(n * 8, core::Dtype::Int32, core::Dtype::UInt8,
+                             core::SizeVector{3}, core::SizeVector{1}, device);
+    core::Tensor addrs, masks;
+    unique_set.Activate(neighbor_keys, addrs, masks);
+    return neighbor_keys.IndexGet({masks});
+}
+
+TSDFVoxelGrid::SurfaceMeshUpdate TSDFVoxelGrid::ExtractSurfaceMeshUpdate(
+        float weight_threshold) {
+    SurfaceMeshUpdate update;
+
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+
+    // Blocks to mesh again: the integrated blocks, and their neighbors in
+    // the negative directions whose cubes reach into them.
+    core::Tensor candidate_keys;
+    if (dirty_block_hashmap_ == nullptr ||
+        weight_threshold != block_mesh_cache_weight_threshold_) {
+        candidate_keys =
+                block_hashmap_->GetKeyTensor().IndexGet({active_addrs});
+        if (dirty_block_hashmap_ == nullptr) {
+            dirty_block_hashmap_ = std::make_shared<core::Hashmap>(
+                    block_hashmap_->GetCapacity(), core::Dtype::Int32,
+                    core::Dtype::UInt8, core::SizeVector{3},
+                    core::SizeVector{1}, device_);
+        }
+        block_mesh_cache_weight_threshold_ = weight_threshold;
+    } else if (dirty_block_hashmap_->Size() > 0) {
+        core::Tensor dirty_addrs;
+        dirty_block_hashmap_->GetActiveIndices(dirty_addrs);
+        candidate_keys = GetUniqueNeighborBlockKeys(
+                dirty_block_hashmap_->GetKeyTensor().IndexGet(
+                        {dirty_addrs.To(core::Dtype::Int64)}),
+                -1);
+    }
+    dirty_block_hashmap_->Clear();
+    if (candidate_keys.NumElements() == 0) {
+        return update;
+    }
+
+    core::Tensor addrs, masks;
+    block_hashmap_->Find(candidate_keys, addrs, masks);
+
+    // Pruned blocks are gone along with their meshes.
+    static const core::Device host("CPU:0");
+    core::Tensor missing_keys =
+            candidate_keys.IndexGet({masks.LogicalNot()}).To(host).Contiguous();
+    const int *missing_keys_ptr = missing_keys.GetDataPtr<int>();
+    for (int64_t i = 0; i < missing_keys.GetLength(); ++i) {
+        Eigen::Vector3i key(missing_keys_ptr[3 * i + 0],
+                            missing_keys_ptr[3 * i + 1],
+                            missing_keys_ptr[3 * i + 2]);
+        if (block_mesh_cache_.erase(key) > 0) {
+            update.removed_blocks_.push_back(key);
+        }
+    }
+
+    core::Tensor remesh_keys = candidate_keys.IndexGet({masks});
+    if (remesh_keys.GetLength() == 0) {
+        return update;
+    }
+
+    // Blocks holding the vertices of the blocks to mesh: themselves and their
+    // neighbors in the positive directions. Only the former emit triangles.
+    core::Tensor support_keys = GetUniqueNeighborBlockKeys(remesh_keys, 1);
+    block_hashmap_->Find(support_keys, addrs, masks);
+    support_keys = support_keys.IndexGet({masks});
+    core::Tensor support_addrs =
+            addrs.IndexGet({masks}).To(core::Dtype::Int64);
+    int64_t n_support = support_keys.GetLength();
+
+    core::Hashmap remesh_set(remesh_keys.GetLength(), core::Dtype::Int32,
+                             core::Dtype::UInt8, core::SizeVector{3},
+                             core::SizeVector{1}, device_);
+    remesh_set.Activate(remesh_keys, addrs, masks);
+    core::Tensor remesh_mask;
+    remesh_set.Find(support_keys, addrs, remesh_mask);
+
+    core::Tensor sorted_addrs = BufferBlockLookup(active_addrs);
+    core::Tensor inverse_index_map({block_hashmap_->GetCapacity()},
+                                   core::Dtype::Int64, device_);
+    inverse_index_map.IndexSet(
+            {support_addrs},
+            core::Tensor::Arange(0, n_support, 1, core::Dtype::Int64, device_));
+
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors,
+            triangle_blocks;
+    kernel::tsdf::ExtractSurfaceMesh(
+            support_addrs, inverse_index_map, sorted_addrs,
+            block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
+            vertices, triangles, vertex_normals, vertex_colors,
+            block_resolution_, voxel_size_, weight_threshold,
+            utility::optional<std::reference_wrapper<const core::Tensor>>(
+                    remesh_mask),
+            utility::optional<std::reference_wrapper<core::Tensor>>(
+                    triangle_blocks));
+
+    // Split the mesh per block on CPU, with local vertex indices.
+    vertices = vertices.To(host);
+    vertex_normals = vertex_normals.To(host);
+    bool has_colors = vertex_colors.NumElements() != 0;
+    if (has_colors) {
+        vertex_colors = vertex_colors.To(host);
+    }
+    core::Tensor triangles_cpu = triangles.To(host).Contiguous();
+    core::Tensor triangle_blocks_cpu = triangle_blocks.To(host).Contiguous();
+    core::Tensor support_keys_cpu = support_keys.To(host).Contiguous();
+    core::Tensor remesh_mask_cpu = remesh_mask.To(host).Contiguous();
+
+    const int64_t *triangles_ptr = triangles_cpu.GetDataPtr<int64_t>();
+    const int64_t *triangle_blocks_ptr =
+            triangle_blocks_cpu.GetDataPtr<int64_t>();
+    const int *support_keys_ptr = support_keys_cpu.GetDataPtr<int>();
+    const bool *remesh_mask_ptr = remesh_mask_cpu.GetDataPtr<bool>();
+
+    std::vector<std::vector<int64_t>> block_triangles(n_support);
+    for (int64_t i = 0; i < triangles_cpu.GetLength(); ++i) {
+        block_triangles[triangle_blocks_ptr[i]].push_back(i);
+    }
+
+    std::vector<int64_t> local_index(vertices.GetLength(), -1);
+    for (int64_t b = 0; b < n_support; ++b) {
+        if (!remesh_mask_ptr[b]) {
+            continue;
+        }
+        Eigen::Vector3i key(support_keys_ptr[3 * b + 0],
+                            support_keys_ptr[3 * b + 1],
+                            support_keys_ptr[3 * b + 2]);
+        if (block_triangles[b].empty()) {
+            if (block_mesh_cache_.erase(key) > 0) {
+                update.removed_blocks_.push_back(key);
+            }
+            continue;
+        }
+
+        std::vector<int64_t> block_vertices;
+        std::vector<int64_t> block_triangle_indices;
+        for (int64_t tri : block_triangles[b]) {
+            for (int k = 0; k < 3; ++k) {
+                int64_t v = triangles_ptr[3 * tri + k];
+                if (local_index[v] < 0) {
+                    local_index[v] = block_vertices.size();
+                    block_vertices.push_back(v);
+                }
+                block_triangle_indices.push_back(local_index[v]);
+            }
+        }
+        for (int64_t v : block_vertices) {
+            local_index[v] = -1;
+        }
+
+        int64_t n_block_vertices = block_vertices.size();
+        core::Tensor gather(block_vertices, {n_block_vertices},
+                            core::Dtype::Int64);
+        TriangleMesh mesh(vertices.IndexGet({gather}),
+                          core::Tensor(block_triangle_indices,
+                                       {int64_t(block_triangles[b].size()), 3},
+                                       core::Dtype::Int64));
+        mesh.SetVertexNormals(vertex_normals.IndexGet({gather}));
+        if (has_colors) {
+            mesh.SetVertexColors(vertex_colors.IndexGet({gather}));
+        }
+
+        block_mesh_cache_[key] = mesh;
+        update.updated_blocks_.push_back(key);
+        update.updated_meshes_.push_back(mesh);
+    }
+    return update;
+}
+
+TriangleMesh TSDFVoxelGrid::GetCachedSurfaceMesh() const {
+    std::vector<float> vertices, normals, colors;
+    std::vector<int64_t> triangles;
+    bool has_colors = !block_mesh_cache_.empty() &&
+                      block_mesh_cache_.begin()->second.HasVertexColors();
+    for (const auto &kv : block_mesh_cache_) {
+        const TriangleMesh &mesh = kv.second;
+        int64_t offset = vertices.size() / 3;
+        auto append = [](std::vector<float> &dst, const core::Tensor &src) {
+            core::Tensor src_contiguous = src.Contiguous();
+            const float *ptr = src_contiguous.GetDataPtr<float>();
+            dst.insert(dst.end(), ptr, ptr + src_contiguous.NumElements());
+        };
+        append(vertices, mesh.GetVertices());
+        append(normals, mesh.GetVertexNormals());
+        if (has_colors) {
+            append(colors, mesh.GetVertexColors());
+        }
+        core::Tensor mesh_triangles = mesh.GetTriangles().Contiguous();
+        const int64_t *ptr = mesh_triangles.GetDataPtr<int64_t>();
+        for (int64_t i = 0; i < mesh_triangles.NumElements(); ++i) {
+            triangles.push_back(ptr[i] + offset);
+        }
+    }
+
+    int64_t n_vertices = vertices.size() / 3;
+    TriangleMesh mesh(
+            core::Tensor(vertices, {n_vertices, 3}, core::Dtype::Float32),
+            core::Tensor(triangles, {int64_t(triangles.size() / 3), 3},
+                         core::Dtype::Int64));
+    mesh.SetVertexNormals(
+            core::Tensor(normals, {n_vertices, 3}, core::Dtype::Float32));
+    if (has_colors) {
+        mesh.SetVertexColors(
+                core::Tensor(colors, {n_vertices, 3}, core::Dtype::Float32));
+    }
+    return mesh;
+}
+
+int64_t TSDFVoxelGrid::PruneTruncatedBlocks() {
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    if (active_addrs.GetLength() == 0) {
+        return 0;
+    }
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+
+    // Integration clamps the tsdf to 1 beyond the truncation in front of the
+    // surface. Allow for the rounding of the running average.
+    RefreshBlockMinTSDF();
+    core::Tensor prune_mask =
+            block_min_tsdf_.IndexGet({active_addrs}).Ge(1.0f - 1e-4f);
+    core::Tensor prune_keys = block_hashmap_->GetKeyTensor().IndexGet(
+            {active_addrs.IndexGet({prune_mask})});
+    int64_t n = prune_keys.GetLength();
+    if (n == 0) {
+        return 0;
+    }
+
+    EraseBlocks(prune_keys);
+    return n;
+}
+
+void TSDFVoxelGrid::DecayWeights(float decay) {
+    if (decay <= 0 || decay > 1) {
+        utility::LogError(
+                "[TSDFVoxelGrid] decay must be in (0, 1], but got {}.", decay);
+    }
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    if (active_addrs.GetLength() == 0 || decay == 1) {
+        return;
+    }
+
+    core::Tensor block_values = block_hashmap_->GetValueTensor();
+    core::Tensor block_max_weight;
+    kernel::tsdf::DecayBlockWeights(active_addrs.To(core::Dtype::Int64),
+                                    block_values, block_max_weight, decay,
+                                    block_resolution_);
+
+    // Voxels may turn unobserved, and surfaces fall below the weight
+    // threshold of the cached meshes.
+    block_min_tsdf_ = core::Tensor();
+    if (dirty_block_hashmap_ != nullptr) {
+        core::Tensor dirty_addrs, dirty_masks;
+        dirty_block_hashmap_->Activate(
+                block_hashmap_->GetKeyTensor().IndexGet(
+                        {active_addrs.To(core::Dtype::Int64)}),
+                dirty_addrs, dirty_masks);
+    }
+}
+
+int64_t TSDFVoxelGrid::EraseStaleBlocks(float weight_threshold,
+                                        int64_t max_unobserved_frames) {
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    if (active_addrs.GetLength() == 0) {
+        return 0;
+    }
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+
+    core::Tensor block_values = block_hashmap_->GetValueTensor();
+    core::Tensor block_max_weight;
+    kernel::tsdf::DecayBlockWeights(active_addrs, block_values,
+                                    block_max_weight, 1.0f, block_resolution_);
+    core::Tensor erase_mask = block_max_weight.Lt(weight_threshold);
+    if (max_unobserved_frames >= 0 &&
+        block_last_frame_.GetLength() == block_hashmap_->GetCapacity()) {
+        erase_mask = erase_mask.LogicalOr(
+                block_last_frame_.IndexGet({active_addrs})
+                        .Lt(frame_count_ - max_unobserved_frames));
+    }
+
+    core::Tensor erase_keys = block_hashmap_->GetKeyTensor().IndexGet(
+            {active_addrs.IndexGet({erase_mask})});
+    int64_t n = erase_keys.GetLength();
+    if (n > 0) {
+        EraseBlocks(erase_keys);
+    }
+    return n;
+}
+
 TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
@@ -359,36 +776,682 @@ TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
                                         sdf_trunc_, block_resolution_,
                                         block_count_, device);
     auto device_tsdf_hashmap = device_tsdf_voxelgrid.block_hashmap_;
-    *device_tsdf_hashmap = block_hashmap_->To(device);
+    *device_tsdf_hashmap = block_hashmap_->To(device, /*copy=*/true);
+    device_tsdf_voxelgrid.frame_count_ = frame_count_;
+    if (block_last_frame_.GetLength() == block_hashmap_->GetCapacity()) {
+        device_tsdf_voxelgrid.block_last_frame_ =
+                block_last_frame_.To(device, /*copy=*/true);
+    }
     return device_tsdf_voxelgrid;
 }
 
-std::pair<core::Tensor, core::Tensor> TSDFVoxelGrid::BufferRadiusNeighbors(
+/// Binary layout written by TSDFVoxelGrid::Save:
+/// - magic "O3DTSDF\0" and format version (uint32)
+/// - voxel size and sdf trunc (float), block resolution (int64)
+/// - names of the tsdf, weight and color dtypes (16 chars each, color empty
+///   if absent)
+/// - number of blocks N (int64), N keys (int32 x 3) and N packed blocks
+static const char kTSDFFileMagic[8] = "O3DTSDF";
+static constexpr uint32_t kTSDFFileVersion = 1;
+static constexpr size_t kDtypeNameLength = 16;
+
+/// Byte offsets of the voxel attributes, packed in the order of the
+/// TSDFVoxelGrid constructor.
+struct VoxelLayout {
+    core::Dtype tsdf_dtype;
+    core::Dtype weight_dtype;
+    core::Dtype color_dtype;
+    bool has_color;
+    int64_t weight_offset;
+    int64_t color_offset;
+    int64_t byte_size;
+};
+
+static VoxelLayout GetVoxelLayout(
+        const std::unordered_map<std::string, core::Dtype> &attr_dtype_map) {
+    VoxelLayout layout{attr_dtype_map.at("tsdf"), attr_dtype_map.at("weight"),
+                       core::Dtype::Float32, false, 0, 0, 0};
+    layout.has_color = attr_dtype_map.count("color") != 0;
+    if (layout.has_color) {
+        layout.color_dtype = attr_dtype_map.at("color");
+    }
+    layout.weight_offset = layout.tsdf_dtype.ByteSize();
+    layout.color_offset = layout.weight_offset + layout.weight_dtype.ByteSize();
+    layout.byte_size =
+            layout.color_offset +
+            (layout.has_color ? 3 * layout.color_dtype.ByteSize() : 0);
+    return layout;
+}
+
+static void WriteVoxelAttr(const core::Dtype &dtype,
+                           float value,
+                           uint8_t *dst) {
+    if (dtype == core::Dtype::Float32) {
+        std::memcpy(dst, &value, sizeof(float));
+    } else if (dtype == core::Dtype::UInt16) {
+        uint16_t v = static_cast<uint16_t>(
+                std::round(std::min(std::max(value, 0.0f), 65535.0f)));
+        std::memcpy(dst, &v, sizeof(uint16_t));
+    } else if (dtype == core::Dtype::Float16) {
+        core::Half v(value);
+        std::memcpy(dst, &v, sizeof(core::Half));
+    } else if (dtype == core::Dtype::UInt8) {
+        *dst = static_cast<uint8_t>(
+                std::round(std::min(std::max(value, 0.0f), 255.0f)));
+    } else if (dtype == core::Dtype::Int8) {
+        *reinterpret_cast<int8_t *>(dst) = static_cast<int8_t>(
+                std::round(std::min(std::max(value, -127.0f), 127.0f)));
+    } else if (dtype == core::Dtype::Int16) {
+        int16_t v = static_cast<int16_t>(
+                std::round(std::min(std::max(value, -32767.0f), 32767.0f)));
+        std::memcpy(dst, &v, sizeof(int16_t));
+    } else {
+        utility::LogError("[TSDFVoxelGrid] Unsupported voxel dtype {}.",
+                          dtype.ToString());
+    }
+}
+
+static float ReadVoxelAttr(const core::Dtype &dtype, const uint8_t *src) {
+    if (dtype == core::Dtype::Float32) {
+        float v;
+        std::memcpy(&v, src, sizeof(float));
+        return v;
+    } else if (dtype == core::Dtype::UInt16) {
+        uint16_t v;
+        std::memcpy(&v, src, sizeof(uint16_t));
+        return static_cast<float>(v);
+    } else if (dtype == core::Dtype::Float16) {
+        core::Half v;
+        std::memcpy(&v, src, sizeof(core::Half));
+        return static_cast<float>(v);
+    } else if (dtype == core::Dtype::UInt8) {
+        return static_cast<float>(*src);
+    } else if (dtype == core::Dtype::Int8) {
+        return static_cast<float>(*reinterpret_cast<const int8_t *>(src));
+    } else if (dtype == core::Dtype::Int16) {
+        int16_t v;
+        std::memcpy(&v, src, sizeof(int16_t));
+        return static_cast<float>(v);
+    } else {
+        utility::LogError("[TSDFVoxelGrid] Unsupported voxel dtype {}.",
+                          dtype.ToString());
+    }
+    return 0;
+}
+
+/// Scale of quantized tsdf, see Voxel8q and ColoredVoxel16q.
+static float GetTSDFScale(const core::Dtype &dtype) {
+    if (dtype == core::Dtype::Int8) {
+        return kernel::tsdf::Voxel8q::kTSDFScale;
+    } else if (dtype == core::Dtype::Int16) {
+        return kernel::tsdf::ColoredVoxel16q::kTSDFScale;
+    }
+    return 1.0f;
+}
+
+/// Voxel values exchanged with legacy volumes, with colors in [0, 255].
+struct VoxelSample {
+    float tsdf;
+    float weight;
+    float r;
+    float g;
+    float b;
+};
+
+static void WriteVoxel(const VoxelLayout &layout,
+                       const VoxelSample &sample,
+                       uint8_t *dst) {
+    float weight = sample.weight;
+    if (layout.weight_dtype == core::Dtype::Float16) {
+        weight = std::min(weight, kernel::tsdf::Voxel16f::kMaxWeight);
+    }
+    WriteVoxelAttr(layout.tsdf_dtype,
+                   sample.tsdf * GetTSDFScale(layout.tsdf_dtype), dst);
+    WriteVoxelAttr(layout.weight_dtype, weight, dst + layout.weight_offset);
+    if (layout.has_color) {
+        // uint16_t colors are stored scaled, see ColoredVoxel16i.
+        float factor = layout.color_dtype == core::Dtype::UInt16
+                               ? kernel::tsdf::ColoredVoxel16i::kColorFactor
+                               : 1.0f;
+        int64_t color_size = layout.color_dtype.ByteSize();
+        uint8_t *color_ptr = dst + layout.color_offset;
+        WriteVoxelAttr(layout.color_dtype, sample.r * factor, color_ptr);
+        WriteVoxelAttr(layout.color_dtype, sample.g * factor,
+                       color_ptr + color_size);
+        WriteVoxelAttr(layout.color_dtype, sample.b * factor,
+                       color_ptr + 2 * color_size);
+    }
+}
+
+static VoxelSample ReadVoxel(const VoxelLayout &layout, const uint8_t *src) {
+    VoxelSample sample{ReadVoxelAttr(layout.tsdf_dtype, src) /
+                               GetTSDFScale(layout.tsdf_dtype),
+                       ReadVoxelAttr(layout.weight_dtype,
+                                     src + layout.weight_offset),
+                       0, 0, 0};
+    if (layout.has_color) {
+        float factor = layout.color_dtype == core::Dtype::UInt16
+                               ? kernel::tsdf::ColoredVoxel16i::kColorFactor
+                               : 1.0f;
+        int64_t color_size = layout.color_dtype.ByteSize();
+        const uint8_t *color_ptr = src + layout.color_offset;
+        sample.r = ReadVoxelAttr(layout.color_dtype, color_ptr) / factor;
+        sample.g = ReadVoxelAttr(layout.color_dtype, color_ptr + color_size) /
+                   factor;
+        sample.b = ReadVoxelAttr(layout.color_dtype,
+                                 color_ptr + 2 * color_size) /
+                   factor;
+    }
+    return sample;
+}
+
+/// Returns the source voxel at an integer voxel index, or false if it is not
+/// allocated.
+using VoxelSampler =
+        std::function<bool(const Eigen::Vector3i &, VoxelSample &)>;
+
+/// Trilinearly interpolate the observed source voxels at the source voxel
+/// coordinate k + shift of the target voxel k, weighting them by their
+/// weights. Returns false if no observed source voxel contributes.
+static bool InterpolateVoxel(const VoxelSampler &sampler,
+                             const Eigen::Vector3i &k,
+                             const Eigen::Vector3d &shift,
+                             VoxelSample &sample) {
+    Eigen::Vector3d c = k.cast<double>() + shift;
+    Eigen::Vector3d c0 = c.array().floor();
+    Eigen::Vector3i j0 = c0.cast<int>();
+    Eigen::Vector3d f = c - c0;
+
+    double sum_weight = 0, tsdf = 0, r = 0, g = 0, b = 0;
+    for (int i = 0; i < 8; ++i) {
+        Eigen::Vector3i d(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+        double ratio = (d(0) ? f(0) : 1 - f(0)) * (d(1) ? f(1) : 1 - f(1)) *
+                       (d(2) ? f(2) : 1 - f(2));
+        VoxelSample s;
+        if (ratio == 0 || !sampler(j0 + d, s) || s.weight <= 0) continue;
+
+        double w = ratio * s.weight;
+        sum_weight += w;
+        tsdf += w * s.tsdf;
+        r += w * s.r;
+        g += w * s.g;
+        b += w * s.b;
+    }
+    if (sum_weight <= 0) return false;
+
+    sample = VoxelSample{float(tsdf / sum_weight), float(sum_weight),
+                         float(r / sum_weight), float(g / sum_weight),
+                         float(b / sum_weight)};
+    return true;
+}
+
+static VoxelSample ToVoxelSample(
+        const open3d::geometry::TSDFVoxel &voxel,
+        open3d::pipelines::integration::TSDFVolumeColorType color_type) {
+    using open3d::pipelines::integration::TSDFVolumeColorType;
+    VoxelSample sample{float(voxel.tsdf_), float(voxel.weight_), 0, 0, 0};
+    if (color_type != TSDFVolumeColorType::NoColor) {
+        // Gray32 intensities in [0, 1] are replicated to RGB.
+        double factor = color_type == TSDFVolumeColorType::Gray32 ? 255.0 : 1.0;
+        sample.r = float(voxel.color_(0) * factor);
+        sample.g = float(voxel.color_(1) * factor);
+        sample.b = float(voxel.color_(2) * factor);
+    }
+    return sample;
+}
+
+static int FloorDiv(int a, int b) {
+    return a >= 0 ? a / b : -((-a - 1) / b) - 1;
+}
+
+/// Interpolate the voxels of the candidate blocks from the source voxels, and
+/// pack the blocks with observed voxels into keys and values of the block
+/// hashmap on CPU.
+static void PackInterpolatedBlocks(
+        const std::vector<Eigen::Vector3i> &candidate_keys,
+        int64_t resolution,
+        const Eigen::Vector3d &shift,
+        const VoxelSampler &sampler,
+        const VoxelLayout &layout,
+        core::Tensor &keys,
+        core::Tensor &values) {
+    int64_t n = candidate_keys.size();
+    int64_t resolution3 = resolution * resolution * resolution;
+    int64_t block_bytes = resolution3 * layout.byte_size;
+
+    std::vector<uint8_t> buffer(n * block_bytes, 0);
+    std::vector<uint8_t> observed(n, 0);
+    utility::ParallelFor(0, n, [&](int64_t i) {
+        uint8_t *block_ptr = buffer.data() + i * block_bytes;
+        Eigen::Vector3i base = candidate_keys[i] * int(resolution);
+        for (int64_t v = 0; v < resolution3; ++v) {
+            // Same voxel order as NDArrayIndexer in the kernels.
+            Eigen::Vector3i k = base + Eigen::Vector3i(
+                                               int(v % resolution),
+                                               int(v / resolution % resolution),
+                                               int(v / (resolution *
+                                                        resolution)));
+            VoxelSample sample;
+            if (InterpolateVoxel(sampler, k, shift, sample)) {
+                WriteVoxel(layout, sample, block_ptr + v * layout.byte_size);
+                observed[i] = 1;
+            }
+        }
+    });
+
+    std::vector<int> key_data;
+    int64_t count = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        if (!observed[i]) continue;
+        key_data.insert(key_data.end(), candidate_keys[i].data(),
+                        candidate_keys[i].data() + 3);
+        if (count != i) {
+            std::memcpy(buffer.data() + count * block_bytes,
+                        buffer.data() + i * block_bytes, block_bytes);
+        }
+        ++count;
+    }
+
+    keys = core::Tensor(key_data, {count, 3}, core::Dtype::Int32);
+    values = core::Tensor({count, resolution, resolution, resolution,
+                           layout.byte_size},
+                          core::Dtype::UInt8);
+    std::memcpy(values.GetDataPtr(), buffer.data(), count * block_bytes);
+}
+
+void TSDFVoxelGrid::Save(const std::string &file_name) const {
+    static const core::Device host("CPU:0");
+
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+    core::Tensor keys = block_hashmap_->GetKeyTensor()
+                                .IndexGet({active_indices})
+                                .To(host)
+                                .Contiguous();
+    core::Tensor values = block_hashmap_->GetValueTensor()
+                                  .IndexGet({active_indices})
+                                  .To(host)
+                                  .Contiguous();
+    int64_t count = keys.GetLength();
+
+    FILE *fp = fopen(file_name.c_str(), "wb");
+    if (!fp) {
+        utility::LogError("[TSDFVoxelGrid] Unable to open file {}.",
+                          file_name);
+    }
+    auto write = [&](const void *data, size_t num_bytes) {
+        if (num_bytes > 0 && fwrite(data, 1, num_bytes, fp) != num_bytes) {
+            fclose(fp);
+            utility::LogError("[TSDFVoxelGrid] Failed to write file {}.",
+                              file_name);
+        }
+    };
+    auto write_dtype = [&](const std::string &attr) {
+        char name[kDtypeNameLength] = {0};
+        if (attr_dtype_map_.count(attr) != 0) {
+            std::strncpy(name, attr_dtype_map_.at(attr).ToString().c_str(),
+                         kDtypeNameLength - 1);
+        }
+        write(name, kDtypeNameLength);
+    };
+
+    write(kTSDFFileMagic, sizeof(kTSDFFileMagic));
+    write(&kTSDFFileVersion, sizeof(kTSDFFileVersion));
+    write(&voxel_size_, sizeof(voxel_size_));
+    write(&sdf_trunc_, sizeof(sdf_trunc_));
+    write(&block_resolution_, sizeof(block_resolution_));
+    write_dtype("tsdf");
+    write_dtype("weight");
+    write_dtype("color");
+    write(&count, sizeof(count));
+    if (count > 0) {
+        write(keys.GetDataPtr(), keys.NumElements() * sizeof(int));
+        write(values.GetDataPtr(), values.NumElements());
+    }
+
+    if (fclose(fp) != 0) {
+        utility::LogError("[TSDFVoxelGrid] Failed to write file {}.",
+                          file_name);
+    }
+}
+
+TSDFVoxelGrid TSDFVoxelGrid::Load(const std::string &file_name,
+                                  const core::Device &device,
+                                  const core::HashmapBackend &backend) {
+    FILE *fp = fopen(file_name.c_str(), "rb");
+    if (!fp) {
+        utility::LogError("[TSDFVoxelGrid] Unable to open file {}.",
+                          file_name);
+    }
+    auto read = [&](void *data, size_t num_bytes) {
+        if (num_bytes > 0 && fread(data, 1, num_bytes, fp) != num_bytes) {
+            fclose(fp);
+            utility::LogError("[TSDFVoxelGrid] File {} is truncated.",
+                              file_name);
+        }
+    };
+
+    char magic[sizeof(kTSDFFileMagic)];
+    uint32_t version;
+    read(magic, sizeof(magic));
+    read(&version, sizeof(version));
+    if (std::memcmp(magic, kTSDFFileMagic, sizeof(magic)) != 0 ||
+        version != kTSDFFileVersion) {
+        fclose(fp);
+        utility::LogError(
+                "[TSDFVoxelGrid] {} is not a TSDFVoxelGrid file of version "
+                "{}.",
+                file_name, kTSDFFileVersion);
+    }
+
+    float voxel_size, sdf_trunc;
+    int64_t block_resolution;
+    read(&voxel_size, sizeof(voxel_size));
+    read(&sdf_trunc, sizeof(sdf_trunc));
+    read(&block_resolution, sizeof(block_resolution));
+
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map;
+    for (const std::string attr : {"tsdf", "weight", "color"}) {
+        char name[kDtypeNameLength];
+        read(name, kDtypeNameLength);
+        name[kDtypeNameLength - 1] = '\0';
+        std::string dtype_name(name);
+        if (dtype_name.empty()) continue;
+        bool found = false;
+        for (const core::Dtype &dtype :
+             {core::Dtype::Float32, core::Dtype::UInt16, core::Dtype::Float16,
+              core::Dtype::Int8, core::Dtype::Int16, core::Dtype::UInt8}) {
+            if (dtype.ToString() == dtype_name) {
+                attr_dtype_map.emplace(attr, dtype);
+                found = true;
+            }
+        }
+        if (!found) {
+            fclose(fp);
+            utility::LogError("[TSDFVoxelGrid] File {} has unsupported {} "
+                              "dtype {}.",
+                              file_name, attr, dtype_name);
+        }
+    }
+
+    int64_t count;
+    read(&count, sizeof(count));
+    if (count < 0 || block_resolution <= 0 ||
+        attr_dtype_map.count("tsdf") == 0 ||
+        attr_dtype_map.count("weight") == 0) {
+        fclose(fp);
+        utility::LogError("[TSDFVoxelGrid] File {} is corrupted.", file_name);
+    }
+
+    VoxelLayout layout = GetVoxelLayout(attr_dtype_map);
+    core::Tensor keys({count, 3}, core::Dtype::Int32);
+    core::Tensor values({count, block_resolution, block_resolution,
+                         block_resolution, layout.byte_size},
+                        core::Dtype::UInt8);
+    read(keys.GetDataPtr(), keys.NumElements() * sizeof(int));
+    read(values.GetDataPtr(), values.NumElements());
+    fclose(fp);
+
+    TSDFVoxelGrid voxel_grid(attr_dtype_map, voxel_size, sdf_trunc,
+                             block_resolution, std::max<int64_t>(count, 1000),
+                             device, backend);
+    if (count > 0) {
+        core::Tensor addrs, masks;
+        voxel_grid.block_hashmap_->Insert(keys.To(device), values.To(device),
+                                          addrs, masks);
+    }
+    return voxel_grid;
+}
+
+TSDFVoxelGrid TSDFVoxelGrid::FromLegacyTSDFVolume(
+        const open3d::pipelines::integration::ScalableTSDFVolume &volume,
+        const std::unordered_map<std::string, core::Dtype> &attr_dtype_map,
+        const core::Device &device) {
+    using open3d::pipelines::integration::TSDFVolumeColorType;
+    int resolution = volume.volume_unit_resolution_;
+
+    // A legacy voxel j is centered at (j + 0.5) * voxel_length, and
+    // contributes to the voxels j and j + 1 of TSDFVoxelGrid. The latter may
+    // fall into the next block.
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            candidate_set;
+    for (const auto &unit : volume.volume_units_) {
+        for (int i = 0; i < 8; ++i) {
+            candidate_set.insert(unit.first + Eigen::Vector3i(i & 1,
+                                                              (i >> 1) & 1,
+                                                              (i >> 2) & 1));
+        }
+    }
+    std::vector<Eigen::Vector3i> candidate_keys(candidate_set.begin(),
+                                                candidate_set.end());
+
+    TSDFVolumeColorType color_type = volume.color_type_;
+    VoxelSampler sampler = [&](const Eigen::Vector3i &j, VoxelSample &s) {
+        Eigen::Vector3i unit_index(FloorDiv(j(0), resolution),
+                                   FloorDiv(j(1), resolution),
+                                   FloorDiv(j(2), resolution));
+        auto it = volume.volume_units_.find(unit_index);
+        if (it == volume.volume_units_.end()) return false;
+        const auto &unit_volume = *it->second.volume_;
+        const open3d::geometry::TSDFVoxel &voxel =
+                unit_volume.voxels_[unit_volume.IndexOf(
+                        j - unit_index * resolution)];
+        s = ToVoxelSample(voxel, color_type);
+        return true;
+    };
+
+    core::Tensor keys, values;
+    PackInterpolatedBlocks(candidate_keys, resolution,
+                           Eigen::Vector3d::Constant(-0.5), sampler,
+                           GetVoxelLayout(attr_dtype_map), keys, values);
+
+    TSDFVoxelGrid voxel_grid(attr_dtype_map, float(volume.voxel_length_),
+                             float(volume.sdf_trunc_), resolution,
+                             std::max<int64_t>(keys.GetLength(), 1000), device);
+    if (keys.GetLength() > 0) {
+        core::Tensor addrs, masks;
+        voxel_grid.block_hashmap_->Insert(keys.To(device), values.To(device),
+                                          addrs, masks);
+    }
+    return voxel_grid;
+}
+
+TSDFVoxelGrid TSDFVoxelGrid::FromLegacyTSDFVolume(
+        const open3d::pipelines::integration::UniformTSDFVolume &volume,
+        int64_t block_resolution,
+        const std::unordered_map<std::string, core::Dtype> &attr_dtype_map,
+        const core::Device &device) {
+    using open3d::pipelines::integration::TSDFVolumeColorType;
+    int resolution = volume.resolution_;
+    int block_res = static_cast<int>(block_resolution);
+
+    // A legacy voxel j is centered at origin + (j + 0.5) * voxel_length.
+    Eigen::Vector3d shift =
+            -volume.origin_ / volume.voxel_length_ -
+            Eigen::Vector3d::Constant(0.5);
+    Eigen::Vector3i k_min = (-shift).array().floor().cast<int>();
+    Eigen::Vector3i k_max =
+            k_min + Eigen::Vector3i::Constant(resolution + 1);
+    std::vector<Eigen::Vector3i> candidate_keys;
+    for (int x = FloorDiv(k_min(0), block_res);
+         x <= FloorDiv(k_max(0), block_res); ++x) {
+        for (int y = FloorDiv(k_min(1), block_res);
+             y <= FloorDiv(k_max(1), block_res); ++y) {
+            for (int z = FloorDiv(k_min(2), block_res);
+                 z <= FloorDiv(k_max(2), block_res); ++z) {
+                candidate_keys.emplace_back(x, y, z);
+            }
+        }
+    }
+
+    TSDFVolumeColorType color_type = volume.color_type_;
+    VoxelSampler sampler = [&](const Eigen::Vector3i &j, VoxelSample &s) {
+        if ((j.array() < 0).any() || (j.array() >= resolution).any()) {
+            return false;
+        }
+        const open3d::geometry::TSDFVoxel &voxel =
+                volume.voxels_[volume.IndexOf(j)];
+        s = ToVoxelSample(voxel, color_type);
+        return true;
+    };
+
+    core::Tensor keys, values;
+    PackInterpolatedBlocks(candidate_keys, block_resolution, shift, sampler,
+                           GetVoxelLayout(attr_dtype_map), keys, values);
+
+    TSDFVoxelGrid voxel_grid(attr_dtype_map, float(volume.voxel_length_),
+                             float(volume.sdf_trunc_), block_resolution,
+                             std::max<int64_t>(keys.GetLength(), 1000), device);
+    if (keys.GetLength() > 0) {
+        core::Tensor addrs, masks;
+        voxel_grid.block_hashmap_->Insert(keys.To(device), values.To(device),
+                                          addrs, masks);
+    }
+    return voxel_grid;
+}
+
+std::shared_ptr<open3d::pipelines::integration::ScalableTSDFVolume>
+TSDFVoxelGrid::ToLegacyTSDFVolume() const {
+    using namespace open3d::pipelines::integration;
+    static const core::Device host("CPU:0");
+
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+    core::Tensor keys = block_hashmap_->GetKeyTensor()
+                                .IndexGet({active_indices})
+                                .To(host)
+                                .Contiguous();
+    core::Tensor values = block_hashmap_->GetValueTensor()
+                                  .IndexGet({active_indices})
+                                  .To(host)
+                                  .Contiguous();
+
+    VoxelLayout layout = GetVoxelLayout(attr_dtype_map_);
+    int resolution = static_cast<int>(block_resolution_);
+    int64_t block_bytes =
+            block_resolution_ * block_resolution_ * block_resolution_ *
+            layout.byte_size;
+    const int *keys_ptr = keys.GetDataPtr<int>();
+    const uint8_t *values_ptr = values.GetDataPtr<uint8_t>();
+
+    std::unordered_map<Eigen::Vector3i, int64_t,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            block_index;
+    for (int64_t i = 0; i < keys.GetLength(); ++i) {
+        block_index.emplace(Eigen::Vector3i(keys_ptr[3 * i + 0],
+                                            keys_ptr[3 * i + 1],
+                                            keys_ptr[3 * i + 2]),
+                            i);
+    }
+
+    // A legacy voxel j is interpolated from the voxels j and j + 1, so the
+    // previous units of the blocks are candidates too.
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            candidate_set;
+    for (const auto &kv : block_index) {
+        for (int i = 0; i < 8; ++i) {
+            candidate_set.insert(kv.first - Eigen::Vector3i(i & 1,
+                                                            (i >> 1) & 1,
+                                                            (i >> 2) & 1));
+        }
+    }
+    std::vector<Eigen::Vector3i> candidate_keys(candidate_set.begin(),
+                                                candidate_set.end());
+
+    VoxelSampler sampler = [&](const Eigen::Vector3i &k, VoxelSample &s) {
+        Eigen::Vector3i block_key(FloorDiv(k(0), resolution),
+                                  FloorDiv(k(1), resolution),
+                                  FloorDiv(k(2), resolution));
+        auto it = block_index.find(block_key);
+        if (it == block_index.end()) return false;
+        Eigen::Vector3i v = k - block_key * resolution;
+        int64_t offset = (int64_t(v(2)) * resolution + v(1)) * resolution +
+                         v(0);
+        s = ReadVoxel(layout, values_ptr + it->second * block_bytes +
+                                      offset * layout.byte_size);
+        return true;
+    };
+
+    auto volume = std::make_shared<ScalableTSDFVolume>(
+            voxel_size_, sdf_trunc_,
+            layout.has_color ? TSDFVolumeColorType::RGB8
+                             : TSDFVolumeColorType::NoColor,
+            resolution);
+    int64_t n = candidate_keys.size();
+    std::vector<std::shared_ptr<UniformTSDFVolume>> unit_volumes(n);
+    utility::ParallelFor(0, n, [&](int64_t i) {
+        auto unit_volume = std::make_shared<UniformTSDFVolume>(
+                volume->volume_unit_length_, resolution, sdf_trunc_,
+                volume->color_type_,
+                candidate_keys[i].cast<double>() *
+                        volume->volume_unit_length_);
+        bool observed = false;
+        Eigen::Vector3i base = candidate_keys[i] * resolution;
+        for (int x = 0; x < resolution; ++x) {
+            for (int y = 0; y < resolution; ++y) {
+                for (int z = 0; z < resolution; ++z) {
+                    VoxelSample sample;
+                    if (!InterpolateVoxel(sampler,
+                                          base + Eigen::Vector3i(x, y, z),
+                                          Eigen::Vector3d::Constant(0.5),
+                                          sample)) {
+                        continue;
+                    }
+                    auto &voxel =
+                            unit_volume->voxels_[unit_volume->IndexOf(x, y, z)];
+                    voxel.tsdf_ = sample.tsdf;
+                    voxel.weight_ = sample.weight;
+                    voxel.color_ =
+                            Eigen::Vector3d(sample.r, sample.g, sample.b);
+                    observed = true;
+                }
+            }
+        }
+        if (observed) {
+            unit_volumes[i] = unit_volume;
+        }
+    });
+
+    for (int64_t i = 0; i < n; ++i) {
+        if (unit_volumes[i] == nullptr) continue;
+        ScalableTSDFVolume::VolumeUnit unit;
+        unit.volume_ = unit_volumes[i];
+        unit.index_ = candidate_keys[i];
+        volume->volume_units_[candidate_keys[i]] = unit;
+    }
+    return volume;
+}
+
+void TSDFVoxelGrid::EraseBlocks(const core::Tensor &block_keys) {
+    core::Tensor masks;
+    block_hashmap_->Erase(block_keys, masks);
+    if (dirty_block_hashmap_ != nullptr) {
+        core::Tensor dirty_addrs, dirty_masks;
+        dirty_block_hashmap_->Activate(block_keys, dirty_addrs, dirty_masks);
+    }
+}
+
+void TSDFVoxelGrid::RefreshBlockMinTSDF() {
+    if (block_min_tsdf_.GetLength() == block_hashmap_->GetCapacity()) {
+        return;
+    }
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    block_min_tsdf_ = core::Tensor::Ones({block_hashmap_->GetCapacity()},
+                                         core::Dtype::Float32, device_);
+    kernel::tsdf::UpdateBlockMinTSDF(active_addrs.To(core::Dtype::Int64),
+                                     block_hashmap_->GetValueTensor(),
+                                     block_min_tsdf_, block_resolution_);
+}
+
+core::Tensor TSDFVoxelGrid::BufferBlockLookup(
         const core::Tensor &active_addrs) {
-    // Fixed radius search for spatially hashed voxel blocks.
-    // A generalization will be implementing dense/sparse fixed radius search
-    // with coordinates as hashmap keys.
-    core::Tensor key_buffer_int3_tensor = block_hashmap_->GetKeyTensor();
-
-    core::Tensor active_keys = key_buffer_int3_tensor.IndexGet(
-            {active_addrs.To(core::Dtype::Int64)});
-    int64_t n = active_keys.GetShape()[0];
-
-    // Fill in radius nearest neighbors.
-    core::Tensor keys_nb({27, n, 3}, core::Dtype::Int32, device_);
-    for (int nb = 0; nb < 27; ++nb) {
-        int dz = nb / 9;
-        int dy = (nb % 9) / 3;
-        int dx = nb % 3;
-        core::Tensor dt = core::Tensor(std::vector<int>{dx - 1, dy - 1, dz - 1},
-                                       {1, 3}, core::Dtype::Int32, device_);
-        keys_nb[nb] = active_keys + dt;
-    }
-    keys_nb = keys_nb.View({27 * n, 3});
-
-    core::Tensor addrs_nb, masks_nb;
-    block_hashmap_->Find(keys_nb, addrs_nb, masks_nb);
-    return std::make_pair(addrs_nb.View({27, n, 1}), masks_nb.View({27, n, 1}));
+    core::Tensor sorted_addrs;
+    kernel::tsdf::SortBlockIndices(active_addrs, block_hashmap_->GetKeyTensor(),
+                                   sorted_addrs);
+    return sorted_addrs;
 }
 }  // namespace geometry
 }  // namespace t
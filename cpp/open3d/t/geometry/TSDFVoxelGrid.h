@@ -30,15 +30,19 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace t {
@@ -52,6 +56,8 @@ namespace geometry {
 /// (resolution, resolution, resolution, channel).
 /// For pure geometric TSDF voxels, channel = 2 (TSDF + weight).
 /// For colored TSDF voxels, channel = 5 (TSDF + weight + color).
+/// Compact layouts quantize TSDF to Int8 or Int16 with UInt16 weight and
+/// UInt8 color, i.e. 3, 6 or 7 bytes per voxel instead of 8 or 12.
 /// Users may specialize their own channels that can be reinterpreted from the
 /// internal Tensor.
 class TSDFVoxelGrid {
@@ -72,11 +78,18 @@ public:
     ~TSDFVoxelGrid(){};
 
     /// Depth-only integration.
+    /// Blocks are allocated from every \p stride-th pixel of \p depth. By
+    /// default all the blocks within sdf_trunc of the observed points are
+    /// allocated. With \p visibility_culling, only the blocks crossed by the
+    /// camera rays within sdf_trunc of the observed surface are allocated, so
+    /// that fewer blocks outside the truncation band are integrated.
     void Integrate(const Image &depth,
                    const core::Tensor &intrinsics,
                    const core::Tensor &extrinsics,
                    float depth_scale = 1000.0f,
-                   float depth_max = 3.0f);
+                   float depth_max = 3.0f,
+                   int64_t stride = 4,
+                   bool visibility_culling = false);
 
     /// RGB-D integration.
     void Integrate(const Image &depth,
@@ -84,7 +97,31 @@ public:
                    const core::Tensor &intrinsics,
                    const core::Tensor &extrinsics,
                    float depth_scale = 1000.0f,
-                   float depth_max = 3.0f);
+                   float depth_max = 3.0f,
+                   int64_t stride = 4,
+                   bool visibility_culling = false);
+
+    /// First step of Integrate: returns the (N, 3) Int32 coordinates of the
+    /// blocks touched by \p depth, on the device of the voxel grid. The
+    /// block hashmap is not modified.
+    core::Tensor TouchBlocks(const Image &depth,
+                             const core::Tensor &intrinsics,
+                             const core::Tensor &extrinsics,
+                             float depth_scale = 1000.0f,
+                             float depth_max = 3.0f,
+                             int64_t stride = 4,
+                             bool visibility_culling = false);
+
+    /// Second step of Integrate: activates the blocks \p block_coords, e.g.
+    /// a subset of the result of TouchBlocks, and integrates \p depth and
+    /// optionally \p color into them. \p color may be empty.
+    void IntegrateBlocks(const core::Tensor &block_coords,
+                         const Image &depth,
+                         const Image &color,
+                         const core::Tensor &intrinsics,
+                         const core::Tensor &extrinsics,
+                         float depth_scale = 1000.0f,
+                         float depth_max = 3.0f);
 
     enum SurfaceMaskCode {
         None = 0,
@@ -132,6 +169,49 @@ public:
     /// observations.
     TriangleMesh ExtractSurfaceMesh(float weight_threshold = 3.0f);
 
+    /// Meshes of the blocks whose surface changed since the previous
+    /// ExtractSurfaceMeshUpdate.
+    struct SurfaceMeshUpdate {
+        /// Coordinates of the blocks whose mesh is added or replaced.
+        std::vector<Eigen::Vector3i> updated_blocks_;
+        /// New meshes of updated_blocks_, on CPU.
+        std::vector<TriangleMesh> updated_meshes_;
+        /// Coordinates of the blocks whose mesh is gone.
+        std::vector<Eigen::Vector3i> removed_blocks_;
+    };
+
+    /// Incremental mesh extraction with Marching Cubes for live preview.
+    /// Only the blocks integrated since the previous call, and the blocks
+    /// whose cubes reach into them, are meshed again. Meshes are cached per
+    /// block and the changes to the cache are returned, so that viewers can
+    /// stream them. The first call, or a call with another weight_threshold,
+    /// meshes all the blocks. Vertices on block boundaries are duplicated in
+    /// the meshes of all the blocks sharing them.
+    SurfaceMeshUpdate ExtractSurfaceMeshUpdate(float weight_threshold = 3.0f);
+
+    /// Assemble the meshes cached by ExtractSurfaceMeshUpdate on CPU.
+    TriangleMesh GetCachedSurfaceMesh() const;
+
+    /// Erase the blocks whose observed voxels are all truncated in front of
+    /// the surface, e.g. free space allocated by ray culling. They hold no
+    /// surface, so this trades the known free space for memory. Returns the
+    /// number of erased blocks.
+    int64_t PruneTruncatedBlocks();
+
+    /// Scale the weights of all the voxels by \p decay in (0, 1], so that
+    /// observations fade out unless new frames confirm them. Integer weights
+    /// are rounded down. Call it periodically in dynamic scenes, followed by
+    /// EraseStaleBlocks.
+    void DecayWeights(float decay);
+
+    /// Erase the blocks whose maximal voxel weight is below
+    /// \p weight_threshold, or that are not integrated in the last
+    /// \p max_unobserved_frames frames (ignored if negative). Integration
+    /// and ray casting then scale with the blocks that are still observed.
+    /// Returns the number of erased blocks.
+    int64_t EraseStaleBlocks(float weight_threshold = 1.0f,
+                             int64_t max_unobserved_frames = -1);
+
     /// Convert TSDFVoxelGrid to the target device.
     /// \param device The targeted device to convert to.
     /// \param copy If true, a new TSDFVoxelGrid is always created; if false,
@@ -155,18 +235,59 @@ public:
 
     std::shared_ptr<core::Hashmap> GetBlockHashmap() { return block_hashmap_; }
 
+    /// Save the active blocks with the grid parameters to a binary file. The
+    /// blocks are stored as keys and packed voxels, in the layout of the
+    /// block hashmap values.
+    void Save(const std::string &file_name) const;
+
+    /// Load a TSDFVoxelGrid saved with Save to \p device, inserting all the
+    /// blocks at once.
+    static TSDFVoxelGrid Load(
+            const std::string &file_name,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// Create a TSDFVoxelGrid from a legacy ScalableTSDFVolume, whose volume
+    /// units become the blocks. Legacy voxels are centered in their cells
+    /// while TSDFVoxelGrid voxels sit on the cell corners, so every voxel is
+    /// trilinearly interpolated from the 8 observed legacy voxels around it.
+    static TSDFVoxelGrid FromLegacyTSDFVolume(
+            const open3d::pipelines::integration::ScalableTSDFVolume &volume,
+            const std::unordered_map<std::string, core::Dtype>
+                    &attr_dtype_map = {{"tsdf", core::Dtype::Float32},
+                                       {"weight", core::Dtype::UInt16},
+                                       {"color", core::Dtype::UInt16}},
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Create a TSDFVoxelGrid from a legacy UniformTSDFVolume, interpolated
+    /// as above into blocks of \p block_resolution.
+    static TSDFVoxelGrid FromLegacyTSDFVolume(
+            const open3d::pipelines::integration::UniformTSDFVolume &volume,
+            int64_t block_resolution = 16,
+            const std::unordered_map<std::string, core::Dtype>
+                    &attr_dtype_map = {{"tsdf", core::Dtype::Float32},
+                                       {"weight", core::Dtype::UInt16},
+                                       {"color", core::Dtype::UInt16}},
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Convert to a legacy ScalableTSDFVolume with the blocks as volume units,
+    /// interpolating the legacy voxels at the cell centers.
+    std::shared_ptr<open3d::pipelines::integration::ScalableTSDFVolume>
+    ToLegacyTSDFVolume() const;
+
 protected:
-    /// Return  addrs and masks for radius (3) neighbor entries.
-    /// We first find all active entries in the hashmap with there coordinates.
-    /// We then query these coordinates and their 3^3 neighbors.
-    /// addrs_nb: indexer used for the internal hashmap to access voxel block
-    /// coordinates in the 3^3 neighbors.
-    /// masks_nb: flag used for hashmap to indicate whether a query is a
-    /// success.
-    /// Currently we preserve a dense output (27 x active_entries) without
-    /// compression / reduction.
-    std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
-            const core::Tensor &active_addrs);
+    /// Return the active block addresses sorted by their coordinates, with
+    /// which the kernels look up the 3^3 neighbors of a block on demand by
+    /// binary search. This takes one address per active block, instead of a
+    /// dense buffer of all the 27 neighbors of every active block.
+    core::Tensor BufferBlockLookup(const core::Tensor &active_addrs);
+
+    /// Erase blocks from the block hashmap, and mark them for the mesh cache.
+    void EraseBlocks(const core::Tensor &block_keys);
+
+    /// Rebuild block_min_tsdf_ for all the active blocks if it is stale.
+    void RefreshBlockMinTSDF();
 
     float voxel_size_;
     float sdf_trunc_;
@@ -179,11 +300,29 @@ protected:
     // Global hashmap
     std::shared_ptr<core::Hashmap> block_hashmap_;
 
-    // Local hashmap for the `unique` operation of input points
+    // Local hashmap for the `unique` operation of touched blocks
     std::shared_ptr<core::Hashmap> point_hashmap_;
     core::Tensor active_block_coords_;
 
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
+
+    // Per-block mesh cache of ExtractSurfaceMeshUpdate, and the set of blocks
+    // integrated since then. Blocks are only tracked once the cache exists.
+    std::unordered_map<Eigen::Vector3i,
+                       TriangleMesh,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            block_mesh_cache_;
+    std::shared_ptr<core::Hashmap> dirty_block_hashmap_;
+    float block_mesh_cache_weight_threshold_ = 0;
+
+    // Minimal TSDF per block address for empty space skipping in ray casting.
+    // Reset when rehashing reassigns the addresses.
+    core::Tensor block_min_tsdf_;
+
+    // Number of integrated frames, and the last frame each block address is
+    // integrated in.
+    int64_t frame_count_ = 0;
+    core::Tensor block_last_frame_;
 };
 }  // namespace geometry
 }  // namespace t
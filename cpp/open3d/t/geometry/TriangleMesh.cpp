@@ -27,12 +27,18 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 #include <Eigen/Core>
+#include <cmath>
+#include <limits>
+#include <random>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
 
 namespace open3d {
 namespace t {
@@ -60,11 +66,16 @@ TriangleMesh::TriangleMesh(const core::Tensor &vertices,
     SetTriangles(triangles);
 }
 
-geometry::TriangleMesh TriangleMesh::FromLegacyTriangleMesh(
-        const open3d::geometry::TriangleMesh &mesh_legacy,
+/// Shared implementation of the FromLegacyTriangleMesh overloads, which only
+/// differ in how a legacy attribute is turned into a tensor.
+template <typename FloatConverter, typename IntConverter>
+static geometry::TriangleMesh FromLegacyTriangleMeshImpl(
+        open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
         core::Dtype int_dtype,
-        const core::Device &device) {
+        const core::Device &device,
+        FloatConverter to_float_tensor,
+        IntConverter to_int_tensor) {
     if (float_dtype != core::Dtype::Float32 &&
         float_dtype != core::Dtype::Float64) {
         utility::LogError("float_dtype must be Float32 or Float64, but got {}.",
@@ -75,35 +86,96 @@ geometry::TriangleMesh TriangleMesh::FromLegacyTriangleMesh(
                           int_dtype.ToString());
     }
 
-    TriangleMesh mesh(device);
-    if (mesh_legacy.HasVertices()) {
-        mesh.SetVertices(core::eigen_converter::EigenVector3dVectorToTensor(
-                mesh_legacy.vertices_, float_dtype, device));
+    // The legacy Has*() checks compare against the number of vertices and
+    // triangles, which may be moved out by the converters, so evaluate them
+    // first.
+    const bool has_vertices = mesh_legacy.HasVertices();
+    const bool has_vertex_colors = mesh_legacy.HasVertexColors();
+    const bool has_vertex_normals = mesh_legacy.HasVertexNormals();
+    const bool has_triangles = mesh_legacy.HasTriangles();
+    const bool has_triangle_normals = mesh_legacy.HasTriangleNormals();
+
+    geometry::TriangleMesh mesh(device);
+    if (has_vertices) {
+        mesh.SetVertices(to_float_tensor(mesh_legacy.vertices_));
     } else {
         utility::LogWarning("Creating from empty legacy TriangleMesh.");
     }
-    if (mesh_legacy.HasVertexColors()) {
-        mesh.SetVertexColors(core::eigen_converter::EigenVector3dVectorToTensor(
-                mesh_legacy.vertex_colors_, float_dtype, device));
+    if (has_vertex_colors) {
+        mesh.SetVertexColors(to_float_tensor(mesh_legacy.vertex_colors_));
     }
-    if (mesh_legacy.HasVertexNormals()) {
-        mesh.SetVertexNormals(
-                core::eigen_converter::EigenVector3dVectorToTensor(
-                        mesh_legacy.vertex_normals_, float_dtype, device));
+    if (has_vertex_normals) {
+        mesh.SetVertexNormals(to_float_tensor(mesh_legacy.vertex_normals_));
     }
-    if (mesh_legacy.HasTriangles()) {
-        mesh.SetTriangles(core::eigen_converter::EigenVector3iVectorToTensor(
-                mesh_legacy.triangles_, int_dtype, device));
+    if (has_triangles) {
+        mesh.SetTriangles(to_int_tensor(mesh_legacy.triangles_));
     }
-    if (mesh_legacy.HasTriangleNormals()) {
+    if (has_triangle_normals) {
         mesh.SetTriangleNormals(
-                core::eigen_converter::EigenVector3dVectorToTensor(
-                        mesh_legacy.triangle_normals_, float_dtype, device));
+                to_float_tensor(mesh_legacy.triangle_normals_));
     }
     return mesh;
 }
 
-open3d::geometry::TriangleMesh TriangleMesh::ToLegacyTriangleMesh() const {
+geometry::TriangleMesh TriangleMesh::FromLegacyTriangleMesh(
+        const open3d::geometry::TriangleMesh &mesh_legacy,
+        core::Dtype float_dtype,
+        core::Dtype int_dtype,
+        const core::Device &device,
+        bool copy) {
+    // The legacy storage can only be aliased by tensors on the CPU whose dtype
+    // matches the element type of the std::vector.
+    const bool alias = !copy && device == core::Device("CPU:0");
+    auto to_float_tensor =
+            [&](std::vector<Eigen::Vector3d> &values) -> core::Tensor {
+        if (alias && float_dtype == core::Dtype::Float64) {
+            return core::eigen_converter::EigenVector3dVectorAsTensor(values);
+        }
+        return core::eigen_converter::EigenVector3dVectorToTensor(
+                values, float_dtype, device);
+    };
+    auto to_int_tensor =
+            [&](std::vector<Eigen::Vector3i> &values) -> core::Tensor {
+        if (alias && int_dtype == core::Dtype::Int32) {
+            return core::eigen_converter::EigenVector3iVectorAsTensor(values);
+        }
+        return core::eigen_converter::EigenVector3iVectorToTensor(
+                values, int_dtype, device);
+    };
+    return FromLegacyTriangleMeshImpl(
+            const_cast<open3d::geometry::TriangleMesh &>(mesh_legacy),
+            float_dtype, int_dtype, device, to_float_tensor, to_int_tensor);
+}
+
+geometry::TriangleMesh TriangleMesh::FromLegacyTriangleMesh(
+        open3d::geometry::TriangleMesh &&mesh_legacy,
+        core::Dtype float_dtype,
+        core::Dtype int_dtype,
+        const core::Device &device) {
+    const bool on_cpu = device == core::Device("CPU:0");
+    auto to_float_tensor =
+            [&](std::vector<Eigen::Vector3d> &values) -> core::Tensor {
+        if (on_cpu && float_dtype == core::Dtype::Float64) {
+            return core::eigen_converter::EigenVector3dVectorToTensor(
+                    std::move(values));
+        }
+        return core::eigen_converter::EigenVector3dVectorToTensor(
+                values, float_dtype, device);
+    };
+    auto to_int_tensor =
+            [&](std::vector<Eigen::Vector3i> &values) -> core::Tensor {
+        if (on_cpu && int_dtype == core::Dtype::Int32) {
+            return core::eigen_converter::EigenVector3iVectorToTensor(
+                    std::move(values));
+        }
+        return core::eigen_converter::EigenVector3iVectorToTensor(
+                values, int_dtype, device);
+    };
+    return FromLegacyTriangleMeshImpl(mesh_legacy, float_dtype, int_dtype,
+                                      device, to_float_tensor, to_int_tensor);
+}
+
+open3d::geometry::TriangleMesh TriangleMesh::ToLegacyTriangleMesh() const & {
     open3d::geometry::TriangleMesh mesh_legacy;
     if (HasVertices()) {
         mesh_legacy.vertices_ =
@@ -134,6 +206,534 @@ open3d::geometry::TriangleMesh TriangleMesh::ToLegacyTriangleMesh() const {
     return mesh_legacy;
 }
 
+open3d::geometry::TriangleMesh TriangleMesh::ToLegacyTriangleMesh() && {
+    open3d::geometry::TriangleMesh mesh_legacy;
+    // HasVertexAttr() and HasTriangleAttr() compare lengths against the
+    // vertices and triangles, so those are moved out last.
+    if (HasVertexColors()) {
+        mesh_legacy.vertex_colors_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        std::move(GetVertexColors()));
+    }
+    if (HasVertexNormals()) {
+        mesh_legacy.vertex_normals_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        std::move(GetVertexNormals()));
+    }
+    if (HasTriangleNormals()) {
+        mesh_legacy.triangle_normals_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        std::move(GetTriangleNormals()));
+    }
+    if (HasTriangles()) {
+        mesh_legacy.triangles_ =
+                core::eigen_converter::TensorToEigenVector3iVector(
+                        std::move(GetTriangles()));
+    }
+    if (HasVertices()) {
+        mesh_legacy.vertices_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        std::move(GetVertices()));
+    }
+    return mesh_legacy;
+}
+
+TriangleMesh &TriangleMesh::NormalizeNormals() {
+    if (HasVertexNormals()) {
+        core::Tensor vertex_normals = GetVertexNormals();
+        kernel::trianglemesh::NormalizeNormals(vertex_normals);
+        SetVertexNormals(vertex_normals);
+    }
+    if (HasTriangleNormals()) {
+        core::Tensor triangle_normals = GetTriangleNormals();
+        kernel::trianglemesh::NormalizeNormals(triangle_normals);
+        SetTriangleNormals(triangle_normals);
+    }
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeTriangleNormals(bool normalized) {
+    if (!HasVertices() || !HasTriangles()) {
+        utility::LogWarning("[ComputeTriangleNormals] The mesh is empty.");
+        return *this;
+    }
+    core::Tensor triangle_normals;
+    kernel::trianglemesh::ComputeTriangleNormals(
+            GetVertices(), GetTriangles(), triangle_normals, normalized);
+    SetTriangleNormals(triangle_normals);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized) {
+    if (!HasVertices() || !HasTriangles()) {
+        utility::LogWarning("[ComputeVertexNormals] The mesh is empty.");
+        return *this;
+    }
+    if (!HasTriangleNormals()) {
+        ComputeTriangleNormals(false);
+    }
+    core::Tensor vertex_normals;
+    kernel::trianglemesh::ComputeVertexNormals(
+            GetTriangles(), GetTriangleNormals(), GetVertices().GetLength(),
+            vertex_normals);
+    SetVertexNormals(vertex_normals);
+    if (normalized) {
+        NormalizeNormals();
+    }
+    return *this;
+}
+
+/// Replaces the vertex indices of \p triangles with their entries in
+/// \p vertex_map, keeping the dtype of the triangles.
+static core::Tensor RemapTriangles(const core::Tensor &triangles,
+                                   const core::Tensor &vertex_map) {
+    core::Tensor indices =
+            triangles.To(core::Dtype::Int64).Contiguous().Reshape({-1});
+    return vertex_map.IndexGet({indices})
+            .Reshape(triangles.GetShape())
+            .To(triangles.GetDtype());
+}
+
+void TriangleMesh::SelectVertices(const core::Tensor &indices,
+                                  const core::Tensor &vertex_map) {
+    std::vector<std::string> keys;
+    for (const auto &kv : vertex_attr_) {
+        if (HasVertexAttr(kv.first)) {
+            keys.push_back(kv.first);
+        }
+    }
+    for (const std::string &key : keys) {
+        SetVertexAttr(key, GetVertexAttr(key).IndexGet({indices}));
+    }
+    if (HasTriangles()) {
+        SetTriangles(RemapTriangles(GetTriangles(), vertex_map));
+    }
+}
+
+TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
+    if (!HasVertices()) {
+        return *this;
+    }
+    int64_t num_vertices = GetVertices().GetLength();
+    core::Tensor vertex_map, first_vertices;
+    kernel::trianglemesh::GroupEqualRows(GetVertices(), vertex_map,
+                                         first_vertices);
+    int64_t num_unique = first_vertices.GetLength();
+    if (num_unique < num_vertices) {
+        SelectVertices(first_vertices, vertex_map);
+    }
+    utility::LogDebug(
+            "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
+            num_vertices - num_unique);
+
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
+    if (!HasVertices()) {
+        return *this;
+    }
+    int64_t num_vertices = GetVertices().GetLength();
+    core::Tensor is_referenced =
+            core::Tensor::Zeros({num_vertices}, core::Dtype::Bool, device_);
+    if (HasTriangles()) {
+        core::Tensor indices =
+                GetTriangles().To(core::Dtype::Int64).Reshape({-1});
+        is_referenced.IndexSet(
+                {indices}, core::Tensor::Ones({indices.GetLength()},
+                                              core::Dtype::Bool, device_));
+    }
+    core::Tensor kept = is_referenced.NonZero()[0];
+    int64_t num_kept = kept.GetLength();
+    if (num_kept < num_vertices) {
+        core::Tensor vertex_map = core::Tensor::Full(
+                {num_vertices}, -1, core::Dtype::Int64, device_);
+        vertex_map.IndexSet({kept},
+                            core::Tensor::Arange(0, num_kept, 1,
+                                                 core::Dtype::Int64, device_));
+        SelectVertices(kept, vertex_map);
+    }
+    utility::LogDebug(
+            "[RemoveUnreferencedVertices] {:d} vertices have been removed.",
+            num_vertices - num_kept);
+
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
+    if (!HasTriangles()) {
+        return *this;
+    }
+    const core::Tensor &triangles = GetTriangles();
+    int64_t num_triangles = triangles.GetLength();
+    core::Tensor v0 = triangles.Slice(1, 0, 1).Reshape({-1});
+    core::Tensor v1 = triangles.Slice(1, 1, 2).Reshape({-1});
+    core::Tensor v2 = triangles.Slice(1, 2, 3).Reshape({-1});
+    core::Tensor kept = v0.Ne(v1).LogicalAnd(v1.Ne(v2)).LogicalAnd(v2.Ne(v0))
+                                .NonZero()[0];
+    int64_t num_kept = kept.GetLength();
+    if (num_kept < num_triangles) {
+        std::vector<std::string> keys;
+        for (const auto &kv : triangle_attr_) {
+            if (HasTriangleAttr(kv.first)) {
+                keys.push_back(kv.first);
+            }
+        }
+        // The triangles are updated last, since HasTriangleAttr() compares
+        // against their number.
+        for (const std::string &key : keys) {
+            if (key != "triangles") {
+                SetTriangleAttr(key, GetTriangleAttr(key).IndexGet({kept}));
+            }
+        }
+        SetTriangles(GetTriangles().IndexGet({kept}));
+    }
+    utility::LogDebug(
+            "[RemoveDegenerateTriangles] {:d} triangles have been removed.",
+            num_triangles - num_kept);
+
+    return *this;
+}
+
+PointCloud TriangleMesh::SamplePointsUniformly(size_t number_of_points,
+                                               bool use_triangle_normal,
+                                               int seed) const {
+    if (number_of_points <= 0) {
+        utility::LogError("[SamplePointsUniformly] number_of_points <= 0");
+    }
+    if (!HasVertices() || !HasTriangles()) {
+        utility::LogError(
+                "[SamplePointsUniformly] input mesh has no triangles");
+    }
+    if (seed == -1) {
+        std::random_device rd;
+        seed = rd();
+    }
+
+    core::Tensor triangle_ids, weights;
+    kernel::trianglemesh::SamplePointsUniformly(
+            GetVertices(), GetTriangles(), int64_t(number_of_points),
+            uint64_t(seed), triangle_ids, weights);
+
+    // Interpolate in the dtype of the weights, i.e. of the vertices.
+    core::Tensor corners =
+            GetTriangles().IndexGet({triangle_ids}).To(core::Dtype::Int64);
+    auto interpolate = [&](const core::Tensor &attr) {
+        core::Tensor attr_float = attr.To(weights.GetDtype());
+        core::Tensor result = core::Tensor::Zeros(
+                {int64_t(number_of_points), attr.GetShape(1)},
+                weights.GetDtype(), GetDevice());
+        for (int64_t i = 0; i < 3; ++i) {
+            core::Tensor vertex_ids = corners.T()[i].Contiguous();
+            result += attr_float.IndexGet({vertex_ids}) *
+                      weights.Slice(1, i, i + 1);
+        }
+        return result.To(attr.GetDtype());
+    };
+
+    PointCloud pcd(interpolate(GetVertices()));
+    if (use_triangle_normal) {
+        core::Tensor triangle_normals;
+        if (HasTriangleNormals()) {
+            triangle_normals = GetTriangleNormals();
+        } else {
+            kernel::trianglemesh::ComputeTriangleNormals(
+                    GetVertices(), GetTriangles(), triangle_normals, true);
+        }
+        pcd.SetPointNormals(triangle_normals.IndexGet({triangle_ids}));
+    } else if (HasVertexNormals()) {
+        pcd.SetPointNormals(interpolate(GetVertexNormals()));
+    }
+    if (HasVertexColors()) {
+        pcd.SetPointColors(interpolate(GetVertexColors()));
+    }
+    return pcd;
+}
+
+PointCloud TriangleMesh::SamplePointsPoissonDisk(size_t number_of_points,
+                                                 double init_factor,
+                                                 bool use_triangle_normal,
+                                                 int seed) const {
+    if (number_of_points <= 0) {
+        utility::LogError("[SamplePointsPoissonDisk] number_of_points <= 0");
+    }
+    if (init_factor < 1) {
+        utility::LogError("[SamplePointsPoissonDisk] init_factor < 1");
+    }
+    if (!HasVertices() || !HasTriangles()) {
+        utility::LogError(
+                "[SamplePointsPoissonDisk] input mesh has no triangles");
+    }
+
+    size_t number_of_init_points = size_t(init_factor * number_of_points);
+    PointCloud pcd = SamplePointsUniformly(number_of_init_points,
+                                           use_triangle_normal, seed);
+
+    // Same radii as the legacy mesh, with alpha = 8, beta = 0.5 and
+    // gamma = 1.5 of the paper.
+    core::Tensor triangle_normals;
+    kernel::trianglemesh::ComputeTriangleNormals(
+            GetVertices(), GetTriangles(), triangle_normals, false);
+    double surface_area =
+            0.5 * (triangle_normals * triangle_normals)
+                          .Sum({1})
+                          .Sqrt()
+                          .Sum({0})
+                          .To(core::Dtype::Float64)
+                          .Item<double>();
+    double ratio = double(number_of_points) / double(number_of_init_points);
+    double r_max = 2 * std::sqrt((surface_area / number_of_points) /
+                                 (2 * std::sqrt(3.)));
+    double r_min = r_max * 0.5 * (1 - std::pow(ratio, 1.5));
+
+    core::Tensor kept;
+    kernel::trianglemesh::EliminateSamples(pcd.GetPoints(), r_max, r_min,
+                                           int64_t(number_of_points), kept);
+    core::Tensor mask = core::Tensor::Zeros({int64_t(number_of_init_points)},
+                                            core::Dtype::Bool, GetDevice());
+    mask.IndexSet({kept}, core::Tensor::Ones({kept.GetLength()},
+                                             core::Dtype::Bool, GetDevice()));
+    return pcd.SelectByMask(mask);
+}
+
+TriangleMesh TriangleMesh::SimplifyVertexClustering(double voxel_size) const {
+    if (voxel_size <= 0) {
+        utility::LogError(
+                "[SimplifyVertexClustering] voxel_size must be positive, but "
+                "got {}.",
+                voxel_size);
+    }
+    TriangleMesh mesh(GetDevice());
+    if (!HasVertices()) {
+        utility::LogWarning("[SimplifyVertexClustering] The mesh is empty.");
+        return mesh;
+    }
+
+    // Voxel indices relative to the min bound, shifted by half a voxel like
+    // in the legacy mesh.
+    core::Tensor vertices = GetVertices().To(core::Dtype::Float64);
+    core::Tensor voxel_min_bound = vertices.Min({0}) - voxel_size * 0.5;
+    core::Tensor voxel_max_bound = vertices.Max({0}) + voxel_size * 0.5;
+    double extent = (voxel_max_bound - voxel_min_bound).Max({0}).Item<double>();
+    if (voxel_size * std::numeric_limits<int>::max() < extent) {
+        utility::LogError(
+                "[SimplifyVertexClustering] voxel_size is too small.");
+    }
+    core::Tensor voxel_indices = ((vertices - voxel_min_bound) / voxel_size)
+                                         .Floor()
+                                         .To(core::Dtype::Int64);
+
+    core::Tensor vertex_map, first_vertices;
+    kernel::trianglemesh::GroupEqualRows(voxel_indices, vertex_map,
+                                         first_vertices);
+    int64_t num_voxels = first_vertices.GetLength();
+    for (const auto &kv : vertex_attr_) {
+        if (!HasVertexAttr(kv.first)) {
+            continue;
+        }
+        const core::Tensor &attr = kv.second;
+        core::Dtype dtype = attr.GetDtype();
+        if (dtype == core::Dtype::Float32 || dtype == core::Dtype::Float64) {
+            core::SizeVector shape = attr.GetShape();
+            shape[0] = num_voxels;
+            core::Tensor averages;
+            kernel::trianglemesh::AverageGroups(
+                    attr.Reshape({attr.GetLength(), -1}), vertex_map,
+                    num_voxels, averages);
+            mesh.SetVertexAttr(kv.first, averages.Reshape(shape));
+        } else {
+            mesh.SetVertexAttr(kv.first, attr.IndexGet({first_vertices}));
+        }
+    }
+
+    if (HasTriangles()) {
+        core::Tensor triangles, triangle_groups, first_triangles;
+        kernel::trianglemesh::ClusterTriangles(GetTriangles(), vertex_map,
+                                               triangles);
+        kernel::trianglemesh::GroupEqualRows(triangles, triangle_groups,
+                                             first_triangles);
+        mesh.SetTriangles(triangles.IndexGet({first_triangles})
+                                  .To(GetTriangles().GetDtype()));
+        if (HasTriangleNormals()) {
+            mesh.ComputeTriangleNormals();
+        }
+    }
+    return mesh;
+}
+
+std::tuple<core::Tensor, core::Tensor> TriangleMesh::ComputePointDistance(
+        const core::Tensor &query_points) const {
+    if (!HasTriangles() || GetTriangles().GetLength() == 0) {
+        utility::LogError("[ComputePointDistance] The mesh has no triangles.");
+    }
+    core::Tensor node_bounds, node_data, triangle_order;
+    kernel::trianglemesh::BuildTriangleBVH(GetVertices(), GetTriangles(),
+                                           node_bounds, node_data,
+                                           triangle_order);
+    core::Tensor distances, closest_triangles;
+    kernel::trianglemesh::ComputePointToMeshDistance(
+            GetVertices(), GetTriangles(), node_bounds, node_data,
+            triangle_order, query_points, distances, closest_triangles);
+    return std::make_tuple(distances, closest_triangles);
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+TriangleMesh::ClusterConnectedTriangles() const {
+    core::Tensor cluster_ids, num_triangles, areas;
+    if (!HasTriangles()) {
+        cluster_ids = core::Tensor({0}, core::Dtype::Int64, GetDevice());
+        num_triangles = core::Tensor({0}, core::Dtype::Int64, GetDevice());
+        areas = core::Tensor({0}, GetVertices().GetDtype(), GetDevice());
+    } else {
+        kernel::trianglemesh::ClusterConnectedTriangles(
+                GetVertices(), GetTriangles(), cluster_ids, num_triangles,
+                areas);
+    }
+    return std::make_tuple(cluster_ids, num_triangles, areas);
+}
+
+/// Applies the filter \p passes, a list of filter types and strengths, to
+/// the vertex attributes in \p scope, \p number_of_iterations times. All
+/// attributes of a pass are filtered with the vertices before the pass.
+static TriangleMesh FilterVertices(
+        const TriangleMesh &mesh,
+        int number_of_iterations,
+        const std::vector<std::pair<kernel::trianglemesh::VertexFilterType,
+                                    double>> &passes,
+        TriangleMesh::FilterScope scope) {
+    using FilterScope = TriangleMesh::FilterScope;
+    TriangleMesh filtered = mesh;
+    if (!mesh.HasVertices() || !mesh.HasTriangles()) {
+        return filtered;
+    }
+    std::vector<std::string> keys;
+    if (scope == FilterScope::All || scope == FilterScope::Vertex) {
+        keys.push_back("vertices");
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Normal) &&
+        mesh.HasVertexNormals()) {
+        keys.push_back("normals");
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Color) &&
+        mesh.HasVertexColors()) {
+        keys.push_back("colors");
+    }
+
+    core::Tensor offsets, neighbors;
+    kernel::trianglemesh::ComputeVertexAdjacency(
+            mesh.GetTriangles(), mesh.GetVertices().GetLength(), offsets,
+            neighbors);
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        for (const auto &pass : passes) {
+            core::Tensor positions = filtered.GetVertices();
+            for (const std::string &key : keys) {
+                core::Tensor values;
+                kernel::trianglemesh::FilterVertexAttribute(
+                        filtered.GetVertexAttr(key).To(positions.GetDtype()),
+                        positions, offsets, neighbors, pass.first, pass.second,
+                        values);
+                filtered.SetVertexAttr(
+                        key, values.To(mesh.GetVertexAttr(key).GetDtype()));
+            }
+        }
+    }
+    return filtered;
+}
+
+TriangleMesh TriangleMesh::FilterSharpen(int number_of_iterations,
+                                         double strength,
+                                         FilterScope scope) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            {{kernel::trianglemesh::VertexFilterType::Sharpen, strength}},
+            scope);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothSimple(int number_of_iterations,
+                                              FilterScope scope) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            {{kernel::trianglemesh::VertexFilterType::SmoothSimple, 0}}, scope);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(int number_of_iterations,
+                                                 double lambda,
+                                                 FilterScope scope) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            {{kernel::trianglemesh::VertexFilterType::SmoothLaplacian, lambda}},
+            scope);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(int number_of_iterations,
+                                              double lambda,
+                                              double mu,
+                                              FilterScope scope) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            {{kernel::trianglemesh::VertexFilterType::SmoothLaplacian, lambda},
+             {kernel::trianglemesh::VertexFilterType::SmoothLaplacian, mu}},
+            scope);
+}
+
+TriangleMesh TriangleMesh::SubdivideMidpoint(int number_of_iterations) const {
+    if (HasTriangleAttr("uvs")) {
+        utility::LogWarning(
+                "[SubdivideMidpoint] This mesh contains triangle uvs that are "
+                "not handled in this function");
+    }
+    TriangleMesh mesh = *this;
+    if (!HasVertices() || !HasTriangles()) {
+        return mesh;
+    }
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        const int64_t num_vertices = mesh.GetVertices().GetLength();
+        const int64_t num_tris = mesh.GetTriangles().GetLength();
+        core::Tensor vertex_ends, triangles;
+        kernel::trianglemesh::SubdivideTriangles(
+                mesh.GetTriangles(), num_vertices, vertex_ends, triangles);
+        core::Tensor ends = vertex_ends.T();
+        core::Tensor first_ends = ends[0].Contiguous();
+        core::Tensor second_ends = ends[1].Contiguous();
+
+        TriangleMesh subdivided(GetDevice());
+        for (const auto &kv : mesh.vertex_attr_) {
+            if (!mesh.HasVertexAttr(kv.first)) {
+                continue;
+            }
+            const core::Tensor &attr = kv.second;
+            core::Dtype dtype = attr.GetDtype();
+            if (dtype == core::Dtype::Float32 ||
+                dtype == core::Dtype::Float64) {
+                // The old vertices are their own midpoints.
+                subdivided.SetVertexAttr(kv.first,
+                                         (attr.IndexGet({first_ends}) +
+                                          attr.IndexGet({second_ends})) *
+                                                 0.5);
+            } else {
+                subdivided.SetVertexAttr(kv.first, attr.IndexGet({first_ends}));
+            }
+        }
+        core::Tensor parents =
+                core::Tensor::Arange(0, 4 * num_tris, 1, core::Dtype::Int64,
+                                     GetDevice()) /
+                4;
+        for (const auto &kv : mesh.triangle_attr_) {
+            if (kv.first != "triangles" && mesh.HasTriangleAttr(kv.first)) {
+                subdivided.SetTriangleAttr(kv.first,
+                                           kv.second.IndexGet({parents}));
+            }
+        }
+        subdivided.SetTriangles(
+                triangles.To(mesh.GetTriangles().GetDtype()));
+        mesh = subdivided;
+    }
+    if (HasTriangleNormals()) {
+        mesh.ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
 TriangleMesh TriangleMesh::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
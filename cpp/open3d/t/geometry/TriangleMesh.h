@@ -29,6 +29,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TensorMap.h"
 
 namespace open3d {
@@ -135,7 +136,7 @@ public:
     TriangleMesh To(const core::Device &device, bool copy = false) const;
 
     /// Returns copy of the triangle mesh on the same device.
-    TriangleMesh Clone() const { return To(GetDevice()); }
+    TriangleMesh Clone() const { return To(GetDevice(), /*copy=*/true); }
 
     /// Transfer the triangle mesh to CPU.
     ///
@@ -413,6 +414,164 @@ public:
         utility::LogError("Unimplemented");
     }
 
+    /// \brief Normalizes the vertex and triangle normals. Like in the legacy
+    /// mesh, zero normals are kept and NaN normals become (0, 0, 1).
+    TriangleMesh &NormalizeNormals();
+
+    /// \brief Computes the triangle normals on the device of the mesh.
+    ///
+    /// \param normalized If true, the normals are normalized.
+    TriangleMesh &ComputeTriangleNormals(bool normalized = true);
+
+    /// \brief Computes the vertex normals as the sums of the normals of the
+    /// triangles around each vertex, on the device of the mesh.
+    ///
+    /// Unnormalized triangle normals are computed first if there are none, so
+    /// that larger triangles weigh more, like in the legacy mesh.
+    /// \param normalized If true, the vertex and triangle normals are
+    /// normalized.
+    TriangleMesh &ComputeVertexNormals(bool normalized = true);
+
+    /// \brief Merges the vertices with exactly equal coordinates.
+    ///
+    /// The attributes of the first of the merged vertices are kept, and the
+    /// vertices stay in the order of their first occurrence.
+    TriangleMesh &RemoveDuplicatedVertices();
+
+    /// \brief Removes the vertices that are not referenced by any triangle.
+    ///
+    /// The remaining vertices keep their order.
+    TriangleMesh &RemoveUnreferencedVertices();
+
+    /// \brief Removes the triangles that reference a vertex more than once.
+    ///
+    /// The remaining triangles keep their order, along with their attributes.
+    TriangleMesh &RemoveDegenerateTriangles();
+
+    /// \brief Samples points uniformly on the surface of the mesh.
+    ///
+    /// The points are sampled on the device of the mesh, and the number of
+    /// points on each triangle is proportional to its area. Vertex normals
+    /// and colors are interpolated.
+    /// \param number_of_points Number of points to sample.
+    /// \param use_triangle_normal If true, the points get the normals of
+    /// their triangles instead of the interpolated vertex normals.
+    /// \param seed Seed of the random generator, -1 to use a random seed.
+    PointCloud SamplePointsUniformly(size_t number_of_points,
+                                     bool use_triangle_normal = false,
+                                     int seed = -1) const;
+
+    /// \brief Samples points on the surface of the mesh with Poisson disk
+    /// sampling.
+    ///
+    /// Like the legacy method, samples \p init_factor times more points
+    /// uniformly and eliminates samples until \p number_of_points remain
+    /// (Yuksel, "Sample Elimination for Generating Poisson Disk Sample Sets",
+    /// EUROGRAPHICS 2015). Runs on the device of the mesh, eliminating the
+    /// locally heaviest samples in parallel rounds.
+    /// \param number_of_points Number of points to sample.
+    /// \param init_factor Factor for the number of initial uniform samples.
+    /// \param use_triangle_normal If true, the points get the normals of
+    /// their triangles instead of the interpolated vertex normals.
+    /// \param seed Seed of the random generator, -1 to use a random seed.
+    PointCloud SamplePointsPoissonDisk(size_t number_of_points,
+                                       double init_factor = 5,
+                                       bool use_triangle_normal = false,
+                                       int seed = -1) const;
+
+    /// \brief Simplifies the mesh by merging the vertices in each voxel of a
+    /// uniform grid into their average.
+    ///
+    /// Runs on the device of the mesh. Floating point vertex attributes, e.g.
+    /// normals and colors, are averaged too, and the others are taken from
+    /// the first vertex of each voxel. Degenerate and duplicated triangles are
+    /// removed. Unlike in the legacy mesh, the triangles are in a
+    /// deterministic order, the one of their first occurrence.
+    /// \param voxel_size Size of the voxels.
+    TriangleMesh SimplifyVertexClustering(double voxel_size) const;
+
+    /// \brief Computes the distance from each query point to the surface of
+    /// the mesh.
+    ///
+    /// A bounding volume hierarchy over the triangles is built on the host
+    /// and traversed on the device of the mesh, one query per thread.
+    /// \param query_points Points of shape {n, 3} with the dtype and device of
+    /// the vertices.
+    /// \return Tuple of the distances of shape {n,} with the dtype of the
+    /// vertices, and the Int64 index of the closest triangle of each point.
+    std::tuple<core::Tensor, core::Tensor> ComputePointDistance(
+            const core::Tensor &query_points) const;
+
+    /// \brief Clusters the triangles connected through shared edges, like
+    /// the legacy geometry::TriangleMesh::ClusterConnectedTriangles.
+    ///
+    /// Runs on the device of the mesh with a parallel union-find over the
+    /// edges, and the clusters are numbered in the order of their first
+    /// triangle.
+    /// \return Tuple of the Int64 cluster of each triangle, of shape {t,},
+    /// the Int64 number of triangles of each cluster, and the surface area of
+    /// each cluster with the dtype of the vertices.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    ClusterConnectedTriangles() const;
+
+    /// Attributes filtered by FilterSharpen and the FilterSmooth functions.
+    using FilterScope = open3d::geometry::MeshBase::FilterScope;
+
+    /// \brief Sharpens the mesh like the legacy
+    /// geometry::TriangleMesh::FilterSharpen.
+    ///
+    /// Runs on the device of the mesh. The vertex adjacency is computed once
+    /// as compressed sparse row arrays, and each iteration updates the
+    /// vertices in parallel.
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param strength Strength of the filter.
+    /// \param scope Vertex attributes to filter.
+    TriangleMesh FilterSharpen(int number_of_iterations = 1,
+                               double strength = 1,
+                               FilterScope scope = FilterScope::All) const;
+
+    /// \brief Smooths the mesh by replacing each vertex with the average of
+    /// itself and its neighbours, like the legacy
+    /// geometry::TriangleMesh::FilterSmoothSimple.
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param scope Vertex attributes to filter.
+    TriangleMesh FilterSmoothSimple(int number_of_iterations = 1,
+                                    FilterScope scope = FilterScope::All) const;
+
+    /// \brief Smooths the mesh with the Laplacian filter of the legacy
+    /// geometry::TriangleMesh::FilterSmoothLaplacian, whose neighbours are
+    /// weighted by their inverse distance.
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param lambda Filter parameter.
+    /// \param scope Vertex attributes to filter.
+    TriangleMesh FilterSmoothLaplacian(
+            int number_of_iterations = 1,
+            double lambda = 0.5,
+            FilterScope scope = FilterScope::All) const;
+
+    /// \brief Smooths the mesh with the Taubin filter of the legacy
+    /// geometry::TriangleMesh::FilterSmoothTaubin, which alternates Laplacian
+    /// steps with \p lambda and \p mu to avoid shrinkage.
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param lambda Filter parameter of the smoothing steps.
+    /// \param mu Filter parameter of the inflating steps.
+    /// \param scope Vertex attributes to filter.
+    TriangleMesh FilterSmoothTaubin(int number_of_iterations = 1,
+                                    double lambda = 0.5,
+                                    double mu = -0.53,
+                                    FilterScope scope = FilterScope::All) const;
+
+    /// \brief Subdivides each triangle into four at the midpoints of its
+    /// edges, like the legacy geometry::TriangleMesh::SubdivideMidpoint.
+    ///
+    /// Runs on the device of the mesh, and the new vertices are numbered like
+    /// in the legacy mesh. Floating point vertex attributes are interpolated,
+    /// the others are taken from the first vertex of the edge. Triangle
+    /// attributes are copied to the four children, and the triangle normals
+    /// are recomputed.
+    /// \param number_of_iterations Number of subdivisions.
+    TriangleMesh SubdivideMidpoint(int number_of_iterations = 1) const;
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
@@ -422,16 +581,43 @@ public:
     /// \param int_dtype Int32 or Int64, used to store index values, e.g.
     /// triangles.
     /// \param device The device where the resulting TriangleMesh resides in.
+    /// \param copy If false, attributes whose dtype matches the legacy storage
+    /// (Float64 values, Int32 triangles) on CPU:0 alias \p mesh_legacy without
+    /// copying. \p mesh_legacy must then outlive the returned TriangleMesh and
+    /// must not be resized.
     static geometry::TriangleMesh FromLegacyTriangleMesh(
             const open3d::geometry::TriangleMesh &mesh_legacy,
             core::Dtype float_dtype = core::Dtype::Float32,
             core::Dtype int_dtype = core::Dtype::Int64,
+            const core::Device &device = core::Device("CPU:0"),
+            bool copy = true);
+
+    /// Create a TriangleMesh from a legacy Open3D TriangleMesh, taking over
+    /// the storage of the attributes whose dtype matches the legacy storage
+    /// (Float64 values, Int32 triangles) on CPU:0 without copying.
+    static geometry::TriangleMesh FromLegacyTriangleMesh(
+            open3d::geometry::TriangleMesh &&mesh_legacy,
+            core::Dtype float_dtype = core::Dtype::Float32,
+            core::Dtype int_dtype = core::Dtype::Int64,
             const core::Device &device = core::Device("CPU:0"));
 
     /// Convert to a legacy Open3D TriangleMesh.
-    open3d::geometry::TriangleMesh ToLegacyTriangleMesh() const;
+    open3d::geometry::TriangleMesh ToLegacyTriangleMesh() const &;
+
+    /// Convert to a legacy Open3D TriangleMesh. Attributes that took over the
+    /// storage of a legacy TriangleMesh and are not shared with other tensors
+    /// are moved back without copying.
+    open3d::geometry::TriangleMesh ToLegacyTriangleMesh() &&;
 
 protected:
+    /// \brief Keeps the vertices at \p indices, in that order, in all vertex
+    /// attributes, and renumbers the triangles.
+    ///
+    /// \param indices Int64 indices of the kept vertices, of shape (M,).
+    /// \param vertex_map Int64 new index of each old vertex, of shape (N,).
+    void SelectVertices(const core::Tensor &indices,
+                        const core::Tensor &vertex_map);
+
     core::Device device_ = core::Device("CPU:0");
     TensorMap vertex_attr_;
     TensorMap triangle_attr_;
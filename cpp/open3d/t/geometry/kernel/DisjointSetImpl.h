@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#if !defined(__CUDACC__)
+#include <atomic>
+#endif
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+
+// Lock-free union-find shared by the CPU and CUDA kernels, e.g. DBSCAN and
+// connected components. Roots are always linked below smaller roots, so the
+// root of a set is its smallest element regardless of the order of unions.
+// On the CPU the parents are std::atomic<int>, on CUDA plain ints updated
+// with atomicCAS.
+#if defined(__CUDACC__)
+typedef int DisjointSetParent;
+#else
+typedef std::atomic<int> DisjointSetParent;
+#endif
+
+OPEN3D_DEVICE static inline int LoadParent(DisjointSetParent* parents, int x) {
+#if defined(__CUDACC__)
+    return *(volatile int*)(parents + x);
+#else
+    return parents[x].load(std::memory_order_relaxed);
+#endif
+}
+
+OPEN3D_DEVICE static inline void StoreParent(DisjointSetParent* parents,
+                                             int x,
+                                             int parent) {
+#if defined(__CUDACC__)
+    *(volatile int*)(parents + x) = parent;
+#else
+    parents[x].store(parent, std::memory_order_relaxed);
+#endif
+}
+
+OPEN3D_DEVICE static inline bool CompareAndSwapParent(
+        DisjointSetParent* parents, int x, int expected, int parent) {
+#if defined(__CUDACC__)
+    return atomicCAS(parents + x, expected, parent) == expected;
+#else
+    return parents[x].compare_exchange_strong(expected, parent);
+#endif
+}
+
+OPEN3D_DEVICE static inline int FindRoot(DisjointSetParent* parents, int x) {
+    int parent = LoadParent(parents, x);
+    while (parent != x) {
+        // Path halving. Racing writes only ever store an ancestor.
+        int grandparent = LoadParent(parents, parent);
+        StoreParent(parents, x, grandparent);
+        x = grandparent;
+        parent = LoadParent(parents, x);
+    }
+    return x;
+}
+
+OPEN3D_DEVICE static inline void UnionSets(DisjointSetParent* parents,
+                                           int a,
+                                           int b) {
+    while (true) {
+        a = FindRoot(parents, a);
+        b = FindRoot(parents, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            int tmp = a;
+            a = b;
+            b = tmp;
+        }
+        // Fails if a stopped being a root in the meantime.
+        if (CompareAndSwapParent(parents, a, a, b)) {
+            return;
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
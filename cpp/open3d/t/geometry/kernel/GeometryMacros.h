@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 
 #include "open3d/core/CUDAUtils.h"
 
@@ -63,6 +64,26 @@ OPEN3D_HOST_DEVICE inline int sign(int x) {
     return (x > 0) ? 1 : ((x < 0) ? -1 : 0);
 }
 
+/// Spreads the lower 21 bits of \p x so that two zero bits separate each of
+/// them, for interleaving into a 63-bit Morton code.
+OPEN3D_HOST_DEVICE inline uint64_t MortonSplitBy3(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+/// Returns the Morton code interleaving three 21-bit grid coordinates.
+OPEN3D_HOST_DEVICE inline uint64_t MortonCode3D(uint64_t x,
+                                                uint64_t y,
+                                                uint64_t z) {
+    return MortonSplitBy3(x) | MortonSplitBy3(y) << 1 |
+           MortonSplitBy3(z) << 2;
+}
+
 namespace {
 OPEN3D_DEVICE
 const int edge_table[256] = {
@@ -33,6 +33,115 @@ namespace geometry {
 namespace kernel {
 namespace image {
 
+void To(const core::Tensor &src,
+        core::Tensor &dst,
+        double scale,
+        double offset) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ToCPU(src, dst, scale, offset);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ToCUDA, src, dst, scale, offset);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RGBToGray(const core::Tensor &src, core::Tensor &dst) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        RGBToGrayCPU(src, dst);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RGBToGrayCUDA, src, dst);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Resize(const core::Tensor &src,
+            core::Tensor &dst,
+            InterpType interp_type) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ResizeCPU(src, dst, interp_type);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ResizeCUDA, src, dst, interp_type);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Dilate(const core::Tensor &src, core::Tensor &dst, int kernel_size) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        DilateCPU(src, dst, kernel_size);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(DilateCUDA, src, dst, kernel_size);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Filter(const core::Tensor &src,
+            core::Tensor &dst,
+            const core::Tensor &kernel) {
+    core::Device device = src.GetDevice();
+    core::Tensor kernel_d =
+            kernel.To(device, core::Dtype::Float32).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterCPU(src, dst, kernel_d);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterCUDA, src, dst, kernel_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_x,
+                     const core::Tensor &kernel_y) {
+    core::Device device = src.GetDevice();
+    core::Tensor kernel_x_d =
+            kernel_x.To(device, core::Dtype::Float32).Contiguous();
+    core::Tensor kernel_y_d =
+            kernel_y.To(device, core::Dtype::Float32).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterSeparableCPU(src, dst, kernel_x_d, kernel_y_d);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSeparableCUDA, src, dst, kernel_x_d, kernel_y_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterBilateral(const core::Tensor &src,
+                     core::Tensor &dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterBilateralCPU(src, dst, kernel_size, value_sigma, distance_sigma);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterBilateralCUDA, src, dst, kernel_size, value_sigma,
+                  distance_sigma);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void PyrDown(const core::Tensor &src, core::Tensor &dst) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        PyrDownCPU(src, dst);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(PyrDownCUDA, src, dst);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void ClipTransform(const core::Tensor &src,
                    core::Tensor &dst,
                    float scale,
@@ -110,6 +219,32 @@ void ColorizeDepth(const core::Tensor &src,
     }
 }
 
+void AlignDepth(const core::Tensor &src,
+                core::Tensor &dst,
+                const core::Tensor &src_intrinsics,
+                const core::Tensor &dst_intrinsics,
+                const core::Tensor &src_to_dst,
+                float depth_scale) {
+    core::Device device = src.GetDevice();
+    static const core::Device host("CPU:0");
+
+    core::Tensor src_intrinsics_d =
+            src_intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor dst_intrinsics_d =
+            dst_intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor src_to_dst_d =
+            src_to_dst.To(host, core::Dtype::Float64).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        AlignDepthCPU(src, dst, src_intrinsics_d, dst_intrinsics_d,
+                      src_to_dst_d, depth_scale);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(AlignDepthCUDA, src, dst, src_intrinsics_d, dst_intrinsics_d,
+                  src_to_dst_d, depth_scale);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
@@ -34,6 +34,48 @@ namespace geometry {
 namespace kernel {
 namespace image {
 
+void To(const core::Tensor &src,
+        core::Tensor &dst,
+        double scale,
+        double offset);
+
+void RGBToGray(const core::Tensor &src, core::Tensor &dst);
+
+/// Interpolation methods of Resize. The values match Image::InterpType.
+enum class InterpType {
+    Nearest = 0,
+    Linear = 1,
+    Cubic = 2,
+    Lanczos = 3,
+    Super = 4
+};
+
+void Resize(const core::Tensor &src, core::Tensor &dst, InterpType interp_type);
+
+void Dilate(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void Filter(const core::Tensor &src,
+            core::Tensor &dst,
+            const core::Tensor &kernel);
+
+/// Correlates each row with \p kernel_x and then each column with
+/// \p kernel_y. The border pixels are repeated. \p dst may have a different
+/// dtype than \p src, and the values are rounded and saturated to it.
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_x,
+                     const core::Tensor &kernel_y);
+
+void FilterBilateral(const core::Tensor &src,
+                     core::Tensor &dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma);
+
+/// Gaussian filter (kernel_size = 5, sigma = 1.0) evaluated only at the even
+/// pixels, i.e. a fused FilterGaussian and Resize by 0.5.
+void PyrDown(const core::Tensor &src, core::Tensor &dst);
+
 void ClipTransform(const core::Tensor &src,
                    core::Tensor &dst,
                    float scale,
@@ -61,6 +103,43 @@ void ColorizeDepth(const core::Tensor &src,
                    float min_value,
                    float max_value);
 
+void AlignDepth(const core::Tensor &src,
+                core::Tensor &dst,
+                const core::Tensor &src_intrinsics,
+                const core::Tensor &dst_intrinsics,
+                const core::Tensor &src_to_dst,
+                float depth_scale);
+
+void ToCPU(const core::Tensor &src,
+           core::Tensor &dst,
+           double scale,
+           double offset);
+
+void RGBToGrayCPU(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               InterpType interp_type);
+
+void DilateCPU(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void FilterCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &kernel);
+
+void FilterSeparableCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        const core::Tensor &kernel_x,
+                        const core::Tensor &kernel_y);
+
+void FilterBilateralCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma);
+
+void PyrDownCPU(const core::Tensor &src, core::Tensor &dst);
+
 void ClipTransformCPU(const core::Tensor &src,
                       core::Tensor &dst,
                       float scale,
@@ -88,7 +167,44 @@ void ColorizeDepthCPU(const core::Tensor &src,
                       float min_value,
                       float max_value);
 
+void AlignDepthCPU(const core::Tensor &src,
+                   core::Tensor &dst,
+                   const core::Tensor &src_intrinsics,
+                   const core::Tensor &dst_intrinsics,
+                   const core::Tensor &src_to_dst,
+                   float depth_scale);
+
 #ifdef BUILD_CUDA_MODULE
+void ToCUDA(const core::Tensor &src,
+            core::Tensor &dst,
+            double scale,
+            double offset);
+
+void RGBToGrayCUDA(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeCUDA(const core::Tensor &src,
+                core::Tensor &dst,
+                InterpType interp_type);
+
+void DilateCUDA(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void FilterCUDA(const core::Tensor &src,
+                core::Tensor &dst,
+                const core::Tensor &kernel);
+
+void FilterSeparableCUDA(const core::Tensor &src,
+                         core::Tensor &dst,
+                         const core::Tensor &kernel_x,
+                         const core::Tensor &kernel_y);
+
+void FilterBilateralCUDA(const core::Tensor &src,
+                         core::Tensor &dst,
+                         int kernel_size,
+                         float value_sigma,
+                         float distance_sigma);
+
+void PyrDownCUDA(const core::Tensor &src, core::Tensor &dst);
+
 void ClipTransformCUDA(const core::Tensor &src,
                        core::Tensor &dst,
                        float scale,
@@ -116,6 +232,13 @@ void ColorizeDepthCUDA(const core::Tensor &src,
                        float min_value,
                        float max_value);
 
+void AlignDepthCUDA(const core::Tensor &src,
+                    core::Tensor &dst,
+                    const core::Tensor &src_intrinsics,
+                    const core::Tensor &dst_intrinsics,
+                    const core::Tensor &src_to_dst,
+                    float depth_scale);
+
 #endif
 }  // namespace image
 }  // namespace kernel
@@ -24,11 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/Image.h"
 
 namespace open3d {
 namespace t {
@@ -36,6 +41,52 @@ namespace geometry {
 namespace kernel {
 namespace image {
 
+/// Rounds \p v to the nearest value of an integer type \p T and clamps it to
+/// the range of \p T. Floating point types are converted directly.
+template <typename T, typename V>
+OPEN3D_HOST_DEVICE inline T SaturateCast(V v) {
+    if (std::is_floating_point<T>::value) {
+        return static_cast<T>(v);
+    }
+    if (v != v) {
+        return static_cast<T>(0);
+    }
+    v = rint(v);
+    const V lowest = static_cast<V>(std::numeric_limits<T>::lowest());
+    const V highest = static_cast<V>(std::numeric_limits<T>::max());
+    return static_cast<T>(v < lowest ? lowest : (v > highest ? highest : v));
+}
+
+/// Clamps \p i to [0, n), i.e. repeats the border pixels.
+OPEN3D_HOST_DEVICE inline int64_t ClampIndex(int64_t i, int64_t n) {
+    return i < 0 ? 0 : (i >= n ? n - 1 : i);
+}
+
+/// Weight of a source pixel at distance \p t for Linear, Cubic (Catmull-Rom)
+/// and Lanczos (a = 3) interpolation.
+OPEN3D_HOST_DEVICE inline float InterpWeight(InterpType interp_type, float t) {
+    t = t < 0 ? -t : t;
+    if (interp_type == InterpType::Cubic) {
+        if (t < 1) {
+            return (1.5f * t - 2.5f) * t * t + 1;
+        }
+        if (t < 2) {
+            return ((-0.5f * t + 2.5f) * t - 4) * t + 2;
+        }
+        return 0;
+    } else if (interp_type == InterpType::Lanczos) {
+        if (t < 1e-6f) {
+            return 1;
+        }
+        if (t >= 3) {
+            return 0;
+        }
+        float pi_t = 3.14159265f * t;
+        return 3 * sin(pi_t) * sin(pi_t / 3) / (pi_t * pi_t);
+    }
+    return t < 1 ? 1 - t : 0;
+}
+
 #ifdef __CUDACC__
 void ClipTransformCUDA
 #else
@@ -305,6 +356,631 @@ void ColorizeDepthCPU
     });
 }
 
+#ifdef __CUDACC__
+void AlignDepthCUDA
+#else
+void AlignDepthCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& src_intrinsics,
+         const core::Tensor& dst_intrinsics,
+         const core::Tensor& src_to_dst,
+         float depth_scale) {
+    // Nearest depth of each destination pixel. UInt32 such that it can be
+    // updated with an atomic min.
+    core::Tensor nearest = core::Tensor::Full(
+            {dst.GetShape(0), dst.GetShape(1)},
+            std::numeric_limits<uint32_t>::max(), core::Dtype::UInt32,
+            src.GetDevice());
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer nearest_indexer(nearest, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+    TransformIndexer src_ti(src_intrinsics, src_to_dst);
+    TransformIndexer dst_ti(dst_intrinsics,
+                            core::Tensor::Eye(4, core::Dtype::Float64,
+                                              core::Device("CPU:0")));
+
+    int64_t src_cols = src.GetShape(1);
+    int64_t dst_rows = dst.GetShape(0);
+    int64_t dst_cols = dst.GetShape(1);
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(
+            src.GetShape(0) * src_cols,
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t y = workload_idx / src_cols;
+                int64_t x = workload_idx % src_cols;
+                uint16_t d = *src_indexer.GetDataPtrFromCoord<uint16_t>(x, y);
+                if (d == 0) {
+                    return;
+                }
+
+                // Project the opposite corners of the pixel, such that the
+                // depth covers the pixels of the footprint of the source
+                // pixel, as in librealsense.
+                float z = d / depth_scale;
+                float u[2], v[2], z_dst = 0;
+                for (int k = 0; k < 2; ++k) {
+                    float x_src, y_src, z_src, x_dst, y_dst;
+                    src_ti.Unproject(x - 0.5f + k, y - 0.5f + k, z, &x_src,
+                                     &y_src, &z_src);
+                    src_ti.RigidTransform(x_src, y_src, z_src, &x_dst, &y_dst,
+                                          &z_dst);
+                    if (z_dst <= 0) {
+                        return;
+                    }
+                    dst_ti.Project(x_dst, y_dst, z_dst, &u[k], &v[k]);
+                }
+                uint32_t value =
+                        static_cast<uint32_t>(rintf(z_dst * depth_scale));
+                if (value == 0 || value > 65535) {
+                    return;
+                }
+
+                // Pixels whose center is in the footprint, or the pixel of
+                // the center of a footprint smaller than a pixel.
+                int64_t u_min = static_cast<int64_t>(ceilf(fminf(u[0], u[1])));
+                int64_t u_max = static_cast<int64_t>(floorf(fmaxf(u[0], u[1])));
+                int64_t v_min = static_cast<int64_t>(ceilf(fminf(v[0], v[1])));
+                int64_t v_max = static_cast<int64_t>(floorf(fmaxf(v[0], v[1])));
+                if (u_min > u_max) {
+                    u_min = u_max =
+                            static_cast<int64_t>(rintf(0.5f * (u[0] + u[1])));
+                }
+                if (v_min > v_max) {
+                    v_min = v_max =
+                            static_cast<int64_t>(rintf(0.5f * (v[0] + v[1])));
+                }
+                u_min = u_min < 0 ? 0 : u_min;
+                v_min = v_min < 0 ? 0 : v_min;
+                u_max = u_max >= dst_cols ? dst_cols - 1 : u_max;
+                v_max = v_max >= dst_rows ? dst_rows - 1 : v_max;
+                for (int64_t v_dst = v_min; v_dst <= v_max; ++v_dst) {
+                    for (int64_t u_dst = u_min; u_dst <= u_max; ++u_dst) {
+                        uint32_t* ptr =
+                                nearest_indexer.GetDataPtrFromCoord<uint32_t>(
+                                        u_dst, v_dst);
+#if defined(__CUDACC__)
+                        atomicMin(ptr, value);
+#else
+                        std::atomic<uint32_t>* nearest_value =
+                                reinterpret_cast<std::atomic<uint32_t>*>(ptr);
+                        uint32_t old = nearest_value->load();
+                        while (value < old &&
+                               !nearest_value->compare_exchange_weak(old,
+                                                                     value)) {
+                        }
+#endif
+                    }
+                }
+            });
+
+    launcher.LaunchGeneralKernel(
+            dst_rows * dst_cols, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t y = workload_idx / dst_cols;
+                int64_t x = workload_idx % dst_cols;
+                uint32_t value =
+                        *nearest_indexer.GetDataPtrFromCoord<uint32_t>(x, y);
+                *dst_indexer.GetDataPtrFromCoord<uint16_t>(x, y) =
+                        value == std::numeric_limits<uint32_t>::max()
+                                ? 0
+                                : static_cast<uint16_t>(value);
+            });
+}
+
+#ifdef __CUDACC__
+void ToCUDA
+#else
+void ToCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         double scale,
+         double offset) {
+    int64_t n = src.NumElements();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using src_t = scalar_t;
+        const src_t* src_ptr = src.GetDataPtr<src_t>();
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst.GetDtype(), [&]() {
+            using dst_t = scalar_t;
+            dst_t* dst_ptr = dst.GetDataPtr<dst_t>();
+            launcher.LaunchGeneralKernel(
+                    n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        double in = static_cast<double>(src_ptr[workload_idx]);
+                        dst_ptr[workload_idx] =
+                                SaturateCast<dst_t>(in * scale + offset);
+                    });
+        });
+    });
+}
+
+#ifdef __CUDACC__
+void RGBToGrayCUDA
+#else
+void RGBToGrayCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t n = rows * cols;
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols;
+                    int64_t x = workload_idx % cols;
+
+                    const scalar_t* in =
+                            src_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+                    float gray = 0.299f * static_cast<float>(in[0]) +
+                                 0.587f * static_cast<float>(in[1]) +
+                                 0.114f * static_cast<float>(in[2]);
+                    *dst_indexer.GetDataPtrFromCoord<scalar_t>(x, y) =
+                            SaturateCast<scalar_t>(gray);
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void ResizeCUDA
+#else
+void ResizeCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst, InterpType interp_type) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t rows_dst = dst.GetShape(0);
+    int64_t cols_dst = dst.GetShape(1);
+    int64_t n = rows_dst * cols_dst;
+
+    // Size of a destination pixel in source pixels.
+    float scale_y = static_cast<float>(rows) / rows_dst;
+    float scale_x = static_cast<float>(cols) / cols_dst;
+
+    // Area averaging is only defined for downsampling.
+    if (interp_type == InterpType::Super && (scale_y < 1 || scale_x < 1)) {
+        interp_type = InterpType::Linear;
+    }
+    int64_t radius = interp_type == InterpType::Lanczos
+                             ? 3
+                             : (interp_type == InterpType::Cubic ? 2 : 1);
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            int64_t y = workload_idx / cols_dst;
+            int64_t x = workload_idx % cols_dst;
+            scalar_t* out = dst_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+
+            if (interp_type == InterpType::Nearest) {
+                int64_t y_src =
+                        ClampIndex(static_cast<int64_t>(y * scale_y), rows);
+                int64_t x_src =
+                        ClampIndex(static_cast<int64_t>(x * scale_x), cols);
+                const scalar_t* in =
+                        src_indexer.GetDataPtrFromCoord<scalar_t>(x_src, y_src);
+                for (int64_t c = 0; c < channels; ++c) {
+                    out[c] = in[c];
+                }
+            } else if (interp_type == InterpType::Super) {
+                // Average of the source pixels covered by the destination
+                // pixel, weighted by the covered area.
+                float y0 = y * scale_y;
+                float y1 = y0 + scale_y;
+                float x0 = x * scale_x;
+                float x1 = x0 + scale_x;
+                int64_t yk_max =
+                        ClampIndex(static_cast<int64_t>(ceil(y1)) - 1, rows);
+                int64_t xk_max =
+                        ClampIndex(static_cast<int64_t>(ceil(x1)) - 1, cols);
+                for (int64_t c = 0; c < channels; ++c) {
+                    float sum = 0;
+                    for (int64_t yk = static_cast<int64_t>(y0); yk <= yk_max;
+                         ++yk) {
+                        float wy = (y1 < yk + 1 ? y1 : yk + 1) -
+                                   (y0 > yk ? y0 : yk);
+                        for (int64_t xk = static_cast<int64_t>(x0);
+                             xk <= xk_max; ++xk) {
+                            float wx = (x1 < xk + 1 ? x1 : xk + 1) -
+                                       (x0 > xk ? x0 : xk);
+                            if (wy > 0 && wx > 0) {
+                                const scalar_t* in =
+                                        src_indexer.GetDataPtrFromCoord<
+                                                scalar_t>(xk, yk);
+                                sum += wy * wx * static_cast<float>(in[c]);
+                            }
+                        }
+                    }
+                    out[c] = SaturateCast<scalar_t>(sum / (scale_y * scale_x));
+                }
+            } else {
+                // Pixel centers are aligned between the two images.
+                float y_center = (y + 0.5f) * scale_y - 0.5f;
+                float x_center = (x + 0.5f) * scale_x - 0.5f;
+                int64_t y_base = static_cast<int64_t>(floor(y_center));
+                int64_t x_base = static_cast<int64_t>(floor(x_center));
+                for (int64_t c = 0; c < channels; ++c) {
+                    float sum = 0;
+                    float w_sum = 0;
+                    for (int64_t yk = y_base - radius + 1;
+                         yk <= y_base + radius; ++yk) {
+                        float wy = InterpWeight(interp_type, y_center - yk);
+                        for (int64_t xk = x_base - radius + 1;
+                             xk <= x_base + radius; ++xk) {
+                            float w = wy * InterpWeight(interp_type,
+                                                        x_center - xk);
+                            const scalar_t* in =
+                                    src_indexer.GetDataPtrFromCoord<scalar_t>(
+                                            ClampIndex(xk, cols),
+                                            ClampIndex(yk, rows));
+                            sum += w * static_cast<float>(in[c]);
+                            w_sum += w;
+                        }
+                    }
+                    out[c] = SaturateCast<scalar_t>(sum / w_sum);
+                }
+            }
+        });
+    });
+}
+
+#ifdef __CUDACC__
+void DilateCUDA
+#else
+void DilateCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst, int kernel_size) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t n = rows * cols;
+    int64_t radius = kernel_size / 2;
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols;
+                    int64_t x = workload_idx % cols;
+
+                    // The window is clipped at the borders, which is the same
+                    // as repeating the border pixels for a maximum.
+                    int64_t y_min = y - radius < 0 ? 0 : y - radius;
+                    int64_t y_max = y + radius >= rows ? rows - 1 : y + radius;
+                    int64_t x_min = x - radius < 0 ? 0 : x - radius;
+                    int64_t x_max = x + radius >= cols ? cols - 1 : x + radius;
+
+                    scalar_t* out =
+                            dst_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        scalar_t v = src_indexer.GetDataPtrFromCoord<scalar_t>(
+                                x, y)[c];
+                        for (int64_t yk = y_min; yk <= y_max; ++yk) {
+                            for (int64_t xk = x_min; xk <= x_max; ++xk) {
+                                scalar_t u = src_indexer.GetDataPtrFromCoord<
+                                        scalar_t>(xk, yk)[c];
+                                v = u > v ? u : v;
+                            }
+                        }
+                        out[c] = v;
+                    }
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void FilterCUDA
+#else
+void FilterCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t n = rows * cols;
+
+    const float* kernel_ptr = kernel.GetDataPtr<float>();
+    int64_t kernel_rows = kernel.GetShape(0);
+    int64_t kernel_cols = kernel.GetShape(1);
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols;
+                    int64_t x = workload_idx % cols;
+
+                    scalar_t* out =
+                            dst_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        float sum = 0;
+                        for (int64_t i = 0; i < kernel_rows; ++i) {
+                            int64_t yk =
+                                    ClampIndex(y + i - kernel_rows / 2, rows);
+                            for (int64_t j = 0; j < kernel_cols; ++j) {
+                                int64_t xk = ClampIndex(
+                                        x + j - kernel_cols / 2, cols);
+                                sum += kernel_ptr[i * kernel_cols + j] *
+                                       static_cast<float>(
+                                               src_indexer.GetDataPtrFromCoord<
+                                                       scalar_t>(xk, yk)[c]);
+                            }
+                        }
+                        out[c] = SaturateCast<scalar_t>(sum);
+                    }
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void FilterSeparableCUDA
+#else
+void FilterSeparableCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel_x,
+         const core::Tensor& kernel_y) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t n = rows * cols;
+
+    // The rows are filtered into a Float32 buffer, so that only the final
+    // values are rounded.
+    core::Tensor buffer = core::Tensor::Empty({rows, cols, channels},
+                                              core::Dtype::Float32,
+                                              src.GetDevice());
+
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer buffer_indexer(buffer, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const float* kernel_x_ptr = kernel_x.GetDataPtr<float>();
+    const float* kernel_y_ptr = kernel_y.GetDataPtr<float>();
+    int64_t kernel_x_size = kernel_x.NumElements();
+    int64_t kernel_y_size = kernel_y.NumElements();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols;
+                    int64_t x = workload_idx % cols;
+
+                    float* out =
+                            buffer_indexer.GetDataPtrFromCoord<float>(x, y);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        float sum = 0;
+                        for (int64_t j = 0; j < kernel_x_size; ++j) {
+                            int64_t xk = ClampIndex(x + j - kernel_x_size / 2,
+                                                    cols);
+                            sum += kernel_x_ptr[j] *
+                                   static_cast<float>(
+                                           src_indexer.GetDataPtrFromCoord<
+                                                   scalar_t>(xk, y)[c]);
+                        }
+                        out[c] = sum;
+                    }
+                });
+    });
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols;
+                    int64_t x = workload_idx % cols;
+
+                    scalar_t* out =
+                            dst_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        float sum = 0;
+                        for (int64_t i = 0; i < kernel_y_size; ++i) {
+                            int64_t yk = ClampIndex(y + i - kernel_y_size / 2,
+                                                    rows);
+                            sum += kernel_y_ptr[i] *
+                                   buffer_indexer.GetDataPtrFromCoord<float>(
+                                           x, yk)[c];
+                        }
+                        out[c] = SaturateCast<scalar_t>(sum);
+                    }
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void FilterBilateralCUDA
+#else
+void FilterBilateralCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         int kernel_size,
+         float value_sigma,
+         float distance_sigma) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t n = rows * cols;
+    if (channels > 4) {
+        utility::LogError(
+                "FilterBilateral supports at most 4 channels, but got {}.",
+                channels);
+    }
+
+    // Round window of radius floor(kernel_size / 2). The value distance is
+    // the L1 norm over the channels.
+    int64_t radius = kernel_size / 2;
+    float value_coeff = -0.5f / (value_sigma * value_sigma);
+    float distance_coeff = -0.5f / (distance_sigma * distance_sigma);
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            int64_t y = workload_idx / cols;
+            int64_t x = workload_idx % cols;
+
+            const scalar_t* center =
+                    src_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+            float sum[4] = {0, 0, 0, 0};
+            float w_sum = 0;
+            for (int64_t dy = -radius; dy <= radius; ++dy) {
+                for (int64_t dx = -radius; dx <= radius; ++dx) {
+                    int64_t d2 = dx * dx + dy * dy;
+                    if (d2 > radius * radius) {
+                        continue;
+                    }
+                    const scalar_t* v =
+                            src_indexer.GetDataPtrFromCoord<scalar_t>(
+                                    ClampIndex(x + dx, cols),
+                                    ClampIndex(y + dy, rows));
+                    float diff = 0;
+                    for (int64_t c = 0; c < channels; ++c) {
+                        float d = static_cast<float>(v[c]) -
+                                  static_cast<float>(center[c]);
+                        diff += d < 0 ? -d : d;
+                    }
+                    float w = exp(distance_coeff * d2 +
+                                  value_coeff * diff * diff);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        sum[c] += w * static_cast<float>(v[c]);
+                    }
+                    w_sum += w;
+                }
+            }
+
+            scalar_t* out = dst_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+            for (int64_t c = 0; c < channels; ++c) {
+                out[c] = SaturateCast<scalar_t>(sum[c] / w_sum);
+            }
+        });
+    });
+}
+
+#ifdef __CUDACC__
+void PyrDownCUDA
+#else
+void PyrDownCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t rows_down = dst.GetShape(0);
+    int64_t cols_down = dst.GetShape(1);
+    int64_t n = rows_down * cols_down;
+
+    // Gaussian filter weights (kernel_size = 5, sigma = 1.0) at distance 0, 1
+    // and 2.
+    const float gweight_1 = std::exp(-0.5f);
+    const float gweight_2 = std::exp(-2.0f);
+    const float gweight_sum = 1 + 2 * gweight_1 + 2 * gweight_2;
+    const float gweights[3] = {1 / gweight_sum, gweight_1 / gweight_sum,
+                               gweight_2 / gweight_sum};
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols_down;
+                    int64_t x = workload_idx % cols_down;
+
+                    int64_t y_src = 2 * y;
+                    int64_t x_src = 2 * x;
+
+                    scalar_t* out =
+                            dst_indexer.GetDataPtrFromCoord<scalar_t>(x, y);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        float sum = 0;
+                        for (int64_t dy = -2; dy <= 2; ++dy) {
+                            int64_t yk = ClampIndex(y_src + dy, rows);
+                            float wy = gweights[dy < 0 ? -dy : dy];
+                            for (int64_t dx = -2; dx <= 2; ++dx) {
+                                int64_t xk = ClampIndex(x_src + dx, cols);
+                                sum += wy * gweights[dx < 0 ? -dx : dx] *
+                                       static_cast<float>(
+                                               src_indexer.GetDataPtrFromCoord<
+                                                       scalar_t>(xk, yk)[c]);
+                            }
+                        }
+                        out[c] = SaturateCast<scalar_t>(sum);
+                    }
+                });
+    });
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
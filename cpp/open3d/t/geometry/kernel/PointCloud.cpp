@@ -26,6 +26,8 @@
 
 #include "open3d/t/geometry/kernel/PointCloud.h"
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "open3d/core/ShapeUtil.h"
@@ -46,15 +48,39 @@ void Unproject(const core::Tensor& depth,
                const core::Tensor& extrinsics,
                float depth_scale,
                float depth_max,
-               int64_t stride) {
+               int64_t stride,
+               utility::optional<std::reference_wrapper<const core::Tensor>>
+                       undistortion_map) {
     if (image_colors.has_value() != colors.has_value()) {
         utility::LogError(
                 "[Unproject] Both or none of image_colors and colors must have "
                 "values.");
     }
+    if (stride < 1) {
+        utility::LogError("[Unproject] stride must be positive, but got {}.",
+                          stride);
+    }
 
     core::Device device = depth.GetDevice();
     core::Device::DeviceType device_type = device.GetType();
+    if (image_colors.has_value()) {
+        const core::Tensor& colors_image = image_colors.value().get();
+        colors_image.AssertDevice(device);
+        core::Dtype dtype = colors_image.GetDtype();
+        if (dtype != core::Dtype::UInt8 && dtype != core::Dtype::UInt16 &&
+            dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+            utility::LogError(
+                    "[Unproject] Unsupported color dtype {}, expected UInt8, "
+                    "UInt16, Float32 or Float64.",
+                    dtype.ToString());
+        }
+    }
+    if (undistortion_map.has_value()) {
+        const core::Tensor& map = undistortion_map.value().get();
+        map.AssertDevice(device);
+        map.AssertDtype(core::Dtype::Float32);
+        map.AssertShape({depth.GetShape(0), depth.GetShape(1), 2});
+    }
 
     static const core::Device host("CPU:0");
     core::Tensor intrinsics_d =
@@ -64,11 +90,538 @@ void Unproject(const core::Tensor& depth,
 
     if (device_type == core::Device::DeviceType::CPU) {
         UnprojectCPU(depth, image_colors, points, colors, intrinsics_d,
-                     extrinsics_d, depth_scale, depth_max, stride);
+                     extrinsics_d, depth_scale, depth_max, stride,
+                     undistortion_map);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         UnprojectCUDA(depth, image_colors, points, colors, intrinsics_d,
-                      extrinsics_d, depth_scale, depth_max, stride);
+                      extrinsics_d, depth_scale, depth_max, stride,
+                      undistortion_map);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeUndistortionMap(const core::Tensor& intrinsics,
+                            const std::vector<double>& distortion,
+                            int64_t rows,
+                            int64_t cols,
+                            const core::Device& device,
+                            core::Tensor& map) {
+    intrinsics.AssertShape({3, 3});
+    if (distortion.size() > 5) {
+        utility::LogError(
+                "[ComputeUndistortionMap] Expected at most 5 distortion "
+                "coefficients (k1, k2, p1, p2, k3), but got {}.",
+                distortion.size());
+    }
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeUndistortionMapCPU(intrinsics_d, distortion, rows, cols,
+                                  device, map);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeUndistortionMapCUDA(intrinsics_d, distortion, rows, cols,
+                                   device, map);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Project(const core::Tensor& points,
+             utility::optional<std::reference_wrapper<const core::Tensor>>
+                     point_colors,
+             core::Tensor& depth,
+             utility::optional<std::reference_wrapper<core::Tensor>> colors,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t rows,
+             int64_t cols,
+             float depth_scale,
+             float depth_max) {
+    if (point_colors.has_value() != colors.has_value()) {
+        utility::LogError(
+                "[Project] Both or none of point_colors and colors must have "
+                "values.");
+    }
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    points.AssertDtype(core::Dtype::Float32);
+    if (points.GetLength() >= (int64_t(1) << 32)) {
+        utility::LogError(
+                "[Project] Expected less than 2^32 points, but got {}.",
+                points.GetLength());
+    }
+    core::Device device = points.GetDevice();
+    if (point_colors.has_value()) {
+        const core::Tensor& pcd_colors = point_colors.value().get();
+        pcd_colors.AssertDevice(device);
+        pcd_colors.AssertDtype(core::Dtype::Float32);
+        pcd_colors.AssertShape(points.GetShape());
+    }
+    intrinsics.AssertShape({3, 3});
+    extrinsics.AssertShapeCompatible({utility::nullopt, 4, 4});
+    if (rows <= 0 || cols <= 0) {
+        utility::LogError("[Project] Invalid image size {}x{}.", cols, rows);
+    }
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    // The poses of all cameras are read by the kernel on the device.
+    core::Tensor extrinsics_f =
+            extrinsics.To(device, core::Dtype::Float32).Contiguous();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ProjectCPU(points.Contiguous(), point_colors, depth, colors,
+                   intrinsics_d, extrinsics_f, rows, cols, depth_scale,
+                   depth_max);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ProjectCUDA(points.Contiguous(), point_colors, depth, colors,
+                    intrinsics_d, extrinsics_f, rows, cols, depth_scale,
+                    depth_max);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeMortonOrder(const core::Tensor& points, core::Tensor& order) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeMortonOrder] Only Float32 and Float64 points are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeMortonOrderCPU(points.Contiguous(), order);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeMortonOrderCUDA(points.Contiguous(), order);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FarthestPointSample(const core::Tensor& points,
+                         int64_t num_samples,
+                         int64_t start_index,
+                         core::Tensor& indices) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[FarthestPointSample] Only Float32 and Float64 points are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+    int64_t n = points.GetLength();
+    if (n >= (int64_t(1) << 32)) {
+        utility::LogError("[FarthestPointSample] Too many points: {}.", n);
+    }
+    if (num_samples < 0 || num_samples > n) {
+        utility::LogError(
+                "[FarthestPointSample] num_samples must be in [0, {}], but "
+                "got {}.",
+                n, num_samples);
+    }
+    if (num_samples > 0 && (start_index < 0 || start_index >= n)) {
+        utility::LogError(
+                "[FarthestPointSample] start_index {} is out of range [0, "
+                "{}).",
+                start_index, n);
+    }
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FarthestPointSampleCPU(points.Contiguous(), num_samples, start_index,
+                               indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FarthestPointSampleCUDA(points.Contiguous(), num_samples, start_index,
+                                indices);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EstimateNormals(const core::Tensor& points,
+                     const core::Tensor& neighbors,
+                     core::Tensor& normals) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[EstimateNormals] Only Float32 and Float64 points are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+    core::Device device = points.GetDevice();
+    int64_t n = points.GetLength();
+    neighbors.AssertDtype(core::Dtype::Int64);
+    neighbors.AssertDevice(device);
+    neighbors.AssertShapeCompatible({n, utility::nullopt});
+
+    bool has_normals = normals.GetShape() == core::SizeVector{n, 3} &&
+                       normals.GetDtype() == dtype &&
+                       normals.GetDevice() == device;
+    if (has_normals) {
+        normals = normals.Contiguous();
+    } else {
+        normals = core::Tensor({n, 3}, dtype, device);
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateNormalsCPU(points.Contiguous(), neighbors.Contiguous(),
+                           normals, has_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        EstimateNormalsCUDA(points.Contiguous(), neighbors.Contiguous(),
+                            normals, has_normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EstimateColorGradients(const core::Tensor& points,
+                            const core::Tensor& normals,
+                            const core::Tensor& colors,
+                            const core::Tensor& neighbors,
+                            core::Tensor& color_gradients) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[EstimateColorGradients] Only Float32 and Float64 points are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+    core::Device device = points.GetDevice();
+    int64_t n = points.GetLength();
+    normals.AssertShape({n, 3});
+    normals.AssertDtype(dtype);
+    normals.AssertDevice(device);
+    colors.AssertShape({n, 3});
+    colors.AssertDtype(dtype);
+    colors.AssertDevice(device);
+    neighbors.AssertDtype(core::Dtype::Int64);
+    neighbors.AssertDevice(device);
+    neighbors.AssertShapeCompatible({n, utility::nullopt});
+
+    color_gradients = core::Tensor({n, 3}, dtype, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateColorGradientsCPU(points.Contiguous(), normals.Contiguous(),
+                                  colors.Contiguous(), neighbors.Contiguous(),
+                                  color_gradients);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        EstimateColorGradientsCUDA(points.Contiguous(), normals.Contiguous(),
+                                   colors.Contiguous(), neighbors.Contiguous(),
+                                   color_gradients);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ClusterDBSCAN(const core::Tensor& points,
+                   double eps,
+                   int64_t min_points,
+                   core::Tensor& labels) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ClusterDBSCAN] Only Float32 and Float64 points are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+    if (eps <= 0) {
+        utility::LogError("[ClusterDBSCAN] eps must be positive, but got {}.",
+                          eps);
+    }
+    if (points.GetLength() > std::numeric_limits<int>::max()) {
+        utility::LogError("[ClusterDBSCAN] Too many points: {}.",
+                          points.GetLength());
+    }
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClusterDBSCANCPU(points.Contiguous(), eps, min_points, labels);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ClusterDBSCANCUDA(points.Contiguous(), eps, min_points, labels);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+/// Checks the neighbors of a fixed radius search over \p n points.
+static void AssertNeighbors(const core::Tensor& indices,
+                            const core::Tensor& num_neighbors,
+                            int64_t n,
+                            const core::Device& device) {
+    indices.AssertDtype(core::Dtype::Int64);
+    indices.AssertDevice(device);
+    indices.AssertShapeCompatible({utility::nullopt});
+    num_neighbors.AssertDtype(core::Dtype::Int64);
+    num_neighbors.AssertDevice(device);
+    num_neighbors.AssertShape({n});
+}
+
+void ComputeISSSaliency(const core::Tensor& points,
+                        const core::Tensor& indices,
+                        const core::Tensor& num_neighbors,
+                        double gamma_21,
+                        double gamma_32,
+                        int64_t min_neighbors,
+                        core::Tensor& saliency) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeISSSaliency] Only Float32 and Float64 points are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+    core::Device device = points.GetDevice();
+    AssertNeighbors(indices, num_neighbors, points.GetLength(), device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeISSSaliencyCPU(points.Contiguous(), indices.Contiguous(),
+                              num_neighbors.Contiguous(), gamma_21, gamma_32,
+                              min_neighbors, saliency);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeISSSaliencyCUDA(points.Contiguous(), indices.Contiguous(),
+                               num_neighbors.Contiguous(), gamma_21, gamma_32,
+                               min_neighbors, saliency);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SuppressNonMaxima(const core::Tensor& saliency,
+                       const core::Tensor& indices,
+                       const core::Tensor& num_neighbors,
+                       int64_t min_neighbors,
+                       core::Tensor& mask) {
+    saliency.AssertDtype(core::Dtype::Float64);
+    saliency.AssertShapeCompatible({utility::nullopt});
+    core::Device device = saliency.GetDevice();
+    AssertNeighbors(indices, num_neighbors, saliency.GetLength(), device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SuppressNonMaximaCPU(saliency.Contiguous(), indices.Contiguous(),
+                             num_neighbors.Contiguous(), min_neighbors, mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SuppressNonMaximaCUDA(saliency.Contiguous(), indices.Contiguous(),
+                              num_neighbors.Contiguous(), min_neighbors, mask);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+/// Checks the segment ids of \p n points and converts them to Int64.
+static core::Tensor SegmentIdsToInt64(const core::Tensor& segment_ids,
+                                      int64_t n,
+                                      const core::Device& device) {
+    core::Dtype dtype = segment_ids.GetDtype();
+    if (dtype != core::Dtype::Int32 && dtype != core::Dtype::Int64) {
+        utility::LogError(
+                "Only Int32 and Int64 segment ids are supported, but {} is "
+                "used.",
+                dtype.ToString());
+    }
+    segment_ids.AssertDevice(device);
+    segment_ids.AssertShape({n});
+    return segment_ids.To(core::Dtype::Int64).Contiguous();
+}
+
+void ComputeSegmentAxisAlignedBoundingBoxes(const core::Tensor& points,
+                                            const core::Tensor& segment_ids,
+                                            int64_t num_segments,
+                                            core::Tensor& min_bounds,
+                                            core::Tensor& max_bounds) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeSegmentAxisAlignedBoundingBoxes] Only Float32 and "
+                "Float64 points are supported, but {} is used.",
+                dtype.ToString());
+    }
+    core::Device device = points.GetDevice();
+    core::Tensor ids =
+            SegmentIdsToInt64(segment_ids, points.GetLength(), device);
+    num_segments = std::max<int64_t>(num_segments, 0);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeSegmentAxisAlignedBoundingBoxesCPU(points.Contiguous(), ids,
+                                                  num_segments, min_bounds,
+                                                  max_bounds);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeSegmentAxisAlignedBoundingBoxesCUDA(points.Contiguous(), ids,
+                                                   num_segments, min_bounds,
+                                                   max_bounds);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeSegmentOrientedBoundingBoxes(const core::Tensor& points,
+                                         const core::Tensor& segment_ids,
+                                         int64_t num_segments,
+                                         bool minimal,
+                                         core::Tensor& centers,
+                                         core::Tensor& rotations,
+                                         core::Tensor& extents) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeSegmentOrientedBoundingBoxes] Only Float32 and "
+                "Float64 points are supported, but {} is used.",
+                dtype.ToString());
+    }
+    core::Device device = points.GetDevice();
+    core::Tensor ids =
+            SegmentIdsToInt64(segment_ids, points.GetLength(), device);
+    num_segments = std::max<int64_t>(num_segments, 0);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeSegmentOrientedBoundingBoxesCPU(points.Contiguous(), ids,
+                                               num_segments, minimal, centers,
+                                               rotations, extents);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeSegmentOrientedBoundingBoxesCUDA(points.Contiguous(), ids,
+                                                num_segments, minimal, centers,
+                                                rotations, extents);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void TransformSegments(std::vector<core::Tensor>& points,
+                       std::vector<core::Tensor>& normals,
+                       const core::Tensor& transformations) {
+    const int64_t num_segments = static_cast<int64_t>(points.size());
+    transformations.AssertShape({num_segments, 4, 4});
+    if (!normals.empty() && normals.size() != points.size()) {
+        utility::LogError(
+                "[TransformSegments] {} normals are given for {} point "
+                "clouds.",
+                normals.size(), points.size());
+    }
+    if (num_segments == 0) {
+        return;
+    }
+    core::Device device = transformations.GetDevice();
+    core::Dtype dtype = points[0].GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[TransformSegments] Only Float32 and Float64 points are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+
+    // The addresses of the points and normals of each point cloud, and the
+    // offset of its first point among all points.
+    std::vector<int64_t> point_ptrs(num_segments);
+    std::vector<int64_t> normal_ptrs(num_segments, 0);
+    std::vector<int64_t> offsets(num_segments + 1, 0);
+    auto check = [&](const core::Tensor& tensor, int64_t n) {
+        tensor.AssertShape({n, 3});
+        tensor.AssertDtype(dtype);
+        tensor.AssertDevice(device);
+        if (!tensor.IsContiguous()) {
+            utility::LogError(
+                    "[TransformSegments] Tensors must be contiguous.");
+        }
+        return reinterpret_cast<int64_t>(tensor.GetDataPtr());
+    };
+    for (int64_t s = 0; s < num_segments; ++s) {
+        int64_t n = points[s].GetLength();
+        point_ptrs[s] = check(points[s], n);
+        if (!normals.empty() && normals[s].NumElements() > 0) {
+            normal_ptrs[s] = check(normals[s], n);
+        }
+        offsets[s + 1] = offsets[s] + n;
+    }
+    if (offsets[num_segments] == 0) {
+        return;
+    }
+    core::Tensor point_ptrs_t(point_ptrs, {num_segments}, core::Dtype::Int64,
+                              device);
+    core::Tensor normal_ptrs_t(normal_ptrs, {num_segments},
+                               core::Dtype::Int64, device);
+    core::Tensor offsets_t(offsets, {num_segments + 1}, core::Dtype::Int64,
+                           device);
+    core::Tensor transformations_d =
+            transformations.To(core::Dtype::Float64).Contiguous();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        TransformSegmentsCPU(point_ptrs_t, normal_ptrs_t, offsets_t,
+                             transformations_d, dtype);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        TransformSegmentsCUDA(point_ptrs_t, normal_ptrs_t, offsets_t,
+                              transformations_d, dtype);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
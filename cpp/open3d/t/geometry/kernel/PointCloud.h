@@ -27,6 +27,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 
@@ -35,6 +36,28 @@ namespace t {
 namespace geometry {
 namespace kernel {
 namespace pointcloud {
+
+/// \brief Unprojects a depth image, and optionally gathers the colors of an
+/// RGB image, in a single pass.
+///
+/// The depth is scaled, truncated and unprojected, and the colors are
+/// converted to Float32 like t::geometry::Image::To, in the same kernel.
+///
+/// \param depth UInt16 or Float32 depth image of shape (H, W, 1).
+/// \param image_colors Optional UInt8, UInt16, Float32 or Float64 color image
+/// of shape (H, W, 3).
+/// \param points Output Float32 points of shape (N, 3).
+/// \param colors Output Float32 colors of shape (N, 3), if \p image_colors is
+/// given.
+/// \param intrinsics Pinhole camera matrix of shape (3, 3).
+/// \param extrinsics World to camera transformation of shape (4, 4).
+/// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+/// \param depth_max Pixels at \p depth_max or farther are dropped.
+/// \param stride Only pixels whose coordinates are multiples of \p stride
+/// are unprojected.
+/// \param undistortion_map Optional Float32 map of shape (H, W, 2) from each
+/// pixel to its undistorted normalized coordinates (x / z, y / z), see
+/// ComputeUndistortionMap. If given, it replaces the pinhole unprojection.
 void Unproject(const core::Tensor& depth,
                utility::optional<std::reference_wrapper<const core::Tensor>>
                        image_colors,
@@ -44,7 +67,9 @@ void Unproject(const core::Tensor& depth,
                const core::Tensor& extrinsics,
                float depth_scale,
                float depth_max,
-               int64_t stride);
+               int64_t stride,
+               utility::optional<std::reference_wrapper<const core::Tensor>>
+                       undistortion_map = utility::nullopt);
 
 void UnprojectCPU(
         const core::Tensor& depth,
@@ -56,7 +81,9 @@ void UnprojectCPU(
         const core::Tensor& extrinsics,
         float depth_scale,
         float depth_max,
-        int64_t stride);
+        int64_t stride,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                undistortion_map);
 
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
@@ -69,7 +96,440 @@ void UnprojectCUDA(
         const core::Tensor& extrinsics,
         float depth_scale,
         float depth_max,
-        int64_t stride);
+        int64_t stride,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                undistortion_map);
+#endif
+
+/// \brief Computes the undistorted normalized coordinates of each pixel of a
+/// camera with Brown-Conrady lens distortion.
+///
+/// The distortion is inverted per pixel with the fixed point iteration of
+/// OpenCV's undistortPoints, so that unprojecting through the map is a single
+/// lookup.
+///
+/// \param intrinsics Pinhole camera matrix of shape (3, 3).
+/// \param distortion Distortion coefficients (k1, k2, p1, p2, k3). Missing
+/// trailing coefficients are zero.
+/// \param rows Height H of the images.
+/// \param cols Width W of the images.
+/// \param device Device of the map.
+/// \param map Output Float32 map of shape (H, W, 2).
+void ComputeUndistortionMap(const core::Tensor& intrinsics,
+                            const std::vector<double>& distortion,
+                            int64_t rows,
+                            int64_t cols,
+                            const core::Device& device,
+                            core::Tensor& map);
+
+void ComputeUndistortionMapCPU(const core::Tensor& intrinsics,
+                               const std::vector<double>& distortion,
+                               int64_t rows,
+                               int64_t cols,
+                               const core::Device& device,
+                               core::Tensor& map);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeUndistortionMapCUDA(const core::Tensor& intrinsics,
+                                const std::vector<double>& distortion,
+                                int64_t rows,
+                                int64_t cols,
+                                const core::Device& device,
+                                core::Tensor& map);
+#endif
+
+/// \brief Projects points, and optionally their colors, into the depth images
+/// of a batch of cameras with z-buffering.
+///
+/// Each point is projected to its nearest pixel in each camera. Per pixel, the
+/// depth and the index of a point are packed into a 64-bit key, and the
+/// closest point is found with an atomic minimum on the keys. The colors of
+/// the closest points are gathered in a second pass. Pixels without a point
+/// are 0.
+///
+/// \param points Float32 points of shape (N, 3), N < 2^32.
+/// \param point_colors Optional Float32 colors of shape (N, 3).
+/// \param depth Output Float32 depth images of shape (B, H, W, 1), with the
+/// depth multiplied by \p depth_scale.
+/// \param colors Output Float32 color images of shape (B, H, W, 3), if
+/// \p point_colors is given.
+/// \param intrinsics Pinhole camera matrix of shape (3, 3).
+/// \param extrinsics World to camera transformations of shape (B, 4, 4).
+/// \param rows Height H of the images.
+/// \param cols Width W of the images.
+/// \param depth_scale The depth is scaled by \p depth_scale.
+/// \param depth_max Points at \p depth_max or farther are dropped.
+void Project(const core::Tensor& points,
+             utility::optional<std::reference_wrapper<const core::Tensor>>
+                     point_colors,
+             core::Tensor& depth,
+             utility::optional<std::reference_wrapper<core::Tensor>> colors,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t rows,
+             int64_t cols,
+             float depth_scale,
+             float depth_max);
+
+void ProjectCPU(const core::Tensor& points,
+                utility::optional<std::reference_wrapper<const core::Tensor>>
+                        point_colors,
+                core::Tensor& depth,
+                utility::optional<std::reference_wrapper<core::Tensor>> colors,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t rows,
+                int64_t cols,
+                float depth_scale,
+                float depth_max);
+
+#ifdef BUILD_CUDA_MODULE
+void ProjectCUDA(const core::Tensor& points,
+                 utility::optional<std::reference_wrapper<const core::Tensor>>
+                         point_colors,
+                 core::Tensor& depth,
+                 utility::optional<std::reference_wrapper<core::Tensor>> colors,
+                 const core::Tensor& intrinsics,
+                 const core::Tensor& extrinsics,
+                 int64_t rows,
+                 int64_t cols,
+                 float depth_scale,
+                 float depth_max);
+#endif
+
+/// \brief Computes the permutation that sorts \p points along a Z-order
+/// (Morton) curve.
+///
+/// The points are quantized on a 2^21 grid spanning their bounding box and
+/// sorted by the interleaved bits of the grid coordinates. Points in the same
+/// grid cell keep their relative order.
+///
+/// \param points Points of shape (N, 3), Float32 or Float64.
+/// \param order Output Int64 permutation of shape (N,).
+void ComputeMortonOrder(const core::Tensor& points, core::Tensor& order);
+
+void ComputeMortonOrderCPU(const core::Tensor& points, core::Tensor& order);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeMortonOrderCUDA(const core::Tensor& points, core::Tensor& order);
+#endif
+
+/// \brief Selects points by farthest point sampling.
+///
+/// Starting from \p start_index, each step selects the point with the largest
+/// distance to the points selected so far. The distances of all points are
+/// updated in parallel in each step. Distances are compared in single
+/// precision and ties are resolved to the smallest index, so CPU and CUDA
+/// select the same points.
+///
+/// \param points Points of shape (N, 3), Float32 or Float64, N < 2^32.
+/// \param num_samples Number of points to select, at most N.
+/// \param start_index Index of the first selected point.
+/// \param indices Output Int64 indices of shape (num_samples,) in the order
+/// of selection.
+void FarthestPointSample(const core::Tensor& points,
+                         int64_t num_samples,
+                         int64_t start_index,
+                         core::Tensor& indices);
+
+void FarthestPointSampleCPU(const core::Tensor& points,
+                            int64_t num_samples,
+                            int64_t start_index,
+                            core::Tensor& indices);
+
+#ifdef BUILD_CUDA_MODULE
+void FarthestPointSampleCUDA(const core::Tensor& points,
+                             int64_t num_samples,
+                             int64_t start_index,
+                             core::Tensor& indices);
+#endif
+
+/// \brief Estimates the normal of each point as the eigenvector of the
+/// smallest eigenvalue of the covariance of its neighbors.
+///
+/// Covariances and eigenvectors are computed in one pass per point, with the
+/// closed-form 3x3 solver of the legacy point cloud. Points with fewer than 3
+/// neighbors get the normal (0, 0, 1).
+///
+/// \param points Points of shape (N, 3), Float32 or Float64.
+/// \param neighbors Int64 neighbor indices of shape (N, K), padded with -1.
+/// \param normals Output normals of shape (N, 3) with the dtype of the
+/// points. If it already holds normals of that shape and dtype, the new
+/// normals are oriented towards them, and they are kept where the covariance
+/// vanishes.
+void EstimateNormals(const core::Tensor& points,
+                     const core::Tensor& neighbors,
+                     core::Tensor& normals);
+
+void EstimateNormalsCPU(const core::Tensor& points,
+                        const core::Tensor& neighbors,
+                        core::Tensor& normals,
+                        bool has_normals);
+
+#ifdef BUILD_CUDA_MODULE
+void EstimateNormalsCUDA(const core::Tensor& points,
+                         const core::Tensor& neighbors,
+                         core::Tensor& normals,
+                         bool has_normals);
+#endif
+
+/// \brief Estimates the gradient of the intensity of \p colors on the tangent
+/// plane of each point, for colored ICP.
+///
+/// The gradient is the least squares fit of the intensity differences to
+/// the neighbors projected on the tangent plane, constrained to be
+/// orthogonal to the normal, as in the legacy colored ICP. Points with fewer
+/// than 3 neighbors get a zero gradient.
+///
+/// \param points Points of shape (N, 3), Float32 or Float64.
+/// \param normals Normals of shape (N, 3) with the dtype of the points.
+/// \param colors Colors of shape (N, 3) with the dtype of the points. The
+/// intensity is the mean of the channels.
+/// \param neighbors Int64 neighbor indices of shape (N, K), padded with -1.
+/// \param color_gradients Output gradients of shape (N, 3) with the dtype of
+/// the points.
+void EstimateColorGradients(const core::Tensor& points,
+                            const core::Tensor& normals,
+                            const core::Tensor& colors,
+                            const core::Tensor& neighbors,
+                            core::Tensor& color_gradients);
+
+void EstimateColorGradientsCPU(const core::Tensor& points,
+                               const core::Tensor& normals,
+                               const core::Tensor& colors,
+                               const core::Tensor& neighbors,
+                               core::Tensor& color_gradients);
+
+#ifdef BUILD_CUDA_MODULE
+void EstimateColorGradientsCUDA(const core::Tensor& points,
+                                const core::Tensor& normals,
+                                const core::Tensor& colors,
+                                const core::Tensor& neighbors,
+                                core::Tensor& color_gradients);
+#endif
+
+/// \brief Clusters \p points with DBSCAN.
+///
+/// Points are hashed into a uniform grid with cells of size \p eps, so that
+/// neighborhoods are enumerated on the fly instead of being stored. Core
+/// points are connected with a lock-free union-find, and the labels match
+/// the ones of the legacy geometry::PointCloud::ClusterDBSCAN.
+///
+/// \param points Points of shape (N, 3), Float32 or Float64.
+/// \param eps Neighborhood radius.
+/// \param min_points Minimum number of neighbors of a core point, including
+/// the point itself.
+/// \param labels Output Int32 cluster labels of shape (N,), -1 for noise.
+void ClusterDBSCAN(const core::Tensor& points,
+                   double eps,
+                   int64_t min_points,
+                   core::Tensor& labels);
+
+void ClusterDBSCANCPU(const core::Tensor& points,
+                      double eps,
+                      int64_t min_points,
+                      core::Tensor& labels);
+
+#ifdef BUILD_CUDA_MODULE
+void ClusterDBSCANCUDA(const core::Tensor& points,
+                       double eps,
+                       int64_t min_points,
+                       core::Tensor& labels);
+#endif
+
+/// \brief Computes the saliency of the Intrinsic Shape Signatures keypoint
+/// detector, i.e. the smallest eigenvalue of the covariance of the neighbors
+/// of each point.
+///
+/// The neighbors are the result of a fixed radius search, concatenated per
+/// point. Like in the legacy geometry::keypoint::ComputeISSKeypoints, the
+/// saliency is 0 for points with fewer than \p min_neighbors neighbors, a
+/// zero covariance, or eigenvalue ratios that are not below \p gamma_21 and
+/// \p gamma_32.
+///
+/// \param points Points of shape (N, 3), Float32 or Float64.
+/// \param indices Int64 indices of the neighbors of all points.
+/// \param num_neighbors Int64 number of neighbors of each point, of shape
+/// (N,).
+/// \param gamma_21 Upper bound on the ratio of the second and the first
+/// eigenvalue.
+/// \param gamma_32 Upper bound on the ratio of the third and the second
+/// eigenvalue.
+/// \param min_neighbors Minimum number of neighbors.
+/// \param saliency Output Float64 saliency of shape (N,).
+void ComputeISSSaliency(const core::Tensor& points,
+                        const core::Tensor& indices,
+                        const core::Tensor& num_neighbors,
+                        double gamma_21,
+                        double gamma_32,
+                        int64_t min_neighbors,
+                        core::Tensor& saliency);
+
+void ComputeISSSaliencyCPU(const core::Tensor& points,
+                           const core::Tensor& indices,
+                           const core::Tensor& num_neighbors,
+                           double gamma_21,
+                           double gamma_32,
+                           int64_t min_neighbors,
+                           core::Tensor& saliency);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeISSSaliencyCUDA(const core::Tensor& points,
+                            const core::Tensor& indices,
+                            const core::Tensor& num_neighbors,
+                            double gamma_21,
+                            double gamma_32,
+                            int64_t min_neighbors,
+                            core::Tensor& saliency);
+#endif
+
+/// \brief Selects the points whose saliency is positive and maximal among
+/// their neighbors, each point independently.
+///
+/// \param saliency Float64 saliency of shape (N,).
+/// \param indices Int64 indices of the neighbors of all points, concatenated
+/// per point.
+/// \param num_neighbors Int64 number of neighbors of each point, of shape
+/// (N,).
+/// \param min_neighbors Minimum number of neighbors of a keypoint.
+/// \param mask Output Bool mask of the keypoints, of shape (N,).
+void SuppressNonMaxima(const core::Tensor& saliency,
+                       const core::Tensor& indices,
+                       const core::Tensor& num_neighbors,
+                       int64_t min_neighbors,
+                       core::Tensor& mask);
+
+void SuppressNonMaximaCPU(const core::Tensor& saliency,
+                          const core::Tensor& indices,
+                          const core::Tensor& num_neighbors,
+                          int64_t min_neighbors,
+                          core::Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+void SuppressNonMaximaCUDA(const core::Tensor& saliency,
+                           const core::Tensor& indices,
+                           const core::Tensor& num_neighbors,
+                           int64_t min_neighbors,
+                           core::Tensor& mask);
+#endif
+
+/// \brief Computes the axis-aligned bounding boxes of many segments of a
+/// point cloud at once.
+///
+/// The points are grouped by segment with a sort, and each segment is then
+/// bounded by one thread.
+///
+/// \param points Points of shape (N, 3), Float32 or Float64.
+/// \param segment_ids Int64 segment id of each point, of shape (N,). Points
+/// with a negative id are ignored.
+/// \param num_segments Number S of segments. Points with an id of at least
+/// S are ignored.
+/// \param min_bounds Output min bounds of shape (S, 3) with the dtype of the
+/// points, zero for empty segments.
+/// \param max_bounds Output max bounds of shape (S, 3), likewise.
+void ComputeSegmentAxisAlignedBoundingBoxes(const core::Tensor& points,
+                                            const core::Tensor& segment_ids,
+                                            int64_t num_segments,
+                                            core::Tensor& min_bounds,
+                                            core::Tensor& max_bounds);
+
+void ComputeSegmentAxisAlignedBoundingBoxesCPU(
+        const core::Tensor& points,
+        const core::Tensor& segment_ids,
+        int64_t num_segments,
+        core::Tensor& min_bounds,
+        core::Tensor& max_bounds);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeSegmentAxisAlignedBoundingBoxesCUDA(
+        const core::Tensor& points,
+        const core::Tensor& segment_ids,
+        int64_t num_segments,
+        core::Tensor& min_bounds,
+        core::Tensor& max_bounds);
+#endif
+
+/// \brief Computes the oriented bounding boxes of many segments of a point
+/// cloud at once.
+///
+/// The axes of a box are the principal axes of the points of its segment,
+/// sorted by decreasing variance, like the legacy
+/// geometry::OrientedBoundingBox::CreateFromPoints, except that all points are
+/// used instead of the vertices of their convex hull. If \p minimal, each
+/// principal axis is in turn held fixed and the other two are rotated about
+/// it to minimize the area of the box section orthogonal to it, and the box
+/// of least volume is kept. The rotation angle is sampled every pi / 64 and
+/// then refined by a golden section search around the best sample.
+///
+/// \param points Points of shape (N, 3), Float32 or Float64.
+/// \param segment_ids Int64 segment id of each point, of shape (N,). Points
+/// with a negative id are ignored.
+/// \param num_segments Number S of segments. Points with an id of at least
+/// S are ignored.
+/// \param minimal If true, minimizes the volume of the boxes.
+/// \param centers Output box centers of shape (S, 3) with the dtype of the
+/// points.
+/// \param rotations Output rotations of shape (S, 3, 3), whose columns are
+/// the axes of the boxes. Empty segments get the identity.
+/// \param extents Output box extents along their axes, of shape (S, 3).
+void ComputeSegmentOrientedBoundingBoxes(const core::Tensor& points,
+                                         const core::Tensor& segment_ids,
+                                         int64_t num_segments,
+                                         bool minimal,
+                                         core::Tensor& centers,
+                                         core::Tensor& rotations,
+                                         core::Tensor& extents);
+
+void ComputeSegmentOrientedBoundingBoxesCPU(const core::Tensor& points,
+                                            const core::Tensor& segment_ids,
+                                            int64_t num_segments,
+                                            bool minimal,
+                                            core::Tensor& centers,
+                                            core::Tensor& rotations,
+                                            core::Tensor& extents);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeSegmentOrientedBoundingBoxesCUDA(const core::Tensor& points,
+                                             const core::Tensor& segment_ids,
+                                             int64_t num_segments,
+                                             bool minimal,
+                                             core::Tensor& centers,
+                                             core::Tensor& rotations,
+                                             core::Tensor& extents);
+#endif
+
+/// \brief Transforms the points, and the normals if any, of many point
+/// clouds at once, in place.
+///
+/// Each point is handled by one thread, which finds its point cloud with a
+/// binary search over the point counts. The point clouds may be separate
+/// tensors, or disjoint slices of a single tensor, so that thousands of small
+/// point clouds are transformed with a single launch.
+///
+/// \param points Contiguous points of shape (N_i, 3) of the M point clouds,
+/// all Float32 or all Float64, on the same device.
+/// \param normals Either empty, or the M contiguous normals of the point
+/// clouds, of shape (N_i, 3) and with the dtype of the points. Empty tensors
+/// stand for point clouds without normals.
+/// \param transformations Transformations of shape (M, 4, 4). Like in
+/// t::geometry::PointCloud::Transform, the points are mapped to R p + t and
+/// the normals to R n.
+void TransformSegments(std::vector<core::Tensor>& points,
+                       std::vector<core::Tensor>& normals,
+                       const core::Tensor& transformations);
+
+void TransformSegmentsCPU(const core::Tensor& point_ptrs,
+                          const core::Tensor& normal_ptrs,
+                          const core::Tensor& offsets,
+                          const core::Tensor& transformations,
+                          core::Dtype dtype);
+
+#ifdef BUILD_CUDA_MODULE
+void TransformSegmentsCUDA(const core::Tensor& point_ptrs,
+                           const core::Tensor& normal_ptrs,
+                           const core::Tensor& offsets,
+                           const core::Tensor& transformations,
+                           core::Dtype dtype);
 #endif
 }  // namespace pointcloud
 }  // namespace kernel
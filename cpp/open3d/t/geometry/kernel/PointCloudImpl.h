@@ -24,20 +24,39 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <tuple>
 #include <vector>
 
+#if defined(__CUDACC__)
+#include <cub/cub.cuh>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#else
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+#endif
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Utility.h"
+#include "open3d/t/geometry/kernel/DisjointSetImpl.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Timer.h"
+#if !defined(__CUDACC__)
+#include "open3d/utility/ParallelScan.h"
+#endif
 
 namespace open3d {
 namespace t {
@@ -45,6 +64,9 @@ namespace geometry {
 namespace kernel {
 namespace pointcloud {
 
+/// Color dtypes read by the Unproject kernel.
+enum class UnprojectColorType { UInt8, UInt16, Float32, Float64 };
+
 #if defined(__CUDACC__)
 void UnprojectCUDA
 #else
@@ -59,7 +81,9 @@ void UnprojectCPU
          const core::Tensor& extrinsics,
          float depth_scale,
          float depth_max,
-         int64_t stride) {
+         int64_t stride,
+         utility::optional<std::reference_wrapper<const core::Tensor>>
+                 undistortion_map) {
 
     const bool have_colors = image_colors.has_value();
     NDArrayIndexer depth_indexer(depth, 2);
@@ -68,6 +92,12 @@ void UnprojectCPU
     core::Tensor pose = t::geometry::InverseTransformation(extrinsics);
     TransformIndexer ti(intrinsics, pose, 1.0f);
 
+    const bool have_map = undistortion_map.has_value();
+    NDArrayIndexer map_indexer;
+    if (have_map) {
+        map_indexer = NDArrayIndexer(undistortion_map.value().get(), 2);
+    }
+
     // Output
     int64_t rows_strided = depth_indexer.GetShape(0) / stride;
     int64_t cols_strided = depth_indexer.GetShape(1) / stride;
@@ -76,6 +106,9 @@ void UnprojectCPU
                           core::Dtype::Float32, depth.GetDevice());
     NDArrayIndexer point_indexer(points, 1);
     NDArrayIndexer colors_indexer;
+    // The colors are converted in the kernel, with the scales of Image::To.
+    UnprojectColorType color_type = UnprojectColorType::Float32;
+    float color_scale = 1.0f;
     if (have_colors) {
         const auto& imcol = image_colors.value().get();
         image_colors_indexer = NDArrayIndexer{imcol, 2};
@@ -83,6 +116,15 @@ void UnprojectCPU
                 core::Tensor({rows_strided * cols_strided, 3},
                              core::Dtype::Float32, imcol.GetDevice());
         colors_indexer = NDArrayIndexer(colors.value().get(), 1);
+        if (imcol.GetDtype() == core::Dtype::UInt8) {
+            color_type = UnprojectColorType::UInt8;
+            color_scale = 1.0f / 255;
+        } else if (imcol.GetDtype() == core::Dtype::UInt16) {
+            color_type = UnprojectColorType::UInt16;
+            color_scale = 1.0f / 65535;
+        } else if (imcol.GetDtype() == core::Dtype::Float64) {
+            color_type = UnprojectColorType::Float64;
+        }
     }
 
     // Counter
@@ -114,8 +156,16 @@ void UnprojectCPU
                 int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
 
                 float x_c = 0, y_c = 0, z_c = 0;
-                ti.Unproject(static_cast<float>(x), static_cast<float>(y), d,
-                             &x_c, &y_c, &z_c);
+                if (have_map) {
+                    const float* ray =
+                            map_indexer.GetDataPtrFromCoord<float>(x, y);
+                    x_c = ray[0] * d;
+                    y_c = ray[1] * d;
+                    z_c = d;
+                } else {
+                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
+                                 d, &x_c, &y_c, &z_c);
+                }
 
                 float* vertex = point_indexer.GetDataPtrFromCoord<float>(idx);
                 ti.RigidTransform(x_c, y_c, z_c, vertex + 0, vertex + 1,
@@ -123,12 +173,27 @@ void UnprojectCPU
                 if (have_colors) {
                     float* pcd_pixel =
                             colors_indexer.GetDataPtrFromCoord<float>(idx);
-                    float* image_pixel =
-                            image_colors_indexer.GetDataPtrFromCoord<float>(x,
-                                                                            y);
-                    *pcd_pixel = *image_pixel;
-                    *(pcd_pixel + 1) = *(image_pixel + 1);
-                    *(pcd_pixel + 2) = *(image_pixel + 2);
+                    for (int c = 0; c < 3; ++c) {
+                        float value;
+                        if (color_type == UnprojectColorType::UInt8) {
+                            value = image_colors_indexer
+                                            .GetDataPtrFromCoord<uint8_t>(x,
+                                                                          y)[c];
+                        } else if (color_type == UnprojectColorType::UInt16) {
+                            value = image_colors_indexer
+                                            .GetDataPtrFromCoord<uint16_t>(
+                                                    x, y)[c];
+                        } else if (color_type == UnprojectColorType::Float64) {
+                            value = float(image_colors_indexer
+                                                  .GetDataPtrFromCoord<double>(
+                                                          x, y)[c]);
+                        } else {
+                            value = image_colors_indexer
+                                            .GetDataPtrFromCoord<float>(x,
+                                                                        y)[c];
+                        }
+                        pcd_pixel[c] = value * color_scale;
+                    }
                 }
             }
         });
@@ -148,6 +213,1671 @@ void UnprojectCPU
                 colors.value().get().Slice(0, 0, total_pts_count);
     }
 }
+
+#if defined(__CUDACC__)
+void ComputeUndistortionMapCUDA
+#else
+void ComputeUndistortionMapCPU
+#endif
+        (const core::Tensor& intrinsics,
+         const std::vector<double>& distortion,
+         int64_t rows,
+         int64_t cols,
+         const core::Device& device,
+         core::Tensor& map) {
+    map = core::Tensor({rows, cols, 2}, core::Dtype::Float32, device);
+    const double* K = intrinsics.GetDataPtr<double>();
+    const double fx = K[0], cx = K[2], fy = K[4], cy = K[5];
+    double coeffs[5] = {0, 0, 0, 0, 0};
+    for (size_t i = 0; i < distortion.size() && i < 5; ++i) {
+        coeffs[i] = distortion[i];
+    }
+    const double k1 = coeffs[0], k2 = coeffs[1], p1 = coeffs[2],
+                 p2 = coeffs[3], k3 = coeffs[4];
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    float* map_ptr = map.GetDataPtr<float>();
+    launcher.LaunchGeneralKernel(rows * cols, [=] OPEN3D_DEVICE(
+                                                      int64_t workload_idx) {
+        double x0 = (double(workload_idx % cols) - cx) / fx;
+        double y0 = (double(workload_idx / cols) - cy) / fy;
+        double x = x0, y = y0;
+        for (int iter = 0; iter < 10; ++iter) {
+            double r2 = x * x + y * y;
+            double icdist = 1.0 / (1.0 + ((k3 * r2 + k2) * r2 + k1) * r2);
+            double dx = 2 * p1 * x * y + p2 * (r2 + 2 * x * x);
+            double dy = p1 * (r2 + 2 * y * y) + 2 * p2 * x * y;
+            x = (x0 - dx) * icdist;
+            y = (y0 - dy) * icdist;
+        }
+        map_ptr[2 * workload_idx + 0] = float(x);
+        map_ptr[2 * workload_idx + 1] = float(y);
+    });
+}
+
+#if defined(__CUDACC__)
+void ProjectCUDA
+#else
+void ProjectCPU
+#endif
+        (const core::Tensor& points,
+         utility::optional<std::reference_wrapper<const core::Tensor>>
+                 point_colors,
+         core::Tensor& depth,
+         utility::optional<std::reference_wrapper<core::Tensor>> colors,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         int64_t rows,
+         int64_t cols,
+         float depth_scale,
+         float depth_max) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t batch_size = extrinsics.GetLength();
+    const int64_t pixels = rows * cols;
+
+    const double* K = intrinsics.GetDataPtr<double>();
+    const float fx = float(K[0]), cx = float(K[2]), fy = float(K[4]),
+                cy = float(K[5]);
+
+    // The closest point of each pixel, as its depth bits in the upper and its
+    // index in the lower 32 bits. Depths are positive, so the keys order like
+    // the depths.
+    core::Tensor keys =
+            core::Tensor::Empty({batch_size, rows, cols}, core::Dtype::UInt64,
+                                device);
+    uint64_t* keys_ptr = keys.GetDataPtr<uint64_t>();
+    const float* points_ptr = points.GetDataPtr<float>();
+    const float* extrinsics_ptr = extrinsics.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(
+            batch_size * pixels, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                keys_ptr[workload_idx] = ~uint64_t(0);
+            });
+
+    launcher.LaunchGeneralKernel(
+            batch_size * n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t b = workload_idx / n;
+                const int64_t idx = workload_idx % n;
+                const float* T = extrinsics_ptr + 16 * b;
+                const float* p = points_ptr + 3 * idx;
+                float x = T[0] * p[0] + T[1] * p[1] + T[2] * p[2] + T[3];
+                float y = T[4] * p[0] + T[5] * p[1] + T[6] * p[2] + T[7];
+                float z = T[8] * p[0] + T[9] * p[1] + T[10] * p[2] + T[11];
+                if (!(z > 0) || z >= depth_max) {
+                    return;
+                }
+                // Pixel centers are at integer coordinates, as in Unproject.
+                int64_t u =
+                        static_cast<int64_t>(floorf(fx * x / z + cx + 0.5f));
+                int64_t v =
+                        static_cast<int64_t>(floorf(fy * y / z + cy + 0.5f));
+                if (u < 0 || u >= cols || v < 0 || v >= rows) {
+                    return;
+                }
+
+#if defined(__CUDA_ARCH__)
+                uint32_t bits = __float_as_uint(z);
+#else
+                uint32_t bits;
+                std::memcpy(&bits, &z, sizeof(bits));
+#endif
+                uint64_t key = (uint64_t(bits) << 32) | uint64_t(uint32_t(idx));
+                uint64_t* ptr = keys_ptr + b * pixels + v * cols + u;
+#if defined(__CUDACC__)
+                atomicMin(reinterpret_cast<unsigned long long*>(ptr),
+                          static_cast<unsigned long long>(key));
+#else
+                std::atomic<uint64_t>* nearest_key =
+                        reinterpret_cast<std::atomic<uint64_t>*>(ptr);
+                uint64_t old = nearest_key->load();
+                while (key < old &&
+                       !nearest_key->compare_exchange_weak(old, key)) {
+                }
+#endif
+            });
+
+    depth = core::Tensor::Empty({batch_size, rows, cols, 1},
+                                core::Dtype::Float32, device);
+    float* depth_ptr = depth.GetDataPtr<float>();
+    const bool have_colors = point_colors.has_value();
+    core::Tensor pcd_colors;
+    const float* pcd_colors_ptr = nullptr;
+    float* colors_ptr = nullptr;
+    if (have_colors) {
+        pcd_colors = point_colors.value().get().Contiguous();
+        pcd_colors_ptr = pcd_colors.GetDataPtr<float>();
+        colors.value().get() = core::Tensor::Empty(
+                {batch_size, rows, cols, 3}, core::Dtype::Float32, device);
+        colors_ptr = colors.value().get().GetDataPtr<float>();
+    }
+
+    launcher.LaunchGeneralKernel(
+            batch_size * pixels, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const uint64_t key = keys_ptr[workload_idx];
+                if (key == ~uint64_t(0)) {
+                    depth_ptr[workload_idx] = 0;
+                    if (have_colors) {
+                        for (int c = 0; c < 3; ++c) {
+                            colors_ptr[3 * workload_idx + c] = 0;
+                        }
+                    }
+                    return;
+                }
+                uint32_t bits = uint32_t(key >> 32);
+#if defined(__CUDA_ARCH__)
+                float z = __uint_as_float(bits);
+#else
+                float z;
+                std::memcpy(&z, &bits, sizeof(z));
+#endif
+                depth_ptr[workload_idx] = z * depth_scale;
+                if (have_colors) {
+                    const int64_t idx = int64_t(uint32_t(key));
+                    for (int c = 0; c < 3; ++c) {
+                        colors_ptr[3 * workload_idx + c] =
+                                pcd_colors_ptr[3 * idx + c];
+                    }
+                }
+            });
+}
+
+#if defined(__CUDACC__)
+void ComputeMortonOrderCUDA
+#else
+void ComputeMortonOrderCPU
+#endif
+        (const core::Tensor& points, core::Tensor& order) {
+    core::Device device = points.GetDevice();
+    int64_t n = points.GetLength();
+    order = core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device);
+    if (n < 2) {
+        return;
+    }
+
+    // Quantize with a uniform scale so that the grid cells stay cubic.
+    static const core::Device host("CPU:0");
+    core::Tensor min_bound, max_bound;
+    std::tie(min_bound, max_bound) = points.MinMax({0});
+    std::vector<double> min_d =
+            min_bound.To(host, core::Dtype::Float64).ToFlatVector<double>();
+    std::vector<double> max_d =
+            max_bound.To(host, core::Dtype::Float64).ToFlatVector<double>();
+    double extent = std::max({max_d[0] - min_d[0], max_d[1] - min_d[1],
+                              max_d[2] - min_d[2]});
+    const double grid_max = double((1 << 21) - 1);
+    const double scale = extent > 0 ? grid_max / extent : 0.0;
+    const double min_x = min_d[0], min_y = min_d[1], min_z = min_d[2];
+
+    core::Tensor codes({n}, core::Dtype::Int64, device);
+    int64_t* codes_ptr = codes.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            const scalar_t* p = points_ptr + 3 * workload_idx;
+            // Clamping also maps NaN coordinates into the grid.
+            auto quantize = [&](scalar_t v, double v_min) {
+                double q = (double(v) - v_min) * scale;
+                return uint64_t(q >= 0 ? (q <= grid_max ? q : grid_max) : 0);
+            };
+            codes_ptr[workload_idx] = int64_t(
+                    MortonCode3D(quantize(p[0], min_x), quantize(p[1], min_y),
+                                 quantize(p[2], min_z)));
+        });
+    });
+
+    int64_t* order_ptr = order.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    // Thrust radix sorts integer keys, and the sort is stable.
+    thrust::sort_by_key(thrust::device, codes_ptr, codes_ptr + n, order_ptr);
+#else
+    tbb::parallel_sort(order_ptr, order_ptr + n,
+                       [codes_ptr](int64_t a, int64_t b) {
+                           return codes_ptr[a] < codes_ptr[b] ||
+                                  (codes_ptr[a] == codes_ptr[b] && a < b);
+                       });
+#endif
+}
+/// Key of a point in farthest point sampling, ordered by the distance and then
+/// by the inverse index. Distances are non-negative, so the bit pattern of the
+/// float orders like its value.
+OPEN3D_HOST_DEVICE static inline uint64_t FarthestPointKey(float dist,
+                                                           int64_t idx) {
+#if defined(__CUDA_ARCH__)
+    uint32_t bits = __float_as_uint(dist);
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &dist, sizeof(bits));
+#endif
+    return (uint64_t(bits) << 32) | uint64_t(~uint32_t(idx));
+}
+
+OPEN3D_HOST_DEVICE static inline int64_t FarthestPointIndex(uint64_t key) {
+    return int64_t(~uint32_t(key));
+}
+
+/// Updates the distance of point \p idx to the selected points with the
+/// last selected point \p center and returns its key.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline uint64_t UpdateFarthestPointDistance(
+        const scalar_t* points_ptr,
+        const scalar_t* center,
+        float* dists_ptr,
+        int64_t idx) {
+    const scalar_t* p = points_ptr + 3 * idx;
+    float dx = float(p[0] - center[0]);
+    float dy = float(p[1] - center[1]);
+    float dz = float(p[2] - center[2]);
+    float dist = dx * dx + dy * dy + dz * dz;
+    dist = dist < dists_ptr[idx] ? dist : dists_ptr[idx];
+    dists_ptr[idx] = dist;
+    return FarthestPointKey(dist, idx);
+}
+
+#if defined(__CUDACC__)
+// One step selects one point. The points are split over many blocks, and the
+// block maxima are combined with an atomicMax on the keys. The selected point
+// of the previous step is read from the keys on the device, so the steps are
+// queued without synchronizing with the host.
+template <typename scalar_t, int kBlockSize>
+__global__ void FarthestPointSampleStepCUDAKernel(const scalar_t* points_ptr,
+                                                  int64_t n,
+                                                  int64_t step,
+                                                  float* dists_ptr,
+                                                  uint64_t* keys_ptr) {
+    typedef cub::BlockReduce<unsigned long long, kBlockSize> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+
+    const scalar_t* center =
+            points_ptr + 3 * FarthestPointIndex(keys_ptr[step - 1]);
+    unsigned long long key = 0;
+    for (int64_t idx = threadIdx.x + int64_t(blockIdx.x) * kBlockSize;
+         idx < n; idx += int64_t(gridDim.x) * kBlockSize) {
+        unsigned long long idx_key = UpdateFarthestPointDistance(
+                points_ptr, center, dists_ptr, idx);
+        key = idx_key > key ? idx_key : key;
+    }
+    key = BlockReduce(temp_storage).Reduce(key, cub::Max());
+    if (threadIdx.x == 0) {
+        atomicMax(reinterpret_cast<unsigned long long*>(keys_ptr + step), key);
+    }
+}
+#endif
+
+#if defined(__CUDACC__)
+void FarthestPointSampleCUDA
+#else
+void FarthestPointSampleCPU
+#endif
+        (const core::Tensor& points,
+         int64_t num_samples,
+         int64_t start_index,
+         core::Tensor& indices) {
+    core::Device device = points.GetDevice();
+    int64_t n = points.GetLength();
+    indices = core::Tensor({num_samples}, core::Dtype::Int64, device);
+    if (num_samples == 0) {
+        return;
+    }
+
+    // keys[i] is the key of the i-th selected point.
+    std::vector<uint64_t> keys_init(num_samples, 0);
+    keys_init[0] = FarthestPointKey(0, start_index);
+    core::Tensor keys(keys_init, {num_samples}, core::Dtype::UInt64, device);
+    uint64_t* keys_ptr = keys.GetDataPtr<uint64_t>();
+    core::Tensor dists = core::Tensor::Full(
+            {n}, std::numeric_limits<float>::infinity(), core::Dtype::Float32,
+            device);
+    float* dists_ptr = dists.GetDataPtr<float>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+#if defined(__CUDACC__)
+        const int kBlockSize = 256;
+        // Each thread updates several points to amortize the reduction.
+        const int64_t blocks = std::max<int64_t>(
+                1, std::min<int64_t>((n + 4 * kBlockSize - 1) /
+                                             (4 * kBlockSize),
+                                     65535));
+        for (int64_t step = 1; step < num_samples; ++step) {
+            FarthestPointSampleStepCUDAKernel<scalar_t, kBlockSize>
+                    <<<blocks, kBlockSize>>>(points_ptr, n, step, dists_ptr,
+                                             keys_ptr);
+        }
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+#else
+        const int64_t grain_size = 4096;
+        for (int64_t step = 1; step < num_samples; ++step) {
+            const scalar_t* center =
+                    points_ptr + 3 * FarthestPointIndex(keys_ptr[step - 1]);
+            keys_ptr[step] = tbb::parallel_reduce(
+                    tbb::blocked_range<int64_t>(0, n, grain_size), uint64_t(0),
+                    [&](const tbb::blocked_range<int64_t>& range,
+                        uint64_t key) {
+                        for (int64_t idx = range.begin(); idx < range.end();
+                             ++idx) {
+                            key = std::max(key, UpdateFarthestPointDistance(
+                                                        points_ptr, center,
+                                                        dists_ptr, idx));
+                        }
+                        return key;
+                    },
+                    [](uint64_t a, uint64_t b) { return std::max(a, b); });
+        }
+#endif
+    });
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+    int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_samples, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                indices_ptr[workload_idx] =
+                        FarthestPointIndex(keys_ptr[workload_idx]);
+            });
+}
+
+// Closed-form eigen-solver for symmetric 3x3 matrices, ported from the legacy
+// geometry::PointCloud::EstimateNormals to run on both host and device. See
+// https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
+
+OPEN3D_HOST_DEVICE static inline void Cross3(const double a[3],
+                                             const double b[3],
+                                             double c[3]) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+OPEN3D_HOST_DEVICE static inline double Dot3(const double a[3],
+                                             const double b[3]) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+OPEN3D_HOST_DEVICE static inline void ComputeEigenvector0(const double A[3][3],
+                                                          double eval0,
+                                                          double evec0[3]) {
+    double row0[3] = {A[0][0] - eval0, A[0][1], A[0][2]};
+    double row1[3] = {A[0][1], A[1][1] - eval0, A[1][2]};
+    double row2[3] = {A[0][2], A[1][2], A[2][2] - eval0};
+    double r0xr1[3], r0xr2[3], r1xr2[3];
+    Cross3(row0, row1, r0xr1);
+    Cross3(row0, row2, r0xr2);
+    Cross3(row1, row2, r1xr2);
+    double d0 = Dot3(r0xr1, r0xr1);
+    double d1 = Dot3(r0xr2, r0xr2);
+    double d2 = Dot3(r1xr2, r1xr2);
+
+    const double* r = r0xr1;
+    double dmax = d0;
+    if (d1 > dmax) {
+        dmax = d1;
+        r = r0xr2;
+    }
+    if (d2 > dmax) {
+        dmax = d2;
+        r = r1xr2;
+    }
+    double inv_length = 1 / sqrt(dmax);
+    for (int i = 0; i < 3; ++i) {
+        evec0[i] = r[i] * inv_length;
+    }
+}
+
+OPEN3D_HOST_DEVICE static inline void ComputeEigenvector1(const double A[3][3],
+                                                          const double evec0[3],
+                                                          double eval1,
+                                                          double evec1[3]) {
+    double U[3], V[3];
+    if (fabs(evec0[0]) > fabs(evec0[1])) {
+        double inv_length =
+                1 / sqrt(evec0[0] * evec0[0] + evec0[2] * evec0[2]);
+        U[0] = -evec0[2] * inv_length;
+        U[1] = 0;
+        U[2] = evec0[0] * inv_length;
+    } else {
+        double inv_length =
+                1 / sqrt(evec0[1] * evec0[1] + evec0[2] * evec0[2]);
+        U[0] = 0;
+        U[1] = evec0[2] * inv_length;
+        U[2] = -evec0[1] * inv_length;
+    }
+    Cross3(evec0, U, V);
+
+    double AU[3], AV[3];
+    for (int i = 0; i < 3; ++i) {
+        AU[i] = Dot3(A[i], U);
+        AV[i] = Dot3(A[i], V);
+    }
+    double m00 = Dot3(U, AU) - eval1;
+    double m01 = Dot3(U, AV);
+    double m11 = Dot3(V, AV) - eval1;
+
+    double abs_m00 = fabs(m00);
+    double abs_m01 = fabs(m01);
+    double abs_m11 = fabs(m11);
+    // evec1 = a * U - b * V, or U if the 2x2 system vanishes.
+    double a = 1, b = 0;
+    if (abs_m00 >= abs_m11) {
+        if ((abs_m00 > abs_m01 ? abs_m00 : abs_m01) > 0) {
+            if (abs_m00 >= abs_m01) {
+                m01 /= m00;
+                m00 = 1 / sqrt(1 + m01 * m01);
+                m01 *= m00;
+            } else {
+                m00 /= m01;
+                m01 = 1 / sqrt(1 + m00 * m00);
+                m00 *= m01;
+            }
+            a = m01;
+            b = m00;
+        }
+    } else {
+        if ((abs_m11 > abs_m01 ? abs_m11 : abs_m01) > 0) {
+            if (abs_m11 >= abs_m01) {
+                m01 /= m11;
+                m11 = 1 / sqrt(1 + m01 * m01);
+                m01 *= m11;
+            } else {
+                m11 /= m01;
+                m01 = 1 / sqrt(1 + m11 * m11);
+                m11 *= m01;
+            }
+            a = m11;
+            b = m01;
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        evec1[i] = a * U[i] - b * V[i];
+    }
+}
+
+/// Eigenvector of the smallest eigenvalue of the symmetric matrix A, or zero
+/// if A is zero. A is modified.
+OPEN3D_HOST_DEVICE static inline void FastEigen3x3(double A[3][3],
+                                                   double normal[3]) {
+    double max_coeff = A[0][0];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            max_coeff = A[i][j] > max_coeff ? A[i][j] : max_coeff;
+        }
+    }
+    if (max_coeff == 0) {
+        normal[0] = normal[1] = normal[2] = 0;
+        return;
+    }
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            A[i][j] /= max_coeff;
+        }
+    }
+
+    double norm = A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2];
+    if (norm > 0) {
+        double q = (A[0][0] + A[1][1] + A[2][2]) / 3;
+        double b00 = A[0][0] - q;
+        double b11 = A[1][1] - q;
+        double b22 = A[2][2] - q;
+        double p = sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+
+        double c00 = b11 * b22 - A[1][2] * A[1][2];
+        double c01 = A[0][1] * b22 - A[1][2] * A[0][2];
+        double c02 = A[0][1] * A[1][2] - b11 * A[0][2];
+        double det = (b00 * c00 - A[0][1] * c01 + A[0][2] * c02) / (p * p * p);
+        double half_det = det * 0.5;
+        half_det = half_det < -1 ? -1 : (half_det > 1 ? 1 : half_det);
+
+        double angle = acos(half_det) / 3;
+        const double two_thirds_pi = 2.09439510239319549;
+        double beta2 = cos(angle) * 2;
+        double beta0 = cos(angle + two_thirds_pi) * 2;
+        double beta1 = -(beta0 + beta2);
+        double eval[3] = {q + p * beta0, q + p * beta1, q + p * beta2};
+
+        // Start from the eigenvalue that is best separated from the others.
+        int first = half_det >= 0 ? 2 : 0;
+        int last = 2 - first;
+        double evec_first[3], evec1[3];
+        ComputeEigenvector0(A, eval[first], evec_first);
+        if (eval[first] < eval[last] && eval[first] < eval[1]) {
+            for (int i = 0; i < 3; ++i) normal[i] = evec_first[i];
+            return;
+        }
+        ComputeEigenvector1(A, evec_first, eval[1], evec1);
+        if (eval[1] < eval[0] && eval[1] < eval[2]) {
+            for (int i = 0; i < 3; ++i) normal[i] = evec1[i];
+            return;
+        }
+        if (first == 2) {
+            Cross3(evec1, evec_first, normal);
+        } else {
+            Cross3(evec_first, evec1, normal);
+        }
+    } else {
+        int axis = 2;
+        if (A[0][0] < A[1][1] && A[0][0] < A[2][2]) {
+            axis = 0;
+        } else if (A[1][1] < A[0][0] && A[1][1] < A[2][2]) {
+            axis = 1;
+        }
+        normal[0] = normal[1] = normal[2] = 0;
+        normal[axis] = 1;
+    }
+}
+
+#if defined(__CUDACC__)
+void EstimateNormalsCUDA
+#else
+void EstimateNormalsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbors,
+         core::Tensor& normals,
+         bool has_normals) {
+    int64_t n = points.GetLength();
+    int64_t max_nn = neighbors.GetShape(1);
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            const int64_t* nb = neighbors_ptr + workload_idx * max_nn;
+            scalar_t* normal = normals_ptr + 3 * workload_idx;
+
+            // Covariance from the first and second order moments.
+            double cumulants[9] = {0};
+            int64_t count = 0;
+            for (int64_t k = 0; k < max_nn && nb[k] >= 0; ++k) {
+                const scalar_t* p = points_ptr + 3 * nb[k];
+                double x = p[0], y = p[1], z = p[2];
+                cumulants[0] += x;
+                cumulants[1] += y;
+                cumulants[2] += z;
+                cumulants[3] += x * x;
+                cumulants[4] += x * y;
+                cumulants[5] += x * z;
+                cumulants[6] += y * y;
+                cumulants[7] += y * z;
+                cumulants[8] += z * z;
+                ++count;
+            }
+            if (count < 3) {
+                normal[0] = 0;
+                normal[1] = 0;
+                normal[2] = 1;
+                return;
+            }
+            for (int i = 0; i < 9; ++i) {
+                cumulants[i] /= count;
+            }
+            double A[3][3];
+            A[0][0] = cumulants[3] - cumulants[0] * cumulants[0];
+            A[1][1] = cumulants[6] - cumulants[1] * cumulants[1];
+            A[2][2] = cumulants[8] - cumulants[2] * cumulants[2];
+            A[0][1] = A[1][0] = cumulants[4] - cumulants[0] * cumulants[1];
+            A[0][2] = A[2][0] = cumulants[5] - cumulants[0] * cumulants[2];
+            A[1][2] = A[2][1] = cumulants[7] - cumulants[1] * cumulants[2];
+
+            double result[3];
+            FastEigen3x3(A, result);
+            if (result[0] == 0 && result[1] == 0 && result[2] == 0) {
+                if (has_normals) {
+                    return;
+                }
+                result[2] = 1;
+            }
+            if (has_normals && result[0] * normal[0] + result[1] * normal[1] +
+                                               result[2] * normal[2] <
+                                       0) {
+                result[0] = -result[0];
+                result[1] = -result[1];
+                result[2] = -result[2];
+            }
+            normal[0] = static_cast<scalar_t>(result[0]);
+            normal[1] = static_cast<scalar_t>(result[1]);
+            normal[2] = static_cast<scalar_t>(result[2]);
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void EstimateColorGradientsCUDA
+#else
+void EstimateColorGradientsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& normals,
+         const core::Tensor& colors,
+         const core::Tensor& neighbors,
+         core::Tensor& color_gradients) {
+    int64_t n = points.GetLength();
+    int64_t max_nn = neighbors.GetShape(1);
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        const scalar_t* colors_ptr = colors.GetDataPtr<scalar_t>();
+        scalar_t* gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            const int64_t* nb = neighbors_ptr + workload_idx * max_nn;
+            const scalar_t* vt = points_ptr + 3 * workload_idx;
+            const scalar_t* nt = normals_ptr + 3 * workload_idx;
+            const scalar_t* ct = colors_ptr + 3 * workload_idx;
+            scalar_t* gradient = gradients_ptr + 3 * workload_idx;
+            gradient[0] = gradient[1] = gradient[2] = 0;
+            const double it = (double(ct[0]) + ct[1] + ct[2]) / 3;
+
+            // Normal equations of the least squares fit of the intensity
+            // differences on the tangent plane.
+            double AtA[3][3] = {{0}}, Atb[3] = {0};
+            int64_t count = 0;
+            for (int64_t k = 0; k < max_nn && nb[k] >= 0; ++k) {
+                if (nb[k] == workload_idx) continue;
+                const scalar_t* v = points_ptr + 3 * nb[k];
+                const scalar_t* c = colors_ptr + 3 * nb[k];
+                const double d = (double(v[0]) - vt[0]) * nt[0] +
+                                 (double(v[1]) - vt[1]) * nt[1] +
+                                 (double(v[2]) - vt[2]) * nt[2];
+                double a[3];
+                for (int i = 0; i < 3; ++i) {
+                    a[i] = double(v[i]) - d * nt[i] - vt[i];
+                }
+                const double b = (double(c[0]) + c[1] + c[2]) / 3 - it;
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) {
+                        AtA[i][j] += a[i] * a[j];
+                    }
+                    Atb[i] += a[i] * b;
+                }
+                ++count;
+            }
+            if (count < 3) {
+                return;
+            }
+            // Orthogonality constraint to the normal, weighted by the number
+            // of neighbors.
+            const double w = double(count) * double(count);
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    AtA[i][j] += w * nt[i] * nt[j];
+                }
+            }
+
+            // Cramer's rule.
+            const double c0 = AtA[1][1] * AtA[2][2] - AtA[1][2] * AtA[2][1];
+            const double c1 = AtA[1][2] * AtA[2][0] - AtA[1][0] * AtA[2][2];
+            const double c2 = AtA[1][0] * AtA[2][1] - AtA[1][1] * AtA[2][0];
+            const double det =
+                    AtA[0][0] * c0 + AtA[0][1] * c1 + AtA[0][2] * c2;
+            if (det == 0) {
+                return;
+            }
+            const double x =
+                    (Atb[0] * c0 +
+                     AtA[0][1] * (AtA[1][2] * Atb[2] - Atb[1] * AtA[2][2]) +
+                     AtA[0][2] * (Atb[1] * AtA[2][1] - AtA[1][1] * Atb[2])) /
+                    det;
+            const double y =
+                    (AtA[0][0] * (Atb[1] * AtA[2][2] - AtA[1][2] * Atb[2]) +
+                     Atb[0] * c1 +
+                     AtA[0][2] * (AtA[1][0] * Atb[2] - Atb[1] * AtA[2][0])) /
+                    det;
+            const double z =
+                    (AtA[0][0] * (AtA[1][1] * Atb[2] - Atb[1] * AtA[2][1]) +
+                     AtA[0][1] * (Atb[1] * AtA[2][0] - AtA[1][0] * Atb[2]) +
+                     Atb[0] * c2) /
+                    det;
+            gradient[0] = static_cast<scalar_t>(x);
+            gradient[1] = static_cast<scalar_t>(y);
+            gradient[2] = static_cast<scalar_t>(z);
+        });
+    });
+}
+
+/// Uniform grid with cells of size eps over the points sorted by the Morton
+/// code of their cell. The points of a cell are found by binary search.
+template <typename scalar_t>
+struct DBSCANGrid {
+    const scalar_t* points_ptr;
+    const int64_t* sorted_codes_ptr;
+    const int64_t* order_ptr;
+    int64_t n;
+    double min_bound[3];
+    double inv_eps;
+    double eps2;
+    int64_t grid_max;
+
+    OPEN3D_HOST_DEVICE void GetCell(const scalar_t* p, int64_t cell[3]) const {
+        for (int i = 0; i < 3; ++i) {
+            cell[i] = int64_t(floor((double(p[i]) - min_bound[i]) * inv_eps));
+        }
+    }
+
+    OPEN3D_HOST_DEVICE int64_t GetCode(const int64_t cell[3]) const {
+        return int64_t(MortonCode3D(uint64_t(cell[0]), uint64_t(cell[1]),
+                                    uint64_t(cell[2])));
+    }
+
+    /// Calls f(nb) for every point nb within eps of point idx, including
+    /// idx itself.
+    template <typename func_t>
+    OPEN3D_HOST_DEVICE void ForEachNeighbor(int64_t idx, func_t f) const {
+        const scalar_t* p = points_ptr + 3 * idx;
+        int64_t cell[3];
+        GetCell(p, cell);
+        for (int64_t x = cell[0] - 1; x <= cell[0] + 1; ++x) {
+            for (int64_t y = cell[1] - 1; y <= cell[1] + 1; ++y) {
+                for (int64_t z = cell[2] - 1; z <= cell[2] + 1; ++z) {
+                    if (x < 0 || y < 0 || z < 0 || x > grid_max ||
+                        y > grid_max || z > grid_max) {
+                        continue;
+                    }
+                    const int64_t nb_cell[3] = {x, y, z};
+                    const int64_t code = GetCode(nb_cell);
+                    int64_t lo = 0, hi = n;
+                    while (lo < hi) {
+                        int64_t mid = lo + (hi - lo) / 2;
+                        if (sorted_codes_ptr[mid] < code) {
+                            lo = mid + 1;
+                        } else {
+                            hi = mid;
+                        }
+                    }
+                    for (; lo < n && sorted_codes_ptr[lo] == code; ++lo) {
+                        const int64_t nb = order_ptr[lo];
+                        const scalar_t* q = points_ptr + 3 * nb;
+                        double dx = double(q[0]) - double(p[0]);
+                        double dy = double(q[1]) - double(p[1]);
+                        double dz = double(q[2]) - double(p[2]);
+                        if (dx * dx + dy * dy + dz * dz < eps2) {
+                            f(nb);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+#if defined(__CUDACC__)
+void ClusterDBSCANCUDA
+#else
+void ClusterDBSCANCPU
+#endif
+        (const core::Tensor& points,
+         double eps,
+         int64_t min_points,
+         core::Tensor& labels) {
+    core::Device device = points.GetDevice();
+    int64_t n = points.GetLength();
+    labels = core::Tensor::Full({n}, -1, core::Dtype::Int32, device);
+    if (n == 0) {
+        return;
+    }
+
+    static const core::Device host("CPU:0");
+    core::Tensor min_bound, max_bound;
+    std::tie(min_bound, max_bound) = points.MinMax({0});
+    std::vector<double> min_d =
+            min_bound.To(host, core::Dtype::Float64).ToFlatVector<double>();
+    std::vector<double> max_d =
+            max_bound.To(host, core::Dtype::Float64).ToFlatVector<double>();
+    double extent = std::max({max_d[0] - min_d[0], max_d[1] - min_d[1],
+                              max_d[2] - min_d[2]});
+    // Morton codes hold 21 bits per axis.
+    const int64_t grid_max = (int64_t(1) << 21) - 1;
+    if (!(extent / eps < double(grid_max))) {
+        utility::LogError(
+                "[ClusterDBSCAN] eps {} is too small for the extent {} of "
+                "the point cloud.",
+                eps, extent);
+    }
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        DBSCANGrid<scalar_t> grid;
+        grid.points_ptr = points.GetDataPtr<scalar_t>();
+        grid.n = n;
+        for (int i = 0; i < 3; ++i) {
+            grid.min_bound[i] = min_d[i];
+        }
+        grid.inv_eps = 1.0 / eps;
+        grid.eps2 = eps * eps;
+        grid.grid_max = grid_max;
+
+        core::Tensor codes({n}, core::Dtype::Int64, device);
+        int64_t* codes_ptr = codes.GetDataPtr<int64_t>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            int64_t cell[3];
+            grid.GetCell(grid.points_ptr + 3 * workload_idx, cell);
+            codes_ptr[workload_idx] = grid.GetCode(cell);
+        });
+
+        core::Tensor order =
+                core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device);
+        int64_t* order_ptr = order.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+        thrust::sort_by_key(thrust::device, codes_ptr, codes_ptr + n,
+                            order_ptr);
+#else
+        tbb::parallel_sort(order_ptr, order_ptr + n,
+                           [codes_ptr](int64_t a, int64_t b) {
+                               return codes_ptr[a] < codes_ptr[b] ||
+                                      (codes_ptr[a] == codes_ptr[b] && a < b);
+                           });
+        codes = codes.IndexGet({order});
+#endif
+        grid.sorted_codes_ptr = codes.GetDataPtr<int64_t>();
+        grid.order_ptr = order_ptr;
+
+        // Only the neighbor counts are kept, so memory stays linear in the
+        // number of points.
+        core::Tensor is_core({n}, core::Dtype::Bool, device);
+        bool* is_core_ptr = is_core.GetDataPtr<bool>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            int64_t count = 0;
+            grid.ForEachNeighbor(workload_idx, [&](int64_t) { ++count; });
+            is_core_ptr[workload_idx] = count >= min_points;
+        });
+
+        // Connect the core points within eps.
+#if defined(__CUDACC__)
+        core::Tensor parents_tensor =
+                core::Tensor::Arange(0, n, 1, core::Dtype::Int32, device);
+        DisjointSetParent* parents = parents_tensor.GetDataPtr<int>();
+#else
+        std::vector<DisjointSetParent> parents_vector(n);
+        DisjointSetParent* parents = parents_vector.data();
+        launcher.LaunchGeneralKernel(n, [=](int64_t workload_idx) {
+            StoreParent(parents, int(workload_idx), int(workload_idx));
+        });
+#endif
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            if (!is_core_ptr[workload_idx]) {
+                return;
+            }
+            grid.ForEachNeighbor(workload_idx, [&](int64_t nb) {
+                if (nb < workload_idx && is_core_ptr[nb]) {
+                    UnionSets(parents, int(workload_idx), int(nb));
+                }
+            });
+        });
+
+        core::Tensor roots({n}, core::Dtype::Int32, device);
+        int* roots_ptr = roots.GetDataPtr<int>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            roots_ptr[workload_idx] = FindRoot(parents, int(workload_idx));
+        });
+
+        // Number the clusters by their smallest core point, like the serial
+        // algorithm does.
+        core::Tensor root_indices =
+                is_core.LogicalAnd(roots.Eq(core::Tensor::Arange(
+                                           0, n, 1, core::Dtype::Int32,
+                                           device)))
+                        .NonZero()[0];
+        core::Tensor root_labels({n}, core::Dtype::Int32, device);
+        root_labels.IndexSet(
+                {root_indices},
+                core::Tensor::Arange(0, root_indices.GetLength(), 1,
+                                     core::Dtype::Int32, device));
+        const int* root_labels_ptr = root_labels.GetDataPtr<int>();
+        int* labels_ptr = labels.GetDataPtr<int>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            if (is_core_ptr[workload_idx]) {
+                labels_ptr[workload_idx] =
+                        root_labels_ptr[roots_ptr[workload_idx]];
+            }
+        });
+
+        // Border points join the neighboring cluster with the smallest label,
+        // which is the first one to reach them in the serial algorithm.
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            if (is_core_ptr[workload_idx]) {
+                return;
+            }
+            int label = -1;
+            grid.ForEachNeighbor(workload_idx, [&](int64_t nb) {
+                if (is_core_ptr[nb] &&
+                    (label == -1 || labels_ptr[nb] < label)) {
+                    label = labels_ptr[nb];
+                }
+            });
+            labels_ptr[workload_idx] = label;
+        });
+    });
+}
+/// Eigenvalues of the symmetric matrix A in ascending order, with the same
+/// closed form as FastEigen3x3.
+OPEN3D_HOST_DEVICE static inline void EigenValues3x3(const double A[3][3],
+                                                     double eval[3]) {
+    double max_coeff = 0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            double a = A[i][j] < 0 ? -A[i][j] : A[i][j];
+            max_coeff = a > max_coeff ? a : max_coeff;
+        }
+    }
+    if (max_coeff == 0) {
+        eval[0] = eval[1] = eval[2] = 0;
+        return;
+    }
+    double B[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            B[i][j] = A[i][j] / max_coeff;
+        }
+    }
+
+    double norm = B[0][1] * B[0][1] + B[0][2] * B[0][2] + B[1][2] * B[1][2];
+    if (norm > 0) {
+        double q = (B[0][0] + B[1][1] + B[2][2]) / 3;
+        double b00 = B[0][0] - q;
+        double b11 = B[1][1] - q;
+        double b22 = B[2][2] - q;
+        double p = sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+
+        double c00 = b11 * b22 - B[1][2] * B[1][2];
+        double c01 = B[0][1] * b22 - B[1][2] * B[0][2];
+        double c02 = B[0][1] * B[1][2] - b11 * B[0][2];
+        double det = (b00 * c00 - B[0][1] * c01 + B[0][2] * c02) / (p * p * p);
+        double half_det = det * 0.5;
+        half_det = half_det < -1 ? -1 : (half_det > 1 ? 1 : half_det);
+
+        double angle = acos(half_det) / 3;
+        const double two_thirds_pi = 2.09439510239319549;
+        double beta2 = cos(angle) * 2;
+        double beta0 = cos(angle + two_thirds_pi) * 2;
+        double beta1 = -(beta0 + beta2);
+        eval[0] = q + p * beta0;
+        eval[1] = q + p * beta1;
+        eval[2] = q + p * beta2;
+    } else {
+        eval[0] = B[0][0];
+        eval[1] = B[1][1];
+        eval[2] = B[2][2];
+        for (int i = 0; i < 2; ++i) {
+            for (int j = 0; j < 2 - i; ++j) {
+                if (eval[j] > eval[j + 1]) {
+                    double tmp = eval[j];
+                    eval[j] = eval[j + 1];
+                    eval[j + 1] = tmp;
+                }
+            }
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        eval[i] *= max_coeff;
+    }
+}
+
+/// Ends of the neighbors of each point in the concatenated neighbor indices
+/// of a fixed radius search.
+static core::Tensor NeighborEnds(const core::Tensor& num_neighbors) {
+    int64_t n = num_neighbors.GetLength();
+    core::Tensor ends({n}, core::Dtype::Int64, num_neighbors.GetDevice());
+    const int64_t* num_neighbors_ptr = num_neighbors.GetDataPtr<int64_t>();
+    int64_t* ends_ptr = ends.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, num_neighbors_ptr,
+                           num_neighbors_ptr + n, ends_ptr);
+#else
+    utility::InclusivePrefixSum(num_neighbors_ptr, num_neighbors_ptr + n,
+                                ends_ptr);
+#endif
+    return ends;
+}
+
+#if defined(__CUDACC__)
+void ComputeISSSaliencyCUDA
+#else
+void ComputeISSSaliencyCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& indices,
+         const core::Tensor& num_neighbors,
+         double gamma_21,
+         double gamma_32,
+         int64_t min_neighbors,
+         core::Tensor& saliency) {
+    int64_t n = points.GetLength();
+    saliency = core::Tensor::Zeros({n}, core::Dtype::Float64,
+                                   points.GetDevice());
+    if (n == 0) {
+        return;
+    }
+    core::Tensor ends = NeighborEnds(num_neighbors);
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    const int64_t* num_neighbors_ptr = num_neighbors.GetDataPtr<int64_t>();
+    const int64_t* ends_ptr = ends.GetDataPtr<int64_t>();
+    double* saliency_ptr = saliency.GetDataPtr<double>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            int64_t count = num_neighbors_ptr[workload_idx];
+            if (count < min_neighbors || count == 0) {
+                return;
+            }
+            const int64_t* nb = indices_ptr + ends_ptr[workload_idx] - count;
+
+            // Covariance from the first and second order moments, like
+            // utility::ComputeCovariance.
+            double cumulants[9] = {0};
+            for (int64_t k = 0; k < count; ++k) {
+                const scalar_t* p = points_ptr + 3 * nb[k];
+                double x = p[0], y = p[1], z = p[2];
+                cumulants[0] += x;
+                cumulants[1] += y;
+                cumulants[2] += z;
+                cumulants[3] += x * x;
+                cumulants[4] += x * y;
+                cumulants[5] += x * z;
+                cumulants[6] += y * y;
+                cumulants[7] += y * z;
+                cumulants[8] += z * z;
+            }
+            for (int i = 0; i < 9; ++i) {
+                cumulants[i] /= count;
+            }
+            double A[3][3];
+            A[0][0] = cumulants[3] - cumulants[0] * cumulants[0];
+            A[1][1] = cumulants[6] - cumulants[1] * cumulants[1];
+            A[2][2] = cumulants[8] - cumulants[2] * cumulants[2];
+            A[0][1] = A[1][0] = cumulants[4] - cumulants[0] * cumulants[1];
+            A[0][2] = A[2][0] = cumulants[5] - cumulants[0] * cumulants[2];
+            A[1][2] = A[2][1] = cumulants[7] - cumulants[1] * cumulants[2];
+
+            double eval[3];
+            EigenValues3x3(A, eval);
+            if (eval[1] / eval[2] < gamma_21 && eval[0] / eval[1] < gamma_32) {
+                saliency_ptr[workload_idx] = eval[0];
+            }
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void SuppressNonMaximaCUDA
+#else
+void SuppressNonMaximaCPU
+#endif
+        (const core::Tensor& saliency,
+         const core::Tensor& indices,
+         const core::Tensor& num_neighbors,
+         int64_t min_neighbors,
+         core::Tensor& mask) {
+    int64_t n = saliency.GetLength();
+    mask = core::Tensor({n}, core::Dtype::Bool, saliency.GetDevice());
+    if (n == 0) {
+        return;
+    }
+    core::Tensor ends = NeighborEnds(num_neighbors);
+    const double* saliency_ptr = saliency.GetDataPtr<double>();
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    const int64_t* num_neighbors_ptr = num_neighbors.GetDataPtr<int64_t>();
+    const int64_t* ends_ptr = ends.GetDataPtr<int64_t>();
+    bool* mask_ptr = mask.GetDataPtr<bool>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        double value = saliency_ptr[workload_idx];
+        int64_t count = num_neighbors_ptr[workload_idx];
+        bool is_max = value > 0 && count >= min_neighbors;
+        const int64_t* nb = indices_ptr + ends_ptr[workload_idx] - count;
+        for (int64_t k = 0; is_max && k < count; ++k) {
+            is_max = saliency_ptr[nb[k]] <= value;
+        }
+        mask_ptr[workload_idx] = is_max;
+    });
+}
+
+/// Sorts the points by segment id. Returns the Int64 indices of the points
+/// in segment order, and sets \p offsets of shape (S + 1,) such that the
+/// points of segment s are at positions [offsets[s], offsets[s + 1]) of the
+/// order. Points with an id out of [0, S) are not in any segment.
+static core::Tensor GroupBySegment(const core::Tensor& segment_ids,
+                                   int64_t num_segments,
+                                   core::Tensor& offsets) {
+    int64_t n = segment_ids.GetLength();
+    core::Device device = segment_ids.GetDevice();
+    core::Tensor order =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device);
+    int64_t* order_ptr = order.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    core::Tensor sorted_ids = segment_ids.Clone();
+    int64_t* sorted_ids_ptr = sorted_ids.GetDataPtr<int64_t>();
+    thrust::sort_by_key(thrust::device, sorted_ids_ptr, sorted_ids_ptr + n,
+                        order_ptr);
+#else
+    const int64_t* ids_ptr = segment_ids.GetDataPtr<int64_t>();
+    tbb::parallel_sort(order_ptr, order_ptr + n,
+                       [ids_ptr](int64_t a, int64_t b) {
+                           return ids_ptr[a] < ids_ptr[b] ||
+                                  (ids_ptr[a] == ids_ptr[b] && a < b);
+                       });
+    core::Tensor sorted_ids = segment_ids.IndexGet({order});
+    const int64_t* sorted_ids_ptr = sorted_ids.GetDataPtr<int64_t>();
+#endif
+
+    offsets = core::Tensor({num_segments + 1}, core::Dtype::Int64, device);
+    int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+    launcher.LaunchGeneralKernel(
+            num_segments + 1, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                // First position with an id of at least workload_idx.
+                int64_t lo = 0, hi = n;
+                while (lo < hi) {
+                    int64_t mid = lo + (hi - lo) / 2;
+                    if (sorted_ids_ptr[mid] < workload_idx) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                offsets_ptr[workload_idx] = lo;
+            });
+    return order;
+}
+
+#if defined(__CUDACC__)
+void ComputeSegmentAxisAlignedBoundingBoxesCUDA
+#else
+void ComputeSegmentAxisAlignedBoundingBoxesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& segment_ids,
+         int64_t num_segments,
+         core::Tensor& min_bounds,
+         core::Tensor& max_bounds) {
+    core::Dtype dtype = points.GetDtype();
+    core::Device device = points.GetDevice();
+    min_bounds = core::Tensor({num_segments, 3}, dtype, device);
+    max_bounds = core::Tensor({num_segments, 3}, dtype, device);
+    if (num_segments == 0) {
+        return;
+    }
+    core::Tensor offsets;
+    core::Tensor order = GroupBySegment(segment_ids, num_segments, offsets);
+    const int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* min_ptr = min_bounds.GetDataPtr<scalar_t>();
+        scalar_t* max_ptr = max_bounds.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                num_segments, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t begin = offsets_ptr[workload_idx];
+                    int64_t end = offsets_ptr[workload_idx + 1];
+                    scalar_t* lo = min_ptr + 3 * workload_idx;
+                    scalar_t* hi = max_ptr + 3 * workload_idx;
+                    if (begin == end) {
+                        for (int i = 0; i < 3; ++i) {
+                            lo[i] = hi[i] = 0;
+                        }
+                        return;
+                    }
+                    const scalar_t* p = points_ptr + 3 * order_ptr[begin];
+                    for (int i = 0; i < 3; ++i) {
+                        lo[i] = hi[i] = p[i];
+                    }
+                    for (int64_t k = begin + 1; k < end; ++k) {
+                        p = points_ptr + 3 * order_ptr[k];
+                        for (int i = 0; i < 3; ++i) {
+                            lo[i] = p[i] < lo[i] ? p[i] : lo[i];
+                            hi[i] = p[i] > hi[i] ? p[i] : hi[i];
+                        }
+                    }
+                });
+    });
+}
+
+/// Eigen-decomposition of the symmetric matrix A with the cyclic Jacobi
+/// method. The eigenvalues are sorted in decreasing order and evec[i] is the
+/// unit eigenvector of eval[i]. A is modified.
+OPEN3D_HOST_DEVICE static inline void JacobiEigen3x3(double A[3][3],
+                                                     double eval[3],
+                                                     double evec[3][3]) {
+    double V[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    for (int sweep = 0; sweep < 32; ++sweep) {
+        double off = A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2];
+        double diag = A[0][0] * A[0][0] + A[1][1] * A[1][1] + A[2][2] * A[2][2];
+        if (off <= 1e-30 * diag || off == 0) {
+            break;
+        }
+        for (int p = 0; p < 2; ++p) {
+            for (int q = p + 1; q < 3; ++q) {
+                double apq = A[p][q];
+                if (apq == 0) {
+                    continue;
+                }
+                // Rotation in the (p, q) plane that zeroes A[p][q].
+                double theta = (A[q][q] - A[p][p]) / (2 * apq);
+                double t = (theta >= 0 ? 1 : -1) /
+                           (fabs(theta) + sqrt(theta * theta + 1));
+                double c = 1 / sqrt(t * t + 1);
+                double s = t * c;
+                int r = 3 - p - q;
+                double arp = A[r][p], arq = A[r][q];
+                A[p][p] -= t * apq;
+                A[q][q] += t * apq;
+                A[p][q] = A[q][p] = 0;
+                A[r][p] = A[p][r] = c * arp - s * arq;
+                A[r][q] = A[q][r] = s * arp + c * arq;
+                for (int k = 0; k < 3; ++k) {
+                    double vkp = V[k][p], vkq = V[k][q];
+                    V[k][p] = c * vkp - s * vkq;
+                    V[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+    int idx[3] = {0, 1, 2};
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2 - i; ++j) {
+            if (A[idx[j]][idx[j]] < A[idx[j + 1]][idx[j + 1]]) {
+                int tmp = idx[j];
+                idx[j] = idx[j + 1];
+                idx[j + 1] = tmp;
+            }
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        eval[i] = A[idx[i]][idx[i]];
+        for (int k = 0; k < 3; ++k) {
+            evec[i][k] = V[k][idx[i]];
+        }
+    }
+}
+
+/// Range [lo, hi] of the projections of the points onto \p axis.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline void ProjectedRange(
+        const scalar_t* points_ptr,
+        const int64_t* indices,
+        int64_t count,
+        const double axis[3],
+        double& lo,
+        double& hi) {
+    lo = INFINITY;
+    hi = -INFINITY;
+    for (int64_t k = 0; k < count; ++k) {
+        const scalar_t* p = points_ptr + 3 * indices[k];
+        double d = axis[0] * p[0] + axis[1] * p[1] + axis[2] * p[2];
+        lo = d < lo ? d : lo;
+        hi = d > hi ? d : hi;
+    }
+}
+
+/// Rotates the orthonormal axes \p u and \p v by \p angle in their plane.
+OPEN3D_HOST_DEVICE static inline void RotateInPlane(const double u[3],
+                                                    const double v[3],
+                                                    double angle,
+                                                    double u_rot[3],
+                                                    double v_rot[3]) {
+    double c = cos(angle), s = sin(angle);
+    for (int i = 0; i < 3; ++i) {
+        u_rot[i] = c * u[i] + s * v[i];
+        v_rot[i] = c * v[i] - s * u[i];
+    }
+}
+
+/// Area of the rectangle bounding the projections of the points onto the
+/// plane of \p u and \p v, rotated by \p angle.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline double SectionArea(const scalar_t* points_ptr,
+                                                    const int64_t* indices,
+                                                    int64_t count,
+                                                    const double u[3],
+                                                    const double v[3],
+                                                    double angle) {
+    double u_rot[3], v_rot[3];
+    RotateInPlane(u, v, angle, u_rot, v_rot);
+    double u_lo, u_hi, v_lo, v_hi;
+    ProjectedRange(points_ptr, indices, count, u_rot, u_lo, u_hi);
+    ProjectedRange(points_ptr, indices, count, v_rot, v_lo, v_hi);
+    return (u_hi - u_lo) * (v_hi - v_lo);
+}
+
+/// Angle in [-pi / 64, pi / 2 + pi / 64) by which to rotate \p u and \p v in
+/// their plane to minimize SectionArea. The area is pi / 2 periodic.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline double MinimizeSectionArea(
+        const scalar_t* points_ptr,
+        const int64_t* indices,
+        int64_t count,
+        const double u[3],
+        const double v[3],
+        double& min_area) {
+    const int num_samples = 32;
+    const double step = 1.57079632679489662 / num_samples;
+    double best_angle = 0;
+    min_area = INFINITY;
+    for (int k = 0; k < num_samples; ++k) {
+        double area = SectionArea(points_ptr, indices, count, u, v, k * step);
+        if (area < min_area) {
+            min_area = area;
+            best_angle = k * step;
+        }
+    }
+
+    // Golden section search around the best sample.
+    const double inv_phi = 0.61803398874989485;
+    double a = best_angle - step, b = best_angle + step;
+    double x1 = b - inv_phi * (b - a), x2 = a + inv_phi * (b - a);
+    double f1 = SectionArea(points_ptr, indices, count, u, v, x1);
+    double f2 = SectionArea(points_ptr, indices, count, u, v, x2);
+    for (int iter = 0; iter < 24; ++iter) {
+        if (f1 < min_area) {
+            min_area = f1;
+            best_angle = x1;
+        }
+        if (f2 < min_area) {
+            min_area = f2;
+            best_angle = x2;
+        }
+        if (f1 < f2) {
+            b = x2;
+            x2 = x1;
+            f2 = f1;
+            x1 = b - inv_phi * (b - a);
+            f1 = SectionArea(points_ptr, indices, count, u, v, x1);
+        } else {
+            a = x1;
+            x1 = x2;
+            f1 = f2;
+            x2 = a + inv_phi * (b - a);
+            f2 = SectionArea(points_ptr, indices, count, u, v, x2);
+        }
+    }
+    return best_angle;
+}
+
+/// Oriented bounding box of the \p count points at \p indices, see
+/// ComputeSegmentOrientedBoundingBoxes. \p R is the row-major rotation.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline void OrientedBoundingBox(
+        const scalar_t* points_ptr,
+        const int64_t* indices,
+        int64_t count,
+        bool minimal,
+        scalar_t* center,
+        scalar_t* R,
+        scalar_t* extent) {
+    if (count == 0) {
+        for (int i = 0; i < 9; ++i) {
+            R[i] = i % 4 == 0 ? 1 : 0;
+        }
+        for (int i = 0; i < 3; ++i) {
+            center[i] = extent[i] = 0;
+        }
+        return;
+    }
+
+    // Principal axes from the first and second order moments.
+    double cumulants[9] = {0};
+    for (int64_t k = 0; k < count; ++k) {
+        const scalar_t* p = points_ptr + 3 * indices[k];
+        double x = p[0], y = p[1], z = p[2];
+        cumulants[0] += x;
+        cumulants[1] += y;
+        cumulants[2] += z;
+        cumulants[3] += x * x;
+        cumulants[4] += x * y;
+        cumulants[5] += x * z;
+        cumulants[6] += y * y;
+        cumulants[7] += y * z;
+        cumulants[8] += z * z;
+    }
+    for (int i = 0; i < 9; ++i) {
+        cumulants[i] /= count;
+    }
+    double A[3][3];
+    A[0][0] = cumulants[3] - cumulants[0] * cumulants[0];
+    A[1][1] = cumulants[6] - cumulants[1] * cumulants[1];
+    A[2][2] = cumulants[8] - cumulants[2] * cumulants[2];
+    A[0][1] = A[1][0] = cumulants[4] - cumulants[0] * cumulants[1];
+    A[0][2] = A[2][0] = cumulants[5] - cumulants[0] * cumulants[2];
+    A[1][2] = A[2][1] = cumulants[7] - cumulants[1] * cumulants[2];
+    double eval[3], axes[3][3];
+    JacobiEigen3x3(A, eval, axes);
+    // Right-handed frame.
+    axes[2][0] = axes[0][1] * axes[1][2] - axes[0][2] * axes[1][1];
+    axes[2][1] = axes[0][2] * axes[1][0] - axes[0][0] * axes[1][2];
+    axes[2][2] = axes[0][0] * axes[1][1] - axes[0][1] * axes[1][0];
+
+    double lo[3], hi[3];
+    for (int i = 0; i < 3; ++i) {
+        ProjectedRange(points_ptr, indices, count, axes[i], lo[i], hi[i]);
+    }
+    if (minimal) {
+        double min_volume = (hi[0] - lo[0]) * (hi[1] - lo[1]) * (hi[2] - lo[2]);
+        double pca_axes[3][3];
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                pca_axes[i][j] = axes[i][j];
+            }
+        }
+        for (int fixed = 0; fixed < 3; ++fixed) {
+            const double* u = pca_axes[(fixed + 1) % 3];
+            const double* v = pca_axes[(fixed + 2) % 3];
+            double area;
+            double angle = MinimizeSectionArea(points_ptr, indices, count, u,
+                                               v, area);
+            double volume = area * (hi[fixed] - lo[fixed]);
+            if (volume < min_volume) {
+                min_volume = volume;
+                for (int j = 0; j < 3; ++j) {
+                    axes[fixed][j] = pca_axes[fixed][j];
+                }
+                RotateInPlane(u, v, angle, axes[(fixed + 1) % 3],
+                              axes[(fixed + 2) % 3]);
+            }
+        }
+        for (int i = 0; i < 3; ++i) {
+            ProjectedRange(points_ptr, indices, count, axes[i], lo[i], hi[i]);
+        }
+    }
+
+    for (int j = 0; j < 3; ++j) {
+        double c = 0;
+        for (int i = 0; i < 3; ++i) {
+            c += axes[i][j] * (lo[i] + hi[i]) / 2;
+            R[3 * j + i] = scalar_t(axes[i][j]);
+        }
+        center[j] = scalar_t(c);
+        extent[j] = scalar_t(hi[j] - lo[j]);
+    }
+}
+
+#if defined(__CUDACC__)
+void ComputeSegmentOrientedBoundingBoxesCUDA
+#else
+void ComputeSegmentOrientedBoundingBoxesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& segment_ids,
+         int64_t num_segments,
+         bool minimal,
+         core::Tensor& centers,
+         core::Tensor& rotations,
+         core::Tensor& extents) {
+    core::Dtype dtype = points.GetDtype();
+    core::Device device = points.GetDevice();
+    centers = core::Tensor({num_segments, 3}, dtype, device);
+    rotations = core::Tensor({num_segments, 3, 3}, dtype, device);
+    extents = core::Tensor({num_segments, 3}, dtype, device);
+    if (num_segments == 0) {
+        return;
+    }
+    core::Tensor offsets;
+    core::Tensor order = GroupBySegment(segment_ids, num_segments, offsets);
+    const int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* centers_ptr = centers.GetDataPtr<scalar_t>();
+        scalar_t* rotations_ptr = rotations.GetDataPtr<scalar_t>();
+        scalar_t* extents_ptr = extents.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                num_segments, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t begin = offsets_ptr[workload_idx];
+                    int64_t end = offsets_ptr[workload_idx + 1];
+                    OrientedBoundingBox(points_ptr, order_ptr + begin,
+                                        end - begin, minimal,
+                                        centers_ptr + 3 * workload_idx,
+                                        rotations_ptr + 9 * workload_idx,
+                                        extents_ptr + 3 * workload_idx);
+                });
+    });
+}
+
+/// Transforms point \p idx of a segment with the transformation \p T, and
+/// its normal if \p normals_ptr is not null.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline void TransformSegmentPoint(
+        scalar_t* points_ptr,
+        scalar_t* normals_ptr,
+        int64_t idx,
+        const double* T) {
+    scalar_t* p = points_ptr + 3 * idx;
+    double x = p[0], y = p[1], z = p[2];
+    p[0] = static_cast<scalar_t>(T[0] * x + T[1] * y + T[2] * z + T[3]);
+    p[1] = static_cast<scalar_t>(T[4] * x + T[5] * y + T[6] * z + T[7]);
+    p[2] = static_cast<scalar_t>(T[8] * x + T[9] * y + T[10] * z + T[11]);
+    if (normals_ptr != nullptr) {
+        scalar_t* nm = normals_ptr + 3 * idx;
+        x = nm[0], y = nm[1], z = nm[2];
+        nm[0] = static_cast<scalar_t>(T[0] * x + T[1] * y + T[2] * z);
+        nm[1] = static_cast<scalar_t>(T[4] * x + T[5] * y + T[6] * z);
+        nm[2] = static_cast<scalar_t>(T[8] * x + T[9] * y + T[10] * z);
+    }
+}
+
+#if defined(__CUDACC__)
+void TransformSegmentsCUDA
+#else
+void TransformSegmentsCPU
+#endif
+        (const core::Tensor& point_ptrs,
+         const core::Tensor& normal_ptrs,
+         const core::Tensor& offsets,
+         const core::Tensor& transformations,
+         core::Dtype dtype) {
+    const int64_t num_segments = point_ptrs.GetLength();
+    const int64_t n = offsets[num_segments].Item<int64_t>();
+    const int64_t* point_ptrs_ptr = point_ptrs.GetDataPtr<int64_t>();
+    const int64_t* normal_ptrs_ptr = normal_ptrs.GetDataPtr<int64_t>();
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    const double* transformations_ptr = transformations.GetDataPtr<double>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    // The last segment starting at or before the point.
+                    int64_t lo = 0, hi = num_segments;
+                    while (hi - lo > 1) {
+                        int64_t mid = (lo + hi) / 2;
+                        if (offsets_ptr[mid] <= workload_idx) {
+                            lo = mid;
+                        } else {
+                            hi = mid;
+                        }
+                    }
+                    TransformSegmentPoint(
+                            reinterpret_cast<scalar_t*>(point_ptrs_ptr[lo]),
+                            reinterpret_cast<scalar_t*>(normal_ptrs_ptr[lo]),
+                            workload_idx - offsets_ptr[lo],
+                            transformations_ptr + 16 * lo);
+                });
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
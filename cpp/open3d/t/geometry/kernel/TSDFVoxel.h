@@ -27,6 +27,7 @@
 #include <atomic>
 
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Half.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 
@@ -41,6 +42,21 @@
         } else if (BYTESIZE == sizeof(Voxel32f)) {           \
             using voxel_t = Voxel32f;                        \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel16f)) {    \
+            using voxel_t = ColoredVoxel16f;                 \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel16f)) {           \
+            using voxel_t = Voxel16f;                        \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel8q)) {            \
+            using voxel_t = Voxel8q;                         \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel8q)) {     \
+            using voxel_t = ColoredVoxel8q;                  \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel16q)) {    \
+            using voxel_t = ColoredVoxel16q;                 \
+            return __VA_ARGS__();                            \
         } else {                                             \
             utility::LogError("Unsupported voxel bytesize"); \
         }                                                    \
@@ -64,6 +80,7 @@ struct Voxel32f {
     OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
     OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
     OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) { weight *= factor; }
 
     OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
         tsdf = (weight * tsdf + dsdf) / (weight + 1);
@@ -105,6 +122,9 @@ struct ColoredVoxel16i {
     OPEN3D_HOST_DEVICE float GetB() {
         return static_cast<float>(b / kColorFactor);
     }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) {
+        weight = static_cast<uint16_t>(floorf(weight * factor));
+    }
     OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
         float inc_wsum = static_cast<float>(weight) + 1;
         float inv_wsum = 1.0f / inc_wsum;
@@ -148,6 +168,7 @@ struct ColoredVoxel32f {
     OPEN3D_HOST_DEVICE float GetR() { return r; }
     OPEN3D_HOST_DEVICE float GetG() { return g; }
     OPEN3D_HOST_DEVICE float GetB() { return b; }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) { weight *= factor; }
     OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
         float inv_wsum = 1.0f / (weight + 1);
         tsdf = (weight * tsdf + dsdf) * inv_wsum;
@@ -167,56 +188,391 @@ struct ColoredVoxel32f {
     }
 };
 
-// Get a voxel in a certain voxel block given the block id with its neighbors.
+/// 4-byte voxel structure.
+/// Half tsdf and weight, halves the memory and bandwidth of Voxel32f. The
+/// weight saturates at kMaxWeight, beyond which Half can no longer represent
+/// consecutive integers.
+struct Voxel16f {
+    static constexpr float kMaxWeight = 2048.0f;
+
+    core::Half tsdf;
+    core::Half weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return weight; }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) {
+        weight = static_cast<float>(weight) * factor;
+    }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float w = weight;
+        tsdf = (w * tsdf + dsdf) / (w + 1);
+        weight = w + 1 < kMaxWeight ? w + 1 : kMaxWeight;
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel16f] should never reach here.\n");
+    }
+};
+
+/// 10-byte voxel structure.
+/// Half tsdf, weight and colors. Colors are averaged in the input range of
+/// [0, 255], where Half keeps at least 3 fractional bits.
+struct ColoredVoxel16f {
+    static constexpr float kMaxWeight = 2048.0f;
+
+    core::Half tsdf;
+    core::Half weight;
+
+    core::Half r;
+    core::Half g;
+    core::Half b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return weight; }
+    OPEN3D_HOST_DEVICE float GetR() { return r; }
+    OPEN3D_HOST_DEVICE float GetG() { return g; }
+    OPEN3D_HOST_DEVICE float GetB() { return b; }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) {
+        weight = static_cast<float>(weight) * factor;
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float w = weight;
+        float inv_wsum = 1.0f / (w + 1);
+        tsdf = (w * tsdf + dsdf) * inv_wsum;
+        weight = w + 1 < kMaxWeight ? w + 1 : kMaxWeight;
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        float w = weight;
+        float inv_wsum = 1.0f / (w + 1);
+        tsdf = (w * tsdf + dsdf) * inv_wsum;
+        r = (w * r + dr) * inv_wsum;
+        g = (w * g + dg) * inv_wsum;
+        b = (w * b + db) * inv_wsum;
+        weight = w + 1 < kMaxWeight ? w + 1 : kMaxWeight;
+    }
+};
+
+// Quantized voxels are stored in bytes only, so that they are 1-byte aligned
+// and packed without padding. 16-bit fields are little-endian.
+OPEN3D_HOST_DEVICE inline uint16_t LoadUInt16(const uint8_t* ptr) {
+    return static_cast<uint16_t>(ptr[0] | (ptr[1] << 8));
+}
+
+OPEN3D_HOST_DEVICE inline void StoreUInt16(uint8_t* ptr, uint16_t value) {
+    ptr[0] = static_cast<uint8_t>(value & 0xff);
+    ptr[1] = static_cast<uint8_t>(value >> 8);
+}
+
+/// Round and clamp a value to the integer range [lo, hi].
+OPEN3D_HOST_DEVICE inline int Quantize(float value, int lo, int hi) {
+    int q = static_cast<int>(roundf(value));
+    return q < lo ? lo : (q > hi ? hi : q);
+}
+
+/// Running average of quantized voxels. The weight of the average is capped
+/// at max_weight, otherwise rounding swallows every update once the weight
+/// outgrows the quantization step. The stored weight keeps counting.
+OPEN3D_HOST_DEVICE inline float QuantizedAverage(float value,
+                                                 float w,
+                                                 float max_weight,
+                                                 float dvalue) {
+    float wa = w < max_weight ? w : max_weight;
+    return (wa * value + dvalue) / (wa + 1);
+}
+
+OPEN3D_HOST_DEVICE inline uint8_t AverageColor(uint8_t color,
+                                               float w,
+                                               float max_weight,
+                                               float dcolor) {
+    return static_cast<uint8_t>(
+            Quantize(QuantizedAverage(color, w, max_weight, dcolor), 0, 255));
+}
+
+OPEN3D_HOST_DEVICE inline uint16_t IncrementWeight(uint16_t weight) {
+    return weight < ColoredVoxel16i::kMaxUint16 ? weight + 1 : weight;
+}
+
+/// 3-byte voxel structure.
+/// int8_t tsdf quantized in steps of 1/127 and uint16_t weight. Meant for
+/// large scenes where geometry at a fraction of the truncation suffices.
+struct Voxel8q {
+    static constexpr float kTSDFScale = 127.0f;
+    static constexpr float kMaxAverageWeight = 16.0f;
+
+    int8_t tsdf;
+    uint8_t weight[2];
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf / kTSDFScale; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return LoadUInt16(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) {
+        StoreUInt16(weight, static_cast<uint16_t>(
+                                    floorf(LoadUInt16(weight) * factor)));
+    }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        uint16_t w = LoadUInt16(weight);
+        tsdf = static_cast<int8_t>(Quantize(
+                QuantizedAverage(tsdf, w, kMaxAverageWeight, dsdf * kTSDFScale),
+                -127, 127));
+        StoreUInt16(weight, IncrementWeight(w));
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel8q] should never reach here.\n");
+    }
+};
+
+/// 6-byte voxel structure.
+/// Voxel8q with uint8_t colors in [0, 255], half the size of
+/// ColoredVoxel16i.
+struct ColoredVoxel8q {
+    static constexpr float kTSDFScale = 127.0f;
+    static constexpr float kMaxAverageWeight = 16.0f;
+
+    int8_t tsdf;
+    uint8_t weight[2];
+
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() { return tsdf / kTSDFScale; }
+    OPEN3D_HOST_DEVICE float GetWeight() { return LoadUInt16(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return r; }
+    OPEN3D_HOST_DEVICE float GetG() { return g; }
+    OPEN3D_HOST_DEVICE float GetB() { return b; }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) {
+        StoreUInt16(weight, static_cast<uint16_t>(
+                                    floorf(LoadUInt16(weight) * factor)));
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        uint16_t w = LoadUInt16(weight);
+        tsdf = static_cast<int8_t>(Quantize(
+                QuantizedAverage(tsdf, w, kMaxAverageWeight, dsdf * kTSDFScale),
+                -127, 127));
+        StoreUInt16(weight, IncrementWeight(w));
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        uint16_t w = LoadUInt16(weight);
+        tsdf = static_cast<int8_t>(Quantize(
+                QuantizedAverage(tsdf, w, kMaxAverageWeight, dsdf * kTSDFScale),
+                -127, 127));
+        r = AverageColor(r, w, kMaxAverageWeight, dr);
+        g = AverageColor(g, w, kMaxAverageWeight, dg);
+        b = AverageColor(b, w, kMaxAverageWeight, db);
+        StoreUInt16(weight, IncrementWeight(w));
+    }
+};
+
+/// 7-byte voxel structure.
+/// int16_t tsdf quantized in steps of 1/32767, uint16_t weight and uint8_t
+/// colors in [0, 255]. Close to the accuracy of ColoredVoxel16i in 58% of its
+/// size. There is no colorless counterpart, as its 4 bytes would alias
+/// Voxel16f in dispatching.
+struct ColoredVoxel16q {
+    static constexpr float kTSDFScale = 32767.0f;
+    static constexpr float kMaxAverageWeight = 256.0f;
+
+    uint8_t tsdf[2];
+    uint8_t weight[2];
+
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<int16_t>(LoadUInt16(tsdf)) / kTSDFScale;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return LoadUInt16(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return r; }
+    OPEN3D_HOST_DEVICE float GetG() { return g; }
+    OPEN3D_HOST_DEVICE float GetB() { return b; }
+    OPEN3D_HOST_DEVICE void DecayWeight(float factor) {
+        StoreUInt16(weight, static_cast<uint16_t>(
+                                    floorf(LoadUInt16(weight) * factor)));
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        uint16_t w = LoadUInt16(weight);
+        IntegrateTSDF(w, dsdf);
+        StoreUInt16(weight, IncrementWeight(w));
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        uint16_t w = LoadUInt16(weight);
+        IntegrateTSDF(w, dsdf);
+        r = AverageColor(r, w, kMaxAverageWeight, dr);
+        g = AverageColor(g, w, kMaxAverageWeight, dg);
+        b = AverageColor(b, w, kMaxAverageWeight, db);
+        StoreUInt16(weight, IncrementWeight(w));
+    }
+
+private:
+    OPEN3D_HOST_DEVICE void IntegrateTSDF(uint16_t w, float dsdf) {
+        float q = static_cast<int16_t>(LoadUInt16(tsdf));
+        int q_new = Quantize(QuantizedAverage(q, w, kMaxAverageWeight,
+                                              dsdf * kTSDFScale),
+                             -32767, 32767);
+        StoreUInt16(tsdf, static_cast<uint16_t>(static_cast<int16_t>(q_new)));
+    }
+};
+
+// Single-entry cache of the last neighbor block found in the hashmap.
+struct BlockCache {
+    int x;
+    int y;
+    int z;
+    int block_idx;
+
+    inline int OPEN3D_DEVICE Check(int xin, int yin, int zin) {
+        return (xin == x && yin == y && zin == z) ? block_idx : -1;
+    }
+
+    inline void OPEN3D_DEVICE Update(int xin,
+                                     int yin,
+                                     int zin,
+                                     int block_idx_in) {
+        x = xin;
+        y = yin;
+        z = zin;
+        block_idx = block_idx_in;
+    }
+};
+
+// Orders block addresses by the lexicographic order of their keys.
+struct BlockKeyLess {
+    const int* keys;
+
+    inline OPEN3D_HOST_DEVICE bool operator()(int64_t a, int64_t b) const {
+        const int* key_a = keys + 3 * a;
+        const int* key_b = keys + 3 * b;
+        if (key_a[0] != key_b[0]) return key_a[0] < key_b[0];
+        if (key_a[1] != key_b[1]) return key_a[1] < key_b[1];
+        return key_a[2] < key_b[2];
+    }
+};
+
+// Compact lookup of active voxel blocks by key from kernels. It only holds the
+// block addresses sorted by BlockKeyLess, and finds a block by binary search
+// over the keys in the hashmap's key buffer.
+struct BlockLookup {
+    const int* keys;
+    const int64_t* sorted_addrs;
+    int64_t n;
+
+    // Return the address of the block with key (x, y, z), or -1 if it is not
+    // active.
+    inline OPEN3D_HOST_DEVICE int64_t Find(int x, int y, int z) const {
+        int64_t lo = 0, hi = n;
+        while (lo < hi) {
+            int64_t mid = lo + (hi - lo) / 2;
+            const int* key = keys + 3 * sorted_addrs[mid];
+            if (key[0] < x ||
+                (key[0] == x && (key[1] < y || (key[1] == y && key[2] < z)))) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == n) return -1;
+        const int* key = keys + 3 * sorted_addrs[lo];
+        return (key[0] == x && key[1] == y && key[2] == z) ? sorted_addrs[lo]
+                                                            : -1;
+    }
+};
+
+// Get the address of the block at offset (dxb, dyb, dzb) from the block at
+// block_addr, or -1 if it is not allocated. Neighbors are looked up on demand.
+inline OPEN3D_DEVICE int64_t
+DeviceGetNeighborBlockAddr(int dxb,
+                           int dyb,
+                           int dzb,
+                           const int* block_key,
+                           int64_t block_addr,
+                           const BlockLookup& lookup,
+                           BlockCache& cache) {
+    if (dxb == 0 && dyb == 0 && dzb == 0) return block_addr;
+
+    int xb = block_key[0] + dxb;
+    int yb = block_key[1] + dyb;
+    int zb = block_key[2] + dzb;
+    int block_addr_i = cache.Check(xb, yb, zb);
+    if (block_addr_i < 0) {
+        block_addr_i = static_cast<int>(lookup.Find(xb, yb, zb));
+        if (block_addr_i < 0) return -1;
+        cache.Update(xb, yb, zb, block_addr_i);
+    }
+    return block_addr_i;
+}
+
+// Get a voxel in a certain voxel block given the block key and address, where
+// voxel coordinates out of [0, resolution) fall into the neighbor blocks.
 template <typename voxel_t>
 inline OPEN3D_DEVICE voxel_t* DeviceGetVoxelAt(
         int xo,
         int yo,
         int zo,
-        int curr_block_idx,
+        const int* block_key,
+        int64_t block_addr,
         int resolution,
-        const NDArrayIndexer& nb_block_masks_indexer,
-        const NDArrayIndexer& nb_block_indices_indexer,
+        const BlockLookup& lookup,
+        BlockCache& cache,
         const NDArrayIndexer& blocks_indexer) {
     int xn = (xo + resolution) % resolution;
     int yn = (yo + resolution) % resolution;
     int zn = (zo + resolution) % resolution;
 
-    int64_t dxb = sign(xo - xn);
-    int64_t dyb = sign(yo - yn);
-    int64_t dzb = sign(zo - zn);
-
-    int64_t nb_idx = (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
-
-    bool block_mask_i = *nb_block_masks_indexer.GetDataPtrFromCoord<bool>(
-            curr_block_idx, nb_idx);
-    if (!block_mask_i) return nullptr;
-
-    int64_t block_idx_i =
-            *nb_block_indices_indexer.GetDataPtrFromCoord<int64_t>(
-                    curr_block_idx, nb_idx);
+    int64_t block_addr_i = DeviceGetNeighborBlockAddr(
+            sign(xo - xn), sign(yo - yn), sign(zo - zn), block_key, block_addr,
+            lookup, cache);
+    if (block_addr_i < 0) return nullptr;
 
-    return blocks_indexer.GetDataPtrFromCoord<voxel_t>(xn, yn, zn, block_idx_i);
+    return blocks_indexer.GetDataPtrFromCoord<voxel_t>(xn, yn, zn,
+                                                       block_addr_i);
 }
 
-// Get TSDF gradient as normal in a certain voxel block given the block id with
-// its neighbors.
+// Get TSDF gradient as normal in a certain voxel block given the block key and
+// address.
 template <typename voxel_t>
 inline OPEN3D_DEVICE void DeviceGetNormalAt(
         int xo,
         int yo,
         int zo,
-        int curr_block_idx,
+        const int* block_key,
+        int64_t block_addr,
         float* n,
         int resolution,
         float voxel_size,
-        const NDArrayIndexer& nb_block_masks_indexer,
-        const NDArrayIndexer& nb_block_indices_indexer,
+        const BlockLookup& lookup,
+        BlockCache& cache,
         const NDArrayIndexer& blocks_indexer) {
     auto GetVoxelAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo) {
-        return DeviceGetVoxelAt<voxel_t>(
-                xo, yo, zo, curr_block_idx, resolution, nb_block_masks_indexer,
-                nb_block_indices_indexer, blocks_indexer);
+        return DeviceGetVoxelAt<voxel_t>(xo, yo, zo, block_key, block_addr,
+                                         resolution, lookup, cache,
+                                         blocks_indexer);
     };
     voxel_t* vxp = GetVoxelAt(xo + 1, yo, zo);
     voxel_t* vxn = GetVoxelAt(xo - 1, yo, zo);
@@ -38,22 +38,38 @@ namespace t {
 namespace geometry {
 namespace kernel {
 namespace tsdf {
-void Touch(std::shared_ptr<core::Hashmap>& hashmap,
-           const core::Tensor& points,
-           core::Tensor& voxel_block_coords,
-           int64_t voxel_grid_resolution,
-           float voxel_size,
-           float sdf_trunc) {
-    core::Device device = points.GetDevice();
+void DepthTouch(std::shared_ptr<core::Hashmap>& hashmap,
+                const core::Tensor& depth,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                core::Tensor& voxel_block_coords,
+                int64_t voxel_grid_resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_max,
+                int64_t stride,
+                bool visibility_culling) {
+    core::Device device = depth.GetDevice();
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor extrinsics_d =
+            extrinsics.To(host, core::Dtype::Float64).Contiguous();
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        TouchCPU(hashmap, points, voxel_block_coords, voxel_grid_resolution,
-                 voxel_size, sdf_trunc);
+        DepthTouchCPU(hashmap, depth, intrinsics_d, extrinsics_d,
+                      voxel_block_coords, voxel_grid_resolution, voxel_size,
+                      sdf_trunc, depth_scale, depth_max, stride,
+                      visibility_culling);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        TouchCUDA(hashmap, points, voxel_block_coords, voxel_grid_resolution,
-                  voxel_size, sdf_trunc);
+        DepthTouchCUDA(hashmap, depth, intrinsics_d, extrinsics_d,
+                       voxel_block_coords, voxel_grid_resolution, voxel_size,
+                       sdf_trunc, depth_scale, depth_max, stride,
+                       visibility_culling);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -152,6 +168,7 @@ void EstimateRange(const core::Tensor& block_keys,
 void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
              const core::Tensor& block_values,
              const core::Tensor& range_map,
+             const core::Tensor& block_min_tsdf,
              core::Tensor& vertex_map,
              core::Tensor& depth_map,
              core::Tensor& color_map,
@@ -176,16 +193,82 @@ void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
     core::Device device = hashmap->GetDevice();
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        RayCastCPU(hashmap, block_values, range_map, vertex_map, depth_map,
-                   color_map, normal_map, intrinsics_d, extrinsics_d, h, w,
-                   block_resolution, voxel_size, sdf_trunc, depth_scale,
-                   depth_min, depth_max, weight_threshold);
+        RayCastCPU(hashmap, block_values, range_map, block_min_tsdf,
+                   vertex_map, depth_map, color_map, normal_map, intrinsics_d,
+                   extrinsics_d, h, w, block_resolution, voxel_size,
+                   sdf_trunc, depth_scale, depth_min, depth_max,
+                   weight_threshold);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        RayCastCUDA(hashmap, block_values, range_map, vertex_map, depth_map,
-                    color_map, normal_map, intrinsics_d, extrinsics_d, h, w,
-                    block_resolution, voxel_size, sdf_trunc, depth_scale,
-                    depth_min, depth_max, weight_threshold);
+        RayCastCUDA(hashmap, block_values, range_map, block_min_tsdf,
+                    vertex_map, depth_map, color_map, normal_map, intrinsics_d,
+                    extrinsics_d, h, w, block_resolution, voxel_size,
+                    sdf_trunc, depth_scale, depth_min, depth_max,
+                    weight_threshold);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void UpdateBlockMinTSDF(const core::Tensor& block_indices,
+                        const core::Tensor& block_values,
+                        core::Tensor& block_min_tsdf,
+                        int64_t resolution) {
+    core::Device device = block_values.GetDevice();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        UpdateBlockMinTSDFCPU(block_indices, block_values, block_min_tsdf,
+                              resolution);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        UpdateBlockMinTSDFCUDA(block_indices, block_values, block_min_tsdf,
+                               resolution);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void DecayBlockWeights(const core::Tensor& block_indices,
+                       core::Tensor& block_values,
+                       core::Tensor& block_max_weight,
+                       float decay,
+                       int64_t resolution) {
+    core::Device device = block_values.GetDevice();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        DecayBlockWeightsCPU(block_indices, block_values, block_max_weight,
+                             decay, resolution);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DecayBlockWeightsCUDA(block_indices, block_values, block_max_weight,
+                              decay, resolution);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SortBlockIndices(const core::Tensor& block_indices,
+                      const core::Tensor& block_keys,
+                      core::Tensor& sorted_block_indices) {
+    core::Device device = block_keys.GetDevice();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SortBlockIndicesCPU(block_indices, block_keys, sorted_block_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SortBlockIndicesCUDA(block_indices, block_keys, sorted_block_indices);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -196,8 +279,7 @@ void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
 
 void ExtractSurfacePoints(
         const core::Tensor& block_indices,
-        const core::Tensor& nb_block_indices,
-        const core::Tensor& nb_block_masks,
+        const core::Tensor& sorted_block_indices,
         const core::Tensor& block_keys,
         const core::Tensor& block_values,
         core::Tensor& points,
@@ -211,16 +293,16 @@ void ExtractSurfacePoints(
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        ExtractSurfacePointsCPU(block_indices, nb_block_indices, nb_block_masks,
+        ExtractSurfacePointsCPU(block_indices, sorted_block_indices,
                                 block_keys, block_values, points, normals,
                                 colors, block_resolution, voxel_size,
                                 weight_threshold, valid_size);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        ExtractSurfacePointsCUDA(block_indices, nb_block_indices,
-                                 nb_block_masks, block_keys, block_values,
-                                 points, normals, colors, block_resolution,
-                                 voxel_size, weight_threshold, valid_size);
+        ExtractSurfacePointsCUDA(block_indices, sorted_block_indices,
+                                 block_keys, block_values, points, normals,
+                                 colors, block_resolution, voxel_size,
+                                 weight_threshold, valid_size);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -229,35 +311,46 @@ void ExtractSurfacePoints(
     }
 }
 
-void ExtractSurfaceMesh(const core::Tensor& block_indices,
-                        const core::Tensor& inv_block_indices,
-                        const core::Tensor& nb_block_indices,
-                        const core::Tensor& nb_block_masks,
-                        const core::Tensor& block_keys,
-                        const core::Tensor& block_values,
-                        core::Tensor& vertices,
-                        core::Tensor& triangles,
-                        core::Tensor& vertex_normals,
-                        core::Tensor& vertex_colors,
-                        int64_t block_resolution,
-                        float voxel_size,
-                        float weight_threshold) {
+void ExtractSurfaceMesh(
+        const core::Tensor& block_indices,
+        const core::Tensor& inv_block_indices,
+        const core::Tensor& sorted_block_indices,
+        const core::Tensor& block_keys,
+        const core::Tensor& block_values,
+        core::Tensor& vertices,
+        core::Tensor& triangles,
+        core::Tensor& vertex_normals,
+        core::Tensor& vertex_colors,
+        int64_t block_resolution,
+        float voxel_size,
+        float weight_threshold,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                block_mask,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_blocks) {
     core::Device device = block_keys.GetDevice();
+    if (block_mask.has_value() &&
+        (block_mask.value().get().GetDtype() != core::Dtype::Bool ||
+         block_mask.value().get().GetLength() != block_indices.GetLength())) {
+        utility::LogError(
+                "[ExtractSurfaceMesh] block_mask must be a Bool tensor with "
+                "one element per block.");
+    }
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
         ExtractSurfaceMeshCPU(block_indices, inv_block_indices,
-                              nb_block_indices, nb_block_masks, block_keys,
-                              block_values, vertices, triangles, vertex_normals,
+                              sorted_block_indices, block_keys, block_values,
+                              vertices, triangles, vertex_normals,
                               vertex_colors, block_resolution, voxel_size,
-                              weight_threshold);
+                              weight_threshold, block_mask, triangle_blocks);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         ExtractSurfaceMeshCUDA(block_indices, inv_block_indices,
-                               nb_block_indices, nb_block_masks, block_keys,
-                               block_values, vertices, triangles,
-                               vertex_normals, vertex_colors, block_resolution,
-                               voxel_size, weight_threshold);
+                               sorted_block_indices, block_keys, block_values,
+                               vertices, triangles, vertex_normals,
+                               vertex_colors, block_resolution, voxel_size,
+                               weight_threshold, block_mask, triangle_blocks);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -37,12 +37,24 @@ namespace geometry {
 namespace kernel {
 namespace tsdf {
 
-void Touch(std::shared_ptr<core::Hashmap>& hashmap,
-           const core::Tensor& points,
-           core::Tensor& voxel_block_coords,
-           int64_t voxel_grid_resolution,
-           float voxel_size,
-           float sdf_trunc);
+/// Unproject every \p stride-th pixel of \p depth and collect the unique
+/// coordinates of the blocks to allocate for integration in
+/// \p voxel_block_coords, using \p hashmap for deduplication. By default
+/// all the blocks within \p sdf_trunc of the observed points are collected.
+/// With \p visibility_culling, only the blocks crossed by the camera rays
+/// within the truncation band around the observed surface are collected.
+void DepthTouch(std::shared_ptr<core::Hashmap>& hashmap,
+                const core::Tensor& depth,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                core::Tensor& voxel_block_coords,
+                int64_t voxel_grid_resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_max,
+                int64_t stride,
+                bool visibility_culling);
 
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
@@ -72,6 +84,7 @@ void EstimateRange(const core::Tensor& block_keys,
 void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
              const core::Tensor& block_values,
              const core::Tensor& range_map,
+             const core::Tensor& block_min_tsdf,
              core::Tensor& vertex_map,
              core::Tensor& depth_map,
              core::Tensor& color_map,
@@ -88,10 +101,33 @@ void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
              float depth_max,
              float weight_threshold);
 
+/// Store the minimal TSDF of the observed voxels in each block of
+/// \p block_indices to \p block_min_tsdf, indexed by block address. Blocks
+/// without negative TSDF contain no surface and are skipped in ray casting.
+void UpdateBlockMinTSDF(const core::Tensor& block_indices,
+                        const core::Tensor& block_values,
+                        core::Tensor& block_min_tsdf,
+                        int64_t resolution);
+
+/// Scale the voxel weights in each block of \p block_indices by \p decay,
+/// and store the resulting maximal voxel weight of the i-th block to
+/// \p block_max_weight[i]. Integer weights are rounded down, so that stale
+/// voxels eventually become unobserved.
+void DecayBlockWeights(const core::Tensor& block_indices,
+                       core::Tensor& block_values,
+                       core::Tensor& block_max_weight,
+                       float decay,
+                       int64_t resolution);
+
+/// Sort the active block indices by their keys in \p block_keys, so that
+/// kernels can find blocks by binary search over the keys.
+void SortBlockIndices(const core::Tensor& block_indices,
+                      const core::Tensor& block_keys,
+                      core::Tensor& sorted_block_indices);
+
 void ExtractSurfacePoints(
         const core::Tensor& block_indices,
-        const core::Tensor& nb_block_indices,
-        const core::Tensor& nb_block_masks,
+        const core::Tensor& sorted_block_indices,
         const core::Tensor& block_keys,
         const core::Tensor& block_values,
         core::Tensor& points,
@@ -102,26 +138,36 @@ void ExtractSurfacePoints(
         float weight_threshold,
         int& valid_size);
 
-void ExtractSurfaceMesh(const core::Tensor& block_indices,
-                        const core::Tensor& inv_block_indices,
-                        const core::Tensor& nb_block_indices,
-                        const core::Tensor& nb_block_masks,
-                        const core::Tensor& block_keys,
-                        const core::Tensor& block_values,
-                        core::Tensor& vertices,
-                        core::Tensor& triangles,
-                        core::Tensor& vertex_normals,
-                        core::Tensor& vertex_colors,
-                        int64_t block_resolution,
-                        float voxel_size,
-                        float weight_threshold);
-
-void TouchCPU(std::shared_ptr<core::Hashmap>& hashmap,
-              const core::Tensor& points,
-              core::Tensor& voxel_block_coords,
-              int64_t voxel_grid_resolution,
-              float voxel_size,
-              float sdf_trunc);
+void ExtractSurfaceMesh(
+        const core::Tensor& block_indices,
+        const core::Tensor& inv_block_indices,
+        const core::Tensor& sorted_block_indices,
+        const core::Tensor& block_keys,
+        const core::Tensor& block_values,
+        core::Tensor& vertices,
+        core::Tensor& triangles,
+        core::Tensor& vertex_normals,
+        core::Tensor& vertex_colors,
+        int64_t block_resolution,
+        float voxel_size,
+        float weight_threshold,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                block_mask,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_blocks);
+
+void DepthTouchCPU(std::shared_ptr<core::Hashmap>& hashmap,
+                   const core::Tensor& depth,
+                   const core::Tensor& intrinsics,
+                   const core::Tensor& extrinsics,
+                   core::Tensor& voxel_block_coords,
+                   int64_t voxel_grid_resolution,
+                   float voxel_size,
+                   float sdf_trunc,
+                   float depth_scale,
+                   float depth_max,
+                   int64_t stride,
+                   bool visibility_culling);
 
 void IntegrateCPU(const core::Tensor& depth,
                   const core::Tensor& color,
@@ -151,6 +197,7 @@ void EstimateRangeCPU(const core::Tensor& block_keys,
 void RayCastCPU(std::shared_ptr<core::DeviceHashmap>& hashmap,
                 const core::Tensor& block_values,
                 const core::Tensor& range_map,
+                const core::Tensor& block_min_tsdf,
                 core::Tensor& vertex_map,
                 core::Tensor& depth_map,
                 core::Tensor& color_map,
@@ -167,10 +214,24 @@ void RayCastCPU(std::shared_ptr<core::DeviceHashmap>& hashmap,
                 float depth_max,
                 float weight_threshold);
 
+void UpdateBlockMinTSDFCPU(const core::Tensor& block_indices,
+                           const core::Tensor& block_values,
+                           core::Tensor& block_min_tsdf,
+                           int64_t resolution);
+
+void DecayBlockWeightsCPU(const core::Tensor& block_indices,
+                          core::Tensor& block_values,
+                          core::Tensor& block_max_weight,
+                          float decay,
+                          int64_t resolution);
+
+void SortBlockIndicesCPU(const core::Tensor& block_indices,
+                         const core::Tensor& block_keys,
+                         core::Tensor& sorted_block_indices);
+
 void ExtractSurfacePointsCPU(
         const core::Tensor& block_indices,
-        const core::Tensor& nb_block_indices,
-        const core::Tensor& nb_block_masks,
+        const core::Tensor& sorted_block_indices,
         const core::Tensor& block_keys,
         const core::Tensor& block_values,
         core::Tensor& points,
@@ -181,27 +242,37 @@ void ExtractSurfacePointsCPU(
         float weight_threshold,
         int& valid_size);
 
-void ExtractSurfaceMeshCPU(const core::Tensor& block_indices,
-                           const core::Tensor& inv_block_indices,
-                           const core::Tensor& nb_block_indices,
-                           const core::Tensor& nb_block_masks,
-                           const core::Tensor& block_keys,
-                           const core::Tensor& block_values,
-                           core::Tensor& vertices,
-                           core::Tensor& triangles,
-                           core::Tensor& vertex_normals,
-                           core::Tensor& vertex_colors,
-                           int64_t block_resolution,
-                           float voxel_size,
-                           float weight_threshold);
+void ExtractSurfaceMeshCPU(
+        const core::Tensor& block_indices,
+        const core::Tensor& inv_block_indices,
+        const core::Tensor& sorted_block_indices,
+        const core::Tensor& block_keys,
+        const core::Tensor& block_values,
+        core::Tensor& vertices,
+        core::Tensor& triangles,
+        core::Tensor& vertex_normals,
+        core::Tensor& vertex_colors,
+        int64_t block_resolution,
+        float voxel_size,
+        float weight_threshold,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                block_mask,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_blocks);
 
 #ifdef BUILD_CUDA_MODULE
-void TouchCUDA(std::shared_ptr<core::Hashmap>& hashmap,
-               const core::Tensor& points,
-               core::Tensor& voxel_block_coords,
-               int64_t voxel_grid_resolution,
-               float voxel_size,
-               float sdf_trunc);
+void DepthTouchCUDA(std::shared_ptr<core::Hashmap>& hashmap,
+                    const core::Tensor& depth,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    core::Tensor& voxel_block_coords,
+                    int64_t voxel_grid_resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max,
+                    int64_t stride,
+                    bool visibility_culling);
 
 void IntegrateCUDA(const core::Tensor& depth,
                    const core::Tensor& color,
@@ -231,6 +302,7 @@ void EstimateRangeCUDA(const core::Tensor& block_keys,
 void RayCastCUDA(std::shared_ptr<core::DeviceHashmap>& hashmap,
                  const core::Tensor& block_values,
                  const core::Tensor& range_map,
+                 const core::Tensor& block_min_tsdf,
                  core::Tensor& vertex_map,
                  core::Tensor& depth_map,
                  core::Tensor& color_map,
@@ -247,10 +319,24 @@ void RayCastCUDA(std::shared_ptr<core::DeviceHashmap>& hashmap,
                  float depth_max,
                  float weight_threshold);
 
+void UpdateBlockMinTSDFCUDA(const core::Tensor& block_indices,
+                            const core::Tensor& block_values,
+                            core::Tensor& block_min_tsdf,
+                            int64_t resolution);
+
+void DecayBlockWeightsCUDA(const core::Tensor& block_indices,
+                           core::Tensor& block_values,
+                           core::Tensor& block_max_weight,
+                           float decay,
+                           int64_t resolution);
+
+void SortBlockIndicesCUDA(const core::Tensor& block_indices,
+                          const core::Tensor& block_keys,
+                          core::Tensor& sorted_block_indices);
+
 void ExtractSurfacePointsCUDA(
         const core::Tensor& block_indices,
-        const core::Tensor& nb_block_indices,
-        const core::Tensor& nb_block_masks,
+        const core::Tensor& sorted_block_indices,
         const core::Tensor& block_keys,
         const core::Tensor& block_values,
         core::Tensor& points,
@@ -261,19 +347,23 @@ void ExtractSurfacePointsCUDA(
         float weight_threshold,
         int& valid_size);
 
-void ExtractSurfaceMeshCUDA(const core::Tensor& block_indices,
-                            const core::Tensor& inv_block_indices,
-                            const core::Tensor& nb_block_indices,
-                            const core::Tensor& nb_block_masks,
-                            const core::Tensor& block_keys,
-                            const core::Tensor& block_values,
-                            core::Tensor& vertices,
-                            core::Tensor& triangles,
-                            core::Tensor& vertex_normals,
-                            core::Tensor& vertex_colors,
-                            int64_t block_resolution,
-                            float voxel_size,
-                            float weight_threshold);
+void ExtractSurfaceMeshCUDA(
+        const core::Tensor& block_indices,
+        const core::Tensor& inv_block_indices,
+        const core::Tensor& sorted_block_indices,
+        const core::Tensor& block_keys,
+        const core::Tensor& block_values,
+        core::Tensor& vertices,
+        core::Tensor& triangles,
+        core::Tensor& vertex_normals,
+        core::Tensor& vertex_colors,
+        int64_t block_resolution,
+        float voxel_size,
+        float weight_threshold,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                block_mask,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_blocks);
 
 #endif
 }  // namespace tsdf
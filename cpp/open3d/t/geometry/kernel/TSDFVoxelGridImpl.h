@@ -27,6 +27,14 @@
 #include <atomic>
 #include <cmath>
 
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#else
+#include <tbb/parallel_sort.h>
+#endif
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
@@ -39,6 +47,9 @@
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Timer.h"
+#if !defined(__CUDACC__)
+#include "open3d/utility/ParallelScan.h"
+#endif
 
 namespace open3d {
 namespace t {
@@ -46,6 +57,203 @@ namespace geometry {
 namespace kernel {
 namespace tsdf {
 
+/// Number of strided pixels of a row processed by one DepthTouch workload.
+/// Neighboring pixels mostly touch the same blocks, and the repetitions are
+/// dropped in the workload before reaching the hashmap.
+constexpr int64_t kDepthTouchSegmentLength = 16;
+
+/// Maximal number of blocks a pixel touches, and the number of recently
+/// touched blocks a DepthTouch workload remembers to skip repetitions.
+constexpr int kDepthTouchMaxBlocks = 8;
+
+#if defined(__CUDACC__)
+void DepthTouchCUDA
+#else
+void DepthTouchCPU
+#endif
+        (std::shared_ptr<core::Hashmap>& hashmap,
+         const core::Tensor& depth,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         core::Tensor& voxel_block_coords,
+         int64_t voxel_grid_resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_max,
+         int64_t stride,
+         bool visibility_culling) {
+    float block_size = voxel_size * voxel_grid_resolution;
+
+    NDArrayIndexer depth_indexer(depth, 2);
+    core::Tensor pose = t::geometry::InverseTransformation(extrinsics);
+    TransformIndexer ti(intrinsics, pose, 1.0f);
+
+    int64_t rows_strided = depth_indexer.GetShape(0) / stride;
+    int64_t cols_strided = depth_indexer.GetShape(1) / stride;
+    int64_t segments_per_row =
+            (cols_strided + kDepthTouchSegmentLength - 1) /
+            kDepthTouchSegmentLength;
+
+    // Output, deduplicated by the hashmap afterwards.
+    core::Device device = depth.GetDevice();
+    core::Tensor block_coordi(
+            {kDepthTouchMaxBlocks * rows_strided * cols_strided, 3},
+            core::Dtype::Int32, device);
+    int* block_coordi_ptr = block_coordi.GetDataPtr<int>();
+#if defined(__CUDACC__)
+    core::Tensor count(std::vector<int>{0}, {}, core::Dtype::Int32, device);
+    int* count_ptr = count.GetDataPtr<int>();
+#else
+    std::atomic<int> count_atomic(0);
+    std::atomic<int>* count_ptr = &count_atomic;
+#endif
+
+    int64_t n = rows_strided * segments_per_row;
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            int64_t y = (workload_idx / segments_per_row) * stride;
+            int64_t xs_begin = (workload_idx % segments_per_row) *
+                               kDepthTouchSegmentLength;
+            int64_t xs_end = xs_begin + kDepthTouchSegmentLength;
+            xs_end = xs_end < cols_strided ? xs_end : cols_strided;
+
+            // Ring buffer of the recently touched blocks.
+            int recent[kDepthTouchMaxBlocks][3];
+            int recent_count = 0;
+            int recent_head = 0;
+            auto touch = [&](int xb, int yb, int zb) {
+                for (int i = 0; i < recent_count; ++i) {
+                    if (recent[i][0] == xb && recent[i][1] == yb &&
+                        recent[i][2] == zb) {
+                        return;
+                    }
+                }
+                recent[recent_head][0] = xb;
+                recent[recent_head][1] = yb;
+                recent[recent_head][2] = zb;
+                recent_head = (recent_head + 1) % kDepthTouchMaxBlocks;
+                recent_count += recent_count < kDepthTouchMaxBlocks ? 1 : 0;
+
+                int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+                block_coordi_ptr[3 * idx + 0] = xb;
+                block_coordi_ptr[3 * idx + 1] = yb;
+                block_coordi_ptr[3 * idx + 2] = zb;
+            };
+
+            for (int64_t xs = xs_begin; xs < xs_end; ++xs) {
+                int64_t x = xs * stride;
+                float d = *depth_indexer.GetDataPtrFromCoord<scalar_t>(x, y) /
+                          depth_scale;
+                if (!(d > 0 && d < depth_max)) {
+                    continue;
+                }
+
+                if (!visibility_culling) {
+                    // All the blocks within sdf_trunc of the observed point.
+                    float xc, yc, zc, xw, yw, zw;
+                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
+                                 d, &xc, &yc, &zc);
+                    ti.RigidTransform(xc, yc, zc, &xw, &yw, &zw);
+
+                    int xb_lo = static_cast<int>(
+                            floorf((xw - sdf_trunc) / block_size));
+                    int xb_hi = static_cast<int>(
+                            floorf((xw + sdf_trunc) / block_size));
+                    int yb_lo = static_cast<int>(
+                            floorf((yw - sdf_trunc) / block_size));
+                    int yb_hi = static_cast<int>(
+                            floorf((yw + sdf_trunc) / block_size));
+                    int zb_lo = static_cast<int>(
+                            floorf((zw - sdf_trunc) / block_size));
+                    int zb_hi = static_cast<int>(
+                            floorf((zw + sdf_trunc) / block_size));
+                    for (int xb = xb_lo; xb <= xb_hi; ++xb) {
+                        for (int yb = yb_lo; yb <= yb_hi; ++yb) {
+                            for (int zb = zb_lo; zb <= zb_hi; ++zb) {
+                                touch(xb, yb, zb);
+                            }
+                        }
+                    }
+                    continue;
+                }
+
+                // Only the blocks crossed by the camera ray within the
+                // truncation band [d - sdf_trunc, d + sdf_trunc], traversed
+                // with a 3D DDA.
+                float z0 = d - sdf_trunc > 0 ? d - sdf_trunc : 0;
+                float z1 = d + sdf_trunc;
+                float p0[3], p1[3], xc, yc, zc;
+                ti.Unproject(static_cast<float>(x), static_cast<float>(y), z0,
+                             &xc, &yc, &zc);
+                ti.RigidTransform(xc, yc, zc, &p0[0], &p0[1], &p0[2]);
+                ti.Unproject(static_cast<float>(x), static_cast<float>(y), z1,
+                             &xc, &yc, &zc);
+                ti.RigidTransform(xc, yc, zc, &p1[0], &p1[1], &p1[2]);
+
+                int block[3], block_end[3], step[3];
+                float t_next[3], t_delta[3];
+                for (int i = 0; i < 3; ++i) {
+                    block[i] = static_cast<int>(floorf(p0[i] / block_size));
+                    block_end[i] = static_cast<int>(floorf(p1[i] / block_size));
+                    float dir = p1[i] - p0[i];
+                    if (dir > 0) {
+                        step[i] = 1;
+                        t_next[i] = ((block[i] + 1) * block_size - p0[i]) / dir;
+                        t_delta[i] = block_size / dir;
+                    } else if (dir < 0) {
+                        step[i] = -1;
+                        t_next[i] = (block[i] * block_size - p0[i]) / dir;
+                        t_delta[i] = -block_size / dir;
+                    } else {
+                        step[i] = 0;
+                        t_next[i] = INFINITY;
+                        t_delta[i] = INFINITY;
+                    }
+                }
+                for (int k = 0; k < kDepthTouchMaxBlocks; ++k) {
+                    touch(block[0], block[1], block[2]);
+                    if (block[0] == block_end[0] && block[1] == block_end[1] &&
+                        block[2] == block_end[2]) {
+                        break;
+                    }
+                    int axis = t_next[0] < t_next[1] ? 0 : 1;
+                    axis = t_next[axis] < t_next[2] ? axis : 2;
+                    if (t_next[axis] > 1) {
+                        break;
+                    }
+                    block[axis] += step[axis];
+                    t_next[axis] += t_delta[axis];
+                }
+            }
+        });
+    });
+
+#if defined(__CUDACC__)
+    int total_block_count = count.Item<int>();
+#else
+    int total_block_count = (*count_ptr).load();
+#endif
+    if (total_block_count == 0) {
+        utility::LogError(
+                "[DepthTouch] No block is touched in TSDF volume, abort "
+                "integration. Please check specified parameters, especially "
+                "depth_scale and voxel_size");
+    }
+
+    block_coordi = block_coordi.Slice(0, 0, total_block_count);
+    core::Tensor block_addrs, block_masks;
+    hashmap->Activate(block_coordi, block_addrs, block_masks);
+    voxel_block_coords = block_coordi.IndexGet({block_masks});
+}
+
 #if defined(__CUDACC__)
 void IntegrateCUDA
 #else
@@ -172,14 +380,134 @@ void IntegrateCPU
 #endif
 }
 
+#if defined(__CUDACC__)
+void UpdateBlockMinTSDFCUDA
+#else
+void UpdateBlockMinTSDFCPU
+#endif
+        (const core::Tensor& indices,
+         const core::Tensor& block_values,
+         core::Tensor& block_min_tsdf,
+         int64_t resolution) {
+    int64_t resolution3 = resolution * resolution * resolution;
+
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    float* block_min_tsdf_ptr = block_min_tsdf.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                launcher.LaunchGeneralKernel(
+                        indices.GetLength(),
+                        [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            int64_t block_idx = indices_ptr[workload_idx];
+                            voxel_t* voxel_ptr =
+                                    voxel_block_buffer_indexer
+                                            .GetDataPtrFromCoord<voxel_t>(
+                                                    0, 0, 0, block_idx);
+
+                            // Unobserved voxels are regarded as empty.
+                            float min_tsdf = 1.0f;
+                            for (int64_t i = 0; i < resolution3; ++i) {
+                                if (voxel_ptr[i].GetWeight() > 0 &&
+                                    voxel_ptr[i].GetTSDF() < min_tsdf) {
+                                    min_tsdf = voxel_ptr[i].GetTSDF();
+                                }
+                            }
+                            block_min_tsdf_ptr[block_idx] = min_tsdf;
+                        });
+            });
+#if defined(__CUDACC__)
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+#if defined(__CUDACC__)
+void DecayBlockWeightsCUDA
+#else
+void DecayBlockWeightsCPU
+#endif
+        (const core::Tensor& indices,
+         core::Tensor& block_values,
+         core::Tensor& block_max_weight,
+         float decay,
+         int64_t resolution) {
+    int64_t resolution3 = resolution * resolution * resolution;
+    int64_t n = indices.GetLength();
+    block_max_weight = core::Tensor({n}, core::Dtype::Float32,
+                                    block_values.GetDevice());
+
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    float* block_max_weight_ptr = block_max_weight.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                launcher.LaunchGeneralKernel(
+                        n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            int64_t block_idx = indices_ptr[workload_idx];
+                            voxel_t* voxel_ptr =
+                                    voxel_block_buffer_indexer
+                                            .GetDataPtrFromCoord<voxel_t>(
+                                                    0, 0, 0, block_idx);
+
+                            float max_weight = 0;
+                            for (int64_t i = 0; i < resolution3; ++i) {
+                                if (decay < 1.0f) {
+                                    voxel_ptr[i].DecayWeight(decay);
+                                }
+                                float weight = voxel_ptr[i].GetWeight();
+                                max_weight =
+                                        weight > max_weight ? weight
+                                                            : max_weight;
+                            }
+                            block_max_weight_ptr[workload_idx] = max_weight;
+                        });
+            });
+#if defined(__CUDACC__)
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+#if defined(__CUDACC__)
+void SortBlockIndicesCUDA
+#else
+void SortBlockIndicesCPU
+#endif
+        (const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         core::Tensor& sorted_indices) {
+    sorted_indices = indices.Clone();
+    int64_t* sorted_indices_ptr = sorted_indices.GetDataPtr<int64_t>();
+    BlockKeyLess less{block_keys.GetDataPtr<int>()};
+#if defined(__CUDACC__)
+    thrust::sort(thrust::device, sorted_indices_ptr,
+                 sorted_indices_ptr + sorted_indices.GetLength(), less);
+#else
+    tbb::parallel_sort(sorted_indices_ptr,
+                       sorted_indices_ptr + sorted_indices.GetLength(), less);
+#endif
+}
+
 #if defined(__CUDACC__)
 void ExtractSurfacePointsCUDA
 #else
 void ExtractSurfacePointsCPU
 #endif
         (const core::Tensor& indices,
-         const core::Tensor& nb_indices,
-         const core::Tensor& nb_masks,
+         const core::Tensor& sorted_indices,
          const core::Tensor& block_keys,
          const core::Tensor& block_values,
          core::Tensor& points,
@@ -198,8 +526,9 @@ void ExtractSurfacePointsCPU
     // Real data indexer
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
     NDArrayIndexer block_keys_indexer(block_keys, 1);
-    NDArrayIndexer nb_block_masks_indexer(nb_masks, 2);
-    NDArrayIndexer nb_block_indices_indexer(nb_indices, 2);
+    BlockLookup lookup{block_keys.GetDataPtr<int>(),
+                       sorted_indices.GetDataPtr<int64_t>(),
+                       sorted_indices.GetLength()};
 
     // Plain arrays that does not require indexers
     const int64_t* indices_ptr =
@@ -232,19 +561,6 @@ void ExtractSurfacePointsCPU
                 voxel_block_buffer_indexer.ElementByteSize(), [&]() {
                     launcher.LaunchGeneralKernel(
                             n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                                auto GetVoxelAt = [&] OPEN3D_DEVICE(
-                                                          int xo, int yo,
-                                                          int zo,
-                                                          int curr_block_idx)
-                                        -> voxel_t* {
-                                    return DeviceGetVoxelAt<voxel_t>(
-                                            xo, yo, zo, curr_block_idx,
-                                            static_cast<int>(resolution),
-                                            nb_block_masks_indexer,
-                                            nb_block_indices_indexer,
-                                            voxel_block_buffer_indexer);
-                                };
-
                                 // Natural index (0, N) -> (block_idx,
                                 // voxel_idx)
                                 int64_t workload_block_idx =
@@ -252,6 +568,22 @@ void ExtractSurfacePointsCPU
                                 int64_t block_idx =
                                         indices_ptr[workload_block_idx];
                                 int64_t voxel_idx = workload_idx % resolution3;
+                                const int* block_key_ptr =
+                                        block_keys_indexer
+                                                .GetDataPtrFromCoord<int>(
+                                                        block_idx);
+
+                                BlockCache cache{0, 0, 0, -1};
+                                auto GetVoxelAt = [&] OPEN3D_DEVICE(
+                                                          int xo, int yo,
+                                                          int zo) -> voxel_t* {
+                                    return DeviceGetVoxelAt<voxel_t>(
+                                            xo, yo, zo, block_key_ptr,
+                                            block_idx,
+                                            static_cast<int>(resolution),
+                                            lookup, cache,
+                                            voxel_block_buffer_indexer);
+                                };
 
                                 // voxel_idx -> (x_voxel, y_voxel, z_voxel)
                                 int64_t xv, yv, zv;
@@ -271,9 +603,7 @@ void ExtractSurfacePointsCPU
                                     voxel_t* ptr = GetVoxelAt(
                                             static_cast<int>(xv) + (i == 0),
                                             static_cast<int>(yv) + (i == 1),
-                                            static_cast<int>(zv) + (i == 2),
-                                            static_cast<int>(
-                                                    workload_block_idx));
+                                            static_cast<int>(zv) + (i == 2));
                                     if (ptr == nullptr) continue;
 
                                     float tsdf_i = ptr->GetTSDF();
@@ -334,27 +664,6 @@ void ExtractSurfacePointsCPU
 
                 launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
                                                         int64_t workload_idx) {
-                    auto GetVoxelAt = [&] OPEN3D_DEVICE(
-                                              int xo, int yo, int zo,
-                                              int curr_block_idx) -> voxel_t* {
-                        return DeviceGetVoxelAt<voxel_t>(
-                                xo, yo, zo, curr_block_idx,
-                                static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
-                                voxel_block_buffer_indexer);
-                    };
-                    auto GetNormalAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo,
-                                                         int curr_block_idx,
-                                                         float* n) {
-                        return DeviceGetNormalAt<voxel_t>(
-                                xo, yo, zo, curr_block_idx, n,
-                                static_cast<int>(resolution), voxel_size,
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
-                                voxel_block_buffer_indexer);
-                    };
-
                     // Natural index (0, N) -> (block_idx, voxel_idx)
                     int64_t workload_block_idx = workload_idx / resolution3;
                     int64_t block_idx = indices_ptr[workload_block_idx];
@@ -369,6 +678,22 @@ void ExtractSurfacePointsCPU
                     int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
                     int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
 
+                    BlockCache cache{0, 0, 0, -1};
+                    auto GetVoxelAt = [&] OPEN3D_DEVICE(int xo, int yo,
+                                                        int zo) -> voxel_t* {
+                        return DeviceGetVoxelAt<voxel_t>(
+                                xo, yo, zo, block_key_ptr, block_idx,
+                                static_cast<int>(resolution), lookup, cache,
+                                voxel_block_buffer_indexer);
+                    };
+                    auto GetNormalAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo,
+                                                         float* n) {
+                        return DeviceGetNormalAt<voxel_t>(
+                                xo, yo, zo, block_key_ptr, block_idx, n,
+                                static_cast<int>(resolution), voxel_size,
+                                lookup, cache, voxel_block_buffer_indexer);
+                    };
+
                     // voxel_idx -> (x_voxel, y_voxel, z_voxel)
                     int64_t xv, yv, zv;
                     voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
@@ -388,8 +713,7 @@ void ExtractSurfacePointsCPU
                     float no[3] = {0}, ni[3] = {0};
                     if (extract_normal) {
                         GetNormalAt(static_cast<int>(xv), static_cast<int>(yv),
-                                    static_cast<int>(zv),
-                                    static_cast<int>(workload_block_idx), no);
+                                    static_cast<int>(zv), no);
                     }
 
                     // Enumerate x-y-z axis
@@ -397,8 +721,7 @@ void ExtractSurfacePointsCPU
                         voxel_t* ptr = GetVoxelAt(
                                 static_cast<int>(xv) + (i == 0),
                                 static_cast<int>(yv) + (i == 1),
-                                static_cast<int>(zv) + (i == 2),
-                                static_cast<int>(workload_block_idx));
+                                static_cast<int>(zv) + (i == 2));
                         if (ptr == nullptr) continue;
 
                         float tsdf_i = ptr->GetTSDF();
@@ -455,9 +778,7 @@ void ExtractSurfacePointsCPU
                                 GetNormalAt(
                                         static_cast<int>(xv) + (i == 0),
                                         static_cast<int>(yv) + (i == 1),
-                                        static_cast<int>(zv) + (i == 2),
-                                        static_cast<int>(workload_block_idx),
-                                        ni);
+                                        static_cast<int>(zv) + (i == 2), ni);
 
                                 float* normal_ptr =
                                         normal_indexer
@@ -498,8 +819,7 @@ void ExtractSurfaceMeshCPU
 #endif
         (const core::Tensor& indices,
          const core::Tensor& inv_indices,
-         const core::Tensor& nb_indices,
-         const core::Tensor& nb_masks,
+         const core::Tensor& sorted_indices,
          const core::Tensor& block_keys,
          const core::Tensor& block_values,
          core::Tensor& vertices,
@@ -508,7 +828,11 @@ void ExtractSurfaceMeshCPU
          core::Tensor& colors,
          int64_t resolution,
          float voxel_size,
-         float weight_threshold) {
+         float weight_threshold,
+         utility::optional<std::reference_wrapper<const core::Tensor>>
+                 block_mask,
+         utility::optional<std::reference_wrapper<core::Tensor>>
+                 triangle_blocks) {
 
     int64_t resolution3 = resolution * resolution * resolution;
 
@@ -542,13 +866,21 @@ void ExtractSurfaceMeshCPU
     // Real data indexer
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
     NDArrayIndexer mesh_structure_indexer(mesh_structure, 4);
-    NDArrayIndexer nb_block_masks_indexer(nb_masks, 2);
-    NDArrayIndexer nb_block_indices_indexer(nb_indices, 2);
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+    BlockLookup lookup{block_keys.GetDataPtr<int>(),
+                       sorted_indices.GetDataPtr<int64_t>(),
+                       sorted_indices.GetLength()};
 
     // Plain arrays that does not require indexers
     const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
     const int64_t* inv_indices_ptr = inv_indices.GetDataPtr<int64_t>();
 
+    // Only the masked blocks generate triangles. The other blocks only hold
+    // the vertices on their edges shared with the masked blocks.
+    const bool* block_mask_ptr =
+            block_mask.has_value() ? block_mask.value().get().GetDataPtr<bool>()
+                                   : nullptr;
+
     int64_t n = n_blocks * resolution3;
 
 #if defined(__CUDACC__)
@@ -563,20 +895,26 @@ void ExtractSurfaceMeshCPU
             voxel_block_buffer_indexer.ElementByteSize(), [&]() {
                 launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
                                                         int64_t workload_idx) {
-                    auto GetVoxelAt = [&] OPEN3D_DEVICE(
-                                              int xo, int yo, int zo,
-                                              int curr_block_idx) -> voxel_t* {
-                        return DeviceGetVoxelAt<voxel_t>(
-                                xo, yo, zo, curr_block_idx,
-                                static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
-                                voxel_block_buffer_indexer);
-                    };
-
                     // Natural index (0, N) -> (block_idx, voxel_idx)
                     int64_t workload_block_idx = workload_idx / resolution3;
+                    if (block_mask_ptr != nullptr &&
+                        !block_mask_ptr[workload_block_idx]) {
+                        return;
+                    }
+                    int64_t block_idx = indices_ptr[workload_block_idx];
                     int64_t voxel_idx = workload_idx % resolution3;
+                    const int* block_key_ptr =
+                            block_keys_indexer.GetDataPtrFromCoord<int>(
+                                    block_idx);
+
+                    BlockCache cache{0, 0, 0, -1};
+                    auto GetVoxelAt = [&] OPEN3D_DEVICE(int xo, int yo,
+                                                        int zo) -> voxel_t* {
+                        return DeviceGetVoxelAt<voxel_t>(
+                                xo, yo, zo, block_key_ptr, block_idx,
+                                static_cast<int>(resolution), lookup, cache,
+                                voxel_block_buffer_indexer);
+                    };
 
                     // voxel_idx -> (x_voxel, y_voxel, z_voxel)
                     int64_t xv, yv, zv;
@@ -588,8 +926,7 @@ void ExtractSurfaceMeshCPU
                         voxel_t* voxel_ptr_i = GetVoxelAt(
                                 static_cast<int>(xv) + vtx_shifts[i][0],
                                 static_cast<int>(yv) + vtx_shifts[i][1],
-                                static_cast<int>(zv) + vtx_shifts[i][2],
-                                static_cast<int>(workload_block_idx));
+                                static_cast<int>(zv) + vtx_shifts[i][2]);
                         if (voxel_ptr_i == nullptr) return;
 
                         float tsdf_i = voxel_ptr_i->GetTSDF();
@@ -619,14 +956,9 @@ void ExtractSurfaceMeshCPU
                             int dyb = static_cast<int>(yv_i / resolution);
                             int dzb = static_cast<int>(zv_i / resolution);
 
-                            int nb_idx =
-                                    (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
-
-                            int64_t block_idx_i =
-                                    *nb_block_indices_indexer
-                                             .GetDataPtrFromCoord<int64_t>(
-                                                     workload_block_idx,
-                                                     nb_idx);
+                            int64_t block_idx_i = DeviceGetNeighborBlockAddr(
+                                    dxb, dyb, dzb, block_key_ptr, block_idx,
+                                    lookup, cache);
                             int* mesh_ptr_i =
                                     mesh_structure_indexer.GetDataPtrFromCoord<
                                             int>(xv_i - dxb * resolution,
@@ -641,61 +973,49 @@ void ExtractSurfaceMeshCPU
                 });
             });
 
-    // Pass 1: determine valid number of vertices.
-#if defined(__CUDACC__)
-    core::Tensor vtx_count(std::vector<int>{0}, {}, core::Dtype::Int32,
-                           block_values.GetDevice());
-    int* vtx_count_ptr = vtx_count.GetDataPtr<int>();
-#else
-    std::atomic<int> vtx_count_atomic(0);
-    std::atomic<int>* vtx_count_ptr = &vtx_count_atomic;
-#endif
-
-#if defined(__CUDACC__)
-    core::kernel::CUDALauncher::LaunchGeneralKernel(
-            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-#else
-    core::kernel::CPULauncher::LaunchGeneralKernel(
-            n, [&](int64_t workload_idx) {
-#endif
-                // Natural index (0, N) -> (block_idx, voxel_idx)
-                int64_t workload_block_idx = workload_idx / resolution3;
-                int64_t voxel_idx = workload_idx % resolution3;
-
-                // voxel_idx -> (x_voxel, y_voxel, z_voxel)
-                int64_t xv, yv, zv;
-                voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
-
-                // Obtain voxel's mesh struct ptr
-                int* mesh_struct_ptr =
-                        mesh_structure_indexer.GetDataPtrFromCoord<int>(
-                                xv, yv, zv, workload_block_idx);
-
-                // Early quit -- no allocated vertex to compute
-                if (mesh_struct_ptr[0] != -1 && mesh_struct_ptr[1] != -1 &&
-                    mesh_struct_ptr[2] != -1) {
-                    return;
-                }
-
-                // Enumerate 3 edges in the voxel
-                for (int e = 0; e < 3; ++e) {
-                    int vertex_idx = mesh_struct_ptr[e];
-                    if (vertex_idx != -1) continue;
-
-                    OPEN3D_ATOMIC_ADD(vtx_count_ptr, 1);
-                }
-            });
+    // Pass 1: count the vertices owned by each voxel on its 3 edges, and the
+    // triangles of its cube. Exclusive prefix sums of the counts give the
+    // output offsets of the voxels, so that the vertices and triangles are
+    // written without atomics, in a deterministic order.
+    core::Tensor vtx_offsets({n}, core::Dtype::Int32, block_values.GetDevice());
+    core::Tensor tri_offsets({n}, core::Dtype::Int32, block_values.GetDevice());
+    int* vtx_offsets_ptr = vtx_offsets.GetDataPtr<int>();
+    int* tri_offsets_ptr = tri_offsets.GetDataPtr<int>();
+
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        // Natural index (0, N) -> (block_idx, voxel_idx)
+        int64_t workload_block_idx = workload_idx / resolution3;
+        int64_t voxel_idx = workload_idx % resolution3;
+
+        // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+        int64_t xv, yv, zv;
+        voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+        // Obtain voxel's mesh struct ptr
+        int* mesh_struct_ptr = mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                xv, yv, zv, workload_block_idx);
+
+        int vtx_count = 0;
+        for (int e = 0; e < 3; ++e) {
+            vtx_count += (mesh_struct_ptr[e] == -1);
+        }
+        vtx_offsets_ptr[workload_idx] = vtx_count;
+        tri_offsets_ptr[workload_idx] = tri_count[mesh_struct_ptr[3]];
+    });
 
-    // Reset count_ptr
 #if defined(__CUDACC__)
-    int total_vtx_count = vtx_count.Item<int>();
-    vtx_count = core::Tensor(std::vector<int>{0}, {}, core::Dtype::Int32,
-                             block_values.GetDevice());
-    vtx_count_ptr = vtx_count.GetDataPtr<int>();
+    thrust::inclusive_scan(thrust::device, vtx_offsets_ptr,
+                           vtx_offsets_ptr + n, vtx_offsets_ptr);
+    thrust::inclusive_scan(thrust::device, tri_offsets_ptr,
+                           tri_offsets_ptr + n, tri_offsets_ptr);
 #else
-    int total_vtx_count = (*vtx_count_ptr).load();
-    (*vtx_count_ptr) = 0;
+    utility::InclusivePrefixSum(vtx_offsets_ptr, vtx_offsets_ptr + n,
+                                vtx_offsets_ptr);
+    utility::InclusivePrefixSum(tri_offsets_ptr, tri_offsets_ptr + n,
+                                tri_offsets_ptr);
 #endif
+    int total_vtx_count = n > 0 ? vtx_offsets[n - 1].Item<int>() : 0;
+    int total_tri_count = n > 0 ? tri_offsets[n - 1].Item<int>() : 0;
 
     utility::LogDebug("Total vertex count = {}", total_vtx_count);
     vertices = core::Tensor({total_vtx_count, 3}, core::Dtype::Float32,
@@ -703,7 +1023,6 @@ void ExtractSurfaceMeshCPU
     normals = core::Tensor({total_vtx_count, 3}, core::Dtype::Float32,
                            block_values.GetDevice());
 
-    NDArrayIndexer block_keys_indexer(block_keys, 1);
     NDArrayIndexer vertex_indexer(vertices, 1);
     NDArrayIndexer normal_indexer(normals, 1);
 
@@ -721,28 +1040,6 @@ void ExtractSurfaceMeshCPU
                 }
                 launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
                                                         int64_t workload_idx) {
-                    auto GetVoxelAt = [&] OPEN3D_DEVICE(
-                                              int xo, int yo, int zo,
-                                              int curr_block_idx) -> voxel_t* {
-                        return DeviceGetVoxelAt<voxel_t>(
-                                xo, yo, zo, curr_block_idx,
-                                static_cast<int>(resolution),
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
-                                voxel_block_buffer_indexer);
-                    };
-
-                    auto GetNormalAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo,
-                                                         int curr_block_idx,
-                                                         float* n) {
-                        return DeviceGetNormalAt<voxel_t>(
-                                xo, yo, zo, curr_block_idx, n,
-                                static_cast<int>(resolution), voxel_size,
-                                nb_block_masks_indexer,
-                                nb_block_indices_indexer,
-                                voxel_block_buffer_indexer);
-                    };
-
                     // Natural index (0, N) -> (block_idx, voxel_idx)
                     int64_t workload_block_idx = workload_idx / resolution3;
                     int64_t block_idx = indices_ptr[workload_block_idx];
@@ -756,6 +1053,22 @@ void ExtractSurfaceMeshCPU
                     int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
                     int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
 
+                    BlockCache cache{0, 0, 0, -1};
+                    auto GetVoxelAt = [&] OPEN3D_DEVICE(int xo, int yo,
+                                                        int zo) -> voxel_t* {
+                        return DeviceGetVoxelAt<voxel_t>(
+                                xo, yo, zo, block_key_ptr, block_idx,
+                                static_cast<int>(resolution), lookup, cache,
+                                voxel_block_buffer_indexer);
+                    };
+                    auto GetNormalAt = [&] OPEN3D_DEVICE(int xo, int yo, int zo,
+                                                         float* n) {
+                        return DeviceGetNormalAt<voxel_t>(
+                                xo, yo, zo, block_key_ptr, block_idx, n,
+                                static_cast<int>(resolution), voxel_size,
+                                lookup, cache, voxel_block_buffer_indexer);
+                    };
+
                     // voxel_idx -> (x_voxel, y_voxel, z_voxel)
                     int64_t xv, yv, zv;
                     voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
@@ -783,8 +1096,13 @@ void ExtractSurfaceMeshCPU
                     float tsdf_o = voxel_ptr->GetTSDF();
                     float no[3] = {0}, ne[3] = {0};
                     GetNormalAt(static_cast<int>(xv), static_cast<int>(yv),
-                                static_cast<int>(zv),
-                                static_cast<int>(workload_block_idx), no);
+                                static_cast<int>(zv), no);
+
+                    // The voxel owns the vertices on its 3 edges, stored
+                    // from the end of the previous voxel's vertices.
+                    int idx = workload_idx > 0
+                                      ? vtx_offsets_ptr[workload_idx - 1]
+                                      : 0;
 
                     // Enumerate 3 edges in the voxel
                     for (int e = 0; e < 3; ++e) {
@@ -794,12 +1112,10 @@ void ExtractSurfaceMeshCPU
                         voxel_t* voxel_ptr_e = GetVoxelAt(
                                 static_cast<int>(xv) + (e == 0),
                                 static_cast<int>(yv) + (e == 1),
-                                static_cast<int>(zv) + (e == 2),
-                                static_cast<int>(workload_block_idx));
+                                static_cast<int>(zv) + (e == 2));
                         float tsdf_e = voxel_ptr_e->GetTSDF();
                         float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
 
-                        int idx = OPEN3D_ATOMIC_ADD(vtx_count_ptr, 1);
                         mesh_struct_ptr[e] = idx;
 
                         float ratio_x = ratio * int(e == 0);
@@ -816,8 +1132,7 @@ void ExtractSurfaceMeshCPU
                                 normal_indexer.GetDataPtrFromCoord<float>(idx);
                         GetNormalAt(static_cast<int>(xv) + (e == 0),
                                     static_cast<int>(yv) + (e == 1),
-                                    static_cast<int>(zv) + (e == 2),
-                                    static_cast<int>(workload_block_idx), ne);
+                                    static_cast<int>(zv) + (e == 2), ne);
                         float nx = (1 - ratio) * no[0] + ratio * ne[0];
                         float ny = (1 - ratio) * no[1] + ratio * ne[1];
                         float nz = (1 - ratio) * no[2] + ratio * ne[2];
@@ -845,24 +1160,26 @@ void ExtractSurfaceMeshCPU
                             color_ptr[2] =
                                     ((1 - ratio) * b_o + ratio * b_e) / 255.0f;
                         }
+                        ++idx;
                     }
                 });
             });
 
     // Pass 3: connect vertices and form triangles.
-#if defined(__CUDACC__)
-    core::Tensor triangle_count(std::vector<int>{0}, {}, core::Dtype::Int32,
-                                block_values.GetDevice());
-    int* tri_count_ptr = triangle_count.GetDataPtr<int>();
-#else
-    std::atomic<int> tri_count_atomic(0);
-    std::atomic<int>* tri_count_ptr = &tri_count_atomic;
-#endif
-
-    triangles = core::Tensor({total_vtx_count * 3, 3}, core::Dtype::Int64,
+    triangles = core::Tensor({total_tri_count, 3}, core::Dtype::Int64,
                              block_values.GetDevice());
     NDArrayIndexer triangle_indexer(triangles, 1);
 
+    // Optional index of the block (in indices) of every triangle.
+    int64_t* triangle_blocks_ptr = nullptr;
+    if (triangle_blocks.has_value()) {
+        triangle_blocks.value().get() =
+                core::Tensor({total_tri_count}, core::Dtype::Int64,
+                             block_values.GetDevice());
+        triangle_blocks_ptr =
+                triangle_blocks.value().get().GetDataPtr<int64_t>();
+    }
+
 #if defined(__CUDACC__)
     core::kernel::CUDALauncher::LaunchGeneralKernel(
             n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
@@ -887,10 +1204,20 @@ void ExtractSurfaceMeshCPU
                 int table_idx = mesh_struct_ptr[3];
                 if (tri_count[table_idx] == 0) return;
 
-                for (size_t tri = 0; tri < 16; tri += 3) {
+                int64_t block_idx = indices_ptr[workload_block_idx];
+                const int* block_key_ptr =
+                        block_keys_indexer.GetDataPtrFromCoord<int>(block_idx);
+                BlockCache cache{0, 0, 0, -1};
+
+                int tri_idx = workload_idx > 0
+                                      ? tri_offsets_ptr[workload_idx - 1]
+                                      : 0;
+                for (size_t tri = 0; tri < 16; tri += 3, ++tri_idx) {
                     if (tri_table[table_idx][tri] == -1) return;
 
-                    int tri_idx = OPEN3D_ATOMIC_ADD(tri_count_ptr, 1);
+                    if (triangle_blocks_ptr != nullptr) {
+                        triangle_blocks_ptr[tri_idx] = workload_block_idx;
+                    }
 
                     for (size_t vertex = 0; vertex < 3; ++vertex) {
                         int edge = tri_table[table_idx][tri + vertex];
@@ -904,12 +1231,9 @@ void ExtractSurfaceMeshCPU
                         int dyb = static_cast<int>(yv_i / resolution);
                         int dzb = static_cast<int>(zv_i / resolution);
 
-                        int nb_idx = (dxb + 1) + (dyb + 1) * 3 + (dzb + 1) * 9;
-
-                        int64_t block_idx_i =
-                                *nb_block_indices_indexer
-                                         .GetDataPtrFromCoord<int64_t>(
-                                                 workload_block_idx, nb_idx);
+                        int64_t block_idx_i = DeviceGetNeighborBlockAddr(
+                                dxb, dyb, dzb, block_key_ptr, block_idx,
+                                lookup, cache);
                         int* mesh_struct_ptr_i =
                                 mesh_structure_indexer.GetDataPtrFromCoord<int>(
                                         xv_i - dxb * resolution,
@@ -925,13 +1249,7 @@ void ExtractSurfaceMeshCPU
                 }
             });
 
-#if defined(__CUDACC__)
-    int total_tri_count = triangle_count.Item<int>();
-#else
-    int total_tri_count = (*tri_count_ptr).load();
-#endif
     utility::LogDebug("Total triangle count = {}", total_tri_count);
-    triangles = triangles.Slice(0, 0, total_tri_count);
 }
 
 #if defined(__CUDACC__)
@@ -1132,27 +1450,6 @@ void EstimateRangeCPU
 #endif
 }
 
-struct BlockCache {
-    int x;
-    int y;
-    int z;
-    int block_idx;
-
-    inline int OPEN3D_DEVICE Check(int xin, int yin, int zin) {
-        return (xin == x && yin == y && zin == z) ? block_idx : -1;
-    }
-
-    inline void OPEN3D_DEVICE Update(int xin,
-                                     int yin,
-                                     int zin,
-                                     int block_idx_in) {
-        x = xin;
-        y = yin;
-        z = zin;
-        block_idx = block_idx_in;
-    }
-};
-
 #if defined(__CUDACC__)
 void RayCastCUDA
 #else
@@ -1161,6 +1458,7 @@ void RayCastCPU
         (std::shared_ptr<core::DeviceHashmap>& hashmap,
          const core::Tensor& block_values,
          const core::Tensor& range_map,
+         const core::Tensor& block_min_tsdf,
          core::Tensor& vertex_map,
          core::Tensor& depth_map,
          core::Tensor& color_map,
@@ -1190,12 +1488,22 @@ void RayCastCPU
 #else
     auto cpu_hashmap =
             std::dynamic_pointer_cast<core::TBBHashmap<Key, Hash>>(hashmap);
+    if (cpu_hashmap == nullptr) {
+        utility::LogError(
+                "Unsupported backend: CPU raycasting only supports TBB.");
+    }
     auto hashmap_impl = *cpu_hashmap->GetImpl();
 #endif
 
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
     NDArrayIndexer range_map_indexer(range_map, 2);
 
+    // Optional per-block minimal TSDF for empty space skipping.
+    const float* block_min_tsdf_ptr =
+            block_min_tsdf.GetLength() != 0
+                    ? block_min_tsdf.GetDataPtr<float>()
+                    : nullptr;
+
     NDArrayIndexer vertex_map_indexer;
     NDArrayIndexer depth_map_indexer;
     NDArrayIndexer color_map_indexer;
@@ -1283,8 +1591,8 @@ void RayCastCPU
                     auto GetVoxelAtT = [&] OPEN3D_DEVICE(
                                                float x_o, float y_o, float z_o,
                                                float x_d, float y_d, float z_d,
-                                               float t,
-                                               BlockCache& cache) -> voxel_t* {
+                                               float t, BlockCache& cache,
+                                               int& block_addr) -> voxel_t* {
                         float x_g = x_o + t * x_d;
                         float y_g = y_o + t * y_d;
                         float z_g = z_o + t * z_d;
@@ -1299,7 +1607,7 @@ void RayCastCPU
                         key(1) = y_b;
                         key(2) = z_b;
 
-                        int block_addr = cache.Check(x_b, y_b, z_b);
+                        block_addr = cache.Check(x_b, y_b, z_b);
                         if (block_addr < 0) {
                             auto iter = hashmap_impl.find(key);
                             if (iter == hashmap_impl.end()) return nullptr;
@@ -1316,6 +1624,26 @@ void RayCastCPU
                                                               block_addr);
                     };
 
+                    // Ray parameter where the ray leaves the block at t.
+                    auto GetBlockExitT = [&] OPEN3D_DEVICE(
+                                                 float x_o, float y_o,
+                                                 float z_o, float x_d,
+                                                 float y_d, float z_d,
+                                                 float t) -> float {
+                        float o[3] = {x_o, y_o, z_o};
+                        float d[3] = {x_d, y_d, z_d};
+                        float t_exit = t + block_size;
+                        for (int i = 0; i < 3; ++i) {
+                            if (d[i] == 0) continue;
+                            float b = floor((o[i] + t * d[i]) / block_size);
+                            float t_i = ((b + (d[i] > 0 ? 1 : 0)) * block_size -
+                                         o[i]) /
+                                        d[i];
+                            t_exit = t_i < t_exit ? t_i : t_exit;
+                        }
+                        return t_exit;
+                    };
+
                     int64_t y = workload_idx / cols;
                     int64_t x = workload_idx % cols;
 
@@ -1385,15 +1713,39 @@ void RayCastCPU
                     float y_d = (y_g - y_o);
                     float z_d = (z_g - z_o);
 
+                    // Minimal advance of t, and the advance of t to move
+                    // by one voxel along the ray.
+                    float t_eps = 0.01f * voxel_size;
+                    float t_voxel =
+                            voxel_size /
+                            sqrt(x_d * x_d + y_d * y_d + z_d * z_d);
+
                     BlockCache cache{0, 0, 0, -1};
+                    int block_addr = -1;
+                    int skipped_block_addr = -1;
                     bool surface_found = false;
                     while (t < t_max) {
-                        voxel_t* voxel_ptr = GetVoxelAtT(x_o, y_o, z_o, x_d,
-                                                         y_d, z_d, t, cache);
+                        voxel_t* voxel_ptr =
+                                GetVoxelAtT(x_o, y_o, z_o, x_d, y_d, z_d, t,
+                                            cache, block_addr);
 
                         if (!voxel_ptr) {
+                            // Jump to the next block along the ray.
                             t_prev = t;
-                            t += block_size;
+                            float t_exit = GetBlockExitT(x_o, y_o, z_o, x_d,
+                                                         y_d, z_d, t);
+                            t = max(t_exit, t) + t_eps;
+                        } else if (block_min_tsdf_ptr != nullptr &&
+                                   weight_threshold > 0 &&
+                                   block_min_tsdf_ptr[block_addr] > 0 &&
+                                   block_addr != skipped_block_addr) {
+                            // No zero crossing ends in this block. Jump to
+                            // its last voxel on the ray, whose positive TSDF
+                            // is sampled for the crossing in the next block.
+                            skipped_block_addr = block_addr;
+                            float t_exit = GetBlockExitT(x_o, y_o, z_o, x_d,
+                                                         y_d, z_d, t);
+                            t = max(t, t_exit - t_voxel);
                         } else {
                             tsdf_prev = tsdf;
                             tsdf = voxel_ptr->GetTSDF();
@@ -0,0 +1,581 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+static void AssertFloatDtype(const std::string& func_name,
+                             const core::Tensor& tensor) {
+    core::Dtype dtype = tensor.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[{}] Only Float32 and Float64 are supported, but {} is used.",
+                func_name, dtype.ToString());
+    }
+}
+
+/// The kernels index with Int64 triangles, so Int32 triangles are converted.
+static core::Tensor TrianglesToInt64(const std::string& func_name,
+                                     const core::Tensor& triangles,
+                                     const core::Device& device) {
+    triangles.AssertShapeCompatible({utility::nullopt, 3});
+    triangles.AssertDevice(device);
+    core::Dtype dtype = triangles.GetDtype();
+    if (dtype != core::Dtype::Int32 && dtype != core::Dtype::Int64) {
+        utility::LogError(
+                "[{}] Only Int32 and Int64 triangles are supported, but {} is "
+                "used.",
+                func_name, dtype.ToString());
+    }
+    return triangles.To(core::Dtype::Int64).Contiguous();
+}
+
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& normals,
+                            bool normalized) {
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    AssertFloatDtype(__FUNCTION__, vertices);
+    core::Device device = vertices.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleNormalsCPU(vertices.Contiguous(), triangles_i64,
+                                  normals, normalized);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeTriangleNormalsCUDA(vertices.Contiguous(), triangles_i64,
+                                   normals, normalized);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeVertexNormals(const core::Tensor& triangles,
+                          const core::Tensor& triangle_normals,
+                          int64_t num_vertices,
+                          core::Tensor& vertex_normals) {
+    AssertFloatDtype(__FUNCTION__, triangle_normals);
+    core::Device device = triangle_normals.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+    triangle_normals.AssertShape({triangles_i64.GetLength(), 3});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexNormalsCPU(triangles_i64, triangle_normals.Contiguous(),
+                                num_vertices, vertex_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeVertexNormalsCUDA(triangles_i64, triangle_normals.Contiguous(),
+                                 num_vertices, vertex_normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void NormalizeNormals(core::Tensor& normals) {
+    normals.AssertShapeCompatible({utility::nullopt, 3});
+    AssertFloatDtype(__FUNCTION__, normals);
+    normals = normals.Contiguous();
+
+    core::Device::DeviceType device_type = normals.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        NormalizeNormalsCPU(normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        NormalizeNormalsCUDA(normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void GroupEqualRows(const core::Tensor& keys,
+                    core::Tensor& group_ids,
+                    core::Tensor& first_rows) {
+    keys.AssertShapeCompatible({utility::nullopt, 3});
+    core::Dtype dtype = keys.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64 &&
+        dtype != core::Dtype::Int64) {
+        utility::LogError(
+                "[GroupEqualRows] Only Float32, Float64 and Int64 keys are "
+                "supported, but {} is used.",
+                dtype.ToString());
+    }
+
+    core::Device::DeviceType device_type = keys.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        GroupEqualRowsCPU(keys.Contiguous(), group_ids, first_rows);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        GroupEqualRowsCUDA(keys.Contiguous(), group_ids, first_rows);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AverageGroups(const core::Tensor& values,
+                   const core::Tensor& group_ids,
+                   int64_t num_groups,
+                   core::Tensor& averages) {
+    AssertFloatDtype(__FUNCTION__, values);
+    if (values.NumDims() != 2) {
+        utility::LogError(
+                "[AverageGroups] Expected values of shape (N, C), but got "
+                "{}.",
+                values.GetShape().ToString());
+    }
+    group_ids.AssertDtype(core::Dtype::Int64);
+    group_ids.AssertDevice(values.GetDevice());
+    group_ids.AssertShape({values.GetLength()});
+
+    core::Device::DeviceType device_type = values.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AverageGroupsCPU(values.Contiguous(), group_ids.Contiguous(),
+                         num_groups, averages);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        AverageGroupsCUDA(values.Contiguous(), group_ids.Contiguous(),
+                          num_groups, averages);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ClusterTriangles(const core::Tensor& triangles,
+                      const core::Tensor& vertex_map,
+                      core::Tensor& clustered) {
+    vertex_map.AssertDtype(core::Dtype::Int64);
+    core::Device device = vertex_map.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClusterTrianglesCPU(triangles_i64, vertex_map.Contiguous(), clustered);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ClusterTrianglesCUDA(triangles_i64, vertex_map.Contiguous(),
+                             clustered);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SamplePointsUniformly(const core::Tensor& vertices,
+                           const core::Tensor& triangles,
+                           int64_t number_of_points,
+                           uint64_t seed,
+                           core::Tensor& triangle_ids,
+                           core::Tensor& weights) {
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    AssertFloatDtype(__FUNCTION__, vertices);
+    core::Device device = vertices.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+    if (triangles_i64.GetLength() == 0) {
+        utility::LogError("[SamplePointsUniformly] No triangles to sample.");
+    }
+    if (number_of_points <= 0) {
+        utility::LogError(
+                "[SamplePointsUniformly] number_of_points must be positive, "
+                "but got {}.",
+                number_of_points);
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SamplePointsUniformlyCPU(vertices.Contiguous(), triangles_i64,
+                                 number_of_points, seed, triangle_ids,
+                                 weights);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SamplePointsUniformlyCUDA(vertices.Contiguous(), triangles_i64,
+                                  number_of_points, seed, triangle_ids,
+                                  weights);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EliminateSamples(const core::Tensor& points,
+                      double r_max,
+                      double r_min,
+                      int64_t number_of_points,
+                      core::Tensor& kept) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    AssertFloatDtype(__FUNCTION__, points);
+    if (number_of_points <= 0 || number_of_points > points.GetLength()) {
+        utility::LogError(
+                "[EliminateSamples] number_of_points must be in (0, {}], but "
+                "got {}.",
+                points.GetLength(), number_of_points);
+    }
+    if (!(r_max > 0)) {
+        utility::LogError("[EliminateSamples] r_max must be positive.");
+    }
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EliminateSamplesCPU(points.Contiguous(), r_max, r_min,
+                            number_of_points, kept);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        EliminateSamplesCUDA(points.Contiguous(), r_max, r_min,
+                             number_of_points, kept);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+/// Maximum number of triangles in a leaf of the BVH.
+static constexpr int64_t kBVHLeafSize = 4;
+
+void BuildTriangleBVH(const core::Tensor& vertices,
+                      const core::Tensor& triangles,
+                      core::Tensor& node_bounds,
+                      core::Tensor& node_data,
+                      core::Tensor& triangle_order) {
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    AssertFloatDtype(__FUNCTION__, vertices);
+    core::Device device = vertices.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t num_triangles = triangles_i64.GetLength();
+    if (num_triangles == 0) {
+        utility::LogError("[BuildTriangleBVH] No triangles.");
+    }
+
+    core::Device host("CPU:0");
+    const std::vector<double> v =
+            vertices.To(host, core::Dtype::Float64).ToFlatVector<double>();
+    const std::vector<int64_t> t = triangles_i64.ToFlatVector<int64_t>();
+
+    // Bounds and centroid of each triangle.
+    std::vector<double> tri_bounds(6 * num_triangles);
+    std::vector<double> centroids(3 * num_triangles);
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        double* lo = &tri_bounds[6 * i];
+        double* hi = lo + 3;
+        std::fill(lo, hi, std::numeric_limits<double>::infinity());
+        std::fill(hi, hi + 3, -std::numeric_limits<double>::infinity());
+        for (int k = 0; k < 3; ++k) {
+            int64_t vidx = t[3 * i + k];
+            if (vidx < 0 || vidx >= num_vertices) {
+                utility::LogError(
+                        "[BuildTriangleBVH] Vertex index {} is out of range "
+                        "[0, {}).",
+                        vidx, num_vertices);
+            }
+            for (int d = 0; d < 3; ++d) {
+                lo[d] = std::min(lo[d], v[3 * vidx + d]);
+                hi[d] = std::max(hi[d], v[3 * vidx + d]);
+            }
+        }
+        for (int d = 0; d < 3; ++d) {
+            centroids[3 * i + d] = 0.5 * (lo[d] + hi[d]);
+        }
+    }
+
+    std::vector<int64_t> order(num_triangles);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<double> bounds;
+    std::vector<int64_t> data;
+
+    // Pending ranges of the order as (begin, end, parent), where parent is
+    // the inner node whose right child the range becomes, or -1. Left ranges
+    // are popped right after their parent, which gives the depth-first order.
+    std::vector<std::tuple<int64_t, int64_t, int64_t>> stack;
+    stack.emplace_back(0, num_triangles, -1);
+    while (!stack.empty()) {
+        int64_t begin, end, parent;
+        std::tie(begin, end, parent) = stack.back();
+        stack.pop_back();
+        const int64_t node = int64_t(data.size() / 2);
+        if (parent >= 0) {
+            data[2 * parent] = node;
+        }
+
+        double lo[3], hi[3], c_lo[3], c_hi[3];
+        for (int d = 0; d < 3; ++d) {
+            lo[d] = c_lo[d] = std::numeric_limits<double>::infinity();
+            hi[d] = c_hi[d] = -std::numeric_limits<double>::infinity();
+        }
+        for (int64_t k = begin; k < end; ++k) {
+            const int64_t i = order[k];
+            for (int d = 0; d < 3; ++d) {
+                lo[d] = std::min(lo[d], tri_bounds[6 * i + d]);
+                hi[d] = std::max(hi[d], tri_bounds[6 * i + 3 + d]);
+                c_lo[d] = std::min(c_lo[d], centroids[3 * i + d]);
+                c_hi[d] = std::max(c_hi[d], centroids[3 * i + d]);
+            }
+        }
+        bounds.insert(bounds.end(), lo, lo + 3);
+        bounds.insert(bounds.end(), hi, hi + 3);
+
+        if (end - begin <= kBVHLeafSize) {
+            data.push_back(begin);
+            data.push_back(end - begin);
+            continue;
+        }
+        data.push_back(-1);
+        data.push_back(0);
+
+        int axis = 0;
+        for (int d = 1; d < 3; ++d) {
+            if (c_hi[d] - c_lo[d] > c_hi[axis] - c_lo[axis]) {
+                axis = d;
+            }
+        }
+        const int64_t mid = begin + (end - begin) / 2;
+        std::nth_element(order.begin() + begin, order.begin() + mid,
+                         order.begin() + end, [&](int64_t a, int64_t b) {
+                             return centroids[3 * a + axis] <
+                                    centroids[3 * b + axis];
+                         });
+        stack.emplace_back(mid, end, node);
+        stack.emplace_back(begin, mid, -1);
+    }
+
+    const int64_t num_nodes = int64_t(data.size() / 2);
+    node_bounds = core::Tensor(bounds, {num_nodes, 6}, core::Dtype::Float64,
+                               host)
+                          .To(device);
+    node_data = core::Tensor(data, {num_nodes, 2}, core::Dtype::Int64, host)
+                        .To(device);
+    triangle_order =
+            core::Tensor(order, {num_triangles}, core::Dtype::Int64, host)
+                    .To(device);
+}
+
+void ComputePointToMeshDistance(const core::Tensor& vertices,
+                                const core::Tensor& triangles,
+                                const core::Tensor& node_bounds,
+                                const core::Tensor& node_data,
+                                const core::Tensor& triangle_order,
+                                const core::Tensor& query_points,
+                                core::Tensor& distances,
+                                core::Tensor& closest_triangles) {
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    AssertFloatDtype(__FUNCTION__, vertices);
+    core::Device device = vertices.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+    query_points.AssertShapeCompatible({utility::nullopt, 3});
+    query_points.AssertDtype(vertices.GetDtype());
+    query_points.AssertDevice(device);
+    node_bounds.AssertDtype(core::Dtype::Float64);
+    node_bounds.AssertDevice(device);
+    node_data.AssertDtype(core::Dtype::Int64);
+    node_data.AssertDevice(device);
+    triangle_order.AssertDtype(core::Dtype::Int64);
+    triangle_order.AssertDevice(device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePointToMeshDistanceCPU(
+                vertices.Contiguous(), triangles_i64, node_bounds.Contiguous(),
+                node_data.Contiguous(), triangle_order.Contiguous(),
+                query_points.Contiguous(), distances, closest_triangles);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputePointToMeshDistanceCUDA(
+                vertices.Contiguous(), triangles_i64, node_bounds.Contiguous(),
+                node_data.Contiguous(), triangle_order.Contiguous(),
+                query_points.Contiguous(), distances, closest_triangles);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ClusterConnectedTriangles(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               core::Tensor& cluster_ids,
+                               core::Tensor& num_triangles,
+                               core::Tensor& areas) {
+    vertices.AssertShapeCompatible({utility::nullopt, 3});
+    AssertFloatDtype(__FUNCTION__, vertices);
+    core::Device device = vertices.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+    // The union-find stores Int32 parents.
+    if (triangles_i64.GetLength() > std::numeric_limits<int>::max()) {
+        utility::LogError("[ClusterConnectedTriangles] Too many triangles: {}.",
+                          triangles_i64.GetLength());
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClusterConnectedTrianglesCPU(vertices.Contiguous(), triangles_i64,
+                                     cluster_ids, num_triangles, areas);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ClusterConnectedTrianglesCUDA(vertices.Contiguous(), triangles_i64,
+                                      cluster_ids, num_triangles, areas);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeVertexAdjacency(const core::Tensor& triangles,
+                            int64_t num_vertices,
+                            core::Tensor& offsets,
+                            core::Tensor& neighbors) {
+    core::Device device = triangles.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexAdjacencyCPU(triangles_i64, num_vertices, offsets,
+                                  neighbors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeVertexAdjacencyCUDA(triangles_i64, num_vertices, offsets,
+                                   neighbors);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterVertexAttribute(const core::Tensor& values,
+                           const core::Tensor& positions,
+                           const core::Tensor& offsets,
+                           const core::Tensor& neighbors,
+                           VertexFilterType type,
+                           double strength,
+                           core::Tensor& filtered) {
+    AssertFloatDtype(__FUNCTION__, values);
+    core::Device device = values.GetDevice();
+    const int64_t num_vertices = values.GetLength();
+    values.AssertShapeCompatible({num_vertices, utility::nullopt});
+    positions.AssertShape({num_vertices, 3});
+    positions.AssertDtype(values.GetDtype());
+    positions.AssertDevice(device);
+    offsets.AssertShape({num_vertices + 1});
+    offsets.AssertDtype(core::Dtype::Int64);
+    offsets.AssertDevice(device);
+    neighbors.AssertDtype(core::Dtype::Int64);
+    neighbors.AssertDevice(device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterVertexAttributeCPU(values.Contiguous(), positions.Contiguous(),
+                                 offsets.Contiguous(), neighbors.Contiguous(),
+                                 type, strength, filtered);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FilterVertexAttributeCUDA(values.Contiguous(), positions.Contiguous(),
+                                  offsets.Contiguous(), neighbors.Contiguous(),
+                                  type, strength, filtered);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SubdivideTriangles(const core::Tensor& triangles,
+                        int64_t num_vertices,
+                        core::Tensor& vertex_ends,
+                        core::Tensor& new_triangles) {
+    core::Device device = triangles.GetDevice();
+    core::Tensor triangles_i64 =
+            TrianglesToInt64(__FUNCTION__, triangles, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SubdivideTrianglesCPU(triangles_i64, num_vertices, vertex_ends,
+                              new_triangles);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SubdivideTrianglesCUDA(triangles_i64, num_vertices, vertex_ends,
+                               new_triangles);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
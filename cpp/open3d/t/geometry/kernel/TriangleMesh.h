@@ -0,0 +1,465 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// \brief Computes the normal of each triangle as the cross product of its
+/// edges.
+///
+/// \param vertices Vertices of shape (N, 3), Float32 or Float64.
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3).
+/// \param normals Output normals of shape (T, 3) with the dtype of the
+/// vertices.
+/// \param normalized If true, the normals are normalized like in
+/// NormalizeNormals.
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& normals,
+                            bool normalized);
+
+void ComputeTriangleNormalsCPU(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               core::Tensor& normals,
+                               bool normalized);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeTriangleNormalsCUDA(const core::Tensor& vertices,
+                                const core::Tensor& triangles,
+                                core::Tensor& normals,
+                                bool normalized);
+#endif
+
+/// \brief Sums the normals of the triangles around each vertex.
+///
+/// The corners are sorted by vertex instead of being scattered with atomics,
+/// so the sums are deterministic and add up in the order of the triangles,
+/// like in the legacy mesh.
+///
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3).
+/// \param triangle_normals Triangle normals of shape (T, 3), Float32 or
+/// Float64.
+/// \param num_vertices Number of vertices N.
+/// \param vertex_normals Output unnormalized normals of shape (N, 3) with
+/// the dtype of the triangle normals.
+void ComputeVertexNormals(const core::Tensor& triangles,
+                          const core::Tensor& triangle_normals,
+                          int64_t num_vertices,
+                          core::Tensor& vertex_normals);
+
+void ComputeVertexNormalsCPU(const core::Tensor& triangles,
+                             const core::Tensor& triangle_normals,
+                             int64_t num_vertices,
+                             core::Tensor& vertex_normals);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeVertexNormalsCUDA(const core::Tensor& triangles,
+                              const core::Tensor& triangle_normals,
+                              int64_t num_vertices,
+                              core::Tensor& vertex_normals);
+#endif
+
+/// \brief Normalizes \p normals in place. Like in the legacy mesh, zero
+/// normals are kept and NaN normals become (0, 0, 1).
+///
+/// \param normals Normals of shape (N, 3), Float32 or Float64.
+void NormalizeNormals(core::Tensor& normals);
+
+void NormalizeNormalsCPU(core::Tensor& normals);
+
+#ifdef BUILD_CUDA_MODULE
+void NormalizeNormalsCUDA(core::Tensor& normals);
+#endif
+
+/// \brief Groups the rows of \p keys that are exactly equal.
+///
+/// The rows are sorted lexicographically, and the groups are numbered in
+/// the order of their first row, which is how the legacy mesh numbers merged
+/// vertices.
+///
+/// \param keys Keys of shape (N, 3), Float32, Float64 or Int64.
+/// \param group_ids Output Int64 group of each row, of shape (N,).
+/// \param first_rows Output Int64 first row of each group, of shape (M,), in
+/// ascending order.
+void GroupEqualRows(const core::Tensor& keys,
+                    core::Tensor& group_ids,
+                    core::Tensor& first_rows);
+
+void GroupEqualRowsCPU(const core::Tensor& keys,
+                       core::Tensor& group_ids,
+                       core::Tensor& first_rows);
+
+#ifdef BUILD_CUDA_MODULE
+void GroupEqualRowsCUDA(const core::Tensor& keys,
+                        core::Tensor& group_ids,
+                        core::Tensor& first_rows);
+#endif
+
+/// \brief Averages the rows of \p values that belong to the same group.
+///
+/// \param values Values of shape (N, C), Float32 or Float64.
+/// \param group_ids Int64 group of each row, of shape (N,), in [0, M).
+/// \param num_groups Number of groups M.
+/// \param averages Output averages of shape (M, C) with the dtype of the
+/// values. Empty groups are zero.
+void AverageGroups(const core::Tensor& values,
+                   const core::Tensor& group_ids,
+                   int64_t num_groups,
+                   core::Tensor& averages);
+
+void AverageGroupsCPU(const core::Tensor& values,
+                      const core::Tensor& group_ids,
+                      int64_t num_groups,
+                      core::Tensor& averages);
+
+#ifdef BUILD_CUDA_MODULE
+void AverageGroupsCUDA(const core::Tensor& values,
+                       const core::Tensor& group_ids,
+                       int64_t num_groups,
+                       core::Tensor& averages);
+#endif
+
+/// \brief Remaps the triangles of a clustered mesh and drops the degenerate
+/// ones.
+///
+/// Each triangle is rotated so that its smallest index comes first, which
+/// keeps its orientation and makes equal triangles have equal rows.
+///
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3).
+/// \param vertex_map Int64 new index of each vertex.
+/// \param clustered Output Int64 remapped triangles of shape (T', 3).
+void ClusterTriangles(const core::Tensor& triangles,
+                      const core::Tensor& vertex_map,
+                      core::Tensor& clustered);
+
+void ClusterTrianglesCPU(const core::Tensor& triangles,
+                         const core::Tensor& vertex_map,
+                         core::Tensor& clustered);
+
+#ifdef BUILD_CUDA_MODULE
+void ClusterTrianglesCUDA(const core::Tensor& triangles,
+                          const core::Tensor& vertex_map,
+                          core::Tensor& clustered);
+#endif
+
+/// \brief Samples points uniformly on the surface of a mesh.
+///
+/// Like in the legacy mesh, triangle i receives the samples between the
+/// rounded area fractions of the triangles before it and up to it, so the
+/// number of points per triangle is proportional to its area. The random
+/// barycentric coordinates come from a counter-based generator, so the
+/// samples only depend on the seed and not on the device.
+///
+/// \param vertices Vertices of shape (N, 3), Float32 or Float64.
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3), T > 0.
+/// \param number_of_points Number of points P to sample.
+/// \param seed Seed of the random generator.
+/// \param triangle_ids Output Int64 triangle of each sample, of shape (P,).
+/// \param weights Output barycentric coordinates of shape (P, 3) with the
+/// dtype of the vertices.
+void SamplePointsUniformly(const core::Tensor& vertices,
+                           const core::Tensor& triangles,
+                           int64_t number_of_points,
+                           uint64_t seed,
+                           core::Tensor& triangle_ids,
+                           core::Tensor& weights);
+
+void SamplePointsUniformlyCPU(const core::Tensor& vertices,
+                              const core::Tensor& triangles,
+                              int64_t number_of_points,
+                              uint64_t seed,
+                              core::Tensor& triangle_ids,
+                              core::Tensor& weights);
+
+#ifdef BUILD_CUDA_MODULE
+void SamplePointsUniformlyCUDA(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               int64_t number_of_points,
+                               uint64_t seed,
+                               core::Tensor& triangle_ids,
+                               core::Tensor& weights);
+#endif
+
+/// \brief Selects a Poisson disk subset of samples by sample elimination.
+///
+/// Like in the legacy mesh (Yuksel, "Sample Elimination for Generating Poisson
+/// Disk Sample Sets", EUROGRAPHICS 2015), each sample is weighted by its
+/// neighbours within \p r_max and the heaviest samples are eliminated. To
+/// run in parallel, each round eliminates the samples that are heavier than
+/// all their neighbours, heaviest first, instead of a single sample. The
+/// neighbours are found in a grid of cells of size \p r_max, hashed by
+/// sorting the samples by cell.
+///
+/// \param points Samples of shape (N, 3), Float32 or Float64.
+/// \param r_max Radius of the neighbourhood of a sample.
+/// \param r_min Distance below which the weight of a neighbour is capped.
+/// \param number_of_points Number of samples M to keep, 0 < M <= N.
+/// \param kept Output Int64 indices of the kept samples, of shape (M,), in
+/// ascending order.
+void EliminateSamples(const core::Tensor& points,
+                      double r_max,
+                      double r_min,
+                      int64_t number_of_points,
+                      core::Tensor& kept);
+
+void EliminateSamplesCPU(const core::Tensor& points,
+                         double r_max,
+                         double r_min,
+                         int64_t number_of_points,
+                         core::Tensor& kept);
+
+#ifdef BUILD_CUDA_MODULE
+void EliminateSamplesCUDA(const core::Tensor& points,
+                          double r_max,
+                          double r_min,
+                          int64_t number_of_points,
+                          core::Tensor& kept);
+#endif
+
+/// \brief Builds a bounding volume hierarchy over the triangles of a mesh.
+///
+/// The tree is built on the host by splitting the triangles at the median
+/// centroid along the longest axis, and is then copied to the device of the
+/// vertices. The nodes are stored in depth-first order, so the left child of
+/// an inner node directly follows it.
+///
+/// \param vertices Vertices of shape (N, 3), Float32 or Float64.
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3), T > 0.
+/// \param node_bounds Output Float64 bounds of shape (M, 6), the minimum and
+/// then the maximum corner of each node.
+/// \param node_data Output Int64 tensor of shape (M, 2). For an inner node,
+/// the index of its right child and 0. For a leaf, the offset of its
+/// triangles in \p triangle_order and their number.
+/// \param triangle_order Output Int64 triangle indices of shape (T,),
+/// grouped by leaf.
+void BuildTriangleBVH(const core::Tensor& vertices,
+                      const core::Tensor& triangles,
+                      core::Tensor& node_bounds,
+                      core::Tensor& node_data,
+                      core::Tensor& triangle_order);
+
+/// \brief Computes the distance from query points to the closest triangle of
+/// a mesh, by a nearest-first traversal of the BVH of BuildTriangleBVH.
+///
+/// \param vertices Vertices of shape (N, 3), Float32 or Float64.
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3), T > 0.
+/// \param node_bounds Node bounds of BuildTriangleBVH.
+/// \param node_data Node data of BuildTriangleBVH.
+/// \param triangle_order Triangle order of BuildTriangleBVH.
+/// \param query_points Query points of shape (Q, 3) with the dtype of the
+/// vertices.
+/// \param distances Output distances of shape (Q,) with the dtype of the
+/// vertices.
+/// \param closest_triangles Output Int64 closest triangle of each query, of
+/// shape (Q,).
+void ComputePointToMeshDistance(const core::Tensor& vertices,
+                                const core::Tensor& triangles,
+                                const core::Tensor& node_bounds,
+                                const core::Tensor& node_data,
+                                const core::Tensor& triangle_order,
+                                const core::Tensor& query_points,
+                                core::Tensor& distances,
+                                core::Tensor& closest_triangles);
+
+void ComputePointToMeshDistanceCPU(const core::Tensor& vertices,
+                                   const core::Tensor& triangles,
+                                   const core::Tensor& node_bounds,
+                                   const core::Tensor& node_data,
+                                   const core::Tensor& triangle_order,
+                                   const core::Tensor& query_points,
+                                   core::Tensor& distances,
+                                   core::Tensor& closest_triangles);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputePointToMeshDistanceCUDA(const core::Tensor& vertices,
+                                    const core::Tensor& triangles,
+                                    const core::Tensor& node_bounds,
+                                    const core::Tensor& node_data,
+                                    const core::Tensor& triangle_order,
+                                    const core::Tensor& query_points,
+                                    core::Tensor& distances,
+                                    core::Tensor& closest_triangles);
+#endif
+
+/// \brief Clusters the triangles connected through shared edges.
+///
+/// The half-edges are sorted by undirected edge, and the triangles along the
+/// same edge are joined with a lock-free union-find. Like in the legacy mesh,
+/// the clusters are numbered in the order of their first triangle. The
+/// statistics are reduced from the triangles sorted by cluster, so the sums
+/// are deterministic.
+///
+/// \param vertices Vertices of shape (N, 3), Float32 or Float64.
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3).
+/// \param cluster_ids Output Int64 cluster of each triangle, of shape (T,).
+/// \param num_triangles Output Int64 number of triangles of each cluster, of
+/// shape (C,).
+/// \param areas Output surface area of each cluster, of shape (C,), with the
+/// dtype of the vertices.
+void ClusterConnectedTriangles(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               core::Tensor& cluster_ids,
+                               core::Tensor& num_triangles,
+                               core::Tensor& areas);
+
+void ClusterConnectedTrianglesCPU(const core::Tensor& vertices,
+                                  const core::Tensor& triangles,
+                                  core::Tensor& cluster_ids,
+                                  core::Tensor& num_triangles,
+                                  core::Tensor& areas);
+
+#ifdef BUILD_CUDA_MODULE
+void ClusterConnectedTrianglesCUDA(const core::Tensor& vertices,
+                                   const core::Tensor& triangles,
+                                   core::Tensor& cluster_ids,
+                                   core::Tensor& num_triangles,
+                                   core::Tensor& areas);
+#endif
+
+/// \brief Computes the neighbours of each vertex, i.e. the other corners of
+/// its triangles, as compressed sparse row (CSR) arrays.
+///
+/// The corner pairs are sorted instead of inserted into per-vertex sets, so
+/// the neighbours of each vertex are sorted and unique, like in the legacy
+/// mesh adjacency.
+///
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3).
+/// \param num_vertices Number of vertices N.
+/// \param offsets Output Int64 offsets of shape (N + 1,). The neighbours of
+/// vertex i are neighbors[offsets[i]:offsets[i + 1]].
+/// \param neighbors Output Int64 neighbours of all vertices.
+void ComputeVertexAdjacency(const core::Tensor& triangles,
+                            int64_t num_vertices,
+                            core::Tensor& offsets,
+                            core::Tensor& neighbors);
+
+void ComputeVertexAdjacencyCPU(const core::Tensor& triangles,
+                               int64_t num_vertices,
+                               core::Tensor& offsets,
+                               core::Tensor& neighbors);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeVertexAdjacencyCUDA(const core::Tensor& triangles,
+                                int64_t num_vertices,
+                                core::Tensor& offsets,
+                                core::Tensor& neighbors);
+#endif
+
+/// Per-vertex filters of FilterVertexAttribute.
+enum class VertexFilterType {
+    /// v + strength * (n * v - sum of the neighbours).
+    Sharpen,
+    /// Average of the vertex and its neighbours.
+    SmoothSimple,
+    /// v + strength * (weighted average of the neighbours - v), weighted by
+    /// the inverse distance to the neighbours.
+    SmoothLaplacian
+};
+
+/// \brief Applies one iteration of a filter over the neighbours of each
+/// vertex to a vertex attribute, like the legacy mesh filters.
+///
+/// Each thread updates one vertex from the previous values, so the vertices
+/// are updated in parallel. Vertices without neighbours are kept.
+///
+/// \param values Values of shape (N, C), Float32 or Float64.
+/// \param positions Vertices of shape (N, 3) with the dtype of the values.
+/// They weigh the neighbours of VertexFilterType::SmoothLaplacian.
+/// \param offsets Int64 offsets of ComputeVertexAdjacency.
+/// \param neighbors Int64 neighbours of ComputeVertexAdjacency.
+/// \param type Filter to apply.
+/// \param strength Strength of VertexFilterType::Sharpen, or lambda of
+/// VertexFilterType::SmoothLaplacian.
+/// \param filtered Output values of shape (N, C) with the dtype of the
+/// values.
+void FilterVertexAttribute(const core::Tensor& values,
+                           const core::Tensor& positions,
+                           const core::Tensor& offsets,
+                           const core::Tensor& neighbors,
+                           VertexFilterType type,
+                           double strength,
+                           core::Tensor& filtered);
+
+void FilterVertexAttributeCPU(const core::Tensor& values,
+                              const core::Tensor& positions,
+                              const core::Tensor& offsets,
+                              const core::Tensor& neighbors,
+                              VertexFilterType type,
+                              double strength,
+                              core::Tensor& filtered);
+
+#ifdef BUILD_CUDA_MODULE
+void FilterVertexAttributeCUDA(const core::Tensor& values,
+                               const core::Tensor& positions,
+                               const core::Tensor& offsets,
+                               const core::Tensor& neighbors,
+                               VertexFilterType type,
+                               double strength,
+                               core::Tensor& filtered);
+#endif
+
+/// \brief Splits each triangle into four at a new vertex on each of its
+/// edges.
+///
+/// The new vertices follow the old ones, and are numbered in the order in
+/// which the triangles first reach their edges, like in the legacy mesh.
+///
+/// \param triangles Int32 or Int64 vertex indices of shape (T, 3).
+/// \param num_vertices Number of vertices N.
+/// \param vertex_ends Output Int64 tensor of shape (N + E, 2). Row i < N is
+/// (i, i), and row N + e holds the vertices of edge e, the smaller one first,
+/// so the new vertex attributes interpolate the rows.
+/// \param new_triangles Output Int64 vertex indices of shape (4 T, 3).
+/// Triangle 4 t + k is the k-th child of triangle t.
+void SubdivideTriangles(const core::Tensor& triangles,
+                        int64_t num_vertices,
+                        core::Tensor& vertex_ends,
+                        core::Tensor& new_triangles);
+
+void SubdivideTrianglesCPU(const core::Tensor& triangles,
+                           int64_t num_vertices,
+                           core::Tensor& vertex_ends,
+                           core::Tensor& new_triangles);
+
+#ifdef BUILD_CUDA_MODULE
+void SubdivideTrianglesCUDA(const core::Tensor& triangles,
+                            int64_t num_vertices,
+                            core::Tensor& vertex_ends,
+                            core::Tensor& new_triangles);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
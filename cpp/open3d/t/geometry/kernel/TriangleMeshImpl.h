@@ -0,0 +1,1359 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#else
+#include <tbb/parallel_sort.h>
+#endif
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/DisjointSetImpl.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+#if !defined(__CUDACC__)
+#include "open3d/utility/ParallelScan.h"
+#endif
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Normalizes \p n in place like Eigen's normalize() in the legacy mesh: zero
+/// normals are kept, and NaN normals become (0, 0, 1).
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline void NormalizeNormal(scalar_t* n) {
+    scalar_t norm2 = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+    if (norm2 > 0) {
+        scalar_t inv_norm = scalar_t(1) / sqrt(norm2);
+        n[0] *= inv_norm;
+        n[1] *= inv_norm;
+        n[2] *= inv_norm;
+    }
+    if (ISNAN(n[0])) {
+        n[0] = 0;
+        n[1] = 0;
+        n[2] = 1;
+    }
+}
+
+/// Three-way comparison with a total order: NaN compares equal to NaN and
+/// greater than any number, so that it can be used to sort.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline int CompareKey(scalar_t a, scalar_t b) {
+    bool a_nan = a != a;
+    bool b_nan = b != b;
+    if (a_nan || b_nan) {
+        return int(a_nan) - int(b_nan);
+    }
+    return a < b ? -1 : (b < a ? 1 : 0);
+}
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline int CompareRows(const scalar_t* a,
+                                                 const scalar_t* b) {
+    for (int i = 0; i < 3; ++i) {
+        int c = CompareKey(a[i], b[i]);
+        if (c != 0) {
+            return c;
+        }
+    }
+    return 0;
+}
+
+/// Returns the first position in the sorted array \p values of length \p n
+/// whose value is greater than (or equal to, if \p or_equal) \p value.
+OPEN3D_HOST_DEVICE static inline int64_t BinarySearch(const int64_t* values,
+                                                      int64_t n,
+                                                      int64_t value,
+                                                      bool or_equal) {
+    int64_t lo = 0, hi = n;
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (values[mid] > value || (or_equal && values[mid] == value)) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+/// The k-th output of the SplitMix64 generator seeded with \p seed, as a
+/// double in [0, 1).
+OPEN3D_HOST_DEVICE static inline double SplitMix64Uniform(uint64_t seed,
+                                                          uint64_t k) {
+    uint64_t z = seed + (k + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    return double(z >> 11) * (1.0 / double(uint64_t(1) << 53));
+}
+
+/// Squared distance from \p p to the triangle (\p a, \p b, \p c), by the
+/// closest point test of the Voronoi regions of the triangle, see Ericson,
+/// "Real-Time Collision Detection", 2004. Degenerate triangles are handled
+/// like their edges.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline scalar_t PointTriangleDistance2(
+        const scalar_t* p,
+        const scalar_t* a,
+        const scalar_t* b,
+        const scalar_t* c) {
+    scalar_t ab[3], ac[3], ap[3], bp[3], cp[3];
+    for (int i = 0; i < 3; ++i) {
+        ab[i] = b[i] - a[i];
+        ac[i] = c[i] - a[i];
+        ap[i] = p[i] - a[i];
+        bp[i] = p[i] - b[i];
+        cp[i] = p[i] - c[i];
+    }
+    auto dot = [](const scalar_t* x, const scalar_t* y) {
+        return x[0] * y[0] + x[1] * y[1] + x[2] * y[2];
+    };
+    // Closest point as a + v * ab + w * ac.
+    scalar_t v = 0, w = 0;
+    scalar_t d1 = dot(ab, ap), d2 = dot(ac, ap);
+    scalar_t d3 = dot(ab, bp), d4 = dot(ac, bp);
+    scalar_t d5 = dot(ab, cp), d6 = dot(ac, cp);
+    scalar_t vc = d1 * d4 - d3 * d2;
+    scalar_t vb = d5 * d2 - d1 * d6;
+    scalar_t va = d3 * d6 - d5 * d4;
+    if (d1 <= 0 && d2 <= 0) {
+        // Vertex a.
+    } else if (d3 >= 0 && d4 <= d3) {
+        v = 1;
+    } else if (d6 >= 0 && d5 <= d6) {
+        w = 1;
+    } else if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        v = d1 - d3 > 0 ? d1 / (d1 - d3) : scalar_t(0);
+    } else if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        w = d2 - d6 > 0 ? d2 / (d2 - d6) : scalar_t(0);
+    } else if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+        scalar_t denom = (d4 - d3) + (d5 - d6);
+        w = denom > 0 ? (d4 - d3) / denom : scalar_t(0);
+        v = 1 - w;
+    } else if (va + vb + vc > 0) {
+        v = vb / (va + vb + vc);
+        w = vc / (va + vb + vc);
+    }
+    scalar_t dist2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        scalar_t diff = ap[i] - v * ab[i] - w * ac[i];
+        dist2 += diff * diff;
+    }
+    return dist2;
+}
+
+/// Squared distance from \p p to the box with corners \p bounds[0:3] and
+/// \p bounds[3:6].
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE static inline double PointBoxDistance2(
+        const scalar_t* p, const double* bounds) {
+    double dist2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        double x = double(p[i]);
+        double diff = x < bounds[i] ? bounds[i] - x
+                                    : (x > bounds[3 + i] ? x - bounds[3 + i]
+                                                         : 0.0);
+        dist2 += diff * diff;
+    }
+    return dist2;
+}
+
+/// Stable argsort of the Int64 tensor \p keys of shape (N,). The sorted keys
+/// are returned in \p sorted_keys.
+static core::Tensor ArgSortIndices(const core::Tensor& keys,
+                                   core::Tensor& sorted_keys) {
+    int64_t n = keys.GetLength();
+    core::Tensor order =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int64, keys.GetDevice());
+    int64_t* order_ptr = order.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    sorted_keys = keys.Clone();
+    int64_t* sorted_ptr = sorted_keys.GetDataPtr<int64_t>();
+    thrust::stable_sort_by_key(thrust::device, sorted_ptr, sorted_ptr + n,
+                               order_ptr);
+#else
+    const int64_t* keys_ptr = keys.GetDataPtr<int64_t>();
+    tbb::parallel_sort(order_ptr, order_ptr + n,
+                       [keys_ptr](int64_t a, int64_t b) {
+                           return keys_ptr[a] < keys_ptr[b] ||
+                                  (keys_ptr[a] == keys_ptr[b] && a < b);
+                       });
+    sorted_keys = keys.IndexGet({order});
+#endif
+    return order;
+}
+
+/// Sums (or averages) the rows of \p values of shape (M, C) into \p out of
+/// shape (num_out, C). Entry k of \p indices of shape (N,) adds the row
+/// k / \p repeat to the output row indices[k]; out of range indices are
+/// ignored. Entries are sorted instead of scattered with atomics, so each
+/// output row adds up its entries in order, on one thread.
+static void SumByIndex(const core::Tensor& values,
+                       const core::Tensor& indices,
+                       int64_t repeat,
+                       int64_t num_out,
+                       bool average,
+                       core::Tensor& out) {
+    int64_t channels = values.GetShape(1);
+    int64_t n = indices.GetLength();
+    out = core::Tensor::Zeros({num_out, channels}, values.GetDtype(),
+                              values.GetDevice());
+    if (n == 0 || num_out == 0) {
+        return;
+    }
+
+    core::Tensor sorted_indices;
+    core::Tensor order = ArgSortIndices(indices, sorted_indices);
+    const int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    const int64_t* sorted_ptr = sorted_indices.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* out_ptr = out.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(num_out, [=] OPEN3D_DEVICE(
+                                                      int64_t workload_idx) {
+            int64_t begin = BinarySearch(sorted_ptr, n, workload_idx,
+                                         /*or_equal=*/true);
+            int64_t end = BinarySearch(sorted_ptr, n, workload_idx,
+                                       /*or_equal=*/false);
+            scalar_t* dst = out_ptr + channels * workload_idx;
+            for (int64_t k = begin; k < end; ++k) {
+                const scalar_t* src =
+                        values_ptr + channels * (order_ptr[k] / repeat);
+                for (int64_t c = 0; c < channels; ++c) {
+                    dst[c] += src[c];
+                }
+            }
+            if (average && end > begin) {
+                for (int64_t c = 0; c < channels; ++c) {
+                    dst[c] /= scalar_t(end - begin);
+                }
+            }
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeTriangleNormalsCUDA
+#else
+void ComputeTriangleNormalsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& normals,
+         bool normalized) {
+    int64_t num_triangles = triangles.GetLength();
+    normals = core::Tensor({num_triangles, 3}, vertices.GetDtype(),
+                           vertices.GetDevice());
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                    const scalar_t* v0 = vertices_ptr + 3 * triangle[0];
+                    const scalar_t* v1 = vertices_ptr + 3 * triangle[1];
+                    const scalar_t* v2 = vertices_ptr + 3 * triangle[2];
+                    scalar_t e1[3], e2[3];
+                    for (int i = 0; i < 3; ++i) {
+                        e1[i] = v1[i] - v0[i];
+                        e2[i] = v2[i] - v0[i];
+                    }
+                    scalar_t* n = normals_ptr + 3 * workload_idx;
+                    n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+                    n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+                    n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+                    if (normalized) {
+                        NormalizeNormal(n);
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexNormalsCUDA
+#else
+void ComputeVertexNormalsCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& triangle_normals,
+         int64_t num_vertices,
+         core::Tensor& vertex_normals) {
+    // Corner k belongs to triangle k / 3.
+    SumByIndex(triangle_normals, triangles.Reshape({-1}), /*repeat=*/3,
+               num_vertices, /*average=*/false, vertex_normals);
+}
+
+#if defined(__CUDACC__)
+void NormalizeNormalsCUDA
+#else
+void NormalizeNormalsCPU
+#endif
+        (core::Tensor& normals) {
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(normals.GetDtype(), [&]() {
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                normals.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    NormalizeNormal(normals_ptr + 3 * workload_idx);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void GroupEqualRowsCUDA
+#else
+void GroupEqualRowsCPU
+#endif
+        (const core::Tensor& keys,
+         core::Tensor& group_ids,
+         core::Tensor& first_rows) {
+    core::Device device = keys.GetDevice();
+    int64_t n = keys.GetLength();
+    group_ids = core::Tensor({n}, core::Dtype::Int64, device);
+    if (n == 0) {
+        first_rows = core::Tensor({0}, core::Dtype::Int64, device);
+        return;
+    }
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // Sort the rows, ties broken by row index so that the first row of each
+    // run of equal keys is the first row of the group.
+    core::Tensor order = core::Tensor::Arange(0, n, 1, core::Dtype::Int64,
+                                              device);
+    int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    core::Tensor is_run_start({n}, core::Dtype::Bool, device);
+    bool* is_run_start_ptr = is_run_start.GetDataPtr<bool>();
+    DISPATCH_DTYPE_TO_TEMPLATE(keys.GetDtype(), [&]() {
+        const scalar_t* keys_ptr = keys.GetDataPtr<scalar_t>();
+        auto less = [keys_ptr] OPEN3D_HOST_DEVICE(int64_t a, int64_t b) {
+            int c = CompareRows(keys_ptr + 3 * a, keys_ptr + 3 * b);
+            return c < 0 || (c == 0 && a < b);
+        };
+#if defined(__CUDACC__)
+        thrust::sort(thrust::device, order_ptr, order_ptr + n, less);
+#else
+        tbb::parallel_sort(order_ptr, order_ptr + n, less);
+#endif
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            is_run_start_ptr[workload_idx] =
+                    workload_idx == 0 ||
+                    CompareRows(keys_ptr + 3 * order_ptr[workload_idx - 1],
+                                keys_ptr + 3 * order_ptr[workload_idx]) != 0;
+        });
+    });
+
+    core::Tensor run_starts = is_run_start.NonZero()[0];
+    int64_t num_groups = run_starts.GetLength();
+    const int64_t* run_starts_ptr = run_starts.GetDataPtr<int64_t>();
+
+    // Number the groups in the order of their first rows.
+    core::Tensor is_first = core::Tensor::Zeros({n}, core::Dtype::Bool, device);
+    bool* is_first_ptr = is_first.GetDataPtr<bool>();
+    launcher.LaunchGeneralKernel(
+            num_groups, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                is_first_ptr[order_ptr[run_starts_ptr[workload_idx]]] = true;
+            });
+    first_rows = is_first.NonZero()[0];
+    const int64_t* first_rows_ptr = first_rows.GetDataPtr<int64_t>();
+
+    core::Tensor ranks({n}, core::Dtype::Int64, device);
+    int64_t* ranks_ptr = ranks.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_groups, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                ranks_ptr[first_rows_ptr[workload_idx]] = workload_idx;
+            });
+
+    int64_t* group_ids_ptr = group_ids.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(num_groups, [=] OPEN3D_DEVICE(
+                                                     int64_t workload_idx) {
+        int64_t begin = run_starts_ptr[workload_idx];
+        int64_t end = workload_idx + 1 < num_groups
+                              ? run_starts_ptr[workload_idx + 1]
+                              : n;
+        int64_t group_id = ranks_ptr[order_ptr[begin]];
+        for (int64_t k = begin; k < end; ++k) {
+            group_ids_ptr[order_ptr[k]] = group_id;
+        }
+    });
+}
+
+#if defined(__CUDACC__)
+void AverageGroupsCUDA
+#else
+void AverageGroupsCPU
+#endif
+        (const core::Tensor& values,
+         const core::Tensor& group_ids,
+         int64_t num_groups,
+         core::Tensor& averages) {
+    SumByIndex(values, group_ids, /*repeat=*/1, num_groups, /*average=*/true,
+               averages);
+}
+
+#if defined(__CUDACC__)
+void ClusterTrianglesCUDA
+#else
+void ClusterTrianglesCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& vertex_map,
+         core::Tensor& clustered) {
+    core::Device device = triangles.GetDevice();
+    int64_t num_triangles = triangles.GetLength();
+    core::Tensor remapped({num_triangles, 3}, core::Dtype::Int64, device);
+    core::Tensor is_valid({num_triangles}, core::Dtype::Bool, device);
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* vertex_map_ptr = vertex_map.GetDataPtr<int64_t>();
+    int64_t* remapped_ptr = remapped.GetDataPtr<int64_t>();
+    bool* is_valid_ptr = is_valid.GetDataPtr<bool>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(num_triangles, [=] OPEN3D_DEVICE(
+                                                        int64_t workload_idx) {
+        const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+        int64_t v0 = vertex_map_ptr[triangle[0]];
+        int64_t v1 = vertex_map_ptr[triangle[1]];
+        int64_t v2 = vertex_map_ptr[triangle[2]];
+        is_valid_ptr[workload_idx] = v0 != v1 && v0 != v2 && v1 != v2;
+
+        // Rotate the smallest index first, like the legacy mesh.
+        int64_t* dst = remapped_ptr + 3 * workload_idx;
+        if (v1 < v0 && v1 < v2) {
+            dst[0] = v1;
+            dst[1] = v2;
+            dst[2] = v0;
+        } else if (v2 < v0 && v2 < v1) {
+            dst[0] = v2;
+            dst[1] = v0;
+            dst[2] = v1;
+        } else {
+            dst[0] = v0;
+            dst[1] = v1;
+            dst[2] = v2;
+        }
+    });
+
+    clustered = remapped.IndexGet({is_valid});
+}
+
+#if defined(__CUDACC__)
+void SamplePointsUniformlyCUDA
+#else
+void SamplePointsUniformlyCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         int64_t number_of_points,
+         uint64_t seed,
+         core::Tensor& triangle_ids,
+         core::Tensor& weights) {
+    core::Device device = vertices.GetDevice();
+    int64_t num_triangles = triangles.GetLength();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // The cumulative areas are accumulated in Float64 for both dtypes.
+    core::Tensor areas({num_triangles}, core::Dtype::Float64, device);
+    double* areas_ptr = areas.GetDataPtr<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                    const scalar_t* v0 = vertices_ptr + 3 * triangle[0];
+                    const scalar_t* v1 = vertices_ptr + 3 * triangle[1];
+                    const scalar_t* v2 = vertices_ptr + 3 * triangle[2];
+                    double e1[3], e2[3];
+                    for (int i = 0; i < 3; ++i) {
+                        e1[i] = double(v1[i]) - double(v0[i]);
+                        e2[i] = double(v2[i]) - double(v0[i]);
+                    }
+                    double n0 = e1[1] * e2[2] - e1[2] * e2[1];
+                    double n1 = e1[2] * e2[0] - e1[0] * e2[2];
+                    double n2 = e1[0] * e2[1] - e1[1] * e2[0];
+                    areas_ptr[workload_idx] =
+                            0.5 * sqrt(n0 * n0 + n1 * n1 + n2 * n2);
+                });
+    });
+
+    core::Tensor cdf({num_triangles}, core::Dtype::Float64, device);
+    double* cdf_ptr = cdf.GetDataPtr<double>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::device, areas_ptr,
+                           areas_ptr + num_triangles, cdf_ptr);
+#else
+    utility::InclusivePrefixSum(areas_ptr, areas_ptr + num_triangles,
+                                cdf_ptr);
+#endif
+    double surface_area = cdf[num_triangles - 1].Item<double>();
+    if (!(surface_area > 0)) {
+        utility::LogError(
+                "[SamplePointsUniformly] The mesh has no surface area to "
+                "sample.");
+    }
+
+    // The samples [counts[i - 1], counts[i]) lie on triangle i.
+    core::Tensor counts({num_triangles}, core::Dtype::Int64, device);
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(num_triangles, [=] OPEN3D_DEVICE(
+                                                        int64_t workload_idx) {
+        double count = floor(cdf_ptr[workload_idx] / surface_area *
+                                     double(number_of_points) +
+                             0.5);
+        counts_ptr[workload_idx] =
+                workload_idx == num_triangles - 1
+                        ? number_of_points
+                        : int64_t(count < double(number_of_points)
+                                          ? count
+                                          : double(number_of_points));
+    });
+
+    triangle_ids = core::Tensor({number_of_points}, core::Dtype::Int64, device);
+    weights = core::Tensor({number_of_points, 3}, vertices.GetDtype(), device);
+    int64_t* triangle_ids_ptr = triangle_ids.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        scalar_t* weights_ptr = weights.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                number_of_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    triangle_ids_ptr[workload_idx] = BinarySearch(
+                            counts_ptr, num_triangles, workload_idx,
+                            /*or_equal=*/false);
+                    double r1 = SplitMix64Uniform(seed, 2 * workload_idx);
+                    double r2 = SplitMix64Uniform(seed, 2 * workload_idx + 1);
+                    double sqrt_r1 = sqrt(r1);
+                    scalar_t* w = weights_ptr + 3 * workload_idx;
+                    w[0] = scalar_t(1 - sqrt_r1);
+                    w[1] = scalar_t(sqrt_r1 * (1 - r2));
+                    w[2] = scalar_t(sqrt_r1 * r2);
+                });
+    });
+}
+
+/// Weight of a neighbour at squared distance \p dist2 in sample elimination,
+/// with the constant alpha = 8 of the paper, like in the legacy mesh.
+OPEN3D_HOST_DEVICE static inline double EliminationWeight(double dist2,
+                                                          double r_max,
+                                                          double r_min) {
+    double d = sqrt(dist2);
+    if (d < r_min) {
+        d = r_min;
+    }
+    double w = 1 - d / r_max;
+    w *= w;
+    w *= w;
+    return w * w;
+}
+
+/// Calls f(t, dist2) for the samples t != s within sqrt(r_max2) of sample s.
+/// The samples are sorted by the keys of their grid cells, so the samples of
+/// each of the 3x3x3 cells around the one of s are found by binary search.
+template <typename scalar_t, typename func_t>
+OPEN3D_HOST_DEVICE static inline void ForEachNeighborSample(
+        const scalar_t* points,
+        const int64_t* cells,
+        const int64_t* keys,
+        int64_t n,
+        int64_t dims0,
+        int64_t dims1,
+        int64_t dims2,
+        double r_max2,
+        int64_t s,
+        func_t f) {
+    const scalar_t* p = points + 3 * s;
+    const int64_t* cell = cells + 3 * s;
+    for (int64_t x = cell[0] - 1; x <= cell[0] + 1; ++x) {
+        for (int64_t y = cell[1] - 1; y <= cell[1] + 1; ++y) {
+            for (int64_t z = cell[2] - 1; z <= cell[2] + 1; ++z) {
+                if (x < 0 || y < 0 || z < 0 || x >= dims0 || y >= dims1 ||
+                    z >= dims2) {
+                    continue;
+                }
+                int64_t key = (x * dims1 + y) * dims2 + z;
+                int64_t end = BinarySearch(keys, n, key, /*or_equal=*/false);
+                for (int64_t t = BinarySearch(keys, n, key, /*or_equal=*/true);
+                     t < end; ++t) {
+                    const scalar_t* q = points + 3 * t;
+                    double dist2 = 0;
+                    for (int i = 0; i < 3; ++i) {
+                        double d = double(q[i]) - double(p[i]);
+                        dist2 += d * d;
+                    }
+                    if (t != s && dist2 <= r_max2) {
+                        f(t, dist2);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#if defined(__CUDACC__)
+void EliminateSamplesCUDA
+#else
+void EliminateSamplesCPU
+#endif
+        (const core::Tensor& points,
+         double r_max,
+         double r_min,
+         int64_t number_of_points,
+         core::Tensor& kept) {
+    core::Device device = points.GetDevice();
+    core::Device host("CPU:0");
+    int64_t n = points.GetLength();
+    double r_max2 = r_max * r_max;
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // Grid of cells of size r_max over the bounding box of the samples.
+    core::Tensor min_bound = points.Min({0}).To(host, core::Dtype::Float64);
+    core::Tensor max_bound = points.Max({0}).To(host, core::Dtype::Float64);
+    const double* min_bound_ptr = min_bound.GetDataPtr<double>();
+    const double* max_bound_ptr = max_bound.GetDataPtr<double>();
+    double min0 = min_bound_ptr[0], min1 = min_bound_ptr[1],
+           min2 = min_bound_ptr[2];
+    int64_t dims[3];
+    double num_cells = 1;
+    for (int i = 0; i < 3; ++i) {
+        double extent = (max_bound_ptr[i] - min_bound_ptr[i]) / r_max;
+        num_cells *= floor(extent) + 1;
+        dims[i] = int64_t(extent) + 1;
+    }
+    if (!(num_cells < 4e18)) {
+        utility::LogError(
+                "[EliminateSamples] r_max is too small for the extent of the "
+                "samples.");
+    }
+    int64_t dims0 = dims[0], dims1 = dims[1], dims2 = dims[2];
+
+    core::Tensor cells({n, 3}, core::Dtype::Int64, device);
+    core::Tensor keys({n}, core::Dtype::Int64, device);
+    core::Tensor order =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device);
+    core::Tensor sorted_points({n, 3}, points.GetDtype(), device);
+    core::Tensor sorted_cells({n, 3}, core::Dtype::Int64, device);
+    core::Tensor sorted_keys({n}, core::Dtype::Int64, device);
+    core::Tensor weights({n}, core::Dtype::Float64, device);
+    core::Tensor alive = core::Tensor::Ones({n}, core::Dtype::Bool, device);
+    core::Tensor is_max({n}, core::Dtype::Bool, device);
+    int64_t* cells_ptr = cells.GetDataPtr<int64_t>();
+    int64_t* keys_ptr = keys.GetDataPtr<int64_t>();
+    int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    int64_t* sorted_cells_ptr = sorted_cells.GetDataPtr<int64_t>();
+    int64_t* sorted_keys_ptr = sorted_keys.GetDataPtr<int64_t>();
+    double* weights_ptr = weights.GetDataPtr<double>();
+    bool* alive_ptr = alive.GetDataPtr<bool>();
+    bool* is_max_ptr = is_max.GetDataPtr<bool>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* sorted_points_ptr = sorted_points.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            const scalar_t* p = points_ptr + 3 * workload_idx;
+            int64_t* cell = cells_ptr + 3 * workload_idx;
+            cell[0] = int64_t(floor((double(p[0]) - min0) / r_max));
+            cell[1] = int64_t(floor((double(p[1]) - min1) / r_max));
+            cell[2] = int64_t(floor((double(p[2]) - min2) / r_max));
+            cell[0] = cell[0] < dims0 ? cell[0] : dims0 - 1;
+            cell[1] = cell[1] < dims1 ? cell[1] : dims1 - 1;
+            cell[2] = cell[2] < dims2 ? cell[2] : dims2 - 1;
+            keys_ptr[workload_idx] = (cell[0] * dims1 + cell[1]) * dims2 +
+                                     cell[2];
+        });
+
+        auto key_less = [keys_ptr] OPEN3D_HOST_DEVICE(int64_t a, int64_t b) {
+            return keys_ptr[a] < keys_ptr[b] ||
+                   (keys_ptr[a] == keys_ptr[b] && a < b);
+        };
+#if defined(__CUDACC__)
+        thrust::sort(thrust::device, order_ptr, order_ptr + n, key_less);
+#else
+        tbb::parallel_sort(order_ptr, order_ptr + n, key_less);
+#endif
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t i = order_ptr[workload_idx];
+                    sorted_keys_ptr[workload_idx] = keys_ptr[i];
+                    for (int k = 0; k < 3; ++k) {
+                        sorted_points_ptr[3 * workload_idx + k] =
+                                points_ptr[3 * i + k];
+                        sorted_cells_ptr[3 * workload_idx + k] =
+                                cells_ptr[3 * i + k];
+                    }
+                });
+
+        // From here on, samples are identified by their sorted index.
+        int64_t num_alive = n;
+        while (num_alive > number_of_points) {
+            launcher.LaunchGeneralKernel(
+                    n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        if (!alive_ptr[workload_idx]) {
+                            return;
+                        }
+                        double weight = 0;
+                        ForEachNeighborSample(
+                                sorted_points_ptr, sorted_cells_ptr,
+                                sorted_keys_ptr, n, dims0, dims1, dims2,
+                                r_max2, workload_idx,
+                                [&](int64_t t, double dist2) {
+                                    if (alive_ptr[t]) {
+                                        weight += EliminationWeight(
+                                                dist2, r_max, r_min);
+                                    }
+                                });
+                        weights_ptr[workload_idx] = weight;
+                    });
+
+            // Ties are broken by index, so that neighbours are never both
+            // local maxima.
+            launcher.LaunchGeneralKernel(
+                    n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        bool is_local_max = alive_ptr[workload_idx];
+                        if (is_local_max) {
+                            double weight = weights_ptr[workload_idx];
+                            ForEachNeighborSample(
+                                    sorted_points_ptr, sorted_cells_ptr,
+                                    sorted_keys_ptr, n, dims0, dims1, dims2,
+                                    r_max2, workload_idx,
+                                    [&](int64_t t, double) {
+                                        if (alive_ptr[t] &&
+                                            (weights_ptr[t] > weight ||
+                                             (weights_ptr[t] == weight &&
+                                              t > workload_idx))) {
+                                            is_local_max = false;
+                                        }
+                                    });
+                        }
+                        is_max_ptr[workload_idx] = is_local_max;
+                    });
+
+            core::Tensor candidates = is_max.NonZero()[0].Contiguous();
+            int64_t num_candidates = candidates.GetLength();
+            int64_t* candidates_ptr = candidates.GetDataPtr<int64_t>();
+            int64_t num_eliminated = num_alive - number_of_points;
+            if (num_eliminated < num_candidates) {
+                auto heavier = [weights_ptr] OPEN3D_HOST_DEVICE(int64_t a,
+                                                                int64_t b) {
+                    return weights_ptr[a] > weights_ptr[b] ||
+                           (weights_ptr[a] == weights_ptr[b] && a > b);
+                };
+#if defined(__CUDACC__)
+                thrust::sort(thrust::device, candidates_ptr,
+                             candidates_ptr + num_candidates, heavier);
+#else
+                tbb::parallel_sort(candidates_ptr,
+                                   candidates_ptr + num_candidates, heavier);
+#endif
+            } else {
+                num_eliminated = num_candidates;
+            }
+            launcher.LaunchGeneralKernel(
+                    num_eliminated, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        alive_ptr[candidates_ptr[workload_idx]] = false;
+                    });
+            num_alive -= num_eliminated;
+        }
+    });
+
+    kept = order.IndexGet({alive.NonZero()[0]});
+    int64_t* kept_ptr = kept.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::sort(thrust::device, kept_ptr, kept_ptr + kept.GetLength());
+#else
+    tbb::parallel_sort(kept_ptr, kept_ptr + kept.GetLength());
+#endif
+}
+
+/// Maximum depth of the BVH traversal stack. The median split keeps the
+/// tree balanced, so this is only reached by more than 2^60 triangles.
+static constexpr int kBVHStackSize = 64;
+
+#if defined(__CUDACC__)
+void ComputePointToMeshDistanceCUDA
+#else
+void ComputePointToMeshDistanceCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         const core::Tensor& node_bounds,
+         const core::Tensor& node_data,
+         const core::Tensor& triangle_order,
+         const core::Tensor& query_points,
+         core::Tensor& distances,
+         core::Tensor& closest_triangles) {
+    core::Device device = vertices.GetDevice();
+    int64_t num_queries = query_points.GetLength();
+    distances = core::Tensor({num_queries}, vertices.GetDtype(), device);
+    closest_triangles = core::Tensor({num_queries}, core::Dtype::Int64, device);
+    if (num_queries == 0) {
+        return;
+    }
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const double* bounds_ptr = node_bounds.GetDataPtr<double>();
+    const int64_t* data_ptr = node_data.GetDataPtr<int64_t>();
+    const int64_t* order_ptr = triangle_order.GetDataPtr<int64_t>();
+    int64_t* closest_ptr = closest_triangles.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        const scalar_t* queries_ptr = query_points.GetDataPtr<scalar_t>();
+        scalar_t* distances_ptr = distances.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                num_queries, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t* p = queries_ptr + 3 * workload_idx;
+                    scalar_t best_dist2 = 0;
+                    int64_t best_triangle = -1;
+                    int64_t stack[kBVHStackSize];
+                    int stack_size = 0;
+                    stack[stack_size++] = 0;
+                    while (stack_size > 0) {
+                        int64_t node = stack[--stack_size];
+                        if (best_triangle >= 0 &&
+                            PointBoxDistance2(p, bounds_ptr + 6 * node) >=
+                                    double(best_dist2)) {
+                            continue;
+                        }
+                        const int64_t* data = data_ptr + 2 * node;
+                        if (data[1] > 0) {
+                            for (int64_t k = data[0]; k < data[0] + data[1];
+                                 ++k) {
+                                const int64_t* triangle =
+                                        triangles_ptr + 3 * order_ptr[k];
+                                scalar_t dist2 = PointTriangleDistance2(
+                                        p, vertices_ptr + 3 * triangle[0],
+                                        vertices_ptr + 3 * triangle[1],
+                                        vertices_ptr + 3 * triangle[2]);
+                                if (best_triangle < 0 || dist2 < best_dist2) {
+                                    best_dist2 = dist2;
+                                    best_triangle = order_ptr[k];
+                                }
+                            }
+                            continue;
+                        }
+                        // The nearer child is pushed last, so that it is
+                        // visited first and tightens the bound for the other.
+                        int64_t left = node + 1;
+                        int64_t right = data[0];
+                        if (PointBoxDistance2(p, bounds_ptr + 6 * left) <
+                            PointBoxDistance2(p, bounds_ptr + 6 * right)) {
+                            int64_t tmp = left;
+                            left = right;
+                            right = tmp;
+                        }
+                        if (stack_size + 2 <= kBVHStackSize) {
+                            stack[stack_size++] = left;
+                            stack[stack_size++] = right;
+                        }
+                    }
+                    distances_ptr[workload_idx] = sqrt(best_dist2);
+                    closest_ptr[workload_idx] = best_triangle;
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ClusterConnectedTrianglesCUDA
+#else
+void ClusterConnectedTrianglesCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& cluster_ids,
+         core::Tensor& num_triangles,
+         core::Tensor& areas) {
+    core::Device device = vertices.GetDevice();
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t num_tris = triangles.GetLength();
+    cluster_ids = core::Tensor({num_tris}, core::Dtype::Int64, device);
+    if (num_tris == 0) {
+        num_triangles = core::Tensor({0}, core::Dtype::Int64, device);
+        areas = core::Tensor({0}, vertices.GetDtype(), device);
+        return;
+    }
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // Half-edge 3 * t + k goes from corner k to corner (k + 1) % 3 of
+    // triangle t, and is keyed by its undirected edge.
+    const int64_t num_half_edges = 3 * num_tris;
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    core::Tensor edge_keys({num_half_edges}, core::Dtype::Int64, device);
+    int64_t* edge_keys_ptr = edge_keys.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_half_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t corner = workload_idx % 3;
+                int64_t next = corner == 2 ? -2 : 1;
+                int64_t a = triangles_ptr[workload_idx];
+                int64_t b = triangles_ptr[workload_idx + next];
+                edge_keys_ptr[workload_idx] = a < b ? a * num_vertices + b
+                                                    : b * num_vertices + a;
+            });
+    core::Tensor sorted_keys;
+    core::Tensor order = ArgSortIndices(edge_keys, sorted_keys);
+    const int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    const int64_t* sorted_ptr = sorted_keys.GetDataPtr<int64_t>();
+
+    // Consecutive half-edges of the same edge join their triangles.
+#if defined(__CUDACC__)
+    core::Tensor parents_tensor =
+            core::Tensor::Arange(0, num_tris, 1, core::Dtype::Int32, device);
+    DisjointSetParent* parents = parents_tensor.GetDataPtr<int>();
+#else
+    std::vector<DisjointSetParent> parents_vector(num_tris);
+    DisjointSetParent* parents = parents_vector.data();
+    launcher.LaunchGeneralKernel(num_tris, [=](int64_t workload_idx) {
+        StoreParent(parents, int(workload_idx), int(workload_idx));
+    });
+#endif
+    launcher.LaunchGeneralKernel(
+            num_half_edges - 1, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                if (sorted_ptr[workload_idx] == sorted_ptr[workload_idx + 1]) {
+                    UnionSets(parents, int(order_ptr[workload_idx] / 3),
+                              int(order_ptr[workload_idx + 1] / 3));
+                }
+            });
+
+    core::Tensor roots({num_tris}, core::Dtype::Int32, device);
+    int* roots_ptr = roots.GetDataPtr<int>();
+    launcher.LaunchGeneralKernel(num_tris, [=] OPEN3D_DEVICE(
+                                                   int64_t workload_idx) {
+        roots_ptr[workload_idx] = FindRoot(parents, int(workload_idx));
+    });
+
+    // The root of a cluster is its first triangle, so numbering the roots in
+    // order gives the cluster indices of a breadth-first search.
+    core::Tensor root_indices =
+            roots.Eq(core::Tensor::Arange(0, num_tris, 1, core::Dtype::Int32,
+                                          device))
+                    .NonZero()[0];
+    const int64_t num_clusters = root_indices.GetLength();
+    core::Tensor root_labels({num_tris}, core::Dtype::Int64, device);
+    root_labels.IndexSet({root_indices},
+                         core::Tensor::Arange(0, num_clusters, 1,
+                                              core::Dtype::Int64, device));
+    const int64_t* root_labels_ptr = root_labels.GetDataPtr<int64_t>();
+    int64_t* cluster_ids_ptr = cluster_ids.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(num_tris, [=] OPEN3D_DEVICE(
+                                                   int64_t workload_idx) {
+        cluster_ids_ptr[workload_idx] =
+                root_labels_ptr[roots_ptr[workload_idx]];
+    });
+
+    // Both statistics come from one sort of the triangles by cluster, and
+    // the areas add up in the order of the triangles.
+    core::Tensor sorted_ids;
+    core::Tensor cluster_order = ArgSortIndices(cluster_ids, sorted_ids);
+    const int64_t* cluster_order_ptr = cluster_order.GetDataPtr<int64_t>();
+    const int64_t* sorted_ids_ptr = sorted_ids.GetDataPtr<int64_t>();
+    num_triangles = core::Tensor({num_clusters}, core::Dtype::Int64, device);
+    areas = core::Tensor({num_clusters}, vertices.GetDtype(), device);
+    int64_t* num_triangles_ptr = num_triangles.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        scalar_t* areas_ptr = areas.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                num_clusters, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t begin =
+                            BinarySearch(sorted_ids_ptr, num_tris,
+                                         workload_idx, /*or_equal=*/true);
+                    int64_t end =
+                            BinarySearch(sorted_ids_ptr, num_tris,
+                                         workload_idx, /*or_equal=*/false);
+                    double area = 0;
+                    for (int64_t k = begin; k < end; ++k) {
+                        const int64_t* triangle =
+                                triangles_ptr + 3 * cluster_order_ptr[k];
+                        const scalar_t* v0 = vertices_ptr + 3 * triangle[0];
+                        const scalar_t* v1 = vertices_ptr + 3 * triangle[1];
+                        const scalar_t* v2 = vertices_ptr + 3 * triangle[2];
+                        double e1[3], e2[3];
+                        for (int i = 0; i < 3; ++i) {
+                            e1[i] = double(v1[i]) - double(v0[i]);
+                            e2[i] = double(v2[i]) - double(v0[i]);
+                        }
+                        double n0 = e1[1] * e2[2] - e1[2] * e2[1];
+                        double n1 = e1[2] * e2[0] - e1[0] * e2[2];
+                        double n2 = e1[0] * e2[1] - e1[1] * e2[0];
+                        area += 0.5 * sqrt(n0 * n0 + n1 * n1 + n2 * n2);
+                    }
+                    num_triangles_ptr[workload_idx] = end - begin;
+                    areas_ptr[workload_idx] = scalar_t(area);
+                });
+    });
+}
+
+/// Returns the Int64 positions in \p sorted_keys at which a run of equal keys
+/// starts.
+static core::Tensor FirstOfRuns(const core::Tensor& sorted_keys) {
+    const int64_t n = sorted_keys.GetLength();
+    core::Tensor is_first({n}, core::Dtype::Bool, sorted_keys.GetDevice());
+    const int64_t* sorted_ptr = sorted_keys.GetDataPtr<int64_t>();
+    bool* is_first_ptr = is_first.GetDataPtr<bool>();
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        is_first_ptr[workload_idx] =
+                workload_idx == 0 ||
+                sorted_ptr[workload_idx] != sorted_ptr[workload_idx - 1];
+    });
+    return is_first.NonZero()[0];
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexAdjacencyCUDA
+#else
+void ComputeVertexAdjacencyCPU
+#endif
+        (const core::Tensor& triangles,
+         int64_t num_vertices,
+         core::Tensor& offsets,
+         core::Tensor& neighbors) {
+    core::Device device = triangles.GetDevice();
+    const int64_t num_tris = triangles.GetLength();
+    if (num_tris == 0) {
+        offsets = core::Tensor::Zeros({num_vertices + 1}, core::Dtype::Int64,
+                                      device);
+        neighbors = core::Tensor({0}, core::Dtype::Int64, device);
+        return;
+    }
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // Each corner is paired with the two other corners of its triangle, and
+    // the pairs are keyed by the corner first.
+    const int64_t num_pairs = 6 * num_tris;
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    core::Tensor pair_keys({num_pairs}, core::Dtype::Int64, device);
+    int64_t* pair_keys_ptr = pair_keys.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_pairs, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t* triangle =
+                        triangles_ptr + 3 * (workload_idx / 6);
+                int64_t corner = (workload_idx % 6) / 2;
+                int64_t other = (corner + 1 + workload_idx % 2) % 3;
+                pair_keys_ptr[workload_idx] =
+                        triangle[corner] * num_vertices + triangle[other];
+            });
+    core::Tensor sorted_keys;
+    ArgSortIndices(pair_keys, sorted_keys);
+
+    core::Tensor unique_keys = sorted_keys.IndexGet({FirstOfRuns(sorted_keys)});
+    const int64_t num_unique = unique_keys.GetLength();
+    const int64_t* unique_ptr = unique_keys.GetDataPtr<int64_t>();
+
+    offsets = core::Tensor({num_vertices + 1}, core::Dtype::Int64, device);
+    neighbors = core::Tensor({num_unique}, core::Dtype::Int64, device);
+    int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_vertices + 1, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                offsets_ptr[workload_idx] =
+                        BinarySearch(unique_ptr, num_unique,
+                                     workload_idx * num_vertices,
+                                     /*or_equal=*/true);
+            });
+    launcher.LaunchGeneralKernel(
+            num_unique, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                neighbors_ptr[workload_idx] =
+                        unique_ptr[workload_idx] % num_vertices;
+            });
+}
+
+#if defined(__CUDACC__)
+void FilterVertexAttributeCUDA
+#else
+void FilterVertexAttributeCPU
+#endif
+        (const core::Tensor& values,
+         const core::Tensor& positions,
+         const core::Tensor& offsets,
+         const core::Tensor& neighbors,
+         VertexFilterType type,
+         double strength,
+         core::Tensor& filtered) {
+    const int64_t num_vertices = values.GetLength();
+    const int64_t channels = values.NumElements() / std::max<int64_t>(
+                                                            num_vertices, 1);
+    filtered = core::Tensor(values.GetShape(), values.GetDtype(),
+                            values.GetDevice());
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        scalar_t* filtered_ptr = filtered.GetDataPtr<scalar_t>();
+        launcher.LaunchGeneralKernel(
+                num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t begin = offsets_ptr[workload_idx];
+                    const int64_t end = offsets_ptr[workload_idx + 1];
+                    const scalar_t* value =
+                            values_ptr + channels * workload_idx;
+                    scalar_t* out = filtered_ptr + channels * workload_idx;
+                    if (begin == end) {
+                        for (int64_t c = 0; c < channels; ++c) {
+                            out[c] = value[c];
+                        }
+                        return;
+                    }
+
+                    // The weighted sum of the neighbours is accumulated in
+                    // the output.
+                    const scalar_t* p = positions_ptr + 3 * workload_idx;
+                    double total_weight = 0;
+                    for (int64_t c = 0; c < channels; ++c) {
+                        out[c] = 0;
+                    }
+                    for (int64_t k = begin; k < end; ++k) {
+                        const int64_t nb = neighbors_ptr[k];
+                        double weight = 1;
+                        if (type == VertexFilterType::SmoothLaplacian) {
+                            const scalar_t* q = positions_ptr + 3 * nb;
+                            double dx = double(p[0]) - double(q[0]);
+                            double dy = double(p[1]) - double(q[1]);
+                            double dz = double(p[2]) - double(q[2]);
+                            weight = 1. / (sqrt(dx * dx + dy * dy + dz * dz) +
+                                           1e-12);
+                        }
+                        total_weight += weight;
+                        const scalar_t* nb_value = values_ptr + channels * nb;
+                        for (int64_t c = 0; c < channels; ++c) {
+                            out[c] += scalar_t(weight * double(nb_value[c]));
+                        }
+                    }
+
+                    const double num_nbs = double(end - begin);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        double v = value[c];
+                        double sum = out[c];
+                        if (type == VertexFilterType::Sharpen) {
+                            out[c] = scalar_t(v +
+                                              strength * (v * num_nbs - sum));
+                        } else if (type == VertexFilterType::SmoothSimple) {
+                            out[c] = scalar_t((v + sum) / (1 + num_nbs));
+                        } else {
+                            out[c] = scalar_t(
+                                    v + strength * (sum / total_weight - v));
+                        }
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SubdivideTrianglesCUDA
+#else
+void SubdivideTrianglesCPU
+#endif
+        (const core::Tensor& triangles,
+         int64_t num_vertices,
+         core::Tensor& vertex_ends,
+         core::Tensor& new_triangles) {
+    core::Device device = triangles.GetDevice();
+    const int64_t num_tris = triangles.GetLength();
+    new_triangles = core::Tensor({4 * num_tris, 3}, core::Dtype::Int64, device);
+    if (num_tris == 0) {
+        vertex_ends = core::Tensor::Arange(0, num_vertices, 1,
+                                           core::Dtype::Int64, device)
+                              .Reshape({num_vertices, 1})
+                              .Expand({num_vertices, 2})
+                              .Contiguous();
+        return;
+    }
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // Half-edge 3 * t + k goes from corner k to corner (k + 1) % 3 of
+    // triangle t, and is keyed by its undirected edge.
+    const int64_t num_half_edges = 3 * num_tris;
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    core::Tensor edge_keys({num_half_edges}, core::Dtype::Int64, device);
+    int64_t* edge_keys_ptr = edge_keys.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_half_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t corner = workload_idx % 3;
+                int64_t next = corner == 2 ? -2 : 1;
+                int64_t a = triangles_ptr[workload_idx];
+                int64_t b = triangles_ptr[workload_idx + next];
+                edge_keys_ptr[workload_idx] = a < b ? a * num_vertices + b
+                                                    : b * num_vertices + a;
+            });
+    core::Tensor sorted_keys;
+    core::Tensor order = ArgSortIndices(edge_keys, sorted_keys);
+    core::Tensor first_positions = FirstOfRuns(sorted_keys);
+    const int64_t num_edges = first_positions.GetLength();
+    // The sort is stable, so the first half-edge of each edge comes first.
+    core::Tensor unique_keys = sorted_keys.IndexGet({first_positions});
+    core::Tensor first_half_edges = order.IndexGet({first_positions});
+    const int64_t* unique_ptr = unique_keys.GetDataPtr<int64_t>();
+    const int64_t* first_half_edges_ptr =
+            first_half_edges.GetDataPtr<int64_t>();
+
+    // The edges are numbered in the order of their first half-edges.
+    core::Tensor starts_edge =
+            core::Tensor::Zeros({num_half_edges}, core::Dtype::Bool, device);
+    bool* starts_edge_ptr = starts_edge.GetDataPtr<bool>();
+    launcher.LaunchGeneralKernel(
+            num_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                starts_edge_ptr[first_half_edges_ptr[workload_idx]] = true;
+            });
+    core::Tensor edge_starts = starts_edge.NonZero()[0];
+    const int64_t* edge_starts_ptr = edge_starts.GetDataPtr<int64_t>();
+    core::Tensor edge_numbers({num_edges}, core::Dtype::Int64, device);
+    int64_t* edge_numbers_ptr = edge_numbers.GetDataPtr<int64_t>();
+    vertex_ends = core::Tensor({num_vertices + num_edges, 2},
+                               core::Dtype::Int64, device);
+    int64_t* vertex_ends_ptr = vertex_ends.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                vertex_ends_ptr[2 * workload_idx] = workload_idx;
+                vertex_ends_ptr[2 * workload_idx + 1] = workload_idx;
+            });
+    launcher.LaunchGeneralKernel(
+            num_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t number = BinarySearch(
+                        edge_starts_ptr, num_edges,
+                        first_half_edges_ptr[workload_idx], /*or_equal=*/true);
+                edge_numbers_ptr[workload_idx] = number;
+                int64_t* ends = vertex_ends_ptr + 2 * (num_vertices + number);
+                ends[0] = unique_ptr[workload_idx] / num_vertices;
+                ends[1] = unique_ptr[workload_idx] % num_vertices;
+            });
+
+    int64_t* new_triangles_ptr = new_triangles.GetDataPtr<int64_t>();
+    launcher.LaunchGeneralKernel(
+            num_tris, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                int64_t mid[3];
+                for (int k = 0; k < 3; ++k) {
+                    int64_t edge = BinarySearch(
+                            unique_ptr, num_edges,
+                            edge_keys_ptr[3 * workload_idx + k],
+                            /*or_equal=*/true);
+                    mid[k] = num_vertices + edge_numbers_ptr[edge];
+                }
+                int64_t* out = new_triangles_ptr + 12 * workload_idx;
+                out[0] = triangle[0];
+                out[1] = mid[0];
+                out[2] = mid[2];
+                out[3] = mid[0];
+                out[4] = triangle[1];
+                out[5] = mid[1];
+                out[6] = mid[1];
+                out[7] = triangle[2];
+                out[8] = mid[2];
+                out[9] = mid[0];
+                out[10] = mid[1];
+                out[11] = mid[2];
+            });
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,1333 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/ChunkedGeometryIO.h"
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// File layout (all values little-endian):
+//
+//   header     64 bytes: magic, version, geometry type, compression,
+//              number of LOD levels, offset and size of the index.
+//   blobs      one blob per chunk and attribute, each starting at a multiple
+//              of kChunkedAlignment bytes. A blob holds the rows of the
+//              attribute for the elements of the chunk, LZF compressed if its
+//              stored size is smaller than its raw size.
+//   index      attribute table followed by the chunk table.
+static const char kChunkedMagic[8] = {'O', '3', 'D', 'C', 'H', 'N', 'K', '\0'};
+static constexpr uint32_t kChunkedVersion = 1;
+static constexpr int64_t kChunkedHeaderSize = 64;
+static constexpr int64_t kChunkedAlignment = 64;
+/// Ratio between the number of points of two consecutive LOD levels.
+static constexpr int64_t kLODFactor = 4;
+/// Rows copied per parallel work item.
+static constexpr int64_t kChunkedGrainSize = 4096;
+
+enum class ChunkedGeometryType : uint32_t { PointCloud = 0, TriangleMesh = 1 };
+enum class ChunkedCompression : uint32_t { None = 0, LZF = 1 };
+/// Point cloud points and mesh vertices are elements; triangle attributes are
+/// indexed by the triangles of the chunk.
+enum class ChunkedAttributeGroup : uint32_t { Element = 0, Triangle = 1 };
+
+struct ChunkedAttribute {
+    ChunkedAttributeGroup group;
+    std::string name;
+    core::Dtype dtype;
+    /// Shape of one row, i.e. the tensor shape without its leading length.
+    core::SizeVector row_shape;
+    int64_t row_bytes;
+};
+
+struct ChunkedBlob {
+    uint64_t offset = 0;
+    uint64_t stored_size = 0;
+    uint64_t raw_size = 0;
+};
+
+struct ChunkedChunk {
+    ChunkInfo info;
+    std::vector<ChunkedBlob> blobs;
+};
+
+struct ChunkedIndex {
+    ChunkedGeometryType geometry_type;
+    ChunkedCompression compression;
+    uint32_t num_lods;
+    std::vector<ChunkedAttribute> attributes;
+    std::vector<ChunkedChunk> chunks;
+};
+
+static bool ChunkedDtypeToCode(const core::Dtype &dtype, uint32_t &code) {
+    const core::Dtype dtypes[] = {
+            core::Dtype::Float32, core::Dtype::Float64, core::Dtype::Int8,
+            core::Dtype::Int16,   core::Dtype::Int32,   core::Dtype::Int64,
+            core::Dtype::UInt8,   core::Dtype::UInt16,  core::Dtype::UInt32,
+            core::Dtype::UInt64,  core::Dtype::Bool};
+    for (uint32_t i = 0; i < sizeof(dtypes) / sizeof(dtypes[0]); i++) {
+        if (dtypes[i] == dtype) {
+            code = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static core::Dtype ChunkedDtypeFromCode(uint32_t code) {
+    const core::Dtype dtypes[] = {
+            core::Dtype::Float32, core::Dtype::Float64, core::Dtype::Int8,
+            core::Dtype::Int16,   core::Dtype::Int32,   core::Dtype::Int64,
+            core::Dtype::UInt8,   core::Dtype::UInt16,  core::Dtype::UInt32,
+            core::Dtype::UInt64,  core::Dtype::Bool};
+    if (code >= sizeof(dtypes) / sizeof(dtypes[0])) {
+        return core::Dtype::Undefined;
+    }
+    return dtypes[code];
+}
+
+static int Seek64(FILE *file, int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, SEEK_SET);
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+}
+
+template <typename T>
+static void AppendValue(std::vector<char> &buffer, const T &value) {
+    const char *bytes = reinterpret_cast<const char *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/// Bounds-checked reader of the serialized index.
+class ChunkedIndexReader {
+public:
+    ChunkedIndexReader(const std::vector<char> &buffer) : buffer_(buffer) {}
+
+    template <typename T>
+    bool Read(T &value) {
+        if (pos_ + sizeof(T) > buffer_.size()) {
+            return false;
+        }
+        std::memcpy(&value, buffer_.data() + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string &value, size_t length) {
+        if (pos_ + length > buffer_.size()) {
+            return false;
+        }
+        value.assign(buffer_.data() + pos_, length);
+        pos_ += length;
+        return true;
+    }
+
+private:
+    const std::vector<char> &buffer_;
+    size_t pos_ = 0;
+};
+
+static std::vector<char> SerializeIndex(const ChunkedIndex &index) {
+    std::vector<char> buffer;
+    AppendValue(buffer, uint32_t(index.attributes.size()));
+    for (const ChunkedAttribute &attribute : index.attributes) {
+        uint32_t dtype_code = 0;
+        ChunkedDtypeToCode(attribute.dtype, dtype_code);
+        AppendValue(buffer, uint32_t(attribute.group));
+        AppendValue(buffer, dtype_code);
+        AppendValue(buffer, uint32_t(attribute.row_shape.size()));
+        for (int64_t dim : attribute.row_shape) {
+            AppendValue(buffer, dim);
+        }
+        AppendValue(buffer, uint32_t(attribute.name.size()));
+        buffer.insert(buffer.end(), attribute.name.begin(),
+                      attribute.name.end());
+    }
+    AppendValue(buffer, uint64_t(index.chunks.size()));
+    for (const ChunkedChunk &chunk : index.chunks) {
+        AppendValue(buffer, int32_t(chunk.info.lod));
+        for (int i = 0; i < 3; i++) {
+            AppendValue(buffer, chunk.info.bbox.min_bound_(i));
+        }
+        for (int i = 0; i < 3; i++) {
+            AppendValue(buffer, chunk.info.bbox.max_bound_(i));
+        }
+        AppendValue(buffer, chunk.info.num_elements);
+        AppendValue(buffer, chunk.info.num_triangles);
+        for (const ChunkedBlob &blob : chunk.blobs) {
+            AppendValue(buffer, blob.offset);
+            AppendValue(buffer, blob.stored_size);
+            AppendValue(buffer, blob.raw_size);
+        }
+    }
+    return buffer;
+}
+
+static bool DeserializeIndex(const std::vector<char> &buffer,
+                             ChunkedIndex &index) {
+    ChunkedIndexReader reader(buffer);
+    uint32_t num_attributes;
+    if (!reader.Read(num_attributes)) {
+        return false;
+    }
+    index.attributes.resize(num_attributes);
+    for (ChunkedAttribute &attribute : index.attributes) {
+        uint32_t group, dtype_code, ndim, name_length;
+        if (!reader.Read(group) || !reader.Read(dtype_code) ||
+            !reader.Read(ndim) || ndim > 8) {
+            return false;
+        }
+        attribute.group = ChunkedAttributeGroup(group);
+        attribute.dtype = ChunkedDtypeFromCode(dtype_code);
+        if (attribute.dtype == core::Dtype::Undefined) {
+            return false;
+        }
+        attribute.row_shape.resize(ndim);
+        for (int64_t &dim : attribute.row_shape) {
+            if (!reader.Read(dim) || dim < 0) {
+                return false;
+            }
+        }
+        attribute.row_bytes = attribute.row_shape.NumElements() *
+                              attribute.dtype.ByteSize();
+        if (!reader.Read(name_length) ||
+            !reader.ReadString(attribute.name, name_length)) {
+            return false;
+        }
+    }
+    uint64_t num_chunks;
+    if (!reader.Read(num_chunks) || num_chunks > buffer.size()) {
+        return false;
+    }
+    index.chunks.resize(num_chunks);
+    for (ChunkedChunk &chunk : index.chunks) {
+        int32_t lod;
+        if (!reader.Read(lod)) {
+            return false;
+        }
+        chunk.info.lod = lod;
+        for (int i = 0; i < 3; i++) {
+            if (!reader.Read(chunk.info.bbox.min_bound_(i))) {
+                return false;
+            }
+        }
+        for (int i = 0; i < 3; i++) {
+            if (!reader.Read(chunk.info.bbox.max_bound_(i))) {
+                return false;
+            }
+        }
+        if (!reader.Read(chunk.info.num_elements) ||
+            !reader.Read(chunk.info.num_triangles)) {
+            return false;
+        }
+        chunk.blobs.resize(index.attributes.size());
+        for (size_t a = 0; a < chunk.blobs.size(); a++) {
+            ChunkedBlob &blob = chunk.blobs[a];
+            if (!reader.Read(blob.offset) || !reader.Read(blob.stored_size) ||
+                !reader.Read(blob.raw_size)) {
+                return false;
+            }
+            const int64_t num_rows =
+                    index.attributes[a].group == ChunkedAttributeGroup::Element
+                            ? chunk.info.num_elements
+                            : chunk.info.num_triangles;
+            if (blob.raw_size !=
+                uint64_t(num_rows * index.attributes[a].row_bytes)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool ReadChunkedIndex(const std::string &filename,
+                             ChunkedIndex &index) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning("Read O3DC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    char header[kChunkedHeaderSize];
+    uint32_t version, geometry_type, compression;
+    uint64_t index_offset, index_size;
+    if (fread(header, 1, kChunkedHeaderSize, file) != kChunkedHeaderSize ||
+        std::memcmp(header, kChunkedMagic, sizeof(kChunkedMagic)) != 0) {
+        utility::LogWarning("Read O3DC failed: {} is not an O3DC file.",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    std::memcpy(&version, header + 8, 4);
+    std::memcpy(&geometry_type, header + 12, 4);
+    std::memcpy(&compression, header + 16, 4);
+    std::memcpy(&index.num_lods, header + 20, 4);
+    std::memcpy(&index_offset, header + 24, 8);
+    std::memcpy(&index_size, header + 32, 8);
+    if (version != kChunkedVersion) {
+        utility::LogWarning("Read O3DC failed: unsupported version {:d}.",
+                            version);
+        fclose(file);
+        return false;
+    }
+    index.geometry_type = ChunkedGeometryType(geometry_type);
+    index.compression = ChunkedCompression(compression);
+
+    std::vector<char> buffer;
+    bool success = Seek64(file, int64_t(index_offset)) == 0;
+    if (success) {
+        buffer.resize(index_size);
+        success = fread(buffer.data(), 1, index_size, file) == index_size;
+    }
+    fclose(file);
+    if (!success || !DeserializeIndex(buffer, index)) {
+        utility::LogWarning("Read O3DC failed: corrupted index in {}.",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+/// Source rows of the elements and triangles of one chunk.
+struct ChunkPlan {
+    int lod = 0;
+    /// Rows of the element attributes. Sorted for meshes, so that triangle
+    /// vertex indices can be mapped to chunk-local indices by binary search.
+    std::vector<int64_t> elements;
+    /// Rows of the triangle attributes.
+    std::vector<int64_t> triangles;
+};
+
+struct ChunkedSource {
+    ChunkedAttribute attribute;
+    /// Contiguous CPU tensor. Mesh triangles are converted to Int64.
+    core::Tensor tensor;
+};
+
+static bool AddChunkedSource(const std::string &name,
+                             const core::Tensor &tensor,
+                             ChunkedAttributeGroup group,
+                             std::vector<ChunkedSource> &sources) {
+    ChunkedSource source;
+    source.tensor = tensor.To(core::Device("CPU:0")).Contiguous();
+    source.attribute.group = group;
+    source.attribute.name = name;
+    source.attribute.dtype = source.tensor.GetDtype();
+    const core::SizeVector &shape = source.tensor.GetShape();
+    source.attribute.row_shape =
+            core::SizeVector(shape.begin() + 1, shape.end());
+    source.attribute.row_bytes = source.attribute.row_shape.NumElements() *
+                                 source.attribute.dtype.ByteSize();
+    uint32_t dtype_code;
+    if (!ChunkedDtypeToCode(source.attribute.dtype, dtype_code)) {
+        utility::LogWarning("Write O3DC: skipping attribute {} of dtype {}.",
+                            name, source.attribute.dtype.ToString());
+        return false;
+    }
+    sources.push_back(source);
+    return true;
+}
+
+/// Computes the tile of every item from its position in a grid anchored at
+/// the minimum of \p positions. Returns false if the grid is too fine.
+static bool ComputeTileKeys(const core::Tensor &positions,
+                            const Eigen::Vector3d &min_bound,
+                            const Eigen::Vector3d &max_bound,
+                            const ChunkedGeometryWriteOption &option,
+                            std::vector<int64_t> &keys) {
+    const int64_t num_items = positions.GetLength();
+    const Eigen::Vector3d extent = max_bound - min_bound;
+    double tile_size = option.tile_size;
+    if (tile_size <= 0.0) {
+        // Spread the items over the non-degenerate axes of the bounding box.
+        const double num_tiles =
+                std::ceil(double(num_items) /
+                          double(std::max<int64_t>(option.points_per_tile, 1)));
+        double volume = 1.0;
+        int num_axes = 0;
+        for (int i = 0; i < 3; i++) {
+            if (extent(i) > 0.0) {
+                volume *= extent(i);
+                num_axes++;
+            }
+        }
+        tile_size = num_axes == 0 ? 1.0
+                                  : std::pow(volume / num_tiles,
+                                             1.0 / double(num_axes));
+    }
+    int64_t dims[3];
+    double num_cells = 1.0;
+    for (int i = 0; i < 3; i++) {
+        dims[i] = int64_t(std::floor(extent(i) / tile_size)) + 1;
+        num_cells *= double(dims[i]);
+    }
+    if (!(num_cells < double(std::numeric_limits<int64_t>::max() / 2))) {
+        utility::LogWarning("Write O3DC failed: tile size {} is too small.",
+                            tile_size);
+        return false;
+    }
+
+    const double *position_ptr = positions.GetDataPtr<double>();
+    keys.resize(num_items);
+    utility::ParallelFor(int64_t(0), num_items, [&](int64_t i) {
+        int64_t key = 0;
+        for (int j = 0; j < 3; j++) {
+            int64_t cell = int64_t(
+                    std::floor((position_ptr[i * 3 + j] - min_bound(j)) /
+                               tile_size));
+            cell = std::min(std::max<int64_t>(cell, 0), dims[j] - 1);
+            key = key * dims[j] + cell;
+        }
+        keys[i] = key;
+    }, kChunkedGrainSize);
+    return true;
+}
+
+/// Returns the items sorted by tile and the begin of every tile in it.
+static void GroupByTile(const std::vector<int64_t> &keys,
+                        std::vector<int64_t> &order,
+                        std::vector<int64_t> &tile_begins) {
+    order.resize(keys.size());
+    std::iota(order.begin(), order.end(), int64_t(0));
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int64_t a, int64_t b) { return keys[a] < keys[b]; });
+    tile_begins.clear();
+    for (size_t i = 0; i < order.size(); i++) {
+        if (i == 0 || keys[order[i]] != keys[order[i - 1]]) {
+            tile_begins.push_back(int64_t(i));
+        }
+    }
+    tile_begins.push_back(int64_t(order.size()));
+}
+
+/// Gathers (and compresses) the attribute rows of one chunk.
+static void EncodeChunk(const ChunkPlan &plan,
+                        const std::vector<ChunkedSource> &sources,
+                        const core::Tensor &positions,
+                        ChunkedCompression compression,
+                        ChunkedChunk &chunk,
+                        std::vector<std::vector<char>> &blobs) {
+    chunk.info.lod = plan.lod;
+    chunk.info.num_elements = int64_t(plan.elements.size());
+    chunk.info.num_triangles = int64_t(plan.triangles.size());
+    const double *position_ptr = positions.GetDataPtr<double>();
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound = -min_bound;
+    for (int64_t element : plan.elements) {
+        const Eigen::Vector3d p(position_ptr[element * 3],
+                                position_ptr[element * 3 + 1],
+                                position_ptr[element * 3 + 2]);
+        min_bound = min_bound.cwiseMin(p);
+        max_bound = max_bound.cwiseMax(p);
+    }
+    chunk.info.bbox = open3d::geometry::AxisAlignedBoundingBox(min_bound,
+                                                               max_bound);
+
+    chunk.blobs.resize(sources.size());
+    blobs.resize(sources.size());
+    std::vector<char> raw;
+    for (size_t a = 0; a < sources.size(); a++) {
+        const ChunkedAttribute &attribute = sources[a].attribute;
+        const std::vector<int64_t> &rows =
+                attribute.group == ChunkedAttributeGroup::Element
+                        ? plan.elements
+                        : plan.triangles;
+        const char *src_ptr =
+                static_cast<const char *>(sources[a].tensor.GetDataPtr());
+        raw.resize(rows.size() * attribute.row_bytes);
+        for (size_t i = 0; i < rows.size(); i++) {
+            std::memcpy(raw.data() + i * attribute.row_bytes,
+                        src_ptr + rows[i] * attribute.row_bytes,
+                        attribute.row_bytes);
+        }
+        if (attribute.group == ChunkedAttributeGroup::Triangle &&
+            attribute.name == "triangles") {
+            // Store chunk-local vertex indices.
+            int64_t *indices = reinterpret_cast<int64_t *>(raw.data());
+            for (size_t i = 0; i < rows.size() * 3; i++) {
+                indices[i] = std::lower_bound(plan.elements.begin(),
+                                              plan.elements.end(),
+                                              indices[i]) -
+                             plan.elements.begin();
+            }
+        }
+
+        ChunkedBlob &blob = chunk.blobs[a];
+        blob.raw_size = raw.size();
+        blob.stored_size = raw.size();
+        blobs[a].clear();
+        if (compression == ChunkedCompression::LZF && raw.size() > 1 &&
+            raw.size() <= std::numeric_limits<unsigned int>::max()) {
+            // Blobs that do not shrink are stored uncompressed.
+            blobs[a].resize(raw.size() - 1);
+            const unsigned int compressed_size = lzf_compress(
+                    raw.data(), (unsigned int)raw.size(), blobs[a].data(),
+                    (unsigned int)blobs[a].size());
+            if (compressed_size > 0) {
+                blobs[a].resize(compressed_size);
+                blob.stored_size = compressed_size;
+                continue;
+            }
+        }
+        blobs[a] = raw;
+    }
+}
+
+/// Writes the header, chunks and index of a chunked geometry file. Chunks can
+/// be appended by several calls to Write, which lets point clouds be written
+/// in a streaming fashion.
+class ChunkedFileWriter {
+public:
+    ~ChunkedFileWriter() {
+        if (file_ != nullptr) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename,
+              ChunkedGeometryType geometry_type,
+              int num_lods,
+              bool compressed) {
+        file_ = utility::filesystem::FOpen(filename, "wb");
+        if (file_ == nullptr) {
+            utility::LogWarning("Write O3DC failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        index_ = ChunkedIndex();
+        index_.geometry_type = geometry_type;
+        index_.compression = compressed ? ChunkedCompression::LZF
+                                        : ChunkedCompression::None;
+        index_.num_lods = uint32_t(num_lods);
+        has_attributes_ = false;
+        offset_ = 0;
+        success_ = true;
+        WriteAligned(nullptr, 0);
+        const char header[kChunkedHeaderSize] = {0};
+        WriteAligned(header, kChunkedHeaderSize);
+        return success_;
+    }
+
+    /// Encodes the chunks of \p plans in parallel in batches, to bound the
+    /// memory use, and appends them to the file. The attributes of \p sources
+    /// must match the ones of the first call.
+    bool Write(const std::vector<ChunkPlan> &plans,
+               const std::vector<ChunkedSource> &sources,
+               const core::Tensor &positions) {
+        if (!has_attributes_) {
+            for (const ChunkedSource &source : sources) {
+                index_.attributes.push_back(source.attribute);
+            }
+            has_attributes_ = true;
+        } else if (!HasSameAttributes(sources)) {
+            utility::LogWarning(
+                    "Write O3DC failed: the attributes of the chunk differ "
+                    "from the first chunk.");
+            return false;
+        }
+
+        const int64_t first_chunk = int64_t(index_.chunks.size());
+        index_.chunks.resize(first_chunk + plans.size());
+        const int64_t batch_size = utility::GetMaxParallelism() * 4;
+        std::vector<std::vector<std::vector<char>>> batch_blobs(batch_size);
+        for (int64_t batch_begin = 0;
+             success_ && batch_begin < int64_t(plans.size());
+             batch_begin += batch_size) {
+            const int64_t batch_end = std::min(batch_begin + batch_size,
+                                               int64_t(plans.size()));
+            utility::ParallelFor(batch_begin, batch_end, [&](int64_t c) {
+                EncodeChunk(plans[c], sources, positions, index_.compression,
+                            index_.chunks[first_chunk + c],
+                            batch_blobs[c - batch_begin]);
+            });
+            for (int64_t c = batch_begin; c < batch_end; c++) {
+                std::vector<std::vector<char>> &blobs =
+                        batch_blobs[c - batch_begin];
+                for (size_t a = 0; a < blobs.size(); a++) {
+                    index_.chunks[first_chunk + c].blobs[a].offset = uint64_t(
+                            WriteAligned(blobs[a].data(), blobs[a].size()));
+                }
+            }
+        }
+        return success_;
+    }
+
+    /// Writes the index, completes the header and closes the file.
+    bool Close() {
+        const std::vector<char> index_buffer = SerializeIndex(index_);
+        const uint64_t index_offset = uint64_t(
+                WriteAligned(index_buffer.data(), index_buffer.size()));
+        const uint64_t index_size = index_buffer.size();
+        char header[kChunkedHeaderSize] = {0};
+        const uint32_t version = kChunkedVersion;
+        const uint32_t type = uint32_t(index_.geometry_type);
+        const uint32_t compression = uint32_t(index_.compression);
+        std::memcpy(header, kChunkedMagic, sizeof(kChunkedMagic));
+        std::memcpy(header + 8, &version, 4);
+        std::memcpy(header + 12, &type, 4);
+        std::memcpy(header + 16, &compression, 4);
+        std::memcpy(header + 20, &index_.num_lods, 4);
+        std::memcpy(header + 24, &index_offset, 8);
+        std::memcpy(header + 32, &index_size, 8);
+        success_ = success_ && Seek64(file_, 0) == 0 &&
+                   fwrite(header, 1, kChunkedHeaderSize, file_) ==
+                           size_t(kChunkedHeaderSize);
+        success_ = fclose(file_) == 0 && success_;
+        file_ = nullptr;
+        if (!success_) {
+            utility::LogWarning("Write O3DC failed: unable to write file.");
+        }
+        return success_;
+    }
+
+    bool IsOpened() const { return file_ != nullptr; }
+
+private:
+    /// Writes \p data at the next multiple of kChunkedAlignment and returns
+    /// its offset.
+    int64_t WriteAligned(const char *data, size_t size) {
+        static const char padding[kChunkedAlignment] = {0};
+        const int64_t aligned = (offset_ + kChunkedAlignment - 1) /
+                                kChunkedAlignment * kChunkedAlignment;
+        success_ = success_ &&
+                   fwrite(padding, 1, aligned - offset_, file_) ==
+                           size_t(aligned - offset_) &&
+                   fwrite(data, 1, size, file_) == size;
+        offset_ = aligned + int64_t(size);
+        return aligned;
+    }
+
+    bool HasSameAttributes(const std::vector<ChunkedSource> &sources) const {
+        if (sources.size() != index_.attributes.size()) {
+            return false;
+        }
+        for (size_t a = 0; a < sources.size(); a++) {
+            const ChunkedAttribute &attribute = index_.attributes[a];
+            if (sources[a].attribute.name != attribute.name ||
+                sources[a].attribute.dtype != attribute.dtype ||
+                sources[a].attribute.row_shape != attribute.row_shape) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    FILE *file_ = nullptr;
+    ChunkedIndex index_;
+    bool has_attributes_ = false;
+    int64_t offset_ = 0;
+    bool success_ = true;
+};
+
+/// Compressed blob read from a file and its destination.
+struct PendingBlob {
+    std::vector<char> stored;
+    char *dst;
+    uint64_t raw_size;
+};
+
+static bool DecompressBlob(const PendingBlob &blob) {
+    return lzf_decompress(blob.stored.data(), (unsigned int)blob.stored.size(),
+                          blob.dst, (unsigned int)blob.raw_size) ==
+           blob.raw_size;
+}
+
+/// Reads \p chunks from \p file and returns one tensor per attribute with the
+/// rows of all chunks in the given order.
+static bool ReadChunkData(FILE *file,
+                          const ChunkedIndex &index,
+                          const std::vector<const ChunkedChunk *> &chunks,
+                          std::vector<core::Tensor> &tensors) {
+    // First output row of every chunk for both attribute groups.
+    std::vector<int64_t> element_begins(chunks.size() + 1, 0);
+    std::vector<int64_t> triangle_begins(chunks.size() + 1, 0);
+    for (size_t c = 0; c < chunks.size(); c++) {
+        element_begins[c + 1] =
+                element_begins[c] + chunks[c]->info.num_elements;
+        triangle_begins[c + 1] =
+                triangle_begins[c] + chunks[c]->info.num_triangles;
+    }
+    tensors.clear();
+    for (const ChunkedAttribute &attribute : index.attributes) {
+        core::SizeVector shape = attribute.row_shape;
+        shape.insert(shape.begin(),
+                     attribute.group == ChunkedAttributeGroup::Element
+                             ? element_begins.back()
+                             : triangle_begins.back());
+        tensors.emplace_back(shape, attribute.dtype);
+    }
+
+    // Uncompressed blobs are read in place. Compressed blobs of a batch of
+    // chunks are read sequentially and decompressed in parallel.
+    const int64_t batch_size = utility::GetMaxParallelism() * 4;
+    std::vector<PendingBlob> pending;
+    bool success = true;
+    for (int64_t batch_begin = 0;
+         success && batch_begin < int64_t(chunks.size());
+         batch_begin += batch_size) {
+        const int64_t batch_end =
+                std::min(batch_begin + batch_size, int64_t(chunks.size()));
+        pending.clear();
+        for (int64_t c = batch_begin; success && c < batch_end; c++) {
+            for (size_t a = 0; success && a < index.attributes.size(); a++) {
+                const ChunkedAttribute &attribute = index.attributes[a];
+                const ChunkedBlob &blob = chunks[c]->blobs[a];
+                const int64_t row =
+                        attribute.group == ChunkedAttributeGroup::Element
+                                ? element_begins[c]
+                                : triangle_begins[c];
+                char *dst = static_cast<char *>(tensors[a].GetDataPtr()) +
+                            row * attribute.row_bytes;
+                if (blob.raw_size == 0) {
+                    continue;
+                }
+                success = Seek64(file, int64_t(blob.offset)) == 0;
+                if (success && blob.stored_size == blob.raw_size) {
+                    success = fread(dst, 1, blob.raw_size, file) ==
+                              blob.raw_size;
+                } else if (success && blob.stored_size < blob.raw_size) {
+                    pending.push_back({std::vector<char>(blob.stored_size),
+                                       dst, blob.raw_size});
+                    success = fread(pending.back().stored.data(), 1,
+                                    blob.stored_size,
+                                    file) == blob.stored_size;
+                } else {
+                    success = false;
+                }
+            }
+        }
+        std::vector<char> decompressed(pending.size(), 1);
+        utility::ParallelFor(int64_t(0), int64_t(pending.size()),
+                             [&](int64_t i) {
+                                 decompressed[i] = DecompressBlob(pending[i]);
+                             });
+        success = success && std::all_of(decompressed.begin(),
+                                         decompressed.end(),
+                                         [](char ok) { return ok != 0; });
+    }
+    if (!success) {
+        return false;
+    }
+
+    // Chunk-local vertex indices become indices into the output vertices.
+    for (size_t a = 0; a < index.attributes.size(); a++) {
+        if (index.attributes[a].group != ChunkedAttributeGroup::Triangle ||
+            index.attributes[a].name != "triangles") {
+            continue;
+        }
+        int64_t *indices = tensors[a].GetDataPtr<int64_t>();
+        utility::ParallelFor(int64_t(0), int64_t(chunks.size()),
+                             [&](int64_t c) {
+                                 for (int64_t i = triangle_begins[c] * 3;
+                                      i < triangle_begins[c + 1] * 3; i++) {
+                                     indices[i] += element_begins[c];
+                                 }
+                             });
+    }
+    return true;
+}
+
+static std::vector<const ChunkedChunk *> SelectChunks(
+        const ChunkedIndex &index,
+        const std::function<bool(const ChunkInfo &)> &select) {
+    std::vector<const ChunkedChunk *> chunks;
+    for (const ChunkedChunk &chunk : index.chunks) {
+        if (select(chunk.info)) {
+            chunks.push_back(&chunk);
+        }
+    }
+    return chunks;
+}
+
+/// Reads the chunks for which \p select returns true and returns one tensor
+/// per attribute with the rows of all selected chunks in file order.
+static bool ReadChunks(const std::string &filename,
+                       const ChunkedIndex &index,
+                       const std::function<bool(const ChunkInfo &)> &select,
+                       std::vector<core::Tensor> &tensors) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning("Read O3DC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const bool success =
+            ReadChunkData(file, index, SelectChunks(index, select), tensors);
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read O3DC failed: corrupted chunk in {}.",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+static bool Intersects(const open3d::geometry::AxisAlignedBoundingBox &a,
+                       const open3d::geometry::AxisAlignedBoundingBox &b) {
+    return (a.min_bound_.array() <= b.max_bound_.array()).all() &&
+           (b.min_bound_.array() <= a.max_bound_.array()).all();
+}
+
+/// Collects the attributes of \p pointcloud, "points" first.
+static bool GetPointCloudSources(const geometry::PointCloud &pointcloud,
+                                 std::vector<ChunkedSource> &sources) {
+    std::vector<std::string> names;
+    for (const auto &kv : pointcloud.GetPointAttr()) {
+        if (kv.first != "points" && pointcloud.HasPointAttr(kv.first)) {
+            names.push_back(kv.first);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    names.insert(names.begin(), "points");
+    sources.clear();
+    for (const std::string &name : names) {
+        if (!AddChunkedSource(name, pointcloud.GetPointAttr(name),
+                              ChunkedAttributeGroup::Element, sources) &&
+            name == "points") {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Splits the points into tiles and the points of every tile into LOD levels.
+static bool PlanPointCloudChunks(const core::Tensor &positions,
+                                 const ChunkedGeometryWriteOption &option,
+                                 std::vector<ChunkPlan> &plans) {
+    const core::Tensor min_tensor = positions.Min({0});
+    const core::Tensor max_tensor = positions.Max({0});
+    const Eigen::Vector3d min_bound(min_tensor[0].Item<double>(),
+                                    min_tensor[1].Item<double>(),
+                                    min_tensor[2].Item<double>());
+    const Eigen::Vector3d max_bound(max_tensor[0].Item<double>(),
+                                    max_tensor[1].Item<double>(),
+                                    max_tensor[2].Item<double>());
+    std::vector<int64_t> keys, order, tile_begins;
+    if (!ComputeTileKeys(positions, min_bound, max_bound, option, keys)) {
+        return false;
+    }
+    GroupByTile(keys, order, tile_begins);
+
+    // The k-th point of a tile belongs to the coarsest level l whose stride
+    // kLODFactor^(num_lods - 1 - l) divides k. Chunks are ordered by level, so
+    // coarse levels are stored contiguously.
+    const int num_lods = std::max(option.num_lods, 1);
+    const int64_t num_tiles = int64_t(tile_begins.size()) - 1;
+    plans.assign(num_lods * num_tiles, ChunkPlan());
+    utility::ParallelFor(int64_t(0), num_tiles, [&](int64_t t) {
+        for (int64_t k = 0; k < tile_begins[t + 1] - tile_begins[t]; k++) {
+            int level = num_lods - 1;
+            int64_t stride = kLODFactor;
+            while (level > 0 && k % stride == 0) {
+                level--;
+                stride *= kLODFactor;
+            }
+            ChunkPlan &plan = plans[level * num_tiles + t];
+            plan.lod = level;
+            plan.elements.push_back(order[tile_begins[t] + k]);
+        }
+    });
+    plans.erase(std::remove_if(plans.begin(), plans.end(),
+                               [](const ChunkPlan &plan) {
+                                   return plan.elements.empty();
+                               }),
+                plans.end());
+    return true;
+}
+
+bool WriteChunkedPointCloud(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            const ChunkedGeometryWriteOption &option) {
+    if (!pointcloud.HasPoints()) {
+        utility::LogWarning("Write O3DC failed: point cloud has 0 points.");
+        return false;
+    }
+    std::vector<ChunkedSource> sources;
+    if (!GetPointCloudSources(pointcloud, sources)) {
+        return false;
+    }
+    const core::Tensor positions =
+            sources[0].tensor.To(core::Dtype::Float64).Contiguous();
+    std::vector<ChunkPlan> plans;
+    if (!PlanPointCloudChunks(positions, option, plans)) {
+        return false;
+    }
+    utility::LogDebug("Write O3DC: {:d} points in {:d} chunks.",
+                      positions.GetLength(), plans.size());
+    ChunkedFileWriter writer;
+    return writer.Open(filename, ChunkedGeometryType::PointCloud,
+                       std::max(option.num_lods, 1), option.compressed) &&
+           writer.Write(plans, sources, positions) && writer.Close();
+}
+
+bool WriteChunkedTriangleMesh(const std::string &filename,
+                              const geometry::TriangleMesh &mesh,
+                              const ChunkedGeometryWriteOption &option) {
+    if (!mesh.HasVertices() || !mesh.HasTriangles()) {
+        utility::LogWarning(
+                "Write O3DC failed: mesh has no vertices or triangles.");
+        return false;
+    }
+    std::vector<ChunkedSource> sources;
+    for (const auto &group : {ChunkedAttributeGroup::Element,
+                              ChunkedAttributeGroup::Triangle}) {
+        const bool is_element = group == ChunkedAttributeGroup::Element;
+        const std::string primary = is_element ? "vertices" : "triangles";
+        const auto &attributes =
+                is_element ? mesh.GetVertexAttr() : mesh.GetTriangleAttr();
+        std::vector<std::string> names;
+        for (const auto &kv : attributes) {
+            const bool valid = is_element ? mesh.HasVertexAttr(kv.first)
+                                          : mesh.HasTriangleAttr(kv.first);
+            if (kv.first != primary && valid) {
+                names.push_back(kv.first);
+            }
+        }
+        std::sort(names.begin(), names.end());
+        names.insert(names.begin(), primary);
+        for (const std::string &name : names) {
+            core::Tensor tensor = attributes.at(name);
+            if (name == "triangles") {
+                tensor = tensor.To(core::Dtype::Int64);
+            }
+            if (!AddChunkedSource(name, tensor, group, sources) &&
+                name == primary) {
+                return false;
+            }
+        }
+    }
+
+    const core::Tensor positions =
+            sources[0].tensor.To(core::Dtype::Float64).Contiguous();
+    const ChunkedSource &triangle_source = *std::find_if(
+            sources.begin(), sources.end(), [](const ChunkedSource &source) {
+                return source.attribute.name == "triangles";
+            });
+    const int64_t *triangle_ptr = triangle_source.tensor.GetDataPtr<int64_t>();
+    const int64_t num_vertices = positions.GetLength();
+    const int64_t num_triangles = triangle_source.tensor.GetLength();
+    for (int64_t i = 0; i < num_triangles * 3; i++) {
+        if (triangle_ptr[i] < 0 || triangle_ptr[i] >= num_vertices) {
+            utility::LogWarning(
+                    "Write O3DC failed: triangle index out of range.");
+            return false;
+        }
+    }
+
+    // Triangles are tiled by their centroid.
+    const double *position_ptr = positions.GetDataPtr<double>();
+    core::Tensor centroids({num_triangles, 3}, core::Dtype::Float64);
+    double *centroid_ptr = centroids.GetDataPtr<double>();
+    utility::ParallelFor(int64_t(0), num_triangles, [&](int64_t i) {
+        for (int j = 0; j < 3; j++) {
+            centroid_ptr[i * 3 + j] =
+                    (position_ptr[triangle_ptr[i * 3] * 3 + j] +
+                     position_ptr[triangle_ptr[i * 3 + 1] * 3 + j] +
+                     position_ptr[triangle_ptr[i * 3 + 2] * 3 + j]) /
+                    3.0;
+        }
+    }, kChunkedGrainSize);
+    const core::Tensor min_tensor = positions.Min({0});
+    const core::Tensor max_tensor = positions.Max({0});
+    const Eigen::Vector3d min_bound(min_tensor[0].Item<double>(),
+                                    min_tensor[1].Item<double>(),
+                                    min_tensor[2].Item<double>());
+    const Eigen::Vector3d max_bound(max_tensor[0].Item<double>(),
+                                    max_tensor[1].Item<double>(),
+                                    max_tensor[2].Item<double>());
+    std::vector<int64_t> keys, order, tile_begins;
+    if (!ComputeTileKeys(centroids, min_bound, max_bound, option, keys)) {
+        return false;
+    }
+    GroupByTile(keys, order, tile_begins);
+
+    const int64_t num_tiles = int64_t(tile_begins.size()) - 1;
+    std::vector<ChunkPlan> plans(num_tiles);
+    utility::ParallelFor(int64_t(0), num_tiles, [&](int64_t t) {
+        ChunkPlan &plan = plans[t];
+        plan.triangles.assign(order.begin() + tile_begins[t],
+                              order.begin() + tile_begins[t + 1]);
+        for (int64_t triangle : plan.triangles) {
+            plan.elements.insert(plan.elements.end(),
+                                 triangle_ptr + triangle * 3,
+                                 triangle_ptr + triangle * 3 + 3);
+        }
+        std::sort(plan.elements.begin(), plan.elements.end());
+        plan.elements.erase(
+                std::unique(plan.elements.begin(), plan.elements.end()),
+                plan.elements.end());
+    });
+    utility::LogDebug("Write O3DC: {:d} triangles in {:d} chunks.",
+                      num_triangles, plans.size());
+    ChunkedFileWriter writer;
+    return writer.Open(filename, ChunkedGeometryType::TriangleMesh, 1,
+                       option.compressed) &&
+           writer.Write(plans, sources, positions) && writer.Close();
+}
+
+bool ReadChunkedGeometryInfo(const std::string &filename,
+                             std::vector<ChunkInfo> &chunks) {
+    ChunkedIndex index;
+    if (!ReadChunkedIndex(filename, index)) {
+        return false;
+    }
+    chunks.clear();
+    for (const ChunkedChunk &chunk : index.chunks) {
+        chunks.push_back(chunk.info);
+    }
+    return true;
+}
+
+static bool ReadChunkedPointCloud(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const std::function<bool(const ChunkInfo &)> &select) {
+    ChunkedIndex index;
+    if (!ReadChunkedIndex(filename, index)) {
+        return false;
+    }
+    if (index.geometry_type != ChunkedGeometryType::PointCloud) {
+        utility::LogWarning("Read O3DC failed: {} does not hold a point cloud.",
+                            filename);
+        return false;
+    }
+    std::vector<core::Tensor> tensors;
+    if (!ReadChunks(filename, index, select, tensors)) {
+        return false;
+    }
+    pointcloud.Clear();
+    for (size_t a = 0; a < tensors.size(); a++) {
+        pointcloud.SetPointAttr(index.attributes[a].name, tensors[a]);
+    }
+    return true;
+}
+
+bool ReadChunkedPointCloud(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           int lod) {
+    return ReadChunkedPointCloud(
+            filename, pointcloud,
+            std::function<bool(const ChunkInfo &)>(
+                    [lod](const ChunkInfo &info) {
+                        return lod < 0 || info.lod <= lod;
+                    }));
+}
+
+bool ReadChunkedPointCloud(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::geometry::AxisAlignedBoundingBox &bbox,
+        int lod) {
+    return ReadChunkedPointCloud(
+            filename, pointcloud,
+            std::function<bool(const ChunkInfo &)>(
+                    [&bbox, lod](const ChunkInfo &info) {
+                        return (lod < 0 || info.lod <= lod) &&
+                               Intersects(info.bbox, bbox);
+                    }));
+}
+
+static bool ReadChunkedTriangleMesh(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const std::function<bool(const ChunkInfo &)> &select) {
+    ChunkedIndex index;
+    if (!ReadChunkedIndex(filename, index)) {
+        return false;
+    }
+    if (index.geometry_type != ChunkedGeometryType::TriangleMesh) {
+        utility::LogWarning("Read O3DC failed: {} does not hold a mesh.",
+                            filename);
+        return false;
+    }
+    std::vector<core::Tensor> tensors;
+    if (!ReadChunks(filename, index, select, tensors)) {
+        return false;
+    }
+    mesh.Clear();
+    for (size_t a = 0; a < tensors.size(); a++) {
+        if (index.attributes[a].group == ChunkedAttributeGroup::Element) {
+            mesh.SetVertexAttr(index.attributes[a].name, tensors[a]);
+        } else {
+            mesh.SetTriangleAttr(index.attributes[a].name, tensors[a]);
+        }
+    }
+    return true;
+}
+
+bool ReadChunkedTriangleMesh(const std::string &filename,
+                             geometry::TriangleMesh &mesh) {
+    return ReadChunkedTriangleMesh(
+            filename, mesh,
+            std::function<bool(const ChunkInfo &)>(
+                    [](const ChunkInfo &) { return true; }));
+}
+
+bool ReadChunkedTriangleMesh(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::geometry::AxisAlignedBoundingBox &bbox) {
+    return ReadChunkedTriangleMesh(
+            filename, mesh,
+            std::function<bool(const ChunkInfo &)>(
+                    [&bbox](const ChunkInfo &info) {
+                        return Intersects(info.bbox, bbox);
+                    }));
+}
+
+/// Streams the chunks of a point cloud file. One file chunk is held in memory
+/// at a time and its rows are handed out over as many ReadChunk calls as
+/// needed.
+class ChunkedPointCloudReader : public PointCloudReader {
+public:
+    explicit ChunkedPointCloudReader(
+            const std::function<bool(const ChunkInfo &)> &select)
+        : select_(select) {}
+    ~ChunkedPointCloudReader() override { Close(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!ReadChunkedIndex(filename, index_)) {
+            return false;
+        }
+        if (index_.geometry_type != ChunkedGeometryType::PointCloud) {
+            utility::LogWarning(
+                    "Read O3DC failed: {} does not hold a point cloud.",
+                    filename);
+            return false;
+        }
+        file_ = utility::filesystem::FOpen(filename, "rb");
+        if (file_ == nullptr) {
+            utility::LogWarning("Read O3DC failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        chunks_ = SelectChunks(index_, select_);
+        num_points_ = 0;
+        for (const ChunkedChunk *chunk : chunks_) {
+            num_points_ += chunk->info.num_elements;
+        }
+        next_chunk_ = 0;
+        tensors_.clear();
+        row_ = 0;
+        return true;
+    }
+
+    void Close() override {
+        if (file_ != nullptr) {
+            fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool IsEOF() const override {
+        return next_chunk_ == chunks_.size() &&
+               (tensors_.empty() || row_ == tensors_[0].GetLength());
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    bool ReadChunk(int64_t max_points, geometry::PointCloud &chunk) override {
+        if (!IsOpened()) {
+            utility::LogWarning("Read O3DC failed: file is not opened.");
+            return false;
+        }
+        std::vector<std::vector<core::Tensor>> parts(index_.attributes.size());
+        int64_t num_read = 0;
+        while (num_read < max_points && !IsEOF()) {
+            if (tensors_.empty() || row_ == tensors_[0].GetLength()) {
+                if (!ReadChunkData(file_, index_, {chunks_[next_chunk_]},
+                                   tensors_)) {
+                    utility::LogWarning(
+                            "Read O3DC failed: corrupted chunk {:d}.",
+                            next_chunk_);
+                    return false;
+                }
+                next_chunk_++;
+                row_ = 0;
+                continue;
+            }
+            const int64_t n = std::min(max_points - num_read,
+                                       tensors_[0].GetLength() - row_);
+            for (size_t a = 0; a < tensors_.size(); a++) {
+                parts[a].push_back(tensors_[a].Slice(0, row_, row_ + n));
+            }
+            row_ += n;
+            num_read += n;
+        }
+        chunk.Clear();
+        for (size_t a = 0; a < index_.attributes.size(); a++) {
+            const ChunkedAttribute &attribute = index_.attributes[a];
+            core::SizeVector shape = attribute.row_shape;
+            shape.insert(shape.begin(), num_read);
+            core::Tensor tensor(shape, attribute.dtype);
+            int64_t row = 0;
+            for (const core::Tensor &part : parts[a]) {
+                tensor.Slice(0, row, row + part.GetLength()) = part;
+                row += part.GetLength();
+            }
+            chunk.SetPointAttr(attribute.name, tensor);
+        }
+        return true;
+    }
+
+private:
+    std::function<bool(const ChunkInfo &)> select_;
+    ChunkedIndex index_;
+    std::vector<const ChunkedChunk *> chunks_;
+    FILE *file_ = nullptr;
+    int64_t num_points_ = 0;
+    size_t next_chunk_ = 0;
+    /// Rows of the current file chunk and the first row not yet returned.
+    std::vector<core::Tensor> tensors_;
+    int64_t row_ = 0;
+};
+
+/// Tiles every chunk passed to WriteChunk on its own, so that memory use is
+/// bounded by the size of one chunk. Tiles of different chunks may overlap.
+class ChunkedPointCloudWriter : public PointCloudWriter {
+public:
+    explicit ChunkedPointCloudWriter(const ChunkedGeometryWriteOption &option)
+        : option_(option) {}
+
+    bool Open(const std::string &filename,
+              const WritePointCloudOption &params) override {
+        option_.compressed = bool(params.compressed);
+        return writer_.Open(filename, ChunkedGeometryType::PointCloud,
+                            std::max(option_.num_lods, 1),
+                            option_.compressed);
+    }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (!writer_.IsOpened()) {
+            utility::LogWarning("Write O3DC failed: file is not opened.");
+            return false;
+        }
+        if (!chunk.HasPoints()) {
+            return true;
+        }
+        std::vector<ChunkedSource> sources;
+        if (!GetPointCloudSources(chunk, sources)) {
+            return false;
+        }
+        const core::Tensor positions =
+                sources[0].tensor.To(core::Dtype::Float64).Contiguous();
+        std::vector<ChunkPlan> plans;
+        return PlanPointCloudChunks(positions, option_, plans) &&
+               writer_.Write(plans, sources, positions);
+    }
+
+    bool Close() override {
+        return writer_.IsOpened() && writer_.Close();
+    }
+
+    bool IsOpened() const override { return writer_.IsOpened(); }
+
+private:
+    ChunkedGeometryWriteOption option_;
+    ChunkedFileWriter writer_;
+};
+
+std::unique_ptr<PointCloudReader> CreateChunkedPointCloudReader(int lod) {
+    return std::make_unique<ChunkedPointCloudReader>(
+            [lod](const ChunkInfo &info) {
+                return lod < 0 || info.lod <= lod;
+            });
+}
+
+std::unique_ptr<PointCloudReader> CreateChunkedPointCloudReader(
+        const open3d::geometry::AxisAlignedBoundingBox &bbox, int lod) {
+    return std::make_unique<ChunkedPointCloudReader>(
+            [bbox, lod](const ChunkInfo &info) {
+                return (lod < 0 || info.lod <= lod) &&
+                       Intersects(info.bbox, bbox);
+            });
+}
+
+std::unique_ptr<PointCloudWriter> CreateChunkedPointCloudWriter(
+        const ChunkedGeometryWriteOption &option) {
+    return std::make_unique<ChunkedPointCloudWriter>(option);
+}
+
+bool ReadPointCloudFromO3DC(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params) {
+    return ReadChunkedPointCloud(filename, pointcloud);
+}
+
+bool WritePointCloudToO3DC(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params) {
+    ChunkedGeometryWriteOption option;
+    option.compressed = bool(params.compressed);
+    return WriteChunkedPointCloud(filename, pointcloud, option);
+}
+
+bool ReadTriangleMeshFromO3DC(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    return ReadChunkedTriangleMesh(filename, mesh);
+}
+
+bool WriteTriangleMeshToO3DC(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool compressed,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool write_triangle_uvs,
+                             const bool print_progress) {
+    ChunkedGeometryWriteOption option;
+    option.compressed = compressed;
+    return WriteChunkedTriangleMesh(filename, mesh, option);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStream.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \struct ChunkedGeometryWriteOption
+///
+/// Options for writing the native chunked geometry format (.o3dc).
+///
+/// The geometry is split into tiles of a regular grid. Each tile is stored as
+/// one or more chunks; a chunk holds its attributes column by column, each
+/// column in its own 64-byte aligned (and optionally LZF compressed) blob. An
+/// index at the end of the file records the level of detail and bounding box
+/// of every chunk, so that readers only load the chunks they need.
+struct ChunkedGeometryWriteOption {
+    /// Edge length of the tiles. If <= 0, the tile size is chosen such that a
+    /// tile holds about \p points_per_tile points (or triangles) on average.
+    double tile_size = 0.0;
+    /// Target number of elements per tile when \p tile_size is not set.
+    int64_t points_per_tile = 65536;
+    /// Number of level of detail levels of point clouds. Level 0 holds every
+    /// 4^(num_lods - 1)-th point of a tile, each following level holds four
+    /// times as many points, and the union of all levels is the full point
+    /// cloud. Meshes are always written with a single level.
+    int num_lods = 4;
+    /// Compress the attribute blobs with LZF.
+    bool compressed = false;
+};
+
+/// \struct ChunkInfo
+///
+/// Index entry of one chunk of a chunked geometry file.
+struct ChunkInfo {
+    /// Level of detail of the chunk.
+    int lod = 0;
+    /// Bounding box of the points (or vertices) of the chunk.
+    open3d::geometry::AxisAlignedBoundingBox bbox;
+    /// Number of points (or vertices) of the chunk.
+    int64_t num_elements = 0;
+    /// Number of triangles of the chunk. Zero for point clouds.
+    int64_t num_triangles = 0;
+};
+
+/// Writes a point cloud in the chunked geometry format. All point attributes
+/// are stored; they are copied to the CPU if needed.
+bool WriteChunkedPointCloud(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            const ChunkedGeometryWriteOption &option = {});
+
+/// Writes a triangle mesh in the chunked geometry format. Triangles are
+/// assigned to tiles by their centroid and every chunk stores the vertices it
+/// references, so vertices shared by triangles of different tiles are stored
+/// once per tile.
+bool WriteChunkedTriangleMesh(const std::string &filename,
+                              const geometry::TriangleMesh &mesh,
+                              const ChunkedGeometryWriteOption &option = {});
+
+/// Reads the chunk index of a chunked geometry file without reading any
+/// attribute data.
+bool ReadChunkedGeometryInfo(const std::string &filename,
+                             std::vector<ChunkInfo> &chunks);
+
+/// Reads the chunks of a point cloud up to level of detail \p lod. A negative
+/// \p lod reads all levels.
+bool ReadChunkedPointCloud(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           int lod = -1);
+
+/// Reads the chunks of a point cloud up to level of detail \p lod whose
+/// bounding box intersects \p bbox. Whole chunks are read, so the result may
+/// contain points outside \p bbox.
+bool ReadChunkedPointCloud(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::geometry::AxisAlignedBoundingBox &bbox,
+        int lod = -1);
+
+/// Reads all chunks of a triangle mesh.
+bool ReadChunkedTriangleMesh(const std::string &filename,
+                             geometry::TriangleMesh &mesh);
+
+/// Reads the chunks of a triangle mesh whose bounding box intersects \p bbox.
+bool ReadChunkedTriangleMesh(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::geometry::AxisAlignedBoundingBox &bbox);
+
+/// Creates a streaming reader of the chunks of a point cloud up to level of
+/// detail \p lod. Chunks are returned level by level, coarse levels first.
+std::unique_ptr<PointCloudReader> CreateChunkedPointCloudReader(int lod = -1);
+
+/// Creates a streaming reader of the chunks of a point cloud up to level of
+/// detail \p lod whose bounding box intersects \p bbox.
+std::unique_ptr<PointCloudReader> CreateChunkedPointCloudReader(
+        const open3d::geometry::AxisAlignedBoundingBox &bbox, int lod = -1);
+
+/// Creates a streaming writer. Every written chunk is tiled independently, so
+/// \p option.tile_size should be set to get the same tiles for all chunks.
+/// \p option.compressed is overridden by the options passed to Open.
+std::unique_ptr<PointCloudWriter> CreateChunkedPointCloudWriter(
+        const ChunkedGeometryWriteOption &option = {});
+
+bool ReadPointCloudFromO3DC(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+bool WritePointCloudToO3DC(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params);
+
+bool ReadTriangleMeshFromO3DC(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+bool WriteTriangleMeshToO3DC(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool compressed,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool write_triangle_uvs,
+                             const bool print_progress);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
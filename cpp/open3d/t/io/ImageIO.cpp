@@ -28,9 +28,11 @@
 
 #include <unordered_map>
 
+#include "open3d/io/FileFormatIO.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -62,6 +64,7 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 }
 
 bool ReadImage(const std::string &filename, geometry::Image &image) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -76,12 +79,72 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
                 filename_ext);
         return false;
     }
-    return map_itr->second(filename, image);
+    bool success = map_itr->second(filename, image);
+    if (success) open3d::io::RecordFileRead(filename, filename_ext);
+    return success;
+}
+
+bool ReadImage(const std::string &filename,
+               geometry::Image &image,
+               const core::Device &device) {
+    std::vector<geometry::Image> images;
+    if (!ReadImages({filename}, images, device)) {
+        return false;
+    }
+    image = images[0];
+    return true;
+}
+
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images,
+                const core::Device &device) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadImages");
+    images.assign(filenames.size(), geometry::Image());
+    std::vector<bool> decoded(filenames.size(), false);
+    if (device.GetType() == core::Device::DeviceType::CUDA &&
+        IsNvJPEGAvailable()) {
+        std::vector<std::string> jpg_filenames;
+        std::vector<size_t> jpg_indices;
+        for (size_t i = 0; i < filenames.size(); ++i) {
+            std::string ext =
+                    utility::filesystem::GetFileExtensionInLowerCase(
+                            filenames[i]);
+            if (ext == "jpg" || ext == "jpeg") {
+                jpg_filenames.push_back(filenames[i]);
+                jpg_indices.push_back(i);
+            }
+        }
+        std::vector<geometry::Image> jpg_images;
+        std::vector<bool> jpg_decoded;
+        ReadImagesFromJPGCUDA(jpg_filenames, jpg_images, jpg_decoded, device);
+        for (size_t j = 0; j < jpg_indices.size(); ++j) {
+            if (jpg_decoded[j]) {
+                images[jpg_indices[j]] = jpg_images[j];
+                decoded[jpg_indices[j]] = true;
+                open3d::io::RecordFileRead(jpg_filenames[j], "jpg");
+            }
+        }
+    }
+
+    bool success = true;
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        if (decoded[i]) {
+            continue;
+        }
+        geometry::Image image;
+        if (!ReadImage(filenames[i], image)) {
+            success = false;
+            continue;
+        }
+        images[i] = image.To(device);
+    }
+    return success;
 }
 
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = kOpen3DImageIODefaultQuality*/) {
+    OPEN3D_PROFILE_SCOPE("t::io::WriteImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -99,7 +162,9 @@ bool WriteImage(const std::string &filename,
         utility::LogWarning("Write geometry::Image failed, data not on CPU.");
         return false;
     }
-    return map_itr->second(filename, image, quality);
+    bool success = map_itr->second(filename, image, quality);
+    if (success) open3d::io::RecordFileWritten(filename, filename_ext);
+    return success;
 }
 
 }  // namespace io
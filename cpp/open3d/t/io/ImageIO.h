@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/t/geometry/Image.h"
@@ -48,6 +49,25 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 /// \return return true if the read function is successful, false otherwise.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// Reads an image from a file onto \p device. On CUDA devices, JPEG images are
+/// decoded on the GPU with nvJPEG if Open3D is built with it, other images
+/// are decoded on the CPU and copied to the device.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadImage(const std::string &filename,
+               geometry::Image &image,
+               const core::Device &device);
+
+/// Reads a batch of images onto \p device. On CUDA devices, the JPEG images of
+/// the batch are decoded together with one batched nvJPEG call; the other
+/// images fall back to ReadImage.
+/// \return return true if all images are read successfully, false otherwise.
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images,
+                const core::Device &device);
+
+/// Returns true if JPEG images can be decoded on CUDA devices with nvJPEG.
+bool IsNvJPEGAvailable();
+
 constexpr int kOpen3DImageIODefaultQuality = -1;
 
 /// The general entrance for writing an Image to a file
@@ -82,6 +102,14 @@ bool WriteImageToPNG(const std::string &filename,
 
 bool ReadImageFromJPG(const std::string &filename, geometry::Image &image);
 
+/// Decodes the JPEG files \p filenames on CUDA \p device with nvJPEG.
+/// \p decoded[i] is set if images[i] has been decoded; images that nvJPEG
+/// does not support are left to the caller.
+void ReadImagesFromJPGCUDA(const std::vector<std::string> &filenames,
+                           std::vector<geometry::Image> &images,
+                           std::vector<bool> &decoded,
+                           const core::Device &device);
+
 bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = kOpen3DImageIODefaultQuality);
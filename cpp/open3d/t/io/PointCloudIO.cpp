@@ -29,10 +29,13 @@
 #include <iostream>
 #include <unordered_map>
 
+#include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/t/io/ChunkedGeometryIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -47,6 +50,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_read_function{
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
+                {"pcd", ReadPointCloudFromPCD},
+                {"o3dc", ReadPointCloudFromO3DC},
         };
 
 static const std::unordered_map<
@@ -57,6 +62,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
+                {"pcd", WritePointCloudToPCD},
+                {"o3dc", WritePointCloudToO3DC},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
@@ -71,6 +78,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const open3d::io::ReadPointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -91,6 +99,7 @@ bool ReadPointCloud(const std::string &filename,
         success = map_itr->second(filename, pointcloud, params);
         utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
                           (int)pointcloud.GetPoints().GetLength());
+        if (success) open3d::io::RecordFileRead(filename, format);
         if (params.remove_nan_points || params.remove_infinite_points) {
             utility::LogError(
                     "remove_nan_points and remove_infinite_points options are "
@@ -127,6 +136,7 @@ bool ReadPointCloud(const std::string &filename,
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const open3d::io::WritePointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("t::io::WritePointCloud");
     std::string format =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     auto map_itr = file_extension_to_pointcloud_write_function.find(format);
@@ -138,6 +148,7 @@ bool WritePointCloud(const std::string &filename,
     bool success = map_itr->second(filename, pointcloud, params);
     utility::LogDebug("Write geometry::PointCloud: {:d} vertices.",
                       (int)pointcloud.GetPoints().GetLength());
+    if (success) open3d::io::RecordFileWritten(filename, format);
     return success;
 }
 
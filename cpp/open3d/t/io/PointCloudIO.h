@@ -77,6 +77,19 @@ bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+/// Reads all fields of a PCD file. x, y, z, normal_x, normal_y, normal_z and
+/// rgb (or rgba) become the "points", "normals" and "colors" attributes,
+/// other fields such as intensity, ring or timestamp are stored as
+/// (num_points, count) attributes with the dtype of the field.
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// Writes all attributes of the point cloud as PCD fields.
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStream.h"
+
+#include "open3d/t/io/ChunkedGeometryIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+std::unique_ptr<PointCloudReader> PointCloudReader::Create(
+        const std::string &filename, const std::string &format) {
+    std::string ext = format;
+    if (ext == "auto") {
+        ext = utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    std::unique_ptr<PointCloudReader> reader;
+    if (ext == "xyz" || ext == "xyzn" || ext == "xyzrgb" || ext == "xyzi") {
+        reader = CreateXYZPointCloudReader(ext);
+    } else if (ext == "ply") {
+        reader = CreatePLYPointCloudReader();
+    } else if (ext == "pcd") {
+        reader = CreatePCDPointCloudReader();
+    } else if (ext == "o3dc") {
+        reader = CreateChunkedPointCloudReader();
+    } else {
+        utility::LogWarning(
+                "Read geometry::PointCloud failed: no streaming reader for "
+                "file extension {}.",
+                ext);
+        return nullptr;
+    }
+    if (!reader->Open(filename)) {
+        return nullptr;
+    }
+    return reader;
+}
+
+std::unique_ptr<PointCloudWriter> PointCloudWriter::Create(
+        const std::string &filename, const WritePointCloudOption &params) {
+    const std::string ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    std::unique_ptr<PointCloudWriter> writer;
+    if (ext == "xyz" || ext == "xyzn" || ext == "xyzrgb" || ext == "xyzi") {
+        writer = CreateXYZPointCloudWriter(ext);
+    } else if (ext == "ply") {
+        writer = CreatePLYPointCloudWriter();
+    } else if (ext == "pcd") {
+        writer = CreatePCDPointCloudWriter();
+    } else if (ext == "o3dc") {
+        writer = CreateChunkedPointCloudWriter();
+    } else {
+        utility::LogWarning(
+                "Write geometry::PointCloud failed: no streaming writer for "
+                "file extension {}.",
+                ext);
+        return nullptr;
+    }
+    if (!writer->Open(filename, params)) {
+        return nullptr;
+    }
+    return writer;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudReader
+///
+/// Reads a point cloud file chunk by chunk, so that files larger than the
+/// available memory can be processed with bounded memory.
+///
+/// \code
+/// auto reader = PointCloudReader::Create(filename);
+/// geometry::PointCloud chunk;
+/// while (reader && !reader->IsEOF() && reader->ReadChunk(1 << 20, chunk)) {
+///     // Process chunk.
+/// }
+/// \endcode
+class PointCloudReader {
+public:
+    PointCloudReader() {}
+    virtual ~PointCloudReader() {}
+
+    /// Opens \p filename and reads its header.
+    virtual bool Open(const std::string &filename) = 0;
+
+    /// Closes the file.
+    virtual void Close() = 0;
+
+    /// Check if a file is opened.
+    virtual bool IsOpened() const = 0;
+
+    /// Check if all points have been read.
+    virtual bool IsEOF() const = 0;
+
+    /// Number of points of the file, or -1 if it is not known before the
+    /// whole file has been read (e.g. for xyz files).
+    virtual int64_t GetNumPoints() const = 0;
+
+    /// Reads at most \p max_points following points into \p chunk, replacing
+    /// its attributes. The attributes of a chunk are the same as the ones
+    /// returned by ReadPointCloud for the whole file.
+    /// \return false if the file could not be read.
+    virtual bool ReadChunk(int64_t max_points,
+                           geometry::PointCloud &chunk) = 0;
+
+    /// Factory function to create and open a reader based on the extension
+    /// name of \p filename. Supports xyz, xyzn, xyzrgb, xyzi, pcd (ascii and
+    /// binary), ply (binary little-endian) and o3dc.
+    /// \return nullptr if the format is not supported or the file cannot be
+    /// opened.
+    static std::unique_ptr<PointCloudReader> Create(
+            const std::string &filename, const std::string &format = "auto");
+};
+
+/// \class PointCloudWriter
+///
+/// Writes a point cloud file chunk by chunk. The attributes of the first chunk
+/// define the fields of the file; every following chunk must have the same
+/// attributes with the same dtypes and shapes. Counts stored in the header are
+/// updated when the writer is closed.
+class PointCloudWriter {
+public:
+    PointCloudWriter() {}
+    virtual ~PointCloudWriter() {}
+
+    /// Creates \p filename.
+    virtual bool Open(const std::string &filename,
+                      const WritePointCloudOption &params) = 0;
+
+    /// Appends the points of \p chunk to the file.
+    virtual bool WriteChunk(const geometry::PointCloud &chunk) = 0;
+
+    /// Completes the header and closes the file.
+    virtual bool Close() = 0;
+
+    /// Check if a file is opened.
+    virtual bool IsOpened() const = 0;
+
+    /// Factory function to create and open a writer based on the extension
+    /// name of \p filename. Supports xyz, xyzn, xyzrgb, xyzi, pcd (ascii and
+    /// binary), ply and o3dc.
+    /// \return nullptr if the format is not supported or the file cannot be
+    /// created.
+    static std::unique_ptr<PointCloudWriter> Create(
+            const std::string &filename,
+            const WritePointCloudOption &params = {});
+};
+
+std::unique_ptr<PointCloudReader> CreateXYZPointCloudReader(
+        const std::string &format);
+std::unique_ptr<PointCloudWriter> CreateXYZPointCloudWriter(
+        const std::string &format);
+
+std::unique_ptr<PointCloudReader> CreatePLYPointCloudReader();
+std::unique_ptr<PointCloudWriter> CreatePLYPointCloudWriter();
+
+std::unique_ptr<PointCloudReader> CreatePCDPointCloudReader();
+std::unique_ptr<PointCloudWriter> CreatePCDPointCloudWriter();
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/RGBDDatasetLoader.h"
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+RGBDDatasetLoader::RGBDDatasetLoader(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        const RGBDDatasetLoaderOption &option)
+    : color_files_(color_files), depth_files_(depth_files), option_(option) {
+    Start();
+}
+
+RGBDDatasetLoader::RGBDDatasetLoader(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        const camera::PinholeCameraTrajectory &trajectory,
+        const RGBDDatasetLoaderOption &option)
+    : color_files_(color_files), depth_files_(depth_files), option_(option) {
+    if (trajectory.parameters_.size() != color_files.size()) {
+        utility::LogError(
+                "[RGBDDatasetLoader] Trajectory has {} poses, but got {} "
+                "frames.",
+                trajectory.parameters_.size(), color_files.size());
+    }
+    for (const camera::PinholeCameraParameters &parameters :
+         trajectory.parameters_) {
+        extrinsics_.push_back(core::eigen_converter::EigenMatrixToTensor(
+                Eigen::Matrix4d(parameters.extrinsic_)));
+    }
+    Start();
+}
+
+RGBDDatasetLoader::~RGBDDatasetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    slot_free_.notify_all();
+    for (std::thread &thread : threads_) {
+        thread.join();
+    }
+}
+
+void RGBDDatasetLoader::Start() {
+    if (color_files_.size() != depth_files_.size()) {
+        utility::LogError(
+                "[RGBDDatasetLoader] Got {} color images but {} depth "
+                "images.",
+                color_files_.size(), depth_files_.size());
+    }
+    int num_threads = option_.num_threads > 0 ? option_.num_threads
+                                              : utility::GetMaxParallelism();
+    int prefetch = option_.prefetch > 0 ? option_.prefetch : 2 * num_threads;
+    slots_.resize(prefetch);
+    num_threads = std::min(num_threads, prefetch);
+    for (int i = 0; i < num_threads; ++i) {
+        threads_.emplace_back(&RGBDDatasetLoader::WorkerLoop, this);
+    }
+}
+
+bool RGBDDatasetLoader::DecodeFrame(int64_t index,
+                                    geometry::RGBDImage &rgbd) const {
+    geometry::Image color, depth;
+    if (!ReadImage(color_files_[index], color) ||
+        !ReadImage(depth_files_[index], depth)) {
+        utility::LogWarning("[RGBDDatasetLoader] Unable to read frame {}.",
+                            index);
+        return false;
+    }
+    if (option_.device.GetType() == core::Device::DeviceType::CUDA) {
+        // Copies from page-locked memory run at full bandwidth. Freed pinned
+        // blocks are cached by size, so the staging buffers of following
+        // frames are reused.
+        if (option_.pinned) {
+            for (geometry::Image *image : {&color, &depth}) {
+                core::Tensor staging = core::Tensor::EmptyPinned(
+                        image->AsTensor().GetShape(), image->GetDtype());
+                staging.CopyFrom(image->AsTensor());
+                *image = geometry::Image(staging);
+            }
+        }
+        color = color.To(option_.device);
+        depth = depth.To(option_.device);
+    }
+    rgbd = geometry::RGBDImage(color, depth);
+    return true;
+}
+
+void RGBDDatasetLoader::WorkerLoop() {
+    while (true) {
+        int64_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            slot_free_.wait(lock, [this] {
+                return stop_ || next_decode_ >= GetFrameCount() ||
+                       next_decode_ < next_output_ + int64_t(slots_.size());
+            });
+            if (stop_ || next_decode_ >= GetFrameCount()) return;
+            index = next_decode_++;
+        }
+
+        geometry::RGBDImage rgbd;
+        bool success = false;
+        try {
+            success = DecodeFrame(index, rgbd);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (exception_ == nullptr) {
+                exception_ = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Slot &slot = slots_[index % slots_.size()];
+            slot.rgbd = std::move(rgbd);
+            slot.success = success;
+            slot.ready = true;
+        }
+        slot_ready_.notify_all();
+    }
+}
+
+bool RGBDDatasetLoader::Next(geometry::RGBDImage &rgbd) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (next_output_ >= GetFrameCount()) {
+            return false;
+        }
+        Slot &slot = slots_[next_output_ % slots_.size()];
+        slot_ready_.wait(lock, [&slot] { return slot.ready; });
+        if (!slot.success) {
+            if (exception_ != nullptr) {
+                std::rethrow_exception(exception_);
+            }
+            return false;
+        }
+        rgbd = std::move(slot.rgbd);
+        slot.rgbd = geometry::RGBDImage();
+        slot.ready = false;
+        ++next_output_;
+    }
+    slot_free_.notify_all();
+    return true;
+}
+
+bool RGBDDatasetLoader::Next(geometry::RGBDImage &rgbd,
+                             core::Tensor &extrinsic) {
+    if (extrinsics_.empty() && GetFrameCount() > 0) {
+        utility::LogError(
+                "[RGBDDatasetLoader] The loader has no trajectory.");
+    }
+    const int64_t index = next_output_;
+    if (!Next(rgbd)) {
+        return false;
+    }
+    extrinsic = extrinsics_[index];
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
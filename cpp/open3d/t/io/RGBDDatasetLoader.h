@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \struct RGBDDatasetLoaderOption
+///
+/// Options of RGBDDatasetLoader.
+struct RGBDDatasetLoaderOption {
+    /// Number of decoding threads. If <= 0, utility::GetMaxParallelism() is
+    /// used.
+    int num_threads = 0;
+    /// Maximal number of frames decoded ahead of the last returned frame. If
+    /// <= 0, twice the number of threads is used.
+    int prefetch = 0;
+    /// Device the frames are uploaded to by the decoding threads.
+    core::Device device = core::Device("CPU:0");
+    /// Stage the decoded images in page-locked host memory before uploading
+    /// them to a CUDA device. Ignored for CPU devices.
+    bool pinned = true;
+};
+
+/// \class RGBDDatasetLoader
+///
+/// Loads a sequence of color and depth image pairs on a pool of threads. The
+/// threads decode up to `prefetch` frames ahead of the consumer, and Next
+/// returns the frames in the order of the input lists.
+///
+/// \code
+/// t::io::RGBDDatasetLoader loader(color_files, depth_files);
+/// t::geometry::RGBDImage rgbd;
+/// while (loader.Next(rgbd)) {
+///     // Process rgbd.
+/// }
+/// \endcode
+class RGBDDatasetLoader {
+public:
+    /// \param color_files Color images, in frame order.
+    /// \param depth_files Depth images, with one image per color image.
+    RGBDDatasetLoader(const std::vector<std::string> &color_files,
+                      const std::vector<std::string> &depth_files,
+                      const RGBDDatasetLoaderOption &option = {});
+
+    /// Same as above, with the camera pose of every frame taken from
+    /// \p trajectory. The trajectory must have one parameter per frame.
+    RGBDDatasetLoader(const std::vector<std::string> &color_files,
+                      const std::vector<std::string> &depth_files,
+                      const camera::PinholeCameraTrajectory &trajectory,
+                      const RGBDDatasetLoaderOption &option = {});
+    ~RGBDDatasetLoader();
+
+    RGBDDatasetLoader(const RGBDDatasetLoader &) = delete;
+    RGBDDatasetLoader &operator=(const RGBDDatasetLoader &) = delete;
+
+    /// Waits for the next frame and returns it in \p rgbd. Returns false at
+    /// the end of the sequence or if the images of the frame could not be
+    /// read. Exceptions thrown while decoding are rethrown here.
+    bool Next(geometry::RGBDImage &rgbd);
+
+    /// Same as above, and returns the 4x4 Float64 extrinsic matrix of the
+    /// frame in \p extrinsic. The loader must have been created with a
+    /// trajectory.
+    bool Next(geometry::RGBDImage &rgbd, core::Tensor &extrinsic);
+
+    /// Number of frames of the sequence.
+    int64_t GetFrameCount() const {
+        return static_cast<int64_t>(color_files_.size());
+    }
+
+    /// Index of the frame returned by the next call to Next.
+    int64_t GetNextFrameIndex() const { return next_output_; }
+
+private:
+    struct Slot {
+        bool ready = false;
+        bool success = false;
+        geometry::RGBDImage rgbd;
+    };
+
+    void Start();
+    void WorkerLoop();
+    bool DecodeFrame(int64_t index, geometry::RGBDImage &rgbd) const;
+
+    std::vector<std::string> color_files_;
+    std::vector<std::string> depth_files_;
+    std::vector<core::Tensor> extrinsics_;
+    RGBDDatasetLoaderOption option_;
+
+    std::mutex mutex_;
+    std::condition_variable slot_free_;
+    std::condition_variable slot_ready_;
+    /// Decoded frame i is stored in slots_[i % slots_.size()].
+    std::vector<Slot> slots_;
+    int64_t next_decode_ = 0;
+    int64_t next_output_ = 0;
+    bool stop_ = false;
+    std::exception_ptr exception_;
+
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
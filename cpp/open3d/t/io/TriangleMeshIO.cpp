@@ -28,8 +28,12 @@
 
 #include <unordered_map>
 
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/t/io/ChunkedGeometryIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -40,7 +44,10 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            geometry::TriangleMesh &,
                            const open3d::io::ReadTriangleMeshOptions &)>>
-        file_extension_to_trianglemesh_read_function{};
+        file_extension_to_trianglemesh_read_function{
+                {"o3dc", ReadTriangleMeshFromO3DC},
+                {"ply", ReadTriangleMeshFromPLY},
+        };
 
 static const std::unordered_map<
         std::string,
@@ -52,7 +59,10 @@ static const std::unordered_map<
                            const bool,
                            const bool,
                            const bool)>>
-        file_extension_to_trianglemesh_write_function{};
+        file_extension_to_trianglemesh_write_function{
+                {"o3dc", WriteTriangleMeshToO3DC},
+                {"ply", WriteTriangleMeshToPLY},
+        };
 
 std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
         const std::string &filename, bool print_progress) {
@@ -73,12 +83,14 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 // mesh conversion.
 // 3. Update the documention with information on how to access these additional
 // attributes from tensor based triangle mesh.
-// 4. Implement read/write tensor triangle mesh with various file formats.
+// 4. Implement read/write tensor triangle mesh with file formats other than
+// PLY.
 // 5. Compare with legacy triangle mesh and add corresponding unit tests.
 
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       open3d::io::ReadTriangleMeshOptions params) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -88,31 +100,47 @@ bool ReadTriangleMesh(const std::string &filename,
         return false;
     }
 
+    const core::Device device = mesh.GetDevice();
     auto map_itr =
             file_extension_to_trianglemesh_read_function.find(filename_ext);
-    bool success = false;
     if (map_itr == file_extension_to_trianglemesh_read_function.end()) {
         open3d::geometry::TriangleMesh legacy_mesh;
-        success = open3d::io::ReadTriangleMesh(filename, legacy_mesh, params);
-        if (!success) {
+        if (!open3d::io::ReadTriangleMesh(filename, legacy_mesh, params)) {
             return false;
         }
-        mesh = geometry::TriangleMesh::FromLegacyTriangleMesh(legacy_mesh);
-    } else {
-        success = map_itr->second(filename, mesh, params);
-        utility::LogDebug(
-                "Read geometry::TriangleMesh: {:d} triangles and {:d} "
-                "vertices.",
-                mesh.GetTriangles().GetLength(),
-                mesh.GetVertices().GetLength());
-        if (mesh.HasVertices() && !mesh.HasTriangles()) {
-            utility::LogWarning(
-                    "geometry::TriangleMesh appears to be a "
-                    "geometry::PointCloud "
-                    "(only contains vertices, but no triangles).");
-        }
+        mesh = geometry::TriangleMesh::FromLegacyTriangleMesh(
+                std::move(legacy_mesh), core::Dtype::Float32,
+                core::Dtype::Int64, device);
+        return true;
     }
-    return success;
+
+    if (params.print_progress) {
+        auto progress_text = std::string("Reading ") +
+                             utility::ToUpper(filename_ext) +
+                             " file: " + filename;
+        auto pbar = utility::ConsoleProgressBar(100, progress_text, true);
+        params.update_progress = [pbar](double percent) mutable -> bool {
+            pbar.SetCurrentCount(size_t(percent));
+            return true;
+        };
+    }
+    bool success = map_itr->second(filename, mesh, params);
+    if (!success) {
+        return false;
+    }
+    open3d::io::RecordFileRead(filename, filename_ext);
+    mesh = mesh.To(device);
+    utility::LogDebug(
+            "Read geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
+            mesh.HasTriangles() ? mesh.GetTriangles().GetLength() : 0,
+            mesh.HasVertices() ? mesh.GetVertices().GetLength() : 0);
+    if (mesh.HasVertices() && !mesh.HasTriangles()) {
+        utility::LogWarning(
+                "geometry::TriangleMesh appears to be a "
+                "geometry::PointCloud "
+                "(only contains vertices, but no triangles).");
+    }
+    return true;
 }
 
 bool WriteTriangleMesh(const std::string &filename,
@@ -123,6 +151,7 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_vertex_colors /* = true*/,
                        bool write_triangle_uvs /* = true*/,
                        bool print_progress /* = false*/) {
+    OPEN3D_PROFILE_SCOPE("t::io::WriteTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -145,6 +174,7 @@ bool WriteTriangleMesh(const std::string &filename,
     utility::LogDebug(
             "Write geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
             mesh.GetTriangles().GetLength(), mesh.GetVertices().GetLength());
+    if (success) open3d::io::RecordFileWritten(filename, filename_ext);
     return success;
 }
 
@@ -42,6 +42,7 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 
 /// The general entrance for reading a TriangleMesh from a file
 /// The function calls read functions based on the extension name of filename.
+/// The attributes are moved to the device of \p mesh once read.
 /// \return return true if the read function is successful, false otherwise.
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
@@ -63,6 +64,29 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+/// Reads a PLY mesh without conversion to the legacy mesh. Vertex and face
+/// properties keep the dtype of the file. x, y, z become the "vertices", nx,
+/// ny, nz the "normals" and red, green, blue the "colors" attributes, other
+/// properties are stored as (num, 1) attributes. Polygons are split into
+/// triangle fans and stored as Int64 "triangles".
+bool ReadTriangleMeshFromPLY(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+/// Writes the vertex and triangle attributes of \p mesh with the dtype of
+/// each attribute. Attributes other than "normals" and "colors" must have one
+/// value per vertex or triangle. \p compressed and \p write_triangle_uvs are
+/// not supported by PLY and are ignored.
+bool WriteTriangleMeshToPLY(const std::string &filename,
+                            const geometry::TriangleMesh &mesh,
+                            bool write_ascii,
+                            bool compressed,
+                            bool write_vertex_normals,
+                            bool write_vertex_colors,
+                            bool write_triangle_uvs,
+                            bool print_progress);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
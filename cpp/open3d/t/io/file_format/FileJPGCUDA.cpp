@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+#ifdef BUILD_NVJPEG
+#include <nvjpeg.h>
+#endif
+
+namespace open3d {
+namespace t {
+namespace io {
+
+#ifdef BUILD_NVJPEG
+
+namespace {
+
+/// nvJPEG library handle and decoder state of one CUDA device. The state is
+/// not thread-safe, so batches are decoded under the mutex.
+struct NvJPEGContext {
+    nvjpegHandle_t handle = nullptr;
+    nvjpegJpegState_t state = nullptr;
+    std::mutex mutex;
+};
+
+/// Makes \p device the current CUDA device and restores the previous one.
+class ScopedCUDADevice {
+public:
+    explicit ScopedCUDADevice(const core::Device &device) {
+        OPEN3D_CUDA_CHECK(cudaGetDevice(&prev_device_id_));
+        OPEN3D_CUDA_CHECK(cudaSetDevice(device.GetID()));
+    }
+    ~ScopedCUDADevice() { cudaSetDevice(prev_device_id_); }
+
+private:
+    int prev_device_id_ = 0;
+};
+
+}  // namespace
+
+/// Returns the context of \p device, or nullptr if nvJPEG cannot be
+/// initialized. Contexts live until the process exits, since destroying them
+/// after the CUDA runtime has been unloaded is not safe.
+static NvJPEGContext *GetNvJPEGContext(const core::Device &device) {
+    static std::mutex mutex;
+    static std::map<int, NvJPEGContext *> contexts;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = contexts.find(device.GetID());
+    if (it != contexts.end()) {
+        return it->second;
+    }
+    NvJPEGContext *context = new NvJPEGContext();
+    if (nvjpegCreateSimple(&context->handle) != NVJPEG_STATUS_SUCCESS ||
+        nvjpegJpegStateCreate(context->handle, &context->state) !=
+                NVJPEG_STATUS_SUCCESS) {
+        utility::LogWarning("Unable to initialize nvJPEG on {}.",
+                            device.ToString());
+        delete context;
+        context = nullptr;
+    }
+    contexts[device.GetID()] = context;
+    return context;
+}
+
+static bool ReadFileBytes(const std::string &filename,
+                          std::vector<unsigned char> &bytes) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning("Read JPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bytes.clear();
+    unsigned char buffer[DEFAULT_IO_BUFFER_SIZE];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + size);
+    }
+    fclose(file);
+    return !bytes.empty();
+}
+
+/// Decodes \p indices of \p bytes with one batched call. All images of the
+/// batch must have \p channels channels.
+static bool DecodeBatch(NvJPEGContext &context,
+                        const std::vector<std::vector<unsigned char>> &bytes,
+                        const std::vector<size_t> &indices,
+                        int channels,
+                        std::vector<geometry::Image> &images,
+                        const core::Device &device) {
+    if (indices.empty()) {
+        return true;
+    }
+    std::vector<const unsigned char *> data;
+    std::vector<size_t> lengths;
+    std::vector<nvjpegImage_t> destinations(indices.size());
+    for (size_t k = 0; k < indices.size(); ++k) {
+        const geometry::Image &image = images[indices[k]];
+        data.push_back(bytes[indices[k]].data());
+        lengths.push_back(bytes[indices[k]].size());
+        destinations[k] = nvjpegImage_t();
+        destinations[k].channel[0] =
+                static_cast<unsigned char *>(image.GetDataPtr());
+        destinations[k].pitch[0] =
+                static_cast<unsigned int>(image.GetCols() * channels);
+    }
+    const nvjpegOutputFormat_t format =
+            channels == 3 ? NVJPEG_OUTPUT_RGBI : NVJPEG_OUTPUT_Y;
+    const core::CUDAStream stream = core::CUDAStream::GetCurrent();
+    std::lock_guard<std::mutex> lock(context.mutex);
+    if (nvjpegDecodeBatchedInitialize(context.handle, context.state,
+                                      static_cast<int>(indices.size()), 1,
+                                      format) != NVJPEG_STATUS_SUCCESS ||
+        nvjpegDecodeBatched(context.handle, context.state, data.data(),
+                            lengths.data(), destinations.data(),
+                            stream.Get()) != NVJPEG_STATUS_SUCCESS) {
+        utility::LogWarning("nvJPEG batched decode failed on {}.",
+                            device.ToString());
+        return false;
+    }
+    stream.Synchronize();
+    return true;
+}
+
+void ReadImagesFromJPGCUDA(const std::vector<std::string> &filenames,
+                           std::vector<geometry::Image> &images,
+                           std::vector<bool> &decoded,
+                           const core::Device &device) {
+    images.assign(filenames.size(), geometry::Image());
+    decoded.assign(filenames.size(), false);
+    if (filenames.empty()) {
+        return;
+    }
+    ScopedCUDADevice scoped_device(device);
+    NvJPEGContext *context = GetNvJPEGContext(device);
+    if (context == nullptr) {
+        return;
+    }
+
+    // The output format is shared by a batch, so gray and color images are
+    // decoded in separate batches.
+    std::vector<std::vector<unsigned char>> bytes(filenames.size());
+    std::vector<size_t> gray_indices, color_indices;
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        if (!ReadFileBytes(filenames[i], bytes[i])) {
+            continue;
+        }
+        int num_components = 0;
+        nvjpegChromaSubsampling_t subsampling;
+        int widths[NVJPEG_MAX_COMPONENT];
+        int heights[NVJPEG_MAX_COMPONENT];
+        if (nvjpegGetImageInfo(context->handle, bytes[i].data(),
+                               bytes[i].size(), &num_components, &subsampling,
+                               widths, heights) != NVJPEG_STATUS_SUCCESS ||
+            (num_components != 1 && num_components != 3)) {
+            continue;
+        }
+        images[i].Reset(heights[0], widths[0], num_components,
+                        core::Dtype::UInt8, device);
+        (num_components == 1 ? gray_indices : color_indices).push_back(i);
+    }
+
+    for (int channels : {1, 3}) {
+        const std::vector<size_t> &indices =
+                channels == 1 ? gray_indices : color_indices;
+        if (DecodeBatch(*context, bytes, indices, channels, images, device)) {
+            for (size_t i : indices) {
+                decoded[i] = true;
+            }
+        }
+    }
+}
+
+bool IsNvJPEGAvailable() { return core::cuda::IsAvailable(); }
+
+#else  // BUILD_NVJPEG
+
+void ReadImagesFromJPGCUDA(const std::vector<std::string> &filenames,
+                           std::vector<geometry::Image> &images,
+                           std::vector<bool> &decoded,
+                           const core::Device &device) {
+    images.assign(filenames.size(), geometry::Image());
+    decoded.assign(filenames.size(), false);
+}
+
+bool IsNvJPEGAvailable() { return false; }
+
+#endif  // BUILD_NVJPEG
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
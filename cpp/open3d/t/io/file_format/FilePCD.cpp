@@ -0,0 +1,646 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/FilePCD.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStream.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+using open3d::io::PCDBuffer;
+using open3d::io::PCDHeader;
+using open3d::io::PCLPointField;
+
+/// Points decoded or encoded per parallel work item.
+static constexpr int64_t kPCDGrainSize = 4096;
+
+static core::Dtype GetDtype(char type, int size) {
+    if (type == 'F' && size == 4) {
+        return core::Dtype::Float32;
+    } else if (type == 'F' && size == 8) {
+        return core::Dtype::Float64;
+    } else if (type == 'I' && size == 1) {
+        return core::Dtype::Int8;
+    } else if (type == 'I' && size == 2) {
+        return core::Dtype::Int16;
+    } else if (type == 'I' && size == 4) {
+        return core::Dtype::Int32;
+    } else if (type == 'I' && size == 8) {
+        return core::Dtype::Int64;
+    } else if (type == 'U' && size == 1) {
+        return core::Dtype::UInt8;
+    } else if (type == 'U' && size == 2) {
+        return core::Dtype::UInt16;
+    } else if (type == 'U' && size == 4) {
+        return core::Dtype::UInt32;
+    } else if (type == 'U' && size == 8) {
+        return core::Dtype::UInt64;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+static char GetPCDType(const core::Dtype &dtype) {
+    if (dtype == core::Dtype::Float32 || dtype == core::Dtype::Float64) {
+        return 'F';
+    } else if (dtype == core::Dtype::Int8 || dtype == core::Dtype::Int16 ||
+               dtype == core::Dtype::Int32 || dtype == core::Dtype::Int64) {
+        return 'I';
+    } else if (dtype == core::Dtype::UInt8 || dtype == core::Dtype::UInt16 ||
+               dtype == core::Dtype::UInt32 || dtype == core::Dtype::UInt64) {
+        return 'U';
+    } else {
+        return 0;
+    }
+}
+
+// Copies the elements of \p fields of every point into the columns of a
+// (num_points, num_columns) tensor. All fields must have the same type.
+static core::Tensor DecodeFields(
+        const PCDHeader &header,
+        const PCDBuffer &buffer,
+        const std::vector<const PCLPointField *> &fields) {
+    const core::Dtype dtype = GetDtype(fields[0]->type, fields[0]->size);
+    int64_t num_columns = 0;
+    for (const PCLPointField *field : fields) {
+        num_columns += field->count;
+    }
+    core::Tensor tensor({header.points, num_columns}, dtype);
+    char *dst_ptr = static_cast<char *>(tensor.GetDataPtr());
+    const int64_t dst_stride = num_columns * dtype.ByteSize();
+    int64_t dst_offset = 0;
+    for (const PCLPointField *field : fields) {
+        int64_t src_stride;
+        const char *src_ptr = buffer.GetField(header, *field, src_stride);
+        const int64_t num_bytes = int64_t(field->size) * field->count;
+        utility::ParallelForRange(
+                0, header.points, kPCDGrainSize,
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; i++) {
+                        std::memcpy(dst_ptr + i * dst_stride + dst_offset,
+                                    src_ptr + i * src_stride, num_bytes);
+                    }
+                });
+        dst_offset += num_bytes;
+    }
+    return tensor;
+}
+
+// Decodes a packed rgb or rgba field, stored in BGR(A) byte order, into a
+// (num_points, 3) UInt8 tensor.
+static core::Tensor DecodeColors(const PCDHeader &header,
+                                 const PCDBuffer &buffer,
+                                 const PCLPointField &field) {
+    core::Tensor colors({header.points, 3}, core::Dtype::UInt8);
+    uint8_t *dst_ptr = colors.GetDataPtr<uint8_t>();
+    int64_t src_stride;
+    const char *src_ptr = buffer.GetField(header, field, src_stride);
+    utility::ParallelForRange(
+            0, header.points, kPCDGrainSize, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    const char *bgr = src_ptr + i * src_stride;
+                    dst_ptr[3 * i + 0] = static_cast<uint8_t>(bgr[2]);
+                    dst_ptr[3 * i + 1] = static_cast<uint8_t>(bgr[1]);
+                    dst_ptr[3 * i + 2] = static_cast<uint8_t>(bgr[0]);
+                }
+            });
+    return colors;
+}
+
+// Decodes the points of \p buffer into the attributes of \p pointcloud.
+// Unsupported fields are skipped, with a warning if \p warn_unsupported is set.
+static bool DecodePointCloud(const PCDHeader &header,
+                             const PCDBuffer &buffer,
+                             geometry::PointCloud &pointcloud,
+                             bool warn_unsupported) {
+    std::unordered_map<std::string, const PCLPointField *> name_to_field;
+    for (const auto &field : header.fields) {
+        if (field.name == "_") {
+            // Padding.
+            continue;
+        }
+        if (GetDtype(field.type, field.size) == core::Dtype::Undefined) {
+            if (warn_unsupported) {
+                utility::LogWarning(
+                        "Read PCD warning: skipping field \"{}\", "
+                        "unsupported type {} of size {:d}.",
+                        field.name, field.type, field.size);
+            }
+            continue;
+        }
+        name_to_field[field.name] = &field;
+    }
+
+    // Groups three single-element fields of the same type into one attribute.
+    auto group_fields = [&](const std::string &attr_name, const char *a,
+                            const char *b, const char *c) {
+        std::vector<const PCLPointField *> fields;
+        for (const char *name : {a, b, c}) {
+            auto it = name_to_field.find(name);
+            if (it == name_to_field.end() || it->second->count != 1 ||
+                it->second->type != name_to_field.at(a)->type ||
+                it->second->size != name_to_field.at(a)->size) {
+                return;
+            }
+            fields.push_back(it->second);
+        }
+        pointcloud.SetPointAttr(attr_name,
+                                DecodeFields(header, buffer, fields));
+        for (const char *name : {a, b, c}) {
+            name_to_field.erase(name);
+        }
+    };
+
+    pointcloud.Clear();
+    if (name_to_field.count("x") == 0) {
+        utility::LogWarning("Read PCD failed: unsupported point fields.");
+        return false;
+    }
+    group_fields("points", "x", "y", "z");
+    if (!pointcloud.HasPoints()) {
+        utility::LogWarning("Read PCD failed: unsupported point fields.");
+        return false;
+    }
+    if (name_to_field.count("normal_x") != 0) {
+        group_fields("normals", "normal_x", "normal_y", "normal_z");
+    }
+    for (const char *name : {"rgb", "rgba"}) {
+        auto it = name_to_field.find(name);
+        if (it != name_to_field.end() && it->second->size == 4 &&
+            it->second->count == 1) {
+            pointcloud.SetPointColors(
+                    DecodeColors(header, buffer, *it->second));
+            name_to_field.erase(it);
+            break;
+        }
+    }
+    // Add rest of the fields, e.g. intensity, ring or timestamp.
+    for (const auto &field : header.fields) {
+        if (name_to_field.count(field.name) != 0) {
+            pointcloud.SetPointAttr(field.name,
+                                    DecodeFields(header, buffer, {&field}));
+        }
+    }
+    return true;
+}
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    PCDHeader header;
+    if (!open3d::io::ReadPCDHeader(file, header)) {
+        utility::LogWarning("Read PCD failed: unable to parse header.");
+        fclose(file);
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(header.points);
+
+    PCDBuffer buffer;
+    if (!open3d::io::ReadPCDBuffer(file, header, buffer)) {
+        utility::LogWarning("Read PCD failed: unable to read data.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    reporter.Update(header.points / 2);
+    if (!DecodePointCloud(header, buffer, pointcloud, true)) {
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+/// Each field is copied from column \p column_ of \p tensor_, viewed as a
+/// contiguous (num_points, num_columns) tensor on CPU.
+struct PCDFieldSource {
+    core::Tensor tensor_;
+    int64_t column_;
+    bool is_color_;
+};
+
+// Sets the fields and point counts of \p header for the attributes of
+// \p pointcloud, and the source of every field.
+static bool PreparePCDFields(const geometry::PointCloud &pointcloud,
+                             PCDHeader &header,
+                             std::vector<PCDFieldSource> &sources,
+                             bool warn_unsupported) {
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+    header.fields.clear();
+    sources.clear();
+    auto add_field = [&](const std::string &name, const core::Tensor &tensor,
+                         int64_t column, int count, bool is_color) {
+        PCLPointField field;
+        field.name = name;
+        field.type = is_color ? 'F' : GetPCDType(tensor.GetDtype());
+        field.size = is_color ? 4 : int(tensor.GetDtype().ByteSize());
+        field.count = count;
+        header.fields.push_back(field);
+        sources.push_back({tensor, column, is_color});
+    };
+    auto to_columns = [&](const core::Tensor &tensor) {
+        return tensor.To(core::Device("CPU:0"))
+                .Reshape({num_points, -1})
+                .Contiguous();
+    };
+
+    // Points, normals and colors come first, the other attributes follow in
+    // alphabetical order.
+    std::vector<std::string> names;
+    for (const char *name : {"points", "normals", "colors"}) {
+        if (pointcloud.HasPointAttr(name)) {
+            names.push_back(name);
+        }
+    }
+    std::vector<std::string> other_names;
+    for (const auto &it : pointcloud.GetPointAttr()) {
+        if (it.first != "points" && it.first != "normals" &&
+            it.first != "colors") {
+            other_names.push_back(it.first);
+        }
+    }
+    std::sort(other_names.begin(), other_names.end());
+    names.insert(names.end(), other_names.begin(), other_names.end());
+
+    for (const std::string &name : names) {
+        const core::Tensor &attr = pointcloud.GetPointAttr(name);
+        if (attr.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write PCD failed: Points ({}) and {} ({}) have "
+                    "different lengths.",
+                    num_points, name, attr.GetLength());
+            return false;
+        }
+        if (name == "colors") {
+            core::Tensor colors = to_columns(attr);
+            if (colors.GetDtype() != core::Dtype::UInt8) {
+                colors = colors.To(core::Dtype::Float64);
+            }
+            add_field("rgb", colors, 0, 1, true);
+            continue;
+        }
+        if (GetPCDType(attr.GetDtype()) == 0) {
+            if (warn_unsupported) {
+                utility::LogWarning(
+                        "Write PCD warning: skipping attribute \"{}\", "
+                        "unsupported dtype {}.",
+                        name, attr.GetDtype().ToString());
+            }
+            continue;
+        }
+        core::Tensor columns = to_columns(attr);
+        if (name == "points" || name == "normals") {
+            const std::string prefix = name == "points" ? "" : "normal_";
+            for (int64_t k = 0; k < 3; k++) {
+                add_field(prefix + std::string(1, char('x' + k)), columns, k,
+                          1, false);
+            }
+        } else {
+            add_field(name, columns, 0, int(columns.GetShape(1)), false);
+        }
+    }
+
+    header.version = "0.7";
+    header.width = static_cast<int>(num_points);
+    header.height = 1;
+    header.points = header.width;
+    int count_offset = 0;
+    int offset = 0;
+    for (auto &field : header.fields) {
+        field.count_offset = count_offset;
+        field.offset = offset;
+        count_offset += field.count;
+        offset += field.size * field.count;
+    }
+    header.elementnum = count_offset;
+    header.pointsize = offset;
+    return true;
+}
+
+// Encodes the fields of all points of \p header into \p buffer.
+static void EncodePointCloud(const PCDHeader &header,
+                             const std::vector<PCDFieldSource> &sources,
+                             PCDBuffer &buffer) {
+    const int64_t num_points = header.points;
+    buffer.Resize(header);
+    for (size_t f = 0; f < header.fields.size(); f++) {
+        const PCLPointField &field = header.fields[f];
+        const PCDFieldSource &source = sources[f];
+        int64_t dst_stride;
+        char *dst_ptr = buffer.GetField(header, field, dst_stride);
+        const char *src_ptr =
+                static_cast<const char *>(source.tensor_.GetDataPtr());
+        const int64_t element_size = source.tensor_.GetDtype().ByteSize();
+        const int64_t src_stride = source.tensor_.GetShape(1) * element_size;
+        const int64_t src_offset = source.column_ * element_size;
+        const int64_t num_bytes = int64_t(field.size) * field.count;
+        utility::ParallelForRange(
+                0, num_points, kPCDGrainSize, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; i++) {
+                        const char *src = src_ptr + i * src_stride + src_offset;
+                        char *dst = dst_ptr + i * dst_stride;
+                        if (!source.is_color_) {
+                            std::memcpy(dst, src, num_bytes);
+                            continue;
+                        }
+                        // Packed rgb in BGR byte order.
+                        uint8_t rgb[3];
+                        for (int c = 0; c < 3; c++) {
+                            if (element_size == 1) {
+                                rgb[c] = static_cast<uint8_t>(src[c]);
+                            } else {
+                                double value;
+                                std::memcpy(&value, src + c * element_size,
+                                            sizeof(double));
+                                value = std::min(std::max(value, 0.0), 1.0);
+                                rgb[c] = static_cast<uint8_t>(
+                                        std::round(value * 255.0));
+                            }
+                        }
+                        const uint8_t bgra[4] = {rgb[2], rgb[1], rgb[0], 0};
+                        std::memcpy(dst, bgra, 4);
+                    }
+                });
+    }
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const open3d::io::WritePointCloudOption &params) {
+    if (pointcloud.IsEmpty()) {
+        utility::LogWarning("Write PCD failed: point cloud has 0 points.");
+        return false;
+    }
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+
+    PCDHeader header;
+    std::vector<PCDFieldSource> sources;
+    if (!PreparePCDFields(pointcloud, header, sources, true)) {
+        return false;
+    }
+    if (bool(params.write_ascii)) {
+        header.datatype = open3d::io::PCD_DATA_ASCII;
+    } else if (bool(params.compressed)) {
+        header.datatype = open3d::io::PCD_DATA_BINARY_COMPRESSED;
+    } else {
+        header.datatype = open3d::io::PCD_DATA_BINARY;
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_points);
+
+    PCDBuffer buffer;
+    EncodePointCloud(header, sources, buffer);
+    reporter.Update(num_points / 2);
+
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write PCD failed: unable to open file.");
+        return false;
+    }
+    if (!open3d::io::WritePCDHeader(file, header) ||
+        !open3d::io::WritePCDBuffer(file, header, buffer)) {
+        utility::LogWarning("Write PCD failed: unable to write data.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    reporter.Finish();
+    return true;
+}
+
+/// Streaming reader of ascii and binary PCD files. binary_compressed files
+/// hold a single LZF block, which cannot be decoded in parts.
+class PCDPointCloudReader : public PointCloudReader {
+public:
+    ~PCDPointCloudReader() override { Close(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename.c_str(), "rb");
+        if (file_ == NULL) {
+            utility::LogWarning("Read PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (!open3d::io::ReadPCDHeader(file_, header_)) {
+            utility::LogWarning("Read PCD failed: unable to parse header.");
+            Close();
+            return false;
+        }
+        if (header_.datatype == open3d::io::PCD_DATA_BINARY_COMPRESSED) {
+            utility::LogWarning(
+                    "Read PCD failed: binary_compressed files cannot be "
+                    "streamed.");
+            Close();
+            return false;
+        }
+        num_read_ = 0;
+        return true;
+    }
+
+    void Close() override {
+        if (file_ != NULL) {
+            fclose(file_);
+            file_ = NULL;
+        }
+    }
+
+    bool IsOpened() const override { return file_ != NULL; }
+
+    bool IsEOF() const override {
+        return file_ == NULL || num_read_ >= header_.points;
+    }
+
+    int64_t GetNumPoints() const override { return header_.points; }
+
+    bool ReadChunk(int64_t max_points, geometry::PointCloud &chunk) override {
+        if (file_ == NULL) {
+            return false;
+        }
+        PCDHeader chunk_header = header_;
+        chunk_header.points = static_cast<int>(
+                std::min(max_points, int64_t(header_.points) - num_read_));
+        PCDBuffer buffer;
+        if (!open3d::io::ReadPCDBuffer(file_, chunk_header, buffer)) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        chunk.Clear();
+        if (!DecodePointCloud(chunk_header, buffer, chunk, num_read_ == 0)) {
+            return false;
+        }
+        num_read_ += chunk_header.points;
+        return true;
+    }
+
+private:
+    FILE *file_ = NULL;
+    PCDHeader header_;
+    int64_t num_read_ = 0;
+};
+
+/// Streaming writer of ascii and binary PCD files. WIDTH and POINTS are
+/// written zero-padded and filled in when the writer is closed.
+class PCDPointCloudWriter : public PointCloudWriter {
+public:
+    ~PCDPointCloudWriter() override { Close(); }
+
+    bool Open(const std::string &filename,
+              const WritePointCloudOption &params) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename.c_str(), "wb");
+        if (file_ == NULL) {
+            utility::LogWarning("Write PCD failed: unable to open file.");
+            return false;
+        }
+        if (bool(params.compressed) && !bool(params.write_ascii)) {
+            utility::LogWarning(
+                    "Write PCD warning: binary_compressed files cannot be "
+                    "streamed, writing binary data.");
+        }
+        header_ = PCDHeader();
+        header_.datatype = bool(params.write_ascii)
+                                   ? open3d::io::PCD_DATA_ASCII
+                                   : open3d::io::PCD_DATA_BINARY;
+        num_points_ = 0;
+        return true;
+    }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (file_ == NULL) {
+            return false;
+        }
+        if (!chunk.HasPoints()) {
+            return true;
+        }
+        PCDHeader chunk_header;
+        std::vector<PCDFieldSource> sources;
+        if (!PreparePCDFields(chunk, chunk_header, sources,
+                              header_.fields.empty())) {
+            return false;
+        }
+        chunk_header.datatype = header_.datatype;
+        if (header_.fields.empty()) {
+            header_ = chunk_header;
+            if (!open3d::io::WritePCDHeader(file_, header_, kCountWidth)) {
+                return false;
+            }
+        } else if (!HasSameFields(chunk_header, header_)) {
+            utility::LogWarning(
+                    "Write PCD failed: the fields of the chunk differ from "
+                    "the first chunk.");
+            return false;
+        }
+        PCDBuffer buffer;
+        EncodePointCloud(chunk_header, sources, buffer);
+        if (!open3d::io::WritePCDBuffer(file_, chunk_header, buffer)) {
+            utility::LogWarning("Write PCD failed: unable to write data.");
+            return false;
+        }
+        num_points_ += chunk_header.points;
+        return true;
+    }
+
+    bool Close() override {
+        if (file_ == NULL) {
+            return true;
+        }
+        bool success = true;
+        if (!header_.fields.empty()) {
+            header_.width = static_cast<int>(num_points_);
+            header_.points = header_.width;
+            success = fseek(file_, 0, SEEK_SET) == 0 &&
+                      open3d::io::WritePCDHeader(file_, header_, kCountWidth);
+        }
+        success = fclose(file_) == 0 && success;
+        file_ = NULL;
+        if (!success) {
+            utility::LogWarning("Write PCD failed: unable to write header.");
+        }
+        return success;
+    }
+
+    bool IsOpened() const override { return file_ != NULL; }
+
+private:
+    static bool HasSameFields(const PCDHeader &a, const PCDHeader &b) {
+        if (a.fields.size() != b.fields.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < a.fields.size(); i++) {
+            if (a.fields[i].name != b.fields[i].name ||
+                a.fields[i].type != b.fields[i].type ||
+                a.fields[i].size != b.fields[i].size ||
+                a.fields[i].count != b.fields[i].count) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Digits of the zero-padded WIDTH and POINTS values.
+    static constexpr int kCountWidth = 10;
+
+    FILE *file_ = NULL;
+    PCDHeader header_;
+    int64_t num_points_ = 0;
+};
+
+std::unique_ptr<PointCloudReader> CreatePCDPointCloudReader() {
+    return std::unique_ptr<PointCloudReader>(new PCDPointCloudReader());
+}
+
+std::unique_ptr<PointCloudWriter> CreatePCDPointCloudWriter() {
+    return std::unique_ptr<PointCloudWriter>(new PCDPointCloudWriter());
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
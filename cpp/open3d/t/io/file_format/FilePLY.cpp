@@ -26,11 +26,20 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/FilePLYBinary.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStream.h"
+#include "open3d/t/io/TriangleMeshIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -52,6 +61,9 @@ struct PLYReaderState {
     // Allow fast access of attr_state by index.
     std::vector<std::shared_ptr<AttrState>> id_to_attr_state_;
     utility::CountingProgressReporter *progress_bar_;
+    // Number of records of the elements read before this one, used to report
+    // the progress of files made of several elements.
+    int64_t progress_offset_ = 0;
 };
 
 template <typename T>
@@ -71,7 +83,8 @@ static int ReadAttributeCallback(p_ply_argument argument) {
             static_cast<T>(ply_get_argument_value(argument));
 
     if (attr_state->current_size_ % 1000 == 0) {
-        state_ptr->progress_bar_->Update(attr_state->current_size_);
+        state_ptr->progress_bar_->Update(state_ptr->progress_offset_ +
+                                         attr_state->current_size_);
     }
     return 1;
 }
@@ -145,15 +158,18 @@ static std::string GetDtypeString(e_ply_type type) {
 
 static core::Dtype GetDtype(e_ply_type type) {
     // PLY_LIST attribute is not supported.
-    // Currently, we are not doing datatype conversions, so some of the ply
-    // datatypes are not included.
-
-    if (type == PLY_UINT8) {
+    if (type == PLY_INT8 || type == PLY_CHAR) {
+        return core::Dtype::Int8;
+    } else if (type == PLY_UINT8) {
         return core::Dtype::UInt8;
-    } else if (type == PLY_UINT16) {
+    } else if (type == PLY_INT16 || type == PLY_SHORT) {
+        return core::Dtype::Int16;
+    } else if (type == PLY_UINT16 || type == PLY_USHORT) {
         return core::Dtype::UInt16;
     } else if (type == PLY_INT32) {
         return core::Dtype::Int32;
+    } else if (type == PLY_UIN32 || type == PLY_UINT) {
+        return core::Dtype::UInt32;
     } else if (type == PLY_FLOAT32) {
         return core::Dtype::Float32;
     } else if (type == PLY_FLOAT64) {
@@ -171,41 +187,88 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
-bool ReadPointCloudFromPLY(const std::string &filename,
-                           geometry::PointCloud &pointcloud,
-                           const open3d::io::ReadPointCloudOption &params) {
-    p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
-    if (!ply_file) {
-        utility::LogWarning("Read PLY failed: unable to open file: {}.",
-                            filename.c_str());
-        return false;
-    }
-    if (!ply_read_header(ply_file)) {
-        utility::LogWarning("Read PLY failed: unable to parse header.");
-        ply_close(ply_file);
-        return false;
+static core::Dtype GetDtype(open3d::io::PLYBinaryElement::ScalarType type) {
+    using ScalarType = open3d::io::PLYBinaryElement::ScalarType;
+    if (type == ScalarType::Int8) {
+        return core::Dtype::Int8;
+    } else if (type == ScalarType::UInt8) {
+        return core::Dtype::UInt8;
+    } else if (type == ScalarType::Int16) {
+        return core::Dtype::Int16;
+    } else if (type == ScalarType::UInt16) {
+        return core::Dtype::UInt16;
+    } else if (type == ScalarType::Int32) {
+        return core::Dtype::Int32;
+    } else if (type == ScalarType::UInt32) {
+        return core::Dtype::UInt32;
+    } else if (type == ScalarType::Float32) {
+        return core::Dtype::Float32;
+    } else if (type == ScalarType::Float64) {
+        return core::Dtype::Float64;
+    } else {
+        return core::Dtype::Undefined;
     }
+}
 
-    PLYReaderState state;
-
-    const char *element_name;
-    long element_size = 0;
-    // Loop through ply elements and find "vertex".
-    p_ply_element element = ply_get_next_element(ply_file, nullptr);
-    while (element) {
-        ply_get_element_info(element, &element_name, &element_size);
-        if (std::string(element_name) == "vertex") {
-            break;
-        } else {
-            element = ply_get_next_element(ply_file, element);
+// Decodes the records held by \p vertex into one attribute state per
+// property. Unsupported properties are skipped, with a warning if
+// \p warn_unsupported is set.
+static void DecodeBinaryPLYAttributes(
+        const open3d::io::PLYBinaryElement &vertex,
+        PLYReaderState &state,
+        bool warn_unsupported) {
+    const int64_t element_size = vertex.GetNumRecords();
+    for (const auto &property : vertex.properties_) {
+        core::Dtype dtype = GetDtype(property.type_);
+        if (dtype == core::Dtype::Undefined) {
+            if (warn_unsupported) {
+                utility::LogWarning(
+                        "Read PLY warning: skipping property \"{}\", "
+                        "unsupported datatype \"{}\".",
+                        property.name_, property.type_name_);
+            }
+            continue;
         }
+        auto attr_state = std::make_shared<PLYReaderState::AttrState>();
+        attr_state->name_ = property.name_;
+        attr_state->data_ = core::Tensor({element_size}, dtype);
+        attr_state->size_ = element_size;
+        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            vertex.Decode(property, attr_state->data_.GetDataPtr<scalar_t>(),
+                          1);
+        });
+        attr_state->current_size_ = element_size;
+        state.name_to_attr_state_.insert({property.name_, attr_state});
+        state.id_to_attr_state_.push_back(attr_state);
     }
+}
 
-    // No element with name "vertex".
-    if (!element) {
-        utility::LogWarning("Read PLY failed: no vertex attribute.");
+// Reads the vertex attributes of binary little-endian files in bulk. Returns
+// false if the file has to be read by rply.
+static bool ReadAttributesFromBinaryPLY(const std::string &filename,
+                                        PLYReaderState &state,
+                                        int64_t &element_size) {
+    open3d::io::PLYBinaryElement vertex;
+    if (!vertex.Read(filename, "vertex")) {
         return false;
     }
+    element_size = vertex.count_;
+    state.progress_bar_->SetTotal(element_size);
+    DecodeBinaryPLYAttributes(vertex, state, true);
+    return true;
+}
+
+// Registers ReadAttributeCallback for the properties of \p element, with one
+// attribute state per property. Properties with unsupported datatypes, such as
+// lists, are skipped with a warning, except for \p list_name which is read by
+// the caller.
+static void SetAttributeReadCallbacks(p_ply ply_file,
+                                      p_ply_element element,
+                                      PLYReaderState &state,
+                                      const std::string &list_name = "") {
+    const char *element_name;
+    long element_size = 0;
+    ply_get_element_info(element, &element_name, &element_size);
 
     p_ply_property attribute = ply_get_next_property(element, nullptr);
 
@@ -214,7 +277,9 @@ bool ReadPointCloudFromPLY(const std::string &filename,
         const char *name;
         ply_get_property_info(attribute, &name, &type, nullptr, nullptr);
 
-        if (GetDtype(type) == core::Dtype::Undefined) {
+        if (name == list_name) {
+            // Read by the caller.
+        } else if (GetDtype(type) == core::Dtype::Undefined) {
             utility::LogWarning(
                     "Read PLY warning: skipping property \"{}\", unsupported "
                     "datatype \"{}\".",
@@ -244,10 +309,47 @@ bool ReadPointCloudFromPLY(const std::string &filename,
         }
         attribute = ply_get_next_property(element, attribute);
     }
+}
 
-    utility::CountingProgressReporter reporter(params.update_progress);
-    reporter.SetTotal(element_size);
-    state.progress_bar_ = &reporter;
+static bool ReadAttributesWithRPLY(const std::string &filename,
+                                   PLYReaderState &state,
+                                   int64_t &element_size) {
+    p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}.",
+                            filename.c_str());
+        return false;
+    }
+    if (!ply_read_header(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    const char *element_name;
+    long num_elements = 0;
+    // Loop through ply elements and find "vertex".
+    p_ply_element element = ply_get_next_element(ply_file, nullptr);
+    while (element) {
+        ply_get_element_info(element, &element_name, &num_elements);
+        if (std::string(element_name) == "vertex") {
+            break;
+        } else {
+            element = ply_get_next_element(ply_file, element);
+        }
+    }
+
+    // No element with name "vertex".
+    if (!element) {
+        utility::LogWarning("Read PLY failed: no vertex attribute.");
+        ply_close(ply_file);
+        return false;
+    }
+    element_size = num_elements;
+
+    SetAttributeReadCallbacks(ply_file, element, state);
+
+    state.progress_bar_->SetTotal(element_size);
 
     if (!ply_read(ply_file)) {
         utility::LogWarning("Read PLY failed: unable to read file: {}.",
@@ -255,45 +357,47 @@ bool ReadPointCloudFromPLY(const std::string &filename,
         ply_close(ply_file);
         return false;
     }
+    ply_close(ply_file);
+    return true;
+}
+
+// Removes the properties \p a, \p b and \p c from \p state and returns them
+// as the columns of \p columns. Returns false if one of them is missing.
+static bool PopColumns(PLYReaderState &state,
+                       const std::string &a,
+                       const std::string &b,
+                       const std::string &c,
+                       core::Tensor &columns) {
+    auto &attr_states = state.name_to_attr_state_;
+    if (attr_states.count(a) == 0 || attr_states.count(b) == 0 ||
+        attr_states.count(c) == 0) {
+        return false;
+    }
+    columns = ConcatColumns(attr_states.at(a)->data_, attr_states.at(b)->data_,
+                            attr_states.at(c)->data_);
+    attr_states.erase(a);
+    attr_states.erase(b);
+    attr_states.erase(c);
+    return true;
+}
 
+// Moves the attributes of \p state to \p pointcloud, grouping x, y, z into
+// points, nx, ny, nz into normals and red, green, blue into colors.
+static void SetPointCloudAttributes(PLYReaderState &state,
+                                    int64_t element_size,
+                                    geometry::PointCloud &pointcloud) {
     pointcloud.Clear();
 
     // Add base attributes.
-    if (state.name_to_attr_state_.count("x") != 0 &&
-        state.name_to_attr_state_.count("y") != 0 &&
-        state.name_to_attr_state_.count("z") != 0) {
-        core::Tensor points =
-                ConcatColumns(state.name_to_attr_state_.at("x")->data_,
-                              state.name_to_attr_state_.at("y")->data_,
-                              state.name_to_attr_state_.at("z")->data_);
-        state.name_to_attr_state_.erase("x");
-        state.name_to_attr_state_.erase("y");
-        state.name_to_attr_state_.erase("z");
-        pointcloud.SetPoints(points);
-    }
-    if (state.name_to_attr_state_.count("nx") != 0 &&
-        state.name_to_attr_state_.count("ny") != 0 &&
-        state.name_to_attr_state_.count("nz") != 0) {
-        core::Tensor normals =
-                ConcatColumns(state.name_to_attr_state_.at("nx")->data_,
-                              state.name_to_attr_state_.at("ny")->data_,
-                              state.name_to_attr_state_.at("nz")->data_);
-        state.name_to_attr_state_.erase("nx");
-        state.name_to_attr_state_.erase("ny");
-        state.name_to_attr_state_.erase("nz");
-        pointcloud.SetPointNormals(normals);
-    }
-    if (state.name_to_attr_state_.count("red") != 0 &&
-        state.name_to_attr_state_.count("green") != 0 &&
-        state.name_to_attr_state_.count("blue") != 0) {
-        core::Tensor colors =
-                ConcatColumns(state.name_to_attr_state_.at("red")->data_,
-                              state.name_to_attr_state_.at("green")->data_,
-                              state.name_to_attr_state_.at("blue")->data_);
-        state.name_to_attr_state_.erase("red");
-        state.name_to_attr_state_.erase("green");
-        state.name_to_attr_state_.erase("blue");
-        pointcloud.SetPointColors(colors);
+    core::Tensor columns;
+    if (PopColumns(state, "x", "y", "z", columns)) {
+        pointcloud.SetPoints(columns);
+    }
+    if (PopColumns(state, "nx", "ny", "nz", columns)) {
+        pointcloud.SetPointNormals(columns);
+    }
+    if (PopColumns(state, "red", "green", "blue", columns)) {
+        pointcloud.SetPointColors(columns);
     }
 
     // Add rest of the attributes.
@@ -301,19 +405,39 @@ bool ReadPointCloudFromPLY(const std::string &filename,
         pointcloud.SetPointAttr(it.second->name_,
                                 it.second->data_.Reshape({element_size, 1}));
     }
-    ply_close(ply_file);
+}
+
+bool ReadPointCloudFromPLY(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    PLYReaderState state;
+    utility::CountingProgressReporter reporter(params.update_progress);
+    state.progress_bar_ = &reporter;
+
+    int64_t element_size = 0;
+    if (!ReadAttributesFromBinaryPLY(filename, state, element_size) &&
+        !ReadAttributesWithRPLY(filename, state, element_size)) {
+        return false;
+    }
+    SetPointCloudAttributes(state, element_size, pointcloud);
     reporter.Finish();
 
     return true;
 }
 
 static e_ply_type GetPlyType(const core::Dtype &dtype) {
-    if (dtype == core::Dtype::UInt8) {
+    if (dtype == core::Dtype::Int8) {
+        return PLY_INT8;
+    } else if (dtype == core::Dtype::UInt8) {
         return PLY_UINT8;
+    } else if (dtype == core::Dtype::Int16) {
+        return PLY_INT16;
     } else if (dtype == core::Dtype::UInt16) {
         return PLY_UINT16;
     } else if (dtype == core::Dtype::Int32) {
         return PLY_INT32;
+    } else if (dtype == core::Dtype::UInt32) {
+        return PLY_UIN32;
     } else if (dtype == core::Dtype::Float32) {
         return PLY_FLOAT32;
     } else if (dtype == core::Dtype::Float64) {
@@ -467,6 +591,647 @@ bool WritePointCloudToPLY(const std::string &filename,
     return true;
 }
 
+struct PLYMeshReaderState {
+    PLYReaderState vertex_state_;
+    PLYReaderState face_state_;
+    // Vertex indices of all the faces, concatenated, and the number of
+    // indices of each face.
+    std::vector<int64_t> face_indices_;
+    std::vector<int64_t> face_sizes_;
+    utility::CountingProgressReporter *progress_bar_;
+    int64_t num_vertices_ = 0;
+};
+
+static int ReadFaceIndexCallback(p_ply_argument argument) {
+    PLYMeshReaderState *state_ptr;
+    long dummy;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &dummy);
+    long length, index;
+    ply_get_argument_property(argument, nullptr, &length, &index);
+    if (index == -1) {
+        // The length of the list is passed before its values.
+        state_ptr->face_sizes_.push_back(length);
+        const int64_t num_faces = state_ptr->face_sizes_.size();
+        if (num_faces % 1000 == 0) {
+            state_ptr->progress_bar_->Update(state_ptr->num_vertices_ +
+                                             num_faces);
+        }
+    } else {
+        state_ptr->face_indices_.push_back(
+                static_cast<int64_t>(ply_get_argument_value(argument)));
+    }
+    return 1;
+}
+
+bool ReadTriangleMeshFromPLY(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}.",
+                            filename);
+        return false;
+    }
+    if (!ply_read_header(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    PLYMeshReaderState state;
+    utility::CountingProgressReporter reporter(params.update_progress);
+    state.progress_bar_ = &reporter;
+    state.vertex_state_.progress_bar_ = &reporter;
+    state.face_state_.progress_bar_ = &reporter;
+
+    int64_t num_faces = 0;
+    p_ply_element element = ply_get_next_element(ply_file, nullptr);
+    while (element) {
+        const char *element_name;
+        long num_elements = 0;
+        ply_get_element_info(element, &element_name, &num_elements);
+        if (std::string(element_name) == "vertex") {
+            state.num_vertices_ = num_elements;
+            SetAttributeReadCallbacks(ply_file, element, state.vertex_state_);
+        } else if (std::string(element_name) == "face") {
+            num_faces = num_elements;
+            std::string list_name;
+            p_ply_property property = ply_get_next_property(element, nullptr);
+            while (property) {
+                const char *c_name;
+                e_ply_type type;
+                ply_get_property_info(property, &c_name, &type, nullptr,
+                                      nullptr);
+                const std::string name(c_name);
+                if (type == PLY_LIST &&
+                    (name == "vertex_indices" || name == "vertex_index")) {
+                    list_name = name;
+                    break;
+                }
+                property = ply_get_next_property(element, property);
+            }
+            if (!list_name.empty()) {
+                ply_set_read_cb(ply_file, element_name, list_name.c_str(),
+                                ReadFaceIndexCallback, &state, 0);
+            }
+            SetAttributeReadCallbacks(ply_file, element, state.face_state_,
+                                      list_name);
+        }
+        element = ply_get_next_element(ply_file, element);
+    }
+    if (state.num_vertices_ == 0) {
+        utility::LogWarning("Read PLY failed: number of vertex <= 0.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    state.face_state_.progress_offset_ = state.num_vertices_;
+    state.face_sizes_.reserve(num_faces);
+    state.face_indices_.reserve(3 * num_faces);
+    reporter.SetTotal(state.num_vertices_ + num_faces);
+    if (!ply_read(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}.",
+                            filename);
+        ply_close(ply_file);
+        return false;
+    }
+    ply_close(ply_file);
+
+    // Polygons are split into triangle fans. face_ids maps the triangles back
+    // to their faces when the file has faces other than triangles.
+    std::vector<int64_t> &face_sizes = state.face_sizes_;
+    const bool all_triangles =
+            std::all_of(face_sizes.begin(), face_sizes.end(),
+                        [](int64_t size) { return size == 3; });
+    std::vector<int64_t> triangles;
+    std::vector<int64_t> face_ids;
+    if (all_triangles) {
+        triangles = std::move(state.face_indices_);
+    } else {
+        const int64_t *indices = state.face_indices_.data();
+        for (size_t face_id = 0; face_id < face_sizes.size(); ++face_id) {
+            for (int64_t i = 2; i < face_sizes[face_id]; ++i) {
+                triangles.insert(triangles.end(),
+                                 {indices[0], indices[i - 1], indices[i]});
+                face_ids.push_back(face_id);
+            }
+            indices += face_sizes[face_id];
+        }
+    }
+    for (int64_t index : triangles) {
+        if (index < 0 || index >= state.num_vertices_) {
+            utility::LogWarning(
+                    "Read PLY failed: vertex index {} out of range [0, {}).",
+                    index, state.num_vertices_);
+            return false;
+        }
+    }
+    const int64_t num_triangles = int64_t(triangles.size()) / 3;
+
+    mesh = geometry::TriangleMesh();
+    core::Tensor columns;
+    if (!PopColumns(state.vertex_state_, "x", "y", "z", columns)) {
+        utility::LogWarning("Read PLY failed: no vertex positions.");
+        return false;
+    }
+    mesh.SetVertices(columns);
+    if (PopColumns(state.vertex_state_, "nx", "ny", "nz", columns)) {
+        mesh.SetVertexNormals(columns);
+    }
+    if (PopColumns(state.vertex_state_, "red", "green", "blue", columns)) {
+        mesh.SetVertexColors(columns);
+    }
+    for (auto const &it : state.vertex_state_.name_to_attr_state_) {
+        mesh.SetVertexAttr(it.second->name_, it.second->data_.Reshape(
+                                                     {state.num_vertices_, 1}));
+    }
+
+    if (num_triangles == 0) {
+        reporter.Finish();
+        return true;
+    }
+    mesh.SetTriangles(core::Tensor(triangles, {num_triangles, 3},
+                                   core::Dtype::Int64));
+    core::Tensor face_ids_tensor;
+    if (!all_triangles) {
+        face_ids_tensor =
+                core::Tensor(face_ids, {num_triangles}, core::Dtype::Int64);
+    }
+    auto to_triangles = [&](const core::Tensor &face_attr) {
+        return all_triangles ? face_attr
+                             : face_attr.IndexGet({face_ids_tensor});
+    };
+    if (PopColumns(state.face_state_, "nx", "ny", "nz", columns)) {
+        mesh.SetTriangleNormals(to_triangles(columns));
+    }
+    if (PopColumns(state.face_state_, "red", "green", "blue", columns)) {
+        mesh.SetTriangleColors(to_triangles(columns));
+    }
+    for (auto const &it : state.face_state_.name_to_attr_state_) {
+        mesh.SetTriangleAttr(
+                it.second->name_,
+                to_triangles(it.second->data_).Reshape({num_triangles, 1}));
+    }
+    reporter.Finish();
+    return true;
+}
+
+struct PLYColumns {
+    // PLY property names of the columns of data_.
+    std::vector<std::string> names_;
+    // Contiguous (size, names_.size()) CPU tensor.
+    core::Tensor data_;
+};
+
+// Lists the attributes of \p attrs other than the primary key as PLY
+// properties: "normals" and "colors" become nx, ny, nz and red, green, blue
+// if \p write_normals and \p write_colors are set, other attributes must have
+// one value per element and keep their name. Attributes of other shapes are
+// skipped with a warning.
+static std::vector<PLYColumns> GetPLYColumns(const geometry::TensorMap &attrs,
+                                             bool write_normals,
+                                             bool write_colors) {
+    const std::string primary_key = attrs.GetPrimaryKey();
+    const int64_t size = attrs.at(primary_key).GetLength();
+    std::vector<PLYColumns> columns;
+    auto add_columns = [&](const std::string &key,
+                           const std::vector<std::string> &names) {
+        const core::Tensor &attr = attrs.at(key);
+        const int64_t num_columns = static_cast<int64_t>(names.size());
+        if (attr.GetLength() != size ||
+            attr.NumElements() != size * num_columns) {
+            utility::LogWarning(
+                    "Write PLY warning: skipping attribute \"{}\" with shape "
+                    "{}.",
+                    key, attr.GetShape().ToString());
+            return;
+        }
+        columns.push_back(
+                {names, attr.Reshape({size, num_columns}).Contiguous()});
+    };
+
+    // Sort the names of the attributes for a deterministic header.
+    std::vector<std::string> keys;
+    for (auto const &it : attrs) {
+        keys.push_back(it.first);
+    }
+    std::sort(keys.begin(), keys.end());
+    if (attrs.Contains("normals") && write_normals) {
+        add_columns("normals", {"nx", "ny", "nz"});
+    }
+    if (attrs.Contains("colors") && write_colors) {
+        add_columns("colors", {"red", "green", "blue"});
+    }
+    for (const std::string &key : keys) {
+        if (key != primary_key && key != "normals" && key != "colors") {
+            add_columns(key, {key});
+        }
+    }
+    return columns;
+}
+
+static void AddPLYProperties(p_ply ply_file,
+                             const std::vector<PLYColumns> &columns) {
+    for (const PLYColumns &column : columns) {
+        e_ply_type type = GetPlyType(column.data_.GetDtype());
+        for (const std::string &name : column.names_) {
+            ply_add_property(ply_file, name.c_str(), type, type, type);
+        }
+    }
+}
+
+static void WritePLYRow(p_ply ply_file, const core::Tensor &data, int64_t i) {
+    const int64_t num_columns = data.GetShape(1);
+    DISPATCH_DTYPE_TO_TEMPLATE(data.GetDtype(), [&]() {
+        const scalar_t *row = data.GetDataPtr<scalar_t>() + i * num_columns;
+        for (int64_t c = 0; c < num_columns; ++c) {
+            ply_write(ply_file, double(row[c]));
+        }
+    });
+}
+
+bool WriteTriangleMeshToPLY(const std::string &filename,
+                            const geometry::TriangleMesh &mesh,
+                            bool write_ascii,
+                            bool compressed,
+                            bool write_vertex_normals,
+                            bool write_vertex_colors,
+                            bool write_triangle_uvs,
+                            bool print_progress) {
+    if (!mesh.HasVertices()) {
+        utility::LogWarning("Write PLY failed: mesh has 0 vertices.");
+        return false;
+    }
+
+    const geometry::TriangleMesh cpu_mesh = mesh.CPU();
+    const core::Tensor vertices = cpu_mesh.GetVertices().Contiguous();
+    const int64_t num_vertices = vertices.GetLength();
+    if (num_vertices > std::numeric_limits<int32_t>::max()) {
+        utility::LogWarning(
+                "Write PLY failed: {} vertices cannot be indexed by int.",
+                num_vertices);
+        return false;
+    }
+    core::Tensor triangles;
+    std::vector<PLYColumns> face_columns;
+    if (cpu_mesh.HasTriangles()) {
+        triangles = cpu_mesh.GetTriangles().Contiguous();
+        face_columns = GetPLYColumns(cpu_mesh.GetTriangleAttr(), true, true);
+    }
+    const int64_t num_triangles = triangles.NumElements() / 3;
+    const std::vector<PLYColumns> vertex_columns =
+            GetPLYColumns(cpu_mesh.GetVertexAttr(), write_vertex_normals,
+                          write_vertex_colors);
+
+    p_ply ply_file = ply_create(filename.c_str(),
+                                write_ascii ? PLY_ASCII : PLY_LITTLE_ENDIAN,
+                                nullptr, 0, nullptr);
+    if (!ply_file) {
+        utility::LogWarning("Write PLY failed: unable to open file: {}.",
+                            filename);
+        return false;
+    }
+    ply_add_comment(ply_file, "Created by Open3D");
+    ply_add_element(ply_file, "vertex", num_vertices);
+    e_ply_type vertex_type = GetPlyType(vertices.GetDtype());
+    ply_add_property(ply_file, "x", vertex_type, vertex_type, vertex_type);
+    ply_add_property(ply_file, "y", vertex_type, vertex_type, vertex_type);
+    ply_add_property(ply_file, "z", vertex_type, vertex_type, vertex_type);
+    AddPLYProperties(ply_file, vertex_columns);
+    ply_add_element(ply_file, "face", num_triangles);
+    ply_add_list_property(ply_file, "vertex_indices", PLY_UCHAR, PLY_INT);
+    AddPLYProperties(ply_file, face_columns);
+    if (!ply_write_header(ply_file)) {
+        utility::LogWarning("Write PLY failed: unable to write header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    utility::ConsoleProgressBar progress_bar(
+            static_cast<size_t>(num_vertices + num_triangles),
+            "Writing PLY: ", print_progress);
+    for (int64_t i = 0; i < num_vertices; ++i) {
+        WritePLYRow(ply_file, vertices, i);
+        for (const PLYColumns &column : vertex_columns) {
+            WritePLYRow(ply_file, column.data_, i);
+        }
+        ++progress_bar;
+    }
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        ply_write(ply_file, 3);
+        WritePLYRow(ply_file, triangles, i);
+        for (const PLYColumns &column : face_columns) {
+            WritePLYRow(ply_file, column.data_, i);
+        }
+        ++progress_bar;
+    }
+
+    ply_close(ply_file);
+    return true;
+}
+
+/// Streaming reader of the vertices of binary little-endian PLY files.
+class PLYPointCloudReader : public PointCloudReader {
+public:
+    ~PLYPointCloudReader() override { Close(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename, "rb");
+        if (file_ == nullptr) {
+            utility::LogWarning("Read PLY failed: unable to open file: {}.",
+                                filename);
+            return false;
+        }
+        if (!vertex_.Open(file_, "vertex")) {
+            utility::LogWarning(
+                    "Read PLY failed: streaming is only supported for the "
+                    "vertices of binary little-endian files.");
+            Close();
+            return false;
+        }
+        num_read_ = 0;
+        return true;
+    }
+
+    void Close() override {
+        if (file_ != nullptr) {
+            fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool IsEOF() const override {
+        return file_ == nullptr || num_read_ >= vertex_.count_;
+    }
+
+    int64_t GetNumPoints() const override { return vertex_.count_; }
+
+    bool ReadChunk(int64_t max_points, geometry::PointCloud &chunk) override {
+        if (file_ == nullptr) {
+            return false;
+        }
+        const int64_t num_points =
+                std::min(max_points, vertex_.count_ - num_read_);
+        if (!vertex_.ReadRecords(file_, num_points)) {
+            utility::LogWarning("Read PLY failed: unable to read vertices.");
+            return false;
+        }
+        PLYReaderState state;
+        DecodeBinaryPLYAttributes(vertex_, state, num_read_ == 0);
+        SetPointCloudAttributes(state, num_points, chunk);
+        num_read_ += num_points;
+        return true;
+    }
+
+private:
+    FILE *file_ = nullptr;
+    open3d::io::PLYBinaryElement vertex_;
+    int64_t num_read_ = 0;
+};
+
+static std::string GetPLYTypeName(const core::Dtype &dtype) {
+    if (dtype == core::Dtype::Int8) {
+        return "char";
+    } else if (dtype == core::Dtype::UInt8) {
+        return "uchar";
+    } else if (dtype == core::Dtype::Int16) {
+        return "short";
+    } else if (dtype == core::Dtype::UInt16) {
+        return "ushort";
+    } else if (dtype == core::Dtype::Int32) {
+        return "int";
+    } else if (dtype == core::Dtype::UInt32) {
+        return "uint";
+    } else if (dtype == core::Dtype::Float32) {
+        return "float";
+    } else if (dtype == core::Dtype::Float64) {
+        return "double";
+    } else {
+        return "";
+    }
+}
+
+/// Streaming writer of PLY point clouds. The vertex count of the header is
+/// written zero-padded and filled in when the writer is closed.
+class PLYPointCloudWriter : public PointCloudWriter {
+public:
+    ~PLYPointCloudWriter() override { Close(); }
+
+    bool Open(const std::string &filename,
+              const WritePointCloudOption &params) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename, "wb");
+        if (file_ == nullptr) {
+            utility::LogWarning("Write PLY failed: unable to open file: {}.",
+                                filename);
+            return false;
+        }
+        write_ascii_ = bool(params.write_ascii);
+        columns_.clear();
+        num_points_ = 0;
+        return true;
+    }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (file_ == nullptr) {
+            return false;
+        }
+        if (columns_.empty() && !WriteHeader(chunk)) {
+            return false;
+        }
+        const int64_t num_points =
+                chunk.HasPoints() ? chunk.GetPoints().GetLength() : 0;
+        if (num_points == 0) {
+            return true;
+        }
+
+        // Contiguous CPU (num_points, num_columns) view of each attribute.
+        std::unordered_map<std::string, core::Tensor> tensors;
+        for (const PLYColumn &column : columns_) {
+            if (tensors.count(column.attr_name_) != 0) {
+                continue;
+            }
+            if (!chunk.HasPointAttr(column.attr_name_) ||
+                chunk.GetPointAttr(column.attr_name_).GetDtype() !=
+                        column.dtype_) {
+                utility::LogWarning(
+                        "Write PLY failed: attribute {} differs from the "
+                        "first chunk.",
+                        column.attr_name_);
+                return false;
+            }
+            tensors[column.attr_name_] =
+                    chunk.GetPointAttr(column.attr_name_)
+                            .To(core::Device("CPU:0"))
+                            .Reshape({num_points, -1})
+                            .Contiguous();
+        }
+
+        bool success = true;
+        if (write_ascii_) {
+            std::string text;
+            for (int64_t i = 0; i < num_points; i++) {
+                for (size_t c = 0; c < columns_.size(); c++) {
+                    const PLYColumn &column = columns_[c];
+                    const core::Tensor &tensor = tensors[column.attr_name_];
+                    DISPATCH_DTYPE_TO_TEMPLATE(column.dtype_, [&]() {
+                        const scalar_t value =
+                                tensor.GetDataPtr<scalar_t>()
+                                        [i * tensor.GetShape(1) +
+                                         column.column_];
+                        fmt::format_to(std::back_inserter(text),
+                                       c == 0 ? "{}" : " {}", value);
+                    });
+                }
+                text.push_back('\n');
+            }
+            success = fwrite(text.data(), 1, text.size(), file_) ==
+                      text.size();
+        } else {
+            std::vector<char> records(num_points * record_size_);
+            int64_t offset = 0;
+            for (const PLYColumn &column : columns_) {
+                const core::Tensor &tensor = tensors[column.attr_name_];
+                const int64_t size = column.dtype_.ByteSize();
+                const int64_t src_stride = tensor.GetShape(1) * size;
+                const char *src_ptr =
+                        static_cast<const char *>(tensor.GetDataPtr()) +
+                        column.column_ * size;
+                for (int64_t i = 0; i < num_points; i++) {
+                    std::memcpy(records.data() + i * record_size_ + offset,
+                                src_ptr + i * src_stride, size);
+                }
+                offset += size;
+            }
+            success = fwrite(records.data(), 1, records.size(), file_) ==
+                      records.size();
+        }
+        if (!success) {
+            utility::LogWarning("Write PLY failed: unable to write vertices.");
+            return false;
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+    bool Close() override {
+        if (file_ == nullptr) {
+            return true;
+        }
+        bool success = true;
+        if (!columns_.empty()) {
+            success = fseek(file_, count_offset_, SEEK_SET) == 0 &&
+                      fprintf(file_, "%0*lld", kCountWidth,
+                              static_cast<long long>(num_points_)) ==
+                              kCountWidth;
+        }
+        success = fclose(file_) == 0 && success;
+        file_ = nullptr;
+        if (!success) {
+            utility::LogWarning("Write PLY failed: unable to write header.");
+        }
+        return success;
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+private:
+    bool WriteHeader(const geometry::PointCloud &chunk) {
+        if (!chunk.HasPoints()) {
+            utility::LogWarning("Write PLY failed: chunk has no points.");
+            return false;
+        }
+        auto add_columns = [&](const std::string &attr_name,
+                               const std::vector<std::string> &names) {
+            const core::Dtype dtype = chunk.GetPointAttr(attr_name).GetDtype();
+            if (GetPLYTypeName(dtype).empty()) {
+                utility::LogWarning(
+                        "Write PLY warning: skipping attribute \"{}\", "
+                        "unsupported dtype {}.",
+                        attr_name, dtype.ToString());
+                return;
+            }
+            for (size_t k = 0; k < names.size(); k++) {
+                columns_.push_back({names[k], attr_name, int64_t(k), dtype});
+            }
+        };
+        add_columns("points", {"x", "y", "z"});
+        if (chunk.HasPointNormals()) {
+            add_columns("normals", {"nx", "ny", "nz"});
+        }
+        if (chunk.HasPointColors()) {
+            add_columns("colors", {"red", "green", "blue"});
+        }
+        std::vector<std::string> names;
+        for (const auto &it : chunk.GetPointAttr()) {
+            if (it.first != "points" && it.first != "normals" &&
+                it.first != "colors" && chunk.HasPointAttr(it.first)) {
+                names.push_back(it.first);
+            }
+        }
+        std::sort(names.begin(), names.end());
+        for (const std::string &name : names) {
+            const core::Tensor &attr = chunk.GetPointAttr(name);
+            if (attr.NumElements() != attr.GetLength()) {
+                utility::LogWarning(
+                        "Write PLY warning: skipping attribute \"{}\" with "
+                        "more than one value per point.",
+                        name);
+                continue;
+            }
+            add_columns(name, {name});
+        }
+        if (columns_.empty() || columns_[0].attr_name_ != "points") {
+            columns_.clear();
+            return false;
+        }
+
+        fprintf(file_, "ply\nformat %s 1.0\ncomment Created by Open3D\n",
+                write_ascii_ ? "ascii" : "binary_little_endian");
+        fprintf(file_, "element vertex ");
+        count_offset_ = ftell(file_);
+        fprintf(file_, "%0*d\n", kCountWidth, 0);
+        record_size_ = 0;
+        for (const PLYColumn &column : columns_) {
+            fprintf(file_, "property %s %s\n",
+                    GetPLYTypeName(column.dtype_).c_str(),
+                    column.name_.c_str());
+            record_size_ += column.dtype_.ByteSize();
+        }
+        return fprintf(file_, "end_header\n") > 0;
+    }
+
+    struct PLYColumn {
+        std::string name_;
+        std::string attr_name_;
+        int64_t column_;
+        core::Dtype dtype_;
+    };
+
+    /// Digits of the zero-padded vertex count.
+    static constexpr int kCountWidth = 20;
+
+    FILE *file_ = nullptr;
+    bool write_ascii_ = false;
+    std::vector<PLYColumn> columns_;
+    int64_t record_size_ = 0;
+    long count_offset_ = 0;
+    int64_t num_points_ = 0;
+};
+
+std::unique_ptr<PointCloudReader> CreatePLYPointCloudReader() {
+    return std::unique_ptr<PointCloudReader>(new PLYPointCloudReader());
+}
+
+std::unique_ptr<PointCloudWriter> CreatePLYPointCloudWriter() {
+    return std::unique_ptr<PointCloudWriter>(new PLYPointCloudWriter());
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
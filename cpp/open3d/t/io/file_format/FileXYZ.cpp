@@ -0,0 +1,261 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudStream.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Attributes stored in the columns of an xyz-style file, e.g. "points" in
+/// the first three and "normals" in the next three columns of xyzn files.
+using XYZColumns = std::vector<std::pair<std::string, int64_t>>;
+
+static bool GetXYZColumns(const std::string &format, XYZColumns &columns) {
+    if (format == "xyz") {
+        columns = {{"points", 3}};
+    } else if (format == "xyzn") {
+        columns = {{"points", 3}, {"normals", 3}};
+    } else if (format == "xyzrgb") {
+        columns = {{"points", 3}, {"colors", 3}};
+    } else if (format == "xyzi") {
+        columns = {{"points", 3}, {"intensities", 1}};
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// Streaming reader of xyz, xyzn, xyzrgb and xyzi files. Lines that do not
+/// hold enough values are skipped, as in the whole-file readers.
+class XYZPointCloudReader : public PointCloudReader {
+public:
+    XYZPointCloudReader(const XYZColumns &columns) : columns_(columns) {
+        for (const auto &column : columns_) {
+            num_values_ += column.second;
+        }
+    }
+    ~XYZPointCloudReader() override { Close(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename, "r");
+        if (file_ == nullptr) {
+            utility::LogWarning("Read XYZ failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        return true;
+    }
+
+    void Close() override {
+        if (file_ != nullptr) {
+            fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool IsEOF() const override {
+        if (file_ == nullptr) {
+            return true;
+        }
+        const int c = fgetc(file_);
+        if (c == EOF) {
+            return true;
+        }
+        ungetc(c, file_);
+        return false;
+    }
+
+    int64_t GetNumPoints() const override { return -1; }
+
+    bool ReadChunk(int64_t max_points, geometry::PointCloud &chunk) override {
+        if (file_ == nullptr) {
+            return false;
+        }
+        std::vector<double> values;
+        values.reserve(max_points * num_values_);
+        std::vector<double> line_values(num_values_);
+        char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+        int64_t num_points = 0;
+        while (num_points < max_points &&
+               fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file_)) {
+            const char *ptr = line_buffer;
+            int64_t k = 0;
+            for (; k < num_values_; k++) {
+                char *end;
+                line_values[k] = std::strtod(ptr, &end);
+                if (end == ptr) {
+                    break;
+                }
+                ptr = end;
+            }
+            if (k == num_values_) {
+                values.insert(values.end(), line_values.begin(),
+                              line_values.end());
+                num_points++;
+            }
+        }
+
+        chunk.Clear();
+        int64_t offset = 0;
+        for (const auto &column : columns_) {
+            core::Tensor tensor({num_points, column.second},
+                                core::Dtype::Float64);
+            double *ptr = tensor.GetDataPtr<double>();
+            for (int64_t i = 0; i < num_points; i++) {
+                for (int64_t k = 0; k < column.second; k++) {
+                    ptr[i * column.second + k] =
+                            values[i * num_values_ + offset + k];
+                }
+            }
+            chunk.SetPointAttr(column.first, tensor);
+            offset += column.second;
+        }
+        return !ferror(file_);
+    }
+
+private:
+    XYZColumns columns_;
+    int64_t num_values_ = 0;
+    FILE *file_ = nullptr;
+};
+
+/// Streaming writer of xyz, xyzn, xyzrgb and xyzi files.
+class XYZPointCloudWriter : public PointCloudWriter {
+public:
+    XYZPointCloudWriter(const XYZColumns &columns) : columns_(columns) {}
+    ~XYZPointCloudWriter() override { Close(); }
+
+    bool Open(const std::string &filename,
+              const WritePointCloudOption &params) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename, "w");
+        if (file_ == nullptr) {
+            utility::LogWarning("Write XYZ failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        return true;
+    }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (file_ == nullptr) {
+            return false;
+        }
+        const int64_t num_points =
+                chunk.HasPoints() ? chunk.GetPoints().GetLength() : 0;
+        std::vector<core::Tensor> tensors;
+        for (const auto &column : columns_) {
+            if (num_points > 0 && !chunk.HasPointAttr(column.first)) {
+                utility::LogWarning("Write XYZ failed: missing attribute {}.",
+                                    column.first);
+                return false;
+            }
+            if (num_points == 0) {
+                continue;
+            }
+            core::Tensor tensor = chunk.GetPointAttr(column.first)
+                                          .To(core::Device("CPU:0"))
+                                          .To(core::Dtype::Float64)
+                                          .Reshape({num_points, -1})
+                                          .Contiguous();
+            if (tensor.GetShape(1) != column.second) {
+                utility::LogWarning(
+                        "Write XYZ failed: attribute {} should have {:d} "
+                        "columns.",
+                        column.first, column.second);
+                return false;
+            }
+            tensors.push_back(tensor);
+        }
+        for (int64_t i = 0; i < num_points; i++) {
+            for (size_t c = 0; c < columns_.size(); c++) {
+                const double *ptr = tensors[c].GetDataPtr<double>() +
+                                    i * columns_[c].second;
+                for (int64_t k = 0; k < columns_[c].second; k++) {
+                    if (fprintf(file_, c == 0 && k == 0 ? "%.10f" : " %.10f",
+                                ptr[k]) < 0) {
+                        utility::LogWarning(
+                                "Write XYZ failed: unable to write file.");
+                        return false;
+                    }
+                }
+            }
+            fputc('\n', file_);
+        }
+        return true;
+    }
+
+    bool Close() override {
+        if (file_ == nullptr) {
+            return true;
+        }
+        const bool success = fclose(file_) == 0;
+        file_ = nullptr;
+        return success;
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+private:
+    XYZColumns columns_;
+    FILE *file_ = nullptr;
+};
+
+std::unique_ptr<PointCloudReader> CreateXYZPointCloudReader(
+        const std::string &format) {
+    XYZColumns columns;
+    if (!GetXYZColumns(format, columns)) {
+        return nullptr;
+    }
+    return std::unique_ptr<PointCloudReader>(new XYZPointCloudReader(columns));
+}
+
+std::unique_ptr<PointCloudWriter> CreateXYZPointCloudWriter(
+        const std::string &format) {
+    XYZColumns columns;
+    if (!GetXYZColumns(format, columns)) {
+        return nullptr;
+    }
+    return std::unique_ptr<PointCloudWriter>(new XYZPointCloudWriter(columns));
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
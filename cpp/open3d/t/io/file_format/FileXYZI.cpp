@@ -29,6 +29,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/FileASCIIRecords.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
@@ -45,46 +46,32 @@ open3d::io::FileGeometry ReadFileGeometryTypeXYZI(const std::string &path) {
 bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
-    try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
-            utility::LogWarning("Read XYZI failed: unable to open file: {}",
-                                filename);
-            return false;
-        }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
-
-        pointcloud.Clear();
-        core::Tensor points({num_points, 3}, core::Dtype::Float64);
-        core::Tensor intensities({num_points, 1}, core::Dtype::Float64);
-        double *points_ptr = points.GetDataPtr<double>();
-        double *intensities_ptr = intensities.GetDataPtr<double>();
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
-        pointcloud.SetPoints(points);
-        pointcloud.SetPointAttr("intensities", intensities);
-        reporter.Finish();
-
-        return true;
-    } catch (const std::exception &e) {
-        utility::LogWarning("Read XYZ failed with exception: {}", e.what());
+    utility::CountingProgressReporter reporter(params.update_progress);
+    std::vector<double> values;
+    if (!open3d::io::ReadASCIIRecords(filename, 0, 4, false, values,
+                                      reporter)) {
+        utility::LogWarning("Read XYZI failed: unable to open file: {}",
+                            filename);
         return false;
     }
+    int64_t num_points = static_cast<int64_t>(values.size() / 4);
+
+    pointcloud.Clear();
+    core::Tensor points({num_points, 3}, core::Dtype::Float64);
+    core::Tensor intensities({num_points, 1}, core::Dtype::Float64);
+    double *points_ptr = points.GetDataPtr<double>();
+    double *intensities_ptr = intensities.GetDataPtr<double>();
+    for (int64_t i = 0; i < num_points; i++) {
+        points_ptr[3 * i + 0] = values[4 * i + 0];
+        points_ptr[3 * i + 1] = values[4 * i + 1];
+        points_ptr[3 * i + 2] = values[4 * i + 2];
+        intensities_ptr[i] = values[4 * i + 3];
+    }
+    pointcloud.SetPoints(points);
+    pointcloud.SetPointAttr("intensities", intensities);
+    reporter.Finish();
+
+    return true;
 }
 
 bool WritePointCloudToXYZI(const std::string &filename,
@@ -42,6 +42,12 @@ bool RGBDVideoMetadata::ConvertToJsonValue(Json::Value &value) const {
     value["color_format"] = color_format_;
     value["depth_format"] = depth_format_;
     value["depth_scale"] = depth_scale_;
+    if (!distortion_coeffs_.empty()) {
+        value["distortion_coeffs"] = Json::Value(Json::arrayValue);
+        for (double k : distortion_coeffs_) {
+            value["distortion_coeffs"].append(k);
+        }
+    }
 
     value["stream_length_usec"] = stream_length_usec_;
     value["width"] = width_;
@@ -59,6 +65,10 @@ bool RGBDVideoMetadata::ConvertFromJsonValue(const Json::Value &value) {
     color_format_ = value["color_format"].asString();
     depth_format_ = value["depth_format"].asString();
     depth_scale_ = value["depth_scale"].asFloat();
+    distortion_coeffs_.clear();
+    for (const auto &k : value["distortion_coeffs"]) {
+        distortion_coeffs_.push_back(k.asDouble());
+    }
 
     stream_length_usec_ = value["stream_length_usec"].asUInt64();
     width_ = value["width"].asInt();
@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/utility/IJsonConvertible.h"
@@ -57,6 +60,10 @@ public:
     /// We assume depth image is always warped to the color image system.
     camera::PinholeCameraIntrinsic intrinsics_;
 
+    /// Brown-Conrady lens distortion coefficients (k1, k2, p1, p2, k3) of the
+    /// color camera. Empty for an undistorted stream.
+    std::vector<double> distortion_coeffs_;
+
     /// Capture device name.
     std::string device_name_ = "";
 
@@ -26,6 +26,7 @@
 
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 
+#include <algorithm>
 #include <string>
 
 #include "open3d/io/IJsonConvertibleIO.h"
@@ -94,6 +95,106 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
                      idx, frame_path);
 }
 
+t::geometry::RGBDImage RGBDVideoReader::NextFrame(const core::Device &device,
+                                                  uint64_t *timestamp) {
+    t::geometry::RGBDImage frame;
+    if (!IsPrefetching()) {
+        frame = NextFrame();
+        if (timestamp) *timestamp = GetTimestamp();
+        return frame.IsEmpty() ? frame : frame.To(device);
+    }
+
+    std::unique_lock<std::mutex> lock(prefetch_mutex_);
+    prefetch_cv_.wait(lock, [this] {
+        return !prefetch_queue_.empty() || prefetch_eof_;
+    });
+    if (prefetch_queue_.empty()) {
+        if (prefetch_error_) {
+            std::exception_ptr error = prefetch_error_;
+            prefetch_error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+        return frame;
+    }
+    frame = std::move(prefetch_queue_.front().first);
+    if (timestamp) *timestamp = prefetch_queue_.front().second;
+    prefetch_queue_.pop_front();
+    lock.unlock();
+    prefetch_cv_.notify_all();
+    return frame.To(device);
+}
+
+std::vector<t::geometry::RGBDImage> RGBDVideoReader::NextFrames(
+        size_t batch_size, const core::Device &device) {
+    std::vector<t::geometry::RGBDImage> frames;
+    frames.reserve(batch_size);
+    while (frames.size() < batch_size) {
+        t::geometry::RGBDImage frame = NextFrame(device);
+        if (frame.IsEmpty()) break;
+        frames.push_back(std::move(frame));
+    }
+    return frames;
+}
+
+void RGBDVideoReader::StartPrefetch(const core::Device &device,
+                                    size_t queue_size) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    StopPrefetch();
+    prefetch_device_ = device;
+    prefetch_queue_size_ = std::max<size_t>(queue_size, 1);
+    prefetch_stop_ = false;
+    prefetch_eof_ = false;
+    prefetch_error_ = nullptr;
+    prefetch_thread_ = std::thread(&RGBDVideoReader::PrefetchLoop, this);
+}
+
+void RGBDVideoReader::StopPrefetch() {
+    if (!prefetch_thread_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        prefetch_stop_ = true;
+    }
+    prefetch_cv_.notify_all();
+    prefetch_thread_.join();
+    prefetch_queue_.clear();
+}
+
+void RGBDVideoReader::PrefetchLoop() {
+    try {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(prefetch_mutex_);
+                prefetch_cv_.wait(lock, [this] {
+                    return prefetch_stop_ ||
+                           prefetch_queue_.size() < prefetch_queue_size_;
+                });
+                if (prefetch_stop_) break;
+            }
+            t::geometry::RGBDImage frame = NextFrame();
+            if (frame.IsEmpty()) break;
+            const uint64_t timestamp = GetTimestamp();
+            // The copy to the device is done here, so that it overlaps with
+            // the processing of the previous frames.
+            frame = frame.To(prefetch_device_);
+            {
+                std::lock_guard<std::mutex> lock(prefetch_mutex_);
+                prefetch_queue_.emplace_back(std::move(frame), timestamp);
+            }
+            prefetch_cv_.notify_all();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        prefetch_error_ = std::current_exception();
+    }
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        prefetch_eof_ = true;
+    }
+    prefetch_cv_.notify_all();
+}
+
 std::unique_ptr<RGBDVideoReader> RGBDVideoReader::Create(
         const std::string &filename) {
 #ifdef BUILD_LIBREALSENSE
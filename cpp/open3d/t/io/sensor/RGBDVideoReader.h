@@ -26,6 +26,15 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Device.h"
 #include "open3d/io/sensor/RGBDSensorConfig.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/io/sensor/RGBDVideoMetadata.h"
@@ -37,7 +46,9 @@ namespace io {
 class RGBDVideoReader {
 public:
     RGBDVideoReader() {}
-    virtual ~RGBDVideoReader() {}
+    /// Subclasses must call StopPrefetch() in their destructor, since the
+    /// prefetch thread calls their NextFrame().
+    virtual ~RGBDVideoReader() { StopPrefetch(); }
 
     /// Check If the RGBD video file is opened.
     virtual bool IsOpened() const = 0;
@@ -68,6 +79,35 @@ public:
     /// Get next frame from the RGBD video playback and returns the RGBD object.
     virtual t::geometry::RGBDImage NextFrame() = 0;
 
+    /// Get the next frame on \p device. While prefetching, the frame is taken
+    /// from the prefetch queue, and is already on the device if it is the
+    /// prefetch device.
+    ///
+    /// \param device Device of the returned frame.
+    /// \param timestamp (optional) Set to the timestamp (in us) of the frame.
+    /// \return The frame, or an empty RGBDImage at the end of the playback.
+    t::geometry::RGBDImage NextFrame(const core::Device &device,
+                                     uint64_t *timestamp = nullptr);
+
+    /// Get the next \p batch_size frames on \p device. Fewer frames are
+    /// returned at the end of the playback.
+    std::vector<t::geometry::RGBDImage> NextFrames(
+            size_t batch_size,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Start reading frames and copying them to \p device on a background
+    /// thread, up to \p queue_size frames ahead of NextFrame(device). Decoding
+    /// and the transfer to the device then overlap with the processing of the
+    /// previous frames. Frames must be read with NextFrame(device) or
+    /// NextFrames() while prefetching. Stop prefetching before seeking.
+    void StartPrefetch(const core::Device &device, size_t queue_size = 4);
+
+    /// Stop prefetching and discard the prefetched frames.
+    void StopPrefetch();
+
+    /// Check if frames are prefetched.
+    bool IsPrefetching() const { return prefetch_thread_.joinable(); }
+
     /// Save synchronized and aligned individual frames to subfolders.
     ///
     /// \param frame_path Frames will be stored in stream subfolders 'color' and
@@ -90,6 +130,20 @@ public:
 
     /// Factory function to create object based on RGBD video file type.
     static std::unique_ptr<RGBDVideoReader> Create(const std::string &filename);
+
+private:
+    void PrefetchLoop();
+
+    std::thread prefetch_thread_;
+    std::mutex prefetch_mutex_;
+    std::condition_variable prefetch_cv_;
+    /// Prefetched frames with their timestamps.
+    std::deque<std::pair<t::geometry::RGBDImage, uint64_t>> prefetch_queue_;
+    core::Device prefetch_device_;
+    size_t prefetch_queue_size_ = 0;
+    bool prefetch_stop_ = false;
+    bool prefetch_eof_ = false;
+    std::exception_ptr prefetch_error_;
 };
 
 }  // namespace io
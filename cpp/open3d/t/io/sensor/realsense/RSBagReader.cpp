@@ -28,7 +28,10 @@
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <chrono>
+#include <climits>
+#include <exception>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
@@ -48,12 +51,14 @@ namespace io {
 // See: https://github.com/intel-isl/Open3D/issues/3141
 const size_t RSBagReader::DEFAULT_BUFFER_SIZE;
 
-RSBagReader::RSBagReader(size_t buffer_size)
+RSBagReader::RSBagReader(size_t buffer_size, bool index_frames)
     : frame_buffer_(buffer_size),
       frame_position_us_(buffer_size),
-      pipe_(nullptr) {}
+      pipe_(nullptr),
+      index_frames_(index_frames) {}
 
 RSBagReader::~RSBagReader() {
+    StopPrefetch();
     if (IsOpened()) Close();
 }
 
@@ -61,6 +66,8 @@ bool RSBagReader::Open(const std::string &filename) {
     if (IsOpened()) {
         Close();
     }
+    if (filename != filename_) frame_index_.clear();
+    next_index_ = SIZE_MAX;
     try {
         rs2::config cfg;
         cfg.enable_device_from_file(filename, false);  // Do not repeat playback
@@ -83,6 +90,9 @@ bool RSBagReader::Open(const std::string &filename) {
         return false;
     }
     filename_ = filename;
+    if (index_frames_ && frame_index_.empty()) {
+        frame_index_ = IndexFrames(filename_);
+    }
     is_eof_ = false;
     is_opened_ = true;
     // Launch thread to keep frame_buffer full
@@ -91,6 +101,7 @@ bool RSBagReader::Open(const std::string &filename) {
 }
 
 void RSBagReader::Close() {
+    StopPrefetch();
     is_opened_ = false;
     need_frames_.notify_one();
     frame_reader_thread_.join();
@@ -117,7 +128,10 @@ void RSBagReader::fill_frame_buffer() try {
                 "frame_reader_thread_ start reading tail_fid_={}, "
                 "head_fid_={}.",
                 tail_fid_, head_fid_);
-        while (!is_eof_ && head_fid_ < tail_fid_ + frame_buffer_.size()) {
+        // A pending seek is served even if the buffer is full, since it
+        // invalidates the buffer.
+        while (!is_eof_ && (seek_to_ < UINT64_MAX ||
+                            head_fid_ < tail_fid_ + frame_buffer_.size())) {
             if (seek_to_ < UINT64_MAX) {
                 utility::LogDebug("frame_reader_thread_ seek to {}us",
                                   seek_to_);
@@ -141,15 +155,16 @@ void RSBagReader::fill_frame_buffer() try {
 
                 frames = align_to_color.process(frames);
                 const auto &color_frame = frames.get_color_frame();
-                // Copy frame data to Tensors
-                current_frame.color_ = core::Tensor(
-                        static_cast<const uint8_t *>(color_frame.get_data()),
+                // Copy frame data to page-locked Tensors, such that they can be
+                // copied asynchronously to CUDA devices.
+                current_frame.color_ = CopyToPinnedTensor(
+                        color_frame.get_data(),
                         {color_frame.get_height(), color_frame.get_width(),
                          metadata_.color_channels_},
                         metadata_.color_dt_);
                 const auto &depth_frame = frames.get_depth_frame();
-                current_frame.depth_ = core::Tensor(
-                        static_cast<const uint16_t *>(depth_frame.get_data()),
+                current_frame.depth_ = CopyToPinnedTensor(
+                        depth_frame.get_data(),
                         {depth_frame.get_height(), depth_frame.get_width()},
                         metadata_.depth_dt_);
                 frame_position_us_[head_fid_ % frame_buffer_.size()] =
@@ -168,7 +183,7 @@ void RSBagReader::fill_frame_buffer() try {
                 "frame_reader_thread pause reading tail_fid_={}, head_fid_={}",
                 tail_fid_, head_fid_);
         need_frames_.wait(lock, [this] {
-            return !is_opened_ ||
+            return !is_opened_ || seek_to_ < UINT64_MAX ||
                    head_fid_ < tail_fid_ + frame_buffer_.size() /
                                                    BUFFER_REFILL_FACTOR;
         });
@@ -190,9 +205,9 @@ t::geometry::RGBDImage RSBagReader::NextFrame() {
         head_fid_ < tail_fid_ + frame_buffer_.size() / BUFFER_REFILL_FACTOR)
         need_frames_.notify_one();
 
-    while (!is_eof_ &&
-           tail_fid_ ==
-                   head_fid_) {  // (rare) spin wait for frame_reader_thread_
+    // (rare) spin wait for frame_reader_thread_, or for a pending seek, since
+    // the buffered frames are stale.
+    while (!is_eof_ && (tail_fid_ == head_fid_ || seek_to_ < UINT64_MAX)) {
         std::this_thread::sleep_for(
                 std::chrono::duration<double>(1 / metadata_.fps_));
     }
@@ -200,6 +215,7 @@ t::geometry::RGBDImage RSBagReader::NextFrame() {
         utility::LogInfo("EOF reached");
         return t::geometry::RGBDImage();
     } else {
+        if (next_index_ != SIZE_MAX) ++next_index_;
         return frame_buffer_[(tail_fid_++) %  // atomic
                              frame_buffer_.size()];
     }
@@ -216,6 +232,7 @@ bool RSBagReader::SeekTimestamp(uint64_t timestamp) {
         return false;
     }
     seek_to_ = timestamp;  // atomic
+    next_index_ = SIZE_MAX;
     if (is_eof_) {
         Open(filename_);  // EOF requires restarting pipeline.
     } else {
@@ -234,6 +251,139 @@ uint64_t RSBagReader::GetTimestamp() const {
                    : frame_position_us_[(tail_fid_ - 1) % frame_buffer_.size()];
 }
 
+std::vector<uint64_t> RSBagReader::IndexFrames(const std::string &filename) {
+    std::vector<uint64_t> frame_index;
+    try {
+        rs2::context ctx;
+        rs2::playback playback = ctx.load_device(filename);
+        // Frames are released immediately, so the playback does not stall.
+        playback.set_real_time(false);
+        std::mutex mutex;
+        std::condition_variable stopped_cv;
+        bool playing = false, stopped = false;
+        playback.set_status_changed_callback([&](rs2_playback_status status) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (status == RS2_PLAYBACK_STATUS_PLAYING) {
+                playing = true;
+            } else if (status == RS2_PLAYBACK_STATUS_STOPPED && playing) {
+                stopped = true;
+                stopped_cv.notify_one();
+            }
+        });
+        unsigned long long last_frame_number = ULLONG_MAX;
+        for (auto &&sensor : playback.query_sensors()) {
+            for (auto &&profile : sensor.get_stream_profiles()) {
+                if (profile.stream_type() != RS2_STREAM_COLOR) continue;
+                sensor.open(profile);
+                sensor.start([&](rs2::frame frame) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (frame.get_frame_number() == last_frame_number) return;
+                    last_frame_number = frame.get_frame_number();
+                    // Convert nanoseconds -> microseconds
+                    frame_index.push_back(playback.get_position() / 1000);
+                });
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    stopped_cv.wait(lock, [&stopped] { return stopped; });
+                }
+                sensor.stop();
+                sensor.close();
+                return frame_index;
+            }
+        }
+        utility::LogWarning("No color stream in file {}", filename);
+    } catch (const rs2::error &e) {
+        utility::LogError("Unable to index file {}: {}: {}", filename,
+                          rs2_exception_type_to_string(e.get_type()),
+                          e.what());
+    }
+    return frame_index;
+}
+
+std::vector<t::geometry::RGBDImage> RSBagReader::ReadFrames(size_t start,
+                                                            size_t count) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (frame_index_.empty()) frame_index_ = IndexFrames(filename_);
+    std::vector<t::geometry::RGBDImage> frames;
+    if (start >= frame_index_.size()) return frames;
+    count = std::min(count, frame_index_.size() - start);
+    if (start != next_index_) {
+        // Seek half a frame interval early, in case the frame is decoded
+        // slightly before its indexed position. Earlier frames are skipped.
+        const uint64_t half_frame_us =
+                static_cast<uint64_t>(0.5e6 / metadata_.fps_);
+        const uint64_t position = frame_index_[start];
+        const uint64_t seek_to =
+                position > half_frame_us ? position - half_frame_us : 0;
+        if (!SeekTimestamp(seek_to)) return frames;
+        t::geometry::RGBDImage frame;
+        do {
+            frame = NextFrame();
+        } while (!frame.IsEmpty() && GetTimestamp() < seek_to);
+        if (frame.IsEmpty()) return frames;
+        frames.push_back(frame);
+        next_index_ = start + 1;
+    }
+    frames.reserve(count);
+    while (frames.size() < count) {
+        t::geometry::RGBDImage frame = NextFrame();
+        if (frame.IsEmpty()) break;
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+void RSBagReader::ReadFramesParallel(const std::string &filename,
+                                     const FrameCallback &callback,
+                                     size_t num_readers,
+                                     size_t start,
+                                     size_t count) {
+    const std::vector<uint64_t> frame_index = IndexFrames(filename);
+    if (start >= frame_index.size()) return;
+    count = std::min(count, frame_index.size() - start);
+    if (num_readers == 0) {
+        num_readers = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    num_readers = std::min(num_readers, count);
+
+    std::mutex mutex;
+    std::exception_ptr exception;
+    std::vector<std::thread> threads;
+    for (size_t r = 0; r < num_readers; ++r) {
+        const size_t begin = start + count * r / num_readers;
+        const size_t end = start + count * (r + 1) / num_readers;
+        threads.emplace_back([&, begin, end] {
+            try {
+                RSBagReader reader;
+                if (!reader.Open(filename)) {
+                    utility::LogError("Unable to open file {}", filename);
+                }
+                reader.SetFrameIndex(frame_index);
+                // Read in batches of the buffer size to bound memory use.
+                for (size_t fid = begin; fid < end;) {
+                    const size_t batch =
+                            std::min(end - fid, DEFAULT_BUFFER_SIZE);
+                    const auto frames = reader.ReadFrames(fid, batch);
+                    for (size_t k = 0; k < frames.size(); ++k) {
+                        callback(fid + k, frames[k]);
+                    }
+                    if (frames.size() < batch) break;
+                    fid += batch;
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!exception) exception = std::current_exception();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    if (exception) std::rethrow_exception(exception);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -28,6 +28,8 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -68,11 +70,18 @@ class RSBagReader : public RGBDVideoReader {
 public:
     static const size_t DEFAULT_BUFFER_SIZE = 32;
 
+    /// Callback receiving the index of a frame in the frame index and the
+    /// frame.
+    using FrameCallback =
+            std::function<void(size_t, const t::geometry::RGBDImage &)>;
+
     /// Constructor
     ///
     /// \param buffer_size (optional) Max number of frames to store in the frame
     /// buffer
-    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    /// \param index_frames (optional) Build the frame index in Open().
+    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                         bool index_frames = false);
 
     RSBagReader(const RSBagReader &) = delete;
     RSBagReader &operator=(const RSBagReader &) = delete;
@@ -114,6 +123,52 @@ public:
     /// Return filename being read
     virtual std::string GetFilename() const override { return filename_; };
 
+    /// Index the playback positions (in us) of all color frames of a bag file.
+    ///
+    /// The file is played back once as fast as possible, without aligning or
+    /// copying frames.
+    /// \param filename Path to the RSBag file.
+    static std::vector<uint64_t> IndexFrames(const std::string &filename);
+
+    /// Get the frame index of the opened file. The index is empty until it is
+    /// built by Open() or ReadFrames(), or set with SetFrameIndex().
+    const std::vector<uint64_t> &GetFrameIndex() const { return frame_index_; }
+
+    /// Use a frame index built for the same file, e.g. by another reader. The
+    /// index is kept if the same file is opened again.
+    void SetFrameIndex(const std::vector<uint64_t> &frame_index) {
+        frame_index_ = frame_index;
+    }
+
+    /// Read \p count consecutive frames, starting with frame \p start of the
+    /// frame index. The index is built first if it is empty. Reading
+    /// continues without a seek if \p start follows the last frame read.
+    ///
+    /// \param start Index of the first frame.
+    /// \param count Max number of frames. Fewer frames are returned at the end
+    /// of the file.
+    std::vector<t::geometry::RGBDImage> ReadFrames(size_t start, size_t count);
+
+    /// Read frames of a bag file in parallel.
+    ///
+    /// The frame range is split into \p num_readers contiguous slices, each
+    /// read by a separate reader instance on its own thread. The frame index
+    /// is built once and shared by the readers. \p callback is called
+    /// concurrently from the reader threads, in increasing frame order within
+    /// a slice. Exceptions thrown by a reader are rethrown here.
+    /// \param filename Path to the RSBag file.
+    /// \param callback Called with each frame and its index.
+    /// \param num_readers Number of reader instances. 0 uses one per
+    /// hardware thread.
+    /// \param start Index of the first frame.
+    /// \param count Max number of frames.
+    static void ReadFramesParallel(const std::string &filename,
+                                   const FrameCallback &callback,
+                                   size_t num_readers = 0,
+                                   size_t start = 0,
+                                   size_t count = SIZE_MAX);
+
+    using RGBDVideoReader::NextFrame;
     using RGBDVideoReader::SaveFrames;
     using RGBDVideoReader::ToString;
 
@@ -152,6 +207,12 @@ private:
 
     std::unique_ptr<rs2::pipeline> pipe_;
 
+    bool index_frames_ = false;
+    /// Playback positions (in us) of the color frames.
+    std::vector<uint64_t> frame_index_;
+    /// Position in frame_index_ of the next frame returned by ReadFrames().
+    size_t next_index_ = SIZE_MAX;
+
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
 };
@@ -30,6 +30,7 @@
 
 #include <librealsense2/rs.hpp>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/io/IJsonConvertibleIO.h"
 
 namespace open3d {
@@ -42,6 +43,21 @@ DECLARE_STRINGIFY_ENUM(rs2_l500_visual_preset)
 DECLARE_STRINGIFY_ENUM(rs2_rs400_visual_preset)
 DECLARE_STRINGIFY_ENUM(rs2_sr300_visual_preset)
 
+/// Copies a RealSense frame buffer to a new page-locked (pinned) CPU tensor,
+/// such that the frame can be queued for an asynchronous copy to a CUDA
+/// device. The pinned allocations are cached, so the buffer of a released
+/// frame is reused by the following frames of the same size.
+core::Tensor CopyToPinnedTensor(const void *data,
+                                const core::SizeVector &shape,
+                                core::Dtype dtype);
+
+/// Wraps the buffer of a RealSense frame in a CPU tensor without copying. The
+/// tensor holds a reference to the frame, which is returned to the librealsense
+/// frame pool only when the tensor and all its views are released.
+core::Tensor WrapFrame(const rs2::frame &frame,
+                       const core::SizeVector &shape,
+                       core::Dtype dtype);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
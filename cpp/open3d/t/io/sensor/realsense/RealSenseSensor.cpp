@@ -28,10 +28,12 @@
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "open3d/core/EigenConverter.h"
 #include "open3d/t/io/sensor/realsense/RealSensePrivate.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
@@ -277,6 +279,10 @@ geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
         utility::LogError("Please StartCapture() first.");
         return geometry::RGBDImage();
     }
+    if (capture_thread_.joinable()) {
+        utility::LogError(
+                "Asynchronous capture in progress, use NextFrame() instead.");
+    }
     try {
         rs2::frameset frames;
         if (!((wait && pipe_->try_wait_for_frames(&frames)) ||
@@ -284,16 +290,17 @@ geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
             return geometry::RGBDImage();
         if (align_depth_to_color) frames = align_to_color_->process(frames);
         timestamp_ = uint64_t(frames.get_timestamp() * MILLISEC_TO_MICROSEC);
-        // Copy frame data to Tensors
+        // Copy frame data to page-locked Tensors, such that they can be
+        // copied asynchronously to CUDA devices.
         const auto& color_frame = frames.get_color_frame();
-        current_frame_.color_ = core::Tensor(
-                static_cast<const uint8_t*>(color_frame.get_data()),
+        current_frame_.color_ = CopyToPinnedTensor(
+                color_frame.get_data(),
                 {color_frame.get_height(), color_frame.get_width(),
                  metadata_.color_channels_},
                 metadata_.color_dt_);
         const auto& depth_frame = frames.get_depth_frame();
-        current_frame_.depth_ = core::Tensor(
-                static_cast<const uint16_t*>(depth_frame.get_data()),
+        current_frame_.depth_ = CopyToPinnedTensor(
+                depth_frame.get_data(),
                 {depth_frame.get_height(), depth_frame.get_width()},
                 metadata_.depth_dt_);
         return current_frame_;
@@ -304,7 +311,211 @@ geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
     }
 }
 
+geometry::PointCloud RealSenseSensor::CapturePointCloud(bool wait,
+                                                        float depth_max,
+                                                        int stride) {
+    const geometry::RGBDImage frame =
+            CaptureFrame(wait, /*align_depth_to_color=*/true);
+    if (frame.IsEmpty()) {
+        return geometry::PointCloud();
+    }
+    const core::Tensor intrinsics = core::eigen_converter::EigenMatrixToTensor(
+            metadata_.intrinsics_.intrinsic_matrix_);
+    return geometry::PointCloud::CreateFromRGBDImage(
+            frame, intrinsics,
+            core::Tensor::Eye(4, core::Dtype::Float32, core::Device("CPU:0")),
+            static_cast<float>(metadata_.depth_scale_), depth_max, stride,
+            metadata_.distortion_coeffs_);
+}
+
+bool RealSenseSensor::StartAsyncCapture(const RealSenseCaptureOption& option,
+                                        const FrameCallback& callback,
+                                        bool start_record) {
+    if (capture_thread_.joinable()) {
+        utility::LogWarning("Asynchronous capture already in progress.");
+        return true;
+    }
+    if (is_capturing_) {
+        utility::LogError(
+                "Synchronous capture in progress, please StopCapture() first.");
+    }
+    if (!StartCapture(start_record)) return false;
+    capture_option_ = option;
+    capture_option_.queue_size = std::max<size_t>(option.queue_size, 1);
+    frame_callback_ = callback;
+    if (capture_option_.align_depth_to_color &&
+        capture_option_.device.GetType() == core::Device::DeviceType::CUDA) {
+        try {
+            const auto profile = pipe_->get_active_profile();
+            const auto depth_profile = profile.get_stream(RS2_STREAM_DEPTH)
+                                               .as<rs2::video_stream_profile>();
+            const auto color_profile = profile.get_stream(RS2_STREAM_COLOR)
+                                               .as<rs2::video_stream_profile>();
+            const rs2_intrinsics di = depth_profile.get_intrinsics();
+            depth_intrinsics_ = core::Tensor::Init<double>(
+                    {{di.fx, 0, di.ppx}, {0, di.fy, di.ppy}, {0, 0, 1}});
+            color_intrinsics_ = core::eigen_converter::EigenMatrixToTensor(
+                    metadata_.intrinsics_.intrinsic_matrix_);
+            // librealsense stores the rotation in column-major order.
+            const rs2_extrinsics ex =
+                    depth_profile.get_extrinsics_to(color_profile);
+            std::vector<double> depth_to_color{0, 0, 0, 0, 0, 0, 0, 0,
+                                               0, 0, 0, 0, 0, 0, 0, 1};
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    depth_to_color[r * 4 + c] = ex.rotation[c * 3 + r];
+                }
+                depth_to_color[r * 4 + 3] = ex.translation[r];
+            }
+            depth_to_color_ = core::Tensor(depth_to_color, {4, 4},
+                                           core::Dtype::Float64);
+        } catch (const rs2::error& e) {
+            StopCapture();
+            utility::LogError("StartAsyncCapture() failed: {}: {}",
+                              rs2_exception_type_to_string(e.get_type()),
+                              e.what());
+            return false;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = false;
+        exception_ = nullptr;
+        frames_.clear();
+        dropped_frames_ = 0;
+    }
+    capture_thread_ = std::thread(&RealSenseSensor::CaptureLoop, this);
+    return true;
+}
+
+bool RealSenseSensor::NextFrame(geometry::RGBDImage& rgbd,
+                                uint64_t* timestamp,
+                                bool wait) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (wait) {
+        frame_ready_.wait(lock, [this] {
+            return !frames_.empty() || exception_ || stop_ ||
+                   !capture_thread_.joinable();
+        });
+    }
+    if (frames_.empty()) {
+        if (exception_) {
+            std::exception_ptr exception = exception_;
+            exception_ = nullptr;
+            std::rethrow_exception(exception);
+        }
+        return false;
+    }
+    rgbd = std::move(frames_.front().first);
+    timestamp_ = frames_.front().second;
+    if (timestamp) *timestamp = timestamp_;
+    frames_.pop_front();
+    return true;
+}
+
+size_t RealSenseSensor::GetDroppedFrameCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_frames_;
+}
+
+void RealSenseSensor::CaptureLoop() {
+    try {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (stop_) return;
+            }
+            rs2::frameset frames;
+            // Time out regularly to check for a stop request.
+            if (!pipe_->try_wait_for_frames(&frames, 100)) continue;
+            const uint64_t timestamp =
+                    uint64_t(frames.get_timestamp() * MILLISEC_TO_MICROSEC);
+            geometry::RGBDImage rgbd = ProcessFrames(frames);
+            if (frame_callback_) {
+                frame_callback_(rgbd, timestamp);
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (frames_.size() >= capture_option_.queue_size) {
+                frames_.pop_front();
+                ++dropped_frames_;
+            }
+            frames_.emplace_back(std::move(rgbd), timestamp);
+            frame_ready_.notify_one();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exception_ = std::current_exception();
+        frame_ready_.notify_all();
+    }
+}
+
+geometry::RGBDImage RealSenseSensor::ProcessFrames(rs2::frameset& frames) {
+    const core::Device& device = capture_option_.device;
+    const bool is_cuda = device.GetType() == core::Device::DeviceType::CUDA;
+    if (capture_option_.align_depth_to_color && !is_cuda) {
+        frames = align_to_color_->process(frames);
+    }
+    // Wrapped frames stay on the CPU. Copies go to page-locked memory, such
+    // that the upload to a CUDA device is asynchronous.
+    const bool zero_copy = capture_option_.zero_copy && !is_cuda;
+    const auto to_tensor = [zero_copy](const rs2::frame& frame,
+                                       const core::SizeVector& shape,
+                                       core::Dtype dtype) {
+        return zero_copy ? WrapFrame(frame, shape, dtype)
+                         : CopyToPinnedTensor(frame.get_data(), shape, dtype);
+    };
+    const rs2::video_frame color_frame = frames.get_color_frame();
+    const rs2::depth_frame depth_frame = frames.get_depth_frame();
+    core::Tensor color =
+            to_tensor(color_frame,
+                      {color_frame.get_height(), color_frame.get_width(),
+                       metadata_.color_channels_},
+                      metadata_.color_dt_)
+                    .To(device);
+    core::Tensor depth =
+            to_tensor(depth_frame,
+                      {depth_frame.get_height(), depth_frame.get_width()},
+                      metadata_.depth_dt_)
+                    .To(device);
+
+    if (capture_option_.convert_to_rgb) {
+        const std::string& format = metadata_.color_format_;
+        core::Tensor channels;
+        if (format == "BGR8" || format == "BGRA8") {
+            channels = core::Tensor::Init<int64_t>({2, 1, 0}, device);
+        } else if (format == "RGBA8") {
+            channels = core::Tensor::Init<int64_t>({0, 1, 2}, device);
+        }
+        if (channels.NumElements() > 0) {
+            color = color.GetItem(
+                    {core::TensorKey::Slice(core::None, core::None, core::None),
+                     core::TensorKey::Slice(core::None, core::None, core::None),
+                     core::TensorKey::IndexTensor(channels)});
+        }
+    }
+
+    geometry::RGBDImage rgbd{geometry::Image(color), geometry::Image(depth),
+                             capture_option_.align_depth_to_color};
+    if (capture_option_.align_depth_to_color && is_cuda) {
+        rgbd.depth_ = rgbd.depth_.AlignDepth(
+                color.GetShape(0), color.GetShape(1), depth_intrinsics_,
+                color_intrinsics_, depth_to_color_,
+                static_cast<float>(metadata_.depth_scale_));
+    }
+    return rgbd;
+}
+
 void RealSenseSensor::StopCapture() {
+    if (capture_thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        frame_ready_.notify_all();
+        capture_thread_.join();
+        frame_callback_ = nullptr;
+    }
     if (is_capturing_) {
         pipe_->stop();
         is_recording_ = false;
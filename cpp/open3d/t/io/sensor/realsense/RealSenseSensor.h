@@ -26,8 +26,16 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
 #include "open3d/t/io/sensor/RGBDVideoMetadata.h"
@@ -37,12 +45,34 @@ namespace rs2 {
 class pipeline;
 class align;
 class config;
+class frameset;
 }  // namespace rs2
 
 namespace open3d {
 namespace t {
 namespace io {
 
+/// Options for RealSenseSensor::StartAsyncCapture().
+struct RealSenseCaptureOption {
+    /// Number of frames buffered between the capture thread and the consumer.
+    /// When the buffer is full, the oldest frame is dropped, so that the
+    /// capture thread never waits for the consumer.
+    size_t queue_size = 4;
+    /// Align the depth image to the color image. The alignment runs on \p
+    /// device if it is a CUDA device, else on the CPU with librealsense.
+    bool align_depth_to_color = true;
+    /// Wrap the librealsense frame buffers in the returned images instead of
+    /// copying them to pinned memory. The frames are returned to librealsense
+    /// only when the images are released, so buffered and held frames count
+    /// against the librealsense frame queue. Only used with CPU alignment (or
+    /// none) and a CPU \p device.
+    bool zero_copy = false;
+    /// Convert BGR8, BGRA8 and RGBA8 color frames to RGB8.
+    bool convert_to_rgb = true;
+    /// Device the frames are delivered on.
+    core::Device device = core::Device("CPU:0");
+};
+
 /// RealSense camera discovery, configuration, streaming and recording
 class RealSenseSensor : public RGBDSensor {
 public:
@@ -111,6 +141,52 @@ public:
     virtual geometry::RGBDImage CaptureFrame(
             bool wait = true, bool align_depth_to_color = true) override;
 
+    /// Acquire the next synchronized RGBD frameset from the camera and
+    /// unproject it to a colored point cloud, with the intrinsics, lens
+    /// distortion and depth scale of the stream. The depth is aligned to the
+    /// color image, and the frame is unprojected on the CPU in a single pass.
+    ///
+    /// \param wait If true wait for the next frame set, else return immediately
+    /// with an empty PointCloud if it is not yet available.
+    /// \param depth_max Points at \p depth_max or farther are dropped.
+    /// \param stride Only pixels whose coordinates are multiples of \p stride
+    /// are unprojected.
+    geometry::PointCloud CapturePointCloud(bool wait = true,
+                                           float depth_max = 3.0f,
+                                           int stride = 1);
+
+    /// Callback receiving a frame and its timestamp (in us).
+    using FrameCallback =
+            std::function<void(const geometry::RGBDImage &, uint64_t)>;
+
+    /// Start capturing frames on a background thread.
+    ///
+    /// Frames are aligned, converted and copied to \p option.device on the
+    /// capture thread. Each frame is passed to \p callback if one is given,
+    /// else it is buffered for NextFrame(). The callback runs on the capture
+    /// thread, and frames arriving meanwhile are dropped by librealsense.
+    /// \param option Capture options.
+    /// \param callback Called for every captured frame.
+    /// \param start_record Start recording to the bag file as well.
+    bool StartAsyncCapture(
+            const RealSenseCaptureOption &option = RealSenseCaptureOption(),
+            const FrameCallback &callback = nullptr,
+            bool start_record = false);
+
+    /// Get the oldest buffered frame of an asynchronous capture.
+    ///
+    /// Exceptions thrown on the capture thread are rethrown here.
+    /// \param rgbd The frame.
+    /// \param timestamp If not null, the timestamp of the frame (in us).
+    /// \param wait If true wait for a frame, else return immediately.
+    /// \return true if a frame was returned.
+    bool NextFrame(geometry::RGBDImage &rgbd,
+                   uint64_t *timestamp = nullptr,
+                   bool wait = true);
+
+    /// Number of frames dropped because the frame buffer was full.
+    size_t GetDroppedFrameCount() const;
+
     /// Get current timestamp (in us)
     ///
     /// See
@@ -144,6 +220,25 @@ private:
     std::unique_ptr<rs2::align> align_to_color_;
     std::unique_ptr<rs2::config> rs_config_;
 
+    /// Asynchronous capture.
+    void CaptureLoop();
+    geometry::RGBDImage ProcessFrames(rs2::frameset &frames);
+
+    RealSenseCaptureOption capture_option_;
+    FrameCallback frame_callback_;
+    /// Depth and color intrinsics and the depth to color extrinsics, for the
+    /// CUDA alignment.
+    core::Tensor depth_intrinsics_;
+    core::Tensor color_intrinsics_;
+    core::Tensor depth_to_color_;
+    mutable std::mutex mutex_;
+    std::condition_variable frame_ready_;
+    std::deque<std::pair<geometry::RGBDImage, uint64_t>> frames_;
+    size_t dropped_frames_ = 0;
+    bool stop_ = false;
+    std::exception_ptr exception_;
+    std::thread capture_thread_;
+
     static const uint64_t MILLISEC_TO_MICROSEC = 1000;
 };
 
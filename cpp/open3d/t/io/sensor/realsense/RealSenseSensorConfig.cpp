@@ -29,6 +29,7 @@
 #include <json/json.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <map>
 #include <set>
 #include <string>
@@ -154,6 +155,25 @@ std::pair<core::Dtype, uint8_t> RealSenseSensorConfig::get_dtype_channels(
             format_channels.at(static_cast<rs2_format>(rs2_format_enum)));
 }
 
+core::Tensor CopyToPinnedTensor(const void *data,
+                                const core::SizeVector &shape,
+                                core::Dtype dtype) {
+    core::Tensor tensor = core::Tensor::EmptyPinned(shape, dtype);
+    std::memcpy(tensor.GetDataPtr(), data,
+                tensor.NumElements() * dtype.ByteSize());
+    return tensor;
+}
+
+core::Tensor WrapFrame(const rs2::frame &frame,
+                       const core::SizeVector &shape,
+                       core::Dtype dtype) {
+    void *data_ptr = const_cast<void *>(frame.get_data());
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"), data_ptr,
+                                             [frame](void *) {});
+    return core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                        data_ptr, dtype, blob);
+}
+
 static std::unordered_map<std::string, std::string> standard_config{
         {"serial", ""},
         {"color_format", "RS2_FORMAT_ANY"},
@@ -261,8 +281,21 @@ Json::Value RealSenseSensorConfig::GetMetadataJson(
     camera::PinholeCameraIntrinsic pinhole_camera;
     pinhole_camera.SetIntrinsics(rgb_intr.width, rgb_intr.height, rgb_intr.fx,
                                  rgb_intr.fy, rgb_intr.ppx, rgb_intr.ppy);
-    // TODO: Add support for distortion
     pinhole_camera.ConvertToJsonValue(value);
+    // librealsense deprojects Brown-Conrady pixels by inverting the
+    // distortion, which is what the undistortion map of the point cloud
+    // factories computes. Other models are left undistorted.
+    if (rgb_intr.model == RS2_DISTORTION_BROWN_CONRADY) {
+        value["distortion_coeffs"] = Json::Value(Json::arrayValue);
+        for (float k : rgb_intr.coeffs) {
+            value["distortion_coeffs"].append(k);
+        }
+    } else if (rgb_intr.model != RS2_DISTORTION_NONE) {
+        utility::LogWarning(
+                "Color stream distortion model {} is not supported and will "
+                "be ignored.",
+                rs2_distortion_to_string(rgb_intr.model));
+    }
 
     value["device_name"] = rs_device.get_info(RS2_CAMERA_INFO_NAME);
     value["serial_number"] = rs_device.get_info(RS2_CAMERA_INFO_SERIAL_NUMBER);
@@ -37,7 +37,8 @@ core::Tensor ComputePosePointToPlane(
         const core::Tensor &source_points,
         const core::Tensor &target_points,
         const core::Tensor &target_normals,
-        const pipelines::registration::CorrespondenceSet &corres) {
+        const pipelines::registration::CorrespondenceSet &corres,
+        const pipelines::registration::RobustKernel &kernel) {
     // Get dtype and device.
     core::Dtype dtype = core::Dtype::Float32;
     core::Device device = source_points.GetDevice();
@@ -75,12 +76,95 @@ core::Tensor ComputePosePointToPlane(
     if (device_type == core::Device::DeviceType::CPU) {
         ComputePosePointToPlaneCPU(source_points_ptr, target_points_ptr,
                                    target_normals_ptr, corres_first,
-                                   corres_second, n, pose, dtype, device);
+                                   corres_second, n, pose, kernel, dtype,
+                                   device);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         ComputePosePointToPlaneCUDA(source_points_ptr, target_points_ptr,
                                     target_normals_ptr, corres_first,
-                                    corres_second, n, pose, dtype, device);
+                                    corres_second, n, pose, kernel, dtype,
+                                   device);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+    return pose;
+}
+
+core::Tensor ComputePoseColoredICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const pipelines::registration::CorrespondenceSet &corres,
+        const pipelines::registration::RobustKernel &kernel,
+        const double &lambda_geometric) {
+    // Get dtype and device.
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = source_points.GetDevice();
+
+    // Checks.
+    source_points.AssertDtype(dtype);
+    source_colors.AssertDtype(dtype);
+    target_points.AssertDtype(dtype);
+    target_normals.AssertDtype(dtype);
+    target_colors.AssertDtype(dtype);
+    target_color_gradients.AssertDtype(dtype);
+    source_colors.AssertDevice(device);
+    target_points.AssertDevice(device);
+    target_normals.AssertDevice(device);
+    target_colors.AssertDevice(device);
+    target_color_gradients.AssertDevice(device);
+
+    // Pose {6,} tensor [ouput].
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64, device);
+    // Number of correspondences.
+    int n = corres.first.GetLength();
+
+    core::Tensor source_points_contiguous = source_points.Contiguous();
+    core::Tensor source_colors_contiguous = source_colors.Contiguous();
+    core::Tensor target_points_contiguous = target_points.Contiguous();
+    core::Tensor target_normals_contiguous = target_normals.Contiguous();
+    core::Tensor target_colors_contiguous = target_colors.Contiguous();
+    core::Tensor target_color_gradients_contiguous =
+            target_color_gradients.Contiguous();
+    core::Tensor corres_first_contiguous = corres.first.Contiguous();
+    core::Tensor corres_second_contiguous = corres.second.Contiguous();
+
+    const float *source_points_ptr =
+            source_points_contiguous.GetDataPtr<float>();
+    const float *source_colors_ptr =
+            source_colors_contiguous.GetDataPtr<float>();
+    const float *target_points_ptr =
+            target_points_contiguous.GetDataPtr<float>();
+    const float *target_normals_ptr =
+            target_normals_contiguous.GetDataPtr<float>();
+    const float *target_colors_ptr =
+            target_colors_contiguous.GetDataPtr<float>();
+    const float *target_color_gradients_ptr =
+            target_color_gradients_contiguous.GetDataPtr<float>();
+    const int64_t *corres_first = corres_first_contiguous.GetDataPtr<int64_t>();
+    const int64_t *corres_second =
+            corres_second_contiguous.GetDataPtr<int64_t>();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePoseColoredICPCPU(
+                source_points_ptr, source_colors_ptr, target_points_ptr,
+                target_normals_ptr, target_colors_ptr,
+                target_color_gradients_ptr, corres_first, corres_second, n,
+                pose, kernel, lambda_geometric, dtype, device);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputePoseColoredICPCUDA(
+                source_points_ptr, source_colors_ptr, target_points_ptr,
+                target_normals_ptr, target_colors_ptr,
+                target_color_gradients_ptr, corres_first, corres_second, n,
+                pose, kernel, lambda_geometric, dtype, device);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
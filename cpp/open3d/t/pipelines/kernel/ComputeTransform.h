@@ -40,12 +40,39 @@ namespace kernel {
 /// \param target_normals target normals indexed according to correspondences.
 /// \param correspondences CorrespondenceSet. [refer to definition in
 /// `/cpp/open3d/t/pipelines/registration/TransformationEstimation.h`].
+/// \param kernel Robust kernel weighting the residuals.
 /// \return Pose [X Y Z alpha beta gamma], a shape {6} tensor of dtype Float32.
 core::Tensor ComputePosePointToPlane(
         const core::Tensor &source_points,
         const core::Tensor &target_points,
         const core::Tensor &target_normals,
-        const pipelines::registration::CorrespondenceSet &correspondences);
+        const pipelines::registration::CorrespondenceSet &correspondences,
+        const pipelines::registration::RobustKernel &kernel =
+                pipelines::registration::RobustKernel());
+
+/// \brief Computes pose for colored ICP registration method.
+/// \param source_points source points indexed according to correspondences.
+/// \param source_colors source colors indexed according to correspondences.
+/// \param target_points target points indexed according to correspondences.
+/// \param target_normals target normals indexed according to correspondences.
+/// \param target_colors target colors indexed according to correspondences.
+/// \param target_color_gradients target intensity gradients indexed according
+/// to correspondences.
+/// \param correspondences CorrespondenceSet. [refer to definition in
+/// `/cpp/open3d/t/pipelines/registration/TransformationEstimation.h`].
+/// \param kernel Robust kernel weighting the residuals.
+/// \param lambda_geometric Weight of the geometric term, in [0, 1].
+/// \return Pose [X Y Z alpha beta gamma], a shape {6} tensor of dtype Float64.
+core::Tensor ComputePoseColoredICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const pipelines::registration::CorrespondenceSet &correspondences,
+        const pipelines::registration::RobustKernel &kernel,
+        const double &lambda_geometric);
 
 /// \brief Computes (R) Rotation {3,3} and (t) translation {3,}
 /// for point to point registration method.
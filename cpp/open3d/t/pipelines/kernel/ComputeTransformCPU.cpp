@@ -41,6 +41,33 @@ namespace t {
 namespace pipelines {
 namespace kernel {
 
+/// Solves ATA(6,6) . Pose(6,1) = -ATB(6,1) as Float64 on CPU, from the
+/// reduction A_1x27 of the lower triangle of ATA and of -ATB.
+static core::Tensor SolvePose(const std::vector<float> &A_1x27) {
+    core::Device host("CPU:0");
+    core::Tensor ATA = core::Tensor::Empty({6, 6}, core::Dtype::Float64, host);
+    double *ata_ptr = ATA.GetDataPtr<double>();
+
+    // ATB_neg is -(ATB), as bi_neg is used in kernel instead of bi,
+    // where  bi = [source_points - target_points].(target_normals).
+    core::Tensor ATB_neg =
+            core::Tensor::Empty({6, 1}, core::Dtype::Float64, host);
+    double *atb_ptr = ATB_neg.GetDataPtr<double>();
+
+    // ATA_ {1,21} to ATA {6,6}.
+    for (int i = 0, j = 0; j < 6; j++) {
+        for (int k = 0; k <= j; k++) {
+            ata_ptr[j * 6 + k] = A_1x27[i];
+            ata_ptr[k * 6 + j] = A_1x27[i];
+            i++;
+        }
+        atb_ptr[j] = A_1x27[21 + j];
+    }
+
+    // ATA(6,6) . Pose(6,1) = -ATB(6,1).
+    return ATA.Solve(ATB_neg).Reshape({-1});
+}
+
 void ComputePosePointToPlaneCPU(const float *source_points_ptr,
                                 const float *target_points_ptr,
                                 const float *target_normals_ptr,
@@ -48,12 +75,15 @@ void ComputePosePointToPlaneCPU(const float *source_points_ptr,
                                 const int64_t *correspondences_second,
                                 const int n,
                                 core::Tensor &pose,
+                                const registration::RobustKernel &kernel,
                                 const core::Dtype &dtype,
                                 const core::Device &device) {
     // As, ATA is a symmetric matrix, we only need 21 elements instead of 36.
     // ATB is of shape {6,1}. Combining both, A_1x27 is a temp. storage
     // with [0:21] elements as ATA and [21:27] elements as ATB.
     std::vector<float> A_1x27(27, 0.0);
+    const float scaling_parameter =
+            static_cast<float>(kernel.scaling_parameter_);
 
 #ifdef _WIN32
     std::vector<float> zeros_27(27, 0.0);
@@ -91,14 +121,17 @@ void ComputePosePointToPlaneCPU(const float *source_points_ptr,
                                         ny,
                                         nz};
 
+                    const float w = ComputeRobustWeight(
+                            kernel.type_, scaling_parameter, bi_neg);
+
                     for (int i = 0, j = 0; j < 6; j++) {
                         for (int k = 0; k <= j; k++) {
                             // ATA_ {1,21}, as ATA {6,6} is a symmetric matrix.
-                            A_reduction[i] += ai[j] * ai[k];
+                            A_reduction[i] += w * ai[j] * ai[k];
                             i++;
                         }
                         // ATB {6,1}.
-                        A_reduction[21 + j] += ai[j] * bi_neg;
+                        A_reduction[21 + j] += w * ai[j] * bi_neg;
                     }
                 }
 #ifdef _WIN32
@@ -114,29 +147,92 @@ void ComputePosePointToPlaneCPU(const float *source_points_ptr,
             });
 #endif
 
-    // Compute linear system on CPU as Float64.
-    core::Device host("CPU:0");
-    core::Tensor ATA = core::Tensor::Empty({6, 6}, core::Dtype::Float64, host);
-    double *ata_ptr = ATA.GetDataPtr<double>();
+    pose = SolvePose(A_1x27);
+}
 
-    // ATB_neg is -(ATB), as bi_neg is used in kernel instead of bi,
-    // where  bi = [source_points - target_points].(target_normals).
-    core::Tensor ATB_neg =
-            core::Tensor::Empty({6, 1}, core::Dtype::Float64, host);
-    double *atb_ptr = ATB_neg.GetDataPtr<double>();
+void ComputePoseColoredICPCPU(const float *source_points_ptr,
+                              const float *source_colors_ptr,
+                              const float *target_points_ptr,
+                              const float *target_normals_ptr,
+                              const float *target_colors_ptr,
+                              const float *target_color_gradients_ptr,
+                              const int64_t *correspondences_first,
+                              const int64_t *correspondences_second,
+                              const int n,
+                              core::Tensor &pose,
+                              const registration::RobustKernel &kernel,
+                              const double &lambda_geometric,
+                              const core::Dtype &dtype,
+                              const core::Device &device) {
+    // Same layout as ComputePosePointToPlaneCPU, with the geometric and the
+    // photometric terms of each correspondence.
+    std::vector<float> A_1x27(27, 0.0);
+    const float scaling_parameter =
+            static_cast<float>(kernel.scaling_parameter_);
+    const float sqrt_lambda_geometric =
+            static_cast<float>(std::sqrt(lambda_geometric));
+    const float sqrt_lambda_photometric =
+            static_cast<float>(std::sqrt(1.0 - lambda_geometric));
 
-    // ATA_ {1,21} to ATA {6,6}.
-    for (int i = 0, j = 0; j < 6; j++) {
-        for (int k = 0; k <= j; k++) {
-            ata_ptr[j * 6 + k] = A_1x27[i];
-            ata_ptr[k * 6 + j] = A_1x27[i];
-            i++;
-        }
-        atb_ptr[j] = A_1x27[21 + j];
-    }
+#ifdef _WIN32
+    std::vector<float> zeros_27(27, 0.0);
+    A_1x27 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_27,
+            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     workload_idx++) {
+#else
+    float *A_reduction = A_1x27.data();
+#pragma omp parallel for reduction(+ : A_reduction[:27]) schedule(static)
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    const int64_t source_idx =
+                            3 * correspondences_first[workload_idx];
+                    const int64_t target_idx =
+                            3 * correspondences_second[workload_idx];
 
-    // ATA(6,6) . Pose(6,1) = -ATB(6,1).
-    pose = ATA.Solve(ATB_neg).Reshape({-1});
+                    const float *cs = source_colors_ptr + source_idx;
+                    const float *ct = target_colors_ptr + target_idx;
+                    float J_G[6], J_I[6], r_G, r_I;
+                    GetJacobianColoredICP(
+                            source_points_ptr + source_idx,
+                            (cs[0] + cs[1] + cs[2]) / 3.0f,
+                            target_points_ptr + target_idx,
+                            target_normals_ptr + target_idx,
+                            (ct[0] + ct[1] + ct[2]) / 3.0f,
+                            target_color_gradients_ptr + target_idx,
+                            sqrt_lambda_geometric, sqrt_lambda_photometric,
+                            J_G, r_G, J_I, r_I);
+                    const float w_G = ComputeRobustWeight(
+                            kernel.type_, scaling_parameter, r_G);
+                    const float w_I = ComputeRobustWeight(
+                            kernel.type_, scaling_parameter, r_I);
+
+                    for (int i = 0, j = 0; j < 6; j++) {
+                        for (int k = 0; k <= j; k++) {
+                            A_reduction[i] += w_G * J_G[j] * J_G[k] +
+                                              w_I * J_I[j] * J_I[k];
+                            i++;
+                        }
+                        // -ATB {6,1}.
+                        A_reduction[21 + j] -=
+                                w_G * J_G[j] * r_G + w_I * J_I[j] * r_I;
+                    }
+                }
+#ifdef _WIN32
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<float> a, std::vector<float> b) {
+                std::vector<float> result(27);
+                for (int j = 0; j < 27; j++) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+
+    pose = SolvePose(A_1x27);
 }
 
 void ComputeRtPointToPointCPU(const float *source_points_ptr,
@@ -34,6 +34,43 @@ namespace t {
 namespace pipelines {
 namespace kernel {
 
+/// Solves ATA(6,6) . Pose(6,1) = ATB(6,1) as Float64 on CPU, from the {n, 27}
+/// local sums of the lower triangle of ATA and of ATB.
+static core::Tensor SolvePose(const core::Tensor &ata_atb) {
+    // Reduce matrix ata_atb to 1x27, i.e. ATA (1x21) and ATB.T() (1x6).
+    // Compute linear system on CPU as Float64.
+    core::Device host("CPU:0");
+    core::Tensor ata_atb_1x27 =
+            ata_atb.Sum({0}, true).To(host, core::Dtype::Float64);
+    core::Tensor ata_1x21 = ata_atb_1x27.Slice(1, 0, 21).Contiguous();
+    core::Tensor ATB = ata_atb_1x27.Slice(1, 21, 27).T().Contiguous();
+
+    //   ata_1x21 is a {1,21} vector having elements of the matrix ATA such
+    //     that the corresponding elemetes in ATA are like:
+    //     0
+    //     1   2
+    //     3   4   5
+    //     6   7   8   9
+    //     10  11  12  13  14
+    //     15  16  17  18  19  20
+    //     Since, ATA is a symmertric matrix, it can be regenerated from this.
+
+    core::Tensor ATA = core::Tensor::Empty({6, 6}, core::Dtype::Float64, host);
+    double *ATA_ptr = ATA.GetDataPtr<double>();
+    double *ata_1x21_ptr = ata_1x21.GetDataPtr<double>();
+
+    for (int i = 0, j = 0; j < 6; j++) {
+        for (int k = 0; k <= j; k++) {
+            ATA_ptr[j * 6 + k] = ata_1x21_ptr[i];
+            ATA_ptr[k * 6 + j] = ata_1x21_ptr[i];
+            i++;
+        }
+    }
+
+    // ATA(6,6) . Pose(6,1) = ATB(6,1)
+    return ATA.Solve(ATB).Reshape({-1});
+}
+
 void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
                                  const float *target_points_ptr,
                                  const float *target_normals_ptr,
@@ -41,20 +78,20 @@ void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
                                  const int64_t *correspondences_second,
                                  const int n,
                                  core::Tensor &pose,
+                                 const registration::RobustKernel &kernel,
                                  const core::Dtype &dtype,
                                  const core::Device &device) {
-    // atai: {n, 21} Stores local sum for ATA stacked vertically
-    core::Tensor atai =
-            core::Tensor::Empty({n, 21}, core::Dtype::Float32, device);
-    float *atai_ptr = atai.GetDataPtr<float>();
-
-    // atbi: {n, 6} Stores local sum for ATB.T() stacked vertically
-    core::Tensor atbi =
-            core::Tensor::Empty({n, 6}, core::Dtype::Float32, device);
-    float *atbi_ptr = atbi.GetDataPtr<float>();
-
-    // This kernel computes the {n,21} shape atai tensor
-    // and {n,6} shape atbi tensor.
+    // ata_atb: {n, 27} Stores local sums stacked vertically. The first 21
+    // columns hold the lower triangle of ATA, the last 6 hold ATB.T(), so that
+    // both are reduced by a single kernel and copied to the host at once.
+    core::Tensor ata_atb =
+            core::Tensor::Empty({n, 27}, core::Dtype::Float32, device);
+    float *ata_atb_ptr = ata_atb.GetDataPtr<float>();
+    const registration::RobustKernelMethod method = kernel.type_;
+    const float scaling_parameter =
+            static_cast<float>(kernel.scaling_parameter_);
+
+    // This kernel computes the {n,27} shape ata_atb tensor.
     core::kernel::CUDALauncher::LaunchGeneralKernel(
             n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
                 const int64_t &source_idx =
@@ -62,8 +99,8 @@ void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
                 const int64_t &target_idx =
                         3 * correspondences_second[workload_idx];
 
-                const int64_t atai_stride = 21 * workload_idx;
-                const int64_t atbi_stride = 6 * workload_idx;
+                const int64_t atai_stride = 27 * workload_idx;
+                const int64_t atbi_stride = 27 * workload_idx + 21;
 
                 const float &sx = source_points_ptr[source_idx + 0];
                 const float &sy = source_points_ptr[source_idx + 1];
@@ -84,45 +121,84 @@ void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
                                     ny,
                                     nz};
 
+                const float w =
+                        ComputeRobustWeight(method, scaling_parameter, bi);
+
                 for (int i = 0, j = 0; j < 6; j++) {
                     for (int k = 0; k <= j; k++) {
-                        atai_ptr[atai_stride + i] = ai[j] * ai[k];
+                        ata_atb_ptr[atai_stride + i] = w * ai[j] * ai[k];
                         i++;
                     }
-                    atbi_ptr[atbi_stride + j] = ai[j] * bi;
+                    ata_atb_ptr[atbi_stride + j] = w * ai[j] * bi;
                 }
             });
 
-    // Reduce matrix atai (to 1x21) and atbi (to ATB.T() 1x6).
-    // Compute linear system on CPU as Float64.
-    core::Device host("CPU:0");
-    core::Tensor ata_1x21 = atai.Sum({0}, true).To(host, core::Dtype::Float64);
-    core::Tensor ATB = atbi.Sum({0}, true).T().To(host, core::Dtype::Float64);
+    pose = SolvePose(ata_atb);
+}
 
-    //   ata_1x21 is a {1,21} vector having elements of the matrix ATA such
-    //     that the corresponding elemetes in ATA are like:
-    //     0
-    //     1   2
-    //     3   4   5
-    //     6   7   8   9
-    //     10  11  12  13  14
-    //     15  16  17  18  19  20
-    //     Since, ATA is a symmertric matrix, it can be regenerated from this.
+void ComputePoseColoredICPCUDA(const float *source_points_ptr,
+                               const float *source_colors_ptr,
+                               const float *target_points_ptr,
+                               const float *target_normals_ptr,
+                               const float *target_colors_ptr,
+                               const float *target_color_gradients_ptr,
+                               const int64_t *correspondences_first,
+                               const int64_t *correspondences_second,
+                               const int n,
+                               core::Tensor &pose,
+                               const registration::RobustKernel &kernel,
+                               const double &lambda_geometric,
+                               const core::Dtype &dtype,
+                               const core::Device &device) {
+    // Same layout as ComputePosePointToPlaneCUDA, with the geometric and the
+    // photometric terms of each correspondence.
+    core::Tensor ata_atb =
+            core::Tensor::Empty({n, 27}, core::Dtype::Float32, device);
+    float *ata_atb_ptr = ata_atb.GetDataPtr<float>();
+    const registration::RobustKernelMethod method = kernel.type_;
+    const float scaling_parameter =
+            static_cast<float>(kernel.scaling_parameter_);
+    const float sqrt_lambda_geometric =
+            static_cast<float>(sqrt(lambda_geometric));
+    const float sqrt_lambda_photometric =
+            static_cast<float>(sqrt(1.0 - lambda_geometric));
 
-    core::Tensor ATA = core::Tensor::Empty({6, 6}, core::Dtype::Float64, host);
-    double *ATA_ptr = ATA.GetDataPtr<double>();
-    double *ata_1x21_ptr = ata_1x21.GetDataPtr<double>();
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t source_idx =
+                        3 * correspondences_first[workload_idx];
+                const int64_t target_idx =
+                        3 * correspondences_second[workload_idx];
+                float *ata_atb_i = ata_atb_ptr + 27 * workload_idx;
 
-    for (int i = 0, j = 0; j < 6; j++) {
-        for (int k = 0; k <= j; k++) {
-            ATA_ptr[j * 6 + k] = ata_1x21_ptr[i];
-            ATA_ptr[k * 6 + j] = ata_1x21_ptr[i];
-            i++;
-        }
-    }
+                const float *cs = source_colors_ptr + source_idx;
+                const float *ct = target_colors_ptr + target_idx;
+                float J_G[6], J_I[6], r_G, r_I;
+                GetJacobianColoredICP(source_points_ptr + source_idx,
+                                      (cs[0] + cs[1] + cs[2]) / 3.0f,
+                                      target_points_ptr + target_idx,
+                                      target_normals_ptr + target_idx,
+                                      (ct[0] + ct[1] + ct[2]) / 3.0f,
+                                      target_color_gradients_ptr + target_idx,
+                                      sqrt_lambda_geometric,
+                                      sqrt_lambda_photometric, J_G, r_G, J_I,
+                                      r_I);
+                const float w_G =
+                        ComputeRobustWeight(method, scaling_parameter, r_G);
+                const float w_I =
+                        ComputeRobustWeight(method, scaling_parameter, r_I);
 
-    // ATA(6,6) . Pose(6,1) = ATB(6,1)
-    pose = ATA.Solve(ATB).Reshape({-1});
+                for (int i = 0, j = 0; j < 6; j++) {
+                    for (int k = 0; k <= j; k++) {
+                        ata_atb_i[i++] = w_G * J_G[j] * J_G[k] +
+                                         w_I * J_I[j] * J_I[k];
+                    }
+                    ata_atb_i[21 + j] =
+                            -(w_G * J_G[j] * r_G + w_I * J_I[j] * r_I);
+                }
+            });
+
+    pose = SolvePose(ata_atb);
 }
 
 }  // namespace kernel
@@ -28,13 +28,130 @@
 
 #pragma once
 
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/registration/RobustKernel.h"
 
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace kernel {
 
+/// Weight of \p residual for the robust kernel \p method with scaling
+/// parameter \p k, see registration::RobustKernel.
+OPEN3D_HOST_DEVICE inline float ComputeRobustWeight(
+        registration::RobustKernelMethod method, float k, float residual) {
+    const float e = fabsf(residual);
+    switch (method) {
+        case registration::RobustKernelMethod::L1Loss:
+            return 1.0f / e;
+        case registration::RobustKernelMethod::HuberLoss:
+            return k / (e > k ? e : k);
+        case registration::RobustKernelMethod::CauchyLoss:
+            return 1.0f / (1.0f + (residual / k) * (residual / k));
+        case registration::RobustKernelMethod::GMLoss: {
+            const float d = k + residual * residual;
+            return k / (d * d);
+        }
+        case registration::RobustKernelMethod::TukeyLoss: {
+            const float x = e < k ? e / k : 1.0f;
+            return (1.0f - x * x) * (1.0f - x * x);
+        }
+        default:
+            return 1.0f;
+    }
+}
+
+/// Jacobians and residuals of the geometric (J_G, r_G) and photometric
+/// (J_I, r_I) terms of colored ICP for the source point \p vs of intensity
+/// \p is, corresponding to the target point \p vt of normal \p nt,
+/// intensity \p it and intensity gradient \p dit. Same terms as the legacy
+/// TransformationEstimationForColoredICP.
+OPEN3D_HOST_DEVICE inline void GetJacobianColoredICP(
+        const float *vs,
+        float is,
+        const float *vt,
+        const float *nt,
+        float it,
+        const float *dit,
+        float sqrt_lambda_geometric,
+        float sqrt_lambda_photometric,
+        float *J_G,
+        float &r_G,
+        float *J_I,
+        float &r_I) {
+    const float d = (vs[0] - vt[0]) * nt[0] + (vs[1] - vt[1]) * nt[1] +
+                    (vs[2] - vt[2]) * nt[2];
+    J_G[0] = sqrt_lambda_geometric * (vs[1] * nt[2] - vs[2] * nt[1]);
+    J_G[1] = sqrt_lambda_geometric * (vs[2] * nt[0] - vs[0] * nt[2]);
+    J_G[2] = sqrt_lambda_geometric * (vs[0] * nt[1] - vs[1] * nt[0]);
+    J_G[3] = sqrt_lambda_geometric * nt[0];
+    J_G[4] = sqrt_lambda_geometric * nt[1];
+    J_G[5] = sqrt_lambda_geometric * nt[2];
+    r_G = sqrt_lambda_geometric * d;
+
+    // Intensity of the projection of vs on the tangent plane of vt, and
+    // ditM = -dit^T (I - nt nt^T).
+    float is0_proj = it;
+    const float dit_n = dit[0] * nt[0] + dit[1] * nt[1] + dit[2] * nt[2];
+    float ditM[3];
+    for (int i = 0; i < 3; i++) {
+        is0_proj += dit[i] * (vs[i] - d * nt[i] - vt[i]);
+        ditM[i] = dit_n * nt[i] - dit[i];
+    }
+    J_I[0] = sqrt_lambda_photometric * (vs[1] * ditM[2] - vs[2] * ditM[1]);
+    J_I[1] = sqrt_lambda_photometric * (vs[2] * ditM[0] - vs[0] * ditM[2]);
+    J_I[2] = sqrt_lambda_photometric * (vs[0] * ditM[1] - vs[1] * ditM[0]);
+    J_I[3] = sqrt_lambda_photometric * ditM[0];
+    J_I[4] = sqrt_lambda_photometric * ditM[1];
+    J_I[5] = sqrt_lambda_photometric * ditM[2];
+    r_I = sqrt_lambda_photometric * (is - is0_proj);
+}
+
+/// Solves JtJ(6,6) . pose(6) = -Jtr(6) by Cholesky decomposition, from
+/// \p reduction holding the lower triangle of JtJ (21 entries, row-major)
+/// followed by Jtr (6 entries). Returns false if JtJ is singular.
+OPEN3D_HOST_DEVICE inline bool SolveJtJCholesky(const float *reduction,
+                                                double *pose) {
+    double L[6][6] = {{0}};
+    for (int i = 0, j = 0; j < 6; j++) {
+        for (int k = 0; k <= j; k++) {
+            L[j][k] = reduction[i++];
+        }
+    }
+    for (int j = 0; j < 6; j++) {
+        for (int k = 0; k < j; k++) {
+            L[j][j] -= L[j][k] * L[j][k];
+        }
+        if (L[j][j] <= 0) {
+            return false;
+        }
+        L[j][j] = sqrt(L[j][j]);
+        for (int i = j + 1; i < 6; i++) {
+            for (int k = 0; k < j; k++) {
+                L[i][j] -= L[i][k] * L[j][k];
+            }
+            L[i][j] /= L[j][j];
+        }
+    }
+    for (int i = 0; i < 6; i++) {
+        pose[i] = -reduction[21 + i];
+        for (int k = 0; k < i; k++) {
+            pose[i] -= L[i][k] * pose[k];
+        }
+        pose[i] /= L[i][i];
+    }
+    for (int i = 5; i >= 0; i--) {
+        for (int k = i + 1; k < 6; k++) {
+            pose[i] -= L[k][i] * pose[k];
+        }
+        pose[i] /= L[i][i];
+    }
+    return true;
+}
+
 void ComputePosePointToPlaneCPU(const float *source_points_ptr,
                                 const float *target_points_ptr,
                                 const float *target_normals_ptr,
@@ -42,9 +159,25 @@ void ComputePosePointToPlaneCPU(const float *source_points_ptr,
                                 const int64_t *correspondences_second,
                                 const int n,
                                 core::Tensor &pose,
+                                const registration::RobustKernel &kernel,
                                 const core::Dtype &dtype,
                                 const core::Device &device);
 
+void ComputePoseColoredICPCPU(const float *source_points_ptr,
+                              const float *source_colors_ptr,
+                              const float *target_points_ptr,
+                              const float *target_normals_ptr,
+                              const float *target_colors_ptr,
+                              const float *target_color_gradients_ptr,
+                              const int64_t *correspondences_first,
+                              const int64_t *correspondences_second,
+                              const int n,
+                              core::Tensor &pose,
+                              const registration::RobustKernel &kernel,
+                              const double &lambda_geometric,
+                              const core::Dtype &dtype,
+                              const core::Device &device);
+
 #ifdef BUILD_CUDA_MODULE
 void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
                                  const float *target_points_ptr,
@@ -53,8 +186,24 @@ void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
                                  const int64_t *correspondences_second,
                                  const int n,
                                  core::Tensor &pose,
+                                 const registration::RobustKernel &kernel,
                                  const core::Dtype &dtype,
                                  const core::Device &device);
+
+void ComputePoseColoredICPCUDA(const float *source_points_ptr,
+                               const float *source_colors_ptr,
+                               const float *target_points_ptr,
+                               const float *target_normals_ptr,
+                               const float *target_colors_ptr,
+                               const float *target_color_gradients_ptr,
+                               const int64_t *correspondences_first,
+                               const int64_t *correspondences_second,
+                               const int n,
+                               core::Tensor &pose,
+                               const registration::RobustKernel &kernel,
+                               const double &lambda_geometric,
+                               const core::Dtype &dtype,
+                               const core::Device &device);
 #endif
 
 void ComputeRtPointToPointCPU(const float *source_points_ptr,
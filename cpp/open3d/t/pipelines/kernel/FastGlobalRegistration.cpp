@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/FastGlobalRegistration.h"
+
+#include "open3d/t/pipelines/kernel/FastGlobalRegistrationImpl.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace fgr {
+
+void TestTuples(const core::Tensor &source_points,
+                const core::Tensor &target_points,
+                const core::Tensor &correspondences,
+                float tuple_scale,
+                int64_t num_trials,
+                uint64_t seed,
+                core::Tensor &tuples,
+                core::Tensor &valid) {
+    core::Device device = source_points.GetDevice();
+    source_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDevice(device);
+    correspondences.AssertDtype(core::Dtype::Int64);
+    correspondences.AssertDevice(device);
+    if (correspondences.GetLength() == 0) {
+        utility::LogError("At least one correspondence is required.");
+    }
+
+    tuples = core::Tensor::Empty({num_trials, 3}, core::Dtype::Int64, device);
+    valid = core::Tensor::Empty({num_trials}, core::Dtype::Bool, device);
+    const core::Tensor src = source_points.Contiguous();
+    const core::Tensor dst = target_points.Contiguous();
+    const core::Tensor corres = correspondences.Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        TestTuplesCPU(src, dst, corres, tuple_scale, num_trials, seed, tuples,
+                      valid);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        TestTuplesCUDA(src, dst, corres, tuple_scale, num_trials, seed,
+                       tuples, valid);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+core::Tensor OptimizePairwiseRegistration(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        int iteration_number,
+        double par,
+        double maximum_correspondence_distance,
+        double division_factor,
+        bool decrease_mu) {
+    core::Device device = source_points.GetDevice();
+    source_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_points.AssertDevice(device);
+    correspondences.AssertDtype(core::Dtype::Int64);
+    correspondences.AssertDevice(device);
+
+    // Transformation, scale and iteration stay on the device.
+    core::Tensor state =
+            core::Tensor::Zeros({kStateSize}, core::Dtype::Float64, device);
+    state.Slice(0, kTransformation, kTransformation + 16) =
+            core::Tensor::Eye(4, core::Dtype::Float64, device).Reshape({16});
+    state[kPar] = par;
+
+    const core::Tensor src = source_points.Contiguous();
+    const core::Tensor dst = target_points.Contiguous();
+    const core::Tensor corres = correspondences.Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        OptimizePairwiseRegistrationCPU(
+                src, dst, corres, iteration_number,
+                maximum_correspondence_distance, division_factor, decrease_mu,
+                state);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        OptimizePairwiseRegistrationCUDA(
+                src, dst, corres, iteration_number,
+                maximum_correspondence_distance, division_factor, decrease_mu,
+                state);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    return state.Slice(0, kTransformation, kTransformation + 16)
+            .Reshape({4, 4});
+}
+
+}  // namespace fgr
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace fgr {
+
+/// \brief Runs the tuple tests of FastGlobalRegistration in parallel.
+///
+/// Each trial draws 3 correspondences from a counter based random generator
+/// seeded with \p seed, and passes if the triangles they form in the source
+/// and in the target have similar edge lengths.
+///
+/// \param source_points Source points {N, 3}, Float32.
+/// \param target_points Target points {M, 3}, Float32.
+/// \param correspondences Pairs of source and target indices {K, 2}, Int64.
+/// \param tuple_scale Similarity of the edge lengths, in (0, 1).
+/// \param num_trials Number of trials.
+/// \param seed Seed of the random generator.
+/// \param tuples Output indices in \p correspondences drawn by each trial
+/// {num_trials, 3}, Int64.
+/// \param valid Output result of each trial {num_trials}, Bool.
+void TestTuples(const core::Tensor &source_points,
+                const core::Tensor &target_points,
+                const core::Tensor &correspondences,
+                float tuple_scale,
+                int64_t num_trials,
+                uint64_t seed,
+                core::Tensor &tuples,
+                core::Tensor &valid);
+
+/// \brief Runs the graduated non-convexity iterations of
+/// FastGlobalRegistration on the device.
+///
+/// Each iteration reduces the JtJ and Jtr of all correspondences, weighted by
+/// their Geman-McClure weights, in a single kernel, then solves and updates
+/// the scale in a second single thread kernel. Nothing is copied to the host
+/// until the iterations end.
+///
+/// \param source_points Source points {N, 3}, Float32.
+/// \param target_points Target points {M, 3}, Float32.
+/// \param correspondences Pairs of source and target indices {K, 2}, Int64.
+/// \param iteration_number Number of iterations.
+/// \param par Initial scale of the graduated non-convexity.
+/// \param maximum_correspondence_distance The scale is not decreased below
+/// it.
+/// \param division_factor Division factor of the scale.
+/// \param decrease_mu Whether the scale is decreased every 4 iterations.
+/// \return The transformation {4, 4}, Float64 on the device of the points,
+/// aligning the target points to the source points.
+core::Tensor OptimizePairwiseRegistration(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        int iteration_number,
+        double par,
+        double maximum_correspondence_distance,
+        double division_factor,
+        bool decrease_mu);
+
+}  // namespace fgr
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
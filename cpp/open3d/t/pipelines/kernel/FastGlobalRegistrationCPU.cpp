@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/FastGlobalRegistrationImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace fgr {
+
+void TestTuplesCPU(const core::Tensor &source_points,
+                   const core::Tensor &target_points,
+                   const core::Tensor &correspondences,
+                   float tuple_scale,
+                   int64_t num_trials,
+                   uint64_t seed,
+                   core::Tensor &tuples,
+                   core::Tensor &valid) {
+    const float *source_points_ptr = source_points.GetDataPtr<float>();
+    const float *target_points_ptr = target_points.GetDataPtr<float>();
+    const int64_t *corres_ptr = correspondences.GetDataPtr<int64_t>();
+    const int64_t num_corres = correspondences.GetLength();
+    int64_t *tuples_ptr = tuples.GetDataPtr<int64_t>();
+    bool *valid_ptr = valid.GetDataPtr<bool>();
+
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            num_trials, [&](int64_t workload_idx) {
+                valid_ptr[workload_idx] = TestTuple(
+                        workload_idx, source_points_ptr, target_points_ptr,
+                        corres_ptr, num_corres, tuple_scale, seed,
+                        tuples_ptr + 3 * workload_idx);
+            });
+}
+
+void OptimizePairwiseRegistrationCPU(const core::Tensor &source_points,
+                                     const core::Tensor &target_points,
+                                     const core::Tensor &correspondences,
+                                     int iteration_number,
+                                     double maximum_correspondence_distance,
+                                     double division_factor,
+                                     bool decrease_mu,
+                                     core::Tensor &state) {
+    const int64_t n = correspondences.GetLength();
+    const float *source_points_ptr = source_points.GetDataPtr<float>();
+    const float *target_points_ptr = target_points.GetDataPtr<float>();
+    const int64_t *corres_ptr = correspondences.GetDataPtr<int64_t>();
+    double *state_ptr = state.GetDataPtr<double>();
+
+    for (int k = 0; k < iteration_number; k++) {
+        std::vector<float> zeros_27(kReductionSize, 0.0);
+        std::vector<float> A_1x27 = tbb::parallel_reduce(
+                tbb::blocked_range<int64_t>(0, n), zeros_27,
+                [&](tbb::blocked_range<int64_t> r,
+                    std::vector<float> A_reduction) {
+                    float reduction[kReductionSize];
+                    for (int64_t workload_idx = r.begin();
+                         workload_idx < r.end(); workload_idx++) {
+                        GetGNCTerms(workload_idx, source_points_ptr,
+                                    target_points_ptr, corres_ptr,
+                                    state_ptr + kTransformation,
+                                    state_ptr[kPar], reduction);
+                        for (int i = 0; i < kReductionSize; i++) {
+                            A_reduction[i] += reduction[i];
+                        }
+                    }
+                    return A_reduction;
+                },
+                [&](std::vector<float> a, std::vector<float> b) {
+                    std::vector<float> result(kReductionSize);
+                    for (int i = 0; i < kReductionSize; i++) {
+                        result[i] = a[i] + b[i];
+                    }
+                    return result;
+                });
+        UpdateTransformation(state_ptr, A_1x27.data(),
+                             maximum_correspondence_distance, division_factor,
+                             decrease_mu);
+    }
+}
+
+}  // namespace fgr
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
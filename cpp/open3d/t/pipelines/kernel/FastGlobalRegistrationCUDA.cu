@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+
+#include <cub/cub.cuh>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/FastGlobalRegistrationImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace fgr {
+
+void TestTuplesCUDA(const core::Tensor& source_points,
+                    const core::Tensor& target_points,
+                    const core::Tensor& correspondences,
+                    float tuple_scale,
+                    int64_t num_trials,
+                    uint64_t seed,
+                    core::Tensor& tuples,
+                    core::Tensor& valid) {
+    const float* source_points_ptr = source_points.GetDataPtr<float>();
+    const float* target_points_ptr = target_points.GetDataPtr<float>();
+    const int64_t* corres_ptr = correspondences.GetDataPtr<int64_t>();
+    const int64_t num_corres = correspondences.GetLength();
+    int64_t* tuples_ptr = tuples.GetDataPtr<int64_t>();
+    bool* valid_ptr = valid.GetDataPtr<bool>();
+
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            num_trials, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                valid_ptr[workload_idx] = TestTuple(
+                        workload_idx, source_points_ptr, target_points_ptr,
+                        corres_ptr, num_corres, tuple_scale, seed,
+                        tuples_ptr + 3 * workload_idx);
+            });
+}
+
+__global__ void ComputeGNCTermsCUDAKernel(const float* source_points_ptr,
+                                          const float* target_points_ptr,
+                                          const int64_t* corres_ptr,
+                                          int64_t n,
+                                          const double* state_ptr,
+                                          float* global_sum) {
+    const int kBlockSize = 256;
+    typedef cub::BlockReduce<float, kBlockSize> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+
+    const int64_t workload_idx =
+            threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x;
+    float reduction[kReductionSize] = {0};
+    if (workload_idx < n) {
+        GetGNCTerms(workload_idx, source_points_ptr, target_points_ptr,
+                    corres_ptr, state_ptr + kTransformation, state_ptr[kPar],
+                    reduction);
+    }
+
+    for (int i = 0; i < kReductionSize; i++) {
+        float sum = BlockReduce(temp_storage).Sum(reduction[i]);
+        if (threadIdx.x == 0) {
+            atomicAdd(&global_sum[i], sum);
+        }
+        __syncthreads();
+    }
+}
+
+__global__ void UpdateTransformationCUDAKernel(
+        double* state_ptr,
+        float* global_sum,
+        double maximum_correspondence_distance,
+        double division_factor,
+        bool decrease_mu) {
+    UpdateTransformation(state_ptr, global_sum,
+                         maximum_correspondence_distance, division_factor,
+                         decrease_mu);
+}
+
+void OptimizePairwiseRegistrationCUDA(const core::Tensor& source_points,
+                                      const core::Tensor& target_points,
+                                      const core::Tensor& correspondences,
+                                      int iteration_number,
+                                      double maximum_correspondence_distance,
+                                      double division_factor,
+                                      bool decrease_mu,
+                                      core::Tensor& state) {
+    const int64_t n = correspondences.GetLength();
+    core::Device device = source_points.GetDevice();
+
+    core::Tensor global_sum = core::Tensor::Zeros(
+            {kReductionSize}, core::Dtype::Float32, device);
+    float* global_sum_ptr = global_sum.GetDataPtr<float>();
+    double* state_ptr = state.GetDataPtr<double>();
+
+    // The iterations are queued without waiting, the transformation and the
+    // scale only live on the device.
+    const int kThreadSize = 256;
+    const int64_t blocks = (n + kThreadSize - 1) / kThreadSize;
+    for (int k = 0; k < iteration_number; k++) {
+        ComputeGNCTermsCUDAKernel<<<blocks, kThreadSize>>>(
+                source_points.GetDataPtr<float>(),
+                target_points.GetDataPtr<float>(),
+                correspondences.GetDataPtr<int64_t>(), n, state_ptr,
+                global_sum_ptr);
+        UpdateTransformationCUDAKernel<<<1, 1>>>(
+                state_ptr, global_sum_ptr, maximum_correspondence_distance,
+                division_factor, decrease_mu);
+    }
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+}  // namespace fgr
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,212 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/ComputeTransformImpl.h"
+#include "open3d/t/pipelines/kernel/TransformationConverterImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace fgr {
+
+/// Layout of the Float64 state of OptimizePairwiseRegistration, kept on the
+/// device between the launches.
+enum FGRState {
+    kTransformation = 0,  // 16 entries, row-major.
+    kPar = 16,
+    kIteration = 17,
+    kStateSize = 18,
+};
+
+/// Number of Float32 entries reduced per iteration: 21 for the lower
+/// triangle of JtJ, 6 for Jtr.
+constexpr int kReductionSize = 27;
+
+/// Counter based random number generator (SplitMix64), so that the trials of
+/// the tuple test do not depend on the order in which they are evaluated.
+OPEN3D_HOST_DEVICE inline uint64_t RandomHash(uint64_t seed, uint64_t index) {
+    uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/// Draws 3 random correspondences for \p trial and checks, like the legacy
+/// FastGlobalRegistration, that the triangles they form in the source and in
+/// the target have similar edge lengths up to \p tuple_scale. The
+/// correspondences are written to \p tuple.
+OPEN3D_HOST_DEVICE inline bool TestTuple(int64_t trial,
+                                         const float *source_points_ptr,
+                                         const float *target_points_ptr,
+                                         const int64_t *corres_ptr,
+                                         int64_t num_corres,
+                                         float tuple_scale,
+                                         uint64_t seed,
+                                         int64_t *tuple) {
+    const float *ps[3];
+    const float *pt[3];
+    for (int k = 0; k < 3; k++) {
+        tuple[k] = static_cast<int64_t>(RandomHash(seed, 3 * trial + k) %
+                                        static_cast<uint64_t>(num_corres));
+        ps[k] = source_points_ptr + 3 * corres_ptr[2 * tuple[k]];
+        pt[k] = target_points_ptr + 3 * corres_ptr[2 * tuple[k] + 1];
+    }
+    for (int k = 0; k < 3; k++) {
+        const float *a = ps[k];
+        const float *b = ps[(k + 1) % 3];
+        const float *c = pt[k];
+        const float *d = pt[(k + 1) % 3];
+        const float ls = sqrtf((a[0] - b[0]) * (a[0] - b[0]) +
+                               (a[1] - b[1]) * (a[1] - b[1]) +
+                               (a[2] - b[2]) * (a[2] - b[2]));
+        const float lt = sqrtf((c[0] - d[0]) * (c[0] - d[0]) +
+                               (c[1] - d[1]) * (c[1] - d[1]) +
+                               (c[2] - d[2]) * (c[2] - d[2]));
+        if (!(ls * tuple_scale < lt && lt < ls / tuple_scale)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Fills the \p reduction terms of correspondence \p workload_idx: the
+/// Jacobians and residuals of the source point against the target point
+/// transformed by \p T, weighted by the Geman-McClure weight of scale \p par
+/// of the graduated non-convexity. Same terms as the legacy
+/// FastGlobalRegistration.
+OPEN3D_HOST_DEVICE inline void GetGNCTerms(int64_t workload_idx,
+                                           const float *source_points_ptr,
+                                           const float *target_points_ptr,
+                                           const int64_t *corres_ptr,
+                                           const double *T,
+                                           double par,
+                                           float *reduction) {
+    const float *p = source_points_ptr + 3 * corres_ptr[2 * workload_idx];
+    const float *t = target_points_ptr + 3 * corres_ptr[2 * workload_idx + 1];
+    float q[3];
+    for (int i = 0; i < 3; i++) {
+        q[i] = static_cast<float>(T[4 * i] * t[0] + T[4 * i + 1] * t[1] +
+                                  T[4 * i + 2] * t[2] + T[4 * i + 3]);
+    }
+    const float r[3] = {p[0] - q[0], p[1] - q[1], p[2] - q[2]};
+    const float par_f = static_cast<float>(par);
+    const float w = par_f / (r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + par_f);
+    const float s = w * w;
+
+    const float J[3][6] = {{0, -q[2], q[1], -1, 0, 0},
+                           {q[2], 0, -q[0], 0, -1, 0},
+                           {-q[1], q[0], 0, 0, 0, -1}};
+    for (int i = 0; i < kReductionSize; i++) {
+        reduction[i] = 0;
+    }
+    for (int row = 0; row < 3; row++) {
+        for (int i = 0, j = 0; j < 6; j++) {
+            for (int k = 0; k <= j; k++) {
+                reduction[i++] += s * J[row][j] * J[row][k];
+            }
+            reduction[21 + j] += s * J[row][j] * r[row];
+        }
+    }
+}
+
+/// Ends an iteration on a single thread: solves the linear system of
+/// \p reduction, left-multiplies the transformation by the update and
+/// decreases the scale of the graduated non-convexity every 4 iterations.
+/// \p reduction is cleared for the next iteration.
+OPEN3D_HOST_DEVICE inline void UpdateTransformation(
+        double *state,
+        float *reduction,
+        double maximum_correspondence_distance,
+        double division_factor,
+        bool decrease_mu) {
+    double pose[6];
+    if (SolveJtJCholesky(reduction, pose)) {
+        ApplyPoseUpdateImpl<double>(state + kTransformation, pose);
+    }
+    const int iteration = static_cast<int>(state[kIteration]);
+    if (decrease_mu && iteration % 4 == 0 &&
+        state[kPar] > maximum_correspondence_distance) {
+        state[kPar] /= division_factor;
+    }
+    state[kIteration] = iteration + 1;
+    for (int i = 0; i < kReductionSize; i++) {
+        reduction[i] = 0;
+    }
+}
+
+void TestTuplesCPU(const core::Tensor &source_points,
+                   const core::Tensor &target_points,
+                   const core::Tensor &correspondences,
+                   float tuple_scale,
+                   int64_t num_trials,
+                   uint64_t seed,
+                   core::Tensor &tuples,
+                   core::Tensor &valid);
+
+void OptimizePairwiseRegistrationCPU(const core::Tensor &source_points,
+                                     const core::Tensor &target_points,
+                                     const core::Tensor &correspondences,
+                                     int iteration_number,
+                                     double maximum_correspondence_distance,
+                                     double division_factor,
+                                     bool decrease_mu,
+                                     core::Tensor &state);
+
+#ifdef BUILD_CUDA_MODULE
+void TestTuplesCUDA(const core::Tensor &source_points,
+                    const core::Tensor &target_points,
+                    const core::Tensor &correspondences,
+                    float tuple_scale,
+                    int64_t num_trials,
+                    uint64_t seed,
+                    core::Tensor &tuples,
+                    core::Tensor &valid);
+
+void OptimizePairwiseRegistrationCUDA(const core::Tensor &source_points,
+                                      const core::Tensor &target_points,
+                                      const core::Tensor &correspondences,
+                                      int iteration_number,
+                                      double maximum_correspondence_distance,
+                                      double division_factor,
+                                      bool decrease_mu,
+                                      core::Tensor &state);
+#endif
+
+}  // namespace fgr
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,217 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+#if defined(__CUDACC__)
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#else
+#include "open3d/core/kernel/CPULauncher.h"
+#endif
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+constexpr double kPi = 3.14159265358979323846;
+
+/// Pair features (f0, f1, f2) of the points p1, p2 of normals n1, n2, as the
+/// legacy ComputePairFeatures. Returns false if they vanish.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline bool ComputePairFeatures(const scalar_t *p1,
+                                                   const scalar_t *n1,
+                                                   const scalar_t *p2,
+                                                   const scalar_t *n2,
+                                                   double feature[3]) {
+    double dp2p1[3] = {double(p2[0]) - p1[0], double(p2[1]) - p1[1],
+                       double(p2[2]) - p1[2]};
+    const double dist = sqrt(dp2p1[0] * dp2p1[0] + dp2p1[1] * dp2p1[1] +
+                             dp2p1[2] * dp2p1[2]);
+    if (dist == 0) {
+        return false;
+    }
+    const double angle1 = (n1[0] * dp2p1[0] + n1[1] * dp2p1[1] +
+                           n1[2] * dp2p1[2]) /
+                          dist;
+    const double angle2 = (n2[0] * dp2p1[0] + n2[1] * dp2p1[1] +
+                           n2[2] * dp2p1[2]) /
+                          dist;
+    double n1_copy[3], n2_copy[3];
+    if (acos(fabs(angle1)) > acos(fabs(angle2))) {
+        for (int i = 0; i < 3; ++i) {
+            n1_copy[i] = n2[i];
+            n2_copy[i] = n1[i];
+            dp2p1[i] = -dp2p1[i];
+        }
+        feature[2] = -angle2;
+    } else {
+        for (int i = 0; i < 3; ++i) {
+            n1_copy[i] = n1[i];
+            n2_copy[i] = n2[i];
+        }
+        feature[2] = angle1;
+    }
+    double v[3] = {dp2p1[1] * n1_copy[2] - dp2p1[2] * n1_copy[1],
+                   dp2p1[2] * n1_copy[0] - dp2p1[0] * n1_copy[2],
+                   dp2p1[0] * n1_copy[1] - dp2p1[1] * n1_copy[0]};
+    const double v_norm = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (v_norm == 0) {
+        feature[2] = 0;
+        return false;
+    }
+    for (int i = 0; i < 3; ++i) {
+        v[i] /= v_norm;
+    }
+    const double w[3] = {n1_copy[1] * v[2] - n1_copy[2] * v[1],
+                         n1_copy[2] * v[0] - n1_copy[0] * v[2],
+                         n1_copy[0] * v[1] - n1_copy[1] * v[0]};
+    feature[1] = v[0] * n2_copy[0] + v[1] * n2_copy[1] + v[2] * n2_copy[2];
+    feature[0] = atan2(w[0] * n2_copy[0] + w[1] * n2_copy[1] +
+                               w[2] * n2_copy[2],
+                       n1_copy[0] * n2_copy[0] + n1_copy[1] * n2_copy[1] +
+                               n1_copy[2] * n2_copy[2]);
+    return true;
+}
+
+/// Bin of a pair feature normalized to [0, 1], among the 11 bins of each of
+/// the 3 histograms.
+OPEN3D_HOST_DEVICE inline int FeatureBin(double value) {
+    const int bin = static_cast<int>(floor(11 * value));
+    return bin < 0 ? 0 : (bin >= 11 ? 10 : bin);
+}
+
+#if defined(__CUDACC__)
+void ComputeFPFHFeatureCUDA
+#else
+void ComputeFPFHFeatureCPU
+#endif
+        (const core::Tensor &points,
+         const core::Tensor &normals,
+         const core::Tensor &neighbors,
+         core::Tensor &fpfhs) {
+    const int64_t n = points.GetLength();
+    const int64_t max_nn = neighbors.GetShape(1);
+    const int64_t *neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t *points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t *normals_ptr = normals.GetDataPtr<scalar_t>();
+        core::Tensor spfhs = core::Tensor::Zeros({n, 33}, points.GetDtype(),
+                                                 points.GetDevice());
+        scalar_t *spfhs_ptr = spfhs.GetDataPtr<scalar_t>();
+        scalar_t *fpfhs_ptr = fpfhs.GetDataPtr<scalar_t>();
+
+        // SPFH: histograms of the pair features with the neighbors.
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            const int64_t *nb = neighbors_ptr + workload_idx * max_nn;
+            const scalar_t *p = points_ptr + 3 * workload_idx;
+            const scalar_t *nrm = normals_ptr + 3 * workload_idx;
+            int64_t count = 0;
+            for (int64_t k = 0; k < max_nn && nb[k] >= 0; ++k) {
+                count += nb[k] != workload_idx;
+            }
+            if (count == 0) {
+                return;
+            }
+            const double hist_incr = 100.0 / count;
+            double spfh[33] = {0};
+            for (int64_t k = 0; k < max_nn && nb[k] >= 0; ++k) {
+                if (nb[k] == workload_idx) continue;
+                double feature[3] = {0, 0, 0};
+                ComputePairFeatures(p, nrm, points_ptr + 3 * nb[k],
+                                    normals_ptr + 3 * nb[k], feature);
+                spfh[FeatureBin((feature[0] + kPi) / (2.0 * kPi))] +=
+                        hist_incr;
+                spfh[11 + FeatureBin((feature[1] + 1.0) * 0.5)] += hist_incr;
+                spfh[22 + FeatureBin((feature[2] + 1.0) * 0.5)] += hist_incr;
+            }
+            scalar_t *out = spfhs_ptr + 33 * workload_idx;
+            for (int j = 0; j < 33; ++j) {
+                out[j] = static_cast<scalar_t>(spfh[j]);
+            }
+        });
+
+        // FPFH: SPFH of the point plus the normalized inverse squared
+        // distance weighted SPFHs of its neighbors.
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            const int64_t *nb = neighbors_ptr + workload_idx * max_nn;
+            const scalar_t *p = points_ptr + 3 * workload_idx;
+            double fpfh[33] = {0};
+            double sum[3] = {0, 0, 0};
+            bool has_neighbors = false;
+            for (int64_t k = 0; k < max_nn && nb[k] >= 0; ++k) {
+                if (nb[k] == workload_idx) continue;
+                has_neighbors = true;
+                const scalar_t *q = points_ptr + 3 * nb[k];
+                const double dist = (double(q[0]) - p[0]) * (q[0] - p[0]) +
+                                    (double(q[1]) - p[1]) * (q[1] - p[1]) +
+                                    (double(q[2]) - p[2]) * (q[2] - p[2]);
+                if (dist == 0) continue;
+                const scalar_t *spfh = spfhs_ptr + 33 * nb[k];
+                for (int j = 0; j < 33; ++j) {
+                    const double val = spfh[j] / dist;
+                    sum[j / 11] += val;
+                    fpfh[j] += val;
+                }
+            }
+            if (!has_neighbors) {
+                return;
+            }
+            for (int j = 0; j < 3; ++j) {
+                if (sum[j] != 0) sum[j] = 100.0 / sum[j];
+            }
+            const scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            scalar_t *out = fpfhs_ptr + 33 * workload_idx;
+            for (int j = 0; j < 33; ++j) {
+                out[j] = static_cast<scalar_t>(fpfh[j] * sum[j / 11] +
+                                               spfh[j]);
+            }
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/FusedICP.h"
+
+#include "open3d/t/pipelines/kernel/FusedICPImpl.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace icp {
+
+void BuildCorrespondenceGrid(const core::Tensor &target_points,
+                             const core::Tensor &target_normals,
+                             float cell_size,
+                             core::Tensor &cell_keys,
+                             core::Tensor &grid_points,
+                             core::Tensor &grid_normals,
+                             core::Tensor &grid_order) {
+    core::Device device = target_points.GetDevice();
+    target_points.AssertDtype(core::Dtype::Float32);
+    target_normals.AssertDtype(core::Dtype::Float32);
+    target_normals.AssertDevice(device);
+    if (cell_size <= 0) {
+        utility::LogError("Cell size must be positive, but got {}.",
+                          cell_size);
+    }
+
+    const core::Tensor points = target_points.Contiguous();
+    const core::Tensor normals = target_normals.Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        BuildCorrespondenceGridCPU(points, normals, cell_size, cell_keys,
+                                   grid_points, grid_normals, grid_order);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BuildCorrespondenceGridCUDA(points, normals, cell_size, cell_keys,
+                                    grid_points, grid_normals, grid_order);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void ComputeRegistrationPointToPlane(
+        const core::Tensor &source_points,
+        const core::Tensor &cell_keys,
+        const core::Tensor &grid_points,
+        const core::Tensor &grid_normals,
+        const core::Tensor &grid_order,
+        float max_correspondence_distance,
+        const registration::ICPConvergenceCriteria &criteria,
+        const registration::RobustKernel &kernel,
+        core::Tensor &transformation,
+        core::Tensor &metrics,
+        core::Tensor &correspondences) {
+    core::Device device = source_points.GetDevice();
+    source_points.AssertDtype(core::Dtype::Float32);
+    grid_points.AssertDevice(device);
+    transformation.AssertShape({4, 4});
+
+    // Transformation, metrics and iteration stay on the device.
+    core::Tensor state =
+            core::Tensor::Zeros({kStateSize}, core::Dtype::Float64, device);
+    state.Slice(0, kTransformation, kTransformation + 16) =
+            transformation.To(device, core::Dtype::Float64).Reshape({16});
+    correspondences = core::Tensor::Empty({source_points.GetLength()},
+                                          core::Dtype::Int64, device);
+
+    const core::Tensor points = source_points.Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ComputeRegistrationPointToPlaneCPU(
+                points, cell_keys, grid_points, grid_normals, grid_order,
+                max_correspondence_distance, criteria, kernel, state,
+                correspondences);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeRegistrationPointToPlaneCUDA(
+                points, cell_keys, grid_points, grid_normals, grid_order,
+                max_correspondence_distance, criteria, kernel, state,
+                correspondences);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    transformation = state.Slice(0, kTransformation, kTransformation + 16)
+                             .Reshape({4, 4});
+    metrics = state.Slice(0, kFitness, kInlierRMSE + 1);
+}
+
+}  // namespace icp
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
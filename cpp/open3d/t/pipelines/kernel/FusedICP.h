@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace icp {
+
+/// \brief Sorts the target points by cells of a uniform grid of size
+/// \p cell_size, to search correspondences on the device.
+///
+/// \param target_points Target points {N, 3}, Float32.
+/// \param target_normals Target normals {N, 3}, Float32.
+/// \param cell_size Size of the cells, at least the maximum correspondence
+/// distance.
+/// \param cell_keys Output sorted cell keys {N}, Int64.
+/// \param grid_points Output target points in cell order {N, 3}.
+/// \param grid_normals Output target normals in cell order {N, 3}.
+/// \param grid_order Output index in target_points of each grid point {N},
+/// Int64.
+void BuildCorrespondenceGrid(const core::Tensor &target_points,
+                             const core::Tensor &target_normals,
+                             float cell_size,
+                             core::Tensor &cell_keys,
+                             core::Tensor &grid_points,
+                             core::Tensor &grid_normals,
+                             core::Tensor &grid_order);
+
+/// \brief Runs the point to plane ICP iterations of one scale on the device.
+///
+/// Each iteration searches the correspondences in the grid, evaluates the
+/// residuals and the Jacobians and reduces JtJ and Jtr in a single kernel,
+/// then solves and checks the convergence in a second single thread kernel.
+/// Nothing is copied to the host until the iterations end.
+///
+/// \param source_points Source points {N, 3}, Float32.
+/// \param cell_keys, grid_points, grid_normals, grid_order Output of
+/// BuildCorrespondenceGrid with cell_size \p max_correspondence_distance.
+/// \param max_correspondence_distance Maximum correspondence distance.
+/// \param criteria Convergence criteria of the scale.
+/// \param kernel Robust kernel weighting the residuals.
+/// \param transformation Source to target transformation {4, 4}, Float64 on
+/// the device of the points, updated in place.
+/// \param metrics Output fitness and inlier RMSE {2}, Float64, of the last
+/// transformation.
+/// \param correspondences Output index of the target point corresponding to
+/// each source point {N}, or -1, Int64.
+void ComputeRegistrationPointToPlane(
+        const core::Tensor &source_points,
+        const core::Tensor &cell_keys,
+        const core::Tensor &grid_points,
+        const core::Tensor &grid_normals,
+        const core::Tensor &grid_order,
+        float max_correspondence_distance,
+        const registration::ICPConvergenceCriteria &criteria,
+        const registration::RobustKernel &kernel,
+        core::Tensor &transformation,
+        core::Tensor &metrics,
+        core::Tensor &correspondences);
+
+}  // namespace icp
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
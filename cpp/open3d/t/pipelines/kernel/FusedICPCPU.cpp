@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/FusedICPImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace icp {
+
+void BuildCorrespondenceGridCPU(const core::Tensor &target_points,
+                                const core::Tensor &target_normals,
+                                float cell_size,
+                                core::Tensor &cell_keys,
+                                core::Tensor &grid_points,
+                                core::Tensor &grid_normals,
+                                core::Tensor &grid_order) {
+    const int64_t n = target_points.GetLength();
+    const float *points_ptr = target_points.GetDataPtr<float>();
+
+    std::vector<int64_t> keys(n);
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+                keys[workload_idx] =
+                        CellKeyOf(points_ptr + 3 * workload_idx, cell_size);
+            });
+    std::vector<int64_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    tbb::parallel_sort(order.begin(), order.end(),
+                       [&](int64_t a, int64_t b) {
+                           return keys[a] < keys[b] ||
+                                  (keys[a] == keys[b] && a < b);
+                       });
+
+    cell_keys = core::Tensor::Empty({n}, core::Dtype::Int64,
+                                    target_points.GetDevice());
+    int64_t *cell_keys_ptr = cell_keys.GetDataPtr<int64_t>();
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n, [&](int64_t workload_idx) {
+                cell_keys_ptr[workload_idx] = keys[order[workload_idx]];
+            });
+    grid_order = core::Tensor(order, {n}, core::Dtype::Int64,
+                              target_points.GetDevice());
+    grid_points = target_points.IndexGet({grid_order});
+    grid_normals = target_normals.IndexGet({grid_order});
+}
+
+void ComputeRegistrationPointToPlaneCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &cell_keys,
+        const core::Tensor &grid_points,
+        const core::Tensor &grid_normals,
+        const core::Tensor &grid_order,
+        float max_correspondence_distance,
+        const registration::ICPConvergenceCriteria &criteria,
+        const registration::RobustKernel &kernel,
+        core::Tensor &state,
+        core::Tensor &correspondences) {
+    const int64_t n = source_points.GetLength();
+    const int64_t num_grid_points = grid_points.GetLength();
+    const float *source_points_ptr = source_points.GetDataPtr<float>();
+    const int64_t *cell_keys_ptr = cell_keys.GetDataPtr<int64_t>();
+    const float *grid_points_ptr = grid_points.GetDataPtr<float>();
+    const float *grid_normals_ptr = grid_normals.GetDataPtr<float>();
+    const int64_t *grid_order_ptr = grid_order.GetDataPtr<int64_t>();
+    double *state_ptr = state.GetDataPtr<double>();
+    int64_t *correspondences_ptr = correspondences.GetDataPtr<int64_t>();
+    const float scaling_parameter =
+            static_cast<float>(kernel.scaling_parameter_);
+
+    for (int k = 0; k <= criteria.max_iteration_ && state_ptr[kDone] == 0;
+         k++) {
+        std::vector<float> zeros_29(kReductionSize, 0.0);
+        std::vector<float> A_1x29 = tbb::parallel_reduce(
+                tbb::blocked_range<int64_t>(0, n), zeros_29,
+                [&](tbb::blocked_range<int64_t> r,
+                    std::vector<float> A_reduction) {
+                    float reduction[kReductionSize];
+                    for (int64_t workload_idx = r.begin();
+                         workload_idx < r.end(); workload_idx++) {
+                        correspondences_ptr[workload_idx] =
+                                GetPointToPlaneTerms(
+                                        workload_idx, source_points_ptr,
+                                        cell_keys_ptr, grid_points_ptr,
+                                        grid_normals_ptr, grid_order_ptr,
+                                        num_grid_points,
+                                        max_correspondence_distance,
+                                        kernel.type_, scaling_parameter,
+                                        state_ptr + kTransformation, reduction);
+                        for (int i = 0; i < kReductionSize; i++) {
+                            A_reduction[i] += reduction[i];
+                        }
+                    }
+                    return A_reduction;
+                },
+                [&](std::vector<float> a, std::vector<float> b) {
+                    std::vector<float> result(kReductionSize);
+                    for (int i = 0; i < kReductionSize; i++) {
+                        result[i] = a[i] + b[i];
+                    }
+                    return result;
+                });
+        UpdateTransformation(state_ptr, A_1x29.data(), n,
+                             criteria.relative_fitness_,
+                             criteria.relative_rmse_, criteria.max_iteration_);
+    }
+}
+
+}  // namespace icp
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cub/cub.cuh>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/FusedICPImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace icp {
+
+void BuildCorrespondenceGridCUDA(const core::Tensor& target_points,
+                                 const core::Tensor& target_normals,
+                                 float cell_size,
+                                 core::Tensor& cell_keys,
+                                 core::Tensor& grid_points,
+                                 core::Tensor& grid_normals,
+                                 core::Tensor& grid_order) {
+    const int64_t n = target_points.GetLength();
+    core::Device device = target_points.GetDevice();
+    const float* points_ptr = target_points.GetDataPtr<float>();
+
+    cell_keys = core::Tensor::Empty({n}, core::Dtype::Int64, device);
+    grid_order = core::Tensor::Empty({n}, core::Dtype::Int64, device);
+    int64_t* cell_keys_ptr = cell_keys.GetDataPtr<int64_t>();
+    int64_t* grid_order_ptr = grid_order.GetDataPtr<int64_t>();
+    core::kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                cell_keys_ptr[workload_idx] =
+                        CellKeyOf(points_ptr + 3 * workload_idx, cell_size);
+            });
+    thrust::sequence(thrust::device, grid_order_ptr, grid_order_ptr + n);
+    thrust::stable_sort_by_key(thrust::device, cell_keys_ptr,
+                               cell_keys_ptr + n, grid_order_ptr);
+    grid_points = target_points.IndexGet({grid_order});
+    grid_normals = target_normals.IndexGet({grid_order});
+}
+
+__global__ void ComputeCorrespondencesPointToPlaneCUDAKernel(
+        const float* source_points_ptr,
+        const int64_t* cell_keys_ptr,
+        const float* grid_points_ptr,
+        const float* grid_normals_ptr,
+        const int64_t* grid_order_ptr,
+        int64_t n,
+        int64_t num_grid_points,
+        float max_correspondence_distance,
+        registration::RobustKernelMethod method,
+        float scaling_parameter,
+        const double* state_ptr,
+        int64_t* correspondences_ptr,
+        float* global_sum) {
+    const int kBlockSize = 256;
+    typedef cub::BlockReduce<float, kBlockSize> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+
+    // The whole block returns together, before any synchronization.
+    if (state_ptr[kDone] != 0) return;
+
+    const int64_t workload_idx =
+            threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x;
+    float reduction[kReductionSize] = {0};
+    if (workload_idx < n) {
+        correspondences_ptr[workload_idx] = GetPointToPlaneTerms(
+                workload_idx, source_points_ptr, cell_keys_ptr,
+                grid_points_ptr, grid_normals_ptr, grid_order_ptr,
+                num_grid_points, max_correspondence_distance, method,
+                scaling_parameter, state_ptr + kTransformation, reduction);
+    }
+
+    for (int i = 0; i < kReductionSize; i++) {
+        float sum = BlockReduce(temp_storage).Sum(reduction[i]);
+        if (threadIdx.x == 0) {
+            atomicAdd(&global_sum[i], sum);
+        }
+        __syncthreads();
+    }
+}
+
+__global__ void UpdateTransformationCUDAKernel(double* state_ptr,
+                                               float* global_sum,
+                                               int64_t n,
+                                               double relative_fitness,
+                                               double relative_rmse,
+                                               int max_iteration) {
+    UpdateTransformation(state_ptr, global_sum, n, relative_fitness,
+                         relative_rmse, max_iteration);
+}
+
+void ComputeRegistrationPointToPlaneCUDA(
+        const core::Tensor& source_points,
+        const core::Tensor& cell_keys,
+        const core::Tensor& grid_points,
+        const core::Tensor& grid_normals,
+        const core::Tensor& grid_order,
+        float max_correspondence_distance,
+        const registration::ICPConvergenceCriteria& criteria,
+        const registration::RobustKernel& kernel,
+        core::Tensor& state,
+        core::Tensor& correspondences) {
+    const int64_t n = source_points.GetLength();
+    core::Device device = source_points.GetDevice();
+
+    core::Tensor global_sum = core::Tensor::Zeros(
+            {kReductionSize}, core::Dtype::Float32, device);
+    float* global_sum_ptr = global_sum.GetDataPtr<float>();
+    double* state_ptr = state.GetDataPtr<double>();
+
+    // The iterations are queued without waiting: the convergence is only
+    // known on the device, and the kernels of a converged state return
+    // immediately.
+    const int kThreadSize = 256;
+    const int64_t blocks = (n + kThreadSize - 1) / kThreadSize;
+    for (int k = 0; k <= criteria.max_iteration_; k++) {
+        ComputeCorrespondencesPointToPlaneCUDAKernel<<<blocks, kThreadSize>>>(
+                source_points.GetDataPtr<float>(),
+                cell_keys.GetDataPtr<int64_t>(),
+                grid_points.GetDataPtr<float>(),
+                grid_normals.GetDataPtr<float>(),
+                grid_order.GetDataPtr<int64_t>(), n, grid_points.GetLength(),
+                max_correspondence_distance, kernel.type_,
+                static_cast<float>(kernel.scaling_parameter_), state_ptr,
+                correspondences.GetDataPtr<int64_t>(), global_sum_ptr);
+        UpdateTransformationCUDAKernel<<<1, 1>>>(
+                state_ptr, global_sum_ptr, n, criteria.relative_fitness_,
+                criteria.relative_rmse_, criteria.max_iteration_);
+    }
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+}  // namespace icp
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
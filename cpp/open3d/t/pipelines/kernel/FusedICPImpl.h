@@ -0,0 +1,269 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/ComputeTransformImpl.h"
+#include "open3d/t/pipelines/kernel/TransformationConverterImpl.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace icp {
+
+/// Layout of the Float64 state of ComputeRegistrationPointToPlane, kept on
+/// the device between the launches.
+enum ICPState {
+    kTransformation = 0,  // 16 entries, row-major.
+    kFitness = 16,
+    kInlierRMSE = 17,
+    kIteration = 18,
+    kDone = 19,
+    kStateSize = 20,
+};
+
+/// Number of Float32 entries reduced per iteration: 21 for the lower
+/// triangle of JtJ, 6 for Jtr, 1 for the squared distances, 1 for the
+/// correspondence count.
+constexpr int kReductionSize = 29;
+
+/// Cells coordinates are clamped to 21 bits each.
+constexpr int64_t kCellOffset = int64_t(1) << 20;
+
+OPEN3D_HOST_DEVICE inline int64_t CellKey(int64_t x, int64_t y, int64_t z) {
+    x = x < -kCellOffset ? 0 : (x >= kCellOffset ? 2 * kCellOffset - 1
+                                                 : x + kCellOffset);
+    y = y < -kCellOffset ? 0 : (y >= kCellOffset ? 2 * kCellOffset - 1
+                                                 : y + kCellOffset);
+    z = z < -kCellOffset ? 0 : (z >= kCellOffset ? 2 * kCellOffset - 1
+                                                 : z + kCellOffset);
+    return (x << 42) | (y << 21) | z;
+}
+
+OPEN3D_HOST_DEVICE inline int64_t CellKeyOf(const float *p, float cell_size) {
+    return CellKey(static_cast<int64_t>(floorf(p[0] / cell_size)),
+                   static_cast<int64_t>(floorf(p[1] / cell_size)),
+                   static_cast<int64_t>(floorf(p[2] / cell_size)));
+}
+
+/// Finds the nearest grid point of \p p closer than \p max_distance, among
+/// the 27 cells around the cell of \p p. Returns its position in the grid, or
+/// -1, and its squared distance in \p distance2.
+OPEN3D_HOST_DEVICE inline int64_t FindCorrespondence(
+        const float *p,
+        const int64_t *cell_keys_ptr,
+        const float *grid_points_ptr,
+        int64_t num_grid_points,
+        float max_distance,
+        float &distance2) {
+    const int64_t cx = static_cast<int64_t>(floorf(p[0] / max_distance));
+    const int64_t cy = static_cast<int64_t>(floorf(p[1] / max_distance));
+    const int64_t cz = static_cast<int64_t>(floorf(p[2] / max_distance));
+    int64_t nearest = -1;
+    distance2 = max_distance * max_distance;
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dz = -1; dz <= 1; dz++) {
+                const int64_t key = CellKey(cx + dx, cy + dy, cz + dz);
+                // First point of the cell.
+                int64_t lo = 0, hi = num_grid_points;
+                while (lo < hi) {
+                    int64_t mid = lo + (hi - lo) / 2;
+                    if (cell_keys_ptr[mid] < key) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                for (; lo < num_grid_points && cell_keys_ptr[lo] == key;
+                     lo++) {
+                    const float *q = grid_points_ptr + 3 * lo;
+                    const float d2 = (p[0] - q[0]) * (p[0] - q[0]) +
+                                     (p[1] - q[1]) * (p[1] - q[1]) +
+                                     (p[2] - q[2]) * (p[2] - q[2]);
+                    if (d2 < distance2) {
+                        distance2 = d2;
+                        nearest = lo;
+                    }
+                }
+            }
+        }
+    }
+    return nearest;
+}
+
+/// Transforms source point \p workload_idx, finds its correspondence and
+/// fills its \p reduction terms weighted by the robust kernel \p method,
+/// like the point to plane ComputePosePointToPlane. Returns the index of the
+/// target point, or -1.
+OPEN3D_HOST_DEVICE inline int64_t GetPointToPlaneTerms(
+        int64_t workload_idx,
+        const float *source_points_ptr,
+        const int64_t *cell_keys_ptr,
+        const float *grid_points_ptr,
+        const float *grid_normals_ptr,
+        const int64_t *grid_order_ptr,
+        int64_t num_grid_points,
+        float max_distance,
+        registration::RobustKernelMethod method,
+        float scaling_parameter,
+        const double *T,
+        float *reduction) {
+    const float *s = source_points_ptr + 3 * workload_idx;
+    float p[3];
+    for (int i = 0; i < 3; i++) {
+        p[i] = static_cast<float>(T[4 * i] * s[0] + T[4 * i + 1] * s[1] +
+                                  T[4 * i + 2] * s[2] + T[4 * i + 3]);
+    }
+    for (int i = 0; i < kReductionSize; i++) {
+        reduction[i] = 0;
+    }
+    float distance2;
+    const int64_t nearest =
+            FindCorrespondence(p, cell_keys_ptr, grid_points_ptr,
+                               num_grid_points, max_distance, distance2);
+    if (nearest < 0) {
+        return -1;
+    }
+    const float *q = grid_points_ptr + 3 * nearest;
+    const float *n = grid_normals_ptr + 3 * nearest;
+    const float r = (p[0] - q[0]) * n[0] + (p[1] - q[1]) * n[1] +
+                    (p[2] - q[2]) * n[2];
+    const float J[] = {n[2] * p[1] - n[1] * p[2],
+                       n[0] * p[2] - n[2] * p[0],
+                       n[1] * p[0] - n[0] * p[1],
+                       n[0],
+                       n[1],
+                       n[2]};
+    const float w = ComputeRobustWeight(method, scaling_parameter, r);
+    for (int i = 0, j = 0; j < 6; j++) {
+        for (int k = 0; k <= j; k++) {
+            reduction[i++] = w * J[j] * J[k];
+        }
+        reduction[21 + j] = w * J[j] * r;
+    }
+    reduction[27] = distance2;
+    reduction[28] = 1;
+    return grid_order_ptr[nearest];
+}
+
+/// Ends an iteration on a single thread: updates the fitness and the inlier
+/// RMSE from \p reduction, checks the convergence like RegistrationICP, and
+/// otherwise solves the linear system and left-multiplies the transformation
+/// by the update. \p reduction is cleared for the next iteration.
+OPEN3D_HOST_DEVICE inline void UpdateTransformation(
+        double *state,
+        float *reduction,
+        int64_t num_source_points,
+        double relative_fitness,
+        double relative_rmse,
+        int max_iteration) {
+    if (state[kDone] != 0) {
+        return;
+    }
+    const double count = reduction[28];
+    const double fitness = count / static_cast<double>(num_source_points);
+    const double inlier_rmse = count > 0 ? sqrt(reduction[27] / count) : 0;
+    const int iteration = static_cast<int>(state[kIteration]);
+    const bool converged =
+            iteration >= 2 &&
+            fabs(state[kFitness] - fitness) < relative_fitness &&
+            fabs(state[kInlierRMSE] - inlier_rmse) < relative_rmse;
+    state[kFitness] = fitness;
+    state[kInlierRMSE] = inlier_rmse;
+    state[kIteration] = iteration + 1;
+    if (converged || iteration >= max_iteration) {
+        state[kDone] = 1;
+    } else {
+        // JtJ is symmetric positive semi-definite. The iterations stop if it
+        // is singular.
+        double pose[6];
+        if (SolveJtJCholesky(reduction, pose)) {
+            ApplyPoseUpdateImpl<double>(state + kTransformation, pose);
+        } else {
+            state[kDone] = 1;
+        }
+    }
+    for (int i = 0; i < kReductionSize; i++) {
+        reduction[i] = 0;
+    }
+}
+
+void BuildCorrespondenceGridCPU(const core::Tensor &target_points,
+                                const core::Tensor &target_normals,
+                                float cell_size,
+                                core::Tensor &cell_keys,
+                                core::Tensor &grid_points,
+                                core::Tensor &grid_normals,
+                                core::Tensor &grid_order);
+
+void ComputeRegistrationPointToPlaneCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &cell_keys,
+        const core::Tensor &grid_points,
+        const core::Tensor &grid_normals,
+        const core::Tensor &grid_order,
+        float max_correspondence_distance,
+        const registration::ICPConvergenceCriteria &criteria,
+        const registration::RobustKernel &kernel,
+        core::Tensor &state,
+        core::Tensor &correspondences);
+
+#ifdef BUILD_CUDA_MODULE
+void BuildCorrespondenceGridCUDA(const core::Tensor &target_points,
+                                 const core::Tensor &target_normals,
+                                 float cell_size,
+                                 core::Tensor &cell_keys,
+                                 core::Tensor &grid_points,
+                                 core::Tensor &grid_normals,
+                                 core::Tensor &grid_order);
+
+void ComputeRegistrationPointToPlaneCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &cell_keys,
+        const core::Tensor &grid_points,
+        const core::Tensor &grid_normals,
+        const core::Tensor &grid_order,
+        float max_correspondence_distance,
+        const registration::ICPConvergenceCriteria &criteria,
+        const registration::RobustKernel &kernel,
+        core::Tensor &state,
+        core::Tensor &correspondences);
+#endif
+
+}  // namespace icp
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
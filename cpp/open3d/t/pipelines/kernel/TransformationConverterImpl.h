@@ -60,6 +60,32 @@ OPEN3D_HOST_DEVICE inline void PoseToTransformationImpl(
     transformation_ptr[10] = cos(pose_ptr[1]) * cos(pose_ptr[0]);
 }
 
+/// Left-multiplies the row-major 4x4 \p transformation by the rigid
+/// transformation of \p pose [alpha beta gamma X Y Z].
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ApplyPoseUpdateImpl(scalar_t *transformation,
+                                                   const scalar_t *pose) {
+    scalar_t update[16] = {0};
+    PoseToTransformationImpl<scalar_t>(update, pose);
+    update[3] = pose[3];
+    update[7] = pose[4];
+    update[11] = pose[5];
+    update[15] = 1;
+    scalar_t result[16];
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            result[4 * i + j] = 0;
+            for (int k = 0; k < 4; k++) {
+                result[4 * i + j] +=
+                        update[4 * i + k] * transformation[4 * k + j];
+            }
+        }
+    }
+    for (int i = 0; i < 16; i++) {
+        transformation[i] = result[i];
+    }
+}
+
 #ifdef BUILD_CUDA_MODULE
 /// \brief Helper function for PoseToTransformationCUDA.
 /// Do not call this independently, as it only sets the transformation part
@@ -26,11 +26,13 @@
 
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/ScopedArena.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RGBDImage.h"
-#include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/pipelines/kernel/RGBDOdometry.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Timer.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 
 namespace open3d {
@@ -38,58 +40,177 @@ namespace t {
 namespace pipelines {
 namespace odometry {
 
-namespace {
-t::geometry::Image PyrDownDepth(t::geometry::Image& src,
-                                float diff_threshold,
-                                float invalid_fill) {
-    if (src.GetRows() <= 0 || src.GetCols() <= 0 || src.GetChannels() != 1) {
-        utility::LogError(
-                "Invalid shape, expected a 1 channel image, but got ({}, {}, "
-                "{})",
-                src.GetRows(), src.GetCols(), src.GetChannels());
-    }
-    if (src.GetDtype() != core::Dtype::Float32) {
-        utility::LogError("Expected a Float32 image, but got {}",
-                          src.GetDtype().ToString());
+using Pyramid = std::vector<std::unordered_map<std::string, core::Tensor>>;
+
+static void SynchronizeDevice(const core::Device& device) {
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        core::CUDAStream::GetCurrent().Synchronize();
     }
+}
+
+/// Returns the Float64 host intrinsics of each level, from coarse to fine.
+static std::vector<core::Tensor> CreateIntrinsicPyramid(
+        const core::Tensor& intrinsics, int64_t n_levels) {
+    core::Tensor intrinsics_d =
+            intrinsics.To(core::Device("CPU:0"), core::Dtype::Float64).Clone();
 
-    core::Tensor dst_tensor =
-            core::Tensor::Empty({src.GetRows() / 2, src.GetCols() / 2, 1},
-                                src.GetDtype(), src.GetDevice());
-    t::geometry::kernel::image::PyrDownDepth(src.AsTensor(), dst_tensor,
-                                             diff_threshold, invalid_fill);
-    return t::geometry::Image(dst_tensor);
+    std::vector<core::Tensor> intrinsic_matrices(n_levels);
+    for (int64_t i = 0; i < n_levels; ++i) {
+        intrinsic_matrices[n_levels - 1 - i] = intrinsics_d.Clone();
+        intrinsics_d /= 2;
+        intrinsics_d[-1][-1] = 1;
+    }
+    return intrinsic_matrices;
 }
-}  // namespace
 
-core::Tensor RGBDOdometryMultiScalePointToPlane(
-        const t::geometry::RGBDImage& source,
-        const t::geometry::RGBDImage& target,
-        core::Tensor& intrinsics,
-        core::Tensor& trans,
+/// Builds the per-level maps of \p rgbd that \p method reads from a source
+/// frame (\p as_source) and/or from a target frame (\p as_target). Levels are
+/// stored from coarse to fine. If \p level_times is given, it receives the
+/// time in milliseconds spent on each level.
+static Pyramid CreateOdometryPyramid(
+        const t::geometry::RGBDImage& rgbd,
+        const std::vector<core::Tensor>& intrinsic_matrices,
         float depth_scale,
         float depth_max,
         float depth_diff,
-        const std::vector<int>& iterations);
+        const Method method,
+        bool as_source,
+        bool as_target,
+        std::vector<double>* level_times) {
+    const int64_t n_levels = int64_t(intrinsic_matrices.size());
+    const bool use_intensity = method != Method::PointToPlane;
+    const core::Device device = rgbd.depth_.GetDevice();
+
+    Pyramid pyramid(n_levels);
+    if (level_times != nullptr) {
+        level_times->assign(n_levels, 0.0);
+    }
 
-core::Tensor RGBDOdometryMultiScaleIntensity(
-        const t::geometry::RGBDImage& source,
-        const t::geometry::RGBDImage& target,
-        core::Tensor& intrinsic,
-        core::Tensor& trans,
-        float depth_scale,
-        float depth_max,
+    utility::Timer timer;
+    timer.Start();
+    t::geometry::Image depth = rgbd.depth_;
+    depth = depth.ClipTransform(depth_scale, 0, depth_max, NAN);
+    t::geometry::Image intensity;
+    if (use_intensity) {
+        intensity = rgbd.color_.RGBToGray().To(core::Dtype::Float32);
+    }
+
+    // Build from fine to coarse, each level from the previous one.
+    for (int64_t i = 0; i < n_levels; ++i) {
+        const int64_t level = n_levels - 1 - i;
+        auto& maps = pyramid[level];
+
+        if (i != 0) {
+            depth = depth.PyrDownDepth(depth_diff * 2, NAN);
+            if (use_intensity) {
+                intensity = intensity.PyrDown();
+            }
+        }
+
+        if (as_source || (as_target && !use_intensity)) {
+            t::geometry::Image vertex_map =
+                    depth.CreateVertexMap(intrinsic_matrices[level], NAN);
+            if (as_target && !use_intensity) {
+                maps["normal"] = vertex_map.CreateNormalMap(NAN).AsTensor();
+            }
+            maps["vertex"] = vertex_map.AsTensor();
+        }
+
+        if (use_intensity) {
+            maps["depth"] = depth.AsTensor();
+            maps["intensity"] = intensity.AsTensor();
+            if (as_target) {
+                auto intensity_grad = intensity.FilterSobel();
+                maps["intensity_dx"] = intensity_grad.first.AsTensor();
+                maps["intensity_dy"] = intensity_grad.second.AsTensor();
+            }
+            if (as_target && method == Method::Hybrid) {
+                auto depth_grad = depth.FilterSobel();
+                maps["depth_dx"] = depth_grad.first.AsTensor();
+                maps["depth_dy"] = depth_grad.second.AsTensor();
+            }
+        }
+
+        if (level_times != nullptr) {
+            SynchronizeDevice(device);
+            timer.Stop();
+            (*level_times)[level] = timer.GetDuration();
+            timer.Start();
+        }
+    }
+
+    return pyramid;
+}
+
+/// Size of the arena serving the temporaries of one odometry iteration.
+static constexpr int64_t kOdometryArenaByteSize = 1 << 20;
+
+/// Runs coarse-to-fine odometry from \p init_source_to_target (Float64 on
+/// host). If \p level_times is given, it receives the time in milliseconds
+/// spent on each level.
+static core::Tensor RunMultiScaleOdometry(
+        const Pyramid& source,
+        const Pyramid& target,
+        const std::vector<core::Tensor>& intrinsic_matrices,
+        const core::Tensor& init_source_to_target,
         float depth_diff,
-        const std::vector<int>& iterations);
+        const std::vector<int>& iterations,
+        const Method method,
+        const core::Device& device,
+        std::vector<double>* level_times) {
+    const int64_t n_levels = int64_t(iterations.size());
+    if (level_times != nullptr) {
+        level_times->assign(n_levels, 0.0);
+    }
+
+    core::Tensor trans = init_source_to_target;
+    utility::Timer timer;
+    for (int64_t i = 0; i < n_levels; ++i) {
+        const auto& src = source[i];
+        const auto& dst = target[i];
 
-core::Tensor RGBDOdometryMultiScaleHybrid(const t::geometry::RGBDImage& source,
-                                          const t::geometry::RGBDImage& target,
-                                          core::Tensor& intrinsics,
-                                          core::Tensor& trans,
-                                          float depth_scale,
-                                          float depth_max,
-                                          float depth_diff,
-                                          const std::vector<int>& iterations);
+        timer.Start();
+        for (int iter = 0; iter < iterations[i]; ++iter) {
+            core::Tensor delta_source_to_target;
+            {
+                // The temporaries of an iteration are released together.
+                core::ScopedArena arena(device, kOdometryArenaByteSize);
+                if (method == Method::PointToPlane) {
+                    delta_source_to_target = ComputePosePointToPlane(
+                            src.at("vertex"), dst.at("vertex"),
+                            dst.at("normal"), intrinsic_matrices[i], trans,
+                            depth_diff);
+                } else if (method == Method::Intensity) {
+                    delta_source_to_target = ComputePoseIntensity(
+                            src.at("depth"), dst.at("depth"),
+                            src.at("intensity"), dst.at("intensity"),
+                            dst.at("intensity_dx"), dst.at("intensity_dy"),
+                            src.at("vertex"), intrinsic_matrices[i], trans,
+                            depth_diff);
+                } else if (method == Method::Hybrid) {
+                    delta_source_to_target = ComputePoseHybrid(
+                            src.at("depth"), dst.at("depth"),
+                            src.at("intensity"), dst.at("intensity"),
+                            dst.at("depth_dx"), dst.at("depth_dy"),
+                            dst.at("intensity_dx"), dst.at("intensity_dy"),
+                            src.at("vertex"), intrinsic_matrices[i], trans,
+                            depth_diff);
+                } else {
+                    utility::LogError("Odometry method not implemented.");
+                }
+            }
+            trans = delta_source_to_target.Matmul(trans).Contiguous();
+        }
+
+        if (level_times != nullptr) {
+            SynchronizeDevice(device);
+            timer.Stop();
+            (*level_times)[i] = timer.GetDuration();
+        }
+    }
+
+    return trans;
+}
 
 core::Tensor RGBDOdometryMultiScale(const t::geometry::RGBDImage& source,
                                     const t::geometry::RGBDImage& target,
@@ -102,6 +223,8 @@ core::Tensor RGBDOdometryMultiScale(const t::geometry::RGBDImage& source,
                                     const Method method) {
     // TODO (wei): more device check
     core::Device device = source.depth_.GetDevice();
+    OPEN3D_CUDA_PROFILE_SCOPE(
+            "t::pipelines::odometry::RGBDOdometryMultiScale", device);
     if (target.depth_.GetDevice() != device) {
         utility::LogError(
                 "Device mismatch, got {} for source and {} for target.",
@@ -110,264 +233,90 @@ core::Tensor RGBDOdometryMultiScale(const t::geometry::RGBDImage& source,
 
     // 4x4 transformations are always float64 and stay on CPU.
     core::Device host("CPU:0");
-    core::Tensor intrinsics_d =
-            intrinsics.To(host, core::Dtype::Float64).Clone();
     core::Tensor trans_d =
             init_source_to_target.To(host, core::Dtype::Float64).Clone();
 
-    t::geometry::Image source_depth = source.depth_;
-    t::geometry::Image target_depth = target.depth_;
-
-    t::geometry::Image source_depth_processed =
-            source_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-    t::geometry::Image target_depth_processed =
-            target_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-
-    t::geometry::RGBDImage source_processed(source.color_,
-                                            source_depth_processed);
-    t::geometry::RGBDImage target_processed(target.color_,
-                                            target_depth_processed);
-
-    if (method == Method::PointToPlane) {
-        return RGBDOdometryMultiScalePointToPlane(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, depth_diff, iterations);
-    } else if (method == Method::Intensity) {
-        return RGBDOdometryMultiScaleIntensity(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, depth_diff, iterations);
-    } else if (method == Method::Hybrid) {
-        return RGBDOdometryMultiScaleHybrid(source_processed, target_processed,
-                                            intrinsics_d, trans_d, depth_scale,
-                                            depth_max, depth_diff, iterations);
-    } else {
-        utility::LogError("Odometry method not implemented.");
-    }
-
-    return trans_d;
+    std::vector<core::Tensor> intrinsic_matrices =
+            CreateIntrinsicPyramid(intrinsics, int64_t(iterations.size()));
+
+    Pyramid source_pyramid =
+            CreateOdometryPyramid(source, intrinsic_matrices, depth_scale,
+                                  depth_max, depth_diff, method,
+                                  /*as_source=*/true, /*as_target=*/false,
+                                  /*level_times=*/nullptr);
+    Pyramid target_pyramid =
+            CreateOdometryPyramid(target, intrinsic_matrices, depth_scale,
+                                  depth_max, depth_diff, method,
+                                  /*as_source=*/false, /*as_target=*/true,
+                                  /*level_times=*/nullptr);
+
+    return RunMultiScaleOdometry(source_pyramid, target_pyramid,
+                                 intrinsic_matrices, trans_d, depth_diff,
+                                 iterations, method, device,
+                                 /*level_times=*/nullptr);
 }
 
-core::Tensor RGBDOdometryMultiScalePointToPlane(
-        const t::geometry::RGBDImage& source,
-        const t::geometry::RGBDImage& target,
-        core::Tensor& intrinsics,
-        core::Tensor& trans,
-        float depth_scale,
-        float depth_max,
-        float depth_diff,
-        const std::vector<int>& iterations) {
-    int64_t n_levels = int64_t(iterations.size());
-    std::vector<core::Tensor> source_vertex_maps(n_levels);
-    std::vector<core::Tensor> target_vertex_maps(n_levels);
-    std::vector<core::Tensor> target_normal_maps(n_levels);
-    std::vector<core::Tensor> intrinsic_matrices(n_levels);
-
-    t::geometry::Image source_depth_curr = source.depth_;
-    t::geometry::Image target_depth_curr = target.depth_;
-
-    // Create image pyramid.
-    for (int64_t i = 0; i < n_levels; ++i) {
-        t::geometry::Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics, NAN);
-        t::geometry::Image target_vertex_map =
-                target_depth_curr.CreateVertexMap(intrinsics, NAN);
-        t::geometry::Image target_normal_map =
-                target_vertex_map.CreateNormalMap(NAN);
-
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-        target_vertex_maps[n_levels - 1 - i] = target_vertex_map.AsTensor();
-        target_normal_maps[n_levels - 1 - i] = target_normal_map.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr =
-                    PyrDownDepth(source_depth_curr, depth_diff * 2, NAN);
-            target_depth_curr =
-                    PyrDownDepth(target_depth_curr, depth_diff * 2, NAN);
-
-            intrinsics /= 2;
-            intrinsics[-1][-1] = 1;
-        }
-    }
-
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < iterations[i]; ++iter) {
-            core::Tensor delta_source_to_target = ComputePosePointToPlane(
-                    source_vertex_maps[i], target_vertex_maps[i],
-                    target_normal_maps[i], intrinsic_matrices[i], trans,
-                    depth_diff);
-            trans = delta_source_to_target.Matmul(trans).Contiguous();
-        }
+RGBDOdometryTracker::RGBDOdometryTracker(const core::Tensor& intrinsics,
+                                         float depth_scale,
+                                         float depth_max,
+                                         float depth_diff,
+                                         const std::vector<int>& iterations,
+                                         const Method method)
+    : depth_scale_(depth_scale),
+      depth_max_(depth_max),
+      depth_diff_(depth_diff),
+      iterations_(iterations),
+      method_(method) {
+    if (iterations_.empty()) {
+        utility::LogError("Expected at least one pyramid level.");
     }
-
-    return trans;
+    intrinsic_matrices_ =
+            CreateIntrinsicPyramid(intrinsics, int64_t(iterations_.size()));
 }
 
-core::Tensor RGBDOdometryMultiScaleIntensity(
-        const t::geometry::RGBDImage& source,
-        const t::geometry::RGBDImage& target,
-        core::Tensor& intrinsics,
-        core::Tensor& trans,
-        float depth_scale,
-        float depth_max,
-        float depth_diff,
-        const std::vector<int>& iterations) {
-    int64_t n_levels = int64_t(iterations.size());
-    std::vector<core::Tensor> source_intensity(n_levels);
-    std::vector<core::Tensor> target_intensity(n_levels);
-
-    std::vector<core::Tensor> source_depth(n_levels);
-    std::vector<core::Tensor> target_depth(n_levels);
-    std::vector<core::Tensor> target_intensity_dx(n_levels);
-    std::vector<core::Tensor> target_intensity_dy(n_levels);
-
-    std::vector<core::Tensor> source_vertex_maps(n_levels);
-
-    std::vector<core::Tensor> intrinsic_matrices(n_levels);
-
-    t::geometry::Image source_depth_curr = source.depth_;
-    t::geometry::Image target_depth_curr = target.depth_;
-
-    t::geometry::Image source_intensity_curr =
-            source.color_.RGBToGray().To(core::Dtype::Float32);
-    t::geometry::Image target_intensity_curr =
-            target.color_.RGBToGray().To(core::Dtype::Float32);
-
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        t::geometry::Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr =
-                    PyrDownDepth(source_depth_curr, depth_diff * 2, NAN);
-            target_depth_curr =
-                    PyrDownDepth(target_depth_curr, depth_diff * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
-
-            intrinsics /= 2;
-            intrinsics[-1][-1] = 1;
+core::Tensor RGBDOdometryTracker::Track(
+        const t::geometry::RGBDImage& frame,
+        const core::Tensor& init_source_to_target) {
+    core::Device device = frame.depth_.GetDevice();
+    OPEN3D_CUDA_PROFILE_SCOPE(
+            "t::pipelines::odometry::RGBDOdometryTracker::Track", device);
+    if (HasReference()) {
+        core::Device reference_device =
+                reference_.back().at("vertex").GetDevice();
+        if (reference_device != device) {
+            utility::LogError(
+                    "Device mismatch, got {} for frame and {} for previous "
+                    "frame.",
+                    device.ToString(), reference_device.ToString());
         }
     }
 
-    // Odometry
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < iterations[i]; ++iter) {
-            core::Tensor delta_source_to_target = ComputePoseIntensity(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_intensity_dx[i],
-                    target_intensity_dy[i], source_vertex_maps[i],
-                    intrinsic_matrices[i], trans, depth_diff);
-            trans = delta_source_to_target.Matmul(trans);
-        }
+    // The pyramid serves as the source now and as the target of the next
+    // call, so it holds the maps of both roles.
+    Pyramid pyramid = CreateOdometryPyramid(
+            frame, intrinsic_matrices_, depth_scale_, depth_max_, depth_diff_,
+            method_, /*as_source=*/true, /*as_target=*/true, &pyramid_times_);
+
+    core::Device host("CPU:0");
+    core::Tensor trans;
+    if (HasReference()) {
+        trans = RunMultiScaleOdometry(
+                pyramid, reference_, intrinsic_matrices_,
+                init_source_to_target.To(host, core::Dtype::Float64).Clone(),
+                depth_diff_, iterations_, method_, device, &odometry_times_);
+    } else {
+        trans = core::Tensor::Eye(4, core::Dtype::Float64, host);
+        odometry_times_.assign(iterations_.size(), 0.0);
     }
 
+    reference_ = std::move(pyramid);
     return trans;
 }
 
-core::Tensor RGBDOdometryMultiScaleHybrid(const t::geometry::RGBDImage& source,
-                                          const t::geometry::RGBDImage& target,
-                                          core::Tensor& intrinsics,
-                                          core::Tensor& trans,
-                                          float depth_scale,
-                                          float depth_max,
-                                          float depth_diff,
-                                          const std::vector<int>& iterations) {
-    int64_t n_levels = int64_t(iterations.size());
-    std::vector<core::Tensor> source_intensity(n_levels);
-    std::vector<core::Tensor> target_intensity(n_levels);
-
-    std::vector<core::Tensor> source_depth(n_levels);
-    std::vector<core::Tensor> target_depth(n_levels);
-    std::vector<core::Tensor> target_intensity_dx(n_levels);
-    std::vector<core::Tensor> target_intensity_dy(n_levels);
-
-    std::vector<core::Tensor> target_depth_dx(n_levels);
-    std::vector<core::Tensor> target_depth_dy(n_levels);
-
-    std::vector<core::Tensor> source_vertex_maps(n_levels);
-
-    std::vector<core::Tensor> intrinsic_matrices(n_levels);
-
-    t::geometry::Image source_depth_curr(source.depth_);
-    t::geometry::Image target_depth_curr(target.depth_);
-
-    t::geometry::Image source_intensity_curr =
-            source.color_.RGBToGray().To(core::Dtype::Float32);
-    t::geometry::Image target_intensity_curr =
-            target.color_.RGBToGray().To(core::Dtype::Float32);
-
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        t::geometry::Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        auto target_depth_grad = target_depth_curr.FilterSobel();
-        target_depth_dx[n_levels - 1 - i] = target_depth_grad.first.AsTensor();
-        target_depth_dy[n_levels - 1 - i] = target_depth_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr =
-                    PyrDownDepth(source_depth_curr, depth_diff * 2, NAN);
-            target_depth_curr =
-                    PyrDownDepth(target_depth_curr, depth_diff * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
-
-            intrinsics /= 2;
-            intrinsics[-1][-1] = 1;
-        }
-    }
-
-    // Odometry
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < iterations[i]; ++iter) {
-            core::Tensor delta_source_to_target = ComputePoseHybrid(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_depth_dx[i], target_depth_dy[i],
-                    target_intensity_dx[i], target_intensity_dy[i],
-                    source_vertex_maps[i], intrinsic_matrices[i], trans,
-                    depth_diff);
-            trans = delta_source_to_target.Matmul(trans);
-        }
-    }
-    return trans;
+void RGBDOdometryTracker::Reset() {
+    reference_.clear();
+    pyramid_times_.clear();
+    odometry_times_.clear();
 }
 
 core::Tensor ComputePosePointToPlane(const core::Tensor& source_vertex_map,
@@ -30,6 +30,10 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
@@ -78,6 +82,83 @@ core::Tensor RGBDOdometryMultiScale(
         const std::vector<int>& iterations = {10, 5, 3},
         const Method method = Method::Hybrid);
 
+/// \class RGBDOdometryTracker
+///
+/// \brief Frame-to-frame multi-scale RGBD odometry over a sequence.
+/// Every frame passed to Track is preprocessed once into an image pyramid,
+/// which serves as the source of the current call and is kept as the target
+/// of the next call. Tracking N frames thus builds N pyramids, while calling
+/// RGBDOdometryMultiScale on consecutive pairs builds 2(N - 1).
+class RGBDOdometryTracker {
+public:
+    /// \param intrinsics (3, 3) intrinsic matrix of the finest level.
+    /// \param depth_scale Converts depth pixel values to meters by dividing
+    /// the scale factor.
+    /// \param depth_max Depth values beyond \p depth_max are discarded.
+    /// \param depth_diff Depth difference threshold used to filter
+    /// projective associations.
+    /// \param iterations Iterations in multiscale odometry, from coarse to
+    /// fine.
+    /// \param method Method used to apply RGBD odometry.
+    RGBDOdometryTracker(const core::Tensor& intrinsics,
+                        float depth_scale = 1000.0f,
+                        float depth_max = 3.0f,
+                        float depth_diff = 0.07f,
+                        const std::vector<int>& iterations = {10, 5, 3},
+                        const Method method = Method::Hybrid);
+
+    /// \brief Registers \p frame against the previously tracked frame and
+    /// keeps its pyramid as the target of the next call.
+    /// \param frame RGBD image holding a depth image (UInt16 or Float32) and
+    /// a color image (UInt8 x 3). All frames must be on the same device.
+    /// \param init_source_to_target (4, 4) initial transformation from
+    /// \p frame to the previous frame.
+    /// \return (4, 4) Float64 transformation from \p frame to the previous
+    /// frame, or identity for the first frame after construction or Reset.
+    core::Tensor Track(const t::geometry::RGBDImage& frame,
+                       const core::Tensor& init_source_to_target =
+                               core::Tensor::Eye(4,
+                                                 core::Dtype::Float64,
+                                                 core::Device("CPU:0")));
+
+    /// Drops the previous frame, such that the next Track call starts over.
+    void Reset();
+
+    /// Returns true if a previous frame is available to track against.
+    bool HasReference() const { return !reference_.empty(); }
+
+    /// Per-level time in milliseconds spent building the pyramid of the last
+    /// tracked frame, from coarse to fine.
+    const std::vector<double>& GetPyramidTimes() const {
+        return pyramid_times_;
+    }
+
+    /// Per-level time in milliseconds spent in odometry iterations of the
+    /// last Track call, from coarse to fine.
+    const std::vector<double>& GetOdometryTimes() const {
+        return odometry_times_;
+    }
+
+private:
+    /// Named per-level maps, from coarse to fine.
+    using Pyramid = std::vector<std::unordered_map<std::string, core::Tensor>>;
+
+    float depth_scale_;
+    float depth_max_;
+    float depth_diff_;
+    std::vector<int> iterations_;
+    Method method_;
+
+    /// Float64 intrinsics of each level, from coarse to fine.
+    std::vector<core::Tensor> intrinsic_matrices_;
+
+    /// Pyramid of the previously tracked frame.
+    Pyramid reference_;
+
+    std::vector<double> pyramid_times_;
+    std::vector<double> odometry_times_;
+};
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target.
 /// Performs one iteration of RGBD odometry using loss function
 /// \f$[(V_p - V_q)^T N_p]^2\f$, where
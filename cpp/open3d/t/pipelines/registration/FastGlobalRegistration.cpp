@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+
+#include <algorithm>
+
+#include "open3d/core/ParallelPrimitives.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/FastGlobalRegistration.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// Index of the nearest neighbor in \p dataset of each row of \p queries {N},
+/// Int64.
+static core::Tensor SearchNearestFeature(const core::Tensor &dataset,
+                                         const core::Tensor &queries) {
+    core::nns::NearestNeighborSearch nns(dataset);
+    if (!nns.KnnIndex()) {
+        utility::LogError(
+                "[FastGlobalRegistration: NearestNeighborSearch::KnnIndex] "
+                "Index is not set.");
+    }
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = nns.KnnSearch(queries, 1);
+    return indices.Reshape({-1});
+}
+
+/// Pairs of mutually nearest source and target features {K, 2}, Int64.
+static core::Tensor MatchFeaturesMutually(const core::Tensor &source_features,
+                                          const core::Tensor &target_features) {
+    core::Tensor source_to_target =
+            SearchNearestFeature(target_features, source_features);
+    core::Tensor target_to_source =
+            SearchNearestFeature(source_features, target_features);
+    core::Tensor source_indices = core::Tensor::Arange(
+            0, source_features.GetLength(), 1, core::Dtype::Int64,
+            source_features.GetDevice());
+    core::Tensor mutual =
+            target_to_source.IndexGet({source_to_target}).Eq(source_indices);
+    core::Tensor first = source_indices.IndexGet({mutual});
+    core::Tensor corres = core::Tensor::Empty(
+            {first.GetLength(), 2}, core::Dtype::Int64, first.GetDevice());
+    corres.Slice(1, 0, 1) = first.Reshape({-1, 1});
+    corres.Slice(1, 1, 2) =
+            source_to_target.IndexGet({mutual}).Reshape({-1, 1});
+    return corres;
+}
+
+/// Largest distance of \p centered_points to the origin.
+static double MaxNorm(const core::Tensor &centered_points) {
+    return (centered_points * centered_points)
+            .Sum({1})
+            .Max({0})
+            .Sqrt()
+            .Item<double>();
+}
+
+RegistrationResult FastGlobalRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        const FastGlobalRegistrationOption &option) {
+    core::Device device = source.GetDevice();
+    core::Device host("CPU:0");
+    source.GetPoints().AssertDtype(core::Dtype::Float32);
+    target.GetPoints().AssertDtype(core::Dtype::Float32);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    if (source.IsEmpty() || target.IsEmpty()) {
+        utility::LogError("Source and target point clouds must be non-empty.");
+    }
+    source_features.AssertDevice(device);
+    target_features.AssertDevice(device);
+    target_features.AssertDtype(source_features.GetDtype());
+    if (source_features.NumDims() != 2 ||
+        source_features.GetLength() != source.GetPoints().GetLength() ||
+        target_features.NumDims() != 2 ||
+        target_features.GetLength() != target.GetPoints().GetLength() ||
+        source_features.GetShape(1) != target_features.GetShape(1)) {
+        utility::LogError(
+                "Features must be of shape {{N, D}}, with one row per point, "
+                "but got {} and {}.",
+                source_features.GetShape().ToString(),
+                target_features.GetShape().ToString());
+    }
+
+    // Normalize the scale of the points: X' = (X - mean) / scale.
+    core::Tensor source_mean =
+            source.GetPoints().To(core::Dtype::Float64).Mean({0});
+    core::Tensor target_mean =
+            target.GetPoints().To(core::Dtype::Float64).Mean({0});
+    core::Tensor source_points =
+            source.GetPoints().To(core::Dtype::Float64) - source_mean;
+    core::Tensor target_points =
+            target.GetPoints().To(core::Dtype::Float64) - target_mean;
+    const double scale =
+            std::max(MaxNorm(source_points), MaxNorm(target_points));
+    const double scale_global = option.use_absolute_scale_ ? 1.0 : scale;
+    utility::LogDebug("normalize points :: global scale : {:f}",
+                      scale_global);
+    source_points = source_points.Div(scale_global).To(core::Dtype::Float32);
+    target_points = target_points.Div(scale_global).To(core::Dtype::Float32);
+
+    // Mutual feature matching.
+    core::Tensor corres =
+            MatchFeaturesMutually(source_features, target_features);
+    utility::LogDebug("[cross check] points are remained : {:d}",
+                      corres.GetLength());
+
+    // Tuple constraint: the first maximum_tuple_count_ passing trials, in
+    // the order of the trials.
+    if (corres.GetLength() > 0) {
+        core::Tensor tuples, valid;
+        kernel::fgr::TestTuples(source_points, target_points, corres,
+                                static_cast<float>(option.tuple_scale_),
+                                corres.GetLength() * 100, option.seed_,
+                                tuples, valid);
+        core::Tensor passed = core::CompactIndices(valid);
+        passed = passed.Slice(
+                0, 0,
+                std::min<int64_t>(passed.GetLength(),
+                                  std::max(option.maximum_tuple_count_, 0)));
+        utility::LogDebug("{:d} tuples.", passed.GetLength());
+        corres = corres.IndexGet({tuples.IndexGet({passed}).Reshape({-1})});
+    }
+    utility::LogDebug("[final] matches {:d}.", corres.GetLength());
+
+    // T aligns the normalized target to the normalized source. Like the
+    // legacy implementation, the graduated non-convexity starts from
+    // scale_global.
+    core::Tensor transformation =
+            core::Tensor::Eye(4, core::Dtype::Float64, host);
+    if (corres.GetLength() >= 10) {
+        transformation =
+                kernel::fgr::OptimizePairwiseRegistration(
+                        source_points, target_points, corres,
+                        option.iteration_number_, scale_global,
+                        option.maximum_correspondence_distance_,
+                        option.division_factor_, option.decrease_mu_)
+                        .To(host);
+    }
+
+    // Back to the original scale, then invert to align source to target.
+    core::Tensor R = transformation.Slice(0, 0, 3).Slice(1, 0, 3);
+    core::Tensor t = transformation.Slice(0, 0, 3).Slice(1, 3, 4);
+    core::Tensor original = core::Tensor::Eye(4, core::Dtype::Float64, host);
+    original.Slice(0, 0, 3).Slice(1, 0, 3) = R;
+    original.Slice(0, 0, 3).Slice(1, 3, 4) =
+            t.Mul(scale_global) + source_mean.To(host).Reshape({3, 1}) -
+            R.Matmul(target_mean.To(host).Reshape({3, 1}));
+
+    return EvaluateRegistration(source, target,
+                                option.maximum_correspondence_distance_,
+                                original.Inverse());
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
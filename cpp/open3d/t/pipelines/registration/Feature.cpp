@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
+                                int max_nn,
+                                const utility::optional<double> radius) {
+    if (max_nn < 1) {
+        utility::LogError("max_nn must be positive.");
+    }
+    if (!input.HasPointNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    const core::Tensor &points = input.GetPoints();
+    if (points.GetLength() == 0) {
+        return core::Tensor::Zeros({0, 33}, points.GetDtype(),
+                                   points.GetDevice());
+    }
+
+    core::nns::NearestNeighborSearch nns(points);
+    core::Tensor neighbors, distances;
+    if (radius.has_value()) {
+        nns.HybridIndex(radius.value());
+        std::tie(neighbors, distances) =
+                nns.HybridSearch(points, radius.value(), max_nn);
+    } else {
+        nns.KnnIndex();
+        std::tie(neighbors, distances) = nns.KnnSearch(
+                points, int(std::min<int64_t>(max_nn, points.GetLength())));
+    }
+
+    core::Tensor fpfhs;
+    kernel::ComputeFPFHFeature(points, input.GetPointNormals(), neighbors,
+                               fpfhs);
+    return fpfhs;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,9 +26,11 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include "open3d/core/CUDAStream.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/FusedICP.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
 
@@ -37,12 +39,24 @@ namespace t {
 namespace pipelines {
 namespace registration {
 
+static void SetHybridIndex(open3d::core::nns::NearestNeighborSearch &target_nns,
+                           double max_correspondence_distance) {
+    bool check = target_nns.HybridIndex(max_correspondence_distance);
+    if (!check) {
+        utility::LogError(
+                "[Tensor: Registration: NearestNeighborSearch::HybridIndex] "
+                "Index is not set.");
+    }
+}
+
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         open3d::core::nns::NearestNeighborSearch &target_nns,
         double max_correspondence_distance,
-        const core::Tensor &transformation) {
+        const core::Tensor &transformation,
+        core::Tensor &neighbors_index,
+        core::Tensor &neighbors_distance) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
@@ -62,21 +76,11 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    bool check = target_nns.HybridIndex(max_correspondence_distance);
-    if (!check) {
-        utility::LogError(
-                "[Tensor: EvaluateRegistration: "
-                "GetRegistrationResultAndCorrespondences: "
-                "NearestNeighborSearch::HybridSearch] "
-                "Index is not set.");
-    }
-
-    core::Tensor distances;
-    std::tie(result.correspondence_set_.second, distances) =
-            target_nns.HybridSearch(source.GetPoints(),
-                                    max_correspondence_distance, 1);
+    // The search writes into the buffers of the previous iteration.
+    target_nns.HybridSearch(source.GetPoints(), max_correspondence_distance, 1,
+                            neighbors_index, neighbors_distance);
 
-    core::Tensor valid = result.correspondence_set_.second.Ne(-1).Reshape({-1});
+    core::Tensor valid = neighbors_index.Ne(-1).Reshape({-1});
     // correpondence_set : (i, corres[i]).
     // source[i] and target[corres[i]] is a correspondence.
     result.correspondence_set_.first =
@@ -85,14 +89,14 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
                     .IndexGet({valid});
     // Only take valid indices.
     result.correspondence_set_.second =
-            result.correspondence_set_.second.IndexGet({valid}).Reshape({-1});
+            neighbors_index.IndexGet({valid}).Reshape({-1});
 
     // Number of good correspondences (C).
     int num_correspondences = result.correspondence_set_.first.GetLength();
 
     // Reduction sum of "distances" for error.
     double squared_error =
-            static_cast<double>(distances.Sum({0}).Item<float>());
+            static_cast<double>(neighbors_distance.Sum({0}).Item<float>());
     result.fitness_ = static_cast<double>(num_correspondences) /
                       static_cast<double>(source.GetPoints().GetLength());
     result.inlier_rmse_ =
@@ -120,10 +124,55 @@ RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
     source_transformed.Transform(transformation.To(device, dtype));
 
     open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    if (max_correspondence_distance > 0.0) {
+        SetHybridIndex(target_nns, max_correspondence_distance);
+    }
 
+    core::Tensor neighbors_index, neighbors_distance;
     return GetRegistrationResultAndCorrespondences(
             source_transformed, target, target_nns, max_correspondence_distance,
-            transformation);
+            transformation, neighbors_index, neighbors_distance);
+}
+
+/// Point to plane ICP over the scales of the pyramids, with the fused kernels
+/// of kernel::icp. The transformation stays on the device, and the host only
+/// waits for the result of the last scale.
+static RegistrationResult MultiScaleICPPointToPlaneFused(
+        const std::vector<t::geometry::PointCloud> &source_down_pyramid,
+        const std::vector<t::geometry::PointCloud> &target_down_pyramid,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init,
+        const RobustKernel &kernel) {
+    core::Device device = source_down_pyramid[0].GetDevice();
+    core::Tensor transformation = init.To(device, core::Dtype::Float64);
+    core::Tensor metrics, correspondences;
+    for (size_t i = 0; i < criterias.size(); i++) {
+        const float max_distance =
+                static_cast<float>(max_correspondence_distances[i]);
+        core::Tensor cell_keys, grid_points, grid_normals, grid_order;
+        kernel::icp::BuildCorrespondenceGrid(
+                target_down_pyramid[i].GetPoints(),
+                target_down_pyramid[i].GetPointNormals(), max_distance,
+                cell_keys, grid_points, grid_normals, grid_order);
+        kernel::icp::ComputeRegistrationPointToPlane(
+                source_down_pyramid[i].GetPoints(), cell_keys, grid_points,
+                grid_normals, grid_order, max_distance, criterias[i], kernel,
+                transformation, metrics, correspondences);
+    }
+
+    const core::Tensor metrics_host = metrics.To(core::Device("CPU:0"));
+    RegistrationResult result(
+            transformation.To(core::Device("CPU:0")).Contiguous());
+    result.fitness_ = metrics_host[0].Item<double>();
+    result.inlier_rmse_ = metrics_host[1].Item<double>();
+    core::Tensor valid = correspondences.Ne(-1);
+    result.correspondence_set_.first =
+            core::Tensor::Arange(0, correspondences.GetLength(), 1,
+                                 core::Dtype::Int64, device)
+                    .IndexGet({valid});
+    result.correspondence_set_.second = correspondences.IndexGet({valid});
+    return result;
 }
 
 RegistrationResult RegistrationICP(const geometry::PointCloud &source,
@@ -146,6 +195,8 @@ RegistrationResult RegistrationMultiScaleICP(
         const core::Tensor &init,
         const TransformationEstimation &estimation) {
     core::Device device = source.GetDevice();
+    OPEN3D_CUDA_PROFILE_SCOPE(
+            "t::pipelines::registration::RegistrationMultiScaleICP", device);
     core::Dtype dtype = core::Dtype::Float32;
 
     source.GetPoints().AssertDtype(dtype,
@@ -180,6 +231,14 @@ RegistrationResult RegistrationMultiScaleICP(
                 "require pre-computed normal vectors for target PointCloud.");
     }
 
+    if (estimation.GetTransformationEstimationType() ==
+                TransformationEstimationType::ColoredICP &&
+        (!source.HasPointColors() || !target.HasPointColors())) {
+        utility::LogError(
+                "TransformationEstimationForColoredICP requires colors for "
+                "source and target PointCloud.");
+    }
+
     if (max_correspondence_distances[0] <= 0.0) {
         utility::LogError(
                 " Max correspondence distance must be greater than 0, but"
@@ -226,17 +285,41 @@ RegistrationResult RegistrationMultiScaleICP(
                 target_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
     }
 
+    if (estimation.GetTransformationEstimationType() ==
+        TransformationEstimationType::PointToPlane) {
+        return MultiScaleICPPointToPlaneFused(
+                source_down_pyramid, target_down_pyramid, criterias,
+                max_correspondence_distances, transformation,
+                static_cast<const TransformationEstimationPointToPlane &>(
+                        estimation)
+                        .kernel_);
+    }
+
     RegistrationResult result(transformation);
 
+    // Search outputs reused over the iterations of each scale.
+    core::Tensor neighbors_index, neighbors_distance;
+
     for (int64_t i = 0; i < num_iterations; i++) {
         source_down_pyramid[i].Transform(transformation.To(device, dtype));
 
+        // Color gradients of the scale, with the neighborhood of the legacy
+        // RegistrationColoredICP.
+        if (estimation.GetTransformationEstimationType() ==
+            TransformationEstimationType::ColoredICP) {
+            target_down_pyramid[i].EstimateColorGradients(
+                    30, max_correspondence_distances[i] * 2.0);
+        }
+
+        // The target is fixed within a scale, so its index is built once.
         core::nns::NearestNeighborSearch target_nns(
                 target_down_pyramid[i].GetPoints());
+        SetHybridIndex(target_nns, max_correspondence_distances[i]);
 
         result = GetRegistrationResultAndCorrespondences(
                 source_down_pyramid[i], target_down_pyramid[i], target_nns,
-                max_correspondence_distances[i], transformation);
+                max_correspondence_distances[i], transformation,
+                neighbors_index, neighbors_distance);
 
         for (int j = 0; j < criterias[i].max_iteration_; j++) {
             utility::LogDebug(
@@ -260,7 +343,8 @@ RegistrationResult RegistrationMultiScaleICP(
 
             result = GetRegistrationResultAndCorrespondences(
                     source_down_pyramid[i], target_down_pyramid[i], target_nns,
-                    max_correspondence_distances[i], transformation);
+                    max_correspondence_distances[i], transformation,
+                    neighbors_index, neighbors_distance);
 
             // ICPConvergenceCriteria, to terminate iteration.
             if (j != 0 &&
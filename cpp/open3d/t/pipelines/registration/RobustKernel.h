@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// Robust loss functions of the legacy pipelines::registration::RobustKernel
+/// classes, selected by value so that the weights are computed in the
+/// reduction kernels on the device.
+enum class RobustKernelMethod {
+    L2Loss = 0,
+    L1Loss = 1,
+    HuberLoss = 2,
+    CauchyLoss = 3,
+    GMLoss = 4,
+    TukeyLoss = 5,
+};
+
+/// \class RobustKernel
+///
+/// Robust kernel for outlier rejection, turning the least squares problem
+/// into an iteratively reweighted least squares problem. The weight w(r) of a
+/// residual r is (1 / r) * (dp(r) / dr) for the loss p(r) of \p type_, with
+/// the same definitions as the legacy kernels:
+///     L2Loss:     1
+///     L1Loss:     1 / |r|
+///     HuberLoss:  k / max(|r|, k)
+///     CauchyLoss: 1 / (1 + (r / k)^2)
+///     GMLoss:     k / (k + r^2)^2
+///     TukeyLoss:  (1 - min(1, |r| / k)^2)^2
+/// where k is \p scaling_parameter_.
+class RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param type Loss function.
+    /// \param scaling_parameter Scaling parameter k of the loss function,
+    /// unused by L2Loss and L1Loss.
+    explicit RobustKernel(RobustKernelMethod type = RobustKernelMethod::L2Loss,
+                          double scaling_parameter = 1.0)
+        : type_(type), scaling_parameter_(scaling_parameter) {}
+
+public:
+    /// Loss function.
+    RobustKernelMethod type_;
+    /// Scaling parameter k of the loss function.
+    double scaling_parameter_;
+};
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
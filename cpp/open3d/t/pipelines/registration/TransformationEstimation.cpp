@@ -131,7 +131,94 @@ core::Tensor TransformationEstimationPointToPlane::ComputeTransformation(
     // target point cloud.
     core::Tensor pose = pipelines::kernel::ComputePosePointToPlane(
             source.GetPoints(), target.GetPoints(), target.GetPointNormals(),
-            corres);
+            corres, kernel_);
+
+    // Get transformation {4,4} of type Float64 from pose {6}.
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
+static void AssertColoredICPAttributes(const geometry::PointCloud &source,
+                                       const geometry::PointCloud &target) {
+    if (!source.HasPointColors() || !target.HasPointColors() ||
+        !target.HasPointNormals() || !target.HasPointAttr("color_gradients")) {
+        utility::LogError(
+                "TransformationEstimationForColoredICP requires source colors, "
+                "and target normals, colors and color_gradients (see "
+                "PointCloud::EstimateColorGradients).");
+    }
+}
+
+double TransformationEstimationForColoredICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    source.GetPoints().AssertDtype(dtype);
+    target.GetPoints().AssertDtype(dtype);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    AssertColoredICPAttributes(source, target);
+
+    // TODO: Optimise using kernel.
+    core::Tensor source_idx = corres.first.Reshape({-1});
+    core::Tensor target_idx = corres.second.Reshape({-1});
+    core::Tensor vs = source.GetPoints().IndexGet({source_idx});
+    core::Tensor vt = target.GetPoints().IndexGet({target_idx});
+    core::Tensor nt = target.GetPointNormals().IndexGet({target_idx});
+    core::Tensor is = source.GetPointColors()
+                              .IndexGet({source_idx})
+                              .To(dtype)
+                              .Mean({1}, true);
+    core::Tensor it = target.GetPointColors()
+                              .IndexGet({target_idx})
+                              .To(dtype)
+                              .Mean({1}, true);
+    core::Tensor dit = target.GetPointAttr("color_gradients")
+                               .IndexGet({target_idx})
+                               .To(dtype);
+
+    // Geometric residual, and photometric residual at the projection of the
+    // source point on the tangent plane of the target point.
+    core::Tensor d = (vs - vt).Mul_(nt).Sum({1}, true);
+    core::Tensor vs_proj = vs - d * nt;
+    core::Tensor is0_proj = (vs_proj - vt).Mul_(dit).Sum({1}, true) + it;
+    core::Tensor r_I = is - is0_proj;
+
+    double error_G = static_cast<double>(d.Mul(d).Sum({0, 1}).Item<float>());
+    double error_I =
+            static_cast<double>(r_I.Mul(r_I).Sum({0, 1}).Item<float>());
+    double error = lambda_geometric_ * error_G +
+                   (1.0 - lambda_geometric_) * error_I;
+    return std::sqrt(error / static_cast<double>(corres.second.GetLength()));
+}
+
+core::Tensor TransformationEstimationForColoredICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    source.GetPoints().AssertDtype(dtype);
+    target.GetPoints().AssertDtype(dtype);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    AssertColoredICPAttributes(source, target);
+
+    // Get pose {6} of type Float64 from correspondences indexed source and
+    // target point cloud.
+    core::Tensor pose = pipelines::kernel::ComputePoseColoredICP(
+            source.GetPoints(), source.GetPointColors().To(dtype),
+            target.GetPoints(), target.GetPointNormals(),
+            target.GetPointColors().To(dtype),
+            target.GetPointAttr("color_gradients").To(dtype), corres, kernel_,
+            lambda_geometric_);
 
     // Get transformation {4,4} of type Float64 from pose {6}.
     return pipelines::kernel::PoseToTransformation(pose);
@@ -35,6 +35,7 @@
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/t/pipelines/registration/RobustKernel.h"
 
 namespace open3d {
 
@@ -153,6 +154,12 @@ public:
     TransformationEstimationPointToPlane() {}
     ~TransformationEstimationPointToPlane() override {}
 
+    /// \brief Constructor that takes as input a RobustKernel.
+    ///
+    /// \param kernel Robust kernel weighting the point to plane residuals.
+    explicit TransformationEstimationPointToPlane(const RobustKernel &kernel)
+        : kernel_(kernel) {}
+
 public:
     TransformationEstimationType GetTransformationEstimationType()
             const override {
@@ -183,11 +190,81 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
 
+public:
+    /// Robust kernel weighting the residuals.
+    RobustKernel kernel_ = RobustKernel();
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
 };
 
+/// \class TransformationEstimationForColoredICP
+///
+/// Class to estimate a transformation of shape {4, 4} and dtype Float64 for
+/// colored ICP, Park et al., "Colored Point Cloud Registration Revisited",
+/// ICCV 2017. The target must have normals, colors and the
+/// "color_gradients" attribute of PointCloud::EstimateColorGradients, the
+/// source must have colors.
+class TransformationEstimationForColoredICP : public TransformationEstimation {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param lambda_geometric Weight of the geometric (point to plane) term,
+    /// in [0, 1]. The photometric term has weight 1 - lambda_geometric.
+    /// \param kernel Robust kernel weighting both residuals.
+    explicit TransformationEstimationForColoredICP(
+            double lambda_geometric = 0.968,
+            const RobustKernel &kernel = RobustKernel())
+        : lambda_geometric_(lambda_geometric), kernel_(kernel) {
+        if (lambda_geometric_ < 0 || lambda_geometric_ > 1.0) {
+            lambda_geometric_ = 0.968;
+        }
+    }
+    ~TransformationEstimationForColoredICP() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    /// \brief Computes RMSE (double) of the combined geometric and
+    /// photometric residuals, between two pointclouds of type Float32, given
+    /// CorrespondenceSet.
+    ///
+    /// \param source Source pointcloud of dtype Float32, with colors.
+    /// \param target Target pointcloud of dtype Float32, with normals, colors
+    /// and color_gradients.
+    /// \param corres CorrespondenceSet: a pair of Int64 {C,} shape tensor.
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres) const override;
+
+    /// \brief Estimates the transformation matrix for colored ICP, a tensor
+    /// of shape {4, 4}, and dtype Float64 on CPU device.
+    ///
+    /// \param source Source pointcloud of dtype Float32, with colors.
+    /// \param target Target pointcloud of dtype Float32, with normals, colors
+    /// and color_gradients.
+    /// \param corres CorrespondenceSet: a pair of Int64 {C,} shape tensor.
+    /// \return transformation between source to target, a tensor of shape {4,
+    /// 4}, type Float64 on CPU device.
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres) const override;
+
+public:
+    /// Weight of the geometric term.
+    double lambda_geometric_ = 0.968;
+    /// Robust kernel weighting the residuals.
+    RobustKernel kernel_ = RobustKernel();
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::ColoredICP;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -26,6 +26,7 @@
 
 #include "open3d/t/pipelines/voxelhashing/Model.h"
 
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
@@ -53,7 +54,11 @@ Model::Model(float voxel_size,
                   block_resolution,
                   est_block_count,
                   device),
-      T_frame_to_world_(T_init.To(core::Device("CPU:0"))) {}
+      T_frame_to_world_(T_init.To(core::Device("CPU:0"))),
+      voxel_size_(voxel_size),
+      sdf_trunc_(sdf_trunc),
+      block_resolution_(block_resolution),
+      block_count_(est_block_count) {}
 
 void Model::SynthesizeModelFrame(Frame& raycast_frame,
                                  float depth_scale,
@@ -62,9 +67,10 @@ void Model::SynthesizeModelFrame(Frame& raycast_frame,
     using MaskCode = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
     auto result = voxel_grid_.RayCast(
             raycast_frame.GetIntrinsics(),
-            t::geometry::InverseTransformation(GetCurrentFramePose()),
+            t::geometry::InverseTransformation(GetFrameToSubmapPose()),
             raycast_frame.GetWidth(), raycast_frame.GetHeight(), depth_scale,
-            depth_min, depth_max, std::min(frame_id_ * 1.0f, 3.0f),
+            depth_min, depth_max,
+            std::min((frame_id_ - submap_first_frame_id_) * 1.0f, 3.0f),
             MaskCode::DepthMap | MaskCode::ColorMap);
     raycast_frame.SetData("depth", result[MaskCode::DepthMap]);
     raycast_frame.SetData("color", result[MaskCode::ColorMap]);
@@ -92,21 +98,164 @@ core::Tensor Model::TrackFrameToModel(const Frame& input_frame,
 void Model::Integrate(const Frame& input_frame,
                       float depth_scale,
                       float depth_max) {
+    if (frame_id_ > submap_first_frame_id_) {
+        bool exceeds_frames =
+                submap_max_frames_ > 0 &&
+                frame_id_ - submap_first_frame_id_ >= submap_max_frames_;
+        core::Tensor translation = GetFrameToSubmapPose()
+                                           .To(core::Dtype::Float64)
+                                           .Slice(0, 0, 3)
+                                           .Slice(1, 3, 4);
+        double distance2 =
+                translation.Mul(translation).Sum({0, 1}).Item<double>();
+        bool exceeds_distance =
+                submap_max_distance_ > 0 &&
+                distance2 > double(submap_max_distance_) * submap_max_distance_;
+        if (exceeds_frames || exceeds_distance) {
+            StartNewSubmap();
+        }
+    }
+
     voxel_grid_.Integrate(
             input_frame.GetDataAsImage("depth"),
             input_frame.GetDataAsImage("color"), input_frame.GetIntrinsics(),
-            t::geometry::InverseTransformation(GetCurrentFramePose()),
+            t::geometry::InverseTransformation(GetFrameToSubmapPose()),
             depth_scale, depth_max);
 }
 
 t::geometry::PointCloud Model::ExtractPointCloud(int estimated_number,
                                                  float weight_threshold) {
-    return voxel_grid_.ExtractSurfacePoints(estimated_number, weight_threshold);
+    if (submaps_.empty()) {
+        return voxel_grid_.ExtractSurfacePoints(estimated_number,
+                                                weight_threshold);
+    }
+
+    // Merge the submaps in the world frame on the device of the active one.
+    core::Device device = voxel_grid_.GetDevice();
+    std::vector<t::geometry::PointCloud> pcds;
+    int64_t total = 0;
+    for (int i = 0; i < GetSubmapCount(); ++i) {
+        t::geometry::PointCloud pcd =
+                ExtractSubmapPointCloud(i, -1, weight_threshold).To(device);
+        pcd.Transform(GetSubmapPose(i).To(device));
+        total += pcd.GetPoints().GetLength();
+        pcds.push_back(pcd);
+    }
+
+    t::geometry::PointCloud merged(device);
+    for (const auto& kv : pcds[0].GetPointAttr()) {
+        bool shared = true;
+        for (const auto& pcd : pcds) {
+            shared = shared && pcd.HasPointAttr(kv.first);
+        }
+        if (!shared) continue;
+
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = total;
+        core::Tensor attr(shape, kv.second.GetDtype(), device);
+        int64_t offset = 0;
+        for (const auto& pcd : pcds) {
+            const core::Tensor& src = pcd.GetPointAttr(kv.first);
+            attr.Slice(0, offset, offset + src.GetLength()) = src;
+            offset += src.GetLength();
+        }
+        merged.SetPointAttr(kv.first, attr);
+    }
+    return merged;
 }
 
 int64_t Model::GetHashmapSize() {
     return voxel_grid_.GetBlockHashmap()->Size();
 }
+
+void Model::SetSubmapPolicy(int max_frames, float max_distance, bool offload) {
+    submap_max_frames_ = max_frames;
+    submap_max_distance_ = max_distance;
+    submap_offload_ = offload;
+}
+
+core::Tensor Model::GetSubmapPose(int submap_id) const {
+    if (submap_id < 0 || submap_id >= GetSubmapCount()) {
+        utility::LogError("Invalid submap id {}, expected in [0, {}).",
+                          submap_id, GetSubmapCount());
+    }
+    if (submap_id == static_cast<int>(submaps_.size())) {
+        return T_submap_to_world_;
+    }
+    return submaps_[submap_id].T_submap_to_world_;
+}
+
+t::geometry::PointCloud Model::ExtractSubmapPointCloud(int submap_id,
+                                                       int estimated_number,
+                                                       float weight_threshold) {
+    GetSubmapPose(submap_id);  // Validates submap_id.
+    if (submap_id == static_cast<int>(submaps_.size())) {
+        return voxel_grid_.ExtractSurfacePoints(estimated_number,
+                                                weight_threshold);
+    }
+    return submaps_[submap_id].voxel_grid_.ExtractSurfacePoints(
+            estimated_number, weight_threshold);
+}
+
+open3d::pipelines::registration::PoseGraph Model::GetSubmapPoseGraph() const {
+    using namespace open3d::pipelines::registration;
+    PoseGraph pose_graph;
+    for (int i = 0; i < GetSubmapCount(); ++i) {
+        Eigen::Matrix4d pose =
+                core::eigen_converter::TensorToEigenMatrixXd(GetSubmapPose(i));
+        pose_graph.nodes_.push_back(PoseGraphNode(pose));
+        if (i > 0) {
+            // Maps points of submap i - 1 to submap i.
+            Eigen::Matrix4d odometry =
+                    pose.inverse() * pose_graph.nodes_[i - 1].pose_;
+            pose_graph.edges_.push_back(PoseGraphEdge(i - 1, i, odometry));
+        }
+    }
+    return pose_graph;
+}
+
+void Model::UpdateSubmapPoses(
+        const open3d::pipelines::registration::PoseGraph& pose_graph) {
+    if (static_cast<int>(pose_graph.nodes_.size()) != GetSubmapCount()) {
+        utility::LogError("Expected {} pose graph nodes, but got {}.",
+                          GetSubmapCount(), pose_graph.nodes_.size());
+    }
+
+    core::Tensor T_frame_to_submap = GetFrameToSubmapPose();
+    for (size_t i = 0; i < submaps_.size(); ++i) {
+        submaps_[i].T_submap_to_world_ =
+                core::eigen_converter::EigenMatrixToTensor(
+                        pose_graph.nodes_[i].pose_);
+    }
+    T_submap_to_world_ = core::eigen_converter::EigenMatrixToTensor(
+            pose_graph.nodes_.back().pose_);
+    T_frame_to_world_ = T_submap_to_world_.Matmul(T_frame_to_submap);
+}
+
+void Model::StartNewSubmap() {
+    Submap submap{submap_offload_ ? voxel_grid_.CPU() : voxel_grid_,
+                  T_submap_to_world_, submap_first_frame_id_, frame_id_ - 1};
+    submaps_.push_back(submap);
+
+    // The new submap starts at the current frame.
+    core::Device device = voxel_grid_.GetDevice();
+    voxel_grid_ = t::geometry::TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                                              {"weight", core::Dtype::UInt16},
+                                              {"color", core::Dtype::UInt16}},
+                                             voxel_size_, sdf_trunc_,
+                                             block_resolution_, block_count_,
+                                             device);
+    T_submap_to_world_ = T_frame_to_world_;
+    submap_first_frame_id_ = frame_id_;
+    utility::LogDebug("Started submap {} at frame {}.", submaps_.size(),
+                      frame_id_);
+}
+
+core::Tensor Model::GetFrameToSubmapPose() const {
+    return t::geometry::InverseTransformation(T_submap_to_world_)
+            .Matmul(T_frame_to_world_)
+            .Contiguous();
+}
 }  // namespace voxelhashing
 }  // namespace pipelines
 }  // namespace t
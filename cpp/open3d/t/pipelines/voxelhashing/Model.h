@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
@@ -38,6 +41,16 @@ namespace open3d {
 namespace t {
 namespace pipelines {
 namespace voxelhashing {
+
+/// A finished part of the map, integrated in its own coordinate frame.
+struct Submap {
+    t::geometry::TSDFVoxelGrid voxel_grid_;
+    /// (4, 4) Float64 transformation from the submap to the world.
+    core::Tensor T_submap_to_world_;
+    int first_frame_id_;
+    int last_frame_id_;
+};
+
 class Model {
 public:
     Model() {}
@@ -84,14 +97,73 @@ public:
 
     int64_t GetHashmapSize();
 
+    /// Split the map into submaps. A new submap starts at the integrated frame
+    /// when the active submap holds \p max_frames frames, or when the camera
+    /// moves farther than \p max_distance (in meter) from the submap origin.
+    /// Zero disables a criterion. Finished submaps are moved to the host with
+    /// \p offload, so that the device memory is bounded by the active submap.
+    void SetSubmapPolicy(int max_frames,
+                         float max_distance,
+                         bool offload = true);
+
+    /// Number of submaps, including the active one.
+    int GetSubmapCount() const { return static_cast<int>(submaps_.size()) + 1; }
+
+    /// Transformation from the submap \p submap_id to the world.
+    core::Tensor GetSubmapPose(int submap_id) const;
+
+    /// Extract the surface points of the submap \p submap_id in its own frame,
+    /// e.g. for registering submaps to detect loop closures.
+    t::geometry::PointCloud ExtractSubmapPointCloud(
+            int submap_id,
+            int estimated_number = -1,
+            float weight_threshold = 3.0f);
+
+    /// Pose graph over the submaps, with the submap poses as nodes and the
+    /// relative poses of consecutive submaps as odometry edges. Loop closure
+    /// edges can be added before optimizing it.
+    open3d::pipelines::registration::PoseGraph GetSubmapPoseGraph() const;
+
+    /// Move the submaps rigidly to the poses of the nodes of \p pose_graph,
+    /// e.g. after a loop closure was optimized. The current frame pose follows
+    /// the active submap.
+    void UpdateSubmapPoses(
+            const open3d::pipelines::registration::PoseGraph& pose_graph);
+
+protected:
+    /// Finish the active submap and start a new one at the current frame.
+    void StartNewSubmap();
+
+    /// Transformation from the current frame to the active submap.
+    core::Tensor GetFrameToSubmapPose() const;
+
 public:
-    // Maintained volumetric map
+    // Maintained volumetric map, i.e. the active submap
     t::geometry::TSDFVoxelGrid voxel_grid_;
 
     // T_frame_to_model, maintained tracking state
     core::Tensor T_frame_to_world_;
 
     int frame_id_ = -1;
+
+protected:
+    // Voxel grid parameters for new submaps
+    float voxel_size_ = 3.0 / 512.0;
+    float sdf_trunc_ = 0.04;
+    int block_resolution_ = 16;
+    int block_count_ = 1000;
+
+    // Active submap
+    core::Tensor T_submap_to_world_ =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+    int submap_first_frame_id_ = 0;
+
+    // Finished submaps
+    std::vector<Submap> submaps_;
+
+    int submap_max_frames_ = 0;
+    float submap_max_distance_ = 0;
+    bool submap_offload_ = true;
 };
 }  // namespace voxelhashing
 }  // namespace pipelines
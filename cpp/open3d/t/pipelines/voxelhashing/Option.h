@@ -47,6 +47,7 @@ struct Option {
 
     /// Input options
     float depth_scale = 1000.0f;
+    float depth_min = 0.3f;
     float depth_max = 3.0f;
     float depth_diff = 0.07f;
 };
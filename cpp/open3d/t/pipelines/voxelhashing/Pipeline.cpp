@@ -0,0 +1,217 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/voxelhashing/Pipeline.h"
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+Pipeline::Pipeline(Model& model,
+                   const core::Tensor& intrinsics,
+                   int height,
+                   int width,
+                   FrameLoader loader,
+                   const Option& option,
+                   int queue_size)
+    : model_(model),
+      intrinsics_(intrinsics),
+      height_(height),
+      width_(width),
+      loader_(std::move(loader)),
+      option_(option),
+      device_(model.voxel_grid_.GetDevice()),
+      raycast_frame_(height, width, intrinsics, device_) {
+    if (queue_size <= 0) {
+        utility::LogError(
+                "[Pipeline] queue_size must be positive, but got {}.",
+                queue_size);
+    }
+    queue_size_ = static_cast<size_t>(queue_size);
+    if (device_.GetType() == core::Device::DeviceType::CUDA) {
+        upload_stream_ = core::CUDAStream(device_);
+    }
+    frame_id_ = model_.frame_id_ + 1;
+    loader_thread_ = std::thread(&Pipeline::LoaderLoop, this);
+}
+
+Pipeline::~Pipeline() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    queue_not_full_.notify_all();
+    if (loader_thread_.joinable()) {
+        loader_thread_.join();
+    }
+}
+
+void Pipeline::LoaderLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queue_not_full_.wait(lock, [this] {
+                return stop_ || queue_.size() < queue_size_;
+            });
+            if (stop_) return;
+        }
+
+        utility::Timer timer;
+        timer.Start();
+        Frame frame(height_, width_, intrinsics_, device_);
+        bool has_frame = false;
+        try {
+            t::geometry::Image depth, color;
+            has_frame = loader_(depth, color);
+            if (has_frame) {
+                // Upload on a separate stream, so that the copies overlap
+                // with the model updates of the previous frame.
+                if (upload_stream_.has_value()) {
+                    core::CUDAScopedStream scoped_stream(
+                            upload_stream_.value());
+                    frame.SetDataFromImage("depth", depth);
+                    frame.SetDataFromImage("color", color);
+                    upload_stream_.value().Synchronize();
+                } else {
+                    frame.SetDataFromImage("depth", depth);
+                    frame.SetDataFromImage("color", color);
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            loader_exception_ = std::current_exception();
+            has_frame = false;
+        }
+        timer.Stop();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!has_frame) {
+                is_eof_ = true;
+            } else {
+                queue_.push_back(std::move(frame));
+                stats_sum_.load_ms += timer.GetDuration();
+                ++load_count_;
+            }
+        }
+        queue_not_empty_.notify_one();
+        if (!has_frame) return;
+    }
+}
+
+bool Pipeline::Step() {
+    utility::Timer frame_timer, timer;
+    frame_timer.Start();
+
+    timer.Start();
+    utility::optional<Frame> input_frame;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        queue_not_empty_.wait(lock,
+                              [this] { return is_eof_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            if (loader_exception_ != nullptr) {
+                std::rethrow_exception(loader_exception_);
+            }
+            return false;
+        }
+        input_frame = std::move(queue_.front());
+        queue_.pop_front();
+    }
+    queue_not_full_.notify_one();
+    timer.Stop();
+    double wait_ms = timer.GetDuration();
+
+    // Tracking needs the model frame synthesized at the previous pose.
+    timer.Start();
+    core::Tensor T_frame_to_model = model_.GetCurrentFramePose();
+    if (frame_id_ > 0) {
+        core::Tensor delta_frame_to_model = model_.TrackFrameToModel(
+                input_frame.value(), raycast_frame_, option_.depth_scale,
+                option_.depth_max, option_.depth_diff);
+        T_frame_to_model =
+                T_frame_to_model.Matmul(delta_frame_to_model).Contiguous();
+    }
+    model_.UpdateFramePose(frame_id_, T_frame_to_model);
+    timer.Stop();
+    double track_ms = timer.GetDuration();
+
+    timer.Start();
+    model_.Integrate(input_frame.value(), option_.depth_scale,
+                     option_.depth_max);
+    timer.Stop();
+    double integrate_ms = timer.GetDuration();
+
+    timer.Start();
+    model_.SynthesizeModelFrame(raycast_frame_, option_.depth_scale,
+                                option_.depth_min, option_.depth_max);
+    timer.Stop();
+    double raycast_ms = timer.GetDuration();
+
+    ++frame_id_;
+    frame_timer.Stop();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_sum_.frame_count;
+    stats_sum_.wait_ms += wait_ms;
+    stats_sum_.track_ms += track_ms;
+    stats_sum_.integrate_ms += integrate_ms;
+    stats_sum_.raycast_ms += raycast_ms;
+    stats_sum_.frame_ms += frame_timer.GetDuration();
+    return true;
+}
+
+void Pipeline::Run() {
+    while (Step()) {
+    }
+}
+
+PipelineStats Pipeline::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PipelineStats stats = stats_sum_;
+    if (load_count_ > 0) {
+        stats.load_ms /= load_count_;
+    }
+    if (stats.frame_count > 0) {
+        double n = static_cast<double>(stats.frame_count);
+        stats.wait_ms /= n;
+        stats.track_ms /= n;
+        stats.integrate_ms /= n;
+        stats.raycast_ms /= n;
+        stats.frame_ms /= n;
+    }
+    return stats;
+}
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/pipelines/voxelhashing/Frame.h"
+#include "open3d/t/pipelines/voxelhashing/Model.h"
+#include "open3d/t/pipelines/voxelhashing/Option.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+/// Per-stage latencies of the Pipeline in milliseconds, averaged over the
+/// processed frames.
+struct PipelineStats {
+    int64_t frame_count = 0;
+
+    /// Decoding and uploading on the loader thread.
+    double load_ms = 0;
+    /// Waiting for a loaded frame on the main thread.
+    double wait_ms = 0;
+    double track_ms = 0;
+    double integrate_ms = 0;
+    double raycast_ms = 0;
+    /// Main thread time per frame, including waiting.
+    double frame_ms = 0;
+};
+
+/// \class Pipeline
+///
+/// Runs the voxel hashing system with the frame loading decoupled from the
+/// model updates. A loader thread decodes the next frames and uploads them to
+/// the device on its own stream into a bounded queue, while the main thread
+/// tracks, integrates and ray casts the current frame on the compute stream.
+class Pipeline {
+public:
+    /// Reads the next depth and color images. Returns false at the end of the
+    /// input.
+    using FrameLoader = std::function<bool(t::geometry::Image& depth,
+                                           t::geometry::Image& color)>;
+
+    /// \param model The model to track against and integrate into. It must
+    /// outlive the pipeline.
+    /// \param queue_size Maximal number of loaded frames waiting to be
+    /// processed.
+    Pipeline(Model& model,
+             const core::Tensor& intrinsics,
+             int height,
+             int width,
+             FrameLoader loader,
+             const Option& option = Option(),
+             int queue_size = 2);
+    ~Pipeline();
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    /// Processes the next frame. Returns false when the input is exhausted.
+    bool Step();
+
+    /// Processes all the remaining frames.
+    void Run();
+
+    PipelineStats GetStats() const;
+
+private:
+    void LoaderLoop();
+
+    Model& model_;
+    core::Tensor intrinsics_;
+    int height_;
+    int width_;
+    FrameLoader loader_;
+    Option option_;
+    size_t queue_size_;
+    core::Device device_;
+
+    // Only created on CUDA devices.
+    utility::optional<core::CUDAStream> upload_stream_;
+
+    Frame raycast_frame_;
+    int frame_id_ = 0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable queue_not_full_;
+    std::condition_variable queue_not_empty_;
+    std::deque<Frame> queue_;
+    bool is_eof_ = false;
+    bool stop_ = false;
+    // Rethrown on the main thread.
+    std::exception_ptr loader_exception_;
+
+    // Accumulated latencies, guarded by mutex_.
+    PipelineStats stats_sum_;
+    int64_t load_count_ = 0;
+
+    std::thread loader_thread_;
+};
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -300,14 +300,15 @@ Eigen::Vector3d ColorToDouble(const Eigen::Vector3uint8 &rgb) {
     return ColorToDouble(rgb(0), rgb(1), rgb(2));
 }
 
-template <typename IdxType>
-Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
-                                  const std::vector<IdxType> &indices) {
+namespace {
+template <typename PointType, typename IdxType>
+Eigen::Matrix3d ComputeCovarianceImpl(const std::vector<PointType> &points,
+                                      const std::vector<IdxType> &indices) {
     Eigen::Matrix3d covariance;
     Eigen::Matrix<double, 9, 1> cumulants;
     cumulants.setZero();
     for (const auto &idx : indices) {
-        const Eigen::Vector3d &point = points[idx];
+        const Eigen::Vector3d point = points[idx].template cast<double>();
         cumulants(0) += point(0);
         cumulants(1) += point(1);
         cumulants(2) += point(2);
@@ -330,6 +331,19 @@ Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
     covariance(2, 1) = covariance(1, 2);
     return covariance;
 }
+}  // namespace
+
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
+                                  const std::vector<IdxType> &indices) {
+    return ComputeCovarianceImpl(points, indices);
+}
+
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3f> &points,
+                                  const std::vector<IdxType> &indices) {
+    return ComputeCovarianceImpl(points, indices);
+}
 
 template <typename IdxType>
 std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
@@ -376,6 +390,9 @@ template std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
 template Eigen::Matrix3d ComputeCovariance(
         const std::vector<Eigen::Vector3d> &points,
         const std::vector<int> &indices);
+template Eigen::Matrix3d ComputeCovariance(
+        const std::vector<Eigen::Vector3f> &points,
+        const std::vector<int> &indices);
 template std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
         const std::vector<Eigen::Vector3d> &points,
         const std::vector<int> &indices);
@@ -134,6 +134,12 @@ template <typename IdxType>
 Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
                                   const std::vector<IdxType> &indices);
 
+/// Function to compute the covariance matrix of a set of single precision
+/// points. The moments are accumulated in double precision.
+template <typename IdxType>
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3f> &points,
+                                  const std::vector<IdxType> &indices);
+
 /// Function to compute the mean and covariance matrix of a set of points.
 template <typename IdxType>
 std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
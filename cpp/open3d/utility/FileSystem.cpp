@@ -235,6 +235,18 @@ bool FileExists(const std::string &filename) {
 #endif
 }
 
+int64_t GetFileSize(const std::string &filename) {
+#ifdef WINDOWS
+    struct _stat64 info;
+    if (_stat64(filename.c_str(), &info) == -1) return -1;
+#else
+    struct stat info;
+    if (stat(filename.c_str(), &info) == -1) return -1;
+#endif
+    if (!S_ISREG(info.st_mode)) return -1;
+    return static_cast<int64_t>(info.st_size);
+}
+
 bool RemoveFile(const std::string &filename) {
     return (std::remove(filename.c_str()) == 0);
 }
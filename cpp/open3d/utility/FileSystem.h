@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -60,6 +61,9 @@ bool DeleteDirectory(const std::string &directory);
 
 bool FileExists(const std::string &filename);
 
+/// Returns the size of a regular file in bytes, or -1 if it does not exist.
+int64_t GetFileSize(const std::string &filename);
+
 bool RemoveFile(const std::string &filename);
 
 bool ListDirectory(const std::string &directory,
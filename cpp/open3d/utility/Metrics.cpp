@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Metrics.h"
+
+#include <memory>
+#include <mutex>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+struct MetricFamily {
+    std::string help_;
+    /// Counters keyed by their formatted label set, e.g. {device="CPU:0"}.
+    std::map<std::string, std::unique_ptr<Counter>> counters_;
+};
+
+struct MetricsState {
+    std::mutex mutex_;
+    std::map<std::string, MetricFamily> families_;
+};
+
+/// Never destroyed, such that counters cached in function-local statics stay
+/// valid during static destruction.
+MetricsState& GetState() {
+    static MetricsState* state = new MetricsState();
+    return *state;
+}
+
+bool IsValidMetricName(const std::string& name) {
+    if (name.empty()) {
+        return false;
+    }
+    for (size_t i = 0; i < name.size(); ++i) {
+        char c = name[i];
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                     c == '_' || c == ':' || (i > 0 && c >= '0' && c <= '9');
+        if (!valid) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string EscapeLabelValue(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        if (c == '\\' || c == '"') {
+            escaped += '\\';
+            escaped += c;
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string EscapeHelp(const std::string& help) {
+    std::string escaped;
+    escaped.reserve(help.size());
+    for (char c : help) {
+        if (c == '\\') {
+            escaped += "\\\\";
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string FormatLabels(const Metrics::Labels& labels) {
+    if (labels.empty()) {
+        return "";
+    }
+    std::string formatted = "{";
+    for (const auto& kv : labels) {
+        if (!IsValidMetricName(kv.first) ||
+            kv.first.find(':') != std::string::npos) {
+            utility::LogError("Invalid metric label name \"{}\".", kv.first);
+        }
+        if (formatted.size() > 1) {
+            formatted += ',';
+        }
+        formatted += kv.first + "=\"" + EscapeLabelValue(kv.second) + '"';
+    }
+    formatted += '}';
+    return formatted;
+}
+
+}  // namespace
+
+int64_t Counter::Get() const {
+    int64_t sum = 0;
+    for (const Shard& shard : shards_) {
+        sum += shard.value_.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+void Counter::Reset() {
+    for (Shard& shard : shards_) {
+        shard.value_.store(0, std::memory_order_relaxed);
+    }
+}
+
+int Counter::ShardIndex() {
+    static std::atomic<int> next_index{0};
+    thread_local int index =
+            next_index.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+    return index;
+}
+
+Counter& Metrics::GetCounter(const std::string& name,
+                             const Labels& labels /* = {} */,
+                             const std::string& help /* = "" */) {
+    if (!IsValidMetricName(name)) {
+        utility::LogError("Invalid metric name \"{}\".", name);
+    }
+    std::string label_str = FormatLabels(labels);
+
+    MetricsState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    MetricFamily& family = state.families_[name];
+    if (family.help_.empty()) {
+        family.help_ = help;
+    }
+    std::unique_ptr<Counter>& counter = family.counters_[label_str];
+    if (!counter) {
+        counter.reset(new Counter());
+    }
+    return *counter;
+}
+
+std::map<std::string, int64_t> Metrics::GetValues() {
+    MetricsState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    std::map<std::string, int64_t> values;
+    for (const auto& family : state.families_) {
+        for (const auto& counter : family.second.counters_) {
+            values[family.first + counter.first] = counter.second->Get();
+        }
+    }
+    return values;
+}
+
+void Metrics::Reset() {
+    MetricsState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    for (auto& family : state.families_) {
+        for (auto& counter : family.second.counters_) {
+            counter.second->Reset();
+        }
+    }
+}
+
+std::string Metrics::ToPrometheusText() {
+    MetricsState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    std::string text;
+    for (const auto& family : state.families_) {
+        if (!family.second.help_.empty()) {
+            text += fmt::format("# HELP {} {}\n", family.first,
+                                EscapeHelp(family.second.help_));
+        }
+        text += fmt::format("# TYPE {} counter\n", family.first);
+        for (const auto& counter : family.second.counters_) {
+            text += fmt::format("{}{} {}\n", family.first, counter.first,
+                                counter.second->Get());
+        }
+    }
+    return text;
+}
+
+}  // namespace utility
+}  // namespace open3d
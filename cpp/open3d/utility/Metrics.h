@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// \class Counter
+///
+/// A monotonic 64-bit counter that is cheap to increment from many threads.
+/// Increments go to one of several cache-line sized shards, picked per
+/// thread, and are only summed up when the counter is read.
+class Counter {
+public:
+    Counter() = default;
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    void Add(int64_t value = 1) {
+        shards_[ShardIndex()].value_.fetch_add(value,
+                                               std::memory_order_relaxed);
+    }
+
+    /// Returns the sum of all increments since the last Reset().
+    int64_t Get() const;
+
+    void Reset();
+
+private:
+    static constexpr int kNumShards = 16;
+    static constexpr int kCacheLineSize = 64;
+
+    struct Shard {
+        std::atomic<int64_t> value_{0};
+        char padding_[kCacheLineSize - sizeof(std::atomic<int64_t>)];
+    };
+
+    static int ShardIndex();
+
+    Shard shards_[kNumShards];
+};
+
+/// \class Metrics
+///
+/// A process-wide registry of counters, identified by a metric name and a
+/// set of labels. Open3D counts, among others, the kernels launched and the
+/// elements processed per device, nearest neighbor search queries, hash map
+/// insertions and rehashes, and the bytes read and written by the io module.
+///
+/// The counters can be exported in the Prometheus text exposition format.
+///
+/// Example:
+/// ```cpp
+/// static utility::Counter& frames = utility::Metrics::GetCounter(
+///         "app_frames_total", {{"camera", "left"}}, "Processed frames.");
+/// frames.Add();
+/// utility::LogInfo("{}", utility::Metrics::ToPrometheusText());
+/// ```
+class Metrics {
+public:
+    using Labels = std::map<std::string, std::string>;
+
+    /// Returns the counter for \p name and \p labels, creating it if needed.
+    /// The returned reference stays valid for the lifetime of the process, so
+    /// callers on hot paths should look it up once and cache it.
+    ///
+    /// \param name Metric name. Must match [a-zA-Z_:][a-zA-Z0-9_:]*.
+    /// \param labels Label names and values of the counter.
+    /// \param help Description of the metric. The first non-empty help of a
+    /// metric name is kept.
+    static Counter& GetCounter(const std::string& name,
+                               const Labels& labels = {},
+                               const std::string& help = "");
+
+    /// Returns the current value of all counters, keyed by their Prometheus
+    /// series name, e.g. `open3d_core_kernel_launches_total{device="CPU:0"}`.
+    static std::map<std::string, int64_t> GetValues();
+
+    /// Sets all counters to zero. Registered counters stay valid.
+    static void Reset();
+
+    /// Returns all counters in the Prometheus text exposition format.
+    static std::string ToPrometheusText();
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,262 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+class TBBExecutor : public ParallelExecutor {
+public:
+    void ParallelFor(
+            int64_t begin,
+            int64_t end,
+            int64_t grain_size,
+            int max_parallelism,
+            const std::function<void(int64_t, int64_t)>& func) override {
+        tbb::blocked_range<int64_t> range(begin, end,
+                                          std::max<int64_t>(grain_size, 1));
+        auto body = [&func](const tbb::blocked_range<int64_t>& r) {
+            func(r.begin(), r.end());
+        };
+        if (max_parallelism >= GetMaxParallelism()) {
+            tbb::parallel_for(range, body);
+        } else {
+            GetArena(max_parallelism).execute([&range, &body]() {
+                tbb::parallel_for(range, body);
+            });
+        }
+    }
+
+    int GetMaxParallelism() const override {
+        return tbb::this_task_arena::max_concurrency();
+    }
+
+    std::string GetName() const override { return "TBB"; }
+
+private:
+    /// Arenas are expensive to create, so one arena is kept per concurrency
+    /// level requested by ScopedMaxParallelism.
+    tbb::task_arena& GetArena(int max_concurrency) {
+        std::lock_guard<std::mutex> lock(arenas_mutex_);
+        auto& arena = arenas_[max_concurrency];
+        if (!arena) {
+            arena = std::make_unique<tbb::task_arena>(max_concurrency);
+        }
+        return *arena;
+    }
+
+    std::mutex arenas_mutex_;
+    std::map<int, std::unique_ptr<tbb::task_arena>> arenas_;
+};
+
+class OpenMPExecutor : public ParallelExecutor {
+public:
+    void ParallelFor(
+            int64_t begin,
+            int64_t end,
+            int64_t grain_size,
+            int max_parallelism,
+            const std::function<void(int64_t, int64_t)>& func) override {
+#ifdef _OPENMP
+        const int64_t n = end - begin;
+        const int64_t num_chunks = std::min<int64_t>(
+                max_parallelism,
+                (n + std::max<int64_t>(grain_size, 1) - 1) /
+                        std::max<int64_t>(grain_size, 1));
+        if (num_chunks <= 1 || omp_in_parallel()) {
+            func(begin, end);
+            return;
+        }
+        const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            const int64_t chunk_begin = begin + chunk_idx * chunk_size;
+            const int64_t chunk_end = std::min(chunk_begin + chunk_size, end);
+            if (chunk_begin < chunk_end) {
+                func(chunk_begin, chunk_end);
+            }
+        }
+#else
+        func(begin, end);
+#endif
+    }
+
+    int GetMaxParallelism() const override {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    std::string GetName() const override { return "OpenMP"; }
+};
+
+class SerialExecutor : public ParallelExecutor {
+public:
+    void ParallelFor(
+            int64_t begin,
+            int64_t end,
+            int64_t grain_size,
+            int max_parallelism,
+            const std::function<void(int64_t, int64_t)>& func) override {
+        func(begin, end);
+    }
+
+    int GetMaxParallelism() const override { return 1; }
+
+    std::string GetName() const override { return "Serial"; }
+};
+
+std::shared_ptr<ParallelExecutor> CreateDefaultExecutor() {
+    const char* env = std::getenv("OPEN3D_PARALLEL_BACKEND");
+    if (env == nullptr) {
+        return CreateTBBExecutor();
+    }
+    const std::string backend = ToLower(env);
+    if (backend == "openmp") {
+        return CreateOpenMPExecutor();
+    } else if (backend == "serial") {
+        return CreateSerialExecutor();
+    } else if (backend != "tbb") {
+        LogWarning(
+                "Unknown OPEN3D_PARALLEL_BACKEND {}, expected tbb, openmp or "
+                "serial. Using tbb.",
+                env);
+    }
+    return CreateTBBExecutor();
+}
+
+std::mutex g_executor_mutex;
+std::shared_ptr<ParallelExecutor> g_executor;
+
+// 0 means unbounded.
+thread_local int g_max_parallelism = 0;
+thread_local int g_parallel_depth = 0;
+
+struct ParallelRegionGuard {
+    ParallelRegionGuard() { ++g_parallel_depth; }
+    ~ParallelRegionGuard() { --g_parallel_depth; }
+};
+
+}  // namespace
+
+std::shared_ptr<ParallelExecutor> CreateTBBExecutor() {
+    return std::make_shared<TBBExecutor>();
+}
+
+std::shared_ptr<ParallelExecutor> CreateOpenMPExecutor() {
+    return std::make_shared<OpenMPExecutor>();
+}
+
+std::shared_ptr<ParallelExecutor> CreateSerialExecutor() {
+    return std::make_shared<SerialExecutor>();
+}
+
+void SetParallelExecutor(std::shared_ptr<ParallelExecutor> executor) {
+    std::lock_guard<std::mutex> lock(g_executor_mutex);
+    g_executor = executor ? executor : CreateDefaultExecutor();
+}
+
+std::shared_ptr<ParallelExecutor> GetParallelExecutor() {
+    std::lock_guard<std::mutex> lock(g_executor_mutex);
+    if (!g_executor) {
+        g_executor = CreateDefaultExecutor();
+    }
+    return g_executor;
+}
+
+int GetMaxParallelism() {
+    int max_parallelism =
+            std::max(GetParallelExecutor()->GetMaxParallelism(), 1);
+    if (g_max_parallelism > 0) {
+        max_parallelism = std::min(max_parallelism, g_max_parallelism);
+    }
+    return max_parallelism;
+}
+
+bool InParallelRegion() { return g_parallel_depth > 0; }
+
+ScopedMaxParallelism::ScopedMaxParallelism(int max_parallelism)
+    : prev_max_parallelism_(g_max_parallelism) {
+    if (max_parallelism <= 0) {
+        LogError("max_parallelism must be positive, but got {}.",
+                 max_parallelism);
+    }
+    g_max_parallelism = g_max_parallelism > 0
+                                ? std::min(g_max_parallelism, max_parallelism)
+                                : max_parallelism;
+}
+
+ScopedMaxParallelism::~ScopedMaxParallelism() {
+    g_max_parallelism = prev_max_parallelism_;
+}
+
+namespace detail {
+
+void ParallelForImpl(int64_t begin,
+                     int64_t end,
+                     int64_t grain_size,
+                     const std::function<void(int64_t, int64_t)>& func) {
+    const std::shared_ptr<ParallelExecutor> executor = GetParallelExecutor();
+    int max_parallelism = std::max(executor->GetMaxParallelism(), 1);
+    if (g_max_parallelism > 0) {
+        max_parallelism = std::min(max_parallelism, g_max_parallelism);
+    }
+    if (max_parallelism == 1 || end - begin <= grain_size) {
+        ParallelRegionGuard guard;
+        func(begin, end);
+        return;
+    }
+    executor->ParallelFor(begin, end, grain_size, max_parallelism,
+                          [&func](int64_t chunk_begin, int64_t chunk_end) {
+                              ParallelRegionGuard guard;
+                              func(chunk_begin, chunk_end);
+                          });
+}
+
+}  // namespace detail
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// \class ParallelExecutor
+///
+/// Backend that runs the parallel loops of the CPU code paths. Open3D ships a
+/// TBB (work-stealing) executor, which is the default, an OpenMP executor and
+/// a serial executor. Applications embedding Open3D in their own thread pool
+/// can subclass ParallelExecutor and install it with SetParallelExecutor().
+class ParallelExecutor {
+public:
+    virtual ~ParallelExecutor() = default;
+
+    /// Calls func(chunk_begin, chunk_end) for disjoint chunks covering
+    /// [begin, end). Each chunk contains at least \p grain_size elements,
+    /// except possibly the last one. At most \p max_parallelism chunks may be
+    /// executed concurrently. Returns after all chunks are done.
+    virtual void ParallelFor(
+            int64_t begin,
+            int64_t end,
+            int64_t grain_size,
+            int max_parallelism,
+            const std::function<void(int64_t, int64_t)>& func) = 0;
+
+    /// Returns the maximum number of concurrent workers.
+    virtual int GetMaxParallelism() const = 0;
+
+    /// Returns the name of the executor, e.g. "TBB".
+    virtual std::string GetName() const = 0;
+};
+
+/// Creates the TBB work-stealing executor.
+std::shared_ptr<ParallelExecutor> CreateTBBExecutor();
+
+/// Creates the OpenMP executor. Nested loops are executed serially.
+std::shared_ptr<ParallelExecutor> CreateOpenMPExecutor();
+
+/// Creates an executor running everything on the calling thread.
+std::shared_ptr<ParallelExecutor> CreateSerialExecutor();
+
+/// Installs the global executor. Passing nullptr restores the default
+/// executor, selected by the OPEN3D_PARALLEL_BACKEND environment variable
+/// ("tbb", "openmp" or "serial", "tbb" if unset).
+void SetParallelExecutor(std::shared_ptr<ParallelExecutor> executor);
+
+/// Returns the global executor.
+std::shared_ptr<ParallelExecutor> GetParallelExecutor();
+
+/// Returns the number of workers available to parallel loops started from the
+/// calling thread, taking ScopedMaxParallelism into account.
+int GetMaxParallelism();
+
+/// Returns true if the calling thread is executing a chunk of a ParallelFor.
+bool InParallelRegion();
+
+/// \class ScopedMaxParallelism
+///
+/// Bounds the number of workers used by parallel loops started from the
+/// calling thread during the lifetime of the object, e.g.
+///
+///     {
+///         utility::ScopedMaxParallelism bound(2);
+///         pcd.EstimateNormals();  // Uses at most 2 threads.
+///     }
+class ScopedMaxParallelism {
+public:
+    explicit ScopedMaxParallelism(int max_parallelism);
+    ~ScopedMaxParallelism();
+    ScopedMaxParallelism(const ScopedMaxParallelism&) = delete;
+    ScopedMaxParallelism& operator=(const ScopedMaxParallelism&) = delete;
+
+private:
+    int prev_max_parallelism_;
+};
+
+namespace detail {
+void ParallelForImpl(int64_t begin,
+                     int64_t end,
+                     int64_t grain_size,
+                     const std::function<void(int64_t, int64_t)>& func);
+}  // namespace detail
+
+/// Calls func(chunk_begin, chunk_end) for disjoint chunks of [begin, end)
+/// using the global executor. Chunks contain at least \p grain_size elements.
+template <typename func_t>
+void ParallelForRange(int64_t begin,
+                      int64_t end,
+                      int64_t grain_size,
+                      const func_t& func) {
+    if (begin >= end) {
+        return;
+    }
+    detail::ParallelForImpl(begin, end, grain_size,
+                            [&func](int64_t chunk_begin, int64_t chunk_end) {
+                                func(chunk_begin, chunk_end);
+                            });
+}
+
+/// Calls func(i) for every i in [begin, end) using the global executor.
+/// Elements are scheduled in chunks of at least \p grain_size elements, such
+/// that the per-chunk dispatch cost is amortized over the chunk.
+template <typename func_t>
+void ParallelFor(int64_t begin,
+                 int64_t end,
+                 const func_t& func,
+                 int64_t grain_size = 1) {
+    ParallelForRange(begin, end, grain_size,
+                     [&func](int64_t chunk_begin, int64_t chunk_end) {
+                         for (int64_t i = chunk_begin; i < chunk_end; ++i) {
+                             func(i);
+                         }
+                     });
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,318 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// Zone as recorded by a ProfileZone, without its track.
+struct RawZone {
+    const char* name_;
+    int depth_;
+    double start_ms_;
+    double duration_ms_;
+};
+
+/// The zones of one thread or device. The mutex is only contended while
+/// zones are collected or cleared.
+struct ZoneBuffer {
+    explicit ZoneBuffer(const std::string& track) : track_(track) {}
+    const std::string track_;
+    std::mutex mutex_;
+    std::vector<RawZone> zones_;
+};
+
+struct ProfilerState {
+    std::atomic<bool> enabled_{false};
+    std::atomic<void (*)(const char*)> push_{nullptr};
+    std::atomic<void (*)()> pop_{nullptr};
+    const double epoch_ms_ = Timer::GetSystemTimeInMilliseconds();
+
+    /// Guards all members below.
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<ZoneBuffer>> thread_buffers_;
+    std::unordered_map<std::string, std::shared_ptr<ZoneBuffer>>
+            other_buffers_;
+    std::unordered_set<std::string> names_;
+    std::vector<std::function<void()>> flush_callbacks_;
+};
+
+/// Never destroyed, such that zones may still be closed by threads that exit
+/// after static destruction started.
+ProfilerState& GetState() {
+    static ProfilerState* state = new ProfilerState();
+    return *state;
+}
+
+struct ThreadState {
+    std::shared_ptr<ZoneBuffer> buffer_;
+    int depth_ = 0;
+};
+
+ThreadState& GetThreadState() {
+    thread_local ThreadState thread_state;
+    if (!thread_state.buffer_) {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex_);
+        thread_state.buffer_ = std::make_shared<ZoneBuffer>(
+                fmt::format("Thread {}", state.thread_buffers_.size()));
+        state.thread_buffers_.push_back(thread_state.buffer_);
+    }
+    return thread_state;
+}
+
+std::string EscapeJSON(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+void Profiler::Enable(bool enable /* = true */) {
+    GetState().enabled_.store(enable);
+}
+
+bool Profiler::IsEnabled() {
+    return GetState().enabled_.load(std::memory_order_relaxed);
+}
+
+void Profiler::Clear() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    for (auto& buffer : state.thread_buffers_) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex_);
+        buffer->zones_.clear();
+    }
+    state.other_buffers_.clear();
+}
+
+std::vector<Profiler::Zone> Profiler::GetZones() {
+    ProfilerState& state = GetState();
+    std::vector<std::function<void()>> flush_callbacks;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex_);
+        flush_callbacks = state.flush_callbacks_;
+    }
+    // Callbacks add zones, so they are called without holding the lock.
+    for (const auto& callback : flush_callbacks) {
+        callback();
+    }
+
+    std::vector<Zone> zones;
+    auto collect = [&zones, &state](ZoneBuffer& buffer) {
+        std::lock_guard<std::mutex> buffer_lock(buffer.mutex_);
+        for (const RawZone& zone : buffer.zones_) {
+            zones.push_back({zone.name_, buffer.track_, zone.depth_,
+                             zone.start_ms_ - state.epoch_ms_,
+                             zone.duration_ms_});
+        }
+    };
+    {
+        std::lock_guard<std::mutex> lock(state.mutex_);
+        for (auto& buffer : state.thread_buffers_) {
+            collect(*buffer);
+        }
+        for (auto& track_buffer : state.other_buffers_) {
+            collect(*track_buffer.second);
+        }
+    }
+    // Zones are recorded when they are closed, i.e. children before their
+    // parents. Sort parents first.
+    std::sort(zones.begin(), zones.end(), [](const Zone& a, const Zone& b) {
+        return a.start_ms_ < b.start_ms_ ||
+               (a.start_ms_ == b.start_ms_ && a.depth_ < b.depth_);
+    });
+    return zones;
+}
+
+std::string Profiler::ToChromeTraceJSON() {
+    const std::vector<Zone> zones = GetZones();
+    std::unordered_map<std::string, size_t> track_ids;
+    std::string events;
+    for (const Zone& zone : zones) {
+        auto it = track_ids.find(zone.track_);
+        if (it == track_ids.end()) {
+            it = track_ids.emplace(zone.track_, track_ids.size()).first;
+            events += fmt::format(
+                    "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                    "\"tid\":{},\"args\":{{\"name\":\"{}\"}}}},\n",
+                    it->second, EscapeJSON(zone.track_));
+        }
+        // Chrome traces are in microseconds.
+        events += fmt::format(
+                "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},"
+                "\"ts\":{:.3f},\"dur\":{:.3f}}},\n",
+                EscapeJSON(zone.name_), it->second, zone.start_ms_ * 1000.0,
+                zone.duration_ms_ * 1000.0);
+    }
+    if (!events.empty()) {
+        events.erase(events.size() - 2, 1);  // Trailing comma.
+    }
+    return "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" + events + "]}\n";
+}
+
+bool Profiler::WriteChromeTrace(const std::string& filename) {
+    const std::string json = ToChromeTraceJSON();
+    FILE* file = filesystem::FOpen(filename, "w");
+    if (file == nullptr) {
+        LogWarning("Profiler: cannot open file {} for writing.", filename);
+        return false;
+    }
+    const bool success =
+            fwrite(json.data(), 1, json.size(), file) == json.size();
+    fclose(file);
+    if (!success) {
+        LogWarning("Profiler: cannot write file {}.", filename);
+    }
+    return success;
+}
+
+void Profiler::LogSummary() {
+    struct Stats {
+        int64_t count_ = 0;
+        double total_ms_ = 0;
+        double max_ms_ = 0;
+    };
+    // Sorting by path lists children right after their parent.
+    std::map<std::vector<std::string>, Stats> stats;
+    std::unordered_map<std::string, std::vector<std::string>> track_paths;
+    for (const Zone& zone : GetZones()) {
+        std::vector<std::string>& path = track_paths[zone.track_];
+        path.resize(std::min(path.size(), size_t(zone.depth_)));
+        path.push_back(zone.name_);
+        Stats& zone_stats = stats[path];
+        zone_stats.count_++;
+        zone_stats.total_ms_ += zone.duration_ms_;
+        zone_stats.max_ms_ = std::max(zone_stats.max_ms_, zone.duration_ms_);
+    }
+    LogInfo("{:<48} {:>8} {:>12} {:>10} {:>10}", "Zone", "Count", "Total ms",
+            "Mean ms", "Max ms");
+    for (const auto& path_stats : stats) {
+        const std::string indented_name =
+                std::string(2 * (path_stats.first.size() - 1), ' ') +
+                path_stats.first.back();
+        const Stats& zone_stats = path_stats.second;
+        LogInfo("{:<48} {:>8} {:>12.3f} {:>10.3f} {:>10.3f}", indented_name,
+                zone_stats.count_, zone_stats.total_ms_,
+                zone_stats.total_ms_ / zone_stats.count_, zone_stats.max_ms_);
+    }
+}
+
+void Profiler::AddZone(const char* name,
+                       const std::string& track,
+                       int depth,
+                       double start_ms,
+                       double duration_ms) {
+    ProfilerState& state = GetState();
+    std::shared_ptr<ZoneBuffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex_);
+        std::shared_ptr<ZoneBuffer>& track_buffer = state.other_buffers_[track];
+        if (!track_buffer) {
+            track_buffer = std::make_shared<ZoneBuffer>(track);
+        }
+        buffer = track_buffer;
+    }
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex_);
+    buffer->zones_.push_back({name, depth, start_ms, duration_ms});
+}
+
+const char* Profiler::InternName(const std::string& name) {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    // Elements of unordered_set are not moved by rehashing.
+    return state.names_.insert(name).first->c_str();
+}
+
+void Profiler::SetRangeCallbacks(void (*push)(const char* name),
+                                 void (*pop)()) {
+    ProfilerState& state = GetState();
+    state.push_.store(push);
+    state.pop_.store(pop);
+}
+
+void Profiler::AddFlushCallback(const std::function<void()>& callback) {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    state.flush_callbacks_.push_back(callback);
+}
+
+ProfileZone::ProfileZone(const char* name) : name_(name), start_ms_(-1.0) {
+    ProfilerState& state = GetState();
+    if (!state.enabled_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    GetThreadState().depth_++;
+    if (auto push = state.push_.load(std::memory_order_relaxed)) {
+        push(name_);
+    }
+    start_ms_ = Timer::GetSystemTimeInMilliseconds();
+}
+
+ProfileZone::~ProfileZone() {
+    if (start_ms_ < 0) {
+        return;
+    }
+    const double end_ms = Timer::GetSystemTimeInMilliseconds();
+    ProfilerState& state = GetState();
+    if (auto pop = state.pop_.load(std::memory_order_relaxed)) {
+        pop();
+    }
+    ThreadState& thread_state = GetThreadState();
+    thread_state.depth_--;
+    std::lock_guard<std::mutex> lock(thread_state.buffer_->mutex_);
+    thread_state.buffer_->zones_.push_back(
+            {name_, thread_state.depth_, start_ms_, end_ms - start_ms_});
+}
+
+}  // namespace utility
+}  // namespace open3d
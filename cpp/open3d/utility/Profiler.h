@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "open3d/Macro.h"
+
+namespace open3d {
+namespace utility {
+
+/// \class Profiler
+///
+/// A low-overhead hierarchical profiler. Scopes are instrumented with
+/// OPEN3D_PROFILE_SCOPE(name), which records a zone with its start time,
+/// duration and nesting depth into a buffer owned by the calling thread.
+/// Zones are only recorded while the profiler is enabled. Otherwise, a zone
+/// costs a single atomic load.
+///
+/// The recorded zones can be written as a Chrome trace, which can be viewed
+/// in chrome://tracing or https://ui.perfetto.dev, or logged as a summary.
+///
+/// Example:
+/// ```cpp
+/// utility::Profiler::Enable();
+/// for (const auto& frame : frames) {
+///     OPEN3D_PROFILE_SCOPE("Frame");
+///     // Calls into instrumented Open3D functions are nested in "Frame".
+/// }
+/// utility::Profiler::WriteChromeTrace("trace.json");
+/// utility::Profiler::LogSummary();
+/// ```
+class Profiler {
+public:
+    /// A recorded zone. Times are in milliseconds relative to the first use
+    /// of the profiler.
+    struct Zone {
+        /// Zone name. Must outlive the profiler, see InternName().
+        const char* name_;
+        /// Name of the thread or device track the zone was recorded on.
+        std::string track_;
+        /// Number of enclosing zones on the same track.
+        int depth_;
+        double start_ms_;
+        double duration_ms_;
+    };
+
+    /// Starts or stops recording zones. Zones that are already open when
+    /// recording starts are not recorded.
+    static void Enable(bool enable = true);
+
+    static bool IsEnabled();
+
+    /// Removes all recorded zones.
+    static void Clear();
+
+    /// Returns the zones recorded so far on all threads and devices, sorted
+    /// by start time.
+    static std::vector<Zone> GetZones();
+
+    /// Returns the recorded zones in Chrome's trace event JSON format.
+    static std::string ToChromeTraceJSON();
+
+    /// Writes ToChromeTraceJSON() to \p filename. Returns false on failure.
+    static bool WriteChromeTrace(const std::string& filename);
+
+    /// Logs the count, total and mean duration of the recorded zones,
+    /// grouped by their nesting path.
+    static void LogSummary();
+
+    /// Adds a zone that was timed elsewhere, e.g. on a device with CUDA
+    /// events, on the track \p track. \p start_ms is measured with
+    /// Timer::GetSystemTimeInMilliseconds().
+    static void AddZone(const char* name,
+                        const std::string& track,
+                        int depth,
+                        double start_ms,
+                        double duration_ms);
+
+    /// Returns a copy of \p name that stays valid until the program exits,
+    /// for zone names that are not string literals.
+    static const char* InternName(const std::string& name);
+
+    /// Sets functions that are called when a zone is opened and closed while
+    /// the profiler is enabled, e.g. to emit NVTX ranges for Nsight Systems.
+    /// Pass nullptr to remove them. They should be set while the profiler is
+    /// disabled, such that every push is matched by a pop.
+    static void SetRangeCallbacks(void (*push)(const char* name),
+                                  void (*pop)());
+
+    /// Adds a function that is called before the recorded zones are
+    /// collected, e.g. to resolve device timings that complete
+    /// asynchronously.
+    static void AddFlushCallback(const std::function<void()>& callback);
+};
+
+/// \class ProfileZone
+///
+/// Records a zone of the Profiler from construction to destruction. Use the
+/// OPEN3D_PROFILE_SCOPE macro instead of constructing it directly.
+class ProfileZone {
+public:
+    /// \param name Zone name. Must be a string literal or outlive the
+    /// profiler, see Profiler::InternName().
+    explicit ProfileZone(const char* name);
+    ~ProfileZone();
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name_;
+    /// Negative if the zone is not recorded.
+    double start_ms_;
+};
+
+}  // namespace utility
+}  // namespace open3d
+
+/// Records the enclosing scope as a zone named \p name (a string literal) of
+/// utility::Profiler.
+#define OPEN3D_PROFILE_SCOPE(name)                                          \
+    ::open3d::utility::ProfileZone OPEN3D_CONCATENATE(open3d_profile_zone_, \
+                                                      __LINE__)(name)
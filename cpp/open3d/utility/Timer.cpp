@@ -29,6 +29,7 @@
 #include <chrono>
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace utility {
@@ -63,11 +64,16 @@ void Timer::Print(const std::string &timer_info) const {
 
 ScopeTimer::ScopeTimer(const std::string &scope_timer_info /* = ""*/)
     : scope_timer_info_(scope_timer_info) {
+    if (Profiler::IsEnabled()) {
+        profile_zone_ = std::make_unique<ProfileZone>(
+                Profiler::InternName(scope_timer_info_));
+    }
     Timer::Start();
 }
 
 ScopeTimer::~ScopeTimer() {
     Timer::Stop();
+    profile_zone_.reset();
     Timer::Print(scope_timer_info_ + " took");
 }
 
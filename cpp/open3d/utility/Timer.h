@@ -26,11 +26,14 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 namespace open3d {
 namespace utility {
 
+class ProfileZone;
+
 class Timer {
 public:
     Timer();
@@ -50,6 +53,8 @@ private:
     double end_time_in_milliseconds_;
 };
 
+/// Logs the time spent in a scope. While the Profiler is enabled, the scope is
+/// also recorded as a profiler zone named \p scope_timer_info.
 class ScopeTimer : public Timer {
 public:
     ScopeTimer(const std::string &scope_timer_info = "");
@@ -57,6 +62,7 @@ public:
 
 private:
     std::string scope_timer_info_;
+    std::unique_ptr<ProfileZone> profile_zone_;
 };
 
 class FPSTimer : public Timer {
@@ -26,8 +26,8 @@
 
 #include "open3d/visualization/gui/PickPointsInteractor.h"
 
+#include <algorithm>
 #include <unordered_map>
-#include <unordered_set>
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
@@ -35,6 +35,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/gui/Events.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Open3DScene.h"
@@ -57,7 +58,7 @@ static const Eigen::Vector4f kBackgroundColor = {1.0f, 1.0f, 1.0f, 1.0f};
 static const std::string kSelectablePointsName = "__selectable_points";
 // The maximum pickable point is one less than FFFFFF, because that would
 // be white, which is the color of the background.
-// static const unsigned int kNoIndex = 0x00ffffff;  // unused, but real
+static const unsigned int kNoIndex = 0x00ffffff;
 static const unsigned int kMeshIndex = 0x00fffffe;
 static const unsigned int kMaxPickableIndex = 0x00fffffd;
 
@@ -74,14 +75,32 @@ Eigen::Vector3d SetColorForIndex(uint32_t idx) {
     return CalcIndexColor(std::min(kMaxPickableIndex, idx));
 }
 
-uint32_t GetIndexForColor(geometry::Image *image, int x, int y) {
-    uint8_t *rgb = image->PointerAt<uint8_t>(x, y, 0);
+uint32_t GetIndexForColor(const uint8_t *rgb) {
     const unsigned int red = (static_cast<unsigned int>(rgb[0]) << 16);
     const unsigned int green = (static_cast<unsigned int>(rgb[1]) << 8);
     const unsigned int blue = (static_cast<unsigned int>(rgb[2]));
     return (red | green | blue);
 }
 
+// Returns the sorted x coordinates where row y crosses the polygon's edges;
+// pixels between consecutive pairs of crossings are inside (even-odd rule).
+// An edge only counts if y is in (y0, y1], so vertices are not counted
+// twice. See http://alienryderflex.com/polygon_fill/
+void PolygonRowCrossings(const std::vector<gui::Point> &polygon,
+                         int y,
+                         std::vector<int> &nodes) {
+    nodes.clear();
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        const auto &p0 = polygon[i];
+        const auto &p1 = polygon[(i + 1) % polygon.size()];
+        if ((p0.y < y && p1.y >= y) || (p1.y < y && p0.y >= y)) {
+            const double t = double(y - p0.y) / double(p1.y - p0.y);
+            nodes.push_back(int(std::round(p0.x + t * (p1.x - p0.x))));
+        }
+    }
+    std::sort(nodes.begin(), nodes.end());
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------------
@@ -238,6 +257,27 @@ void PickPointsInteractor::SetPickableGeometry(
 
 void PickPointsInteractor::SetNeedsRedraw() { dirty_ = true; }
 
+void PickPointsInteractor::DecodeIndexBuffer(const geometry::Image &img) {
+    id_width_ = img.width_;
+    id_height_ = img.height_;
+    id_buffer_.resize(size_t(id_width_) * size_t(id_height_));
+    const int n_channels = img.num_of_channels_;
+    utility::ParallelFor(
+            0, int64_t(id_buffer_.size()),
+            [this, &img, n_channels](int64_t i) {
+                id_buffer_[i] =
+                        GetIndexForColor(img.data_.data() + i * n_channels);
+            },
+            16384);
+}
+
+uint32_t PickPointsInteractor::IndexAt(int x, int y) const {
+    if (x < 0 || y < 0 || x >= id_width_ || y >= id_height_) {
+        return kNoIndex;
+    }
+    return id_buffer_[size_t(y) * size_t(id_width_) + size_t(x)];
+}
+
 rendering::MatrixInteractorLogic &PickPointsInteractor::GetMatrixInteractor() {
     return matrix_logic_;
 }
@@ -350,6 +390,7 @@ void PickPointsInteractor::OnPickImageDone(
         std::shared_ptr<geometry::Image> img) {
     if (dirty_) {
         pick_image_ = img;
+        DecodeIndexBuffer(*img);
         dirty_ = false;
     }
 
@@ -361,7 +402,6 @@ void PickPointsInteractor::OnPickImageDone(
             indices;
     while (!pending_.empty()) {
         PickInfo &info = pending_.back();
-        auto *img = pick_image_.get();
         indices.clear();
         if (info.polygon.size() == 1) {
             const int x0 = info.polygon[0].x;
@@ -370,7 +410,7 @@ void PickPointsInteractor::OnPickImageDone(
                 float score = 0;
             };
             std::unordered_map<unsigned int, Score> candidates;
-            auto clicked_idx = GetIndexForColor(img, x0, y0);
+            auto clicked_idx = IndexAt(x0, y0);
             int radius;
             // HACK: the color for kMeshIndex doesn't come back quite right.
             //       We shouldn't need to check if the index is out of range,
@@ -387,7 +427,7 @@ void PickPointsInteractor::OnPickImageDone(
             }
             for (int y = y0 - radius; y < y0 + radius; ++y) {
                 for (int x = x0 - radius; x < x0 + radius; ++x) {
-                    unsigned int idx = GetIndexForColor(img, x, y);
+                    unsigned int idx = IndexAt(x, y);
                     if (IsValidIndex(idx) && idx < points_.size()) {
                         float dist = std::sqrt(float((x - x0) * (x - x0) +
                                                      (y - y0) * (y - y0)));
@@ -414,144 +454,48 @@ void PickPointsInteractor::OnPickImageDone(
                         obj_idx, points_[best_idx]));
             }
         } else {
-            // Use polygon fill algorithm to find the pixels that need to be
-            // checked.
-            // Good test cases:  ______________             /|
-            //                  |             /    |\      / |
-            //                  |            /     |  \   /  |
-            //                  |   /\      /      |    \/   |
-            //                  |  /  \    /      |          |
-            //                  | /    \  /       |     _____|
-            //                  |/      \/        |____/
-            std::unordered_set<unsigned int> raw_indices;
-
-            // Find the min/max y, so we can avoid excess looping.
-            int minY = 1000000, maxY = -1000000;
+            // Even-odd scan conversion of the polygon, one row per task. The
+            // rows only read the index buffer, so they are independent.
+            int min_y = info.polygon[0].y, max_y = info.polygon[0].y;
             for (auto &p : info.polygon) {
-                minY = std::min(minY, p.y);
-                maxY = std::max(maxY, p.y);
+                min_y = std::min(min_y, p.y);
+                max_y = std::max(max_y, p.y);
             }
-            // Duplicate the first point so for easy indexing
-            info.polygon.push_back(info.polygon[0]);
-            // Precalculate m and b (of y = mx + b)
-            const double kInf = 1e18;
-            std::vector<double> m, b;
-            m.reserve(info.polygon.size() - 1);
-            b.reserve(info.polygon.size() - 1);
-            for (size_t i = 1; i < info.polygon.size(); ++i) {
-                int m_denom = info.polygon[i].x - info.polygon[i - 1].x;
-                if (m_denom == 0) {  // vertical line (x doesn't change)
-                    m.push_back(kInf);
-                    b.push_back(0.0);
-                    continue;
-                }
-                m.push_back(double(info.polygon[i].y - info.polygon[i - 1].y) /
-                            double(m_denom));
-                if (m.back() == 0.0) {  // horiz line (y doesn't change)
-                    b.push_back(info.polygon[i].y);
-                } else {
-                    b.push_back(info.polygon[i].y -
-                                m.back() * info.polygon[i].x);
-                }
-            }
-            // Loop through the rows of the polygon.
-            std::vector<bool> is_vert_corner(info.polygon.size(), false);
-            for (size_t i = 0; i < info.polygon.size() - 1; ++i) {
-                int prev = i - 1;
-                if (prev < 0) {
-                    prev = info.polygon.size() - 2;
-                }
-                int next = i + 1;
-                int lastY = info.polygon[prev].y;
-                int thisY = info.polygon[i].y;
-                int nextY = info.polygon[next].y;
-                if ((thisY > lastY && thisY > nextY) ||
-                    (thisY < lastY && thisY < nextY)) {
-                    is_vert_corner[i] = true;
-                }
-            }
-            is_vert_corner.back() = is_vert_corner[0];
-            std::unordered_set<int> intersectionsX;
-            std::vector<int> sortedX;
-            intersectionsX.reserve(32);
-            sortedX.reserve(32);
-            for (int y = minY; y <= maxY; ++y) {
-                for (size_t i = 0; i < m.size(); ++i) {
-                    if ((y < info.polygon[i].y && y < info.polygon[i + 1].y) ||
-                        (y > info.polygon[i].y && y > info.polygon[i + 1].y)) {
-                        continue;
-                    }
-                    if (m[i] == 0.0) {  // horizontal
-                        intersectionsX.insert({info.polygon[i].x});
-                        intersectionsX.insert({info.polygon[i + 1].x});
-                    } else if (m[i] == kInf) {  // vertical
-                        bool is_corner = (y == info.polygon[i].y);
-                        intersectionsX.insert({info.polygon[i].x});
-                        if (is_corner) {
-                            intersectionsX.insert({info.polygon[i].x});
+            min_y = std::max(min_y, 0);
+            max_y = std::min(max_y, id_height_ - 1);
+            const int n_rows = std::max(0, max_y - min_y + 1);
+            std::vector<std::vector<uint32_t>> row_indices(n_rows);
+            utility::ParallelFor(
+                    0, n_rows,
+                    [&](int64_t row) {
+                        const int y = min_y + int(row);
+                        std::vector<int> nodes;
+                        PolygonRowCrossings(info.polygon, y, nodes);
+                        auto &out = row_indices[row];
+                        for (size_t i = 0; i + 1 < nodes.size(); i += 2) {
+                            const int x0 = std::max(nodes[i], 0);
+                            const int x1 =
+                                    std::min(nodes[i + 1], id_width_ - 1);
+                            for (int x = x0; x <= x1; ++x) {
+                                const uint32_t idx = IndexAt(x, y);
+                                if (IsValidIndex(idx) && idx < points_.size()) {
+                                    out.push_back(idx);
+                                }
+                            }
                         }
-                    } else {
-                        double x = (double(y) - b[i]) / m[i];
-                        bool is_corner0 =
-                                (y == info.polygon[i].y &&
-                                 std::abs(x - double(info.polygon[i].x)) < 0.5);
-                        bool is_corner1 =
-                                (y == info.polygon[i + 1].y &&
-                                 std::abs(x - double(info.polygon[i + 1].x)) <
-                                         0.5);
-                        if ((is_corner0 && is_vert_corner[i]) ||
-                            (is_corner1 && is_vert_corner[i + 1])) {
-                            // We hit the corner, don't add, otherwise we will
-                            // get half a segment.
-                        } else {
-                            intersectionsX.insert(int(std::round(x)));
-                        }
-                    }
-                }
-                for (auto x : intersectionsX) {
-                    sortedX.push_back(x);
-                }
-                std::sort(sortedX.begin(), sortedX.end());
-
-                // sortedX contains the horizontal line segment(s). This should
-                // be an even number, otherwise there is a problem. (Probably
-                // a corner got included)
-                if (sortedX.size() % 2 == 1) {
-                    std::stringstream s;
-                    for (size_t i = 0; i < info.polygon.size() - 1; ++i) {
-                        s << "(" << info.polygon[i].x << ", "
-                          << info.polygon[i].y << ") ";
-                    }
-                    utility::LogWarning(
-                            "Internal error: Odd number of points for row "
-                            "segments (should be even).");
-                    utility::LogWarning("Polygon is: {}", s.str());
-                    s.str("");
-                    s << "{ ";
-                    for (size_t i = 0; i < sortedX.size(); ++i) {
-                        s << sortedX[i] << " ";
-                    }
-                    s << "}";
-                    utility::LogWarning("y: {}, sortedX: {}", y, s.str());
-                    // Recover: this is likely to give the wrong result, but
-                    // better than the alternative of crashing.
-                    sortedX.push_back(sortedX.back());
-                }
+                    },
+                    16);
 
-                // "Fill" the pixels on this row
-                for (size_t i = 0; i < sortedX.size(); i += 2) {
-                    int startX = sortedX[i];
-                    int endX = sortedX[i + 1];
-                    for (int x = startX; x <= endX; ++x) {
-                        unsigned int idx = GetIndexForColor(img, x, y);
-                        if (IsValidIndex(idx) && idx < points_.size()) {
-                            raw_indices.insert(idx);
-                        }
-                    }
-                }
-                intersectionsX.clear();
-                sortedX.clear();
+            // A point usually covers several pixels, so dedup the indices.
+            std::vector<uint32_t> raw_indices;
+            for (auto &row : row_indices) {
+                raw_indices.insert(raw_indices.end(), row.begin(), row.end());
             }
+            std::sort(raw_indices.begin(), raw_indices.end());
+            raw_indices.erase(
+                    std::unique(raw_indices.begin(), raw_indices.end()),
+                    raw_indices.end());
+
             // Now add everything that was "filled"
             for (auto idx : raw_indices) {
                 auto &o = lookup_->ObjectForIndex(idx);
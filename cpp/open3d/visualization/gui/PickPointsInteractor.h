@@ -96,6 +96,10 @@ public:
 
 protected:
     void OnPickImageDone(std::shared_ptr<geometry::Image> img);
+    void DecodeIndexBuffer(const geometry::Image& img);
+    /// Index of the point drawn at pixel (x, y) of the pick image, or an
+    /// invalid index outside the image.
+    uint32_t IndexAt(int x, int y) const;
 
     rendering::Material MakeMaterial();
 
@@ -118,6 +122,10 @@ private:
     // to define this (internal) class in the header file.
     SelectionIndexLookup* lookup_ = nullptr;
     std::shared_ptr<geometry::Image> pick_image_;
+    // Point indices decoded from pick_image_, row-major.
+    std::vector<uint32_t> id_buffer_;
+    int id_width_ = 0;
+    int id_height_ = 0;
     bool dirty_ = true;
     struct PickInfo {
         std::vector<gui::Point> polygon;  // or point, if only one item
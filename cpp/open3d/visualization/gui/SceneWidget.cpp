@@ -1181,6 +1181,11 @@ Widget::DrawResult SceneWidget::Tick(const TickEvent& e) {
         SetRenderQuality(Quality::FAST);
         impl_->last_fast_time_ = Application::GetInstance().Now();
     }
+    // Keep redrawing while large geometry is still streaming in.
+    if (impl_->scene_->GetScene()->HasPendingStreaming()) {
+        ForceRedraw();
+        result = Widget::DrawResult::REDRAW;
+    }
     if (impl_->buttons_down_ == 0 && GetRenderQuality() == Quality::FAST) {
         double now = Application::GetInstance().Now();
         if (now - impl_->last_fast_time_ > DELAY_FOR_BEST_RENDERING_SECS) {
@@ -27,6 +27,7 @@
 #include "open3d/visualization/gui/TreeView.h"
 
 #include <imgui.h>
+#include <imgui_internal.h>  // for TreeNodeBehaviorIsOpen()
 
 #include <cmath>
 #include <list>
@@ -231,6 +232,9 @@ struct TreeView::Impl {
         std::shared_ptr<Widget> cell;
         Item *parent = nullptr;
         std::list<Item> children;
+        // Height of the row, including item spacing, when it was last
+        // drawn; used to skip the row while it is scrolled out of view.
+        float row_height = -1.0f;
     };
     int id_;
     Item root_;
@@ -410,6 +414,38 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
     std::function<void(Impl::Item &)> DrawItem;
     DrawItem = [&DrawItem, this, &frame, &context, &new_selection,
                 &result](Impl::Item &item) {
+        int flags = ImGuiTreeNodeFlags_DefaultOpen |
+                    ImGuiTreeNodeFlags_AllowItemOverlap;
+        if (impl_->can_select_parents_) {
+            flags |= ImGuiTreeNodeFlags_OpenOnDoubleClick;
+            flags |= ImGuiTreeNodeFlags_OpenOnArrow;
+        }
+        if (item.children.empty()) {
+            flags |= ImGuiTreeNodeFlags_Leaf;
+        }
+
+        // Rows scrolled out of view only need to take up their space, so
+        // that large trees do not lay out and draw every cell each frame.
+        // Their children are still visited if the row is open, since
+        // some of them may be visible.
+        const float spacing = ImGui::GetStyle().ItemSpacing.y;
+        if (item.row_height > 0.0f &&
+            !ImGui::IsRectVisible(
+                    ImVec2(float(frame.width), item.row_height))) {
+            ImGui::Dummy(ImVec2(0.0f, item.row_height - spacing));
+            auto id = ImGui::GetID(item.id_string.c_str());
+            if (!item.children.empty() &&
+                ImGui::TreeNodeBehaviorIsOpen(id, flags)) {
+                ImGui::TreePush(item.id_string.c_str());
+                for (auto &child : item.children) {
+                    DrawItem(child);
+                }
+                ImGui::TreePop();
+            }
+            return;
+        }
+        const float row_y = ImGui::GetCursorPosY();
+
         int height = item.cell
                              ->CalcPreferredSize({context.theme, context.fonts},
                                                  Constraints())
@@ -429,15 +465,6 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
                     colorToImguiRGBA(context.theme.tree_selected_color));
         }
 
-        int flags = ImGuiTreeNodeFlags_DefaultOpen |
-                    ImGuiTreeNodeFlags_AllowItemOverlap;
-        if (impl_->can_select_parents_) {
-            flags |= ImGuiTreeNodeFlags_OpenOnDoubleClick;
-            flags |= ImGuiTreeNodeFlags_OpenOnArrow;
-        }
-        if (item.children.empty()) {
-            flags |= ImGuiTreeNodeFlags_Leaf;
-        }
         bool is_selectable =
                 (item.children.empty() || impl_->can_select_parents_);
         auto DrawThis = [this, &tree_frame = frame, &context, &new_selection,
@@ -471,6 +498,7 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
 
         if (ImGui::TreeNodeEx(item.id_string.c_str(), flags, "%s", "")) {
             DrawThis(item, height, is_selectable);
+            item.row_height = ImGui::GetCursorPosY() - row_y;
 
             for (auto &child : item.children) {
                 DrawItem(child);
@@ -478,6 +506,7 @@ Widget::DrawResult TreeView::Draw(const DrawContext &context) {
             ImGui::TreePop();
         } else {
             DrawThis(item, height, is_selectable);
+            item.row_height = ImGui::GetCursorPosY() - row_y;
         }
     };
     for (auto &top : impl_->root_.children) {
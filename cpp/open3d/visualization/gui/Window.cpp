@@ -230,6 +230,7 @@ struct Window::Impl {
     WindowSystem::OSWindow window_ = nullptr;
     std::string title_;  // there is no glfwGetWindowTitle()...
     bool draw_menu_ = true;
+    bool show_render_stats_ = false;
     std::unordered_map<Menu::ItemId, std::function<void()>> menu_callbacks_;
     std::function<bool(void)> on_tick_event_;
     std::function<bool(void)> on_close_;
@@ -704,6 +705,13 @@ void Window::ShowMessageBox(const char* title, const char* message) {
 
 void Window::ShowMenu(bool show) { impl_->draw_menu_ = show; }
 
+void Window::SetShowRenderStats(bool show) {
+    impl_->show_render_stats_ = show;
+    PostRedraw();
+}
+
+bool Window::GetShowRenderStats() const { return impl_->show_render_stats_; }
+
 LayoutContext Window::GetLayoutContext() { return {GetTheme(), impl_->imgui_}; }
 
 void Window::Layout(const LayoutContext& context) {
@@ -785,6 +793,34 @@ Widget::DrawResult DrawChild(DrawContext& dc,
 
     return result;
 }
+
+void DrawRenderStats(const visualization::rendering::RenderStats& stats,
+                     const Rect& content_rect,
+                     float margin) {
+    ImGuiWindowFlags flags =
+            ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+            ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoSavedSettings |
+            ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
+    ImGui::SetNextWindowPos(
+            ImVec2(float(content_rect.GetRight()) - margin,
+                   float(content_rect.y) + margin),
+            ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowBgAlpha(0.5f);
+    ImGui::Begin("##render_stats", nullptr, flags);
+    ImGui::Text("%.1f fps (%.2f ms)", stats.fps, stats.frame_interval_ms);
+    ImGui::Text("frame  %6.2f ms", stats.frame_ms);
+    ImGui::Text("draw   %6.2f ms", stats.draw_ms);
+    ImGui::Text("update %6.2f ms", stats.update_geometry_ms);
+    ImGui::Separator();
+    ImGui::Text("views      %zu", stats.num_views);
+    ImGui::Text("draw calls %zu", stats.num_draw_calls);
+    ImGui::Text("points     %zu", stats.num_points);
+    ImGui::Text("lines      %zu", stats.num_lines);
+    ImGui::Text("triangles  %zu", stats.num_triangles);
+    ImGui::Text("buffers    %.1f MB",
+                double(stats.buffer_bytes) / (1024.0 * 1024.0));
+    ImGui::End();
+}
 }  // namespace
 
 Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
@@ -923,6 +959,12 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
         ImGui::PopStyleVar(2);
     }
 
+    if (impl_->show_render_stats_) {
+        // The renderer draws after ImGui, so these are the last frame's.
+        DrawRenderStats(impl_->renderer_->GetRenderStats(), GetContentRect(),
+                        float(theme.default_margin));
+    }
+
     // Finish frame and generate the commands
     ImGui::PopFont();
     ImGui::EndFrame();
@@ -169,6 +169,13 @@ public:
     // be useful in other circumstances.
     void ShowMenu(bool show);
 
+    /// Shows or hides an overlay in the top-right corner with the frame rate,
+    /// frame timings and primitive counts of the renderer (see
+    /// rendering::Renderer::GetRenderStats()). The overlay does not cause
+    /// redraws by itself; it is updated whenever the window draws.
+    void SetShowRenderStats(bool show);
+    bool GetShowRenderStats() const;
+
     int GetMouseMods() const;  // internal, for WindowSystem
 
 protected:
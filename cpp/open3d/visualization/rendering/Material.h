@@ -63,6 +63,14 @@ struct Material {
     float point_size = 3.f;
     float line_width = 1.f;  // only used with shader = "unlitLine"
 
+    // Point splats (shader = "pointSplat"). Splats are point_size to
+    // max_point_size pixels wide, depending on the distance to the camera.
+    // A splat_radius of 0 estimates the world-space radius from the point
+    // spacing of each renderable (each chunk, for chunked point clouds).
+    float splat_radius = 0.f;
+    float max_point_size = 64.f;
+    float splat_shading = 1.f;  // 0: flat discs; 1: shaded as hemispheres
+
     std::shared_ptr<geometry::Image> albedo_img;
     std::shared_ptr<geometry::Image> normal_img;
     std::shared_ptr<geometry::Image> ao_img;
@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/OcclusionBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+constexpr float kEmptyDepth = std::numeric_limits<float>::infinity();
+constexpr float kMinW = 1e-6f;
+
+float EdgeFunction(const Eigen::Vector3f& a,
+                   const Eigen::Vector3f& b,
+                   float x,
+                   float y) {
+    return (b.x() - a.x()) * (y - a.y()) - (b.y() - a.y()) * (x - a.x());
+}
+
+}  // namespace
+
+void OcclusionBuffer::Reset(int width,
+                            int height,
+                            const Eigen::Matrix4f& world_to_clip) {
+    width_ = std::max(width, 1);
+    height_ = std::max(height, 1);
+    world_to_clip_ = world_to_clip;
+    levels_.resize(1);
+    level_sizes_.assign(1, Eigen::Vector2i(width_, height_));
+    levels_[0].assign(size_t(width_) * size_t(height_), kEmptyDepth);
+}
+
+bool OcclusionBuffer::Project(const Eigen::Matrix4f& model_to_clip,
+                              const Eigen::Vector3f& p,
+                              Eigen::Vector3f& screen) const {
+    const Eigen::Vector4f clip = model_to_clip * p.homogeneous();
+    if (clip.w() < kMinW || clip.z() < -clip.w()) {
+        return false;
+    }
+    screen.x() = (clip.x() / clip.w() * 0.5f + 0.5f) * float(width_);
+    screen.y() = (clip.y() / clip.w() * 0.5f + 0.5f) * float(height_);
+    screen.z() = clip.z() / clip.w();
+    return true;
+}
+
+void OcclusionBuffer::AddOccluder(const std::vector<Eigen::Vector3f>& vertices,
+                                  const std::vector<Eigen::Vector3i>& triangles,
+                                  const Eigen::Matrix4f& model) {
+    if (levels_.empty()) {
+        return;
+    }
+    const Eigen::Matrix4f model_to_clip = world_to_clip_ * model;
+    std::vector<Eigen::Vector3f> screen(vertices.size());
+    std::vector<char> in_front(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        in_front[i] = Project(model_to_clip, vertices[i], screen[i]);
+    }
+
+    auto& depth = levels_[0];
+    for (const auto& t : triangles) {
+        if (t.minCoeff() < 0 || size_t(t.maxCoeff()) >= vertices.size() ||
+            !in_front[t(0)] || !in_front[t(1)] || !in_front[t(2)]) {
+            continue;
+        }
+        const auto& a = screen[t(0)];
+        const auto& b = screen[t(1)];
+        const auto& c = screen[t(2)];
+        const float area = EdgeFunction(a, b, c.x(), c.y());
+        if (area == 0.f) {
+            continue;
+        }
+        const int x0 = std::max(
+                int(std::floor(std::min({a.x(), b.x(), c.x()}))), 0);
+        const int x1 = std::min(
+                int(std::ceil(std::max({a.x(), b.x(), c.x()}))), width_ - 1);
+        const int y0 = std::max(
+                int(std::floor(std::min({a.y(), b.y(), c.y()}))), 0);
+        const int y1 = std::min(
+                int(std::ceil(std::max({a.y(), b.y(), c.y()}))), height_ - 1);
+        // The farthest depth of the triangle keeps the test conservative
+        const float z = std::max({a.z(), b.z(), c.z()});
+        for (int y = y0; y <= y1; ++y) {
+            const float py = float(y) + 0.5f;
+            for (int x = x0; x <= x1; ++x) {
+                const float px = float(x) + 0.5f;
+                float w0 = EdgeFunction(b, c, px, py);
+                float w1 = EdgeFunction(c, a, px, py);
+                float w2 = EdgeFunction(a, b, px, py);
+                if (area < 0.f) {
+                    w0 = -w0;
+                    w1 = -w1;
+                    w2 = -w2;
+                }
+                if (w0 >= 0.f && w1 >= 0.f && w2 >= 0.f) {
+                    float& d = depth[size_t(y) * width_ + x];
+                    d = std::min(d, z);
+                }
+            }
+        }
+    }
+}
+
+void OcclusionBuffer::BuildHierarchy() {
+    if (levels_.empty()) {
+        return;
+    }
+    levels_.resize(1);
+    level_sizes_.resize(1);
+    while (level_sizes_.back().x() > 1 || level_sizes_.back().y() > 1) {
+        const Eigen::Vector2i src_size = level_sizes_.back();
+        const Eigen::Vector2i size((src_size.x() + 1) / 2,
+                                   (src_size.y() + 1) / 2);
+        std::vector<float> level(size_t(size.x()) * size_t(size.y()));
+        const auto& src = levels_.back();
+        for (int y = 0; y < size.y(); ++y) {
+            const int sy0 = 2 * y;
+            const int sy1 = std::min(2 * y + 1, src_size.y() - 1);
+            for (int x = 0; x < size.x(); ++x) {
+                const int sx0 = 2 * x;
+                const int sx1 = std::min(2 * x + 1, src_size.x() - 1);
+                level[size_t(y) * size.x() + x] =
+                        std::max({src[size_t(sy0) * src_size.x() + sx0],
+                                  src[size_t(sy0) * src_size.x() + sx1],
+                                  src[size_t(sy1) * src_size.x() + sx0],
+                                  src[size_t(sy1) * src_size.x() + sx1]});
+            }
+        }
+        levels_.push_back(std::move(level));
+        level_sizes_.push_back(size);
+    }
+}
+
+bool OcclusionBuffer::IsOccluded(const Eigen::Vector3f& min_bound,
+                                 const Eigen::Vector3f& max_bound,
+                                 const Eigen::Matrix4f& model) const {
+    if (levels_.empty()) {
+        return false;
+    }
+    const Eigen::Matrix4f model_to_clip = world_to_clip_ * model;
+    Eigen::Vector3f lo = Eigen::Vector3f::Constant(
+            std::numeric_limits<float>::max());
+    Eigen::Vector3f hi = -lo;
+    for (int i = 0; i < 8; ++i) {
+        const Eigen::Vector3f corner((i & 1) ? max_bound.x() : min_bound.x(),
+                                     (i & 2) ? max_bound.y() : min_bound.y(),
+                                     (i & 4) ? max_bound.z() : min_bound.z());
+        Eigen::Vector3f screen;
+        if (!Project(model_to_clip, corner, screen)) {
+            return false;
+        }
+        lo = lo.cwiseMin(screen);
+        hi = hi.cwiseMax(screen);
+    }
+    if (hi.x() < 0.f || hi.y() < 0.f || lo.x() > float(width_) ||
+        lo.y() > float(height_)) {
+        return false;
+    }
+
+    int x0 = std::max(int(std::floor(lo.x())), 0);
+    int x1 = std::min(int(std::floor(hi.x())), width_ - 1);
+    int y0 = std::max(int(std::floor(lo.y())), 0);
+    int y1 = std::min(int(std::floor(hi.y())), height_ - 1);
+    // Use the finest level at which the box covers at most 2x2 texels
+    size_t level = 0;
+    while (level + 1 < levels_.size() && (x1 - x0 > 1 || y1 - y0 > 1)) {
+        x0 /= 2;
+        x1 /= 2;
+        y0 /= 2;
+        y1 /= 2;
+        ++level;
+    }
+    const auto& depth = levels_[level];
+    const int stride = level_sizes_[level].x();
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            if (depth[size_t(y) * stride + x] >= lo.z()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
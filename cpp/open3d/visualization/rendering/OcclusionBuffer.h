@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Geometry>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// A low-resolution depth buffer for occlusion culling on the CPU.
+/// Occluders are rasterized with the depth of the farthest vertex of each
+/// triangle, and bounding boxes are tested against a hierarchy of maximum
+/// depths, so a box is only reported as occluded if it is entirely hidden.
+/// Depths are normalized device z coordinates.
+class OcclusionBuffer {
+public:
+    /// Clears the buffer, sets its resolution, and sets the world to clip
+    /// space transform (projection * view) for the following calls.
+    void Reset(int width, int height, const Eigen::Matrix4f& world_to_clip);
+
+    /// Rasterizes \p triangles after transforming \p vertices by \p model.
+    /// Triangles that cross the near plane are skipped.
+    void AddOccluder(const std::vector<Eigen::Vector3f>& vertices,
+                     const std::vector<Eigen::Vector3i>& triangles,
+                     const Eigen::Matrix4f& model);
+
+    /// Builds the depth hierarchy. Call after adding all occluders.
+    void BuildHierarchy();
+
+    /// Returns true if the box with bounds \p min_bound and \p max_bound,
+    /// transformed by \p model, is hidden behind the occluders. Boxes that
+    /// cross the near plane or lie outside the buffer are never occluded.
+    bool IsOccluded(const Eigen::Vector3f& min_bound,
+                    const Eigen::Vector3f& max_bound,
+                    const Eigen::Matrix4f& model) const;
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+private:
+    // Returns false if the point is behind the near plane
+    bool Project(const Eigen::Matrix4f& model_to_clip,
+                 const Eigen::Vector3f& p,
+                 Eigen::Vector3f& screen) const;
+
+    int width_ = 0;
+    int height_ = 0;
+    Eigen::Matrix4f world_to_clip_ = Eigen::Matrix4f::Identity();
+    // levels_[0] holds the depth of each pixel; each following level holds
+    // the maximum of 2x2 texels of the previous one.
+    std::vector<std::vector<float>> levels_;
+    std::vector<Eigen::Vector2i> level_sizes_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -31,6 +31,8 @@
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
 #include "open3d/visualization/gui/Application.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Scene.h"
@@ -295,29 +297,53 @@ void Open3DScene::AddGeometry(
 
     auto scene = renderer_.GetScene(scene_);
     if (scene->AddGeometry(name, *geom, mat, fast_name, downsample_threshold)) {
-        auto bbox = scene->GetGeometryBoundingBox(name);
-        bounds_ += bbox;
-        GeometryData info(name, "");
-        // If the downsampled object got created, add it. It may not have been
-        // created if downsampling wasn't enabled or if the object does not meet
-        // the threshold.
-        if (add_downsampled_copy_for_fast_rendering &&
-            scene->HasGeometry(fast_name)) {
-            info.fast_name = fast_name;
+        AddedTGeometry(name, fast_name);
+    }
+}
 
-            auto lowq_name = name + kLowQualityModelObjectSuffix;
-            auto bbox_geom =
-                    geometry::LineSet::CreateFromAxisAlignedBoundingBox(bbox);
-            Material bbox_mat;
-            bbox_mat.base_color = {1.0f, 0.5f, 0.0f, 1.0f};  // orange
-            bbox_mat.shader = "unlitSolidColor";
-            scene->AddGeometry(lowq_name, *bbox_geom, bbox_mat);
-            info.low_name = lowq_name;
-        }
-        geometries_[name] = info;
-        SetGeometryToLOD(info, lod_);
+void Open3DScene::AddPreparedGeometry(
+        const std::string& name,
+        const Scene::GeometryPreparation& prepared,
+        const Material& mat,
+        bool add_downsampled_copy_for_fast_rendering /*= true*/) {
+    size_t downsample_threshold = SIZE_MAX;
+    std::string fast_name;
+    if (add_downsampled_copy_for_fast_rendering) {
+        fast_name = name + "." + kFastModelObjectSuffix;
+        downsample_threshold = downsample_threshold_;
     }
 
+    auto scene = renderer_.GetScene(scene_);
+    if (scene->AddPreparedGeometry(name, prepared, mat, fast_name,
+                                   downsample_threshold)) {
+        AddedTGeometry(name, fast_name);
+    }
+}
+
+void Open3DScene::AddedTGeometry(const std::string& name,
+                                 const std::string& fast_name) {
+    auto scene = renderer_.GetScene(scene_);
+    auto bbox = scene->GetGeometryBoundingBox(name);
+    bounds_ += bbox;
+    GeometryData info(name, "");
+    // If the downsampled object got created, add it. It may not have been
+    // created if downsampling wasn't enabled or if the object does not meet
+    // the threshold.
+    if (!fast_name.empty() && scene->HasGeometry(fast_name)) {
+        info.fast_name = fast_name;
+
+        auto lowq_name = name + kLowQualityModelObjectSuffix;
+        auto bbox_geom =
+                geometry::LineSet::CreateFromAxisAlignedBoundingBox(bbox);
+        Material bbox_mat;
+        bbox_mat.base_color = {1.0f, 0.5f, 0.0f, 1.0f};  // orange
+        bbox_mat.shader = "unlitSolidColor";
+        scene->AddGeometry(lowq_name, *bbox_geom, bbox_mat);
+        info.low_name = lowq_name;
+    }
+    geometries_[name] = info;
+    SetGeometryToLOD(info, lod_);
+
     // Axes may need to be recreated
     axis_dirty_ = true;
 }
@@ -355,6 +381,46 @@ void Open3DScene::ModifyGeometryMaterial(const std::string& name,
     }
 }
 
+void Open3DScene::UpdateMeshBlocks(
+        const std::string& name,
+        const std::vector<Eigen::Vector3i>& updated_blocks,
+        const std::vector<t::geometry::TriangleMesh>& updated_meshes,
+        const std::vector<Eigen::Vector3i>& removed_blocks,
+        const Material& mat) {
+    if (updated_blocks.size() != updated_meshes.size()) {
+        utility::LogError(
+                "Expected one mesh per updated block, but got {} blocks and "
+                "{} meshes.",
+                updated_blocks.size(), updated_meshes.size());
+    }
+    auto BlockName = [&name](const Eigen::Vector3i& block) {
+        return fmt::format("{}/{}_{}_{}", name, block.x(), block.y(),
+                           block.z());
+    };
+
+    auto scene = renderer_.GetScene(scene_);
+    for (const auto& block : removed_blocks) {
+        RemoveGeometry(BlockName(block));
+    }
+    for (size_t i = 0; i < updated_blocks.size(); ++i) {
+        const std::string block_name = BlockName(updated_blocks[i]);
+        const auto mesh = updated_meshes[i].ToLegacyTriangleMesh();
+        if (mesh.IsEmpty()) {
+            RemoveGeometry(block_name);
+        } else if (scene->HasGeometry(block_name)) {
+            scene->UpdateGeometry(block_name, mesh,
+                                  Scene::kUpdatePointsFlag |
+                                          Scene::kUpdateNormalsFlag |
+                                          Scene::kUpdateColorsFlag |
+                                          Scene::kUpdateTrianglesFlag);
+            bounds_ += scene->GetGeometryBoundingBox(block_name);
+            axis_dirty_ = true;
+        } else {
+            AddGeometry(block_name, &mesh, mat, false);
+        }
+    }
+}
+
 void Open3DScene::ShowGeometry(const std::string& name, bool show) {
     auto it = geometries_.find(name);
     if (it != geometries_.end()) {
@@ -44,7 +44,8 @@ class Image;
 namespace t {
 namespace geometry {
 class PointCloud;
-}
+class TriangleMesh;
+}  // namespace geometry
 }  // namespace t
 
 namespace visualization {
@@ -104,8 +105,25 @@ public:
                      const t::geometry::PointCloud* geom,
                      const Material& mat,
                      bool add_downsampled_copy_for_fast_rendering = true);
+    /// Adds a point cloud prepared with Scene::PrepareGeometry(), whose
+    /// preparation may have run on a worker thread.
+    void AddPreparedGeometry(
+            const std::string& name,
+            const Scene::GeometryPreparation& prepared,
+            const Material& mat,
+            bool add_downsampled_copy_for_fast_rendering = true);
     bool HasGeometry(const std::string& name) const;
     void RemoveGeometry(const std::string& name);
+    /// Streams a mesh made of blocks, e.g. the changes returned by
+    /// t::geometry::TSDFVoxelGrid::ExtractSurfaceMeshUpdate(). Each block is
+    /// a geometry named "<name>/<x>_<y>_<z>" that is updated in place, so
+    /// only the meshes of changed blocks are uploaded.
+    void UpdateMeshBlocks(
+            const std::string& name,
+            const std::vector<Eigen::Vector3i>& updated_blocks,
+            const std::vector<t::geometry::TriangleMesh>& updated_meshes,
+            const std::vector<Eigen::Vector3i>& removed_blocks,
+            const Material& mat);
     /// Shows or hides the geometry with the specified name.
     void ShowGeometry(const std::string& name, bool show);
     void ModifyGeometryMaterial(const std::string& name, const Material& mat);
@@ -144,6 +162,8 @@ private:
     };
 
     void SetGeometryToLOD(const GeometryData&, LOD lod);
+    // Bookkeeping after a tensor point cloud was added to the scene
+    void AddedTGeometry(const std::string& name, const std::string& fast_name);
 
 private:
     Renderer& renderer_;
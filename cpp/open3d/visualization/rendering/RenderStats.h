@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// Statistics about the most recent frame of a Renderer, see
+/// Renderer::GetRenderStats(). Times are CPU wall-clock times in
+/// milliseconds. GPU times are not included: the Filament version used does
+/// not expose its timer queries.
+struct RenderStats {
+    struct Geometry {
+        std::string name;
+        bool visible = true;
+        /// Hidden by occlusion culling (see Scene::SetOcclusionCulling())
+        bool occluded = false;
+        size_t num_vertices = 0;
+        /// Points, lines or triangles, depending on the geometry
+        size_t num_primitives = 0;
+        /// Estimated size of the geometry's vertex and index buffers
+        size_t buffer_bytes = 0;
+    };
+
+    size_t frame_count = 0;
+    /// Time from BeginFrame() to EndFrame()
+    double frame_ms = 0.0;
+    /// Time in Draw(), which records the rendering commands of all scenes
+    double draw_ms = 0.0;
+    /// Time between the starts of the last two frames
+    double frame_interval_ms = 0.0;
+    /// Frames per second, smoothed over recent frames
+    double fps = 0.0;
+    /// Time spent adding and updating geometry since the previous frame
+    double update_geometry_ms = 0.0;
+
+    /// Counts for the last frame, summed over all rendered views. Draw calls
+    /// are visible renderables per view before frustum culling, so they are
+    /// an upper bound.
+    size_t num_views = 0;
+    size_t num_draw_calls = 0;
+    size_t num_points = 0;
+    size_t num_lines = 0;
+    size_t num_triangles = 0;
+
+    /// All geometries of all scenes, and their total buffer size
+    std::vector<Geometry> geometries;
+    size_t buffer_bytes = 0;
+
+    /// Estimated GPU memory held by all vertex and index buffers and
+    /// textures of the renderer, and the budget set with
+    /// Renderer::SetMemoryBudget() (0 if unlimited)
+    size_t resident_buffer_bytes = 0;
+    size_t resident_texture_bytes = 0;
+    size_t memory_budget = 0;
+    /// Hidden geometries whose buffers were released to stay within the
+    /// memory budget. They are uploaded again when shown.
+    std::vector<std::string> evicted_geometries;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
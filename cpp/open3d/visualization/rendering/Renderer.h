@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/visualization/rendering/MaterialModifier.h"
+#include "open3d/visualization/rendering/RenderStats.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 
 namespace open3d {
@@ -90,6 +91,23 @@ public:
 
     virtual void SetOnAfterDraw(std::function<void()> callback) = 0;
 
+    /// Returns timings and counts of the most recently drawn frame.
+    virtual RenderStats GetRenderStats() const = 0;
+
+    /// Limits the estimated GPU memory of geometry buffers and textures.
+    /// While over the budget, scenes release the buffers of hidden
+    /// geometries, least recently hidden first, and upload them again when
+    /// they are shown. 0 (the default) means unlimited.
+    virtual void SetMemoryBudget(size_t bytes) = 0;
+    virtual size_t GetMemoryBudget() const = 0;
+    /// Textures loaded from larger images are uploaded without their
+    /// largest mip levels. 0 (the default) means unlimited.
+    virtual void SetMaxTextureSize(int size) = 0;
+    /// Textures loaded from 8-bit RGB and RGBA images afterwards are block
+    /// compressed (BC1 and BC3) if the GPU supports it, which uses 1/6 and
+    /// 1/4 of the memory. Off by default.
+    virtual void SetTextureCompression(bool enable) = 0;
+
     virtual MaterialHandle AddMaterial(const ResourceLoadRequest& request) = 0;
     virtual MaterialInstanceHandle AddMaterialInstance(
             const MaterialHandle& material) = 0;
@@ -34,10 +34,15 @@
 #include "open3d/visualization/rendering/RendererHandle.h"
 
 namespace open3d {
+namespace core {
+class Tensor;
+}  // namespace core
+
 namespace geometry {
 class Geometry3D;
 class AxisAlignedBoundingBox;
 class Image;
+class TriangleMesh;
 }  // namespace geometry
 
 namespace t {
@@ -63,9 +68,20 @@ public:
     static const uint32_t kUpdateNormalsFlag = (1 << 1);
     static const uint32_t kUpdateColorsFlag = (1 << 2);
     static const uint32_t kUpdateUv0Flag = (1 << 3);
+    static const uint32_t kUpdateTrianglesFlag = (1 << 4);
 
     using Transform = Eigen::Transform<float, 3, Eigen::Affine>;
 
+    /// The CPU-side part of adding a geometry (e.g. splitting a large point
+    /// cloud into chunks), separated so that it can run on a worker thread.
+    class GeometryPreparation {
+    public:
+        virtual ~GeometryPreparation() = default;
+        /// Does the work. Does not access the scene, so it may be called
+        /// from any thread, even after the scene has been destroyed.
+        virtual void Run() = 0;
+    };
+
     Scene(Renderer& renderer) : renderer_(renderer) {}
     virtual ~Scene() = default;
 
@@ -105,9 +121,21 @@ public:
     virtual void UpdateGeometry(const std::string& object_name,
                                 const t::geometry::PointCloud& point_cloud,
                                 uint32_t update_flags) = 0;
+    /// Updates a triangle mesh without triangle UVs in place, keeping its
+    /// material. The vertex attributes are interleaved, so any of
+    /// kUpdatePointsFlag, kUpdateNormalsFlag and kUpdateColorsFlag uploads
+    /// all of them. kUpdateTrianglesFlag uploads the triangles and is
+    /// required if the number of vertices grows. Buffers that become too
+    /// small are reallocated with spare capacity.
+    virtual void UpdateGeometry(const std::string& object_name,
+                                const geometry::TriangleMesh& mesh,
+                                uint32_t update_flags) = 0;
     virtual void RemoveGeometry(const std::string& object_name) = 0;
     virtual void ShowGeometry(const std::string& object_name, bool show) = 0;
     virtual bool GeometryIsVisible(const std::string& object_name) = 0;
+    /// Returns false if the geometry's buffers have been released to stay
+    /// within the renderer's memory budget (see Renderer::SetMemoryBudget())
+    virtual bool GeometryIsResident(const std::string& object_name) const = 0;
     virtual void OverrideMaterial(const std::string& object_name,
                                   const Material& material) = 0;
     virtual void GeometryShadows(const std::string& object_name,
@@ -115,6 +143,12 @@ public:
                                  bool receive_shadows) = 0;
     virtual void SetGeometryCulling(const std::string& object_name,
                                     bool enable) = 0;
+    /// Hides geometries that are behind other geometries of the scene in all
+    /// active views. Triangle meshes with few triangles added while enabled
+    /// act as occluders. Updates of hidden geometries are deferred until
+    /// they become visible again. Geometries with culling disabled (see
+    /// SetGeometryCulling()) are always drawn.
+    virtual void SetOcclusionCulling(bool enable) = 0;
     virtual void SetGeometryPriority(const std::string& object_name,
                                      uint8_t priority) = 0;
     virtual void QueryGeometry(std::vector<std::string>& geometry) = 0;
@@ -125,6 +159,41 @@ public:
             const std::string& object_name) = 0;
     virtual void OverrideMaterialAll(const Material& material,
                                      bool shader_only = true) = 0;
+    /// Returns true while geometry is still being streamed to the GPU, in
+    /// which case the scene should keep being redrawn.
+    virtual bool HasPendingStreaming() const = 0;
+    /// Returns the preparation of \p point_cloud for AddPreparedGeometry().
+    /// Call on the render thread; the returned object's Run() may then be
+    /// called on any thread. \p point_cloud may still be filled in before
+    /// Run(), but must not be modified from then until AddPreparedGeometry()
+    /// returns.
+    virtual std::shared_ptr<GeometryPreparation> PrepareGeometry(
+            std::shared_ptr<const t::geometry::PointCloud> point_cloud) = 0;
+    /// Adds a geometry whose preparation has finished Run(). Otherwise
+    /// equivalent to AddGeometry().
+    virtual bool AddPreparedGeometry(
+            const std::string& object_name,
+            const GeometryPreparation& prepared,
+            const Material& material,
+            const std::string& downsampled_name = "",
+            size_t downsample_threshold = SIZE_MAX) = 0;
+    /// Adds one instance of \p geometry per row of \p transforms, an
+    /// (N, 4, 4) tensor of model matrices. \p colors is either empty or an
+    /// (N, 3) tensor of per-instance base colors. The geometry is uploaded
+    /// once and shared by all instances, which is much cheaper than adding
+    /// N geometries for e.g. detection boxes. Per-object calls such as
+    /// ShowGeometry() and RemoveGeometry() apply to all instances;
+    /// SetGeometryTransform() would replace all instance transforms, use
+    /// UpdateInstanceTransforms() instead.
+    virtual bool AddInstancedGeometry(const std::string& object_name,
+                                      const geometry::Geometry3D& geometry,
+                                      const Material& material,
+                                      const core::Tensor& transforms,
+                                      const core::Tensor& colors) = 0;
+    /// Replaces the transforms of an instanced geometry. \p transforms must
+    /// have as many rows as the geometry has instances.
+    virtual void UpdateInstanceTransforms(const std::string& object_name,
+                                          const core::Tensor& transforms) = 0;
 
     // Lighting Environment
     virtual bool AddPointLight(const std::string& light_name,
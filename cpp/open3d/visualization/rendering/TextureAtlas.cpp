@@ -0,0 +1,274 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/TextureAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/visualization/rendering/Model.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+// Texels of padding around each packed texture, so that filtering and the
+// smaller mip levels do not sample neighboring textures
+constexpr int kPadding = 2;
+
+bool IsPackable(const Material& material, int max_size) {
+    const auto& img = material.albedo_img;
+    return img && img->HasData() && img->bytes_per_channel_ == 1 &&
+           (img->num_of_channels_ == 3 || img->num_of_channels_ == 4) &&
+           img->width_ <= max_size && img->height_ <= max_size &&
+           !material.normal_img && !material.ao_img &&
+           !material.metallic_img && !material.roughness_img &&
+           !material.reflectance_img && !material.clearcoat_img &&
+           !material.clearcoat_roughness_img && !material.anisotropy_img &&
+           !material.ao_rough_metal_img && !material.gradient &&
+           material.generic_imgs.empty();
+}
+
+bool HasUnitUvs(const geometry::TriangleMesh& mesh) {
+    if (mesh.triangle_uvs_.size() != 3 * mesh.triangles_.size()) {
+        return false;
+    }
+    for (const auto& uv : mesh.triangle_uvs_) {
+        if (uv.x() < 0.0 || uv.x() > 1.0 || uv.y() < 0.0 || uv.y() > 1.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SameMaterialExceptAlbedo(const Material& a, const Material& b) {
+    return a.shader == b.shader && a.has_alpha == b.has_alpha &&
+           a.base_color == b.base_color &&
+           a.base_metallic == b.base_metallic &&
+           a.base_roughness == b.base_roughness &&
+           a.base_reflectance == b.base_reflectance &&
+           a.base_clearcoat == b.base_clearcoat &&
+           a.base_clearcoat_roughness == b.base_clearcoat_roughness &&
+           a.base_anisotropy == b.base_anisotropy &&
+           a.point_size == b.point_size && a.sRGB_color == b.sRGB_color &&
+           a.sRGB_vertex_color == b.sRGB_vertex_color &&
+           a.generic_params == b.generic_params;
+}
+
+int RoundUpToFour(int value) { return (value + 3) / 4 * 4; }
+
+// Copies src to (x, y) in dst, surrounded by kPadding texels of its edges
+void CopyWithPadding(const geometry::Image& src,
+                     geometry::Image& dst,
+                     int x,
+                     int y) {
+    const int src_channels = src.num_of_channels_;
+    const int dst_channels = dst.num_of_channels_;
+    for (int dy = -kPadding; dy < src.height_ + kPadding; ++dy) {
+        const int sy = std::min(std::max(dy, 0), src.height_ - 1);
+        for (int dx = -kPadding; dx < src.width_ + kPadding; ++dx) {
+            const int sx = std::min(std::max(dx, 0), src.width_ - 1);
+            const std::uint8_t* s = src.PointerAt<std::uint8_t>(sx, sy, 0);
+            std::uint8_t* d = dst.PointerAt<std::uint8_t>(x + dx, y + dy, 0);
+            for (int c = 0; c < dst_channels; ++c) {
+                d[c] = (c < src_channels ? s[c] : 255);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+int PackTextureAtlases(TriangleMeshModel& model,
+                       int max_texture_size,
+                       int atlas_size) {
+    auto& materials = model.materials_;
+    max_texture_size = std::min(max_texture_size, atlas_size - 2 * kPadding);
+
+    std::vector<bool> packable(materials.size(), false);
+    std::vector<bool> used(materials.size(), false);
+    for (size_t i = 0; i < materials.size(); ++i) {
+        packable[i] = IsPackable(materials[i], max_texture_size);
+    }
+    for (const auto& info : model.meshes_) {
+        if (info.material_idx < materials.size()) {
+            used[info.material_idx] = true;
+            if (!info.mesh || !HasUnitUvs(*info.mesh)) {
+                packable[info.material_idx] = false;
+            }
+        }
+    }
+    std::vector<size_t> candidates;
+    double total_area = 0.0;
+    int max_width = 0;
+    for (size_t i = 0; i < materials.size(); ++i) {
+        if (packable[i] && used[i]) {
+            const auto& img = *materials[i].albedo_img;
+            candidates.push_back(i);
+            total_area += double(img.width_ + 2 * kPadding) *
+                          double(img.height_ + 2 * kPadding);
+            max_width = std::max(max_width, img.width_ + 2 * kPadding);
+        }
+    }
+    if (candidates.size() < 2) {
+        return 0;
+    }
+
+    // Shelf packing, tallest textures first
+    std::sort(candidates.begin(), candidates.end(), [&](size_t a, size_t b) {
+        return materials[a].albedo_img->height_ >
+               materials[b].albedo_img->height_;
+    });
+    struct Atlas {
+        int width = 0;
+        int height = 0;
+        bool rgba = false;
+        std::shared_ptr<geometry::Image> image;
+    };
+    struct Placement {
+        size_t atlas = 0;
+        int x = 0;
+        int y = 0;
+    };
+    const int width = std::min(
+            atlas_size,
+            RoundUpToFour(std::max(max_width,
+                                   int(std::ceil(std::sqrt(total_area))))));
+    std::vector<Atlas> atlases(1);
+    atlases[0].width = width;
+    std::vector<Placement> placements(materials.size());
+    int shelf_x = 0;
+    int shelf_y = 0;
+    int shelf_height = 0;
+    for (size_t idx : candidates) {
+        const auto& img = *materials[idx].albedo_img;
+        const int w = img.width_ + 2 * kPadding;
+        const int h = img.height_ + 2 * kPadding;
+        if (shelf_x + w > width) {
+            shelf_x = 0;
+            shelf_y += shelf_height;
+            shelf_height = 0;
+        }
+        if (shelf_y + h > atlas_size) {
+            atlases.emplace_back();
+            atlases.back().width = width;
+            shelf_x = 0;
+            shelf_y = 0;
+            shelf_height = 0;
+        }
+        auto& atlas = atlases.back();
+        placements[idx] = {atlases.size() - 1, shelf_x + kPadding,
+                           shelf_y + kPadding};
+        shelf_x += w;
+        shelf_height = std::max(shelf_height, h);
+        atlas.height = std::max(atlas.height, shelf_y + h);
+        atlas.rgba = atlas.rgba || (img.num_of_channels_ == 4);
+    }
+
+    for (auto& atlas : atlases) {
+        atlas.height = RoundUpToFour(atlas.height);
+        atlas.image = std::make_shared<geometry::Image>();
+        atlas.image->Prepare(atlas.width, atlas.height, atlas.rgba ? 4 : 3,
+                             1);
+    }
+    // Textures are disjoint in their atlas, so they can be copied in parallel
+    utility::ParallelFor(0, int64_t(candidates.size()), [&](int64_t i) {
+        const size_t idx = candidates[i];
+        const auto& p = placements[idx];
+        CopyWithPadding(*materials[idx].albedo_img, *atlases[p.atlas].image,
+                        p.x, p.y);
+    });
+
+    // Materials that only differed by their albedo map become one
+    std::vector<Material> atlas_materials;
+    std::vector<size_t> atlas_of_material;
+    std::vector<int> merged_material(materials.size(), -1);
+    for (size_t idx : candidates) {
+        const size_t atlas = placements[idx].atlas;
+        for (size_t m = 0; m < atlas_materials.size(); ++m) {
+            if (atlas_of_material[m] == atlas &&
+                SameMaterialExceptAlbedo(materials[idx], atlas_materials[m])) {
+                merged_material[idx] = int(m);
+                break;
+            }
+        }
+        if (merged_material[idx] < 0) {
+            merged_material[idx] = int(atlas_materials.size());
+            atlas_materials.push_back(materials[idx]);
+            atlas_materials.back().albedo_img = atlases[atlas].image;
+            atlas_of_material.push_back(atlas);
+        }
+    }
+
+    // Meshes with the same merged material become one mesh
+    std::vector<TriangleMeshModel::MeshInfo> meshes;
+    std::vector<std::shared_ptr<geometry::TriangleMesh>> merged_meshes(
+            atlas_materials.size());
+    for (const auto& info : model.meshes_) {
+        const size_t idx = info.material_idx;
+        if (idx >= materials.size() || merged_material[idx] < 0) {
+            meshes.push_back(info);
+            continue;
+        }
+        const auto& p = placements[idx];
+        const auto& img = *materials[idx].albedo_img;
+        const auto& atlas = atlases[p.atlas];
+        const Eigen::Vector2d offset(double(p.x) / atlas.width,
+                                     double(p.y) / atlas.height);
+        const Eigen::Vector2d scale(double(img.width_) / atlas.width,
+                                    double(img.height_) / atlas.height);
+
+        auto& merged = merged_meshes[merged_material[idx]];
+        if (!merged) {
+            merged = std::make_shared<geometry::TriangleMesh>();
+            meshes.push_back(
+                    {merged, info.mesh_name,
+                     (unsigned int)(materials.size() + merged_material[idx])});
+        }
+        // operator+= drops the UVs of meshes without textures, so they are
+        // appended separately.
+        auto uvs = std::move(merged->triangle_uvs_);
+        *merged += *info.mesh;
+        for (const auto& uv : info.mesh->triangle_uvs_) {
+            uvs.push_back(offset + uv.cwiseProduct(scale));
+        }
+        merged->triangle_uvs_ = std::move(uvs);
+    }
+
+    model.meshes_ = std::move(meshes);
+    materials.insert(materials.end(), atlas_materials.begin(),
+                     atlas_materials.end());
+    return int(candidates.size());
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
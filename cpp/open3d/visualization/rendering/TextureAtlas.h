@@ -0,0 +1,50 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+struct TriangleMeshModel;
+
+/// Packs the albedo textures of the meshes of \p model that are at most
+/// \p max_texture_size pixels wide and high into atlases of at most
+/// \p atlas_size pixels, and remaps the texture coordinates of the meshes.
+/// Meshes that share an atlas and otherwise have the same material are
+/// merged, so that each atlas is uploaded once and drawn with fewer draw
+/// calls. Only materials with an 8-bit albedo map and no other maps are
+/// packed, and only if all their meshes have texture coordinates in [0, 1],
+/// since a texture in an atlas cannot repeat.
+/// \return The number of textures that were packed.
+int PackTextureAtlases(TriangleMeshModel& model,
+                       int max_texture_size = 1024,
+                       int atlas_size = 4096);
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
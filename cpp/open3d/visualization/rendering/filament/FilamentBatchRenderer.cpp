@@ -0,0 +1,471 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/rendering/filament/FilamentBatchRenderer.h"
+
+// 4068: Filament has some clang-specific vectorizing pragma's that MSVC flags
+// 4146: PixelBufferDescriptor assert unsigned is positive before subtracting
+//       but MSVC can't figure that out.
+// 4293: Filament's utils/algorithm.h utils::details::clz() does strange
+//       things with MSVC. Somehow sizeof(unsigned int) > 4, but its size is
+//       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
+//       determine the if statement does not run.)
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4068 4146 4293)
+#endif  // _MSC_VER
+
+#include <filament/Engine.h>
+#include <filament/Renderer.h>
+#include <filament/SwapChain.h>
+#include <filament/View.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // _MSC_VER
+
+#include <algorithm>
+#include <cstring>
+
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/Geometry3D.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/utility/Console.h"
+#include "open3d/visualization/rendering/Open3DScene.h"
+#include "open3d/visualization/rendering/filament/FilamentEngine.h"
+#include "open3d/visualization/rendering/filament/FilamentRenderer.h"
+#include "open3d/visualization/rendering/filament/FilamentScene.h"
+#include "open3d/visualization/rendering/filament/FilamentView.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+const std::string kJobGeometryPrefix = "__batch_job_";
+}  // namespace
+
+struct FilamentBatchRenderer::Readback {
+    FilamentBatchRenderer* owner = nullptr;
+    std::vector<std::uint8_t> buffer;
+    bool in_flight = false;
+    bool depth = false;
+    std::vector<size_t> view_indices;
+    // Near and far clip planes of the tiles whose depth is converted to
+    // view space, or zero
+    std::vector<Eigen::Vector2f> view_space_clip_planes;
+    ImageCallback on_image;
+
+    // Tensor jobs read back into a pinned staging tensor instead of buffer,
+    // which is copied to the device on stream.
+    TensorImageCallback on_tensor_image;
+    core::Device device;
+    core::Tensor staging;
+    core::CUDAStream stream;
+    bool copy_pending = false;
+};
+
+FilamentBatchRenderer::FilamentBatchRenderer(int width,
+                                             int height,
+                                             int views_per_frame,
+                                             int frames_in_flight)
+    : width_(width),
+      height_(height),
+      views_per_frame_(std::max(1, views_per_frame)) {
+    if (width <= 0 || height <= 0) {
+        utility::LogError("Invalid batch render size {}x{}", width, height);
+    }
+
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+    o3d_renderer_ = std::make_unique<FilamentRenderer>(engine, width, height,
+                                                       resource_mgr);
+    scene_ = std::make_unique<Open3DScene>(*o3d_renderer_);
+    auto* filament_scene = dynamic_cast<FilamentScene*>(scene_->GetScene());
+
+    // All views of a frame are tiled horizontally into one swapchain, so
+    // that they can be read back with a single readPixels().
+    renderer_ = engine.createRenderer();
+    swapchain_ = engine.createSwapChain(width_ * views_per_frame_, height_,
+                                        filament::SwapChain::CONFIG_READABLE);
+
+    for (int i = 0; i < views_per_frame_; ++i) {
+        color_views_.emplace_back(
+                std::make_unique<FilamentView>(engine, resource_mgr));
+        depth_views_.emplace_back(
+                std::make_unique<FilamentView>(engine, resource_mgr));
+        // Post-processing discards the depth buffer, see
+        // FilamentRenderToBuffer::CopySettings().
+        depth_views_.back()->ConfigureForColorPicking();
+        if (filament_scene) {
+            color_views_.back()->SetScene(*filament_scene);
+            depth_views_.back()->SetScene(*filament_scene);
+        }
+    }
+
+    for (int i = 0; i < std::max(1, frames_in_flight); ++i) {
+        readbacks_.emplace_back(std::make_unique<Readback>());
+        readbacks_.back()->owner = this;
+    }
+}
+
+FilamentBatchRenderer::~FilamentBatchRenderer() {
+    auto& engine = EngineInstance::GetInstance();
+    // Readback callbacks reference the readback buffers, so they must all
+    // have run before anything is destroyed.
+    if (n_in_flight_ > 0) {
+        engine.flushAndWait();
+    }
+    // So must the copies from the staging tensors.
+    for (auto& readback : readbacks_) {
+        if (readback->copy_pending) {
+            readback->stream.Synchronize();
+        }
+    }
+
+    color_views_.clear();
+    depth_views_.clear();
+    engine.destroy(swapchain_);
+    engine.destroy(renderer_);
+    scene_.reset();
+    o3d_renderer_.reset();
+}
+
+void FilamentBatchRenderer::Enqueue(Job job) {
+    if (job.views.empty() || (!job.on_image == !job.on_tensor_image)) {
+        utility::LogWarning("Batch render job needs views and one callback");
+        return;
+    }
+    queue_.emplace_back(std::move(job));
+}
+
+void FilamentBatchRenderer::Flush() {
+    while (!queue_.empty()) {
+        Job job = std::move(queue_.front());
+        queue_.pop_front();
+        RenderJob(job);
+    }
+
+    // Readbacks only complete once the engine has processed their frames.
+    if (n_in_flight_ > 0) {
+        EngineInstance::GetInstance().flushAndWait();
+    }
+}
+
+void FilamentBatchRenderer::RenderJob(const Job& job) {
+    std::string name;
+    geometry::AxisAlignedBoundingBox bounds;
+    if (job.geometry) {
+        name = kJobGeometryPrefix + std::to_string(next_job_id_++);
+        scene_->AddGeometry(name, job.geometry.get(), job.material, false);
+        if (!scene_->HasGeometry(name)) {
+            std::vector<size_t> indices(job.views.size());
+            for (size_t i = 0; i < indices.size(); ++i) {
+                indices[i] = i;
+            }
+            FailViews(job, indices);
+            return;
+        }
+        bounds = job.geometry->GetAxisAlignedBoundingBox();
+    } else {
+        bounds = scene_->GetBoundingBox();
+    }
+    Eigen::Vector3d center = bounds.GetCenter();
+    double radius = 0.5 * bounds.GetExtent().norm();
+
+    // Color and depth are read back with different pixel formats, so a frame
+    // only contains one kind of view.
+    std::vector<size_t> color_indices, depth_indices;
+    for (size_t i = 0; i < job.views.size(); ++i) {
+        if (job.views[i].depth) {
+            depth_indices.push_back(i);
+        } else {
+            color_indices.push_back(i);
+        }
+    }
+    for (bool depth : {false, true}) {
+        const auto& indices = (depth ? depth_indices : color_indices);
+        for (size_t start = 0; start < indices.size();
+             start += views_per_frame_) {
+            auto end = std::min(indices.size(), start + views_per_frame_);
+            RenderFrame(job, {indices.begin() + start, indices.begin() + end},
+                        depth, center, radius);
+        }
+    }
+
+    // The geometry's buffers are only released once the engine is done with
+    // the frames that still reference them.
+    if (!name.empty()) {
+        scene_->RemoveGeometry(name);
+    }
+}
+
+void FilamentBatchRenderer::RenderFrame(const Job& job,
+                                        const std::vector<size_t>& view_indices,
+                                        bool depth,
+                                        const Eigen::Vector3d& center,
+                                        double radius) {
+    auto& engine = EngineInstance::GetInstance();
+    auto& readback = AcquireReadback();
+
+    bool started = renderer_->beginFrame(swapchain_);
+    if (!started) {
+        // Filament skips frames if the GPU falls behind; let it catch up.
+        engine.flushAndWait();
+        started = renderer_->beginFrame(swapchain_);
+    }
+    if (!started) {
+        utility::LogWarning("Batch renderer could not begin a frame");
+        FailViews(job, view_indices);
+        return;
+    }
+
+    auto& views = (depth ? depth_views_ : color_views_);
+    readback.view_space_clip_planes.assign(view_indices.size(),
+                                           Eigen::Vector2f::Zero());
+    for (size_t tile = 0; tile < view_indices.size(); ++tile) {
+        auto& view = *views[tile];
+        const auto& request = job.views[view_indices[tile]];
+        view.SetViewport(std::int32_t(tile * width_), 0, width_, height_);
+        auto clip_planes = SetupCamera(view, request, center, radius);
+        if (depth && request.depth_in_view_space) {
+            readback.view_space_clip_planes[tile] = clip_planes;
+        }
+        view.PreRender();
+        renderer_->render(view.GetNativeView());
+        view.PostRender();
+    }
+
+    using namespace filament;
+    using namespace backend;
+
+    auto n_tiles = std::uint32_t(view_indices.size());
+    size_t pixel_size = (depth ? sizeof(float) : 3 * sizeof(std::uint8_t));
+    void* pixels = nullptr;
+    size_t pixels_size = n_tiles * width_ * height_ * pixel_size;
+    if (job.on_tensor_image) {
+        core::SizeVector shape{height_, n_tiles * width_, depth ? 1 : 3};
+        core::Dtype dtype = (depth ? core::Dtype::Float32 : core::Dtype::UInt8);
+        if (readback.staging.GetShape() != shape ||
+            readback.staging.GetDtype() != dtype) {
+            readback.staging = core::Tensor::EmptyPinned(shape, dtype);
+        }
+        if (job.device.GetType() == core::Device::DeviceType::CUDA &&
+            readback.stream.GetDevice() != job.device) {
+            readback.stream = core::CUDAStream(job.device);
+        }
+        pixels = readback.staging.GetDataPtr();
+    } else {
+        readback.buffer.resize(pixels_size);
+        pixels = readback.buffer.data();
+    }
+    readback.depth = depth;
+    readback.view_indices = view_indices;
+    readback.on_image = job.on_image;
+    readback.on_tensor_image = job.on_tensor_image;
+    readback.device = job.device;
+    readback.in_flight = true;
+    ++n_in_flight_;
+
+    PixelBufferDescriptor pd(
+            pixels, pixels_size,
+            (depth ? PixelDataFormat::DEPTH_COMPONENT : PixelDataFormat::RGB),
+            (depth ? PixelDataType::FLOAT : PixelDataType::UBYTE),
+            ReadPixelsCallback, &readback);
+    renderer_->readPixels(0, 0, n_tiles * width_, height_, std::move(pd));
+    renderer_->endFrame();
+}
+
+Eigen::Vector2f FilamentBatchRenderer::SetupCamera(
+        FilamentView& view,
+        const ViewRequest& request,
+        const Eigen::Vector3d& center,
+        double radius) {
+    Eigen::Matrix3d R = request.extrinsic.block<3, 3>(0, 0);
+    Eigen::Vector3d t = request.extrinsic.block<3, 1>(0, 3);
+    Eigen::Vector3d eye = -R.transpose() * t;
+    Eigen::Vector3d forward = R.row(2).transpose();
+    Eigen::Vector3d up = -R.row(1).transpose();
+
+    // Fit the clip planes tightly around the geometry to make the most of
+    // the depth buffer's precision.
+    double dist = (center - eye).dot(forward);
+    double far = std::max(dist + radius, 1e-3);
+    double near = std::max(dist - radius, far * 1e-4);
+
+    auto* camera = view.GetCamera();
+    camera->SetProjection(request.intrinsic, near, far, width_, height_);
+    camera->LookAt((eye + forward).cast<float>(), eye.cast<float>(),
+                   up.cast<float>());
+    return {float(near), float(far)};
+}
+
+std::vector<std::shared_ptr<t::geometry::Image>>
+FilamentBatchRenderer::RenderToTensorImages(
+        const std::vector<ViewRequest>& views,
+        const core::Device& device,
+        std::shared_ptr<const geometry::Geometry3D> geometry,
+        const Material& material) {
+    std::vector<std::shared_ptr<t::geometry::Image>> images(views.size());
+    if (views.empty()) {
+        return images;
+    }
+    Job job;
+    job.geometry = geometry;
+    job.material = material;
+    job.views = views;
+    job.device = device;
+    job.on_tensor_image = [&images](size_t view_index,
+                                    std::shared_ptr<t::geometry::Image> image) {
+        images[view_index] = image;
+    };
+    Enqueue(std::move(job));
+    Flush();
+    return images;
+}
+
+void FilamentBatchRenderer::FailViews(const Job& job,
+                                      const std::vector<size_t>& indices) {
+    for (auto idx : indices) {
+        if (job.on_tensor_image) {
+            job.on_tensor_image(idx, nullptr);
+        } else {
+            job.on_image(idx, nullptr);
+        }
+    }
+}
+
+void FilamentBatchRenderer::CopyTensorTiles(Readback& readback) {
+    core::Tensor frame = readback.staging;
+    if (readback.device.GetType() == core::Device::DeviceType::CUDA) {
+        // Blocking streams synchronize with the default stream, so the
+        // operations below wait for the copy.
+        frame = readback.staging.To(readback.device, readback.stream, true);
+        readback.copy_pending = true;
+    }
+
+    // (height, tiles * width, channels) -> (height, tiles, width, channels)
+    const int64_t height = frame.GetShape(0);
+    const int64_t n_tiles = int64_t(readback.view_indices.size());
+    const int64_t width = frame.GetShape(1) / n_tiles;
+    const int64_t channels = frame.GetShape(2);
+    frame = frame.Reshape({height, n_tiles, width, channels});
+    for (int64_t tile = 0; tile < n_tiles; ++tile) {
+        // Clone() also copies the CPU tiles out of the staging tensor.
+        core::Tensor pixels = frame.Slice(1, tile, tile + 1).Clone().Reshape(
+                {height, width, channels});
+        const auto& clip_planes = readback.view_space_clip_planes[tile];
+        if (readback.depth && clip_planes.y() > 0.0f) {
+            // See ReadPixelsCallback()
+            const float near = clip_planes.x();
+            const float far = clip_planes.y();
+            core::Tensor drawn = pixels.Gt(0.0f).To(core::Dtype::Float32);
+            pixels = core::Tensor::Full(pixels.GetShape(), near * far,
+                                        core::Dtype::Float32,
+                                        pixels.GetDevice())
+                             .Div(pixels.Mul(far - near).Add(near))
+                             .Mul(drawn);
+        }
+        readback.on_tensor_image(readback.view_indices[tile],
+                                 std::make_shared<t::geometry::Image>(pixels));
+    }
+}
+
+FilamentBatchRenderer::Readback& FilamentBatchRenderer::AcquireReadback() {
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        for (auto& readback : readbacks_) {
+            if (!readback->in_flight) {
+                // The staging tensor is overwritten by the next readback.
+                if (readback->copy_pending) {
+                    readback->stream.Synchronize();
+                    readback->copy_pending = false;
+                }
+                return *readback;
+            }
+        }
+        // All readbacks are in flight: wait for the oldest frames to
+        // complete, which runs their callbacks and frees the buffers.
+        EngineInstance::GetInstance().flushAndWait();
+    }
+    utility::LogError("Batch renderer readbacks did not complete");
+}
+
+void FilamentBatchRenderer::ReadPixelsCallback(void*, size_t, void* user) {
+    auto* readback = static_cast<Readback*>(user);
+    auto* self = readback->owner;
+    if (readback->on_tensor_image) {
+        CopyTensorTiles(*readback);
+        readback->on_tensor_image = nullptr;
+        readback->in_flight = false;
+        --self->n_in_flight_;
+        return;
+    }
+
+    int n_channels = (readback->depth ? 1 : 3);
+    int bytes_per_channel = (readback->depth ? 4 : 1);
+    size_t tile_row_bytes = size_t(self->width_) * n_channels *
+                            bytes_per_channel;
+    size_t frame_row_bytes = tile_row_bytes * readback->view_indices.size();
+    for (size_t tile = 0; tile < readback->view_indices.size(); ++tile) {
+        auto image = std::make_shared<geometry::Image>();
+        image->Prepare(self->width_, self->height_, n_channels,
+                       bytes_per_channel);
+        const std::uint8_t* src =
+                readback->buffer.data() + tile * tile_row_bytes;
+        for (int y = 0; y < self->height_; ++y) {
+            std::memcpy(image->data_.data() + y * tile_row_bytes,
+                        src + y * frame_row_bytes, tile_row_bytes);
+        }
+        const auto& clip_planes = readback->view_space_clip_planes[tile];
+        if (readback->depth && clip_planes.y() > 0.0f) {
+            // Filament's depth is reversed (1 at the near plane, 0 at the
+            // far plane and where nothing was drawn).
+            const float near = clip_planes.x();
+            const float far = clip_planes.y();
+            auto* pixels = image->PointerAs<float>();
+            const size_t n_pixels = size_t(self->width_) * self->height_;
+            for (size_t i = 0; i < n_pixels; ++i) {
+                const float d = pixels[i];
+                pixels[i] = (d > 0.0f) ? near * far / (near + d * (far - near))
+                                       : 0.0f;
+            }
+        }
+        readback->on_image(readback->view_indices[tile], image);
+    }
+
+    // Release the callback in case it captured something large.
+    readback->on_image = nullptr;
+    readback->in_flight = false;
+    --self->n_in_flight_;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
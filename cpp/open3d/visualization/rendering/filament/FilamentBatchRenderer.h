@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/visualization/rendering/Material.h"
+
+/// @cond
+namespace filament {
+class Renderer;
+class SwapChain;
+}  // namespace filament
+/// @endcond
+
+namespace open3d {
+
+namespace geometry {
+class Geometry3D;
+class Image;
+}  // namespace geometry
+
+namespace t {
+namespace geometry {
+class Image;
+}  // namespace geometry
+}  // namespace t
+
+namespace visualization {
+namespace rendering {
+
+class FilamentRenderer;
+class FilamentView;
+class Open3DScene;
+
+/// Renders queues of offscreen jobs, e.g. thumbnails and depth maps of many
+/// assets, with one warm engine and scene. Each job uploads its geometry
+/// once and renders all of its views; up to \p views_per_frame views are
+/// tiled side by side into one frame and read back together. Readbacks are
+/// asynchronous, so the next frame renders while earlier frames are still
+/// being read back, with at most \p frames_in_flight frames outstanding.
+///
+/// Jobs with on_tensor_image return t::geometry::Images on a device instead.
+/// Filament's GL context is private, so the frames cannot be shared with
+/// CUDA directly; instead, they are read back into pinned host memory and
+/// copied to the device asynchronously, and the tiles are split (and depth
+/// converted) on the device, so that the host does not touch the pixels.
+///
+/// The engine must be initialized before construction, for headless use
+/// with EngineInstance::EnableHeadless() and EngineInstance::SetResourcePath()
+/// (or gui::Application::Initialize()). Not thread-safe; all calls and all
+/// callbacks happen on the thread that calls Flush().
+class FilamentBatchRenderer {
+public:
+    struct ViewRequest {
+        /// Pinhole intrinsic matrix for the width and height of the renderer
+        Eigen::Matrix3d intrinsic = Eigen::Matrix3d::Identity();
+        /// World to camera transform (OpenCV convention: +Z forward, +Y down)
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        /// Renders a float depth image in [0, 1] instead of an RGB image.
+        bool depth = false;
+        /// With \p depth, the image holds the distance along the camera's
+        /// Z axis in scene units instead, and 0 where nothing was drawn.
+        bool depth_in_view_space = false;
+    };
+
+    /// Called once per view of a job with the index of the view in
+    /// Job::views. The image is nullptr if the view could not be rendered.
+    using ImageCallback = std::function<void(
+            size_t view_index, std::shared_ptr<geometry::Image> image)>;
+
+    /// Called once per view of a job with the index of the view in
+    /// Job::views. Color images are (height, width, 3) UInt8 and depth images
+    /// (height, width, 1) Float32, on Job::device. The image is nullptr if
+    /// the view could not be rendered.
+    using TensorImageCallback = std::function<void(
+            size_t view_index, std::shared_ptr<t::geometry::Image> image)>;
+
+    struct Job {
+        /// May be nullptr to only render the geometry of GetScene()
+        std::shared_ptr<const geometry::Geometry3D> geometry;
+        Material material;
+        std::vector<ViewRequest> views;
+        /// Exactly one of the callbacks must be set.
+        ImageCallback on_image;
+        TensorImageCallback on_tensor_image;
+        /// Device of the images passed to on_tensor_image
+        core::Device device = core::Device("CPU:0");
+    };
+
+    FilamentBatchRenderer(int width,
+                          int height,
+                          int views_per_frame = 4,
+                          int frames_in_flight = 2);
+    ~FilamentBatchRenderer();
+
+    FilamentBatchRenderer(const FilamentBatchRenderer&) = delete;
+    FilamentBatchRenderer& operator=(const FilamentBatchRenderer&) = delete;
+
+    /// The scene that jobs are rendered in. Its lighting applies to all
+    /// subsequent jobs. Geometry added to it directly is rendered in every
+    /// job, which is useful for e.g. a ground plane.
+    Open3DScene& GetScene() { return *scene_; }
+
+    void Enqueue(Job job);
+    size_t GetQueueSize() const { return queue_.size(); }
+
+    /// Renders all queued jobs and returns after all their callbacks ran.
+    void Flush();
+
+    /// Renders \p views of GetScene() and \p geometry (if not nullptr) into
+    /// t::geometry::Images on \p device, in the order of \p views. See
+    /// TensorImageCallback for the formats. Queued jobs are rendered first.
+    std::vector<std::shared_ptr<t::geometry::Image>> RenderToTensorImages(
+            const std::vector<ViewRequest>& views,
+            const core::Device& device,
+            std::shared_ptr<const geometry::Geometry3D> geometry = nullptr,
+            const Material& material = Material());
+
+private:
+    struct Readback;
+
+    void RenderJob(const Job& job);
+    static void FailViews(const Job& job, const std::vector<size_t>& indices);
+    static void CopyTensorTiles(Readback& readback);
+    void RenderFrame(const Job& job,
+                     const std::vector<size_t>& view_indices,
+                     bool depth,
+                     const Eigen::Vector3d& center,
+                     double radius);
+    /// Returns the near and far clip planes.
+    Eigen::Vector2f SetupCamera(FilamentView& view,
+                                const ViewRequest& request,
+                                const Eigen::Vector3d& center,
+                                double radius);
+    Readback& AcquireReadback();
+    static void ReadPixelsCallback(void* buffer, size_t size, void* user);
+
+    int width_;
+    int height_;
+    int views_per_frame_;
+
+    std::unique_ptr<FilamentRenderer> o3d_renderer_;
+    std::unique_ptr<Open3DScene> scene_;
+    filament::Renderer* renderer_ = nullptr;
+    filament::SwapChain* swapchain_ = nullptr;
+    std::vector<std::unique_ptr<FilamentView>> color_views_;
+    std::vector<std::unique_ptr<FilamentView>> depth_views_;
+
+    std::vector<std::unique_ptr<Readback>> readbacks_;
+    size_t n_in_flight_ = 0;
+    size_t next_job_id_ = 0;
+
+    std::deque<Job> queue_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
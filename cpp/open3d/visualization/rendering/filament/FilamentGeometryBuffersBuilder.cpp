@@ -26,12 +26,35 @@
 
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 
+// 4068: Filament has some clang-specific vectorizing pragma's that MSVC flags
+// 4146: Filament's utils/algorithm.h utils::details::ctz() tries to negate
+//       an unsigned int.
+// 4293: Filament's utils/algorithm.h utils::details::clz() does strange
+//       things with MSVC. Somehow sizeof(unsigned int) > 4, but its size is
+//       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
+//       determine the if statement does not run.)
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4068 4146 4293)
+#endif  // _MSC_VER
+
+#include <geometry/SurfaceOrientation.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // _MSC_VER
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/Octree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/geometry/VoxelGrid.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace visualization {
@@ -271,6 +294,81 @@ void GeometryBuffersBuilder::DeallocateBuffer(void* buffer,
     free(buffer);
 }
 
+std::int16_t GeometryBuffersBuilder::ToSnorm16(float value) {
+    value = std::min(std::max(value, -1.f), 1.f);
+    return std::int16_t(std::lround(value * 32767.f));
+}
+
+std::uint8_t GeometryBuffersBuilder::ToUnorm8(float value) {
+    value = std::min(std::max(value, 0.f), 1.f);
+    return std::uint8_t(std::lround(value * 255.f));
+}
+
+std::uint16_t GeometryBuffersBuilder::ToHalf(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const std::uint16_t sign = std::uint16_t((bits >> 16) & 0x8000u);
+    const std::int32_t exponent = std::int32_t((bits >> 23) & 0xffu) - 127;
+    std::uint32_t mantissa = bits & 0x7fffffu;
+
+    if (exponent == 128) {  // Inf and NaN
+        return std::uint16_t(sign | 0x7c00u | (mantissa ? 0x200u : 0u));
+    }
+    if (exponent > 15) {  // too large, saturate to infinity
+        return std::uint16_t(sign | 0x7c00u);
+    }
+    if (exponent < -25) {  // too small, even for a denormal
+        return sign;
+    }
+    if (exponent < -14) {  // denormal half
+        mantissa |= 0x800000u;
+        const int shift = -exponent - 1;
+        std::uint32_t half_mantissa = mantissa >> shift;
+        // Round to nearest, ties to even
+        const std::uint32_t rest = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half_mantissa & 1u))) {
+            ++half_mantissa;
+        }
+        return std::uint16_t(sign | half_mantissa);
+    }
+
+    std::uint32_t half = (std::uint32_t(exponent + 15) << 10) |
+                         (mantissa >> 13);
+    // Round to nearest, ties to even. A carry into the exponent is correct,
+    // including rounding up to infinity.
+    const std::uint32_t rest = mantissa & 0x1fffu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) {
+        ++half;
+    }
+    return std::uint16_t(sign | half);
+}
+
+void GeometryBuffersBuilder::ComputeTangentQuats(const float* normals,
+                                                 size_t n_vertices,
+                                                 float* quats) {
+    // SurfaceOrientation is single threaded, so convert independent slices
+    // of the normals. Each quaternion only depends on its own normal.
+    static const int64_t kSliceSize = 65536;
+    utility::ParallelForRange(
+            0, int64_t(n_vertices), kSliceSize,
+            [&](int64_t begin, int64_t end) {
+                const size_t count = size_t(end - begin);
+                auto* orientation =
+                        filament::geometry::SurfaceOrientation::Builder()
+                                .vertexCount(count)
+                                .normals(reinterpret_cast<
+                                         const filament::math::float3*>(
+                                        normals + 3 * begin))
+                                .build();
+                orientation->getQuats(
+                        reinterpret_cast<filament::math::quatf*>(quats +
+                                                                 4 * begin),
+                        count);
+                delete orientation;
+            });
+}
+
 }  // namespace rendering
 }  // namespace visualization
 }  // namespace open3d
@@ -51,6 +51,7 @@
 #endif  // _MSC_VER
 // clang-format on
 
+#include <cstdint>
 #include <memory>
 #include <tuple>
 
@@ -82,6 +83,15 @@ public:
                                IndexBufferHandle>;  // downsampled buffer
     using IndexType = std::uint32_t;
 
+    // Layout of the vertex buffers. kFloat stores 32-bit floats for every
+    // attribute. kPacked interleaves float positions with snorm16 tangent
+    // quaternions and unorm8 colors. kPackedHalfPositions additionally
+    // stores positions as float16 relative to GetPositionOrigin(), which is
+    // only precise enough for spatially small geometry (e.g. point cloud
+    // chunks). Builders without half positions treat it as kPacked, and
+    // builders without a packed layout (line sets) always use kFloat.
+    enum class VertexFormat { kFloat, kPacked, kPackedHalfPositions };
+
     static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
             const geometry::Geometry3D& geometry);
     static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
@@ -108,6 +118,18 @@ public:
         adjust_colors_for_srgb_tonemapping_ = adjust;
     }
 
+    virtual void SetVertexFormat(VertexFormat format) {
+        vertex_format_ = format;
+    }
+    VertexFormat GetVertexFormat() const { return vertex_format_; }
+
+    // Positions in the vertex buffer are relative to this point, which is
+    // non-zero only for VertexFormat::kPackedHalfPositions. The renderable's
+    // transform must translate by it. Valid after ConstructBuffers().
+    const filament::math::float3& GetPositionOrigin() const {
+        return position_origin_;
+    }
+
     virtual Buffers ConstructBuffers() = 0;
     virtual filament::Box ComputeAABB() = 0;
 
@@ -115,9 +137,22 @@ protected:
     size_t downsample_threshold_ = SIZE_MAX;
     bool wide_lines_ = false;
     bool adjust_colors_for_srgb_tonemapping_ = true;
+    VertexFormat vertex_format_ = VertexFormat::kFloat;
+    filament::math::float3 position_origin_ = {0.f, 0.f, 0.f};
 
     static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr);
 
+    // Conversions for the packed vertex formats.
+    static std::int16_t ToSnorm16(float value);
+    static std::uint8_t ToUnorm8(float value);
+    static std::uint16_t ToHalf(float value);
+
+    // Computes tangent-frame quaternions (4 floats per vertex) from
+    // \p n_vertices normals (3 floats per vertex), in parallel.
+    static void ComputeTangentQuats(const float* normals,
+                                    size_t n_vertices,
+                                    float* quats);
+
     static IndexBufferHandle CreateIndexBuffer(size_t max_index,
                                                size_t n_subsamples = SIZE_MAX);
 };
@@ -132,7 +167,24 @@ public:
     Buffers ConstructBuffers() override;
     filament::Box ComputeAABB() override;
 
+    // Rewrites the vertices and/or indices of buffers built by
+    // ConstructBuffers() with the same vertex format. The mesh must not have
+    // triangle UVs. Buffers that are too small are replaced by new ones with
+    // spare capacity, in which case the returned handles differ from \p vb
+    // and \p ib and the caller must destroy the old buffers. Returns kBadId
+    // handles on failure.
+    Buffers UpdateBuffers(VertexBufferHandle vb,
+                          IndexBufferHandle ib,
+                          bool update_vertices,
+                          bool update_indices);
+
 private:
+    Buffers ConstructPackedBuffers();
+    // Interleaved vertices of the packed or the float (without triangle UVs)
+    // layout, and triangle indices, allocated with malloc().
+    void* CreateVertices(bool packed, size_t* byte_count) const;
+    IndexType* CreateIndices(size_t* byte_count) const;
+
     const geometry::TriangleMesh& geometry_;
 };
 
@@ -147,6 +199,8 @@ public:
     filament::Box ComputeAABB() override;
 
 private:
+    Buffers ConstructPackedBuffers();
+
     const geometry::PointCloud& geometry_;
 };
 
@@ -161,6 +215,8 @@ public:
     filament::Box ComputeAABB() override;
 
 private:
+    Buffers ConstructPackedBuffers();
+
     const t::geometry::PointCloud& geometry_;
 };
 
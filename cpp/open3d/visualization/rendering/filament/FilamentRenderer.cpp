@@ -169,7 +169,27 @@ void FilamentRenderer::UpdateBitmapSwapChain(int width, int height) {
                                           filament::SwapChain::CONFIG_READABLE);
 }
 
+namespace {
+double MillisecondsBetween(std::chrono::steady_clock::time_point start,
+                           std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+}  // namespace
+
 void FilamentRenderer::BeginFrame() {
+    const auto now = std::chrono::steady_clock::now();
+    if (frame_stats_.frame_count > 0) {
+        const double interval = MillisecondsBetween(frame_start_, now);
+        frame_stats_.frame_interval_ms = interval;
+        if (interval > 0.0) {
+            const double fps = 1000.0 / interval;
+            frame_stats_.fps = (frame_stats_.fps > 0.0
+                                        ? 0.9 * frame_stats_.fps + 0.1 * fps
+                                        : fps);
+        }
+    }
+    frame_start_ = now;
+
     // We will complete render to buffer requests first
     if (!buffer_renderers_.empty()) {
         for (auto& br : buffer_renderers_) {
@@ -192,6 +212,7 @@ void FilamentRenderer::BeginFrame() {
 
 void FilamentRenderer::Draw() {
     if (frame_started_) {
+        const auto draw_start = std::chrono::steady_clock::now();
         // Draw 3D scenes into textures
         for (const auto& pair : scenes_) {
             pair.second->Draw(*renderer_);
@@ -207,6 +228,8 @@ void FilamentRenderer::Draw() {
         if (on_after_draw_) {
             on_after_draw_();
         }
+        frame_stats_.draw_ms = MillisecondsBetween(
+                draw_start, std::chrono::steady_clock::now());
     }
 }
 
@@ -217,9 +240,44 @@ void FilamentRenderer::EndFrame() {
             engine_.flushAndWait();
             needs_wait_after_draw_ = false;
         }
+        frame_stats_.frame_ms = MillisecondsBetween(
+                frame_start_, std::chrono::steady_clock::now());
+        frame_stats_.frame_count += 1;
     }
 }
 
+RenderStats FilamentRenderer::GetRenderStats() const {
+    RenderStats stats = frame_stats_;
+    for (const auto& pair : scenes_) {
+        pair.second->AddRenderStats(stats);
+    }
+    auto usage = resource_mgr_.GetMemoryUsage();
+    stats.resident_buffer_bytes =
+            usage.vertex_buffer_bytes + usage.index_buffer_bytes;
+    stats.resident_texture_bytes = usage.texture_bytes;
+    stats.memory_budget = resource_mgr_.GetMemoryBudget();
+    return stats;
+}
+
+void FilamentRenderer::SetMemoryBudget(size_t bytes) {
+    resource_mgr_.SetMemoryBudget(bytes);
+    for (auto& pair : scenes_) {
+        pair.second->EnforceMemoryBudget();
+    }
+}
+
+size_t FilamentRenderer::GetMemoryBudget() const {
+    return resource_mgr_.GetMemoryBudget();
+}
+
+void FilamentRenderer::SetMaxTextureSize(int size) {
+    resource_mgr_.SetMaxTextureSize(size);
+}
+
+void FilamentRenderer::SetTextureCompression(bool enable) {
+    resource_mgr_.SetTextureCompression(enable);
+}
+
 namespace {
 
 struct UserData {
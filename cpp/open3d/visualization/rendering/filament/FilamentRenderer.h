@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -82,6 +83,13 @@ public:
 
     void SetOnAfterDraw(std::function<void()> callback) override;
 
+    RenderStats GetRenderStats() const override;
+
+    void SetMemoryBudget(size_t bytes) override;
+    size_t GetMemoryBudget() const override;
+    void SetMaxTextureSize(int size) override;
+    void SetTextureCompression(bool enable) override;
+
     MaterialHandle AddMaterial(const ResourceLoadRequest& request) override;
     MaterialInstanceHandle AddMaterialInstance(
             const MaterialHandle& material) override;
@@ -141,6 +149,10 @@ private:
     bool frame_started_ = false;
     std::function<void()> on_after_draw_;
     bool needs_wait_after_draw_ = false;
+
+    // Timings of the last frame; counts are collected from the scenes.
+    RenderStats frame_stats_;
+    std::chrono::steady_clock::time_point frame_start_;
 };
 
 }  // namespace rendering
@@ -64,6 +64,7 @@
 #include "open3d/visualization/gui/Application.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentEntitiesMods.h"
+#include "open3d/visualization/rendering/filament/TextureCompression.h"
 
 namespace open3d {
 namespace visualization {
@@ -295,6 +296,113 @@ TextureSettings GetSettingsFromImage(const t::geometry::Image& image,
     return settings;
 }
 
+size_t BitsPerTexel(filament::Texture::InternalFormat format) {
+    using Format = filament::Texture::InternalFormat;
+    switch (format) {
+        case Format::DXT1_RGB:
+        case Format::DXT1_SRGB:
+            return 4;
+        case Format::R8:
+        case Format::DXT5_RGBA:
+        case Format::DXT5_SRGBA:
+            return 8;
+        case Format::RG8:
+            return 16;
+        case Format::RGB8:
+        case Format::SRGB8:
+            return 24;
+        case Format::RGBA16F:
+            return 64;
+        default:
+            return 32;
+    }
+}
+
+// Size of all mip levels of a texture. Cubemaps are counted as one face.
+size_t TextureBytes(const filament::Texture& texture) {
+    const size_t texel_bits = BitsPerTexel(texture.getFormat());
+    size_t bits = 0;
+    for (size_t level = 0; level < texture.getLevels(); ++level) {
+        bits += std::max<size_t>(1, texture.getWidth() >> level) *
+                std::max<size_t>(1, texture.getHeight() >> level) * texel_bits;
+    }
+    return bits / 8;
+}
+
+void FreeCompressedLevel(void* buffer, size_t size, void* user_ptr) {
+    free(buffer);
+}
+
+bool GetCompressedFormat(int num_channels,
+                         bool srgb,
+                         filament::Texture::InternalFormat* format,
+                         filament::Texture::CompressedType* type) {
+    using filament::Texture;
+    if (num_channels == 3) {
+        *format = (srgb ? Texture::InternalFormat::DXT1_SRGB
+                        : Texture::InternalFormat::DXT1_RGB);
+        *type = (srgb ? Texture::CompressedType::DXT1_SRGB
+                      : Texture::CompressedType::DXT1_RGB);
+        return true;
+    } else if (num_channels == 4) {
+        *format = (srgb ? Texture::InternalFormat::DXT5_SRGBA
+                        : Texture::InternalFormat::DXT5_RGBA);
+        *type = (srgb ? Texture::CompressedType::DXT5_SRGBA
+                      : Texture::CompressedType::DXT5_RGBA);
+        return true;
+    }
+    return false;
+}
+
+// Filament cannot generate the mip levels of compressed textures, so each
+// level is downsampled and encoded on the CPU.
+void SetCompressedImage(filament::Engine& engine,
+                        filament::Texture& texture,
+                        const geometry::Image& image,
+                        filament::Texture::CompressedType type) {
+    std::shared_ptr<geometry::Image> halved;
+    const geometry::Image* level_image = &image;
+    for (size_t level = 0; level < texture.getLevels(); ++level) {
+        if (level > 0) {
+            halved = HalveImage(*level_image);
+            level_image = halved.get();
+        }
+        const size_t size = BlockCompressedSize(level_image->width_,
+                                                level_image->height_,
+                                                level_image->num_of_channels_);
+        auto* data = static_cast<std::uint8_t*>(malloc(size));
+        BlockCompressImage(*level_image, data);
+        filament::Texture::PixelBufferDescriptor pb(
+                data, size, type, std::uint32_t(size), FreeCompressedLevel);
+        texture.setImage(engine, level, std::move(pb));
+    }
+}
+
+// Box filters an image with one byte per channel to half its size
+std::shared_ptr<geometry::Image> HalveImage(const geometry::Image& image) {
+    auto half = std::make_shared<geometry::Image>();
+    const int channels = image.num_of_channels_;
+    half->Prepare(std::max(1, image.width_ / 2), std::max(1, image.height_ / 2),
+                  channels, 1);
+    for (int y = 0; y < half->height_; ++y) {
+        const int y0 = std::min(2 * y, image.height_ - 1);
+        const int y1 = std::min(2 * y + 1, image.height_ - 1);
+        for (int x = 0; x < half->width_; ++x) {
+            const int x0 = std::min(2 * x, image.width_ - 1);
+            const int x1 = std::min(2 * x + 1, image.width_ - 1);
+            auto* out = half->PointerAt<std::uint8_t>(x, y, 0);
+            for (int c = 0; c < channels; ++c) {
+                int sum = *image.PointerAt<std::uint8_t>(x0, y0, c) +
+                          *image.PointerAt<std::uint8_t>(x1, y0, c) +
+                          *image.PointerAt<std::uint8_t>(x0, y1, c) +
+                          *image.PointerAt<std::uint8_t>(x1, y1, c);
+                out[c] = std::uint8_t((sum + 2) / 4);
+            }
+        }
+    }
+    return half;
+}
+
 }  // namespace
 
 const MaterialHandle FilamentResourceManager::kDefaultLit =
@@ -325,6 +433,8 @@ const MaterialHandle FilamentResourceManager::kDefaultLineShader =
         MaterialHandle::Next();
 const MaterialHandle FilamentResourceManager::kDefaultUnlitPolygonOffsetShader =
         MaterialHandle::Next();
+const MaterialHandle FilamentResourceManager::kPointSplatShader =
+        MaterialHandle::Next();
 const MaterialInstanceHandle FilamentResourceManager::kDepthMaterial =
         MaterialInstanceHandle::Next();
 const MaterialInstanceHandle FilamentResourceManager::kNormalsMaterial =
@@ -350,6 +460,7 @@ static const std::unordered_set<REHandle_abstract> kDefaultResources = {
         FilamentResourceManager::kInfinitePlaneShader,
         FilamentResourceManager::kDefaultLineShader,
         FilamentResourceManager::kDefaultUnlitPolygonOffsetShader,
+        FilamentResourceManager::kPointSplatShader,
         FilamentResourceManager::kDepthMaterial,
         FilamentResourceManager::kNormalsMaterial,
         FilamentResourceManager::kDefaultTexture,
@@ -483,6 +594,15 @@ bool FilamentResourceManager::UpdateTexture(
     if (auto ftexture = ftexture_weak.lock()) {
         if (ftexture->getWidth() == size_t(image->width_) &&
             ftexture->getHeight() == size_t(image->height_)) {
+            filament::Texture::InternalFormat format;
+            filament::Texture::CompressedType type;
+            if (image->bytes_per_channel_ == 1 &&
+                GetCompressedFormat(image->num_of_channels_, srgb, &format,
+                                    &type) &&
+                format == ftexture->getFormat()) {
+                SetCompressedImage(engine_, *ftexture, *image, type);
+                return true;
+            }
             auto retained_img_id = RetainImageForLoading(image);
             auto texture_settings = GetSettingsFromImage(*image, srgb);
             filament::Texture::PixelBufferDescriptor desc(
@@ -503,6 +623,16 @@ bool FilamentResourceManager::UpdateTexture(TextureHandle texture,
     if (auto ftexture = ftexture_weak.lock()) {
         if (ftexture->getWidth() == size_t(image.GetCols()) &&
             ftexture->getHeight() == size_t(image.GetRows())) {
+            filament::Texture::InternalFormat format;
+            filament::Texture::CompressedType type;
+            if (image.GetDtype() == core::Dtype::UInt8 &&
+                GetCompressedFormat(int(image.GetChannels()), srgb, &format,
+                                    &type) &&
+                format == ftexture->getFormat()) {
+                SetCompressedImage(engine_, *ftexture, image.ToLegacyImage(),
+                                   type);
+                return true;
+            }
             auto texture_settings = GetSettingsFromImage(image, srgb);
             filament::Texture::PixelBufferDescriptor desc(
                     image.GetDataPtr(),
@@ -684,9 +814,13 @@ SkyboxHandle FilamentResourceManager::CreateSkybox(
 }
 
 VertexBufferHandle FilamentResourceManager::AddVertexBuffer(
-        filament::VertexBuffer* vertex_buffer) {
-    return RegisterResource<VertexBufferHandle>(engine_, vertex_buffer,
-                                                vertex_buffers_);
+        filament::VertexBuffer* vertex_buffer, size_t bytes_per_vertex) {
+    auto handle = RegisterResource<VertexBufferHandle>(engine_, vertex_buffer,
+                                                       vertex_buffers_);
+    if (bytes_per_vertex > 0) {
+        buffer_strides_[handle] = bytes_per_vertex;
+    }
+    return handle;
 }
 
 void FilamentResourceManager::ReuseVertexBuffer(VertexBufferHandle vb) {
@@ -714,11 +848,21 @@ IndexBufferHandle FilamentResourceManager::CreateIndexBuffer(
     if (ibuf) {
         handle = RegisterResource<IndexBufferHandle>(engine_, ibuf,
                                                      index_buffers_);
+        buffer_strides_[handle] = index_stride;
     }
 
     return handle;
 }
 
+void FilamentResourceManager::ReuseIndexBuffer(IndexBufferHandle ib) {
+    auto found = index_buffers_.find(ib);
+    if (found != index_buffers_.end()) {
+        found->second.use_count += 1;
+    } else {
+        utility::LogError("Reusing non-existant index buffer");
+    }
+}
+
 std::weak_ptr<filament::Material> FilamentResourceManager::GetMaterial(
         const MaterialHandle& id) {
     return FindResource(id, materials_);
@@ -768,6 +912,7 @@ void FilamentResourceManager::DestroyAll() {
     index_buffers_.clear();
     ibls_.clear();
     skyboxes_.clear();
+    buffer_strides_.clear();
 }
 
 void FilamentResourceManager::Destroy(const REHandle_abstract& id) {
@@ -812,6 +957,10 @@ void FilamentResourceManager::Destroy(const REHandle_abstract& id) {
             return;
     }
 
+    if (vertex_buffers_.count(id) == 0 && index_buffers_.count(id) == 0) {
+        buffer_strides_.erase(id);
+    }
+
     auto found = dependencies_.find(id);
     if (found != dependencies_.end()) {
         for (const auto& dependent : found->second) {
@@ -822,6 +971,35 @@ void FilamentResourceManager::Destroy(const REHandle_abstract& id) {
     }
 }
 
+FilamentResourceManager::MemoryUsage FilamentResourceManager::GetMemoryUsage()
+        const {
+    MemoryUsage usage;
+    for (const auto& vb : vertex_buffers_) {
+        auto stride = buffer_strides_.find(vb.first);
+        // Buffers added without a stride hold at least a float3 position
+        size_t bytes_per_vertex = stride != buffer_strides_.end()
+                                          ? stride->second
+                                          : 3 * sizeof(float);
+        usage.vertex_buffer_bytes +=
+                size_t(vb.second.ptr->getVertexCount()) * bytes_per_vertex;
+    }
+    for (const auto& ib : index_buffers_) {
+        auto stride = buffer_strides_.find(ib.first);
+        size_t bytes_per_index = stride != buffer_strides_.end()
+                                         ? stride->second
+                                         : sizeof(std::uint32_t);
+        usage.index_buffer_bytes +=
+                size_t(ib.second.ptr->getIndexCount()) * bytes_per_index;
+    }
+    for (const auto& tex : textures_) {
+        usage.texture_bytes += TextureBytes(*tex.second.ptr);
+    }
+    usage.num_vertex_buffers = vertex_buffers_.size();
+    usage.num_index_buffers = index_buffers_.size();
+    usage.num_textures = textures_.size();
+    return usage;
+}
+
 inline uint8_t maxLevelCount(uint32_t width, uint32_t height) {
     auto maxdim = std::max(width, height);
     uint8_t levels = static_cast<uint8_t>(std::ilogbf(float(maxdim)));
@@ -829,9 +1007,22 @@ inline uint8_t maxLevelCount(uint32_t width, uint32_t height) {
 }
 
 filament::Texture* FilamentResourceManager::LoadTextureFromImage(
-        const std::shared_ptr<geometry::Image>& image, bool srgb) {
+        const std::shared_ptr<geometry::Image>& source, bool srgb) {
     using namespace filament;
 
+    // Drop the largest mip levels of images above the size limit
+    auto image = source;
+    while (max_texture_size_ > 0 && image->bytes_per_channel_ == 1 &&
+           std::max(image->width_, image->height_) > max_texture_size_) {
+        image = HalveImage(*image);
+    }
+
+    if (compress_textures_) {
+        if (auto texture = LoadCompressedTexture(*image, srgb)) {
+            return texture;
+        }
+    }
+
     auto retained_img_id = RetainImageForLoading(image);
     auto texture_settings = GetSettingsFromImage(*image, srgb);
     auto levels = maxLevelCount(texture_settings.texel_width,
@@ -858,6 +1049,16 @@ filament::Texture* FilamentResourceManager::LoadTextureFromImage(
         const t::geometry::Image& image, bool srgb) {
     using namespace filament;
 
+    const bool resize =
+            (max_texture_size_ > 0 &&
+             std::max(image.GetRows(), image.GetCols()) > max_texture_size_);
+    if ((resize || compress_textures_) &&
+        image.GetDtype() == core::Dtype::UInt8) {
+        return LoadTextureFromImage(
+                std::make_shared<geometry::Image>(image.ToLegacyImage()),
+                srgb);
+    }
+
     auto texture_settings = GetSettingsFromImage(image, srgb);
     auto levels = maxLevelCount(texture_settings.texel_width,
                                 texture_settings.texel_height);
@@ -880,6 +1081,29 @@ filament::Texture* FilamentResourceManager::LoadTextureFromImage(
     return texture;
 }
 
+filament::Texture* FilamentResourceManager::LoadCompressedTexture(
+        const geometry::Image& image, bool srgb) {
+    using namespace filament;
+
+    Texture::InternalFormat format;
+    Texture::CompressedType type;
+    if (image.bytes_per_channel_ != 1 ||
+        !GetCompressedFormat(image.num_of_channels_, srgb, &format, &type) ||
+        !Texture::isTextureFormatSupported(engine_, format)) {
+        return nullptr;
+    }
+
+    auto texture = Texture::Builder()
+                           .width(image.width_)
+                           .height(image.height_)
+                           .levels(maxLevelCount(image.width_, image.height_))
+                           .format(format)
+                           .sampler(Texture::Sampler::SAMPLER_2D)
+                           .build(engine_);
+    SetCompressedImage(engine_, *texture, image, type);
+    return texture;
+}
+
 filament::Texture* FilamentResourceManager::LoadFilledTexture(
         const Eigen::Vector3f& color, size_t dimension) {
     auto image = std::make_shared<geometry::Image>();
@@ -1096,6 +1320,17 @@ void FilamentResourceManager::LoadDefaults() {
     auto poffset_mat = LoadMaterialFromFile(poffset_path, engine_);
     materials_[kDefaultUnlitPolygonOffsetShader] =
             BoxResource(poffset_mat, engine_);
+
+    const auto splat_path = resource_root + "/pointSplat.filamat";
+    auto splat_mat = LoadMaterialFromFile(splat_path, engine_);
+    splat_mat->setDefaultParameter("baseColor", filament::RgbType::LINEAR,
+                                   {1.f, 1.f, 1.f});
+    splat_mat->setDefaultParameter("pointSize", 1.f);
+    splat_mat->setDefaultParameter("maxPointSize", 64.f);
+    splat_mat->setDefaultParameter("splatRadius", 0.f);
+    splat_mat->setDefaultParameter("splatShading", 1.f);
+    splat_mat->setDefaultParameter("srgbColor", 0.f);
+    materials_[kPointSplatShader] = BoxResource(splat_mat, engine_);
 }
 
 }  // namespace rendering
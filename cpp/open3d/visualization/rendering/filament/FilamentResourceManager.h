@@ -82,6 +82,7 @@ public:
     static const MaterialHandle kInfinitePlaneShader;
     static const MaterialHandle kDefaultLineShader;
     static const MaterialHandle kDefaultUnlitPolygonOffsetShader;
+    static const MaterialHandle kPointSplatShader;
     static const MaterialInstanceHandle kDepthMaterial;
     static const MaterialInstanceHandle kNormalsMaterial;
     static const MaterialInstanceHandle kColorMapMaterial;
@@ -131,10 +132,14 @@ public:
     // Since rendering uses not all Open3D geometry/filament features, we don't
     // know which arguments pass to CreateVB(...). Thus creation of VB is
     // managed by FilamentGeometryBuffersBuilder class
-    VertexBufferHandle AddVertexBuffer(filament::VertexBuffer* vertex_buffer);
+    // \param bytes_per_vertex is the combined size of all attributes of one
+    // vertex and is only used for memory accounting.
+    VertexBufferHandle AddVertexBuffer(filament::VertexBuffer* vertex_buffer,
+                                       size_t bytes_per_vertex = 0);
     void ReuseVertexBuffer(VertexBufferHandle vb);
     IndexBufferHandle CreateIndexBuffer(size_t indices_count,
                                         size_t index_stride);
+    void ReuseIndexBuffer(IndexBufferHandle ib);
 
     std::weak_ptr<filament::Material> GetMaterial(const MaterialHandle& id);
     std::weak_ptr<filament::MaterialInstance> GetMaterialInstance(
@@ -153,6 +158,40 @@ public:
     void DestroyAll();
     void Destroy(const REHandle_abstract& id);
 
+    // Estimated GPU memory held by the resources in the manager.
+    struct MemoryUsage {
+        size_t vertex_buffer_bytes = 0;
+        size_t index_buffer_bytes = 0;
+        size_t texture_bytes = 0;
+        size_t num_vertex_buffers = 0;
+        size_t num_index_buffers = 0;
+        size_t num_textures = 0;
+
+        size_t Total() const {
+            return vertex_buffer_bytes + index_buffer_bytes + texture_bytes;
+        }
+    };
+    MemoryUsage GetMemoryUsage() const;
+
+    // Scenes evict hidden geometry while the usage is above the budget.
+    // A budget of 0 (the default) means unlimited.
+    void SetMemoryBudget(size_t bytes) { memory_budget_ = bytes; }
+    size_t GetMemoryBudget() const { return memory_budget_; }
+    bool IsOverMemoryBudget() const {
+        return memory_budget_ > 0 && GetMemoryUsage().Total() > memory_budget_;
+    }
+
+    // Textures created from images larger than this are uploaded without
+    // their largest mip levels. 0 (the default) means no limit.
+    void SetMaxTextureSize(int size) { max_texture_size_ = size; }
+    int GetMaxTextureSize() const { return max_texture_size_; }
+
+    // Textures created from 8-bit RGB and RGBA images are block compressed
+    // (BC1 and BC3) if the GPU supports it. Filament cannot generate the mip
+    // levels of compressed textures, so they are built on the CPU.
+    void SetTextureCompression(bool enable) { compress_textures_ = enable; }
+    bool GetTextureCompression() const { return compress_textures_; }
+
 public:
     // Only public so that .cpp file can use this
     template <class ResourceType>
@@ -189,10 +228,19 @@ private:
     std::unordered_map<REHandle_abstract, std::unordered_set<REHandle_abstract>>
             dependencies_;
 
+    // Bytes per vertex or per index of the buffers, for memory accounting
+    std::unordered_map<REHandle_abstract, size_t> buffer_strides_;
+    size_t memory_budget_ = 0;
+    int max_texture_size_ = 0;
+    bool compress_textures_ = false;
+
     filament::Texture* LoadTextureFromImage(
             const std::shared_ptr<geometry::Image>& image, bool srgb);
     filament::Texture* LoadTextureFromImage(const t::geometry::Image& image,
                                             bool srgb);
+    // Returns nullptr if the image or GPU does not support block compression
+    filament::Texture* LoadCompressedTexture(const geometry::Image& image,
+                                             bool srgb);
     filament::Texture* LoadFilledTexture(const Eigen::Vector3f& color,
                                          size_t dimension);
 
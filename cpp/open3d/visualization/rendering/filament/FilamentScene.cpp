@@ -32,6 +32,12 @@
 //       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
 //       determine the if statement does not run.)
 // 4305: LightManager.h needs to specify some constants as floats
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
 #include <unordered_set>
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -96,6 +102,48 @@ const std::string kBackgroundName = "__background";
 const std::string kGroundPlaneName = "__ground_plane";
 const Eigen::Vector4f kDefaultGroundPlaneColor(0.5f, 0.5f, 0.5f, 1.f);
 
+// Reorders indices[begin, end) into spatially coherent ranges of at most
+// max_points points by recursively splitting at the median of the longest
+// axis, and appends the ranges to chunks.
+void SplitPointCloudChunks(const float* points,
+                           int64_t* indices,
+                           int64_t begin,
+                           int64_t end,
+                           int64_t max_points,
+                           std::vector<std::pair<int64_t, int64_t>>& chunks) {
+    if (end - begin <= max_points) {
+        chunks.emplace_back(begin, end);
+        return;
+    }
+    Eigen::Vector3f min_pt = Eigen::Vector3f::Constant(1e30f);
+    Eigen::Vector3f max_pt = Eigen::Vector3f::Constant(-1e30f);
+    for (int64_t i = begin; i < end; ++i) {
+        Eigen::Map<const Eigen::Vector3f> pt(points + 3 * indices[i]);
+        min_pt = min_pt.cwiseMin(pt);
+        max_pt = max_pt.cwiseMax(pt);
+    }
+    int axis = 0;
+    (max_pt - min_pt).maxCoeff(&axis);
+    const int64_t mid = begin + (end - begin) / 2;
+    std::nth_element(indices + begin, indices + mid, indices + end,
+                     [points, axis](int64_t a, int64_t b) {
+                         return points[3 * a + axis] < points[3 * b + axis];
+                     });
+    SplitPointCloudChunks(points, indices, begin, mid, max_points, chunks);
+    SplitPointCloudChunks(points, indices, mid, end, max_points, chunks);
+}
+
+// Chunks never draw fewer points than this (unless they have fewer), so that
+// distant chunks remain visible.
+const size_t kMinChunkPointsDrawn = 256;
+
+// Triangle meshes with more triangles are not used as occluders, since
+// rasterizing them on the CPU every frame would cost too much.
+const size_t kMaxOccluderTriangles = 4096;
+// Width of the occlusion buffer, in pixels. The height follows the aspect
+// ratio of the view.
+const int kOcclusionBufferWidth = 256;
+
 namespace defaults_mapping {
 
 using GeometryType = open3d::geometry::Geometry::GeometryType;
@@ -120,7 +168,8 @@ std::unordered_map<std::string, MaterialHandle> shader_mappings = {
          ResourceManager::kDefaultUnlitPolygonOffsetShader},
         {"unlitBackground", ResourceManager::kDefaultUnlitBackgroundShader},
         {"infiniteGroundPlane", ResourceManager::kInfinitePlaneShader},
-        {"unlitLine", ResourceManager::kDefaultLineShader}};
+        {"unlitLine", ResourceManager::kDefaultLineShader},
+        {"pointSplat", ResourceManager::kPointSplatShader}};
 
 MaterialHandle kColorOnlyMesh = ResourceManager::kDefaultUnlit;
 MaterialHandle kPlainMesh = ResourceManager::kDefaultLit;
@@ -162,6 +211,51 @@ namespace open3d {
 namespace visualization {
 namespace rendering {
 
+namespace {
+
+// Host copy of the geometry types that AddGeometry() can upload again after
+// the geometry has been evicted
+std::shared_ptr<geometry::Geometry3D> CopyGeometry(
+        const geometry::Geometry3D& geometry) {
+    using GeometryType = geometry::Geometry::GeometryType;
+    switch (geometry.GetGeometryType()) {
+        case GeometryType::PointCloud:
+            return std::make_shared<geometry::PointCloud>(
+                    static_cast<const geometry::PointCloud&>(geometry));
+        case GeometryType::TriangleMesh:
+            return std::make_shared<geometry::TriangleMesh>(
+                    static_cast<const geometry::TriangleMesh&>(geometry));
+        case GeometryType::LineSet:
+            return std::make_shared<geometry::LineSet>(
+                    static_cast<const geometry::LineSet&>(geometry));
+        default:
+            return nullptr;
+    }
+}
+
+}  // namespace
+
+class FilamentScene::GeometryUpdateTimer {
+public:
+    explicit GeometryUpdateTimer(FilamentScene& scene)
+        : scene_(scene), start_(std::chrono::steady_clock::now()) {
+        scene_.geometry_update_depth_ += 1;
+    }
+    ~GeometryUpdateTimer() {
+        scene_.geometry_update_depth_ -= 1;
+        if (scene_.geometry_update_depth_ == 0) {
+            scene_.geometry_update_ms_ +=
+                    std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start_)
+                            .count();
+        }
+    }
+
+private:
+    FilamentScene& scene_;
+    std::chrono::steady_clock::time_point start_;
+};
+
 FilamentScene::FilamentScene(filament::Engine& engine,
                              FilamentResourceManager& resource_mgr,
                              Renderer& renderer)
@@ -180,6 +274,8 @@ Scene* FilamentScene::Copy() {
     copy->geometries_ = this->geometries_;
     copy->lights_ = this->lights_;
     copy->model_geometries_ = this->model_geometries_;
+    copy->chunked_point_clouds_ = this->chunked_point_clouds_;
+    copy->instanced_geometries_ = this->instanced_geometries_;
     copy->background_color_ = this->background_color_;
     copy->background_image_ = this->background_image_;
     copy->ibl_name_ = this->ibl_name_;
@@ -311,7 +407,8 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
                                 const Material& material,
                                 const std::string& downsampled_name /*= ""*/,
                                 size_t downsample_threshold /*= SIZE_MAX*/) {
-    if (geometries_.count(object_name) > 0) {
+    GeometryUpdateTimer timer(*this);
+    if (geometries_.count(object_name) > 0 || FindEvictedSource(object_name)) {
         utility::LogWarning(
                 "Geometry {} has already been added to scene graph.",
                 object_name);
@@ -351,6 +448,16 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     if (material.shader == "unlitLine") {
         buffer_builder->SetWideLines();
     }
+    size_t n_vertices = 0;
+    if (auto cloud = dynamic_cast<const geometry::PointCloud*>(&geometry)) {
+        n_vertices = cloud->points_.size();
+    } else if (tris) {
+        n_vertices = tris->vertices_.size();
+    }
+    if (n_vertices >= packed_vertex_threshold_) {
+        buffer_builder->SetVertexFormat(
+                GeometryBuffersBuilder::VertexFormat::kPacked);
+    }
 
     auto buffers = buffer_builder->ConstructBuffers();
     auto vb = std::get<0>(buffers);
@@ -367,6 +474,19 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
                     "Internal error: could not create downsampled point cloud");
         }
     }
+    if (success && occlusion_culling_ && tris) {
+        KeepOccluder(object_name, *tris);
+    }
+    if (success && resource_mgr_.GetMemoryBudget() > 0) {
+        if (geometry_sources_.count(object_name) == 0) {
+            GeometrySource source;
+            source.geometry = CopyGeometry(geometry);
+            source.downsampled_name = ib_downsampled ? downsampled_name : "";
+            source.downsample_threshold = downsample_threshold;
+            KeepGeometrySource(object_name, std::move(source));
+        }
+        EnforceMemoryBudget();
+    }
     return success;
 }
 
@@ -375,6 +495,7 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
                                 const Material& material,
                                 const std::string& downsampled_name /*= ""*/,
                                 size_t downsample_threshold /*= SIZE_MAX*/) {
+    GeometryUpdateTimer timer(*this);
     // Tensor::Min() and Tensor::Max() can be very slow on certain setups,
     // in particular macOS with clang 11.0.0. This is a temporary fix.
     auto ComputeAABB =
@@ -422,6 +543,12 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
         utility::LogWarning("tensor point cloud must have Dtype of Float32");
         return false;
     }
+    if (size_t(points.GetLength()) > chunking_min_points_) {
+        // LOD replaces the downsampled copy for chunked point clouds.
+        return AddChunkedPointCloud(
+                object_name, SplitPointCloud(point_cloud, points_per_chunk_),
+                material);
+    }
 
     auto buffer_builder = GeometryBuffersBuilder::GetBuilder(point_cloud);
     if (!downsampled_name.empty()) {
@@ -448,9 +575,346 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
                                        vb, ib, material, BufferReuse::kYes);
         }
     }
+    if (success && resource_mgr_.GetMemoryBudget() > 0) {
+        if (geometry_sources_.count(object_name) == 0) {
+            // Tensors are shared, so this does not copy the points.
+            GeometrySource source;
+            source.point_cloud =
+                    std::make_shared<t::geometry::PointCloud>(point_cloud);
+            source.downsampled_name = ib_downsampled ? downsampled_name : "";
+            source.downsample_threshold = downsample_threshold;
+            KeepGeometrySource(object_name, std::move(source));
+        }
+        EnforceMemoryBudget();
+    }
     return success;
 }
 
+FilamentScene::ChunkedPointCloud FilamentScene::SplitPointCloud(
+        const t::geometry::PointCloud& point_cloud, size_t points_per_chunk) {
+    const core::Tensor points = point_cloud.GetPoints().Contiguous();
+    const float* pts = points.GetDataPtr<float>();
+    const int64_t n_points = points.GetLength();
+    std::vector<int64_t> indices(n_points);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    SplitPointCloudChunks(pts, indices.data(), 0, n_points,
+                          int64_t(points_per_chunk), ranges);
+
+    // A fixed seed keeps the subsample of a chunk stable across runs.
+    std::mt19937 rng(0);
+    ChunkedPointCloud chunked;
+    chunked.min_bound = Eigen::Vector3f::Constant(1e30f);
+    chunked.max_bound = Eigen::Vector3f::Constant(-1e30f);
+    for (size_t c = 0; c < ranges.size(); ++c) {
+        const int64_t begin = ranges[c].first;
+        const int64_t end = ranges[c].second;
+        std::shuffle(indices.begin() + begin, indices.begin() + end, rng);
+
+        PointCloudChunk chunk;
+        chunk.num_points = size_t(end - begin);
+        chunk.min_bound = Eigen::Vector3f::Constant(1e30f);
+        chunk.max_bound = Eigen::Vector3f::Constant(-1e30f);
+        for (int64_t i = begin; i < end; ++i) {
+            Eigen::Map<const Eigen::Vector3f> pt(pts + 3 * indices[i]);
+            chunk.min_bound = chunk.min_bound.cwiseMin(pt);
+            chunk.max_bound = chunk.max_bound.cwiseMax(pt);
+        }
+        chunked.min_bound = chunked.min_bound.cwiseMin(chunk.min_bound);
+        chunked.max_bound = chunked.max_bound.cwiseMax(chunk.max_bound);
+
+        const core::Tensor chunk_indices(
+                std::vector<int64_t>(indices.begin() + begin,
+                                     indices.begin() + end),
+                {end - begin}, core::Dtype::Int64);
+        chunk.cloud = std::make_shared<t::geometry::PointCloud>(
+                points.GetDevice());
+        for (const auto& kv : point_cloud.GetPointAttr()) {
+            chunk.cloud->SetPointAttr(
+                    kv.first, kv.second.IndexGet({chunk_indices}).Contiguous());
+        }
+        chunked.chunks.push_back(std::move(chunk));
+    }
+    return chunked;
+}
+
+bool FilamentScene::AddChunkedPointCloud(const std::string& object_name,
+                                         ChunkedPointCloud&& chunked,
+                                         const Material& material) {
+    GeometryUpdateTimer timer(*this);
+    if (geometries_.count(object_name) > 0 || GeometryIsModel(object_name)) {
+        utility::LogWarning(
+                "Geometry {} has already been added to scene graph.",
+                object_name);
+        return false;
+    }
+
+    size_t n_points = 0;
+    for (size_t c = 0; c < chunked.chunks.size(); ++c) {
+        chunked.chunks[c].name = object_name + ".chunk" + std::to_string(c);
+        n_points += chunked.chunks[c].num_points;
+    }
+    const size_t n_chunks = chunked.chunks.size();
+    chunked_point_clouds_[object_name] = std::move(chunked);
+    model_geometries_[object_name] = {};
+
+    // The first chunk is uploaded right away; chunks streamed in later copy
+    // its material, visibility and transform.
+    if (!UploadPointCloudChunk(object_name, 0, material)) {
+        chunked_point_clouds_.erase(object_name);
+        model_geometries_.erase(object_name);
+        return false;
+    }
+    utility::LogDebug("Split point cloud {} ({} points) into {} chunks",
+                      object_name, n_points, n_chunks);
+    return true;
+}
+
+class FilamentScene::PointCloudPreparation
+    : public Scene::GeometryPreparation {
+public:
+    PointCloudPreparation(std::shared_ptr<const t::geometry::PointCloud> cloud,
+                          size_t chunking_min_points,
+                          size_t points_per_chunk)
+        : cloud_(cloud),
+          chunking_min_points_(chunking_min_points),
+          points_per_chunk_(points_per_chunk) {}
+
+    void Run() override {
+        // Clouds that AddGeometry() rejects are not split, so that
+        // AddPreparedGeometry() reports the same warnings.
+        const auto& points = cloud_->GetPoints();
+        split_ = !cloud_->IsEmpty() &&
+                 points.GetDevice().GetType() !=
+                         core::Device::DeviceType::CUDA &&
+                 points.GetDtype() == core::Dtype::Float32 &&
+                 size_t(points.GetLength()) > chunking_min_points_;
+        if (split_) {
+            chunked_ = SplitPointCloud(*cloud_, points_per_chunk_);
+        }
+        has_run_ = true;
+    }
+
+    std::shared_ptr<const t::geometry::PointCloud> cloud_;
+    size_t chunking_min_points_;
+    size_t points_per_chunk_;
+    bool split_ = false;
+    ChunkedPointCloud chunked_;
+    bool has_run_ = false;
+};
+
+std::shared_ptr<Scene::GeometryPreparation> FilamentScene::PrepareGeometry(
+        std::shared_ptr<const t::geometry::PointCloud> point_cloud) {
+    return std::make_shared<PointCloudPreparation>(
+            point_cloud, chunking_min_points_, points_per_chunk_);
+}
+
+bool FilamentScene::AddPreparedGeometry(
+        const std::string& object_name,
+        const GeometryPreparation& prepared,
+        const Material& material,
+        const std::string& downsampled_name /*= ""*/,
+        size_t downsample_threshold /*= SIZE_MAX*/) {
+    GeometryUpdateTimer timer(*this);
+    auto* preparation = dynamic_cast<const PointCloudPreparation*>(&prepared);
+    if (!preparation || !preparation->has_run_) {
+        utility::LogWarning(
+                "Geometry {} was not prepared by this scene or its "
+                "preparation has not run",
+                object_name);
+        return false;
+    }
+    if (preparation->split_) {
+        // Chunks share their tensors with the preparation, so this is cheap.
+        ChunkedPointCloud chunked = preparation->chunked_;
+        return AddChunkedPointCloud(object_name, std::move(chunked), material);
+    }
+    return AddGeometry(object_name, *preparation->cloud_, material,
+                       downsampled_name, downsample_threshold);
+}
+
+bool FilamentScene::UploadPointCloudChunk(const std::string& object_name,
+                                          size_t chunk_index,
+                                          const Material& material) {
+    auto& chunked = chunked_point_clouds_[object_name];
+    auto& chunk = chunked.chunks[chunk_index];
+
+    auto buffer_builder = GeometryBuffersBuilder::GetBuilder(*chunk.cloud);
+    buffer_builder->SetAdjustColorsForSRGBToneMapping(material.sRGB_color);
+    // Chunks are spatially compact, so float16 offsets from the chunk center
+    // are well below the point spacing. Chunks are never updated in place,
+    // which would need the float layout.
+    buffer_builder->SetVertexFormat(
+            GeometryBuffersBuilder::VertexFormat::kPackedHalfPositions);
+    auto buffers = buffer_builder->ConstructBuffers();
+    auto vb = std::get<0>(buffers);
+    auto ib = std::get<1>(buffers);
+
+    filament::math::float3 min(chunk.min_bound.x(), chunk.min_bound.y(),
+                               chunk.min_bound.z());
+    filament::math::float3 max(chunk.max_bound.x(), chunk.max_bound.y(),
+                               chunk.max_bound.z());
+    filament::Box aabb;
+    aabb.set(min, max);
+    if (aabb.isEmpty()) {
+        min -= 1.f;
+        max += 1.f;
+        aabb.set(min, max);
+    }
+    if (!CreateAndAddFilamentEntity(chunk.name, *buffer_builder, aabb, vb, ib,
+                                    material)) {
+        return false;
+    }
+    chunk.uploaded = true;
+    chunk.drawn_points = chunk.num_points;
+    chunked.num_uploaded += 1;
+    model_geometries_[object_name].push_back(chunk.name);
+    return true;
+}
+
+bool FilamentScene::HasPendingStreaming() const {
+    for (const auto& kv : chunked_point_clouds_) {
+        if (kv.second.num_uploaded < kv.second.chunks.size()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FilamentScene::SetPointCloudChunking(size_t min_points,
+                                          size_t points_per_chunk,
+                                          size_t points_per_frame,
+                                          float points_per_pixel) {
+    chunking_min_points_ = min_points;
+    points_per_chunk_ = std::max(points_per_chunk, size_t(1));
+    points_per_frame_ = std::max(points_per_frame, size_t(1));
+    points_per_pixel_ = points_per_pixel;
+}
+
+void FilamentScene::SetPackedVertexThreshold(size_t min_vertices) {
+    packed_vertex_threshold_ = min_vertices;
+}
+
+void FilamentScene::UpdateChunkedPointClouds() {
+    if (chunked_point_clouds_.empty()) {
+        return;
+    }
+    // LOD is chosen for the first active view.
+    FilamentView* view = nullptr;
+    for (auto& pair : views_) {
+        if (pair.second.is_active) {
+            view = pair.second.view.get();
+            break;
+        }
+    }
+    if (!view) {
+        return;
+    }
+    const Camera* camera = view->GetCamera();
+    const bool is_ortho = camera->GetProjection().is_ortho;
+    const Eigen::Vector3f eye = camera->GetPosition();
+    // Pixels covered by one unit of length at unit distance (or at any
+    // distance, for orthographic projections).
+    const float pixels_per_unit =
+            std::abs(camera->GetProjectionMatrix().matrix()(1, 1)) * 0.5f *
+            float(view->GetViewport()[3]);
+
+    auto& renderable_mgr = engine_.getRenderableManager();
+    size_t upload_budget = points_per_frame_;
+    for (auto& kv : chunked_point_clouds_) {
+        const std::string& object_name = kv.first;
+        auto& chunked = kv.second;
+        auto first = geometries_.find(chunked.chunks[0].name);
+        if (first == geometries_.end()) {
+            continue;
+        }
+        RenderableGeometry& reference = first->second;
+        const Transform transform =
+                GetGeometryTransform(chunked.chunks[0].name);
+        const float scale = transform.linear().colwise().norm().maxCoeff();
+
+        std::vector<std::pair<float, size_t>> pending;
+        for (size_t c = 0; c < chunked.chunks.size(); ++c) {
+            auto& chunk = chunked.chunks[c];
+            const Eigen::Vector3f center =
+                    transform * (0.5f * (chunk.min_bound + chunk.max_bound));
+            const float radius =
+                    0.5f * scale * (chunk.max_bound - chunk.min_bound).norm();
+            const float distance = (center - eye).norm();
+            if (!chunk.uploaded) {
+                pending.emplace_back(distance, c);
+                continue;
+            }
+
+            // Screen-space error: draw enough points to cover the projected
+            // area of the chunk's bounding sphere.
+            size_t count = chunk.num_points;
+            if (is_ortho || distance > radius) {
+                const float radius_px =
+                        radius * pixels_per_unit /
+                        (is_ortho ? 1.f : std::max(distance - radius, 1e-6f));
+                const double needed = double(points_per_pixel_) * M_PI *
+                                      double(radius_px) * double(radius_px);
+                if (needed < double(chunk.num_points)) {
+                    count = std::max(size_t(needed), kMinChunkPointsDrawn);
+                    count = std::min(count, chunk.num_points);
+                }
+            }
+            // Avoid resubmitting geometry for small changes.
+            const size_t diff = count > chunk.drawn_points
+                                        ? count - chunk.drawn_points
+                                        : chunk.drawn_points - count;
+            if (diff * 8 > chunk.drawn_points ||
+                (count == chunk.num_points && diff > 0)) {
+                auto g = geometries_.find(chunk.name);
+                if (g != geometries_.end()) {
+                    auto inst = renderable_mgr.getInstance(
+                            g->second.filament_entity);
+                    renderable_mgr.setGeometryAt(
+                            inst, 0,
+                            filament::RenderableManager::PrimitiveType::POINTS,
+                            0, count);
+                    chunk.drawn_points = count;
+                }
+            }
+        }
+
+        // Stream pending chunks, nearest first. At least one chunk is
+        // uploaded per frame even if it exceeds the budget.
+        std::sort(pending.begin(), pending.end());
+        auto reference_inst =
+                renderable_mgr.getInstance(reference.filament_entity);
+        for (const auto& p : pending) {
+            auto& chunk = chunked.chunks[p.second];
+            if (upload_budget == 0) {
+                break;
+            }
+            if (!UploadPointCloudChunk(object_name, p.second,
+                                       reference.mat.properties)) {
+                continue;
+            }
+            upload_budget -= std::min(upload_budget, chunk.num_points);
+            auto& g = geometries_[chunk.name];
+            SetGeometryTransform(chunk.name, transform);
+            auto inst = renderable_mgr.getInstance(g.filament_entity);
+            renderable_mgr.setCastShadows(
+                    inst, renderable_mgr.isShadowCaster(reference_inst));
+            renderable_mgr.setReceiveShadows(
+                    inst, renderable_mgr.isShadowReceiver(reference_inst));
+            renderable_mgr.setCulling(inst, reference.culling_enabled);
+            g.culling_enabled = reference.culling_enabled;
+            if (reference.priority >= 0) {
+                renderable_mgr.setPriority(inst, uint8_t(reference.priority));
+                g.priority = reference.priority;
+            }
+            if (!reference.visible) {
+                scene_->remove(g.filament_entity);
+                g.visible = false;
+            }
+        }
+    }
+}
+
 #ifndef NDEBUG
 void OutputMaterialProperties(const visualization::rendering::Material& mat) {
     utility::LogInfo("Material {}", mat.name);
@@ -493,6 +957,163 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     return true;
 }
 
+// Returns the (N, 4, 4) transforms as a contiguous Float32 CPU tensor, or
+// an empty tensor if they have the wrong shape.
+static core::Tensor InstanceTransformsToCPU(const core::Tensor& transforms) {
+    if (transforms.NumDims() != 3 || transforms.GetShape(1) != 4 ||
+        transforms.GetShape(2) != 4) {
+        utility::LogWarning(
+                "Instance transforms must have shape (N, 4, 4), got {}",
+                transforms.GetShape().ToString());
+        return core::Tensor();
+    }
+    return transforms.To(core::Device("CPU:0"), core::Dtype::Float32)
+            .Contiguous();
+}
+
+static FilamentScene::Transform InstanceTransform(const core::Tensor& cpu,
+                                                  int64_t index) {
+    using RowMajor = Eigen::Matrix<float, 4, 4, Eigen::RowMajor>;
+    Eigen::Map<const RowMajor> m(cpu.GetDataPtr<float>() + 16 * index);
+    return FilamentScene::Transform(Eigen::Matrix4f(m));
+}
+
+bool FilamentScene::AddInstancedGeometry(const std::string& object_name,
+                                         const geometry::Geometry3D& geometry,
+                                         const Material& material,
+                                         const core::Tensor& transforms,
+                                         const core::Tensor& colors) {
+    GeometryUpdateTimer timer(*this);
+    if (geometries_.count(object_name) > 0 || GeometryIsModel(object_name)) {
+        utility::LogWarning(
+                "Geometry {} has already been added to scene graph.",
+                object_name);
+        return false;
+    }
+    if (geometry.IsEmpty()) {
+        utility::LogDebug(
+                "Geometry for object {} is empty. Not adding geometry to scene",
+                object_name);
+        return false;
+    }
+    const core::Tensor cpu_transforms = InstanceTransformsToCPU(transforms);
+    if (cpu_transforms.NumElements() == 0) {
+        return false;
+    }
+    const int64_t n_instances = cpu_transforms.GetLength();
+    core::Tensor cpu_colors;
+    if (colors.NumElements() > 0) {
+        if (colors.GetShape() != core::SizeVector{n_instances, 3}) {
+            utility::LogWarning(
+                    "Instance colors must have shape ({}, 3), got {}",
+                    n_instances, colors.GetShape().ToString());
+            return false;
+        }
+        cpu_colors = colors.To(core::Device("CPU:0"), core::Dtype::Float32)
+                             .Contiguous();
+    }
+
+    auto buffer_builder = GeometryBuffersBuilder::GetBuilder(geometry);
+    if (!buffer_builder) {
+        utility::LogWarning("Geometry type {} is not supported yet!",
+                            static_cast<size_t>(geometry.GetGeometryType()));
+        return false;
+    }
+    buffer_builder->SetAdjustColorsForSRGBToneMapping(material.sRGB_color);
+    if (material.shader == "unlitLine") {
+        buffer_builder->SetWideLines();
+    }
+    auto buffers = buffer_builder->ConstructBuffers();
+    auto vb = std::get<0>(buffers);
+    auto ib = std::get<1>(buffers);
+    filament::Box aabb = buffer_builder->ComputeAABB();
+
+    // Every instance is a renderable of its own, so that Filament culls
+    // instances individually, but all of them draw from the same buffers.
+    model_geometries_[object_name] = {};
+    auto& instance_names = model_geometries_[object_name];
+    instance_names.reserve(n_instances);
+    for (int64_t i = 0; i < n_instances; ++i) {
+        auto name = object_name + ".instance" + std::to_string(i);
+        Material instance_material = material;
+        if (cpu_colors.NumElements() > 0) {
+            const float* c = cpu_colors.GetDataPtr<float>() + 3 * i;
+            instance_material.base_color = {c[0], c[1], c[2],
+                                            material.base_color.w()};
+        }
+        auto reuse = (i == 0 ? BufferReuse::kNo : BufferReuse::kYes);
+        if (!CreateAndAddFilamentEntity(name, *buffer_builder, aabb, vb, ib,
+                                        instance_material, reuse)) {
+            if (i == 0) {
+                resource_mgr_.Destroy(vb);
+                resource_mgr_.Destroy(ib);
+            }
+            RemoveGeometry(object_name);
+            return false;
+        }
+        if (i > 0) {
+            resource_mgr_.ReuseIndexBuffer(ib);
+        }
+        instance_names.push_back(name);
+        SetGeometryTransform(name, InstanceTransform(cpu_transforms, i));
+    }
+    instanced_geometries_[object_name] = size_t(n_instances);
+    return true;
+}
+
+void FilamentScene::UpdateInstanceTransforms(const std::string& object_name,
+                                             const core::Tensor& transforms) {
+    auto found = instanced_geometries_.find(object_name);
+    if (found == instanced_geometries_.end()) {
+        utility::LogWarning("Geometry {} is not an instanced geometry",
+                            object_name);
+        return;
+    }
+    const core::Tensor cpu_transforms = InstanceTransformsToCPU(transforms);
+    if (size_t(cpu_transforms.GetLength()) != found->second) {
+        utility::LogWarning(
+                "Geometry {} has {} instances, but {} transforms were given",
+                object_name, found->second, cpu_transforms.GetLength());
+        return;
+    }
+    const auto& instance_names = model_geometries_[object_name];
+    for (size_t i = 0; i < instance_names.size(); ++i) {
+        SetGeometryTransform(instance_names[i],
+                             InstanceTransform(cpu_transforms, int64_t(i)));
+    }
+}
+
+// Sizes of the vertex attributes each GeometryBuffersBuilder writes:
+// position, normal/tangent quaternion, color and UV.
+static size_t BytesPerVertex(const GeometryBuffersBuilder& builder) {
+    switch (builder.GetVertexFormat()) {
+        case GeometryBuffersBuilder::VertexFormat::kPacked:
+            return 12 + 8 + 4 + 8;
+        case GeometryBuffersBuilder::VertexFormat::kPackedHalfPositions:
+            return 8 + 8 + 4 + 8;
+        case GeometryBuffersBuilder::VertexFormat::kFloat:
+        default:
+            return 12 + 16 + 16 + 8;
+    }
+}
+
+// Points sampled from surfaces (scans, reconstructions) are spread over
+// roughly the area of the two largest extents of their bounding box.
+static float EstimatePointSpacing(const filament::Box& aabb,
+                                  const GeometryBuffersBuilder& builder,
+                                  size_t num_points) {
+    if (builder.GetPrimitiveType() !=
+                filament::RenderableManager::PrimitiveType::POINTS ||
+        num_points == 0) {
+        return 0.f;
+    }
+    float extents[3] = {2.f * aabb.halfExtent.x, 2.f * aabb.halfExtent.y,
+                        2.f * aabb.halfExtent.z};
+    std::sort(extents, extents + 3);
+    float area = extents[2] * std::max(extents[1], 1e-3f * extents[2]);
+    return std::sqrt(area / float(num_points));
+}
+
 bool FilamentScene::CreateAndAddFilamentEntity(
         const std::string& object_name,
         GeometryBuffersBuilder& buffer_builder,
@@ -504,9 +1125,15 @@ bool FilamentScene::CreateAndAddFilamentEntity(
     auto vbuf = resource_mgr_.GetVertexBuffer(vb).lock();
     auto ibuf = resource_mgr_.GetIndexBuffer(ib).lock();
 
+    // The vertex buffer is relative to the builder's position origin, so the
+    // local bounding box is too. SetGeometryTransform() adds the offset back.
+    const auto& origin = buffer_builder.GetPositionOrigin();
+    filament::Box local_aabb = aabb;
+    local_aabb.center -= origin;
+
     auto filament_entity = utils::EntityManager::get().create();
     filament::RenderableManager::Builder builder(1);
-    builder.boundingBox(aabb)
+    builder.boundingBox(local_aabb)
             .layerMask(FilamentView::kAllLayersMask, FilamentView::kMainLayer)
             .castShadows(true)
             .receiveShadows(true)
@@ -520,6 +1147,10 @@ bool FilamentScene::CreateAndAddFilamentEntity(
     if (result == filament::RenderableManager::Builder::Success) {
         scene_->addEntity(filament_entity);
 
+        const bool packed_vertices =
+                (buffer_builder.GetVertexFormat() !=
+                 GeometryBuffersBuilder::VertexFormat::kFloat);
+
         auto giter = geometries_.emplace(std::make_pair(
                 object_name,
                 RenderableGeometry{object_name,
@@ -532,7 +1163,13 @@ bool FilamentScene::CreateAndAddFilamentEntity(
                                    filament_entity,
                                    buffer_builder.GetPrimitiveType(),
                                    vb,
-                                   ib}));
+                                   ib,
+                                   {origin.x, origin.y, origin.z},
+                                   BytesPerVertex(buffer_builder),
+                                   EstimatePointSpacing(
+                                           aabb, buffer_builder,
+                                           ibuf->getIndexCount()),
+                                   packed_vertices}));
 
         SetGeometryTransform(object_name, Transform::Identity());
         UpdateMaterialProperties(giter.first->second);
@@ -557,7 +1194,13 @@ bool FilamentScene::HasGeometry(const std::string& object_name) const {
         return true;
     }
     auto geom_entry = geometries_.find(object_name);
-    return (geom_entry != geometries_.end());
+    return (geom_entry != geometries_.end()) ||
+           FindEvictedSource(object_name) != nullptr;
+}
+
+bool FilamentScene::GeometryIsResident(const std::string& object_name) const {
+    return HasGeometry(object_name) &&
+           FindEvictedSource(object_name) == nullptr;
 }
 
 static void deallocate_vertex_buffer(void* buffer,
@@ -569,10 +1212,26 @@ static void deallocate_vertex_buffer(void* buffer,
 void FilamentScene::UpdateGeometry(const std::string& object_name,
                                    const t::geometry::PointCloud& point_cloud,
                                    uint32_t update_flags) {
+    GeometryUpdateTimer timer(*this);
+    if (chunked_point_clouds_.count(object_name) > 0) {
+        utility::LogWarning(
+                "Point cloud {} was split into chunks and cannot be updated. "
+                "Remove it and add it again instead.",
+                object_name);
+        return;
+    }
     auto geoms = GetGeometry(object_name, false);
     if (!geoms.empty()) {
         // Note: There should only be a single entry in geoms
         auto* g = geoms[0];
+        if (g->occluded) {
+            auto& deferred = deferred_updates_[object_name];
+            deferred.point_cloud = std::make_shared<t::geometry::PointCloud>(
+                    point_cloud.Clone());
+            deferred.mesh.reset();
+            deferred.update_flags |= update_flags;
+            return;
+        }
         auto vbuf_ptr = resource_mgr_.GetVertexBuffer(g->vb).lock();
         auto vbuf = vbuf_ptr.get();
 
@@ -667,22 +1326,148 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
     }
 }
 
-void FilamentScene::RemoveGeometry(const std::string& object_name) {
+void FilamentScene::UpdateGeometry(const std::string& object_name,
+                                   const geometry::TriangleMesh& mesh,
+                                   uint32_t update_flags) {
+    GeometryUpdateTimer timer(*this);
+    auto geoms = GetGeometry(object_name, false);
+    if (geoms.empty()) {
+        return;
+    }
+    // Note: There should only be a single entry in geoms
+    auto* g = geoms[0];
+    if (g->primitive_type !=
+        filament::RenderableManager::PrimitiveType::TRIANGLES) {
+        utility::LogWarning("Geometry {} is not a triangle mesh.", object_name);
+        return;
+    }
+    // Triangle UVs duplicate vertices, so the vertex buffer of a textured
+    // mesh does not correspond to its vertices.
+    if (mesh.HasTriangleUvs()) {
+        utility::LogWarning(
+                "Triangle mesh {} has triangle UVs and cannot be updated. "
+                "Remove it and add it again instead.",
+                object_name);
+        return;
+    }
+    if (occlusion_culling_ &&
+        (update_flags & (kUpdatePointsFlag | kUpdateTrianglesFlag))) {
+        KeepOccluder(object_name, mesh);
+    }
+    if (g->occluded) {
+        auto& deferred = deferred_updates_[object_name];
+        deferred.mesh = std::make_shared<geometry::TriangleMesh>(mesh);
+        deferred.point_cloud.reset();
+        deferred.update_flags |= update_flags;
+        // Keep the bounds current so that the occlusion test sees the move
+        if ((update_flags & kUpdatePointsFlag) && !mesh.vertices_.empty()) {
+            auto& renderable_mgr = engine_.getRenderableManager();
+            renderable_mgr.setAxisAlignedBoundingBox(
+                    renderable_mgr.getInstance(g->filament_entity),
+                    TriangleMeshBuffersBuilder(mesh).ComputeAABB());
+        }
+        return;
+    }
+
+    const bool update_vertices =
+            (update_flags &
+             (kUpdatePointsFlag | kUpdateNormalsFlag | kUpdateColorsFlag));
+    const bool update_triangles = (update_flags & kUpdateTrianglesFlag);
+    auto vbuf = resource_mgr_.GetVertexBuffer(g->vb).lock();
+    if (!vbuf) {
+        return;
+    }
+    if (!update_triangles && mesh.vertices_.size() > vbuf->getVertexCount()) {
+        utility::LogWarning(
+                "Triangle mesh {} has more vertices than before (Old: {}, "
+                "New: {}), which requires kUpdateTrianglesFlag.",
+                object_name, vbuf->getVertexCount(), mesh.vertices_.size());
+        return;
+    }
+
+    TriangleMeshBuffersBuilder builder(mesh);
+    builder.SetVertexFormat(
+            g->packed_vertices ? GeometryBuffersBuilder::VertexFormat::kPacked
+                               : GeometryBuffersBuilder::VertexFormat::kFloat);
+    auto buffers = builder.UpdateBuffers(g->vb, g->ib, update_vertices,
+                                         update_triangles);
+    auto vb = std::get<0>(buffers);
+    auto ib = std::get<1>(buffers);
+    if (!vb || !ib) {
+        utility::LogWarning("Could not update triangle mesh {}.", object_name);
+        return;
+    }
+
+    auto& renderable_mgr = engine_.getRenderableManager();
+    auto inst = renderable_mgr.getInstance(g->filament_entity);
+    if (update_triangles) {
+        auto new_vbuf = resource_mgr_.GetVertexBuffer(vb).lock();
+        auto new_ibuf = resource_mgr_.GetIndexBuffer(ib).lock();
+        renderable_mgr.setGeometryAt(
+                inst, 0, filament::RenderableManager::PrimitiveType::TRIANGLES,
+                new_vbuf.get(), new_ibuf.get(), 0,
+                3 * mesh.triangles_.size());
+        // The old buffers were replaced by larger ones
+        if (vb != g->vb) {
+            resource_mgr_.Destroy(g->vb);
+            g->vb = vb;
+        }
+        if (ib != g->ib) {
+            resource_mgr_.Destroy(g->ib);
+            g->ib = ib;
+        }
+    }
+    if ((update_flags & kUpdatePointsFlag) && !mesh.vertices_.empty()) {
+        renderable_mgr.setAxisAlignedBoundingBox(inst, builder.ComputeAABB());
+    }
+}
+
+void FilamentScene::ReleaseGeometry(const std::string& object_name) {
     auto geoms = GetGeometry(object_name, false);
     if (!geoms.empty()) {
         for (auto* g : geoms) {
             scene_->remove(g->filament_entity);
             g->ReleaseResources(engine_, resource_mgr_);
+            occluders_.erase(g->name);
+            deferred_updates_.erase(g->name);
             geometries_.erase(g->name);
         }
     }
+}
+
+void FilamentScene::RemoveGeometry(const std::string& object_name) {
+    ReleaseGeometry(object_name);
 
     if (GeometryIsModel(object_name)) {
         model_geometries_.erase(object_name);
     }
+    chunked_point_clouds_.erase(object_name);
+    instanced_geometries_.erase(object_name);
+
+    auto source = geometry_sources_.find(object_name);
+    if (source != geometry_sources_.end()) {
+        downsampled_sources_.erase(source->second.downsampled_name);
+        geometry_sources_.erase(source);
+    }
+    auto downsampled = downsampled_sources_.find(object_name);
+    if (downsampled != downsampled_sources_.end()) {
+        // Do not recreate the downsampled copy if the source is evicted
+        auto& owner = geometry_sources_[downsampled->second];
+        owner.downsampled_name.clear();
+        owner.evicted_state.erase(object_name);
+        downsampled_sources_.erase(downsampled);
+    }
+    hidden_since_.erase(object_name);
 }
 
 void FilamentScene::ShowGeometry(const std::string& object_name, bool show) {
+    if (const std::string* source = FindEvictedSource(object_name)) {
+        if (!show) {
+            return;  // evicted geometries are already hidden
+        }
+        RestoreGeometry(std::string(*source));
+    }
+
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         if (g->visible != show) {
@@ -694,9 +1479,19 @@ void FilamentScene::ShowGeometry(const std::string& object_name, bool show) {
             }
         }
     }
+
+    if (show) {
+        hidden_since_.erase(object_name);
+    } else if (!geoms.empty()) {
+        hidden_since_.emplace(object_name, ++visibility_tick_);
+        EnforceMemoryBudget();
+    }
 }
 
 bool FilamentScene::GeometryIsVisible(const std::string& object_name) {
+    if (FindEvictedSource(object_name)) {
+        return false;
+    }
     auto geoms = GetGeometry(object_name);
     if (!geoms.empty()) {
         // NOTE: all meshes of model share same visibility so we only need to
@@ -724,11 +1519,17 @@ FilamentScene::GetGeometryTransformInstance(RenderableGeometry* geom) {
 
 void FilamentScene::SetGeometryTransform(const std::string& object_name,
                                          const Transform& transform) {
+    if (auto* evicted = GetEvictedState(object_name)) {
+        evicted->transform = transform;
+        return;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         auto itransform = GetGeometryTransformInstance(g);
         if (itransform.isValid()) {
-            const auto& ematrix = transform.matrix();
+            const Transform local =
+                    transform * Eigen::Translation3f(g->position_origin);
+            const auto& ematrix = local.matrix();
             auto& transform_mgr = engine_.getTransformManager();
             transform_mgr.setTransform(
                     itransform,
@@ -739,6 +1540,9 @@ void FilamentScene::SetGeometryTransform(const std::string& object_name,
 
 FilamentScene::Transform FilamentScene::GetGeometryTransform(
         const std::string& object_name) {
+    if (auto* evicted = GetEvictedState(object_name)) {
+        return evicted->transform;
+    }
     Transform etransform;
     auto geoms = GetGeometry(object_name);
     if (!geoms.empty()) {
@@ -747,6 +1551,8 @@ FilamentScene::Transform FilamentScene::GetGeometryTransform(
             auto& transform_mgr = engine_.getTransformManager();
             auto ftransform = transform_mgr.getTransform(itransform);
             etransform = converters::EigenMatrixFromFilamentMatrix(ftransform);
+            etransform = etransform *
+                         Eigen::Translation3f(-geoms[0]->position_origin);
         }
     }
     return etransform;
@@ -755,6 +1561,21 @@ FilamentScene::Transform FilamentScene::GetGeometryTransform(
 geometry::AxisAlignedBoundingBox FilamentScene::GetGeometryBoundingBox(
         const std::string& object_name) {
     geometry::AxisAlignedBoundingBox result;
+    auto chunked = chunked_point_clouds_.find(object_name);
+    if (chunked != chunked_point_clouds_.end()) {
+        // Not all chunks may be uploaded yet, so use the stored bounds.
+        const Transform transform = GetGeometryTransform(object_name);
+        const Eigen::Vector3f& min = chunked->second.min_bound;
+        const Eigen::Vector3f& max = chunked->second.max_bound;
+        std::vector<Eigen::Vector3d> corners;
+        for (int corner = 0; corner < 8; ++corner) {
+            const Eigen::Vector3f pt(corner & 1 ? max.x() : min.x(),
+                                     corner & 2 ? max.y() : min.y(),
+                                     corner & 4 ? max.z() : min.z());
+            corners.push_back((transform * pt).cast<double>());
+        }
+        return geometry::AxisAlignedBoundingBox::CreateFromPoints(corners);
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         auto& renderable_mgr = engine_.getRenderableManager();
@@ -789,6 +1610,10 @@ void FilamentScene::GeometryShadows(const std::string& object_name,
 
 void FilamentScene::SetGeometryCulling(const std::string& object_name,
                                        bool enable) {
+    if (auto* evicted = GetEvictedState(object_name)) {
+        evicted->culling_enabled = enable;
+        return;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         auto& renderable_mgr = engine_.getRenderableManager();
@@ -799,8 +1624,155 @@ void FilamentScene::SetGeometryCulling(const std::string& object_name,
     }
 }
 
+void FilamentScene::SetOcclusionCulling(bool enable) {
+    occlusion_culling_ = enable;
+    if (!enable) {
+        for (auto& kv : geometries_) {
+            SetOccluded(kv.second, false);
+        }
+        occluders_.clear();
+        deferred_updates_.clear();
+    }
+}
+
+void FilamentScene::KeepOccluder(const std::string& object_name,
+                                 const geometry::TriangleMesh& mesh) {
+    if (mesh.triangles_.empty() ||
+        mesh.triangles_.size() > kMaxOccluderTriangles) {
+        occluders_.erase(object_name);
+        return;
+    }
+    auto& occluder = occluders_[object_name];
+    occluder.vertices.resize(mesh.vertices_.size());
+    for (size_t i = 0; i < mesh.vertices_.size(); ++i) {
+        occluder.vertices[i] = mesh.vertices_[i].cast<float>();
+    }
+    occluder.triangles = mesh.triangles_;
+}
+
+void FilamentScene::UpdateOcclusion() {
+    std::vector<FilamentView*> views;
+    for (auto& pair : views_) {
+        if (pair.second.is_active) {
+            views.push_back(pair.second.view.get());
+        }
+    }
+    if (views.empty()) {
+        return;
+    }
+
+    auto& renderable_mgr = engine_.getRenderableManager();
+    auto& transform_mgr = engine_.getTransformManager();
+    auto world_transform = [&](RenderableGeometry& g) -> Eigen::Matrix4f {
+        auto itransform = GetGeometryTransformInstance(&g);
+        if (!itransform.isValid()) {
+            return Eigen::Matrix4f::Identity();
+        }
+        return converters::EigenMatrixFromFilamentMatrix(
+                transform_mgr.getWorldTransform(itransform));
+    };
+
+    struct Occludee {
+        RenderableGeometry* geometry;
+        Eigen::Matrix4f model;
+        Eigen::Vector3f min_bound;
+        Eigen::Vector3f max_bound;
+        bool visible;
+    };
+    std::vector<Occludee> occludees;
+    for (auto& kv : geometries_) {
+        auto& g = kv.second;
+        if (!g.visible || !g.culling_enabled) {
+            SetOccluded(g, false);
+            continue;
+        }
+        auto inst = renderable_mgr.getInstance(g.filament_entity);
+        const filament::Box box =
+                renderable_mgr.getAxisAlignedBoundingBox(inst);
+        const Eigen::Vector3f center(box.center.x, box.center.y,
+                                     box.center.z);
+        const Eigen::Vector3f half(box.halfExtent.x, box.halfExtent.y,
+                                   box.halfExtent.z);
+        occludees.push_back({&g, world_transform(g), center - half,
+                             center + half, false});
+    }
+
+    // A geometry is occluded only if it is hidden in all active views
+    for (auto* view : views) {
+        const Camera* camera = view->GetCamera();
+        const auto& viewport = view->GetViewport();
+        const int height = std::max(1, kOcclusionBufferWidth * viewport[3] /
+                                               std::max(viewport[2], 1));
+        const Eigen::Matrix4f world_to_clip =
+                (camera->GetProjectionMatrix() * camera->GetViewMatrix())
+                        .matrix();
+        occlusion_buffer_.Reset(kOcclusionBufferWidth, height, world_to_clip);
+        for (const auto& kv : occluders_) {
+            auto g = geometries_.find(kv.first);
+            if (g == geometries_.end() || !g->second.visible) {
+                continue;
+            }
+            // The occluder has the vertices of the mesh, which are not
+            // relative to the position origin of the vertex buffer.
+            Eigen::Matrix4f model = world_transform(g->second);
+            model.block<3, 1>(0, 3) -=
+                    model.block<3, 3>(0, 0) * g->second.position_origin;
+            occlusion_buffer_.AddOccluder(kv.second.vertices,
+                                          kv.second.triangles, model);
+        }
+        occlusion_buffer_.BuildHierarchy();
+        for (auto& o : occludees) {
+            if (!o.visible) {
+                o.visible = !occlusion_buffer_.IsOccluded(
+                        o.min_bound, o.max_bound, o.model);
+            }
+        }
+    }
+
+    for (auto& o : occludees) {
+        SetOccluded(*o.geometry, !o.visible);
+    }
+}
+
+void FilamentScene::SetOccluded(RenderableGeometry& geom, bool occluded) {
+    if (geom.occluded == occluded) {
+        return;
+    }
+    geom.occluded = occluded;
+    // Occluded geometries stay in the scene but are on no layer, so no view
+    // draws them.
+    auto& renderable_mgr = engine_.getRenderableManager();
+    renderable_mgr.setLayerMask(
+            renderable_mgr.getInstance(geom.filament_entity),
+            FilamentView::kAllLayersMask,
+            occluded ? 0 : FilamentView::kMainLayer);
+    if (occluded) {
+        return;
+    }
+
+    // Apply the updates made while the geometry was occluded
+    auto deferred = deferred_updates_.find(geom.name);
+    if (deferred == deferred_updates_.end() ||
+        deferred->second.update_flags == 0) {
+        return;
+    }
+    const uint32_t flags = deferred->second.update_flags;
+    deferred->second.update_flags = 0;
+    if (deferred->second.mesh) {
+        auto mesh = std::move(deferred->second.mesh);
+        deferred_updates_.erase(deferred);
+        UpdateGeometry(geom.name, *mesh, flags);
+    } else if (deferred->second.point_cloud) {
+        UpdateGeometry(geom.name, *deferred->second.point_cloud, flags);
+    }
+}
+
 void FilamentScene::SetGeometryPriority(const std::string& object_name,
                                         uint8_t priority) {
+    if (auto* evicted = GetEvictedState(object_name)) {
+        evicted->priority = int(priority);
+        return;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         auto& renderable_mgr = engine_.getRenderableManager();
@@ -969,6 +1941,25 @@ void FilamentScene::UpdateUnlitPolygonOffsetShader(
             .Finish();
 }
 
+void FilamentScene::UpdatePointSplatShader(GeometryMaterialInstance& geom_mi,
+                                           float point_spacing) {
+    const auto& material = geom_mi.properties;
+    float radius = material.splat_radius;
+    if (radius <= 0.f) {
+        // Neighboring splats need to overlap a little to close the gaps
+        // between irregularly spaced points.
+        radius = 0.75f * point_spacing;
+    }
+    renderer_.ModifyMaterial(geom_mi.mat_instance)
+            .SetColor("baseColor", material.base_color, true)
+            .SetParameter("pointSize", material.point_size)
+            .SetParameter("maxPointSize", material.max_point_size)
+            .SetParameter("splatRadius", radius)
+            .SetParameter("splatShading", material.splat_shading)
+            .SetParameter("srgbColor", material.sRGB_vertex_color ? 1.f : 0.f)
+            .Finish();
+}
+
 std::shared_ptr<geometry::Image> CombineTextures(
         std::shared_ptr<geometry::Image> ao,
         std::shared_ptr<geometry::Image> rough,
@@ -1129,6 +2120,8 @@ void FilamentScene::UpdateMaterialProperties(RenderableGeometry& geom) {
         UpdateLineShader(geom.mat);
     } else if (props.shader == "unlitPolygonOffset") {
         UpdateUnlitPolygonOffsetShader(geom.mat);
+    } else if (props.shader == "pointSplat") {
+        UpdatePointSplatShader(geom.mat, geom.point_spacing);
     } else {
         utility::LogWarning("'{}' is not a valid shader", props.shader);
     }
@@ -1181,6 +2174,8 @@ void FilamentScene::OverrideMaterialInternal(RenderableGeometry* geom,
             UpdateLineShader(geom->mat);
         } else if (material.shader == "unlitPolygonOffset") {
             UpdateUnlitPolygonOffsetShader(geom->mat);
+        } else if (material.shader == "pointSplat") {
+            UpdatePointSplatShader(geom->mat, geom->point_spacing);
         } else if (material.shader == "depthValue") {
             UpdateDepthValueShader(geom->mat);
         } else {
@@ -1193,6 +2188,10 @@ void FilamentScene::OverrideMaterialInternal(RenderableGeometry* geom,
 
 void FilamentScene::OverrideMaterial(const std::string& object_name,
                                      const Material& material) {
+    if (auto* evicted = GetEvictedState(object_name)) {
+        evicted->material = material;
+        return;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         OverrideMaterialInternal(g, material);
@@ -1213,6 +2212,15 @@ void FilamentScene::OverrideMaterialAll(const Material& material,
         }
         OverrideMaterialInternal(&ge.second, material, shader_only);
     }
+    for (auto& source : geometry_sources_) {
+        for (auto& evicted : source.second.evicted_state) {
+            if (shader_only) {
+                evicted.second.material.shader = material.shader;
+            } else {
+                evicted.second.material = material;
+            }
+        }
+    }
 }
 
 bool FilamentScene::AddPointLight(const std::string& light_name,
@@ -1878,6 +2886,13 @@ void FilamentScene::RenderableGeometry::ReleaseResources(
 }
 
 void FilamentScene::Draw(filament::Renderer& renderer) {
+    UpdateChunkedPointClouds();
+    if (occlusion_culling_) {
+        UpdateOcclusion();
+    }
+    last_geometry_update_ms_ = geometry_update_ms_;
+    geometry_update_ms_ = 0.0;
+    last_num_views_drawn_ = 0;
     for (auto& pair : views_) {
         auto& container = pair.second;
         // Skip inactive views
@@ -1890,6 +2905,209 @@ void FilamentScene::Draw(filament::Renderer& renderer) {
         container.view->PreRender();
         renderer.render(container.view->GetNativeView());
         container.view->PostRender();
+        ++last_num_views_drawn_;
+    }
+}
+
+void FilamentScene::AddRenderStats(RenderStats& stats) const {
+    stats.num_views += last_num_views_drawn_;
+    stats.update_geometry_ms += last_geometry_update_ms_;
+
+    using PrimitiveType = filament::RenderableManager::PrimitiveType;
+    for (const auto& pair : geometries_) {
+        const auto& g = pair.second;
+        auto vbuf = resource_mgr_.GetVertexBuffer(g.vb).lock();
+        auto ibuf = resource_mgr_.GetIndexBuffer(g.ib).lock();
+        if (!vbuf || !ibuf) continue;
+
+        RenderStats::Geometry info;
+        info.name = g.name;
+        info.visible = g.visible;
+        info.occluded = g.occluded;
+        info.num_vertices = vbuf->getVertexCount();
+        size_t num_indices = ibuf->getIndexCount();
+        switch (g.primitive_type) {
+            case PrimitiveType::POINTS:
+                info.num_primitives = num_indices;
+                break;
+            case PrimitiveType::LINES:
+                info.num_primitives = num_indices / 2;
+                break;
+            default:
+                info.num_primitives = num_indices / 3;
+                break;
+        }
+        info.buffer_bytes = info.num_vertices * g.bytes_per_vertex +
+                            num_indices * sizeof(uint32_t);
+
+        if (g.visible && !g.occluded) {
+            size_t drawn = last_num_views_drawn_ * info.num_primitives;
+            switch (g.primitive_type) {
+                case PrimitiveType::POINTS:
+                    stats.num_points += drawn;
+                    break;
+                case PrimitiveType::LINES:
+                    stats.num_lines += drawn;
+                    break;
+                default:
+                    stats.num_triangles += drawn;
+                    break;
+            }
+            stats.num_draw_calls += last_num_views_drawn_;
+        }
+        stats.buffer_bytes += info.buffer_bytes;
+        stats.geometries.emplace_back(std::move(info));
+    }
+    for (const auto& source : geometry_sources_) {
+        if (source.second.evicted) {
+            stats.evicted_geometries.push_back(source.first);
+        }
+    }
+}
+
+const std::string* FilamentScene::FindEvictedSource(
+        const std::string& name) const {
+    auto source = geometry_sources_.find(name);
+    if (source == geometry_sources_.end()) {
+        auto downsampled = downsampled_sources_.find(name);
+        if (downsampled == downsampled_sources_.end()) {
+            return nullptr;
+        }
+        source = geometry_sources_.find(downsampled->second);
+        if (source == geometry_sources_.end()) {
+            return nullptr;
+        }
+    }
+    return source->second.evicted ? &source->first : nullptr;
+}
+
+FilamentScene::EvictedState* FilamentScene::GetEvictedState(
+        const std::string& name) {
+    auto* source = FindEvictedSource(name);
+    if (!source) {
+        return nullptr;
+    }
+    auto& states = geometry_sources_[*source].evicted_state;
+    auto found = states.find(name);
+    return (found != states.end() ? &found->second : nullptr);
+}
+
+void FilamentScene::KeepGeometrySource(const std::string& object_name,
+                                       GeometrySource&& source) {
+    if (!source.geometry && !source.point_cloud) {
+        return;  // not a geometry type that can be uploaded again
+    }
+    if (!source.downsampled_name.empty()) {
+        downsampled_sources_[source.downsampled_name] = object_name;
+    }
+    geometry_sources_[object_name] = std::move(source);
+}
+
+void FilamentScene::EnforceMemoryBudget() {
+    while (resource_mgr_.IsOverMemoryBudget()) {
+        const std::string* lru = nullptr;
+        auto lru_tick = std::numeric_limits<std::uint64_t>::max();
+        for (const auto& source : geometry_sources_) {
+            if (source.second.evicted) {
+                continue;
+            }
+            // The downsampled copy shares the vertex buffer, so it must be
+            // hidden too.
+            bool hidden = true;
+            std::uint64_t tick = 0;
+            for (const auto* name :
+                 {&source.first, &source.second.downsampled_name}) {
+                auto g = geometries_.find(*name);
+                if (g != geometries_.end() && g->second.visible) {
+                    hidden = false;
+                    break;
+                }
+                auto since = hidden_since_.find(*name);
+                if (since != hidden_since_.end()) {
+                    tick = std::max(tick, since->second);
+                }
+            }
+            if (hidden && tick < lru_tick) {
+                lru = &source.first;
+                lru_tick = tick;
+            }
+        }
+        if (!lru) {
+            break;
+        }
+        EvictGeometry(*lru);
+    }
+}
+
+void FilamentScene::EvictGeometry(const std::string& object_name) {
+    auto& source = geometry_sources_[object_name];
+    for (const auto& name : {object_name, source.downsampled_name}) {
+        auto g = geometries_.find(name);
+        if (name.empty() || g == geometries_.end()) {
+            continue;
+        }
+        EvictedState state;
+        state.material = g->second.mat.properties;
+        state.transform = GetGeometryTransform(name);
+        state.visible = g->second.visible;
+        state.culling_enabled = g->second.culling_enabled;
+        state.priority = g->second.priority;
+        source.evicted_state[name] = state;
+        ReleaseGeometry(name);
+    }
+    source.evicted = true;
+    utility::LogDebug("Evicted hidden geometry {} to stay within the budget",
+                      object_name);
+}
+
+void FilamentScene::RestoreGeometry(const std::string& object_name) {
+    auto& source = geometry_sources_[object_name];
+    const auto states = std::move(source.evicted_state);
+    source.evicted_state.clear();
+    source.evicted = false;
+
+    auto main_state = states.find(object_name);
+    const Material material = (main_state != states.end())
+                                      ? main_state->second.material
+                                      : Material();
+    bool success = false;
+    if (source.geometry) {
+        success = AddGeometry(object_name, *source.geometry, material,
+                              source.downsampled_name,
+                              source.downsample_threshold);
+    } else {
+        success = AddGeometry(object_name, *source.point_cloud, material,
+                              source.downsampled_name,
+                              source.downsample_threshold);
+    }
+    if (!success) {
+        utility::LogWarning("Could not upload evicted geometry {} again",
+                            object_name);
+        downsampled_sources_.erase(source.downsampled_name);
+        geometry_sources_.erase(object_name);
+        return;
+    }
+
+    for (const auto& entry : states) {
+        const auto& name = entry.first;
+        const auto& state = entry.second;
+        auto g = geometries_.find(name);
+        if (g == geometries_.end()) {
+            continue;
+        }
+        if (name != object_name) {
+            OverrideMaterialInternal(&g->second, state.material);
+        }
+        SetGeometryTransform(name, state.transform);
+        SetGeometryCulling(name, state.culling_enabled);
+        if (state.priority >= 0) {
+            SetGeometryPriority(name, std::uint8_t(state.priority));
+        }
+        // Not ShowGeometry(), which could evict the geometry again
+        if (!state.visible && g->second.visible) {
+            g->second.visible = false;
+            scene_->remove(g->second.filament_entity);
+        }
     }
 }
 
@@ -48,12 +48,15 @@
 #endif  // _MSC_VER
 
 #include <Eigen/Geometry>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/visualization/rendering/Camera.h"
 #include "open3d/visualization/rendering/Material.h"
+#include "open3d/visualization/rendering/OcclusionBuffer.h"
+#include "open3d/visualization/rendering/RenderStats.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 #include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -127,9 +130,13 @@ public:
     void UpdateGeometry(const std::string& object_name,
                         const t::geometry::PointCloud& point_cloud,
                         uint32_t update_flags) override;
+    void UpdateGeometry(const std::string& object_name,
+                        const geometry::TriangleMesh& mesh,
+                        uint32_t update_flags) override;
     void RemoveGeometry(const std::string& object_name) override;
     void ShowGeometry(const std::string& object_name, bool show) override;
     bool GeometryIsVisible(const std::string& object_name) override;
+    bool GeometryIsResident(const std::string& object_name) const override;
     void SetGeometryTransform(const std::string& object_name,
                               const Transform& transform) override;
     Transform GetGeometryTransform(const std::string& object_name) override;
@@ -140,6 +147,7 @@ public:
                          bool receive_shadows) override;
     void SetGeometryCulling(const std::string& object_name,
                             bool enable) override;
+    void SetOcclusionCulling(bool enable) override;
     void SetGeometryPriority(const std::string& object_name,
                              uint8_t priority) override;
     void OverrideMaterial(const std::string& object_name,
@@ -226,8 +234,55 @@ public:
             std::function<void(std::shared_ptr<geometry::Image>)> callback)
             override;
 
+    bool HasPendingStreaming() const override;
+    std::shared_ptr<GeometryPreparation> PrepareGeometry(
+            std::shared_ptr<const t::geometry::PointCloud> point_cloud)
+            override;
+    bool AddPreparedGeometry(const std::string& object_name,
+                             const GeometryPreparation& prepared,
+                             const Material& material,
+                             const std::string& downsampled_name = "",
+                             size_t downsample_threshold = SIZE_MAX) override;
+    bool AddInstancedGeometry(const std::string& object_name,
+                              const geometry::Geometry3D& geometry,
+                              const Material& material,
+                              const core::Tensor& transforms,
+                              const core::Tensor& colors) override;
+    void UpdateInstanceTransforms(const std::string& object_name,
+                                  const core::Tensor& transforms) override;
+
+    /// Configures how large tensor point clouds are rendered. Clouds with
+    /// more than \p min_points points are split into spatial chunks of at
+    /// most \p points_per_chunk points. Each chunk is a separate renderable
+    /// with a tight bounding box, so Filament culls chunks outside the
+    /// frustum, and draws only as many of its points as its screen size
+    /// needs (\p points_per_pixel per pixel of projected area). Chunks are
+    /// uploaded over several frames, nearest first, at most
+    /// \p points_per_frame points per frame. Applies to clouds added
+    /// afterwards.
+    void SetPointCloudChunking(size_t min_points,
+                               size_t points_per_chunk,
+                               size_t points_per_frame,
+                               float points_per_pixel);
+
+    /// Legacy geometries with at least \p min_vertices vertices are uploaded
+    /// with interleaved, quantized vertices (snorm16 normals, unorm8 colors),
+    /// which roughly halves their GPU memory. Applies to geometries added
+    /// afterwards. Chunked tensor point clouds (see SetPointCloudChunking())
+    /// are always packed, with float16 positions.
+    void SetPackedVertexThreshold(size_t min_vertices);
+
     void Draw(filament::Renderer& renderer);
 
+    /// Adds the counts of the last Draw() and this scene's geometries to
+    /// \p stats.
+    void AddRenderStats(RenderStats& stats) const;
+
+    /// Releases the buffers of hidden geometries, least recently hidden
+    /// first, while the resource manager is over its memory budget. Called
+    /// automatically when geometry is added or hidden.
+    void EnforceMemoryBudget();
+
     // NOTE: Can GetNativeScene be removed?
     filament::Scene* GetNativeScene() const { return scene_; }
 
@@ -236,6 +291,22 @@ private:
             filament::RenderableManager::Builder& builder,
             const Material& material);
     enum BufferReuse { kNo, kYes };
+    struct ChunkedPointCloud;
+    struct RenderableGeometry;
+    bool AddChunkedPointCloud(const std::string& object_name,
+                              ChunkedPointCloud&& chunked,
+                              const Material& material);
+    bool UploadPointCloudChunk(const std::string& object_name,
+                               size_t chunk_index,
+                               const Material& material);
+    void UpdateChunkedPointClouds();
+    void ReleaseGeometry(const std::string& object_name);
+    void KeepOccluder(const std::string& object_name,
+                      const geometry::TriangleMesh& mesh);
+    void UpdateOcclusion();
+    void SetOccluded(RenderableGeometry& geom, bool occluded);
+    void EvictGeometry(const std::string& object_name);
+    void RestoreGeometry(const std::string& object_name);
     bool CreateAndAddFilamentEntity(
             const std::string& object_name,
             GeometryBuffersBuilder& buffer_builder,
@@ -289,6 +360,16 @@ private:
         filament::RenderableManager::PrimitiveType primitive_type;
         VertexBufferHandle vb;
         IndexBufferHandle ib;
+        // Vertex positions are relative to this point (packed formats)
+        Eigen::Vector3f position_origin = Eigen::Vector3f::Zero();
+        // Estimated from the vertex format, for RenderStats
+        size_t bytes_per_vertex = 0;
+        // Estimated distance between neighboring points, for point splats
+        float point_spacing = 0.f;
+        // Whether the vertex buffer uses one of the packed vertex formats
+        bool packed_vertices = false;
+        // Hidden by occlusion culling, independently of visible
+        bool occluded = false;
         void ReleaseResources(filament::Engine& engine,
                               FilamentResourceManager& manager);
     };
@@ -327,6 +408,8 @@ private:
     void UpdateGroundPlaneShader(GeometryMaterialInstance& geom_mi);
     void UpdateLineShader(GeometryMaterialInstance& geom_mi);
     void UpdateUnlitPolygonOffsetShader(GeometryMaterialInstance& geom_mi);
+    void UpdatePointSplatShader(GeometryMaterialInstance& geom_mi,
+                                float point_spacing);
     utils::EntityInstance<filament::TransformManager>
     GetGeometryTransformInstance(RenderableGeometry* geom);
     void CreateSunDirectionalLight();
@@ -337,6 +420,104 @@ private:
     std::unordered_map<std::string, LightEntity> lights_;
     std::unordered_map<std::string, std::vector<std::string>> model_geometries_;
 
+    // Large tensor point clouds are split into spatial chunks. Uploaded
+    // chunks are renderables listed under the object name in
+    // model_geometries_, so per-object operations apply to all of them.
+    // The points of a chunk are shuffled, so any prefix of the vertex
+    // buffer is a uniform subsample; LOD selection draws such a prefix.
+    struct PointCloudChunk {
+        std::string name;
+        // Host copy of the chunk. Filament reads vertex data asynchronously
+        // from it, so it is kept alive as long as the chunk.
+        std::shared_ptr<t::geometry::PointCloud> cloud;
+        Eigen::Vector3f min_bound;
+        Eigen::Vector3f max_bound;
+        size_t num_points = 0;
+        size_t drawn_points = 0;
+        bool uploaded = false;
+    };
+    struct ChunkedPointCloud {
+        std::vector<PointCloudChunk> chunks;
+        Eigen::Vector3f min_bound;
+        Eigen::Vector3f max_bound;
+        size_t num_uploaded = 0;
+    };
+    // Thread-safe; chunk names are assigned by AddChunkedPointCloud().
+    static ChunkedPointCloud SplitPointCloud(
+            const t::geometry::PointCloud& point_cloud,
+            size_t points_per_chunk);
+    class PointCloudPreparation;
+    std::unordered_map<std::string, ChunkedPointCloud> chunked_point_clouds_;
+    size_t chunking_min_points_ = 4000000;
+    size_t points_per_chunk_ = 262144;
+    size_t points_per_frame_ = 2000000;
+    float points_per_pixel_ = 1.f;
+    size_t packed_vertex_threshold_ = 1000000;
+
+    // For RenderStats. Time spent adding and updating geometry accumulates
+    // until the next Draw(); nested calls are only timed once.
+    double geometry_update_ms_ = 0.0;
+    double last_geometry_update_ms_ = 0.0;
+    int geometry_update_depth_ = 0;
+    size_t last_num_views_drawn_ = 0;
+    class GeometryUpdateTimer;
+
+    // Occlusion culling (see SetOcclusionCulling()). Small triangle meshes
+    // keep a host copy of their triangles, which is rasterized into the
+    // occlusion buffer of each active view before drawing. Updates of
+    // occluded geometries are kept until they become visible; the last
+    // applied point cloud is kept alive because Filament reads it
+    // asynchronously.
+    struct Occluder {
+        std::vector<Eigen::Vector3f> vertices;
+        std::vector<Eigen::Vector3i> triangles;
+    };
+    struct DeferredUpdate {
+        std::shared_ptr<geometry::TriangleMesh> mesh;
+        std::shared_ptr<t::geometry::PointCloud> point_cloud;
+        uint32_t update_flags = 0;
+    };
+    bool occlusion_culling_ = false;
+    std::unordered_map<std::string, Occluder> occluders_;
+    std::unordered_map<std::string, DeferredUpdate> deferred_updates_;
+    OcclusionBuffer occlusion_buffer_;
+
+    // While a memory budget is set, geometries added with AddGeometry() keep
+    // a host copy so that their buffers can be released when they are
+    // hidden (evicted) and uploaded again when they are shown.
+    struct EvictedState {
+        Material material;
+        Transform transform;
+        bool visible = false;
+        bool culling_enabled = true;
+        int priority = -1;
+    };
+    struct GeometrySource {
+        std::shared_ptr<geometry::Geometry3D> geometry;
+        std::shared_ptr<t::geometry::PointCloud> point_cloud;
+        std::string downsampled_name;
+        size_t downsample_threshold = SIZE_MAX;
+        bool evicted = false;
+        // Keyed by the object name and the downsampled name
+        std::unordered_map<std::string, EvictedState> evicted_state;
+    };
+    // Returns the object name of the evicted source that \p name belongs
+    // to, or nullptr.
+    const std::string* FindEvictedSource(const std::string& name) const;
+    EvictedState* GetEvictedState(const std::string& name);
+    void KeepGeometrySource(const std::string& object_name,
+                            GeometrySource&& source);
+    std::unordered_map<std::string, GeometrySource> geometry_sources_;
+    // Maps downsampled names to the object name of their source
+    std::unordered_map<std::string, std::string> downsampled_sources_;
+    // When each hidden geometry was hidden, for least recently used eviction
+    std::unordered_map<std::string, std::uint64_t> hidden_since_;
+    std::uint64_t visibility_tick_ = 0;
+
+    // Instanced geometries are models whose renderables share one vertex
+    // and index buffer; this maps their names to the instance count.
+    std::unordered_map<std::string, size_t> instanced_geometries_;
+
     Eigen::Vector4f background_color_;
     std::shared_ptr<geometry::Image> background_image_;
     std::string ibl_name_;
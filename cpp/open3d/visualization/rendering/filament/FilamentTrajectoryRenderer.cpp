@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/rendering/filament/FilamentTrajectoryRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+FilamentTrajectoryRenderer::FilamentTrajectoryRenderer(
+        int width, int height, const TrajectoryRenderOption& option)
+    : width_(width),
+      height_(height),
+      option_(option),
+      // Each pose needs a color and a depth view, which the batch renderer
+      // draws in separate frames.
+      batch_(width, height, option.poses_per_frame, option.frames_in_flight) {}
+
+bool FilamentTrajectoryRenderer::Render(
+        const camera::PinholeCameraTrajectory& trajectory,
+        const FrameCallback& on_frame) {
+    const auto& poses = trajectory.parameters_;
+    for (const auto& pose : poses) {
+        if (pose.intrinsic_.width_ != width_ ||
+            pose.intrinsic_.height_ != height_) {
+            utility::LogWarning(
+                    "Trajectory intrinsic size {}x{} does not match the "
+                    "renderer size {}x{}",
+                    pose.intrinsic_.width_, pose.intrinsic_.height_, width_,
+                    height_);
+            return false;
+        }
+    }
+
+    // The color and depth images of a pose arrive separately and are paired
+    // up here. All callbacks run on this thread, within Flush().
+    struct PendingPose {
+        std::shared_ptr<geometry::Image> color;
+        std::shared_ptr<geometry::Image> depth;
+        int n_received = 0;
+    };
+    std::unordered_map<size_t, PendingPose> pending;
+    bool success = true;
+
+    const size_t poses_per_job = size_t(std::max(1, option_.poses_per_frame));
+    for (size_t start = 0; start < poses.size(); start += poses_per_job) {
+        const size_t end = std::min(poses.size(), start + poses_per_job);
+        FilamentBatchRenderer::Job job;
+        for (size_t i = start; i < end; ++i) {
+            FilamentBatchRenderer::ViewRequest view;
+            view.intrinsic = poses[i].intrinsic_.intrinsic_matrix_;
+            view.extrinsic = poses[i].extrinsic_;
+            job.views.push_back(view);
+            view.depth = true;
+            view.depth_in_view_space = true;
+            job.views.push_back(view);
+        }
+        job.on_image = [this, start, &pending, &success, &on_frame](
+                               size_t view_index,
+                               std::shared_ptr<geometry::Image> image) {
+            const size_t pose_index = start + view_index / 2;
+            auto& pose = pending[pose_index];
+            if (view_index % 2 == 0) {
+                pose.color = image;
+            } else if (image) {
+                pose.depth = ConvertDepth(*image);
+            }
+            if (++pose.n_received < 2) {
+                return;
+            }
+            if (!pose.color || !pose.depth) {
+                success = false;
+                pose.color.reset();
+                pose.depth.reset();
+            }
+            on_frame(pose_index, pose.color, pose.depth);
+            pending.erase(pose_index);
+        };
+        batch_.Enqueue(std::move(job));
+    }
+    batch_.Flush();
+    return success;
+}
+
+bool FilamentTrajectoryRenderer::RenderToDirectory(
+        const camera::PinholeCameraTrajectory& trajectory,
+        const std::string& directory) {
+    const std::string color_dir = directory + "/color";
+    const std::string depth_dir = directory + "/depth";
+    if (!utility::filesystem::MakeDirectoryHierarchy(color_dir) ||
+        !utility::filesystem::MakeDirectoryHierarchy(depth_dir)) {
+        utility::LogWarning("Could not create the directories in {}",
+                            directory);
+        return false;
+    }
+
+    // Writes are queued while the next poses render. The queue is bounded,
+    // so rendering waits if encoding falls behind.
+    io::AsyncWriter writer(option_.writer_option);
+    std::vector<std::future<bool>> writes;
+    bool rendered = Render(
+            trajectory,
+            [&](size_t pose_index, std::shared_ptr<geometry::Image> color,
+                std::shared_ptr<geometry::Image> depth) {
+                if (!color || !depth) {
+                    return;
+                }
+                auto filename = fmt::format("{:06d}.png", pose_index);
+                writes.push_back(writer.WriteImage(color_dir + "/" + filename,
+                                                   std::move(*color)));
+                writes.push_back(writer.WriteImage(depth_dir + "/" + filename,
+                                                   std::move(*depth)));
+            });
+
+    bool written = true;
+    for (auto& write : writes) {
+        try {
+            written = write.get() && written;
+        } catch (const std::exception& e) {
+            utility::LogWarning("Writing a trajectory image failed: {}",
+                                e.what());
+            written = false;
+        }
+    }
+    return rendered && written;
+}
+
+std::shared_ptr<geometry::Image> FilamentTrajectoryRenderer::ConvertDepth(
+        const geometry::Image& depth) const {
+    auto converted = std::make_shared<geometry::Image>();
+    converted->Prepare(depth.width_, depth.height_, 1, 2);
+    const auto* src = depth.PointerAs<float>();
+    auto* dst = converted->PointerAs<uint16_t>();
+    const size_t n_pixels = size_t(depth.width_) * depth.height_;
+    for (size_t i = 0; i < n_pixels; ++i) {
+        const double value = std::round(src[i] * option_.depth_scale);
+        dst[i] = (value > 0.0 && value <= 65535.0) ? uint16_t(value) : 0;
+    }
+    return converted;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "open3d/io/AsyncWriter.h"
+#include "open3d/visualization/rendering/filament/FilamentBatchRenderer.h"
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraTrajectory;
+}  // namespace camera
+
+namespace geometry {
+class Image;
+}  // namespace geometry
+
+namespace visualization {
+namespace rendering {
+
+class Open3DScene;
+
+/// \struct TrajectoryRenderOption
+///
+/// Options of FilamentTrajectoryRenderer.
+struct TrajectoryRenderOption {
+    /// Number of poses rendered per frame
+    int poses_per_frame = 4;
+    /// Maximal number of frames being read back at the same time
+    int frames_in_flight = 2;
+    /// Depth images are 16 bit, with depth_scale units per scene unit.
+    /// Depths that do not fit are stored as 0.
+    double depth_scale = 1000.0;
+    /// Threads and queue of RenderToDirectory()
+    io::AsyncWriterOption writer_option;
+};
+
+/// Renders color and depth images of GetScene() from every pose of a camera
+/// trajectory, e.g. to generate synthetic RGBD datasets. The poses are
+/// rendered with a FilamentBatchRenderer, so that several poses share a frame
+/// and frames are read back while the next ones render, and the images are
+/// written by an io::AsyncWriter, so that encoding does not stall rendering.
+///
+/// All intrinsics of the trajectory must have the size given to the
+/// constructor. See FilamentBatchRenderer for the engine requirements.
+class FilamentTrajectoryRenderer {
+public:
+    /// Called once per pose, in the order of the poses. The color image is
+    /// 8 bit RGB and the depth image 16 bit (see
+    /// TrajectoryRenderOption::depth_scale). Both are nullptr if the pose
+    /// could not be rendered.
+    using FrameCallback =
+            std::function<void(size_t pose_index,
+                               std::shared_ptr<geometry::Image> color,
+                               std::shared_ptr<geometry::Image> depth)>;
+
+    FilamentTrajectoryRenderer(int width,
+                               int height,
+                               const TrajectoryRenderOption& option = {});
+
+    Open3DScene& GetScene() { return batch_.GetScene(); }
+
+    /// Renders all poses of \p trajectory. Returns false if a pose could not
+    /// be rendered.
+    bool Render(const camera::PinholeCameraTrajectory& trajectory,
+                const FrameCallback& on_frame);
+
+    /// Renders all poses of \p trajectory and writes them to
+    /// \p directory/color/000000.png and \p directory/depth/000000.png, etc.
+    /// Returns false if a pose could not be rendered or written.
+    bool RenderToDirectory(const camera::PinholeCameraTrajectory& trajectory,
+                           const std::string& directory);
+
+private:
+    std::shared_ptr<geometry::Image> ConvertDepth(
+            const geometry::Image& depth) const;
+
+    int width_;
+    int height_;
+    TrajectoryRenderOption option_;
+    FilamentBatchRenderer batch_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -209,7 +209,7 @@ LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructThinLines() {
 
     VertexBufferHandle vb_handle;
     if (vbuf) {
-        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf, sizeof(ColoredVertex));
     } else {
         free(vertices);
         free(indices);
@@ -331,7 +331,7 @@ LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructBuffers() {
 
     VertexBufferHandle vb_handle;
     if (vbuf) {
-        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf, sizeof(ColoredVertex));
     } else {
         free(vertices);
         free(indices);
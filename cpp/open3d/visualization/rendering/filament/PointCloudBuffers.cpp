@@ -47,6 +47,7 @@
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -85,7 +86,7 @@ struct ColoredVertex {
         position.z = float_pos(2);
     }
 
-    float sRGBToLinear(float color) {
+    static float sRGBToLinear(float color) {
         return color <= 0.04045f ? color / 12.92f
                                  : pow((color + 0.055f) / 1.055f, 2.4f);
     }
@@ -103,6 +104,55 @@ struct ColoredVertex {
         }
     }
 };
+
+// Interleaved vertex of VertexFormat::kPacked: 32 bytes instead of the 52
+// bytes of ColoredVertex.
+struct PackedVertex {
+    math::float3 position = {0.f, 0.f, 0.f};
+    math::short4 tangent = {0, 0, 0, 32767};
+    math::ubyte4 color = {255, 255, 255, 255};
+    math::float2 uv = {0.f, 0.f};
+};
+
+// Interleaved vertex of VertexFormat::kPackedHalfPositions (28 bytes). The
+// position is a half4 relative to the builder's position origin.
+struct PackedHalfVertex {
+    math::ushort4 position = {0, 0, 0, 0x3c00};  // w = 1.0
+    math::short4 tangent = {0, 0, 0, 32767};
+    math::ubyte4 color = {255, 255, 255, 255};
+    math::float2 uv = {0.f, 0.f};
+};
+
+// Number of vertices converted per task when filling packed buffers.
+static const int64_t kPackedGrainSize = 16384;
+
+template <typename VertexType>
+VertexBuffer* BuildPackedVertexBuffer(filament::Engine& engine,
+                                      std::uint32_t n_vertices,
+                                      VertexBuffer::AttributeType position) {
+    // See ConstructBuffers() for the CUSTOM0 workaround.
+    return VertexBuffer::Builder()
+            .bufferCount(1)
+            .vertexCount(n_vertices)
+            .attribute(VertexAttribute::POSITION, 0, position,
+                       offsetof(VertexType, position), sizeof(VertexType))
+            .normalized(VertexAttribute::COLOR)
+            .attribute(VertexAttribute::COLOR, 0,
+                       VertexBuffer::AttributeType::UBYTE4,
+                       offsetof(VertexType, color), sizeof(VertexType))
+            .normalized(VertexAttribute::TANGENTS)
+            .attribute(VertexAttribute::TANGENTS, 0,
+                       VertexBuffer::AttributeType::SHORT4,
+                       offsetof(VertexType, tangent), sizeof(VertexType))
+            .normalized(VertexAttribute::CUSTOM0)
+            .attribute(VertexAttribute::CUSTOM0, 0,
+                       VertexBuffer::AttributeType::SHORT4,
+                       offsetof(VertexType, tangent), sizeof(VertexType))
+            .attribute(VertexAttribute::UV0, 0,
+                       VertexBuffer::AttributeType::FLOAT2,
+                       offsetof(VertexType, uv), sizeof(VertexType))
+            .build(engine);
+}
 }  // namespace
 
 IndexBufferHandle GeometryBuffersBuilder::CreateIndexBuffer(
@@ -177,6 +227,10 @@ RenderableManager::PrimitiveType PointCloudBuffersBuilder::GetPrimitiveType()
 }
 
 GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
+    if (vertex_format_ != VertexFormat::kFloat) {
+        return ConstructPackedBuffers();
+    }
+
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
@@ -215,7 +269,7 @@ GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
 
     VertexBufferHandle vb_handle;
     if (vbuf) {
-        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf, sizeof(ColoredVertex));
     } else {
         return {};
     }
@@ -281,6 +335,88 @@ GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
     return std::make_tuple(vb_handle, ib_handle, downsampled_handle);
 }
 
+GeometryBuffersBuilder::Buffers
+PointCloudBuffersBuilder::ConstructPackedBuffers() {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    // Double precision points do not survive a conversion to float16, so
+    // kPackedHalfPositions is treated as kPacked here.
+    const size_t n_vertices = geometry_.points_.size();
+    VertexBuffer* vbuf = BuildPackedVertexBuffer<PackedVertex>(
+            engine, std::uint32_t(n_vertices),
+            VertexBuffer::AttributeType::FLOAT3);
+    if (!vbuf) {
+        return {};
+    }
+    auto vb_handle = resource_mgr.AddVertexBuffer(vbuf, sizeof(PackedVertex));
+
+    std::vector<float> quats;
+    if (geometry_.HasNormals()) {
+        std::vector<float> normals(3 * n_vertices);
+        utility::ParallelFor(
+                0, int64_t(n_vertices),
+                [&](int64_t i) {
+                    const auto& n = geometry_.normals_[i];
+                    normals[3 * i] = float(n.x());
+                    normals[3 * i + 1] = float(n.y());
+                    normals[3 * i + 2] = float(n.z());
+                },
+                kPackedGrainSize);
+        quats.resize(4 * n_vertices);
+        ComputeTangentQuats(normals.data(), n_vertices, quats.data());
+    }
+
+    const size_t vertices_byte_count = n_vertices * sizeof(PackedVertex);
+    auto* vertices = static_cast<PackedVertex*>(malloc(vertices_byte_count));
+    const bool has_colors = geometry_.HasColors();
+    const bool adjust_for_srgb = adjust_colors_for_srgb_tonemapping_;
+    utility::ParallelFor(
+            0, int64_t(n_vertices),
+            [&](int64_t i) {
+                PackedVertex& element = vertices[i];
+                const auto& p = geometry_.points_[i];
+                element.position = {float(p.x()), float(p.y()), float(p.z())};
+                if (has_colors) {
+                    for (int c = 0; c < 3; ++c) {
+                        float value = float(geometry_.colors_[i](c));
+                        if (adjust_for_srgb) {
+                            value = ColoredVertex::sRGBToLinear(value);
+                        }
+                        element.color[c] = ToUnorm8(value);
+                    }
+                    element.color[3] = 255;
+                } else {
+                    // Same mid-gray as ColoredVertex
+                    element.color = {128, 128, 128, 255};
+                }
+                if (!quats.empty()) {
+                    for (int c = 0; c < 4; ++c) {
+                        element.tangent[c] = ToSnorm16(quats[4 * i + c]);
+                    }
+                } else {
+                    element.tangent = {0, 0, 0, 32767};
+                }
+                element.uv = {0.f, 0.f};
+            },
+            kPackedGrainSize);
+
+    VertexBuffer::BufferDescriptor vb_descriptor(
+            vertices, vertices_byte_count,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+
+    auto ib_handle = CreateIndexBuffer(n_vertices);
+
+    IndexBufferHandle downsampled_handle;
+    if (n_vertices >= downsample_threshold_) {
+        downsampled_handle =
+                CreateIndexBuffer(n_vertices, downsample_threshold_);
+    }
+
+    return std::make_tuple(vb_handle, ib_handle, downsampled_handle);
+}
+
 filament::Box PointCloudBuffersBuilder::ComputeAABB() {
     const auto geometry_aabb = geometry_.GetAxisAlignedBoundingBox();
 
@@ -307,6 +443,10 @@ RenderableManager::PrimitiveType TPointCloudBuffersBuilder::GetPrimitiveType()
 }
 
 GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
+    if (vertex_format_ != VertexFormat::kFloat) {
+        return ConstructPackedBuffers();
+    }
+
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
@@ -340,7 +480,8 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
 
     VertexBufferHandle vb_handle;
     if (vbuf) {
-        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+        vb_handle = resource_mgr.AddVertexBuffer(
+                vbuf, (3 + 3 + 4 + 2) * sizeof(float));
     } else {
         return {};
     }
@@ -447,6 +588,150 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
     return std::make_tuple(vb_handle, ib_handle, downsampled_handle);
 }
 
+GeometryBuffersBuilder::Buffers
+TPointCloudBuffersBuilder::ConstructPackedBuffers() {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    // Same dtype assumptions as ConstructBuffers()
+    const float* points =
+            static_cast<const float*>(geometry_.GetPoints().GetDataPtr());
+    const size_t n_vertices = geometry_.GetPoints().GetLength();
+    const bool half_positions =
+            (vertex_format_ == VertexFormat::kPackedHalfPositions);
+
+    VertexBuffer* vbuf = nullptr;
+    if (half_positions) {
+        vbuf = BuildPackedVertexBuffer<PackedHalfVertex>(
+                engine, std::uint32_t(n_vertices),
+                VertexBuffer::AttributeType::HALF4);
+    } else {
+        vbuf = BuildPackedVertexBuffer<PackedVertex>(
+                engine, std::uint32_t(n_vertices),
+                VertexBuffer::AttributeType::FLOAT3);
+    }
+    if (!vbuf) {
+        return {};
+    }
+    auto vb_handle = resource_mgr.AddVertexBuffer(
+            vbuf, half_positions ? sizeof(PackedHalfVertex)
+                                 : sizeof(PackedVertex));
+
+    position_origin_ = {0.f, 0.f, 0.f};
+    if (half_positions && n_vertices > 0) {
+        position_origin_ = ComputeAABB().center;
+    }
+
+    std::vector<float> quats;
+    if (geometry_.HasPointNormals()) {
+        quats.resize(4 * n_vertices);
+        ComputeTangentQuats(static_cast<const float*>(
+                                    geometry_.GetPointNormals().GetDataPtr()),
+                            n_vertices, quats.data());
+    }
+
+    const std::uint8_t* colors_uint8 = nullptr;
+    const float* colors_float = nullptr;
+    if (geometry_.HasPointColors()) {
+        const auto& colors = geometry_.GetPointColors();
+        if (colors.GetDtype() == core::Dtype::UInt8) {
+            colors_uint8 =
+                    static_cast<const std::uint8_t*>(colors.GetDataPtr());
+        } else {
+            colors_float = static_cast<const float*>(colors.GetDataPtr());
+        }
+    }
+
+    const float* uvs = nullptr;
+    const float* scalars = nullptr;
+    if (geometry_.HasPointAttr("uv")) {
+        uvs = static_cast<const float*>(
+                geometry_.GetPointAttr("uv").GetDataPtr());
+    } else if (geometry_.HasPointAttr("__visualization_scalar")) {
+        scalars = static_cast<const float*>(
+                geometry_.GetPointAttr("__visualization_scalar").GetDataPtr());
+    }
+
+    // Both vertex types share the layout after the position.
+    const auto fill_attributes = [&](auto& element, int64_t i) {
+        if (colors_uint8) {
+            element.color = {colors_uint8[3 * i], colors_uint8[3 * i + 1],
+                             colors_uint8[3 * i + 2], 255};
+        } else if (colors_float) {
+            element.color = {ToUnorm8(colors_float[3 * i]),
+                             ToUnorm8(colors_float[3 * i + 1]),
+                             ToUnorm8(colors_float[3 * i + 2]), 255};
+        } else {
+            element.color = {255, 255, 255, 255};
+        }
+        if (!quats.empty()) {
+            for (int c = 0; c < 4; ++c) {
+                element.tangent[c] = ToSnorm16(quats[4 * i + c]);
+            }
+        } else {
+            element.tangent = {0, 0, 0, 32767};
+        }
+        if (uvs) {
+            element.uv = {uvs[2 * i], uvs[2 * i + 1]};
+        } else if (scalars) {
+            element.uv = {scalars[i], 0.f};
+        } else {
+            element.uv = {0.f, 0.f};
+        }
+    };
+
+    void* vertices = nullptr;
+    size_t vertices_byte_count = 0;
+    if (half_positions) {
+        vertices_byte_count = n_vertices * sizeof(PackedHalfVertex);
+        auto* half_vertices =
+                static_cast<PackedHalfVertex*>(malloc(vertices_byte_count));
+        const math::float3 origin = position_origin_;
+        utility::ParallelFor(
+                0, int64_t(n_vertices),
+                [&](int64_t i) {
+                    PackedHalfVertex& element = half_vertices[i];
+                    for (int c = 0; c < 3; ++c) {
+                        element.position[c] =
+                                ToHalf(points[3 * i + c] - origin[c]);
+                    }
+                    element.position[3] = 0x3c00;
+                    fill_attributes(element, i);
+                },
+                kPackedGrainSize);
+        vertices = half_vertices;
+    } else {
+        vertices_byte_count = n_vertices * sizeof(PackedVertex);
+        auto* float_vertices =
+                static_cast<PackedVertex*>(malloc(vertices_byte_count));
+        utility::ParallelFor(
+                0, int64_t(n_vertices),
+                [&](int64_t i) {
+                    PackedVertex& element = float_vertices[i];
+                    element.position = {points[3 * i], points[3 * i + 1],
+                                        points[3 * i + 2]};
+                    fill_attributes(element, i);
+                },
+                kPackedGrainSize);
+        vertices = float_vertices;
+    }
+
+    VertexBuffer::BufferDescriptor vb_descriptor(
+            vertices, vertices_byte_count,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+
+    auto ib_handle = CreateIndexBuffer(n_vertices);
+
+    IndexBufferHandle downsampled_handle;
+    if (n_vertices >= downsample_threshold_) {
+        downsampled_handle =
+                CreateIndexBuffer(n_vertices, downsample_threshold_);
+    }
+
+    return std::make_tuple(vb_handle, ib_handle, downsampled_handle);
+}
+
 filament::Box TPointCloudBuffersBuilder::ComputeAABB() {
     auto min_bounds = geometry_.GetMinBound();
     auto max_bounds = geometry_.GetMaxBound();
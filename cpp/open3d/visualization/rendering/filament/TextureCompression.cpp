@@ -0,0 +1,210 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/filament/TextureCompression.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "open3d/geometry/Image.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+constexpr int kBlockTexels = 16;
+using BlockTexels = std::uint8_t[kBlockTexels][4];
+
+std::uint16_t ToRGB565(const int c[3]) {
+    return std::uint16_t(((c[0] * 31 + 127) / 255) << 11 |
+                         ((c[1] * 63 + 127) / 255) << 5 |
+                         ((c[2] * 31 + 127) / 255));
+}
+
+void FromRGB565(std::uint16_t v, int c[3]) {
+    const int r = (v >> 11) & 31;
+    const int g = (v >> 5) & 63;
+    const int b = v & 31;
+    c[0] = (r << 3) | (r >> 2);
+    c[1] = (g << 2) | (g >> 4);
+    c[2] = (b << 3) | (b >> 2);
+}
+
+// Four color BC1 block. The endpoints are the corners of the bounding box
+// of the colors along the diagonal that best follows their correlation.
+void EncodeColorBlock(const BlockTexels& texels, std::uint8_t* out) {
+    int lo[3] = {255, 255, 255};
+    int hi[3] = {0, 0, 0};
+    int mean[3] = {0, 0, 0};
+    for (int i = 0; i < kBlockTexels; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            lo[c] = std::min(lo[c], int(texels[i][c]));
+            hi[c] = std::max(hi[c], int(texels[i][c]));
+            mean[c] += texels[i][c];
+        }
+    }
+    int cov_rg = 0;
+    int cov_bg = 0;
+    for (int i = 0; i < kBlockTexels; ++i) {
+        const int g = kBlockTexels * texels[i][1] - mean[1];
+        cov_rg += (kBlockTexels * texels[i][0] - mean[0]) * g;
+        cov_bg += (kBlockTexels * texels[i][2] - mean[2]) * g;
+    }
+    if (cov_rg < 0) std::swap(lo[0], hi[0]);
+    if (cov_bg < 0) std::swap(lo[2], hi[2]);
+    // Insetting the endpoints by 1/16 of the range lowers the average error
+    for (int c = 0; c < 3; ++c) {
+        const int inset = (hi[c] - lo[c]) / 16;
+        hi[c] -= inset;
+        lo[c] += inset;
+    }
+
+    std::uint16_t c0 = ToRGB565(hi);
+    std::uint16_t c1 = ToRGB565(lo);
+    // c0 > c1 selects the four color mode
+    if (c0 < c1) std::swap(c0, c1);
+    int palette[4][3];
+    FromRGB565(c0, palette[0]);
+    FromRGB565(c1, palette[1]);
+    for (int c = 0; c < 3; ++c) {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    std::uint32_t indices = 0;
+    if (c0 != c1) {
+        for (int i = 0; i < kBlockTexels; ++i) {
+            int best = 0;
+            int best_error = 1 << 30;
+            for (int p = 0; p < 4; ++p) {
+                int error = 0;
+                for (int c = 0; c < 3; ++c) {
+                    const int d = int(texels[i][c]) - palette[p][c];
+                    error += d * d;
+                }
+                if (error < best_error) {
+                    best = p;
+                    best_error = error;
+                }
+            }
+            indices |= std::uint32_t(best) << (2 * i);
+        }
+    }
+
+    out[0] = std::uint8_t(c0 & 0xff);
+    out[1] = std::uint8_t(c0 >> 8);
+    out[2] = std::uint8_t(c1 & 0xff);
+    out[3] = std::uint8_t(c1 >> 8);
+    for (int b = 0; b < 4; ++b) {
+        out[4 + b] = std::uint8_t((indices >> (8 * b)) & 0xff);
+    }
+}
+
+// Eight value BC3 alpha block spanning the range of the alpha values
+void EncodeAlphaBlock(const BlockTexels& texels, std::uint8_t* out) {
+    int lo = 255;
+    int hi = 0;
+    for (int i = 0; i < kBlockTexels; ++i) {
+        lo = std::min(lo, int(texels[i][3]));
+        hi = std::max(hi, int(texels[i][3]));
+    }
+
+    std::uint64_t indices = 0;
+    if (hi > lo) {
+        int palette[8] = {hi, lo};
+        for (int k = 2; k < 8; ++k) {
+            palette[k] = ((8 - k) * hi + (k - 1) * lo) / 7;
+        }
+        for (int i = 0; i < kBlockTexels; ++i) {
+            int best = 0;
+            for (int k = 1; k < 8; ++k) {
+                if (std::abs(texels[i][3] - palette[k]) <
+                    std::abs(texels[i][3] - palette[best])) {
+                    best = k;
+                }
+            }
+            indices |= std::uint64_t(best) << (3 * i);
+        }
+    }
+
+    out[0] = std::uint8_t(hi);
+    out[1] = std::uint8_t(lo);
+    for (int b = 0; b < 6; ++b) {
+        out[2 + b] = std::uint8_t((indices >> (8 * b)) & 0xff);
+    }
+}
+
+}  // namespace
+
+std::size_t BlockCompressedSize(int width, int height, int num_channels) {
+    const std::size_t block_bytes = (num_channels == 4 ? 16 : 8);
+    return std::size_t((width + 3) / 4) * std::size_t((height + 3) / 4) *
+           block_bytes;
+}
+
+void BlockCompressImage(const geometry::Image& image, std::uint8_t* out) {
+    const int channels = image.num_of_channels_;
+    if (image.bytes_per_channel_ != 1 || (channels != 3 && channels != 4)) {
+        utility::LogError(
+                "Block compression requires an 8-bit RGB or RGBA image.");
+    }
+
+    const std::size_t block_bytes = (channels == 4 ? 16 : 8);
+    const int blocks_x = (image.width_ + 3) / 4;
+    const int blocks_y = (image.height_ + 3) / 4;
+    utility::ParallelFor(0, blocks_y, [&](int64_t by) {
+        BlockTexels texels;
+        for (int bx = 0; bx < blocks_x; ++bx) {
+            // Blocks at the right and bottom edges repeat the last texel
+            for (int i = 0; i < kBlockTexels; ++i) {
+                const int x = std::min(4 * bx + i % 4, image.width_ - 1);
+                const int y = std::min(4 * int(by) + i / 4, image.height_ - 1);
+                const std::uint8_t* p =
+                        image.data_.data() +
+                        (std::size_t(y) * image.width_ + x) * channels;
+                texels[i][0] = p[0];
+                texels[i][1] = p[1];
+                texels[i][2] = p[2];
+                texels[i][3] = (channels == 4 ? p[3] : 255);
+            }
+            std::uint8_t* block =
+                    out + (std::size_t(by) * blocks_x + bx) * block_bytes;
+            if (channels == 4) {
+                EncodeAlphaBlock(texels, block);
+                block += 8;
+            }
+            EncodeColorBlock(texels, block);
+        }
+    });
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,52 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace open3d {
+
+namespace geometry {
+class Image;
+}
+
+namespace visualization {
+namespace rendering {
+
+/// Size in bytes of the block compressed encoding of an image: BC1 (DXT1)
+/// for RGB images and BC3 (DXT5) for RGBA images.
+std::size_t BlockCompressedSize(int width, int height, int num_channels);
+
+/// Encodes an image with one byte per channel and three (BC1) or four (BC3)
+/// channels into \p out, which must hold BlockCompressedSize() bytes. Blocks
+/// are encoded in parallel.
+void BlockCompressImage(const geometry::Image& image, std::uint8_t* out);
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -48,10 +48,12 @@
 #pragma warning(pop)
 #endif  // _MSC_VER
 
+#include <algorithm>
 #include <map>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -82,6 +84,19 @@ struct TexturedVertex {
     math::float2 uv = {0.f, 0.f};
 };
 
+// Interleaved vertex of VertexFormat::kPacked: 28 bytes instead of the 52
+// bytes of TexturedVertex. The UVs are always zero (meshes with triangle UVs
+// use the float layout), so they are stored as half2.
+struct PackedVertex {
+    math::float3 position = {0.f, 0.f, 0.f};
+    math::short4 tangent = {0, 0, 0, 32767};
+    math::ubyte4 color = {128, 128, 128, 255};
+    math::ushort2 uv = {0, 0};
+};
+
+// Number of vertices converted per task when filling packed buffers.
+static const int64_t kPackedGrainSize = 16384;
+
 template <typename VertexType>
 void SetVertexPosition(VertexType& vertex, const Eigen::Vector3d& pos) {
     auto float_pos = pos.cast<float>();
@@ -170,6 +185,40 @@ VertexBuffer* BuildFilamentVertexBuffer(filament::Engine& engine,
     return builder.build(engine);
 }
 
+VertexBuffer* BuildPackedVertexBuffer(filament::Engine& engine,
+                                     const std::uint32_t vertices_count) {
+    const std::uint32_t stride = sizeof(PackedVertex);
+    // For CUSTOM0 explanation, see FilamentGeometryBuffersBuilder.cpp
+    return VertexBuffer::Builder()
+            .bufferCount(1)
+            .vertexCount(vertices_count)
+            .attribute(VertexAttribute::POSITION, 0,
+                       VertexBuffer::AttributeType::FLOAT3,
+                       offsetof(PackedVertex, position), stride)
+            .normalized(VertexAttribute::TANGENTS)
+            .attribute(VertexAttribute::TANGENTS, 0,
+                       VertexBuffer::AttributeType::SHORT4,
+                       offsetof(PackedVertex, tangent), stride)
+            .normalized(VertexAttribute::CUSTOM0)
+            .attribute(VertexAttribute::CUSTOM0, 0,
+                       VertexBuffer::AttributeType::SHORT4,
+                       offsetof(PackedVertex, tangent), stride)
+            .normalized(VertexAttribute::COLOR)
+            .attribute(VertexAttribute::COLOR, 0,
+                       VertexBuffer::AttributeType::UBYTE4,
+                       offsetof(PackedVertex, color), stride)
+            .attribute(VertexAttribute::UV0, 0,
+                       VertexBuffer::AttributeType::HALF2,
+                       offsetof(PackedVertex, uv), stride)
+            .build(engine);
+}
+
+// Buffers of meshes that are updated tend to keep growing (e.g. streamed
+// surface reconstructions), so they get room for half as much again.
+size_t GrownCapacity(size_t required, size_t current) {
+    return std::max(required, current + current / 2);
+}
+
 struct vbdata {
     size_t byte_count = 0;
     size_t bytes_to_copy = 0;
@@ -381,6 +430,15 @@ RenderableManager::PrimitiveType TriangleMeshBuffersBuilder::GetPrimitiveType()
 }
 
 GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
+    // Textured meshes duplicate vertices per triangle UV, which the packed
+    // layout does not implement.
+    if (vertex_format_ != VertexFormat::kFloat &&
+        !geometry_.HasTriangleUvs()) {
+        return ConstructPackedBuffers();
+    }
+    // Let GetVertexFormat() report the layout that is actually built
+    vertex_format_ = VertexFormat::kFloat;
+
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
@@ -438,7 +496,7 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
 
     VertexBufferHandle vb_handle;
     if (vbuf) {
-        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf, stride);
     } else {
         free(vertex_data.bytes);
         free(index_data.bytes);
@@ -467,6 +525,187 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
     return std::make_tuple(vb_handle, ib_handle, IndexBufferHandle());
 }
 
+GeometryBuffersBuilder::Buffers
+TriangleMeshBuffersBuilder::ConstructPackedBuffers() {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    const size_t n_vertices = geometry_.vertices_.size();
+    VertexBuffer* vbuf =
+            BuildPackedVertexBuffer(engine, std::uint32_t(n_vertices));
+    if (!vbuf) {
+        return {};
+    }
+    auto vb_handle = resource_mgr.AddVertexBuffer(vbuf, sizeof(PackedVertex));
+
+    size_t vertices_byte_count = 0;
+    void* vertices = CreateVertices(true, &vertices_byte_count);
+    VertexBuffer::BufferDescriptor vb_descriptor(
+            vertices, vertices_byte_count,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+
+    size_t indices_byte_count = 0;
+    IndexType* indices = CreateIndices(&indices_byte_count);
+    auto ib_handle = resource_mgr.CreateIndexBuffer(
+            3 * geometry_.triangles_.size(), sizeof(IndexType));
+    auto ibuf = resource_mgr.GetIndexBuffer(ib_handle).lock();
+    IndexBuffer::BufferDescriptor ib_descriptor(
+            indices, indices_byte_count,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    ibuf->setBuffer(engine, std::move(ib_descriptor));
+
+    return std::make_tuple(vb_handle, ib_handle, IndexBufferHandle());
+}
+
+GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::UpdateBuffers(
+        VertexBufferHandle vb,
+        IndexBufferHandle ib,
+        bool update_vertices,
+        bool update_indices) {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    auto vbuf = resource_mgr.GetVertexBuffer(vb).lock();
+    auto ibuf = resource_mgr.GetIndexBuffer(ib).lock();
+    if (!vbuf || !ibuf) {
+        return {};
+    }
+
+    const bool packed = (vertex_format_ != VertexFormat::kFloat);
+    const size_t n_vertices = geometry_.vertices_.size();
+    if (update_vertices && n_vertices > vbuf->getVertexCount()) {
+        const auto capacity = std::uint32_t(
+                GrownCapacity(n_vertices, vbuf->getVertexCount()));
+        VertexBuffer* grown =
+                (packed ? BuildPackedVertexBuffer(engine, capacity)
+                        : BuildFilamentVertexBuffer(engine, capacity,
+                                                    sizeof(TexturedVertex),
+                                                    true, true));
+        if (!grown) {
+            return {};
+        }
+        vb = resource_mgr.AddVertexBuffer(
+                grown, packed ? sizeof(PackedVertex) : sizeof(TexturedVertex));
+        vbuf = resource_mgr.GetVertexBuffer(vb).lock();
+    }
+    if (update_vertices && n_vertices > 0) {
+        size_t byte_count = 0;
+        void* vertices = CreateVertices(packed, &byte_count);
+        VertexBuffer::BufferDescriptor vb_descriptor(
+                vertices, byte_count, GeometryBuffersBuilder::DeallocateBuffer);
+        vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+    }
+
+    const size_t n_indices = 3 * geometry_.triangles_.size();
+    if (update_indices && n_indices > ibuf->getIndexCount()) {
+        ib = resource_mgr.CreateIndexBuffer(
+                GrownCapacity(n_indices, ibuf->getIndexCount()),
+                sizeof(IndexType));
+        ibuf = resource_mgr.GetIndexBuffer(ib).lock();
+    }
+    if (update_indices && n_indices > 0) {
+        size_t byte_count = 0;
+        IndexType* indices = CreateIndices(&byte_count);
+        IndexBuffer::BufferDescriptor ib_descriptor(
+                indices, byte_count, GeometryBuffersBuilder::DeallocateBuffer);
+        ibuf->setBuffer(engine, std::move(ib_descriptor));
+    }
+
+    return std::make_tuple(vb, ib, IndexBufferHandle());
+}
+
+void* TriangleMeshBuffersBuilder::CreateVertices(bool packed,
+                                                 size_t* byte_count) const {
+    const size_t n_vertices = geometry_.vertices_.size();
+
+    std::vector<float> quats;
+    if (geometry_.HasVertexNormals()) {
+        std::vector<float> normals(3 * n_vertices);
+        utility::ParallelFor(
+                0, int64_t(n_vertices),
+                [&](int64_t i) {
+                    const auto& n = geometry_.vertex_normals_[i];
+                    normals[3 * i] = float(n.x());
+                    normals[3 * i + 1] = float(n.y());
+                    normals[3 * i + 2] = float(n.z());
+                },
+                kPackedGrainSize);
+        quats.resize(4 * n_vertices);
+        ComputeTangentQuats(normals.data(), n_vertices, quats.data());
+    }
+
+    const bool has_colors = geometry_.HasVertexColors();
+    if (packed) {
+        *byte_count = n_vertices * sizeof(PackedVertex);
+        auto* vertices = static_cast<PackedVertex*>(malloc(*byte_count));
+        utility::ParallelFor(
+                0, int64_t(n_vertices),
+                [&](int64_t i) {
+                    PackedVertex& element = vertices[i];
+                    const auto& v = geometry_.vertices_[i];
+                    element.position = {float(v.x()), float(v.y()),
+                                        float(v.z())};
+                    if (!quats.empty()) {
+                        for (int c = 0; c < 4; ++c) {
+                            element.tangent[c] = ToSnorm16(quats[4 * i + c]);
+                        }
+                    } else {
+                        element.tangent = {0, 0, 0, 32767};
+                    }
+                    if (has_colors) {
+                        const auto& color = geometry_.vertex_colors_[i];
+                        element.color = {ToUnorm8(float(color.x())),
+                                         ToUnorm8(float(color.y())),
+                                         ToUnorm8(float(color.z())), 255};
+                    } else {
+                        element.color = {128, 128, 128, 255};
+                    }
+                    element.uv = {0, 0};
+                },
+                kPackedGrainSize);
+        return vertices;
+    }
+
+    // The float layout of meshes without triangle UVs, see
+    // CreateColoredBuffers()
+    *byte_count = n_vertices * sizeof(TexturedVertex);
+    auto* vertices = static_cast<TexturedVertex*>(malloc(*byte_count));
+    utility::ParallelFor(
+            0, int64_t(n_vertices),
+            [&](int64_t i) {
+                TexturedVertex element;
+                SetVertexPosition(element, geometry_.vertices_[i]);
+                if (!quats.empty()) {
+                    element.tangent = {quats[4 * i], quats[4 * i + 1],
+                                       quats[4 * i + 2], quats[4 * i + 3]};
+                }
+                if (has_colors) {
+                    SetVertexColor(element, geometry_.vertex_colors_[i]);
+                }
+                vertices[i] = element;
+            },
+            kPackedGrainSize);
+    return vertices;
+}
+
+GeometryBuffersBuilder::IndexType* TriangleMeshBuffersBuilder::CreateIndices(
+        size_t* byte_count) const {
+    const size_t n_triangles = geometry_.triangles_.size();
+    *byte_count = n_triangles * 3 * sizeof(IndexType);
+    auto* indices = static_cast<IndexType*>(malloc(*byte_count));
+    utility::ParallelFor(
+            0, int64_t(n_triangles),
+            [&](int64_t i) {
+                const auto& triangle = geometry_.triangles_[i];
+                indices[3 * i] = IndexType(triangle(0));
+                indices[3 * i + 1] = IndexType(triangle(1));
+                indices[3 * i + 2] = IndexType(triangle(2));
+            },
+            kPackedGrainSize);
+    return indices;
+}
+
 filament::Box TriangleMeshBuffersBuilder::ComputeAABB() {
     auto geometry_aabb = geometry_.GetAxisAlignedBoundingBox();
 
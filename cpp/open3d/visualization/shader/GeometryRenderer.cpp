@@ -160,6 +160,51 @@ bool OctreeRenderer::UpdateGeometry() {
     return true;
 }
 
+bool TensorPointCloudRenderer::Render(const RenderOption &option,
+                                      const ViewControl &view) {
+    if (!is_visible_ || !pointcloud_ptr_ || pointcloud_ptr_->IsEmpty()) {
+        return true;
+    }
+    return simple_point_shader_.Render(*pointcloud_ptr_, option, view);
+}
+
+bool TensorPointCloudRenderer::AddGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr) {
+    return false;
+}
+
+bool TensorPointCloudRenderer::AddGeometry(
+        std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr) {
+    if (!pointcloud_ptr) {
+        return false;
+    }
+    pointcloud_ptr_ = pointcloud_ptr;
+    return UpdateGeometry();
+}
+
+bool TensorPointCloudRenderer::UpdateGeometry() {
+    simple_point_shader_.InvalidateGeometry();
+    return true;
+}
+
+geometry::AxisAlignedBoundingBox
+TensorPointCloudRenderer::GetAxisAlignedBoundingBox() const {
+    if (!pointcloud_ptr_ || pointcloud_ptr_->IsEmpty() ||
+        pointcloud_ptr_->GetPoints().GetLength() == 0) {
+        return geometry::AxisAlignedBoundingBox();
+    }
+    const core::Device host("CPU:0");
+    const auto min_bound = pointcloud_ptr_->GetMinBound()
+                                   .To(host, core::Dtype::Float64)
+                                   .ToFlatVector<double>();
+    const auto max_bound = pointcloud_ptr_->GetMaxBound()
+                                   .To(host, core::Dtype::Float64)
+                                   .ToFlatVector<double>();
+    return geometry::AxisAlignedBoundingBox(
+            Eigen::Vector3d(min_bound[0], min_bound[1], min_bound[2]),
+            Eigen::Vector3d(max_bound[0], max_bound[1], max_bound[2]));
+}
+
 bool LineSetRenderer::Render(const RenderOption &option,
                              const ViewControl &view) {
     if (!is_visible_ || geometry_ptr_->IsEmpty()) return true;
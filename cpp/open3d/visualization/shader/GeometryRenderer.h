@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/Geometry.h"
 #include "open3d/visualization/shader/ImageMaskShader.h"
 #include "open3d/visualization/shader/ImageShader.h"
@@ -36,6 +37,7 @@
 #include "open3d/visualization/shader/Simple2DShader.h"
 #include "open3d/visualization/shader/SimpleBlackShader.h"
 #include "open3d/visualization/shader/SimpleShader.h"
+#include "open3d/visualization/shader/TensorPointCloudShader.h"
 #include "open3d/visualization/shader/TexturePhongShader.h"
 #include "open3d/visualization/shader/TextureSimpleShader.h"
 
@@ -114,6 +116,34 @@ protected:
     PickingShaderForPointCloud picking_shader_;
 };
 
+/// Renders a t::geometry::PointCloud, streaming its tensors into GL buffers
+/// without a host round trip when they live on a CUDA device. The legacy
+/// geometry_ptr_ stays empty; the point cloud is held in pointcloud_ptr_.
+class TensorPointCloudRenderer : public GeometryRenderer {
+public:
+    ~TensorPointCloudRenderer() override {}
+
+public:
+    bool Render(const RenderOption &option, const ViewControl &view) override;
+    /// Always returns false: legacy geometries are not supported.
+    bool AddGeometry(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
+    bool AddGeometry(
+            std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr);
+    bool UpdateGeometry() override;
+
+    std::shared_ptr<const t::geometry::PointCloud> GetPointCloud() const {
+        return pointcloud_ptr_;
+    }
+
+    /// Bounds of the point cloud, for fitting the view.
+    geometry::AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const;
+
+protected:
+    std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr_;
+    SimpleShaderForTensorPointCloud simple_point_shader_;
+};
+
 class LineSetRenderer : public GeometryRenderer {
 public:
     ~LineSetRenderer() override {}
@@ -50,19 +50,16 @@ bool NormalShader::Compile() {
 
 void NormalShader::Release() {
     UnbindGeometry();
+    vertex_position_buffer_.Release();
+    vertex_normal_buffer_.Release();
     ReleaseProgram();
 }
 
 bool NormalShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // The buffers are kept when the geometry changes; rebinding writes the
+    // new data into their existing storage (see StreamingVertexBuffer).
 
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
@@ -72,15 +69,11 @@ bool NormalShader::BindGeometry(const geometry::Geometry &geometry,
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_normal_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
-                 normals.data(), GL_STATIC_DRAW);
+    // Upload the geometry
+    vertex_position_buffer_.Upload(points.data(),
+                                   points.size() * sizeof(Eigen::Vector3f));
+    vertex_normal_buffer_.Upload(normals.data(),
+                                 normals.size() * sizeof(Eigen::Vector3f));
     bound_ = true;
     return true;
 }
@@ -97,10 +90,10 @@ bool NormalShader::RenderGeometry(const geometry::Geometry &geometry,
     glUniformMatrix4fv(V_, 1, GL_FALSE, view.GetViewMatrix().data());
     glUniformMatrix4fv(M_, 1, GL_FALSE, view.GetModelMatrix().data());
     glEnableVertexAttribArray(vertex_position_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glEnableVertexAttribArray(vertex_normal_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_normal_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
     glDisableVertexAttribArray(vertex_position_);
@@ -108,13 +101,7 @@ bool NormalShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void NormalShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_normal_buffer_);
-        bound_ = false;
-    }
-}
+void NormalShader::UnbindGeometry() { bound_ = false; }
 
 bool NormalShaderForPointCloud::PrepareRendering(
         const geometry::Geometry &geometry,
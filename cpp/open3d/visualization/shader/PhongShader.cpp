@@ -62,19 +62,17 @@ bool PhongShader::Compile() {
 
 void PhongShader::Release() {
     UnbindGeometry();
+    vertex_position_buffer_.Release();
+    vertex_normal_buffer_.Release();
+    vertex_color_buffer_.Release();
     ReleaseProgram();
 }
 
 bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
                                const RenderOption &option,
                                const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // The buffers are kept when the geometry changes; rebinding writes the
+    // new data into their existing storage (see StreamingVertexBuffer).
 
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
@@ -85,19 +83,13 @@ bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_normal_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
-                 normals.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Upload the geometry
+    vertex_position_buffer_.Upload(points.data(),
+                                   points.size() * sizeof(Eigen::Vector3f));
+    vertex_normal_buffer_.Upload(normals.data(),
+                                 normals.size() * sizeof(Eigen::Vector3f));
+    vertex_color_buffer_.Upload(colors.data(),
+                                colors.size() * sizeof(Eigen::Vector3f));
     bound_ = true;
     return true;
 }
@@ -122,13 +114,13 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
                  light_specular_shininess_data_.data());
     glUniform4fv(light_ambient_, 1, light_ambient_data_.data());
     glEnableVertexAttribArray(vertex_position_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glEnableVertexAttribArray(vertex_normal_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_normal_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glEnableVertexAttribArray(vertex_color_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
     glDisableVertexAttribArray(vertex_position_);
@@ -137,14 +129,7 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void PhongShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_normal_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
-}
+void PhongShader::UnbindGeometry() { bound_ = false; }
 
 void PhongShader::SetLighting(const ViewControl &view,
                               const RenderOption &option) {
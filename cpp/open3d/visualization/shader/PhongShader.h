@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/visualization/shader/ShaderWrapper.h"
+#include "open3d/visualization/shader/StreamingVertexBuffer.h"
 
 namespace open3d {
 namespace visualization {
@@ -70,11 +71,11 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    StreamingVertexBuffer vertex_position_buffer_;
     GLuint vertex_color_;
-    GLuint vertex_color_buffer_;
+    StreamingVertexBuffer vertex_color_buffer_;
     GLuint vertex_normal_;
-    GLuint vertex_normal_buffer_;
+    StreamingVertexBuffer vertex_normal_buffer_;
     GLuint MVP_;
     GLuint V_;
     GLuint M_;
@@ -56,7 +56,8 @@ public:
                 const ViewControl &view);
 
     /// Function to invalidate the geometry (set the dirty flag and release
-    /// geometry resource)
+    /// geometry resource). Shaders using StreamingVertexBuffer keep their
+    /// buffers and refill them on the next bind.
     void InvalidateGeometry();
 
     const std::string &GetShaderName() const { return shader_name_; }
@@ -104,25 +104,32 @@ void SimpleBlackShader::UnbindGeometry() {
     }
 }
 
-bool SimpleBlackShaderForPointCloudNormal::PrepareRendering(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::PointCloud) {
-        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+bool SimpleBlackShaderForPointCloudNormal::Compile() {
+    if (!CompileShaders(NormalLineVertexShader, NormalLineGeometryShader,
+                        SimpleBlackFragmentShader)) {
+        PrintShaderWarning("Compiling shaders failed.");
         return false;
     }
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_normal_ = glGetAttribLocation(program_, "vertex_normal");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    line_length_ = glGetUniformLocation(program_, "line_length");
+    line_width_ = glGetUniformLocation(program_, "line_width");
+    viewport_size_ = glGetUniformLocation(program_, "viewport_size");
     return true;
 }
 
-bool SimpleBlackShaderForPointCloudNormal::PrepareBinding(
+void SimpleBlackShaderForPointCloudNormal::Release() {
+    UnbindGeometry();
+    vertex_position_buffer_.Release();
+    vertex_normal_buffer_.Release();
+    ReleaseProgram();
+}
+
+bool SimpleBlackShaderForPointCloudNormal::BindGeometry(
         const geometry::Geometry &geometry,
         const RenderOption &option,
-        const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points) {
+        const ViewControl &view) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::PointCloud) {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
@@ -134,20 +141,60 @@ bool SimpleBlackShaderForPointCloudNormal::PrepareBinding(
         PrintShaderWarning("Binding failed with empty pointcloud.");
         return false;
     }
-    points.resize(pointcloud.points_.size() * 2);
-    double line_length =
-            option.point_size_ * 0.01 * view.GetBoundingBox().GetMaxExtent();
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        const auto &normal = pointcloud.normals_[i];
-        points[i * 2] = point.cast<float>();
-        points[i * 2 + 1] = (point + normal * line_length).cast<float>();
+    if (!pointcloud.HasNormals()) {
+        PrintShaderWarning("Binding failed with pointcloud with no normals.");
+        return false;
     }
-    draw_arrays_mode_ = GL_LINES;
-    draw_arrays_size_ = GLsizei(points.size());
+
+    // The point and normal arrays are uploaded as they are; GL converts the
+    // doubles to floats when fetching the vertex attributes, so no host-side
+    // line array is built.
+    vertex_position_buffer_.Upload(
+            pointcloud.points_.data(),
+            pointcloud.points_.size() * sizeof(Eigen::Vector3d));
+    vertex_normal_buffer_.Upload(
+            pointcloud.normals_.data(),
+            pointcloud.normals_.size() * sizeof(Eigen::Vector3d));
+    draw_arrays_mode_ = GL_POINTS;
+    draw_arrays_size_ = GLsizei(pointcloud.points_.size());
+    bound_ = true;
+    return true;
+}
+
+bool SimpleBlackShaderForPointCloudNormal::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+        return false;
+    }
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    const double line_length =
+            option.point_size_ * 0.01 * view.GetBoundingBox().GetMaxExtent();
+
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glUniform1f(line_length_, GLfloat(line_length));
+    glUniform1f(line_width_, GLfloat(option.line_width_));
+    glUniform2f(viewport_size_, GLfloat(view.GetWindowWidth()),
+                GLfloat(view.GetWindowHeight()));
+    glEnableVertexAttribArray(vertex_position_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_.GetBuffer());
+    glVertexAttribPointer(vertex_position_, 3, GL_DOUBLE, GL_FALSE, 0, NULL);
+    glEnableVertexAttribArray(vertex_normal_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_.GetBuffer());
+    glVertexAttribPointer(vertex_normal_, 3, GL_DOUBLE, GL_FALSE, 0, NULL);
+    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    glDisableVertexAttribArray(vertex_position_);
+    glDisableVertexAttribArray(vertex_normal_);
     return true;
 }
 
+void SimpleBlackShaderForPointCloudNormal::UnbindGeometry() { bound_ = false; }
+
 bool SimpleBlackShaderForTriangleMeshWireFrame::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
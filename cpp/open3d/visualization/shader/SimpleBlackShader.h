@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/visualization/shader/ShaderWrapper.h"
+#include "open3d/visualization/shader/StreamingVertexBuffer.h"
 
 namespace open3d {
 namespace visualization {
@@ -71,19 +72,38 @@ protected:
     GLuint MVP_;
 };
 
-class SimpleBlackShaderForPointCloudNormal : public SimpleBlackShader {
+/// Draws point cloud normals as lines. Only the points and normals are
+/// uploaded (one vertex per point); a geometry shader emits each normal as a
+/// screen-space quad, so the line length and width can change without
+/// rebinding.
+class SimpleBlackShaderForPointCloudNormal : public ShaderWrapper {
 public:
+    ~SimpleBlackShaderForPointCloudNormal() override { Release(); }
     SimpleBlackShaderForPointCloudNormal()
-        : SimpleBlackShader("SimpleBlackShaderForPointCloudNormal") {}
+        : ShaderWrapper("SimpleBlackShaderForPointCloudNormal") {
+        Compile();
+    }
 
 protected:
-    bool PrepareRendering(const geometry::Geometry &geometry,
-                          const RenderOption &option,
-                          const ViewControl &view) final;
-    bool PrepareBinding(const geometry::Geometry &geometry,
+    bool Compile() final;
+    void Release() final;
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
                         const RenderOption &option,
-                        const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points) final;
+                        const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    GLuint vertex_position_;
+    StreamingVertexBuffer vertex_position_buffer_;
+    GLuint vertex_normal_;
+    StreamingVertexBuffer vertex_normal_buffer_;
+    GLuint MVP_;
+    GLuint line_length_;
+    GLuint line_width_;
+    GLuint viewport_size_;
 };
 
 class SimpleBlackShaderForTriangleMeshWireFrame : public SimpleBlackShader {
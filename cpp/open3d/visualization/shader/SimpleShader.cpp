@@ -67,31 +67,35 @@ const static std::vector<Eigen::Vector2i> cuboid_lines_vertex_indices{
 };
 
 bool SimpleShader::Compile() {
-    if (!CompileShaders(SimpleVertexShader, NULL, SimpleFragmentShader)) {
+    if (!CompileShaders(
+                thick_lines_ ? ThickLineVertexShader : SimpleVertexShader,
+                thick_lines_ ? ThickLineGeometryShader : NULL,
+                SimpleFragmentShader)) {
         PrintShaderWarning("Compiling shaders failed.");
         return false;
     }
     vertex_position_ = glGetAttribLocation(program_, "vertex_position");
     vertex_color_ = glGetAttribLocation(program_, "vertex_color");
     MVP_ = glGetUniformLocation(program_, "MVP");
+    if (thick_lines_) {
+        line_width_ = glGetUniformLocation(program_, "line_width");
+        viewport_size_ = glGetUniformLocation(program_, "viewport_size");
+    }
     return true;
 }
 
 void SimpleShader::Release() {
     UnbindGeometry();
+    vertex_position_buffer_.Release();
+    vertex_color_buffer_.Release();
     ReleaseProgram();
 }
 
 bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // The buffers are kept when the geometry changes; rebinding writes the
+    // new data into their existing storage (see StreamingVertexBuffer).
 
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
@@ -101,15 +105,11 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Upload the geometry
+    vertex_position_buffer_.Upload(points.data(),
+                                   points.size() * sizeof(Eigen::Vector3f));
+    vertex_color_buffer_.Upload(colors.data(),
+                                colors.size() * sizeof(Eigen::Vector3f));
     bound_ = true;
     return true;
 }
@@ -123,11 +123,16 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
     }
     glUseProgram(program_);
     glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    if (thick_lines_) {
+        glUniform1f(line_width_, GLfloat(option.line_width_));
+        glUniform2f(viewport_size_, GLfloat(view.GetWindowWidth()),
+                    GLfloat(view.GetWindowHeight()));
+    }
     glEnableVertexAttribArray(vertex_position_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glEnableVertexAttribArray(vertex_color_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
     glDisableVertexAttribArray(vertex_position_);
@@ -135,13 +140,7 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void SimpleShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
-}
+void SimpleShader::UnbindGeometry() { bound_ = false; }
 
 bool SimpleShaderForPointCloud::PrepareRendering(
         const geometry::Geometry &geometry,
@@ -222,7 +221,6 @@ bool SimpleShaderForLineSet::PrepareRendering(
         PrintShaderWarning("Rendering type is not geometry::LineSet.");
         return false;
     }
-    glLineWidth(GLfloat(option.line_width_));
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GLenum(option.GetGLDepthFunc()));
     return true;
@@ -272,7 +270,6 @@ bool SimpleShaderForTetraMesh::PrepareRendering(
         PrintShaderWarning("Rendering type is not geometry::TetraMesh.");
         return false;
     }
-    glLineWidth(GLfloat(option.line_width_));
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GLenum(option.GetGLDepthFunc()));
     return true;
@@ -337,7 +334,6 @@ bool SimpleShaderForOrientedBoundingBox::PrepareRendering(
                 "Rendering type is not geometry::OrientedBoundingBox.");
         return false;
     }
-    glLineWidth(GLfloat(option.line_width_));
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GLenum(option.GetGLDepthFunc()));
     return true;
@@ -386,7 +382,6 @@ bool SimpleShaderForAxisAlignedBoundingBox::PrepareRendering(
                 "Rendering type is not geometry::AxisAlignedBoundingBox.");
         return false;
     }
-    glLineWidth(GLfloat(option.line_width_));
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GLenum(option.GetGLDepthFunc()));
     return true;
@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/visualization/shader/ShaderWrapper.h"
+#include "open3d/visualization/shader/StreamingVertexBuffer.h"
 
 namespace open3d {
 namespace visualization {
@@ -41,7 +42,13 @@ public:
     ~SimpleShader() override { Release(); }
 
 protected:
-    SimpleShader(const std::string &name) : ShaderWrapper(name) { Compile(); }
+    /// When \p thick_lines is set, the shader draws GL_LINES as screen-space
+    /// quads of RenderOption::line_width_ pixels, expanded in a geometry
+    /// shader.
+    SimpleShader(const std::string &name, bool thick_lines = false)
+        : ShaderWrapper(name), thick_lines_(thick_lines) {
+        Compile();
+    }
 
 protected:
     bool Compile() final;
@@ -66,10 +73,13 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    StreamingVertexBuffer vertex_position_buffer_;
     GLuint vertex_color_;
-    GLuint vertex_color_buffer_;
+    StreamingVertexBuffer vertex_color_buffer_;
     GLuint MVP_;
+    GLuint line_width_;
+    GLuint viewport_size_;
+    bool thick_lines_;
 };
 
 class SimpleShaderForPointCloud : public SimpleShader {
@@ -89,7 +99,7 @@ protected:
 
 class SimpleShaderForLineSet : public SimpleShader {
 public:
-    SimpleShaderForLineSet() : SimpleShader("SimpleShaderForLineSet") {}
+    SimpleShaderForLineSet() : SimpleShader("SimpleShaderForLineSet", true) {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -104,7 +114,8 @@ protected:
 
 class SimpleShaderForTetraMesh : public SimpleShader {
 public:
-    SimpleShaderForTetraMesh() : SimpleShader("SimpleShaderForTetraMesh") {}
+    SimpleShaderForTetraMesh()
+        : SimpleShader("SimpleShaderForTetraMesh", true) {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -120,7 +131,7 @@ protected:
 class SimpleShaderForOrientedBoundingBox : public SimpleShader {
 public:
     SimpleShaderForOrientedBoundingBox()
-        : SimpleShader("SimpleShaderForOrientedBoundingBox") {}
+        : SimpleShader("SimpleShaderForOrientedBoundingBox", true) {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -136,7 +147,7 @@ protected:
 class SimpleShaderForAxisAlignedBoundingBox : public SimpleShader {
 public:
     SimpleShaderForAxisAlignedBoundingBox()
-        : SimpleShader("SimpleShaderForAxisAlignedBoundingBox") {}
+        : SimpleShader("SimpleShaderForAxisAlignedBoundingBox", true) {}
 
 protected:
     bool PrepareRendering(const geometry::Geometry &geometry,
@@ -0,0 +1,69 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/shader/StreamingVertexBuffer.h"
+
+#include <algorithm>
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+void StreamingVertexBuffer::Upload(const void *data, size_t byte_size) {
+    if (buffer_ == 0) {
+        glGenBuffers(1, &buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer_);
+        glBufferData(GL_ARRAY_BUFFER, byte_size, data, GL_STATIC_DRAW);
+        capacity_ = byte_size;
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffer_);
+    if (byte_size > capacity_) {
+        // Grow by half again, so that slowly growing data (e.g. accumulated
+        // scans) does not reallocate on every update.
+        capacity_ = std::max(byte_size, capacity_ + capacity_ / 2);
+    }
+    // Orphan the old storage; frames still drawing from it keep it alive.
+    glBufferData(GL_ARRAY_BUFFER, capacity_, NULL, GL_STREAM_DRAW);
+    if (byte_size > 0) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, byte_size, data);
+    }
+}
+
+void StreamingVertexBuffer::Release() {
+    if (buffer_ != 0) {
+        glDeleteBuffers(1, &buffer_);
+        buffer_ = 0;
+    }
+    capacity_ = 0;
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+/// \class StreamingVertexBuffer
+///
+/// \brief A GL array buffer that keeps its storage across geometry updates.
+///
+/// The first upload allocates the buffer with GL_STATIC_DRAW, so geometry
+/// that never changes is stored as before. Later uploads reuse the storage:
+/// it is orphaned (so that the driver can hand out fresh memory while frames
+/// in flight still read the old contents, which double-buffers the data
+/// without a sync stall) and filled with glBufferSubData. Storage is only
+/// reallocated when the data outgrows it.
+///
+/// A GL context must be current for all member functions. Release() must be
+/// called explicitly while the context is current.
+class StreamingVertexBuffer {
+public:
+    StreamingVertexBuffer() {}
+    StreamingVertexBuffer(const StreamingVertexBuffer &) = delete;
+    StreamingVertexBuffer &operator=(const StreamingVertexBuffer &) = delete;
+
+public:
+    /// Copies \p byte_size bytes from \p data into the buffer and leaves it
+    /// bound to GL_ARRAY_BUFFER.
+    void Upload(const void *data, size_t byte_size);
+
+    /// Deletes the GL buffer.
+    void Release();
+
+    GLuint GetBuffer() const { return buffer_; }
+
+private:
+    GLuint buffer_ = 0;
+    size_t capacity_ = 0;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/shader/TensorPointCloudShader.h"
+
+#include "open3d/visualization/shader/Shader.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+bool SimpleShaderForTensorPointCloud::Compile() {
+    if (!CompileShaders(SimpleVertexShader, NULL, SimpleFragmentShader)) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    return true;
+}
+
+void SimpleShaderForTensorPointCloud::Release() {
+    UnbindGeometry();
+    position_buffer_.Release();
+    color_buffer_.Release();
+    ReleaseProgram();
+}
+
+bool SimpleShaderForTensorPointCloud::Render(
+        const t::geometry::PointCloud &pointcloud,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (!compiled_) {
+        Compile();
+    }
+    if (!bound_) {
+        BindPointCloud(pointcloud, option);
+    }
+    if (!compiled_ || !bound_) {
+        PrintShaderWarning("Something is wrong in compiling or binding.");
+        return false;
+    }
+    glPointSize(GLfloat(option.point_size_));
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glEnableVertexAttribArray(vertex_position_);
+    glBindBuffer(GL_ARRAY_BUFFER, position_buffer_.GetBuffer());
+    glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    if (has_colors_) {
+        glEnableVertexAttribArray(vertex_color_);
+        glBindBuffer(GL_ARRAY_BUFFER, color_buffer_.GetBuffer());
+        glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    } else {
+        // A disabled attribute array reads the current generic value.
+        const auto &color = option.default_mesh_color_;
+        glVertexAttrib3f(vertex_color_, GLfloat(color(0)), GLfloat(color(1)),
+                         GLfloat(color(2)));
+    }
+    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    glDisableVertexAttribArray(vertex_position_);
+    if (has_colors_) {
+        glDisableVertexAttribArray(vertex_color_);
+    }
+    return true;
+}
+
+bool SimpleShaderForTensorPointCloud::BindGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    PrintShaderWarning("Rendering type is not t::geometry::PointCloud.");
+    return false;
+}
+
+bool SimpleShaderForTensorPointCloud::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    PrintShaderWarning("Rendering type is not t::geometry::PointCloud.");
+    return false;
+}
+
+void SimpleShaderForTensorPointCloud::UnbindGeometry() {
+    // Buffers are kept alive and refilled in place by the next bind.
+    bound_ = false;
+}
+
+bool SimpleShaderForTensorPointCloud::BindPointCloud(
+        const t::geometry::PointCloud &pointcloud,
+        const RenderOption &option) {
+    if (pointcloud.IsEmpty() || pointcloud.GetPoints().GetLength() == 0) {
+        PrintShaderWarning("Binding failed with empty pointcloud.");
+        return false;
+    }
+    // Dtype conversions run on the point cloud's device.
+    const core::Tensor &points = pointcloud.GetPoints();
+    if (!position_buffer_.Upload(points.To(core::Dtype::Float32))) {
+        PrintShaderWarning("Binding failed when uploading points.");
+        return false;
+    }
+    has_colors_ = pointcloud.HasPointColors() &&
+                  (option.point_color_option_ ==
+                           RenderOption::PointColorOption::Default ||
+                   option.point_color_option_ ==
+                           RenderOption::PointColorOption::Color);
+    if (has_colors_) {
+        core::Tensor colors = pointcloud.GetPointColors();
+        if (colors.GetDtype() == core::Dtype::UInt8) {
+            colors = colors.To(core::Dtype::Float32) / 255.0f;
+        } else {
+            colors = colors.To(core::Dtype::Float32);
+        }
+        if (!color_buffer_.Upload(colors)) {
+            PrintShaderWarning("Binding failed when uploading colors.");
+            return false;
+        }
+    }
+    draw_arrays_mode_ = GL_POINTS;
+    draw_arrays_size_ = GLsizei(points.GetLength());
+    bound_ = true;
+    return true;
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
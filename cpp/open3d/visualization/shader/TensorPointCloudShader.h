@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/visualization/shader/ShaderWrapper.h"
+#include "open3d/visualization/shader/TensorVertexBuffer.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+/// \class SimpleShaderForTensorPointCloud
+///
+/// \brief Renders a t::geometry::PointCloud with the simple shader.
+///
+/// Positions and colors are streamed from the point cloud tensors into
+/// persistent GL buffers (see TensorVertexBuffer), so CUDA point clouds are
+/// copied device-to-device without a host round trip. Invalidating the
+/// geometry only marks the buffers dirty; they are refilled in place on the
+/// next render. Points without colors use RenderOption::default_mesh_color_.
+class SimpleShaderForTensorPointCloud : public ShaderWrapper {
+public:
+    SimpleShaderForTensorPointCloud()
+        : ShaderWrapper("SimpleShaderForTensorPointCloud") {
+        Compile();
+    }
+    ~SimpleShaderForTensorPointCloud() override { Release(); }
+
+public:
+    bool Render(const t::geometry::PointCloud &pointcloud,
+                const RenderOption &option,
+                const ViewControl &view);
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    bool BindPointCloud(const t::geometry::PointCloud &pointcloud,
+                        const RenderOption &option);
+
+protected:
+    GLuint vertex_position_;
+    GLuint vertex_color_;
+    GLuint MVP_;
+    TensorVertexBuffer position_buffer_;
+    TensorVertexBuffer color_buffer_;
+    bool has_colors_ = false;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/shader/TensorVertexBuffer.h"
+
+#ifdef BUILD_CUDA_MODULE
+#include <cuda_gl_interop.h>
+#include <cuda_runtime.h>
+#endif
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+#ifdef BUILD_CUDA_MODULE
+namespace {
+
+/// Makes \p device the current CUDA device and restores the previous one.
+class ScopedCUDADevice {
+public:
+    explicit ScopedCUDADevice(const core::Device &device) {
+        OPEN3D_CUDA_CHECK(cudaGetDevice(&prev_device_id_));
+        OPEN3D_CUDA_CHECK(cudaSetDevice(device.GetID()));
+    }
+    ~ScopedCUDADevice() { cudaSetDevice(prev_device_id_); }
+
+private:
+    int prev_device_id_ = 0;
+};
+
+}  // namespace
+#endif
+
+bool TensorVertexBuffer::Upload(const core::Tensor &tensor) {
+    const core::Tensor data = tensor.Contiguous();
+    const size_t byte_size =
+            size_t(data.NumElements()) * data.GetDtype().ByteSize();
+    if (buffer_ == 0) {
+        glGenBuffers(1, &buffer_);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer_);
+    if (byte_size != byte_size_) {
+        // Registered resources refer to the old storage and must be
+        // registered again after reallocation.
+        UnregisterResource();
+        glBufferData(GL_ARRAY_BUFFER, byte_size, NULL, GL_STREAM_DRAW);
+        byte_size_ = byte_size;
+    }
+    interop_used_ = false;
+    if (byte_size == 0) {
+        return true;
+    }
+    if (data.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
+        if (UploadFromCUDA(data)) {
+            interop_used_ = true;
+            return true;
+        }
+        const core::Tensor host = data.To(core::Device("CPU:0"));
+        glBindBuffer(GL_ARRAY_BUFFER, buffer_);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, byte_size, host.GetDataPtr());
+        return true;
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, 0, byte_size, data.GetDataPtr());
+    return true;
+}
+
+bool TensorVertexBuffer::UploadFromCUDA(const core::Tensor &tensor) {
+#ifdef BUILD_CUDA_MODULE
+    if (interop_failed_) {
+        return false;
+    }
+    ScopedCUDADevice scoped_device(tensor.GetDevice());
+    if (resource_ == nullptr) {
+        cudaError_t err = cudaGraphicsGLRegisterBuffer(
+                &resource_, buffer_, cudaGraphicsRegisterFlagsWriteDiscard);
+        if (err != cudaSuccess) {
+            // Typically the GL context runs on a different GPU. Clear the
+            // sticky error and fall back to host copies from now on.
+            cudaGetLastError();
+            resource_ = nullptr;
+            interop_failed_ = true;
+            utility::LogWarning(
+                    "CUDA-GL interop is unavailable ({}), falling back to "
+                    "host copies.",
+                    cudaGetErrorString(err));
+            return false;
+        }
+    }
+    OPEN3D_CUDA_CHECK(cudaGraphicsMapResources(1, &resource_, 0));
+    void *mapped_ptr = nullptr;
+    size_t mapped_size = 0;
+    OPEN3D_CUDA_CHECK(cudaGraphicsResourceGetMappedPointer(
+            &mapped_ptr, &mapped_size, resource_));
+    if (mapped_size < byte_size_) {
+        OPEN3D_CUDA_CHECK(cudaGraphicsUnmapResources(1, &resource_, 0));
+        utility::LogError("Mapped GL buffer holds {} bytes, expected {}.",
+                          mapped_size, byte_size_);
+    }
+    OPEN3D_CUDA_CHECK(cudaMemcpy(mapped_ptr, tensor.GetDataPtr(), byte_size_,
+                                 cudaMemcpyDeviceToDevice));
+    OPEN3D_CUDA_CHECK(cudaGraphicsUnmapResources(1, &resource_, 0));
+    return true;
+#else
+    return false;
+#endif
+}
+
+void TensorVertexBuffer::UnregisterResource() {
+#ifdef BUILD_CUDA_MODULE
+    if (resource_ != nullptr) {
+        OPEN3D_CUDA_CHECK(cudaGraphicsUnregisterResource(resource_));
+        resource_ = nullptr;
+    }
+#endif
+}
+
+void TensorVertexBuffer::Release() {
+    UnregisterResource();
+    if (buffer_ != 0) {
+        glDeleteBuffers(1, &buffer_);
+        buffer_ = 0;
+    }
+    byte_size_ = 0;
+    interop_used_ = false;
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
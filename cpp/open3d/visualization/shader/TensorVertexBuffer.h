@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <GL/glew.h>
+
+#include "open3d/core/Tensor.h"
+
+struct cudaGraphicsResource;
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+/// \class TensorVertexBuffer
+///
+/// \brief A GL array buffer filled directly from a core::Tensor.
+///
+/// CPU tensors are uploaded with glBufferSubData. CUDA tensors are copied
+/// device-to-device into the buffer through CUDA-GL interop, so the data
+/// never travels through host memory. If the GL context is not driven by the
+/// tensor's CUDA device, interop registration fails and the buffer falls
+/// back to a host copy.
+///
+/// A GL context must be current for all member functions, including the
+/// destructor.
+class TensorVertexBuffer {
+public:
+    TensorVertexBuffer() {}
+    ~TensorVertexBuffer() { Release(); }
+    TensorVertexBuffer(const TensorVertexBuffer &) = delete;
+    TensorVertexBuffer &operator=(const TensorVertexBuffer &) = delete;
+
+public:
+    /// Copies \p tensor into the buffer. The storage is reallocated only when
+    /// the byte size changes, so streaming tensors of constant size reuse the
+    /// same buffer (and interop registration) every frame.
+    bool Upload(const core::Tensor &tensor);
+
+    /// Deletes the GL buffer and unregisters it from CUDA.
+    void Release();
+
+    GLuint GetBuffer() const { return buffer_; }
+    size_t GetByteSize() const { return byte_size_; }
+
+    /// Returns true if the last upload used CUDA-GL interop.
+    bool IsInteropUsed() const { return interop_used_; }
+
+private:
+    bool UploadFromCUDA(const core::Tensor &tensor);
+    void UnregisterResource();
+
+private:
+    GLuint buffer_ = 0;
+    size_t byte_size_ = 0;
+    cudaGraphicsResource *resource_ = nullptr;
+    bool interop_failed_ = false;
+    bool interop_used_ = false;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
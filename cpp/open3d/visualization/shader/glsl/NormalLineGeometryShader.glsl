@@ -0,0 +1,45 @@
+#version 330
+
+layout(points) in;
+layout(triangle_strip, max_vertices = 4) out;
+
+in vec3 normal[];
+
+uniform mat4 MVP;
+uniform float line_length;
+uniform float line_width;
+uniform vec2 viewport_size;
+
+void main()
+{
+    vec4 p0 = MVP * gl_in[0].gl_Position;
+    vec4 p1 = MVP * vec4(gl_in[0].gl_Position.xyz + normal[0] * line_length,
+                         1);
+
+    // Clip the line against the near plane before dividing by w
+    float d0 = p0.z + p0.w;
+    float d1 = p1.z + p1.w;
+    if (d0 < 0.0 && d1 < 0.0) {
+        return;
+    }
+    if (d0 < 0.0) {
+        p0 = mix(p0, p1, d0 / (d0 - d1));
+    } else if (d1 < 0.0) {
+        p1 = mix(p0, p1, d0 / (d0 - d1));
+    }
+
+    // Expand the line into a quad line_width pixels wide
+    vec2 dir = (p1.xy / p1.w - p0.xy / p0.w) * viewport_size;
+    dir = length(dir) > 1e-6 ? normalize(dir) : vec2(1, 0);
+    vec2 offset = vec2(-dir.y, dir.x) * line_width / viewport_size;
+
+    gl_Position = p0 + vec4(offset * p0.w, 0, 0);
+    EmitVertex();
+    gl_Position = p0 - vec4(offset * p0.w, 0, 0);
+    EmitVertex();
+    gl_Position = p1 + vec4(offset * p1.w, 0, 0);
+    EmitVertex();
+    gl_Position = p1 - vec4(offset * p1.w, 0, 0);
+    EmitVertex();
+    EndPrimitive();
+}
@@ -0,0 +1,14 @@
+#version 330
+
+in vec3 vertex_position;
+in vec3 vertex_normal;
+
+out vec3 normal;
+
+void main()
+{
+    // Positions stay in model space; the geometry shader projects both ends
+    // of the normal line.
+    gl_Position = vec4(vertex_position, 1);
+    normal = vertex_normal;
+}
@@ -29,6 +29,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/utility/GLHelper.h"
 #include "open3d/visualization/utility/SelectionPolygonVolume.h"
 #include "open3d/visualization/visualizer/ViewControl.h"
@@ -227,69 +228,72 @@ SelectionPolygon::CropTriangleMeshInPolygon(const geometry::TriangleMesh &input,
     return input.SelectByIndex(CropInPolygon(input.vertices_, view));
 }
 
-std::vector<size_t> SelectionPolygon::CropInRectangle(
-        const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
+namespace {
+
+// Returns the indices of the points whose window coordinates (lower-left
+// origin) satisfy inside(x, y). Points are projected in parallel.
+template <typename Predicate>
+std::vector<size_t> SelectInWindow(const std::vector<Eigen::Vector3d> &input,
+                                   const ViewControl &view,
+                                   const Predicate &inside) {
+    const Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
+    const double half_width = (double)view.GetWindowWidth() * 0.5;
+    const double half_height = (double)view.GetWindowHeight() * 0.5;
+    std::vector<uint8_t> selected(input.size(), 0);
+    utility::ParallelFor(
+            0, int64_t(input.size()),
+            [&](int64_t i) {
+                const auto &point = input[i];
+                Eigen::Vector4d pos =
+                        mvp_matrix *
+                        Eigen::Vector4d(point(0), point(1), point(2), 1.0);
+                if (pos(3) == 0.0) return;
+                pos /= pos(3);
+                const double x = (pos(0) + 1.0) * half_width;
+                const double y = (pos(1) + 1.0) * half_height;
+                selected[i] = (inside(x, y) ? 1 : 0);
+            },
+            4096);
+
     std::vector<size_t> output_index;
-    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
-    double half_width = (double)view.GetWindowWidth() * 0.5;
-    double half_height = (double)view.GetWindowHeight() * 0.5;
-    auto min_bound = GetMinBound();
-    auto max_bound = GetMaxBound();
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t i = 0; i < input.size(); i++) {
-        ++progress_bar;
-        const auto &point = input[i];
-        Eigen::Vector4d pos =
-                mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
-        pos /= pos(3);
-        double x = (pos(0) + 1.0) * half_width;
-        double y = (pos(1) + 1.0) * half_height;
-        if (x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
-            y <= max_bound(1)) {
+    for (size_t i = 0; i < selected.size(); i++) {
+        if (selected[i]) {
             output_index.push_back(i);
         }
     }
     return output_index;
 }
 
+}  // namespace
+
+std::vector<size_t> SelectionPolygon::CropInRectangle(
+        const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
+    const auto min_bound = GetMinBound();
+    const auto max_bound = GetMaxBound();
+    return SelectInWindow(input, view, [&](double x, double y) {
+        return x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
+               y <= max_bound(1);
+    });
+}
+
 std::vector<size_t> SelectionPolygon::CropInPolygon(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
-    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
-    double half_width = (double)view.GetWindowWidth() * 0.5;
-    double half_height = (double)view.GetWindowHeight() * 0.5;
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
-        const auto &point = input[k];
-        Eigen::Vector4d pos =
-                mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
-        pos /= pos(3);
-        double x = (pos(0) + 1.0) * half_width;
-        double y = (pos(1) + 1.0) * half_height;
-        nodes.clear();
-        for (size_t i = 0; i < polygon_.size(); i++) {
-            size_t j = (i + 1) % polygon_.size();
-            if ((polygon_[i](1) < y && polygon_[j](1) >= y) ||
-                (polygon_[j](1) < y && polygon_[i](1) >= y)) {
-                nodes.push_back(polygon_[i](0) +
-                                (y - polygon_[i](1)) /
-                                        (polygon_[j](1) - polygon_[i](1)) *
-                                        (polygon_[j](0) - polygon_[i](0)));
-            }
-        }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), x);
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
+    // Testing a point against the rasterized interior is O(1), whereas
+    // testing it against the polygon's edges is O(number of edges), which
+    // dominates for lasso selections on large clouds.
+    const int width = view.GetWindowWidth();
+    const int height = view.GetWindowHeight();
+    if (polygon_interior_mask_.width_ != width ||
+        polygon_interior_mask_.height_ != height) {
+        FillPolygon(width, height);
     }
-    return output_index;
+    const auto &mask = polygon_interior_mask_.data_;
+    return SelectInWindow(input, view, [&](double x, double y) {
+        if (x < 0.0 || y < 0.0 || x >= double(width) || y >= double(height)) {
+            return false;
+        }
+        return mask[size_t(x) + size_t(y) * size_t(width)] != 0;
+    });
 }
 
 }  // namespace visualization
@@ -26,6 +26,9 @@
 
 #include "open3d/visualization/visualizer/O3DVisualizer.h"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -41,7 +44,9 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/gui/Application.h"
+#include "open3d/visualization/gui/BitmapWindowSystem.h"
 #include "open3d/visualization/gui/Button.h"
 #include "open3d/visualization/gui/Checkbox.h"
 #include "open3d/visualization/gui/ColorEdit.h"
@@ -80,6 +85,28 @@ static const std::string kShaderUnlitLines = "unlitLine";
 
 static const std::string kDefaultIBL = "default";
 
+// Point clouds with at least this many points are prepared on a worker thread
+// so that adding them does not freeze the window. Their bounding box is shown
+// in the meantime.
+static const size_t kAsyncPointCloudMinPoints = 1000000;
+static const std::string kLoadingBoundsSuffix = ".__loading_bounds__";
+
+// The legacy point cloud renderer converts sRGB colors to linear, but the
+// tensor one does not, so point clouds converted to tensors are linearized
+// up front to look the same.
+void LinearizeSRGBColors(core::Tensor colors) {
+    float *values = colors.GetDataPtr<float>();
+    utility::ParallelFor(
+            0, colors.NumElements(),
+            [values](int64_t i) {
+                const float c = values[i];
+                values[i] = c <= 0.04045f ? c / 12.92f
+                                          : std::pow((c + 0.055f) / 1.055f,
+                                                     2.4f);
+            },
+            4096);
+}
+
 enum MenuId {
     MENU_ABOUT = 0,
     MENU_EXPORT_RGB,
@@ -318,6 +345,32 @@ struct O3DVisualizer::Impl {
     Window *window_ = nullptr;
     SceneWidget *scene_ = nullptr;
 
+    // Geometries being prepared on a worker thread (name -> request id)
+    std::unordered_map<std::string, uint64_t> pending_geometries_;
+    uint64_t next_pending_id_ = 0;
+
+    // Point cloud sequences streamed during playback (see
+    // AddGeometrySequence()). Only the frames in the preload window of the
+    // current time are kept in memory.
+    struct SequenceFrame {
+        std::shared_ptr<t::geometry::PointCloud> cloud;
+        bool loading = true;
+    };
+    struct GeometrySequence {
+        uint64_t id = 0;  // distinguishes re-added sequences of the same name
+        int num_frames = 0;
+        int preload_frames = 0;
+        SequenceFrameLoader loader;
+        std::map<int, SequenceFrame> frames;
+        int shown_frame = -1;
+        // Points that fit in the scene geometry's buffers
+        size_t capacity = 0;
+        // The scene reads these while uploading, so they are kept alive
+        // until they have been replaced twice.
+        std::shared_ptr<const t::geometry::PointCloud> uploads[2];
+    };
+    std::unordered_map<std::string, GeometrySequence> sequences_;
+
     struct {
         // We only keep pointers here because that way we don't have to release
         // all the shared_ptrs at destruction just to ensure that the gui gets
@@ -934,7 +987,9 @@ struct O3DVisualizer::Impl {
 
         auto scene = scene_->GetScene();
         // Do we have a tgeometry or a geometry?
-        if (geom) {
+        if (AddPointCloudAsync(name, geom, tgeom, mat)) {
+            // Added to the scene by FinishAddingPointCloud()
+        } else if (geom) {
             scene->AddGeometry(name, geom.get(), mat);
         } else if (tgeom && valid_tpcd) {
             scene->AddGeometry(name, valid_tpcd, mat);
@@ -956,7 +1011,358 @@ struct O3DVisualizer::Impl {
         scene_->ForceRedraw();
     }
 
+    // Prepares large point clouds on a worker thread and shows their bounding
+    // box until they are ready. Returns false if the geometry should be added
+    // synchronously instead.
+    bool AddPointCloudAsync(const std::string &name,
+                            std::shared_ptr<geometry::Geometry3D> geom,
+                            std::shared_ptr<t::geometry::Geometry> tgeom,
+                            const Material &mat) {
+        auto cloud = std::dynamic_pointer_cast<geometry::PointCloud>(geom);
+        auto t_cloud =
+                std::dynamic_pointer_cast<t::geometry::PointCloud>(tgeom);
+        geometry::AxisAlignedBoundingBox bounds;
+        if (cloud && cloud->points_.size() >= kAsyncPointCloudMinPoints) {
+            bounds = cloud->GetAxisAlignedBoundingBox();
+        } else if (t_cloud && !t_cloud->IsEmpty() &&
+                   size_t(t_cloud->GetPoints().GetLength()) >=
+                           kAsyncPointCloudMinPoints &&
+                   t_cloud->GetPoints().GetDevice().GetType() ==
+                           core::Device::DeviceType::CPU &&
+                   t_cloud->GetPoints().GetDtype() == core::Dtype::Float32) {
+            auto min_bound = t_cloud->GetMinBound().ToFlatVector<float>();
+            auto max_bound = t_cloud->GetMaxBound().ToFlatVector<float>();
+            bounds = geometry::AxisAlignedBoundingBox(
+                    {min_bound[0], min_bound[1], min_bound[2]},
+                    {max_bound[0], max_bound[1], max_bound[2]});
+        } else {
+            return false;
+        }
+
+        // The placeholder also extends the scene bounds, so that the camera
+        // can be set up before the point cloud is ready.
+        auto o3dscene = scene_->GetScene();
+        auto placeholder =
+                geometry::LineSet::CreateFromAxisAlignedBoundingBox(bounds);
+        Material placeholder_mat;
+        placeholder_mat.base_color = {1.0f, 0.5f, 0.0f, 1.0f};  // orange
+        placeholder_mat.shader = "unlitSolidColor";
+        o3dscene->AddGeometry(name + kLoadingBoundsSuffix, placeholder.get(),
+                              placeholder_mat, false);
+
+        // Legacy point clouds are converted to tensors on the worker thread,
+        // so that they can be split into chunks and uploaded progressively.
+        std::shared_ptr<t::geometry::PointCloud> converted;
+        std::shared_ptr<const t::geometry::PointCloud> prepared_cloud = t_cloud;
+        if (cloud) {
+            converted = std::make_shared<t::geometry::PointCloud>();
+            prepared_cloud = converted;
+        }
+        auto preparation =
+                o3dscene->GetScene()->PrepareGeometry(prepared_cloud);
+
+        const uint64_t id = next_pending_id_++;
+        pending_geometries_[name] = id;
+        const bool linearize_colors = mat.sRGB_color;
+        Window *window = window_;
+        Application::GetInstance().RunInThread([this, window, name, id, cloud,
+                                                converted, preparation,
+                                                linearize_colors]() {
+            if (cloud) {
+                *converted = t::geometry::PointCloud::FromLegacyPointCloud(
+                        *cloud, core::Dtype::Float32);
+                if (linearize_colors && converted->HasPointColors()) {
+                    LinearizeSRGBColors(converted->GetPointColors());
+                }
+            }
+            preparation->Run();
+            // Only runs if the window still exists.
+            Application::GetInstance().PostToMainThread(
+                    window, [this, name, id, preparation]() {
+                        FinishAddingPointCloud(name, id, *preparation);
+                    });
+        });
+        return true;
+    }
+
+    void FinishAddingPointCloud(const std::string &name,
+                                uint64_t id,
+                                const Scene::GeometryPreparation &prepared) {
+        auto pending = pending_geometries_.find(name);
+        if (pending == pending_geometries_.end() || pending->second != id) {
+            return;  // removed or replaced in the meantime
+        }
+        pending_geometries_.erase(pending);
+
+        auto o3dscene = scene_->GetScene();
+        o3dscene->RemoveGeometry(name + kLoadingBoundsSuffix);
+        for (auto &o : objects_) {
+            if (o.name == name) {
+                // The material may have changed (e.g. the point size) while
+                // the point cloud was being prepared.
+                o3dscene->AddPreparedGeometry(name, prepared, o.material);
+                OverrideMaterial(o.name, o.material, ui_state_.scene_shader);
+                UpdateGeometryVisibility(o);
+                break;
+            }
+        }
+        scene_->ForceRedraw();
+    }
+
+    void AddGeometrySequence(const std::string &name,
+                             int num_frames,
+                             SequenceFrameLoader loader,
+                             const Material *material,
+                             const std::string &group,
+                             int preload_frames) {
+        if (num_frames <= 0 || !loader) {
+            utility::LogWarning("Geometry sequence {} has no frames.", name);
+            return;
+        }
+        // The first frame sets the default material and the initial bounds,
+        // like a regular geometry.
+        auto first = LoadSequenceFrame(name, loader, 0);
+        if (!first) {
+            return;
+        }
+        AddGeometry(name, nullptr, first, material, group, 0.0, true);
+
+        auto &seq = sequences_[name];
+        seq = GeometrySequence();
+        seq.id = next_pending_id_++;
+        seq.num_frames = num_frames;
+        seq.preload_frames = std::max(1, preload_frames);
+        seq.loader = loader;
+        seq.frames[0].cloud = first;
+        seq.frames[0].loading = false;
+        seq.shown_frame = 0;
+        // The first frame was added without spare capacity, so the next one
+        // reallocates the buffers.
+        seq.capacity = 0;
+
+        const double end_time = (num_frames - 1) * ui_state_.time_step;
+        bool update_for_time = (min_time_ == max_time_ && end_time > max_time_);
+        max_time_ = std::max(max_time_, end_time);
+        if (num_frames > 1) {
+            UpdateTimeUIRange();
+            settings.time_panel->SetVisible(true);
+        }
+        if (update_for_time) {
+            UpdateObjectTree();
+            if (can_auto_show_settings_) {
+                ShowSettings(true);
+            }
+        }
+        UpdateSequence(name, seq);
+        for (auto &o : objects_) {
+            if (o.name == name) {
+                UpdateGeometryVisibility(o);
+                break;
+            }
+        }
+    }
+
+    // Returns the frame of the sequence at the current time, or -1 if the
+    // current time is outside of the sequence.
+    int GetSequenceFrameIndex(const GeometrySequence &seq) const {
+        if (ui_state_.time_step <= 0.0) {
+            return -1;
+        }
+        // The current time accumulates time steps, so allow for rounding.
+        int index = int(std::floor(
+                ui_state_.current_time / ui_state_.time_step + 1e-6));
+        return (index >= 0 && index < seq.num_frames) ? index : -1;
+    }
+
+    static std::shared_ptr<t::geometry::PointCloud> LoadSequenceFrame(
+            const std::string &name,
+            const SequenceFrameLoader &loader,
+            int index) {
+        std::shared_ptr<t::geometry::PointCloud> cloud;
+        try {
+            cloud = loader(index);
+        } catch (const std::exception &e) {
+            utility::LogWarning("Loading frame {} of {} failed: {}", index,
+                                name, e.what());
+            return nullptr;
+        }
+        if (!cloud || cloud->IsEmpty() ||
+            cloud->GetPoints().GetDevice().GetType() !=
+                    core::Device::DeviceType::CPU ||
+            cloud->GetPoints().GetDtype() != core::Dtype::Float32) {
+            utility::LogWarning(
+                    "Frame {} of {} is not a non-empty CPU Float32 point "
+                    "cloud.",
+                    index, name);
+            return nullptr;
+        }
+        return cloud;
+    }
+
+    // Shows the frame of the current time if it is loaded (otherwise the
+    // previous frame stays until it is) and loads the frames that follow.
+    void UpdateSequence(const std::string &name, GeometrySequence &seq) {
+        int index = GetSequenceFrameIndex(seq);
+        if (index < 0) {
+            return;
+        }
+        auto frame = seq.frames.find(index);
+        if (frame != seq.frames.end() && frame->second.cloud &&
+            index != seq.shown_frame) {
+            ShowSequenceFrame(name, seq, index, frame->second.cloud);
+        }
+
+        // Playback loops, so the window wraps around to the first frame.
+        std::vector<int> window;
+        for (int i = 0; i < std::min(seq.preload_frames, seq.num_frames); ++i) {
+            window.push_back((index + i) % seq.num_frames);
+        }
+        for (auto it = seq.frames.begin(); it != seq.frames.end();) {
+            if (std::find(window.begin(), window.end(), it->first) ==
+                window.end()) {
+                it = seq.frames.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (int i : window) {
+            if (seq.frames.count(i) > 0) {
+                continue;
+            }
+            seq.frames[i] = SequenceFrame();
+            const uint64_t id = seq.id;
+            auto loader = seq.loader;
+            Window *window = window_;
+            Application::GetInstance().RunInThread(
+                    [this, window, name, id, i, loader]() {
+                        auto cloud = LoadSequenceFrame(name, loader, i);
+                        // Only runs if the window still exists.
+                        Application::GetInstance().PostToMainThread(
+                                window, [this, name, id, i, cloud]() {
+                                    FinishLoadingSequenceFrame(name, id, i,
+                                                               cloud);
+                                });
+                    });
+        }
+    }
+
+    void FinishLoadingSequenceFrame(
+            const std::string &name,
+            uint64_t id,
+            int index,
+            std::shared_ptr<t::geometry::PointCloud> cloud) {
+        auto seq = sequences_.find(name);
+        if (seq == sequences_.end() || seq->second.id != id) {
+            return;  // removed or replaced in the meantime
+        }
+        auto frame = seq->second.frames.find(index);
+        if (frame == seq->second.frames.end()) {
+            return;  // left the preload window in the meantime
+        }
+        // A failed frame stays in the window so that it is not retried on
+        // every tick.
+        frame->second.cloud = cloud;
+        frame->second.loading = false;
+        if (cloud && index == GetSequenceFrameIndex(seq->second) &&
+            index != seq->second.shown_frame) {
+            ShowSequenceFrame(name, seq->second, index, cloud);
+        }
+    }
+
+    void ShowSequenceFrame(const std::string &name,
+                           GeometrySequence &seq,
+                           int index,
+                           std::shared_ptr<t::geometry::PointCloud> cloud) {
+        if (pending_geometries_.count(name) > 0) {
+            return;  // the first frame is still being prepared
+        }
+        DrawObject *object = nullptr;
+        for (auto &o : objects_) {
+            if (o.name == name) {
+                object = &o;
+                break;
+            }
+        }
+        if (!object) {
+            return;
+        }
+
+        auto o3dscene = scene_->GetScene();
+        auto scene = o3dscene->GetScene();
+        const size_t n_points = size_t(cloud->GetPoints().GetLength());
+        if (n_points > seq.capacity || !o3dscene->HasGeometry(name)) {
+            // Reallocate with spare capacity, so that following frames of
+            // similar size can be updated in place. There is no downsampled
+            // copy, since it would not be updated.
+            seq.capacity = n_points + n_points / 4;
+            auto padded = PadPointCloud(*cloud, seq.capacity);
+            o3dscene->RemoveGeometry(name);
+            o3dscene->AddGeometry(name, padded.get(), object->material, false);
+            // The bounds are not updated with the points, so culling could
+            // hide frames that moved.
+            scene->SetGeometryCulling(name, false);
+            OverrideMaterial(name, object->material, ui_state_.scene_shader);
+            KeepSequenceUpload(seq, padded);
+        }
+        uint32_t update_flags = Scene::kUpdatePointsFlag;
+        if (cloud->HasPointColors()) {
+            update_flags |= Scene::kUpdateColorsFlag;
+        }
+        if (cloud->HasPointNormals()) {
+            update_flags |= Scene::kUpdateNormalsFlag;
+        }
+        scene->UpdateGeometry(name, *cloud, update_flags);
+        KeepSequenceUpload(seq, cloud);
+        seq.shown_frame = index;
+
+        object->tgeometry = cloud;
+        selections_need_update_ = true;
+        UpdateGeometryVisibility(*object);
+    }
+
+    // Returns a copy of \p cloud with \p capacity points. The extra points
+    // repeat the first ones, so that they do not change the bounds.
+    static std::shared_ptr<t::geometry::PointCloud> PadPointCloud(
+            const t::geometry::PointCloud &cloud, size_t capacity) {
+        const int64_t n = cloud.GetPoints().GetLength();
+        const int64_t pad = int64_t(capacity) - n;
+        auto pad_attr = [n, pad, capacity](const core::Tensor &attr) {
+            core::Tensor padded({int64_t(capacity), attr.GetShape(1)},
+                                attr.GetDtype(), attr.GetDevice());
+            padded.Slice(0, 0, n) = attr;
+            int64_t filled = 0;
+            while (filled < pad) {
+                const int64_t count = std::min(n, pad - filled);
+                padded.Slice(0, n + filled, n + filled + count) =
+                        attr.Slice(0, 0, count);
+                filled += count;
+            }
+            return padded;
+        };
+        auto padded = std::make_shared<t::geometry::PointCloud>(
+                pad_attr(cloud.GetPoints()));
+        if (cloud.HasPointColors()) {
+            padded->SetPointColors(pad_attr(cloud.GetPointColors()));
+        }
+        if (cloud.HasPointNormals()) {
+            padded->SetPointNormals(pad_attr(cloud.GetPointNormals()));
+        }
+        return padded;
+    }
+
+    static void KeepSequenceUpload(
+            GeometrySequence &seq,
+            std::shared_ptr<const t::geometry::PointCloud> cloud) {
+        seq.uploads[1] = seq.uploads[0];
+        seq.uploads[0] = cloud;
+    }
+
     void RemoveGeometry(const std::string &name) {
+        if (pending_geometries_.erase(name) > 0) {
+            scene_->GetScene()->RemoveGeometry(name + kLoadingBoundsSuffix);
+        }
+        sequences_.erase(name);
+
         std::string group;
         for (size_t i = 0; i < objects_.size(); ++i) {
             if (objects_[i].name == name) {
@@ -977,6 +1383,10 @@ struct O3DVisualizer::Impl {
             max_time_ = std::max(max_time_, o.time);
             groups.insert(o.group);
         }
+        for (auto &seq : sequences_) {
+            max_time_ = std::max(max_time_, (seq.second.num_frames - 1) *
+                                                    ui_state_.time_step);
+        }
         if (min_time_ == max_time_) {
             SetAnimating(false);
         }
@@ -1171,6 +1581,9 @@ struct O3DVisualizer::Impl {
     void OverrideMaterial(const std::string &name,
                           const Material &original_material,
                           O3DVisualizer::Shader shader) {
+        if (pending_geometries_.count(name) > 0) {
+            return;  // applied by FinishAddingPointCloud()
+        }
         bool is_lines = (original_material.shader == "unlitLine");
         auto scene = scene_->GetScene();
         // Lines are already unlit, so keep using the original shader when in
@@ -1289,6 +1702,9 @@ struct O3DVisualizer::Impl {
         for (auto &o : objects_) {
             UpdateGeometryVisibility(o);
         }
+        for (auto &seq : sequences_) {
+            UpdateSequence(seq.first, seq.second);
+        }
         UpdateTimeUI();
 
         if (on_animation_) {
@@ -1533,14 +1949,23 @@ struct O3DVisualizer::Impl {
     }
 
     void UpdateGeometryVisibility(const DrawObject &o) {
-        scene_->GetScene()->ShowGeometry(o.name, IsGeometryVisible(o));
+        std::string name = o.name;
+        if (pending_geometries_.count(name) > 0) {
+            name += kLoadingBoundsSuffix;
+        }
+        scene_->GetScene()->ShowGeometry(name, IsGeometryVisible(o));
         scene_->ForceRedraw();
     }
 
     bool IsGeometryVisible(const DrawObject &o) {
+        // Sequences show one of their frames during their whole duration
+        auto seq = sequences_.find(o.name);
         bool is_current =
-                (o.time >= ui_state_.current_time &&
-                 o.time < ui_state_.current_time + ui_state_.time_step);
+                (seq != sequences_.end())
+                        ? GetSequenceFrameIndex(seq->second) >= 0
+                        : (o.time >= ui_state_.current_time &&
+                           o.time < ui_state_.current_time +
+                                            ui_state_.time_step);
         bool is_group_enabled = (ui_state_.enabled_groups.find(o.group) !=
                                  ui_state_.enabled_groups.end());
         bool is_visible = o.is_visible;
@@ -1815,6 +2240,22 @@ void O3DVisualizer::StartRPCInterface(const std::string &address, int timeout) {
     } catch (std::exception &e) {
         utility::LogWarning("Failed to start RPC interface: {}", e.what());
     }
+
+    // Frames can be streamed if the window is drawn to a bitmap, e.g. when
+    // running headless on a server.
+    if (auto *bitmap_ws = dynamic_cast<gui::BitmapWindowSystem *>(
+                &gui::Application::GetInstance().GetWindowSystem())) {
+        std::weak_ptr<Receiver> weak_receiver = impl_->receiver_;
+        bitmap_ws->SetOnWindowDraw(
+                [this, weak_receiver](gui::Window *window,
+                                      std::shared_ptr<geometry::Image> image) {
+                    auto receiver = weak_receiver.lock();
+                    if (receiver && window == this) {
+                        receiver->SetFrame(image);
+                    }
+                });
+        PostRedraw();
+    }
 #else
     utility::LogWarning(
             "O3DVisualizer::StartRPCInterface: RPC interface not built");
@@ -1825,6 +2266,10 @@ void O3DVisualizer::StopRPCInterface() {
 #ifdef BUILD_RPC_INTERFACE
     if (impl_->receiver_) {
         utility::LogInfo("Stopping RPC interface");
+        if (auto *bitmap_ws = dynamic_cast<gui::BitmapWindowSystem *>(
+                    &gui::Application::GetInstance().GetWindowSystem())) {
+            bitmap_ws->SetOnWindowDraw(nullptr);
+        }
     }
     impl_->receiver_.reset();
 #else
@@ -1893,6 +2338,17 @@ void O3DVisualizer::Add3DLabel(const Eigen::Vector3f &pos, const char *text) {
 
 void O3DVisualizer::Clear3DLabels() { impl_->Clear3DLabels(); }
 
+void O3DVisualizer::AddGeometrySequence(
+        const std::string &name,
+        int num_frames,
+        SequenceFrameLoader loader,
+        const rendering::Material *material /*= nullptr*/,
+        const std::string &group /*= ""*/,
+        int preload_frames /*= 8*/) {
+    impl_->AddGeometrySequence(name, num_frames, loader, material, group,
+                               preload_frames);
+}
+
 void O3DVisualizer::RemoveGeometry(const std::string &name) {
     return impl_->RemoveGeometry(name);
 }
@@ -42,6 +42,7 @@ class Image;
 namespace t {
 namespace geometry {
 class Geometry;
+class PointCloud;
 }  // namespace geometry
 }  // namespace t
 
@@ -127,6 +128,31 @@ public:
                      double time = 0.0,
                      bool is_visible = true);
 
+    /// Loads frame \p index of a geometry sequence. Called on worker
+    /// threads, so it must be thread-safe. Returns nullptr if the frame
+    /// cannot be loaded.
+    using SequenceFrameLoader =
+            std::function<std::shared_ptr<t::geometry::PointCloud>(int index)>;
+
+    /// Adds a point cloud sequence that is streamed during playback instead
+    /// of keeping every frame resident: frame i is shown at time
+    /// i * GetAnimationTimeStep(), so set the time step first. Only the
+    /// \p preload_frames frames from the current time onwards are kept in
+    /// memory; they are loaded with \p loader on worker threads. All frames
+    /// share one scene geometry whose buffers are allocated with spare
+    /// capacity and updated in place, so frames of similar size do not
+    /// reallocate them. The first frame is loaded immediately and sets the
+    /// default material. Frames should be CPU Float32 point clouds below the
+    /// renderer's chunking threshold (see
+    /// FilamentScene::SetPointCloudChunking()). Remove the sequence with
+    /// RemoveGeometry().
+    void AddGeometrySequence(const std::string& name,
+                             int num_frames,
+                             SequenceFrameLoader loader,
+                             const rendering::Material* material = nullptr,
+                             const std::string& group = "",
+                             int preload_frames = 8);
+
     void RemoveGeometry(const std::string& name);
 
     void ShowGeometry(const std::string& name, bool show);
@@ -181,6 +207,9 @@ public:
     rendering::Open3DScene* GetScene() const;
 
     /// Starts the RPC interface. See io/rpc/ReceiverBase for the parameters.
+    /// If the application draws windows to bitmaps (BitmapWindowSystem),
+    /// clients can also view the window with io::rpc::GetFrame() and control
+    /// it with io::rpc::SendInputEvent().
     void StartRPCInterface(const std::string& address, int timeout);
 
     void StopRPCInterface();
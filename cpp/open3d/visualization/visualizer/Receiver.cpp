@@ -26,13 +26,18 @@
 
 #include "open3d/visualization/visualizer/Receiver.h"
 
+#include <chrono>
 #include <zmq.hpp>
 
+#include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/ImageIO.h"
 #include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/visualization/gui/Application.h"
+#include "open3d/visualization/gui/BitmapWindowSystem.h"
+#include "open3d/visualization/gui/Events.h"
 #include "open3d/visualization/gui/Window.h"
 #include "open3d/visualization/rendering/Material.h"
 
@@ -42,6 +47,66 @@ using namespace open3d::utility;
 namespace open3d {
 namespace visualization {
 
+namespace {
+std::shared_ptr<zmq::message_t> CreateErrorMsg(const std::string& errstr) {
+    auto status_err = messages::Status::ErrorProcessingMessage();
+    status_err.str += errstr;
+    msgpack::sbuffer sbuf;
+    messages::Reply reply{status_err.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, status_err);
+    return std::shared_ptr<zmq::message_t>(
+            new zmq::message_t(sbuf.data(), sbuf.size()));
+}
+
+/// Overwrites the vectors starting at \p offset with the rows of \p arr.
+/// An empty \p dst is treated as a new attribute with \p num_vertices zero
+/// vectors.
+bool UpdateVectors(const messages::Array& arr,
+                   int64_t offset,
+                   size_t num_vertices,
+                   std::vector<Eigen::Vector3d>& dst,
+                   std::string& errstr) {
+    if (!arr.CheckType(
+                {messages::TypeStr<float>(), messages::TypeStr<double>()},
+                errstr) ||
+        !arr.CheckShape({-1, 3}, errstr)) {
+        return false;
+    }
+    if (dst.empty()) {
+        dst.resize(num_vertices, Eigen::Vector3d::Zero());
+    }
+    if (offset + arr.shape[0] > int64_t(dst.size())) {
+        errstr += " vertex range [" + std::to_string(offset) + ", " +
+                  std::to_string(offset + arr.shape[0]) +
+                  ") is out of bounds for size " + std::to_string(dst.size());
+        return false;
+    }
+    if (arr.type == messages::TypeStr<float>()) {
+        const float* ptr = arr.Ptr<float>();
+        for (int64_t i = 0; i < arr.shape[0]; ++i) {
+            dst[offset + i] = Eigen::Vector3d(ptr[0], ptr[1], ptr[2]);
+            ptr += 3;
+        }
+    }
+    if (arr.type == messages::TypeStr<double>()) {
+        const double* ptr = arr.Ptr<double>();
+        for (int64_t i = 0; i < arr.shape[0]; ++i) {
+            dst[offset + i] = Eigen::Vector3d(ptr[0], ptr[1], ptr[2]);
+            ptr += 3;
+        }
+    }
+    return true;
+}
+
+/// Returns the window system if windows are drawn to bitmaps, which queues
+/// input events like a real window system does. Call on the main thread.
+gui::BitmapWindowSystem* GetBitmapWindowSystem() {
+    return dynamic_cast<gui::BitmapWindowSystem*>(
+            &gui::Application::GetInstance().GetWindowSystem());
+}
+}  // namespace
+
 std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
         const messages::Request& req,
         const messages::SetMeshData& msg,
@@ -195,6 +260,7 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
             }
         }
 
+        geometries_[{msg.path, msg.time}] = mesh;
         SetGeometry(mesh, msg.path, msg.time, msg.layer);
 
     } else {
@@ -301,12 +367,222 @@ std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
                 }
             }
         }
+        geometries_[{msg.path, msg.time}] = pcd;
         SetGeometry(pcd, msg.path, msg.time, msg.layer);
     }
 
     return CreateStatusOKMsg();
 }
 
+std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::UpdateMeshData& msg,
+        const MsgpackObject& obj) {
+    std::string errstr(":");
+    if (!msg.CheckMessage(errstr)) {
+        return CreateErrorMsg(errstr);
+    }
+    auto it = geometries_.find({msg.path, msg.time});
+    if (it == geometries_.end()) {
+        return CreateErrorMsg(": no mesh data for path '" + msg.path +
+                              "' and time " + std::to_string(msg.time));
+    }
+
+    std::shared_ptr<geometry::Geometry3D> geom;
+    size_t num_vertices = 0;
+    std::map<std::string, std::vector<Eigen::Vector3d>*> targets;
+    if (it->second->GetGeometryType() ==
+        geometry::Geometry::GeometryType::PointCloud) {
+        auto pcd = std::make_shared<geometry::PointCloud>(
+                static_cast<const geometry::PointCloud&>(*it->second));
+        if (msg.num_vertices >= 0) {
+            num_vertices = size_t(msg.num_vertices);
+            if (pcd->HasNormals()) pcd->normals_.resize(num_vertices);
+            if (pcd->HasColors()) pcd->colors_.resize(num_vertices);
+            pcd->points_.resize(num_vertices, Eigen::Vector3d::Zero());
+        }
+        num_vertices = pcd->points_.size();
+        targets = {{"vertices", &pcd->points_},
+                   {"normals", &pcd->normals_},
+                   {"colors", &pcd->colors_}};
+        geom = pcd;
+    } else {
+        auto mesh = std::make_shared<geometry::TriangleMesh>(
+                static_cast<const geometry::TriangleMesh&>(*it->second));
+        if (msg.num_vertices >= 0) {
+            num_vertices = size_t(msg.num_vertices);
+            if (num_vertices < mesh->vertices_.size()) {
+                // Also removes the triangles using the removed vertices.
+                std::vector<bool> mask(mesh->vertices_.size(), false);
+                std::fill(mask.begin() + num_vertices, mask.end(), true);
+                mesh->RemoveVerticesByMask(mask);
+            } else {
+                if (mesh->HasVertexNormals()) {
+                    mesh->vertex_normals_.resize(num_vertices);
+                }
+                if (mesh->HasVertexColors()) {
+                    mesh->vertex_colors_.resize(num_vertices);
+                }
+                mesh->vertices_.resize(num_vertices, Eigen::Vector3d::Zero());
+            }
+        }
+        num_vertices = mesh->vertices_.size();
+        targets = {{"vertices", &mesh->vertices_},
+                   {"normals", &mesh->vertex_normals_},
+                   {"colors", &mesh->vertex_colors_}};
+        geom = mesh;
+    }
+
+    for (const auto& item : msg.vertex_attributes) {
+        if (!targets.count(item.first)) {
+            LogInfo("Ignoring unsupported vertex attribute {}", item.first);
+            continue;
+        }
+        errstr = ": cannot update " + item.first + ":";
+        if (!UpdateVectors(item.second, msg.vertex_offset, num_vertices,
+                           *targets[item.first], errstr)) {
+            return CreateErrorMsg(errstr);
+        }
+    }
+
+    it->second = geom;
+    SetGeometry(geom, msg.path, msg.time, msg.layer);
+    return CreateStatusOKMsg();
+}
+
+std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::GetFrame& msg,
+        const MsgpackObject& obj) {
+    if (msg.encoding != "jpeg" && msg.encoding != "raw") {
+        return CreateErrorMsg(": unsupported frame encoding '" +
+                              msg.encoding + "'");
+    }
+    std::shared_ptr<geometry::Image> frame;
+    int64_t frame_id;
+    {
+        std::unique_lock<std::mutex> lock(frame_mutex_);
+        if (msg.wait_ms > 0) {
+            frame_changed_.wait_for(
+                    lock, std::chrono::milliseconds(msg.wait_ms),
+                    [this, &msg]() { return frame_id_ != msg.last_frame_id; });
+        }
+        frame = frame_;
+        frame_id = frame_id_;
+    }
+
+    messages::FrameData data;
+    data.frame_id = frame_id;
+    data.encoding = msg.encoding;
+    if (frame) {
+        data.width = frame->width_;
+        data.height = frame->height_;
+        data.channels = frame->num_of_channels_;
+    }
+    if (frame && frame_id != msg.last_frame_id) {
+        if (msg.encoding == "raw") {
+            // Packed directly from the pixels read back from the renderer
+            data.data.ptr = (const char*)frame->data_.data();
+            data.data.size = uint32_t(frame->data_.size());
+        } else {
+            if (encoded_frame_id_ != frame_id ||
+                encoded_quality_ != msg.quality) {
+                if (!io::WriteImageToJPGInMemory(*frame, encoded_frame_,
+                                                 msg.quality)) {
+                    encoded_frame_id_ = -1;
+                    return CreateErrorMsg(": could not encode the frame");
+                }
+                encoded_frame_id_ = frame_id;
+                encoded_quality_ = msg.quality;
+            }
+            data.data.ptr = (const char*)encoded_frame_.data();
+            data.data.size = uint32_t(encoded_frame_.size());
+        }
+    }
+
+    msgpack::sbuffer sbuf;
+    messages::Reply reply{data.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, data);
+    return std::shared_ptr<zmq::message_t>(
+            new zmq::message_t(sbuf.data(), sbuf.size()));
+}
+
+std::shared_ptr<zmq::message_t> Receiver::ProcessMessage(
+        const messages::Request& req,
+        const messages::InputEvent& msg,
+        const MsgpackObject& obj) {
+    gui::Window* window = window_;
+    auto& app = gui::Application::GetInstance();
+    if (msg.type.compare(0, 6, "mouse_") == 0) {
+        gui::MouseEvent e;
+        e.x = msg.x;
+        e.y = msg.y;
+        e.modifiers = msg.modifiers;
+        if (msg.type == "mouse_move" || msg.type == "mouse_drag") {
+            e.type = (msg.type == "mouse_move" ? gui::MouseEvent::MOVE
+                                               : gui::MouseEvent::DRAG);
+            e.move.buttons = msg.buttons;
+        } else if (msg.type == "mouse_down" || msg.type == "mouse_up") {
+            e.type = (msg.type == "mouse_down" ? gui::MouseEvent::BUTTON_DOWN
+                                               : gui::MouseEvent::BUTTON_UP);
+            e.button.button = gui::MouseButton(msg.buttons);
+            e.button.count = 1;
+        } else if (msg.type == "mouse_wheel") {
+            e.type = gui::MouseEvent::WHEEL;
+            e.wheel.dx = msg.wheel_dx;
+            e.wheel.dy = msg.wheel_dy;
+            e.wheel.isTrackpad = false;
+        } else {
+            return CreateErrorMsg(": unsupported input event type '" +
+                                  msg.type + "'");
+        }
+        app.PostToMainThread(window, [window, e]() {
+            if (auto* bitmap_ws = GetBitmapWindowSystem()) {
+                bitmap_ws->PostMouseEvent(window->GetOSWindow(), e);
+            } else {
+                window->OnMouseEvent(e);
+            }
+        });
+    } else if (msg.type == "key_down" || msg.type == "key_up") {
+        gui::KeyEvent e;
+        e.type = (msg.type == "key_down" ? gui::KeyEvent::DOWN
+                                         : gui::KeyEvent::UP);
+        e.key = msg.key;
+        e.isRepeat = false;
+        app.PostToMainThread(window, [window, e]() {
+            if (auto* bitmap_ws = GetBitmapWindowSystem()) {
+                bitmap_ws->PostKeyEvent(window->GetOSWindow(), e);
+            } else {
+                window->OnKeyEvent(e);
+            }
+        });
+    } else if (msg.type == "text") {
+        const std::string text = msg.text;
+        app.PostToMainThread(window, [window, text]() {
+            const gui::TextInputEvent e{text.c_str()};
+            if (auto* bitmap_ws = GetBitmapWindowSystem()) {
+                bitmap_ws->PostTextInputEvent(window->GetOSWindow(), e);
+            } else {
+                window->OnTextInput(e);
+            }
+        });
+    } else {
+        return CreateErrorMsg(": unsupported input event type '" + msg.type +
+                              "'");
+    }
+    return CreateStatusOKMsg();
+}
+
+void Receiver::SetFrame(std::shared_ptr<geometry::Image> frame) {
+    {
+        std::lock_guard<std::mutex> lock(frame_mutex_);
+        frame_ = frame;
+        ++frame_id_;
+    }
+    frame_changed_.notify_all();
+}
+
 void Receiver::SetGeometry(std::shared_ptr<geometry::Geometry3D> geom,
                            const std::string& path,
                            int time,
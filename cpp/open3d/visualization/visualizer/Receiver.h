@@ -27,12 +27,18 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "open3d/io/rpc/ReceiverBase.h"
 
 namespace open3d {
 
 namespace geometry {
 class Geometry3D;
+class Image;
 }  // namespace geometry
 
 namespace visualization {
@@ -42,6 +48,9 @@ class Window;
 }  // namespace gui
 
 /// Receiver implementation which interfaces with the Open3DScene and a Window.
+/// Besides geometry, it serves the frames passed to SetFrame() and delivers
+/// input events to the window, so that the window can be viewed and used
+/// remotely.
 class Receiver : public io::rpc::ReceiverBase {
 public:
     using OnGeometryFunc = std::function<void(
@@ -62,9 +71,46 @@ public:
             const io::rpc::messages::SetMeshData& msg,
             const MsgpackObject& obj) override;
 
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const io::rpc::messages::Request& req,
+            const io::rpc::messages::UpdateMeshData& msg,
+            const MsgpackObject& obj) override;
+
+    /// Replies with the last frame, encoded as requested. Waiting for a new
+    /// frame blocks the processing of other messages.
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const io::rpc::messages::Request& req,
+            const io::rpc::messages::GetFrame& msg,
+            const MsgpackObject& obj) override;
+
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const io::rpc::messages::Request& req,
+            const io::rpc::messages::InputEvent& msg,
+            const MsgpackObject& obj) override;
+
+    /// Sets the frame served to "get_frame" messages. Can be called from any
+    /// thread. The image is not copied and must not be modified afterwards;
+    /// it is only encoded when a client requests it.
+    void SetFrame(std::shared_ptr<geometry::Image> frame);
+
 private:
     gui::Window* window_;
     OnGeometryFunc on_geometry_;
+    /// The last geometry for each path and time. Updates are applied to a
+    /// copy of this geometry, since the geometry passed to on_geometry_ may
+    /// still be in use on the main thread.
+    std::map<std::pair<std::string, int>,
+             std::shared_ptr<geometry::Geometry3D>>
+            geometries_;
+
+    std::mutex frame_mutex_;
+    std::condition_variable frame_changed_;
+    std::shared_ptr<geometry::Image> frame_;
+    int64_t frame_id_ = -1;
+    /// The last JPEG encoded frame, only used on the receiver thread
+    int64_t encoded_frame_id_ = -1;
+    int encoded_quality_ = -1;
+    std::vector<uint8_t> encoded_frame_;
 
     void SetGeometry(std::shared_ptr<geometry::Geometry3D> geom,
                      const std::string& path,
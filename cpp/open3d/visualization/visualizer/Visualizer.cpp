@@ -425,6 +425,7 @@ bool Visualizer::ClearGeometries() {
     glfwMakeContextCurrent(window_);
     geometry_renderer_ptrs_.clear();
     geometry_ptrs_.clear();
+    tensor_pointcloud_renderer_ptrs_.clear();
     return UpdateGeometry();
 }
 
@@ -444,7 +445,64 @@ bool Visualizer::UpdateGeometry(
 
 void Visualizer::UpdateRender() { is_redraw_required_ = true; }
 
-bool Visualizer::HasGeometry() const { return !geometry_ptrs_.empty(); }
+bool Visualizer::HasGeometry() const {
+    return !geometry_ptrs_.empty() || !tensor_pointcloud_renderer_ptrs_.empty();
+}
+
+bool Visualizer::AddTensorPointCloud(
+        std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr,
+        bool reset_bounding_box) {
+    if (!is_initialized_ || !pointcloud_ptr) {
+        return false;
+    }
+    if (tensor_pointcloud_renderer_ptrs_.count(pointcloud_ptr) > 0) {
+        return UpdateTensorPointCloud(pointcloud_ptr);
+    }
+    glfwMakeContextCurrent(window_);
+    auto renderer_ptr = std::make_shared<glsl::TensorPointCloudRenderer>();
+    if (!renderer_ptr->AddGeometry(pointcloud_ptr)) {
+        return false;
+    }
+    geometry_renderer_ptrs_.insert(renderer_ptr);
+    tensor_pointcloud_renderer_ptrs_[pointcloud_ptr] = renderer_ptr;
+    if (reset_bounding_box) {
+        view_control_ptr_->FitInGeometry(
+                renderer_ptr->GetAxisAlignedBoundingBox());
+        ResetViewPoint();
+    }
+    utility::LogDebug(
+            "Add tensor point cloud and update bounding box to {}",
+            view_control_ptr_->GetBoundingBox().GetPrintInfo().c_str());
+    return UpdateTensorPointCloud(pointcloud_ptr);
+}
+
+bool Visualizer::RemoveTensorPointCloud(
+        std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr,
+        bool reset_bounding_box) {
+    if (!is_initialized_) {
+        return false;
+    }
+    auto it = tensor_pointcloud_renderer_ptrs_.find(pointcloud_ptr);
+    if (it == tensor_pointcloud_renderer_ptrs_.end()) return false;
+    glfwMakeContextCurrent(window_);
+    geometry_renderer_ptrs_.erase(it->second);
+    tensor_pointcloud_renderer_ptrs_.erase(it);
+    if (reset_bounding_box) {
+        ResetViewPoint(true);
+    }
+    UpdateRender();
+    return true;
+}
+
+bool Visualizer::UpdateTensorPointCloud(
+        std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr) {
+    auto it = tensor_pointcloud_renderer_ptrs_.find(pointcloud_ptr);
+    if (it == tensor_pointcloud_renderer_ptrs_.end()) return false;
+    glfwMakeContextCurrent(window_);
+    bool success = it->second->UpdateGeometry();
+    UpdateRender();
+    return success;
+}
 
 void Visualizer::SetFullScreen(bool fullscreen) {
     if (!fullscreen) {
@@ -178,6 +178,30 @@ public:
             std::shared_ptr<const geometry::Geometry> geometry_ptr = nullptr);
     virtual bool HasGeometry() const;
 
+    /// \brief Function to add a tensor point cloud to the scene.
+    ///
+    /// Points and colors are streamed into GL vertex buffers directly from
+    /// the point cloud tensors. For CUDA point clouds this is a
+    /// device-to-device copy through CUDA-GL interop, which makes frequent
+    /// updates (e.g. live reconstruction previews) cheap. Call
+    /// UpdateTensorPointCloud() after the point cloud has changed.
+    ///
+    /// \param pointcloud_ptr The point cloud.
+    /// \param reset_bounding_box Fit the view to the point cloud.
+    virtual bool AddTensorPointCloud(
+            std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr,
+            bool reset_bounding_box = true);
+
+    /// Function to remove a point cloud added by AddTensorPointCloud().
+    virtual bool RemoveTensorPointCloud(
+            std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr,
+            bool reset_bounding_box = true);
+
+    /// Function to notify that a point cloud added by AddTensorPointCloud()
+    /// has changed. Its buffers are refilled in place on the next render.
+    virtual bool UpdateTensorPointCloud(
+            std::shared_ptr<const t::geometry::PointCloud> pointcloud_ptr);
+
     /// Function to inform render needed to be updated.
     virtual void UpdateRender();
 
@@ -306,6 +330,11 @@ protected:
     std::unordered_set<std::shared_ptr<glsl::GeometryRenderer>>
             geometry_renderer_ptrs_;
 
+    // renderers of tensor point clouds, also in geometry_renderer_ptrs_
+    std::unordered_map<std::shared_ptr<const t::geometry::PointCloud>,
+                       std::shared_ptr<glsl::TensorPointCloudRenderer>>
+            tensor_pointcloud_renderer_ptrs_;
+
     // utilities owned by the Visualizer
     std::vector<std::shared_ptr<const geometry::Geometry>> utility_ptrs_;
 
@@ -145,6 +145,10 @@ void Visualizer::ResetViewPoint(bool reset_bounding_box /* = false*/) {
         for (const auto &geometry_ptr : geometry_ptrs_) {
             view_control_ptr_->FitInGeometry(*(geometry_ptr));
         }
+        for (const auto &it : tensor_pointcloud_renderer_ptrs_) {
+            view_control_ptr_->FitInGeometry(
+                    it.second->GetAxisAlignedBoundingBox());
+        }
         if (coordinate_frame_mesh_ptr_ && coordinate_frame_mesh_renderer_ptr_) {
             const auto &boundingbox = view_control_ptr_->GetBoundingBox();
             *coordinate_frame_mesh_ptr_ =
@@ -51,6 +51,8 @@ void pybind_core_dtype(py::module &m) {
     dtype.def_readonly_static("Undefined", &Dtype::Undefined);
     dtype.def_readonly_static("Float32", &Dtype::Float32);
     dtype.def_readonly_static("Float64", &Dtype::Float64);
+    dtype.def_readonly_static("Float16", &Dtype::Float16);
+    dtype.def_readonly_static("BFloat16", &Dtype::BFloat16);
     dtype.def_readonly_static("Int8", &Dtype::Int8);
     dtype.def_readonly_static("Int16", &Dtype::Int16);
     dtype.def_readonly_static("Int32", &Dtype::Int32);
@@ -62,6 +62,29 @@ void pybind_core_hashmap(py::module& m) {
                 "element_shape_value"_a = SizeVector({1}),
                 "device"_a = Device("CPU:0"));
 
+    hashmap.def(py::init([](int64_t init_capacity, const Dtype& dtype_key,
+                            const std::vector<Dtype>& dtypes_value,
+                            const py::handle& element_shape_key,
+                            const py::list& element_shapes_value,
+                            const Device& device,
+                            const std::vector<std::string>& value_names) {
+                    SizeVector element_shape_key_sv =
+                            PyHandleToSizeVector(element_shape_key);
+                    std::vector<SizeVector> element_shapes_value_sv;
+                    for (const py::handle& shape : element_shapes_value) {
+                        element_shapes_value_sv.push_back(
+                                PyHandleToSizeVector(shape));
+                    }
+                    return Hashmap(init_capacity, dtype_key, dtypes_value,
+                                   element_shape_key_sv,
+                                   element_shapes_value_sv, device,
+                                   HashmapBackend::Default, value_names);
+                }),
+                "init_capacity"_a, "dtype_key"_a, "dtypes_value"_a,
+                "element_shape_key"_a, "element_shapes_value"_a,
+                "device"_a = Device("CPU:0"),
+                "value_names"_a = std::vector<std::string>());
+
     hashmap.def("insert",
                 [](Hashmap& h, const Tensor& keys, const Tensor& values) {
                     Tensor addrs, masks;
@@ -69,12 +92,39 @@ void pybind_core_hashmap(py::module& m) {
                     return py::make_tuple(addrs, masks);
                 });
 
+    hashmap.def("insert", [](Hashmap& h, const Tensor& keys,
+                             const std::vector<Tensor>& values) {
+        Tensor addrs, masks;
+        h.Insert(keys, values, addrs, masks);
+        return py::make_tuple(addrs, masks);
+    });
+
     hashmap.def("activate", [](Hashmap& h, const Tensor& keys) {
         Tensor addrs, masks;
         h.Activate(keys, addrs, masks);
         return py::make_tuple(addrs, masks);
     });
 
+    hashmap.def("find_or_insert", [](Hashmap& h, const Tensor& keys) {
+        Tensor addrs, masks;
+        h.FindOrInsert(keys, addrs, masks);
+        return py::make_tuple(addrs, masks);
+    });
+
+    hashmap.def("find_or_insert",
+                [](Hashmap& h, const Tensor& keys, const Tensor& values) {
+                    Tensor addrs, masks;
+                    h.FindOrInsert(keys, values, addrs, masks);
+                    return py::make_tuple(addrs, masks);
+                });
+
+    hashmap.def("find_or_insert", [](Hashmap& h, const Tensor& keys,
+                                     const std::vector<Tensor>& values) {
+        Tensor addrs, masks;
+        h.FindOrInsert(keys, values, addrs, masks);
+        return py::make_tuple(addrs, masks);
+    });
+
     hashmap.def("find", [](Hashmap& h, const Tensor& keys) {
         Tensor addrs, masks;
         h.Find(keys, addrs, masks);
@@ -94,10 +144,24 @@ void pybind_core_hashmap(py::module& m) {
     });
 
     hashmap.def("get_key_buffer", &Hashmap::GetKeyBuffer);
-    hashmap.def("get_value_buffer", &Hashmap::GetValueBuffer);
+    hashmap.def("get_value_buffer",
+                py::overload_cast<size_t>(&Hashmap::GetValueBuffer, py::const_),
+                "index"_a = 0);
+    hashmap.def("get_value_buffer",
+                py::overload_cast<const std::string&>(&Hashmap::GetValueBuffer,
+                                                      py::const_),
+                "name"_a);
 
     hashmap.def("get_key_tensor", &Hashmap::GetKeyTensor);
-    hashmap.def("get_value_tensor", &Hashmap::GetValueTensor);
+    hashmap.def("get_value_tensor",
+                py::overload_cast<size_t>(&Hashmap::GetValueTensor, py::const_),
+                "index"_a = 0);
+    hashmap.def("get_value_tensor",
+                py::overload_cast<const std::string&>(&Hashmap::GetValueTensor,
+                                                      py::const_),
+                "name"_a);
+    hashmap.def("value_buffer_count", &Hashmap::GetValueBufferCount);
+    hashmap.def("value_names", &Hashmap::GetValueNames);
 
     hashmap.def("rehash", &Hashmap::Rehash);
     hashmap.def("size", &Hashmap::Size);
@@ -107,6 +171,14 @@ void pybind_core_hashmap(py::module& m) {
     hashmap.def("clone", &Hashmap::Clone);
     hashmap.def("cpu", &Hashmap::CPU);
     hashmap.def("cuda", &Hashmap::CUDA, "device_id"_a = 0);
+
+    hashmap.def("save", &Hashmap::Save, "file_name"_a);
+    hashmap.def_static(
+            "load",
+            [](const std::string& file_name, const Device& device) {
+                return Hashmap::Load(file_name, device);
+            },
+            "file_name"_a, "device"_a = Device("CPU:0"));
 }
 }  // namespace core
 }  // namespace open3d
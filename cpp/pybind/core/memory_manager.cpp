@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryStatistics.h"
+#include "pybind/core/core.h"
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace core {
+
+/// Python context manager wrapping ScopedMemoryTag.
+class PyMemoryTag {
+public:
+    PyMemoryTag(const std::string& tag) : tag_(tag) {}
+    void Enter() { guard_.reset(new ScopedMemoryTag(tag_)); }
+    void Exit() { guard_.reset(); }
+
+private:
+    std::string tag_;
+    std::unique_ptr<ScopedMemoryTag> guard_;
+};
+
+void pybind_core_memory_manager(py::module& m) {
+    py::class_<MemoryStatistics> memory_statistics(
+            m, "MemoryStatistics",
+            "Allocation statistics of one device, or of one tag on one "
+            "device.");
+    memory_statistics.def(py::init<>())
+            .def_readonly("live_bytes", &MemoryStatistics::live_bytes_)
+            .def_readonly("peak_bytes", &MemoryStatistics::peak_bytes_)
+            .def_readonly("num_allocs", &MemoryStatistics::num_allocs_)
+            .def_readonly("num_frees", &MemoryStatistics::num_frees_)
+            .def_readonly("memcpy_in_bytes",
+                          &MemoryStatistics::memcpy_in_bytes_)
+            .def_readonly("memcpy_out_bytes",
+                          &MemoryStatistics::memcpy_out_bytes_)
+            .def("__repr__", &MemoryStatistics::ToString);
+
+    py::class_<MemoryCacheStatistics> cache_statistics(
+            m, "MemoryCacheStatistics",
+            "Statistics of a caching memory manager.");
+    cache_statistics.def(py::init<>())
+            .def_readonly("num_hits", &MemoryCacheStatistics::num_hits_)
+            .def_readonly("num_misses", &MemoryCacheStatistics::num_misses_)
+            .def_readonly("cached_bytes",
+                          &MemoryCacheStatistics::cached_bytes_)
+            .def_property_readonly("hit_rate", &MemoryCacheStatistics::HitRate);
+
+    py::module m_memory = m.def_submodule(
+            "memory", "Memory allocation statistics and tracing.");
+    m_memory.def(
+            "set_statistics_enabled",
+            [](bool enabled) {
+                MemoryTracker::GetInstance().SetEnabled(enabled);
+            },
+            "Enables or disables allocation tracking.", "enabled"_a);
+    m_memory.def(
+            "is_statistics_enabled",
+            []() { return MemoryTracker::GetInstance().IsEnabled(); },
+            "Returns True if allocation tracking is enabled.");
+    m_memory.def(
+            "get_statistics",
+            [](const Device& device) {
+                return MemoryTracker::GetInstance().GetStatistics(device);
+            },
+            "Returns the allocation statistics of a device.", "device"_a);
+    m_memory.def(
+            "get_tag_statistics",
+            [](const Device& device) {
+                return MemoryTracker::GetInstance().GetTagStatistics(device);
+            },
+            "Returns a dict from tag to allocation statistics of a device.",
+            "device"_a);
+    m_memory.def(
+            "reset_statistics",
+            []() { MemoryTracker::GetInstance().ResetStatistics(); },
+            "Resets peaks to the current live bytes and clears the counters.");
+    m_memory.def(
+            "print_statistics",
+            []() { MemoryTracker::GetInstance().PrintStatistics(); },
+            "Prints the allocation statistics of all devices and tags.");
+
+    m_memory.def("set_cpu_cache_enabled", &CPUMemoryManager::SetCacheEnabled,
+                 "Enables or disables the CPU size-class cache.", "enabled"_a);
+    m_memory.def("is_cpu_cache_enabled", &CPUMemoryManager::IsCacheEnabled,
+                 "Returns True if the CPU size-class cache is enabled.");
+    m_memory.def("release_cpu_cache", &CPUMemoryManager::ReleaseCache,
+                 "Releases the cached CPU memory to the system.");
+    m_memory.def("get_cpu_cache_statistics",
+                 &CPUMemoryManager::GetCacheStatistics,
+                 "Returns the statistics of the CPU size-class cache.");
+    m_memory.def("release_pinned_cache", &CPUPinnedMemoryManager::ReleaseCache,
+                 "Releases the cached pinned host memory to the system.");
+    m_memory.def("get_pinned_cache_statistics",
+                 &CPUPinnedMemoryManager::GetCacheStatistics,
+                 "Returns the statistics of the pinned host memory cache.");
+#if defined(BUILD_CUDA_MODULE) && defined(BUILD_CACHED_CUDA_MANAGER)
+    m_memory.def("get_cuda_cache_statistics",
+                 &CUDACachedMemoryManager::GetCacheStatistics,
+                 "Returns the statistics of the cached CUDA memory manager.");
+#endif
+
+    // Context manager that tags the allocations of the calling thread:
+    //     with o3d.core.memory.tag("integrate"):
+    //         ...
+    py::class_<PyMemoryTag> memory_tag(
+            m_memory, "tag",
+            "Context manager that tags the allocations of the calling "
+            "thread.");
+    memory_tag.def(py::init<const std::string&>(), "tag"_a)
+            .def("__enter__", &PyMemoryTag::Enter)
+            .def("__exit__", [](PyMemoryTag& self, py::object, py::object,
+                                py::object) { self.Exit(); });
+}
+
+}  // namespace core
+}  // namespace open3d
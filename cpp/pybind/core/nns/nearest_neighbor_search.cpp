@@ -28,6 +28,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/core/nns/NeighborListOps.h"
 #include "pybind/core/tensor_converter.h"
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
@@ -122,6 +123,38 @@ void pybind_core_nns(py::module &m) {
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
                                     "hybrid_search",
                                     map_nearest_neighbor_search_method_docs);
+
+    // Neighbor list operations.
+    m_nns.def(
+            "invert_neighbors_list",
+            [](int64_t num_points, const Tensor &inp_neighbors_index,
+               const Tensor &inp_neighbors_row_splits,
+               const Tensor &inp_neighbors_attributes) {
+                Tensor neighbors_index, neighbors_row_splits,
+                        neighbors_attributes;
+                InvertNeighborsList(num_points, inp_neighbors_index,
+                                    inp_neighbors_row_splits,
+                                    inp_neighbors_attributes, neighbors_index,
+                                    neighbors_row_splits,
+                                    neighbors_attributes);
+                return py::make_tuple(neighbors_index, neighbors_row_splits,
+                                      neighbors_attributes);
+            },
+            "Inverts a neighbors list, i.e. the query points become the "
+            "neighbors and vice versa. Pass an empty attributes tensor of "
+            "shape {0} if there are no attributes. Returns the tuple "
+            "(neighbors_index, neighbors_row_splits, neighbors_attributes).",
+            "num_points"_a, "inp_neighbors_index"_a,
+            "inp_neighbors_row_splits"_a, "inp_neighbors_attributes"_a);
+    m_nns.def("reduce_subarrays_sum", &ReduceSubarraysSum,
+              "Computes the sum of each subarray defined by the Int64 "
+              "row_splits.",
+              "values"_a, "row_splits"_a);
+    m_nns.def("ragged_to_dense", &RaggedToDense,
+              "Converts a ragged tensor defined by values and the Int64 "
+              "row_splits to a dense tensor with out_col_size columns, padded "
+              "with default_value.",
+              "values"_a, "row_splits"_a, "out_col_size"_a, "default_value"_a);
 }
 
 }  // namespace nns
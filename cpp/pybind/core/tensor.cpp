@@ -236,14 +236,17 @@ void pybind_core_tensor(py::module& m) {
     tensor.def(py::init([](const py::array& np_array,
                            utility::optional<Dtype> dtype,
                            utility::optional<Device> device) {
-                   Tensor t = PyArrayToTensor(np_array, /*inplace=*/false);
+                   // Copy only once: converting the dtype or moving the
+                   // Tensor to another device already makes a copy.
+                   Tensor t = PyArrayToTensor(np_array, /*inplace=*/true);
+                   const std::shared_ptr<Blob> np_blob = t.GetBlob();
                    if (dtype.has_value()) {
                        t = t.To(dtype.value());
                    }
                    if (device.has_value()) {
                        t = t.To(device.value());
                    }
-                   return t;
+                   return t.GetBlob() == np_blob ? t.Clone() : t;
                }),
                "np_array"_a, "dtype"_a = py::none(), "device"_a = py::none());
 
@@ -286,6 +289,16 @@ void pybind_core_tensor(py::module& m) {
     // Tensor creation API.
     BindTensorCreation(tensor, "empty", Tensor::Empty);
     BindTensorCreation(tensor, "zeros", Tensor::Zeros);
+    tensor.def_static(
+            "empty_pinned",
+            [](const SizeVector& shape, utility::optional<Dtype> dtype) {
+                return Tensor::EmptyPinned(shape, dtype.has_value()
+                                                          ? dtype.value()
+                                                          : Dtype::Float32);
+            },
+            "Create a CPU:0 Tensor with uninitialized values in page-locked "
+            "host memory, for fast and asynchronous copies to CUDA devices.",
+            "shape"_a, "dtype"_a = py::none());
     BindTensorCreation(tensor, "ones", Tensor::Ones);
     BindTensorFullCreation<float>(tensor);
     BindTensorFullCreation<double>(tensor);
@@ -387,6 +400,20 @@ void pybind_core_tensor(py::module& m) {
         return core::PyArrayToTensor(np_array, true);
     });
 
+    // Zero-copy interop with NumPy, CuPy, Numba, etc. through the array
+    // interface protocols. Each property raises AttributeError for Tensors on
+    // the other device type, such that consumers fall back to the other one.
+    tensor.def_property_readonly("__array_interface__",
+                                 &core::TensorToArrayInterface);
+    tensor.def_property_readonly("__cuda_array_interface__",
+                                 &core::TensorToCUDAArrayInterface);
+    tensor.def_static("from_array_interface", &core::ArrayInterfaceToTensor,
+                      "Create a Tensor sharing the memory of an object that "
+                      "exposes __cuda_array_interface__ (e.g. a CuPy array) "
+                      "or __array_interface__ (e.g. a NumPy array). The "
+                      "object is kept alive until the memory is released.",
+                      "obj"_a);
+
     tensor.def("to_dlpack", [](const Tensor& tensor) {
         DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
         // See PyTorch's torch/csrc/Module.cpp
@@ -427,9 +454,19 @@ void pybind_core_tensor(py::module& m) {
     // Numpy IO.
     tensor.def("save", &Tensor::Save);
     tensor.def_static("load", &Tensor::Load);
+    tensor.def_static("load_mmap", &Tensor::LoadMmap,
+                      "Load a npy file by memory-mapping it. Pages are read "
+                      "on first access. With writable=True, in-place changes "
+                      "are written back to the file.",
+                      "file_name"_a, "writable"_a = false);
+    tensor.def_static("empty_mmap", &Tensor::EmptyMmap,
+                      "Create a npy file and return a Tensor memory-mapped "
+                      "to its uninitialized values.",
+                      "file_name"_a, "shape"_a, "dtype"_a);
 
     /// Linalg operations.
     tensor.def("det", &Tensor::Det);
+    tensor.def("batched_det", &Tensor::BatchedDet);
     tensor.def("lu_ipiv", &Tensor::LUIpiv);
     tensor.def("matmul", &Tensor::Matmul);
     tensor.def("__matmul__", &Tensor::Matmul);
@@ -599,6 +636,40 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("all", &Tensor::All);
     tensor.def("any", &Tensor::Any);
 
+    tensor.def("index_add_", &Tensor::IndexAdd_, "dim"_a, "index"_a, "src"_a,
+               "Accumulates the slices of src into the tensor along dim at "
+               "the positions given by index. Duplicate indices are all "
+               "added.");
+
+    // Sorting ops.
+    tensor.def("sort", &Tensor::Sort, "dim"_a = -1, "descending"_a = false,
+               "Stable sort along dim.");
+    tensor.def("argsort", &Tensor::ArgSort, "dim"_a = -1,
+               "descending"_a = false,
+               "Indices that stably sort the tensor along dim.");
+    tensor.def("topk", &Tensor::TopK, "k"_a, "dim"_a = -1, "largest"_a = true,
+               "The k largest or smallest elements along dim. Returns a tuple "
+               "of (values, indices).");
+    tensor.def(
+            "unique",
+            [](const Tensor& tensor, bool return_inverse,
+               bool return_counts) -> py::object {
+                if (!return_inverse && !return_counts) {
+                    return py::cast(tensor.Unique());
+                }
+                Tensor unique, inverse, counts;
+                std::tie(unique, inverse, counts) =
+                        tensor.UniqueWithInverseAndCounts();
+                py::list result;
+                result.append(unique);
+                if (return_inverse) result.append(inverse);
+                if (return_counts) result.append(counts);
+                return py::tuple(result);
+            },
+            "return_inverse"_a = false, "return_counts"_a = false,
+            "Sorted unique elements of the flattened tensor, optionally with "
+            "the inverse indices and the counts.");
+
     // Reduction ops.
     BIND_REDUCTION_OP(sum, Sum);
     BIND_REDUCTION_OP(mean, Mean);
@@ -626,6 +697,12 @@ void pybind_core_tensor(py::module& m) {
         Dtype dtype = tensor.GetDtype();
         if (dtype == Dtype::Float32) return py::float_(tensor.Item<float>());
         if (dtype == Dtype::Float64) return py::float_(tensor.Item<double>());
+        if (dtype == Dtype::Float16) {
+            return py::float_(static_cast<float>(tensor.Item<Half>()));
+        }
+        if (dtype == Dtype::BFloat16) {
+            return py::float_(static_cast<float>(tensor.Item<BFloat16>()));
+        }
         if (dtype == Dtype::Int8) return py::int_(tensor.Item<int8_t>());
         if (dtype == Dtype::Int16) return py::int_(tensor.Item<int16_t>());
         if (dtype == Dtype::Int32) return py::int_(tensor.Item<int32_t>());
@@ -26,6 +26,9 @@
 
 #include "pybind/core/tensor_converter.h"
 
+#include "open3d/core/CUDAStream.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
 #ifdef _MSC_VER
@@ -140,6 +143,175 @@ Tensor PyArrayToTensor(py::array array, bool inplace) {
     }
 }
 
+/// Returns the array interface type string of \p dtype, e.g. "<f4". Open3D
+/// only supports little-endian hosts.
+static std::string DtypeToTypestr(const Dtype& dtype) {
+    if (dtype == Dtype::Bool) return "|b1";
+    if (dtype == Dtype::Int8) return "|i1";
+    if (dtype == Dtype::UInt8) return "|u1";
+    if (dtype == Dtype::Int16) return "<i2";
+    if (dtype == Dtype::Int32) return "<i4";
+    if (dtype == Dtype::Int64) return "<i8";
+    if (dtype == Dtype::UInt16) return "<u2";
+    if (dtype == Dtype::UInt32) return "<u4";
+    if (dtype == Dtype::UInt64) return "<u8";
+    if (dtype == Dtype::Float16) return "<f2";
+    if (dtype == Dtype::Float32) return "<f4";
+    if (dtype == Dtype::Float64) return "<f8";
+    utility::LogError("Dtype {} is not supported by the array interface.",
+                      dtype.ToString());
+}
+
+static Dtype TypestrToDtype(const std::string& typestr) {
+    // The byte order is '<', '>', '|' (not applicable) or '=' (native).
+    if (typestr.size() >= 2 && typestr[0] != '>') {
+        for (const Dtype& dtype :
+             {Dtype::Bool, Dtype::Int8, Dtype::UInt8, Dtype::Int16,
+              Dtype::Int32, Dtype::Int64, Dtype::UInt16, Dtype::UInt32,
+              Dtype::UInt64, Dtype::Float16, Dtype::Float32, Dtype::Float64}) {
+            if (DtypeToTypestr(dtype).substr(1) == typestr.substr(1)) {
+                return dtype;
+            }
+        }
+    }
+    utility::LogError("Unsupported array interface type string {}.", typestr);
+}
+
+/// The shape and byte strides of \p tensor as Python tuples.
+static std::pair<py::tuple, py::tuple> ShapeAndByteStrides(
+        const Tensor& tensor) {
+    const SizeVector& shape = tensor.GetShape();
+    const SizeVector& strides = tensor.GetStrides();
+    const int64_t element_byte_size = tensor.GetDtype().ByteSize();
+    py::tuple py_shape(shape.size());
+    py::tuple py_strides(strides.size());
+    for (size_t i = 0; i < shape.size(); ++i) {
+        py_shape[i] = shape[i];
+        py_strides[i] = strides[i] * element_byte_size;
+    }
+    return {py_shape, py_strides};
+}
+
+py::dict TensorToArrayInterface(const Tensor& tensor) {
+    // Raise AttributeError, such that NumPy's hasattr() checks fall back to
+    // the other conversions for CUDA Tensors.
+    if (tensor.GetDevice().GetType() != Device::DeviceType::CPU) {
+        throw py::attribute_error(
+                "__array_interface__ is only available for CPU Tensors. Use "
+                "__cuda_array_interface__ or copy the Tensor to CPU.");
+    }
+    py::tuple py_shape, py_strides;
+    std::tie(py_shape, py_strides) = ShapeAndByteStrides(tensor);
+    py::dict interface;
+    interface["version"] = 3;
+    interface["shape"] = py_shape;
+    interface["typestr"] = DtypeToTypestr(tensor.GetDtype());
+    interface["data"] = py::make_tuple(
+            reinterpret_cast<intptr_t>(tensor.GetDataPtr()), false);
+    interface["strides"] = py_strides;
+    return interface;
+}
+
+py::dict TensorToCUDAArrayInterface(const Tensor& tensor) {
+    if (tensor.GetDevice().GetType() != Device::DeviceType::CUDA) {
+        throw py::attribute_error(
+                "__cuda_array_interface__ is only available for CUDA "
+                "Tensors.");
+    }
+    py::tuple py_shape, py_strides;
+    std::tie(py_shape, py_strides) = ShapeAndByteStrides(tensor);
+    py::dict interface;
+    interface["version"] = 3;
+    interface["shape"] = py_shape;
+    interface["typestr"] = DtypeToTypestr(tensor.GetDtype());
+    interface["data"] = py::make_tuple(
+            reinterpret_cast<intptr_t>(tensor.GetDataPtr()), false);
+    interface["strides"] = py_strides;
+#ifdef BUILD_CUDA_MODULE
+    // Work producing the Tensor may still be queued on the current stream.
+    // The interface encodes the legacy default stream as 1.
+    CUDAStream stream = CUDAStream::GetCurrent();
+    if (stream.IsDefault() || stream.GetDevice() != tensor.GetDevice()) {
+        interface["stream"] = 1;
+    } else {
+        interface["stream"] = reinterpret_cast<intptr_t>(stream.Get());
+    }
+#endif
+    return interface;
+}
+
+static Tensor CUDAArrayInterfaceToTensor(const py::object& obj) {
+    py::dict interface =
+            obj.attr("__cuda_array_interface__").cast<py::dict>();
+    if (interface.contains("mask") && !interface["mask"].is_none()) {
+        utility::LogError(
+                "Masked arrays are not supported by the CUDA array "
+                "interface conversion.");
+    }
+    SizeVector shape =
+            PyTupleToSizeVector(interface["shape"].cast<py::tuple>());
+    Dtype dtype = TypestrToDtype(interface["typestr"].cast<std::string>());
+    void* data_ptr = reinterpret_cast<void*>(
+            interface["data"].cast<py::tuple>()[0].cast<intptr_t>());
+
+    SizeVector strides;
+    if (!interface.contains("strides") || interface["strides"].is_none()) {
+        strides = shape_util::DefaultStrides(shape);
+    } else {
+        strides = PyTupleToSizeVector(interface["strides"].cast<py::tuple>());
+        for (int64_t& stride : strides) {
+            if (stride % dtype.ByteSize() != 0) {
+                utility::LogError(
+                        "Byte strides must be multiples of the element size "
+                        "{}, but got {}.",
+                        dtype.ByteSize(), stride);
+            }
+            stride /= dtype.ByteSize();
+        }
+    }
+
+    // Empty arrays may have a null data pointer that has no device.
+    if (shape.NumElements() == 0) {
+        return Tensor(shape, dtype, Device("CUDA:0"));
+    }
+    Device device(Device::DeviceType::CUDA, cuda::GetPointerDevice(data_ptr));
+
+#ifdef BUILD_CUDA_MODULE
+    // The producer may still write the data on the given stream. 0 is
+    // disallowed by the interface, 1 and 2 are the legacy and per-thread
+    // default streams, which are also their cudaStream_t values.
+    if (interface.contains("stream") && !interface["stream"].is_none()) {
+        intptr_t handle = interface["stream"].cast<intptr_t>();
+        if (handle == 0) {
+            utility::LogError(
+                    "Stream 0 is disallowed by the CUDA array interface.");
+        }
+        CUDAStream::FromNative(reinterpret_cast<cudaStream_t>(handle), device)
+                .Synchronize();
+    }
+#endif
+
+    // Same as PyArrayToTensor, the Blob keeps `obj` alive.
+    obj.inc_ref();
+    std::function<void(void*)> deleter = [obj](void*) -> void {
+        py::gil_scoped_acquire acquire;
+        obj.dec_ref();
+    };
+    auto blob = std::make_shared<Blob>(device, data_ptr, deleter);
+    return Tensor(shape, strides, data_ptr, dtype, blob);
+}
+
+Tensor ArrayInterfaceToTensor(const py::object& obj) {
+    if (py::hasattr(obj, "__cuda_array_interface__")) {
+        return CUDAArrayInterfaceToTensor(obj);
+    }
+    // NumPy handles all variants of __array_interface__ and the buffer
+    // protocol. The resulting array references `obj` as its base.
+    py::object numpy = py::module::import("numpy");
+    return PyArrayToTensor(numpy.attr("asarray")(obj).cast<py::array>(),
+                           /*inplace=*/true);
+}
+
 Tensor PyListToTensor(const py::list& list,
                       utility::optional<Dtype> dtype,
                       utility::optional<Device> device) {
@@ -227,6 +399,11 @@ Tensor PyHandleToTensor(const py::handle& handle,
         } catch (...) {
             utility::LogError("Cannot cast index to Tensor.");
         }
+    } else if (py::hasattr(handle, "__cuda_array_interface__")) {
+        Tensor t = ArrayInterfaceToTensor(
+                py::reinterpret_borrow<py::object>(handle));
+        return CastOptionalDtypeDevice(force_copy ? t.Clone() : t, dtype,
+                                       device);
     } else {
         utility::LogError("PyHandleToTensor has invlaid input type {}.",
                           class_name);
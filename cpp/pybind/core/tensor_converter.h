@@ -65,6 +65,25 @@ py::array TensorToPyArray(const Tensor& tensor);
 /// python buffer will be copied.
 Tensor PyArrayToTensor(py::array array, bool inplace);
 
+/// Returns the NumPy array interface (`__array_interface__`, version 3) of a
+/// CPU Tensor. The interface describes the Tensor's memory in place, such that
+/// `numpy.asarray(tensor)` does not copy. NumPy keeps a reference to the
+/// Python Tensor object, which keeps the memory alive.
+py::dict TensorToArrayInterface(const Tensor& tensor);
+
+/// Returns the CUDA array interface (`__cuda_array_interface__`, version 3)
+/// of a CUDA Tensor, used e.g. by CuPy, Numba and PyTorch to wrap the memory
+/// without copying. The interface names the current CUDA stream, on which
+/// the consumer must wait before accessing the data.
+py::dict TensorToCUDAArrayInterface(const Tensor& tensor);
+
+/// Wraps the memory of a Python object exposing `__cuda_array_interface__` or
+/// `__array_interface__` (or the buffer protocol) in a Tensor without
+/// copying. The Tensor holds a reference to \p obj until its memory is
+/// released. For CUDA memory, the stream named in the interface is
+/// synchronized before returning.
+Tensor ArrayInterfaceToTensor(const py::object& obj);
+
 /// Convert py::list to Tensor.
 ///
 /// Nested lists are supported, e.g. [[0, 1, 2], [3, 4, 5]] becomes a 2x3
@@ -110,6 +129,8 @@ Tensor IntToTensor(int64_t scalar_value,
 /// 4) tuple
 /// 5) numpy.ndarray (value will be copied)
 /// 6) Tensor (value will be copied)
+/// 7) objects exposing __cuda_array_interface__, e.g. CuPy arrays (value will
+///    be copied)
 ///
 /// An exception will be thrown if the type is not supported.
 Tensor PyHandleToTensor(const py::handle& handle,
@@ -130,6 +130,11 @@ void pybind_kdtreeflann(py::module &m) {
             .def("set_feature", &KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
                  "feature"_a)
+            .def("set_approximate_search", &KDTreeFlann::SetApproximateSearch,
+                 "Uses a forest of ``num_trees`` randomized KDTrees visiting "
+                 "at most ``checks`` leaves per search. ``num_trees = 0`` "
+                 "restores exact search.",
+                 "num_trees"_a, "checks"_a)
             // Although these C++ style functions are fast by orders of
             // magnitudes when similar queries are performed for a large number
             // of times and memory management is involved, we prefer not to
@@ -36,6 +36,32 @@ namespace open3d {
 namespace geometry {
 
 void pybind_trianglemesh(py::module &m) {
+    py::class_<DeformAsRigidAsPossibleCache,
+               std::shared_ptr<DeformAsRigidAsPossibleCache>>
+            arap_cache(m, "DeformAsRigidAsPossibleCache",
+                       "Factorized system of deform_as_rigid_as_possible, "
+                       "reused across calls with the same constraint vertex "
+                       "indices.");
+    arap_cache.def(py::init<>())
+            .def("clear", &DeformAsRigidAsPossibleCache::Clear,
+                 "Discards the cached system.")
+            .def("is_empty", &DeformAsRigidAsPossibleCache::IsEmpty,
+                 "Returns True if no system is cached.");
+
+    py::class_<AlphaShapeCache, std::shared_ptr<AlphaShapeCache>>
+            alpha_shape_cache(m, "AlphaShapeCache",
+                              "Delaunay tetrahedralization of a point cloud, "
+                              "reused by create_from_point_cloud_alpha_shape "
+                              "across alpha values.");
+    alpha_shape_cache.def(py::init<>())
+            .def("clear", &AlphaShapeCache::Clear,
+                 "Discards the cached tetrahedralization.")
+            .def("is_empty", &AlphaShapeCache::IsEmpty,
+                 "Returns True if no tetrahedralization is cached.")
+            .def("get_alpha_spectrum", &AlphaShapeCache::GetAlphaSpectrum,
+                 "Returns the sorted alpha values at which the alpha shape "
+                 "changes.");
+
     py::class_<TriangleMesh, PyGeometry3D<TriangleMesh>,
                std::shared_ptr<TriangleMesh>, MeshBase>
             trianglemesh(m, "TriangleMesh",
@@ -76,6 +102,7 @@ void pybind_trianglemesh(py::module &m) {
                  "rendering",
                  "normalized"_a = true)
             .def("compute_vertex_normals", &TriangleMesh::ComputeVertexNormals,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute vertex normals, usually called before "
                  "rendering",
                  "normalized"_a = true)
@@ -108,6 +135,7 @@ void pybind_trianglemesh(py::module &m) {
                  "area adjacent to the non-manifold edge until the number of "
                  "adjacent triangles to the edge is `<= 2`.")
             .def("merge_close_vertices", &TriangleMesh::MergeCloseVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that will merge close by vertices to a single one. "
                  "The vertex position, "
                  "normal and color will be the average of the vertices. The "
@@ -117,6 +145,7 @@ void pybind_trianglemesh(py::module &m) {
                  "close triangle soups.",
                  "eps"_a)
             .def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sharpen triangle mesh. The output value "
                  "(:math:`v_o`) is the input value (:math:`v_i`) plus strength "
                  "times the input value minus he sum of he adjacent values. "
@@ -125,6 +154,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "strength"_a = 1,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh with simple neighbour "
                  "average. :math:`v_o = \\frac{v_i + \\sum_{n \\in N} "
                  "v_n)}{|N| + 1}`, with :math:`v_i` being the input value, "
@@ -134,6 +164,7 @@ void pybind_trianglemesh(py::module &m) {
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_laplacian",
                  &TriangleMesh::FilterSmoothLaplacian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
                  "= v_i \\cdot \\lambda (sum_{n \\in N} w_n v_n - v_i)`, with "
                  ":math:`v_i` being the input value, :math:`v_o` the output "
@@ -144,6 +175,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using method of Taubin, "
                  "\"Curve and Surface Smoothing Without Shrinkage\", 1995. "
                  "Applies in each iteration two times filter_smooth_laplacian, "
@@ -193,12 +225,15 @@ void pybind_trianglemesh(py::module &m) {
             .def("is_vertex_manifold", &TriangleMesh::IsVertexManifold,
                  "Tests if all vertices of the triangle mesh are manifold.")
             .def("is_self_intersecting", &TriangleMesh::IsSelfIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is self-intersecting.")
             .def("get_self_intersecting_triangles",
                  &TriangleMesh::GetSelfIntersectingTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Returns a list of indices to triangles that intersect the "
                  "mesh.")
             .def("is_intersecting", &TriangleMesh::IsIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is intersecting the other "
                  "triangle mesh.")
             .def("is_orientable", &TriangleMesh::IsOrientable,
@@ -238,11 +273,13 @@ void pybind_trianglemesh(py::module &m) {
                  "condition that it is watertight and orientable.")
             .def("sample_points_uniformly",
                  &TriangleMesh::SamplePointsUniformly,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to uniformly sample points from the mesh.",
                  "number_of_points"_a = 100, "use_triangle_normal"_a = false,
                  "seed"_a = -1)
             .def("sample_points_poisson_disk",
                  &TriangleMesh::SamplePointsPoissonDisk,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sample points from the mesh, where each point "
                  "has "
                  "approximately the same distance to the neighbouring points "
@@ -252,30 +289,45 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
                  "use_triangle_normal"_a = false, "seed"_a = -1)
             .def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using midpoint algorithm.",
                  "number_of_iterations"_a = 1)
             .def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using Loop's algorithm. Loop, "
                  "\"Smooth "
                  "subdivision surfaces based on triangles\", 1987.",
                  "number_of_iterations"_a = 1)
             .def("simplify_vertex_clustering",
                  &TriangleMesh::SimplifyVertexClustering,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using vertex clustering.",
                  "voxel_size"_a,
                  "contraction"_a = MeshBase::SimplificationContraction::Average)
             .def("simplify_quadric_decimation",
                  &TriangleMesh::SimplifyQuadricDecimation,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
                  "target_number_of_triangles"_a,
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
+            .def("simplify_quadric_decimation_parallel",
+                 &TriangleMesh::SimplifyQuadricDecimationParallel,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to simplify mesh using Quadric Error Metric "
+                 "Decimation by Garland and Heckbert, collapsing independent "
+                 "edges in parallel",
+                 "target_number_of_triangles"_a,
+                 "maximum_error"_a = std::numeric_limits<double>::infinity(),
+                 "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
                  &TriangleMesh::ClusterConnectedTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that clusters connected triangles, i.e., triangles "
                  "that are connected via edges are assigned the same cluster "
                  "index.  This function returns an array that contains the "
@@ -305,21 +357,43 @@ void pybind_trianglemesh(py::module &m) {
                  "vertex_mask. Note that also all triangles associated with "
                  "the vertices are removed.",
                  "vertex_mask"_a)
-            .def("deform_as_rigid_as_possible",
-                 &TriangleMesh::DeformAsRigidAsPossible,
-                 "This function deforms the mesh using the method by Sorkine "
-                 "and Alexa, "
-                 "'As-Rigid-As-Possible Surface Modeling', 2007",
-                 "constraint_vertex_indices"_a, "constraint_vertex_positions"_a,
-                 "max_iter"_a,
-                 "energy"_a = MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
-                 "smoothed_alpha"_a = 0.01)
+            .def(
+                    "deform_as_rigid_as_possible",
+                    [](const TriangleMesh &mesh,
+                       const std::vector<int> &constraint_vertex_indices,
+                       const std::vector<Eigen::Vector3d>
+                               &constraint_vertex_positions,
+                       size_t max_iter,
+                       MeshBase::DeformAsRigidAsPossibleEnergy energy,
+                       double smoothed_alpha,
+                       std::shared_ptr<DeformAsRigidAsPossibleCache> cache) {
+                        if (cache) {
+                            return mesh.DeformAsRigidAsPossible(
+                                    constraint_vertex_indices,
+                                    constraint_vertex_positions, max_iter,
+                                    energy, smoothed_alpha, *cache);
+                        }
+                        return mesh.DeformAsRigidAsPossible(
+                                constraint_vertex_indices,
+                                constraint_vertex_positions, max_iter, energy,
+                                smoothed_alpha);
+                    },
+                    py::call_guard<py::gil_scoped_release>(),
+                    "This function deforms the mesh using the method by "
+                    "Sorkine and Alexa, "
+                    "'As-Rigid-As-Possible Surface Modeling', 2007",
+                    "constraint_vertex_indices"_a,
+                    "constraint_vertex_positions"_a, "max_iter"_a,
+                    "energy"_a =
+                            MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+                    "smoothed_alpha"_a = 0.01, "cache"_a = py::none())
             .def_static(
                     "create_from_point_cloud_alpha_shape",
                     [](const PointCloud &pcd, double alpha) {
                         return TriangleMesh::CreateFromPointCloudAlphaShape(
                                 pcd, alpha);
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Alpha shapes are a generalization of the convex hull. "
                     "With decreasing alpha value the shape schrinks and "
                     "creates cavities. See Edelsbrunner and Muecke, "
@@ -327,14 +401,28 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
                         &TriangleMesh::CreateFromPointCloudAlphaShape,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape shrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+            .def_static(
+                    "create_from_point_cloud_alpha_shape",
+                    [](const PointCloud &pcd, double alpha,
+                       AlphaShapeCache &cache) {
+                        return TriangleMesh::CreateFromPointCloudAlphaShape(
+                                pcd, alpha, cache);
+                    },
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Alpha shapes are a generalization of the convex hull. "
+                    "The tetrahedralization of pcd is kept in the cache, so "
+                    "that sweeping alpha only computes it once.",
+                    "pcd"_a, "alpha"_a, "cache"_a)
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function that computes a triangle mesh from a oriented "
                     "PointCloud. This implements the Ball Pivoting algorithm "
                     "proposed in F. Bernardini et al., \"The ball-pivoting "
@@ -348,6 +436,7 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "radii"_a)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Function that computes a triangle mesh from a "
                         "oriented PointCloud pcd. This implements the Screened "
                         "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
@@ -355,7 +444,19 @@ void pybind_trianglemesh(py::module &m) {
                         "This function uses the original implementation by "
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false, "n_threads"_a = -1)
+                        "linear_fit"_a = false, "n_threads"_a = -1,
+                        "max_memory_mb"_a = 0, "temp_dir"_a = "",
+                        "compute_densities"_a = true)
+            .def_static("create_from_point_cloud_poisson_with_timings",
+                        &TriangleMesh::CreateFromPointCloudPoissonWithTimings,
+                        py::call_guard<py::gil_scoped_release>(),
+                        "Same as create_from_point_cloud_poisson, and also "
+                        "returns the time in seconds of each stage of the "
+                        "reconstruction as a list of (stage, seconds).",
+                        "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
+                        "linear_fit"_a = false, "n_threads"_a = -1,
+                        "max_memory_mb"_a = 0, "temp_dir"_a = "",
+                        "compute_densities"_a = true)
             .def_static("create_box", &TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -617,6 +718,16 @@ void pybind_trianglemesh(py::module &m) {
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
               "boundaries"}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "simplify_quadric_decimation_parallel",
+            {{"target_number_of_triangles",
+              "The number of triangles that the simplified mesh should have. "
+              "It is not guaranteed that this number will be reached."},
+             {"maximum_error",
+              "The maximum error where a vertex is allowed to be merged"},
+             {"boundary_weight",
+              "A weight applied to edge vertices used to preserve "
+              "boundaries"}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -654,7 +765,11 @@ void pybind_trianglemesh(py::module &m) {
               "Energy model that is minimized in the deformation process"},
              {"smoothed_alpha",
               "trade-off parameter for the smoothed energy functional for the "
-              "regularization term."}});
+              "regularization term."},
+             {"cache",
+              "Optional DeformAsRigidAsPossibleCache. The factorized system is "
+              "reused if it matches the mesh and the constraint vertex "
+              "indices, and rebuilt otherwise."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_alpha_shape",
             {{"pcd",
@@ -667,7 +782,10 @@ void pybind_trianglemesh(py::module &m) {
               "If not None, than uses this to construct the alpha shape. "
               "Otherwise, TetraMesh is computed from pcd."},
              {"pt_map",
-              "Optional map from tetra_mesh vertex indices to pcd points."}});
+              "Optional map from tetra_mesh vertex indices to pcd points."},
+             {"cache",
+              "AlphaShapeCache with the tetrahedralization of pcd, computed "
+              "on first use and whenever the points change."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_ball_pivoting",
             {{"pcd",
@@ -698,8 +816,50 @@ void pybind_trianglemesh(py::module &m) {
               "If true, the reconstructor will use linear interpolation to "
               "estimate the positions of iso-vertices."},
              {"n_threads",
-              "Number of threads used for reconstruction. Set to -1 to "
-              "automatically determine it."}});
+              "Number of threads used for reconstruction, including the "
+              "linear solver. Set to -1 to automatically determine it."},
+             {"max_memory_mb",
+              "If positive, fail as soon as a stage leaves the process using "
+              "more memory than this."},
+             {"temp_dir",
+              "If not empty, extract the iso-surface out-of-core into "
+              "temporary files in this directory."},
+             {"compute_densities",
+              "If false, the densities are not collected and an empty list is "
+              "returned."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_poisson_with_timings",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"depth",
+              "Maximum depth of the tree that will be used for surface "
+              "reconstruction. Running at depth d corresponds to solving on a "
+              "grid whose resolution is no larger than 2^d x 2^d x 2^d. Note "
+              "that since the reconstructor adapts the octree to the sampling "
+              "density, the specified reconstruction depth is only an upper "
+              "bound."},
+             {"width",
+              "Specifies the target width of the finest level octree cells. "
+              "This parameter is ignored if depth is specified"},
+             {"scale",
+              "Specifies the ratio between the diameter of the cube used for "
+              "reconstruction and the diameter of the samples' bounding cube."},
+             {"linear_fit",
+              "If true, the reconstructor will use linear interpolation to "
+              "estimate the positions of iso-vertices."},
+             {"n_threads",
+              "Number of threads used for reconstruction, including the "
+              "linear solver. Set to -1 to automatically determine it."},
+             {"max_memory_mb",
+              "If positive, fail as soon as a stage leaves the process using "
+              "more memory than this."},
+             {"temp_dir",
+              "If not empty, extract the iso-surface out-of-core into "
+              "temporary files in this directory."},
+             {"compute_densities",
+              "If false, the densities are not collected and an empty list is "
+              "returned."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_box",
             {{"width", "x-directional length."},
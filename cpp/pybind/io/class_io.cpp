@@ -56,6 +56,7 @@ namespace io {
 static const std::unordered_map<std::string, std::string>
         map_shared_argument_docstrings = {
                 {"filename", "Path to file."},
+                {"filenames", "Paths to files."},
                 // Write options
                 {"compressed",
                  "Set to ``True`` to write in compressed format."},
@@ -144,6 +145,20 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_image",
                                  map_shared_argument_docstrings);
 
+    m_io.def(
+            "write_images",
+            [](const std::vector<std::string> &filenames,
+               const std::vector<std::shared_ptr<geometry::Image>> &images,
+               int quality) {
+                py::gil_scoped_release release;
+                return WriteImages(filenames, images, quality);
+            },
+            "Function to write multiple Images to files in parallel",
+            "filenames"_a, "images"_a,
+            "quality"_a = kOpen3DImageIODefaultQuality);
+    docstring::FunctionDocInject(m_io, "write_images",
+                                 map_shared_argument_docstrings);
+
     // open3d::geometry::LineSet
     m_io.def(
             "read_line_set",
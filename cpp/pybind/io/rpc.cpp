@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/RemoteFunctions.h"
@@ -57,6 +58,44 @@ void pybind_rpc(py::module& m_io) {
                  "address"_a = "tcp://127.0.0.1:51454",
                  "connect_timeout"_a = 5000, "timeout"_a = 10000);
 
+    py::class_<rpc::AsyncConnection, std::shared_ptr<rpc::AsyncConnection>,
+               rpc::ConnectionBase>(
+            m, "AsyncConnection",
+            "A connection which queues messages and sends them from a "
+            "background thread without waiting for the replies.")
+            .def(py::init([](std::string address, int connect_timeout,
+                             int timeout, size_t max_queue_size,
+                             size_t max_in_flight, size_t max_batch_bytes,
+                             bool block_when_full) {
+                     rpc::AsyncConnectionOption option;
+                     option.max_queue_size = max_queue_size;
+                     option.max_in_flight = max_in_flight;
+                     option.max_batch_bytes = max_batch_bytes;
+                     option.block_when_full = block_when_full;
+                     return std::make_shared<rpc::AsyncConnection>(
+                             address, connect_timeout, timeout, option);
+                 }),
+                 "Creates an asynchronous connection object",
+                 "address"_a = "tcp://127.0.0.1:51454",
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000,
+                 "max_queue_size"_a = 64, "max_in_flight"_a = 8,
+                 "max_batch_bytes"_a = 4 * 1024 * 1024,
+                 "block_when_full"_a = true)
+            .def("flush", &rpc::AsyncConnection::Flush,
+                 py::call_guard<py::gil_scoped_release>(), "timeout"_a = -1,
+                 "Waits until all queued messages are sent and replied to. "
+                 "Returns False if the timeout (in ms) expired.")
+            .def_property_readonly("queue_size",
+                                   &rpc::AsyncConnection::GetQueueSize,
+                                   "Number of messages waiting to be sent.")
+            .def_property_readonly(
+                    "dropped_count", &rpc::AsyncConnection::GetDroppedCount,
+                    "Number of messages rejected because the queue was full.")
+            .def_property_readonly(
+                    "error_count", &rpc::AsyncConnection::GetErrorCount,
+                    "Number of messages which failed on the receiving end or "
+                    "were not replied to in time.");
+
     py::class_<rpc::DummyReceiver, std::shared_ptr<rpc::DummyReceiver>>(
             m, "_DummyReceiver",
             "Dummy receiver for the server side receiving requests from a "
@@ -141,6 +180,31 @@ void pybind_rpc(py::module& m_io) {
                      "the connection."},
             });
 
+    m.def("update_mesh_data", &rpc::UpdateMeshData, "path"_a, "time"_a = 0,
+          "layer"_a = "",
+          "vertex_attributes"_a = std::map<std::string, core::Tensor>(),
+          "vertex_offset"_a = 0, "num_vertices"_a = -1,
+          "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
+          "Sends an update_mesh_data message, which overwrites a range of "
+          "vertices of previously sent mesh data.");
+    docstring::FunctionDocInject(
+            m, "update_mesh_data",
+            {
+                    {"path", "The path descriptor of the data to update."},
+                    {"time", "The time associated with the data to update."},
+                    {"layer", "The layer associated with the data to update."},
+                    {"vertex_attributes",
+                     "dict of Tensors with the new values. Use 'vertices' for "
+                     "the positions."},
+                    {"vertex_offset", "Index of the first vertex to update."},
+                    {"num_vertices",
+                     "The new number of vertices. A negative value keeps the "
+                     "number of vertices."},
+                    {"connection",
+                     "A Connection object. Use None to automatically create "
+                     "the connection."},
+            });
+
     m.def("set_legacy_camera", &rpc::SetLegacyCamera, "camera"_a, "path"_a = "",
           "time"_a = 0, "layer"_a = "",
           "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
@@ -179,6 +243,83 @@ void pybind_rpc(py::module& m_io) {
                      "A Connection object. Use None to automatically create "
                      "the connection."},
             });
+
+    py::class_<rpc::Frame>(m, "Frame",
+                           "A frame drawn by the viewer, see get_frame().")
+            .def_readonly("id", &rpc::Frame::id)
+            .def_readonly("width", &rpc::Frame::width)
+            .def_readonly("height", &rpc::Frame::height)
+            .def_readonly("channels", &rpc::Frame::channels)
+            .def_readonly("encoding", &rpc::Frame::encoding)
+            .def_property_readonly("data", [](const rpc::Frame& frame) {
+                return py::bytes((const char*)frame.data.data(),
+                                 frame.data.size());
+            });
+
+    m.def(
+            "get_frame",
+            [](int64_t last_frame_id, const std::string& encoding,
+               int quality, int wait_ms,
+               std::shared_ptr<rpc::ConnectionBase> connection) -> py::object {
+                rpc::Frame frame;
+                bool ok;
+                {
+                    py::gil_scoped_release release;
+                    ok = rpc::GetFrame(frame, last_frame_id, encoding,
+                                       quality, wait_ms, connection);
+                }
+                if (!ok) {
+                    return py::none();
+                }
+                return py::cast(std::move(frame));
+            },
+            "last_frame_id"_a = -1, "encoding"_a = "jpeg", "quality"_a = 80,
+            "wait_ms"_a = 0,
+            "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
+            "Requests the last frame drawn by the viewer window. Returns a "
+            "Frame, whose data is empty if no frame newer than "
+            "last_frame_id was drawn, or None on failure.");
+    docstring::FunctionDocInject(
+            m, "get_frame",
+            {
+                    {"last_frame_id",
+                     "The id of the frame the client already has, or -1."},
+                    {"encoding", "'jpeg' or 'raw'."},
+                    {"quality", "JPEG quality in [0, 100]."},
+                    {"wait_ms",
+                     "Time in milliseconds to wait for a frame newer than "
+                     "last_frame_id."},
+                    {"connection",
+                     "A synchronous Connection object. Use None to "
+                     "automatically create the connection."},
+            });
+
+    m.def("send_input_event", &rpc::SendInputEvent, "type"_a, "x"_a = 0,
+          "y"_a = 0, "buttons"_a = 0, "modifiers"_a = 0, "wheel_dx"_a = 0.f,
+          "wheel_dy"_a = 0.f, "key"_a = 0, "text"_a = "",
+          "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
+          "Sends a mouse or keyboard event to the viewer window.");
+    docstring::FunctionDocInject(
+            m, "send_input_event",
+            {
+                    {"type",
+                     "One of 'mouse_move', 'mouse_drag', 'mouse_down', "
+                     "'mouse_up', 'mouse_wheel', 'key_down', 'key_up' and "
+                     "'text'."},
+                    {"x", "Mouse x coordinate in pixels."},
+                    {"y", "Mouse y coordinate in pixels."},
+                    {"buttons",
+                     "Mouse buttons that are down, or the button that "
+                     "changed for 'mouse_down' and 'mouse_up'."},
+                    {"modifiers", "Key modifiers that are down."},
+                    {"wheel_dx", "Horizontal mouse wheel movement."},
+                    {"wheel_dy", "Vertical mouse wheel movement."},
+                    {"key", "Key code for 'key_down' and 'key_up'."},
+                    {"text", "UTF-8 text for 'text'."},
+                    {"connection",
+                     "A Connection object. Use None to automatically create "
+                     "the connection."},
+            });
 }
 
 }  // namespace io
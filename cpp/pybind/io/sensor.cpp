@@ -118,7 +118,52 @@ void pybind_sensor(py::module &m) {
             .def("record_frame", &AzureKinectRecorder::RecordFrame,
                  "enable_record"_a, "enable_align_depth_to_color"_a,
                  "Record a frame to mkv if flag is on and return an RGBD "
-                 "object.");
+                 "object.")
+            .def("start_async_record", &AzureKinectRecorder::StartAsyncRecord,
+                 "enable_record"_a, "enable_align_depth_to_color"_a,
+                 "queue_size"_a = 16,
+                 "Start capturing, writing and decoding frames on background "
+                 "threads.")
+            .def("set_async_write", &AzureKinectRecorder::SetAsyncWrite,
+                 "enable_record"_a,
+                 "Enable or pause writing to mkv during asynchronous "
+                 "recording.")
+            .def("next_frame", &AzureKinectRecorder::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(), "wait"_a = true,
+                 "Get the latest decoded frame of the asynchronous "
+                 "recording.")
+            .def("stop_async_record", &AzureKinectRecorder::StopAsyncRecord,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Stop the asynchronous recording.")
+            .def("get_stats", &AzureKinectRecorder::GetStats,
+                 "Get frame counts and latencies of the asynchronous "
+                 "recording.");
+
+    py::class_<AzureKinectRecorderStats> azure_kinect_recorder_stats(
+            m, "AzureKinectRecorderStats",
+            "Frame counts and per-stage latencies of an asynchronous "
+            "AzureKinect recording.");
+    azure_kinect_recorder_stats
+            .def_readonly("captured_frames",
+                          &AzureKinectRecorderStats::captured_frames)
+            .def_readonly("device_dropped_frames",
+                          &AzureKinectRecorderStats::device_dropped_frames)
+            .def_readonly("written_frames",
+                          &AzureKinectRecorderStats::written_frames)
+            .def_readonly("write_dropped_frames",
+                          &AzureKinectRecorderStats::write_dropped_frames)
+            .def_readonly("decoded_frames",
+                          &AzureKinectRecorderStats::decoded_frames)
+            .def_readonly("decode_dropped_frames",
+                          &AzureKinectRecorderStats::decode_dropped_frames)
+            .def_readonly("mean_write_latency_ms",
+                          &AzureKinectRecorderStats::mean_write_latency_ms)
+            .def_readonly("max_write_latency_ms",
+                          &AzureKinectRecorderStats::max_write_latency_ms)
+            .def_readonly("mean_decode_latency_ms",
+                          &AzureKinectRecorderStats::mean_decode_latency_ms)
+            .def_readonly("max_decode_latency_ms",
+                          &AzureKinectRecorderStats::max_decode_latency_ms);
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder", "init_sensor",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder",
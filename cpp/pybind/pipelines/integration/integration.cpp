@@ -88,11 +88,14 @@ In SIGGRAPH, 1996)");
             .def("reset", &TSDFVolume::Reset,
                  "Function to reset the TSDFVolume")
             .def("integrate", &TSDFVolume::Integrate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to integrate an RGB-D image into the volume",
                  "image"_a, "intrinsic"_a, "extrinsic"_a)
             .def("extract_point_cloud", &TSDFVolume::ExtractPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a point cloud with normals")
             .def("extract_triangle_mesh", &TSDFVolume::ExtractTriangleMesh,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a triangle mesh")
             .def_readwrite("voxel_length", &TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
@@ -144,8 +147,10 @@ In SIGGRAPH, 1996)");
                  })  // todo: extend
             .def("extract_voxel_point_cloud",
                  &UniformTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point cloud.")
             .def("extract_voxel_grid", &UniformTSDFVolume::ExtractVoxelGrid,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data VoxelGrid.")
             .def_readwrite("length", &UniformTSDFVolume::length_,
                            "Total length, where ``voxel_length = length / "
@@ -202,6 +207,7 @@ In SIGGRAPH, 2013)");
                  })
             .def("extract_voxel_point_cloud",
                  &ScalableTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point "
                  "cloud.");
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
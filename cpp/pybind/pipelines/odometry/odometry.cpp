@@ -174,10 +174,40 @@ Anonymous submission.)");
             "__repr__", [](const RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.RGBDOdometryTracker
+    py::class_<RGBDOdometryTracker> tracker(
+            m, "RGBDOdometryTracker",
+            "Estimates 6D rigid motion between consecutive RGBD frames. The "
+            "preprocessed image pyramids of each frame are kept and reused as "
+            "the target of the next call to ``track``.");
+    tracker.def(py::init<const camera::PinholeCameraIntrinsic &,
+                         const OdometryOption &>(),
+                "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+                "option"_a = OdometryOption())
+            .def("track", &RGBDOdometryTracker::Track,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Estimates the motion from ``rgbd`` to the previous frame "
+                 "and keeps ``rgbd`` as the target of the next call. The "
+                 "first frame only initializes the tracker. Output: "
+                 "(is_success, 4x4 motion matrix, 6x6 information matrix).",
+                 "rgbd"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+                 "jacobian"_a = RGBDOdometryJacobianFromHybridTerm())
+            .def("reset", &RGBDOdometryTracker::Reset,
+                 "Drops the previous frame.")
+            .def("has_reference", &RGBDOdometryTracker::HasReference,
+                 "Returns ``True`` if a previous frame is available to track "
+                 "against.")
+            .def("__repr__", [](const RGBDOdometryTracker &tracker) {
+                return std::string("RGBDOdometryTracker with ") +
+                       (tracker.HasReference() ? "a" : "no") +
+                       " previous frame";
+            });
 }
 
 void pybind_odometry_methods(py::module &m) {
     m.def("compute_rgbd_odometry", &ComputeRGBDOdometry,
+          py::call_guard<py::gil_scoped_release>(),
           "Function to estimate 6D rigid motion from two RGBD image pairs. "
           "Output: (is_success, 4x4 motion matrix, 6x6 information matrix).",
           "rgbd_source"_a, "rgbd_target"_a,
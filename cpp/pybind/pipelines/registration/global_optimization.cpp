@@ -321,6 +321,30 @@ void pybind_global_optimization(py::module &m) {
                        std::string("\n> reference_node : ") +
                        std::to_string(goo.reference_node_);
             });
+
+    // open3d.pipelines.registration.IncrementalGlobalOptimization
+    py::class_<IncrementalGlobalOptimization> incremental(
+            m, "IncrementalGlobalOptimization",
+            "Incremental pose graph optimization for online reconstruction. "
+            "Only nodes affected by new edges are relinearized.");
+    incremental
+            .def(py::init<const GlobalOptimizationOption &, double>(),
+                 "option"_a = GlobalOptimizationOption(),
+                 "relinearization_threshold"_a = 1e-3)
+            .def("add_node", &IncrementalGlobalOptimization::AddNode,
+                 "Adds a node and returns its index.", "node"_a)
+            .def("add_edge", &IncrementalGlobalOptimization::AddEdge,
+                 "Adds an edge between two existing nodes.", "edge"_a)
+            .def("optimize_incremental",
+                 &IncrementalGlobalOptimization::OptimizeIncremental,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Optimizes the nodes affected since the last call within "
+                 "time_budget milliseconds (negative for no limit). Returns "
+                 "the number of nodes still waiting to be relinearized.",
+                 "criteria"_a = GlobalOptimizationConvergenceCriteria(),
+                 "time_budget"_a = -1.0)
+            .def("get_pose_graph", &IncrementalGlobalOptimization::GetPoseGraph,
+                 "Returns the current pose graph.");
 }
 
 void pybind_global_optimization_methods(py::module &m) {
@@ -331,6 +355,7 @@ void pybind_global_optimization_methods(py::module &m) {
                const GlobalOptimizationOption &option) {
                 GlobalOptimization(pose_graph, method, criteria, option);
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Function to optimize PoseGraph", "pose_graph"_a, "method"_a,
             "criteria"_a, "option"_a);
     docstring::FunctionDocInject(
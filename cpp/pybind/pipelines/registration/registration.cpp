@@ -413,6 +413,39 @@ must hold true for all edges.)");
                                    normal_angle_threshold_,
                            "Radian value for angle threshold.");
 
+    // open3d.registration.FeatureMatchingOption:
+    py::class_<FeatureMatchingOption> matching_option(
+            m, "FeatureMatchingOption",
+            "Options for nearest neighbor matching in feature space. "
+            "``num_trees > 0`` matches approximately with a forest of "
+            "randomized KDTrees.");
+    py::detail::bind_copy_functions<FeatureMatchingOption>(matching_option);
+    matching_option
+            .def(py::init([](int num_trees, int checks,
+                             int recall_sample_size) {
+                     return new FeatureMatchingOption(num_trees, checks,
+                                                      recall_sample_size);
+                 }),
+                 "num_trees"_a = 0, "checks"_a = 64,
+                 "recall_sample_size"_a = 256)
+            .def_readwrite("num_trees", &FeatureMatchingOption::num_trees_,
+                           "int: Number of randomized KDTrees. 0 matches "
+                           "exactly.")
+            .def_readwrite("checks", &FeatureMatchingOption::checks_,
+                           "int: Maximum number of leaves visited per query "
+                           "in approximate mode.")
+            .def_readwrite(
+                    "recall_sample_size",
+                    &FeatureMatchingOption::recall_sample_size_,
+                    "int: Number of queries used to estimate the recall in "
+                    "approximate mode.")
+            .def("__repr__", [](const FeatureMatchingOption &c) {
+                return fmt::format(
+                        "FeatureMatchingOption with num_trees={:d}, "
+                        "checks={:d}, and recall_sample_size={:d}",
+                        c.num_trees_, c.checks_, c.recall_sample_size_);
+            });
+
     // open3d.registration.FastGlobalRegistrationOption:
     py::class_<FastGlobalRegistrationOption> fgr_option(
             m, "FastGlobalRegistrationOption",
@@ -423,17 +456,20 @@ must hold true for all edges.)");
                              bool decrease_mu,
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
-                             int maximum_tuple_count) {
+                             int maximum_tuple_count,
+                             const FeatureMatchingOption &matching_option) {
                      return new FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
-                             tuple_scale, maximum_tuple_count);
+                             tuple_scale, maximum_tuple_count,
+                             matching_option);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
-                 "maximum_tuple_count"_a = 1000)
+                 "maximum_tuple_count"_a = 1000,
+                 "matching_option"_a = FeatureMatchingOption())
             .def_readwrite(
                     "division_factor",
                     &FastGlobalRegistrationOption::division_factor_,
@@ -461,6 +497,10 @@ must hold true for all edges.)");
             .def_readwrite("maximum_tuple_count",
                            &FastGlobalRegistrationOption::maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite("matching_option",
+                           &FastGlobalRegistrationOption::matching_option_,
+                           "FeatureMatchingOption: Exact or approximate "
+                           "feature matching.")
             .def("__repr__", [](const FastGlobalRegistrationOption &c) {
                 return fmt::format(
                         ""
@@ -502,6 +542,11 @@ must hold true for all edges.)");
                     "fitness", &RegistrationResult::fitness_,
                     "float: The overlapping area (# of inlier correspondences "
                     "/ # of points in target). Higher is better.")
+            .def_readwrite("feature_matching_recall",
+                           &RegistrationResult::feature_matching_recall_,
+                           "float: Estimated fraction of feature matches that "
+                           "found the true nearest neighbor. 1.0 for exact "
+                           "matching.")
             .def("__repr__", [](const RegistrationResult &rr) {
                 return fmt::format(
                         "RegistrationResult with "
@@ -512,6 +557,28 @@ must hold true for all edges.)");
                         rr.fitness_, rr.inlier_rmse_,
                         rr.correspondence_set_.size());
             });
+
+    // open3d.registration.RegistrationPair
+    py::class_<RegistrationPair> registration_pair(
+            m, "RegistrationPair",
+            "A pair of fragments to register in a batch, given by their "
+            "indices in the fragment list, and an initial transformation.");
+    py::detail::bind_copy_functions<RegistrationPair>(registration_pair);
+    registration_pair
+            .def(py::init<int, int, const Eigen::Matrix4d &>(),
+                 "source_id"_a = 0, "target_id"_a = 0,
+                 "init"_a = Eigen::Matrix4d::Identity())
+            .def_readwrite("source_id", &RegistrationPair::source_id_,
+                           "int: Index of the source fragment.")
+            .def_readwrite("target_id", &RegistrationPair::target_id_,
+                           "int: Index of the target fragment.")
+            .def_readwrite("init", &RegistrationPair::init_,
+                           "``4 x 4`` float64 numpy array: Initial "
+                           "transformation estimation.")
+            .def("__repr__", [](const RegistrationPair &rp) {
+                return fmt::format("RegistrationPair from {:d} to {:d}",
+                                   rp.source_id_, rp.target_id_);
+            });
 }
 
 // Registration functions have similar arguments, sharing arg docstrings
@@ -534,6 +601,8 @@ static const std::unordered_map<std::string, std::string>
                  "o3d.utility.Vector2iVector that stores indices of "
                  "corresponding point or feature arrays."},
                 {"criteria", "Convergence criteria"},
+                {"features", "Features of the fragments."},
+                {"fragments", "The fragment point clouds."},
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``"
@@ -545,12 +614,16 @@ static const std::unordered_map<std::string, std::string>
                 {"init", "Initial transformation estimation"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"kernel", "Robust Kernel used in the Optimization"},
+                {"matching_option",
+                 "Options for exact or approximate feature matching."},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
                 {"mutual_filter",
                  "Enables mutual filter such that the correspondence of the "
                  "source point's correspondence is itself."},
                 {"option", "Registration option"},
+                {"pairs",
+                 "List of ``RegistrationPair`` fragment pairs to register."},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source_feature", "Source point cloud feature."},
                 {"source", "The source point cloud."},
@@ -562,14 +635,22 @@ static const std::unordered_map<std::string, std::string>
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &EvaluateRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a = Eigen::Matrix4d::Identity());
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &RegistrationICP, "Function for ICP registration",
-          "source"_a, "target"_a, "max_correspondence_distance"_a,
+    m.def("registration_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &,
+                            const TransformationEstimation &,
+                            const ICPConvergenceCriteria &>(&RegistrationICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration", "source"_a, "target"_a,
+          "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "estimation_method"_a = TransformationEstimationPointToPoint(false),
           "criteria"_a = ICPConvergenceCriteria());
@@ -577,6 +658,7 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("registration_colored_icp", &RegistrationColoredICP,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -587,6 +669,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_ransac_based_on_correspondence",
           &RegistrationRANSACBasedOnCorrespondence,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on a set of "
           "correspondences",
           "source"_a, "target"_a, "corres"_a, "max_correspondence_distance"_a,
@@ -601,6 +684,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("registration_ransac_based_on_feature_matching",
           &RegistrationRANSACBasedOnFeatureMatching,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "mutual_filter"_a, "max_correspondence_distance"_a,
@@ -608,13 +692,43 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 3,
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
-          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999));
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
+          "matching_option"_a = FeatureMatchingOption());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
 
+    m.def("registration_icp_multi_pair", &RegistrationICPMultiPair,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration of many fragment pairs. Returns one "
+          "RegistrationResult per pair.",
+          "fragments"_a, "pairs"_a, "max_correspondence_distance"_a,
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "criteria"_a = ICPConvergenceCriteria());
+    docstring::FunctionDocInject(m, "registration_icp_multi_pair",
+                                 map_shared_argument_docstrings);
+
+    m.def("registration_ransac_based_on_feature_matching_multi_pair",
+          &RegistrationRANSACBasedOnFeatureMatchingMultiPair,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for global RANSAC registration of many fragment pairs "
+          "based on feature matching. Returns one RegistrationResult per "
+          "pair.",
+          "fragments"_a, "features"_a, "pairs"_a, "mutual_filter"_a,
+          "max_correspondence_distance"_a,
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "ransac_n"_a = 3,
+          "checkers"_a = std::vector<
+                  std::reference_wrapper<const CorrespondenceChecker>>(),
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
+          "matching_option"_a = FeatureMatchingOption());
+    docstring::FunctionDocInject(
+            m, "registration_ransac_based_on_feature_matching_multi_pair",
+            map_shared_argument_docstrings);
+
     m.def("registration_fast_based_on_feature_matching",
           &FastGlobalRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for fast global registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "option"_a = FastGlobalRegistrationOption());
@@ -624,6 +738,7 @@ void pybind_registration_methods(py::module &m) {
 
     m.def("get_information_matrix_from_point_clouds",
           &GetInformationMatrixFromPointClouds,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for computing information matrix from transformation "
           "matrix",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
@@ -131,19 +131,22 @@ void pybind_image(py::module &m) {
                  "image = scale * image + offset.",
                  "scale"_a = 1.0, "offset"_a = 0.0)
             .def("dilate", &Image::Dilate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after performing morphological dilation. "
-                 "Supported datatypes are UInt8, UInt16 and Float32 with "
-                 "{1, 3, 4} channels. An 8-connected neighborhood is used to "
-                 "create the dilation mask.",
+                 "An 8-connected neighborhood is used to create the dilation "
+                 "mask.",
                  "kernel_size"_a = 3)
             .def("filter", &Image::Filter,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after filtering with the given kernel.",
                  "kernel"_a)
             .def("filter_gaussian", &Image::FilterGaussian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after Gaussian filtering."
                  "Possible kernel_size: odd numbers >= 3 are supported.",
                  "kernel_size"_a = 3, "sigma"_a = 1.0)
             .def("filter_bilateral", &Image::FilterBilateral,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after bilateral filtering."
                  "Note: CPU (IPP) and CUDA (NPP) versions are inconsistent:"
                  "CPU uses a round kernel (radius = floor(kernel_size / 2)),"
@@ -152,11 +155,13 @@ void pybind_image(py::module &m) {
                  "kernel_size"_a = 3, "value_sigma"_a = 20.0,
                  "dist_sigma"_a = 10.0)
             .def("filter_sobel", &Image::FilterSobel,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a pair of new gradient images (dx, dy) after Sobel "
                  "filtering."
                  "Possible kernel_size: 3 and 5.",
                  "kernel_size"_a = 3)
             .def("resize", &Image::Resize,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after resizing with specified "
                  "interpolation type. Downsample if sampling rate is < 1. "
                  "Upsample if sampling rate > 1. Aspect ratio is always "
@@ -164,6 +169,7 @@ void pybind_image(py::module &m) {
                  "sampling_rate"_a = 0.5,
                  "interp_type"_a = Image::InterpType::Nearest)
             .def("pyrdown", &Image::PyrDown,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new downsampled image with pyramid downsampling "
                  "formed by a"
                  "chained Gaussian filter (kernel_size = 5, sigma = 1.0) and a"
@@ -181,11 +187,19 @@ void pybind_image(py::module &m) {
               "image. Each pixel will be transformed by x = x / scale; x = x < "
               "min_value ? clip_fill : x; x = x > max_value ? clip_fill : x",
               "scale"_a, "min_value"_a, "max_value"_a, "clip_fill"_a = 0.0f);
+    image.def("pyrdown_depth", &Image::PyrDownDepth,
+              "Downsample a depth image of (H, W, 1) in Float32 with a "
+              "Gaussian filter (kernel_size = 5, sigma = 1.0) over the valid "
+              "neighbors whose depth differs from the center by less than "
+              "diff_threshold.",
+              "diff_threshold"_a, "invalid_fill"_a = 0.0f);
     image.def("create_vertex_map", &Image::CreateVertexMap,
+              py::call_guard<py::gil_scoped_release>(),
               "Create a vertex map (H, W, 3) in Float32 from an image of (H, "
               "W, 1) in Float32 using unprojection",
               "intrinsics"_a, "invalid_fill"_a = 0.0f);
     image.def("create_normal_map", &Image::CreateNormalMap,
+              py::call_guard<py::gil_scoped_release>(),
               "Create a normal map (H, W, 3) in Float32 from a vertex map of "
               "(H, W, 1) in Float32 using cross product",
               "invalid_fill"_a = 0.0f);
@@ -193,6 +207,12 @@ void pybind_image(py::module &m) {
               " Colorize an input depth image with the Turbo colormap, "
               "rescaled within (min_range, max_range)",
               "scale"_a, "min_range"_a, "max_range"_a);
+    image.def("align_depth", &Image::AlignDepth,
+              py::call_guard<py::gil_scoped_release>(),
+              "Reproject a UInt16 depth image into another camera with an "
+              "image of (rows, cols), keeping the nearest depth per pixel.",
+              "rows"_a, "cols"_a, "depth_intrinsics"_a, "intrinsics"_a,
+              "depth_to_camera"_a, "depth_scale"_a = 1000.0f);
 
     // Device transfers.
     image.def("to",
@@ -28,8 +28,10 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "pybind/docstring.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -95,32 +97,169 @@ void pybind_pointcloud(py::module& m) {
                    "Returns the max bound for point coordinates.");
     pointcloud.def("get_center", &PointCloud::GetCenter,
                    "Returns the center for point coordinates.");
+    pointcloud.def("get_segment_axis_aligned_bounding_boxes",
+                   &PointCloud::GetSegmentAxisAlignedBoundingBoxes,
+                   "segment_ids"_a,
+                   "Returns the min bounds and the max bounds of the points "
+                   "of each segment. Points with a negative segment id are "
+                   "ignored.");
+    pointcloud.def("get_segment_oriented_bounding_boxes",
+                   &PointCloud::GetSegmentOrientedBoundingBoxes,
+                   "segment_ids"_a, "minimal"_a = false,
+                   "Returns the centers, rotations and extents of the "
+                   "oriented bounding boxes of the points of each segment, "
+                   "aligned with their principal axes, or of minimal volume "
+                   "if minimal is true.");
     pointcloud.def("transform", &PointCloud::Transform, "transformation"_a,
                    "Transforms the points and normals (if exist).");
+    pointcloud.def("transform_segments", &PointCloud::TransformSegments,
+                   "transformations"_a, "offsets"_a,
+                   "Transforms the points and normals (if exist) of segment "
+                   "s, the rows offsets[s] to offsets[s + 1] - 1, by "
+                   "transformations[s], in place and in a single pass.");
+    pointcloud.def_static(
+            "transform_batch",
+            [](py::list pcds, const core::Tensor &transformations) {
+                std::vector<PointCloud> batch;
+                for (auto pcd : pcds) {
+                    batch.push_back(pcd.cast<PointCloud>());
+                }
+                PointCloud::TransformBatch(batch, transformations);
+                // The tensors may have been made contiguous.
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    pcds[i].cast<PointCloud &>() = batch[i];
+                }
+            },
+            "pcds"_a, "transformations"_a,
+            "Transforms the points and normals (if exist) of each point "
+            "cloud by its own transformation, in place and in a single "
+            "pass.");
     pointcloud.def("translate", &PointCloud::Translate, "translation"_a,
                    "relative"_a = true, "Translates points.");
     pointcloud.def("scale", &PointCloud::Scale, "scale"_a, "center"_a,
                    "Scale points.");
     pointcloud.def("rotate", &PointCloud::Rotate, "R"_a, "center"_a,
                    "Rotate points and normals (if exist).");
+    pointcloud.def("sort_by_morton_code", &PointCloud::SortByMortonCode,
+                   "Reorder points and all attributes along a Z-order curve "
+                   "for cache locality.");
     pointcloud.def(
             "voxel_down_sample",
             [](const PointCloud& pointcloud, const double voxel_size) {
                 return pointcloud.VoxelDownSample(
                         voxel_size, core::HashmapBackend::Default);
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def(
+            "voxel_down_sample_and_trace",
+            [](const PointCloud& pointcloud, const double voxel_size) {
+                core::Tensor trace;
+                PointCloud pcd_down =
+                        pointcloud.VoxelDownSampleAndTrace(voxel_size, trace);
+                return py::make_tuple(pcd_down, trace);
+            },
+            "Downsamples a point cloud by averaging the points and all point "
+            "attributes within each voxel. Returns the downsampled point "
+            "cloud and the index of the output point of each input point.",
+            "voxel_size"_a);
+    pointcloud.def("farthest_point_down_sample",
+                   &PointCloud::FarthestPointDownSample,
+                   py::call_guard<py::gil_scoped_release>(), "num_samples"_a,
+                   "voxel_size"_a = 0.0,
+                   "Downsample the point cloud with farthest point sampling. "
+                   "A positive voxel_size samples approximately from one "
+                   "point per voxel.");
+    pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "max_nn"_a = 30, "radius"_a = py::none(),
+                   "Estimate the normals of the points from the covariance of "
+                   "their neighborhoods, optionally limited to a radius. "
+                   "Existing normals are used for orientation.");
+    pointcloud.def("estimate_color_gradients",
+                   &PointCloud::EstimateColorGradients,
+                   py::call_guard<py::gil_scoped_release>(), "max_nn"_a = 30,
+                   "radius"_a = py::none(),
+                   "Estimate the gradients of the color intensity on the "
+                   "tangent planes of the points for colored ICP, stored in "
+                   "the ``color_gradients`` attribute.");
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                   py::call_guard<py::gil_scoped_release>(), "eps"_a,
+                   "min_points"_a,
+                   "Cluster the points with DBSCAN. Returns the cluster label "
+                   "of each point, -1 for noise.");
+    pointcloud.def("compute_iss_keypoints", &PointCloud::ComputeISSKeypoints,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "salient_radius"_a = 0.0, "non_max_radius"_a = 0.0,
+                   "gamma_21"_a = 0.975, "gamma_32"_a = 0.975,
+                   "min_neighbors"_a = 5,
+                   "Detect the Intrinsic Shape Signatures keypoints. Returns "
+                   "the keypoints and the boolean mask of the keypoints.");
+    pointcloud.def("segment_plane", &PointCloud::SegmentPlane,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                   "num_iterations"_a = 100, "probability"_a = 0.99999999,
+                   "Segment a plane with RANSAC. Returns the plane model "
+                   "[a, b, c, d] of ax + by + cz + d = 0 and the indices of "
+                   "its inliers.");
+    pointcloud.def("hidden_point_removal", &PointCloud::HiddenPointRemoval,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "camera_location"_a, "radius"_a,
+                   "Remove the points hidden from the camera location. "
+                   "Returns the mesh of the visible points and their "
+                   "indices.");
+    pointcloud.def("compute_point_cloud_distance",
+                   &PointCloud::ComputePointCloudDistance,
+                   py::call_guard<py::gil_scoped_release>(), "target"_a,
+                   "Compute the distance from each point to its nearest "
+                   "neighbor in the target point cloud.");
+    pointcloud.def("compute_nearest_neighbor_distance",
+                   &PointCloud::ComputeNearestNeighborDistance,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Compute the distance from each point to its nearest "
+                   "neighbor in the point cloud, the point itself excluded.");
+    pointcloud.def("compute_hausdorff_distance",
+                   &PointCloud::ComputeHausdorffDistance,
+                   py::call_guard<py::gil_scoped_release>(), "target"_a,
+                   "symmetric"_a = true,
+                   "Compute the Hausdorff distance to the target point cloud, "
+                   "in one or both directions.");
+    pointcloud.def("compute_chamfer_distance",
+                   &PointCloud::ComputeChamferDistance,
+                   py::call_guard<py::gil_scoped_release>(), "target"_a,
+                   "Compute the sum of the mean nearest neighbor distances "
+                   "in both directions.");
+    pointcloud.def("select_by_mask", &PointCloud::SelectByMask, "mask"_a,
+                   "invert"_a = false,
+                   "Select the points where the boolean mask is true.");
+    pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "nb_points"_a, "search_radius"_a,
+                   "Remove points that have less than nb_points neighbors in "
+                   "a sphere of a given radius. Returns the filtered point "
+                   "cloud and the boolean mask of the kept points.");
+    pointcloud.def("remove_statistical_outliers",
+                   &PointCloud::RemoveStatisticalOutliers,
+                   py::call_guard<py::gil_scoped_release>(), "nb_neighbors"_a,
+                   "std_ratio"_a,
+                   "Remove points that are further away from their neighbors "
+                   "than the average for the point cloud. Returns the "
+                   "filtered point cloud and the boolean mask of the kept "
+                   "points.");
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             py::call_guard<py::gil_scoped_release>(), "depth"_a, "intrinsics"_a,
             "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
                                                core::Device("CPU:0")),
             "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f, "stride"_a = 1,
+            "distortion"_a = std::vector<double>(),
             "Factory function to create a pointcloud (with only 'points') from "
             "a depth image and a camera model.\n\n Given depth value d at (u, "
             "v) image coordinate, the corresponding 3d point is:\n z = d / "
-            "depth_scale\n x = (u - cx) * z / fx\n y = (v - cy) * z / fy");
+            "depth_scale\n x = (u - cx) * z / fx\n y = (v - cy) * z / fy\n\n "
+            "distortion holds the Brown-Conrady coefficients (k1, k2, p1, p2, "
+            "k3) of a distorted camera.");
     pointcloud.def_static(
             "create_from_rgbd_image", &PointCloud::CreateFromRGBDImage,
             py::call_guard<py::gil_scoped_release>(), "rgbd_image"_a,
@@ -128,17 +267,60 @@ void pybind_pointcloud(py::module& m) {
             "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
                                                core::Device("CPU:0")),
             "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f, "stride"_a = 1,
+            "distortion"_a = std::vector<double>(),
             "Factory function to create a pointcloud (with properties "
             "{'points', 'colors'}) from an RGBD image and a camera model.\n\n "
             "Given depth value d at (u, v) image coordinate, the corresponding "
             "3d point is:\n z = d / depth_scale\n x = (u - cx) * z / fx\n y = "
-            "(v - cy) * z / fy");
+            "(v - cy) * z / fy\n\n distortion holds the Brown-Conrady "
+            "coefficients (k1, k2, p1, p2, k3) of a distorted camera. Colors "
+            "are converted to Float32 while unprojecting.");
+    pointcloud.def("project_to_depth_image", &PointCloud::ProjectToDepthImage,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a,
+                   "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                      core::Device("CPU:0")),
+                   "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+                   "Project the point cloud into a Float32 depth image. Each "
+                   "pixel holds the depth of the closest point, scaled by "
+                   "depth_scale, or 0.");
+    pointcloud.def("project_to_rgbd_image", &PointCloud::ProjectToRGBDImage,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a,
+                   "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
+                                                      core::Device("CPU:0")),
+                   "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+                   "Project the point cloud and its colors into an RGBD image "
+                   "with Float32 depth and color images.");
+    pointcloud.def("project_to_depth_images",
+                   &PointCloud::ProjectToDepthImages,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a, "extrinsics"_a,
+                   "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+                   "Project the point cloud into the depth images of a batch "
+                   "of cameras with extrinsics of shape (B, 4, 4).");
+    pointcloud.def("project_to_rgbd_images",
+                   &PointCloud::ProjectToRGBDImages,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a, "extrinsics"_a,
+                   "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+                   "Project the point cloud and its colors into the RGBD "
+                   "images of a batch of cameras with extrinsics of shape "
+                   "(B, 4, 4).");
     pointcloud.def_static(
-            "from_legacy_pointcloud", &PointCloud::FromLegacyPointCloud,
+            "from_legacy_pointcloud",
+            [](const open3d::geometry::PointCloud &pcd_legacy,
+               core::Dtype dtype, const core::Device &device) {
+                return PointCloud::FromLegacyPointCloud(pcd_legacy, dtype,
+                                                        device);
+            },
             "pcd_legacy"_a, "dtype"_a = core::Dtype::Float32,
             "device"_a = core::Device("CPU:0"),
             "Create a PointCloud from a legacy Open3D PointCloud.");
-    pointcloud.def("to_legacy_pointcloud", &PointCloud::ToLegacyPointCloud,
+    pointcloud.def("to_legacy_pointcloud",
+                   static_cast<open3d::geometry::PointCloud (PointCloud::*)()
+                                       const &>(
+                           &PointCloud::ToLegacyPointCloud),
                    "Convert to a legacy Open3D PointCloud.");
 
     docstring::ClassMethodDocInject(m, "PointCloud", "create_from_depth_image",
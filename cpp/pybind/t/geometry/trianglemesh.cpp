@@ -89,14 +89,108 @@ void pybind_trianglemesh(py::module& m) {
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def("normalize_normals", &TriangleMesh::NormalizeNormals,
+                      "Normalize vertex and triangle normals to length 1.");
+    triangle_mesh.def("compute_triangle_normals",
+                      &TriangleMesh::ComputeTriangleNormals,
+                      "Computes the triangle normals on the device of the "
+                      "mesh.",
+                      "normalized"_a = true);
+    triangle_mesh.def("compute_vertex_normals",
+                      &TriangleMesh::ComputeVertexNormals,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Computes the vertex normals on the device of the mesh.",
+                      "normalized"_a = true);
+    triangle_mesh.def("remove_duplicated_vertices",
+                      &TriangleMesh::RemoveDuplicatedVertices,
+                      "Merges the vertices with exactly equal coordinates.");
+    triangle_mesh.def("remove_unreferenced_vertices",
+                      &TriangleMesh::RemoveUnreferencedVertices,
+                      "Removes the vertices that are not referenced by any "
+                      "triangle.");
+    triangle_mesh.def("remove_degenerate_triangles",
+                      &TriangleMesh::RemoveDegenerateTriangles,
+                      "Removes the triangles that reference a vertex more "
+                      "than once.");
+    triangle_mesh.def("sample_points_uniformly",
+                      &TriangleMesh::SamplePointsUniformly,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Samples points uniformly on the surface of the mesh.",
+                      "number_of_points"_a = 100,
+                      "use_triangle_normal"_a = false, "seed"_a = -1);
+    triangle_mesh.def("sample_points_poisson_disk",
+                      &TriangleMesh::SamplePointsPoissonDisk,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Samples points on the surface of the mesh with Poisson "
+                      "disk sampling by sample elimination.",
+                      "number_of_points"_a, "init_factor"_a = 5,
+                      "use_triangle_normal"_a = false, "seed"_a = -1);
+    triangle_mesh.def("simplify_vertex_clustering",
+                      &TriangleMesh::SimplifyVertexClustering,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Merges the vertices in each voxel of a uniform grid "
+                      "into their average.",
+                      "voxel_size"_a);
+    triangle_mesh.def("compute_point_distance",
+                      &TriangleMesh::ComputePointDistance,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Computes the distance from each query point to the "
+                      "surface of the mesh, and the index of its closest "
+                      "triangle.",
+                      "query_points"_a);
+    triangle_mesh.def("cluster_connected_triangles",
+                      &TriangleMesh::ClusterConnectedTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Clusters the triangles connected through shared edges. "
+                      "Returns the cluster of each triangle, and the number "
+                      "of triangles and the surface area of each cluster.");
+    triangle_mesh.def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Sharpens the mesh with the filter of the legacy "
+                      "TriangleMesh.filter_sharpen.",
+                      "number_of_iterations"_a = 1, "strength"_a = 1,
+                      "filter_scope"_a = TriangleMesh::FilterScope::All);
+    triangle_mesh.def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Smooths the mesh with the filter of the legacy "
+                      "TriangleMesh.filter_smooth_simple.",
+                      "number_of_iterations"_a = 1,
+                      "filter_scope"_a = TriangleMesh::FilterScope::All);
+    triangle_mesh.def("filter_smooth_laplacian",
+                      &TriangleMesh::FilterSmoothLaplacian,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Smooths the mesh with the filter of the legacy "
+                      "TriangleMesh.filter_smooth_laplacian.",
+                      "number_of_iterations"_a = 1, "lambda"_a = 0.5,
+                      "filter_scope"_a = TriangleMesh::FilterScope::All);
+    triangle_mesh.def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Smooths the mesh with the filter of the legacy "
+                      "TriangleMesh.filter_smooth_taubin.",
+                      "number_of_iterations"_a = 1, "lambda"_a = 0.5,
+                      "mu"_a = -0.53,
+                      "filter_scope"_a = TriangleMesh::FilterScope::All);
+    triangle_mesh.def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Subdivides each triangle into four at the midpoints of "
+                      "its edges.",
+                      "number_of_iterations"_a = 1);
     triangle_mesh.def_static(
-            "from_legacy_triangle_mesh", &TriangleMesh::FromLegacyTriangleMesh,
+            "from_legacy_triangle_mesh",
+            [](const open3d::geometry::TriangleMesh &mesh_legacy,
+               core::Dtype float_dtype, core::Dtype int_dtype,
+               const core::Device &device) {
+                return TriangleMesh::FromLegacyTriangleMesh(
+                        mesh_legacy, float_dtype, int_dtype, device);
+            },
             "mesh_legacy"_a, "vertex_dtype"_a = core::Dtype::Float32,
             "triangle_dtype"_a = core::Dtype::Int64,
             "device"_a = core::Device("CPU:0"),
             "Create a TriangleMesh from a legacy Open3D TriangleMesh.");
     triangle_mesh.def("to_legacy_triangle_mesh",
-                      &TriangleMesh::ToLegacyTriangleMesh,
+                      static_cast<open3d::geometry::TriangleMesh (
+                              TriangleMesh::*)() const &>(
+                              &TriangleMesh::ToLegacyTriangleMesh),
                       "Convert to a legacy Open3D TriangleMesh.");
 }
 
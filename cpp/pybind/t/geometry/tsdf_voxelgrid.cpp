@@ -27,6 +27,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -49,6 +50,17 @@ void pybind_tsdf_voxelgrid(py::module& m) {
             m, "TSDFVoxelGrid",
             "A voxel grid for TSDF and/or color integration.");
 
+    py::class_<TSDFVoxelGrid::SurfaceMeshUpdate> surface_mesh_update(
+            m, "SurfaceMeshUpdate",
+            "Per-block surface mesh changes since the last update.");
+    surface_mesh_update
+            .def_readonly("updated_blocks",
+                          &TSDFVoxelGrid::SurfaceMeshUpdate::updated_blocks_)
+            .def_readonly("updated_meshes",
+                          &TSDFVoxelGrid::SurfaceMeshUpdate::updated_meshes_)
+            .def_readonly("removed_blocks",
+                          &TSDFVoxelGrid::SurfaceMeshUpdate::removed_blocks_);
+
     // Constructors.
     tsdf_voxelgrid.def(
             py::init<const std::unordered_map<std::string, core::Dtype>&, float,
@@ -63,37 +75,58 @@ void pybind_tsdf_voxelgrid(py::module& m) {
             "block_resolution"_a = 16, "block_count"_a = 100,
             "device"_a = core::Device("CPU:0"));
 
-    tsdf_voxelgrid.def("integrate",
-                       py::overload_cast<const Image&, const core::Tensor&,
-                                         const core::Tensor&, float, float>(
-                               &TSDFVoxelGrid::Integrate),
-                       "depth"_a, "intrinsics"_a, "extrinsics"_a,
-                       "depth_scale"_a, "depth_max"_a);
+    tsdf_voxelgrid.def(
+            "integrate",
+            py::overload_cast<const Image&, const core::Tensor&,
+                              const core::Tensor&, float, float, int64_t,
+                              bool>(&TSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(), "depth"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a, "depth_max"_a,
+            "stride"_a = 4, "visibility_culling"_a = false);
 
     tsdf_voxelgrid.def(
             "integrate",
             py::overload_cast<const Image&, const Image&, const core::Tensor&,
-                              const core::Tensor&, float, float>(
-                    &TSDFVoxelGrid::Integrate),
-            "depth"_a, "color"_a, "intrinsics"_a, "extrinsics"_a,
-            "depth_scale"_a, "depth_max"_a);
+                              const core::Tensor&, float, float, int64_t,
+                              bool>(&TSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(), "depth"_a, "color"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a, "depth_max"_a,
+            "stride"_a = 4, "visibility_culling"_a = false);
 
     // TODO(wei): expose mask code as a python class
     tsdf_voxelgrid.def(
-            "raycast", &TSDFVoxelGrid::RayCast, "intrinsics"_a, "extrinsics"_a,
-            "width"_a, "height"_a, "depth_scale"_a = 1000.0,
+            "raycast", &TSDFVoxelGrid::RayCast,
+            py::call_guard<py::gil_scoped_release>(), "intrinsics"_a,
+            "extrinsics"_a, "width"_a, "height"_a, "depth_scale"_a = 1000.0,
             "depth_min"_a = 0.1f, "depth_max"_a = 3.0f,
             "weight_threshold"_a = 3.0f,
             "raycast_result_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
                                       TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
     tsdf_voxelgrid.def(
             "extract_surface_points", &TSDFVoxelGrid::ExtractSurfacePoints,
+            py::call_guard<py::gil_scoped_release>(),
             "estimate_number"_a = -1, "weight_threshold"_a = 3.0f,
             "surface_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::VertexMap |
                                TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
     tsdf_voxelgrid.def("extract_surface_mesh",
                        &TSDFVoxelGrid::ExtractSurfaceMesh,
+                       py::call_guard<py::gil_scoped_release>(),
+                       "weight_threshold"_a = 3.0f);
+    tsdf_voxelgrid.def("extract_surface_mesh_update",
+                       &TSDFVoxelGrid::ExtractSurfaceMeshUpdate,
+                       py::call_guard<py::gil_scoped_release>(),
                        "weight_threshold"_a = 3.0f);
+    tsdf_voxelgrid.def("get_cached_surface_mesh",
+                       &TSDFVoxelGrid::GetCachedSurfaceMesh);
+    tsdf_voxelgrid.def("prune_truncated_blocks",
+                       &TSDFVoxelGrid::PruneTruncatedBlocks,
+                       py::call_guard<py::gil_scoped_release>());
+    tsdf_voxelgrid.def("decay_weights", &TSDFVoxelGrid::DecayWeights,
+                       "decay"_a);
+    tsdf_voxelgrid.def("erase_stale_blocks", &TSDFVoxelGrid::EraseStaleBlocks,
+                       py::call_guard<py::gil_scoped_release>(),
+                       "weight_threshold"_a = 1.0f,
+                       "max_unobserved_frames"_a = -1);
 
     tsdf_voxelgrid.def("to", &TSDFVoxelGrid::To, "device"_a, "copy"_a = false);
     tsdf_voxelgrid.def("clone", &TSDFVoxelGrid::Clone);
@@ -102,6 +135,103 @@ void pybind_tsdf_voxelgrid(py::module& m) {
 
     tsdf_voxelgrid.def("get_block_hashmap", &TSDFVoxelGrid::GetBlockHashmap);
     tsdf_voxelgrid.def("get_device", &TSDFVoxelGrid::GetDevice);
+
+    tsdf_voxelgrid.def("save", &TSDFVoxelGrid::Save,
+                       py::call_guard<py::gil_scoped_release>(), "file_name"_a);
+    tsdf_voxelgrid.def_static("load", &TSDFVoxelGrid::Load,
+                              py::call_guard<py::gil_scoped_release>(),
+                              "file_name"_a,
+                              "device"_a = core::Device("CPU:0"),
+                              "backend"_a = core::HashmapBackend::Default);
+    tsdf_voxelgrid.def_static(
+            "from_legacy_tsdf_volume",
+            py::overload_cast<
+                    const open3d::pipelines::integration::ScalableTSDFVolume &,
+                    const std::unordered_map<std::string, core::Dtype> &,
+                    const core::Device &>(&TSDFVoxelGrid::FromLegacyTSDFVolume),
+            "volume"_a,
+            "attr_dtype_map"_a =
+                    std::unordered_map<std::string, core::Dtype>{
+                            {"tsdf", core::Dtype::Float32},
+                            {"weight", core::Dtype::UInt16},
+                            {"color", core::Dtype::UInt16}},
+            "device"_a = core::Device("CPU:0"));
+    tsdf_voxelgrid.def_static(
+            "from_legacy_tsdf_volume",
+            py::overload_cast<
+                    const open3d::pipelines::integration::UniformTSDFVolume &,
+                    int64_t,
+                    const std::unordered_map<std::string, core::Dtype> &,
+                    const core::Device &>(&TSDFVoxelGrid::FromLegacyTSDFVolume),
+            "volume"_a, "block_resolution"_a = 16,
+            "attr_dtype_map"_a =
+                    std::unordered_map<std::string, core::Dtype>{
+                            {"tsdf", core::Dtype::Float32},
+                            {"weight", core::Dtype::UInt16},
+                            {"color", core::Dtype::UInt16}},
+            "device"_a = core::Device("CPU:0"));
+
+    py::class_<PartitionedTSDFVoxelGrid> partitioned_voxelgrid(
+            m, "PartitionedTSDFVoxelGrid",
+            "A TSDF voxel grid partitioned into spatial slabs across "
+            "devices.");
+    partitioned_voxelgrid.def(
+            py::init<const std::vector<core::Device>&,
+                     const std::unordered_map<std::string, core::Dtype>&,
+                     float, float, int64_t, int64_t, int64_t, int,
+                     const core::HashmapBackend&>(),
+            "devices"_a,
+            "map_attrs_to_dtypes"_a =
+                    std::unordered_map<std::string, core::Dtype>{
+                            {"tsdf", core::Dtype::Float32},
+                            {"weight", core::Dtype::UInt16},
+                            {"color", core::Dtype::UInt16},
+                    },
+            "voxel_size"_a = 3.0 / 512, "sdf_trunc"_a = 0.04,
+            "block_resolution"_a = 16, "block_count"_a = 100,
+            "slab_width"_a = 4, "axis"_a = 0,
+            "backend"_a = core::HashmapBackend::Default);
+    partitioned_voxelgrid.def(
+            "integrate",
+            py::overload_cast<const Image&, const core::Tensor&,
+                              const core::Tensor&, float, float, int64_t,
+                              bool>(&PartitionedTSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(), "depth"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a, "depth_max"_a,
+            "stride"_a = 4, "visibility_culling"_a = false);
+    partitioned_voxelgrid.def(
+            "integrate",
+            py::overload_cast<const Image&, const Image&, const core::Tensor&,
+                              const core::Tensor&, float, float, int64_t,
+                              bool>(&PartitionedTSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(), "depth"_a, "color"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a, "depth_max"_a,
+            "stride"_a = 4, "visibility_culling"_a = false);
+    partitioned_voxelgrid.def(
+            "raycast", &PartitionedTSDFVoxelGrid::RayCast,
+            py::call_guard<py::gil_scoped_release>(), "intrinsics"_a,
+            "extrinsics"_a, "width"_a, "height"_a, "depth_scale"_a = 1000.0,
+            "depth_min"_a = 0.1f, "depth_max"_a = 3.0f,
+            "weight_threshold"_a = 3.0f,
+            "raycast_result_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+                                      TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
+    partitioned_voxelgrid.def(
+            "extract_surface_points",
+            &PartitionedTSDFVoxelGrid::ExtractSurfacePoints,
+            py::call_guard<py::gil_scoped_release>(),
+            "weight_threshold"_a = 3.0f,
+            "surface_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::VertexMap |
+                               TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
+    partitioned_voxelgrid.def("extract_surface_mesh",
+                              &PartitionedTSDFVoxelGrid::ExtractSurfaceMesh,
+                              py::call_guard<py::gil_scoped_release>(),
+                              "weight_threshold"_a = 3.0f);
+    partitioned_voxelgrid.def("get_partition_count",
+                              &PartitionedTSDFVoxelGrid::GetPartitionCount);
+    partitioned_voxelgrid.def("get_partition",
+                              &PartitionedTSDFVoxelGrid::GetPartition,
+                              py::return_value_policy::reference_internal,
+                              "index"_a);
 }
 }  // namespace geometry
 }  // namespace t
@@ -56,7 +56,12 @@ void pybind_sensor(py::module &m) {
                      "(default video length) Save frames till this time (us)"},
                     {"buffer_size",
                      "Size of internal frame buffer, increase this if you "
-                     "experience frame drops."}};
+                     "experience frame drops."},
+                    {"index_frames",
+                     "Index the positions of all frames when the file is "
+                     "opened, for random access with read_frames()."},
+                    {"start", "Index of the first frame in the frame index."},
+                    {"count", "Max number of frames to read."}};
 
     py::enum_<SensorType>(m, "SensorType", "Sensor type")
             .value("AZURE_KINECT", SensorType::AZURE_KINECT)
@@ -68,6 +73,11 @@ void pybind_sensor(py::module &m) {
     rgbd_video_metadata.def(py::init<>())
             .def_readwrite("intrinsics", &RGBDVideoMetadata::intrinsics_,
                            "Shared intrinsics between RGB & depth")
+            .def_readwrite("distortion_coeffs",
+                           &RGBDVideoMetadata::distortion_coeffs_,
+                           "Brown-Conrady lens distortion coefficients (k1, "
+                           "k2, p1, p2, k3) of the color camera. Empty for an "
+                           "undistorted stream.")
             .def_readwrite("device_name", &RGBDVideoMetadata::device_name_,
                            "Capture device name")
             .def_readwrite("serial_number", &RGBDVideoMetadata::serial_number_,
@@ -155,6 +165,27 @@ void pybind_sensor(py::module &m) {
                  "start_time_us"_a = 0, "end_time_us"_a = UINT64_MAX,
                  "Save synchronized and aligned individual frames to "
                  "subfolders.")
+            .def(
+                    "next_frames",
+                    [](RGBDVideoReader &reader, size_t batch_size,
+                       const core::Device &device) {
+                        py::gil_scoped_release release;
+                        return reader.NextFrames(batch_size, device);
+                    },
+                    "batch_size"_a, "device"_a = core::Device("CPU:0"),
+                    "Get the next batch_size frames on the device. Fewer "
+                    "frames are returned at the end of the playback.")
+            .def("start_prefetch", &RGBDVideoReader::StartPrefetch,
+                 "device"_a, "queue_size"_a = 4,
+                 "Start reading frames and copying them to the device on a "
+                 "background thread. Read the frames with next_frames() "
+                 "while prefetching.")
+            .def("stop_prefetch", &RGBDVideoReader::StopPrefetch,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Stop prefetching and discard the prefetched frames.")
+            .def_property_readonly("is_prefetching",
+                                   &RGBDVideoReader::IsPrefetching,
+                                   "Check if frames are prefetched.")
             .def("__repr__", &RGBDVideoReader::ToString);
     docstring::ClassMethodDocInject(m, "RGBDVideoReader", "create",
                                     map_shared_argument_docstrings);
@@ -190,8 +221,9 @@ void pybind_sensor(py::module &m) {
                     "Note: A few frames may be dropped if user code takes a "
                     "long time (>10 frame intervals) to process a frame.");
     rs_bag_reader.def(py::init<>())
-            .def(py::init<size_t>(),
-                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE)
+            .def(py::init<size_t, bool>(),
+                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE,
+                 "index_frames"_a = false)
             .def("is_opened", &RSBagReader::IsOpened,
                  "Check if the RS bag file  is opened.")
             .def("open", &RSBagReader::Open,
@@ -215,6 +247,24 @@ void pybind_sensor(py::module &m) {
                  py::call_guard<py::gil_scoped_release>(),
                  "Get next frame from the RS bag playback and returns the RGBD "
                  "object.")
+            .def_property_readonly(
+                    "frame_index", &RSBagReader::GetFrameIndex,
+                    "Playback positions (in us) of the color frames. Empty "
+                    "until it is built by open() or read_frames().")
+            .def("set_frame_index", &RSBagReader::SetFrameIndex,
+                 "frame_index"_a,
+                 "Use a frame index built for the same file, e.g. by "
+                 "another reader.")
+            .def("read_frames", &RSBagReader::ReadFrames,
+                 py::call_guard<py::gil_scoped_release>(), "start"_a,
+                 "count"_a,
+                 "Read count consecutive frames, starting with frame start of "
+                 "the frame index. The index is built first if it is empty.")
+            .def_static("index_frames", &RSBagReader::IndexFrames,
+                        py::call_guard<py::gil_scoped_release>(),
+                        "filename"_a,
+                        "Index the playback positions (in us) of all color "
+                        "frames of a bag file.")
             // Release Python GIL for SaveFrames, since this will take a while
             .def("save_frames", &RSBagReader::SaveFrames,
                  py::call_guard<py::gil_scoped_release>(), "frame_path"_a,
@@ -230,6 +280,8 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "RSBagReader", "save_frames",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RSBagReader", "read_frames",
+                                    map_shared_argument_docstrings);
 
     // Class RealSenseSensorConfig
     py::class_<RealSenseSensorConfig> realsense_sensor_config(
@@ -304,6 +356,12 @@ void pybind_sensor(py::module &m) {
                  py::call_guard<py::gil_scoped_release>(), "wait"_a = true,
                  "align_depth_to_color"_a = true,
                  "Acquire the next synchronized RGBD frameset from the camera.")
+            .def("capture_point_cloud", &RealSenseSensor::CapturePointCloud,
+                 py::call_guard<py::gil_scoped_release>(), "wait"_a = true,
+                 "depth_max"_a = 3.0f, "stride"_a = 1,
+                 "Acquire the next synchronized RGBD frameset from the camera "
+                 "and unproject it to a colored point cloud, with the "
+                 "intrinsics, lens distortion and depth scale of the stream.")
             .def("get_timestamp", &RealSenseSensor::GetTimestamp,
                  "Get current timestamp (in us)")
             .def("stop_capture", &RealSenseSensor::StopCapture,
@@ -340,6 +398,15 @@ void pybind_sensor(py::module &m) {
              {"align_depth_to_color",
               "Enable aligning WFOV depth image to the color image in "
               "visualizer."}});
+    docstring::ClassMethodDocInject(
+            m, "RealSenseSensor", "capture_point_cloud",
+            {{"wait",
+              "If true wait for the next frame set, else return immediately "
+              "with an empty PointCloud if it is not yet available."},
+             {"depth_max", "Points at depth_max or farther are dropped."},
+             {"stride",
+              "Only pixels whose coordinates are multiples of stride are "
+              "unprojected."}});
 
 #endif
 }
@@ -30,6 +30,8 @@
 #include <utility>
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+#include "open3d/t/pipelines/registration/Feature.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Console.h"
 #include "pybind/docstring.h"
@@ -96,6 +98,39 @@ void pybind_registration_classes(py::module &m) {
                         c.max_iteration_);
             });
 
+    // open3d.t.pipelines.registration.RobustKernelMethod
+    py::enum_<RobustKernelMethod>(m, "RobustKernelMethod",
+                                  "Loss function of a RobustKernel.")
+            .value("L2Loss", RobustKernelMethod::L2Loss)
+            .value("L1Loss", RobustKernelMethod::L1Loss)
+            .value("HuberLoss", RobustKernelMethod::HuberLoss)
+            .value("CauchyLoss", RobustKernelMethod::CauchyLoss)
+            .value("GMLoss", RobustKernelMethod::GMLoss)
+            .value("TukeyLoss", RobustKernelMethod::TukeyLoss)
+            .export_values();
+
+    // open3d.t.pipelines.registration.RobustKernel
+    py::class_<RobustKernel> robust_kernel(
+            m, "RobustKernel",
+            "Robust kernel for outlier rejection, weighting the residuals of "
+            "the registration.");
+    py::detail::bind_copy_functions<RobustKernel>(robust_kernel);
+    robust_kernel
+            .def(py::init<RobustKernelMethod, double>(),
+                 "type"_a = RobustKernelMethod::L2Loss,
+                 "scaling_parameter"_a = 1.0)
+            .def_readwrite("type", &RobustKernel::type_, "Loss function.")
+            .def_readwrite("scaling_parameter",
+                           &RobustKernel::scaling_parameter_,
+                           "Scaling parameter of the loss function.")
+            .def("__repr__", [](const RobustKernel &kernel) {
+                return fmt::format(
+                        "RobustKernel with type={:d} and "
+                        "scaling_parameter={:e}",
+                        static_cast<int>(kernel.type_),
+                        kernel.scaling_parameter_);
+            });
+
     // open3d.t.pipelines.registration.TransformationEstimation
     py::class_<TransformationEstimation,
                PyTransformationEstimation<TransformationEstimation>>
@@ -155,10 +190,102 @@ void pybind_registration_classes(py::module &m) {
     py::detail::bind_copy_functions<TransformationEstimationPointToPlane>(
             te_p2l);
     te_p2l.def(py::init())
+            .def(py::init<const RobustKernel &>(), "kernel"_a)
             .def("__repr__",
                  [](const TransformationEstimationPointToPlane &te) {
                      return std::string("TransformationEstimationPointToPlane");
-                 });
+                 })
+            .def_readwrite("kernel",
+                           &TransformationEstimationPointToPlane::kernel_,
+                           "Robust kernel weighting the residuals.");
+
+    // open3d.t.pipelines.registration.TransformationEstimationForColoredICP
+    // TransformationEstimation
+    py::class_<TransformationEstimationForColoredICP,
+               PyTransformationEstimation<
+                       TransformationEstimationForColoredICP>,
+               TransformationEstimation>
+            te_col(m, "TransformationEstimationForColoredICP",
+                   "Class to estimate a transformation for colored ICP. The "
+                   "target must have ``color_gradients``, see "
+                   "``PointCloud.estimate_color_gradients``.");
+    py::detail::bind_copy_functions<TransformationEstimationForColoredICP>(
+            te_col);
+    te_col.def(py::init<double, const RobustKernel &>(),
+               "lambda_geometric"_a = 0.968, "kernel"_a = RobustKernel())
+            .def("__repr__",
+                 [](const TransformationEstimationForColoredICP &te) {
+                     return std::string(
+                             "TransformationEstimationForColoredICP with "
+                             "lambda_geometric:" +
+                             std::to_string(te.lambda_geometric_));
+                 })
+            .def_readwrite(
+                    "lambda_geometric",
+                    &TransformationEstimationForColoredICP::lambda_geometric_,
+                    "Weight of the geometric term, in [0, 1].")
+            .def_readwrite("kernel",
+                           &TransformationEstimationForColoredICP::kernel_,
+                           "Robust kernel weighting the residuals.");
+
+    // open3d.t.pipelines.registration.FastGlobalRegistrationOption
+    py::class_<FastGlobalRegistrationOption> fgr_option(
+            m, "FastGlobalRegistrationOption",
+            "Options for FastGlobalRegistration.");
+    py::detail::bind_copy_functions<FastGlobalRegistrationOption>(fgr_option);
+    fgr_option
+            .def(py::init<double, bool, bool, double, int, double, int,
+                          uint64_t>(),
+                 "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
+                 "decrease_mu"_a = true,
+                 "maximum_correspondence_distance"_a = 0.025,
+                 "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
+                 "maximum_tuple_count"_a = 1000, "seed"_a = 0)
+            .def_readwrite(
+                    "division_factor",
+                    &FastGlobalRegistrationOption::division_factor_,
+                    "float: Division factor used for graduated non-convexity.")
+            .def_readwrite(
+                    "use_absolute_scale",
+                    &FastGlobalRegistrationOption::use_absolute_scale_,
+                    "bool: Measure distance in absolute scale (1) or in scale "
+                    "relative to the diameter of the model (0).")
+            .def_readwrite("decrease_mu",
+                           &FastGlobalRegistrationOption::decrease_mu_,
+                           "bool: Set to ``True`` to decrease scale mu by "
+                           "``division_factor`` for graduated non-convexity.")
+            .def_readwrite("maximum_correspondence_distance",
+                           &FastGlobalRegistrationOption::
+                                   maximum_correspondence_distance_,
+                           "float: Maximum correspondence distance.")
+            .def_readwrite("iteration_number",
+                           &FastGlobalRegistrationOption::iteration_number_,
+                           "int: Maximum number of iterations.")
+            .def_readwrite(
+                    "tuple_scale", &FastGlobalRegistrationOption::tuple_scale_,
+                    "float: Similarity measure used for tuples of feature "
+                    "points.")
+            .def_readwrite("maximum_tuple_count",
+                           &FastGlobalRegistrationOption::maximum_tuple_count_,
+                           "int: Maximum tuple numbers.")
+            .def_readwrite("seed", &FastGlobalRegistrationOption::seed_,
+                           "int: Seed of the random sampling of the tuples.")
+            .def("__repr__", [](const FastGlobalRegistrationOption &c) {
+                return fmt::format(
+                        "FastGlobalRegistrationOption class "
+                        "with \ndivision_factor={}"
+                        "\nuse_absolute_scale={}"
+                        "\ndecrease_mu={}"
+                        "\nmaximum_correspondence_distance={}"
+                        "\niteration_number={}"
+                        "\ntuple_scale={}"
+                        "\nmaximum_tuple_count={}"
+                        "\nseed={}",
+                        c.division_factor_, c.use_absolute_scale_,
+                        c.decrease_mu_, c.maximum_correspondence_distance_,
+                        c.iteration_number_, c.tuple_scale_,
+                        c.maximum_tuple_count_, c.seed_);
+            });
 
     // open3d.t.pipelines.registration.RegistrationResult
     py::class_<RegistrationResult> registration_result(
@@ -213,7 +340,8 @@ static const std::unordered_map<std::string, std::string>
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``TransformationEstimationPointToPoint``, "
-                 "``TransformationEstimationPointToPlane``)"},
+                 "``TransformationEstimationPointToPlane``, "
+                 "``TransformationEstimationForColoredICP``)"},
                 {"init", "Initial transformation estimation"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
@@ -232,6 +360,7 @@ static const std::unordered_map<std::string, std::string>
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &EvaluateRegistration,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a = core::Tensor::Eye(4, core::Dtype::Float64,
@@ -239,7 +368,9 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &RegistrationICP, "Function for ICP registration",
+    m.def("registration_icp", &RegistrationICP,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "init"_a = core::Tensor::Eye(4, core::Dtype::Float64,
                                        core::Device("CPU:0")),
@@ -249,6 +380,7 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("registration_multi_scale_icp", &RegistrationMultiScaleICP,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for Multi-Scale ICP registration", "source"_a, "target"_a,
           "voxel_sizes"_a, "criterias"_a, "max_correspondence_distances"_a,
           "init"_a = core::Tensor::Eye(4, core::Dtype::Float64,
@@ -256,6 +388,33 @@ void pybind_registration_methods(py::module &m) {
           "estimation_method"_a = TransformationEstimationPointToPoint());
     docstring::FunctionDocInject(m, "registration_multi_scale_icp",
                                  map_shared_argument_docstrings);
+
+    m.def("registration_fgr_based_on_feature_matching",
+          &FastGlobalRegistration, py::call_guard<py::gil_scoped_release>(),
+          "Function for fast global registration based on feature matching",
+          "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
+          "option"_a = FastGlobalRegistrationOption());
+    docstring::FunctionDocInject(
+            m, "registration_fgr_based_on_feature_matching",
+            {{"source", "The source point cloud."},
+             {"target", "The target point cloud."},
+             {"source_feature",
+              "Source point cloud feature, a (N, D) Tensor, e.g. the output "
+              "of ``compute_fpfh_feature``."},
+             {"target_feature", "Target point cloud feature, a (M, D) Tensor."},
+             {"option", "Registration option"}});
+
+    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to compute FPFH feature for a point cloud. Returns a "
+          "(N, 33) Tensor.",
+          "input"_a, "max_nn"_a = 30, "radius"_a = py::none());
+    docstring::FunctionDocInject(
+            m, "compute_fpfh_feature",
+            {{"input", "The input point cloud with normals."},
+             {"max_nn", "Maximum number of neighbors in the search."},
+             {"radius",
+              "Search radius. If None, KNN search with max_nn is used."}});
 }
 
 void pybind_registration(py::module &m) {
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+#include <type_traits>
+
+#include "open3d/utility/Parallel.h"
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
 
@@ -46,6 +50,65 @@ py::class_<Vector, holder_type> bind_vector_without_repr(
     return cl;
 }
 
+// Copies a numpy array of shape (n, EigenVector::SizeAtCompileTime) into a
+// std::vector<EigenVector>. Contiguous arrays of the same scalar type are
+// copied with memcpy and float32 arrays are converted to float64 with Eigen's
+// vectorized cast, both in parallel chunks for large arrays. All other arrays
+// are first converted by numpy.
+template <typename EigenVector,
+          typename EigenAllocator = std::allocator<EigenVector>>
+std::vector<EigenVector, EigenAllocator> py_array_to_vectors(py::array array) {
+    typedef typename EigenVector::Scalar Scalar;
+    const int64_t eigen_vector_size = EigenVector::SizeAtCompileTime;
+    static_assert(sizeof(EigenVector) ==
+                          EigenVector::SizeAtCompileTime * sizeof(Scalar),
+                  "EigenVector must not be padded.");
+    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
+        throw py::cast_error();
+    }
+    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
+    if (eigen_vectors.empty()) {
+        return eigen_vectors;
+    }
+    Scalar *dst = eigen_vectors.data()->data();
+    const int64_t num_scalars = array.shape(0) * eigen_vector_size;
+    // Chunks of 1 MiB keep the copy bandwidth bound without scheduling
+    // overhead for small arrays.
+    const int64_t grain_size = (1 << 20) / sizeof(Scalar);
+
+    if (std::is_same<Scalar, double>::value &&
+        array.dtype().is(py::dtype::of<float>())) {
+        auto src_array =
+                py::array_t<float, py::array::c_style>::ensure(array);
+        if (!src_array) {
+            throw py::cast_error();
+        }
+        const float *src = src_array.data();
+        open3d::utility::ParallelForRange(
+                0, num_scalars, grain_size, [&](int64_t begin, int64_t end) {
+                    Eigen::Map<Eigen::Array<Scalar, Eigen::Dynamic, 1>>(
+                            dst + begin, end - begin) =
+                            Eigen::Map<const Eigen::ArrayXf>(src + begin,
+                                                             end - begin)
+                                    .template cast<Scalar>();
+                });
+    } else {
+        auto src_array = py::array_t<Scalar, py::array::c_style |
+                                                     py::array::forcecast>::
+                ensure(array);
+        if (!src_array) {
+            throw py::cast_error();
+        }
+        const Scalar *src = src_array.data();
+        open3d::utility::ParallelForRange(
+                0, num_scalars, grain_size, [&](int64_t begin, int64_t end) {
+                    memcpy(dst + begin, src + begin,
+                           (end - begin) * sizeof(Scalar));
+                });
+    }
+    return eigen_vectors;
+}
+
 // - This function is used by Pybind for std::vector<SomeEigenType> constructor.
 //   This optional constructor is added to avoid too many Python <-> C++ API
 //   calls when the vector size is large using the default biding method.
@@ -53,37 +116,19 @@ py::class_<Vector, holder_type> bind_vector_without_repr(
 // - Directly using templates for the py::array_t<double> and py::array_t<int>
 //   and etc. doesn't work. The current solution is to explicitly implement
 //   bindings for each py array types.
+// - numpy arrays of any dtype are already matched by the py::array
+//   constructor, which is registered first. These constructors convert other
+//   sequences, e.g. nested lists.
 template <typename EigenVector>
 std::vector<EigenVector> py_array_to_vectors_double(
         py::array_t<double, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        // The EigenVector here must be a double-typed eigen vector, since only
-        // open3d::Vector3dVector binds to py_array_to_vectors_double.
-        // Therefore, we can use the memory map directly.
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+    return py_array_to_vectors<EigenVector>(array);
 }
 
 template <typename EigenVector>
 std::vector<EigenVector> py_array_to_vectors_int(
         py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+    return py_array_to_vectors<EigenVector>(array);
 }
 
 template <typename EigenVector,
@@ -91,16 +136,7 @@ template <typename EigenVector,
 std::vector<EigenVector, EigenAllocator>
 py_array_to_vectors_int_eigen_allocator(
         py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+    return py_array_to_vectors<EigenVector, EigenAllocator>(array);
 }
 
 template <typename EigenVector,
@@ -108,16 +144,7 @@ template <typename EigenVector,
 std::vector<EigenVector, EigenAllocator>
 py_array_to_vectors_int64_eigen_allocator(
         py::array_t<int64_t, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+    return py_array_to_vectors<EigenVector, EigenAllocator>(array);
 }
 
 }  // namespace pybind11
@@ -166,6 +193,10 @@ py::class_<Vector, holder_type> pybind_eigen_vector_of_vector(
     typedef typename EigenVector::Scalar Scalar;
     auto vec = py::bind_vector_without_repr<std::vector<EigenVector>>(
             m, bind_name, py::buffer_protocol());
+    // Matches numpy arrays of any dtype before the sequence constructors.
+    vec.def(py::init([](py::array array) {
+        return py::py_array_to_vectors<EigenVector>(array);
+    }));
     vec.def(py::init(init_func));
     vec.def_buffer([](std::vector<EigenVector> &v) -> py::buffer_info {
         size_t rows = EigenVector::RowsAtCompileTime;
@@ -239,6 +270,10 @@ py::class_<Vector, holder_type> pybind_eigen_vector_of_vector_eigen_allocator(
     auto vec = py::bind_vector_without_repr<
             std::vector<EigenVector, EigenAllocator>>(m, bind_name,
                                                       py::buffer_protocol());
+    // Matches numpy arrays of any dtype before the sequence constructors.
+    vec.def(py::init([](py::array array) {
+        return py::py_array_to_vectors<EigenVector, EigenAllocator>(array);
+    }));
     vec.def(py::init(init_func));
     vec.def_buffer(
             [](std::vector<EigenVector, EigenAllocator> &v) -> py::buffer_info {
@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Metrics.h"
+
+#include "open3d/utility/Console.h"
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+#include "pybind/utility/utility.h"
+
+namespace open3d {
+namespace utility {
+
+void pybind_metrics(py::module& m) {
+    py::class_<Metrics> metrics(
+            m, "Metrics",
+            "Process-wide counters of the work done by Open3D, such as the "
+            "kernels launched and elements processed per device, nearest "
+            "neighbor search queries, hash map insertions and rehashes, and "
+            "the bytes read and written by the io module. The counters can "
+            "be exported in the Prometheus text exposition format.");
+    metrics.def_static("get_values", &Metrics::GetValues,
+                       "Returns a dict from the Prometheus series name of "
+                       "each counter, e.g. "
+                       "``open3d_core_kernel_launches_total{device=\"CPU:0\"}"
+                       "``, to its value.")
+            .def_static("reset", &Metrics::Reset, "Set all counters to zero.")
+            .def_static("to_prometheus_text", &Metrics::ToPrometheusText,
+                        "Returns all counters in the Prometheus text "
+                        "exposition format.")
+            .def_static(
+                    "add",
+                    [](const std::string& name, int64_t value,
+                       const Metrics::Labels& labels, const std::string& help) {
+                        if (value < 0) {
+                            utility::LogError(
+                                    "Counters can only be incremented, but "
+                                    "value is {}.",
+                                    value);
+                        }
+                        Metrics::GetCounter(name, labels, help).Add(value);
+                    },
+                    "Increment the counter ``name`` with ``labels`` by "
+                    "``value``, creating it if needed.",
+                    "name"_a, "value"_a = 1,
+                    "labels"_a = Metrics::Labels(), "help"_a = "");
+}
+
+}  // namespace utility
+}  // namespace open3d
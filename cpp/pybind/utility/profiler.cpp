@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <memory>
+
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+#include "pybind/utility/utility.h"
+
+namespace open3d {
+namespace utility {
+
+/// Records a profiler zone between __enter__ and __exit__.
+class PyProfileZone {
+public:
+    explicit PyProfileZone(const std::string& name)
+        : name_(Profiler::InternName(name)) {}
+    void Enter() { zone_.reset(new ProfileZone(name_)); }
+    void Exit() { zone_.reset(); }
+
+private:
+    const char* name_;
+    std::unique_ptr<ProfileZone> zone_;
+};
+
+void pybind_profiler(py::module& m) {
+    py::class_<Profiler> profiler(
+            m, "Profiler",
+            "Low-overhead hierarchical profiler. Instrumented Open3D "
+            "functions, such as registration, odometry, TSDF integration and "
+            "file I/O, record zones while the profiler is enabled. The zones "
+            "can be written as a Chrome trace, which can be viewed in "
+            "chrome://tracing or https://ui.perfetto.dev.");
+    profiler.def_static("enable", &Profiler::Enable,
+                        "Start or stop recording zones.", "enable"_a = true)
+            .def_static("is_enabled", &Profiler::IsEnabled,
+                        "Returns True if zones are being recorded.")
+            .def_static("clear", &Profiler::Clear,
+                        "Remove all recorded zones.")
+            .def_static("to_chrome_trace_json", &Profiler::ToChromeTraceJSON,
+                        "Returns the recorded zones in Chrome's trace event "
+                        "JSON format.")
+            .def_static("write_chrome_trace", &Profiler::WriteChromeTrace,
+                        "Write the recorded zones as a Chrome trace JSON "
+                        "file. Returns False on failure.",
+                        "filename"_a)
+            .def_static("log_summary", &Profiler::LogSummary,
+                        "Log the count, total and mean duration of the "
+                        "recorded zones, grouped by their nesting path.");
+
+    py::class_<PyProfileZone>(m, "ProfileZone",
+                              "A context manager that records a profiler "
+                              "zone, nested in the zones of the calling "
+                              "thread.")
+            .def(py::init<const std::string&>(), "name"_a)
+            .def(
+                    "__enter__",
+                    [](PyProfileZone& zone) {
+                        zone.Enter();
+                        return &zone;
+                    },
+                    py::return_value_policy::reference)
+            .def("__exit__",
+                 [](PyProfileZone& zone, py::object exc_type,
+                    py::object exc_value,
+                    py::object traceback) { zone.Exit(); });
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -36,6 +36,8 @@ void pybind_utility(py::module &m) {
     py::module m_submodule = m.def_submodule("utility");
     pybind_console(m_submodule);
     pybind_eigen(m_submodule);
+    pybind_metrics(m_submodule);
+    pybind_profiler(m_submodule);
 }
 
 }  // namespace utility
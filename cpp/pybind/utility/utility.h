@@ -35,6 +35,8 @@ void pybind_utility(py::module &m);
 
 void pybind_console(py::module &m);
 void pybind_eigen(py::module &m);
+void pybind_metrics(py::module &m);
+void pybind_profiler(py::module &m);
 
 }  // namespace utility
 }  // namespace open3d
@@ -410,6 +410,10 @@ void pybind_gui_classes(py::module &m) {
                  "Flags window to re-layout")
             .def("post_redraw", &PyWindow::PostRedraw,
                  "Sends a redraw message to the OS message queue")
+            .def_property("show_render_stats", &PyWindow::GetShowRenderStats,
+                          &PyWindow::SetShowRenderStats,
+                          "Shows an overlay with the frame rate, timings and "
+                          "primitive counts of the renderer")
             .def_property_readonly("is_active_window",
                                    &PyWindow::IsActiveWindow,
                                    "True if the window is currently the active "
@@ -233,6 +233,18 @@ void pybind_o3dvisualizer(py::module& m) {
                     "group: a string declaring the group it is a member of "
                     "(optional)\n"
                     "time: a time value\n")
+            .def("add_geometry_sequence",
+                 &O3DVisualizer::AddGeometrySequence, "name"_a,
+                 "num_frames"_a, "loader"_a, "material"_a = nullptr,
+                 "group"_a = "", "preload_frames"_a = 8,
+                 "add_geometry_sequence(name, num_frames, loader, "
+                 "material=None, group='', preload_frames=8): adds a "
+                 "t.geometry.PointCloud sequence that is streamed during "
+                 "playback. Frame i is shown at time i * animation_time_step "
+                 "and is returned by loader(i), which is called on worker "
+                 "threads. Only preload_frames frames from the current time "
+                 "onwards are kept in memory, and all frames share the same "
+                 "GPU buffers.")
             .def("remove_geometry", &O3DVisualizer::RemoveGeometry,
                  "remove_geometry(name): removes the geometry with the "
                  "name.")
@@ -24,7 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/visualization/rendering/ColorGrading.h"
 #include "open3d/visualization/rendering/Gradient.h"
 #include "open3d/visualization/rendering/Material.h"
@@ -32,6 +34,7 @@
 #include "open3d/visualization/rendering/Open3DScene.h"
 #include "open3d/visualization/rendering/Renderer.h"
 #include "open3d/visualization/rendering/Scene.h"
+#include "open3d/visualization/rendering/TextureAtlas.h"
 #include "open3d/visualization/rendering/View.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentRenderer.h"
@@ -87,6 +90,41 @@ private:
 };
 
 void pybind_rendering_classes(py::module &m) {
+    py::class_<RenderStats> stats(m, "RenderStats",
+                                  "Timings (in ms) and counts of the most "
+                                  "recent frame. Get from "
+                                  "Renderer.get_render_stats().");
+    py::class_<RenderStats::Geometry> stats_geom(
+            stats, "Geometry", "Per-geometry counts of a RenderStats");
+    stats_geom.def_readonly("name", &RenderStats::Geometry::name)
+            .def_readonly("visible", &RenderStats::Geometry::visible)
+            .def_readonly("occluded", &RenderStats::Geometry::occluded)
+            .def_readonly("num_vertices", &RenderStats::Geometry::num_vertices)
+            .def_readonly("num_primitives",
+                          &RenderStats::Geometry::num_primitives)
+            .def_readonly("buffer_bytes", &RenderStats::Geometry::buffer_bytes);
+    stats.def_readonly("frame_count", &RenderStats::frame_count)
+            .def_readonly("frame_ms", &RenderStats::frame_ms)
+            .def_readonly("draw_ms", &RenderStats::draw_ms)
+            .def_readonly("frame_interval_ms", &RenderStats::frame_interval_ms)
+            .def_readonly("fps", &RenderStats::fps)
+            .def_readonly("update_geometry_ms",
+                          &RenderStats::update_geometry_ms)
+            .def_readonly("num_views", &RenderStats::num_views)
+            .def_readonly("num_draw_calls", &RenderStats::num_draw_calls)
+            .def_readonly("num_points", &RenderStats::num_points)
+            .def_readonly("num_lines", &RenderStats::num_lines)
+            .def_readonly("num_triangles", &RenderStats::num_triangles)
+            .def_readonly("geometries", &RenderStats::geometries)
+            .def_readonly("buffer_bytes", &RenderStats::buffer_bytes)
+            .def_readonly("resident_buffer_bytes",
+                          &RenderStats::resident_buffer_bytes)
+            .def_readonly("resident_texture_bytes",
+                          &RenderStats::resident_texture_bytes)
+            .def_readonly("memory_budget", &RenderStats::memory_budget)
+            .def_readonly("evicted_geometries",
+                          &RenderStats::evicted_geometries);
+
     py::class_<Renderer> renderer(
             m, "Renderer",
             "Renderer class that manages 3D resources. Get from gui.Window.");
@@ -120,7 +158,27 @@ void pybind_rendering_classes(py::module &m) {
             .def("remove_texture", &Renderer::RemoveTexture,
                  "Deletes the texture. This does not remove the texture from "
                  "any existing materials or GUI widgets, and must be done "
-                 "prior to this call.");
+                 "prior to this call.")
+            .def("get_render_stats", &Renderer::GetRenderStats,
+                 "Returns frame timings and primitive counts for the most "
+                 "recent frame")
+            .def("set_memory_budget", &Renderer::SetMemoryBudget, "bytes"_a,
+                 "Limits the estimated GPU memory of geometry buffers and "
+                 "textures. While over the budget, the buffers of hidden "
+                 "geometries are released, least recently hidden first, and "
+                 "uploaded again when the geometry is shown. 0 means "
+                 "unlimited.")
+            .def("get_memory_budget", &Renderer::GetMemoryBudget,
+                 "Returns the memory budget in bytes, 0 if unlimited")
+            .def("set_max_texture_size", &Renderer::SetMaxTextureSize,
+                 "size"_a,
+                 "Textures loaded from images larger than this are uploaded "
+                 "without their largest mip levels. 0 means unlimited.")
+            .def("set_texture_compression", &Renderer::SetTextureCompression,
+                 "enable"_a,
+                 "If enabled, textures loaded afterwards from 8-bit RGB and "
+                 "RGBA images are block compressed (BC1 and BC3) if the GPU "
+                 "supports it.");
 
     // It would be nice to have this inherit from Renderer, but the problem is
     // that Python needs to own this class and Python needs to not own Renderer,
@@ -305,6 +363,14 @@ void pybind_rendering_classes(py::module &m) {
             .def_readwrite("point_size", &Material::point_size)
             .def_readwrite("line_width", &Material::line_width,
                            "Requires 'shader' to be 'unlitLine'")
+            .def_readwrite("splat_radius", &Material::splat_radius,
+                           "World-space point splat radius; 0 estimates it "
+                           "from the point spacing. Requires 'shader' to be "
+                           "'pointSplat'")
+            .def_readwrite("max_point_size", &Material::max_point_size,
+                           "Requires 'shader' to be 'pointSplat'")
+            .def_readwrite("splat_shading", &Material::splat_shading,
+                           "Requires 'shader' to be 'pointSplat'")
             .def_readwrite("albedo_img", &Material::albedo_img)
             .def_readwrite("normal_img", &Material::normal_img)
             .def_readwrite("ao_img", &Material::ao_img)
@@ -345,7 +411,15 @@ void pybind_rendering_classes(py::module &m) {
                            &TriangleMeshModel::MeshInfo::material_idx);
     tri_model.def(py::init<>())
             .def_readwrite("meshes", &TriangleMeshModel::meshes_)
-            .def_readwrite("materials", &TriangleMeshModel::materials_);
+            .def_readwrite("materials", &TriangleMeshModel::materials_)
+            .def("pack_texture_atlases", &PackTextureAtlases,
+                 "max_texture_size"_a = 1024, "atlas_size"_a = 4096,
+                 "Packs the albedo textures of meshes that are at most "
+                 "max_texture_size wide and high into atlases of at most "
+                 "atlas_size, and merges the meshes that then have the same "
+                 "material. Only materials with no other maps, whose meshes "
+                 "have UVs in [0, 1], are packed. Returns the number of "
+                 "textures packed.");
 
     // ---- ColorGradingParams ---
     py::class_<ColorGradingParams> color_grading(
@@ -434,11 +508,40 @@ void pybind_rendering_classes(py::module &m) {
             .def("has_geometry", &Scene::HasGeometry,
                  "Returns True if a geometry with the provided name exists in "
                  "the scene.")
-            .def("update_geometry", &Scene::UpdateGeometry,
+            .def("geometry_is_resident", &Scene::GeometryIsResident,
+                 "Returns False if the geometry's buffers have been released "
+                 "to stay within the renderer's memory budget.")
+            .def("set_occlusion_culling", &Scene::SetOcclusionCulling,
+                 "Hides geometries that are behind other geometries in all "
+                 "active views. Triangle meshes with few triangles that are "
+                 "added while enabled act as occluders.")
+            .def("update_geometry",
+                 (void (Scene::*)(const std::string &,
+                                  const t::geometry::PointCloud &, uint32_t)) &
+                         Scene::UpdateGeometry,
                  "Updates the flagged arrays from the tgeometry.PointCloud. "
                  "The flags should be ORed from Scene.UPDATE_POINTS_FLAG, "
                  "Scene.UPDATE_NORMALS_FLAG, Scene.UPDATE_COLORS_FLAG, and "
                  "Scene.UPDATE_UV0_FLAG")
+            .def("update_geometry",
+                 (void (Scene::*)(const std::string &,
+                                  const geometry::TriangleMesh &, uint32_t)) &
+                         Scene::UpdateGeometry,
+                 "Updates a TriangleMesh without triangle UVs in place. Any of "
+                 "Scene.UPDATE_POINTS_FLAG, Scene.UPDATE_NORMALS_FLAG and "
+                 "Scene.UPDATE_COLORS_FLAG uploads all vertex attributes; "
+                 "Scene.UPDATE_TRIANGLES_FLAG uploads the triangles and is "
+                 "required if the number of vertices grows")
+            .def("add_instanced_geometry", &Scene::AddInstancedGeometry,
+                 "name"_a, "geometry"_a, "material"_a, "transforms"_a,
+                 "colors"_a = core::Tensor(),
+                 "Adds one instance of the geometry per (4, 4) transform of "
+                 "the (N, 4, 4) transforms tensor, with optional (N, 3) "
+                 "per-instance colors. All instances share one GPU copy of "
+                 "the geometry.")
+            .def("update_instance_transforms",
+                 &Scene::UpdateInstanceTransforms, "name"_a, "transforms"_a,
+                 "Replaces the (N, 4, 4) transforms of an instanced geometry")
             .def("enable_indirect_light", &Scene::EnableIndirectLight,
                  "Enables or disables indirect lighting")
             .def("set_indirect_light", &Scene::SetIndirectLight,
@@ -492,6 +595,8 @@ void pybind_rendering_classes(py::module &m) {
     scene.attr("UPDATE_NORMALS_FLAG") = py::int_(Scene::kUpdateNormalsFlag);
     scene.attr("UPDATE_COLORS_FLAG") = py::int_(Scene::kUpdateColorsFlag);
     scene.attr("UPDATE_UV0_FLAG") = py::int_(Scene::kUpdateUv0Flag);
+    scene.attr("UPDATE_TRIANGLES_FLAG") =
+            py::int_(Scene::kUpdateTrianglesFlag);
 
     // ---- Open3DScene ----
     py::class_<Open3DScene, UnownedPointer<Open3DScene>> o3dscene(
@@ -555,6 +660,13 @@ void pybind_rendering_classes(py::module &m) {
                  "added to the scene, False otherwise")
             .def("remove_geometry", &Open3DScene::RemoveGeometry,
                  "Removes the geometry with the given name")
+            .def("update_mesh_blocks", &Open3DScene::UpdateMeshBlocks,
+                 "name"_a, "updated_blocks"_a, "updated_meshes"_a,
+                 "removed_blocks"_a, "material"_a,
+                 "Streams a mesh made of blocks, such as the result of "
+                 "TSDFVoxelGrid.extract_surface_mesh_update(). Each block is "
+                 "a geometry named '<name>/<x>_<y>_<z>' that is updated in "
+                 "place, so only the changed blocks are uploaded")
             .def("modify_geometry_material",
                  &Open3DScene::ModifyGeometryMaterial,
                  "modify_geometry_material(name, material). Modifies the "
@@ -41,6 +41,7 @@ namespace visualization {
 static const std::unordered_map<std::string, std::string>
         map_visualizer_docstrings = {
                 {"callback_func", "The call back function."},
+                {"pointcloud", "The ``open3d.t.geometry.PointCloud``."},
                 {"depth_scale",
                  "Scale depth value when capturing the depth image."},
                 {"do_render", "Set to ``True`` to do render."},
@@ -110,6 +111,20 @@ void pybind_visualizer(py::module &m) {
             .def("remove_geometry", &Visualizer::RemoveGeometry,
                  "Function to remove geometry", "geometry"_a,
                  "reset_bounding_box"_a = true)
+            .def("add_tensor_point_cloud", &Visualizer::AddTensorPointCloud,
+                 "Function to add a tensor point cloud to the scene. CUDA "
+                 "point clouds are copied into the vertex buffers on the "
+                 "device, without a round trip through host memory.",
+                 "pointcloud"_a, "reset_bounding_box"_a = true)
+            .def("remove_tensor_point_cloud",
+                 &Visualizer::RemoveTensorPointCloud,
+                 "Function to remove a tensor point cloud", "pointcloud"_a,
+                 "reset_bounding_box"_a = true)
+            .def("update_tensor_point_cloud",
+                 &Visualizer::UpdateTensorPointCloud,
+                 "Function to update a tensor point cloud after it has been "
+                 "changed.",
+                 "pointcloud"_a)
             .def("clear_geometries", &Visualizer::ClearGeometries,
                  "Function to clear geometries from the visualizer")
             .def("get_view_control", &Visualizer::GetViewControl,
@@ -229,6 +244,14 @@ void pybind_visualizer(py::module &m) {
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "remove_geometry",
                                     map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer", "add_tensor_point_cloud",
+                                    map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer",
+                                    "remove_tensor_point_cloud",
+                                    map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer",
+                                    "update_tensor_point_cloud",
+                                    map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer",
                                     "capture_depth_float_buffer",
                                     map_visualizer_docstrings);
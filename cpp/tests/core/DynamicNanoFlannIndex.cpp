@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/DynamicNanoFlannIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/utility/Helper.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(DynamicNanoFlannIndex, AddRemoveSearchKnn) {
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64);
+
+    // Add the points in several batches, the ids follow the insertion order.
+    core::nns::DynamicNanoFlannIndex index;
+    EXPECT_THROW(index.SearchKnn(query, 3), std::runtime_error);
+    std::vector<std::pair<int64_t, int64_t>> batches{
+            {0, 4}, {4, 5}, {5, 7}, {7, 10}};
+    for (const std::pair<int64_t, int64_t> &batch : batches) {
+        core::Tensor ids = index.Add(ref.Slice(0, batch.first, batch.second));
+        EXPECT_EQ(ids.ToFlatVector<int64_t>(),
+                  core::Tensor::Arange(batch.first, batch.second, 1)
+                          .ToFlatVector<int64_t>());
+    }
+    EXPECT_EQ(index.GetDatasetSize(), size);
+    EXPECT_LE(index.GetNumTrees(), 3);
+
+    // If k <= 0.
+    EXPECT_THROW(index.SearchKnn(query, -1), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+
+    // If k == 3.
+    std::pair<core::Tensor, core::Tensor> result = index.SearchKnn(query, 3);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(result.second.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0108912}));
+
+    // If k > size.
+    result = index.SearchKnn(query, 12);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8}));
+
+    // Removed points are not returned, unknown ids are ignored.
+    EXPECT_EQ(index.Remove(core::Tensor::Init<int64_t>({4, 9, 4, 42})), 2);
+    EXPECT_EQ(index.GetDatasetSize(), size - 2);
+    result = index.SearchKnn(query, 3);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 0, 3}));
+
+    // Removed points can't be found by radius or hybrid search either.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor> radius_result =
+            index.SearchRadius(query, 0.1);
+    ExpectEQ(std::get<0>(radius_result).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1}));
+    ExpectEQ(std::get<2>(radius_result).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({0, 1}));
+    result = index.SearchHybrid(query, 0.1, 2);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, -1}));
+
+    // Re-adding a point gives it a new id.
+    core::Tensor ids = index.Add(ref.Slice(0, 4, 5));
+    EXPECT_EQ(ids.ToFlatVector<int64_t>(), std::vector<int64_t>({10}));
+    result = index.SearchKnn(query, 2);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 10}));
+
+    // Dtype and dimension must match the previous points.
+    EXPECT_THROW(index.Add(ref.To(core::Dtype::Float32)), std::runtime_error);
+    EXPECT_THROW(index.Add(ref.Slice(1, 0, 2)), std::runtime_error);
+}
+
+TEST(DynamicNanoFlannIndex, MatchesBruteForce) {
+    // Pseudo-random 2D points, added and removed in many small batches.
+    int64_t size = 500;
+    core::Tensor points =
+            (core::Tensor::Arange(0, size * 2, 1, core::Dtype::Float32) *
+             0.618034)
+                    .Sin()
+                    .Reshape({size, 2});
+    core::nns::DynamicNanoFlannIndex index;
+    std::vector<bool> alive(size, true);
+    for (int64_t begin = 0; begin < size; begin += 25) {
+        index.Add(points.Slice(0, begin, begin + 25));
+        // Remove every third point of the previous batch.
+        if (begin > 0) {
+            std::vector<int64_t> removed;
+            for (int64_t id = begin - 25; id < begin; id += 3) {
+                removed.push_back(id);
+                alive[id] = false;
+            }
+            index.Remove(core::Tensor(removed,
+                                      {static_cast<int64_t>(removed.size())},
+                                      core::Dtype::Int64));
+        }
+    }
+    EXPECT_EQ(index.GetDatasetSize(),
+              std::count(alive.begin(), alive.end(), true));
+    EXPECT_LE(index.GetNumTrees(), 10);
+
+    core::Tensor query = points.Slice(0, 0, 20) + 0.01f;
+    int knn = 7;
+    std::pair<core::Tensor, core::Tensor> result = index.SearchKnn(query, knn);
+    std::vector<int64_t> indices = result.first.ToFlatVector<int64_t>();
+    std::vector<float> distances = result.second.ToFlatVector<float>();
+    for (int64_t i = 0; i < 20; ++i) {
+        core::Tensor diff = points - query.Slice(0, i, i + 1);
+        std::vector<float> dists =
+                (diff * diff).Sum({1}).ToFlatVector<float>();
+        std::vector<float> alive_dists;
+        for (int64_t id = 0; id < size; ++id) {
+            if (alive[id]) {
+                alive_dists.push_back(dists[id]);
+            }
+        }
+        std::sort(alive_dists.begin(), alive_dists.end());
+        for (int k = 0; k < knn; ++k) {
+            int64_t id = indices[i * knn + k];
+            EXPECT_TRUE(alive[id]);
+            EXPECT_NEAR(distances[i * knn + k], alive_dists[k], 1e-6);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -89,5 +89,77 @@ TEST_P(EigenConverterPermuteDevices, TensorToEigenMatrix) {
             core::Tensor::Ones({5, 4}, core::Dtype::Int32, cpu_device)));
 }
 
+TEST_P(EigenConverterPermuteDevices, EigenVector3dVectorFloat32) {
+    core::Device device = GetParam();
+    std::vector<Eigen::Vector3d> values{Eigen::Vector3d(0, 1, 2),
+                                        Eigen::Vector3d(3, 4, 5)};
+
+    core::Tensor tensor = core::eigen_converter::EigenVector3dVectorToTensor(
+            values, core::Dtype::Float32, device);
+    EXPECT_EQ(tensor.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(tensor.GetDevice(), device);
+    EXPECT_EQ(tensor.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+    ExpectEQ(core::eigen_converter::TensorToEigenVector3dVector(tensor),
+             values);
+
+    // Non-contiguous tensors are converted too.
+    core::Tensor tensor_t = core::Tensor::Init<float>(
+            {{0, 3}, {1, 4}, {2, 5}}, device);
+    ExpectEQ(core::eigen_converter::TensorToEigenVector3dVector(tensor_t.T()),
+             values);
+}
+
+TEST(EigenConverter, EigenVector3dVectorAsTensor) {
+    std::vector<Eigen::Vector3d> values{Eigen::Vector3d(0, 1, 2),
+                                        Eigen::Vector3d(3, 4, 5)};
+
+    // The tensor aliases the vector's storage.
+    core::Tensor tensor =
+            core::eigen_converter::EigenVector3dVectorAsTensor(values);
+    EXPECT_EQ(tensor.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(tensor.GetDtype(), core::Dtype::Float64);
+    EXPECT_EQ(tensor.GetDataPtr(), static_cast<void*>(values.data()));
+    tensor[1][2] = 10.0;
+    EXPECT_EQ(values[1](2), 10.0);
+
+    // Converting back copies, since the tensor does not own the vector.
+    std::vector<Eigen::Vector3d> values_copy =
+            core::eigen_converter::TensorToEigenVector3dVector(
+                    std::move(tensor));
+    EXPECT_NE(values_copy.data(), values.data());
+    ExpectEQ(values_copy, values);
+}
+
+TEST(EigenConverter, EigenVector3iVectorMoveToTensor) {
+    std::vector<Eigen::Vector3i> values{Eigen::Vector3i(0, 1, 2),
+                                        Eigen::Vector3i(3, 4, 5)};
+    const Eigen::Vector3i* data_ptr = values.data();
+
+    core::Tensor tensor =
+            core::eigen_converter::EigenVector3iVectorToTensor(
+                    std::move(values));
+    EXPECT_EQ(tensor.GetDtype(), core::Dtype::Int32);
+    EXPECT_EQ(tensor.GetDataPtr(), static_cast<const void*>(data_ptr));
+    EXPECT_EQ(tensor.ToFlatVector<int>(), std::vector<int>({0, 1, 2, 3, 4, 5}));
+
+    // While the storage is shared, converting back copies.
+    std::vector<Eigen::Vector3i> values_copy;
+    {
+        core::Tensor tensor_shared = tensor;
+        values_copy = core::eigen_converter::TensorToEigenVector3iVector(
+                std::move(tensor_shared));
+        EXPECT_NE(values_copy.data(), data_ptr);
+    }
+
+    // The sole owner hands the storage back and is reset.
+    std::vector<Eigen::Vector3i> values_moved =
+            core::eigen_converter::TensorToEigenVector3iVector(
+                    std::move(tensor));
+    EXPECT_EQ(values_moved.data(), data_ptr);
+    EXPECT_EQ(tensor.GetBlob(), nullptr);
+    ExpectEQ(values_moved, values_copy);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/FusedExpr.h"
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEWJIT.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FusedExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FusedExpr,
+                         FusedExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FusedExprPermuteDevices, Arithmetic) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor a(std::vector<float>{1, 2, 3, 4, 5, 6}, {2, 3}, dtype, device);
+    core::Tensor b(std::vector<float>{6, 5, 4, 3, 2, 1}, {2, 3}, dtype, device);
+    core::Tensor c(std::vector<float>{2, 2, 2, 3, 3, 3}, {2, 3}, dtype, device);
+    core::Tensor d(std::vector<float>{1, 1, 1, 1, 1, 1}, {2, 3}, dtype, device);
+
+    core::FusedExpr expr = (core::FusedExpr(a) - b) * c + d;
+    EXPECT_EQ(expr.NumInputs(), 4);
+    core::Tensor dst = expr.Eval();
+    core::Tensor ref = (a - b).Mul(c).Add(d);
+    EXPECT_EQ(dst.GetShape(), ref.GetShape());
+    EXPECT_EQ(dst.GetDevice(), device);
+    EXPECT_EQ(dst.ToFlatVector<float>(), ref.ToFlatVector<float>());
+
+    // Scalars and unary ops.
+    dst = core::Fuse((-(core::FusedExpr(a) / 2.f) + 1).Abs());
+    ref = ((a / 2.f).Neg() + 1.f).Abs();
+    EXPECT_EQ(dst.ToFlatVector<float>(), ref.ToFlatVector<float>());
+}
+
+TEST_P(FusedExprPermuteDevices, Broadcast) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float64;
+
+    core::Tensor a(std::vector<double>{0, 1, 2, 3, 4, 5}, {2, 3}, dtype,
+                   device);
+    core::Tensor b(std::vector<double>{10, 20, 30}, {3}, dtype, device);
+    core::Tensor c(std::vector<double>{2, 3}, {2, 1}, dtype, device);
+
+    core::Tensor dst = ((core::FusedExpr(a) + b) * c).Eval();
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<double>(),
+              std::vector<double>({20, 42, 64, 39, 72, 105}));
+
+    // Non-contiguous input.
+    core::Tensor a_t = a.T();
+    dst = (core::FusedExpr(a_t) * a_t).Eval();
+    EXPECT_EQ(dst.ToFlatVector<double>(), (a_t * a_t).ToFlatVector<double>());
+}
+
+TEST_P(FusedExprPermuteDevices, SharedInputs) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor a(std::vector<float>{1, 4, 9, 16}, {4}, dtype, device);
+    core::FusedExpr x(a);
+    core::FusedExpr expr = x.Sqrt() * x + x;
+    EXPECT_EQ(expr.NumInputs(), 1);
+    EXPECT_EQ(expr.Eval().ToFlatVector<float>(),
+              std::vector<float>({2, 12, 36, 80}));
+}
+
+TEST_P(FusedExprPermuteDevices, EvalInto) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Int32;
+
+    core::Tensor a(std::vector<int>{1, 2, 3, 4}, {4}, dtype, device);
+    core::Tensor b(std::vector<int>{4, 3, 2, 1}, {4}, dtype, device);
+
+    // In-place, dst aliases the input.
+    (core::FusedExpr(a) * b - 1).EvalInto(a);
+    EXPECT_EQ(a.ToFlatVector<int>(), std::vector<int>({3, 5, 5, 3}));
+
+    // Float-only ops are not allowed for integers.
+    EXPECT_ANY_THROW(core::FusedExpr(a).Sqrt().Eval());
+}
+
+TEST_P(FusedExprPermuteDevices, Errors) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Ones({2, 3}, core::Dtype::Float64, device);
+    core::Tensor c = core::Tensor::Ones({4}, core::Dtype::Float32, device);
+
+    // Dtype mismatch.
+    EXPECT_ANY_THROW((core::FusedExpr(a) + b).Eval());
+    // Shapes not broadcastable.
+    EXPECT_ANY_THROW((core::FusedExpr(a) + c).Eval());
+    // No tensor in expression.
+    EXPECT_ANY_THROW((core::FusedExpr(1.0) + 2.0).Eval());
+    // Too many distinct inputs.
+    core::FusedExpr expr(a);
+    std::vector<core::Tensor> tensors;
+    for (int i = 0; i < 16; ++i) {
+        tensors.push_back(core::Tensor::Ones({2, 3}, core::Dtype::Float32,
+                                             device));
+        expr = expr + tensors.back();
+    }
+    EXPECT_ANY_THROW(expr.Eval());
+}
+
+TEST(FusedExpr, JITSource) {
+    using core::kernel::FusedEWOpCode;
+    // sqrt(v0 * v1 + 0.5) - v0
+    core::kernel::FusedEWProgram program;
+    program.Push(FusedEWOpCode::LoadInput, 0);
+    program.Push(FusedEWOpCode::LoadInput, 1);
+    program.Push(FusedEWOpCode::Mul);
+    program.Push(FusedEWOpCode::LoadScalar, 0, 0.5);
+    program.Push(FusedEWOpCode::Add);
+    program.Push(FusedEWOpCode::Sqrt);
+    program.Push(FusedEWOpCode::LoadInput, 0);
+    program.Push(FusedEWOpCode::Sub);
+    EXPECT_EQ(program.ToExpression("float"),
+              "(o3d_sqrt(((v0 * v1) + ((float)(0.5)))) - v0)");
+
+    std::string source = core::kernel::GenerateFusedEWSource(
+            program, core::Dtype::Float32, {false, true});
+    EXPECT_NE(source.find("typedef float scalar_t;"), std::string::npos);
+    EXPECT_NE(source.find("const scalar_t v0 = args.in[0][i];"),
+              std::string::npos);
+    EXPECT_NE(source.find("const scalar_t v1 = args.in[1][0];"),
+              std::string::npos);
+    EXPECT_NE(source.find("args.out[i] = (o3d_sqrt("), std::string::npos);
+    EXPECT_ANY_THROW(core::kernel::GenerateFusedEWSource(
+            program, core::Dtype::UInt8, {false, false}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -33,6 +33,7 @@
 #include "open3d/core/Indexer.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/hashmap/SpillingHashmap.h"
 #include "open3d/utility/Optional.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
@@ -80,6 +81,7 @@ TEST_P(HashmapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     for (auto backend : backends) {
@@ -110,6 +112,7 @@ TEST_P(HashmapPermuteDevices, Find) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     const int n = 1000000;
@@ -154,6 +157,7 @@ TEST_P(HashmapPermuteDevices, Insert) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     const int n = 1000000;
@@ -199,6 +203,156 @@ TEST_P(HashmapPermuteDevices, Insert) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, FindOrInsert) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
+    }
+
+    const int n = 1000000;
+    const int slots = 1023;
+    const int existing = 100;
+    int init_capacity = n * 2;
+
+    HashData<int, int> data(n, slots);
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+    // Keys 0, ..., existing - 1 (times k_factor) are inserted beforehand.
+    std::vector<int> existing_keys(existing), existing_values(existing);
+    for (int i = 0; i < existing; ++i) {
+        existing_keys[i] = i * data.k_factor_;
+        existing_values[i] = i;
+    }
+
+    for (auto backend : backends) {
+        core::Hashmap hashmap(init_capacity, core::Dtype::Int32,
+                              core::Dtype::Int32, {1}, {1}, device, backend);
+
+        core::Tensor addrs, masks;
+        hashmap.Insert(
+                core::Tensor(existing_keys, {existing}, core::Dtype::Int32,
+                             device),
+                core::Tensor(existing_values, {existing}, core::Dtype::Int32,
+                             device),
+                addrs, masks);
+
+        // Placeholder values for the new keys.
+        core::Tensor placeholders =
+                core::Tensor::Full({n}, -1, core::Dtype::Int32, device);
+        hashmap.FindOrInsert(keys, placeholders, addrs, masks);
+        EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                  slots - existing);
+        EXPECT_EQ(hashmap.Size(), slots);
+
+        // Every address is valid and points to the queried key.
+        core::Tensor indices = addrs.To(core::Dtype::Int64);
+        core::Tensor found_keys = hashmap.GetKeyTensor().IndexGet({indices});
+        EXPECT_TRUE(found_keys.Reshape({n}).AllClose(keys));
+
+        // Existing entries keep their values, new ones take the placeholder.
+        std::vector<int> found_values = hashmap.GetValueTensor()
+                                                .IndexGet({indices})
+                                                .ToFlatVector<int>();
+        std::vector<bool> masks_vec = masks.ToFlatVector<bool>();
+        for (int i = 0; i < n; ++i) {
+            int v = data.vals_[i];
+            if (masks_vec[i]) {
+                EXPECT_GE(v, existing);
+            }
+            EXPECT_EQ(found_values[i], v < existing ? v : -1);
+        }
+
+        // A second pass finds everything without inserting.
+        hashmap.FindOrInsert(keys, addrs, masks);
+        EXPECT_FALSE(masks.Any());
+        EXPECT_EQ(hashmap.Size(), slots);
+        EXPECT_TRUE(addrs.To(core::Dtype::Int64).AllClose(indices));
+    }
+}
+
+TEST_P(HashmapPermuteDevices, Spilling) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
+    }
+
+    auto make_range = [&](int begin, int end, int factor) {
+        std::vector<int> data(end - begin);
+        for (int i = begin; i < end; ++i) {
+            data[i - begin] = i * factor;
+        }
+        return core::Tensor(data, {end - begin}, core::Dtype::Int32, device);
+    };
+
+    const int capacity = 100;
+    for (auto backend : backends) {
+        core::SpillingHashmap hashmap(capacity, core::Dtype::Int32,
+                                      core::Dtype::Int32, {1}, {1}, device,
+                                      backend);
+        core::Tensor addrs, masks;
+
+        // Frame 1: fill the device.
+        hashmap.NextFrame();
+        hashmap.Insert(make_range(0, 100, 1), make_range(0, 100, 10), addrs,
+                       masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_EQ(hashmap.GetDeviceSize(), 100);
+
+        // Frame 2: keep the first half warm.
+        hashmap.NextFrame();
+        hashmap.Find(make_range(0, 50, 1), addrs, masks);
+        EXPECT_TRUE(masks.All());
+
+        // Frame 3: new keys evict the cold half to host.
+        hashmap.NextFrame();
+        hashmap.Activate(make_range(100, 150, 1), addrs, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_EQ(hashmap.GetDeviceSize(), 100);
+        EXPECT_EQ(hashmap.GetHostSize(), 50);
+        EXPECT_EQ(hashmap.Size(), 150);
+
+        hashmap.GetDeviceHashmap().Find(make_range(0, 50, 1), addrs, masks);
+        EXPECT_TRUE(masks.All());
+        hashmap.GetHostHashmap().Find(
+                make_range(50, 100, 1).To(core::Device("CPU:0")), addrs, masks);
+        EXPECT_TRUE(masks.All());
+
+        // Frame 4: evicted entries are uploaded back with their values.
+        hashmap.NextFrame();
+        hashmap.Find(make_range(50, 60, 1), addrs, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_EQ(hashmap.GetHostSize(), 50);
+        EXPECT_EQ(hashmap.Size(), 150);
+        core::Tensor values =
+                hashmap.GetDeviceHashmap().GetValueTensor().IndexGet(
+                        {addrs.To(core::Dtype::Int64)});
+        EXPECT_TRUE(values.Reshape({10}).AllClose(make_range(50, 60, 10)));
+
+        // Erase from both sides.
+        hashmap.Erase(make_range(60, 62, 1), masks);
+        EXPECT_TRUE(masks.All());
+        hashmap.Erase(make_range(0, 1, 1), masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_EQ(hashmap.Size(), 147);
+
+        // A frame may not touch more keys than the device capacity.
+        hashmap.NextFrame();
+        EXPECT_ANY_THROW(
+                hashmap.Activate(make_range(1000, 1101, 1), addrs, masks));
+    }
+}
+
 TEST_P(HashmapPermuteDevices, Erase) {
     core::Device device = GetParam();
     std::vector<core::HashmapBackend> backends;
@@ -207,6 +361,7 @@ TEST_P(HashmapPermuteDevices, Erase) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     const int n = 1000000;
@@ -272,6 +427,7 @@ TEST_P(HashmapPermuteDevices, Rehash) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     const int n = 1000000;
@@ -318,6 +474,203 @@ TEST_P(HashmapPermuteDevices, Rehash) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, SaveLoad) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
+    }
+
+    const int n = 10000;
+    const int slots = 1023;
+    int init_capacity = n * 2;
+    const std::string file_name = "hashmap.bin";
+
+    HashData<int, int> data_insert(n, slots);
+    core::Tensor keys_insert(data_insert.keys_, {n}, core::Dtype::Int32,
+                             device);
+    core::Tensor values_insert(data_insert.vals_, {n}, core::Dtype::Int32,
+                               device);
+
+    HashData<int, int> data_erase(n, slots / 2);
+    core::Tensor keys_erase(data_erase.keys_, {n}, core::Dtype::Int32, device);
+
+    for (auto backend : backends) {
+        core::Hashmap hashmap(init_capacity, core::Dtype::Int32,
+                              core::Dtype::Int32, {1}, {1}, device, backend);
+
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys_insert, values_insert, addrs, masks);
+        hashmap.Erase(keys_erase, masks);
+
+        core::Tensor addrs_ref, masks_ref;
+        hashmap.Find(keys_insert, addrs_ref, masks_ref);
+        std::vector<int> addrs_ref_vec = addrs_ref.ToFlatVector<int>();
+        std::vector<bool> masks_ref_vec = masks_ref.ToFlatVector<bool>();
+
+        hashmap.Save(file_name);
+        std::vector<core::Hashmap> restored = {
+                core::Hashmap::Load(file_name, device, backend),
+                hashmap.Clone(), hashmap.CPU()};
+
+        for (auto& restored_hashmap : restored) {
+            EXPECT_EQ(restored_hashmap.Size(), slots - slots / 2);
+            EXPECT_EQ(restored_hashmap.GetCapacity(), init_capacity);
+
+            // Entries are found at their original addresses.
+            core::Tensor addrs_find, masks_find;
+            restored_hashmap.Find(keys_insert.To(restored_hashmap.GetDevice()),
+                                  addrs_find, masks_find);
+            std::vector<int> addrs_find_vec = addrs_find.ToFlatVector<int>();
+            std::vector<bool> masks_find_vec = masks_find.ToFlatVector<bool>();
+            std::vector<int> values_vec =
+                    restored_hashmap.GetValueTensor()
+                            .IndexGet({addrs_find.To(core::Dtype::Int64)})
+                            .ToFlatVector<int>();
+            for (int i = 0; i < n; ++i) {
+                EXPECT_EQ(masks_find_vec[i], masks_ref_vec[i]);
+                if (masks_find_vec[i]) {
+                    EXPECT_EQ(addrs_find_vec[i], addrs_ref_vec[i]);
+                    EXPECT_EQ(data_insert.keys_[i],
+                              data_insert.k_factor_ * values_vec[i]);
+                }
+            }
+
+            // Erased entries are reused without overwriting active ones.
+            restored_hashmap.Insert(
+                    keys_erase.To(restored_hashmap.GetDevice()),
+                    keys_erase.To(restored_hashmap.GetDevice()), addrs, masks);
+            EXPECT_EQ(restored_hashmap.Size(), slots);
+            restored_hashmap.Find(keys_insert.To(restored_hashmap.GetDevice()),
+                                  addrs_find, masks_find);
+            addrs_find_vec = addrs_find.ToFlatVector<int>();
+            for (int i = 0; i < n; ++i) {
+                if (masks_ref_vec[i]) {
+                    EXPECT_EQ(addrs_find_vec[i], addrs_ref_vec[i]);
+                }
+            }
+        }
+    }
+
+    EXPECT_ANY_THROW(core::Hashmap::Load("does_not_exist.bin", device));
+}
+
+TEST_P(HashmapPermuteDevices, MultiValue) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
+    }
+
+    const int n = 10000;
+    const int slots = 1023;
+    int init_capacity = 2048;
+    const std::string file_name = "hashmap_multi_value.bin";
+
+    // Buffers of 12, 1 and 8 bytes, so that not all rows are int aligned.
+    HashData<int, int> data(n, slots);
+    std::vector<float> positions(n * 3);
+    std::vector<uint8_t> labels(n);
+    std::vector<int64_t> ids(n);
+    for (int i = 0; i < n; ++i) {
+        int v = data.vals_[i];
+        positions[3 * i + 0] = v;
+        positions[3 * i + 1] = v + 0.5f;
+        positions[3 * i + 2] = -v;
+        labels[i] = static_cast<uint8_t>(v % 256);
+        ids[i] = int64_t(v) << 32;
+    }
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    // Positions are passed as a non-contiguous view.
+    std::vector<core::Tensor> values = {
+            core::Tensor(positions, {n, 3}, core::Dtype::Float32, device)
+                    .T()
+                    .Contiguous()
+                    .T(),
+            core::Tensor(labels, {n}, core::Dtype::UInt8, device),
+            core::Tensor(ids, {n}, core::Dtype::Int64, device)};
+
+    // Every active entry holds the values of its key in every buffer.
+    auto check_values = [&](core::Hashmap& hashmap) {
+        core::Tensor addrs, masks;
+        hashmap.Find(keys.To(hashmap.GetDevice()), addrs, masks);
+        EXPECT_TRUE(masks.All());
+        core::Tensor indices = addrs.To(core::Dtype::Int64);
+        std::vector<float> positions_found = hashmap.GetValueTensor(0)
+                                                     .IndexGet({indices})
+                                                     .ToFlatVector<float>();
+        std::vector<uint8_t> labels_found = hashmap.GetValueTensor("label")
+                                                    .IndexGet({indices})
+                                                    .ToFlatVector<uint8_t>();
+        std::vector<int64_t> ids_found = hashmap.GetValueTensor("id")
+                                                 .IndexGet({indices})
+                                                 .ToFlatVector<int64_t>();
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(positions_found[3 * i + 0], positions[3 * i + 0]);
+            EXPECT_EQ(positions_found[3 * i + 1], positions[3 * i + 1]);
+            EXPECT_EQ(positions_found[3 * i + 2], positions[3 * i + 2]);
+            EXPECT_EQ(labels_found[i], labels[i]);
+            EXPECT_EQ(ids_found[i], ids[i]);
+        }
+    };
+
+    for (auto backend : backends) {
+        core::Hashmap hashmap(
+                init_capacity, core::Dtype::Int32,
+                {core::Dtype::Float32, core::Dtype::UInt8, core::Dtype::Int64},
+                {1}, {{3}, {1}, {1}}, device, backend,
+                {"position", "label", "id"});
+        EXPECT_EQ(hashmap.GetValueBufferCount(), 3);
+        EXPECT_EQ(hashmap.GetValueBytesize(), 21);
+        EXPECT_EQ(hashmap.GetValueBufferIndex("id"), 2u);
+        EXPECT_ANY_THROW(hashmap.GetValueTensor("color"));
+
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        EXPECT_EQ(hashmap.Size(), slots);
+        check_values(hashmap);
+
+        // Rehashing moves the values of all the buffers.
+        hashmap.Rehash(hashmap.GetBucketCount() * 2);
+        check_values(hashmap);
+
+        // New keys get zeroed values in every buffer.
+        core::Tensor new_keys = core::Tensor::Init<int>({-1, -2}, device);
+        hashmap.FindOrInsert(new_keys, addrs, masks);
+        EXPECT_TRUE(masks.All());
+        core::Tensor indices = addrs.To(core::Dtype::Int64);
+        for (int64_t i = 0; i < hashmap.GetValueBufferCount(); ++i) {
+            EXPECT_FALSE(hashmap.GetValueTensor(i)
+                                 .IndexGet({indices})
+                                 .To(core::Dtype::Bool)
+                                 .Any());
+        }
+
+        hashmap.Save(file_name);
+        std::vector<core::Hashmap> restored = {
+                core::Hashmap::Load(file_name, device, backend),
+                hashmap.Clone(), hashmap.CPU()};
+        for (auto& restored_hashmap : restored) {
+            EXPECT_EQ(restored_hashmap.GetValueBufferCount(), 3);
+            EXPECT_EQ(restored_hashmap.GetValueNames(),
+                      hashmap.GetValueNames());
+            EXPECT_EQ(restored_hashmap.Size(), slots + 2);
+            check_values(restored_hashmap);
+        }
+
+        // One value tensor is required per buffer.
+        EXPECT_ANY_THROW(hashmap.Insert(keys, values[0], addrs, masks));
+    }
+}
+
 TEST_P(HashmapPermuteDevices, Clear) {
     core::Device device = GetParam();
     std::vector<core::HashmapBackend> backends;
@@ -326,6 +679,7 @@ TEST_P(HashmapPermuteDevices, Clear) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     const int n = 1000000;
@@ -404,6 +758,7 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     const int n = 1000000;
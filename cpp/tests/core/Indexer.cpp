@@ -117,41 +117,73 @@ TEST_P(IndexerPermuteDevices, BroadcastRestride) {
     core::TensorRef input1_tr = indexer.GetInput(1);
     core::TensorRef output_tr = indexer.GetOutput();
 
-    EXPECT_EQ(input0_tr.ndims_, 5);
-    EXPECT_EQ(input1_tr.ndims_, 5);
-    EXPECT_EQ(output_tr.ndims_, 5);
+    // The size-1 dimension is coalesced into its outer dimension.
+    EXPECT_EQ(input0_tr.ndims_, 4);
+    EXPECT_EQ(input1_tr.ndims_, 4);
+    EXPECT_EQ(output_tr.ndims_, 4);
+    EXPECT_FALSE(indexer.IsFlat());
 
     // Check core::Indexer's global info
     EXPECT_EQ(indexer.NumInputs(), 2);
     EXPECT_EQ(indexer.NumWorkloads(), 24);
     EXPECT_EQ(core::SizeVector(indexer.GetMasterShape(),
                                indexer.GetMasterShape() + indexer.NumDims()),
-              core::SizeVector({2, 2, 2, 1, 3}));
+              core::SizeVector({2, 2, 2, 3}));
     EXPECT_EQ(core::SizeVector(indexer.GetMasterStrides(),
                                indexer.GetMasterStrides() + indexer.NumDims()),
-              core::SizeVector({12, 6, 3, 3, 1}));
+              core::SizeVector({12, 6, 3, 1}));
 
     // Check tensor shape
     EXPECT_EQ(core::SizeVector(input0_tr.shape_,
                                input0_tr.shape_ + input0_tr.ndims_),
-              core::SizeVector({1, 2, 1, 1, 3}));
+              core::SizeVector({1, 2, 1, 3}));
     EXPECT_EQ(core::SizeVector(input1_tr.shape_,
                                input1_tr.shape_ + input1_tr.ndims_),
-              core::SizeVector({1, 1, 1, 1, 3}));
+              core::SizeVector({1, 1, 1, 3}));
     EXPECT_EQ(core::SizeVector(output_tr.shape_,
                                output_tr.shape_ + output_tr.ndims_),
-              core::SizeVector({2, 2, 2, 1, 3}));
+              core::SizeVector({2, 2, 2, 3}));
 
     // Check tensor strides
     EXPECT_EQ(core::SizeVector(input0_tr.byte_strides_,
                                input0_tr.byte_strides_ + input0_tr.ndims_),
-              core::SizeVector({0, 3 * 4, 0, 3 * 4, 1 * 4}));
+              core::SizeVector({0, 3 * 4, 0, 1 * 4}));
     EXPECT_EQ(core::SizeVector(input1_tr.byte_strides_,
                                input1_tr.byte_strides_ + input1_tr.ndims_),
-              core::SizeVector({0, 0, 0, 3 * 4, 1 * 4}));
+              core::SizeVector({0, 0, 0, 1 * 4}));
     EXPECT_EQ(core::SizeVector(output_tr.byte_strides_,
                                output_tr.byte_strides_ + output_tr.ndims_),
-              core::SizeVector({12 * 4, 6 * 4, 3 * 4, 3 * 4, 1 * 4}));
+              core::SizeVector({12 * 4, 6 * 4, 3 * 4, 1 * 4}));
+}
+
+TEST_P(IndexerPermuteDevices, CoalesceContiguous) {
+    core::Device device = GetParam();
+
+    // Contiguous operands and a broadcasted scalar collapse to one dimension.
+    core::Tensor input0({2, 3, 4}, core::Dtype::Float32, device);
+    core::Tensor input1({}, core::Dtype::Float32, device);
+    core::Tensor output({2, 3, 4}, core::Dtype::Float32, device);
+    core::Indexer indexer({input0, input1}, output);
+    EXPECT_TRUE(indexer.IsFlat());
+    EXPECT_EQ(indexer.NumDims(), 1);
+    EXPECT_EQ(indexer.NumWorkloads(), 24);
+    EXPECT_EQ(indexer.GetInputByteStride(0), 4);
+    EXPECT_EQ(indexer.GetInputByteStride(1), 0);
+    EXPECT_EQ(indexer.GetOutputByteStride(), 4);
+    EXPECT_EQ(indexer.GetInputPtr(0, 5),
+              static_cast<char*>(input0.GetDataPtr()) + 5 * 4);
+    EXPECT_EQ(indexer.GetInputPtr(1, 5),
+              static_cast<char*>(input1.GetDataPtr()));
+
+    // A transposed input keeps the workloads in the output's order.
+    core::Tensor input_t = input0.Transpose(1, 2);
+    core::Tensor output_t({2, 4, 3}, core::Dtype::Float32, device);
+    core::Indexer indexer_t({input_t}, output_t);
+    EXPECT_FALSE(indexer_t.IsFlat());
+    EXPECT_EQ(indexer_t.GetInputPtr(0, 1),
+              static_cast<char*>(input0.GetDataPtr()) + 4 * 4);
+    EXPECT_EQ(indexer_t.GetOutputPtr(1),
+              static_cast<char*>(output_t.GetDataPtr()) + 1 * 4);
 }
 
 TEST_P(IndexerPermuteDevices, GetPointers) {
@@ -189,5 +221,43 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, StaticIndexer) {
+    core::Device device = GetParam();
+
+    // Rank 2 after coalescing: transposed input, broadcasted row.
+    core::Tensor input0 =
+            core::Tensor({4, 3}, core::Dtype::Float32, device).T();
+    core::Tensor input1({1, 4}, core::Dtype::Float32, device);
+    core::Tensor output({3, 4}, core::Dtype::Float32, device);
+    core::Indexer indexer({input0, input1}, output);
+    EXPECT_EQ(indexer.NumDims(), 2);
+
+    core::StaticIndexer<2, 2> static_indexer(indexer);
+    for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
+        EXPECT_EQ(static_indexer.GetInputPtr(0, i), indexer.GetInputPtr(0, i));
+        EXPECT_EQ(static_indexer.GetInputPtr(1, i), indexer.GetInputPtr(1, i));
+        EXPECT_EQ(static_indexer.GetOutputPtr(i), indexer.GetOutputPtr(i));
+    }
+
+    // Rank 3 after coalescing: strided slice.
+    core::Tensor src({4, 5, 6}, core::Dtype::Int32, device);
+    core::Tensor src_slice =
+            src.Slice(0, 0, 4, 2).Slice(1, 0, 5, 2).Slice(2, 1, 6, 2);
+    core::Tensor dst(src_slice.GetShape(), core::Dtype::Int32, device);
+    core::Indexer indexer_3d({src_slice}, dst);
+    EXPECT_EQ(indexer_3d.NumDims(), 3);
+
+    core::StaticIndexer<3, 1> static_indexer_3d(indexer_3d);
+    for (int64_t i = 0; i < indexer_3d.NumWorkloads(); ++i) {
+        EXPECT_EQ(static_indexer_3d.GetInputPtr(0, i),
+                  indexer_3d.GetInputPtr(0, i));
+        EXPECT_EQ(static_indexer_3d.GetOutputPtr(i),
+                  indexer_3d.GetOutputPtr(i));
+    }
+
+    EXPECT_ANY_THROW((core::StaticIndexer<3, 2>(indexer)));
+    EXPECT_LT(sizeof(static_indexer), sizeof(indexer));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KnnIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/utility/Helper.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(KnnIndex, SearchKnn) {
+    core::Device device = core::Device("CUDA:0");
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32, device);
+    core::nns::KnnIndex index(ref);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32, device);
+
+    // If k <= 0.
+    EXPECT_THROW(index.SearchKnn(query, -1), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+
+    // If k == 3.
+    std::pair<core::Tensor, core::Tensor> result = index.SearchKnn(query, 3);
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(result.second.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0.0108912}));
+
+    // If k > size.
+    result = index.SearchKnn(query, 12);
+    EXPECT_EQ(result.first.GetShape(), core::SizeVector({1, size}));
+    ExpectEQ(result.first.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8}));
+
+    // Query points on another device.
+    EXPECT_THROW(index.SearchKnn(query.To(core::Device("CPU:0")), 3),
+                 std::runtime_error);
+}
+
+TEST(KnnIndex, SearchKnnMatchesBruteForce) {
+    core::Device device = core::Device("CUDA:0");
+    // More points than a single tile, with pseudo-random 8-dimensional
+    // features.
+    core::Tensor ref =
+            core::Tensor::Arange(0, 1000 * 8, 1, core::Dtype::Float64, device)
+                    .Reshape({1000, 8});
+    ref = (ref * 0.618034).Sin();
+    core::Tensor query = ref.Slice(0, 0, 50) + 0.01;
+    core::nns::KnnIndex index(ref);
+    std::pair<core::Tensor, core::Tensor> result = index.SearchKnn(query, 5);
+
+    core::Tensor ref_cpu = ref.To(core::Device("CPU:0"));
+    core::Tensor query_cpu = query.To(core::Device("CPU:0"));
+    std::vector<int64_t> indices = result.first.ToFlatVector<int64_t>();
+    std::vector<double> distances = result.second.ToFlatVector<double>();
+    for (int64_t i = 0; i < 50; ++i) {
+        core::Tensor diff = ref_cpu - query_cpu.Slice(0, i, i + 1);
+        std::vector<double> dists =
+                (diff * diff).Sum({1}).ToFlatVector<double>();
+        std::vector<double> sorted = dists;
+        std::sort(sorted.begin(), sorted.end());
+        for (int64_t k = 0; k < 5; ++k) {
+            EXPECT_NEAR(distances[i * 5 + k], sorted[k], 1e-10);
+            EXPECT_NEAR(dists[indices[i * 5 + k]], sorted[k], 1e-10);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
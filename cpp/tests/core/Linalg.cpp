@@ -460,5 +460,84 @@ TEST_P(LinalgPermuteDevices, LeastSquares) {
         EXPECT_TRUE(std::abs(X_data[i] - X_gt[i]) < EPSILON);
     }
 }
+TEST_P(LinalgPermuteDevices, Batched) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    // Two 3x3 matrices, the second one being diagonal.
+    core::Tensor A = core::Tensor::Init<float>(
+            {{{2, 1, 0}, {1, 3, 1}, {0, 1, 4}},
+             {{2, 0, 0}, {0, 4, 0}, {0, 0, 8}}},
+            device);
+    core::Tensor B = core::Tensor::Init<float>(
+            {{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}},
+             {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}},
+            device);
+
+    // Batched Matmul.
+    core::Tensor C = A.Matmul(B);
+    EXPECT_EQ(C.GetShape(), core::SizeVector({2, 3, 3}));
+    core::Tensor C_gt = core::Tensor::Init<float>(
+            {{{6, 9, 12}, {20, 25, 30}, {32, 37, 42}},
+             {{2, 0, 0}, {0, 4, 0}, {0, 0, 8}}},
+            device);
+    EXPECT_TRUE(C.AllClose(C_gt));
+
+    // Batched Matmul with non-square matrices.
+    core::Tensor A_2x4 = core::Tensor::Ones({3, 2, 4}, dtype, device);
+    core::Tensor B_4x3 = core::Tensor::Ones({3, 4, 3}, dtype, device);
+    core::Tensor C_2x3 = A_2x4.Matmul(B_4x3);
+    EXPECT_EQ(C_2x3.GetShape(), core::SizeVector({3, 2, 3}));
+    EXPECT_TRUE(
+            C_2x3.AllClose(core::Tensor::Full({3, 2, 3}, 4, dtype, device)));
+    EXPECT_ANY_THROW(A_2x4.Matmul(A_2x4));
+    EXPECT_ANY_THROW(
+            A_2x4.Matmul(core::Tensor::Ones({2, 4, 3}, dtype, device)));
+
+    // Batched Inverse.
+    core::Tensor A_inv = A.Inverse();
+    EXPECT_EQ(A_inv.GetShape(), core::SizeVector({2, 3, 3}));
+    core::Tensor I = core::Tensor::Eye(3, dtype, device).Reshape({1, 3, 3});
+    EXPECT_TRUE(A.Matmul(A_inv).AllClose(I.Expand({2, 3, 3}), 1e-5, 1e-5));
+
+    // Batched Inverse with a size that has no fixed-size kernel.
+    core::Tensor A_5x5 = core::Tensor::Eye(5, dtype, device)
+                                 .Mul(5)
+                                 .Add(core::Tensor::Ones({5, 5}, dtype, device))
+                                 .Reshape({1, 5, 5})
+                                 .Expand({4, 5, 5})
+                                 .Contiguous();
+    core::Tensor I_5x5 = core::Tensor::Eye(5, dtype, device)
+                                 .Reshape({1, 5, 5})
+                                 .Expand({4, 5, 5});
+    EXPECT_TRUE(A_5x5.Matmul(A_5x5.Inverse()).AllClose(I_5x5, 1e-5, 1e-5));
+
+    // Batched Solve with a batch of vectors.
+    core::Tensor b = core::Tensor::Init<float>({{3, 5, 5}, {2, 4, 8}}, device);
+    core::Tensor x = A.Solve(b);
+    EXPECT_EQ(x.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_TRUE(x.AllClose(core::Tensor::Ones({2, 3}, dtype, device), 1e-5,
+                           1e-5));
+
+    // Batched Solve with a batch of matrices.
+    core::Tensor X = A.Solve(C);
+    EXPECT_EQ(X.GetShape(), core::SizeVector({2, 3, 3}));
+    EXPECT_TRUE(X.AllClose(B, 1e-5, 1e-5));
+    EXPECT_ANY_THROW(A.Solve(core::Tensor::Ones({3, 3}, dtype, device)));
+
+    // Batched determinant.
+    core::Tensor A_det = A.BatchedDet();
+    EXPECT_EQ(A_det.GetShape(), core::SizeVector({2}));
+    EXPECT_TRUE(A_det.AllClose(core::Tensor::Init<float>({18, 64}, device),
+                               1e-5, 1e-5));
+
+    // Singular matrices.
+    core::Tensor S = core::Tensor::Init<float>(
+            {{{1, 2}, {3, 4}}, {{1, 2}, {2, 4}}}, device);
+    EXPECT_TRUE(S.BatchedDet().AllClose(
+            core::Tensor::Init<float>({-2, 0}, device), 1e-5, 1e-5));
+    EXPECT_ANY_THROW(S.Inverse());
+    EXPECT_ANY_THROW(S.Solve(core::Tensor::Ones({2, 2}, dtype, device)));
+}
 }  // namespace tests
 }  // namespace open3d
@@ -26,10 +26,14 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <cstring>
 #include <vector>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryStatistics.h"
+#include "open3d/core/ScopedArena.h"
+#include "open3d/core/Tensor.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
 
@@ -78,5 +82,165 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST(MemoryManager, CPUCache) {
+    core::Device device("CPU:0");
+    bool was_enabled = core::CPUMemoryManager::IsCacheEnabled();
+
+    core::CPUMemoryManager::SetCacheEnabled(true);
+    core::CPUMemoryManager::ReleaseCache();
+    core::MemoryCacheStatistics stats0 =
+            core::CPUMemoryManager::GetCacheStatistics();
+    EXPECT_EQ(stats0.cached_bytes_, 0);
+
+    // Same size class: the second Malloc reuses the first block.
+    for (size_t byte_size : {size_t(100), size_t(3000), size_t(2 << 20)}) {
+        void* ptr = core::MemoryManager::Malloc(byte_size, device);
+        std::memset(ptr, 0, byte_size);
+        core::MemoryManager::Free(ptr, device);
+        EXPECT_GT(core::CPUMemoryManager::GetCacheStatistics().cached_bytes_,
+                  0);
+        void* ptr2 = core::MemoryManager::Malloc(byte_size - 1, device);
+        EXPECT_EQ(ptr, ptr2);
+        core::MemoryManager::Free(ptr2, device);
+    }
+    core::MemoryCacheStatistics stats1 =
+            core::CPUMemoryManager::GetCacheStatistics();
+    EXPECT_GE(stats1.num_hits_ - stats0.num_hits_, 3);
+
+    // Memory allocated with the cache can be freed without the cache and vice
+    // versa.
+    void* cached_ptr = core::MemoryManager::Malloc(64, device);
+    core::CPUMemoryManager::SetCacheEnabled(false);
+    void* uncached_ptr = core::MemoryManager::Malloc(64, device);
+    core::MemoryManager::Free(cached_ptr, device);
+    core::CPUMemoryManager::SetCacheEnabled(true);
+    core::MemoryManager::Free(uncached_ptr, device);
+
+    core::CPUMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::CPUMemoryManager::GetCacheStatistics().cached_bytes_, 0);
+    core::CPUMemoryManager::SetCacheEnabled(was_enabled);
+}
+
+TEST_P(MemoryManagerPermuteDevices, MemoryTracker) {
+    core::Device device = GetParam();
+    core::MemoryTracker& tracker = core::MemoryTracker::GetInstance();
+    bool was_enabled = tracker.IsEnabled();
+    tracker.SetEnabled(true);
+    tracker.ResetStatistics();
+
+    core::MemoryStatistics stats0 = tracker.GetStatistics(device);
+    void* ptr0 = core::MemoryManager::Malloc(100, device);
+    void* ptr1 = nullptr;
+    {
+        core::ScopedMemoryTag outer("outer");
+        {
+            core::ScopedMemoryTag inner("inner");
+            ptr1 = core::MemoryManager::Malloc(50, device);
+        }
+    }
+    core::MemoryStatistics stats1 = tracker.GetStatistics(device);
+    EXPECT_EQ(stats1.live_bytes_ - stats0.live_bytes_, 150);
+    EXPECT_EQ(stats1.num_allocs_ - stats0.num_allocs_, 2);
+    EXPECT_GE(stats1.peak_bytes_, stats1.live_bytes_);
+    EXPECT_EQ(tracker.GetStatistics(device, "outer/inner").live_bytes_, 50);
+
+    core::MemoryManager::Free(ptr1, device);
+    core::MemoryManager::Free(ptr0, device);
+    core::MemoryStatistics stats2 = tracker.GetStatistics(device);
+    EXPECT_EQ(stats2.live_bytes_, stats0.live_bytes_);
+    EXPECT_EQ(stats2.num_frees_ - stats0.num_frees_, 2);
+    EXPECT_EQ(stats2.peak_bytes_, stats1.peak_bytes_);
+    EXPECT_EQ(tracker.GetStatistics(device, "outer/inner").live_bytes_, 0);
+    EXPECT_EQ(tracker.GetStatistics(device, "outer/inner").peak_bytes_, 50);
+
+    tracker.SetEnabled(was_enabled);
+}
+
+TEST_P(MemoryManagerPermuteDevices, Pinned) {
+    core::Device device = GetParam();
+    core::CPUPinnedMemoryManager::ReleaseCache();
+    core::MemoryCacheStatistics stats0 =
+            core::CPUPinnedMemoryManager::GetCacheStatistics();
+
+    core::Tensor src_t =
+            core::Tensor::EmptyPinned({2, 3}, core::Dtype::Int32);
+    EXPECT_EQ(src_t.GetDevice(), core::Device("CPU:0"));
+    src_t.Fill(7);
+    void* src_ptr = src_t.GetDataPtr();
+
+    core::CUDAStream stream;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        stream = core::CUDAStream(device);
+    }
+    core::Tensor dst_t = src_t.To(device, stream, /*copy=*/true);
+    stream.Synchronize();
+    EXPECT_EQ(dst_t.ToFlatVector<int>(), std::vector<int>(6, 7));
+
+    // Freed blocks are reused for allocations of the same size.
+    src_t = core::Tensor();
+    core::Tensor reuse_t =
+            core::Tensor::EmptyPinned({3, 2}, core::Dtype::Int32);
+    EXPECT_EQ(reuse_t.GetDataPtr(), src_ptr);
+    core::MemoryCacheStatistics stats1 =
+            core::CPUPinnedMemoryManager::GetCacheStatistics();
+    EXPECT_EQ(stats1.num_hits_ - stats0.num_hits_, 1);
+    EXPECT_EQ(stats1.num_misses_ - stats0.num_misses_, 1);
+
+    reuse_t = core::Tensor();
+    EXPECT_EQ(core::CPUPinnedMemoryManager::GetCacheStatistics().cached_bytes_,
+              24);
+    core::CPUPinnedMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::CPUPinnedMemoryManager::GetCacheStatistics().cached_bytes_,
+              0);
+}
+
+TEST_P(MemoryManagerPermuteDevices, ScopedArena) {
+    core::Device device = GetParam();
+    const int64_t capacity = 4096;
+    const core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor escaped;
+    {
+        core::ScopedArena arena(device, capacity);
+        EXPECT_EQ(arena.GetDevice(), device);
+        EXPECT_EQ(arena.GetCapacity(), capacity);
+
+        // Allocations are bumped and aligned to 256 bytes.
+        core::Tensor a = core::Tensor::Empty({10}, dtype, device);
+        core::Tensor b = core::Tensor::Empty({10}, dtype, device);
+        EXPECT_EQ(static_cast<uint8_t*>(b.GetDataPtr()) -
+                          static_cast<uint8_t*>(a.GetDataPtr()),
+                  256);
+        EXPECT_EQ(arena.GetUsedBytes(), 512);
+
+        // Allocations that do not fit fall back to the MemoryManager.
+        core::Tensor large = core::Tensor::Empty({capacity}, dtype, device);
+        EXPECT_EQ(arena.GetUsedBytes(), 512);
+
+        // The arena restarts once all of its allocations are freed.
+        a = core::Tensor();
+        b = core::Tensor();
+        core::Tensor c = core::Tensor::Empty({1}, dtype, device);
+        EXPECT_EQ(arena.GetUsedBytes(), 256);
+
+        // The innermost arena is used.
+        {
+            core::ScopedArena inner(device, capacity);
+            core::Tensor d = core::Tensor::Empty({1}, dtype, device);
+            EXPECT_EQ(inner.GetUsedBytes(), 256);
+            EXPECT_EQ(arena.GetUsedBytes(), 256);
+        }
+
+        // Tensors escaping the arena keep its block alive.
+        escaped = core::Tensor::Full({4}, 5, core::Dtype::Int64, device);
+    }
+    EXPECT_EQ(escaped.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({5, 5, 5, 5}));
+
+    // Without an arena, the MemoryManager is used.
+    core::Blob blob(16, device);
+    EXPECT_FALSE(static_cast<bool>(blob.GetDeleter()));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -50,7 +50,7 @@ INSTANTIATE_TEST_SUITE_P(
         NNSPermuteDevicesWithFaiss,
         testing::ValuesIn(PermuteDevicesWithFaiss::TestCases()));
 
-TEST_P(NNSPermuteDevicesWithFaiss, KnnSearch) {
+TEST_P(NNSPermuteDevices, KnnSearch) {
     // Set up nns.
     int size = 10;
     core::Device device = GetParam();
@@ -94,7 +94,7 @@ TEST_P(NNSPermuteDevicesWithFaiss, KnnSearch) {
     // Multiple points.
     query = core::Tensor(std::vector<float>({0.064705, 0.043921, 0.087843,
                                              0.064705, 0.043921, 0.087843}),
-                         {2, 3}, core::Dtype::Float32);
+                         {2, 3}, core::Dtype::Float32, device);
     result = nns.KnnSearch(query, 3);
     indices = result.first;
     distances = result.second;
@@ -205,5 +205,46 @@ TEST_P(NNSPermuteDevicesWithFaiss, HybridSearch) {
              std::vector<float>({0.00626358, 0.00747938, 0}));
 }
 
+TEST_P(NNSPermuteDevices, HybridSearchPreallocated) {
+    // Set up nns.
+    int size = 10;
+    core::Device device = GetParam();
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32, device);
+    core::nns::NearestNeighborSearch nns(ref);
+    double radius = 0.1;
+    int max_knn = 3;
+    nns.HybridIndex(radius);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32, device);
+
+    // Matching outputs are written in place.
+    core::Tensor indices =
+            core::Tensor::Full({1, max_knn}, 7, core::Dtype::Int64, device);
+    core::Tensor distances =
+            core::Tensor::Full({1, max_knn}, 7, core::Dtype::Float32, device);
+    void *indices_ptr = indices.GetDataPtr();
+    void *distances_ptr = distances.GetDataPtr();
+    nns.HybridSearch(query, radius, max_knn, indices, distances);
+    EXPECT_EQ(indices.GetDataPtr(), indices_ptr);
+    EXPECT_EQ(distances.GetDataPtr(), distances_ptr);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, -1}));
+    ExpectEQ(distances.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0}));
+
+    // Mismatching outputs are reallocated.
+    query = core::Tensor(std::vector<float>({0.064705, 0.043921, 0.087843,
+                                             0.064705, 0.043921, 0.087843}),
+                         {2, 3}, core::Dtype::Float32, device);
+    nns.HybridSearch(query, radius, max_knn, indices, distances);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({2, max_knn}));
+    EXPECT_EQ(distances.GetShape(), core::SizeVector({2, max_knn}));
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, -1, 1, 4, -1}));
+}
+
 }  // namespace tests
 }  // namespace open3d
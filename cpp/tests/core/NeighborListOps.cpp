@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/NeighborListOps.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class NeighborListOpsPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(NeighborListOps,
+                         NeighborListOpsPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(NeighborListOpsPermuteDevices, InvertNeighborsList) {
+    core::Device device = GetParam();
+
+    // The neighbors of 3 queries in 2 points.
+    core::Tensor index(std::vector<int32_t>{0, 1, 0, 0}, {4},
+                       core::Dtype::Int32, device);
+    core::Tensor row_splits(std::vector<int64_t>{0, 2, 3, 4}, {4},
+                            core::Dtype::Int64, device);
+    core::Tensor attributes(std::vector<float>{0.1, 0.2, 0.3, 0.4}, {4},
+                            core::Dtype::Float32, device);
+
+    core::Tensor out_index, out_row_splits, out_attributes;
+    core::nns::InvertNeighborsList(2, index, row_splits, attributes,
+                                   out_index, out_row_splits, out_attributes);
+    EXPECT_EQ(out_row_splits.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 3, 4}));
+
+    // The order of the neighbors within a row is not defined.
+    std::vector<int32_t> index_vec = out_index.ToFlatVector<int32_t>();
+    std::vector<float> attributes_vec = out_attributes.ToFlatVector<float>();
+    std::vector<std::pair<int32_t, float>> row0;
+    for (int i = 0; i < 3; ++i) {
+        row0.emplace_back(index_vec[i], attributes_vec[i]);
+    }
+    std::sort(row0.begin(), row0.end());
+    EXPECT_EQ(row0, (std::vector<std::pair<int32_t, float>>(
+                            {{0, 0.1f}, {1, 0.3f}, {2, 0.4f}})));
+    EXPECT_EQ(index_vec[3], 0);
+    EXPECT_EQ(attributes_vec[3], 0.2f);
+
+    // Without attributes.
+    core::Tensor no_attributes =
+            core::Tensor::Empty({0}, core::Dtype::Float32, device);
+    core::nns::InvertNeighborsList(2, index.To(core::Dtype::Int64), row_splits,
+                                   no_attributes, out_index, out_row_splits,
+                                   out_attributes);
+    EXPECT_EQ(out_index.GetDtype(), core::Dtype::Int64);
+    EXPECT_EQ(out_attributes.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(out_row_splits.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 3, 4}));
+}
+
+TEST_P(NeighborListOpsPermuteDevices, ReduceSubarraysSum) {
+    core::Device device = GetParam();
+
+    core::Tensor values(std::vector<float>{1, 2, 3, 4, 5}, {5},
+                        core::Dtype::Float32, device);
+    core::Tensor row_splits(std::vector<int64_t>{0, 2, 2, 5}, {4},
+                            core::Dtype::Int64, device);
+    core::Tensor sums = core::nns::ReduceSubarraysSum(values, row_splits);
+    EXPECT_EQ(sums.ToFlatVector<float>(), std::vector<float>({3, 0, 12}));
+
+    EXPECT_ANY_THROW(core::nns::ReduceSubarraysSum(
+            values, row_splits.To(core::Dtype::Int32)));
+}
+
+TEST_P(NeighborListOpsPermuteDevices, RaggedToDense) {
+    core::Device device = GetParam();
+
+    core::Tensor values(std::vector<int64_t>{1, 2, 3, 4, 5}, {5},
+                        core::Dtype::Int64, device);
+    core::Tensor row_splits(std::vector<int64_t>{0, 2, 2, 5}, {4},
+                            core::Dtype::Int64, device);
+    core::Tensor default_value(std::vector<int64_t>{-1}, {},
+                               core::Dtype::Int64, device);
+    core::Tensor dense = core::nns::RaggedToDense(values, row_splits, 2,
+                                                  default_value);
+    EXPECT_EQ(dense.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dense.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, -1, -1, 3, 4}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ParallelPrimitives.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ParallelPrimitivesPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ParallelPrimitives,
+                         ParallelPrimitivesPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ParallelPrimitivesPermuteDevices, Scan) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<int32_t>({3, 1, 4, 1, 5}, device);
+    ExpectEQ(core::Scan(src).ToFlatVector<int32_t>(),
+             std::vector<int32_t>({3, 4, 8, 9, 14}));
+    ExpectEQ(core::Scan(src, /*exclusive=*/true).ToFlatVector<int32_t>(),
+             std::vector<int32_t>({0, 3, 4, 8, 9}));
+
+    // Bool is summed as Int64.
+    core::Tensor mask = core::Tensor::Init<bool>({true, false, true}, device);
+    core::Tensor mask_sum = core::Scan(mask);
+    EXPECT_EQ(mask_sum.GetDtype(), core::Dtype::Int64);
+    ExpectEQ(mask_sum.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 1, 2}));
+
+    // Large enough to be split into chunks.
+    int64_t n = 1000003;
+    core::Tensor ones = core::Tensor::Ones({n}, core::Dtype::Int64, device);
+    core::Tensor ones_sum = core::Scan(ones);
+    EXPECT_TRUE(ones_sum.AllClose(core::Tensor::Arange(
+            1, n + 1, 1, core::Dtype::Int64, device)));
+
+    EXPECT_ANY_THROW(core::Scan(core::Tensor::Ones({2, 2}, core::Dtype::Int32,
+                                                   device)));
+}
+
+TEST_P(ParallelPrimitivesPermuteDevices, SortByKey) {
+    core::Device device = GetParam();
+    core::Tensor keys =
+            core::Tensor::Init<float>({2.5, -1, 0, 2.5, -7.5, 0}, device);
+    core::Tensor values = core::Tensor::Init<int64_t>(
+            {{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}}, device);
+    ExpectEQ(core::ArgSort(keys).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({4, 1, 2, 5, 0, 3}));
+
+    core::Tensor sorted_keys, sorted_values;
+    std::tie(sorted_keys, sorted_values) = core::SortByKey(keys, values);
+    ExpectEQ(sorted_keys.ToFlatVector<float>(),
+             std::vector<float>({-7.5, -1, 0, 0, 2.5, 2.5}));
+    ExpectEQ(sorted_values.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({4, 4, 1, 1, 2, 2, 5, 5, 0, 0, 3, 3}));
+
+    // Random keys, checked against a stable sort.
+    int64_t n = 100000;
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+    std::vector<int64_t> keys_vec(n);
+    std::generate(keys_vec.begin(), keys_vec.end(),
+                  [&]() { return dist(rng); });
+    std::vector<int64_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](int64_t a, int64_t b) {
+                         return keys_vec[a] < keys_vec[b];
+                     });
+    core::Tensor random_keys(keys_vec, {n}, core::Dtype::Int64, device);
+    ExpectEQ(core::ArgSort(random_keys).ToFlatVector<int64_t>(), expected);
+}
+
+TEST_P(ParallelPrimitivesPermuteDevices, Unique) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<int32_t>({5, 2, 5, 5, -1, 2}, device);
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = core::Unique(src);
+    ExpectEQ(unique.ToFlatVector<int32_t>(), std::vector<int32_t>({-1, 2, 5}));
+    ExpectEQ(inverse.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({2, 1, 2, 2, 0, 1}));
+    ExpectEQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2, 3}));
+    EXPECT_TRUE(unique.IndexGet({inverse}).AllClose(src));
+
+    std::tie(unique, inverse, counts) =
+            core::Unique(core::Tensor({0}, core::Dtype::Int32, device));
+    EXPECT_EQ(unique.GetLength(), 0);
+    EXPECT_EQ(counts.GetLength(), 0);
+}
+
+TEST_P(ParallelPrimitivesPermuteDevices, SegmentedReduce) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>(
+            {{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}}, device);
+    core::Tensor offsets = core::Tensor::Init<int64_t>({0, 2, 2, 5}, device);
+
+    ExpectEQ(core::SegmentedReduce(src, offsets,
+                                   core::kernel::ReductionOpCode::Sum)
+                     .ToFlatVector<float>(),
+             std::vector<float>({4, 6, 0, 0, 21, 24}));
+    ExpectEQ(core::SegmentedReduce(src, offsets,
+                                   core::kernel::ReductionOpCode::Max)
+                     .ToFlatVector<float>(),
+             std::vector<float>({3, 4, std::numeric_limits<float>::lowest(),
+                                 std::numeric_limits<float>::lowest(), 9,
+                                 10}));
+
+    // Single column segments.
+    core::Tensor src_1d = core::Tensor::Init<int32_t>({4, 2, 3, 1}, device);
+    core::Tensor offsets_1d = core::Tensor::Init<int64_t>({0, 3, 4}, device);
+    ExpectEQ(core::SegmentedReduce(src_1d, offsets_1d,
+                                   core::kernel::ReductionOpCode::Min)
+                     .ToFlatVector<int32_t>(),
+             std::vector<int32_t>({2, 1}));
+    ExpectEQ(core::SegmentedReduce(src_1d, offsets_1d,
+                                   core::kernel::ReductionOpCode::Prod)
+                     .ToFlatVector<int32_t>(),
+             std::vector<int32_t>({24, 1}));
+
+    EXPECT_ANY_THROW(core::SegmentedReduce(
+            src, offsets, core::kernel::ReductionOpCode::ArgMax));
+}
+
+TEST_P(ParallelPrimitivesPermuteDevices, Compact) {
+    core::Device device = GetParam();
+    core::Tensor mask = core::Tensor::Init<bool>(
+            {false, true, true, false, true}, device);
+    ExpectEQ(core::CompactIndices(mask).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 2, 4}));
+
+    core::Tensor src = core::Tensor::Init<double>(
+            {{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}}, device);
+    ExpectEQ(core::Compact(src, mask).ToFlatVector<double>(),
+             std::vector<double>({1, 1, 2, 2, 4, 4}));
+
+    int64_t n = 1000003;
+    core::Tensor all = core::Tensor::Full({n}, true, core::Dtype::Bool, device);
+    EXPECT_TRUE(core::CompactIndices(all).AllClose(
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device)));
+    core::Tensor none = core::Tensor::Zeros({n}, core::Dtype::Bool, device);
+    EXPECT_EQ(core::CompactIndices(none).GetLength(), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/ShardedFixedRadiusIndex.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Points on a 8 x 4 x 2 grid with spacing 0.1, the longest axis being x.
+static core::Tensor GridPoints() {
+    std::vector<float> points;
+    for (int x = 0; x < 8; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            for (int z = 0; z < 2; ++z) {
+                points.insert(points.end(), {0.1f * x, 0.1f * y, 0.1f * z});
+            }
+        }
+    }
+    return core::Tensor(points, {int64_t(points.size() / 3), 3},
+                        core::Dtype::Float32);
+}
+
+// Neighbor indices of each query, sorted to compare independently of the
+// order of equidistant neighbors.
+static std::vector<std::vector<int64_t>> SortedNeighbors(
+        const core::Tensor& indices, const core::Tensor& row_splits) {
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<int64_t> splits_vec = row_splits.ToFlatVector<int64_t>();
+    std::vector<std::vector<int64_t>> neighbors;
+    for (size_t i = 0; i + 1 < splits_vec.size(); ++i) {
+        neighbors.emplace_back(indices_vec.begin() + splits_vec[i],
+                               indices_vec.begin() + splits_vec[i + 1]);
+        std::sort(neighbors.back().begin(), neighbors.back().end());
+    }
+    return neighbors;
+}
+
+TEST(ShardedFixedRadiusIndex, SearchRadius) {
+    core::Tensor dataset = GridPoints();
+    core::Tensor query = dataset.Add(0.013f);
+    double radius = 0.15;
+
+    core::nns::NanoFlannIndex reference(dataset);
+    core::Tensor ref_indices, ref_distances, ref_row_splits;
+    std::tie(ref_indices, ref_distances, ref_row_splits) =
+            reference.SearchRadius(query, radius);
+
+    std::vector<core::Device> devices(3, core::Device("CPU:0"));
+    core::nns::ShardedFixedRadiusIndex index(dataset, radius, devices);
+    EXPECT_EQ(index.GetNumShards(), 3);
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            index.SearchRadius(query, radius);
+
+    EXPECT_EQ(row_splits.ToFlatVector<int64_t>(),
+              ref_row_splits.ToFlatVector<int64_t>());
+    EXPECT_EQ(SortedNeighbors(indices, row_splits),
+              SortedNeighbors(ref_indices, ref_row_splits));
+    EXPECT_NEAR(distances.Sum({0}).Item<float>(),
+                ref_distances.Sum({0}).Item<float>(), 1e-4);
+
+    // The index only holds the neighbors up to its radius.
+    EXPECT_THROW(index.SearchRadius(query, 2 * radius), std::runtime_error);
+}
+
+TEST(ShardedFixedRadiusIndex, SearchHybrid) {
+    core::Tensor dataset = GridPoints();
+    core::Tensor query = dataset.Add(0.013f);
+    double radius = 0.15;
+    int max_knn = 32;
+
+    core::nns::NanoFlannIndex reference(dataset);
+    core::Tensor ref_indices, ref_distances;
+    std::tie(ref_indices, ref_distances) =
+            reference.SearchHybrid(query, radius, max_knn);
+
+    std::vector<core::Device> devices(4, core::Device("CPU:0"));
+    core::nns::ShardedFixedRadiusIndex index(dataset, radius, devices);
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchHybrid(query, radius, max_knn);
+
+    EXPECT_EQ(indices.GetShape(), ref_indices.GetShape());
+    EXPECT_EQ(indices.Lt(0).ToFlatVector<bool>(),
+              ref_indices.Lt(0).ToFlatVector<bool>());
+    int64_t num_queries = query.GetShape(0);
+    core::Tensor row_splits = core::Tensor::Arange(
+            0, (num_queries + 1) * max_knn, max_knn, core::Dtype::Int64);
+    EXPECT_EQ(SortedNeighbors(indices.Reshape({-1}), row_splits),
+              SortedNeighbors(ref_indices.Reshape({-1}), row_splits));
+}
+
+}  // namespace tests
+}  // namespace open3d
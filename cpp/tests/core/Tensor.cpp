@@ -28,6 +28,7 @@
 
 #include <cmath>
 #include <limits>
+#include <tuple>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
@@ -352,6 +353,95 @@ TEST_P(TensorPermuteDevices, To) {
     EXPECT_EQ(dst_t.ToFlatVector<int>(), dst_vals);
 }
 
+TEST_P(TensorPermuteDevices, ToHalf) {
+    core::Device device = GetParam();
+
+    // Round-to-nearest-even conversions.
+    EXPECT_EQ(core::Half(1.0f).bits, 0x3c00);
+    EXPECT_EQ(core::Half(-2.5f).bits, 0xc100);
+    EXPECT_EQ(core::Half(65504.0f).bits, 0x7bff);
+    EXPECT_EQ(core::Half(65520.0f).bits, 0x7c00);
+    EXPECT_EQ(core::Half(1.0f + 1.0f / 2048).bits, 0x3c00);
+    EXPECT_EQ(core::Half(1.0f + 3.0f / 2048).bits, 0x3c02);
+    EXPECT_EQ(static_cast<float>(core::Half::FromBits(0x0001)),
+              1.0f / (1 << 24));
+    EXPECT_TRUE(std::isnan(static_cast<float>(core::Half(NAN))));
+    EXPECT_EQ(core::BFloat16(1.0f).bits, 0x3f80);
+    EXPECT_NEAR(static_cast<float>(core::BFloat16(3.0e38f)), 3.0e38f, 3.0e36f);
+    EXPECT_TRUE(std::isnan(static_cast<float>(core::BFloat16(NAN))));
+
+    for (core::Dtype dtype : {core::Dtype::Float16, core::Dtype::BFloat16}) {
+        core::Tensor src_t = core::Tensor::Init<float>(
+                {{0, 1, 2}, {-3, 4, 5.5}}, device);
+        core::Tensor t = src_t.To(dtype);
+        EXPECT_EQ(t.GetDtype(), dtype);
+        EXPECT_EQ(t.GetDtype().ByteSize(), 2);
+        EXPECT_TRUE(t.To(core::Dtype::Float32).AllClose(src_t));
+        EXPECT_TRUE(t.To(core::Dtype::Int32).AllClose(
+                src_t.To(core::Dtype::Int32)));
+
+        // Element-wise ops.
+        EXPECT_TRUE((t + t).To(core::Dtype::Float32).AllClose(src_t * 2));
+        EXPECT_TRUE((t * t - t).To(core::Dtype::Float32)
+                            .AllClose(src_t * src_t - src_t));
+        EXPECT_TRUE((t / 2).To(core::Dtype::Float32).AllClose(src_t / 2));
+        EXPECT_TRUE(t.Neg().To(core::Dtype::Float32).AllClose(src_t.Neg()));
+        EXPECT_TRUE(t.Abs().Sqrt().To(core::Dtype::Float32).AllClose(
+                src_t.Abs().Sqrt(), 1e-2));
+        EXPECT_EQ(t.Gt(1.5).ToFlatVector<bool>(),
+                  std::vector<bool>({false, false, true, false, true, true}));
+        EXPECT_FALSE(t.IsNan().Any());
+
+        // Reductions accumulate in float.
+        EXPECT_EQ(t.Sum({0, 1}).To(core::Dtype::Float32).Item<float>(), 9.5);
+        EXPECT_EQ(t.Max({1}).To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({2, 5.5}));
+        EXPECT_EQ(t.ArgMin({0, 1}).Item<int64_t>(), 3);
+        core::Tensor ones = core::Tensor::Ones({4096}, dtype, device);
+        EXPECT_EQ(ones.Sum({0}).To(core::Dtype::Float32).Item<float>(), 4096);
+
+        // Indexing.
+        core::Tensor t_row = t.IndexGet(
+                {core::Tensor::Init<int64_t>({1}, device)});
+        EXPECT_TRUE(t_row.To(core::Dtype::Float32)
+                            .AllClose(src_t.Slice(0, 1, 2)));
+    }
+
+    core::Tensor h = core::Tensor::Full({}, 0.5, core::Dtype::Float16, device);
+    EXPECT_EQ(static_cast<float>(h.Item<core::Half>()), 0.5f);
+    EXPECT_NE(h.ToString().find("Float16"), std::string::npos);
+    EXPECT_NE(h.ToString().find("0.5"), std::string::npos);
+}
+
+TEST_P(TensorPermuteDevicePairs, ToAsync) {
+    core::Device dst_device;
+    core::Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    core::CUDAStream stream;
+    if (dst_device.GetType() == core::Device::DeviceType::CUDA) {
+        stream = core::CUDAStream(dst_device);
+    } else if (src_device.GetType() == core::Device::DeviceType::CUDA) {
+        stream = core::CUDAStream(src_device);
+    }
+
+    core::Tensor src_t = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}}, src_device);
+    core::Tensor dst_t = src_t.To(dst_device, stream, /*copy=*/true);
+    stream.Synchronize();
+    EXPECT_EQ(dst_t.GetDevice(), dst_device);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    // Non-contiguous source.
+    core::Tensor src_t_t = src_t.T();
+    core::Tensor dst_t_t = src_t_t.To(dst_device, stream, /*copy=*/true);
+    stream.Synchronize();
+    EXPECT_EQ(dst_t_t.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dst_t_t.ToFlatVector<float>(),
+              std::vector<float>({0, 3, 1, 4, 2, 5}));
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     core::Device dst_device;
     core::Device src_device;
@@ -1115,6 +1205,83 @@ TEST_P(TensorPermuteDevicePairs, IndexSetBroadcast) {
                                   0, 0, 0, 0, 20, 20, 20, 0, 0, 0, 0, 0}));
 }
 
+TEST_P(TensorPermuteDevicePairs, IndexGetRows) {
+    core::Device idx_device;
+    core::Device src_device;
+    std::tie(idx_device, src_device) = GetParam();
+
+    core::Tensor t = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, src_device);
+
+    // t[[2, -1, 0, 2]]
+    core::Tensor idx(std::vector<int64_t>({2, -1, 0, 2}), {4},
+                     core::Dtype::Int64, idx_device);
+    core::Tensor t_1 = t.IndexGet({idx});
+    EXPECT_EQ(t_1.GetShape(), core::SizeVector({4, 3}));
+    EXPECT_EQ(t_1.GetDevice(), src_device);
+    EXPECT_EQ(t_1.ToFlatVector<float>(),
+              std::vector<float>({6, 7, 8, 9, 10, 11, 0, 1, 2, 6, 7, 8}));
+
+    // t[[True, False, False, True]]
+    core::Tensor mask(std::vector<bool>({true, false, false, true}), {4},
+                      core::Dtype::Bool, idx_device);
+    core::Tensor t_2 = t.IndexGet({mask});
+    EXPECT_EQ(t_2.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(t_2.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 9, 10, 11}));
+
+    // Non-contiguous tensors take the general path.
+    core::Tensor t_3 = t.T().IndexGet({idx.Slice(0, 0, 2)});
+    EXPECT_EQ(t_3.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(t_3.ToFlatVector<float>(),
+              std::vector<float>({2, 5, 8, 11, 2, 5, 8, 11}));
+}
+
+TEST_P(TensorPermuteDevicePairs, IndexSetRows) {
+    core::Device dst_device;
+    core::Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    core::Tensor dst_t =
+            core::Tensor::Zeros({4, 2}, core::Dtype::Int32, dst_device);
+    core::Tensor src_t =
+            core::Tensor::Init<int32_t>({{1, 2}, {3, 4}}, src_device);
+    core::Tensor idx(std::vector<int64_t>({-1, 1}), {2}, core::Dtype::Int64,
+                     src_device);
+
+    dst_t.IndexSet({idx}, src_t);
+    EXPECT_EQ(dst_t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 0, 3, 4, 0, 0, 1, 2}));
+}
+
+TEST_P(TensorPermuteDevices, IndexAdd_) {
+    core::Device device = GetParam();
+
+    core::Tensor idx = core::Tensor::Init<int64_t>({2, 0, 2, -4}, device);
+    core::Tensor src =
+            core::Tensor::Init<float>({{1, 2}, {3, 4}, {5, 6}, {7, 8}}, device);
+
+    core::Tensor dst = core::Tensor::Ones({4, 2}, core::Dtype::Float32, device);
+    dst.IndexAdd_(0, idx, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({11, 13, 1, 1, 7, 9, 1, 1}));
+
+    // Accumulate along the last dim.
+    core::Tensor dst_t =
+            core::Tensor::Zeros({2, 4}, core::Dtype::Float32, device);
+    dst_t.IndexAdd_(1, idx, src.T());
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({10, 0, 6, 0, 12, 0, 8, 0}));
+
+    core::Tensor counts = core::Tensor::Zeros({3}, core::Dtype::Int64, device);
+    counts.IndexAdd_(0, idx.Slice(0, 0, 3),
+                     core::Tensor::Ones({3}, core::Dtype::Int64, device));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 0, 2}));
+
+    EXPECT_ANY_THROW(dst.IndexAdd_(0, idx, src.To(core::Dtype::Float64)));
+    EXPECT_ANY_THROW(dst.IndexAdd_(0, idx.Slice(0, 0, 2), src));
+}
+
 TEST_P(TensorPermuteDevices, Permute) {
     core::Device device = GetParam();
 
@@ -1277,6 +1444,38 @@ TEST_P(TensorPermuteDevices, Add_) {
               std::vector<float>({10, 12, 14, 16, 18, 20}));
 }
 
+TEST_P(TensorPermuteDevices, BinaryEWRowBroadcast) {
+    core::Device device = GetParam();
+
+    // Row lengths 3 and 5 with enough rows to span several tiles of the
+    // vectorized CPU kernel and a remainder.
+    for (int64_t row_size : {3, 5}) {
+        int64_t num_rows = 101;
+        std::vector<float> full_vals(num_rows * row_size);
+        std::vector<float> row_vals(row_size);
+        for (size_t i = 0; i < full_vals.size(); ++i) {
+            full_vals[i] = static_cast<float>(i);
+        }
+        for (int64_t j = 0; j < row_size; ++j) {
+            row_vals[j] = static_cast<float>(j * 10 + 1);
+        }
+        core::Tensor full(full_vals, {num_rows, row_size},
+                          core::Dtype::Float32, device);
+        core::Tensor row(row_vals, {row_size}, core::Dtype::Float32, device);
+
+        std::vector<float> sub_vals(full_vals.size());
+        std::vector<float> div_vals(full_vals.size());
+        for (size_t i = 0; i < full_vals.size(); ++i) {
+            sub_vals[i] = full_vals[i] - row_vals[i % row_size];
+            div_vals[i] = row_vals[i % row_size] / full_vals[i];
+        }
+        EXPECT_EQ((full - row).ToFlatVector<float>(), sub_vals);
+        EXPECT_EQ((row / full).ToFlatVector<float>(), div_vals);
+        EXPECT_EQ((full - row.Reshape({1, row_size})).ToFlatVector<float>(),
+                  sub_vals);
+    }
+}
+
 TEST_P(TensorPermuteDevices, Add_BroadcastException) {
     // A.shape = (   3, 4)
     // B.shape = (2, 3, 4)
@@ -1297,6 +1496,39 @@ TEST_P(TensorPermuteDevices, Add_BroadcastException) {
                                   20, 22, 24, 26, 28, 30, 32, 34}));
 }
 
+TEST_P(TensorPermuteDevices, BinaryUnaryEWLargeArray) {
+    core::Device device = GetParam();
+
+    int64_t size = 100003;
+    std::vector<float> lhs_vals(size);
+    std::vector<float> rhs_vals(size);
+    for (int64_t i = 0; i < size; ++i) {
+        lhs_vals[i] = static_cast<float>(utility::UniformRandInt(-100, 100));
+        rhs_vals[i] = static_cast<float>(utility::UniformRandInt(1, 100));
+    }
+    core::Tensor lhs(lhs_vals, {size}, core::Dtype::Float32, device);
+    core::Tensor rhs(rhs_vals, {size}, core::Dtype::Float32, device);
+
+    std::vector<float> ref_add(size), ref_div(size), ref_sub_scalar(size),
+            ref_neg(size), ref_abs(size);
+    for (int64_t i = 0; i < size; ++i) {
+        ref_add[i] = lhs_vals[i] + rhs_vals[i];
+        ref_div[i] = lhs_vals[i] / rhs_vals[i];
+        ref_sub_scalar[i] = lhs_vals[i] - 2.f;
+        ref_neg[i] = -lhs_vals[i];
+        ref_abs[i] = std::abs(lhs_vals[i]);
+    }
+    EXPECT_EQ((lhs + rhs).ToFlatVector<float>(), ref_add);
+    EXPECT_EQ((lhs / rhs).ToFlatVector<float>(), ref_div);
+    EXPECT_EQ((lhs - 2.f).ToFlatVector<float>(), ref_sub_scalar);
+    EXPECT_EQ(lhs.Neg().ToFlatVector<float>(), ref_neg);
+    EXPECT_EQ(lhs.Abs().ToFlatVector<float>(), ref_abs);
+
+    // In-place.
+    lhs.Add_(rhs);
+    EXPECT_EQ(lhs.ToFlatVector<float>(), ref_add);
+}
+
 TEST_P(TensorPermuteDevices, Sub) {
     core::Device device = GetParam();
     core::Tensor a =
@@ -1891,6 +2123,86 @@ TEST_P(TensorPermuteDevices, ReduceMaxFloatLimit) {
     EXPECT_EQ(dst.ToFlatVector<int64_t>(), std::vector<int64_t>({1}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceMinMax) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>({{{22.f, 23.f, 20.f, 9.f},
+                                                   {6.f, 14.f, 18.f, 13.f},
+                                                   {15.f, 3.f, 17.f, 0.f}},
+                                                  {{7.f, 21.f, 11.f, 1.f},
+                                                   {4.f, 2.f, 10.f, 19.f},
+                                                   {5.f, 8.f, 16.f, 12.f}}},
+                                                 device);
+
+    for (const core::SizeVector& dims :
+         std::vector<core::SizeVector>{{}, {0}, {1}, {2}, {0, 2}, {2, 0},
+                                       {0, 1, 2}}) {
+        for (bool keepdim : {false, true}) {
+            core::Tensor min, max;
+            std::tie(min, max) = src.MinMax(dims, keepdim);
+            core::Tensor ref_min = src.Min(dims, keepdim);
+            core::Tensor ref_max = src.Max(dims, keepdim);
+            EXPECT_EQ(min.GetShape(), ref_min.GetShape());
+            EXPECT_EQ(max.GetShape(), ref_max.GetShape());
+            EXPECT_EQ(min.ToFlatVector<float>(), ref_min.ToFlatVector<float>());
+            EXPECT_EQ(max.ToFlatVector<float>(), ref_max.ToFlatVector<float>());
+        }
+    }
+
+    core::Tensor src_int = core::Tensor::Init<int32_t>({-2, 5, 3}, device);
+    core::Tensor min, max;
+    std::tie(min, max) = src_int.MinMax({0});
+    EXPECT_EQ(min.ToFlatVector<int32_t>(), std::vector<int32_t>({-2}));
+    EXPECT_EQ(max.ToFlatVector<int32_t>(), std::vector<int32_t>({5}));
+
+    std::tie(min, max) = src.To(core::Dtype::Float16).MinMax({0, 1});
+    EXPECT_EQ(min.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(min.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({4.f, 2.f, 10.f, 0.f}));
+    EXPECT_EQ(max.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({22.f, 23.f, 20.f, 19.f}));
+
+    EXPECT_ANY_THROW(core::Tensor({0, 3}, core::Dtype::Float32, device)
+                             .MinMax({0}));
+}
+
+TEST_P(TensorPermuteDevices, MeanAndCovariance) {
+    core::Device device = GetParam();
+    // A large offset checks that the accumulation does not cancel out.
+    core::Tensor src =
+            core::Tensor::Init<double>({{1.0, 2.0, 0.5},
+                                        {3.0, -1.0, 1.5},
+                                        {-2.0, 0.0, 2.5},
+                                        {4.0, 3.0, -0.5},
+                                        {0.0, 1.0, 1.0}},
+                                       device) +
+            1e6;
+    core::Tensor ref_mean = src.Mean({0});
+    core::Tensor centered = src - ref_mean;
+    core::Tensor ref_covariance =
+            (centered.Reshape({5, 3, 1}) * centered.Reshape({5, 1, 3}))
+                    .Mean({0});
+
+    core::Tensor mean, covariance;
+    std::tie(mean, covariance) = src.MeanAndCovariance();
+    EXPECT_EQ(mean.GetShape(), core::SizeVector({3}));
+    EXPECT_EQ(covariance.GetShape(), core::SizeVector({3, 3}));
+    EXPECT_TRUE(mean.AllClose(ref_mean));
+    EXPECT_TRUE(covariance.AllClose(ref_covariance, 1e-7, 1e-7));
+    EXPECT_TRUE(covariance.AllClose(covariance.T()));
+
+    std::tie(mean, covariance) =
+            src.To(core::Dtype::Float32).MeanAndCovariance();
+    EXPECT_TRUE(mean.AllClose(ref_mean.To(core::Dtype::Float32)));
+    EXPECT_TRUE(covariance.AllClose(ref_covariance.To(core::Dtype::Float32),
+                                    1e-2, 1e-2));
+
+    EXPECT_ANY_THROW(
+            core::Tensor::Ones({3, 2}, core::Dtype::Int32, device)
+                    .MeanAndCovariance());
+    EXPECT_ANY_THROW(core::Tensor::Ones({3}, core::Dtype::Float32, device)
+                             .MeanAndCovariance());
+}
+
 TEST_P(TensorPermuteDevices, ReduceArgMin) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>(
@@ -1919,6 +2231,42 @@ TEST_P(TensorPermuteDevices, ReduceArgMin) {
               std::vector<int64_t>({3, 0, 3, 3, 1, 0}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceArgMinMaxLargeArray) {
+    core::Device device = GetParam();
+
+    // Many duplicated values, so the first index of the extremum matters.
+    int64_t num_rows = 7;
+    int64_t num_cols = 100003;
+    std::vector<float> vals(num_rows * num_cols);
+    std::transform(vals.begin(), vals.end(), vals.begin(), [](float x) {
+        return static_cast<float>(utility::UniformRandInt(0, 100));
+    });
+    core::Tensor src(vals, {num_rows, num_cols}, core::Dtype::Float32, device);
+
+    // Full reduction.
+    int64_t ref_argmin =
+            std::min_element(vals.begin(), vals.end()) - vals.begin();
+    int64_t ref_argmax =
+            std::max_element(vals.begin(), vals.end()) - vals.begin();
+    EXPECT_EQ(src.ArgMin({0, 1}).Item<int64_t>(), ref_argmin);
+    EXPECT_EQ(src.ArgMax({0, 1}).Item<int64_t>(), ref_argmax);
+    EXPECT_EQ(src.Min({0, 1}).Item<float>(), vals[ref_argmin]);
+    EXPECT_EQ(src.Max({0, 1}).Item<float>(), vals[ref_argmax]);
+
+    // Row-wise reduction.
+    std::vector<int64_t> ref_row_argmax;
+    std::vector<float> ref_row_min;
+    for (int64_t row = 0; row < num_rows; ++row) {
+        auto begin = vals.begin() + row * num_cols;
+        auto end = begin + num_cols;
+        ref_row_argmax.push_back(std::max_element(begin, end) - begin);
+        ref_row_min.push_back(*std::min_element(begin, end));
+    }
+    EXPECT_EQ(src.ArgMax({1}).ToFlatVector<int64_t>(), ref_row_argmax);
+    EXPECT_EQ(src.Min({1}).ToFlatVector<float>(), ref_row_min);
+    EXPECT_EQ(src.Min({1}, true).GetShape(), core::SizeVector({num_rows, 1}));
+}
+
 TEST_P(TensorPermuteDevices, ReduceArgMax) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>(
@@ -2449,6 +2797,62 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), core::SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{3, 1, 2}, {0, 5, 4}}, device);
+    EXPECT_EQ(a.Sort().ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 0, 4, 5}));
+    EXPECT_EQ(a.Sort(0).ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 5, 4}));
+    EXPECT_EQ(a.Sort(1, true).ToFlatVector<float>(),
+              std::vector<float>({3, 2, 1, 5, 4, 0}));
+    EXPECT_EQ(a.Sort().GetShape(), core::SizeVector({2, 3}));
+
+    // Ties keep their original order in both directions.
+    core::Tensor b = core::Tensor::Init<int32_t>({2, 1, 2, 1, 3}, device);
+    EXPECT_EQ(b.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 0, 2, 4}));
+    EXPECT_EQ(b.ArgSort(0, true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({4, 0, 2, 1, 3}));
+}
+
+TEST_P(TensorPermuteDevices, TopK) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{3, 1, 2}, {0, 5, 4}}, device);
+    core::Tensor values, indices;
+    std::tie(values, indices) = a.TopK(2);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({3, 2, 5, 4}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 1, 2}));
+
+    std::tie(values, indices) = a.TopK(1, 0, false);
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({0, 1, 2}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, 0}));
+
+    EXPECT_ANY_THROW(a.TopK(4));
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor a =
+            core::Tensor::Init<int64_t>({{3, 1, 3}, {2, 1, 3}}, device);
+    EXPECT_EQ(a.Unique().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 3}));
+
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = a.UniqueWithInverseAndCounts();
+    EXPECT_EQ(unique.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2, 3}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0, 2}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 3}));
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     core::Device device = GetParam();
 
@@ -2839,6 +3243,60 @@ TEST_P(TensorPermuteDevices, NumpyIO) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(TensorPermuteDevices, NumpyIOMmap) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Init<float>(
+            {{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}}, device);
+    t.Save(file_name);
+
+    // Read-only mapping: slices view the mapped file, writes stay private.
+    {
+        core::Tensor t_mmap = core::Tensor::LoadMmap(file_name);
+        EXPECT_EQ(t_mmap.GetDevice(), core::Device("CPU:0"));
+        EXPECT_TRUE(t_mmap.AllClose(t.To(core::Device("CPU:0"))));
+        core::Tensor row = t_mmap.Slice(0, 1, 2);
+        EXPECT_EQ(row.ToFlatVector<float>(), std::vector<float>({4, 5, 6, 7}));
+        row.Fill(0);
+        EXPECT_EQ(t_mmap[1][2].Item<float>(), 0);
+    }
+    EXPECT_TRUE(core::Tensor::Load(file_name).AllClose(
+            t.To(core::Device("CPU:0"))));
+
+    // Writable mapping: writes are stored in the file.
+    {
+        core::Tensor t_mmap = core::Tensor::LoadMmap(file_name, true);
+        t_mmap.Slice(0, 2, 3).Fill(-1);
+    }
+    EXPECT_EQ(core::Tensor::Load(file_name).ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, -1, -1, -1, -1}));
+
+    // Create a file and write it through the mapping.
+    {
+        core::Tensor t_mmap =
+                core::Tensor::EmptyMmap(file_name, {2, 3}, core::Dtype::Int32);
+        t_mmap.CopyFrom(core::Tensor::Init<int32_t>({{1, 2, 3}, {4, 5, 6}},
+                                                    device)
+                                .To(core::Device("CPU:0")));
+    }
+    core::Tensor t_load = core::Tensor::Load(file_name);
+    EXPECT_EQ(t_load.GetDtype(), core::Dtype::Int32);
+    EXPECT_EQ(t_load.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(t_load.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3, 4, 5, 6}));
+
+    // {0} tensor.
+    core::Tensor::EmptyMmap(file_name, {0}, core::Dtype::Float32);
+    EXPECT_EQ(core::Tensor::LoadMmap(file_name).GetShape(),
+              core::SizeVector({0}));
+
+    EXPECT_ANY_THROW(core::Tensor::LoadMmap("does_not_exist.npy"));
+
+    // Clean up.
+    utility::filesystem::RemoveFile(file_name);
+}
+
 TEST_P(TensorPermuteDevices, RValueScalar) {
     const core::Device &device = GetParam();
     core::Tensor t, t_ref;
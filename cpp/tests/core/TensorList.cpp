@@ -440,5 +440,178 @@ TEST_P(TensorListPermuteDevices, Clear) {
     EXPECT_ANY_THROW(tl_inplace.Clear());
 }
 
+TEST_P(TensorListPermuteDevices, Chunked) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    EXPECT_ANY_THROW(core::TensorList::Chunked({2, 3}, dtype, device, 0));
+
+    core::TensorList tl = core::TensorList::Chunked({2, 3}, dtype, device, 4);
+    EXPECT_TRUE(tl.IsChunked());
+    EXPECT_EQ(tl.GetChunkSize(), 4);
+    EXPECT_EQ(tl.GetSize(), 0);
+    EXPECT_EQ(tl.GetReservedSize(), 4);
+
+    // There is no single internal tensor.
+    EXPECT_ANY_THROW(tl.GetInternalTensor());
+
+    // Growing only appends chunks, the first chunk is never reallocated.
+    tl.PushBack(core::Tensor::Full({2, 3}, 0, dtype, device));
+    const void* first_chunk_ptr = tl[0].GetDataPtr();
+    for (int i = 1; i < 10; ++i) {
+        tl.PushBack(core::Tensor::Full({2, 3}, i, dtype, device));
+    }
+    EXPECT_EQ(tl.GetSize(), 10);
+    EXPECT_EQ(tl.GetReservedSize(), 12);
+    EXPECT_EQ(tl[0].GetDataPtr(), first_chunk_ptr);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(
+                tl[i].AllClose(core::Tensor::Full({2, 3}, i, dtype, device)));
+    }
+    EXPECT_TRUE(tl[-1].AllClose(core::Tensor::Full({2, 3}, 9, dtype, device)));
+
+    // AsTensor() materializes the chunks.
+    core::Tensor t = tl.AsTensor();
+    EXPECT_EQ(t.GetShape(), core::SizeVector({10, 2, 3}));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(t[i].AllClose(tl[i]));
+    }
+
+    // Contiguous() converts to a regular tensorlist.
+    core::TensorList tl_contiguous = tl.Contiguous();
+    EXPECT_FALSE(tl_contiguous.IsChunked());
+    EXPECT_EQ(tl_contiguous.GetSize(), 10);
+    EXPECT_EQ(tl_contiguous.GetInternalTensor().GetShape(0), 10);
+    EXPECT_TRUE(tl_contiguous.AsTensor().AllClose(t));
+
+    // Extend with a regular tensorlist and with itself.
+    tl.Extend(tl_contiguous);
+    EXPECT_EQ(tl.GetSize(), 20);
+    tl.Extend(tl);
+    EXPECT_EQ(tl.GetSize(), 40);
+    EXPECT_EQ(tl[0].GetDataPtr(), first_chunk_ptr);
+    for (int i = 0; i < 40; ++i) {
+        EXPECT_TRUE(tl[i].AllClose(
+                core::Tensor::Full({2, 3}, i % 10, dtype, device)));
+    }
+
+    // Resize zero-fills across chunks.
+    tl.Resize(5);
+    tl.Resize(11);
+    EXPECT_TRUE(tl[4].AllClose(core::Tensor::Full({2, 3}, 4, dtype, device)));
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 5, 11).AllClose(
+            core::Tensor::Zeros({6, 2, 3}, dtype, device)));
+
+    // Clone() deep copies the chunks.
+    core::TensorList tl_clone = tl.Clone();
+    EXPECT_TRUE(tl_clone.IsChunked());
+    tl_clone[0] = core::Tensor::Full({2, 3}, 7, dtype, device);
+    EXPECT_TRUE(tl[0].AllClose(core::Tensor::Zeros({2, 3}, dtype, device)));
+
+    // Clear() keeps the chunked mode.
+    tl.Clear();
+    EXPECT_TRUE(tl.IsChunked());
+    EXPECT_EQ(tl.GetSize(), 0);
+    EXPECT_EQ(tl.GetReservedSize(), 4);
+}
+
+TEST_P(TensorListPermuteDevices, ChunkedExtendSelf) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    // 6 tensors in chunks of 4, extended onto itself into a third chunk.
+    core::TensorList tl = core::TensorList::Chunked({3}, dtype, device, 4);
+    for (int i = 0; i < 6; ++i) {
+        tl.PushBack(core::Tensor::Full({3}, i, dtype, device));
+    }
+    const void* first_chunk_ptr = tl[0].GetDataPtr();
+    tl.Extend(tl);
+    EXPECT_TRUE(tl.IsChunked());
+    EXPECT_EQ(tl.GetSize(), 12);
+    EXPECT_EQ(tl.GetReservedSize(), 12);
+    EXPECT_EQ(tl[0].GetDataPtr(), first_chunk_ptr);
+    for (int i = 0; i < 12; ++i) {
+        EXPECT_TRUE(
+                tl[i].AllClose(core::Tensor::Full({3}, i % 6, dtype, device)));
+    }
+
+    // The operator form extends onto itself the same way.
+    tl += tl;
+    EXPECT_EQ(tl.GetSize(), 24);
+    for (int i = 0; i < 24; ++i) {
+        EXPECT_TRUE(
+                tl[i].AllClose(core::Tensor::Full({3}, i % 6, dtype, device)));
+    }
+}
+
+TEST_P(TensorListPermuteDevices, ChunkedResize) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::TensorList tl = core::TensorList::Chunked({3}, dtype, device, 4);
+    for (int i = 0; i < 3; ++i) {
+        tl.PushBack(core::Tensor::Full({3}, i + 1, dtype, device));
+    }
+
+    // Growing across two chunk boundaries zero-fills the new tensors.
+    tl.Resize(9);
+    EXPECT_EQ(tl.GetSize(), 9);
+    EXPECT_EQ(tl.GetReservedSize(), 12);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(
+                tl[i].AllClose(core::Tensor::Full({3}, i + 1, dtype, device)));
+    }
+    for (int i = 3; i < 9; ++i) {
+        EXPECT_TRUE(tl[i].AllClose(core::Tensor::Zeros({3}, dtype, device)));
+    }
+
+    // Shrinking keeps the chunks, growing again clears the reused tensors on
+    // both sides of the chunk boundary.
+    for (int i = 0; i < 9; ++i) {
+        tl[i] = core::Tensor::Full({3}, 5, dtype, device);
+    }
+    tl.Resize(2);
+    EXPECT_EQ(tl.GetSize(), 2);
+    EXPECT_EQ(tl.GetReservedSize(), 12);
+    tl.Resize(6);
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 0, 2).AllClose(
+            core::Tensor::Full({2, 3}, 5, dtype, device)));
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 2, 6).AllClose(
+            core::Tensor::Zeros({4, 3}, dtype, device)));
+}
+
+TEST_P(TensorListPermuteDevices, ChunkedClone) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    // 10 tensors span 3 chunks of 4.
+    core::TensorList tl = core::TensorList::Chunked({3}, dtype, device, 4);
+    for (int i = 0; i < 10; ++i) {
+        tl.PushBack(core::Tensor::Full({3}, i, dtype, device));
+    }
+
+    core::TensorList tl_clone = tl.Clone();
+    EXPECT_TRUE(tl_clone.IsChunked());
+    EXPECT_EQ(tl_clone.GetChunkSize(), 4);
+    EXPECT_EQ(tl_clone.GetSize(), 10);
+    EXPECT_TRUE(tl_clone.AsTensor().AllClose(tl.AsTensor()));
+
+    // Every chunk is copied.
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_NE(tl_clone[i].GetDataPtr(), tl[i].GetDataPtr());
+    }
+    for (int i = 0; i < 10; ++i) {
+        tl_clone[i] = core::Tensor::Full({3}, -1, dtype, device);
+    }
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(tl[i].AllClose(core::Tensor::Full({3}, i, dtype, device)));
+    }
+
+    // The clone grows independently.
+    tl_clone.PushBack(core::Tensor::Full({3}, 10, dtype, device));
+    EXPECT_EQ(tl_clone.GetSize(), 11);
+    EXPECT_EQ(tl.GetSize(), 10);
+}
+
 }  // namespace tests
 }  // namespace open3d
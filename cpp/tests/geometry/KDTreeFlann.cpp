@@ -72,6 +72,51 @@ TEST(KDTreeFlann, SearchKNN) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchKNNBatch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    std::vector<Eigen::Vector3d> query_points(20);
+    Rand(query_points, vmin, vmax, 1);
+    Eigen::MatrixXd queries(3, query_points.size());
+    for (size_t i = 0; i < query_points.size(); i++) {
+        queries.col(i) = query_points[i];
+    }
+
+    int knn = 10;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    EXPECT_EQ(kdtree.SearchKNNBatch(queries, knn, indices, distance2), knn);
+    EXPECT_EQ(indices.size(), query_points.size() * knn);
+    EXPECT_EQ(distance2.size(), query_points.size() * knn);
+
+    for (size_t i = 0; i < query_points.size(); i++) {
+        std::vector<int> ref_indices;
+        std::vector<double> ref_distance2;
+        kdtree.SearchKNN(query_points[i], knn, ref_indices, ref_distance2);
+        ExpectEQ(ref_indices,
+                 std::vector<int>(indices.begin() + i * knn,
+                                  indices.begin() + (i + 1) * knn));
+        ExpectEQ(ref_distance2,
+                 std::vector<double>(distance2.begin() + i * knn,
+                                     distance2.begin() + (i + 1) * knn));
+    }
+
+    // knn is clamped to the dataset size.
+    EXPECT_EQ(kdtree.SearchKNNBatch(queries, 2 * size, indices, distance2),
+              size);
+    EXPECT_EQ(indices.size(), query_points.size() * size);
+}
+
 TEST(KDTreeFlann, SearchRadius) {
     std::vector<int> ref_indices = {27, 48, 4,  77, 90, 7, 54, 17, 76, 38, 39,
                                     60, 15, 84, 11, 57, 3, 32, 99, 36, 52};
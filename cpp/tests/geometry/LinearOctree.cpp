@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static geometry::PointCloud CreateRandomPointCloud(size_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -2, -3), Eigen::Vector3d(3, 2, 1), 0);
+    Rand(pcd.colors_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 1);
+    return pcd;
+}
+
+TEST(LinearOctree, MatchesInsertion) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    for (size_t max_depth : {0, 1, 4}) {
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+        // Reference tree built by inserting the points one at a time.
+        geometry::Octree octree(max_depth, linear_octree.origin_,
+                                linear_octree.size_);
+        for (size_t idx = 0; idx < pcd.points_.size(); idx++) {
+            octree.InsertPoint(
+                    pcd.points_[idx],
+                    geometry::OctreePointColorLeafNode::GetInitFunction(),
+                    geometry::OctreePointColorLeafNode::GetUpdateFunction(
+                            idx, pcd.colors_[idx]),
+                    geometry::OctreeInternalPointNode::GetInitFunction(),
+                    geometry::OctreeInternalPointNode::GetUpdateFunction(idx));
+        }
+        EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+
+        geometry::Octree converted(max_depth);
+        converted.ConvertFromPointCloud(pcd, 0.01);
+        EXPECT_TRUE(converted == octree);
+    }
+}
+
+TEST(LinearOctree, Nodes) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0, 0, 0}, {1, 1, 1}, {0.1, 0.1, 0.1}};
+    geometry::LinearOctree linear_octree(1);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    // Root and the two opposite corner children.
+    ASSERT_EQ(linear_octree.nodes_.size(), 3);
+    const geometry::LinearOctree::Node &root = linear_octree.nodes_[0];
+    EXPECT_FALSE(root.IsLeaf());
+    EXPECT_EQ(root.child_mask_, 0x81);
+    EXPECT_EQ(root.GetChild(0), 1);
+    EXPECT_EQ(root.GetChild(1), -1);
+    EXPECT_EQ(root.GetChild(7), 2);
+    EXPECT_EQ(root.end_ - root.begin_, 3);
+
+    const geometry::LinearOctree::Node &leaf = linear_octree.nodes_[2];
+    EXPECT_TRUE(leaf.IsLeaf());
+    EXPECT_EQ(leaf.key_, 7);
+    EXPECT_EQ(leaf.depth_, 1);
+    EXPECT_EQ(linear_octree.GetNodeSize(leaf), linear_octree.size_ / 2);
+    Eigen::Vector3d leaf_origin =
+            linear_octree.origin_ +
+            Eigen::Vector3d::Constant(linear_octree.size_ / 2);
+    ExpectEQ(linear_octree.GetNodeOrigin(leaf), leaf_origin);
+    EXPECT_EQ(std::vector<size_t>(
+                      linear_octree.point_indices_.begin() + leaf.begin_,
+                      linear_octree.point_indices_.begin() + leaf.end_),
+              std::vector<size_t>({1}));
+}
+
+TEST(LinearOctree, LocateLeafNodes) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    size_t max_depth = 5;
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::vector<Eigen::Vector3d> queries(pcd.points_.begin(),
+                                         pcd.points_.begin() + 100);
+    queries.push_back(Eigen::Vector3d(100, 100, 100));
+    std::vector<int64_t> leaf_indices = linear_octree.LocateLeafNodes(queries);
+    ASSERT_EQ(leaf_indices.size(), queries.size());
+
+    for (size_t i = 0; i < 100; i++) {
+        ASSERT_GE(leaf_indices[i], 0);
+        const geometry::LinearOctree::Node &leaf =
+                linear_octree.nodes_[leaf_indices[i]];
+        EXPECT_TRUE(leaf.IsLeaf());
+        EXPECT_EQ(leaf.depth_, max_depth);
+        EXPECT_TRUE(geometry::Octree::IsPointInBound(
+                queries[i], linear_octree.GetNodeOrigin(leaf),
+                linear_octree.GetNodeSize(leaf)));
+        EXPECT_NE(std::find(linear_octree.point_indices_.begin() + leaf.begin_,
+                            linear_octree.point_indices_.begin() + leaf.end_,
+                            i),
+                  linear_octree.point_indices_.begin() + leaf.end_);
+    }
+    EXPECT_EQ(leaf_indices.back(), -1);
+}
+
+}  // namespace tests
+}  // namespace open3d
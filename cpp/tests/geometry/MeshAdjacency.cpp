@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/MeshAdjacency.h"
+
+#include <vector>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(MeshAdjacency, Box) {
+    auto box = geometry::TriangleMesh::CreateBox();
+    geometry::MeshAdjacency adjacency(box->triangles_, box->vertices_.size());
+    EXPECT_EQ(adjacency.NumHalfEdges(), 36u);
+    EXPECT_EQ(adjacency.NumEdges(), 18u);
+    EXPECT_EQ(adjacency.NumVertices(), 8u);
+
+    for (int edge = 0; edge < int(adjacency.NumEdges()); ++edge) {
+        const Eigen::Vector2i &vertices = adjacency.GetEdge(edge);
+        EXPECT_LT(vertices(0), vertices(1));
+        EXPECT_EQ(adjacency.EdgeDegree(edge), 2);
+        for (const int *it = adjacency.EdgeHalfEdgesBegin(edge);
+             it != adjacency.EdgeHalfEdgesEnd(edge); ++it) {
+            EXPECT_EQ(adjacency.HalfEdgeEdge(*it), edge);
+            EXPECT_EQ(geometry::TriangleMesh::GetOrderedEdge(
+                              adjacency.HalfEdgeSource(*it),
+                              adjacency.HalfEdgeTarget(*it)),
+                      vertices);
+        }
+    }
+
+    int num_half_edges = 0;
+    for (int vertex = 0; vertex < int(adjacency.NumVertices()); ++vertex) {
+        for (const int *it = adjacency.VertexHalfEdgesBegin(vertex);
+             it != adjacency.VertexHalfEdgesEnd(vertex); ++it) {
+            EXPECT_EQ(adjacency.HalfEdgeSource(*it), vertex);
+            num_half_edges++;
+        }
+        EXPECT_TRUE(adjacency.IsVertexManifold(vertex));
+    }
+    EXPECT_EQ(num_half_edges, 36);
+
+    // Vertex 0 is connected to the other corners of its three faces.
+    box->ComputeAdjacencyList();
+    std::vector<int> neighbors = adjacency.GetVertexNeighbors(0);
+    EXPECT_EQ(neighbors.size(), box->adjacency_list_[0].size());
+    for (int neighbor : neighbors) {
+        EXPECT_EQ(box->adjacency_list_[0].count(neighbor), 1u);
+    }
+}
+
+TEST(MeshAdjacency, NonManifoldVertex) {
+    // Two triangles sharing only vertex 0.
+    std::vector<Eigen::Vector3i> triangles = {{0, 1, 2}, {0, 3, 4}};
+    geometry::MeshAdjacency adjacency(triangles, 5);
+    EXPECT_FALSE(adjacency.IsVertexManifold(0));
+    EXPECT_TRUE(adjacency.IsVertexManifold(1));
+    EXPECT_EQ(adjacency.GetVertexNeighbors(0), std::vector<int>({1, 2, 3, 4}));
+    EXPECT_EQ(geometry::MeshAdjacency::NextHalfEdge(5), 3);
+    EXPECT_EQ(geometry::MeshAdjacency::PrevHalfEdge(3), 5);
+
+    EXPECT_ANY_THROW(geometry::MeshAdjacency(triangles, 4));
+}
+
+}  // namespace tests
+}  // namespace open3d
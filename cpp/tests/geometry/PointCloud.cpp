@@ -31,6 +31,7 @@
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/Image.h"
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/ImageIO.h"
@@ -193,6 +194,39 @@ TEST(PointCloud, GetOrientedBoundingBox) {
                                                 {3, 2, 1}})));
 }
 
+TEST(PointCloud, DerivedDataCache) {
+    geometry::PointCloud pcd({{0, 0, 0}, {1, 0, 0}, {0, 2, 0}, {0, 0, 3}});
+
+    // The KDTree is cached until the points change, by a method or in place.
+    auto kdtree = pcd.GetKDTree();
+    EXPECT_EQ(pcd.GetKDTree(), kdtree);
+    pcd.Translate({1, 0, 0});
+    EXPECT_NE(pcd.GetKDTree(), kdtree);
+    kdtree = pcd.GetKDTree();
+    pcd.points_[0] = {-1, 0, 0};
+    EXPECT_NE(pcd.GetKDTree(), kdtree);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    pcd.GetKDTree()->SearchKNN(Eigen::Vector3d(-1, 0, 0), 1, indices,
+                               distance2);
+    EXPECT_EQ(indices[0], 0);
+
+    // Cached bounding boxes follow the points too.
+    EXPECT_EQ(pcd.GetAxisAlignedBoundingBox().min_bound_,
+              Eigen::Vector3d(-1, 0, 0));
+    pcd.points_[0] = {-2, 0, 0};
+    EXPECT_EQ(pcd.GetAxisAlignedBoundingBox().min_bound_,
+              Eigen::Vector3d(-2, 0, 0));
+
+    // Copies do not share the cache.
+    geometry::PointCloud copy = pcd;
+    copy.points_[1] = {5, 5, 5};
+    EXPECT_EQ(pcd.GetAxisAlignedBoundingBox().max_bound_,
+              Eigen::Vector3d(2, 2, 3));
+    EXPECT_EQ(copy.GetAxisAlignedBoundingBox().max_bound_,
+              Eigen::Vector3d(5, 5, 5));
+}
+
 TEST(PointCloud, Transform) {
     std::vector<Eigen::Vector3d> points = {
             {0, 0, 0},
@@ -473,6 +507,25 @@ TEST(PointCloud, PaintUniformColor) {
     EXPECT_EQ(pcd.colors_, std::vector<Eigen::Vector3d>({color, color}));
 }
 
+TEST(PointCloud, SortByMortonCode) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{1, 1, 1}, {0, 1, 0}, {1, 0, 1}, {0, 0, 0},
+                   {1, 1, 0}, {0, 0, 1}, {1, 0, 0}, {0, 1, 1}};
+    pcd.colors_ = pcd.points_;
+    for (auto &color : pcd.colors_) color *= 0.5;
+
+    pcd.SortByMortonCode();
+
+    // x is the lowest bit of the Morton code, z the highest.
+    std::vector<Eigen::Vector3d> ref_points = {
+            {0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0},
+            {0, 0, 1}, {1, 0, 1}, {0, 1, 1}, {1, 1, 1}};
+    ExpectEQ(pcd.points_, ref_points);
+    for (auto &point : ref_points) point *= 0.5;
+    ExpectEQ(pcd.colors_, ref_points);
+    EXPECT_FALSE(pcd.HasNormals());
+}
+
 TEST(PointCloud, SelectByIndex) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -594,6 +647,49 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    // voxel_size: 1, voxel bounds: [0, 3)
+    std::vector<Eigen::Vector3d> points{
+            // voxel_{0, 0, 0}, cubic id 7 (upper half on all axes)
+            {0.5, 0.7, 0.6},
+            {0.7, 0.6, 0.5},
+            // voxel_{0, 1, 2}, cubic id 3 (upper half on x and y)
+            {0.5, 1.6, 2.4},
+            // voxel_{0, 0, 0}, cubic id 0
+            {0.2, 0.1, 0.3},
+            // voxel_{0, 1, 2}, cubic id 4 (upper half on z)
+            {0.1, 1.2, 2.9},
+    };
+    geometry::PointCloud pcd;
+    pcd.points_ = points;
+
+    std::shared_ptr<geometry::PointCloud> pc_down;
+    Eigen::MatrixXi cubic_id;
+    std::vector<std::vector<int>> original_indices;
+    std::tie(pc_down, cubic_id, original_indices) =
+            pcd.VoxelDownSampleAndTrace(1.0, Eigen::Vector3d(0, 0, 0),
+                                        Eigen::Vector3d(3, 3, 3));
+
+    std::vector<Eigen::Vector3d> points_down{
+            {0.7 / 1.5, 0.7 / 1.5, 0.7 / 1.5},
+            {0.3, 1.4, 2.65},
+    };
+    std::vector<size_t> sort_indices =
+            GetIndicesAToB(pc_down->points_, points_down);
+    ExpectEQ(ApplyIndices(pc_down->points_, sort_indices), points_down);
+
+    ASSERT_EQ(cubic_id.rows(), 2);
+    ASSERT_EQ(original_indices.size(), 2u);
+    Eigen::MatrixXi cubic_id_down(2, 8);
+    cubic_id_down << 3, -1, -1, -1, -1, -1, -1, 1,  //
+            -1, -1, -1, 2, 4, -1, -1, -1;
+    std::vector<std::vector<int>> original_indices_down{{0, 1, 3}, {2, 4}};
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(cubic_id.row(sort_indices[i]), cubic_id_down.row(i));
+        EXPECT_EQ(original_indices[sort_indices[i]], original_indices_down[i]);
+    }
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -855,6 +951,51 @@ TEST(PointCloud, OrientNormalsConsistentTangentPlane) {
                                                          {c, -b, -b}}));
 }
 
+TEST(PointCloud, OrientNormalsConsistentTangentPlaneSphere) {
+    // Points near a sphere with radial normals, a third of them flipped.
+    geometry::PointCloud pcd;
+    std::vector<Eigen::Vector3d> ref_normals;
+    const int n = 200;
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < n; ++i) {
+        double z = 1.0 - 2.0 * (i + 0.5) / n;
+        double r = std::sqrt(1.0 - z * z);
+        Eigen::Vector3d dir(r * std::cos(golden_angle * i),
+                            r * std::sin(golden_angle * i), z);
+        pcd.points_.push_back((1.0 + 0.02 * std::sin(7.0 * i)) * dir);
+        pcd.normals_.push_back(i % 3 == 0 ? -dir : dir);
+        ref_normals.push_back(dir);
+    }
+
+    // Same output as the previous serial Kruskal implementation: all normals
+    // point outwards.
+    pcd.OrientNormalsConsistentTangentPlane(/*k=*/6);
+    ExpectEQ(pcd.normals_, ref_normals);
+}
+
+TEST(PointCloud, OrientNormalsConsistentTangentPlaneEqualWeights) {
+    // Parallel normals give all Riemannian graph edges the same weight, so
+    // the spanning tree depends on how ties are broken, but the orientation
+    // must not.
+    geometry::PointCloud pcd;
+    for (int x = 0; x < 5; ++x) {
+        for (int y = 0; y < 5; ++y) {
+            for (int z = 0; z < 2; ++z) {
+                int i = int(pcd.points_.size());
+                pcd.points_.push_back({x + 0.1 * std::sin(i),
+                                       y + 0.1 * std::cos(3 * i),
+                                       0.2 * z + 0.05 * std::sin(5 * i)});
+                pcd.normals_.push_back({0, 0, i % 3 == 0 ? -1.0 : 1.0});
+            }
+        }
+    }
+
+    // Same output as the previous serial Kruskal implementation.
+    pcd.OrientNormalsConsistentTangentPlane(/*k=*/6);
+    ExpectEQ(pcd.normals_,
+             std::vector<Eigen::Vector3d>(pcd.points_.size(), {0, 0, 1}));
+}
+
 TEST(PointCloud, ComputePointCloudToPointCloudDistance) {
     geometry::PointCloud pc0({{0, 0, 0}, {1, 2, 0}, {2, 2, 0}});
     geometry::PointCloud pc1({{-1, 0, 0}, {-2, 0, 0}, {-1, 2, 0}});
@@ -989,6 +1130,29 @@ TEST(PointCloud, ComputeConvexHull) {
                                                              {7, 0, 6},
                                                              {7, 4, 5},
                                                              {7, 4, 6}}));
+
+    // Large enough for the interior points to be culled before Qhull.
+    pcd.points_.resize(5000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    std::tie(mesh, pt_map) = pcd.ComputeConvexHull();
+    ExpectEQ(mesh->vertices_, ApplyIndices(pcd.points_, pt_map));
+    Eigen::Vector3d center(0, 0, 0);
+    for (const Eigen::Vector3d &vertex : mesh->vertices_) {
+        center += vertex / double(mesh->vertices_.size());
+    }
+    for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+        const Eigen::Vector3d &a = mesh->vertices_[triangle(0)];
+        Eigen::Vector3d normal = (mesh->vertices_[triangle(1)] - a)
+                                         .cross(mesh->vertices_[triangle(2)] -
+                                                a)
+                                         .normalized();
+        if (normal.dot(center - a) > 0) {
+            normal = -normal;
+        }
+        for (const Eigen::Vector3d &point : pcd.points_) {
+            EXPECT_LE(normal.dot(point - a), 1e-9);
+        }
+    }
 }
 
 TEST(PointCloud, HiddenPointRemoval) {
@@ -1050,6 +1214,43 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlanes) {
+    // A floor z = 0 and a wall x = 0 sampled on grids, and a few points off
+    // both.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 20; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            pcd.points_.push_back(Eigen::Vector3d(0.1 * i + 0.1, 0.1 * j, 0));
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            pcd.points_.push_back(Eigen::Vector3d(0, 0.1 * j, 0.1 * i + 0.1));
+        }
+    }
+    pcd.points_.push_back(Eigen::Vector3d(1, 1, 1));
+    pcd.points_.push_back(Eigen::Vector3d(0.5, 0.3, 0.7));
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes =
+            pcd.SegmentPlanes(3, 0.01, 3, 1000, 10);
+    ASSERT_EQ(planes.size(), 2);
+
+    // The floor has more inliers, so it is found first.
+    Eigen::Vector4d floor = std::get<0>(planes[0]);
+    floor *= floor(2) < 0 ? -1 : 1;
+    ExpectEQ(floor, Eigen::Vector4d(0, 0, 1, 0));
+    std::vector<size_t> floor_ref(400);
+    std::iota(floor_ref.begin(), floor_ref.end(), 0);
+    EXPECT_EQ(std::get<1>(planes[0]), floor_ref);
+
+    Eigen::Vector4d wall = std::get<0>(planes[1]);
+    wall *= wall(0) < 0 ? -1 : 1;
+    ExpectEQ(wall, Eigen::Vector4d(1, 0, 0, 0));
+    std::vector<size_t> wall_ref(200);
+    std::iota(wall_ref.begin(), wall_ref.end(), 400);
+    EXPECT_EQ(std::get<1>(planes[1]), wall_ref);
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log";
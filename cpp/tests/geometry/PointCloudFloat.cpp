@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/geometry/PointCloudFloat.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(PointCloudFloat, ToPointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0.0, 1.0, 2.0}, {3.0, 4.0, 5.0}};
+    pcd.normals_ = {{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}};
+
+    geometry::PointCloudFloat pcd_float(pcd);
+    EXPECT_TRUE(pcd_float.HasNormals());
+    EXPECT_FALSE(pcd_float.HasColors());
+    ExpectEQ(pcd_float.GetMinBound(), Eigen::Vector3d(0.0, 1.0, 2.0));
+    ExpectEQ(pcd_float.GetMaxBound(), Eigen::Vector3d(3.0, 4.0, 5.0));
+
+    geometry::PointCloud pcd_back = pcd_float.ToPointCloud();
+    ExpectEQ(pcd_back.points_, pcd.points_);
+    ExpectEQ(pcd_back.normals_, pcd.normals_);
+    EXPECT_FALSE(pcd_back.HasColors());
+}
+
+TEST(PointCloudFloat, Transform) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(100);
+    pcd.normals_.resize(100);
+    Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(0.0, 0.0, 1.0))
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.5, -0.2, 0.1);
+
+    geometry::PointCloudFloat pcd_float(pcd);
+    pcd_float.Transform(transformation);
+    pcd.Transform(transformation);
+    geometry::PointCloud pcd_back = pcd_float.ToPointCloud();
+    ExpectEQ(pcd_back.points_, pcd.points_, 1e-6);
+    ExpectEQ(pcd_back.normals_, pcd.normals_, 1e-6);
+}
+
+TEST(PointCloudFloat, VoxelDownSample) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    pcd.normals_.resize(1000);
+    pcd.colors_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pcd.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 2);
+    // Round the points to single precision so that both clouds fall into the
+    // same voxels.
+    pcd = geometry::PointCloudFloat(pcd).ToPointCloud();
+
+    auto downsampled = pcd.VoxelDownSample(0.25);
+    auto downsampled_float =
+            geometry::PointCloudFloat(pcd).VoxelDownSample(0.25);
+    geometry::PointCloud downsampled_back = downsampled_float->ToPointCloud();
+    ASSERT_EQ(downsampled_back.points_.size(), downsampled->points_.size());
+    ExpectEQ(downsampled_back.points_, downsampled->points_, 1e-6);
+    ExpectEQ(downsampled_back.normals_, downsampled->normals_, 1e-6);
+    ExpectEQ(downsampled_back.colors_, downsampled->colors_, 1e-6);
+}
+
+TEST(PointCloudFloat, EstimateNormals) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    // Points on a wavy surface z = 0.1 * sin(4 * x).
+    for (auto &point : pcd.points_) {
+        point(2) = 0.1 * std::sin(4.0 * point(0));
+    }
+    pcd = geometry::PointCloudFloat(pcd).ToPointCloud();
+    geometry::PointCloudFloat pcd_float(pcd);
+
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    pcd_float.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    ASSERT_TRUE(pcd_float.HasNormals());
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        // Normals are only defined up to their sign.
+        EXPECT_NEAR(std::abs(pcd_float.normals_[i].cast<double>().dot(
+                            pcd.normals_[i])),
+                    1.0, 1e-4);
+    }
+
+    // Existing normals are kept as the orientation reference.
+    pcd_float.normals_.assign(pcd_float.points_.size(),
+                              Eigen::Vector3f(0.0, 0.0, -1.0));
+    pcd_float.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    for (const auto &normal : pcd_float.normals_) {
+        EXPECT_LT(normal(2), 0.0);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -28,6 +28,8 @@
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TetraMesh.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -839,6 +841,47 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2, 1e-4);
 }
 
+TEST(TriangleMesh, SubdivideMidpoint) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    mesh->triangles_ = {{0, 1, 2}};
+
+    auto subdivided = mesh->SubdivideMidpoint(1);
+    std::vector<Eigen::Vector3d> ref_vertices = {
+            {0, 0, 0},     {1, 0, 0},     {0, 1, 0},
+            {0.5, 0, 0}, {0.5, 0.5, 0}, {0, 0.5, 0}};
+    std::vector<Eigen::Vector3i> ref_triangles = {
+            {0, 3, 5}, {3, 1, 4}, {4, 2, 5}, {3, 4, 5}};
+    ExpectEQ(subdivided->vertices_, ref_vertices);
+    ExpectEQ(subdivided->triangles_, ref_triangles);
+
+    subdivided = geometry::TriangleMesh::CreateBox()->SubdivideMidpoint(2);
+    EXPECT_EQ(subdivided->vertices_.size(), 8 + 18 + 72);
+    EXPECT_EQ(subdivided->triangles_.size(), 12 * 16);
+    EXPECT_TRUE(subdivided->IsWatertight());
+}
+
+TEST(TriangleMesh, SubdivideLoop) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    mesh->triangles_ = {{0, 1, 2}};
+
+    // All edges are on the boundary, so the new vertices are the midpoints.
+    auto subdivided = mesh->SubdivideLoop(1);
+    std::vector<Eigen::Vector3d> ref_vertices = {
+            {0.125, 0.125, 0}, {0.75, 0.125, 0}, {0.125, 0.75, 0},
+            {0.5, 0, 0},       {0.5, 0.5, 0},    {0, 0.5, 0}};
+    std::vector<Eigen::Vector3i> ref_triangles = {
+            {0, 3, 5}, {3, 1, 4}, {4, 2, 5}, {3, 4, 5}};
+    ExpectEQ(subdivided->vertices_, ref_vertices);
+    ExpectEQ(subdivided->triangles_, ref_triangles);
+
+    subdivided = geometry::TriangleMesh::CreateBox()->SubdivideLoop(2);
+    EXPECT_EQ(subdivided->vertices_.size(), 8 + 18 + 72);
+    EXPECT_EQ(subdivided->triangles_.size(), 12 * 16);
+    EXPECT_TRUE(subdivided->IsWatertight());
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1425,6 +1468,36 @@ TEST(TriangleMesh, DeformAsRigidAsPossible) {
     auto mesh_deform =
             mesh_in.DeformAsRigidAsPossible(constraint_ids, constraint_pos, 50);
     ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
+
+    // The cached system is reused for the same constraint indices, and
+    // rebuilt when they change.
+    geometry::DeformAsRigidAsPossibleCache cache;
+    EXPECT_TRUE(cache.IsEmpty());
+    std::vector<Eigen::Vector3d> moved_pos = constraint_pos;
+    moved_pos.back() = {0.5, 0.5, 0.2};
+    auto mesh_moved = mesh_in.DeformAsRigidAsPossible(
+            constraint_ids, moved_pos, 50,
+            geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Spokes, 0.01,
+            cache);
+    EXPECT_FALSE(cache.IsEmpty());
+    mesh_deform = mesh_in.DeformAsRigidAsPossible(
+            constraint_ids, constraint_pos, 50,
+            geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Spokes, 0.01,
+            cache);
+    ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
+    ExpectEQ(mesh_moved->vertices_[constraint_ids.back()],
+             Eigen::Vector3d(0.5, 0.5, 0.2));
+
+    std::vector<int> fewer_ids(constraint_ids.begin(),
+                               constraint_ids.end() - 1);
+    std::vector<Eigen::Vector3d> fewer_pos(constraint_pos.begin(),
+                                           constraint_pos.end() - 1);
+    ExpectMeshEQ(
+            *mesh_in.DeformAsRigidAsPossible(
+                    fewer_ids, fewer_pos, 50,
+                    geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+                    0.01, cache),
+            *mesh_in.DeformAsRigidAsPossible(fewer_ids, fewer_pos, 50), 1e-8);
 }
 
 TEST(TriangleMesh, SelectByIndex) {
@@ -1639,6 +1712,49 @@ TEST(TriangleMesh, CropTriangleMesh) {
     ExpectEQ(ref_triangle_normals, output_tm->triangle_normals_);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimationParallel) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    auto mesh = sphere->SimplifyQuadricDecimationParallel(
+            500, std::numeric_limits<double>::infinity(), 1.0);
+    EXPECT_LE(mesh->triangles_.size(), 500u);
+    EXPECT_GE(mesh->triangles_.size(), 490u);
+    EXPECT_EQ(mesh->vertex_normals_.size(), mesh->vertices_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold());
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+    }
+    for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+        for (int k = 0; k < 3; ++k) {
+            EXPECT_GE(triangle(k), 0);
+            EXPECT_LT(triangle(k), int(mesh->vertices_.size()));
+        }
+    }
+
+    // Collapses within a plane and along its straight boundary are free, all
+    // others are bounded by the maximum error.
+    geometry::TriangleMesh grid;
+    const int n = 11;
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            grid.vertices_.emplace_back(x / double(n - 1), y / double(n - 1),
+                                        0);
+        }
+    }
+    for (int y = 0; y + 1 < n; ++y) {
+        for (int x = 0; x + 1 < n; ++x) {
+            int vidx = y * n + x;
+            grid.triangles_.emplace_back(vidx, vidx + 1, vidx + n + 1);
+            grid.triangles_.emplace_back(vidx, vidx + n + 1, vidx + n);
+        }
+    }
+    mesh = grid.SimplifyQuadricDecimationParallel(0, 1e-12, 1.0);
+    EXPECT_LT(mesh->triangles_.size(), grid.triangles_.size() / 4);
+    EXPECT_NEAR(mesh->GetSurfaceArea(), 1.0, 1e-9);
+    ExpectEQ(mesh->GetMinBound(), Eigen::Vector3d(0, 0, 0));
+    ExpectEQ(mesh->GetMaxBound(), Eigen::Vector3d(1, 1, 0));
+}
+
 TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -1888,6 +2004,58 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
 
     ExpectMeshEQ(*mesh_es, mesh_gt, 1e-4);
     ExpectEQ(densities_es, densities_gt, 1e-4);
+
+    std::vector<std::pair<std::string, double>> timings;
+    std::tie(mesh_es, densities_es, timings) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonWithTimings(
+                    pcd, 2, 0, 1.1f, false, /*n_threads=*/1,
+                    /*max_memory_mb=*/0, /*temp_dir=*/"",
+                    /*compute_densities=*/false);
+    ExpectMeshEQ(*mesh_es, mesh_gt, 1e-4);
+    EXPECT_TRUE(densities_es.empty());
+    std::vector<std::string> stages;
+    for (const auto &timing : timings) {
+        stages.push_back(timing.first);
+        EXPECT_GE(timing.second, 0);
+    }
+    EXPECT_EQ(stages, std::vector<std::string>({"read_samples",
+                                                "density_estimation",
+                                                "normal_field", "finalize_tree",
+                                                "fem_constraints",
+                                                "point_constraints", "solve",
+                                                "iso_value", "extract_mesh",
+                                                "total"}));
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Evenly distributed points on the unit sphere.
+    const int n = 2000;
+    geometry::PointCloud pcd;
+    for (int i = 0; i < n; ++i) {
+        double z = 1 - (2 * i + 1) / double(n);
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5.0));
+        pcd.points_.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+        pcd.normals_.push_back(pcd.points_.back());
+    }
+
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {0.1, 0.2});
+    EXPECT_EQ(mesh->vertices_.size(), size_t(n));
+    EXPECT_EQ(mesh->triangles_.size(), size_t(2 * n - 4));
+    EXPECT_EQ(mesh->triangle_normals_.size(), mesh->triangles_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold(false));
+    EXPECT_TRUE(mesh->IsVertexManifold());
+    for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+        const Eigen::Vector3d& v0 = mesh->vertices_[triangle(0)];
+        const Eigen::Vector3d& v1 = mesh->vertices_[triangle(1)];
+        const Eigen::Vector3d& v2 = mesh->vertices_[triangle(2)];
+        EXPECT_GT((v1 - v0).cross(v2 - v0).dot(v0), 0);
+    }
+
+    pcd.normals_.clear();
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {0.1}));
 }
 
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
@@ -1915,6 +2083,51 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapeCache) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(200);
+    Rand(pcd.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 0);
+    pcd.colors_.resize(200);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+
+    geometry::AlphaShapeCache cache;
+    EXPECT_TRUE(cache.IsEmpty());
+    EXPECT_TRUE(cache.GetAlphaSpectrum().empty());
+    std::shared_ptr<geometry::TetraMesh> tetra_mesh;
+    std::vector<size_t> pt_map;
+    std::tie(tetra_mesh, pt_map) =
+            geometry::Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+    for (double alpha : {0.05, 0.1, 0.2, 0.5, 10.0}) {
+        auto mesh = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                pcd, alpha, cache);
+        EXPECT_FALSE(cache.IsEmpty());
+        ExpectMeshEQ(*mesh,
+                     *geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                             pcd, alpha, tetra_mesh, &pt_map));
+    }
+
+    // Crossing a value of the spectrum changes the shape.
+    std::vector<double> spectrum = cache.GetAlphaSpectrum();
+    ASSERT_GT(spectrum.size(), 2u);
+    EXPECT_TRUE(std::is_sorted(spectrum.begin(), spectrum.end()));
+    double alpha = spectrum[spectrum.size() / 2];
+    auto mesh_at = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+            pcd, alpha, cache);
+    auto mesh_below = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+            pcd, std::nextafter(alpha, 0.0), cache);
+    EXPECT_FALSE(mesh_at->triangles_ == mesh_below->triangles_ &&
+                 mesh_at->vertices_ == mesh_below->vertices_);
+
+    // The cache is rebuilt when the points change.
+    pcd.points_[0] += Eigen::Vector3d(0.5, 0.5, 0.5);
+    ExpectMeshEQ(
+            *geometry::TriangleMesh::CreateFromPointCloudAlphaShape(pcd, 0.3,
+                                                                    cache),
+            *geometry::TriangleMesh::CreateFromPointCloudAlphaShape(pcd, 0.3));
+    cache.Clear();
+    EXPECT_TRUE(cache.IsEmpty());
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleMeshBVH, Nodes) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::TriangleMeshBVH bvh(*mesh, 3);
+    const std::vector<geometry::TriangleMeshBVH::Node> &nodes = bvh.GetNodes();
+    ASSERT_FALSE(nodes.empty());
+
+    // Every triangle is in exactly one leaf, and inside its bounds.
+    std::vector<int> order = bvh.GetTriangleOrder();
+    std::sort(order.begin(), order.end());
+    std::vector<int> order_ref(mesh->triangles_.size());
+    std::iota(order_ref.begin(), order_ref.end(), 0);
+    EXPECT_EQ(order, order_ref);
+    int num_leaf_triangles = 0;
+    for (const geometry::TriangleMeshBVH::Node &node : nodes) {
+        if (!node.IsLeaf()) {
+            continue;
+        }
+        EXPECT_LE(node.count_, 3);
+        num_leaf_triangles += node.count_;
+        for (int k = node.offset_; k < node.offset_ + node.count_; ++k) {
+            const Eigen::Vector3i &triangle =
+                    mesh->triangles_[bvh.GetTriangleOrder()[k]];
+            for (int i = 0; i < 3; ++i) {
+                const Eigen::Vector3d &v = mesh->vertices_[triangle(i)];
+                EXPECT_TRUE((v.array() >= node.min_bound_.array()).all());
+                EXPECT_TRUE((v.array() <= node.max_bound_.array()).all());
+            }
+        }
+    }
+    EXPECT_EQ(num_leaf_triangles, int(mesh->triangles_.size()));
+
+    EXPECT_TRUE(geometry::TriangleMeshBVH(geometry::TriangleMesh())
+                        .GetNodes()
+                        .empty());
+    EXPECT_ANY_THROW(geometry::TriangleMeshBVH(*mesh, 0));
+}
+
+TEST(TriangleMeshBVH, CastRays) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::TriangleMeshBVH bvh(*mesh);
+
+    std::vector<Eigen::Vector3d> origins(200), directions(200);
+    Rand(origins, Eigen::Vector3d(-2, -2, -2), Eigen::Vector3d(2, 2, 2), 0);
+    Rand(directions, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 1);
+    std::vector<geometry::TriangleMeshBVH::RayHit> hits =
+            bvh.CastRays(origins, directions);
+    std::vector<int> counts = bvh.CountIntersections(origins, directions);
+    ASSERT_EQ(hits.size(), origins.size());
+
+    for (size_t i = 0; i < origins.size(); ++i) {
+        // Reference by brute force over the triangles.
+        double t_ref = std::numeric_limits<double>::infinity();
+        int count_ref = 0;
+        for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+            const Eigen::Vector3d &a = mesh->vertices_[triangle(0)];
+            const Eigen::Vector3d &b = mesh->vertices_[triangle(1)];
+            const Eigen::Vector3d &c = mesh->vertices_[triangle(2)];
+            Eigen::Matrix3d A;
+            A << -directions[i], b - a, c - a;
+            Eigen::Vector3d x = A.colPivHouseholderQr().solve(origins[i] - a);
+            if (x(0) >= 0 && x(1) >= 0 && x(2) >= 0 && x(1) + x(2) <= 1) {
+                t_ref = std::min(t_ref, x(0));
+                count_ref++;
+            }
+        }
+        EXPECT_EQ(counts[i], count_ref);
+        if (count_ref == 0) {
+            EXPECT_EQ(hits[i].triangle_, -1);
+            continue;
+        }
+        EXPECT_NEAR(hits[i].t_, t_ref, 1e-9);
+        ASSERT_GE(hits[i].triangle_, 0);
+        const Eigen::Vector3i &triangle = mesh->triangles_[hits[i].triangle_];
+        Eigen::Vector3d hit_point =
+                (1 - hits[i].uv_.sum()) * mesh->vertices_[triangle(0)] +
+                hits[i].uv_(0) * mesh->vertices_[triangle(1)] +
+                hits[i].uv_(1) * mesh->vertices_[triangle(2)];
+        ExpectEQ(hit_point,
+                 Eigen::Vector3d(origins[i] + hits[i].t_ * directions[i]),
+                 1e-9);
+    }
+
+    // A ray that stops before the sphere.
+    EXPECT_EQ(bvh.CastRay(Eigen::Vector3d(0, 0, -3), Eigen::Vector3d(0, 0, 1),
+                          1.5)
+                      .triangle_,
+              -1);
+    EXPECT_NEAR(bvh.CastRay(Eigen::Vector3d(0, 0, -3), Eigen::Vector3d(0, 0, 1))
+                        .t_,
+                2.0, 1e-9);
+}
+
+TEST(TriangleMeshBVH, ComputeClosestPoints) {
+    auto mesh = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    geometry::TriangleMeshBVH bvh(*mesh);
+
+    std::vector<Eigen::Vector3d> points = {{0.5, 1.0, -1.0},
+                                           {2.0, 3.0, 4.0},
+                                           {0.5, 0.2, 1.5},
+                                           {0.1, 1.0, 1.5}};
+    std::vector<geometry::TriangleMeshBVH::ClosestPoint> closest =
+            bvh.ComputeClosestPoints(points);
+    ASSERT_EQ(closest.size(), points.size());
+    ExpectEQ(closest[0].point_, Eigen::Vector3d(0.5, 1.0, 0.0));
+    EXPECT_NEAR(closest[0].distance_, 1.0, 1e-12);
+    ExpectEQ(closest[1].point_, Eigen::Vector3d(1.0, 2.0, 3.0));
+    EXPECT_NEAR(closest[1].distance_, std::sqrt(3.0), 1e-12);
+    ExpectEQ(closest[2].point_, Eigen::Vector3d(0.5, 0.0, 1.5));
+    EXPECT_NEAR(closest[2].distance_, 0.2, 1e-12);
+    ExpectEQ(closest[3].point_, Eigen::Vector3d(0.0, 1.0, 1.5));
+    EXPECT_NEAR(closest[3].distance_, 0.1, 1e-12);
+    for (const geometry::TriangleMeshBVH::ClosestPoint &c : closest) {
+        ASSERT_GE(c.triangle_, 0);
+        ASSERT_LT(c.triangle_, int(mesh->triangles_.size()));
+    }
+}
+
+TEST(TriangleMeshBVH, ComputeOccupancy) {
+    auto mesh = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    geometry::TriangleMeshBVH bvh(*mesh);
+
+    std::vector<Eigen::Vector3d> points = {{0.5, 1.0, 1.5},
+                                           {0.9, 0.1, 2.9},
+                                           {1.5, 1.0, 1.5},
+                                           {-0.1, -0.1, -0.1},
+                                           {0.5, 1.0, 3.5}};
+    EXPECT_EQ(bvh.ComputeOccupancy(points),
+              std::vector<bool>({true, true, false, false, false}));
+}
+
+}  // namespace tests
+}  // namespace open3d
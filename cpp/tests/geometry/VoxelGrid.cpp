@@ -26,8 +26,16 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/camera/PinholeCameraParameters.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/LineSet.h"
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
 
@@ -75,5 +83,99 @@ TEST(VoxelGrid, Visualization) {
     // visualization::DrawGeometries({voxel_grid});
 }
 
+TEST(VoxelGrid, CreateFromPointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    pcd.colors_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    Rand(pcd.colors_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 1);
+    auto voxel_grid = geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.3);
+
+    // Reference by accumulating the points one by one.
+    std::unordered_map<Eigen::Vector3i, geometry::AvgColorVoxel,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            voxels_ref;
+    for (size_t i = 0; i < pcd.points_.size(); ++i) {
+        Eigen::Vector3i index =
+                ((pcd.points_[i] - voxel_grid->origin_) / 0.3)
+                        .array()
+                        .floor()
+                        .cast<int>();
+        voxels_ref[index].Add(index, pcd.colors_[i]);
+    }
+    ASSERT_EQ(voxel_grid->voxels_.size(), voxels_ref.size());
+    for (const auto &it : voxels_ref) {
+        ASSERT_EQ(voxel_grid->voxels_.count(it.first), 1u);
+        ExpectEQ(voxel_grid->voxels_.at(it.first).color_,
+                 it.second.GetAverageColor());
+    }
+}
+
+TEST(VoxelGrid, CreateFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    double voxel_size = 0.2;
+    auto voxel_grid =
+            geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, voxel_size);
+
+    // Reference by testing every voxel against every triangle.
+    std::vector<Eigen::Vector3i> voxels_ref;
+    Eigen::Vector3i num_voxels =
+            ((mesh->GetMaxBound() - mesh->GetMinBound()) / voxel_size +
+             Eigen::Vector3d::Ones())
+                    .array()
+                    .round()
+                    .cast<int>();
+    Eigen::Vector3d box_half_size = Eigen::Vector3d::Constant(voxel_size / 2);
+    for (int w = 0; w < num_voxels(0); ++w) {
+        for (int h = 0; h < num_voxels(1); ++h) {
+            for (int d = 0; d < num_voxels(2); ++d) {
+                Eigen::Vector3d center = voxel_grid->origin_ +
+                                         Eigen::Vector3d(w, h, d) * voxel_size;
+                for (const Eigen::Vector3i &t : mesh->triangles_) {
+                    if (geometry::IntersectionTest::TriangleAABB(
+                                center, box_half_size, mesh->vertices_[t(0)],
+                                mesh->vertices_[t(1)],
+                                mesh->vertices_[t(2)])) {
+                        voxels_ref.emplace_back(w, h, d);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    ASSERT_EQ(voxel_grid->voxels_.size(), voxels_ref.size());
+    for (const Eigen::Vector3i &index : voxels_ref) {
+        EXPECT_EQ(voxel_grid->voxels_.count(index), 1u);
+    }
+}
+
+TEST(VoxelGrid, CarveSilhouette) {
+    auto voxel_grid = geometry::VoxelGrid::CreateDense(
+            Eigen::Vector3d(-0.5, -0.5, 1.5), Eigen::Vector3d::Zero(), 0.1,
+            1.0, 1.0, 1.0);
+    ASSERT_EQ(voxel_grid->voxels_.size(), 1000u);
+
+    // Only the voxels that project to the left half of the image are kept.
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(64, 64, 32, 32, 31.5, 31.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    geometry::Image mask;
+    mask.Prepare(64, 64, 1, 4);
+    for (int v = 0; v < 64; ++v) {
+        for (int u = 0; u < 32; ++u) {
+            *mask.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    voxel_grid->CarveSilhouette(mask, camera, false);
+    EXPECT_FALSE(voxel_grid->voxels_.empty());
+    EXPECT_LT(voxel_grid->voxels_.size(), 1000u);
+    for (const auto &it : voxel_grid->voxels_) {
+        // Some corner of the voxel must project to the left half, up to the
+        // bilinear interpolation of the mask at the middle column.
+        EXPECT_LE(voxel_grid->GetVoxelCenterCoordinate(it.first)(0) - 0.05,
+                  1e-9);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/AsyncWriter.h"
+
+#include <atomic>
+#include <stdexcept>
+
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/io/PoseGraphIO.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(AsyncWriter, WriteGeometries) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = pointcloud.points_;
+    mesh.triangles_ = {{0, 1, 2}};
+    pipelines::registration::PoseGraph pose_graph;
+    pose_graph.nodes_.resize(2);
+
+    const std::string prefix = std::string(TEST_DATA_DIR) + "/test_async";
+    io::AsyncWriterOption option;
+    option.num_threads = 2;
+    io::AsyncWriter writer(option);
+    std::future<bool> pointcloud_written =
+            writer.WritePointCloud(prefix + ".pcd", pointcloud,
+                                   io::WritePointCloudOption(false, true));
+    std::future<bool> mesh_written =
+            writer.WriteTriangleMesh(prefix + ".ply", mesh);
+    std::future<bool> pose_graph_written =
+            writer.WritePoseGraph(prefix + ".json", pose_graph);
+    writer.Flush();
+    EXPECT_EQ(writer.GetPendingCount(), 0u);
+    EXPECT_TRUE(pointcloud_written.get());
+    EXPECT_TRUE(mesh_written.get());
+    EXPECT_TRUE(pose_graph_written.get());
+
+    geometry::PointCloud pointcloud_read;
+    EXPECT_TRUE(io::ReadPointCloud(prefix + ".pcd", pointcloud_read));
+    ExpectEQ(pointcloud_read.points_, pointcloud.points_);
+    geometry::TriangleMesh mesh_read;
+    EXPECT_TRUE(io::ReadTriangleMesh(prefix + ".ply", mesh_read));
+    ExpectEQ(mesh_read.triangles_, mesh.triangles_);
+    pipelines::registration::PoseGraph pose_graph_read;
+    EXPECT_TRUE(io::ReadPoseGraph(prefix + ".json", pose_graph_read));
+    EXPECT_EQ(pose_graph_read.nodes_.size(), 2u);
+    for (const std::string ext : {".pcd", ".ply", ".json"}) {
+        std::remove((prefix + ext).c_str());
+    }
+}
+
+TEST(AsyncWriter, Submit) {
+    io::AsyncWriterOption option;
+    option.max_queue_size = 2;
+    std::atomic<int> count(0);
+    std::vector<std::future<bool>> results;
+    {
+        io::AsyncWriter writer(option);
+        for (int i = 0; i < 16; ++i) {
+            results.push_back(writer.Submit([&count]() {
+                ++count;
+                return true;
+            }));
+        }
+        results.push_back(writer.Submit(
+                []() -> bool { throw std::runtime_error("write failed"); }));
+        // The destructor completes the queued writes.
+    }
+    EXPECT_EQ(count, 16);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_TRUE(results[i].get());
+    }
+    EXPECT_THROW(results.back().get(), std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/ImageIO.h"
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,6 +37,35 @@ TEST(ImageIO, DISABLED_ReadImage) { NotImplemented(); }
 
 TEST(ImageIO, DISABLED_WriteImage) { NotImplemented(); }
 
+TEST(ImageIO, WriteImages) {
+    const std::string prefix = std::string(TEST_DATA_DIR) + "/test_images";
+    std::vector<std::string> filenames;
+    std::vector<std::shared_ptr<geometry::Image>> images;
+    for (int i = 0; i < 4; ++i) {
+        auto image = std::make_shared<geometry::Image>();
+        image->Prepare(64, 48, 1, 2);
+        for (size_t j = 0; j < image->data_.size(); ++j) {
+            image->data_[j] = uint8_t(i + j);
+        }
+        images.push_back(image);
+        filenames.push_back(prefix + std::to_string(i) +
+                            (i % 2 ? ".png" : ".lzf"));
+    }
+    // The fastest and the smallest PNG compression levels.
+    for (int quality : {0, 9}) {
+        ASSERT_TRUE(io::WriteImages(filenames, images, quality));
+        for (size_t i = 0; i < images.size(); ++i) {
+            geometry::Image image;
+            ASSERT_TRUE(io::ReadImage(filenames[i], image));
+            EXPECT_EQ(image.data_, images[i]->data_);
+        }
+    }
+    EXPECT_FALSE(io::WriteImages({filenames[0]}, images));
+    for (const std::string &filename : filenames) {
+        std::remove(filename.c_str());
+    }
+}
+
 TEST(ImageIO, DISABLED_ReadImageFromPNG) { NotImplemented(); }
 
 TEST(ImageIO, DISABLED_WriteImageToPNG) { NotImplemented(); }
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -50,5 +52,33 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     NotImplemented();
 }
 
+TEST(PinholeCameraTrajectoryIO, ReadWritePinholeCameraTrajectoryBIN) {
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 3; ++i) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_ = camera::PinholeCameraIntrinsic(
+                640, 480 + i, 525.0, 525.0, 319.5 + i, 239.5);
+        parameters.extrinsic_ = Eigen::Matrix4d::Random();
+        trajectory.parameters_.push_back(parameters);
+    }
+
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_trajectory.bin";
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(file_name, trajectory));
+    camera::PinholeCameraTrajectory trajectory_read;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, trajectory_read));
+    ASSERT_EQ(trajectory_read.parameters_.size(), 3u);
+    for (int i = 0; i < 3; ++i) {
+        const auto &expected = trajectory.parameters_[i];
+        const auto &actual = trajectory_read.parameters_[i];
+        ExpectEQ(actual.extrinsic_, expected.extrinsic_);
+        ExpectEQ(actual.intrinsic_.intrinsic_matrix_,
+                 expected.intrinsic_.intrinsic_matrix_);
+        EXPECT_EQ(actual.intrinsic_.width_, expected.intrinsic_.width_);
+        EXPECT_EQ(actual.intrinsic_.height_, expected.intrinsic_.height_);
+    }
+    std::remove(file_name.c_str());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/PointCloudLOD.h"
+
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static geometry::PointCloud CreatePointCloud(size_t num_points) {
+    geometry::PointCloud pointcloud;
+    std::vector<Eigen::Vector3d> points(num_points);
+    Rand(points, Eigen::Vector3d(-10, -10, -1), Eigen::Vector3d(10, 10, 1), 0);
+    pointcloud.points_ = points;
+    pointcloud.colors_.assign(num_points, Eigen::Vector3d(1.0, 0.0, 0.2));
+    return pointcloud;
+}
+
+static camera::PinholeCameraParameters CreateCamera(double distance) {
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(640, 480, 500, 500, 319.5, 239.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera.extrinsic_(2, 3) = distance;
+    return camera;
+}
+
+TEST(PointCloudLOD, WriteAndRead) {
+    const geometry::PointCloud pointcloud = CreatePointCloud(20000);
+    const std::string directory = std::string(TEST_DATA_DIR) + "/test_lod";
+    io::PointCloudLODOption option;
+    option.max_points_per_node = 500;
+    option.spacing = 1.0;
+    // Forces the partitioning into temporary files.
+    option.max_points_in_memory = 2000;
+    ASSERT_TRUE(io::WritePointCloudLOD(pointcloud, directory, option));
+    EXPECT_FALSE(utility::filesystem::DirectoryExists(directory + "/tmp"));
+
+    io::PointCloudLODReader reader(1000);
+    ASSERT_TRUE(reader.Open(directory));
+    EXPECT_GT(reader.GetNodes().size(), 8u);
+    EXPECT_EQ(reader.GetNumPoints(), pointcloud.points_.size());
+    EXPECT_EQ(reader.GetNodes()[0].name_, "r");
+
+    // Every point is stored in exactly one node.
+    auto all = reader.ReadPointCloud(CreateCamera(40), 0.0, 1u << 30);
+    ASSERT_EQ(all->points_.size(), pointcloud.points_.size());
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    Eigen::Vector3d sum_read = Eigen::Vector3d::Zero();
+    for (size_t i = 0; i < all->points_.size(); ++i) {
+        sum += pointcloud.points_[i];
+        sum_read += all->points_[i];
+    }
+    ExpectEQ(sum_read, sum, 1e-1);
+    ExpectEQ(all->colors_[0], Eigen::Vector3d(1.0, 0.0, 51.0 / 255.0), 1e-6);
+    EXPECT_LT(reader.GetCachedPointCount(), reader.GetNumPoints());
+
+    // Far away cameras need fewer nodes, and cameras looking away none.
+    const size_t num_near = reader.SelectNodes(CreateCamera(40), 2.0).size();
+    const size_t num_far = reader.SelectNodes(CreateCamera(400), 2.0).size();
+    EXPECT_LT(num_far, num_near);
+    auto budget = reader.ReadPointCloud(CreateCamera(40), 0.0, 5000);
+    EXPECT_LE(budget->points_.size(), 5000u);
+    EXPECT_TRUE(reader.SelectNodes(CreateCamera(-40), 0.0).empty());
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+TEST(PointCloudLOD, WriteFromFiles) {
+    const geometry::PointCloud pointcloud = CreatePointCloud(4000);
+    const std::string prefix = std::string(TEST_DATA_DIR) + "/test_lod_part";
+    const std::string directory = std::string(TEST_DATA_DIR) + "/test_lod";
+    std::vector<std::string> filenames;
+    for (int i = 0; i < 2; ++i) {
+        filenames.push_back(prefix + std::to_string(i) + ".ply");
+        ASSERT_TRUE(io::WritePointCloud(filenames.back(), pointcloud));
+    }
+    io::PointCloudLODOption option;
+    option.max_points_per_node = 500;
+    ASSERT_TRUE(io::WritePointCloudLOD(filenames, directory, option));
+
+    io::PointCloudLODReader reader;
+    ASSERT_TRUE(reader.Open(directory));
+    EXPECT_EQ(reader.GetNumPoints(), 2 * pointcloud.points_.size());
+    for (const std::string &filename : filenames) {
+        std::remove(filename.c_str());
+    }
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+}  // namespace tests
+}  // namespace open3d
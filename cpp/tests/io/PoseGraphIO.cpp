@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PoseGraphIO.h"
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,5 +37,39 @@ TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { NotImplemented(); }
 
 TEST(PoseGraphIO, DISABLED_WritePoseGraph) { NotImplemented(); }
 
+TEST(PoseGraphIO, ReadWritePoseGraphBIN) {
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < 4; ++i) {
+        pose_graph.nodes_.emplace_back(Eigen::Matrix4d::Random());
+    }
+    for (int i = 0; i < 3; ++i) {
+        Eigen::Matrix6d information = Eigen::Matrix6d::Random();
+        pose_graph.edges_.emplace_back(i, i + 1, Eigen::Matrix4d::Random(),
+                                       information, i % 2 == 0, 0.25 * i);
+    }
+
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_pose_graph.bin";
+    EXPECT_TRUE(io::WritePoseGraph(file_name, pose_graph));
+    pipelines::registration::PoseGraph pose_graph_read;
+    EXPECT_TRUE(io::ReadPoseGraph(file_name, pose_graph_read));
+    ASSERT_EQ(pose_graph_read.nodes_.size(), 4u);
+    ASSERT_EQ(pose_graph_read.edges_.size(), 3u);
+    for (int i = 0; i < 4; ++i) {
+        ExpectEQ(pose_graph_read.nodes_[i].pose_, pose_graph.nodes_[i].pose_);
+    }
+    for (int i = 0; i < 3; ++i) {
+        const auto &expected = pose_graph.edges_[i];
+        const auto &actual = pose_graph_read.edges_[i];
+        EXPECT_EQ(actual.source_node_id_, expected.source_node_id_);
+        EXPECT_EQ(actual.target_node_id_, expected.target_node_id_);
+        ExpectEQ(actual.transformation_, expected.transformation_);
+        ExpectEQ(actual.information_, expected.information_);
+        EXPECT_EQ(actual.uncertain_, expected.uncertain_);
+        EXPECT_EQ(actual.confidence_, expected.confidence_);
+    }
+    std::remove(file_name.c_str());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <fstream>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +44,63 @@ TEST(TriangleMeshIO, DISABLED_ReadTriangleMeshFromPLY) { NotImplemented(); }
 
 TEST(TriangleMeshIO, DISABLED_WriteTriangleMeshToPLY) { NotImplemented(); }
 
+TEST(TriangleMeshIO, ReadTriangleMeshFromSTL) {
+    auto box = geometry::TriangleMesh::CreateBox();
+    box->ComputeTriangleNormals();
+    const std::string filename = "test_read.stl";
+    EXPECT_TRUE(io::WriteTriangleMesh(filename, *box));
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMeshFromSTL(filename, mesh, {}));
+    ASSERT_EQ(mesh.triangles_.size(), box->triangles_.size());
+    EXPECT_EQ(mesh.vertices_.size(), 3 * box->triangles_.size());
+    EXPECT_EQ(mesh.vertex_normals_.size(), mesh.vertices_.size());
+    for (size_t i = 0; i < mesh.triangles_.size(); ++i) {
+        ExpectEQ(mesh.triangle_normals_[i], box->triangle_normals_[i]);
+        for (int k = 0; k < 3; ++k) {
+            ExpectEQ(mesh.vertices_[mesh.triangles_[i](k)],
+                     box->vertices_[box->triangles_[i](k)]);
+        }
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshFromOBJGeometry) {
+    const std::string filename = "test_read.obj";
+    std::ofstream(filename) << "# quad and triangle\n"
+                               "o quad\n"
+                               "v 0 0 0\n"
+                               "v 1 0 0\n"
+                               "  v 1 1 0\n"
+                               "v 0 1 0 \n"
+                               "vt 0 0\n"
+                               "vt 1 0\n"
+                               "vt 1 1\n"
+                               "vt 0 1\n"
+                               "vn 0 0 1\n"
+                               "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+                               "v 2 0 0\n"
+                               "f -4/-3/1 -1/-2/-1 -3/-1/1\r\n";
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMeshFromOBJGeometry(filename, mesh, {}));
+    EXPECT_EQ(mesh.vertices_.size(), 5u);
+    ExpectEQ(mesh.vertices_[2], Eigen::Vector3d(1, 1, 0));
+    ASSERT_EQ(mesh.triangles_.size(), 3u);
+    ExpectEQ(mesh.triangles_[0], Eigen::Vector3i(0, 1, 2));
+    ExpectEQ(mesh.triangles_[1], Eigen::Vector3i(0, 2, 3));
+    ExpectEQ(mesh.triangles_[2], Eigen::Vector3i(1, 4, 2));
+    ASSERT_EQ(mesh.triangle_uvs_.size(), 9u);
+    ExpectEQ(mesh.triangle_uvs_[5], Eigen::Vector2d(0, 1));
+    ExpectEQ(mesh.triangle_uvs_[7], Eigen::Vector2d(1, 1));
+    ASSERT_EQ(mesh.vertex_normals_.size(), 5u);
+    ExpectEQ(mesh.vertex_normals_[4], Eigen::Vector3d(0, 0, 1));
+
+    // Out of range indices are rejected.
+    std::ofstream(filename) << "v 0 0 0\nv 1 0 0\nf 1 2 3\n";
+    EXPECT_FALSE(io::ReadTriangleMeshFromOBJGeometry(filename, mesh, {}));
+    std::remove(filename.c_str());
+}
+
 }  // namespace tests
 }  // namespace open3d
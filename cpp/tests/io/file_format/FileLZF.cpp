@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(FileLZF, WriteReadImage) {
+    const std::string filename = std::string(TEST_DATA_DIR) + "/test_depth.lzf";
+    geometry::Image depth;
+    depth.Prepare(320, 240, 1, 2);
+    for (int v = 0; v < depth.height_; ++v) {
+        for (int u = 0; u < depth.width_; ++u) {
+            *depth.PointerAt<uint16_t>(u, v) = uint16_t(1000 + 3 * u + v);
+        }
+    }
+    geometry::Image color;
+    color.Prepare(33, 17, 3, 1);
+    for (size_t i = 0; i < color.data_.size(); ++i) {
+        color.data_[i] = uint8_t(i * 7);
+    }
+
+    for (const geometry::Image *image : {&depth, &color}) {
+        // Quality 0 stores the data without compression.
+        for (int quality : {0, io::kOpen3DImageIODefaultQuality}) {
+            ASSERT_TRUE(io::WriteImage(filename, *image, quality));
+            geometry::Image image_read;
+            ASSERT_TRUE(io::ReadImage(filename, image_read));
+            EXPECT_EQ(image_read.width_, image->width_);
+            EXPECT_EQ(image_read.height_, image->height_);
+            EXPECT_EQ(image_read.num_of_channels_, image->num_of_channels_);
+            EXPECT_EQ(image_read.bytes_per_channel_,
+                      image->bytes_per_channel_);
+            EXPECT_EQ(image_read.data_, image->data_);
+        }
+    }
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
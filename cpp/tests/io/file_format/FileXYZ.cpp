@@ -24,12 +24,37 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <fstream>
+
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FileXYZ, DISABLED_ReadPointCloudFromXYZ) { NotImplemented(); }
+TEST(FileXYZ, ReadPointCloudFromXYZ) {
+    const std::string filename = "test_read.xyz";
+    {
+        std::ofstream out(filename, std::ios::binary);
+        out << "1 2 3\n"
+            << "  -4.5\t5e-1 6.25 extra fields\r\n"
+            << "not a point\n"
+            << "\n"
+            << "7 8\n"
+            << "0.1 -1.5e+3 12345678901234567890\n"
+            << "9 10 11";
+    }
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZ(filename, pcd, {}));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>({{1, 2, 3},
+                                           {-4.5, 0.5, 6.25},
+                                           {0.1, -1500, 12345678901234567890.},
+                                           {9, 10, 11}}));
+    utility::filesystem::RemoveFile(filename);
+}
 
 TEST(FileXYZ, DISABLED_WritePointCloudToXYZ) { NotImplemented(); }
 
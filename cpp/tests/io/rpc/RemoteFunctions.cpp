@@ -30,10 +30,12 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 #include "tests/UnitTest.h"
 
@@ -153,6 +155,111 @@ TEST_F(RemoteFunctions, SendReceiveUnpackMessages) {
     }
 }
 
+TEST_F(RemoteFunctions, GetFrameAndSendInputEvent) {
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    Frame frame;
+    frame.data = {1, 2, 3};
+    ASSERT_TRUE(GetFrame(frame, -1, "jpeg", 80, 0, connection));
+    EXPECT_EQ(frame.id, -1);
+    EXPECT_EQ(frame.encoding, "jpeg");
+    // Without new frame data, the data is kept
+    EXPECT_EQ(frame.data.size(), 3u);
+
+    ASSERT_TRUE(SendInputEvent("mouse_down", 10, 20, 1, 0, 0.f, 0.f, 0, "",
+                               connection));
+    receiver.Stop();
+}
+
+TEST_F(RemoteFunctions, SendLargeMeshData) {
+    // Arrays above the zero-copy threshold are sent as separate frames.
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    const core::Tensor no_indices({0}, core::Dtype::Int32);
+    const core::Tensor vertices =
+            core::Tensor::Ones({100000, 3}, core::Dtype::Float32);
+    const core::Tensor colors =
+            core::Tensor::Zeros({100000, 3}, core::Dtype::UInt8);
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    ASSERT_TRUE(SetMeshData(vertices, "group/points", 0, "",
+                            {{"colors", colors}}, no_indices, {}, no_indices,
+                            {}, {}, connection));
+    receiver.Stop();
+
+    // The buffer connection receives the concatenated frames.
+    auto buf_connection = std::make_shared<BufferConnection>();
+    ASSERT_TRUE(SetMeshData(vertices, "group/points", 0, "", {}, no_indices,
+                            {}, no_indices, {}, {}, buf_connection));
+    EXPECT_GT(buf_connection->buffer().str().size(),
+              size_t(vertices.NumElements() * sizeof(float)));
+}
+
+TEST_F(RemoteFunctions, UpdateMeshData) {
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    const core::Tensor colors =
+            core::Tensor::Ones({10, 3}, core::Dtype::Float32);
+    const core::Tensor vertices =
+            core::Tensor::Zeros({10, 3}, core::Dtype::Float64);
+    ASSERT_TRUE(UpdateMeshData("group/points", 0, "",
+                               {{"colors", colors}, {"vertices", vertices}},
+                               20, 100, connection));
+    EXPECT_FALSE(UpdateMeshData("group/points", 0, "", {}, 0, -1, connection));
+    EXPECT_ANY_THROW(UpdateMeshData("group/points", 0, "",
+                                    {{"colors", colors},
+                                     {"vertices", vertices.Slice(0, 0, 5)}},
+                                    0, -1, connection));
+    receiver.Stop();
+
+    messages::UpdateMeshData msg;
+    std::string errstr;
+    EXPECT_FALSE(msg.CheckMessage(errstr));
+    msg.vertex_attributes["colors"] = messages::Array::FromPtr(
+            (float*)colors.GetDataPtr(), {10, 3});
+    msg.vertex_offset = 95;
+    msg.num_vertices = 100;
+    EXPECT_FALSE(msg.CheckMessage(errstr));
+    msg.vertex_offset = 90;
+    EXPECT_TRUE(msg.CheckMessage(errstr));
+}
+
+TEST_F(RemoteFunctions, AsyncConnection) {
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+    {
+        AsyncConnectionOption option;
+        option.max_queue_size = 4;
+        option.max_in_flight = 2;
+        auto connection = std::make_shared<AsyncConnection>(
+                connection_address, 500, 500, option);
+        geometry::PointCloud pcd;
+        pcd.points_.push_back(Eigen::Vector3d(1, 2, 3));
+        for (int i = 0; i < 20; ++i) {
+            ASSERT_TRUE(SetTime(i, connection));
+            ASSERT_TRUE(SetPointCloud(pcd, "", i, "", connection));
+        }
+        ASSERT_TRUE(connection->Flush(5000));
+        EXPECT_EQ(connection->GetQueueSize(), 0u);
+        EXPECT_EQ(connection->GetDroppedCount(), 0u);
+        EXPECT_EQ(connection->GetErrorCount(), 0u);
+
+        // Messages the receiver cannot process are counted as errors.
+        std::string data = CreateSerializedRequestMessage("bla123");
+        connection->Send(data.data(), data.size());
+        ASSERT_TRUE(connection->Flush(5000));
+        EXPECT_EQ(connection->GetErrorCount(), 1u);
+    }
+    receiver.Stop();
+}
+
 TEST_F(RemoteFunctions, SendGarbage) {
     std::mt19937 rng;
     rng.seed(123);
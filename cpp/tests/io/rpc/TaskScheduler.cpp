@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/TaskScheduler.h"
+
+#include <map>
+#include <thread>
+
+#include "open3d/io/rpc/Connection.h"
+#include "open3d/io/rpc/TaskWorker.h"
+#include "open3d/io/rpc/ZMQContext.h"
+#include "tests/UnitTest.h"
+
+using namespace open3d::io::rpc;
+
+namespace open3d {
+namespace tests {
+
+#ifdef _WIN32
+const std::string scheduler_address = "tcp://127.0.0.1:51455";
+#else
+const std::string scheduler_address = "ipc:///tmp/open3d_task_ipc";
+#endif
+
+class TaskScheduler : public testing::Test {
+public:
+    virtual void TearDown() { DestroyZMQContext(); }
+};
+
+TEST_F(TaskScheduler, RetryFailedTasks) {
+    io::rpc::TaskScheduler scheduler(scheduler_address, 10000, 3, 500);
+    scheduler.Start();
+    for (int64_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(scheduler.AddTask({"square", {i}, ""}), i);
+    }
+    scheduler.AddTask({"fail", {}, ""});
+    scheduler.Close();
+
+    auto connection =
+            std::make_shared<Connection>(scheduler_address, 500, 500);
+    TaskWorker worker(connection, "worker");
+    std::map<int64_t, int> num_calls;
+    worker.SetHandler("square", [&](const Task& task, TaskOutcome& outcome) {
+        // The first attempt of each task fails.
+        if (num_calls[task.args_[0]]++ == 0) {
+            throw std::runtime_error("first attempt");
+        }
+        outcome.values_.push_back(double(task.args_[0] * task.args_[0]));
+    });
+    worker.SetHandler("fail", [](const Task& task, TaskOutcome& outcome) {
+        outcome.success_ = false;
+        outcome.error_ = "always fails";
+    });
+    EXPECT_EQ(worker.Run(10), 4 * 2 + 3);
+    EXPECT_TRUE(scheduler.Wait(1000));
+    scheduler.Stop();
+
+    EXPECT_EQ(scheduler.GetTaskCount(), 5);
+    EXPECT_EQ(scheduler.GetFailedTaskCount(), 1);
+    for (int64_t i = 0; i < 4; ++i) {
+        TaskOutcome outcome = scheduler.GetOutcome(i);
+        EXPECT_TRUE(outcome.success_);
+        EXPECT_EQ(outcome.attempts_, 2);
+        EXPECT_EQ(outcome.worker_, "worker");
+        ASSERT_EQ(outcome.values_.size(), 1u);
+        EXPECT_EQ(outcome.values_[0], double(i * i));
+    }
+    TaskOutcome outcome = scheduler.GetOutcome(4);
+    EXPECT_FALSE(outcome.success_);
+    EXPECT_EQ(outcome.attempts_, 3);
+    EXPECT_EQ(outcome.error_, "worker: always fails");
+}
+
+TEST_F(TaskScheduler, RestartLostTasks) {
+    io::rpc::TaskScheduler scheduler(scheduler_address, 100, 3, 500);
+    scheduler.Start();
+    scheduler.AddTask({"echo", {7}, "payload"});
+    scheduler.Close();
+
+    // A worker that takes a task and dies.
+    {
+        auto connection =
+                std::make_shared<Connection>(scheduler_address, 500, 500);
+        TaskWorker worker(connection, "lost");
+        worker.SetHandler("echo", [](const Task& task, TaskOutcome& outcome) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+            throw std::runtime_error("not reached in time");
+        });
+        std::thread lost_worker([&]() { worker.Run(10, 1); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+
+        auto connection2 =
+                std::make_shared<Connection>(scheduler_address, 500, 500);
+        TaskWorker worker2(connection2, "second");
+        worker2.SetHandler("echo", [](const Task& task, TaskOutcome& outcome) {
+            outcome.data_ = task.payload_;
+        });
+        EXPECT_EQ(worker2.Run(10), 1);
+        lost_worker.join();
+    }
+    EXPECT_TRUE(scheduler.Wait(1000));
+    scheduler.Stop();
+
+    TaskOutcome outcome = scheduler.GetOutcome(0);
+    EXPECT_TRUE(outcome.success_);
+    EXPECT_EQ(outcome.attempts_, 2);
+    EXPECT_EQ(outcome.worker_, "second");
+    EXPECT_EQ(outcome.data_, "payload");
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <algorithm>
+#include <array>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -43,7 +50,67 @@ TEST(ScalableTSDFVolume, DISABLED_Integrate) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) { NotImplemented(); }
+TEST(ScalableTSDFVolume, ExtractTriangleMesh) {
+    // A sphere crossing the boundaries of 4 x 4 x 4 units.
+    const double voxel_length = 0.01;
+    const double radius = 0.12;
+    const int resolution = 8;
+    pipelines::integration::ScalableTSDFVolume volume(
+            voxel_length, 0.04,
+            pipelines::integration::TSDFVolumeColorType::NoColor, resolution);
+    for (int ux = -2; ux < 2; ux++) {
+        for (int uy = -2; uy < 2; uy++) {
+            for (int uz = -2; uz < 2; uz++) {
+                Eigen::Vector3i index(ux, uy, uz);
+                auto &unit = volume.volume_units_[index];
+                unit.index_ = index;
+                unit.volume_ = std::make_shared<
+                        pipelines::integration::UniformTSDFVolume>(
+                        volume.volume_unit_length_, resolution, 0.04,
+                        pipelines::integration::TSDFVolumeColorType::NoColor,
+                        index.cast<double>() * volume.volume_unit_length_);
+                for (int i = 0; i < resolution * resolution * resolution;
+                     i++) {
+                    Eigen::Vector3i xyz(i / (resolution * resolution),
+                                        (i / resolution) % resolution,
+                                        i % resolution);
+                    Eigen::Vector3d p = ((index * resolution + xyz)
+                                                 .cast<double>()
+                                                 .array() +
+                                         0.5) *
+                                        voxel_length;
+                    auto &voxel =
+                            unit.volume_->voxels_[unit.volume_->IndexOf(xyz)];
+                    voxel.tsdf_ = float(std::max(
+                            -1.0, std::min(1.0, (p.norm() - radius) / 0.04)));
+                    voxel.weight_ = 1.0f;
+                }
+            }
+        }
+    }
+    auto mesh = volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+
+    // Vertices shared by cubes of different units are merged, and all of
+    // them are used.
+    std::vector<std::array<double, 3>> vertices;
+    for (const auto &v : mesh->vertices_) {
+        EXPECT_NEAR(v.norm(), radius, voxel_length);
+        vertices.push_back({v(0), v(1), v(2)});
+    }
+    std::sort(vertices.begin(), vertices.end());
+    EXPECT_TRUE(std::adjacent_find(vertices.begin(), vertices.end()) ==
+                vertices.end());
+    std::vector<bool> used(mesh->vertices_.size(), false);
+    for (const auto &triangle : mesh->triangles_) {
+        for (int j = 0; j < 3; j++) {
+            ASSERT_GE(triangle(j), 0);
+            ASSERT_LT(triangle(j), int(mesh->vertices_.size()));
+            used[triangle(j)] = true;
+        }
+    }
+    EXPECT_EQ(std::count(used.begin(), used.end(), false), 0);
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) { NotImplemented(); }
 
@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/io/ImageIO.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -31,6 +39,52 @@ namespace tests {
 
 TEST(Odometry, DISABLED_ComputeRGBDOdometry) { NotImplemented(); }
 
+TEST(Odometry, RGBDOdometryTracker) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    std::vector<std::shared_ptr<geometry::RGBDImage>> frames;
+    for (int i = 0; i < 3; ++i) {
+        geometry::Image im_color;
+        std::ostringstream im_color_path;
+        im_color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+                      << std::setw(5) << i << ".jpg";
+        io::ReadImage(im_color_path.str(), im_color);
+
+        geometry::Image im_depth;
+        std::ostringstream im_depth_path;
+        im_depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+                      << std::setw(5) << i << ".png";
+        io::ReadImage(im_depth_path.str(), im_depth);
+
+        frames.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                im_color, im_depth, /*depth_scale*/ 1000.0,
+                /*depth_func*/ 3.0, /*convert_rgb_to_intensity*/ false));
+    }
+
+    pipelines::odometry::RGBDOdometryTracker tracker(intrinsic);
+    EXPECT_FALSE(std::get<0>(tracker.Track(*frames[0])));
+    EXPECT_TRUE(tracker.HasReference());
+
+    // Reusing the pyramids of the previous frame gives the pairwise result.
+    for (size_t i = 1; i < frames.size(); ++i) {
+        bool success, ref_success;
+        Eigen::Matrix4d trans, ref_trans;
+        Eigen::Matrix6d info, ref_info;
+        std::tie(success, trans, info) = tracker.Track(*frames[i]);
+        std::tie(ref_success, ref_trans, ref_info) =
+                pipelines::odometry::ComputeRGBDOdometry(
+                        *frames[i], *frames[i - 1], intrinsic);
+        EXPECT_TRUE(ref_success);
+        EXPECT_EQ(success, ref_success);
+        ExpectEQ(ref_trans, trans);
+        ExpectEQ(ref_info, info);
+    }
+
+    tracker.Reset();
+    EXPECT_FALSE(tracker.HasReference());
+}
+
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { NotImplemented(); }
 
 TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
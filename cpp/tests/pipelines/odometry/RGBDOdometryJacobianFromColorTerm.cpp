@@ -108,5 +108,77 @@ TEST(RGBDOdometryJacobianFromColorTerm, ComputeJacobianAndResidual) {
     }
 }
 
+TEST(RGBDOdometryJacobianFromColorTerm, ComputeJTJandJTr) {
+    int width = 10;
+    int height = 10;
+
+    auto srcColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+    auto srcDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 0);
+
+    auto tgtColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+    auto tgtDepth = GenerateImage(width, height, 1, 4, 1.0f, 2.0f, 0);
+
+    auto dxColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+    auto dyColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+
+    ShiftLeft(tgtColor, 10);
+    ShiftUp(tgtColor, 5);
+
+    ShiftLeft(dxColor, 10);
+    ShiftUp(dyColor, 5);
+
+    geometry::RGBDImage source(*srcColor, *srcDepth);
+    geometry::RGBDImage target(*tgtColor, *tgtDepth);
+    auto source_xyz = GenerateImage(width, height, 3, 4, 0.0f, 1.0f, 0);
+    geometry::RGBDImage target_dx(*dxColor, *tgtDepth);
+    geometry::RGBDImage target_dy(*dyColor, *tgtDepth);
+
+    Eigen::Matrix3d intrinsic = Eigen::Matrix3d::Zero();
+    intrinsic(0, 0) = 0.5;
+    intrinsic(1, 1) = 0.65;
+    intrinsic(0, 2) = 0.75;
+    intrinsic(1, 2) = 0.35;
+
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Zero();
+    extrinsic(0, 0) = 1.0;
+    extrinsic(1, 1) = 1.0;
+    extrinsic(2, 2) = 1.0;
+
+    int rows = height;
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> corresps(rows);
+    Rand(corresps, 0, 3, 0);
+
+    pipelines::odometry::RGBDOdometryJacobianFromColorTerm jacobian_method;
+
+    Eigen::Matrix6d ref_JTJ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d ref_JTr = Eigen::Vector6d::Zero();
+    double ref_r2 = 0.0;
+    for (int row = 0; row < rows; row++) {
+        std::vector<Eigen::Vector6d, utility::Vector6d_allocator> J_r;
+        std::vector<double> r;
+        std::vector<double> w;
+
+        jacobian_method.ComputeJacobianAndResidual(
+                row, J_r, r, w, source, target, *source_xyz, target_dx,
+                target_dy, intrinsic, extrinsic, corresps);
+        for (size_t i = 0; i < r.size(); i++) {
+            ref_JTJ += J_r[i] * w[i] * J_r[i].transpose();
+            ref_JTr += J_r[i] * w[i] * r[i];
+            ref_r2 += r[i] * r[i];
+        }
+    }
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, *source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic, corresps);
+
+    ExpectEQ(ref_JTJ, JTJ);
+    ExpectEQ(ref_JTr, JTr);
+    EXPECT_NEAR(ref_r2, r2, THRESHOLD_1E_6);
+}
+
 }  // namespace tests
 }  // namespace open3d
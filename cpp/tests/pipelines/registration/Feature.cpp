@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Feature.h"
+
+#include "open3d/geometry/KDTreeFlann.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +42,33 @@ TEST(Feature, DISABLED_ComputeFPFHFeature) { NotImplemented(); }
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { NotImplemented(); }
 
+TEST(Feature, EstimateFeatureMatchingRecall) {
+    pipelines::registration::Feature reference;
+    pipelines::registration::Feature query;
+    reference.Resize(33, 500);
+    query.Resize(33, 100);
+    Rand(reference.data_.data(), reference.data_.size(), 0.0, 100.0, 0);
+    Rand(query.data_.data(), query.data_.size(), 0.0, 100.0, 1);
+
+    // Exact matching always finds the true nearest neighbor.
+    pipelines::registration::FeatureMatchingOption exact;
+    geometry::KDTreeFlann kdtree;
+    exact.Apply(kdtree);
+    kdtree.SetFeature(reference);
+    EXPECT_EQ(pipelines::registration::EstimateFeatureMatchingRecall(
+                      kdtree, reference, query, 50),
+              1.0);
+
+    // Approximate matching with a single check misses some neighbors in 33
+    // dimensions, but never reports an invalid recall.
+    pipelines::registration::FeatureMatchingOption approximate(4, 1);
+    EXPECT_TRUE(approximate.IsApproximate());
+    approximate.Apply(kdtree);
+    double recall = pipelines::registration::EstimateFeatureMatchingRecall(
+            kdtree, reference, query, 50);
+    EXPECT_GE(recall, 0.0);
+    EXPECT_LE(recall, 1.0);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include "open3d/pipelines/registration/PoseGraph.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -49,5 +52,160 @@ TEST(GlobalOptimization, DISABLED_CreatePoseGraphWithoutInvalidEdges) {
     NotImplemented();
 }
 
+// A loop of 6 nodes with slightly inconsistent odometry, two consistent loop
+// closures and one outlier loop closure.
+static pipelines::registration::PoseGraph CreateLoopClosurePoseGraph() {
+    const int n_nodes = 6;
+    std::vector<Eigen::Matrix4d> poses;
+    for (int i = 0; i < n_nodes; i++) {
+        double angle = 2.0 * M_PI * i / n_nodes;
+        Eigen::Vector6d pose_vector;
+        pose_vector << 0.1 * std::sin(angle), 0.05 * std::cos(angle), angle,
+                std::cos(angle), std::sin(angle), 0.1 * i;
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose_vector));
+    }
+
+    pipelines::registration::PoseGraph pose_graph;
+    Eigen::Matrix4d pose = poses[0];
+    for (int i = 0; i < n_nodes; i++) {
+        pose_graph.nodes_.push_back(
+                pipelines::registration::PoseGraphNode(pose));
+        if (i + 1 < n_nodes) {
+            Eigen::Vector6d noise;
+            noise << 0.002 * i, -0.001, 0.002, 0.004, -0.002 * i, 0.001;
+            Eigen::Matrix4d odometry =
+                    utility::TransformVector6dToMatrix4d(noise) *
+                    poses[i + 1].inverse() * poses[i];
+            pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+                    i, i + 1, odometry, Eigen::Matrix6d::Identity(),
+                    /*uncertain=*/false));
+            pose = pose * odometry.inverse();
+        }
+    }
+    pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+            0, 5, poses[5].inverse() * poses[0], Eigen::Matrix6d::Identity(),
+            /*uncertain=*/true));
+    pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+            1, 4, poses[4].inverse() * poses[1], Eigen::Matrix6d::Identity(),
+            /*uncertain=*/true));
+    Eigen::Vector6d outlier;
+    outlier << 0.5, -0.3, 0.8, 1.0, -2.0, 0.7;
+    pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+            2, 5,
+            utility::TransformVector6dToMatrix4d(outlier) *
+                    poses[5].inverse() * poses[2],
+            Eigen::Matrix6d::Identity(), /*uncertain=*/true));
+    return pose_graph;
+}
+
+static void ExpectOptimizedLoopClosurePoseGraph(
+        const pipelines::registration::PoseGraph &pose_graph,
+        const std::vector<Eigen::Vector6d> &expected_poses) {
+    // Only the outlier loop closure is pruned.
+    ASSERT_EQ(pose_graph.edges_.size(), 7u);
+    for (const auto &edge : pose_graph.edges_) {
+        EXPECT_FALSE(edge.source_node_id_ == 2 && edge.target_node_id_ == 5);
+    }
+    ASSERT_EQ(pose_graph.nodes_.size(), expected_poses.size());
+    for (size_t i = 0; i < expected_poses.size(); i++) {
+        ExpectEQ(utility::TransformMatrix4dToVector6d(
+                         pose_graph.nodes_[i].pose_),
+                 expected_poses[i], 1e-6);
+    }
+}
+
+TEST(GlobalOptimization, GaussNewtonLoopClosure) {
+    pipelines::registration::PoseGraph pose_graph =
+            CreateLoopClosurePoseGraph();
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationGaussNewton(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            pipelines::registration::GlobalOptimizationOption(0.05, 0.25, 1.0,
+                                                              0));
+
+    // Result of the previous dense Gauss-Newton solver.
+    std::vector<Eigen::Vector6d> expected_poses(6);
+    expected_poses[0] << 0.0, 0.05, 0.0, 1.0, 0.0, 0.0;
+    expected_poses[1] << 0.0851053889, 0.0245591742, 1.0464537224,
+            0.4960318547, 0.8615239681, 0.0994630300;
+    expected_poses[2] << 0.0830004398, -0.0203457126, 2.0920531322,
+            -0.5071993769, 0.8589800079, 0.1946532176;
+    expected_poses[3] << 0.0000389224, -0.0429296026, 3.1384903660,
+            -1.0077606923, -0.0089468459, 0.2931348275;
+    expected_poses[4] << -0.0853377220, -0.0226278212, -2.0949143346,
+            -0.5029977990, -0.8721316322, 0.3962802351;
+    expected_poses[5] << -0.0887334556, 0.0254522388, -1.0484580831,
+            0.5006331459, -0.8646889383, 0.5007993467;
+    ExpectOptimizedLoopClosurePoseGraph(pose_graph, expected_poses);
+}
+
+TEST(GlobalOptimization, LevenbergMarquardtLoopClosure) {
+    pipelines::registration::PoseGraph pose_graph =
+            CreateLoopClosurePoseGraph();
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationLevenbergMarquardt(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            pipelines::registration::GlobalOptimizationOption(0.05, 0.25, 1.0,
+                                                              0));
+
+    // Result of the previous dense Levenberg-Marquardt solver.
+    std::vector<Eigen::Vector6d> expected_poses(6);
+    expected_poses[0] << 0.0, 0.05, 0.0, 1.0, 0.0, 0.0;
+    expected_poses[1] << 0.0851053631, 0.0245591748, 1.0464537333,
+            0.4960318175, 0.8615239597, 0.0994630019;
+    expected_poses[2] << 0.0830004061, -0.0203457033, 2.0920531532,
+            -0.5071993937, 0.8589799642, 0.1946531583;
+    expected_poses[3] << 0.0000388933, -0.0429295514, 3.1384903880,
+            -1.0077606737, -0.0089469182, 0.2931347218;
+    expected_poses[4] << -0.0853376877, -0.0226277398, -2.0949143370,
+            -0.5029977694, -0.8721317306, 0.3962801234;
+    expected_poses[5] << -0.0887333698, 0.0254522383, -1.0484580426,
+            0.5006331413, -0.8646890008, 0.5007993096;
+    ExpectOptimizedLoopClosurePoseGraph(pose_graph, expected_poses);
+}
+
+TEST(GlobalOptimization, IncrementalGlobalOptimization) {
+    // Poses on a circle, observed by exact odometry and loop closure edges
+    // while the node initializations are perturbed.
+    const int n_nodes = 40;
+    std::vector<Eigen::Matrix4d> poses;
+    for (int i = 0; i < n_nodes; i++) {
+        double angle = 2.0 * M_PI * i / n_nodes;
+        Eigen::Vector6d pose_vector;
+        pose_vector << 0.0, 0.0, angle, std::cos(angle), std::sin(angle), 0.0;
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose_vector));
+    }
+
+    pipelines::registration::IncrementalGlobalOptimization optimization;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d noise;
+        noise << 0.01, -0.01, 0.02, 0.03, -0.02, 0.01;
+        Eigen::Matrix4d init = poses[i];
+        if (i > 0) {
+            init = utility::TransformVector6dToMatrix4d(noise) * poses[i];
+        }
+        EXPECT_EQ(optimization.AddNode(
+                          pipelines::registration::PoseGraphNode(init)),
+                  i);
+        if (i > 0) {
+            optimization.AddEdge(pipelines::registration::PoseGraphEdge(
+                    i - 1, i, poses[i].inverse() * poses[i - 1]));
+        }
+        if (i > 0 && i % 10 == 0) {
+            optimization.AddEdge(pipelines::registration::PoseGraphEdge(
+                    0, i, poses[i].inverse() * poses[0]));
+        }
+        optimization.OptimizeIncremental();
+    }
+
+    const pipelines::registration::PoseGraph &pose_graph =
+            optimization.GetPoseGraph();
+    for (int i = 0; i < n_nodes; i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-4);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Registration.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/PointCloudFloat.h"
+#include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -49,8 +55,102 @@ TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
-    NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnCorrespondence) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(0.0, 0.0, 1.0))
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.5, -0.2, 0.1);
+
+    geometry::PointCloud source;
+    source.points_.resize(200);
+    Rand(source.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+
+    // 150 correct correspondences and 50 outliers.
+    pipelines::registration::CorrespondenceSet corres;
+    for (int i = 0; i < 200; i++) {
+        corres.push_back(Eigen::Vector2i(i, i < 150 ? i : (i * 7) % 150));
+    }
+
+    pipelines::registration::CorrespondenceCheckerBasedOnEdgeLength
+            edge_checker(0.9);
+    auto result =
+            pipelines::registration::RegistrationRANSACBasedOnCorrespondence(
+                    source, target, corres, 0.01,
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    3, {edge_checker},
+                    pipelines::registration::RANSACConvergenceCriteria(
+                            10000, 0.999));
+
+    EXPECT_GE(result.correspondence_set_.size(), 150u);
+    EXPECT_NEAR(result.fitness_, 0.75, 0.01);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-6);
+}
+
+TEST(Registration, RegistrationICPMultiPair) {
+    std::vector<geometry::PointCloud> fragments(3);
+    for (int i = 0; i < 3; i++) {
+        fragments[i].points_.resize(100);
+        Rand(fragments[i].points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+             Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+        Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+        transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01 * i, 0.0, 0.0);
+        fragments[i].Transform(transformation);
+    }
+    std::vector<std::reference_wrapper<const geometry::PointCloud>> refs(
+            fragments.begin(), fragments.end());
+    std::vector<pipelines::registration::RegistrationPair> pairs = {
+            {0, 1}, {0, 2}, {1, 2}, {2, 0}};
+
+    auto results = pipelines::registration::RegistrationICPMultiPair(
+            refs, pairs, 0.05);
+    ASSERT_EQ(results.size(), pairs.size());
+    for (size_t k = 0; k < pairs.size(); k++) {
+        auto expected = pipelines::registration::RegistrationICP(
+                fragments[pairs[k].source_id_], fragments[pairs[k].target_id_],
+                0.05);
+        EXPECT_NEAR(results[k].fitness_, expected.fitness_, 1e-8);
+        EXPECT_NEAR(results[k].inlier_rmse_, expected.inlier_rmse_, 1e-8);
+        ExpectEQ(Eigen::Matrix4d(results[k].transformation_),
+                 Eigen::Matrix4d(expected.transformation_), 1e-8);
+    }
+}
+
+TEST(Registration, RegistrationICPFloat) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(0.0, 0.0, 1.0))
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.01);
+
+    geometry::PointCloud source;
+    source.points_.resize(500);
+    Rand(source.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+    geometry::PointCloudFloat source_float(source);
+    geometry::PointCloudFloat target_float(target);
+
+    auto result = pipelines::registration::RegistrationICP(
+            source_float, target_float, 0.1, Eigen::Matrix4d::Identity(),
+            pipelines::registration::TransformationEstimationPointToPoint(),
+            pipelines::registration::ICPConvergenceCriteria(1e-6, 1e-6, 100));
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-8);
+    EXPECT_LT(result.inlier_rmse_, 1e-5);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-4);
+
+    target_float.EstimateNormals();
+    result = pipelines::registration::RegistrationICP(
+            source_float, target_float, 0.1, Eigen::Matrix4d::Identity(),
+            pipelines::registration::TransformationEstimationPointToPlane(),
+            pipelines::registration::ICPConvergenceCriteria(1e-6, 1e-6, 100));
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-8);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-4);
 }
 
 TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
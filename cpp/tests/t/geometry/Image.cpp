@@ -176,9 +176,7 @@ TEST_P(ImagePermuteDevices, Copy) {
 
 // Test automatic scale determination for conversion from UInt8 / UInt16 ->
 // Float32/64 and LinearTransform().
-// Currently needs IPP.
-TEST_P(ImagePermuteDevices,
-       OPEN3D_CONCATENATE(IPP_CONDITIONAL_TEST_STR, To_LinearTransform)) {
+TEST_P(ImagePermuteDevices, To_LinearTransform) {
     using ::testing::ElementsAreArray;
     using ::testing::FloatEq;
     core::Device device = GetParam();
@@ -239,21 +237,15 @@ TEST_P(ImagePermuteDevices, FilterBilateral) {
                                          core::Dtype::Float32, device);
 
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterBilateral(3, 10, 10), std::runtime_error);
+        im = im.FilterBilateral(3, 10, 10);
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_ipp, {5, 5, 1},
+                                 core::Dtype::Float32, device)));
         } else {
-            im = im.FilterBilateral(3, 10, 10);
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_ipp, {5, 5, 1},
-                                     core::Dtype::Float32, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_npp, {5, 5, 1},
-                                     core::Dtype::Float32, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_npp, {5, 5, 1},
+                                 core::Dtype::Float32, device)));
         }
     }
 
@@ -283,23 +275,17 @@ TEST_P(ImagePermuteDevices, FilterBilateral) {
                 core::Tensor(input_data, {5, 5, 1}, core::Dtype::UInt8, device);
 
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterBilateral(3, 5, 5), std::runtime_error);
+        im = im.FilterBilateral(3, 5, 5);
+        utility::LogInfo("{}", im.AsTensor().View({5, 5}).ToString());
+
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_ipp, {5, 5, 1},
+                                 core::Dtype::UInt8, device)));
         } else {
-            im = im.FilterBilateral(3, 5, 5);
-            utility::LogInfo("{}", im.AsTensor().View({5, 5}).ToString());
-
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_ipp, {5, 5, 1},
-                                     core::Dtype::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_npp, {5, 5, 1},
-                                     core::Dtype::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_npp, {5, 5, 1},
+                                 core::Dtype::UInt8, device)));
         }
     }
 }
@@ -328,15 +314,9 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data = core::Tensor(input_data, {5, 5, 1},
                                          core::Dtype::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
-        } else {
-            im = im.FilterGaussian(3);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {5, 5, 1}, core::Dtype::Float32, device)));
-        }
+        im = im.FilterGaussian(3);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {5, 5, 1}, core::Dtype::Float32, device)));
     }
 
     {  // UInt8
@@ -364,23 +344,17 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data =
                 core::Tensor(input_data, {5, 5, 1}, core::Dtype::UInt8, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
+        im = im.FilterGaussian(3);
+        utility::LogInfo("{}", im.AsTensor().View({5, 5}).ToString());
+
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_ipp, {5, 5, 1},
+                                 core::Dtype::UInt8, device)));
         } else {
-            im = im.FilterGaussian(3);
-            utility::LogInfo("{}", im.AsTensor().View({5, 5}).ToString());
-
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_ipp, {5, 5, 1},
-                                     core::Dtype::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_npp, {5, 5, 1},
-                                     core::Dtype::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_npp, {5, 5, 1},
+                                 core::Dtype::UInt8, device)));
         }
     }
 }
@@ -410,15 +384,8 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Dtype::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
-        } else {
-            t::geometry::Image im_new = im.Filter(kernel);
-            EXPECT_TRUE(
-                    im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
-        }
+        t::geometry::Image im_new = im.Filter(kernel);
+        EXPECT_TRUE(im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
     }
 
     {  // UInt8
@@ -458,23 +425,17 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Dtype::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
+        im = im.Filter(kernel);
+        utility::LogInfo("{}", im.AsTensor().View({5, 5}).ToString());
+
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_ipp, {5, 5, 1},
+                                 core::Dtype::UInt8, device)));
         } else {
-            im = im.Filter(kernel);
-            utility::LogInfo("{}", im.AsTensor().View({5, 5}).ToString());
-
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_ipp, {5, 5, 1},
-                                     core::Dtype::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_npp, {5, 5, 1},
-                                     core::Dtype::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_npp, {5, 5, 1},
+                                 core::Dtype::UInt8, device)));
         }
     }
 }
@@ -508,19 +469,13 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                                          core::Dtype::Float32, device);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
+        std::tie(dx, dy) = im.FilterSobel(3);
 
-            EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
-                    output_dx_ref, {5, 5, 1}, core::Dtype::Float32, device)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
-                    output_dy_ref, {5, 5, 1}, core::Dtype::Float32, device)));
-            utility::LogInfo("{}", dx.AsTensor().View({5, 5}).ToString());
-        }
+        EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
+                output_dx_ref, {5, 5, 1}, core::Dtype::Float32, device)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
+                output_dy_ref, {5, 5, 1}, core::Dtype::Float32, device)));
+        utility::LogInfo("{}", dx.AsTensor().View({5, 5}).ToString());
     }
 
     {  // UInt8 -> Int16
@@ -529,23 +484,17 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                                     .To(core::Dtype::UInt8);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
-
-            EXPECT_TRUE(dx.AsTensor().AllClose(
-                    core::Tensor(output_dx_ref, {5, 5, 1}, core::Dtype::Float32,
-                                 device)
-                            .To(core::Dtype::Int16)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(
-                    core::Tensor(output_dy_ref, {5, 5, 1}, core::Dtype::Float32,
-                                 device)
-                            .To(core::Dtype::Int16)));
-            utility::LogInfo("{}", dx.AsTensor().View({5, 5}).ToString());
-        }
+        std::tie(dx, dy) = im.FilterSobel(3);
+
+        EXPECT_TRUE(dx.AsTensor().AllClose(
+                core::Tensor(output_dx_ref, {5, 5, 1}, core::Dtype::Float32,
+                             device)
+                        .To(core::Dtype::Int16)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(
+                core::Tensor(output_dy_ref, {5, 5, 1}, core::Dtype::Float32,
+                             device)
+                        .To(core::Dtype::Int16)));
+        utility::LogInfo("{}", dx.AsTensor().View({5, 5}).ToString());
     }
 }
 
@@ -570,17 +519,9 @@ TEST_P(ImagePermuteDevices, Resize) {
         core::Tensor data = core::Tensor(input_data, {6, 6, 1},
                                          core::Dtype::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(
-                    im.Resize(0.5, t::geometry::Image::InterpType::Nearest),
-                    std::runtime_error);
-        } else {
-            im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Dtype::Float32, device)));
-        }
+        im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Dtype::Float32, device)));
     }
     {  // UInt8
         // clang-format off
@@ -604,40 +545,33 @@ TEST_P(ImagePermuteDevices, Resize) {
         core::Tensor data =
                 core::Tensor(input_data, {6, 6, 1}, core::Dtype::UInt8, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Resize(0.5, t::geometry::Image::InterpType::Super),
-                         std::runtime_error);
+        t::geometry::Image im_low =
+                im.Resize(0.5, t::geometry::Image::InterpType::Super);
+        utility::LogInfo("{}", im_low.AsTensor().View({3, 3}).ToString());
+
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im_low.AsTensor().AllClose(
+                    core::Tensor(output_ref_ipp, {3, 3, 1},
+                                 core::Dtype::UInt8, device)));
         } else {
-            t::geometry::Image im_low =
-                    im.Resize(0.5, t::geometry::Image::InterpType::Super);
-            utility::LogInfo("{}", im_low.AsTensor().View({3, 3}).ToString());
-
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im_low.AsTensor().AllClose(
-                        core::Tensor(output_ref_ipp, {3, 3, 1},
-                                     core::Dtype::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im_low.AsTensor().AllClose(
-                        core::Tensor(output_ref_npp, {3, 3, 1},
-                                     core::Dtype::UInt8, device)));
-
-                // Check output in the CI to see if other inteprolations works
-                // with other platforms
-                im_low = im.Resize(0.5, t::geometry::Image::InterpType::Linear);
-                utility::LogInfo("Linear: {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-
-                im_low = im.Resize(0.5, t::geometry::Image::InterpType::Cubic);
-                utility::LogInfo("Cubic: {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-
-                im_low =
-                        im.Resize(0.5, t::geometry::Image::InterpType::Lanczos);
-                utility::LogInfo("Lanczos: {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-            }
+            EXPECT_TRUE(im_low.AsTensor().AllClose(
+                    core::Tensor(output_ref_npp, {3, 3, 1},
+                                 core::Dtype::UInt8, device)));
+
+            // Check output in the CI to see if other inteprolations works
+            // with other platforms
+            im_low = im.Resize(0.5, t::geometry::Image::InterpType::Linear);
+            utility::LogInfo("Linear: {}",
+                             im_low.AsTensor().View({3, 3}).ToString());
+
+            im_low = im.Resize(0.5, t::geometry::Image::InterpType::Cubic);
+            utility::LogInfo("Cubic: {}",
+                             im_low.AsTensor().View({3, 3}).ToString());
+
+            im_low =
+                    im.Resize(0.5, t::geometry::Image::InterpType::Lanczos);
+            utility::LogInfo("Lanczos: {}",
+                             im_low.AsTensor().View({3, 3}).ToString());
         }
     }
 }
@@ -664,15 +598,9 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                                          core::Dtype::Float32, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
-        } else {
-            im = im.PyrDown();
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Dtype::Float32, device)));
-        }
+        im = im.PyrDown();
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Dtype::Float32, device)));
     }
 
     {  // UInt8
@@ -698,23 +626,78 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                 core::Tensor(input_data, {6, 6, 1}, core::Dtype::UInt8, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
+        im = im.PyrDown();
+        utility::LogInfo("{}", im.AsTensor().View({3, 3}).ToString());
+
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_ipp, {3, 3, 1},
+                                 core::Dtype::UInt8, device)));
         } else {
-            im = im.PyrDown();
-            utility::LogInfo("{}", im.AsTensor().View({3, 3}).ToString());
-
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_ipp, {3, 3, 1},
-                                     core::Dtype::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(
-                        core::Tensor(output_ref_npp, {3, 3, 1},
-                                     core::Dtype::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(
+                    core::Tensor(output_ref_npp, {3, 3, 1},
+                                 core::Dtype::UInt8, device)));
+        }
+    }
+}
+
+TEST_P(ImagePermuteDevices, PyrDownDepth) {
+    core::Device device = GetParam();
+
+    // clang-format off
+    const std::vector<float> input_data =
+      {1, 1, 2, 2,
+       1, 1, 2, 2,
+       0, 0, 3, 3,
+       0, 0, 3, 3};
+    const std::vector<float> output_ref =
+      {1, 2,
+       0, 3};
+    // clang-format on
+
+    core::Tensor data =
+            core::Tensor(input_data, {4, 4, 1}, core::Dtype::Float32, device);
+    t::geometry::Image im(data);
+
+    // Only valid neighbors with a similar depth are averaged.
+    im = im.PyrDownDepth(/* diff_threshold = */ 0.5,
+                         /* invalid_fill = */ 0);
+    EXPECT_TRUE(im.AsTensor().AllClose(
+            core::Tensor(output_ref, {2, 2, 1}, core::Dtype::Float32, device)));
+}
+
+TEST_P(ImagePermuteDevices, AlignDepth) {
+    core::Device device = GetParam();
+
+    const int64_t rows = 16, cols = 16;
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{100, 0, 8}, {0, 100, 8}, {0, 0, 1}});
+
+    std::vector<uint16_t> depth_data(rows * cols);
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        depth_data[i] = static_cast<uint16_t>(1000 + i);
+    }
+    t::geometry::Image depth(core::Tensor(depth_data, {rows, cols, 1},
+                                          core::Dtype::UInt16, device));
+
+    // Identical cameras: the depth image is reproduced exactly.
+    core::Tensor identity = core::Tensor::Eye(4, core::Dtype::Float64,
+                                              core::Device("CPU:0"));
+    t::geometry::Image aligned = depth.AlignDepth(rows, cols, intrinsics,
+                                                  intrinsics, identity);
+    EXPECT_TRUE(aligned.AsTensor().AllClose(depth.AsTensor()));
+
+    // A 0.1m baseline at 1m shifts the depth by fx * 0.1 = 10 pixels.
+    depth = t::geometry::Image(core::Tensor::Full(
+            {rows, cols, 1}, 1000, core::Dtype::UInt16, device));
+    core::Tensor extrinsics = identity.Clone();
+    extrinsics[0][3] = 0.1;
+    aligned = depth.AlignDepth(rows, cols, intrinsics, intrinsics, extrinsics);
+
+    core::Tensor aligned_cpu = aligned.AsTensor().To(core::Device("CPU:0"));
+    for (int64_t v = 0; v < rows; ++v) {
+        for (int64_t u = 0; u < cols; ++u) {
+            EXPECT_EQ(aligned_cpu[v][u][0].Item<uint16_t>(), u < 10 ? 0 : 1000);
         }
     }
 }
@@ -752,46 +735,31 @@ TEST_P(ImagePermuteDevices, Dilate) {
     core::Tensor t_input_uint8_t =
             t_input.To(core::Dtype::UInt8);  // normal static_cast is OK
     t::geometry::Image input_uint8_t(t_input_uint8_t);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(input_uint8_t.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input_uint8_t.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<uint8_t>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input_uint8_t.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<uint8_t>(),
+                ElementsAreArray(output_ref));
 
     // UInt16
     core::Tensor t_input_uint16_t =
             t_input.To(core::Dtype::UInt16);  // normal static_cast is OK
     t::geometry::Image input_uint16_t(t_input_uint16_t);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(input_uint16_t.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input_uint16_t.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<uint16_t>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input_uint16_t.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<uint16_t>(),
+                ElementsAreArray(output_ref));
 
     // Float32
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(input.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<float>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<float>(),
+                ElementsAreArray(output_ref));
 }
 
 // tImage: (r, c, ch) | legacy Image: (u, v, ch) = (c, r, ch)
@@ -859,22 +827,16 @@ TEST_P(ImagePermuteDevices, DISABLED_CreateNormalMap) {
     // We have to apply a bilateral filter, otherwise normals would be too
     // noisy.
     auto depth_clipped = depth.ClipTransform(1000.0, 0.0, 3.0, invalid_fill);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(depth_clipped.FilterBilateral(5, 5.0, 10.0),
-                     std::runtime_error);
-    } else {
-        auto depth_bilateral = depth_clipped.FilterBilateral(5, 5.0, 10.0);
-        auto vertex_map_for_normal =
-                depth_bilateral.CreateVertexMap(intrinsic_t, invalid_fill);
-        auto normal_map = vertex_map_for_normal.CreateNormalMap(invalid_fill);
-
-        // Use abs for better visualization
-        normal_map.AsTensor() = normal_map.AsTensor().Abs();
-        visualization::DrawGeometries(
-                {std::make_shared<open3d::geometry::Image>(
-                        normal_map.ToLegacyImage())});
-    }
+    auto depth_bilateral = depth_clipped.FilterBilateral(5, 5.0, 10.0);
+    auto vertex_map_for_normal =
+            depth_bilateral.CreateVertexMap(intrinsic_t, invalid_fill);
+    auto normal_map = vertex_map_for_normal.CreateNormalMap(invalid_fill);
+
+    // Use abs for better visualization
+    normal_map.AsTensor() = normal_map.AsTensor().Abs();
+    visualization::DrawGeometries(
+            {std::make_shared<open3d::geometry::Image>(
+                    normal_map.ToLegacyImage())});
 }
 
 TEST_P(ImagePermuteDevices, DISABLED_ColorizeDepth) {
@@ -28,10 +28,18 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/Keypoint.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -121,6 +129,122 @@ TEST_P(PointCloudPermuteDevices, GetMinBound_GetMaxBound_GetCenter) {
               std::vector<float>({2.5, 3.5, 4.5}));
 }
 
+TEST_P(PointCloudPermuteDevices, GetSegmentAxisAlignedBoundingBoxes) {
+    core::Device device = GetParam();
+
+    // Segment 2 is empty and the points of id -1 are ignored.
+    std::vector<double> points;
+    std::vector<int> ids;
+    for (int i = 0; i < 200; ++i) {
+        points.insert(points.end(), {std::sin(3.0 * i), std::cos(5.0 * i),
+                                     0.01 * i});
+        ids.push_back(i % 5 == 4 ? -1 : (i % 5 == 2 ? 3 : i % 5));
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {200, 3}, core::Dtype::Float64, device));
+    core::Tensor segment_ids(ids, {200}, core::Dtype::Int32, device);
+
+    core::Tensor min_bounds, max_bounds;
+    std::tie(min_bounds, max_bounds) =
+            pcd.GetSegmentAxisAlignedBoundingBoxes(segment_ids);
+    EXPECT_EQ(min_bounds.GetShape(), core::SizeVector({4, 3}));
+    EXPECT_EQ(max_bounds.GetShape(), core::SizeVector({4, 3}));
+    std::vector<double> min_values = min_bounds.ToFlatVector<double>();
+    std::vector<double> max_values = max_bounds.ToFlatVector<double>();
+    for (int segment = 0; segment < 4; ++segment) {
+        std::vector<Eigen::Vector3d> segment_points;
+        for (int i = 0; i < 200; ++i) {
+            if (ids[i] == segment) {
+                segment_points.emplace_back(points[3 * i], points[3 * i + 1],
+                                            points[3 * i + 2]);
+            }
+        }
+        geometry::AxisAlignedBoundingBox box =
+                geometry::AxisAlignedBoundingBox::CreateFromPoints(
+                        segment_points);
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(min_values[3 * segment + i], box.min_bound_(i));
+            EXPECT_EQ(max_values[3 * segment + i], box.max_bound_(i));
+        }
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, GetSegmentOrientedBoundingBoxes) {
+    core::Device device = GetParam();
+
+    // Segment 0 is a single point, segment 1 the corners of a 4 x 2 x 1 box
+    // rotated about z, plus points on a diagonal that tilt its principal
+    // axes, and segment 2 is empty.
+    std::vector<double> points = {5, 6, 7};
+    std::vector<int64_t> ids = {0};
+    double c = std::cos(0.3), s = std::sin(0.3);
+    auto AddBoxPoint = [&](double x, double y, double z) {
+        points.insert(points.end(), {c * x - s * y + 1, s * x + c * y - 2,
+                                     z + 3});
+        ids.push_back(1);
+    };
+    for (int i = 0; i < 8; ++i) {
+        AddBoxPoint(i & 1 ? 2 : -2, i & 2 ? 1 : -1, i & 4 ? 0.5 : -0.5);
+    }
+    for (int i = 0; i <= 20; ++i) {
+        AddBoxPoint(0.2 * i - 2, 0.1 * i - 1, 0);
+    }
+    points.insert(points.end(), {0, 0, 0});
+    ids.push_back(3);
+    int64_t n = int64_t(ids.size());
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {n, 3}, core::Dtype::Float64, device));
+    core::Tensor segment_ids(ids, {n}, core::Dtype::Int64, device);
+
+    for (bool minimal : {false, true}) {
+        core::Tensor centers, rotations, extents;
+        std::tie(centers, rotations, extents) =
+                pcd.GetSegmentOrientedBoundingBoxes(segment_ids, minimal);
+        EXPECT_EQ(centers.GetShape(), core::SizeVector({4, 3}));
+        EXPECT_EQ(rotations.GetShape(), core::SizeVector({4, 3, 3}));
+        EXPECT_EQ(extents.GetShape(), core::SizeVector({4, 3}));
+        std::vector<double> center = centers.ToFlatVector<double>();
+        std::vector<double> R = rotations.ToFlatVector<double>();
+        std::vector<double> extent = extents.ToFlatVector<double>();
+
+        EXPECT_EQ(std::vector<double>(center.begin(), center.begin() + 3),
+                  std::vector<double>({5, 6, 7}));
+        EXPECT_EQ(std::vector<double>(extent.begin(), extent.begin() + 3),
+                  std::vector<double>({0, 0, 0}));
+        EXPECT_EQ(std::vector<double>(R.begin() + 18, R.begin() + 27),
+                  std::vector<double>({1, 0, 0, 0, 1, 0, 0, 0, 1}));
+        EXPECT_EQ(std::vector<double>(extent.begin() + 6, extent.begin() + 9),
+                  std::vector<double>({0, 0, 0}));
+
+        // The box of segment 1 is a rotation and contains its points.
+        Eigen::Matrix3d rotation;
+        for (int i = 0; i < 9; ++i) {
+            rotation(i / 3, i % 3) = R[9 + i];
+        }
+        ExpectEQ(Eigen::Matrix3d(rotation.transpose() * rotation),
+                 Eigen::Matrix3d(Eigen::Matrix3d::Identity()));
+        EXPECT_NEAR(rotation.determinant(), 1, 1e-12);
+        Eigen::Vector3d box_center(center[3], center[4], center[5]);
+        Eigen::Vector3d box_extent(extent[3], extent[4], extent[5]);
+        for (int64_t i = 0; i < n; ++i) {
+            if (ids[i] != 1) {
+                continue;
+            }
+            Eigen::Vector3d p(points[3 * i], points[3 * i + 1],
+                              points[3 * i + 2]);
+            Eigen::Vector3d local = rotation.transpose() * (p - box_center);
+            EXPECT_LE((local.cwiseAbs() - box_extent / 2).maxCoeff(), 1e-9);
+        }
+        double volume = box_extent.prod();
+        if (minimal) {
+            EXPECT_NEAR(volume, 8, 1e-4);
+            ExpectEQ(box_center, Eigen::Vector3d(1, -2, 3), 1e-4);
+        } else {
+            EXPECT_GT(volume, 9);
+        }
+    }
+}
+
 TEST_P(PointCloudPermuteDevicePairs, CopyDevice) {
     core::Device dst_device;
     core::Device src_device;
@@ -195,6 +319,55 @@ TEST_P(PointCloudPermuteDevices, Transform) {
               std::vector<float>({2, 2, 1}));
 }
 
+TEST_P(PointCloudPermuteDevices, TransformSegments) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Tensor points = core::Tensor::Init<float>(
+            {{1, 1, 1}, {1, 2, 3}, {0, 1, 0}, {2, 0, 1}, {3, 3, 3}}, device);
+    core::Tensor normals = core::Tensor::Init<float>(
+            {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 0}, {0, 1, 1}}, device);
+    core::Tensor transformations(
+            std::vector<float>{1, 1, 0, 1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 1,
+                               0, -1, 0, 2, 1, 0, 0, 3, 0, 0, 1, 4, 0, 0, 0, 1},
+            {2, 4, 4}, dtype, device);
+    core::Tensor offsets = core::Tensor::Init<int64_t>({0, 2, 4}, device);
+
+    // Segment s is transformed like with Transform, the last point is not.
+    t::geometry::PointCloud pcd(device);
+    pcd.SetPoints(points.Clone());
+    pcd.SetPointNormals(normals.Clone());
+    pcd.TransformSegments(transformations, offsets);
+    for (int64_t s = 0; s < 2; ++s) {
+        t::geometry::PointCloud segment(device);
+        segment.SetPoints(points.Slice(0, 2 * s, 2 * s + 2).Clone());
+        segment.SetPointNormals(normals.Slice(0, 2 * s, 2 * s + 2).Clone());
+        segment.Transform(transformations[s]);
+        EXPECT_TRUE(pcd.GetPoints()
+                            .Slice(0, 2 * s, 2 * s + 2)
+                            .AllClose(segment.GetPoints()));
+        EXPECT_TRUE(pcd.GetPointNormals()
+                            .Slice(0, 2 * s, 2 * s + 2)
+                            .AllClose(segment.GetPointNormals()));
+    }
+    EXPECT_TRUE(pcd.GetPoints()[4].AllClose(points[4]));
+
+    // Separate point clouds, one of which has no normals.
+    std::vector<t::geometry::PointCloud> pcds(2,
+                                              t::geometry::PointCloud(device));
+    pcds[0].SetPoints(points.Slice(0, 0, 2).Clone());
+    pcds[0].SetPointNormals(normals.Slice(0, 0, 2).Clone());
+    pcds[1].SetPoints(points.Slice(0, 2, 5).Clone());
+    t::geometry::PointCloud::TransformBatch(pcds, transformations);
+    EXPECT_TRUE(pcds[0].GetPoints().AllClose(pcd.GetPoints().Slice(0, 0, 2)));
+    EXPECT_TRUE(pcds[0].GetPointNormals().AllClose(
+            pcd.GetPointNormals().Slice(0, 0, 2)));
+    t::geometry::PointCloud expected(device);
+    expected.SetPoints(points.Slice(0, 2, 5).Clone());
+    expected.Transform(transformations[1]);
+    EXPECT_TRUE(pcds[1].GetPoints().AllClose(expected.GetPoints()));
+    EXPECT_FALSE(pcds[1].HasPointNormals());
+}
+
 TEST_P(PointCloudPermuteDevices, Translate) {
     core::Device device = GetParam();
     t::geometry::PointCloud pcd(device);
@@ -284,6 +457,40 @@ TEST_P(PointCloudPermuteDevices, FromLegacyPointCloud) {
             core::Tensor::Ones({2, 3}, dtype, device)));
 }
 
+TEST(PointCloud, LegacyPointCloudZeroCopy) {
+    core::Dtype dtype = core::Dtype::Float64;
+    core::Device device("CPU:0");
+    geometry::PointCloud legacy_pcd;
+    legacy_pcd.points_ = std::vector<Eigen::Vector3d>{Eigen::Vector3d(0, 1, 2),
+                                                      Eigen::Vector3d(3, 4, 5)};
+    legacy_pcd.colors_ = std::vector<Eigen::Vector3d>{Eigen::Vector3d(1, 1, 1),
+                                                      Eigen::Vector3d(1, 1, 1)};
+
+    // Aliasing the legacy storage.
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            legacy_pcd, dtype, device, /*copy=*/false);
+    EXPECT_EQ(pcd.GetPoints().GetDataPtr(),
+              static_cast<void *>(legacy_pcd.points_.data()));
+    EXPECT_EQ(pcd.GetPointColors().GetDataPtr(),
+              static_cast<void *>(legacy_pcd.colors_.data()));
+
+    // Taking over the legacy storage and handing it back.
+    const Eigen::Vector3d *points_ptr = legacy_pcd.points_.data();
+    const Eigen::Vector3d *colors_ptr = legacy_pcd.colors_.data();
+    pcd = t::geometry::PointCloud::FromLegacyPointCloud(std::move(legacy_pcd),
+                                                        dtype, device);
+    EXPECT_TRUE(pcd.HasPoints());
+    EXPECT_TRUE(pcd.HasPointColors());
+    EXPECT_EQ(pcd.GetPoints().GetDataPtr(),
+              static_cast<const void *>(points_ptr));
+    geometry::PointCloud legacy_pcd_back = std::move(pcd).ToLegacyPointCloud();
+    EXPECT_EQ(legacy_pcd_back.points_.data(), points_ptr);
+    EXPECT_EQ(legacy_pcd_back.colors_.data(), colors_ptr);
+    ExpectEQ(legacy_pcd_back.points_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(0, 1, 2),
+                                          Eigen::Vector3d(3, 4, 5)});
+}
+
 TEST_P(PointCloudPermuteDevices, ToLegacyPointCloud) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -455,6 +662,225 @@ TEST_P(PointCloudPermuteDevices, CreateFromRGBDImage) {
                         pcd_ref.GetPointColors().ToFlatVector<float>()));
 }
 
+TEST_P(PointCloudPermuteDevices, CreateFromRGBDImageDistorted) {
+    using ::testing::UnorderedElementsAreArray;
+
+    core::Device device = GetParam();
+    const int64_t rows = 12, cols = 16;
+    std::vector<int> depth_ints(rows * cols);
+    std::vector<uint8_t> color_values(rows * cols * 3);
+    Rand(depth_ints, 0, 2500, 0);
+    Rand(color_values, 0, 255, 1);
+    std::vector<uint16_t> depth_values(depth_ints.begin(), depth_ints.end());
+    core::Tensor im_depth(depth_values, {rows, cols, 1}, core::Dtype::UInt16,
+                          device);
+    core::Tensor im_color(color_values, {rows, cols, 3}, core::Dtype::UInt8,
+                          device);
+    const double fx = 20, fy = 22, cx = 7.5, cy = 5.5;
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{fx, 0, cx}, {0, fy, cy}, {0, 0, 1}}, device);
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float32, device);
+    t::geometry::RGBDImage rgbd(im_color, im_depth);
+
+    // UInt8 colors are converted in the kernel like Image::To(Float32).
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::CreateFromRGBDImage(
+            rgbd, intrinsics, extrinsics, 1000.f, 2.f);
+    t::geometry::PointCloud pcd_ref =
+            t::geometry::PointCloud::CreateFromRGBDImage(
+                    t::geometry::RGBDImage(
+                            t::geometry::Image(im_color).To(
+                                    core::Dtype::Float32),
+                            im_depth),
+                    intrinsics, extrinsics, 1000.f, 2.f);
+    EXPECT_THAT(pcd.GetPointColors().ToFlatVector<float>(),
+                UnorderedElementsAreArray(
+                        pcd_ref.GetPointColors().ToFlatVector<float>()));
+
+    // Zero distortion is the pinhole model.
+    t::geometry::PointCloud pcd_zero =
+            t::geometry::PointCloud::CreateFromRGBDImage(
+                    rgbd, intrinsics, extrinsics, 1000.f, 2.f, 1,
+                    {0, 0, 0, 0, 0});
+    EXPECT_THAT(pcd_zero.GetPoints().ToFlatVector<float>(),
+                UnorderedElementsAreArray(
+                        pcd.GetPoints().ToFlatVector<float>()));
+
+    // Distorting the unprojected points again lands them on their pixels.
+    const std::vector<double> k = {-0.2, 0.05, 0.001, -0.002, 0.01};
+    t::geometry::PointCloud pcd_distorted =
+            t::geometry::PointCloud::CreateFromRGBDImage(
+                    rgbd, intrinsics, extrinsics, 1000.f, 2.f, 1, k);
+    std::vector<float> points = pcd_distorted.GetPoints().ToFlatVector<float>();
+    EXPECT_EQ(int64_t(points.size()), pcd.GetPoints().NumElements());
+    for (size_t i = 0; i < points.size(); i += 3) {
+        const double z = points[i + 2];
+        const double x = points[i] / z, y = points[i + 1] / z;
+        const double r2 = x * x + y * y;
+        const double radial = 1 + r2 * (k[0] + r2 * (k[1] + r2 * k[4]));
+        const double u =
+                fx * (x * radial + 2 * k[2] * x * y + k[3] * (r2 + 2 * x * x)) +
+                cx;
+        const double v =
+                fy * (y * radial + k[2] * (r2 + 2 * y * y) + 2 * k[3] * x * y) +
+                cy;
+        const int64_t col = std::lround(u), row = std::lround(v);
+        EXPECT_NEAR(u, col, 1e-2);
+        EXPECT_NEAR(v, row, 1e-2);
+        ASSERT_TRUE(row >= 0 && row < rows && col >= 0 && col < cols);
+        EXPECT_NEAR(z, depth_values[row * cols + col] / 1000.0, 1e-5);
+    }
+
+    // Only pixels on the stride grid are unprojected.
+    t::geometry::PointCloud pcd_stride =
+            t::geometry::PointCloud::CreateFromRGBDImage(
+                    rgbd, intrinsics, extrinsics, 1000.f, 2.f, 2, k);
+    int64_t num_valid = 0;
+    for (int64_t row = 0; row < rows; row += 2) {
+        for (int64_t col = 0; col < cols; col += 2) {
+            const uint16_t d = depth_values[row * cols + col];
+            num_valid += d > 0 && d < 2000;
+        }
+    }
+    EXPECT_EQ(pcd_stride.GetPoints().GetLength(), num_valid);
+}
+
+TEST_P(PointCloudPermuteDevices, ProjectToRGBDImage) {
+    core::Device device = GetParam();
+    const int64_t rows = 12, cols = 16;
+    std::vector<int> depth_ints(rows * cols);
+    std::vector<float> color_values(rows * cols * 3);
+    Rand(depth_ints, 0, 2500, 0);
+    Rand(color_values, 0, 1, 1);
+    std::vector<float> depth_values(depth_ints.begin(), depth_ints.end());
+    core::Tensor im_depth(depth_values, {rows, cols, 1}, core::Dtype::Float32,
+                          device);
+    core::Tensor im_color(color_values, {rows, cols, 3}, core::Dtype::Float32,
+                          device);
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{20, 0, 7.5}, {0, 22, 5.5}, {0, 0, 1}}, device);
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float32, device);
+
+    // Projecting the unprojected points gives the images, with 0 for the
+    // dropped pixels.
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::CreateFromRGBDImage(
+            t::geometry::RGBDImage(im_color, im_depth), intrinsics, extrinsics,
+            1000.f, 2.f);
+    core::Tensor valid = im_depth.Gt(0.f).LogicalAnd(im_depth.Lt(2000.f));
+    core::Tensor depth_ref = im_depth * valid.To(core::Dtype::Float32);
+    core::Tensor color_ref = im_color * valid.To(core::Dtype::Float32);
+    t::geometry::RGBDImage rgbd = pcd.ProjectToRGBDImage(
+            cols, rows, intrinsics, extrinsics, 1000.f, 2.f);
+    EXPECT_TRUE(rgbd.depth_.AsTensor().AllClose(depth_ref, 1e-5, 1e-3));
+    EXPECT_TRUE(rgbd.color_.AsTensor().AllClose(color_ref));
+
+    // The closest point of a pixel wins.
+    t::geometry::PointCloud pcd_ray(core::Tensor::Init<float>(
+            {{0, 0, 2}, {0, 0, 1}, {0, 0, 3}}, device));
+    core::Tensor depth =
+            pcd_ray.ProjectToDepthImage(cols, rows, intrinsics, extrinsics,
+                                        1.f, 10.f)
+                    .AsTensor();
+    EXPECT_EQ(depth[6][8][0].Item<float>(), 1.f);
+    EXPECT_EQ(depth.Sum({0, 1, 2}).Item<float>(), 1.f);
+
+    // A batch of cameras gives the images of the cameras.
+    core::Tensor translated = extrinsics.Clone();
+    translated[0][3] = 0.05f;
+    core::Tensor batch = core::Tensor::Empty({2, 4, 4}, core::Dtype::Float32,
+                                             device);
+    batch[0] = extrinsics;
+    batch[1] = translated;
+    std::vector<t::geometry::RGBDImage> images = pcd.ProjectToRGBDImages(
+            cols, rows, intrinsics, batch, 1000.f, 2.f);
+    ASSERT_EQ(images.size(), 2u);
+    EXPECT_TRUE(images[0].depth_.AsTensor().AllClose(depth_ref, 1e-5, 1e-3));
+    t::geometry::RGBDImage rgbd_translated = pcd.ProjectToRGBDImage(
+            cols, rows, intrinsics, translated, 1000.f, 2.f);
+    EXPECT_TRUE(images[1].depth_.AsTensor().AllClose(
+            rgbd_translated.depth_.AsTensor()));
+    EXPECT_TRUE(images[1].color_.AsTensor().AllClose(
+            rgbd_translated.color_.AsTensor()));
+}
+
+TEST_P(PointCloudPermuteDevices, SortByMortonCode) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<float>({{1, 1, 1},
+                                                     {0, 1, 0},
+                                                     {1, 0, 1},
+                                                     {0, 0, 0},
+                                                     {1, 1, 0},
+                                                     {0, 0, 1},
+                                                     {1, 0, 0},
+                                                     {0, 1, 1}},
+                                                    device);
+    t::geometry::PointCloud pcd(points);
+    pcd.SetPointColors(points * 0.5);
+    core::Tensor labels =
+            core::Tensor::Arange(0, 8, 1, core::Dtype::Int64, device);
+    pcd.SetPointAttr("labels", labels);
+
+    pcd.SortByMortonCode();
+
+    // x is the lowest bit of the Morton code, z the highest.
+    core::Tensor ref_points = core::Tensor::Init<float>({{0, 0, 0},
+                                                         {1, 0, 0},
+                                                         {0, 1, 0},
+                                                         {1, 1, 0},
+                                                         {0, 0, 1},
+                                                         {1, 0, 1},
+                                                         {0, 1, 1},
+                                                         {1, 1, 1}},
+                                                        device);
+    EXPECT_TRUE(pcd.GetPoints().AllClose(ref_points));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(ref_points * 0.5));
+    EXPECT_EQ(pcd.GetPointAttr("labels").ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 6, 1, 4, 5, 2, 7, 0}));
+}
+
+TEST_P(PointCloudPermuteDevices, FarthestPointDownSample) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<float>({{0, 0, 0},
+                                                     {0.1, 0.1, 0},
+                                                     {1, 0, 0},
+                                                     {0, 1, 0},
+                                                     {1.1, 0.1, 0},
+                                                     {1, 1, 0}},
+                                                    device);
+    t::geometry::PointCloud pcd(points);
+    pcd.SetPointAttr("labels", core::Tensor::Arange(0, 6, 1,
+                                                    core::Dtype::Int64,
+                                                    device));
+
+    // (1, 1) is farthest from the origin, then (1, 0) and (0, 1) tie and the
+    // smaller index wins.
+    t::geometry::PointCloud pcd_down = pcd.FarthestPointDownSample(4);
+    EXPECT_EQ(pcd_down.GetPointAttr("labels").ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 5, 2, 3}));
+    EXPECT_TRUE(pcd_down.GetPoints().AllClose(
+            points.IndexGet({core::Tensor::Init<int64_t>({0, 5, 2, 3},
+                                                         device)})));
+
+    // With voxels of size 0.5 the points {0, 1} and {2, 4} share a voxel, and
+    // one point of each of the 4 occupied voxels is selected.
+    pcd_down = pcd.FarthestPointDownSample(4, 0.5);
+    const std::vector<int64_t> voxel_of_label = {0, 0, 1, 2, 1, 3};
+    std::vector<int64_t> voxels;
+    for (int64_t label :
+         pcd_down.GetPointAttr("labels").ToFlatVector<int64_t>()) {
+        voxels.push_back(voxel_of_label[label]);
+    }
+    std::sort(voxels.begin(), voxels.end());
+    EXPECT_EQ(voxels, std::vector<int64_t>({0, 1, 2, 3}));
+
+    EXPECT_EQ(pcd.FarthestPointDownSample(0).GetPoints().GetLength(), 0);
+    EXPECT_EQ(pcd.FarthestPointDownSample(6).GetPoints().GetLength(), 6);
+    EXPECT_ANY_THROW(pcd.FarthestPointDownSample(7));
+}
+
 TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
     core::Device device = GetParam();
 
@@ -480,5 +906,367 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, VoxelDownSampleAndTrace) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0.1, 0.3, 0.9},
+                                                           {1.9, 0.2, 0.4},
+                                                           {0.3, 0.5, 0.7},
+                                                           {1.5, 0.4, 0.2},
+                                                           {0.2, 2.1, 0.2}},
+                                                          device));
+    pcd.SetPointColors(core::Tensor::Init<uint8_t>(
+            {{10, 0, 0}, {0, 20, 0}, {30, 0, 0}, {0, 40, 0}, {0, 0, 50}},
+            device));
+    pcd.SetPointAttr("labels",
+                     core::Tensor::Init<int64_t>({1, 2, 3, 4, 5}, device));
+
+    core::Tensor trace;
+    t::geometry::PointCloud pcd_down = pcd.VoxelDownSampleAndTrace(1, trace);
+
+    // Voxels are ordered by x, then y, then z.
+    EXPECT_TRUE(pcd_down.GetPoints().AllClose(
+            core::Tensor::Init<float>(
+                    {{0.2, 0.4, 0.8}, {0.2, 2.1, 0.2}, {1.7, 0.3, 0.3}},
+                    device)));
+    EXPECT_TRUE(pcd_down.GetPointColors().AllClose(
+            core::Tensor::Init<uint8_t>({{20, 0, 0}, {0, 0, 50}, {0, 30, 0}},
+                                        device)));
+    EXPECT_TRUE(pcd_down.GetPointAttr("labels").AllClose(
+            core::Tensor::Init<int64_t>({2, 5, 3}, device)));
+    EXPECT_TRUE(trace.AllClose(
+            core::Tensor::Init<int64_t>({0, 2, 0, 2, 1}, device)));
+
+    // Every input point maps to the voxel holding it.
+    t::geometry::PointCloud pcd_large =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    *io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
+                                                  "/ICP/cloud_bin_2.pcd"))
+                    .To(device);
+    pcd_down = pcd_large.VoxelDownSampleAndTrace(0.05, trace);
+    EXPECT_EQ(trace.GetLength(), pcd_large.GetPoints().GetLength());
+    core::Tensor voxels_in =
+            (pcd_large.GetPoints() / 0.05).Floor().To(core::Dtype::Int64);
+    core::Tensor voxels_out = (pcd_down.GetPoints() / 0.05)
+                                      .Floor()
+                                      .To(core::Dtype::Int64)
+                                      .IndexGet({trace});
+    EXPECT_TRUE(voxels_in.AllClose(voxels_out));
+
+    EXPECT_ANY_THROW(pcd.VoxelDownSampleAndTrace(0, trace));
+}
+
+// A 3 x 3 x 3 grid with spacing 0.1, followed by two isolated points.
+static t::geometry::PointCloud GridWithOutliers(const core::Device& device) {
+    std::vector<float> points;
+    for (int x = 0; x < 3; ++x) {
+        for (int y = 0; y < 3; ++y) {
+            for (int z = 0; z < 3; ++z) {
+                points.insert(points.end(), {0.1f * x, 0.1f * y, 0.1f * z});
+            }
+        }
+    }
+    points.insert(points.end(), {2.0f, 2.0f, 2.0f, -1.0f, 0.1f, 0.1f});
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {29, 3}, core::Dtype::Float32, device));
+    core::Tensor labels =
+            core::Tensor::Arange(0, 29, 1, core::Dtype::Int64, device);
+    pcd.SetPointAttr("labels", labels);
+    return pcd;
+}
+
+TEST_P(PointCloudPermuteDevices, EstimateNormals) {
+    core::Device device = GetParam();
+
+    // Points on an ellipsoid, with rough outward normals for orientation.
+    std::vector<double> points, normals;
+    const int n = 200;
+    for (int i = 0; i < n; ++i) {
+        double z = 1 - 2 * (i + 0.5) / n;
+        double r = std::sqrt(1 - z * z);
+        double phi = i * 2.399963229728653;
+        points.insert(points.end(),
+                      {2 * r * std::cos(phi), r * std::sin(phi), z});
+        normals.insert(normals.end(),
+                       {r * std::cos(phi), r * std::sin(phi), z});
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {n, 3}, core::Dtype::Float64, device));
+    pcd.SetPointNormals(
+            core::Tensor(normals, {n, 3}, core::Dtype::Float64, device));
+
+    for (bool hybrid : {false, true}) {
+        t::geometry::PointCloud pcd_estimated = pcd.Clone();
+        geometry::PointCloud pcd_legacy = pcd.ToLegacyPointCloud();
+        if (hybrid) {
+            pcd_estimated.EstimateNormals(10, 0.5);
+            pcd_legacy.EstimateNormals(
+                    geometry::KDTreeSearchParamHybrid(0.5, 10));
+        } else {
+            pcd_estimated.EstimateNormals(10);
+            pcd_legacy.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+        }
+        core::Tensor normals_ref =
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        pcd_legacy.normals_, core::Dtype::Float64, device);
+        EXPECT_TRUE(pcd_estimated.GetPointNormals().AllClose(normals_ref,
+                                                             1e-5, 1e-5));
+    }
+
+    // Without neighbors, normals default to +z.
+    t::geometry::PointCloud pcd_sparse(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}, device));
+    pcd_sparse.EstimateNormals(10, 0.1);
+    EXPECT_TRUE(pcd_sparse.GetPointNormals().AllClose(
+            core::Tensor::Init<float>({{0, 0, 1}, {0, 0, 1}, {0, 0, 1}},
+                                      device)));
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd = GridWithOutliers(device);
+
+    t::geometry::PointCloud pcd_inliers;
+    core::Tensor mask;
+    std::tie(pcd_inliers, mask) = pcd.RemoveRadiusOutliers(3, 0.12);
+
+    std::vector<bool> mask_ref(29, true);
+    mask_ref[27] = mask_ref[28] = false;
+    EXPECT_EQ(mask.GetDevice(), device);
+    EXPECT_EQ(mask.ToFlatVector<bool>(), mask_ref);
+    EXPECT_EQ(pcd_inliers.GetPointAttr("labels").ToFlatVector<int64_t>(),
+              core::Tensor::Arange(0, 27, 1).ToFlatVector<int64_t>());
+
+    // Corners of the grid have only 3 neighbors besides themselves.
+    std::tie(pcd_inliers, mask) = pcd.RemoveRadiusOutliers(4, 0.12);
+    EXPECT_EQ(pcd_inliers.GetPoints().GetLength(), 19);
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveStatisticalOutliers) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd = GridWithOutliers(device);
+
+    for (double std_ratio : {0.5, 1.0, 2.0}) {
+        t::geometry::PointCloud pcd_inliers;
+        core::Tensor mask;
+        std::tie(pcd_inliers, mask) =
+                pcd.RemoveStatisticalOutliers(5, std_ratio);
+
+        std::vector<size_t> indices_ref;
+        std::tie(std::ignore, indices_ref) =
+                pcd.ToLegacyPointCloud().RemoveStatisticalOutliers(5,
+                                                                   std_ratio);
+        std::vector<int64_t> indices =
+                pcd_inliers.GetPointAttr("labels").ToFlatVector<int64_t>();
+        EXPECT_EQ(std::vector<size_t>(indices.begin(), indices.end()),
+                  indices_ref);
+        EXPECT_EQ(mask.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                  int64_t(indices_ref.size()));
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    // Three curves of scattered points, joined by a sparse bridge, plus
+    // isolated points.
+    std::vector<double> points;
+    for (int i = 0; i < 300; ++i) {
+        double t = 0.01 * i;
+        double c = double(i % 3);
+        points.insert(points.end(), {c + 0.3 * std::sin(7 * t),
+                                     t + 0.02 * std::sin(13 * i),
+                                     0.02 * std::cos(17 * i)});
+    }
+    for (int i = 0; i < 10; ++i) {
+        points.insert(points.end(), {0.07 * i, 1.5, 0.0});
+    }
+    points.insert(points.end(), {5.0, 5.0, 5.0, -3.0, 1.0, 0.0});
+    int64_t n = int64_t(points.size() / 3);
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {n, 3}, core::Dtype::Float64, device));
+    geometry::PointCloud pcd_legacy = pcd.ToLegacyPointCloud();
+
+    for (double eps : {0.05, 0.1, 0.3}) {
+        for (size_t min_points : {1, 3, 6}) {
+            core::Tensor labels = pcd.ClusterDBSCAN(eps, min_points);
+            EXPECT_EQ(labels.GetDtype(), core::Dtype::Int32);
+            EXPECT_EQ(labels.GetDevice(), device);
+            EXPECT_EQ(labels.ToFlatVector<int>(),
+                      pcd_legacy.ClusterDBSCAN(eps, min_points));
+        }
+    }
+
+    t::geometry::PointCloud pcd_empty(
+            core::Tensor({0, 3}, core::Dtype::Float32, device));
+    EXPECT_EQ(pcd_empty.ClusterDBSCAN(0.1, 3).GetLength(), 0);
+}
+
+TEST_P(PointCloudPermuteDevices, ComputeISSKeypoints) {
+    core::Device device = GetParam();
+
+    // Jittered samples of a bumpy surface.
+    std::vector<double> points;
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            double x = 0.05 * i + 0.01 * std::sin(37 * (i * 40 + j));
+            double y = 0.05 * j + 0.01 * std::cos(53 * (i * 40 + j));
+            points.insert(points.end(),
+                          {x, y,
+                           0.3 * std::sin(3 * x) * std::cos(4 * y) +
+                                   0.005 * std::sin(71 * (i * 40 + j))});
+        }
+    }
+    int64_t n = int64_t(points.size() / 3);
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {n, 3}, core::Dtype::Float64, device));
+    geometry::PointCloud pcd_legacy = pcd.ToLegacyPointCloud();
+
+    auto sorted_points = [](const geometry::PointCloud &pcd) {
+        std::vector<Eigen::Vector3d> sorted = pcd.points_;
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                      return std::lexicographical_compare(
+                              a.data(), a.data() + 3, b.data(), b.data() + 3);
+                  });
+        return sorted;
+    };
+    t::geometry::PointCloud keypoints;
+    core::Tensor mask;
+    std::tie(keypoints, mask) = pcd.ComputeISSKeypoints(0.2, 0.15);
+    EXPECT_EQ(mask.GetDevice(), device);
+    EXPECT_EQ(keypoints.GetPoints().GetLength(),
+              mask.To(core::Dtype::Int64).Sum({0}).Item<int64_t>());
+    EXPECT_GT(keypoints.GetPoints().GetLength(), 0);
+    ExpectEQ(sorted_points(keypoints.ToLegacyPointCloud()),
+             sorted_points(*geometry::keypoint::ComputeISSKeypoints(
+                     pcd_legacy, 0.2, 0.15)));
+
+    t::geometry::PointCloud pcd_empty(
+            core::Tensor({0, 3}, core::Dtype::Float32, device));
+    EXPECT_EQ(std::get<1>(pcd_empty.ComputeISSKeypoints()).GetLength(), 0);
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentPlane) {
+    core::Device device = GetParam();
+
+    // A floor z = 0 and a smaller wall x = 0 sampled on grids.
+    std::vector<float> points;
+    for (int i = 0; i < 20; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            points.insert(points.end(), {0.1f * i + 0.1f, 0.1f * j, 0.0f});
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            points.insert(points.end(), {0.0f, 0.1f * j, 0.1f * i + 0.1f});
+        }
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {600, 3}, core::Dtype::Float32, device));
+
+    core::Tensor plane_model, inliers;
+    std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 3, 1000);
+    EXPECT_EQ(plane_model.GetDtype(), core::Dtype::Float64);
+    std::vector<double> plane = plane_model.ToFlatVector<double>();
+    EXPECT_NEAR(std::abs(plane[2]), 1.0, 1e-6);
+    EXPECT_NEAR(plane[0], 0.0, 1e-6);
+    EXPECT_NEAR(plane[1], 0.0, 1e-6);
+    EXPECT_NEAR(plane[3], 0.0, 1e-6);
+    EXPECT_EQ(inliers.GetDevice(), device);
+    std::vector<int64_t> inliers_ref(400);
+    std::iota(inliers_ref.begin(), inliers_ref.end(), 0);
+    EXPECT_EQ(inliers.ToFlatVector<int64_t>(), inliers_ref);
+}
+
+TEST_P(PointCloudPermuteDevices, HiddenPointRemoval) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_.resize(2000);
+    Rand(pcd_legacy.points_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 0);
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float64, device);
+    core::Tensor camera_location(std::vector<double>{0, 0, 4}, {3},
+                                 core::Dtype::Float64, device);
+
+    t::geometry::TriangleMesh mesh;
+    core::Tensor indices;
+    std::tie(mesh, indices) = pcd.HiddenPointRemoval(camera_location, 400);
+    EXPECT_EQ(indices.GetDevice(), device);
+    EXPECT_EQ(indices.GetDtype(), core::Dtype::Int64);
+    EXPECT_TRUE(mesh.GetVertices().AllClose(
+            pcd.GetPoints().IndexGet({indices})));
+
+    std::shared_ptr<geometry::TriangleMesh> mesh_legacy;
+    std::vector<size_t> pt_map;
+    std::tie(mesh_legacy, pt_map) = pcd_legacy.HiddenPointRemoval(
+            Eigen::Vector3d(0, 0, 4), 400);
+    std::vector<int64_t> visible = indices.ToFlatVector<int64_t>();
+    std::vector<int64_t> visible_ref(pt_map.begin(), pt_map.end());
+    std::sort(visible.begin(), visible.end());
+    std::sort(visible_ref.begin(), visible_ref.end());
+    EXPECT_EQ(visible, visible_ref);
+    EXPECT_EQ(mesh.GetTriangles().GetLength(),
+              int64_t(mesh_legacy->triangles_.size()));
+    EXPECT_EQ(mesh.GetTriangles().Max({0, 1}).Item<int64_t>(),
+              indices.GetLength() - 1);
+
+    EXPECT_ANY_THROW(pcd.HiddenPointRemoval(camera_location, 0));
+}
+
+TEST_P(PointCloudPermuteDevices, ComputePointCloudDistance) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud source_legacy, target_legacy;
+    source_legacy.points_.resize(200);
+    target_legacy.points_.resize(300);
+    Rand(source_legacy.points_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 0);
+    Rand(target_legacy.points_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(2, 2, 2), 1);
+    t::geometry::PointCloud source =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    source_legacy, core::Dtype::Float64, device);
+    t::geometry::PointCloud target =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    target_legacy, core::Dtype::Float64, device);
+
+    std::vector<double> distances_ref =
+            source_legacy.ComputePointCloudDistance(target_legacy);
+    std::vector<double> distances_back_ref =
+            target_legacy.ComputePointCloudDistance(source_legacy);
+    core::Tensor distances = source.ComputePointCloudDistance(target);
+    EXPECT_EQ(distances.GetDevice(), device);
+    EXPECT_TRUE(distances.AllClose(
+            core::Tensor(distances_ref, {200}, core::Dtype::Float64, device)));
+
+    std::vector<double> nn_distances_ref =
+            source_legacy.ComputeNearestNeighborDistance();
+    EXPECT_TRUE(source.ComputeNearestNeighborDistance().AllClose(core::Tensor(
+            nn_distances_ref, {200}, core::Dtype::Float64, device)));
+
+    double max_ref =
+            *std::max_element(distances_ref.begin(), distances_ref.end());
+    double max_back_ref = *std::max_element(distances_back_ref.begin(),
+                                            distances_back_ref.end());
+    EXPECT_NEAR(source.ComputeHausdorffDistance(target, false), max_ref,
+                1e-12);
+    EXPECT_NEAR(source.ComputeHausdorffDistance(target),
+                std::max(max_ref, max_back_ref), 1e-12);
+    double chamfer_ref =
+            std::accumulate(distances_ref.begin(), distances_ref.end(), 0.0) /
+                    200 +
+            std::accumulate(distances_back_ref.begin(),
+                            distances_back_ref.end(), 0.0) /
+                    300;
+    EXPECT_NEAR(source.ComputeChamferDistance(target), chamfer_ref, 1e-12);
+
+    EXPECT_ANY_THROW(source.ComputeChamferDistance(
+            t::geometry::PointCloud(core::Tensor::Empty(
+                    {0, 3}, core::Dtype::Float64, device))));
+}
+
 }  // namespace tests
 }  // namespace open3d
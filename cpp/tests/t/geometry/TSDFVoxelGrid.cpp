@@ -26,13 +26,17 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <cstdio>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 #include "open3d/pipelines/registration/Registration.h"
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
@@ -53,6 +57,7 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     for (auto backend : backends) {
@@ -115,6 +120,491 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateVisibilityCulling) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    auto create_voxel_grid = [&]() {
+        return t::geometry::TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    };
+    t::geometry::TSDFVoxelGrid voxel_grid = create_voxel_grid();
+    t::geometry::TSDFVoxelGrid voxel_grid_culled = create_voxel_grid();
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+
+        Eigen::Matrix4d extrinsic = trajectory->parameters_[i].extrinsic_;
+        core::Tensor extrinsic_t =
+                core::eigen_converter::EigenMatrixToTensor(extrinsic);
+
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+        voxel_grid_culled.Integrate(depth, color, intrinsic_t, extrinsic_t,
+                                    1000.0f, 3.0f, 4,
+                                    /*visibility_culling=*/true);
+    }
+
+    // Only the blocks crossed by the camera rays are allocated, while the
+    // surface is preserved.
+    EXPECT_LT(voxel_grid_culled.GetBlockHashmap()->Size(),
+              voxel_grid.GetBlockHashmap()->Size());
+
+    auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
+    auto pcd_culled =
+            voxel_grid_culled.ExtractSurfacePoints().ToLegacyPointCloud();
+    auto result = pipelines::registration::EvaluateRegistration(
+            pcd_culled, pcd, voxel_size);
+    EXPECT_GT(result.fitness_, 0.99);
+    EXPECT_GT(pcd_culled.points_.size(), 0.9 * pcd.points_.size());
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, ExtractSurfaceMesh) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+
+        Eigen::Matrix4d extrinsic = trajectory->parameters_[i].extrinsic_;
+        core::Tensor extrinsic_t =
+                core::eigen_converter::EigenMatrixToTensor(extrinsic);
+
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+    }
+
+    // Vertices are written at prefix sum offsets, so the output is
+    // deterministic. Every vertex is emitted once by the voxel owning its
+    // edge, including the vertices on block boundaries.
+    auto mesh = voxel_grid.ExtractSurfaceMesh();
+    auto mesh_again = voxel_grid.ExtractSurfaceMesh();
+    EXPECT_TRUE(mesh.GetVertices().AllClose(mesh_again.GetVertices()));
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(mesh_again.GetTriangles()));
+
+    auto mesh_legacy = mesh.ToLegacyTriangleMesh();
+    size_t n_vertices = mesh_legacy.vertices_.size();
+    EXPECT_GT(n_vertices, 0u);
+    mesh_legacy.RemoveDuplicatedVertices();
+    EXPECT_EQ(mesh_legacy.vertices_.size(), n_vertices);
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, Partitioned) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    // Slabs of one block, such that every partition holds part of the scene.
+    t::geometry::PartitionedTSDFVoxelGrid partitioned(
+            {device, device, device},
+            {{"tsdf", core::Dtype::Float32},
+             {"weight", core::Dtype::UInt16},
+             {"color", core::Dtype::UInt16}},
+            voxel_size, 0.04f, 16, 1000, /*slab_width=*/1);
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    core::Tensor extrinsic_t;
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+
+        Eigen::Matrix4d extrinsic = trajectory->parameters_[i].extrinsic_;
+        extrinsic_t = core::eigen_converter::EigenMatrixToTensor(extrinsic);
+
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+        partitioned.Integrate(depth, color, intrinsic_t, extrinsic_t);
+    }
+    for (int64_t i = 0; i < partitioned.GetPartitionCount(); ++i) {
+        EXPECT_GT(partitioned.GetPartition(i).GetBlockHashmap()->Size(), 0);
+    }
+
+    // Every surface point is extracted once, by the owner of its slab.
+    auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
+    auto pcd_partitioned = partitioned.ExtractSurfacePoints();
+    EXPECT_EQ(pcd_partitioned.GetDevice(), device);
+    auto pcd_merged = pcd_partitioned.ToLegacyPointCloud();
+    EXPECT_NEAR(static_cast<double>(pcd_merged.points_.size()),
+                static_cast<double>(pcd.points_.size()),
+                0.001 * pcd.points_.size());
+    auto result = pipelines::registration::EvaluateRegistration(
+            pcd_merged, pcd, voxel_size);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-3);
+    EXPECT_NEAR(result.inlier_rmse_, 0, 1e-4);
+
+    auto mesh = voxel_grid.ExtractSurfaceMesh();
+    auto mesh_partitioned = partitioned.ExtractSurfaceMesh();
+    int64_t num_triangles = mesh.GetTriangles().GetLength();
+    EXPECT_NEAR(
+            static_cast<double>(mesh_partitioned.GetTriangles().GetLength()),
+            static_cast<double>(num_triangles), 0.001 * num_triangles);
+
+    // Ray casting sees the same surface from the last camera.
+    int mask = t::geometry::TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+               t::geometry::TSDFVoxelGrid::SurfaceMaskCode::VertexMap;
+    auto maps = voxel_grid.RayCast(intrinsic_t, extrinsic_t, 640, 480, 1000.0f,
+                                   0.1f, 3.0f, 3.0f, mask);
+    auto maps_partitioned =
+            partitioned.RayCast(intrinsic_t, extrinsic_t, 640, 480, 1000.0f,
+                                0.1f, 3.0f, 3.0f, mask);
+    core::Tensor depth =
+            maps.at(t::geometry::TSDFVoxelGrid::SurfaceMaskCode::DepthMap);
+    core::Tensor depth_partitioned = maps_partitioned.at(
+            t::geometry::TSDFVoxelGrid::SurfaceMaskCode::DepthMap);
+    EXPECT_EQ(depth_partitioned.GetShape(), depth.GetShape());
+    core::Tensor vertex_map_partitioned = maps_partitioned.at(
+            t::geometry::TSDFVoxelGrid::SurfaceMaskCode::VertexMap);
+    EXPECT_EQ(vertex_map_partitioned.GetShape(),
+              core::SizeVector({480, 640, 3}));
+    core::Tensor valid = depth.Gt(0.0f).Reshape({-1});
+    core::Tensor close = depth.Sub(depth_partitioned)
+                                 .Abs()
+                                 .Lt(1.0f)
+                                 .Reshape({-1})
+                                 .LogicalAnd(valid);
+    int64_t num_valid =
+            valid.To(core::Dtype::Int64).Sum({0}).Item<int64_t>();
+    int64_t num_close =
+            close.To(core::Dtype::Int64).Sum({0}).Item<int64_t>();
+    EXPECT_GT(num_valid, 0);
+    EXPECT_GT(num_close, 0.99 * num_valid);
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, ExtractSurfaceMeshUpdate) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+
+        Eigen::Matrix4d extrinsic = trajectory->parameters_[i].extrinsic_;
+        core::Tensor extrinsic_t =
+                core::eigen_converter::EigenMatrixToTensor(extrinsic);
+
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+
+        // Every block is assigned to exactly one cached mesh, so the cache
+        // always sums up to the full extraction.
+        auto update = voxel_grid.ExtractSurfaceMeshUpdate();
+        EXPECT_EQ(update.updated_blocks_.size(),
+                  update.updated_meshes_.size());
+        EXPECT_EQ(voxel_grid.GetCachedSurfaceMesh().GetTriangles().GetLength(),
+                  voxel_grid.ExtractSurfaceMesh().GetTriangles().GetLength());
+    }
+
+    // Nothing is integrated since the last update.
+    auto update = voxel_grid.ExtractSurfaceMeshUpdate();
+    EXPECT_TRUE(update.updated_blocks_.empty());
+    EXPECT_TRUE(update.removed_blocks_.empty());
+
+    auto mesh = voxel_grid.ExtractSurfaceMesh();
+    auto mesh_cached = voxel_grid.GetCachedSurfaceMesh();
+    EXPECT_TRUE(mesh_cached.HasVertexColors());
+    EXPECT_GE(mesh_cached.GetVertices().GetLength(),
+              mesh.GetVertices().GetLength());
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, LegacyConversionAndIO) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    pipelines::integration::ScalableTSDFVolume volume(
+            voxel_size, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8,
+            16);
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        auto depth = io::CreateImageFromFile(fmt::format(
+                "{}/RGBD/depth/{:05d}.png", std::string(TEST_DATA_DIR), i));
+        auto color = io::CreateImageFromFile(fmt::format(
+                "{}/RGBD/color/{:05d}.jpg", std::string(TEST_DATA_DIR), i));
+        auto rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+                *color, *depth, 1000.0, 3.0, false);
+        volume.Integrate(*rgbd, intrinsic,
+                         trajectory->parameters_[i].extrinsic_);
+    }
+
+    // Resampled surfaces agree with the legacy surface up to a voxel.
+    auto pcd_legacy = *volume.ExtractPointCloud();
+    t::geometry::TSDFVoxelGrid voxel_grid =
+            t::geometry::TSDFVoxelGrid::FromLegacyTSDFVolume(
+                    volume,
+                    {{"tsdf", core::Dtype::Float32},
+                     {"weight", core::Dtype::UInt16},
+                     {"color", core::Dtype::UInt16}},
+                    device);
+    auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
+    auto result = pipelines::registration::EvaluateRegistration(
+            pcd, pcd_legacy, voxel_size);
+    EXPECT_GT(result.fitness_, 0.95);
+    EXPECT_TRUE(pcd.HasColors());
+
+    auto volume_back = voxel_grid.ToLegacyTSDFVolume();
+    auto pcd_back = *volume_back->ExtractPointCloud();
+    result = pipelines::registration::EvaluateRegistration(
+            pcd_back, pcd_legacy, voxel_size);
+    EXPECT_GT(result.fitness_, 0.95);
+
+    // Save and load keep the blocks bit-exact.
+    std::string file_name = "tsdf_voxel_grid.o3dtsdf";
+    voxel_grid.Save(file_name);
+    t::geometry::TSDFVoxelGrid voxel_grid_loaded =
+            t::geometry::TSDFVoxelGrid::Load(file_name, device);
+    EXPECT_EQ(voxel_grid_loaded.GetBlockHashmap()->Size(),
+              voxel_grid.GetBlockHashmap()->Size());
+    EXPECT_EQ(voxel_grid_loaded.ExtractSurfacePoints()
+                      .GetPoints()
+                      .GetLength(),
+              int64_t(pcd.points_.size()));
+    std::remove(file_name.c_str());
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, QuantizedVoxels) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    auto integrate = [&](t::geometry::TSDFVoxelGrid &voxel_grid) {
+        for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+            t::geometry::Image depth =
+                    t::io::CreateImageFromFile(
+                            fmt::format("{}/RGBD/depth/{:05d}.png",
+                                        std::string(TEST_DATA_DIR), i))
+                            ->To(device);
+            t::geometry::Image color =
+                    t::io::CreateImageFromFile(
+                            fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                        std::string(TEST_DATA_DIR), i))
+                            ->To(device);
+
+            Eigen::Matrix4d extrinsic = trajectory->parameters_[i].extrinsic_;
+            core::Tensor extrinsic_t =
+                    core::eigen_converter::EigenMatrixToTensor(extrinsic);
+
+            voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t,
+                                 1000.0f, 3.0f, 4, true);
+        }
+    };
+
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    integrate(voxel_grid);
+    auto pcd = voxel_grid.ExtractSurfacePoints().ToLegacyPointCloud();
+
+    for (auto tsdf_dtype : {core::Dtype::Int16, core::Dtype::Int8}) {
+        t::geometry::TSDFVoxelGrid voxel_grid_q(
+                {{"tsdf", tsdf_dtype},
+                 {"weight", core::Dtype::UInt16},
+                 {"color", core::Dtype::UInt8}},
+                voxel_size, 0.04f, 16, 1000, device);
+        EXPECT_EQ(voxel_grid_q.GetBlockHashmap()->GetValueTensor().GetShape(4),
+                  tsdf_dtype.ByteSize() + 2 + 3);
+        integrate(voxel_grid_q);
+
+        auto pcd_q = voxel_grid_q.ExtractSurfacePoints().ToLegacyPointCloud();
+        auto result = pipelines::registration::EvaluateRegistration(
+                pcd_q, pcd, voxel_size);
+        EXPECT_GT(result.fitness_, 0.9);
+        EXPECT_TRUE(pcd_q.HasColors());
+
+        // Pruning truncated blocks keeps the surface.
+        int64_t block_count = voxel_grid_q.GetBlockHashmap()->Size();
+        int64_t pruned = voxel_grid_q.PruneTruncatedBlocks();
+        EXPECT_EQ(voxel_grid_q.GetBlockHashmap()->Size(), block_count - pruned);
+        auto pcd_pruned =
+                voxel_grid_q.ExtractSurfacePoints().ToLegacyPointCloud();
+        result = pipelines::registration::EvaluateRegistration(
+                pcd_q, pcd_pruned, voxel_size);
+        EXPECT_GT(result.fitness_, 0.99);
+    }
+
+    // Int16 tsdf without color would alias the Float16 layout.
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::Int16}, {"weight", core::Dtype::UInt16}},
+            voxel_size, 0.04f, 16, 1000, device));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, EraseStaleBlocks) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+
+        Eigen::Matrix4d extrinsic = trajectory->parameters_[i].extrinsic_;
+        core::Tensor extrinsic_t =
+                core::eigen_converter::EigenMatrixToTensor(extrinsic);
+
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+    }
+
+    // Observed blocks are kept, and blocks out of the last frame are erased.
+    int64_t block_count = voxel_grid.GetBlockHashmap()->Size();
+    EXPECT_EQ(voxel_grid.EraseStaleBlocks(0.0f), 0);
+    int64_t erased = voxel_grid.EraseStaleBlocks(0.0f, 1);
+    EXPECT_GT(erased, 0);
+    EXPECT_LT(erased, block_count);
+    EXPECT_EQ(voxel_grid.GetBlockHashmap()->Size(), block_count - erased);
+
+    // Without new observations, decayed uint16_t weights reach zero.
+    for (int i = 0; i < 17; ++i) {
+        voxel_grid.DecayWeights(0.5f);
+    }
+    EXPECT_EQ(voxel_grid.EraseStaleBlocks(1.0f), block_count - erased);
+    EXPECT_EQ(voxel_grid.GetBlockHashmap()->Size(), 0);
+}
+
 TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
     core::Device device = GetParam();
     std::vector<core::HashmapBackend> backends;
@@ -123,6 +613,7 @@ TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::LinearProbing);
     }
 
     for (auto backend : backends) {
@@ -175,7 +666,8 @@ TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
                                  depth_scale, depth_max);
 
             if (i == trajectory->parameters_.size() - 1) {
-                if (backend == core::HashmapBackend::Slab) {
+                if (backend == core::HashmapBackend::Slab ||
+                    backend == core::HashmapBackend::LinearProbing) {
                     EXPECT_THROW(
                             voxel_grid.RayCast(intrinsic_t, extrinsic_t,
                                                depth.GetCols(), depth.GetRows(),
@@ -26,7 +26,12 @@
 
 #include "open3d/t/geometry/TriangleMesh.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorList.h"
 #include "tests/UnitTest.h"
 
@@ -85,6 +90,25 @@ TEST_P(TriangleMeshPermuteDevices, ConstructFromVertices) {
     EXPECT_EQ(mesh.GetTriangles().GetLength(), 10);
 }
 
+TEST_P(TriangleMeshPermuteDevices, Clone) {
+    core::Device device = GetParam();
+
+    core::Tensor vertices =
+            core::Tensor::Ones({10, 3}, core::Dtype::Float32, device);
+    core::Tensor triangles =
+            core::Tensor::Ones({10, 3}, core::Dtype::Int64, device);
+    t::geometry::TriangleMesh mesh(vertices, triangles);
+
+    t::geometry::TriangleMesh mesh_copy = mesh.Clone();
+
+    // Copy does not share the same memory with source (deep copy).
+    EXPECT_EQ(mesh_copy.GetDevice(), device);
+    EXPECT_FALSE(mesh_copy.GetVertices().IsSame(mesh.GetVertices()));
+    EXPECT_FALSE(mesh_copy.GetTriangles().IsSame(mesh.GetTriangles()));
+    EXPECT_TRUE(mesh_copy.GetVertices().AllClose(mesh.GetVertices()));
+    EXPECT_TRUE(mesh_copy.GetTriangles().AllClose(mesh.GetTriangles()));
+}
+
 TEST_P(TriangleMeshPermuteDevices, Getters) {
     core::Device device = GetParam();
 
@@ -306,5 +330,369 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacyTriangleMesh) {
                       {Eigen::Vector3d(4, 4, 4), Eigen::Vector3d(4, 4, 4)}));
 }
 
+TEST_P(TriangleMeshPermuteDevices, ComputeVertexNormals) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int32,
+                    device);
+    legacy_mesh->ComputeVertexNormals();
+    mesh.ComputeVertexNormals();
+
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->vertex_normals_, core::Dtype::Float64,
+                    device)));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->triangle_normals_, core::Dtype::Float64,
+                    device)));
+
+    // Degenerate triangles keep a zero normal.
+    t::geometry::TriangleMesh flat(
+            core::Tensor::Zeros({3, 3}, core::Dtype::Float32, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device));
+    flat.ComputeTriangleNormals();
+    EXPECT_TRUE(flat.GetTriangleNormals().AllClose(
+            core::Tensor::Zeros({1, 3}, core::Dtype::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveDuplicatedVertices) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {1, 0, 0},
+                                       {0, 1, 0},
+                                       {1, 0, 0},
+                                       {0, 0, 0},
+                                       {1, 1, 0}},
+                                      device),
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {4, 3, 5}}, device));
+    mesh.SetVertexColors(core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                                    {0.1, 0.1, 0.1},
+                                                    {0.2, 0.2, 0.2},
+                                                    {0.3, 0.3, 0.3},
+                                                    {0.4, 0.4, 0.4},
+                                                    {0.5, 0.5, 0.5}},
+                                                   device));
+    mesh.RemoveDuplicatedVertices();
+
+    EXPECT_TRUE(mesh.GetVertices().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device)));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(
+            core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                       {0.1, 0.1, 0.1},
+                                       {0.2, 0.2, 0.2},
+                                       {0.5, 0.5, 0.5}},
+                                      device)));
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {0, 1, 3}}, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveUnreferencedVertices) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {5, 5, 5}, {1, 0, 0}, {0, 1, 0}, {6, 6, 6}},
+                    device),
+            core::Tensor::Init<int64_t>({{0, 2, 3}, {3, 2, 0}}, device));
+    mesh.SetVertexColors(core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                                    {0.1, 0.1, 0.1},
+                                                    {0.2, 0.2, 0.2},
+                                                    {0.3, 0.3, 0.3},
+                                                    {0.4, 0.4, 0.4}},
+                                                   device));
+    mesh.RemoveUnreferencedVertices();
+
+    EXPECT_TRUE(mesh.GetVertices().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}, device)));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(core::Tensor::Init<float>(
+            {{0.0, 0.0, 0.0}, {0.2, 0.2, 0.2}, {0.3, 0.3, 0.3}}, device)));
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {2, 1, 0}}, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveDegenerateTriangles) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>({{0, 0, 0}, {1, 0, 0}, {0, 1, 0}},
+                                      device),
+            core::Tensor::Init<int32_t>(
+                    {{0, 1, 1}, {0, 1, 2}, {2, 2, 2}, {2, 1, 0}}, device));
+    mesh.SetTriangleNormals(core::Tensor::Init<float>(
+            {{0, 0, 1}, {0, 0, 2}, {0, 0, 3}, {0, 0, 4}}, device));
+    mesh.RemoveDegenerateTriangles();
+
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {2, 1, 0}}, device)));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor::Init<float>({{0, 0, 2}, {0, 0, 4}}, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsUniformly) {
+    core::Device device = GetParam();
+
+    auto legacy_box = geometry::TriangleMesh::CreateBox();
+    t::geometry::TriangleMesh box =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_box, core::Dtype::Float32, core::Dtype::Int64,
+                    device);
+    t::geometry::PointCloud pcd = box.SamplePointsUniformly(1000, true, 42);
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 1000);
+    EXPECT_EQ(pcd.GetPointNormals().GetLength(), 1000);
+    EXPECT_TRUE(pcd.GetPoints().AllClose(
+            box.SamplePointsUniformly(1000, true, 42).GetPoints()));
+
+    // The points lie on the faces of the box, with axis-aligned normals.
+    geometry::PointCloud legacy_pcd = pcd.ToLegacyPointCloud();
+    for (size_t i = 0; i < legacy_pcd.points_.size(); ++i) {
+        Eigen::Vector3d p = legacy_pcd.points_[i];
+        Eigen::Vector3d n = legacy_pcd.normals_[i];
+        EXPECT_GE(p.minCoeff(), -1e-6);
+        EXPECT_LE(p.maxCoeff(), 1.0 + 1e-6);
+        EXPECT_NEAR(std::min(p.minCoeff(), 1.0 - p.maxCoeff()), 0.0, 1e-6);
+        EXPECT_NEAR(n.cwiseAbs().maxCoeff(), 1.0, 1e-6);
+        EXPECT_NEAR(n.norm(), 1.0, 1e-6);
+    }
+
+    EXPECT_ANY_THROW(box.SamplePointsUniformly(0));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsPoissonDisk) {
+    core::Device device = GetParam();
+
+    auto legacy_box = geometry::TriangleMesh::CreateBox();
+    t::geometry::TriangleMesh box =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_box, core::Dtype::Float32, core::Dtype::Int64,
+                    device);
+    t::geometry::PointCloud pcd = box.SamplePointsPoissonDisk(200, 5, true, 42);
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 200);
+    EXPECT_EQ(pcd.GetPointNormals().GetLength(), 200);
+
+    // Eliminating the dense samples spreads the remaining ones out more than
+    // uniform sampling does.
+    auto min_distance = [](const t::geometry::PointCloud &pcd) {
+        geometry::PointCloud legacy_pcd = pcd.ToLegacyPointCloud();
+        std::vector<double> distances =
+                legacy_pcd.ComputeNearestNeighborDistance();
+        return *std::min_element(distances.begin(), distances.end());
+    };
+    EXPECT_GT(min_distance(pcd),
+              min_distance(box.SamplePointsUniformly(200, true, 42)));
+
+    EXPECT_ANY_THROW(box.SamplePointsPoissonDisk(0));
+    EXPECT_ANY_THROW(box.SamplePointsPoissonDisk(200, 0.5));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyVertexClustering) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    legacy_mesh->ComputeVertexNormals();
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+    auto legacy_simplified = legacy_mesh->SimplifyVertexClustering(0.3);
+    t::geometry::TriangleMesh simplified = mesh.SimplifyVertexClustering(0.3);
+
+    // The vertices are in the same order, but the legacy triangles are in
+    // hash order. The legacy mesh also normalizes the vertex normals when it
+    // computes the triangle normals.
+    simplified.NormalizeNormals();
+    EXPECT_TRUE(simplified.GetVertices().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_simplified->vertices_, core::Dtype::Float64,
+                    device)));
+    EXPECT_TRUE(simplified.GetVertexNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_simplified->vertex_normals_, core::Dtype::Float64,
+                    device)));
+    auto sorted_triangles = [](std::vector<Eigen::Vector3i> triangles) {
+        std::sort(triangles.begin(), triangles.end(),
+                  [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                      return std::lexicographical_compare(
+                              a.data(), a.data() + 3, b.data(), b.data() + 3);
+                  });
+        return triangles;
+    };
+    EXPECT_EQ(sorted_triangles(simplified.ToLegacyTriangleMesh().triangles_),
+              sorted_triangles(legacy_simplified->triangles_));
+    EXPECT_TRUE(simplified.HasTriangleNormals());
+
+    EXPECT_ANY_THROW(mesh.SimplifyVertexClustering(0));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ClusterConnectedTriangles) {
+    core::Device device = GetParam();
+
+    // Three boxes, the second one sharing a vertex but no edge with the
+    // first one, and the triangles shuffled between them.
+    geometry::TriangleMesh legacy_mesh;
+    for (int i = 0; i < 3; ++i) {
+        auto box = geometry::TriangleMesh::CreateBox(1.0, 1.0 + i, 1.0);
+        box->Translate(i == 1 ? Eigen::Vector3d(1, 1, 1)
+                              : Eigen::Vector3d(3.0 * i, 0, 0));
+        legacy_mesh += *box;
+    }
+    std::swap(legacy_mesh.triangles_[1], legacy_mesh.triangles_[20]);
+    std::swap(legacy_mesh.triangles_[5], legacy_mesh.triangles_[30]);
+    legacy_mesh.MergeCloseVertices(1e-9);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+
+    core::Tensor cluster_ids, num_triangles, areas;
+    std::tie(cluster_ids, num_triangles, areas) =
+            mesh.ClusterConnectedTriangles();
+    EXPECT_EQ(cluster_ids.GetDevice(), device);
+
+    std::vector<int> clusters_ref;
+    std::vector<size_t> num_triangles_ref;
+    std::vector<double> areas_ref;
+    std::tie(clusters_ref, num_triangles_ref, areas_ref) =
+            legacy_mesh.ClusterConnectedTriangles();
+    EXPECT_EQ(num_triangles_ref.size(), 3);
+    EXPECT_EQ(cluster_ids.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(clusters_ref.begin(), clusters_ref.end()));
+    EXPECT_EQ(num_triangles.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(num_triangles_ref.begin(),
+                                   num_triangles_ref.end()));
+    ExpectEQ(areas.ToFlatVector<double>(), areas_ref);
+
+    std::tie(cluster_ids, num_triangles, areas) =
+            t::geometry::TriangleMesh(device).ClusterConnectedTriangles();
+    EXPECT_EQ(cluster_ids.GetLength(), 0);
+    EXPECT_EQ(num_triangles.GetLength(), 0);
+}
+
+TEST_P(TriangleMeshPermuteDevices, FilterSmooth) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    legacy_mesh->vertex_colors_.resize(legacy_mesh->vertices_.size());
+    Rand(legacy_mesh->vertex_colors_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(1, 1, 1), 0);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+
+    auto expect_eq = [](const t::geometry::TriangleMesh &filtered,
+                        const geometry::TriangleMesh &ref) {
+        geometry::TriangleMesh filtered_legacy =
+                filtered.ToLegacyTriangleMesh();
+        ExpectEQ(filtered_legacy.vertices_, ref.vertices_);
+        ExpectEQ(filtered_legacy.vertex_colors_, ref.vertex_colors_);
+    };
+    expect_eq(mesh.FilterSharpen(2, 0.1),
+              *legacy_mesh->FilterSharpen(2, 0.1));
+    expect_eq(mesh.FilterSmoothSimple(3), *legacy_mesh->FilterSmoothSimple(3));
+    expect_eq(mesh.FilterSmoothLaplacian(3, 0.5),
+              *legacy_mesh->FilterSmoothLaplacian(3, 0.5));
+    expect_eq(mesh.FilterSmoothTaubin(3),
+              *legacy_mesh->FilterSmoothTaubin(3));
+    expect_eq(mesh.FilterSmoothLaplacian(
+                      2, 0.5, t::geometry::TriangleMesh::FilterScope::Color),
+              *legacy_mesh->FilterSmoothLaplacian(
+                      2, 0.5, geometry::MeshBase::FilterScope::Color));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SubdivideMidpoint) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateBox();
+    legacy_mesh->vertex_colors_.resize(legacy_mesh->vertices_.size());
+    Rand(legacy_mesh->vertex_colors_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(1, 1, 1), 0);
+    legacy_mesh->ComputeTriangleNormals();
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+
+    t::geometry::TriangleMesh subdivided = mesh.SubdivideMidpoint(2);
+    EXPECT_EQ(subdivided.GetDevice(), device);
+    auto ref = legacy_mesh->SubdivideMidpoint(2);
+    geometry::TriangleMesh subdivided_legacy =
+            subdivided.ToLegacyTriangleMesh();
+    ExpectEQ(subdivided_legacy.vertices_, ref->vertices_);
+    ExpectEQ(subdivided_legacy.vertex_colors_, ref->vertex_colors_);
+    ExpectEQ(subdivided_legacy.triangles_, ref->triangles_);
+    ExpectEQ(subdivided_legacy.triangle_normals_, ref->triangle_normals_);
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputePointDistance) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+    std::vector<Eigen::Vector3d> queries(500);
+    Rand(queries, Eigen::Vector3d(-2, -2, -2), Eigen::Vector3d(2, 2, 2), 0);
+    core::Tensor query_points =
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    queries, core::Dtype::Float64, device);
+
+    core::Tensor distances, closest_triangles;
+    std::tie(distances, closest_triangles) =
+            mesh.ComputePointDistance(query_points);
+    EXPECT_EQ(distances.GetShape(), core::SizeVector({500}));
+    EXPECT_EQ(closest_triangles.GetDtype(), core::Dtype::Int64);
+
+    // Reference by brute force over the triangles, with the distance to the
+    // plane, the edges or the vertices of each triangle.
+    auto segment_distance = [](const Eigen::Vector3d &p,
+                               const Eigen::Vector3d &a,
+                               const Eigen::Vector3d &b) {
+        Eigen::Vector3d ab = b - a;
+        double s = std::min(1.0, std::max(0.0, (p - a).dot(ab) / ab.dot(ab)));
+        return (p - a - s * ab).norm();
+    };
+    auto triangle_distance = [&](const Eigen::Vector3d &p, int64_t idx) {
+        const Eigen::Vector3i &t = legacy_mesh->triangles_[idx];
+        const Eigen::Vector3d &a = legacy_mesh->vertices_[t(0)];
+        const Eigen::Vector3d &b = legacy_mesh->vertices_[t(1)];
+        const Eigen::Vector3d &c = legacy_mesh->vertices_[t(2)];
+        Eigen::Vector3d n = (b - a).cross(c - a).normalized();
+        Eigen::Vector3d q = p - (p - a).dot(n) * n;
+        if ((b - a).cross(q - a).dot(n) >= 0 &&
+            (c - b).cross(q - b).dot(n) >= 0 &&
+            (a - c).cross(q - c).dot(n) >= 0) {
+            return std::abs((p - a).dot(n));
+        }
+        return std::min({segment_distance(p, a, b), segment_distance(p, b, c),
+                         segment_distance(p, c, a)});
+    };
+    std::vector<double> distances_vec = distances.ToFlatVector<double>();
+    std::vector<int64_t> closest_vec =
+            closest_triangles.ToFlatVector<int64_t>();
+    const int64_t num_triangles = int64_t(legacy_mesh->triangles_.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        double distance_ref = std::numeric_limits<double>::infinity();
+        for (int64_t idx = 0; idx < num_triangles; ++idx) {
+            distance_ref =
+                    std::min(distance_ref, triangle_distance(queries[i], idx));
+        }
+        EXPECT_NEAR(distances_vec[i], distance_ref, 1e-9);
+        ASSERT_GE(closest_vec[i], 0);
+        ASSERT_LT(closest_vec[i], num_triangles);
+        EXPECT_NEAR(triangle_distance(queries[i], closest_vec[i]),
+                    distance_ref, 1e-9);
+    }
+
+    EXPECT_ANY_THROW(t::geometry::TriangleMesh(device).ComputePointDistance(
+            query_points));
+}
+
 }  // namespace tests
 }  // namespace open3d
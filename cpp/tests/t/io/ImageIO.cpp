@@ -28,6 +28,7 @@
 
 #include <gtest/gtest.h>
 
+#include "core/CoreTest.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -129,6 +130,48 @@ TEST(ImageIO, ReadImage) {
     RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.png");
 }
 
+class ImageIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ImageIO,
+                         ImageIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ImageIOPermuteDevices, ReadImages) {
+    core::Device device = GetParam();
+    WriteTestImage(CreateTestImage());
+    const std::vector<std::string> filenames = {
+            std::string(TEST_DATA_DIR) + "/test_imageio.jpg",
+            std::string(TEST_DATA_DIR) + "/test_imageio.png",
+            std::string(TEST_DATA_DIR) + "/test_imageio.jpg"};
+    std::vector<t::geometry::Image> images;
+    EXPECT_TRUE(t::io::ReadImages(filenames, images, device));
+    ASSERT_EQ(images.size(), 3u);
+
+    // GPU and CPU JPEG decoders may round differently.
+    t::geometry::Image test_img = CreateTestImage();
+    for (const t::geometry::Image &img : images) {
+        EXPECT_EQ(img.GetRows(), 150);
+        EXPECT_EQ(img.GetCols(), 100);
+        EXPECT_EQ(img.GetChannels(), 3);
+        EXPECT_EQ(img.GetDtype(), core::Dtype::UInt8);
+        EXPECT_EQ(img.GetDevice(), device);
+        EXPECT_TRUE(img.AsTensor()
+                            .To(core::Device("CPU:0"))
+                            .To(core::Dtype::Float32)
+                            .AllClose(test_img.AsTensor().To(
+                                              core::Dtype::Float32),
+                                      0, 2));
+    }
+
+    t::geometry::Image img;
+    EXPECT_TRUE(t::io::ReadImage(filenames[0], img, device));
+    EXPECT_EQ(img.GetDevice(), device);
+    EXPECT_FALSE(t::io::ReadImage(std::string(TEST_DATA_DIR) + "/no.jpg",
+                                  img, device));
+
+    RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.jpg");
+    RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.png");
+}
+
 TEST(ImageIO, ReadImageFromPNG) {
     WriteTestImage(CreateTestImage());
     t::geometry::Image img;
@@ -28,12 +28,18 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
+#include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/ChunkedGeometryIO.h"
+#include "open3d/t/io/PointCloudStream.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -158,6 +164,216 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY1) {
     EXPECT_FALSE(pcd.HasPointAttr("x"));
 }
 
+// Binary files are decoded in bulk, compare against the rply ascii reader.
+TEST(TPointCloudIO, ReadPointCloudFromPLYBinaryMatchesASCII) {
+    t::geometry::PointCloud pcd_binary;
+    EXPECT_TRUE(t::io::ReadPointCloud(
+            std::string(TEST_DATA_DIR) + "/fragment.ply", pcd_binary,
+            {"auto", false, false, true}));
+    EXPECT_TRUE(t::io::WritePointCloud("test_fragment_ascii.ply", pcd_binary,
+                                       {true, false, true}));
+    t::geometry::PointCloud pcd_ascii;
+    EXPECT_TRUE(t::io::ReadPointCloud("test_fragment_ascii.ply", pcd_ascii,
+                                      {"auto", false, false, true}));
+
+    EXPECT_TRUE(pcd_binary.GetPoints().AllClose(pcd_ascii.GetPoints(), 1e-5,
+                                                1e-5));
+    EXPECT_TRUE(pcd_binary.GetPointNormals().AllClose(
+            pcd_ascii.GetPointNormals(), 1e-5, 1e-5));
+    EXPECT_TRUE(pcd_binary.GetPointColors().AllClose(
+            pcd_ascii.GetPointColors(), 0, 0));
+    EXPECT_TRUE(pcd_binary.GetPointAttr("curvature")
+                        .AllClose(pcd_ascii.GetPointAttr("curvature"), 1e-5,
+                                  1e-5));
+}
+
+// Arbitrary PCD fields survive ascii, binary and binary_compressed round
+// trips. The compressed data spans several LZF chunks.
+TEST(TPointCloudIO, ReadWritePCDFields) {
+    const int64_t num_points = 100000;
+    std::vector<float> points(num_points * 3);
+    std::vector<float> normals(num_points * 3);
+    std::vector<uint8_t> colors(num_points * 3);
+    std::vector<float> intensity(num_points);
+    std::vector<uint16_t> ring(num_points);
+    std::vector<double> timestamp(num_points);
+    for (int64_t i = 0; i < num_points; i++) {
+        for (int64_t k = 0; k < 3; k++) {
+            points[3 * i + k] = 0.001f * i + 0.5f * k;
+            normals[3 * i + k] = k == i % 3 ? 1.f : 0.f;
+            colors[3 * i + k] = static_cast<uint8_t>(i * (k + 1));
+        }
+        intensity[i] = 0.25f * (i % 7);
+        ring[i] = static_cast<uint16_t>(i % 64);
+        timestamp[i] = 1.6e9 + 1e-6 * i;
+    }
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor(points, {num_points, 3}, core::Dtype::Float32));
+    pcd.SetPointNormals(
+            core::Tensor(normals, {num_points, 3}, core::Dtype::Float32));
+    pcd.SetPointColors(
+            core::Tensor(colors, {num_points, 3}, core::Dtype::UInt8));
+    pcd.SetPointAttr("intensity", core::Tensor(intensity, {num_points, 1},
+                                               core::Dtype::Float32));
+    pcd.SetPointAttr("ring",
+                     core::Tensor(ring, {num_points, 1}, core::Dtype::UInt16));
+    pcd.SetPointAttr("timestamp", core::Tensor(timestamp, {num_points, 1},
+                                               core::Dtype::Float64));
+
+    const std::string filename = "test_fields.pcd";
+    for (bool write_ascii : {true, false}) {
+        for (bool compressed : {false, true}) {
+            SCOPED_TRACE(fmt::format("ascii {} compressed {}", write_ascii,
+                                     compressed));
+            EXPECT_TRUE(t::io::WritePointCloud(
+                    filename, pcd, {write_ascii, compressed, false}));
+            t::geometry::PointCloud pcd_read;
+            EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read,
+                                              {"auto", false, false, false}));
+            for (const std::string name : {"points", "normals", "colors",
+                                           "intensity", "ring", "timestamp"}) {
+                SCOPED_TRACE(name);
+                const core::Tensor &expected = pcd.GetPointAttr(name);
+                const core::Tensor &actual = pcd_read.GetPointAttr(name);
+                EXPECT_EQ(actual.GetDtype(), expected.GetDtype());
+                EXPECT_EQ(actual.GetShape(), expected.GetShape());
+                EXPECT_TRUE(actual.AllClose(expected, 0, 0));
+            }
+
+            // The legacy reader decodes the same file.
+            open3d::geometry::PointCloud legacy_pcd;
+            EXPECT_TRUE(open3d::io::ReadPointCloud(
+                    filename, legacy_pcd, {"auto", false, false, false}));
+            EXPECT_EQ(legacy_pcd.points_.size(), size_t(num_points));
+            ExpectEQ(legacy_pcd.points_.back(),
+                     Eigen::Vector3d(points[3 * num_points - 3],
+                                     points[3 * num_points - 2],
+                                     points[3 * num_points - 1]));
+        }
+    }
+    utility::filesystem::RemoveFile(filename);
+}
+
+TEST(TPointCloudIO, ReadWriteChunked) {
+    // 50 x 50 x 4 grid, split into 5 x 5 x 1 tiles of 400 points.
+    const int64_t num_points = 10000;
+    std::vector<float> points(num_points * 3);
+    std::vector<int32_t> labels(num_points);
+    for (int64_t i = 0; i < num_points; i++) {
+        points[3 * i + 0] = float(i % 50);
+        points[3 * i + 1] = float((i / 50) % 50);
+        points[3 * i + 2] = float(i / 2500);
+        labels[i] = int32_t(i);
+    }
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor(points, {num_points, 3}, core::Dtype::Float32));
+    pcd.SetPointAttr("labels", core::Tensor(labels, {num_points, 1},
+                                            core::Dtype::Int32));
+
+    const std::string filename = "test_chunked.o3dc";
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        t::io::ChunkedGeometryWriteOption option;
+        option.tile_size = 10.0;
+        option.num_lods = 3;
+        option.compressed = compressed;
+        EXPECT_TRUE(t::io::WriteChunkedPointCloud(filename, pcd, option));
+
+        std::vector<t::io::ChunkInfo> chunks;
+        EXPECT_TRUE(t::io::ReadChunkedGeometryInfo(filename, chunks));
+        EXPECT_EQ(chunks.size(), 75u);
+
+        // All levels hold every point once, with its attributes.
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::ReadChunkedPointCloud(filename, pcd_read));
+        EXPECT_EQ(pcd_read.GetPoints().GetLength(), num_points);
+        EXPECT_EQ(pcd_read.GetPoints().GetDtype(), core::Dtype::Float32);
+        const float *points_read = pcd_read.GetPoints().GetDataPtr<float>();
+        const int32_t *labels_read =
+                pcd_read.GetPointAttr("labels").GetDataPtr<int32_t>();
+        std::vector<bool> seen(num_points, false);
+        for (int64_t i = 0; i < num_points; i++) {
+            const int32_t label = labels_read[i];
+            ASSERT_TRUE(label >= 0 && label < num_points && !seen[label]);
+            seen[label] = true;
+            for (int64_t k = 0; k < 3; k++) {
+                EXPECT_EQ(points_read[3 * i + k], points[3 * label + k]);
+            }
+        }
+
+        // Level 0 holds every 16th point of a tile.
+        EXPECT_TRUE(t::io::ReadChunkedPointCloud(filename, pcd_read, 0));
+        EXPECT_EQ(pcd_read.GetPoints().GetLength(), 25 * 25);
+
+        // Only the chunks of the first tile intersect the box.
+        EXPECT_TRUE(t::io::ReadChunkedPointCloud(
+                filename, pcd_read,
+                geometry::AxisAlignedBoundingBox(
+                        Eigen::Vector3d(0.0, 0.0, 0.0),
+                        Eigen::Vector3d(9.5, 9.5, 3.0))));
+        EXPECT_EQ(pcd_read.GetPoints().GetLength(), 400);
+
+        // Whole-file reads through the generic entrance.
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read));
+        EXPECT_EQ(pcd_read.GetPoints().GetLength(), num_points);
+    }
+    utility::filesystem::RemoveFile(filename);
+}
+
+TEST(TPointCloudIO, ReadWriteStream) {
+    const int64_t num_points = 1000;
+    std::vector<float> points(num_points * 3);
+    for (int64_t i = 0; i < num_points * 3; i++) {
+        points[i] = float(i % 97);
+    }
+    const core::Tensor all_points(points, {num_points, 3},
+                                  core::Dtype::Float32);
+
+    for (const std::string filename :
+         {"test_stream.xyz", "test_stream.ply", "test_stream.pcd",
+          "test_stream.o3dc"}) {
+        SCOPED_TRACE(filename);
+        // Written in chunks of 300 points.
+        auto writer = t::io::PointCloudWriter::Create(filename);
+        ASSERT_TRUE(writer);
+        for (int64_t begin = 0; begin < num_points; begin += 300) {
+            const int64_t end = std::min(begin + 300, num_points);
+            EXPECT_TRUE(writer->WriteChunk(
+                    t::geometry::PointCloud(all_points.Slice(0, begin, end))));
+        }
+        EXPECT_TRUE(writer->Close());
+
+        // Read in chunks of 256 points.
+        auto reader = t::io::PointCloudReader::Create(filename);
+        ASSERT_TRUE(reader);
+        if (reader->GetNumPoints() >= 0) {
+            EXPECT_EQ(reader->GetNumPoints(), num_points);
+        }
+        std::vector<double> points_read;
+        t::geometry::PointCloud chunk;
+        while (!reader->IsEOF()) {
+            ASSERT_TRUE(reader->ReadChunk(256, chunk));
+            EXPECT_LE(chunk.GetPoints().GetLength(), 256);
+            const core::Tensor chunk_points =
+                    chunk.GetPoints().To(core::Dtype::Float64).Contiguous();
+            const double *data = chunk_points.GetDataPtr<double>();
+            points_read.insert(points_read.end(), data,
+                               data + chunk_points.NumElements());
+        }
+        reader->Close();
+        ASSERT_EQ(points_read.size(), points.size());
+
+        // The chunked format reorders points by tile.
+        std::vector<double> expected(points.begin(), points.end());
+        if (filename == "test_stream.o3dc") {
+            std::sort(expected.begin(), expected.end());
+            std::sort(points_read.begin(), points_read.end());
+        }
+        EXPECT_EQ(points_read, expected);
+        utility::filesystem::RemoveFile(filename);
+    }
+}
+
 // Reading ascii.
 TEST(TPointCloudIO, ReadPointCloudFromPLY2) {
     t::geometry::PointCloud pcd;
@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/RGBDDatasetLoader.h"
+
+#include <gtest/gtest.h>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(RGBDDatasetLoader, Next) {
+    std::vector<std::string> color_files, depth_files;
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 5; ++i) {
+        color_files.push_back(fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                          TEST_DATA_DIR, i));
+        depth_files.push_back(fmt::format("{}/RGBD/depth/{:05d}.png",
+                                          TEST_DATA_DIR, i));
+        camera::PinholeCameraParameters parameters;
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_(0, 3) = i;
+        trajectory.parameters_.push_back(parameters);
+    }
+
+    // Fewer slots than frames, so that slots are reused.
+    t::io::RGBDDatasetLoaderOption option;
+    option.num_threads = 2;
+    option.prefetch = 3;
+    t::io::RGBDDatasetLoader loader(color_files, depth_files, trajectory,
+                                    option);
+    EXPECT_EQ(loader.GetFrameCount(), 5);
+
+    t::geometry::RGBDImage rgbd;
+    core::Tensor extrinsic;
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(loader.GetNextFrameIndex(), i);
+        ASSERT_TRUE(loader.Next(rgbd, extrinsic));
+        t::geometry::Image color, depth;
+        ASSERT_TRUE(t::io::ReadImage(color_files[i], color));
+        ASSERT_TRUE(t::io::ReadImage(depth_files[i], depth));
+        EXPECT_TRUE(rgbd.color_.AsTensor().AllClose(color.AsTensor()));
+        EXPECT_TRUE(rgbd.depth_.AsTensor().AllClose(depth.AsTensor()));
+        EXPECT_EQ(extrinsic[0][3].Item<double>(), i);
+    }
+    EXPECT_FALSE(loader.Next(rgbd));
+
+    // Destroying a loader with frames in flight stops its threads.
+    t::io::RGBDDatasetLoader unfinished(color_files, depth_files, option);
+    EXPECT_TRUE(unfinished.Next(rgbd));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+#include <gtest/gtest.h>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+/// Reader returning num_frames frames with depth value i for frame i.
+class FakeVideoReader : public t::io::RGBDVideoReader {
+public:
+    explicit FakeVideoReader(int64_t num_frames) : num_frames_(num_frames) {}
+    ~FakeVideoReader() override { StopPrefetch(); }
+
+    bool IsOpened() const override { return true; }
+    bool IsEOF() const override { return next_ >= num_frames_; }
+    bool Open(const std::string &filename) override { return true; }
+    void Close() override { StopPrefetch(); }
+    t::io::RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+    const t::io::RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+    bool SeekTimestamp(uint64_t timestamp) override {
+        next_ = int64_t(timestamp / 1000);
+        return true;
+    }
+    uint64_t GetTimestamp() const override { return (next_ - 1) * 1000; }
+    t::geometry::RGBDImage NextFrame() override {
+        if (IsEOF()) return t::geometry::RGBDImage();
+        const float value = float(next_++);
+        return t::geometry::RGBDImage(
+                core::Tensor::Zeros({4, 4, 3}, core::Dtype::UInt8),
+                core::Tensor::Full({4, 4, 1}, value, core::Dtype::Float32));
+    }
+    std::string GetFilename() const override { return "fake"; }
+
+    using t::io::RGBDVideoReader::NextFrame;
+
+private:
+    int64_t num_frames_;
+    int64_t next_ = 0;
+    t::io::RGBDVideoMetadata metadata_;
+};
+
+class RGBDVideoReaderPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(RGBDVideoReader,
+                         RGBDVideoReaderPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(RGBDVideoReaderPermuteDevices, NextFrames) {
+    core::Device device = GetParam();
+    FakeVideoReader reader(10);
+    std::vector<t::geometry::RGBDImage> frames = reader.NextFrames(4, device);
+    ASSERT_EQ(frames.size(), 4u);
+    EXPECT_EQ(frames[3].depth_.GetDevice(), device);
+    EXPECT_EQ(frames[3].depth_.AsTensor()[0][0][0].Item<float>(), 3.f);
+
+    uint64_t timestamp = 0;
+    t::geometry::RGBDImage frame = reader.NextFrame(device, &timestamp);
+    EXPECT_EQ(timestamp, 4000u);
+    EXPECT_EQ(reader.NextFrames(100, device).size(), 5u);
+    EXPECT_TRUE(reader.NextFrame(device).IsEmpty());
+}
+
+TEST_P(RGBDVideoReaderPermuteDevices, Prefetch) {
+    core::Device device = GetParam();
+    FakeVideoReader reader(20);
+    reader.StartPrefetch(device, 3);
+    EXPECT_TRUE(reader.IsPrefetching());
+    for (int i = 0; i < 20; ++i) {
+        uint64_t timestamp = 0;
+        t::geometry::RGBDImage frame = reader.NextFrame(device, &timestamp);
+        ASSERT_FALSE(frame.IsEmpty());
+        EXPECT_EQ(frame.depth_.GetDevice(), device);
+        EXPECT_EQ(frame.depth_.AsTensor()[0][0][0].Item<float>(), float(i));
+        EXPECT_EQ(timestamp, uint64_t(i) * 1000);
+    }
+    EXPECT_TRUE(reader.NextFrame(device).IsEmpty());
+    EXPECT_TRUE(reader.NextFrames(4, device).empty());
+
+    // Stopping discards the prefetched frames.
+    reader.SeekTimestamp(0);
+    reader.StartPrefetch(device, 2);
+    EXPECT_EQ(reader.NextFrames(2, device).size(), 2u);
+    reader.StopPrefetch();
+    EXPECT_FALSE(reader.IsPrefetching());
+}
+
+}  // namespace tests
+}  // namespace open3d
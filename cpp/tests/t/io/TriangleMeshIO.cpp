@@ -28,6 +28,7 @@
 
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/io/ChunkedGeometryIO.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -50,6 +51,61 @@ TEST(TriangleMeshIO, ReadWriteTriangleMeshPLY) {
     std::remove(file_name.c_str());
 }
 
+TEST(TriangleMeshIO, ReadWriteTriangleMeshPLYAttributes) {
+    t::geometry::TriangleMesh mesh;
+    mesh.SetVertices(core::Tensor::Init<double>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 1}}));
+    mesh.SetVertexColors(core::Tensor::Init<uint8_t>(
+            {{255, 0, 0}, {0, 255, 0}, {0, 0, 255}, {9, 9, 9}}));
+    mesh.SetVertexAttr("intensity",
+                       core::Tensor::Init<float>({{0.5}, {1.5}, {2.5}, {3.5}}));
+    mesh.SetTriangles(core::Tensor::Init<int64_t>({{0, 1, 2}, {1, 3, 2}}));
+    mesh.SetTriangleAttr("label", core::Tensor::Init<int32_t>({{7}, {-3}}));
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_mesh.ply";
+    for (bool write_ascii : {false, true}) {
+        t::geometry::TriangleMesh mesh_read;
+        EXPECT_TRUE(t::io::WriteTriangleMesh(file_name, mesh, write_ascii));
+        EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read));
+        EXPECT_EQ(mesh_read.GetVertices().GetDtype(), core::Dtype::Float64);
+        EXPECT_TRUE(mesh_read.GetVertices().AllClose(mesh.GetVertices()));
+        EXPECT_EQ(mesh_read.GetVertexColors().GetDtype(), core::Dtype::UInt8);
+        EXPECT_TRUE(
+                mesh_read.GetVertexColors().AllClose(mesh.GetVertexColors()));
+        EXPECT_TRUE(mesh_read.GetVertexAttr("intensity")
+                            .AllClose(mesh.GetVertexAttr("intensity")));
+        EXPECT_TRUE(mesh_read.GetTriangles().AllClose(mesh.GetTriangles()));
+        EXPECT_EQ(mesh_read.GetTriangleAttr("label").GetDtype(),
+                  core::Dtype::Int32);
+        EXPECT_TRUE(mesh_read.GetTriangleAttr("label").AllClose(
+                mesh.GetTriangleAttr("label")));
+    }
+    std::remove(file_name.c_str());
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshPLYPolygons) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_polygons.ply";
+    FILE *file = fopen(file_name.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fputs("ply\nformat ascii 1.0\nelement vertex 5\n"
+          "property float x\nproperty float y\nproperty float z\n"
+          "element face 2\nproperty list uchar int vertex_indices\n"
+          "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+          "end_header\n0 0 0\n1 0 0\n1 1 0\n0 1 0\n2 2 0\n"
+          "4 0 1 2 3 10 20 30\n3 1 4 2 40 50 60\n",
+          file);
+    fclose(file);
+
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh));
+    EXPECT_EQ(mesh.GetVertices().GetDtype(), core::Dtype::Float32);
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}, {1, 4, 2}})));
+    EXPECT_TRUE(mesh.GetTriangleColors().AllClose(core::Tensor::Init<uint8_t>(
+            {{10, 20, 30}, {10, 20, 30}, {40, 50, 60}})));
+    std::remove(file_name.c_str());
+}
+
 TEST(TriangleMeshIO, ReadWriteTriangleMeshOBJ) {
     t::geometry::TriangleMesh mesh, mesh_read;
     EXPECT_TRUE(t::io::ReadTriangleMesh(
@@ -91,6 +147,36 @@ TEST(TriangleMeshIO, ReadWriteTriangleMeshOBJ) {
     std::remove(file_name.c_str());
 }
 
+TEST(TriangleMeshIO, ReadWriteTriangleMeshChunked) {
+    t::geometry::TriangleMesh mesh, mesh_read;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(TEST_DATA_DIR "/knot.ply", mesh));
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_mesh.o3dc";
+    t::io::ChunkedGeometryWriteOption option;
+    option.points_per_tile = 256;
+    option.compressed = true;
+    EXPECT_TRUE(t::io::WriteChunkedTriangleMesh(file_name, mesh, option));
+
+    // Vertices are duplicated across chunks, so compare triangle corners.
+    auto corners = [](const t::geometry::TriangleMesh &m) {
+        return m.GetVertices()
+                .IndexGet({m.GetTriangles().Reshape({-1})})
+                .To(core::Dtype::Float64)
+                .Sum({0});
+    };
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read));
+    EXPECT_EQ(mesh_read.GetTriangles().GetLength(), 2880);
+    EXPECT_TRUE(corners(mesh_read).AllClose(corners(mesh)));
+
+    std::vector<t::io::ChunkInfo> chunks;
+    EXPECT_TRUE(t::io::ReadChunkedGeometryInfo(file_name, chunks));
+    EXPECT_GT(chunks.size(), 1u);
+    EXPECT_TRUE(t::io::ReadChunkedTriangleMesh(file_name, mesh_read,
+                                               chunks[0].bbox));
+    EXPECT_GT(mesh_read.GetTriangles().GetLength(), 0);
+    EXPECT_LT(mesh_read.GetTriangles().GetLength(), 2880);
+    std::remove(file_name.c_str());
+}
+
 // TODO: Add tests for triangle_uvs, materials, triangle_material_ids and
 // textures once these are supported.
 TEST(TriangleMeshIO, TriangleMeshLegecyCompatibility) {
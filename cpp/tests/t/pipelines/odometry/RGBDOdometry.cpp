@@ -188,5 +188,58 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScale) {
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
 
+TEST_P(OdometryPermuteDevices, RGBDOdometryTracker) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+    const std::vector<int> iterations = {10, 5, 3};
+
+    const std::vector<std::string> names = {"00000", "00001", "00002"};
+    std::vector<t::geometry::RGBDImage> frames(names.size());
+    for (size_t i = 0; i < names.size(); ++i) {
+        frames[i].depth_ = t::io::CreateImageFromFile(
+                                   std::string(TEST_DATA_DIR) +
+                                   "/RGBD/depth/" + names[i] + ".png")
+                                   ->To(device);
+        frames[i].color_ = t::io::CreateImageFromFile(
+                                   std::string(TEST_DATA_DIR) +
+                                   "/RGBD/color/" + names[i] + ".jpg")
+                                   ->To(device);
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    t::pipelines::odometry::RGBDOdometryTracker tracker(
+            intrinsic_t, depth_scale, depth_max, depth_diff, iterations);
+
+    core::Device host("CPU:0");
+    core::Tensor identity = core::Tensor::Eye(4, core::Dtype::Float64, host);
+    core::Tensor trans = tracker.Track(frames[0]);
+    EXPECT_TRUE(trans.AllClose(identity));
+    EXPECT_TRUE(tracker.HasReference());
+    EXPECT_EQ(tracker.GetPyramidTimes().size(), iterations.size());
+    EXPECT_EQ(tracker.GetOdometryTimes().size(), iterations.size());
+
+    // Each step reuses the previous pyramid and must match the pairwise API.
+    for (size_t i = 1; i < frames.size(); ++i) {
+        trans = tracker.Track(frames[i]);
+        core::Tensor trans_pair =
+                t::pipelines::odometry::RGBDOdometryMultiScale(
+                        frames[i], frames[i - 1], intrinsic_t, identity,
+                        depth_scale, depth_max, depth_diff, iterations);
+        EXPECT_TRUE(trans.AllClose(trans_pair, 1e-5, 1e-5));
+    }
+
+    tracker.Reset();
+    EXPECT_FALSE(tracker.HasReference());
+    trans = tracker.Track(frames[2]);
+    EXPECT_TRUE(trans.AllClose(identity));
+}
+
 }  // namespace tests
 }  // namespace open3d
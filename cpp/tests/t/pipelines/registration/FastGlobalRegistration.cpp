@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FastGlobalRegistrationPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FastGlobalRegistration,
+                         FastGlobalRegistrationPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FastGlobalRegistrationPermuteDevices, FastGlobalRegistration) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud source_legacy;
+    source_legacy.points_.resize(500);
+    Rand(source_legacy.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.2, -0.1, 0.3);
+    geometry::PointCloud target_legacy = source_legacy;
+    target_legacy.Transform(transformation);
+
+    t::geometry::PointCloud source =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    source_legacy, core::Dtype::Float32, device);
+    t::geometry::PointCloud target =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    target_legacy, core::Dtype::Float32, device);
+
+    // Point i of the target corresponds to point i of the source, so that
+    // the same distinct features are used for both.
+    core::Tensor features = source.GetPoints().Clone();
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::FastGlobalRegistration(
+                    source, target, features, features);
+
+    EXPECT_EQ(result.transformation_.GetShape(), core::SizeVector({4, 4}));
+    EXPECT_TRUE(result.transformation_.AllClose(
+            core::eigen_converter::EigenMatrixToTensor(transformation), 1e-3,
+            1e-3));
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-6);
+
+    // Without distinct features, there are too few matches to estimate a
+    // transformation.
+    result = t::pipelines::registration::FastGlobalRegistration(
+            source, target, features,
+            core::Tensor::Zeros({500, 3}, core::Dtype::Float32, device));
+    EXPECT_TRUE(result.transformation_.AllClose(
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"))));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_.resize(200);
+    Rand(pcd_legacy.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    pcd_legacy.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float64, device);
+
+    // KNN search.
+    auto fpfh_legacy = pipelines::registration::ComputeFPFHFeature(
+            pcd_legacy, geometry::KDTreeSearchParamKNN(15));
+    core::Tensor fpfh = t::pipelines::registration::ComputeFPFHFeature(pcd, 15);
+    EXPECT_EQ(fpfh.GetShape(), core::SizeVector({200, 33}));
+    EXPECT_TRUE(fpfh.AllClose(core::eigen_converter::EigenMatrixToTensor(
+                                      fpfh_legacy->data_)
+                                      .T()
+                                      .To(device),
+                              1e-4, 1e-4));
+
+    // Hybrid search.
+    fpfh_legacy = pipelines::registration::ComputeFPFHFeature(
+            pcd_legacy, geometry::KDTreeSearchParamHybrid(0.2, 30));
+    fpfh = t::pipelines::registration::ComputeFPFHFeature(pcd, 30, 0.2);
+    EXPECT_TRUE(fpfh.AllClose(core::eigen_converter::EigenMatrixToTensor(
+                                      fpfh_legacy->data_)
+                                      .T()
+                                      .To(device),
+                              1e-4, 1e-4));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Metrics.h"
+
+#include <thread>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Metrics, Counter) {
+    utility::Counter& counter = utility::Metrics::GetCounter(
+            "test_metrics_counter_total", {}, "Test counter.");
+    counter.Reset();
+    counter.Add();
+    counter.Add(41);
+    EXPECT_EQ(counter.Get(), 42);
+
+    // The same name and labels return the same counter.
+    EXPECT_EQ(&utility::Metrics::GetCounter("test_metrics_counter_total"),
+              &counter);
+    EXPECT_NE(&utility::Metrics::GetCounter("test_metrics_counter_total",
+                                            {{"kind", "other"}}),
+              &counter);
+
+    std::map<std::string, int64_t> values = utility::Metrics::GetValues();
+    EXPECT_EQ(values.at("test_metrics_counter_total"), 42);
+    EXPECT_EQ(values.at("test_metrics_counter_total{kind=\"other\"}"), 0);
+
+    utility::Metrics::Reset();
+    EXPECT_EQ(counter.Get(), 0);
+}
+
+TEST(Metrics, Threads) {
+    utility::Counter& counter =
+            utility::Metrics::GetCounter("test_metrics_threads_total");
+    counter.Reset();
+    const int num_threads = 8;
+    const int num_adds = 10000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&counter]() {
+            for (int j = 0; j < num_adds; ++j) {
+                counter.Add();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.Get(), num_threads * num_adds);
+}
+
+TEST(Metrics, PrometheusText) {
+    utility::Metrics::GetCounter("test_metrics_prometheus_total",
+                                 {{"device", "CPU:0"}, {"path", "a\"b\\c"}},
+                                 "Help with\na newline.")
+            .Add(3);
+    std::string text = utility::Metrics::ToPrometheusText();
+    EXPECT_NE(text.find("# HELP test_metrics_prometheus_total Help with\\na "
+                        "newline.\n"
+                        "# TYPE test_metrics_prometheus_total counter\n"
+                        "test_metrics_prometheus_total{device=\"CPU:0\","
+                        "path=\"a\\\"b\\\\c\"} 3\n"),
+              std::string::npos);
+}
+
+TEST(Metrics, InvalidName) {
+    EXPECT_ANY_THROW(utility::Metrics::GetCounter("0invalid"));
+    EXPECT_ANY_THROW(utility::Metrics::GetCounter("test_metrics_label_total",
+                                                  {{"in-valid", "x"}}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Counts the calls, and runs the chunks on the calling thread.
+class CountingExecutor : public utility::ParallelExecutor {
+public:
+    void ParallelFor(
+            int64_t begin,
+            int64_t end,
+            int64_t grain_size,
+            int max_parallelism,
+            const std::function<void(int64_t, int64_t)>& func) override {
+        num_calls_++;
+        last_max_parallelism_ = max_parallelism;
+        for (int64_t i = begin; i < end; i += grain_size) {
+            func(i, std::min(i + grain_size, end));
+        }
+    }
+    int GetMaxParallelism() const override { return 8; }
+    std::string GetName() const override { return "Counting"; }
+
+    int num_calls_ = 0;
+    int last_max_parallelism_ = 0;
+};
+
+}  // namespace
+
+TEST(Parallel, ParallelForBackends) {
+    const int64_t n = 100003;
+    for (const auto& executor :
+         {utility::CreateTBBExecutor(), utility::CreateOpenMPExecutor(),
+          utility::CreateSerialExecutor()}) {
+        utility::SetParallelExecutor(executor);
+        EXPECT_EQ(utility::GetParallelExecutor()->GetName(),
+                  executor->GetName());
+        EXPECT_FALSE(utility::InParallelRegion());
+
+        std::vector<int> visits(n, 0);
+        std::atomic<bool> in_region(true);
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t i) {
+                    visits[i]++;
+                    if (!utility::InParallelRegion()) {
+                        in_region = false;
+                    }
+                },
+                64);
+        EXPECT_TRUE(in_region);
+        EXPECT_EQ(visits, std::vector<int>(n, 1));
+
+        std::atomic<int64_t> sum(0);
+        utility::ParallelForRange(5, n, 1000, [&](int64_t begin, int64_t end) {
+            int64_t local_sum = 0;
+            for (int64_t i = begin; i < end; ++i) {
+                local_sum += i;
+            }
+            sum += local_sum;
+        });
+        EXPECT_EQ(sum.load(), (n - 1) * n / 2 - 10);
+    }
+    utility::SetParallelExecutor(nullptr);
+}
+
+TEST(Parallel, CustomExecutor) {
+    auto executor = std::make_shared<CountingExecutor>();
+    utility::SetParallelExecutor(executor);
+    EXPECT_EQ(utility::GetMaxParallelism(), 8);
+
+    std::vector<int> visits(1000, 0);
+    utility::ParallelFor(
+            0, 1000, [&](int64_t i) { visits[i]++; }, 10);
+    EXPECT_EQ(visits, std::vector<int>(1000, 1));
+    EXPECT_EQ(executor->num_calls_, 1);
+    EXPECT_EQ(executor->last_max_parallelism_, 8);
+
+    {
+        utility::ScopedMaxParallelism bound(3);
+        EXPECT_EQ(utility::GetMaxParallelism(), 3);
+        utility::ParallelFor(
+                0, 1000, [&](int64_t i) { visits[i]++; }, 10);
+        EXPECT_EQ(executor->last_max_parallelism_, 3);
+
+        // A bound of 1 runs on the calling thread without the executor.
+        utility::ScopedMaxParallelism serial(1);
+        utility::ParallelFor(
+                0, 1000, [&](int64_t i) { visits[i]++; }, 10);
+        EXPECT_EQ(executor->num_calls_, 2);
+    }
+    EXPECT_EQ(utility::GetMaxParallelism(), 8);
+    EXPECT_EQ(visits, std::vector<int>(1000, 3));
+
+    // Empty ranges do not reach the executor.
+    utility::ParallelFor(0, 0, [&](int64_t i) { visits[i]++; });
+    EXPECT_EQ(executor->num_calls_, 2);
+
+    utility::SetParallelExecutor(nullptr);
+    EXPECT_NE(utility::GetParallelExecutor(), executor);
+}
+
+TEST(Parallel, ScopedMaxParallelism) {
+    utility::SetParallelExecutor(utility::CreateTBBExecutor());
+    utility::ScopedMaxParallelism bound(2);
+    std::mutex threads_mutex;
+    std::set<std::thread::id> threads;
+    utility::ParallelFor(0, 10000, [&](int64_t) {
+        std::lock_guard<std::mutex> lock(threads_mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+    EXPECT_LE(threads.size(), 2u);
+    utility::SetParallelExecutor(nullptr);
+}
+
+}  // namespace tests
+}  // namespace open3d
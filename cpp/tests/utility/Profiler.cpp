@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <thread>
+
+#include "open3d/utility/Timer.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Profiler, NestedZones) {
+    utility::Profiler::Clear();
+    utility::Profiler::Enable();
+    {
+        OPEN3D_PROFILE_SCOPE("Outer");
+        { OPEN3D_PROFILE_SCOPE("Inner"); }
+        { OPEN3D_PROFILE_SCOPE("Inner"); }
+    }
+    utility::Profiler::Enable(false);
+    { OPEN3D_PROFILE_SCOPE("Disabled"); }
+
+    std::vector<utility::Profiler::Zone> zones =
+            utility::Profiler::GetZones();
+    ASSERT_EQ(zones.size(), 3u);
+    EXPECT_STREQ(zones[0].name_, "Outer");
+    EXPECT_EQ(zones[0].depth_, 0);
+    for (int i = 1; i < 3; ++i) {
+        EXPECT_STREQ(zones[i].name_, "Inner");
+        EXPECT_EQ(zones[i].depth_, 1);
+        EXPECT_EQ(zones[i].track_, zones[0].track_);
+        EXPECT_GE(zones[i].start_ms_, zones[0].start_ms_);
+        EXPECT_LE(zones[i].start_ms_ + zones[i].duration_ms_,
+                  zones[0].start_ms_ + zones[0].duration_ms_);
+    }
+    utility::Profiler::LogSummary();
+
+    utility::Profiler::Clear();
+    EXPECT_TRUE(utility::Profiler::GetZones().empty());
+}
+
+TEST(Profiler, Threads) {
+    utility::Profiler::Clear();
+    utility::Profiler::Enable();
+    { OPEN3D_PROFILE_SCOPE("Main"); }
+    std::thread thread([]() { OPEN3D_PROFILE_SCOPE("Worker"); });
+    thread.join();
+    utility::Profiler::Enable(false);
+
+    // Zones of exited threads are kept.
+    std::vector<utility::Profiler::Zone> zones =
+            utility::Profiler::GetZones();
+    ASSERT_EQ(zones.size(), 2u);
+    EXPECT_NE(zones[0].track_, zones[1].track_);
+    EXPECT_EQ(zones[1].depth_, 0);
+    utility::Profiler::Clear();
+}
+
+TEST(Profiler, ScopeTimer) {
+    utility::Profiler::Clear();
+    utility::Profiler::Enable();
+    { utility::ScopeTimer timer(std::string("Dynamic") + " name"); }
+    utility::Profiler::Enable(false);
+
+    std::vector<utility::Profiler::Zone> zones =
+            utility::Profiler::GetZones();
+    ASSERT_EQ(zones.size(), 1u);
+    EXPECT_STREQ(zones[0].name_, "Dynamic name");
+    utility::Profiler::Clear();
+}
+
+TEST(Profiler, ChromeTrace) {
+    utility::Profiler::Clear();
+    utility::Profiler::AddZone("Quoted \"zone\"", "CUDA:0", 0,
+                               utility::Timer::GetSystemTimeInMilliseconds(),
+                               1.5);
+    const std::string json = utility::Profiler::ToChromeTraceJSON();
+    EXPECT_NE(json.find("\"name\":\"CUDA:0\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Quoted \\\"zone\\\"\""),
+              std::string::npos);
+    EXPECT_NE(json.find("\"dur\":1500.000"), std::string::npos);
+    EXPECT_EQ(json.find(",\n]"), std::string::npos);
+    utility::Profiler::Clear();
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/OcclusionBuffer.h"
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+using visualization::rendering::OcclusionBuffer;
+
+// OpenGL perspective projection with a 90 degree field of view, looking
+// down -z
+Eigen::Matrix4f Perspective(float near, float far) {
+    Eigen::Matrix4f proj = Eigen::Matrix4f::Zero();
+    proj(0, 0) = 1.f;
+    proj(1, 1) = 1.f;
+    proj(2, 2) = -(far + near) / (far - near);
+    proj(2, 3) = -2.f * far * near / (far - near);
+    proj(3, 2) = -1.f;
+    return proj;
+}
+
+// A square in the plane z = \p z, from -half_size to half_size
+void AddSquare(OcclusionBuffer& buffer, float z, float half_size) {
+    const std::vector<Eigen::Vector3f> vertices = {
+            {-half_size, -half_size, z},
+            {half_size, -half_size, z},
+            {half_size, half_size, z},
+            {-half_size, half_size, z}};
+    const std::vector<Eigen::Vector3i> triangles = {{0, 1, 2}, {0, 2, 3}};
+    buffer.AddOccluder(vertices, triangles, Eigen::Matrix4f::Identity());
+}
+
+}  // namespace
+
+TEST(OcclusionBuffer, IsOccluded) {
+    OcclusionBuffer buffer;
+    buffer.Reset(64, 48, Perspective(0.1f, 100.f));
+    AddSquare(buffer, -2.f, 1.f);
+    buffer.BuildHierarchy();
+    const Eigen::Matrix4f identity = Eigen::Matrix4f::Identity();
+
+    // Behind the square
+    EXPECT_TRUE(buffer.IsOccluded({-0.5f, -0.5f, -6.f}, {0.5f, 0.5f, -5.f},
+                                  identity));
+    // In front of the square
+    EXPECT_FALSE(buffer.IsOccluded({-0.5f, -0.5f, -1.5f}, {0.5f, 0.5f, -1.f},
+                                   identity));
+    // Behind the square, but sticking out at the side
+    EXPECT_FALSE(buffer.IsOccluded({-0.5f, -0.5f, -6.f}, {4.f, 0.5f, -5.f},
+                                   identity));
+    // Intersecting the square
+    EXPECT_FALSE(buffer.IsOccluded({-0.5f, -0.5f, -3.f}, {0.5f, 0.5f, -1.f},
+                                   identity));
+    // Crossing the near plane
+    EXPECT_FALSE(buffer.IsOccluded({-0.5f, -0.5f, -6.f}, {0.5f, 0.5f, 1.f},
+                                   identity));
+
+    // The model transform moves the box from behind the square to its side
+    Eigen::Matrix4f model = identity;
+    model(0, 3) = 8.f;
+    EXPECT_FALSE(buffer.IsOccluded({-0.5f, -0.5f, -6.f}, {0.5f, 0.5f, -5.f},
+                                   model));
+}
+
+TEST(OcclusionBuffer, EmptyBuffer) {
+    OcclusionBuffer buffer;
+    EXPECT_FALSE(buffer.IsOccluded({-1.f, -1.f, -6.f}, {1.f, 1.f, -5.f},
+                                   Eigen::Matrix4f::Identity()));
+    buffer.Reset(16, 16, Perspective(0.1f, 100.f));
+    buffer.BuildHierarchy();
+    EXPECT_FALSE(buffer.IsOccluded({-1.f, -1.f, -6.f}, {1.f, 1.f, -5.f},
+                                   Eigen::Matrix4f::Identity()));
+}
+
+}  // namespace tests
+}  // namespace open3d
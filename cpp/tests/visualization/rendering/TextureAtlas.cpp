@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/TextureAtlas.h"
+
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/visualization/rendering/Model.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+using visualization::rendering::Material;
+using visualization::rendering::TriangleMeshModel;
+
+std::shared_ptr<geometry::Image> SolidImage(int size, std::uint8_t value) {
+    auto img = std::make_shared<geometry::Image>();
+    img->Prepare(size, size, 3, 1);
+    std::fill(img->data_.begin(), img->data_.end(), value);
+    return img;
+}
+
+std::shared_ptr<geometry::TriangleMesh> UnitTriangle() {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    mesh->triangles_ = {{0, 1, 2}};
+    mesh->triangle_uvs_ = {{0, 0}, {1, 0}, {0.5, 0.5}};
+    return mesh;
+}
+
+}  // namespace
+
+TEST(TextureAtlas, PackTextureAtlases) {
+    TriangleMeshModel model;
+    for (unsigned int i = 0; i < 2; ++i) {
+        Material material;
+        material.shader = "defaultLit";
+        material.albedo_img = SolidImage(8, std::uint8_t(100 * (i + 1)));
+        model.materials_.push_back(material);
+        model.meshes_.push_back({UnitTriangle(), "mesh" + std::to_string(i),
+                                 i});
+    }
+
+    EXPECT_EQ(visualization::rendering::PackTextureAtlases(model), 2);
+    ASSERT_EQ(model.meshes_.size(), 1u);
+    ASSERT_EQ(model.materials_.size(), 3u);
+
+    const auto& mesh = *model.meshes_[0].mesh;
+    const auto& atlas = *model.materials_[model.meshes_[0].material_idx]
+                                 .albedo_img;
+    EXPECT_EQ(mesh.vertices_.size(), 6u);
+    EXPECT_EQ(mesh.triangles_.size(), 2u);
+    ASSERT_EQ(mesh.triangle_uvs_.size(), 6u);
+    // The center UV of each triangle samples that triangle's texture
+    for (int t = 0; t < 2; ++t) {
+        const auto& uv = mesh.triangle_uvs_[3 * t + 2];
+        EXPECT_GE(uv.x(), 0.0);
+        EXPECT_LE(uv.x(), 1.0);
+        const int x = int(uv.x() * atlas.width_);
+        const int y = int(uv.y() * atlas.height_);
+        EXPECT_EQ(*atlas.PointerAt<std::uint8_t>(x, y, 0), 100 * (t + 1));
+    }
+}
+
+TEST(TextureAtlas, RepeatingUvsAreNotPacked) {
+    TriangleMeshModel model;
+    for (unsigned int i = 0; i < 2; ++i) {
+        Material material;
+        material.albedo_img = SolidImage(8, 255);
+        model.materials_.push_back(material);
+        model.meshes_.push_back({UnitTriangle(), "mesh" + std::to_string(i),
+                                 i});
+    }
+    model.meshes_[1].mesh->triangle_uvs_[0] = {2.0, 0.0};
+
+    EXPECT_EQ(visualization::rendering::PackTextureAtlases(model), 0);
+    EXPECT_EQ(model.meshes_.size(), 2u);
+    EXPECT_EQ(model.materials_.size(), 2u);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -145,38 +145,34 @@ int main(int argc, char** argv) {
                                             block_resolution, block_count,
                                             T_frame_to_model, device);
 
-    // Initialize frame
+    // Frames are loaded and uploaded on a separate thread, overlapping with
+    // tracking, integration and ray casting of the previous frame.
     t::geometry::Image ref_depth =
             *t::io::CreateImageFromFile(depth_filenames[0]);
-    t::pipelines::voxelhashing::Frame input_frame(
-            ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
-    t::pipelines::voxelhashing::Frame raycast_frame(
-            ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
-
-    // Iterate over frames
-    for (size_t i = 0; i < iterations; ++i) {
-        // Load image into frame
-        t::geometry::Image input_depth =
-                *t::io::CreateImageFromFile(depth_filenames[i]);
-        t::geometry::Image input_color =
-                *t::io::CreateImageFromFile(color_filenames[i]);
-        input_frame.SetDataFromImage("depth", input_depth);
-        input_frame.SetDataFromImage("color", input_color);
-
-        if (i > 0) {
-            utility::LogInfo("Frame-to-model for the frame {}", i);
-
-            Tensor delta_frame_to_model =
-                    model.TrackFrameToModel(input_frame, raycast_frame,
-                                            depth_scale, depth_max, depth_diff);
-            T_frame_to_model =
-                    T_frame_to_model.Matmul(delta_frame_to_model).Contiguous();
-        }
-
-        model.UpdateFramePose(i, T_frame_to_model);
-        model.Integrate(input_frame, depth_scale, depth_max);
-        model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.3, depth_max);
-    }
+    size_t frame_idx = 0;
+    auto loader = [&](t::geometry::Image& depth, t::geometry::Image& color) {
+        if (frame_idx >= iterations) return false;
+        depth = *t::io::CreateImageFromFile(depth_filenames[frame_idx]);
+        color = *t::io::CreateImageFromFile(color_filenames[frame_idx]);
+        ++frame_idx;
+        return true;
+    };
+
+    t::pipelines::voxelhashing::Option option;
+    option.depth_scale = depth_scale;
+    option.depth_max = depth_max;
+    option.depth_diff = depth_diff;
+    t::pipelines::voxelhashing::Pipeline pipeline(
+            model, intrinsic_t, ref_depth.GetRows(), ref_depth.GetCols(),
+            loader, option);
+    pipeline.Run();
+
+    auto stats = pipeline.GetStats();
+    utility::LogInfo(
+            "{} frames, per frame: {:.2f} ms (load {:.2f}, wait {:.2f}, "
+            "track {:.2f}, integrate {:.2f}, raycast {:.2f})",
+            stats.frame_count, stats.frame_ms, stats.load_ms, stats.wait_ms,
+            stats.track_ms, stats.integrate_ms, stats.raycast_ms);
 
     if (utility::ProgramOptionExists(argc, argv, "--pointcloud")) {
         std::string filename = utility::GetProgramOptionAsString(
@@ -48,8 +48,12 @@ if _build_config["BUILD_GUI"] and not (_find_library('c++abi') or
     except StopIteration:  # Not found: check system paths while loading
         pass
 
+# OPEN3D_DEVICE_API=cpu skips loading the CUDA pybind library and probing the
+# CUDA driver, which shortens the import time of CPU-only (e.g. headless
+# geometry processing) workloads on CUDA builds.
 __DEVICE_API__ = 'cpu'
-if _build_config["BUILD_CUDA_MODULE"]:
+if (_build_config["BUILD_CUDA_MODULE"] and
+        os.environ.get('OPEN3D_DEVICE_API', '').lower() != 'cpu'):
     # Load CPU pybind dll gracefully without introducing new python variable.
     # Do this before loading the CUDA pybind dll to correctly resolve symbols
     try:  # StopIteration if cpu version not available
@@ -76,7 +80,6 @@ if __DEVICE_API__ == 'cpu':
     from open3d.cpu import pybind
 
 import open3d.core
-import open3d.visualization
 
 __version__ = "@PROJECT_VERSION@"
 
@@ -100,4 +103,27 @@ if "@BUILD_JUPYTER_EXTENSION@" == "ON":
 if 'OPEN3D_ML_ROOT' in os.environ:
     print('Using external Open3D-ML in {}'.format(os.environ['OPEN3D_ML_ROOT']))
     sys.path.append(os.environ['OPEN3D_ML_ROOT'])
-import open3d.ml
+
+# open3d.visualization and open3d.ml pull in the GUI and Open3D-ML Python
+# packages, which are slow to import and not needed by most geometry
+# processing scripts. They are imported on first attribute access (PEP 562).
+# Set OPEN3D_EAGER_IMPORT=1 to restore eager imports.
+_lazy_submodules = ('visualization', 'ml')
+
+if (sys.version_info < (3, 7) or
+        os.environ.get('OPEN3D_EAGER_IMPORT', '0') not in ('', '0')):
+    import open3d.visualization
+    import open3d.ml
+else:
+
+    def __getattr__(name):
+        if name in _lazy_submodules:
+            import importlib
+            module = importlib.import_module('.' + name, __name__)
+            globals()[name] = module
+            return module
+        raise AttributeError("module {!r} has no attribute {!r}".format(
+            __name__, name))
+
+    def __dir__():
+        return sorted(set(globals()) | set(_lazy_submodules))
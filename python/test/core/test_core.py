@@ -330,6 +330,56 @@ def test_tensor_to_numpy_scope():
     np.testing.assert_equal(dst_t, src_t)
 
 
+def test_tensor_array_interface():
+    # np.asarray shares memory with the Tensor.
+    o3d_t = o3d.core.Tensor([[0, 1, 2], [3, 4, 5]],
+                            dtype=o3d.core.Dtype.Float32)
+    np_t = np.asarray(o3d_t)
+    assert np_t.dtype == np.float32
+    np_t[0, 0] = 10
+    np.testing.assert_equal(o3d_t.numpy(), np_t)
+
+    # Non-contiguous Tensor.
+    np.testing.assert_equal(np.asarray(o3d_t[:, 1:]), np_t[:, 1:])
+
+    # from_array_interface shares memory and keeps the source alive.
+    src_t = np.arange(12, dtype=np.int32).reshape(3, 4)[:, ::2]
+    o3d_t = o3d.core.Tensor.from_array_interface(src_t)
+    src_t[0, 0] = 100
+    np.testing.assert_equal(o3d_t.numpy(), src_t)
+    del src_t
+    np.testing.assert_equal(o3d_t.numpy(), [[100, 2], [4, 6], [8, 10]])
+
+    with pytest.raises(AttributeError):
+        o3d_t.__cuda_array_interface__
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_tensor_cuda_array_interface(device):
+    if device.get_type() != o3d.core.Device.DeviceType.CUDA:
+        return
+    cp = pytest.importorskip("cupy")
+
+    # CuPy wraps the Tensor's memory.
+    o3d_t = o3d.core.Tensor([[0, 1, 2], [3, 4, 5]],
+                            dtype=o3d.core.Dtype.Float32,
+                            device=device)
+    with pytest.raises(AttributeError):
+        o3d_t.__array_interface__
+    cp_t = cp.asarray(o3d_t)
+    cp_t[0, 0] = 10
+    np.testing.assert_equal(o3d_t.cpu().numpy(), cp.asnumpy(cp_t))
+
+    # The Tensor wraps CuPy's memory and keeps it alive.
+    cp_t = cp.arange(12, dtype=cp.int64).reshape(3, 4)[:, ::2]
+    o3d_t = o3d.core.Tensor.from_array_interface(cp_t)
+    assert o3d_t.device.get_type() == o3d.core.Device.DeviceType.CUDA
+    cp_t[0, 0] = 100
+    del cp_t
+    np.testing.assert_equal(o3d_t.cpu().numpy(),
+                            [[100, 2], [4, 6], [8, 10]])
+
+
 @pytest.mark.parametrize("dtype", list_non_bool_dtypes())
 @pytest.mark.parametrize("device", list_devices())
 def test_binary_ew_ops(dtype, device):
@@ -161,3 +161,25 @@ def test_radius_search():
                                 o3c.Tensor.from_numpy(query_batches),
                                 o3c.Tensor.from_numpy(dataset_batches),
                                 11.0).numpy()
+
+
+@pytest.mark.skipif(o3c.cuda.device_count() == 0,
+                    reason="CUDA device is not available")
+def test_radius_search_cuda():
+    points = np.array([[0, 0, 0], [1, 0, 0], [0, 1, 0], [0, 0, 1], [1, 1, 1],
+                       [5, 0, 0], [5, 1, 0]],
+                      dtype=np.float32)
+    device = o3c.Device('CUDA:0')
+
+    indices = radius_search(
+        o3c.Tensor.from_numpy(points).to(device),
+        o3c.Tensor.from_numpy(points).to(device),
+        o3c.Tensor.from_numpy(np.array([2, 3, 2], dtype=np.int32)).to(device),
+        o3c.Tensor.from_numpy(np.array([3, 2, 2], dtype=np.int32)).to(device),
+        11.0)
+    assert indices.device == device
+
+    indices_ref = np.array([[0, 1, 2], [1, 0, 2], [3, 4, -1], [3, 4, -1],
+                            [4, 3, -1], [5, 6, -1], [6, 5, -1]],
+                           dtype=np.int32)
+    np.testing.assert_equal(indices.cpu().numpy(), indices_ref)
@@ -47,8 +47,11 @@ pytestmark = mltest.default_marks
 # yapf: enable
 @mltest.parametrize.ml
 @pytest.mark.parametrize('dtype', [np.float32])
+# 0 selects the fused GPU kernel, 64 the GEMM path
+@pytest.mark.parametrize('max_temp_mem_MB', [0, 64])
 def test_compare_to_conv3d(ml, dtype, filter_size, out_channels, in_channels,
-                           with_inp_importance, with_normalization):
+                           with_inp_importance, with_normalization,
+                           max_temp_mem_MB):
     """Compares to the 3D convolution in tensorflow"""
 
     # This test requires tensorflow
@@ -64,7 +67,7 @@ def test_compare_to_conv3d(ml, dtype, filter_size, out_channels, in_channels,
         'coordinate_mapping': 'identity',
         'normalize': with_normalization,
         'interpolation': 'nearest_neighbor',
-        'max_temp_mem_MB': 0,
+        'max_temp_mem_MB': max_temp_mem_MB,
     }
 
     filters = np.random.random(size=(*filter_size, in_channels,
@@ -407,3 +410,84 @@ def test_cconv_gradient(ml, dtype, filter_size, out_channels, in_channels,
         debug_outputs=dbg,
         **tolerance)
     assert transpose_feature_gradient_OK
+
+
+# yapf: disable
+@pytest.mark.parametrize("filter_size, out_channels, in_channels",[
+                             ([3,3,3],            8,          16),
+                             ([3,5,1],            5,           7),
+                        ])
+# yapf: enable
+@mltest.parametrize.ml_gpu_only
+@pytest.mark.parametrize('max_temp_mem_MB', [0, 64])
+def test_cconv_half(ml, filter_size, out_channels, in_channels,
+                    max_temp_mem_MB):
+    """Compares half precision filters and features to float"""
+    if ml.module.__name__ != 'torch':
+        pytest.skip('half features are only supported by the torch ops')
+
+    np.random.seed(0)
+
+    conv_attrs = {
+        'align_corners': True,
+        'coordinate_mapping': 'ball_to_cube_radial',
+        'normalize': True,
+        'interpolation': 'linear',
+        'max_temp_mem_MB': max_temp_mem_MB,
+    }
+
+    filters = np.random.random(size=(*filter_size, in_channels,
+                                     out_channels)).astype(np.float32)
+    inp_positions = np.random.rand(256, 3).astype(np.float32)
+    out_positions = np.random.rand(64, 3).astype(np.float32)
+    extent = np.array([[0.4]], dtype=np.float32)
+    offset = np.array([0.0, 0.0, 0.0], dtype=np.float32)
+    inp_features = np.random.uniform(size=inp_positions.shape[0:1] +
+                                     (in_channels,)).astype(np.float32)
+    inp_importance = np.empty((0,), dtype=np.float32)
+    neighbors_importance = np.empty((0,), dtype=np.float32)
+
+    fixed_radius_search = ml.layers.FixedRadiusSearch(metric='Linf')
+    neighbors_index, neighbors_row_splits, _ = mltest.run_op(
+        ml, ml.device, False, fixed_radius_search, inp_positions, out_positions,
+        extent[0, 0] / 2)
+
+    out_features_gradient = np.random.rand(out_positions.shape[0],
+                                           out_channels).astype(np.float32)
+
+    results = []
+    for dtype in (np.float32, np.float16):
+        conv_kwargs = dict(out_positions=out_positions,
+                           extents=extent,
+                           offset=offset,
+                           inp_positions=inp_positions,
+                           inp_importance=inp_importance,
+                           neighbors_index=neighbors_index,
+                           neighbors_importance=neighbors_importance,
+                           neighbors_row_splits=neighbors_row_splits,
+                           **conv_attrs)
+        filters_ = filters.astype(dtype)
+        inp_features_ = inp_features.astype(dtype)
+        y = mltest.run_op(ml,
+                          ml.device,
+                          True,
+                          ml.ops.continuous_conv,
+                          filters=filters_,
+                          inp_features=inp_features_,
+                          **conv_kwargs)
+        filters_backprop = mltest.run_op_grad(ml,
+                                              ml.device,
+                                              True,
+                                              ml.ops.continuous_conv,
+                                              filters_,
+                                              '',
+                                              out_features_gradient.astype(
+                                                  dtype),
+                                              filters=filters_,
+                                              inp_features=inp_features_,
+                                              **conv_kwargs)
+        results.append((y.astype(np.float32),
+                        filters_backprop.astype(np.float32)))
+
+    for expected, actual in zip(*results):
+        np.testing.assert_allclose(actual, expected, rtol=1e-2, atol=1e-2)
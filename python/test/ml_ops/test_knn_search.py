@@ -38,7 +38,7 @@ dtypes = pytest.mark.parametrize('dtype', [np.float32, np.float64])
 
 
 @dtypes
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml
 @pytest.mark.parametrize('num_points_queries', [(2, 5), (31, 33), (33, 31),
                                                 (123, 345)])
 @pytest.mark.parametrize('metric', ['L1', 'L2'])
@@ -109,7 +109,7 @@ def test_knn_search(dtype, ml, num_points_queries, metric, ignore_query_point,
                 np.testing.assert_allclose(dist, gt_dist, rtol=1e-7, atol=1e-8)
 
 
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml
 def test_knn_search_empty_point_sets(ml):
     rng = np.random.RandomState(123)
 
@@ -157,7 +157,7 @@ def test_knn_search_empty_point_sets(ml):
     assert ans.neighbors_distance.shape == (0,)
 
 
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml
 @pytest.mark.parametrize('batch_size', [2, 3, 8])
 def test_knn_search_batches(ml, batch_size):
 
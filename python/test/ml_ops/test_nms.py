@@ -74,3 +74,32 @@ def test_nms_empty(ml):
 
     np.testing.assert_equal(keep_indices, keep_indices_ref)
     assert keep_indices.dtype == keep_indices_ref.dtype
+
+
+@mltest.parametrize.ml
+def test_batched_nms(ml):
+    boxes = np.array([[15.0811, -7.9803, 15.6721, -6.8714, 0.5152],
+                      [15.1166, -7.9261, 15.7060, -6.8137, 0.6501],
+                      [15.1304, -7.8129, 15.7069, -6.8903, 0.7296],
+                      [15.2050, -7.8447, 15.8311, -6.7437, 1.0506],
+                      [15.1343, -7.8136, 15.7121, -6.8479, 1.0352],
+                      [15.0931, -7.9552, 15.6675, -7.0056, 0.5979]],
+                     dtype=np.float32)
+    scores = np.array([3, 1.1, 5, 2, 1, 0], dtype=np.float32)
+    labels = np.array([0, 1, 0, 1, 1, 0], dtype=np.int64)
+    nms_overlap_thresh = 0.7
+    # Box 1 and 5 survive because they are in a different class than the
+    # boxes suppressing them in the single class case.
+    keep_indices_ref = np.array([2, 3, 1, 5]).astype(np.int64)
+
+    keep_indices = mltest.run_op(ml,
+                                 ml.device,
+                                 True,
+                                 ml.ops.batched_nms,
+                                 boxes,
+                                 scores,
+                                 labels,
+                                 nms_overlap_thresh=nms_overlap_thresh)
+
+    np.testing.assert_equal(keep_indices, keep_indices_ref)
+    assert keep_indices.dtype == keep_indices_ref.dtype
@@ -48,3 +48,23 @@ def test_furthest_point_sampling(ml):
         'https://storage.googleapis.com/isl-datasets/open3d-dev/test/ml_ops/data/sampling/out.npy'
     )
     np.testing.assert_equal(ans, expected)
+
+
+@mltest.parametrize.ml_gpu_only
+def test_furthest_point_sampling_large(ml):
+    # Large point counts use the kernels with multiple blocks per item.
+    rng = np.random.RandomState(123)
+    values = rng.rand(2, 20000, 3).astype(np.float32)
+    samples = 32
+
+    ans = mltest.run_op(ml, ml.device, True, ml.ops.furthest_point_sampling,
+                        values, samples)
+
+    expected = np.zeros((values.shape[0], samples), dtype=np.int32)
+    for b, points in enumerate(values):
+        dists = np.full(points.shape[0], np.inf, dtype=np.float32)
+        for j in range(1, samples):
+            diff = points - points[expected[b, j - 1]]
+            dists = np.minimum(dists, np.sum(diff * diff, axis=1))
+            expected[b, j] = np.argmax(dists)
+    np.testing.assert_equal(ans, expected)
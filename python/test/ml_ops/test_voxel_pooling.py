@@ -45,7 +45,7 @@ feature_functions = pytest.mark.parametrize(
     'feature_fn', ['average', 'max', 'nearest_neighbor'])
 
 
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml
 @position_dtypes
 @feature_dtypes
 @position_functions
@@ -121,7 +121,7 @@ def test_voxel_pooling(ml, pos_dtype, feat_dtype, position_fn, feature_fn):
     np.testing.assert_allclose(ans.pooled_features, expected_features[index])
 
 
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml
 @position_dtypes
 @feature_dtypes
 @position_functions
@@ -144,7 +144,7 @@ gradient_feature_dtypes = pytest.mark.parametrize('feat_dtype',
                                                   [np.float32, np.float64])
 
 
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml
 @position_dtypes
 @gradient_feature_dtypes
 @position_functions
@@ -42,11 +42,16 @@ import pytest
         ([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], False),
         # Datatypes
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float64), False),
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float32), False),
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int32), False),
         (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int32), False),
+        # Large float32 array, converted in parallel
+        (np.random.rand(300000, 3).astype(np.float32), False),
         # Slice non-contiguous memory
         (np.array([[1, 2, 3, 4, 5], [6, 7, 8, 9, 10]],
                   dtype=np.float64)[:, 0:6:2], False),
+        (np.array([[1, 2, 3, 4, 5], [6, 7, 8, 9, 10]],
+                  dtype=np.float32)[:, 0:6:2], False),
         # Transpose view
         (np.array([[1, 4], [2, 5], [3, 6]], dtype=np.float64).T, False),
         # Fortran layout
@@ -189,6 +194,13 @@ def test_benchmark():
     print("numpy -> open3d: %.6fs" % (time.time() - start_time))
     np.testing.assert_allclose(x, z)
 
+    x = x.astype(np.float32)
+    print("\no3d.utility.Vector3dVector (float32):", x.shape)
+    start_time = time.time()
+    y = o3d.utility.Vector3dVector(x)
+    print("open3d -> numpy: %.6fs" % (time.time() - start_time))
+    np.testing.assert_allclose(x, np.asarray(y))
+
     print("\no3d.utility.Vector3iVector:", x.shape)
     x = np.random.randint(10, size=(vector_size, 3)).astype(np.int32)
     start_time = time.time()
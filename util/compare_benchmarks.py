@@ -0,0 +1,93 @@
+"""Compare two Google Benchmark JSON reports and flag regressions.
+
+Produce the reports on each commit with, e.g.:
+
+    ./bin/benchmarks --benchmark_out=base.json --benchmark_out_format=json \
+        --benchmark_repetitions=5 --benchmark_report_aggregates_only=true
+
+and compare them with:
+
+    python util/compare_benchmarks.py base.json head.json --threshold 0.1
+
+The exit code is 1 if any benchmark present in both reports is slower by more
+than the threshold (relative to the base), 0 otherwise.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_times(path, metric):
+    """Return {benchmark name: time in ns} of a Google Benchmark JSON report.
+
+    If the report contains aggregates, only the median is used.
+    """
+    unit_to_ns = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    with open(path) as f:
+        report = json.load(f)
+
+    has_aggregates = any(
+        b.get("run_type") == "aggregate" for b in report["benchmarks"])
+    times = {}
+    for b in report["benchmarks"]:
+        if has_aggregates:
+            if b.get("aggregate_name") != "median":
+                continue
+            name = b["run_name"]
+        else:
+            name = b["name"]
+        times[name] = b[metric] * unit_to_ns[b.get("time_unit", "ns")]
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two Google Benchmark JSON reports.")
+    parser.add_argument("base", help="JSON report of the base commit.")
+    parser.add_argument("head", help="JSON report of the commit to check.")
+    parser.add_argument("--threshold",
+                        type=float,
+                        default=0.1,
+                        help="Relative slowdown reported as a regression.")
+    parser.add_argument("--metric",
+                        choices=["real_time", "cpu_time"],
+                        default="real_time")
+    args = parser.parse_args()
+
+    base = load_times(args.base, args.metric)
+    head = load_times(args.head, args.metric)
+
+    regressions = []
+    name_width = max([len(name) for name in base] + [9])
+    print("{:<{w}} {:>12} {:>12} {:>8}".format("Benchmark",
+                                               "Base (ms)",
+                                               "Head (ms)",
+                                               "Change",
+                                               w=name_width))
+    for name in sorted(base.keys() & head.keys()):
+        change = head[name] / base[name] - 1.0 if base[name] > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            regressions.append(name)
+            flag = " REGRESSION"
+        print("{:<{w}} {:>12.3f} {:>12.3f} {:>+7.1%}{}".format(name,
+                                                               base[name] / 1e6,
+                                                               head[name] / 1e6,
+                                                               change,
+                                                               flag,
+                                                               w=name_width))
+    for name in sorted(base.keys() - head.keys()):
+        print("{:<{w}} only in base".format(name, w=name_width))
+    for name in sorted(head.keys() - base.keys()):
+        print("{:<{w}} only in head".format(name, w=name_width))
+
+    if regressions:
+        print("{} benchmark(s) regressed by more than {:.0%}.".format(
+            len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())